@@ -1,12 +1,41 @@
 /**
  * @file fonts.h
  * @brief Embedded font data for TinyVK
+ *
+ * Every font lives in its own source file under src/assets/fonts and only the
+ * fonts listed in the TINYVK_EMBEDDED_FONTS CMake option are compiled in.
+ * Referencing the data of a font left out fails to link, look fonts up by
+ * name with FindEmbeddedFont() to handle both cases.
  */
 
 #pragma once
 
+#include "../core/types.h"
+
 namespace tvk {
 
+/**
+ * @brief Font compiled into the library
+ */
+struct EmbeddedFont {
+    const char* name;              // Source file name, e.g. "roboto_medium"
+    const unsigned char* data;     // TrueType data
+    unsigned int size;
+};
+
+/**
+ * @brief Find an embedded font by name
+ * Also accepts the short names of ImGuiConfig::embeddedFontName: "roboto",
+ * "lexend", "quicksand" and "droid"
+ * @return nullptr if the font is not embedded
+ */
+const EmbeddedFont* FindEmbeddedFont(const char* name);
+
+/**
+ * @brief Fonts compiled into this build
+ */
+const EmbeddedFont* GetEmbeddedFonts(u32& count);
+
 extern unsigned char roboto_medium[];
 extern unsigned int roboto_medium_size;
 
@@ -10,6 +10,11 @@
 #include <string>
 #include <chrono>
 #include <vector>
+#include <functional>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 // Forward declare Vulkan types
 struct VkCommandBuffer_T;
@@ -22,6 +27,7 @@ class Renderer;
 class ImGuiLayer;
 class RenderWidget;
 class VulkanContext;
+class JobSystem;
 
 /**
  * @brief Application rendering mode
@@ -43,6 +49,16 @@ struct AppConfig {
     bool decorated = true;
     AppMode mode = AppMode::Hybrid;
     bool enableDockspace = true;
+    u32 workerThreads = 0;        // Job system workers including the main thread, 0 uses the hardware thread count
+    bool lowLatency = false;      // Wait for the previous frame to be displayed before sampling input
+    u32 maxFramesInFlight = 2;    // Upper bound for Renderer::SetFramesInFlight()
+    bool onDemand = false;        // Only render on input, RequestRedraw(), animations and background work, meant for GUI mode
+    float idleRedrawInterval = 0.0f;   // Seconds between redraws while idle in on-demand mode, 0 waits for events only
+    float fixedTimestep = 0.0f;   // Seconds per OnFixedUpdate() step, 0 disables fixed updates
+    u32 maxFixedSteps = 8;        // Steps per frame at most, time beyond is dropped so slow frames cannot spiral
+    bool threadedSimulation = false;   // Run OnFixedUpdate() on a simulation thread while the frame renders
+    bool asyncLogging = true;     // Write the log on a background thread, unless Log::Init() was already called
+    std::string logFile;          // Also write the log to this file when set
 };
 
 // Legacy alias
@@ -103,6 +119,11 @@ public:
     float ElapsedTime() const { return _elapsedTime; }
     float FPS() const { return _fps; }
     
+    // Fixed timestep simulation, FixedAlpha() interpolates from the previous to the latest step
+    float FixedTimestep() const { return _fixedTimestep; }
+    float FixedAlpha() const { return _fixedAlpha; }
+    u64 FixedStepCount() const { return _fixedStepCount; }
+    
     // Window info
     u32 WindowWidth() const;
     u32 WindowHeight() const;
@@ -124,6 +145,35 @@ public:
     VkCommandBuffer GetCommandBuffer();
     VulkanContext& GetContext();
     void SetClearColor(float r, float g, float b, float a = 1.0f);
+    
+    // Job system, usable from OnUpdate() and OnRender()
+    JobSystem& GetJobs();
+    
+    /**
+     * @brief Render the next frame in on-demand mode, callable from any thread
+     * The frames after input are rendered without a request
+     */
+    void RequestRedraw();
+    
+    /**
+     * @brief Render continuously for the given number of seconds in on-demand mode
+     */
+    void RequestAnimation(float seconds);
+    
+    /**
+     * @brief Enable or disable on-demand rendering
+     * While idle the loop sleeps in Window::WaitEvents() and OnUpdate(), OnUI() and all GPU work are skipped
+     */
+    void SetOnDemand(bool enabled) { _onDemand = enabled; RequestRedraw(); }
+    bool IsOnDemand() const { return _onDemand; }
+    
+    /**
+     * @brief Record swapchain render pass commands across the job system
+     * function(cmd, begin, end) is called for chunks of [0, count) with a secondary command buffer
+     * of the worker running it. Call from OnRender(), the commands execute ahead of the ones
+     * recorded into OnRender()'s command buffer
+     */
+    void RecordParallel(u32 count, u32 chunkSize, const std::function<void(VkCommandBuffer, u32, u32)>& function);
 
 protected:
     /**
@@ -136,6 +186,21 @@ protected:
      */
     virtual void OnUpdate() {}
 
+    /**
+     * @brief Called at the rate of AppConfig::fixedTimestep, zero or more times per frame before OnUpdate()
+     * With AppConfig::threadedSimulation it runs on the simulation thread while the frame renders,
+     * only touch simulation state there
+     * @param dt The fixed timestep in seconds
+     */
+    virtual void OnFixedUpdate(float dt) {}
+    
+    /**
+     * @brief Called on the main thread between two batches of OnFixedUpdate() with threaded simulation
+     * The simulation thread is idle, copy the state that rendering reads here. Rendering then shows
+     * the state one frame behind the simulation
+     */
+    virtual void OnFixedSync() {}
+
     /**
      * @brief Called every frame - override to draw your ImGui UI
      * This is where you write all your ImGui code
@@ -170,9 +235,19 @@ private:
     void Initialize(const AppConfig& config);
     void Shutdown();
     void MainLoop();
+    bool IsRedrawDue() const;
+    void WaitForRedraw();
+    void BeginRedraw();
+    float Now() const;
+    void StepSimulation();
+    void StartSimulationThread();
+    void StopSimulationThread();
+    void WaitForSimulation();
+    void SimulationThread();
 
     static inline App* _instance = nullptr;
 
+    Scope<JobSystem> _jobs;
     Scope<Window> _window;
     Scope<Renderer> _renderer;
     Scope<ImGuiLayer> _imguiLayer;
@@ -181,6 +256,31 @@ private:
     
     AppMode _mode = AppMode::Hybrid;
     bool _enableDockspace = true;
+    
+    // On-demand rendering
+    bool _onDemand = false;
+    float _idleRedrawInterval = 0.0f;
+    std::atomic<bool> _redrawRequested{true};
+    u32 _redrawFrames = 0;        // Frames still rendered after the last input
+    u64 _seenEventCount = 0;
+    float _animateUntil = 0.0f;
+    float _lastRedrawTime = 0.0f;
+    
+    // Fixed timestep simulation
+    float _fixedTimestep = 0.0f;
+    u32 _maxFixedSteps = 8;
+    bool _threadedSimulation = false;
+    float _fixedAccumulator = 0.0f;
+    float _fixedAlpha = 0.0f;
+    float _pendingAlpha = 0.0f;   // Alpha of the batch running on the simulation thread
+    u64 _fixedStepCount = 0;
+    
+    std::thread _simThread;
+    std::mutex _simMutex;
+    std::condition_variable _simWake;
+    std::condition_variable _simDone;
+    u32 _simSteps = 0;            // Steps of the running batch, 0 when idle
+    bool _simExit = false;
 
     bool _running = false;
     float _deltaTime = 0.0f;
@@ -0,0 +1,40 @@
+/**
+ * @file hash.h
+ * @brief Hashing helpers for cache keys
+ */
+
+#pragma once
+
+#include "types.h"
+#include <string>
+
+namespace tvk {
+
+constexpr u64 HashSeed = 14695981039346656037ull;
+
+/**
+ * @brief FNV-1a hash of a byte range, pass a previous hash as seed to chain ranges
+ */
+inline u64 HashBytes(const void* data, size_t size, u64 seed = HashSeed) {
+    const u8* bytes = static_cast<const u8*>(data);
+    u64 hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+inline u64 HashString(const std::string& value, u64 seed = HashSeed) {
+    return HashBytes(value.data(), value.size(), seed);
+}
+
+/**
+ * @brief Hash a trivially copyable value
+ */
+template<typename T>
+inline u64 HashValue(const T& value, u64 seed = HashSeed) {
+    return HashBytes(&value, sizeof(T), seed);
+}
+
+} // namespace tvk
@@ -7,6 +7,9 @@
 
 #include "types.h"
 #include <GLFW/glfw3.h>
+#include <bitset>
+#include <chrono>
+#include <vector>
 
 namespace tvk {
 
@@ -97,8 +100,65 @@ enum class MouseButton : i32 {
     Button8 = GLFW_MOUSE_BUTTON_8
 };
 
+enum class InputEventType : u8 {
+    Key,
+    Char,
+    MouseButton,
+    MouseMove,
+    Scroll
+};
+
+/**
+ * @brief Input event as delivered by GLFW, with the time it was received
+ */
+struct InputEvent {
+    InputEventType type = InputEventType::Key;
+    i32 code = 0;                    // Key, MouseButton or codepoint
+    i32 action = 0;                  // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT for keys and buttons
+    i32 mods = 0;                    // GLFW_MOD_* flags for keys and buttons
+    Vec2 value = {0.0f, 0.0f};       // Cursor position or scroll offset
+    std::chrono::steady_clock::time_point time;
+};
+
+/**
+ * @brief Key and button state of one frame
+ *
+ * Presses and releases are collected from the events, so a key pressed and
+ * released again between two frames still counts as pressed for one frame.
+ * Plain data, copy it to hand the input of a frame to another thread.
+ */
+struct InputSnapshot {
+    static constexpr u32 KeyCount = GLFW_KEY_LAST + 1;
+    static constexpr u32 MouseButtonCount = GLFW_MOUSE_BUTTON_LAST + 1;
+
+    std::bitset<KeyCount> keysHeld;
+    std::bitset<KeyCount> keysPressed;             // Since the previous snapshot
+    std::bitset<KeyCount> keysReleased;
+    std::bitset<MouseButtonCount> buttonsHeld;
+    std::bitset<MouseButtonCount> buttonsPressed;
+    std::bitset<MouseButtonCount> buttonsReleased;
+    Vec2 mousePosition = {0.0f, 0.0f};
+    Vec2 mouseDelta = {0.0f, 0.0f};
+    Vec2 scrollDelta = {0.0f, 0.0f};               // Summed over all scroll events
+    std::chrono::steady_clock::time_point time;    // When the snapshot was taken
+
+    bool IsKeyHeld(Key key) const { return IsKey(key) && keysHeld[static_cast<u32>(key)]; }
+    bool IsKeyPressed(Key key) const { return IsKey(key) && keysPressed[static_cast<u32>(key)]; }
+    bool IsKeyReleased(Key key) const { return IsKey(key) && keysReleased[static_cast<u32>(key)]; }
+    bool IsButtonHeld(MouseButton button) const { return buttonsHeld[static_cast<u32>(button)]; }
+    bool IsButtonPressed(MouseButton button) const { return buttonsPressed[static_cast<u32>(button)]; }
+    bool IsButtonReleased(MouseButton button) const { return buttonsReleased[static_cast<u32>(button)]; }
+
+    static bool IsKey(Key key) { return static_cast<u32>(key) < KeyCount; }
+};
+
 /**
  * @brief Input handling class
+ *
+ * GLFW callbacks record events and key state as they arrive, Update() turns
+ * them into the snapshot of the frame. Queries read the snapshot and do not
+ * call into GLFW. Use it from the main thread, with threaded simulation copy
+ * GetSnapshot() in App::OnFixedSync().
  */
 class Input {
 public:
@@ -127,6 +187,16 @@ public:
      */
     static bool IsMouseButtonPressed(MouseButton button);
 
+    /**
+     * @brief Check if a mouse button was just pressed this frame
+     */
+    static bool IsMouseButtonDown(MouseButton button);
+
+    /**
+     * @brief Check if a mouse button was just released this frame
+     */
+    static bool IsMouseButtonUp(MouseButton button);
+
     /**
      * @brief Get current mouse position
      */
@@ -147,18 +217,42 @@ public:
      */
     static void SetCursorMode(int mode);
 
+    /**
+     * @brief State of the current frame
+     */
+    static const InputSnapshot& GetSnapshot() { return s_Snapshot; }
+
+    /**
+     * @brief Events received before the current frame's Update(), oldest first
+     */
+    static const std::vector<InputEvent>& GetEvents() { return s_Events; }
+
     /**
      * @brief Update input state (call once per frame)
+     * Takes the snapshot and the events received since the previous call
      */
     static void Update();
 
+    static constexpr size_t MaxEventsPerFrame = 4096;   // Further events only update the state
+
 private:
     static inline GLFWwindow* s_Window = nullptr;
-    static inline Vec2 s_LastMousePos = {0.0f, 0.0f};
-    static inline Vec2 s_MouseDelta = {0.0f, 0.0f};
-    static inline Vec2 s_ScrollDelta = {0.0f, 0.0f};
-    static inline bool s_FirstMouse = true;
+    static inline InputSnapshot s_Snapshot;
+    static inline InputSnapshot s_Pending;            // Written by the callbacks until Update()
+    static inline std::vector<InputEvent> s_Events;
+    static inline std::vector<InputEvent> s_PendingEvents;
+    static inline GLFWkeyfun s_PrevKeyCallback = nullptr;
+    static inline GLFWcharfun s_PrevCharCallback = nullptr;
+    static inline GLFWmousebuttonfun s_PrevMouseButtonCallback = nullptr;
+    static inline GLFWcursorposfun s_PrevCursorPosCallback = nullptr;
+    static inline GLFWscrollfun s_PrevScrollCallback = nullptr;
+
+    static void PushEvent(const InputEvent& event);
 
+    static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void CharCallback(GLFWwindow* window, unsigned int codepoint);
+    static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void CursorPosCallback(GLFWwindow* window, double x, double y);
     static void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset);
 };
 
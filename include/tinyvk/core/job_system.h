@@ -0,0 +1,193 @@
+/**
+ * @file job_system.h
+ * @brief Work-stealing job scheduler for TinyVK
+ */
+
+#pragma once
+
+#include "types.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tvk {
+
+class JobSystem;
+
+/**
+ * @brief A unit of work scheduled on the job system
+ */
+struct Job {
+    std::function<void()> function;
+    class JobCounter* counter = nullptr;
+};
+
+/**
+ * @brief Counts unfinished jobs, used to wait for them or to start dependent jobs
+ * Wait on it with JobSystem::Wait() before destroying it
+ */
+class JobCounter {
+public:
+    JobCounter() = default;
+
+    // Non-copyable
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    /**
+     * @brief Check if every job added to the counter has finished
+     */
+    bool IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; }
+
+    /**
+     * @brief Get number of unfinished jobs
+     */
+    u32 GetValue() const { return m_Value.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<u32> m_Value{0};
+
+    // Jobs started by JobSystem::RunAfter() once the value drops to zero
+    std::mutex m_Mutex;
+    std::vector<Job*> m_Continuations;
+};
+
+/**
+ * @brief Bounded lock-free work-stealing deque (Chase-Lev)
+ * The owning worker pushes and pops at the bottom, other workers steal from the top
+ */
+class JobQueue {
+public:
+    explicit JobQueue(u32 capacity = 4096);
+
+    // Non-copyable
+    JobQueue(const JobQueue&) = delete;
+    JobQueue& operator=(const JobQueue&) = delete;
+
+    /**
+     * @brief Push a job, owner only
+     * @return false if the queue is full
+     */
+    bool Push(Job* job);
+
+    /**
+     * @brief Pop the most recently pushed job, owner only
+     */
+    Job* Pop();
+
+    /**
+     * @brief Steal the oldest job, any thread
+     */
+    Job* Steal();
+
+private:
+    std::vector<std::atomic<Job*>> m_Jobs;
+    i64 m_Mask = 0;
+    alignas(64) std::atomic<i64> m_Top{0};
+    alignas(64) std::atomic<i64> m_Bottom{0};
+};
+
+/**
+ * @brief Fixed pool of workers executing jobs from per-worker deques
+ *
+ * The thread that calls Init() is worker 0 and runs jobs while it waits.
+ *
+ * Example:
+ * @code
+ * JobCounter counter;
+ * jobs.Run([]{ SimulateParticles(); }, &counter);
+ * jobs.RunAfter(counter, []{ BuildDrawList(); });
+ * jobs.ParallelFor(count, 256, [&](u32 begin, u32 end) { ... });
+ * jobs.Wait(counter);
+ * @endcode
+ */
+class JobSystem {
+public:
+    static constexpr u32 InvalidWorker = ~0u;
+
+    JobSystem() = default;
+    ~JobSystem();
+
+    // Non-copyable
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Start the workers
+     * @param workerCount Number of workers including the calling thread, 0 uses the hardware thread count
+     */
+    bool Init(u32 workerCount = 0);
+
+    /**
+     * @brief Stop the workers, jobs that have not started are dropped
+     */
+    void Cleanup();
+
+    /**
+     * @brief Schedule a job
+     * @param counter Incremented now and decremented once the job finished
+     */
+    void Run(std::function<void()> function, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Schedule a job that starts once every job of the dependency finished
+     */
+    void RunAfter(JobCounter& dependency, std::function<void()> function, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Run function(begin, end) over [0, count) in chunks and wait for all of them
+     */
+    void ParallelFor(u32 count, u32 chunkSize, const std::function<void(u32, u32)>& function);
+
+    /**
+     * @brief Schedule function(begin, end) over [0, count) in chunks without waiting
+     * The function must stay alive until the counter is done
+     */
+    void ParallelFor(u32 count, u32 chunkSize, const std::function<void(u32, u32)>& function, JobCounter& counter);
+
+    /**
+     * @brief Wait for the counter, running other jobs meanwhile
+     */
+    void Wait(JobCounter& counter);
+
+    /**
+     * @brief Get number of workers including the main thread
+     */
+    u32 GetWorkerCount() const { return static_cast<u32>(m_Queues.size()); }
+
+    /**
+     * @brief Get the worker index of the calling thread, InvalidWorker outside the job system
+     */
+    static u32 GetWorkerIndex();
+
+    bool IsRunning() const { return m_Running.load(std::memory_order_acquire); }
+
+private:
+    void WorkerLoop(u32 index);
+    void Schedule(Job* job);
+    void Execute(Job* job);
+    void Finish(JobCounter* counter);
+    Job* FindJob(u32 index);
+
+    std::vector<Scope<JobQueue>> m_Queues;
+    std::vector<std::thread> m_Threads;
+    std::atomic<bool> m_Running{false};
+
+    // Jobs scheduled from threads that are not workers
+    std::mutex m_InboxMutex;
+    std::vector<Job*> m_Inbox;
+    std::atomic<u32> m_InboxCount{0};
+
+    // Idle workers sleep until jobs are scheduled
+    std::mutex m_WakeMutex;
+    std::condition_variable m_WakeCondition;
+    std::atomic<u32> m_PendingJobs{0};
+    std::atomic<u32> m_SleepingWorkers{0};
+};
+
+} // namespace tvk
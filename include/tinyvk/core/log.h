@@ -8,7 +8,20 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <cstdarg>
+#include <vector>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+// Log calls below this level are compiled out: 0 Trace, 1 Debug, 2 Info, 3 Warn, 4 Error, 5 Fatal, 6 none
+#ifndef TVK_LOG_MIN_LEVEL
+    #define TVK_LOG_MIN_LEVEL 0
+#endif
 
 namespace tvk {
 
@@ -21,89 +34,264 @@ enum class LogLevel {
     Fatal
 };
 
+/**
+ * @brief Log backend configuration for Log::Init()
+ */
+struct LogConfig {
+    bool async = true;                 // Write on a background thread, callers only format and enqueue
+    bool console = true;               // Write to stdout
+    bool consoleStderr = false;        // Write the console output to stderr instead, keeping stdout to program output
+    std::vector<std::string> files;    // Appended to, created if missing
+    size_t queueCapacity = 4096;       // Queue slots, rounded up to a power of two. A full queue blocks callers
+};
+
+/**
+ * @brief Fixed-size buffer a message is formatted into, one per thread
+ */
+class LogBuffer {
+public:
+    static constexpr size_t Capacity = 4096;   // Longer messages are cut off
+
+    void Clear() { m_Size = 0; m_Truncated = false; }
+
+    void Append(char c) {
+        if (m_Size < Capacity) m_Data[m_Size++] = c;
+        else m_Truncated = true;
+    }
+
+    void Append(std::string_view text) {
+        size_t count = text.size();
+        if (count > Capacity - m_Size) {
+            count = Capacity - m_Size;
+            m_Truncated = true;
+        }
+        std::memcpy(m_Data + m_Size, text.data(), count);
+        m_Size += count;
+    }
+
+    // Marks a cut off message with a trailing "..."
+    void Finish() {
+        if (m_Truncated) std::memcpy(m_Data + Capacity - 3, "...", 3);
+    }
+
+    char* End() { return m_Data + m_Size; }
+    size_t Remaining() const { return Capacity - m_Size; }
+    void Advance(size_t count) { m_Size += count; }
+
+    const char* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    char m_Data[Capacity];
+    size_t m_Size = 0;
+    bool m_Truncated = false;
+};
+
+/**
+ * @brief Formats "{}" placeholders and writes the message to the sinks
+ *
+ * Messages are formatted into a per-thread LogBuffer without allocating.
+ * Without Init() they are written synchronously to stdout, the way they always
+ * were. With an async LogConfig they are copied into a lock-free queue instead,
+ * and a writer thread drains it in batches into the console and file sinks.
+ * Fatal messages flush the queue before returning.
+ */
 class Log {
 public:
     static void SetLevel(LogLevel level) { s_Level = level; }
     static LogLevel GetLevel() { return s_Level; }
 
+    /**
+     * @brief Configure the sinks and start the writer thread for async logging
+     * @return false if already initialized or no sink could be opened
+     */
+    static bool Init(const LogConfig& config);
+
+    /**
+     * @brief Write pending messages, stop the writer and close the file sinks
+     * Logging keeps working synchronously to stdout afterwards
+     */
+    static void Shutdown();
+
+    /**
+     * @brief Block until every message logged so far has been written
+     */
+    static void Flush();
+
+    /**
+     * @brief Also write to a file, works with and without Init()
+     */
+    static bool AddFileSink(const std::string& path);
+
+    static bool IsInitialized();
+    static bool IsAsync();
+
     template<typename... Args>
     static void Trace(const char* fmt, Args&&... args) {
-        if (s_Level <= LogLevel::Trace)
-            Print("[TRACE]", fmt, std::forward<Args>(args)...);
+        if constexpr (TVK_LOG_MIN_LEVEL <= 0) {
+            if (s_Level <= LogLevel::Trace)
+                Print(LogLevel::Trace, "[TRACE]", fmt, std::forward<Args>(args)...);
+        }
     }
 
     template<typename... Args>
     static void Debug(const char* fmt, Args&&... args) {
-        if (s_Level <= LogLevel::Debug)
-            Print("[DEBUG]", fmt, std::forward<Args>(args)...);
+        if constexpr (TVK_LOG_MIN_LEVEL <= 1) {
+            if (s_Level <= LogLevel::Debug)
+                Print(LogLevel::Debug, "[DEBUG]", fmt, std::forward<Args>(args)...);
+        }
     }
 
     template<typename... Args>
     static void Info(const char* fmt, Args&&... args) {
-        if (s_Level <= LogLevel::Info)
-            Print("[INFO]", fmt, std::forward<Args>(args)...);
+        if constexpr (TVK_LOG_MIN_LEVEL <= 2) {
+            if (s_Level <= LogLevel::Info)
+                Print(LogLevel::Info, "[INFO]", fmt, std::forward<Args>(args)...);
+        }
     }
 
     template<typename... Args>
     static void Warn(const char* fmt, Args&&... args) {
-        if (s_Level <= LogLevel::Warn)
-            Print("[WARN]", fmt, std::forward<Args>(args)...);
+        if constexpr (TVK_LOG_MIN_LEVEL <= 3) {
+            if (s_Level <= LogLevel::Warn)
+                Print(LogLevel::Warn, "[WARN]", fmt, std::forward<Args>(args)...);
+        }
     }
 
     template<typename... Args>
     static void Error(const char* fmt, Args&&... args) {
-        if (s_Level <= LogLevel::Error)
-            Print("[ERROR]", fmt, std::forward<Args>(args)...);
+        if constexpr (TVK_LOG_MIN_LEVEL <= 4) {
+            if (s_Level <= LogLevel::Error)
+                Print(LogLevel::Error, "[ERROR]", fmt, std::forward<Args>(args)...);
+        }
     }
 
+    // Not affected by TVK_LOG_MIN_LEVEL, so assertions always report
     template<typename... Args>
     static void Fatal(const char* fmt, Args&&... args) {
         if (s_Level <= LogLevel::Fatal)
-            Print("[FATAL]", fmt, std::forward<Args>(args)...);
+            Print(LogLevel::Fatal, "[FATAL]", fmt, std::forward<Args>(args)...);
     }
 
 private:
     static inline LogLevel s_Level = LogLevel::Trace;
 
     template<typename... Args>
-    static void Print(const char* prefix, const char* fmt, Args&&... args) {
-        std::ostringstream oss;
-        oss << prefix << " ";
-        FormatTo(oss, fmt, std::forward<Args>(args)...);
-        std::cout << oss.str() << std::endl;
+    static void Print(LogLevel level, const char* prefix, const char* fmt, Args&&... args) {
+        thread_local LogBuffer buffer;
+        buffer.Clear();
+        buffer.Append(prefix);
+        buffer.Append(' ');
+        FormatTo(buffer, fmt, std::forward<Args>(args)...);
+        buffer.Finish();
+        Submit(level, buffer.GetData(), buffer.GetSize());
     }
 
-    static void FormatTo(std::ostringstream& oss, const char* fmt) {
-        oss << fmt;
+    static void Submit(LogLevel level, const char* text, size_t size);
+
+    static void FormatTo(LogBuffer& buffer, const char* fmt) {
+        buffer.Append(fmt);
     }
 
     template<typename T, typename... Args>
-    static void FormatTo(std::ostringstream& oss, const char* fmt, T&& value, Args&&... args) {
+    static void FormatTo(LogBuffer& buffer, const char* fmt, T&& value, Args&&... args) {
         while (*fmt) {
             if (*fmt == '{' && *(fmt + 1) == '}') {
-                oss << std::forward<T>(value);
-                FormatTo(oss, fmt + 2, std::forward<Args>(args)...);
+                FormatValue(buffer, value);
+                FormatTo(buffer, fmt + 2, std::forward<Args>(args)...);
                 return;
             }
-            oss << *fmt++;
+            buffer.Append(*fmt++);
+        }
+    }
+
+    // Unscoped enums print as their value, like with streams
+    template<typename T>
+    static constexpr bool IsPlainEnum() {
+        if constexpr (std::is_enum_v<T>) return std::is_convertible_v<T, std::underlying_type_t<T>>;
+        else return false;
+    }
+
+    template<typename T>
+    static void FormatValue(LogBuffer& buffer, const T& value) {
+        using U = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<U, bool>) {
+            buffer.Append(value ? '1' : '0');
+        } else if constexpr (std::is_same_v<U, char>) {
+            buffer.Append(value);
+        } else if constexpr (std::is_integral_v<U>) {
+            auto result = std::to_chars(buffer.End(), buffer.End() + buffer.Remaining(), value);
+            if (result.ec == std::errc()) buffer.Advance(static_cast<size_t>(result.ptr - buffer.End()));
+        } else if constexpr (std::is_floating_point_v<U>) {
+            // Same digits as the default stream formatting
+            char text[32];
+            int count = std::snprintf(text, sizeof(text), "%g", static_cast<double>(value));
+            if (count > 0) buffer.Append(std::string_view(text, static_cast<size_t>(count)));
+        } else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+            buffer.Append(value ? std::string_view(value) : std::string_view("(null)"));
+        } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+            buffer.Append(std::string_view(value));
+        } else if constexpr (std::is_pointer_v<U>) {
+            char text[32];
+            int count = std::snprintf(text, sizeof(text), "%p", static_cast<const void*>(value));
+            if (count > 0) buffer.Append(std::string_view(text, static_cast<size_t>(count)));
+        } else if constexpr (IsPlainEnum<U>()) {
+            FormatValue(buffer, static_cast<std::underlying_type_t<U>>(value));
+        } else {
+            // Other types go through their stream operator, the stream is reused
+            thread_local std::ostringstream stream;
+            stream.str(std::string());
+            stream.clear();
+            stream << value;
+            buffer.Append(stream.str());
         }
     }
 };
 
-// Convenience macros
-#define TVK_LOG_TRACE(...) ::tvk::Log::Trace(__VA_ARGS__)
-#define TVK_LOG_DEBUG(...) ::tvk::Log::Debug(__VA_ARGS__)
-#define TVK_LOG_INFO(...)  ::tvk::Log::Info(__VA_ARGS__)
-#define TVK_LOG_WARN(...)  ::tvk::Log::Warn(__VA_ARGS__)
-#define TVK_LOG_ERROR(...) ::tvk::Log::Error(__VA_ARGS__)
-#define TVK_LOG_FATAL(...) ::tvk::Log::Fatal(__VA_ARGS__)
+// Convenience macros, levels below TVK_LOG_MIN_LEVEL do not evaluate their arguments
+#if TVK_LOG_MIN_LEVEL <= 0
+    #define TVK_LOG_TRACE(...) ::tvk::Log::Trace(__VA_ARGS__)
+#else
+    #define TVK_LOG_TRACE(...) ((void)0)
+#endif
+
+#if TVK_LOG_MIN_LEVEL <= 1
+    #define TVK_LOG_DEBUG(...) ::tvk::Log::Debug(__VA_ARGS__)
+#else
+    #define TVK_LOG_DEBUG(...) ((void)0)
+#endif
+
+#if TVK_LOG_MIN_LEVEL <= 2
+    #define TVK_LOG_INFO(...)  ::tvk::Log::Info(__VA_ARGS__)
+#else
+    #define TVK_LOG_INFO(...)  ((void)0)
+#endif
+
+#if TVK_LOG_MIN_LEVEL <= 3
+    #define TVK_LOG_WARN(...)  ::tvk::Log::Warn(__VA_ARGS__)
+#else
+    #define TVK_LOG_WARN(...)  ((void)0)
+#endif
+
+#if TVK_LOG_MIN_LEVEL <= 4
+    #define TVK_LOG_ERROR(...) ::tvk::Log::Error(__VA_ARGS__)
+#else
+    #define TVK_LOG_ERROR(...) ((void)0)
+#endif
+
+#if TVK_LOG_MIN_LEVEL <= 5
+    #define TVK_LOG_FATAL(...) ::tvk::Log::Fatal(__VA_ARGS__)
+#else
+    #define TVK_LOG_FATAL(...) ((void)0)
+#endif
 
 #ifdef TVK_DEBUG_BUILD
     #define TVK_ASSERT(condition, ...) \
         do { \
             if (!(condition)) { \
-                TVK_LOG_FATAL("Assertion failed: {}", #condition); \
-                TVK_LOG_FATAL(__VA_ARGS__); \
+                ::tvk::Log::Fatal("Assertion failed: {}", #condition); \
+                ::tvk::Log::Fatal(__VA_ARGS__); \
                 std::abort(); \
             } \
         } while (false)
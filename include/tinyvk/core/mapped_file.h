@@ -0,0 +1,47 @@
+/**
+ * @file mapped_file.h
+ * @brief Read-only memory mapped files
+ */
+
+#pragma once
+
+#include "types.h"
+#include <string>
+
+namespace tvk {
+
+/**
+ * @brief Maps a whole file read-only into the address space
+ * Pages are loaded on first access, so only the parts that are read cost I/O
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Non-copyable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Movable
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    const u8* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    bool IsOpen() const { return m_Data != nullptr; }
+
+private:
+    const u8* m_Data = nullptr;
+    size_t m_Size = 0;
+
+#ifdef TVK_PLATFORM_WINDOWS
+    void* m_File = nullptr;
+    void* m_Mapping = nullptr;
+#endif
+};
+
+} // namespace tvk
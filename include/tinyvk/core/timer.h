@@ -2,12 +2,19 @@
 
 #include <chrono>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
+#include <deque>
+#include <array>
+#include <memory>
+#include <atomic>
 #include <functional>
 #include <mutex>
 #include <algorithm>
 #include <numeric>
+#include <iterator>
+#include <cstdint>
 
 namespace tinyvk {
 
@@ -109,10 +116,59 @@ private:
     Callback m_callback;
 };
 
+/**
+ * @brief Fixed capacity history that overwrites its oldest value
+ * Indexed oldest first. For ImGui::PlotLines() pass data(), size() and offset()
+ */
+template<typename T, size_t Capacity>
+class RingHistory {
+public:
+    void push(const T& value) {
+        m_values[m_head] = value;
+        m_head = (m_head + 1) % Capacity;
+        if (m_size < Capacity) m_size++;
+    }
+
+    void clear() {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+    [[nodiscard]] static constexpr size_t capacity() { return Capacity; }
+
+    /// Value i, 0 being the oldest
+    [[nodiscard]] const T& operator[](size_t i) const { return m_values[(offset() + i) % Capacity]; }
+
+    /// Most recent value
+    [[nodiscard]] const T& back() const { return m_values[(m_head + Capacity - 1) % Capacity]; }
+
+    /// Raw storage, the oldest value is at offset()
+    [[nodiscard]] const T* data() const { return m_values.data(); }
+    [[nodiscard]] size_t offset() const { return m_size < Capacity ? 0 : m_head; }
+
+    /// Copy out oldest first
+    [[nodiscard]] std::vector<T> toVector() const {
+        std::vector<T> result(m_size);
+        for (size_t i = 0; i < m_size; i++) {
+            result[i] = (*this)[i];
+        }
+        return result;
+    }
+
+private:
+    std::array<T, Capacity> m_values{};
+    size_t m_head = 0;
+    size_t m_size = 0;
+};
+
 /**
  * @brief Statistics for a profiled section
  */
 struct ProfileStats {
+    static constexpr size_t MaxHistorySize = 120;
+
     std::string name;
     double lastTime = 0.0;      // Last recorded time in ms
     double totalTime = 0.0;     // Total accumulated time in ms
@@ -120,9 +176,7 @@ struct ProfileStats {
     double maxTime = 0.0;       // Maximum time in ms
     double avgTime = 0.0;       // Average time in ms
     uint64_t callCount = 0;     // Number of times called
-    std::vector<double> history; // Recent history for graphing
-
-    static constexpr size_t MaxHistorySize = 120;
+    RingHistory<double, MaxHistorySize> history; // Recent history for graphing
 
     void addSample(double timeMs) {
         lastTime = timeMs;
@@ -137,10 +191,7 @@ struct ProfileStats {
             avgTime = totalTime / static_cast<double>(callCount);
         }
 
-        history.push_back(timeMs);
-        if (history.size() > MaxHistorySize) {
-            history.erase(history.begin());
-        }
+        history.push(timeMs);
     }
 
     void reset() {
@@ -150,8 +201,81 @@ struct ProfileStats {
     }
 };
 
+/// Identifies an interned section name, see Profiler::intern()
+using ProfileId = uint32_t;
+
+/**
+ * @brief A timed section recorded by one thread
+ */
+struct ProfileEvent {
+    ProfileId id = 0;
+    uint32_t depth = 0;         // Sections open on the thread when it began
+    int64_t startNs = 0;        // Since the profiler started, see Profiler::now()
+    int64_t endNs = 0;
+};
+
+/**
+ * @brief Events of one thread, written by it without locks and drained by Profiler::collect()
+ *
+ * Single producer, single consumer ring. When collect() falls behind the ring
+ * fills up and further events are dropped and counted.
+ */
+class ProfileThreadBuffer {
+public:
+    static constexpr uint64_t Capacity = 8192;   // Power of two
+
+    /// Called by the owning thread only
+    void push(const ProfileEvent& event) {
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= Capacity) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_events[head & (Capacity - 1)] = event;
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    /// Called by the consumer only, visits the events pushed so far in order
+    template<typename Visitor>
+    void drain(Visitor&& visitor) {
+        uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        for (; tail != head; tail++) {
+            visitor(m_events[tail & (Capacity - 1)]);
+        }
+        m_tail.store(tail, std::memory_order_release);
+    }
+
+    /// Events lost to a full ring since the last call
+    uint64_t takeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+    // Owning thread only, sections open on the thread
+    struct OpenSection {
+        ProfileId id;
+        uint32_t depth;
+        int64_t startNs;
+    };
+    uint32_t depth = 0;
+    std::vector<OpenSection> openSections;   // Begun by Profiler::begin()
+
+    uint32_t threadIndex = 0;                // Trace tid, in registration order
+    std::string threadName;                  // Guarded by the profiler
+
+private:
+    std::unique_ptr<ProfileEvent[]> m_events{new ProfileEvent[Capacity]};
+    std::atomic<uint64_t> m_head{0};
+    std::atomic<uint64_t> m_tail{0};
+    std::atomic<uint64_t> m_dropped{0};
+};
+
 /**
  * @brief Performance profiler for tracking multiple named sections
+ *
+ * Sections are identified by interned names. Recording a section only
+ * touches the calling thread's ProfileThreadBuffer, so scopes are cheap
+ * enough for hot paths and safe from any thread. The events are folded into
+ * ProfileStats by collect(), which the application calls once per frame.
+ * While a capture runs they are also kept for writeChromeTrace().
  */
 class Profiler {
 public:
@@ -160,90 +284,164 @@ public:
         return profiler;
     }
 
-    /// Start timing a section
-    void begin(const std::string& name) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_activeTimers[name] = Timer::Clock::now();
+    /// Get the id of a name, the same name always yields the same id. Locks, cache the id in hot paths
+    ProfileId intern(std::string_view name);
+
+    /// Get the name of an interned id
+    [[nodiscard]] std::string getName(ProfileId id) const;
+
+    /// Nanoseconds since the profiler started
+    [[nodiscard]] int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
     }
 
-    /// End timing a section
-    void end(const std::string& name) {
-        auto endTime = Timer::Clock::now();
-        
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_activeTimers.find(name);
-        if (it != m_activeTimers.end()) {
-            auto duration = std::chrono::duration<double, std::milli>(endTime - it->second);
-            
-            auto& stats = m_stats[name];
-            stats.name = name;
-            stats.addSample(duration.count());
-            
-            m_activeTimers.erase(it);
+    /// Get the calling thread's event buffer, registered on first use
+    ProfileThreadBuffer& threadBuffer() {
+        thread_local ProfileThreadBuffer* buffer = nullptr;
+        if (!buffer) {
+            buffer = registerThread();
         }
+        return *buffer;
+    }
+
+    /// Name the calling thread in traces
+    void setThreadName(const std::string& name);
+
+    /// Start timing a section on the calling thread
+    void begin(ProfileId id) {
+        if (!isEnabled()) return;
+
+        ProfileThreadBuffer& buffer = threadBuffer();
+        buffer.openSections.push_back({id, buffer.depth++, now()});
     }
 
-    /// Get stats for a section
-    [[nodiscard]] const ProfileStats* getStats(const std::string& name) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_stats.find(name);
-        return it != m_stats.end() ? &it->second : nullptr;
+    /// Start timing a section by name, interns on every call
+    void begin(const std::string& name) {
+        if (!isEnabled()) return;
+        begin(intern(name));
     }
 
-    /// Get all stats
-    [[nodiscard]] std::vector<ProfileStats> getAllStats() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        std::vector<ProfileStats> result;
-        result.reserve(m_stats.size());
-        for (const auto& [name, stats] : m_stats) {
-            result.push_back(stats);
+    /// End timing the section of the calling thread begun last with this id
+    /// Sections begun after it and still open are discarded
+    void end(ProfileId id) {
+        int64_t endNs = now();
+
+        ProfileThreadBuffer& buffer = threadBuffer();
+        auto& open = buffer.openSections;
+        for (auto it = open.rbegin(); it != open.rend(); ++it) {
+            if (it->id == id) {
+                buffer.push({id, it->depth, it->startNs, endNs});
+                buffer.depth = it->depth;
+                open.erase(std::next(it).base(), open.end());
+                return;
+            }
         }
-        return result;
     }
 
-    /// Reset all stats
-    void reset() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_stats.clear();
-        m_activeTimers.clear();
+    /// End timing a section by name, interns on every call
+    void end(const std::string& name) {
+        if (threadBuffer().openSections.empty()) return;
+        end(intern(name));
     }
 
-    /// Reset stats for a specific section
-    void reset(const std::string& name) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        auto it = m_stats.find(name);
-        if (it != m_stats.end()) {
-            it->second.reset();
-        }
+    /// Record a time measured elsewhere, e.g. on the GPU
+    void addSample(const std::string& name, double timeMs) {
+        if (!isEnabled()) return;
+        addSample(intern(name), timeMs);
     }
 
+    void addSample(ProfileId id, double timeMs);
+
+    /// Fold the events buffered by every thread into the stats
+    void collect();
+
+    /// Get stats for a section, as of the last collect()
+    [[nodiscard]] const ProfileStats* getStats(const std::string& name) const;
+
+    /// Get stats of every section recorded so far
+    [[nodiscard]] std::vector<ProfileStats> getAllStats() const;
+
+    /// Reset all stats, interned ids stay valid
+    void reset();
+
+    /// Reset stats for a specific section
+    void reset(const std::string& name);
+
+    /// Keep collected events, up to maxEvents, for writeChromeTrace()
+    void beginCapture(size_t maxEvents = 1 << 20);
+
+    /// Stop keeping events, the capture stays available until the next beginCapture()
+    void endCapture();
+
+    [[nodiscard]] bool isCapturing() const { return m_capturing.load(std::memory_order_relaxed); }
+    [[nodiscard]] size_t getCapturedEventCount() const;
+
+    /// Events lost to full thread buffers or a full capture
+    [[nodiscard]] uint64_t getDroppedEventCount() const;
+
+    /**
+     * @brief Write the capture as Chrome trace event JSON
+     * Opens in chrome://tracing and ui.perfetto.dev. Samples from addSample(), e.g. GPU
+     * times, become counter tracks
+     */
+    bool writeChromeTrace(const std::string& path);
+
     /// Enable/disable profiling
-    void setEnabled(bool enabled) { m_enabled = enabled; }
-    [[nodiscard]] bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
 
 private:
-    Profiler() = default;
-    
-    mutable std::mutex m_mutex;
-    std::unordered_map<std::string, Timer::TimePoint> m_activeTimers;
-    std::unordered_map<std::string, ProfileStats> m_stats;
-    bool m_enabled = true;
+    struct CaptureCounter {
+        ProfileId id;
+        int64_t timeNs;
+        double value;
+    };
+
+    struct CaptureEvent {
+        ProfileEvent event;
+        uint32_t threadIndex;
+    };
+
+    Profiler() : m_epoch(std::chrono::steady_clock::now()) {}
+
+    ProfileThreadBuffer* registerThread();
+    ProfileId internLocked(std::string_view name);
+    void collectLocked();
+
+    std::chrono::steady_clock::time_point m_epoch;
+    mutable std::mutex m_mutex;                  // Everything below, not taken when recording
+    std::unordered_map<std::string, ProfileId> m_ids;
+    std::deque<ProfileStats> m_stats;            // Indexed by id, stable for getStats()
+    std::vector<std::unique_ptr<ProfileThreadBuffer>> m_threads;
+    std::vector<CaptureEvent> m_captureEvents;
+    std::vector<CaptureCounter> m_captureCounters;
+    size_t m_captureLimit = 0;
+    uint64_t m_droppedEvents = 0;
+    std::atomic<bool> m_capturing{false};
+    std::atomic<bool> m_enabled{true};
 };
 
 /**
  * @brief RAII profiler scope that automatically begins/ends a profile section
+ * Lock free when constructed from an id, TVK_PROFILE_SCOPE() interns the name once per call site
  */
 class ProfileScope {
 public:
-    explicit ProfileScope(const std::string& name) : m_name(name) {
-        if (Profiler::instance().isEnabled()) {
-            Profiler::instance().begin(name);
+    explicit ProfileScope(ProfileId id) : m_id(id) {
+        Profiler& profiler = Profiler::instance();
+        if (profiler.isEnabled()) {
+            m_buffer = &profiler.threadBuffer();
+            m_depth = m_buffer->depth++;
+            m_start = profiler.now();
         }
     }
 
+    explicit ProfileScope(const std::string& name) : ProfileScope(Profiler::instance().intern(name)) {}
+
     ~ProfileScope() {
-        if (Profiler::instance().isEnabled()) {
-            Profiler::instance().end(m_name);
+        if (m_buffer) {
+            m_buffer->depth--;
+            m_buffer->push({m_id, m_depth, m_start, Profiler::instance().now()});
         }
     }
 
@@ -252,7 +450,10 @@ public:
     ProfileScope& operator=(const ProfileScope&) = delete;
 
 private:
-    std::string m_name;
+    ProfileThreadBuffer* m_buffer = nullptr;
+    ProfileId m_id;
+    uint32_t m_depth = 0;
+    int64_t m_start = 0;
 };
 
 /**
@@ -260,6 +461,9 @@ private:
  */
 class FrameTimer {
 public:
+    static constexpr size_t MaxHistorySize = 120;
+    using History = RingHistory<float, MaxHistorySize>;
+
     FrameTimer() = default;
 
     /// Call at the start of each frame
@@ -283,10 +487,7 @@ public:
         }
 
         // Track frame time history
-        m_frameTimeHistory.push_back(static_cast<float>(m_deltaTime * 1000.0));
-        if (m_frameTimeHistory.size() > MaxHistorySize) {
-            m_frameTimeHistory.erase(m_frameTimeHistory.begin());
-        }
+        m_frameTimeHistory.push(static_cast<float>(m_deltaTime * 1000.0));
     }
 
     /// Get delta time in seconds
@@ -299,33 +500,34 @@ public:
     [[nodiscard]] double getFPS() const { return m_fps; }
 
     /// Get frame time history for graphing (float for ImGui compatibility)
-    [[nodiscard]] const std::vector<float>& getFrameTimeHistory() const { 
+    [[nodiscard]] const History& getFrameTimeHistory() const { 
         return m_frameTimeHistory; 
     }
 
     /// Get average frame time from history
     [[nodiscard]] double getAverageFrameTimeMs() const {
         if (m_frameTimeHistory.empty()) return 0.0;
-        return std::accumulate(m_frameTimeHistory.begin(), m_frameTimeHistory.end(), 0.0f) 
+        // Order does not matter, the filled part of the storage is summed directly
+        const float* values = m_frameTimeHistory.data();
+        return std::accumulate(values, values + m_frameTimeHistory.size(), 0.0f) 
                / static_cast<double>(m_frameTimeHistory.size());
     }
 
     /// Get min/max frame time from history
     [[nodiscard]] std::pair<float, float> getMinMaxFrameTimeMs() const {
         if (m_frameTimeHistory.empty()) return {0.0f, 0.0f};
-        auto [minIt, maxIt] = std::minmax_element(m_frameTimeHistory.begin(), m_frameTimeHistory.end());
+        const float* values = m_frameTimeHistory.data();
+        auto [minIt, maxIt] = std::minmax_element(values, values + m_frameTimeHistory.size());
         return {*minIt, *maxIt};
     }
 
 private:
-    static constexpr size_t MaxHistorySize = 120;
-
     Timer::TimePoint m_frameStart;
     double m_deltaTime = 0.0;
     double m_fps = 0.0;
     double m_fpsTimer = 0.0;
     uint64_t m_frameCount = 0;
-    std::vector<float> m_frameTimeHistory;
+    History m_frameTimeHistory;
 };
 
 } // namespace tinyvk
@@ -334,13 +536,31 @@ private:
 namespace tvk {
     using tinyvk::Timer;
     using tinyvk::ScopedTimer;
+    using tinyvk::RingHistory;
     using tinyvk::ProfileStats;
+    using tinyvk::ProfileId;
+    using tinyvk::ProfileEvent;
+    using tinyvk::ProfileThreadBuffer;
     using tinyvk::Profiler;
     using tinyvk::ProfileScope;
     using tinyvk::FrameTimer;
 }
 
 // Convenience macros
-#define TVK_PROFILE_SCOPE(name) tinyvk::ProfileScope _profileScope##__LINE__(name)
+#define TVK_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TVK_PROFILE_CONCAT(a, b) TVK_PROFILE_CONCAT_IMPL(a, b)
+
+// The name is interned once per call site and must not change between calls
+#define TVK_PROFILE_SCOPE(name) \
+    static const tinyvk::ProfileId TVK_PROFILE_CONCAT(_profileId, __LINE__) = tinyvk::Profiler::instance().intern(name); \
+    tinyvk::ProfileScope TVK_PROFILE_CONCAT(_profileScope, __LINE__)(TVK_PROFILE_CONCAT(_profileId, __LINE__))
 #define TVK_PROFILE_FUNCTION() TVK_PROFILE_SCOPE(__FUNCTION__)
-#define TVK_SCOPED_TIMER(name) tinyvk::ScopedTimer _scopedTimer##__LINE__(name)
+#define TVK_PROFILE_BEGIN(name) do { \
+        static const tinyvk::ProfileId _profileId = tinyvk::Profiler::instance().intern(name); \
+        tinyvk::Profiler::instance().begin(_profileId); \
+    } while (0)
+#define TVK_PROFILE_END(name) do { \
+        static const tinyvk::ProfileId _profileId = tinyvk::Profiler::instance().intern(name); \
+        tinyvk::Profiler::instance().end(_profileId); \
+    } while (0)
+#define TVK_SCOPED_TIMER(name) tinyvk::ScopedTimer TVK_PROFILE_CONCAT(_scopedTimer, __LINE__)(name)
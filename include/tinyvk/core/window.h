@@ -133,6 +133,22 @@ public:
      */
     void WaitEvents();
 
+    /**
+     * @brief Wait for window events for at most timeout seconds
+     */
+    void WaitEventsTimeout(double timeout);
+
+    /**
+     * @brief Wake up WaitEvents() or WaitEventsTimeout(), callable from any thread
+     */
+    static void PostEmptyEvent();
+
+    /**
+     * @brief Number of input and window events received so far
+     * Changes across PollEvents() or WaitEvents() when something happened
+     */
+    u64 GetEventCount() const { return m_EventCount; }
+
     /**
      * @brief Get window position
      */
@@ -169,10 +185,20 @@ private:
     ResizeCallback m_ResizeCallback;
     CloseCallback m_CloseCallback;
     MaximizeCallback m_MaximizeCallback;
+    u64 m_EventCount = 0;
 
+    static void CountEvent(GLFWwindow* window);
     static void FramebufferResizeCallback(GLFWwindow* window, int width, int height);
     static void WindowCloseCallback(GLFWwindow* window);
     static void WindowMaximizeCallback(GLFWwindow* window, int maximized);
+    static void WindowFocusCallback(GLFWwindow* window, int focused);
+    static void WindowRefreshCallback(GLFWwindow* window);
+    static void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void CharCallback(GLFWwindow* window, unsigned int codepoint);
+    static void MouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void CursorPosCallback(GLFWwindow* window, double x, double y);
+    static void CursorEnterCallback(GLFWwindow* window, int entered);
+    static void ScrollCallback(GLFWwindow* window, double xoffset, double yoffset);
 };
 
 } // namespace tvk
@@ -0,0 +1,190 @@
+/**
+ * @file allocator.h
+ * @brief Sub-allocating GPU memory allocator for TinyVK
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include <vulkan/vulkan.h>
+#include <vector>
+
+// Forward declare VMA handles so the allocator header stays lightweight
+struct VmaAllocator_T;
+typedef VmaAllocator_T* VmaAllocator;
+struct VmaAllocation_T;
+typedef VmaAllocation_T* VmaAllocation;
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief A sub-range of a larger VkDeviceMemory block
+ */
+struct Allocation {
+    VmaAllocation handle = nullptr;
+    VkDeviceSize size = 0;
+    void* mapped = nullptr;     // Persistent mapping, only set when requested at creation
+
+    bool IsValid() const { return handle != nullptr; }
+};
+
+/**
+ * @brief Memory usage of a single Vulkan memory heap
+ */
+struct MemoryHeapStats {
+    u32 heapIndex = 0;
+    bool deviceLocal = false;
+    u32 blockCount = 0;             // Number of VkDeviceMemory blocks
+    u32 allocationCount = 0;        // Number of resources carved out of the blocks
+    VkDeviceSize blockBytes = 0;    // Bytes allocated from the driver
+    VkDeviceSize allocationBytes = 0; // Bytes actually used by resources
+    VkDeviceSize usage = 0;         // Estimated heap usage by this process
+    VkDeviceSize budget = 0;        // Estimated heap budget for this process
+};
+
+/**
+ * @brief Result of a defragmentation run
+ */
+struct DefragmentationStats {
+    VkDeviceSize bytesMoved = 0;
+    VkDeviceSize bytesFreed = 0;
+    u32 allocationsMoved = 0;
+    u32 blocksFreed = 0;
+};
+
+/**
+ * @brief Hook for resources whose memory can be moved by MemoryAllocator::Defragment()
+ *
+ * Allocations without a registered RelocatableResource are never moved.
+ */
+class RelocatableResource {
+public:
+    virtual ~RelocatableResource() = default;
+
+    /**
+     * @brief Create a replacement resource bound to the destination and record the copy
+     * @return false to keep the resource where it is
+     */
+    virtual bool BeginRelocation(VkCommandBuffer cmd, VmaAllocation destination) = 0;
+
+    /**
+     * @brief Called after the copy has finished on the GPU - swap to the new resource
+     */
+    virtual void EndRelocation() = 0;
+};
+
+/**
+ * @brief Block allocator that carves buffers and images out of large VkDeviceMemory blocks
+ *
+ * Owned by VulkanContext. Alignment and bufferImageGranularity are respected
+ * between neighbouring resources of the same block.
+ */
+class MemoryAllocator {
+public:
+    MemoryAllocator() = default;
+    ~MemoryAllocator();
+
+    // Non-copyable
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+    /**
+     * @brief Initialize the allocator for the context's device
+     * @param blockSize Preferred size of the VkDeviceMemory blocks for large heaps
+     */
+    bool Init(VulkanContext* context, VkDeviceSize blockSize);
+
+    /**
+     * @brief Release all blocks - every allocation must have been freed
+     */
+    void Cleanup();
+
+    /**
+     * @brief Create a buffer and bind it to a sub-allocation
+     * @param mapped Keep the allocation persistently mapped (host visible memory only)
+     */
+    bool CreateBuffer(const VkBufferCreateInfo& bufferInfo, VkMemoryPropertyFlags properties,
+                      VkBuffer& buffer, Allocation& allocation, bool mapped = false);
+
+    /**
+     * @brief Destroy a buffer and free its sub-allocation
+     */
+    void DestroyBuffer(VkBuffer buffer, Allocation& allocation);
+
+    /**
+     * @brief Create an image and bind it to a sub-allocation
+     */
+    bool CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties,
+                     VkImage& image, Allocation& allocation);
+
+    /**
+     * @brief Destroy an image and free its sub-allocation
+     */
+    void DestroyImage(VkImage image, Allocation& allocation);
+
+    /**
+     * @brief Bind an additional buffer to an existing allocation
+     */
+    bool BindBuffer(VmaAllocation allocation, VkBuffer buffer, VkDeviceSize offset = 0);
+
+    /**
+     * @brief Bind an image to a range of an existing allocation
+     */
+    bool BindImage(VmaAllocation allocation, VkImage image, VkDeviceSize offset = 0);
+
+    /**
+     * @brief Allocate memory without a resource, several resources can be bound to it with an offset
+     */
+    bool AllocateMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, Allocation& allocation);
+
+    /**
+     * @brief Free memory from AllocateMemory(), resources bound to it must be destroyed first
+     */
+    void FreeMemory(Allocation& allocation);
+
+    /**
+     * @brief Map the allocation (reference counted, start of the allocation)
+     */
+    void* Map(const Allocation& allocation);
+
+    /**
+     * @brief Unmap a previous Map()
+     */
+    void Unmap(const Allocation& allocation);
+
+    /**
+     * @brief Flush a range of a non-coherent allocation
+     */
+    void Flush(const Allocation& allocation, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Register the resource that owns an allocation so it can be moved
+     */
+    void SetRelocatable(const Allocation& allocation, RelocatableResource* resource);
+
+    /**
+     * @brief Compact sparsely used blocks by moving relocatable resources
+     * Waits for the device to be idle. Resource handles may change.
+     */
+    DefragmentationStats Defragment();
+
+    /**
+     * @brief Get usage statistics for every memory heap
+     */
+    std::vector<MemoryHeapStats> GetHeapStats() const;
+
+    /**
+     * @brief Advance the frame index, heap budgets are refreshed once per frame
+     */
+    void SetFrameIndex(u64 frame);
+
+    VmaAllocator GetHandle() const { return m_Allocator; }
+
+private:
+    VulkanContext* m_Context = nullptr;
+    VmaAllocator m_Allocator = nullptr;
+};
+
+} // namespace tvk
@@ -0,0 +1,164 @@
+/**
+ * @file bindless_heap.h
+ * @brief Descriptor indexing heap giving resources a stable index
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include <vulkan/vulkan.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief One descriptor set holding large arrays of every resource kind
+ *
+ * Sampled images, samplers and storage buffers are written into free array
+ * elements once and keep their index for their lifetime. Shaders look them
+ * up by indices passed through push constants or buffers, so a frame binds
+ * the set once per command buffer and bind point instead of one set per draw.
+ * Bindings are partially bound and update-after-bind: adding resources never
+ * disturbs command buffers in flight, removed indices are reused once the
+ * frames that may still read them have completed.
+ *
+ * @code
+ * // GLSL, see shaders::bindless_glsl
+ * layout(set = 0, binding = 0) uniform texture2D textures[];
+ * layout(set = 0, binding = 1) uniform sampler samplers[];
+ * outColor = texture(sampler2D(textures[nonuniformEXT(push.texture)], samplers[push.sampler]), uv);
+ * @endcode
+ */
+class BindlessHeap {
+public:
+    static constexpr u32 InvalidIndex = ~0u;
+
+    static constexpr u32 SampledImageBinding = 0;
+    static constexpr u32 SamplerBinding = 1;
+    static constexpr u32 StorageBufferBinding = 2;
+
+    // Push constant range of GetPipelineLayout(), visible to every stage
+    static constexpr u32 PushConstantSize = 128;
+
+    BindlessHeap() = default;
+    ~BindlessHeap();
+
+    // Non-copyable
+    BindlessHeap(const BindlessHeap&) = delete;
+    BindlessHeap& operator=(const BindlessHeap&) = delete;
+
+    /**
+     * @brief Create the set, capacities are clamped to the device's update-after-bind limits
+     * @return false if descriptor indexing is unsupported, the heap stays disabled
+     */
+    bool Init(VulkanContext* context, u32 maxImages, u32 maxSamplers, u32 maxBuffers);
+    void Cleanup();
+
+    bool IsEnabled() const { return m_Set != VK_NULL_HANDLE; }
+
+    /**
+     * @brief Write a resource into a free element
+     * @return Its index, InvalidIndex if the heap is disabled or full
+     */
+    u32 AddImage(VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    u32 AddBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Get the index of a sampler, shared by every resource using the same handle
+     */
+    u32 AddSampler(VkSampler sampler);
+
+    /**
+     * @brief Point an index at a new handle, e.g. after the buffer behind it was recreated
+     */
+    void UpdateImage(u32 index, VkImageView view, VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    void UpdateBuffer(u32 index, VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Free an index once the given frame has completed
+     * @param frame Last frame that may use the resource, see Renderer::GetFrameNumber()
+     */
+    void RemoveImage(u32 index, u64 frame);
+    void RemoveBuffer(u32 index, u64 frame);
+    void RemoveSampler(VkSampler sampler, u64 frame);
+
+    /**
+     * @brief Reuse indices of completed frames, called by the Renderer
+     */
+    void Collect(u64 completedFrame);
+
+    /**
+     * @brief Bind the set at index 0 of a layout compatible with GetPipelineLayout()
+     */
+    void Bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout) const;
+    void Bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint) const { Bind(cmd, bindPoint, m_PipelineLayout); }
+
+    /**
+     * @brief Push constants of GetPipelineLayout(), e.g. resource indices
+     */
+    void PushConstants(VkCommandBuffer cmd, const void* data, u32 size, u32 offset = 0) const;
+
+    template<typename T>
+    void PushConstants(VkCommandBuffer cmd, const T& data) const {
+        static_assert(sizeof(T) <= PushConstantSize, "Push constants exceed the bindless layout");
+        PushConstants(cmd, &data, sizeof(T));
+    }
+
+    VkDescriptorSetLayout GetSetLayout() const { return m_SetLayout; }
+    VkDescriptorSet GetSet() const { return m_Set; }
+
+    /**
+     * @brief Layout with the heap at set 0 and PushConstantSize bytes for all stages
+     * Pipelines sharing it keep the set bound across pipeline changes
+     */
+    VkPipelineLayout GetPipelineLayout() const { return m_PipelineLayout; }
+
+    u32 GetImageCapacity() const { return m_Images.capacity; }
+    u32 GetSamplerCapacity() const { return m_Samplers.capacity; }
+    u32 GetBufferCapacity() const { return m_Buffers.capacity; }
+
+private:
+    /**
+     * @brief Free list of one binding's array elements
+     */
+    struct IndexPool {
+        struct PendingFree {
+            u64 frame = 0;
+            u32 index = 0;
+        };
+
+        u32 capacity = 0;
+        u32 next = 0;                       // Elements below have been handed out before
+        std::vector<u32> free;
+        std::vector<PendingFree> pending;
+
+        u32 Allocate();
+        void Collect(u64 completedFrame);
+    };
+
+    struct SamplerEntry {
+        u32 index = InvalidIndex;
+        u32 refCount = 0;
+    };
+
+    void WriteImage(u32 index, VkImageView view, VkImageLayout layout);
+    void WriteBuffer(u32 index, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range);
+
+    VulkanContext* m_Context = nullptr;
+    VkDescriptorSetLayout m_SetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_Pool = VK_NULL_HANDLE;
+    VkDescriptorSet m_Set = VK_NULL_HANDLE;
+    VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+
+    std::mutex m_Mutex;
+    IndexPool m_Images;
+    IndexPool m_Samplers;
+    IndexPool m_Buffers;
+    std::unordered_map<VkSampler, SamplerEntry> m_SamplerEntries;
+};
+
+} // namespace tvk
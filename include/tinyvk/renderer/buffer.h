@@ -6,6 +6,9 @@
 #pragma once
 
 #include "../core/types.h"
+#include "allocator.h"
+#include "transfer_queue.h"
+#include "bindless_heap.h"
 #include <vulkan/vulkan.h>
 #include <vector>
 
@@ -24,16 +27,22 @@ enum class BufferUsage {
     Uniform,
     Storage,
     StorageShared,
-    Staging
+    Staging,
+    Instance,   // Per-instance vertex data, also readable as a storage buffer
+    Indirect    // Indirect draw commands and counts, writable from compute
 };
 
 /**
  * @brief GPU Buffer class
+ *
+ * Device local vertex and index buffers may be moved by MemoryAllocator::Defragment(),
+ * which changes the handle returned by GetBuffer(). Buffers usable as storage
+ * buffers stay in place, descriptor sets hold on to their handles.
  */
-class Buffer {
+class Buffer : public RelocatableResource {
 public:
     Buffer() = default;
-    ~Buffer();
+    ~Buffer() override;
 
     // Non-copyable
     Buffer(const Buffer&) = delete;
@@ -69,6 +78,21 @@ public:
         return Create(renderer, sizeof(T) * indices.size(), BufferUsage::Index, indices.data());
     }
 
+    /**
+     * @brief Create a per-instance vertex buffer from data
+     */
+    template<typename T>
+    static Ref<Buffer> CreateInstance(Renderer* renderer, const std::vector<T>& instances) {
+        return Create(renderer, sizeof(T) * instances.size(), BufferUsage::Instance, instances.data());
+    }
+
+    /**
+     * @brief Create an indirect draw buffer from commands
+     */
+    static Ref<Buffer> CreateIndirect(Renderer* renderer, const std::vector<VkDrawIndexedIndirectCommand>& commands) {
+        return Create(renderer, sizeof(VkDrawIndexedIndirectCommand) * commands.size(), BufferUsage::Indirect, commands.data());
+    }
+
     /**
      * @brief Create a uniform buffer
      */
@@ -79,12 +103,22 @@ public:
 
     /**
      * @brief Update buffer data
+     * Device local buffers are updated through the staging ring, the copy
+     * executes ahead of the current frame's commands
      * @param data Pointer to data
      * @param size Size in bytes
      * @param offset Offset in buffer
      */
     void SetData(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
 
+    /**
+     * @brief Update buffer data through the asynchronous transfer queue
+     * The buffer must not be used by the GPU until the returned handle is complete.
+     * Only buffers without contents are written asynchronously, frames in flight may still
+     * read the others. Falls back to SetData() for those, host visible buffers or without async transfers.
+     */
+    TransferHandle SetDataAsync(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
     /**
      * @brief Map buffer memory for direct access
      */
@@ -104,7 +138,9 @@ public:
     VkBuffer GetBuffer() const { return m_Buffer; }
     VkDeviceSize GetSize() const { return m_Size; }
     BufferUsage GetUsage() const { return m_Usage; }
+    u32 GetBindlessIndex() const { return m_BindlessIndex; }   // Storage buffer index in the bindless heap
     bool IsMapped() const { return m_Mapped != nullptr; }
+    bool IsHostVisible() const { return !IsDeviceLocal(m_Usage); }
 
     /**
      * @brief Bind as vertex buffer
@@ -116,19 +152,36 @@ public:
      */
     void BindAsIndex(VkCommandBuffer cmd, VkIndexType indexType = VK_INDEX_TYPE_UINT32) const;
 
+    // RelocatableResource
+    bool BeginRelocation(VkCommandBuffer cmd, VmaAllocation destination) override;
+    void EndRelocation() override;
+
 private:
+    friend class UploadBatch;
+
     bool Init(Renderer* renderer, VkDeviceSize size, BufferUsage usage, const void* data);
     void Cleanup();
+    void WaitForTransfer();
     
     static VkBufferUsageFlags ToVkUsage(BufferUsage usage);
     static VkMemoryPropertyFlags GetMemoryProperties(BufferUsage usage);
+    static bool IsDeviceLocal(BufferUsage usage);
+    static bool IsRelocatable(BufferUsage usage);
 
+    Renderer* m_Renderer = nullptr;
     VulkanContext* m_Context = nullptr;
     VkBuffer m_Buffer = VK_NULL_HANDLE;
-    VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+    VkBuffer m_RelocatedBuffer = VK_NULL_HANDLE;
+    Allocation m_Allocation;
     VkDeviceSize m_Size = 0;
     BufferUsage m_Usage = BufferUsage::Vertex;
     void* m_Mapped = nullptr;
+    u32 m_BindlessIndex = BindlessHeap::InvalidIndex;
+
+    u64 m_UploadSerial = 0;   // Upload batch of the last staged copy
+    bool m_HasUpload = false;
+    bool m_HasContents = false;         // Written or mapped, the GPU may read it from now on
+    TransferHandle m_PendingTransfer;   // Last asynchronous upload into this buffer
 };
 
 } // namespace tvk
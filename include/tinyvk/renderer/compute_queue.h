@@ -0,0 +1,233 @@
+/**
+ * @file compute_queue.h
+ * @brief Asynchronous compute on the dedicated compute queue
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "allocator.h"
+#include <vulkan/vulkan.h>
+#include <vector>
+#include <functional>
+
+namespace tvk {
+
+class VulkanContext;
+class ComputeQueue;
+
+/**
+ * @brief Pollable handle to a submitted compute batch
+ *
+ * Complete once the GPU has finished the batch. Readback callbacks of the
+ * batch run on the next ComputeQueue::Update() or Wait(). A default
+ * constructed handle is always complete.
+ */
+struct ComputeHandle {
+    ComputeQueue* queue = nullptr;
+    u64 value = 0;
+
+    bool IsValid() const { return queue != nullptr; }
+    bool IsComplete() const;
+    void Wait() const;
+};
+
+/**
+ * @brief Receives the contents of a buffer read back by ComputeQueue::ReadBuffer()
+ * The data is only valid during the call
+ */
+using ReadbackCallback = std::function<void(const void* data, VkDeviceSize size)>;
+
+/**
+ * @brief Batches dispatches on the compute queue and signals a timeline semaphore
+ *
+ * Commands are recorded into the command buffer returned by Begin(), e.g. with
+ * ComputePipeline::Bind() and Dispatch(), and submitted by
+ * Renderer::SubmitCompute() or at the end of the frame, after the frame's
+ * uploads. Buffers written by uploads are handed over with
+ * Renderer::ReleaseToCompute(), other inputs are waited for with
+ * WaitSemaphore(). Buffers consumed by graphics are released by the batch and
+ * acquired by Renderer::WaitForCompute(), whose frame waits on the timeline on
+ * the GPU instead of on the CPU. Buffers read by the CPU are copied to host
+ * memory and handed to a callback once the batch has finished. The GPU time
+ * of every batch is added to Profiler as "GPU: Compute".
+ */
+class ComputeQueue {
+public:
+    ComputeQueue() = default;
+    ~ComputeQueue();
+
+    // Non-copyable
+    ComputeQueue(const ComputeQueue&) = delete;
+    ComputeQueue& operator=(const ComputeQueue&) = delete;
+
+    /**
+     * @brief Initialize the compute queue
+     */
+    bool Init(VulkanContext* context);
+
+    /**
+     * @brief Wait for outstanding work and release resources
+     */
+    void Cleanup();
+
+    /**
+     * @brief Get the command buffer of the open batch, begun on first use
+     * @return VK_NULL_HANDLE without timeline semaphores
+     */
+    VkCommandBuffer Begin();
+
+    /**
+     * @brief Hand a buffer written by the open batch over to the graphics queue
+     * Acquired by Renderer::WaitForCompute() with the handle of the batch, otherwise
+     * by the Renderer ahead of the first frame after the batch has finished
+     */
+    void ReleaseBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Record the acquire of a buffer the graphics queue released to the compute queue
+     * Dispatches recorded afterwards may read it, see Renderer::ReleaseToCompute()
+     */
+    void AcquireBuffer(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Make the open batch wait on the GPU for a timeline value of another queue
+     * The value must already be submitted, or the batch never starts
+     */
+    void WaitSemaphore(VkSemaphore semaphore, u64 value, VkPipelineStageFlags stage = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+    /**
+     * @brief Copy a buffer written by the open batch into host memory
+     * @param callback Called by Update() once the batch has finished
+     */
+    ComputeHandle ReadBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, ReadbackCallback callback);
+
+    /**
+     * @brief Submit the open batch
+     * Does not wait for uploads, Renderer::SubmitCompute() does
+     * @return Handle of the submitted batch
+     */
+    ComputeHandle Submit();
+
+    /**
+     * @brief Check if commands are recorded but not submitted yet
+     */
+    bool HasPendingWork() const { return m_Recording; }
+
+    /**
+     * @brief Check if a value belongs to the open batch, which is not submitted yet
+     */
+    bool IsPending(u64 value) const { return m_Recording && value >= m_NextValue; }
+
+    /**
+     * @brief Check if a value has completed on the compute queue
+     */
+    bool IsComplete(u64 value) const;
+
+    /**
+     * @brief Block until a value has completed and deliver its readbacks
+     */
+    void Wait(u64 value);
+
+    /**
+     * @brief Deliver readbacks of finished batches and recycle their command buffers
+     * Called by the Renderer at the start of every frame
+     */
+    void Update();
+
+    /**
+     * @brief Record ownership acquires for buffers released by batches up to a value
+     * The batches do not need to have finished, the graphics submission waits for them
+     * @return Timeline value the graphics submission has to wait for, 0 for none
+     */
+    u64 Acquire(u64 value, VkCommandBuffer graphicsCmd);
+
+    /**
+     * @brief Check if a finished batch released buffers that were not acquired yet
+     */
+    bool HasCompletedReleases() const;
+
+    /**
+     * @brief Check if submitted batches still have readbacks to deliver or buffers to hand to graphics
+     */
+    bool HasWorkInFlight() const { return !m_Readbacks.empty() || (IsAsync() && !m_Acquires.empty()); }
+
+    /**
+     * @brief Record ownership acquires for buffers released by finished batches
+     * Called by the Renderer with a graphics command buffer ahead of the frame
+     * @return Timeline value the graphics submission has to wait for, 0 for none
+     */
+    u64 AcquireCompleted(VkCommandBuffer graphicsCmd);
+
+    VkSemaphore GetTimelineSemaphore() const { return m_Timeline; }
+    bool IsAsync() const { return m_Timeline != VK_NULL_HANDLE; }
+
+private:
+    struct PendingAcquire {
+        u64 value = 0;
+        VkBufferMemoryBarrier barrier{};
+    };
+
+    struct SemaphoreWait {
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        u64 value = 0;
+        VkPipelineStageFlags stage = 0;
+    };
+
+    struct ReadbackBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        Allocation allocation;
+        VkDeviceSize capacity = 0;
+    };
+
+    struct PendingReadback {
+        u64 value = 0;
+        ReadbackBuffer buffer;
+        VkDeviceSize size = 0;
+        ReadbackCallback callback;
+    };
+
+    struct Submission {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        u64 value = 0;
+        u32 timestampQuery = NoTimestamps;
+    };
+
+    static constexpr u32 MaxTimedBatches = 16;     // Batches in flight beyond this are not timed
+    static constexpr u32 NoTimestamps = ~0u;
+
+    bool AcquireReadbackBuffer(VkDeviceSize size, ReadbackBuffer& buffer);
+    void WaitForValue(u64 value) const;
+    u64 GetCompletedValue() const;
+    void Recycle(u64 completed);
+
+    VulkanContext* m_Context = nullptr;
+    VkQueue m_Queue = VK_NULL_HANDLE;
+    VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+    VkSemaphore m_Timeline = VK_NULL_HANDLE;
+
+    u32 m_ComputeFamily = 0;
+    u32 m_GraphicsFamily = 0;
+
+    VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+    bool m_Recording = false;
+
+    // Timestamp pairs, query 2i begins batch i and 2i + 1 ends it
+    VkQueryPool m_TimestampPool = VK_NULL_HANDLE;
+    std::vector<u32> m_FreeTimestampQueries;
+    u32 m_TimestampQuery = NoTimestamps;           // Pair of the open batch
+    u64 m_TimestampMask = 0;
+    double m_TimestampPeriod = 0.0;
+
+    u64 m_NextValue = 1;       // Value signaled by the open batch
+
+    std::vector<Submission> m_InFlight;
+    std::vector<VkCommandBuffer> m_FreeCommandBuffers;
+    std::vector<SemaphoreWait> m_Waits;           // Of the open batch
+    std::vector<PendingAcquire> m_Releases;       // Recorded into the open batch
+    std::vector<PendingAcquire> m_Acquires;       // Submitted, waiting for a graphics acquire
+    std::vector<PendingReadback> m_Readbacks;     // In submission order
+    std::vector<ReadbackBuffer> m_FreeReadbackBuffers;
+};
+
+} // namespace tvk
@@ -6,9 +6,12 @@
 #pragma once
 
 #include "../core/types.h"
+#include "allocator.h"
+#include "sampler_cache.h"
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <optional>
+#include <string>
 
 struct GLFWwindow;
 
@@ -45,6 +48,10 @@ struct ContextConfig {
     bool enableGPUDebugMarkers = true;
     std::vector<const char*> requiredExtensions;
     std::vector<const char*> requiredDeviceExtensions;
+    VkDeviceSize memoryBlockSize = 64ull * 1024 * 1024;  // Size of the allocator's VkDeviceMemory blocks
+    std::string pipelineCachePath = "pipeline_cache.bin"; // Loaded at Init and saved at Cleanup, empty disables persistence
+    bool enableDynamicRendering = true;                   // Use VK_KHR_dynamic_rendering where the device supports it
+    bool enablePresentWait = true;                        // Use VK_KHR_present_id and VK_KHR_present_wait where supported
 };
 
 /**
@@ -61,6 +68,7 @@ public:
 
     /**
      * @brief Initialize Vulkan context
+     * @param window Surface to present to, nullptr creates a headless context without surface and swapchain support
      */
     bool Init(GLFWwindow* window, const ContextConfig& config = ContextConfig{});
 
@@ -81,11 +89,103 @@ public:
     VkSurfaceKHR GetSurface() const { return m_Surface; }
     VkQueue GetGraphicsQueue() const { return m_GraphicsQueue; }
     VkQueue GetPresentQueue() const { return m_PresentQueue; }
+    VkQueue GetTransferQueue() const { return m_TransferQueue; }
+    VkQueue GetComputeQueue() const { return m_ComputeQueue; }
     VkCommandPool GetCommandPool() const { return m_CommandPool; }
     VkDescriptorPool GetDescriptorPool() const { return m_DescriptorPool; }
+    VkPipelineCache GetPipelineCache() const { return m_PipelineCache; }
     const QueueFamilyIndices& GetQueueFamilyIndices() const { return m_QueueFamilyIndices; }
     VkPhysicalDeviceProperties GetDeviceProperties() const { return m_DeviceProperties; }
     VkPhysicalDeviceMemoryProperties GetMemoryProperties() const { return m_MemoryProperties; }
+    MemoryAllocator& GetAllocator() { return m_Allocator; }
+    SamplerCache& GetSamplerCache() { return m_SamplerCache; }
+    const VkPhysicalDeviceFeatures& GetEnabledFeatures() const { return m_Features; }
+    const VkPhysicalDeviceVulkan12Features& GetVulkan12Features() const { return m_Features12; }
+
+    /**
+     * @brief Check if the context was initialized without a window
+     * There is no surface, GetPresentQueue() is the graphics queue
+     */
+    bool IsHeadless() const { return m_Headless; }
+
+    /**
+     * @brief Check if transfers run on a queue family other than graphics
+     */
+    bool HasDedicatedTransferQueue() const {
+        return m_QueueFamilyIndices.transferFamily != m_QueueFamilyIndices.graphicsFamily;
+    }
+
+    /**
+     * @brief Check if compute can run on a queue family other than graphics
+     * Without one GetComputeQueue() is the graphics queue
+     */
+    bool HasDedicatedComputeQueue() const {
+        return m_QueueFamilyIndices.computeFamily != m_QueueFamilyIndices.graphicsFamily;
+    }
+
+    /**
+     * @brief Get the number of meaningful bits in timestamps written on a queue family
+     * @return 0 if the family does not support timestamps
+     */
+    u32 GetTimestampValidBits(u32 queueFamily) const;
+
+    /**
+     * @brief Check if an optimally tiled image of the format supports the features
+     */
+    bool IsFormatSupported(VkFormat format, VkFormatFeatureFlags features) const;
+
+    /**
+     * @brief Check if VK_EXT_memory_budget is enabled, heap budgets are estimates otherwise
+     */
+    bool IsMemoryBudgetSupported() const { return m_MemoryBudgetEnabled; }
+
+    /**
+     * @brief Check if the descriptor indexing features used by the BindlessHeap are enabled
+     */
+    bool IsBindlessSupported() const { return m_BindlessSupported; }
+
+    /**
+     * @brief Check if VK_KHR_dynamic_rendering is enabled
+     * Pipelines then target attachment formats instead of a VkRenderPass, see PipelineDesc
+     */
+    bool IsDynamicRenderingSupported() const { return m_DynamicRenderingEnabled; }
+
+    /**
+     * @brief Record vkCmdBeginRenderingKHR, requires IsDynamicRenderingSupported()
+     */
+    void CmdBeginRendering(VkCommandBuffer cmd, const VkRenderingInfoKHR& renderingInfo) const;
+
+    /**
+     * @brief Record vkCmdEndRenderingKHR, requires IsDynamicRenderingSupported()
+     */
+    void CmdEndRendering(VkCommandBuffer cmd) const;
+
+    /**
+     * @brief Check if command buffer labels are enabled, see ContextConfig::enableGPUDebugMarkers
+     * Labels show up in debuggers and GPU profilers such as RenderDoc or Nsight
+     */
+    bool IsDebugLabelsSupported() const { return m_DebugLabelsEnabled; }
+
+    /**
+     * @brief Open a labelled region of a command buffer, does nothing without debug labels
+     */
+    void CmdBeginDebugLabel(VkCommandBuffer cmd, const char* name) const;
+
+    /**
+     * @brief Close the region opened last by CmdBeginDebugLabel()
+     */
+    void CmdEndDebugLabel(VkCommandBuffer cmd) const;
+
+    /**
+     * @brief Check if VK_KHR_present_id and VK_KHR_present_wait are enabled
+     */
+    bool IsPresentWaitSupported() const { return m_PresentWaitEnabled; }
+
+    /**
+     * @brief Wait until the present with an id has been displayed, requires IsPresentWaitSupported()
+     * @param timeout Nanoseconds, VK_TIMEOUT is returned when it expires first
+     */
+    VkResult WaitForPresent(VkSwapchainKHR swapchain, u64 presentId, u64 timeout) const;
 
     /**
      * @brief Query swapchain support for physical device
@@ -107,6 +207,12 @@ public:
      */
     void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
 
+    /**
+     * @brief Write the pipeline cache to disk
+     * Called by Cleanup(), call it earlier to keep pipelines compiled so far
+     */
+    bool SavePipelineCache();
+
 private:
     bool CreateInstance(const ContextConfig& config);
     bool SetupDebugMessenger();
@@ -115,11 +221,14 @@ private:
     bool CreateLogicalDevice(const ContextConfig& config);
     bool CreateCommandPool();
     bool CreateDescriptorPool();
+    bool CreatePipelineCache();
 
     QueueFamilyIndices FindQueueFamilies(VkPhysicalDevice device) const;
     bool IsDeviceSuitable(VkPhysicalDevice device, const ContextConfig& config) const;
     bool CheckDeviceExtensionSupport(VkPhysicalDevice device, const std::vector<const char*>& extensions) const;
     std::vector<const char*> GetRequiredExtensions(const ContextConfig& config) const;
+    std::vector<const char*> GetRequiredDeviceExtensions() const;
+    bool CheckInstanceExtensionSupport(const char* extension) const;
     bool CheckValidationLayerSupport() const;
 
     VkInstance m_Instance = VK_NULL_HANDLE;
@@ -129,14 +238,33 @@ private:
     VkSurfaceKHR m_Surface = VK_NULL_HANDLE;
     VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
     VkQueue m_PresentQueue = VK_NULL_HANDLE;
+    VkQueue m_TransferQueue = VK_NULL_HANDLE;
+    VkQueue m_ComputeQueue = VK_NULL_HANDLE;
     VkCommandPool m_CommandPool = VK_NULL_HANDLE;
     VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
+    VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
+    std::string m_PipelineCachePath;
+    MemoryAllocator m_Allocator;
+    SamplerCache m_SamplerCache;
 
     QueueFamilyIndices m_QueueFamilyIndices;
     VkPhysicalDeviceProperties m_DeviceProperties{};
     VkPhysicalDeviceMemoryProperties m_MemoryProperties{};
+    VkPhysicalDeviceFeatures m_Features{};   // Enabled core features
+    VkPhysicalDeviceVulkan12Features m_Features12{};   // Enabled Vulkan 1.2 features
 
     bool m_ValidationEnabled = false;
+    bool m_Headless = false;
+    bool m_MemoryBudgetEnabled = false;
+    bool m_BindlessSupported = false;
+    bool m_DynamicRenderingEnabled = false;
+    PFN_vkCmdBeginRenderingKHR m_CmdBeginRendering = nullptr;
+    PFN_vkCmdEndRenderingKHR m_CmdEndRendering = nullptr;
+    bool m_PresentWaitEnabled = false;
+    PFN_vkWaitForPresentKHR m_WaitForPresent = nullptr;
+    bool m_DebugLabelsEnabled = false;
+    PFN_vkCmdBeginDebugUtilsLabelEXT m_CmdBeginDebugLabel = nullptr;
+    PFN_vkCmdEndDebugUtilsLabelEXT m_CmdEndDebugLabel = nullptr;
 };
 
 } // namespace tvk
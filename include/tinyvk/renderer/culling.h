@@ -0,0 +1,99 @@
+/**
+ * @file culling.h
+ * @brief GPU frustum culling into indirect draw commands
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "buffer.h"
+#include "pipeline.h"
+#include <vulkan/vulkan.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace tvk {
+
+class Renderer;
+
+/**
+ * @brief One cullable instance, matches CullObject in shaders::frustum_cull_comp
+ */
+struct CullObject {
+    glm::mat4 model;
+    glm::vec4 boundingSphere;   // Object space center and radius, see Mesh::GetBoundingSphere()
+    u32 drawIndex = 0;          // Draw command the instance belongs to
+    u32 pad[3] = {};
+};
+
+/**
+ * @brief Compute pass culling instances against the camera frustum
+ *
+ * Each draw command (usually one per mesh) owns a range of the instance buffer.
+ * Cull() resets the instance counts, tests every object's bounding sphere and
+ * compacts the survivors into the range of their draw, so each mesh is drawn
+ * with one Mesh::DrawIndirect() call:
+ *
+ * @code
+ * culling.Cull(cmd, viewProjection);
+ * BeginRenderPass(cmd);
+ * pipeline.Bind(cmd);
+ * mesh.DrawIndirect(cmd, culling.GetDrawBuffer(), CullingPass::GetDrawOffset(0), 1, &culling.GetInstanceBuffer());
+ * @endcode
+ */
+class CullingPass {
+public:
+    CullingPass() = default;
+    ~CullingPass();
+
+    // Non-copyable
+    CullingPass(const CullingPass&) = delete;
+    CullingPass& operator=(const CullingPass&) = delete;
+
+    bool Init(Renderer* renderer, u32 maxObjects, u32 maxDraws);
+    void Cleanup();
+
+    /**
+     * @brief Upload the objects and the draw commands they belong to
+     * instanceCount and firstInstance of the draws are assigned by the pass
+     */
+    bool SetScene(const std::vector<CullObject>& objects, const std::vector<VkDrawIndexedIndirectCommand>& draws);
+
+    /**
+     * @brief Record the culling dispatch, outside of a render pass
+     * The draw and instance buffers are ready for indirect drawing afterwards
+     */
+    void Cull(VkCommandBuffer cmd, const glm::mat4& viewProjection);
+
+    const Buffer& GetDrawBuffer() const { return *m_DrawCommands; }
+    const Buffer& GetInstanceBuffer() const { return *m_Instances; }
+    u32 GetObjectCount() const { return m_ObjectCount; }
+    u32 GetDrawCount() const { return m_DrawCount; }
+
+    static VkDeviceSize GetDrawOffset(u32 drawIndex) {
+        return static_cast<VkDeviceSize>(drawIndex) * sizeof(VkDrawIndexedIndirectCommand);
+    }
+
+private:
+    struct CullPushConstants {
+        glm::vec4 planes[6];
+        u32 objectCount;
+    };
+
+    static void ExtractFrustumPlanes(const glm::mat4& viewProjection, glm::vec4 planes[6]);
+
+    Renderer* m_Renderer = nullptr;
+    ComputePipeline m_Pipeline;
+
+    Ref<Buffer> m_Objects;
+    Ref<Buffer> m_Instances;
+    Ref<Buffer> m_DrawTemplates;   // Copied over m_DrawCommands to reset the counts
+    Ref<Buffer> m_DrawCommands;
+
+    u32 m_MaxObjects = 0;
+    u32 m_MaxDraws = 0;
+    u32 m_ObjectCount = 0;
+    u32 m_DrawCount = 0;
+};
+
+} // namespace tvk
@@ -0,0 +1,104 @@
+/**
+ * @file frame_allocator.h
+ * @brief Per-frame linear allocator for transient GPU data
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "allocator.h"
+#include <vulkan/vulkan.h>
+#include <atomic>
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief A region of frame memory, written by the CPU and read by the GPU in the same frame
+ */
+struct FrameAllocation {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void* data = nullptr;
+
+    bool IsValid() const { return data != nullptr; }
+
+    /**
+     * @brief Offset for vkCmdBindDescriptorSets() with a dynamic descriptor written at offset 0
+     */
+    u32 GetDynamicOffset() const { return static_cast<u32>(offset); }
+};
+
+/**
+ * @brief Persistently mapped buffer split into one slice per frame in flight
+ *
+ * Allocation bumps an atomic head through the slice of the current frame, so
+ * recording threads can allocate concurrently. The renderer resets a slice
+ * once the fence of its previous frame signaled. One buffer serves every
+ * frame: a dynamic uniform or storage descriptor written once against
+ * GetBuffer() reaches any allocation through its dynamic offset.
+ */
+class FrameAllocator {
+public:
+    FrameAllocator() = default;
+    ~FrameAllocator();
+
+    // Non-copyable
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    /**
+     * @brief Create and map frameCount slices of frameSize bytes
+     */
+    bool Init(VulkanContext* context, VkDeviceSize frameSize, u32 frameCount);
+
+    /**
+     * @brief Destroy the buffer - the GPU must be done with every frame
+     */
+    void Cleanup();
+
+    /**
+     * @brief Sub-allocate from the current frame's slice
+     * @param alignment 0 uses GetAlignment(), which satisfies uniform and storage offsets
+     * @return An invalid allocation if the slice is full
+     */
+    FrameAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment = 0);
+
+    /**
+     * @brief Copy a value into frame memory
+     */
+    template<typename T>
+    FrameAllocation Push(const T& value) {
+        FrameAllocation allocation = Allocate(sizeof(T));
+        if (allocation.IsValid()) {
+            *static_cast<T*>(allocation.data) = value;
+        }
+        return allocation;
+    }
+
+    /**
+     * @brief Start allocating from a frame's slice, everything allocated from it before is discarded
+     */
+    void Reset(u32 frameIndex);
+
+    VkBuffer GetBuffer() const { return m_Buffer; }
+    VkDeviceSize GetFrameSize() const { return m_FrameSize; }
+    VkDeviceSize GetUsedSize() const { return m_Head.load(std::memory_order_relaxed); }
+    VkDeviceSize GetAlignment() const { return m_Alignment; }
+
+private:
+    VulkanContext* m_Context = nullptr;
+    VkBuffer m_Buffer = VK_NULL_HANDLE;
+    Allocation m_Allocation;
+    u8* m_Data = nullptr;
+
+    VkDeviceSize m_FrameSize = 0;
+    VkDeviceSize m_Alignment = 256;
+    VkDeviceSize m_Base = 0;                    // Start of the current slice
+    std::atomic<VkDeviceSize> m_Head{0};        // Bytes used in the current slice
+    std::atomic<bool> m_OverflowReported{false};
+};
+
+} // namespace tvk
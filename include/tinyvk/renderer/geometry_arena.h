@@ -0,0 +1,125 @@
+/**
+ * @file geometry_arena.h
+ * @brief Shared vertex and index buffers that meshes sub-allocate from
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "buffer.h"
+#include <vulkan/vulkan.h>
+#include <vector>
+#include <map>
+
+namespace tvk {
+
+class Renderer;
+
+/**
+ * @brief Where a mesh lives inside the arena, in vertices and indices
+ */
+struct GeometryRange {
+    u32 firstVertex = 0;
+    u32 vertexCount = 0;
+    u32 firstIndex = 0;
+    u32 indexCount = 0;
+};
+
+/**
+ * @brief One large device local vertex buffer and index buffer shared by many meshes
+ *
+ * Meshes hold a handle instead of a range, so Compact() can move them.
+ * Indices are relative to the mesh's first vertex, draws pass it as vertexOffset.
+ * Bind() once and draw every mesh in the arena without rebinding.
+ */
+class GeometryArena {
+public:
+    using Handle = u32;
+    static constexpr Handle InvalidHandle = ~0u;
+
+    GeometryArena() = default;
+    ~GeometryArena();
+
+    // Non-copyable
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    /**
+     * @brief Create the shared buffers
+     * @param vertexStride Size of one vertex, all meshes in the arena share the format
+     */
+    bool Init(Renderer* renderer, u32 vertexStride, u32 vertexCapacity, u32 indexCapacity);
+    void Cleanup();
+
+    /**
+     * @brief Sub-allocate and upload a mesh
+     * @return InvalidHandle if the arena has no contiguous room left
+     */
+    Handle Allocate(const void* vertices, u32 vertexCount, const u32* indices, u32 indexCount);
+    void Free(Handle handle);
+
+    /**
+     * @brief Move all live meshes to the front of the buffers, merging the free space
+     * Waits for the GPU to go idle
+     */
+    void Compact();
+
+    /**
+     * @brief Bind the vertex buffer to binding 0 and the index buffer
+     */
+    void Bind(VkCommandBuffer cmd) const;
+
+    const GeometryRange& GetRange(Handle handle) const { return m_Ranges[handle]; }
+    VkBuffer GetVertexBuffer() const { return m_VertexBuffer ? m_VertexBuffer->GetBuffer() : VK_NULL_HANDLE; }
+    VkBuffer GetIndexBuffer() const { return m_IndexBuffer ? m_IndexBuffer->GetBuffer() : VK_NULL_HANDLE; }
+    u32 GetVertexStride() const { return m_VertexStride; }
+
+    // Includes freed ranges still in use by frames in flight
+    u32 GetUsedVertices() const { return m_VertexCapacity - m_FreeVertices.GetFreeCount(); }
+    u32 GetUsedIndices() const { return m_IndexCapacity - m_FreeIndices.GetFreeCount(); }
+    u32 GetVertexCapacity() const { return m_VertexCapacity; }
+    u32 GetIndexCapacity() const { return m_IndexCapacity; }
+
+private:
+    /**
+     * @brief First-fit free list over [0, capacity), adjacent ranges are merged on free
+     */
+    class FreeList {
+    public:
+        static constexpr u32 InvalidOffset = ~0u;
+
+        void Reset(u32 capacity, u32 used = 0);
+        u32 Allocate(u32 count);
+        void Free(u32 offset, u32 count);
+        u32 GetFreeCount() const { return m_FreeCount; }
+
+    private:
+        std::map<u32, u32> m_Ranges;   // Offset to size
+        u32 m_FreeCount = 0;
+    };
+
+    struct PendingFree {
+        u64 frame;
+        GeometryRange range;
+    };
+
+    void ReleaseRange(const GeometryRange& range);
+    void ReleaseCompleted();
+
+    Renderer* m_Renderer = nullptr;
+    Ref<Buffer> m_VertexBuffer;
+    Ref<Buffer> m_IndexBuffer;
+    u32 m_VertexStride = 0;
+    u32 m_VertexCapacity = 0;
+    u32 m_IndexCapacity = 0;
+
+    FreeList m_FreeVertices;
+    FreeList m_FreeIndices;
+
+    std::vector<GeometryRange> m_Ranges;
+    std::vector<bool> m_Live;
+    std::vector<Handle> m_FreeHandles;
+    std::vector<PendingFree> m_PendingFrees;   // Ranges frames in flight may still draw from
+};
+
+} // namespace tvk
@@ -0,0 +1,129 @@
+/**
+ * @file geometry_kernels.h
+ * @brief Batched mesh generation and vertex processing
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "vertex.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+
+namespace tvk {
+
+class JobSystem;
+
+/**
+ * @brief Axis aligned bounding box
+ */
+struct BoundingBox {
+    glm::vec3 min{0.0f};
+    glm::vec3 max{0.0f};
+
+    glm::vec3 GetCenter() const { return (min + max) * 0.5f; }
+    glm::vec3 GetExtent() const { return (max - min) * 0.5f; }
+};
+
+/**
+ * @brief Kernels that process vertices four at a time
+ *
+ * Vertices are transposed into SSE registers (or four-wide arrays on other
+ * targets) internally, the arrays passed in stay in their usual layout.
+ * Outputs are raw pointers, so they may point into mapped or staging memory,
+ * e.g. from UploadBatch::Stage(), which has to be filled before the batch
+ * is committed or recorded. With a running job system, inputs of at least
+ * ParallelThreshold vertices are split across its workers.
+ *
+ * @code
+ * u32 vertexCount = GeometryKernels::GetGridVertexCount(255, 255);
+ * u32 indexCount = GeometryKernels::GetGridIndexCount(255, 255);
+ * auto vertices = Buffer::Create(renderer, sizeof(Vertex) * vertexCount, BufferUsage::Vertex);
+ * auto indices = Buffer::Create(renderer, sizeof(u32) * indexCount, BufferUsage::Index);
+ *
+ * UploadBatch batch(renderer);
+ * GeometryKernels::GenerateHeightfield(static_cast<Vertex*>(batch.Stage(*vertices, vertices->GetSize())),
+ *                                      heights.data(), 255, 255, 1.0f, &GetJobs());
+ * GeometryKernels::GenerateGridIndices(static_cast<u32*>(batch.Stage(*indices, indices->GetSize())), 255, 255);
+ * batch.Submit();
+ * @endcode
+ */
+namespace GeometryKernels {
+
+    inline constexpr u32 ParallelThreshold = 16384;
+
+    /**
+     * @brief Vertices of a grid with columns x rows quads, as written by the grid generators
+     */
+    inline u32 GetGridVertexCount(u32 columns, u32 rows) { return (columns + 1) * (rows + 1); }
+
+    /**
+     * @brief Indices of a grid with columns x rows quads, two triangles each
+     */
+    inline u32 GetGridIndexCount(u32 columns, u32 rows) { return columns * rows * 6; }
+
+    /**
+     * @brief Write the triangle list of a row-major grid of (columns + 1) x (rows + 1) vertices
+     * @param baseVertex Added to every index
+     */
+    void GenerateGridIndices(u32* indices, u32 columns, u32 rows, u32 baseVertex = 0, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Plane in XZ facing +Y, GetGridVertexCount(segmentsX, segmentsY) vertices
+     */
+    void GeneratePlane(Vertex* vertices, float width, float height, u32 segmentsX, u32 segmentsY, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief UV sphere, GetGridVertexCount(segments, rings) vertices
+     */
+    void GenerateSphere(Vertex* vertices, float radius, u32 segments, u32 rings, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Torus around +Y, GetGridVertexCount(minorSegments, majorSegments) vertices
+     */
+    void GenerateTorus(Vertex* vertices, float majorRadius, float minorRadius, u32 majorSegments, u32 minorSegments,
+                       JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Terrain grid centered on the origin, normals from the height differences
+     * @param heights Row-major, GetGridVertexCount(columns, rows) samples
+     * @param cellSize Distance between neighbouring samples
+     */
+    void GenerateHeightfield(Vertex* vertices, const float* heights, u32 columns, u32 rows, float cellSize,
+                             JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Transform positions by the matrix and normals by its inverse transpose
+     * Normals are renormalized. Destination may be the same array as the source
+     */
+    void TransformVertices(Vertex* destination, const Vertex* source, u32 count, const glm::mat4& transform,
+                           JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Replace the normals by the area weighted average of the adjacent triangles' normals
+     * Counter-clockwise triangles face the normal, like VK_FRONT_FACE_COUNTER_CLOCKWISE
+     */
+    void ComputeNormals(Vertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Compute per-vertex tangents from the positions, normals and texture coordinates
+     * Vertex has no tangent, so they are written to their own array of vertexCount entries.
+     * w is the bitangent sign: bitangent = cross(normal, tangent.xyz) * tangent.w
+     */
+    void ComputeTangents(glm::vec4* tangents, const Vertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount,
+                         JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Bounding box of the positions
+     * @param positionStride Bytes between consecutive positions (three floats each)
+     */
+    BoundingBox ComputeBounds(const float* positions, size_t count, size_t positionStride, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Sphere around the bounding box center of the positions, xyz center and w radius
+     */
+    glm::vec4 ComputeBoundingSphere(const float* positions, size_t count, size_t positionStride, JobSystem* jobs = nullptr);
+
+} // namespace GeometryKernels
+
+} // namespace tvk
@@ -0,0 +1,170 @@
+/**
+ * @file gpu_profiler.h
+ * @brief GPU timestamp and pipeline statistics scopes
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief Pipeline statistics counted by a GPU scope
+ */
+struct GpuPipelineStatistics {
+    u64 inputVertices = 0;
+    u64 inputPrimitives = 0;
+    u64 vertexInvocations = 0;
+    u64 clippedPrimitives = 0;       // Primitives output by clipping
+    u64 fragmentInvocations = 0;
+    u64 computeInvocations = 0;
+};
+
+/**
+ * @brief GPU time of the scopes sharing a name in one frame
+ */
+struct GpuScopeResult {
+    std::string name;
+    double timeMs = 0.0;             // Summed over the scopes
+    u32 count = 0;                   // Scopes of this name
+    bool hasStatistics = false;
+    GpuPipelineStatistics statistics;
+};
+
+/**
+ * @brief Measures command buffer regions of a frame with timestamp queries
+ *
+ * Every frame slot owns a query pool, reset when the slot begins a frame and
+ * read without waiting once its fence has signaled, i.e. the results are
+ * those of the frame that used the slot before. Each scope name is also fed
+ * into Profiler as "GPU: <name>", so GPU times show up next to the CPU
+ * sections. Scopes open a debug label when VulkanContext::IsDebugLabelsSupported().
+ *
+ * Scopes are recorded on the main thread into any command buffer submitted
+ * with the frame, between Renderer::BeginFrame() and EndFrame().
+ */
+class GpuProfiler {
+public:
+    static constexpr u32 InvalidScope = ~0u;
+
+    GpuProfiler() = default;
+    ~GpuProfiler();
+
+    // Non-copyable
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    /**
+     * @brief Create the query pools
+     * @param maxScopes Scopes each frame can measure, later scopes only get a debug label
+     * @param pipelineStatistics Also count pipeline statistics, requires the pipelineStatisticsQuery feature
+     * @return false without timestamp support on the graphics queue, debug labels still work
+     */
+    bool Init(VulkanContext* context, u32 frameCount, u32 maxScopes, bool pipelineStatistics);
+
+    /**
+     * @brief Destroy the query pools - the GPU must be done with every frame
+     */
+    void Cleanup();
+
+    /**
+     * @brief Collect the results of a frame slot and reset its queries
+     * Called by the Renderer once the slot's fence signaled
+     * @param resetCmd Runs ahead of every command buffer of the frame, only used without host query reset
+     */
+    void BeginFrame(u32 frameIndex, VkCommandBuffer resetCmd);
+
+    /**
+     * @brief Stop measuring scopes for the frame, called by the Renderer before submission
+     */
+    void EndFrame();
+
+    /**
+     * @brief Open a scope with a timestamp and a debug label
+     * @param statistics Count pipeline statistics when enabled. Only one scope counts at a time,
+     *        it has to end in the command buffer and subpass it began in
+     * @return Scope for EndScope(), InvalidScope if it is not measured
+     */
+    u32 BeginScope(VkCommandBuffer cmd, const char* name, bool statistics = true);
+
+    /**
+     * @brief Close a scope, also when BeginScope() returned InvalidScope
+     * The command buffer may differ from the one the scope began in if both are primaries
+     */
+    void EndScope(VkCommandBuffer cmd, u32 scope);
+
+    /**
+     * @brief Get the scopes of the latest finished frame, merged by name in first use order
+     */
+    const std::vector<GpuScopeResult>& GetResults() const { return m_Results; }
+
+    void SetEnabled(bool enabled) { m_Enabled = enabled; }
+    bool IsEnabled() const { return m_Enabled && !m_Frames.empty(); }
+    bool HasPipelineStatistics() const { return m_PipelineStatistics; }
+
+private:
+    struct Scope {
+        std::string name;
+        u32 statisticsQuery = InvalidScope;
+        bool ended = false;
+    };
+
+    struct FrameQueries {
+        VkQueryPool timestampPool = VK_NULL_HANDLE;
+        VkQueryPool statisticsPool = VK_NULL_HANDLE;
+        std::vector<Scope> scopes;     // Scope i writes timestamps 2i and 2i + 1
+        u32 statisticsCount = 0;
+        bool reset = false;            // Queries may be written by the frame
+    };
+
+    void Resolve(FrameQueries& frame);
+
+    VulkanContext* m_Context = nullptr;
+    std::vector<FrameQueries> m_Frames;
+    std::vector<GpuScopeResult> m_Results;
+    std::vector<u64> m_QueryData;
+    std::string m_ProfileName;
+
+    u32 m_MaxScopes = 0;
+    u32 m_CurrentFrame = 0;
+    u64 m_TimestampMask = 0;
+    double m_TimestampPeriod = 0.0;  // Nanoseconds per tick
+    bool m_PipelineStatistics = false;
+    bool m_HostReset = false;
+    bool m_Recording = false;          // Between BeginFrame() and EndFrame()
+    bool m_StatisticsActive = false;
+    bool m_Enabled = true;
+};
+
+/**
+ * @brief RAII GPU scope
+ */
+class GpuScope {
+public:
+    GpuScope(GpuProfiler& profiler, VkCommandBuffer cmd, const char* name, bool statistics = true)
+        : m_Profiler(profiler), m_Cmd(cmd), m_Scope(profiler.BeginScope(cmd, name, statistics)) {}
+
+    ~GpuScope() { m_Profiler.EndScope(m_Cmd, m_Scope); }
+
+    // Non-copyable
+    GpuScope(const GpuScope&) = delete;
+    GpuScope& operator=(const GpuScope&) = delete;
+
+private:
+    GpuProfiler& m_Profiler;
+    VkCommandBuffer m_Cmd;
+    u32 m_Scope;
+};
+
+} // namespace tvk
+
+// Two levels so __LINE__ expands before pasting
+#define TVK_GPU_CONCAT_IMPL(a, b) a##b
+#define TVK_GPU_CONCAT(a, b) TVK_GPU_CONCAT_IMPL(a, b)
+#define TVK_GPU_SCOPE(profiler, cmd, name) tvk::GpuScope TVK_GPU_CONCAT(_gpuScope, __LINE__)(profiler, cmd, name)
@@ -8,8 +8,12 @@
 #include "../core/types.h"
 #include "vertex.h"
 #include "buffer.h"
+#include "geometry_arena.h"
+#include "mesh_optimizer.h"
+#include "geometry_kernels.h"
 #include <vulkan/vulkan.h>
 #include <vector>
+#include <string>
 
 namespace tvk {
 
@@ -23,23 +27,125 @@ public:
     Mesh(const Mesh&) = delete;
     Mesh& operator=(const Mesh&) = delete;
     
-    bool Create(Renderer* renderer, const std::vector<Vertex>& vertices, const std::vector<u32>& indices);
+    /**
+     * @brief Upload the geometry into its own buffers, or into a shared arena
+     * T is Vertex or another vertex format with a position member, e.g. VertexCompact.
+     * Falls back to own buffers if the arena is full. The arena must outlive the mesh
+     */
+    template<typename T>
+    bool Create(Renderer* renderer, const std::vector<T>& vertices, const std::vector<u32>& indices,
+                GeometryArena* arena = nullptr) {
+        return CreateFromData(renderer, vertices.data(), static_cast<u32>(vertices.size()), sizeof(T),
+                              ComputeBoundingSphere(vertices), indices.data(), static_cast<u32>(indices.size()), arena);
+    }
+
+    /**
+     * @brief Upload tightly packed vertices of any format
+     */
+    bool CreateFromData(Renderer* renderer, const void* vertices, u32 vertexCount, u32 vertexStride,
+                        const glm::vec4& boundingSphere, const u32* indices, u32 indexCount,
+                        GeometryArena* arena = nullptr);
+
+    /**
+     * @brief Load a .tvkmesh file written by MeshFile::Write() or the mesh_converter tool
+     * The file is memory mapped and copied straight into the upload staging memory.
+     * Its vertex format must match the pipeline, see MeshFile::GetVertexLayout()
+     */
+    bool LoadFromFile(Renderer* renderer, const std::string& path, GeometryArena* arena = nullptr);
+
+    /**
+     * @brief Sphere around the bounding box center of the vertex positions
+     */
+    template<typename T>
+    static glm::vec4 ComputeBoundingSphere(const std::vector<T>& vertices) {
+        if (vertices.empty()) return glm::vec4(0.0f);
+        return GeometryKernels::ComputeBoundingSphere(&vertices[0].position.x, vertices.size(), sizeof(T));
+    }
     void Destroy();
     
-    void Draw(VkCommandBuffer cmd);
+    void Draw(VkCommandBuffer cmd, u32 lod = 0);
+
+    /**
+     * @brief Draw without binding buffers, for meshes of an arena bound with GeometryArena::Bind()
+     */
+    void DrawBound(VkCommandBuffer cmd, u32 instanceCount = 1, u32 firstInstance = 0, u32 lod = 0);
+
+    /**
+     * @brief Set the index ranges of the levels of detail, e.g. from MeshOptimizer::GenerateLods()
+     * Without LODs the whole index buffer is LOD 0
+     */
+    void SetLods(const std::vector<MeshLod>& lods);
+    u32 GetLodCount() const { return static_cast<u32>(_lods.size()); }
+    const MeshLod& GetLod(u32 lod) const { return _lods[lod]; }
+
+    /**
+     * @brief Pick the coarsest LOD whose distance is below the camera distance
+     * @param bias Scales the distance, above 1 switches to coarser LODs earlier
+     */
+    u32 SelectLod(float distance, float bias = 1.0f) const;
+    u32 SelectLod(const glm::vec3& cameraPosition, const glm::mat4& model, float bias = 1.0f) const;
+
+    /**
+     * @brief Draw instanceCount copies in one call, per-instance data comes from InstanceData::Binding
+     * Use with a pipeline built from VertexLayout::FromVertexInstanced()
+     */
+    void DrawInstanced(VkCommandBuffer cmd, const Buffer& instances, u32 instanceCount, u32 firstInstance = 0);
+
+    /**
+     * @brief Draw from VkDrawIndexedIndirectCommand records in a buffer
+     * Indexed meshes only. Issued as one call with multiDrawIndirect, one call per record otherwise
+     * @param instances Per-instance data, or nullptr if the pipeline has none
+     */
+    void DrawIndirect(VkCommandBuffer cmd, const Buffer& commands, VkDeviceSize offset, u32 drawCount,
+                      const Buffer* instances = nullptr, u32 stride = sizeof(VkDrawIndexedIndirectCommand));
+
+    /**
+     * @brief Draw with the record count read from a buffer written on the GPU
+     * Requires drawIndirectCount, see SupportsDrawIndirectCount()
+     */
+    void DrawIndirectCount(VkCommandBuffer cmd, const Buffer& commands, VkDeviceSize offset,
+                           const Buffer& count, VkDeviceSize countOffset, u32 maxDrawCount,
+                           const Buffer* instances = nullptr, u32 stride = sizeof(VkDrawIndexedIndirectCommand));
+
+    /**
+     * @brief Indirect command drawing the whole mesh
+     */
+    VkDrawIndexedIndirectCommand GetIndirectCommand(u32 instanceCount = 1, u32 firstInstance = 0, u32 lod = 0) const;
+
+    bool SupportsDrawIndirectCount() const;
     
     u32 GetVertexCount() const { return _vertexCount; }
     u32 GetIndexCount() const { return _indexCount; }
+    u32 GetVertexStride() const { return _vertexStride; }
+
+    /**
+     * @brief Object space bounds, xyz is the center and w the radius
+     */
+    const glm::vec4& GetBoundingSphere() const { return _boundingSphere; }
     
-    VkBuffer GetVertexBuffer() const { return _vertexBuffer ? _vertexBuffer->GetBuffer() : VK_NULL_HANDLE; }
-    VkBuffer GetIndexBuffer() const { return _indexBuffer ? _indexBuffer->GetBuffer() : VK_NULL_HANDLE; }
+    VkBuffer GetVertexBuffer() const;
+    VkBuffer GetIndexBuffer() const;
+
+    /**
+     * @brief Arena holding the geometry, nullptr if the mesh owns its buffers
+     */
+    GeometryArena* GetArena() const { return _arena; }
+    GeometryRange GetRange() const;
     
 private:
+    void BindBuffers(VkCommandBuffer cmd, const Buffer* instances);
+    MeshLod ResolveLod(u32 lod) const;
+
     Renderer* _renderer = nullptr;
     Ref<Buffer> _vertexBuffer;
     Ref<Buffer> _indexBuffer;
+    GeometryArena* _arena = nullptr;
+    GeometryArena::Handle _arenaHandle = GeometryArena::InvalidHandle;
     u32 _vertexCount = 0;
     u32 _indexCount = 0;
+    u32 _vertexStride = 0;
+    glm::vec4 _boundingSphere{0.0f};
+    std::vector<MeshLod> _lods;
 };
 
 namespace Geometry {
@@ -50,6 +156,13 @@ namespace Geometry {
     Scope<Mesh> CreateCone(Renderer* renderer, float radius = 1.0f, float height = 2.0f, u32 segments = 32);
     Scope<Mesh> CreateTorus(Renderer* renderer, float majorRadius = 1.0f, float minorRadius = 0.3f, u32 majorSegments = 32, u32 minorSegments = 16);
     Scope<Mesh> CreateQuad(Renderer* renderer);
+
+    /**
+     * @brief Terrain grid from row-major heights, see GeometryKernels::GenerateHeightfield()
+     * @param jobs Splits the generation of large grids across workers
+     */
+    Scope<Mesh> CreateHeightfield(Renderer* renderer, const float* heights, u32 columns, u32 rows, float cellSize = 1.0f,
+                                  JobSystem* jobs = nullptr);
 }
 
 } // namespace tvk
@@ -0,0 +1,105 @@
+/**
+ * @file mesh_file.h
+ * @brief TinyVK binary mesh container, loaded by memory mapping
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/mapped_file.h"
+#include "mesh.h"
+#include "pipeline_registry.h"
+#include <string>
+#include <vector>
+
+namespace tvk {
+
+/**
+ * @brief Header at the start of a .tvkmesh file
+ *
+ * Sections follow at the given offsets, each 16 byte aligned:
+ * attributes, LODs, vertices (vertexCount * vertexStride bytes) and u32 indices.
+ * All values are little endian, vertex data is stored exactly as uploaded.
+ */
+struct MeshFileHeader {
+    char magic[4];
+    u32 version;
+    u32 vertexStride;
+    u32 vertexCount;
+    u32 indexCount;
+    u32 attributeCount;
+    u32 lodCount;
+    u32 reserved;
+    float boundingSphere[4];
+    u64 attributesOffset;
+    u64 lodsOffset;
+    u64 verticesOffset;
+    u64 indicesOffset;
+};
+
+struct MeshFileAttribute {
+    u32 location;
+    u32 format;   // VkFormat
+    u32 offset;
+    u32 reserved;
+};
+
+struct MeshFileLod {
+    u32 firstIndex;
+    u32 indexCount;
+    float distance;
+    u32 reserved;
+};
+
+/**
+ * @brief A mapped .tvkmesh file, the vertex and index data point into the mapping
+ */
+class MeshFile {
+public:
+    static constexpr u32 Version = 1;
+
+    MeshFile() = default;
+    ~MeshFile() = default;
+
+    // Non-copyable
+    MeshFile(const MeshFile&) = delete;
+    MeshFile& operator=(const MeshFile&) = delete;
+
+    /**
+     * @brief Map and validate a file
+     */
+    bool Open(const std::string& path);
+    void Close();
+
+    const MeshFileHeader& GetHeader() const { return *m_Header; }
+    const void* GetVertices() const { return m_File.GetData() + m_Header->verticesOffset; }
+    const u32* GetIndices() const { return reinterpret_cast<const u32*>(m_File.GetData() + m_Header->indicesOffset); }
+    glm::vec4 GetBoundingSphere() const;
+
+    std::vector<MeshLod> GetLods() const;
+
+    /**
+     * @brief Vertex layout in binding 0, for PipelineDesc::vertexLayout
+     */
+    VertexLayout GetVertexLayout() const;
+
+    /**
+     * @brief Write a mesh in the format Open() reads
+     */
+    static bool Write(const std::string& path, const void* vertices, u32 vertexCount, u32 vertexStride,
+                      const VertexLayout& layout, const u32* indices, u32 indexCount,
+                      const std::vector<MeshLod>& lods, const glm::vec4& boundingSphere);
+
+    template<typename T>
+    static bool Write(const std::string& path, const std::vector<T>& vertices, const std::vector<u32>& indices,
+                      const std::vector<MeshLod>& lods = {}) {
+        return Write(path, vertices.data(), static_cast<u32>(vertices.size()), sizeof(T), VertexLayout::From<T>(),
+                     indices.data(), static_cast<u32>(indices.size()), lods, Mesh::ComputeBoundingSphere(vertices));
+    }
+
+private:
+    MappedFile m_File;
+    const MeshFileHeader* m_Header = nullptr;
+};
+
+} // namespace tvk
@@ -0,0 +1,110 @@
+/**
+ * @file mesh_optimizer.h
+ * @brief Index and vertex reordering for GPU efficiency and LOD generation
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "vertex.h"
+#include <vector>
+#include <cstddef>
+
+namespace tvk {
+
+/**
+ * @brief One level of detail inside a mesh's index buffer
+ */
+struct MeshLod {
+    u32 firstIndex = 0;   // Relative to the mesh's own indices
+    u32 indexCount = 0;
+    float distance = 0.0f;   // Used from this camera distance on, see Mesh::SelectLod()
+};
+
+namespace MeshOptimizer {
+
+    /**
+     * @brief Reorder triangles for the post-transform vertex cache (Forsyth)
+     */
+    void OptimizeVertexCache(u32* indices, size_t indexCount, size_t vertexCount);
+
+    /**
+     * @brief Reorder clusters of cache optimized triangles so outward facing ones draw first
+     * Run after OptimizeVertexCache(), the clusters keep most of its cache efficiency
+     * @param positionStride Bytes between consecutive positions (three floats each)
+     */
+    void OptimizeOverdraw(u32* indices, size_t indexCount, const float* positions, size_t vertexCount, size_t positionStride);
+
+    /**
+     * @brief Reorder vertices in the order the indices first use them and drop unused ones
+     * @return The new vertex count
+     */
+    size_t OptimizeVertexFetch(void* vertices, u32* indices, size_t indexCount, size_t vertexCount, size_t vertexSize);
+
+    /**
+     * @brief Simplify by clustering vertices on a grid, keeping the original vertices
+     * The result indexes the same vertex buffer, so LODs can share it
+     * @return Number of indices written, at most targetIndexCount unless that is not reachable
+     */
+    size_t Simplify(u32* destination, const u32* indices, size_t indexCount, const float* positions,
+                    size_t vertexCount, size_t positionStride, size_t targetIndexCount);
+
+    /**
+     * @brief Average cache miss ratio (transformed vertices per triangle) for a FIFO cache
+     */
+    float AnalyzeVertexCache(const u32* indices, size_t indexCount, size_t vertexCount, u32 cacheSize = 16);
+
+    /**
+     * @brief Run the cache, overdraw and fetch optimizations on a mesh
+     * T is any vertex format with a glm::vec3 position member
+     */
+    template<typename T>
+    void Optimize(std::vector<T>& vertices, std::vector<u32>& indices) {
+        if (indices.empty() || vertices.empty()) return;
+
+        OptimizeVertexCache(indices.data(), indices.size(), vertices.size());
+        OptimizeOverdraw(indices.data(), indices.size(), &vertices[0].position.x, vertices.size(), sizeof(T));
+        vertices.resize(OptimizeVertexFetch(vertices.data(), indices.data(), indices.size(), vertices.size(), sizeof(T)));
+    }
+
+    /**
+     * @brief Append simplified index lists to indices, each about reduction times the previous one
+     * LOD 0 is the original list. LOD i is used from baseDistance * 2^(i - 1) on
+     * @return The LOD ranges, including LOD 0
+     */
+    template<typename T>
+    std::vector<MeshLod> GenerateLods(const std::vector<T>& vertices, std::vector<u32>& indices,
+                                      u32 maxLods, float baseDistance, float reduction = 0.5f) {
+        std::vector<MeshLod> lods;
+        if (indices.empty()) return lods;
+
+        lods.push_back({0, static_cast<u32>(indices.size()), 0.0f});
+
+        std::vector<u32> lod;
+        for (u32 level = 1; level < maxLods; level++) {
+            const MeshLod& previous = lods.back();
+            size_t target = static_cast<size_t>(previous.indexCount * reduction) / 3 * 3;
+            if (target < 3) break;
+
+            lod.resize(previous.indexCount);
+            size_t count = Simplify(lod.data(), indices.data() + previous.firstIndex, previous.indexCount,
+                                    &vertices[0].position.x, vertices.size(), sizeof(T), target);
+
+            // Stop once simplification no longer makes progress
+            if (count == 0 || count >= previous.indexCount) break;
+
+            OptimizeVertexCache(lod.data(), count, vertices.size());
+
+            MeshLod range;
+            range.firstIndex = static_cast<u32>(indices.size());
+            range.indexCount = static_cast<u32>(count);
+            range.distance = baseDistance * static_cast<float>(1u << (level - 1));
+            indices.insert(indices.end(), lod.begin(), lod.begin() + count);
+            lods.push_back(range);
+        }
+        return lods;
+    }
+
+} // namespace MeshOptimizer
+
+} // namespace tvk
@@ -6,10 +6,13 @@
 #pragma once
 
 #include "../core/types.h"
+#include "../core/job_system.h"
 #include "vertex.h"
+#include "pipeline_registry.h"
 #include <vulkan/vulkan.h>
 #include <string>
 #include <vector>
+#include <atomic>
 
 namespace tvk {
 
@@ -22,24 +25,65 @@ struct PushConstants {
     glm::mat4 view_projection;
 };
 
+enum class PipelineState {
+    Pending,
+    Ready,
+    Failed
+};
+
 class Pipeline {
 public:
     Pipeline() = default;
     ~Pipeline();
 
+    // Non-copyable
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
     bool Create(Renderer* renderer, VkRenderPass renderPass, const std::string& vertShaderSource, const std::string& fragShaderSource);
+
+    /**
+     * @brief Create from a full description, shared with other pipelines of identical state
+     */
+    bool Create(Renderer* renderer, const PipelineDesc& desc);
+
+    /**
+     * @brief Compile shaders and create the pipeline on a worker thread
+     * The layout is valid on return, the pipeline once IsReady(). Until then Bind() uses the fallback
+     */
+    bool CreateAsync(JobSystem& jobs, Renderer* renderer, VkRenderPass renderPass, std::string vertShaderSource, std::string fragShaderSource);
+    bool CreateAsync(JobSystem& jobs, Renderer* renderer, PipelineDesc desc);
     void Destroy();
     
-    void Bind(VkCommandBuffer cmd);
+    /**
+     * @brief Bind the pipeline, or the fallback while it is still being built
+     * @return false if neither is ready, draws should be skipped
+     */
+    bool Bind(VkCommandBuffer cmd);
     void SetPushConstants(VkCommandBuffer cmd, const PushConstants& constants);
+
+    /**
+     * @brief Pipeline bound while this one is pending or failed to build, must use a compatible layout
+     */
+    void SetFallback(Pipeline* fallback) { _fallback = fallback; }
     
-    VkPipeline GetHandle() const { return _pipeline; }
+    bool IsReady() const { return _state.load(std::memory_order_acquire) == PipelineState::Ready; }
+    PipelineState GetState() const { return _state.load(std::memory_order_acquire); }
+    VkPipeline GetHandle() const { return IsReady() ? _pipeline : VK_NULL_HANDLE; }
     VkPipelineLayout GetLayout() const { return _layout; }
 
 private:
+    static PipelineDesc MakeDesc(VkRenderPass renderPass, std::string vertShaderSource, std::string fragShaderSource);
+    bool Build(const PipelineDesc& desc);
+
     Renderer* _renderer = nullptr;
     VkPipeline _pipeline = VK_NULL_HANDLE;
     VkPipelineLayout _layout = VK_NULL_HANDLE;
+    Pipeline* _fallback = nullptr;
+
+    std::atomic<PipelineState> _state{PipelineState::Pending};
+    JobSystem* _jobs = nullptr;
+    JobCounter _build;
 };
 
 class ComputePipeline {
@@ -48,13 +92,22 @@ public:
     ~ComputePipeline();
 
     bool Create(Renderer* renderer, const std::string& computeShaderSource);
+
+    /**
+     * @brief Create on the layout of the renderer's bindless heap
+     * The shader reaches buffers and images through heap indices instead of
+     * BindStorageBuffer(), see shaders::bindless_glsl
+     * @return false if the heap is disabled
+     */
+    bool CreateBindless(Renderer* renderer, const std::string& computeShaderSource);
     void Destroy();
     
     void Bind(VkCommandBuffer cmd);
     
     template<typename T>
     void SetPushConstants(VkCommandBuffer cmd, const T& data) {
-        vkCmdPushConstants(cmd, _layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(T), &data);
+        static_assert(sizeof(T) <= 128, "Push constants exceed 128 bytes");
+        vkCmdPushConstants(cmd, _layout, _pushConstantStages, 0, sizeof(T), &data);
     }
     
     void Dispatch(VkCommandBuffer cmd, u32 groupCountX, u32 groupCountY, u32 groupCountZ);
@@ -63,6 +116,7 @@ public:
     VkPipelineLayout GetLayout() const { return _layout; }
     VkDescriptorSetLayout GetDescriptorSetLayout() const { return _descriptorSetLayout; }
     VkDescriptorSet GetDescriptorSet() const { return _descriptorSet; }
+    bool IsBindless() const { return _bindless; }
 
     void BindStorageBuffer(u32 binding, Buffer* buffer);
     void BindStorageBuffers(Buffer* buffer0, Buffer* buffer1 = nullptr);
@@ -70,10 +124,13 @@ public:
 
 private:
     bool CreateDescriptorResources();
+    bool CreatePipeline(const std::string& computeShaderSource);
 
     Renderer* _renderer = nullptr;
     VkPipeline _pipeline = VK_NULL_HANDLE;
-    VkPipelineLayout _layout = VK_NULL_HANDLE;
+    VkPipelineLayout _layout = VK_NULL_HANDLE;   // Owned unless bindless, the heap's layout is shared
+    VkShaderStageFlags _pushConstantStages = VK_SHADER_STAGE_COMPUTE_BIT;
+    bool _bindless = false;
     VkDescriptorSetLayout _descriptorSetLayout = VK_NULL_HANDLE;
     VkDescriptorPool _descriptorPool = VK_NULL_HANDLE;
     VkDescriptorSet _descriptorSet = VK_NULL_HANDLE;
@@ -0,0 +1,170 @@
+/**
+ * @file pipeline_registry.h
+ * @brief Pipeline descriptions and a registry that shares pipelines with identical state
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "vertex.h"
+#include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief Vertex buffer bindings and attributes consumed by a pipeline
+ */
+struct VertexLayout {
+    std::vector<VkVertexInputBindingDescription> bindings;
+    std::vector<VkVertexInputAttributeDescription> attributes;
+
+    /**
+     * @brief Layout of a vertex type with GetBindingDescription() and GetAttributeDescriptions()
+     */
+    template<typename T>
+    static VertexLayout From() {
+        VertexLayout layout;
+        layout.bindings.push_back(T::GetBindingDescription());
+
+        auto attributes = T::GetAttributeDescriptions();
+        layout.attributes.assign(attributes.begin(), attributes.end());
+        return layout;
+    }
+
+    /**
+     * @brief Vertex type in binding 0 and InstanceData in binding 1
+     */
+    template<typename T>
+    static VertexLayout FromInstanced() {
+        VertexLayout layout = From<T>();
+        layout.bindings.push_back(InstanceData::GetBindingDescription());
+
+        auto attributes = InstanceData::GetAttributeDescriptions();
+        layout.attributes.insert(layout.attributes.end(), attributes.begin(), attributes.end());
+        return layout;
+    }
+
+    /**
+     * @brief Layout of the standard Vertex in binding 0
+     */
+    static VertexLayout FromVertex() { return From<Vertex>(); }
+
+    /**
+     * @brief Vertex in binding 0 and InstanceData in binding 1
+     */
+    static VertexLayout FromVertexInstanced() { return FromInstanced<Vertex>(); }
+
+    bool operator==(const VertexLayout& other) const;
+};
+
+enum class BlendMode {
+    Opaque,
+    Alpha,
+    Additive
+};
+
+/**
+ * @brief Specialization constant applied to every shader stage
+ */
+struct SpecializationConstant {
+    u32 id = 0;
+    u32 value = 0;
+
+    bool operator==(const SpecializationConstant& other) const { return id == other.id && value == other.value; }
+};
+
+/**
+ * @brief Complete description of a graphics pipeline
+ */
+struct PipelineDesc {
+    // GLSL sources
+    std::string vertexShader;
+    std::string fragmentShader;
+
+    VertexLayout vertexLayout = VertexLayout::FromVertex();
+    VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    // Rasterizer
+    VkPolygonMode polygonMode = VK_POLYGON_MODE_FILL;
+    VkCullModeFlags cullMode = VK_CULL_MODE_BACK_BIT;
+    VkFrontFace frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+
+    // Depth
+    bool depthTest = true;
+    bool depthWrite = true;
+    VkCompareOp depthCompareOp = VK_COMPARE_OP_LESS;
+
+    BlendMode blendMode = BlendMode::Opaque;
+    bool colorWrite = true;   // Off for depth only passes
+
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    u32 subpass = 0;
+
+    // Dynamic rendering targets, used when renderPass is VK_NULL_HANDLE
+    VkFormat colorFormat = VK_FORMAT_UNDEFINED;   // UNDEFINED for depth only
+    VkFormat depthFormat = VK_FORMAT_UNDEFINED;
+
+    std::vector<SpecializationConstant> specialization;
+
+    // VK_NULL_HANDLE uses the registry's layout with the PushConstants range
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+
+    u64 Hash() const;
+    bool operator==(const PipelineDesc& other) const;
+};
+
+/**
+ * @brief Creates graphics pipelines once per distinct description
+ * Owned by the Renderer, safe to use from multiple threads
+ */
+class PipelineRegistry {
+public:
+    PipelineRegistry() = default;
+    ~PipelineRegistry();
+
+    // Non-copyable
+    PipelineRegistry(const PipelineRegistry&) = delete;
+    PipelineRegistry& operator=(const PipelineRegistry&) = delete;
+
+    bool Init(VulkanContext* context);
+    void Cleanup();
+
+    /**
+     * @brief Get the pipeline for a description, creating it on first use
+     * @return VK_NULL_HANDLE if creation failed
+     */
+    VkPipeline GetPipeline(const PipelineDesc& desc);
+
+    /**
+     * @brief Layout used by descriptions without one, with the PushConstants range for the vertex stage
+     */
+    VkPipelineLayout GetDefaultLayout() const { return m_DefaultLayout; }
+
+    /**
+     * @brief Get number of distinct pipelines created
+     */
+    u32 GetPipelineCount() const;
+
+private:
+    struct Entry {
+        PipelineDesc desc;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+    };
+
+    VkPipeline CreatePipeline(const PipelineDesc& desc);
+
+    VulkanContext* m_Context = nullptr;
+    VkPipelineLayout m_DefaultLayout = VK_NULL_HANDLE;
+
+    mutable std::mutex m_Mutex;
+    std::unordered_map<u64, std::vector<Entry>> m_Pipelines;   // Entries sharing a hash are told apart by comparison
+    u32 m_PipelineCount = 0;
+};
+
+} // namespace tvk
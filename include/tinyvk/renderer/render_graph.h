@@ -0,0 +1,435 @@
+/**
+ * @file render_graph.h
+ * @brief Frame graph deriving barriers, transient memory and queue scheduling from declared passes
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "allocator.h"
+#include <vulkan/vulkan.h>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace tvk {
+
+class Renderer;
+class RenderGraph;
+
+/**
+ * @brief Handle of an image declared for one Execute() of the graph
+ */
+struct RenderGraphImage {
+    u32 index = ~0u;
+    bool IsValid() const { return index != ~0u; }
+};
+
+/**
+ * @brief Handle of a buffer declared for one Execute() of the graph
+ */
+struct RenderGraphBuffer {
+    u32 index = ~0u;
+    bool IsValid() const { return index != ~0u; }
+};
+
+/**
+ * @brief Description of a 2D image
+ */
+struct RenderGraphImageDesc {
+    u32 width = 0;                  // 0 uses the swapchain extent
+    u32 height = 0;
+    VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    u32 mipLevels = 1;
+    VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT;
+};
+
+/**
+ * @brief Kind of work a pass records
+ */
+enum class RenderGraphPassType {
+    Raster,         // Runs inside a render pass built from its attachments
+    Compute,        // Dispatches on the graphics queue
+    AsyncCompute,   // Dispatches on the compute queue when it can overlap graphics work
+    Transfer        // Copies and blits on the graphics queue
+};
+
+enum class RenderGraphImageUsage {
+    Sampled,
+    Storage,
+    TransferSrc,
+    TransferDst
+};
+
+enum class RenderGraphBufferUsage {
+    Vertex,
+    Index,
+    Indirect,
+    Uniform,
+    Storage,
+    TransferSrc,
+    TransferDst
+};
+
+/**
+ * @brief Declares the resources a pass reads and writes, passed to the setup callback
+ */
+class RenderGraphBuilder {
+public:
+    /**
+     * @brief Render into a color attachment, the previous contents are kept unless cleared
+     */
+    void WriteColor(RenderGraphImage image, std::optional<VkClearColorValue> clear = std::nullopt);
+
+    /**
+     * @brief Depth test and write, the previous contents are kept unless cleared
+     */
+    void WriteDepth(RenderGraphImage image, std::optional<f32> clear = std::nullopt);
+
+    /**
+     * @brief Depth test against a read-only depth attachment
+     */
+    void ReadDepth(RenderGraphImage image);
+
+    void Read(RenderGraphImage image, RenderGraphImageUsage usage = RenderGraphImageUsage::Sampled);
+    void Write(RenderGraphImage image, RenderGraphImageUsage usage = RenderGraphImageUsage::Storage);
+    void Read(RenderGraphBuffer buffer, RenderGraphBufferUsage usage);
+    void Write(RenderGraphBuffer buffer, RenderGraphBufferUsage usage = RenderGraphBufferUsage::Storage);
+
+    /**
+     * @brief Keep the pass even if nothing reads what it writes, e.g. it writes to the host
+     */
+    void SetSideEffect();
+
+private:
+    friend class RenderGraph;
+    RenderGraphBuilder(RenderGraph* graph, u32 pass) : m_Graph(graph), m_Pass(pass) {}
+
+    RenderGraph* m_Graph;
+    u32 m_Pass;
+};
+
+/**
+ * @brief Physical resources of a pass, passed to the execute callback
+ */
+class RenderGraphContext {
+public:
+    VkCommandBuffer GetCommandBuffer() const { return m_CommandBuffer; }
+
+    VkImage GetImage(RenderGraphImage image) const;
+    VkImageView GetImageView(RenderGraphImage image) const;
+    VkBuffer GetBuffer(RenderGraphBuffer buffer) const;
+
+    /**
+     * @brief Render pass of a raster pass, already begun with viewport and scissor set
+     */
+    VkRenderPass GetRenderPass() const { return m_RenderPass; }
+    VkExtent2D GetExtent() const { return m_Extent; }
+
+private:
+    friend class RenderGraph;
+
+    const RenderGraph* m_Graph = nullptr;
+    VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+    VkRenderPass m_RenderPass = VK_NULL_HANDLE;
+    VkExtent2D m_Extent{};
+};
+
+/**
+ * @brief Statistics of the last Execute()
+ */
+struct RenderGraphStats {
+    u32 passCount = 0;              // Declared passes
+    u32 culledPasses = 0;           // Passes nothing depended on
+    u32 asyncPasses = 0;            // Passes scheduled onto the compute queue
+    u32 barriers = 0;               // Image and buffer barriers recorded
+    VkDeviceSize transientMemory = 0;   // Memory backing transient resources
+    VkDeviceSize requestedMemory = 0;   // Memory they would need without aliasing
+};
+
+/**
+ * @brief Records a frame from passes that declare what they read and write
+ *
+ * Passes and resources are declared again for every Execute(). From the
+ * declarations the graph
+ * - culls passes whose results nothing reads, unless they have side effects
+ * - records the barriers and layout transitions between passes, batched per pass
+ * - places transient resources whose lifetimes do not overlap in the same memory
+ * - moves AsyncCompute passes to the compute queue when none of their resources
+ *   were touched by earlier graphics work, graphics passes consuming their
+ *   results wait on a timeline semaphore while earlier ones overlap them
+ *
+ * Transient memory is kept while the set of transients stays the same, so a
+ * steady frame allocates nothing. Imported resources are owned by the graphics
+ * queue family, they are expected in their current layout and left in their
+ * final layout, visible to everything submitted afterwards.
+ *
+ * @code
+ * RenderGraphImage hdr = graph.CreateImage("hdr", {0, 0, VK_FORMAT_R16G16B16A16_SFLOAT});
+ * RenderGraphImage output = graph.ImportImage("output", image, view, desc, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+ * graph.AddPass("scene", RenderGraphPassType::Raster,
+ *     [&](RenderGraphBuilder& builder) { builder.WriteColor(hdr, VkClearColorValue{}); },
+ *     [&](RenderGraphContext& context) { DrawScene(context.GetCommandBuffer()); });
+ * graph.AddPass("tonemap", RenderGraphPassType::Compute,
+ *     [&](RenderGraphBuilder& builder) { builder.Read(hdr); builder.Write(output); },
+ *     [&](RenderGraphContext& context) { Tonemap(context, hdr, output); });
+ * graph.Execute();
+ * @endcode
+ */
+class RenderGraph {
+public:
+    RenderGraph() = default;
+    ~RenderGraph();
+
+    // Non-copyable
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    bool Init(Renderer* renderer);
+
+    /**
+     * @brief Destroy every resource - the GPU must be done with every frame
+     */
+    void Cleanup();
+
+    /**
+     * @brief Declare an image living for this execution only, its contents start undefined
+     */
+    RenderGraphImage CreateImage(const std::string& name, const RenderGraphImageDesc& desc);
+    RenderGraphBuffer CreateBuffer(const std::string& name, VkDeviceSize size);
+
+    /**
+     * @brief Use an image owned elsewhere
+     * @param currentLayout Layout the image is in when the graph executes
+     * @param finalLayout Layout the graph leaves it in
+     */
+    RenderGraphImage ImportImage(const std::string& name, VkImage image, VkImageView view,
+                                 const RenderGraphImageDesc& desc, VkImageLayout currentLayout,
+                                 VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    RenderGraphBuffer ImportBuffer(const std::string& name, VkBuffer buffer, VkDeviceSize size);
+
+    /**
+     * @brief Add a pass, setup runs immediately and execute runs during Execute() if the pass is kept
+     */
+    void AddPass(const std::string& name, RenderGraphPassType type,
+                 const std::function<void(RenderGraphBuilder&)>& setup,
+                 std::function<void(RenderGraphContext&)> execute);
+
+    /**
+     * @brief Compile, record and submit the declared passes, then clear the declarations
+     * Call between BeginFrame() and EndFrame(). Without async compute the commands are
+     * queued with Renderer::SubmitWithFrame(), otherwise they are submitted right away
+     */
+    void Execute();
+
+    /**
+     * @brief Render pass compatible with raster passes using these attachments, for creating pipelines
+     */
+    VkRenderPass GetRenderPass(const std::vector<VkFormat>& colorFormats, VkFormat depthFormat = VK_FORMAT_UNDEFINED,
+                               VkSampleCountFlagBits samples = VK_SAMPLE_COUNT_1_BIT);
+
+    /**
+     * @brief Check if AsyncCompute passes can run on a queue of their own
+     */
+    bool IsAsyncComputeAvailable() const { return m_AsyncCompute; }
+
+    const RenderGraphStats& GetStats() const { return m_Stats; }
+
+private:
+    friend class RenderGraphBuilder;
+    friend class RenderGraphContext;
+
+    enum QueueIndex : u32 { GraphicsQueue = 0, ComputeQueue = 1 };
+
+    struct Access {
+        u32 resource = 0;
+        VkPipelineStageFlags stages = 0;
+        VkAccessFlags access = 0;
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        bool read = false;
+        bool write = false;
+    };
+
+    struct Attachment {
+        u32 image = ~0u;
+        bool clear = false;
+        bool readOnly = false;
+        VkClearValue clearValue{};
+    };
+
+    struct Pass {
+        std::string name;
+        RenderGraphPassType type = RenderGraphPassType::Raster;
+        std::function<void(RenderGraphContext&)> execute;
+        std::vector<Access> images;
+        std::vector<Access> buffers;
+        std::vector<Attachment> colors;
+        Attachment depth;
+        bool sideEffect = false;
+
+        // Compiled
+        bool culled = false;
+        u32 queue = GraphicsQueue;
+        bool tail = false;          // Graphics work waiting on the compute queue
+    };
+
+    /**
+     * @brief Synchronization state of a resource while recording
+     */
+    struct ResourceState {
+        VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkPipelineStageFlags writeStages = 0;   // Stages of the last write (or layout transition)
+        VkAccessFlags writeAccess = 0;
+        VkPipelineStageFlags readStages = 0;    // Stages that read since, already synchronized
+        VkAccessFlags readAccess = 0;
+        u32 queue = GraphicsQueue;
+        bool hasContents = false;
+    };
+
+    struct Resource {
+        std::string name;
+        bool imported = false;
+        u32 physical = ~0u;         // Index into the physical images or buffers of transients
+
+        // Image
+        RenderGraphImageDesc desc;
+        VkImage image = VK_NULL_HANDLE;
+        VkImageView view = VK_NULL_HANDLE;
+        VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        // Buffer
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize size = 0;
+
+        // Compiled
+        u32 usage = 0;              // VkImageUsageFlags or VkBufferUsageFlags
+        VkPipelineStageFlags stages = 0;
+        VkAccessFlags writeAccess = 0;
+        u32 firstPass = ~0u;
+        u32 lastPass = 0;
+        bool graphics = false;      // Touched by a pass on the graphics queue
+        bool compute = false;       // Touched by a pass on the compute queue
+        ResourceState state;
+    };
+
+    struct MemoryRange {
+        u32 block = ~0u;
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+    };
+
+    struct PhysicalImage {
+        VkImage image = VK_NULL_HANDLE;
+        VkImageView view = VK_NULL_HANDLE;
+        MemoryRange range;
+    };
+
+    struct PhysicalBuffer {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        MemoryRange range;
+    };
+
+    struct Framebuffer {
+        VkRenderPass renderPass = VK_NULL_HANDLE;
+        std::vector<VkImageView> views;
+        VkExtent2D extent{};
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+        bool used = false;
+    };
+
+    /**
+     * @brief Handles released once the frame that last used them has completed
+     */
+    struct RetiredResources {
+        u64 frame = 0;
+        std::vector<PhysicalImage> images;
+        std::vector<PhysicalBuffer> buffers;
+        std::vector<Allocation> blocks;
+        std::vector<VkFramebuffer> framebuffers;
+    };
+
+    /**
+     * @brief Command buffers of one frame in flight, reset once its fence signaled
+     */
+    struct FrameCommands {
+        VkCommandPool graphicsPool = VK_NULL_HANDLE;
+        VkCommandPool computePool = VK_NULL_HANDLE;
+        std::vector<VkCommandBuffer> graphics;
+        std::vector<VkCommandBuffer> compute;
+        u32 graphicsUsed = 0;
+        u32 computeUsed = 0;
+        u64 frameNumber = 0;
+    };
+
+    /**
+     * @brief Barriers collected for one point of a command buffer
+     */
+    struct BarrierBatch {
+        VkPipelineStageFlags srcStages = 0;
+        VkPipelineStageFlags dstStages = 0;
+        std::vector<VkImageMemoryBarrier> images;
+        std::vector<VkBufferMemoryBarrier> buffers;
+    };
+
+    void AddImageAccess(u32 pass, u32 image, VkImageUsageFlags usage, VkPipelineStageFlags stages,
+                        VkAccessFlags access, VkImageLayout layout, bool read, bool write);
+    void AddBufferAccess(u32 pass, u32 buffer, VkBufferUsageFlags usage, VkPipelineStageFlags stages,
+                         VkAccessFlags access, bool read, bool write);
+    VkPipelineStageFlags GetShaderStages(u32 pass) const;
+
+    void CullPasses();
+    void AssignQueues();
+    void ComputeLifetimes();
+    bool RealizeTransients();
+    void DestroyPhysical(RetiredResources& retired);
+    void CollectRetired();
+    void InitStates();
+
+    void RecordPass(u32 passIndex, VkCommandBuffer cmd, BarrierBatch& batch);
+    void RecordHandoffs(VkCommandBuffer compute, BarrierBatch& tailBatch, BarrierBatch& endBatch,
+                        VkPipelineStageFlags& tailWaitStages);
+    void RecordFinalBarriers(VkCommandBuffer cmd, BarrierBatch& batch);
+    void Transition(Resource& resource, bool isImage, const Access& access, BarrierBatch& batch);
+    void AddBarrier(BarrierBatch& batch, Resource& resource, bool isImage, VkPipelineStageFlags srcStages,
+                    VkAccessFlags srcAccess, VkPipelineStageFlags dstStages, VkAccessFlags dstAccess,
+                    VkImageLayout oldLayout, VkImageLayout newLayout, u32 srcFamily, u32 dstFamily);
+    void FlushBarriers(VkCommandBuffer cmd, BarrierBatch& batch);
+
+    VkRenderPass GetPassRenderPass(u32 passIndex);
+    VkRenderPass FindRenderPass(const std::vector<VkAttachmentDescription>& attachments, bool hasDepth);
+    VkFramebuffer GetFramebuffer(VkRenderPass renderPass, const std::vector<VkImageView>& views, VkExtent2D extent);
+    VkCommandBuffer BeginCommands(u32 queue);
+    void Submit(VkCommandBuffer pre, VkCommandBuffer graphics, VkCommandBuffer compute,
+                VkCommandBuffer tail, VkPipelineStageFlags tailWaitStages);
+    void Reset();
+
+    Renderer* m_Renderer = nullptr;
+    bool m_AsyncCompute = false;
+    u32 m_GraphicsFamily = 0;
+    u32 m_ComputeFamily = 0;
+
+    // Declarations of the current execution
+    std::vector<Pass> m_Passes;
+    std::vector<Resource> m_Images;
+    std::vector<Resource> m_Buffers;
+
+    // Transient resources, kept while the signature of the transients stays the same
+    std::vector<u64> m_Signature;
+    std::vector<PhysicalImage> m_PhysicalImages;
+    std::vector<PhysicalBuffer> m_PhysicalBuffers;
+    std::vector<Allocation> m_Blocks;
+    std::vector<RetiredResources> m_Retired;
+
+    std::map<std::vector<u32>, VkRenderPass> m_RenderPasses;
+    std::vector<Framebuffer> m_Framebuffers;
+
+    std::vector<FrameCommands> m_FrameCommands;
+    VkSemaphore m_Timeline = VK_NULL_HANDLE;
+    u64 m_TimelineValue = 0;
+
+    RenderGraphStats m_Stats;
+};
+
+} // namespace tvk
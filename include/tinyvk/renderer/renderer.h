@@ -7,9 +7,19 @@
 
 #include "../core/types.h"
 #include "context.h"
+#include "staging_ring.h"
+#include "frame_allocator.h"
+#include "transfer_queue.h"
+#include "compute_queue.h"
+#include "gpu_profiler.h"
+#include "pipeline_registry.h"
+#include "bindless_heap.h"
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <atomic>
+#include <functional>
 
 struct GLFWwindow;
 
@@ -26,8 +36,46 @@ class Texture;
 struct RendererConfig {
     bool enableValidation = true;
     bool vsync = true;
-    u32 maxFramesInFlight = 2;
+    u32 maxFramesInFlight = 2;    // Frame slots allocated at Init, upper bound for SetFramesInFlight()
+    u32 framesInFlight = 0;       // Frames queued at startup, 0 uses maxFramesInFlight
+    bool lowLatency = false;      // Pace frames in PaceFrame() so input is sampled as late as possible
+    float latencyMarginMs = 2.0f; // Headroom left before the predicted refresh in low latency mode
     Color clearColor = Color::Black();
+    VkDeviceSize stagingBufferSize = 32ull * 1024 * 1024;
+    VkDeviceSize transferStagingSize = 32ull * 1024 * 1024;   // Staging ring of the async transfer queue
+    VkDeviceSize frameMemorySize = 4ull * 1024 * 1024;        // Transient memory of each frame in flight
+    u32 recordingThreads = 0;     // Threads recording secondary command buffers, 0 uses the hardware thread count
+    u32 bindlessImages = 16384;   // Capacities of the bindless heap, clamped to the device limits
+    u32 bindlessSamplers = 256;
+    u32 bindlessBuffers = 4096;
+    bool gpuProfiling = true;     // Timestamp queries for GPU scopes, see GpuProfiler
+    bool gpuPipelineStatistics = false;
+    u32 gpuProfilerScopes = 64;   // Scopes measured per frame
+    VkExtent2D headlessExtent = {1280, 720};   // Offscreen target size when initialized without a window
+};
+
+/**
+ * @brief Frame latency measured by the Renderer, in milliseconds
+ */
+struct LatencyStats {
+    float latencyMs = 0.0f;          // Input sampled until the frame was displayed, smoothed
+    float lastLatencyMs = 0.0f;      // Same for the latest measured frame
+    float paceWaitMs = 0.0f;         // Time PaceFrame() waited ahead of the latest frame
+    float refreshIntervalMs = 0.0f;  // Measured interval between displayed frames, 0 until known
+    u32 missedRefreshes = 0;         // Low latency frames displayed one or more refreshes late
+    bool displayTimed = false;       // Displayed time from VK_KHR_present_wait, else the GPU completion seen by the CPU
+};
+
+/**
+ * @brief Secondary command buffers recorded by one thread during one frame
+ */
+struct ThreadCommands {
+    VkCommandPool commandPool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> commandBuffers;
+    u32 used = 0;
+
+    // Ended and waiting to be executed by the frame's render pass
+    std::vector<VkCommandBuffer> recorded;
 };
 
 /**
@@ -38,6 +86,24 @@ struct FrameData {
     VkSemaphore imageAvailableSemaphore = VK_NULL_HANDLE;
     VkSemaphore renderFinishedSemaphore = VK_NULL_HANDLE;
     VkFence inFlightFence = VK_NULL_HANDLE;
+
+    // Upload commands submitted ahead of the frame, reused once the fence signals
+    std::vector<VkCommandBuffer> uploadCommandBuffers;
+    u32 uploadIndex = 0;
+    bool uploadRecording = false;
+
+    u64 submittedFrame = 0;       // Frame number of the last submission guarded by the fence
+    bool pendingSubmission = false;
+    std::chrono::steady_clock::time_point inputTime;   // Input sampled for the submission
+
+    // Recorded elsewhere (e.g. by render widgets), submitted ahead of the frame's command buffer
+    std::vector<VkCommandBuffer> queuedCommandBuffers;
+
+    // The render pass is built from secondaries, the main thread records into passCommandBuffer
+    ThreadCommands mainCommands;
+    std::vector<ThreadCommands> threadCommands;
+    VkCommandBuffer passCommandBuffer = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> executeCommandBuffers;
 };
 
 /**
@@ -54,6 +120,8 @@ public:
 
     /**
      * @brief Initialize the renderer
+     * @param window Window to present to, nullptr renders headless into offscreen images
+     *        of RendererConfig::headlessExtent, one per frame slot
      */
     bool Init(Window* window, const RendererConfig& config = RendererConfig{});
 
@@ -74,10 +142,17 @@ public:
     void EndFrame();
 
     /**
-     * @brief Handle window resize
+     * @brief Handle window resize, resizes the offscreen images when headless
      */
     void OnResize(u32 width, u32 height);
 
+    /**
+     * @brief Check if the renderer draws into offscreen images instead of a swapchain
+     * Frames are submitted without acquire and present, the swapchain getters describe the
+     * offscreen images. They end each frame in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+     */
+    bool IsHeadless() const { return m_Window == nullptr; }
+
     /**
      * @brief Set clear color
      */
@@ -90,14 +165,83 @@ public:
 
     /**
      * @brief Get current command buffer
+     * Records into the frame's render pass on the main thread
      */
     VkCommandBuffer GetCurrentCommandBuffer() const;
 
+    /**
+     * @brief Get number of threads that can record secondary command buffers at the same time
+     */
+    u32 GetRecordingThreadCount() const { return m_RecordingThreadCount; }
+
+    /**
+     * @brief Begin a secondary command buffer continuing the frame's render pass
+     * @param thread Recording thread index, each index must only be used by one thread at a time
+     * Viewport and scissor are set to the swapchain extent. Call between BeginFrame() and EndFrame()
+     */
+    VkCommandBuffer BeginSecondaryCommands(u32 thread);
+
+    /**
+     * @brief End a secondary command buffer, it is executed by the next merge
+     */
+    void EndSecondaryCommands(u32 thread, VkCommandBuffer cmd);
+
+    /**
+     * @brief Execute the secondary command buffers ended so far, in thread order
+     * Call on the main thread once the recording threads are done. The current command buffer
+     * changes, fetch it again with GetCurrentCommandBuffer(). Secondaries still pending at
+     * EndFrame() run ahead of the commands recorded on the main thread since the last merge
+     */
+    void ExecuteSecondaryCommands();
+
     /**
      * @brief Get current frame index
      */
     u32 GetCurrentFrameIndex() const { return m_CurrentFrame; }
 
+    /**
+     * @brief Get number of frame slots, the upper bound for GetFramesInFlight()
+     * Per-frame resources are sized by this, GetCurrentFrameIndex() stays below it
+     */
+    u32 GetMaxFramesInFlight() const { return m_Config.maxFramesInFlight; }
+
+    /**
+     * @brief Get number of frames the CPU may currently record ahead of the GPU
+     */
+    u32 GetFramesInFlight() const { return m_FramesInFlight; }
+
+    /**
+     * @brief Change the number of frames in flight, applied when the current frame ends
+     * Clamped to [1, GetMaxFramesInFlight()]. Fewer frames lower latency, more absorb CPU spikes
+     */
+    void SetFramesInFlight(u32 count);
+
+    /**
+     * @brief Wait for the best moment to start the next frame, call right before sampling input
+     * In low latency mode the previous frame is waited for until it is displayed, or finished by
+     * the GPU without present wait. With present wait the start is then delayed so that the frame
+     * finishes just ahead of the next refresh. Also timestamps the input for GetLatencyStats()
+     */
+    void PaceFrame();
+
+    void SetLowLatency(bool enabled) { m_Config.lowLatency = enabled; }
+    bool IsLowLatency() const { return m_Config.lowLatency; }
+
+    /**
+     * @brief Get latency measured over recent frames
+     */
+    const LatencyStats& GetLatencyStats() const { return m_LatencyStats; }
+
+    /**
+     * @brief Serial of the frame being recorded, increments with every submission
+     */
+    u64 GetFrameNumber() const { return m_FrameNumber; }
+
+    /**
+     * @brief Latest frame serial the GPU is known to have finished
+     */
+    u64 GetCompletedFrame() const { return m_CompletedFrame; }
+
     /**
      * @brief Get swapchain image count
      */
@@ -118,18 +262,152 @@ public:
      */
     u32 GetCurrentImageIndex() const { return m_CurrentImageIndex; }
 
+    /**
+     * @brief Get a swapchain or offscreen image
+     */
+    VkImage GetSwapchainImage(u32 index) const { return m_SwapchainImages[index]; }
+
     /**
      * @brief Get render pass
      */
     VkRenderPass GetRenderPass() const { return m_RenderPass; }
 
+    /**
+     * @brief Queue a primary command buffer to execute ahead of the frame's command buffer
+     * It is submitted by EndFrame() and may be reused once this frame slot comes around again
+     */
+    void SubmitWithFrame(VkCommandBuffer cmd);
+
     /**
      * @brief Create a texture from file
      */
     Ref<Texture> CreateTexture(const std::string& path);
 
+    /**
+     * @brief Sub-allocate staging memory from the frame-fenced staging ring
+     * Valid until the GPU has finished the frame the upload is submitted with
+     */
+    StagingAllocation AllocateStaging(VkDeviceSize size, VkDeviceSize alignment = 16);
+
+    /**
+     * @brief Sub-allocate staging memory without flushing uploads when the ring is full
+     * @return An invalid allocation if the ring is full
+     */
+    StagingAllocation TryAllocateStaging(VkDeviceSize size, VkDeviceSize alignment = 16);
+
+    /**
+     * @brief Sub-allocate transient memory for the frame being recorded, e.g. uniforms
+     * Valid until the GPU has finished this frame, see FrameAllocator
+     */
+    FrameAllocation AllocateFrameMemory(VkDeviceSize size, VkDeviceSize alignment = 0) {
+        return m_FrameAllocator.Allocate(size, alignment);
+    }
+
+    /**
+     * @brief Get the per-frame linear allocator, reset by BeginFrame()
+     */
+    FrameAllocator& GetFrameAllocator() { return m_FrameAllocator; }
+
+    /**
+     * @brief Get the command buffer that upload copies are recorded into
+     * It is submitted ahead of the frame's command buffer in EndFrame()
+     */
+    VkCommandBuffer GetUploadCommandBuffer();
+
+    /**
+     * @brief Submit recorded uploads now so that work submitted afterwards sees them
+     */
+    void SubmitUploads();
+
+    /**
+     * @brief Submit recorded uploads and wait for the GPU to finish them
+     */
+    void FlushUploads();
+
+    /**
+     * @brief Check if upload commands are recorded but not yet submitted
+     */
+    bool HasPendingUploads() const;
+
+    /**
+     * @brief Identifies the batch of upload commands currently being recorded
+     */
+    u64 GetUploadSerial() const { return m_UploadSerial; }
+
+    /**
+     * @brief Get the asynchronous transfer queue
+     * Open batches are submitted at the end of every frame
+     */
+    TransferQueue& GetTransferQueue() { return m_TransferQueue; }
+
+    /**
+     * @brief Get the asynchronous compute queue
+     * Open batches are submitted after the frame's uploads at the end of every frame,
+     * readbacks are delivered by BeginFrame(). Submit earlier with SubmitCompute()
+     */
+    ComputeQueue& GetComputeQueue() { return m_ComputeQueue; }
+
+    /**
+     * @brief Count work that needs later frames to finish, e.g. a texture being decoded
+     * Callable from any thread, on-demand apps keep rendering until it is ended
+     */
+    void BeginBackgroundWork() { m_BackgroundWork.fetch_add(1, std::memory_order_relaxed); }
+    void EndBackgroundWork();
+
+    /**
+     * @brief Check if background work, uploads or compute batches still need frames to finish
+     */
+    bool HasBackgroundWork() const;
+
+    /**
+     * @brief Set the function waking an idle main loop, called by Wake() from any thread
+     */
+    void SetWakeCallback(std::function<void()> callback) { m_WakeCallback = std::move(callback); }
+
+    /**
+     * @brief Tell an idle main loop that background work made progress
+     */
+    void Wake() const;
+
+    /**
+     * @brief Submit recorded uploads, then the open compute batch waiting on the GPU for them
+     * @return Handle of the submitted batch, invalid if nothing was recorded
+     */
+    ComputeHandle SubmitCompute();
+
+    /**
+     * @brief Hand a buffer written by uploads over to the open compute batch
+     * Releases it at the end of the recorded uploads and acquires it in the batch,
+     * which waits for those uploads when submitted
+     */
+    void ReleaseToCompute(VkBuffer buffer, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    /**
+     * @brief Make the results of a compute batch visible to the next graphics submission
+     * Acquires the buffers the batch released and lets the GPU wait on its timeline value,
+     * the CPU does not wait. Work recorded into GetUploadCommandBuffer() already sees them
+     */
+    void WaitForCompute(const ComputeHandle& handle);
+
+    /**
+     * @brief Get the GPU profiler, the main render pass is measured as "Main Pass"
+     */
+    GpuProfiler& GetGpuProfiler() { return m_GpuProfiler; }
+
+    /**
+     * @brief Get the registry sharing graphics pipelines between identical descriptions
+     */
+    PipelineRegistry& GetPipelineRegistry() { return m_PipelineRegistry; }
+
+    /**
+     * @brief Get the bindless descriptor heap
+     * Disabled without descriptor indexing, see BindlessHeap::IsEnabled()
+     */
+    BindlessHeap& GetBindlessHeap() { return m_BindlessHeap; }
+
 private:
     bool CreateSwapchain();
+    bool CreateOffscreenImages();
     bool CreateImageViews();
     bool CreateRenderPass();
     bool CreateFramebuffers();
@@ -137,6 +415,20 @@ private:
     bool CreateSyncObjects();
     bool CreateDepthResources();
 
+    void WaitForFrame(FrameData& frame);
+    void CollectPresents(bool wait);
+    void Present(FrameData& frame);
+    void RecordLatency(std::chrono::steady_clock::time_point inputTime, std::chrono::steady_clock::time_point doneTime);
+    u32 AddTimelineWaits(VkSemaphore* semaphores, VkPipelineStageFlags* stages, u64* values);
+    VkCommandBuffer EndUploadCommands(FrameData& frame);
+
+    bool CreateThreadCommands(ThreadCommands& commands);
+    void DestroyThreadCommands(ThreadCommands& commands);
+    VkCommandBuffer BeginSecondary(ThreadCommands& commands);
+    void BeginPassSegment(FrameData& frame);
+    void EndPassSegment(FrameData& frame);
+    void MergeThreadCommands(FrameData& frame);
+
     void CleanupSwapchain();
     void RecreateSwapchain();
 
@@ -157,10 +449,11 @@ private:
     std::vector<VkImageView> m_SwapchainImageViews;
     VkFormat m_SwapchainImageFormat = VK_FORMAT_UNDEFINED;
     VkExtent2D m_SwapchainExtent{};
+    std::vector<Allocation> m_OffscreenAllocations;   // Headless only, backs m_SwapchainImages
 
     // Depth buffer
     VkImage m_DepthImage = VK_NULL_HANDLE;
-    VkDeviceMemory m_DepthImageMemory = VK_NULL_HANDLE;
+    Allocation m_DepthImageAllocation;
     VkImageView m_DepthImageView = VK_NULL_HANDLE;
     VkFormat m_DepthFormat = VK_FORMAT_UNDEFINED;
 
@@ -175,7 +468,58 @@ private:
     std::vector<VkSemaphore> m_ImageAvailableSemaphores;
     std::vector<VkSemaphore> m_RenderFinishedSemaphores;
     u32 m_CurrentSemaphoreIndex = 0;
+
+    // Staging memory for uploads
+    StagingRing m_StagingRing;
+    FrameAllocator m_FrameAllocator;
+    u64 m_FrameNumber = 1;
+    u64 m_CompletedFrame = 0;
+    u64 m_UploadSerial = 0;
+
+    // Asynchronous uploads, acquired by the upload command buffer
+    TransferQueue m_TransferQueue;
+    u64 m_TransferWaitValue = 0;
+
+    // Asynchronous compute, its releases are acquired by the upload command buffer
+    ComputeQueue m_ComputeQueue;
+    u64 m_ComputeWaitValue = 0;
+
+    // Signaled by every upload submission, compute batches wait on it for their inputs
+    VkSemaphore m_UploadTimeline = VK_NULL_HANDLE;
+    u64 m_UploadTimelineValue = 0;
+    std::vector<VkBufferMemoryBarrier> m_ComputeReleases;
+
+    GpuProfiler m_GpuProfiler;
+    u32 m_MainPassScope = GpuProfiler::InvalidScope;
     
+    std::vector<VkCommandBuffer> m_SubmitCommandBuffers;
+    u32 m_RecordingThreadCount = 1;
+
+    PipelineRegistry m_PipelineRegistry;
+    BindlessHeap m_BindlessHeap;
+
+    std::atomic<u32> m_BackgroundWork{0};
+    std::function<void()> m_WakeCallback;
+
+    // Frame pacing, present ids are only attached with VK_KHR_present_wait
+    struct PendingPresent {
+        u64 id = 0;
+        std::chrono::steady_clock::time_point inputTime;
+    };
+
+    u32 m_FramesInFlight = 2;
+    u32 m_RequestedFramesInFlight = 2;
+    u32 m_PreviousFrame = 0;         // Slot of the last submitted frame
+    u64 m_PresentId = 0;             // Per swapchain, restarts when it is recreated
+    u64 m_DisplayedId = 0;
+    std::vector<PendingPresent> m_PendingPresents;
+    std::chrono::steady_clock::time_point m_DisplayedTime;
+    std::chrono::steady_clock::time_point m_InputTime;
+    bool m_Paced = false;            // m_InputTime was taken by PaceFrame() for the next frame
+    bool m_SkipPaceDelay = false;    // The last frame missed its refresh
+    double m_WorkEstimate = 0.0;     // Seconds from input to GPU completion, decays slowly after spikes
+    LatencyStats m_LatencyStats;
+
     u32 m_CurrentFrame = 0;
     u32 m_CurrentImageIndex = 0;
     bool m_FramebufferResized = false;
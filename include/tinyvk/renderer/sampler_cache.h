@@ -0,0 +1,89 @@
+/**
+ * @file sampler_cache.h
+ * @brief Shared samplers keyed by their state
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include <vulkan/vulkan.h>
+#include <mutex>
+#include <unordered_map>
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief Sampler state, every field is 32 bits so the struct hashes without padding
+ */
+struct SamplerDesc {
+    VkFilter magFilter = VK_FILTER_LINEAR;
+    VkFilter minFilter = VK_FILTER_LINEAR;
+    VkSamplerMipmapMode mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+    VkSamplerAddressMode addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    VkSamplerAddressMode addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    VkSamplerAddressMode addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    VkBorderColor borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+    f32 maxAnisotropy = 0.0f;           // 0 disables anisotropic filtering, clamped to the device limit
+    f32 maxLod = VK_LOD_CLAMP_NONE;     // The image view bounds the levels sampled anyway
+
+    bool operator==(const SamplerDesc& other) const = default;
+};
+
+/**
+ * @brief Hands out one reference-counted VkSampler per distinct SamplerDesc
+ *
+ * Owned by the VulkanContext. Every Acquire() has to be matched by a
+ * Release() once the sampler is no longer used by the GPU, the sampler is
+ * destroyed with its last reference.
+ */
+class SamplerCache {
+public:
+    SamplerCache() = default;
+    ~SamplerCache();
+
+    // Non-copyable
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+
+    void Init(VulkanContext* context);
+
+    /**
+     * @brief Destroy every sampler, references still held become invalid
+     */
+    void Cleanup();
+
+    /**
+     * @brief Get the sampler for a state, created on first use
+     * @return Sampler or VK_NULL_HANDLE on failure
+     */
+    VkSampler Acquire(const SamplerDesc& desc);
+
+    /**
+     * @brief Drop a reference obtained from Acquire()
+     */
+    void Release(VkSampler sampler);
+
+    /**
+     * @brief Get number of distinct samplers alive
+     */
+    u32 GetSamplerCount() const;
+
+private:
+    struct DescHash {
+        size_t operator()(const SamplerDesc& desc) const;
+    };
+
+    struct Entry {
+        VkSampler sampler = VK_NULL_HANDLE;
+        u32 refCount = 0;
+    };
+
+    VulkanContext* m_Context = nullptr;
+    mutable std::mutex m_Mutex;
+    std::unordered_map<SamplerDesc, Entry, DescHash> m_Samplers;
+    std::unordered_map<VkSampler, SamplerDesc> m_Descs;
+};
+
+} // namespace tvk
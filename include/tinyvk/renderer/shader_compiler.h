@@ -23,12 +23,29 @@ enum class ShaderStage {
     TessEvaluation
 };
 
+/**
+ * @brief GLSL compiler with a SPIR-V cache keyed by source, stage, options and shaderc build
+ * Results are kept in memory and in the cache directory, so later calls and launches skip shaderc.
+ * Safe to call from multiple threads
+ */
 class ShaderCompiler {
 public:
     ShaderCompiler() = default;
     ~ShaderCompiler() = default;
 
     static std::vector<u32> CompileGLSL(const std::string& source, ShaderStage stage, const std::string& name = "shader");
+
+    /**
+     * @brief Set the directory of the on-disk SPIR-V cache, empty disables it
+     * Builds that could not hash the shaderc library never use the disk cache
+     */
+    static void SetCacheDirectory(const std::string& directory);
+    static std::string GetCacheDirectory();
+
+    /**
+     * @brief Drop the in-memory SPIR-V cache
+     */
+    static void ClearCache();
     
     static VkShaderModule CreateShaderModule(Renderer* renderer, const std::vector<u32>& spirv);
     static VkShaderModule CreateShaderModuleFromGLSL(Renderer* renderer, const std::string& glsl, ShaderStage stage, const std::string& name = "shader");
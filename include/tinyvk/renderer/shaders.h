@@ -49,6 +49,151 @@ void main() {
 }
 )";
 
+constexpr const char* instanced_vert = R"(
+#version 450
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inColor;
+layout(location = 4) in mat4 inModel;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragNormal;
+layout(location = 2) out vec2 fragTexCoord;
+
+layout(push_constant) uniform PushConstants {
+    mat4 modelMatrix;
+    mat4 viewProjectionMatrix;
+} push;
+
+void main() {
+    gl_Position = push.viewProjectionMatrix * inModel * vec4(inPosition, 1.0);
+    fragColor = inColor;
+    fragNormal = mat3(inModel) * inNormal;
+    fragTexCoord = inTexCoord;
+}
+)";
+
+constexpr const char* compact_vert = R"(
+#version 450
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec2 inNormal;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec4 inColor;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragNormal;
+layout(location = 2) out vec2 fragTexCoord;
+
+layout(push_constant) uniform PushConstants {
+    mat4 modelMatrix;
+    mat4 viewProjectionMatrix;
+} push;
+
+vec3 decodeOctahedral(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+void main() {
+    gl_Position = push.viewProjectionMatrix * push.modelMatrix * vec4(inPosition, 1.0);
+    fragColor = inColor.rgb;
+    fragNormal = mat3(push.modelMatrix) * decodeOctahedral(inNormal);
+    fragTexCoord = inTexCoord;
+}
+)";
+
+constexpr const char* depth_only_vert = R"(
+#version 450
+
+layout(location = 0) in vec3 inPosition;
+
+layout(push_constant) uniform PushConstants {
+    mat4 modelMatrix;
+    mat4 viewProjectionMatrix;
+} push;
+
+void main() {
+    gl_Position = push.viewProjectionMatrix * push.modelMatrix * vec4(inPosition, 1.0);
+}
+)";
+
+constexpr const char* depth_only_frag = R"(
+#version 450
+
+void main() {
+}
+)";
+
+constexpr const char* frustum_cull_comp = R"(
+#version 450
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct CullObject {
+    mat4 model;
+    vec4 boundingSphere;
+    uint drawIndex;
+    uint pad0;
+    uint pad1;
+    uint pad2;
+};
+
+struct DrawCommand {
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+layout(std430, binding = 0) readonly buffer ObjectBuffer {
+    CullObject objects[];
+};
+
+layout(std430, binding = 1) writeonly buffer InstanceBuffer {
+    mat4 instances[];
+};
+
+layout(std430, binding = 2) buffer DrawBuffer {
+    DrawCommand draws[];
+};
+
+layout(push_constant) uniform PushConstants {
+    vec4 planes[6];
+    uint objectCount;
+} push;
+
+void main() {
+    uint index = gl_GlobalInvocationID.x;
+    
+    if (index >= push.objectCount) {
+        return;
+    }
+    
+    CullObject object = objects[index];
+    
+    // Sphere to world space, the radius scaled by the largest axis
+    vec3 center = (object.model * vec4(object.boundingSphere.xyz, 1.0)).xyz;
+    float scale = max(max(length(object.model[0].xyz), length(object.model[1].xyz)), length(object.model[2].xyz));
+    float radius = object.boundingSphere.w * scale;
+    
+    for (int i = 0; i < 6; i++) {
+        if (dot(push.planes[i].xyz, center) + push.planes[i].w < -radius) {
+            return;
+        }
+    }
+    
+    uint slot = atomicAdd(draws[object.drawIndex].instanceCount, 1);
+    instances[draws[object.drawIndex].firstInstance + slot] = object.model;
+}
+)";
+
 constexpr const char* array_multiply_comp = R"(
 #version 450
 
@@ -121,5 +266,21 @@ void main() {
 }
 )";
 
+// Declarations of the bindless heap, insert after #version
+// Storage buffers are raw words, reinterpret them with uintBitsToFloat() and friends
+constexpr const char* bindless_glsl = R"(
+#extension GL_EXT_nonuniform_qualifier : require
+
+layout(set = 0, binding = 0) uniform texture2D textures[];
+layout(set = 0, binding = 1) uniform sampler samplers[];
+layout(set = 0, binding = 2) buffer StorageBuffers {
+    uint data[];
+} buffers[];
+
+vec4 SampleBindless(uint textureIndex, uint samplerIndex, vec2 uv) {
+    return texture(sampler2D(textures[nonuniformEXT(textureIndex)], samplers[nonuniformEXT(samplerIndex)]), uv);
+}
+)";
+
 } // namespace shaders
 } // namespace tvk
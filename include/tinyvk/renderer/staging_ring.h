@@ -0,0 +1,108 @@
+/**
+ * @file staging_ring.h
+ * @brief Persistently mapped staging ring buffer for TinyVK uploads
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "allocator.h"
+#include <vulkan/vulkan.h>
+#include <vector>
+
+namespace tvk {
+
+class VulkanContext;
+
+/**
+ * @brief A region of staging memory ready to be written by the CPU
+ */
+struct StagingAllocation {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void* data = nullptr;
+
+    bool IsValid() const { return data != nullptr; }
+};
+
+/**
+ * @brief Ring of host visible memory that uploads sub-allocate from
+ *
+ * Allocations are grouped by Retire() under a marker (e.g. a frame number)
+ * and handed back by Release() once the GPU has finished with that marker.
+ * Requests larger than the ring get a dedicated buffer with the same lifetime.
+ */
+class StagingRing {
+public:
+    StagingRing() = default;
+    ~StagingRing();
+
+    // Non-copyable
+    StagingRing(const StagingRing&) = delete;
+    StagingRing& operator=(const StagingRing&) = delete;
+
+    /**
+     * @brief Create and persistently map the ring buffer
+     */
+    bool Init(VulkanContext* context, VkDeviceSize capacity);
+
+    /**
+     * @brief Destroy the ring - the GPU must be done with every allocation
+     */
+    void Cleanup();
+
+    /**
+     * @brief Sub-allocate staging memory
+     * @return An invalid allocation if the ring is currently full
+     */
+    StagingAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment = 16);
+
+    /**
+     * @brief Assign every allocation made since the last call to a marker
+     */
+    void Retire(u64 marker);
+
+    /**
+     * @brief Free all allocations whose marker is <= completedMarker
+     */
+    void Release(u64 completedMarker);
+
+    /**
+     * @brief Free everything that has been retired
+     */
+    void ReleaseAll();
+
+    VkDeviceSize GetCapacity() const { return m_Capacity; }
+    VkDeviceSize GetUsedSize() const { return m_Used; }
+
+private:
+    struct Region {
+        u64 marker = 0;
+        VkDeviceSize end = 0;     // Ring head when the region was retired
+        VkDeviceSize bytes = 0;   // Bytes consumed including wrap padding
+    };
+
+    struct Overflow {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        Allocation allocation;
+        u64 marker = 0;
+        bool retired = false;
+    };
+
+    VulkanContext* m_Context = nullptr;
+    VkBuffer m_Buffer = VK_NULL_HANDLE;
+    Allocation m_Allocation;
+    u8* m_Data = nullptr;
+
+    VkDeviceSize m_Capacity = 0;
+    VkDeviceSize m_Head = 0;
+    VkDeviceSize m_Tail = 0;
+    VkDeviceSize m_Used = 0;
+    VkDeviceSize m_PendingBytes = 0;
+
+    std::vector<Region> m_Regions;
+    std::vector<Overflow> m_Overflow;
+};
+
+} // namespace tvk
@@ -6,14 +6,21 @@
 #pragma once
 
 #include "../core/types.h"
+#include "allocator.h"
+#include "sampler_cache.h"
+#include "bindless_heap.h"
 #include <vulkan/vulkan.h>
 #include <string>
+#include <vector>
 
 namespace tvk {
 
 // Forward declarations
 class VulkanContext;
 class Renderer;
+class UploadBatch;
+class TextureLoader;
+class TextureStreamer;
 
 /**
  * @brief Texture format options
@@ -29,7 +36,24 @@ enum class TextureFormat {
     RGBA16F,
     RGBA32F,
     Depth24Stencil8,
-    Depth32F
+    Depth32F,
+
+    // Block compressed, 4x4 texel blocks. Check IsFormatSupported() before use
+    BC1,
+    BC1_SRGB,
+    BC3,
+    BC3_SRGB,
+    BC4,
+    BC5,
+    BC6H,
+    BC7,
+    BC7_SRGB,
+    ETC2_RGB8,
+    ETC2_RGB8_SRGB,
+    ETC2_RGBA8,
+    ETC2_RGBA8_SRGB,
+    ASTC_4x4,
+    ASTC_4x4_SRGB
 };
 
 /**
@@ -50,6 +74,25 @@ enum class TextureWrap {
     ClampToBorder
 };
 
+/**
+ * @brief Load state of a texture, see TextureLoader
+ */
+enum class TextureState {
+    Pending,
+    Ready,
+    Failed
+};
+
+/**
+ * @brief One level of a pre-built mip chain, offset relative to the start of the texel data
+ */
+struct TextureMipLevel {
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    u32 width = 0;
+    u32 height = 0;
+};
+
 /**
  * @brief Texture creation specification
  */
@@ -64,6 +107,7 @@ struct TextureSpec {
     bool generateMipmaps = true;
     bool useSampler = true;
     bool storageUsage = false;
+    u32 maxSize = 0;              // Files are loaded from the first level no larger than this, 0 for full size
 };
 
 /**
@@ -85,12 +129,18 @@ public:
     /**
      * @brief Create texture from file
      * @param renderer The renderer to use
-     * @param filepath Path to image file (PNG, JPG, BMP, TGA, etc.)
+     * @param filepath Path to image file (PNG, JPG, BMP, TGA, etc.), or a KTX2/DDS file whose
+     *                 format and mip chain are uploaded as stored
      * @param spec Texture specification (filter, wrap mode, etc.)
      * @return Created texture or nullptr on failure
      */
     static Ref<Texture> LoadFromFile(Renderer* renderer, const std::string& filepath, const TextureSpec& spec = TextureSpec{});
 
+    /**
+     * @brief Create texture from file, uploaded when the batch is recorded
+     */
+    static Ref<Texture> LoadFromFile(UploadBatch& batch, const std::string& filepath, const TextureSpec& spec = TextureSpec{});
+
     /**
      * @brief Create texture from memory
      * @param renderer The renderer to use  
@@ -102,6 +152,11 @@ public:
      */
     static Ref<Texture> Create(Renderer* renderer, const void* data, u32 width, u32 height, const TextureSpec& spec = TextureSpec{});
 
+    /**
+     * @brief Create texture from memory, uploaded when the batch is recorded
+     */
+    static Ref<Texture> Create(UploadBatch& batch, const void* data, u32 width, u32 height, const TextureSpec& spec = TextureSpec{});
+
     /**
      * @brief Create an empty texture
      * @param renderer The renderer to use
@@ -120,40 +175,93 @@ public:
 
     /**
      * @brief Get ImGui texture ID for displaying in ImGui::Image
+     * Textures still loading return the loader's placeholder
      */
-    VkDescriptorSet GetImGuiTextureID() const { return m_ImGuiDescriptorSet; }
+    VkDescriptorSet GetImGuiTextureID() const {
+        return m_State == TextureState::Ready ? m_ImGuiDescriptorSet : m_PlaceholderDescriptorSet;
+    }
 
     /**
      * @brief Bind texture to ImGui for rendering
-     * Must be called before using GetImGuiTextureID()
+     * Must be called before using GetImGuiTextureID(), does nothing without the ImGui Vulkan backend, e.g. headless
      */
     void BindToImGui();
 
+    /**
+     * @brief Destroy without waiting for the device, once the GPU has finished every frame using the texture
+     * See Renderer::GetCompletedFrame()
+     */
+    void SkipWaitIdleOnCleanup() { m_WaitIdleOnCleanup = false; }
+
     // Getters
     u32 GetWidth() const { return m_Width; }
     u32 GetHeight() const { return m_Height; }
     u32 GetMipLevels() const { return m_MipLevels; }
-    u32 GetChannels() const { return 4; } // Always RGBA after loading
+    u32 GetChannels() const { return GetChannelCount(m_TextureFormat); }
     VkImage GetImage() const { return m_Image; }
     VkImageView GetImageView() const { return m_ImageView; }
     VkSampler GetSampler() const { return m_Sampler; }
+
+    /**
+     * @brief Get indices into the renderer's bindless heap
+     * BindlessHeap::InvalidIndex if the heap is disabled or full
+     */
+    u32 GetBindlessIndex() const { return m_BindlessIndex; }
+    u32 GetBindlessSamplerIndex() const { return m_BindlessSamplerIndex; }
     VkFormat GetFormat() const { return m_Format; }
     const std::string& GetFilePath() const { return m_FilePath; }
     bool IsValid() const { return m_Image != VK_NULL_HANDLE; }
+    TextureFormat GetTextureFormat() const { return m_TextureFormat; }
+    VkDeviceSize GetMemorySize() const { return m_ImageAllocation.size; }
+
+    /**
+     * @brief Size of the image in its file, larger than GetWidth()/GetHeight() if loaded with a maxSize
+     */
+    u32 GetSourceWidth() const { return m_SourceWidth; }
+    u32 GetSourceHeight() const { return m_SourceHeight; }
+
+    /**
+     * @brief Check if the contents are uploaded, always true unless loaded by a TextureLoader
+     */
+    bool IsReady() const { return m_State == TextureState::Ready; }
+    TextureState GetState() const { return m_State; }
+
+    /**
+     * @brief Check if the device can sample a format with optimal tiling
+     */
+    static bool IsFormatSupported(Renderer* renderer, TextureFormat format);
+    static bool IsCompressed(TextureFormat format);
+    static u32 GetChannelCount(TextureFormat format);
+
+    /**
+     * @brief Bytes of one mip level, whole blocks for compressed formats
+     */
+    static VkDeviceSize GetImageSize(TextureFormat format, u32 width, u32 height);
+
+    static VkFormat ToVkFormat(TextureFormat format);
+    static bool FromVkFormat(VkFormat vkFormat, TextureFormat& format);
 
 private:
-    bool Init(Renderer* renderer, const void* data, const TextureSpec& spec);
+    friend class TextureLoader;
+    friend class TextureStreamer;
+
+    static Ref<Texture> LoadFromFile(Renderer* renderer, UploadBatch* batch, const std::string& filepath, const TextureSpec& spec);
+
+    bool Init(Renderer* renderer, const void* data, const TextureSpec& spec, UploadBatch* batch = nullptr);
+    bool InitWithLevels(Renderer* renderer, const void* data, VkDeviceSize size, const std::vector<TextureMipLevel>& levels,
+                        const TextureSpec& spec, UploadBatch* batch);
+    bool CreateResources(Renderer* renderer, const TextureSpec& spec, u32 mipLevels = 0);
     void Cleanup();
-    void CreateImage(u32 width, u32 height, VkFormat format, VkImageTiling tiling,
+    bool CreateImage(u32 width, u32 height, VkFormat format, VkImageTiling tiling,
                      VkImageUsageFlags usage, VkMemoryPropertyFlags properties);
     void CreateImageView(VkFormat format, VkImageAspectFlags aspectFlags);
-    void CreateSampler(const TextureSpec& spec);
-    void TransitionImageLayout(VkImage image, VkFormat format,
-                               VkImageLayout oldLayout, VkImageLayout newLayout, u32 mipLevels);
-    void CopyBufferToImage(VkBuffer buffer, VkImage image, u32 width, u32 height);
-    void GenerateMipmaps(VkImage image, VkFormat format, u32 width, u32 height, u32 mipLevels);
 
-    static VkFormat ToVkFormat(TextureFormat format);
+    /**
+     * @brief Halve RGBA8 pixels in place until neither side exceeds maxSize
+     */
+    static void Downsample(u8* pixels, u32& width, u32& height, u32 maxSize);
+
+    static SamplerDesc GetSamplerDesc(const TextureSpec& spec);
     static VkFilter ToVkFilter(TextureFilter filter);
     static VkSamplerAddressMode ToVkWrap(TextureWrap wrap);
 
@@ -161,16 +269,24 @@ private:
     VulkanContext* m_Context = nullptr;
 
     VkImage m_Image = VK_NULL_HANDLE;
-    VkDeviceMemory m_ImageMemory = VK_NULL_HANDLE;
+    Allocation m_ImageAllocation;
     VkImageView m_ImageView = VK_NULL_HANDLE;
     VkSampler m_Sampler = VK_NULL_HANDLE;
+    u32 m_BindlessIndex = BindlessHeap::InvalidIndex;
+    u32 m_BindlessSamplerIndex = BindlessHeap::InvalidIndex;
     VkFormat m_Format = VK_FORMAT_R8G8B8A8_UNORM;
+    TextureFormat m_TextureFormat = TextureFormat::RGBA8;
 
     VkDescriptorSet m_ImGuiDescriptorSet = VK_NULL_HANDLE;
+    VkDescriptorSet m_PlaceholderDescriptorSet = VK_NULL_HANDLE;   // Owned by the loader
+    TextureState m_State = TextureState::Ready;
+    bool m_WaitIdleOnCleanup = true;   // Cleared by the streamer once the GPU is done with the image
 
     u32 m_Width = 0;
     u32 m_Height = 0;
     u32 m_MipLevels = 1;
+    u32 m_SourceWidth = 0;
+    u32 m_SourceHeight = 0;
     bool m_StorageUsage = false;
     std::string m_FilePath;
 };
@@ -0,0 +1,75 @@
+/**
+ * @file texture_file.h
+ * @brief KTX2 and DDS texture containers with pre-built mip chains
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/mapped_file.h"
+#include "texture.h"
+#include <string>
+#include <vector>
+
+namespace tvk {
+
+/**
+ * @brief A mapped KTX2 or DDS file holding a single 2D image
+ *
+ * Block compressed and uncompressed formats are read as stored, including
+ * every mip level. KTX2 files asking for generated mips load the base level
+ * only. Supercompressed KTX2 files, cube maps, arrays and volume textures
+ * are rejected.
+ */
+class TextureFile {
+public:
+    TextureFile() = default;
+    ~TextureFile() = default;
+
+    // Non-copyable
+    TextureFile(const TextureFile&) = delete;
+    TextureFile& operator=(const TextureFile&) = delete;
+
+    /**
+     * @brief Check if the extension is .ktx2 or .dds
+     */
+    static bool IsContainer(const std::string& path);
+
+    bool Open(const std::string& path);
+    void Close();
+
+    TextureFormat GetFormat() const { return m_Format; }
+    u32 GetWidth() const { return m_Width; }
+    u32 GetHeight() const { return m_Height; }
+
+    /**
+     * @brief Drop leading levels with a side larger than maxSize, the smallest level is always kept
+     */
+    void SkipLevels(u32 maxSize);
+
+    /**
+     * @brief Levels from largest to smallest, offsets relative to GetData()
+     */
+    const std::vector<TextureMipLevel>& GetLevels() const { return m_Levels; }
+
+    /**
+     * @brief Texel data of all levels, points into the mapping
+     */
+    const u8* GetData() const { return m_Data; }
+    VkDeviceSize GetDataSize() const { return m_DataSize; }
+
+private:
+    bool ParseKtx2(const std::string& path);
+    bool ParseDds(const std::string& path);
+    bool SetLevels(const std::string& path, const u64* offsets, u32 levelCount);
+
+    MappedFile m_File;
+    TextureFormat m_Format = TextureFormat::RGBA8;
+    u32 m_Width = 0;
+    u32 m_Height = 0;
+    std::vector<TextureMipLevel> m_Levels;
+    const u8* m_Data = nullptr;
+    VkDeviceSize m_DataSize = 0;
+};
+
+} // namespace tvk
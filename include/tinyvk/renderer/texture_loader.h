@@ -0,0 +1,117 @@
+/**
+ * @file texture_loader.h
+ * @brief Asynchronous texture loading with decoding on the job system
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/job_system.h"
+#include "texture.h"
+#include <vulkan/vulkan.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tvk {
+
+class Renderer;
+
+/**
+ * @brief Loads textures without stalling the frame
+ *
+ * Load() returns a pending texture at once and decodes the file on a worker,
+ * KTX2 and DDS files are read as stored including their mips.
+ * Update() creates the images of decoded files and uploads them on the transfer
+ * queue. Once the graphics queue owns them, the mip chains of all images acquired
+ * since the last Update() are generated together and the textures become ready.
+ * Until then GetImGuiTextureID() returns a placeholder.
+ *
+ * @code
+ * TextureLoader loader;
+ * loader.Init(renderer, app.GetJobs());
+ * auto texture = loader.Load("assets/albedo.png");
+ *
+ * // Every frame
+ * loader.Update();
+ * ImGui::Image(texture->GetImGuiTextureID(), size);
+ * @endcode
+ */
+class TextureLoader {
+public:
+    TextureLoader() = default;
+    ~TextureLoader();
+
+    // Non-copyable
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+
+    /**
+     * @brief Create the placeholder texture
+     * @param uploadBudget Bytes of decoded texels uploaded per Update(), at least one image is
+     */
+    bool Init(Renderer* renderer, JobSystem& jobs, VkDeviceSize uploadBudget = 64ull * 1024 * 1024);
+
+    /**
+     * @brief Wait for running decodes and drop images that were not uploaded yet
+     */
+    void Cleanup();
+
+    /**
+     * @brief Start loading a file, the texture is pending until its contents are uploaded
+     */
+    Ref<Texture> Load(const std::string& filepath, const TextureSpec& spec = TextureSpec{});
+
+    /**
+     * @brief Upload decoded images and finish acquired ones, call once per frame on the main thread
+     */
+    void Update();
+
+    /**
+     * @brief Block until every texture requested so far is ready or failed
+     */
+    void WaitAll();
+
+    /**
+     * @brief Get number of textures that are neither ready nor failed
+     */
+    u32 GetPendingCount() const { return m_PendingCount; }
+
+    const Ref<Texture>& GetPlaceholder() const { return m_Placeholder; }
+
+private:
+    struct DecodedImage {
+        Ref<Texture> texture;
+        TextureSpec spec;
+        u8* pixels = nullptr;   // stb_image allocation, nullptr if decoding failed
+        u32 sourceWidth = 0;    // Before levels above spec.maxSize were dropped
+        u32 sourceHeight = 0;
+
+        // Mip chain of a KTX2 or DDS file, uploaded as stored
+        std::vector<u8> levelData;
+        std::vector<TextureMipLevel> levels;
+
+        bool IsValid() const { return pixels || !levels.empty(); }
+        VkDeviceSize GetSize() const {
+            return levels.empty() ? static_cast<VkDeviceSize>(spec.width) * spec.height * 4 : levelData.size();
+        }
+    };
+
+    void Upload(DecodedImage& image, UploadBatch& fallback);
+    void GenerateMipmaps();
+    void Finish(Texture& texture, TextureState state);
+
+    Renderer* m_Renderer = nullptr;
+    JobSystem* m_Jobs = nullptr;
+    VkDeviceSize m_UploadBudget = 0;
+    Ref<Texture> m_Placeholder;
+
+    JobCounter m_Decoding;
+    std::mutex m_DecodedMutex;
+    std::vector<DecodedImage> m_Decoded;   // Filled by workers
+
+    std::vector<Ref<Texture>> m_Acquired;  // Owned by graphics, waiting for mipmaps
+    u32 m_PendingCount = 0;
+};
+
+} // namespace tvk
@@ -0,0 +1,177 @@
+/**
+ * @file texture_streamer.h
+ * @brief Texture streaming by on-screen size within a VRAM budget
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "../core/job_system.h"
+#include "texture.h"
+#include "texture_loader.h"
+#include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
+
+namespace tvk {
+
+class Renderer;
+class TextureStreamer;
+
+/**
+ * @brief Texture streamer configuration
+ */
+struct TextureStreamerConfig {
+    VkDeviceSize budget = 0;           // Bytes of streamed textures, 0 derives it from the device-local heap budget
+    f32 heapBudgetFraction = 0.5f;     // Share of the device-local heap budget used when budget is 0
+    u32 minSize = 64;                  // Largest side of the levels loaded first, textures never drop below it
+    u32 evictAfterFrames = 120;        // Frames without use after which a texture may fall back to minSize
+    u32 maxLoadsInFlight = 8;          // Resolution changes loading at the same time
+    VkDeviceSize uploadBudget = 64ull * 1024 * 1024;   // See TextureLoader::Init()
+};
+
+/**
+ * @brief A texture whose resolution follows its on-screen size
+ *
+ * Holds the image at one level of its full mip chain, starting with the level
+ * no larger than TextureStreamerConfig::minSize. The streamer swaps in another
+ * level once it is uploaded, the previous one stays visible until then.
+ */
+class StreamedTexture {
+public:
+    StreamedTexture() = default;
+
+    // Non-copyable
+    StreamedTexture(const StreamedTexture&) = delete;
+    StreamedTexture& operator=(const StreamedTexture&) = delete;
+
+    /**
+     * @brief Get ImGui texture ID and mark the texture as used this frame
+     * @param width On-screen width in pixels, 0 together with height requests the full resolution
+     * @param height On-screen height in pixels
+     */
+    VkDescriptorSet GetImGuiTextureID(f32 width = 0.0f, f32 height = 0.0f);
+
+    /**
+     * @brief Resident texture, nullptr until its first level is uploaded
+     */
+    const Ref<Texture>& GetTexture() const { return m_Texture; }
+
+    u32 GetWidth() const { return m_Texture ? m_Texture->GetWidth() : 0; }
+    u32 GetHeight() const { return m_Texture ? m_Texture->GetHeight() : 0; }
+    u32 GetSourceWidth() const { return m_Texture ? m_Texture->GetSourceWidth() : 0; }
+    u32 GetSourceHeight() const { return m_Texture ? m_Texture->GetSourceHeight() : 0; }
+    const std::string& GetFilePath() const { return m_FilePath; }
+    bool IsResident() const { return m_Texture != nullptr; }
+
+    /**
+     * @brief Check if loading a level failed, the resident level is kept and no other is requested
+     */
+    bool IsFailed() const { return m_Failed; }
+
+private:
+    friend class TextureStreamer;
+
+    static constexpr u32 s_NoLevel = ~0u;
+
+    Renderer* m_Renderer = nullptr;
+    VkDescriptorSet m_Placeholder = VK_NULL_HANDLE;   // Owned by the streamer's loader
+    std::string m_FilePath;
+    TextureSpec m_Spec;
+
+    Ref<Texture> m_Texture;                // Displayed level
+    Ref<Texture> m_Loading;                // Replacement being loaded
+    u32 m_Level = s_NoLevel;               // Halvings of the source image, 0 for full resolution
+    u32 m_MaxLevel = s_NoLevel;            // Lowest level the file provides, known once a load came up short
+    u32 m_LoadingSize = 0;                 // maxSize of the replacement
+    bool m_Failed = false;
+
+    u64 m_LastUsedFrame = 0;
+    u32 m_RequestedSize = 0;               // Largest side requested during m_LastUsedFrame, 0 for full
+};
+
+/**
+ * @brief Streams texture levels by on-screen usage and evicts them under a VRAM budget
+ *
+ * Load() starts with a low resolution level. Every Update() compares the size
+ * each texture was last drawn at with its resident level and loads a better
+ * fitting one through a TextureLoader, largest gains for the most recently
+ * used textures first. Whenever streamed textures exceed the budget, or the
+ * driver reports the device-local heaps over budget via VK_EXT_memory_budget,
+ * the least recently used textures fall back to lower levels. Replaced images
+ * are destroyed once the GPU has finished the frames that used them.
+ *
+ * @code
+ * TextureStreamer streamer;
+ * streamer.Init(renderer, app.GetJobs());
+ * auto thumbnail = streamer.Load("assets/photo.jpg");
+ *
+ * // Every frame
+ * streamer.Update();
+ * ImGui::Image(thumbnail->GetImGuiTextureID(128, 128), ImVec2(128, 128));
+ * @endcode
+ */
+class TextureStreamer {
+public:
+    TextureStreamer() = default;
+    ~TextureStreamer();
+
+    // Non-copyable
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    bool Init(Renderer* renderer, JobSystem& jobs, const TextureStreamerConfig& config = TextureStreamerConfig{});
+
+    /**
+     * @brief Finish running loads and release every image not referenced elsewhere
+     */
+    void Cleanup();
+
+    /**
+     * @brief Start streaming a file, spec.maxSize is ignored
+     */
+    Ref<StreamedTexture> Load(const std::string& filepath, const TextureSpec& spec = TextureSpec{});
+
+    /**
+     * @brief Swap in loaded levels, evict and request new ones, call once per frame on the main thread
+     */
+    void Update();
+
+    /**
+     * @brief Get bytes of device memory held by streamed textures, including replacements being loaded
+     */
+    VkDeviceSize GetResidentBytes() const { return m_ResidentBytes; }
+
+    /**
+     * @brief Get budget applied by the last Update()
+     */
+    VkDeviceSize GetBudget() const { return m_Budget; }
+
+    u32 GetTextureCount() const { return static_cast<u32>(m_Textures.size()); }
+    u32 GetLoadingCount() const { return m_LoadingCount; }
+    TextureLoader& GetLoader() { return m_Loader; }
+
+private:
+    struct RetiredTexture {
+        Ref<Texture> texture;
+        u64 frame = 0;          // Last frame that may use it, 0 while still loading
+    };
+
+    void Request(StreamedTexture& texture, u32 maxSize);
+    void Retire(Ref<Texture> texture);
+    void ReleaseRetired();
+    VkDeviceSize ComputeBudget() const;
+
+    Renderer* m_Renderer = nullptr;
+    TextureStreamerConfig m_Config;
+    TextureLoader m_Loader;
+
+    std::vector<Ref<StreamedTexture>> m_Textures;
+    std::vector<RetiredTexture> m_Retired;
+
+    VkDeviceSize m_ResidentBytes = 0;
+    VkDeviceSize m_Budget = 0;
+    u32 m_LoadingCount = 0;
+};
+
+} // namespace tvk
@@ -0,0 +1,198 @@
+/**
+ * @file transfer_queue.h
+ * @brief Asynchronous uploads on the dedicated transfer queue
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "staging_ring.h"
+#include <vulkan/vulkan.h>
+#include <vector>
+#include <functional>
+
+namespace tvk {
+
+class VulkanContext;
+class TransferQueue;
+
+/**
+ * @brief Pollable handle to an asynchronous upload
+ *
+ * Complete once the copy has finished and the ownership acquire has run on
+ * the graphics queue. A default constructed handle is always complete.
+ */
+struct TransferHandle {
+    TransferQueue* queue = nullptr;
+    u64 value = 0;
+
+    bool IsValid() const { return queue != nullptr; }
+    bool IsComplete() const;
+    void Wait() const;
+};
+
+/**
+ * @brief Image upload description for TransferQueue::UploadImage()
+ */
+struct ImageUploadInfo {
+    VkImage image = VK_NULL_HANDLE;
+    u32 width = 0;
+    u32 height = 0;
+    u32 mipLevel = 0;
+    u32 mipLevels = 1;                      // Levels transitioned and handed over
+    VkImageAspectFlags aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+    VkImageLayout finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    // Copies several levels from data instead of one, buffer offsets relative to data
+    std::vector<VkBufferImageCopy> regions;
+
+    // Recorded on the graphics queue once the image is owned by it and in finalLayout, e.g. mip generation
+    std::function<void(VkCommandBuffer)> onAcquired;
+};
+
+/**
+ * @brief Batches copies on the transfer queue and signals a timeline semaphore
+ *
+ * Copies are recorded into an open batch which is submitted by Submit() or
+ * at the end of the frame. Ownership is released on the transfer queue and
+ * acquired by the Renderer ahead of the first frame after completion, so the
+ * render loop never waits for an upload.
+ *
+ * Nothing orders the copies after graphics work, destinations must not be in
+ * use by the GPU, e.g. freshly created resources.
+ */
+class TransferQueue {
+public:
+    TransferQueue() = default;
+    ~TransferQueue();
+
+    // Non-copyable
+    TransferQueue(const TransferQueue&) = delete;
+    TransferQueue& operator=(const TransferQueue&) = delete;
+
+    /**
+     * @brief Initialize the transfer queue
+     * @param stagingSize Size of the staging ring used by asynchronous uploads
+     */
+    bool Init(VulkanContext* context, VkDeviceSize stagingSize);
+
+    /**
+     * @brief Wait for outstanding transfers and release resources
+     */
+    void Cleanup();
+
+    /**
+     * @brief Copy data into a buffer asynchronously
+     * The buffer must not be in use by the GPU until the handle is complete
+     */
+    TransferHandle UploadBuffer(VkBuffer buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
+    /**
+     * @brief Copy tightly packed texel data into an image asynchronously
+     * The image must not be in use by the GPU until the handle is complete, its previous contents are discarded
+     */
+    TransferHandle UploadImage(const ImageUploadInfo& info, const void* data, VkDeviceSize size);
+
+    /**
+     * @brief Submit the open batch
+     * @return Handle of the submitted batch
+     */
+    TransferHandle Submit();
+
+    /**
+     * @brief Check if copies are recorded but not submitted yet
+     */
+    bool HasPendingWork() const { return m_Recording; }
+
+    /**
+     * @brief Check if a value has completed and the graphics queue has run its acquires
+     */
+    bool IsComplete(u64 value) const;
+
+    /**
+     * @brief Block until a value has completed and its resources are acquired
+     */
+    void Wait(u64 value);
+
+    /**
+     * @brief Check if a submitted batch is waiting to be acquired
+     */
+    bool HasCompletedWork() const;
+
+    /**
+     * @brief Check if submitted batches are waiting to be acquired, finished or not
+     */
+    bool HasWorkInFlight() const { return IsAsync() && !m_Acquires.empty(); }
+
+    /**
+     * @brief Record ownership acquires for completed batches
+     * Called by the Renderer with a graphics command buffer ahead of the frame
+     * @param graphicsValue Graphics timeline value signaled once graphicsCmd has run, 0 if it has run on return
+     * @return Timeline value the graphics submission has to wait for, 0 for none
+     */
+    u64 AcquireCompleted(VkCommandBuffer graphicsCmd, u64 graphicsValue = 0);
+
+    /**
+     * @brief Set the graphics timeline the values passed to AcquireCompleted() are signaled on
+     * @param submitAcquires Submits the graphics commands holding recorded acquires, used by Wait()
+     */
+    void SetGraphicsTimeline(VkSemaphore timeline, std::function<void()> submitAcquires);
+
+    VkSemaphore GetTimelineSemaphore() const { return m_Timeline; }
+    bool IsAsync() const { return m_Timeline != VK_NULL_HANDLE; }
+
+private:
+    struct PendingAcquire {
+        u64 value = 0;
+        VkBufferMemoryBarrier bufferBarrier{};
+        VkImageMemoryBarrier imageBarrier{};
+        bool isImage = false;
+        std::function<void(VkCommandBuffer)> onAcquired;
+    };
+
+    struct Submission {
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        u64 value = 0;
+    };
+
+    // Acquires of values up to value run once the graphics timeline reaches graphicsValue
+    struct AcquireSignal {
+        u64 value = 0;
+        u64 graphicsValue = 0;
+    };
+
+    VkCommandBuffer GetCommandBuffer();
+    StagingAllocation AllocateStaging(VkDeviceSize size);
+    void WaitForValue(u64 value) const;
+    u64 GetCompletedValue() const;
+    u64 GetGraphicsCompletedValue() const;
+    u64 GetAcquireSignal(u64 value) const;
+    void Recycle();
+
+    VulkanContext* m_Context = nullptr;
+    VkQueue m_Queue = VK_NULL_HANDLE;
+    VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+    VkSemaphore m_Timeline = VK_NULL_HANDLE;
+    StagingRing m_StagingRing;
+
+    u32 m_TransferFamily = 0;
+    u32 m_GraphicsFamily = 0;
+
+    VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+    bool m_Recording = false;
+
+    u64 m_NextValue = 1;       // Value signaled by the open batch
+    u64 m_AcquiredValue = 0;   // Highest value whose acquires are recorded
+    u64 m_ExecutedValue = 0;   // Highest value whose acquires have run
+
+    VkSemaphore m_GraphicsTimeline = VK_NULL_HANDLE;
+    std::function<void()> m_SubmitAcquires;
+    std::vector<AcquireSignal> m_AcquireSignals;   // Recorded, maybe not run yet
+
+    std::vector<Submission> m_InFlight;
+    std::vector<VkCommandBuffer> m_FreeCommandBuffers;
+    std::vector<PendingAcquire> m_Releases;   // Recorded into the open batch
+    std::vector<PendingAcquire> m_Acquires;   // Submitted, waiting for completion
+};
+
+} // namespace tvk
@@ -0,0 +1,127 @@
+/**
+ * @file upload_batch.h
+ * @brief Batched buffer and texture uploads for TinyVK
+ */
+
+#pragma once
+
+#include "../core/types.h"
+#include "staging_ring.h"
+#include "texture.h"
+#include <vulkan/vulkan.h>
+#include <vector>
+
+namespace tvk {
+
+// Forward declarations
+class Renderer;
+class Buffer;
+
+/**
+ * @brief Collects uploads and records them with grouped barriers
+ *
+ * Data is copied into staging memory when enqueued. Record() writes one
+ * layout barrier for all images, every copy, the mip chains level by level
+ * and one final barrier into the renderer's upload command buffer.
+ * Enqueued resources must stay alive until the batch is recorded.
+ *
+ * @code
+ * UploadBatch batch(renderer);
+ * for (const auto& path : paths) {
+ *     textures.push_back(Texture::LoadFromFile(batch, path));
+ * }
+ * batch.Submit();
+ * @endcode
+ */
+class UploadBatch {
+public:
+    explicit UploadBatch(Renderer* renderer);
+    ~UploadBatch();
+
+    // Non-copyable
+    UploadBatch(const UploadBatch&) = delete;
+    UploadBatch& operator=(const UploadBatch&) = delete;
+
+    /**
+     * @brief Enqueue a copy into a buffer
+     * Host visible buffers are written immediately
+     */
+    bool Upload(Buffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
+
+    /**
+     * @brief Enqueue a copy into a device local buffer from staging memory the caller fills
+     * Lets data be generated in place instead of copied, e.g. by GeometryKernels.
+     * The memory is neither copied nor reused until Commit(), Record() or Submit(),
+     * uploads enqueued in between fall back to dedicated staging buffers once the ring is full
+     * @return size bytes to write, nullptr on failure or for host visible buffers
+     */
+    void* Stage(Buffer& buffer, VkDeviceSize size, VkDeviceSize offset = 0);
+
+    /**
+     * @brief Mark the memory returned by Stage() as filled
+     * Lets later uploads flush a full staging ring again
+     */
+    void Commit();
+
+    /**
+     * @brief Enqueue the base level of a texture, mips are regenerated if the texture has any
+     * @param currentLayout Layout the texture is in when the batch executes
+     */
+    bool Upload(Texture& texture, const void* data, VkDeviceSize size,
+                VkImageLayout currentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    /**
+     * @brief Enqueue a pre-built mip chain, e.g. from a KTX2 or DDS file, one level per entry
+     * @param data Texel data of all levels, the level offsets are relative to it
+     */
+    bool Upload(Texture& texture, const void* data, VkDeviceSize size, const std::vector<TextureMipLevel>& levels,
+                VkImageLayout currentLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    /**
+     * @brief Commit and record enqueued uploads, they execute ahead of the current frame
+     * Waits for the copies if dedicated staging buffers were needed
+     */
+    void Record();
+
+    /**
+     * @brief Record enqueued uploads and submit them in a single submission
+     */
+    void Submit();
+
+    /**
+     * @brief Get number of uploads not recorded yet
+     */
+    u32 GetPendingCount() const { return static_cast<u32>(m_BufferCopies.size() + m_ImageCopies.size()); }
+
+    Renderer* GetRenderer() const { return m_Renderer; }
+
+private:
+    struct BufferCopy {
+        Buffer* buffer = nullptr;
+        VkBuffer source = VK_NULL_HANDLE;
+        VkBufferCopy region{};
+    };
+
+    struct ImageCopy {
+        VkImage image = VK_NULL_HANDLE;
+        VkImageLayout oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkBuffer source = VK_NULL_HANDLE;
+        VkDeviceSize sourceOffset = 0;
+        u32 width = 0;
+        u32 height = 0;
+        u32 mipLevels = 1;
+        bool generateMips = false;
+        std::vector<TextureMipLevel> levels;   // Copied as stored instead of the base level
+    };
+
+    StagingAllocation Allocate(VkDeviceSize size);
+    void RecordCopies();
+
+    Renderer* m_Renderer = nullptr;
+    std::vector<BufferCopy> m_BufferCopies;
+    std::vector<ImageCopy> m_ImageCopies;
+    std::vector<Ref<Buffer>> m_StagingBuffers;   // Used while Stage() memory is open
+    u32 m_OpenStages = 0;                         // Stage() allocations not committed yet
+};
+
+} // namespace tvk
@@ -8,7 +8,9 @@
 #include "../core/types.h"
 #include <vulkan/vulkan.h>
 #include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
 #include <array>
+#include <vector>
 
 namespace tvk {
 
@@ -53,4 +55,150 @@ struct Vertex {
     }
 };
 
+/**
+ * @brief Octahedral encoding of a unit vector into [-1, 1]^2
+ */
+inline glm::vec2 EncodeOctahedral(glm::vec3 n) {
+    n /= glm::abs(n.x) + glm::abs(n.y) + glm::abs(n.z);
+    glm::vec2 p(n.x, n.y);
+    if (n.z < 0.0f) {
+        glm::vec2 sign(p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f);
+        p = (1.0f - glm::abs(glm::vec2(p.y, p.x))) * sign;
+    }
+    return p;
+}
+
+/**
+ * @brief 24 byte vertex with the attributes of Vertex at reduced precision
+ * Normal is octahedral encoded in two snorm16, texCoord is half float and color is RGBA8.
+ * Use with shaders::compact_vert, which decodes the normal
+ */
+struct VertexCompact {
+    glm::vec3 position;
+    u32 normal;     // R16G16_SNORM octahedral
+    u32 texCoord;   // R16G16_SFLOAT
+    u32 color;      // R8G8B8A8_UNORM
+    
+    static VertexCompact FromVertex(const Vertex& vertex) {
+        VertexCompact compact;
+        compact.position = vertex.position;
+        compact.normal = glm::packSnorm2x16(EncodeOctahedral(glm::normalize(vertex.normal)));
+        compact.texCoord = glm::packHalf2x16(vertex.texCoord);
+        compact.color = glm::packUnorm4x8(glm::vec4(vertex.color, 1.0f));
+        return compact;
+    }
+    
+    static VkVertexInputBindingDescription GetBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 0;
+        bindingDescription.stride = sizeof(VertexCompact);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        return bindingDescription;
+    }
+    
+    static std::array<VkVertexInputAttributeDescription, 4> GetAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 4> attributeDescriptions{};
+        
+        attributeDescriptions[0].binding = 0;
+        attributeDescriptions[0].location = 0;
+        attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
+        attributeDescriptions[0].offset = offsetof(VertexCompact, position);
+        
+        attributeDescriptions[1].binding = 0;
+        attributeDescriptions[1].location = 1;
+        attributeDescriptions[1].format = VK_FORMAT_R16G16_SNORM;
+        attributeDescriptions[1].offset = offsetof(VertexCompact, normal);
+        
+        attributeDescriptions[2].binding = 0;
+        attributeDescriptions[2].location = 2;
+        attributeDescriptions[2].format = VK_FORMAT_R16G16_SFLOAT;
+        attributeDescriptions[2].offset = offsetof(VertexCompact, texCoord);
+        
+        attributeDescriptions[3].binding = 0;
+        attributeDescriptions[3].location = 3;
+        attributeDescriptions[3].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributeDescriptions[3].offset = offsetof(VertexCompact, color);
+        
+        return attributeDescriptions;
+    }
+};
+
+/**
+ * @brief Position only vertex for depth and shadow passes, use with shaders::depth_only_vert
+ */
+struct VertexPosition {
+    glm::vec3 position;
+    
+    static VertexPosition FromVertex(const Vertex& vertex) {
+        return {vertex.position};
+    }
+    
+    static VkVertexInputBindingDescription GetBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 0;
+        bindingDescription.stride = sizeof(VertexPosition);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        return bindingDescription;
+    }
+    
+    static std::array<VkVertexInputAttributeDescription, 1> GetAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 1> attributeDescriptions{};
+        
+        attributeDescriptions[0].binding = 0;
+        attributeDescriptions[0].location = 0;
+        attributeDescriptions[0].format = VK_FORMAT_R32G32B32_SFLOAT;
+        attributeDescriptions[0].offset = offsetof(VertexPosition, position);
+        
+        return attributeDescriptions;
+    }
+};
+
+static_assert(sizeof(VertexCompact) == 24, "VertexCompact must stay tightly packed");
+static_assert(sizeof(VertexPosition) == 12, "VertexPosition must stay tightly packed");
+
+/**
+ * @brief Convert full precision vertices to another vertex format
+ */
+template<typename T>
+std::vector<T> ConvertVertices(const std::vector<Vertex>& vertices) {
+    std::vector<T> result;
+    result.reserve(vertices.size());
+    for (const auto& vertex : vertices) {
+        result.push_back(T::FromVertex(vertex));
+    }
+    return result;
+}
+
+/**
+ * @brief Per-instance data read from binding 1 at VK_VERTEX_INPUT_RATE_INSTANCE
+ * The model matrix occupies locations 4 to 7, one column each
+ */
+struct InstanceData {
+    glm::mat4 model;
+    
+    static constexpr u32 Binding = 1;
+    static constexpr u32 FirstLocation = 4;
+    
+    static VkVertexInputBindingDescription GetBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = Binding;
+        bindingDescription.stride = sizeof(InstanceData);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+        return bindingDescription;
+    }
+    
+    static std::array<VkVertexInputAttributeDescription, 4> GetAttributeDescriptions() {
+        std::array<VkVertexInputAttributeDescription, 4> attributeDescriptions{};
+        
+        for (u32 column = 0; column < 4; column++) {
+            attributeDescriptions[column].binding = Binding;
+            attributeDescriptions[column].location = FirstLocation + column;
+            attributeDescriptions[column].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+            attributeDescriptions[column].offset = offsetof(InstanceData, model) + sizeof(glm::vec4) * column;
+        }
+        
+        return attributeDescriptions;
+    }
+};
+
 } // namespace tvk
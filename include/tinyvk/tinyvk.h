@@ -32,14 +32,29 @@
 #include "core/types.h"
 #include "core/timer.h"
 #include "core/file_dialog.h"
+#include "core/job_system.h"
+#include "core/mapped_file.h"
 
 // Texture loading (for displaying images in ImGui)
 #include "renderer/texture.h"
+#include "renderer/texture_file.h"
+#include "renderer/texture_loader.h"
+#include "renderer/texture_streamer.h"
+#include "renderer/upload_batch.h"
 
 // Geometry and rendering
 #include "renderer/vertex.h"
 #include "renderer/mesh.h"
+#include "renderer/geometry_kernels.h"
+#include "renderer/geometry_arena.h"
+#include "renderer/mesh_optimizer.h"
+#include "renderer/mesh_file.h"
 #include "renderer/pipeline.h"
+#include "renderer/pipeline_registry.h"
+#include "renderer/bindless_heap.h"
+#include "renderer/render_graph.h"
+#include "renderer/culling.h"
+#include "renderer/gpu_profiler.h"
 
 // Assets - Embedded fonts and icons
 #include "assets/fonts.h"
@@ -7,8 +7,11 @@
 
 #include "../core/types.h"
 #include <vulkan/vulkan.h>
+#include <string>
+#include <vector>
 
 struct GLFWwindow;
+struct ImFont;
 
 namespace tvk {
 
@@ -26,11 +29,18 @@ struct ImGuiConfig {
     const char* fontPath = nullptr;
     float fontSize = 16.0f;
     bool useEmbeddedFont = true;
-    const char* embeddedFontName = "roboto";
+    const char* embeddedFontName = "roboto";    // See FindEmbeddedFont()
+    const char* fontCachePath = "imgui_fonts.cache";   // Prebuilt atlas loaded instead of rasterizing the fonts, nullptr disables it
 };
 
 /**
  * @brief ImGui integration layer
+ *
+ * The font atlas is built from a list of font sources, the configured font
+ * first. A built atlas is written to ImGuiConfig::fontCachePath together with
+ * a key of the sources, their sizes and the ImGui version. Later starts with
+ * the same key read the glyphs and pixels from the cache and upload them as
+ * they are, without parsing or rasterizing any font.
  */
 class ImGuiLayer {
 public:
@@ -89,13 +99,48 @@ public:
      */
     void EndDockspace();
 
+    /**
+     * @brief Add a font to the atlas on demand
+     * The atlas is rebuilt before the next frame, GetFont() returns nullptr until then.
+     * Must not be called after Begin() within a frame the atlas is used by
+     * @param font Embedded font name, see FindEmbeddedFont(), or a TTF file path
+     * @param size Size in pixels, ImGuiConfig::fontScale is applied
+     * @param icons Merge the Font Awesome icons into the font
+     * @return Handle for GetFont()
+     */
+    u32 RequestFont(const std::string& font, float size, bool icons = true);
+
+    /**
+     * @brief Font of a RequestFont() handle, 0 is the default font
+     * @return nullptr while the atlas is pending or if the font failed to load
+     */
+    ImFont* GetFont(u32 handle) const;
+
 private:
+    /**
+     * @brief Font added to the atlas
+     */
+    struct FontSource {
+        std::string font;            // Embedded font name or file path, empty for the ImGui default font
+        float size = 0.0f;           // Pixels, scale applied
+        bool icons = false;
+    };
+
     void SetupStyle();
+    void RebuildFonts();
+    bool BuildFontAtlas();
+    ImFont* AddFontSource(const FontSource& source);
+    u64 GetFontCacheKey() const;
+    bool LoadFontCache(u64 key);
+    void SaveFontCache(u64 key);
 
     GLFWwindow* m_Window = nullptr;
     Renderer* m_Renderer = nullptr;
     VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
     ImGuiConfig m_Config;
+    std::vector<FontSource> m_FontSources;
+    std::vector<ImFont*> m_Fonts;      // Per source, nullptr until built or if loading failed
+    bool m_FontsDirty = false;         // Sources changed since the atlas was built
     bool m_Initialized = false;
 };
 
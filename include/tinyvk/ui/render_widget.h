@@ -7,9 +7,11 @@
 
 #include "../core/types.h"
 #include "../renderer/context.h"
+#include "../renderer/pipeline_registry.h"
 #include <vulkan/vulkan.h>
 #include <functional>
 #include <array>
+#include <vector>
 
 namespace tvk {
 
@@ -72,6 +74,8 @@ public:
 
     /**
      * @brief Set the widget size
+     * Attachments grow in steps of ResizeStep pixels and only shrink once they are more
+     * than twice the size, the widget renders into their top left width x height region
      */
     void SetSize(u32 width, u32 height);
     
@@ -99,6 +103,17 @@ public:
     void SetEnabled(bool enabled) { _enabled = enabled; }
     bool IsEnabled() const { return _enabled; }
 
+    /**
+     * @brief Keep rendering every frame in on-demand mode, e.g. for animated content
+     */
+    void SetAnimating(bool animating) { _animating = animating; }
+    bool IsAnimating() const { return _animating; }
+
+    /**
+     * @brief Render the next frame in on-demand mode after the content changed
+     */
+    void RequestRedraw();
+
     /**
      * @brief Get the Vulkan context for advanced usage
      */
@@ -116,9 +131,29 @@ public:
     
     /**
      * @brief Get the render pass for pipeline creation
+     * VK_NULL_HANDLE with dynamic rendering, MakePipelineDesc() works in both modes
      */
     VkRenderPass GetRenderPass() const { return _renderPass; }
 
+    /**
+     * @brief Check if the widget renders without a VkRenderPass and framebuffers
+     */
+    bool UsesDynamicRendering() const { return _dynamicRendering; }
+
+    VkFormat GetColorFormat() const { return VK_FORMAT_R8G8B8A8_UNORM; }
+    VkFormat GetDepthFormat() const { return VK_FORMAT_D32_SFLOAT; }
+
+    /**
+     * @brief Pipeline description targeting this widget's attachments
+     * With dynamic rendering the pipeline only depends on the formats
+     */
+    PipelineDesc MakePipelineDesc(std::string vertShaderSource, std::string fragShaderSource) const;
+
+    /**
+     * @brief Granularity in pixels at which attachments are reallocated
+     */
+    static constexpr u32 ResizeStep = 128;
+
 protected:
     /**
      * @brief Override this to initialize your rendering resources
@@ -174,33 +209,54 @@ protected:
 
 private:
     void CreateRenderPass();
-    void CreateSampler();
     void CreateSizeDependentResources();
     void CleanupSizeDependentResources();
     void CreateRenderTarget();
     void CleanupRenderTarget();
     void RecreateRenderTarget();
 
+    /**
+     * @brief Render target of one frame in flight
+     */
+    struct RenderTarget {
+        VkImage renderImage = VK_NULL_HANDLE;
+        Allocation renderImageAllocation;
+        VkImageView renderImageView = VK_NULL_HANDLE;
+        VkImage depthImage = VK_NULL_HANDLE;
+        Allocation depthImageAllocation;
+        VkImageView depthImageView = VK_NULL_HANDLE;
+        VkFramebuffer framebuffer = VK_NULL_HANDLE;
+
+        // ImGui texture ID for displaying the rendered result
+        VkDescriptorSet imguiTexture = VK_NULL_HANDLE;
+    };
+
+    void CreateTarget(RenderTarget& target);
+    void DestroyTarget(RenderTarget& target);
+    void ReleaseRetiredTargets();
+
+    /**
+     * @brief Targets replaced by a resize, destroyed once the frames using them finished
+     */
+    struct RetiredTarget {
+        RenderTarget target;
+        u64 frame = 0;
+    };
+
     Renderer* _renderer = nullptr;
-    VkCommandBuffer _currentCommandBuffer = VK_NULL_HANDLE;
     
     // Render target resources
-    VkImage _renderImage = VK_NULL_HANDLE;
-    VkDeviceMemory _renderImageMemory = VK_NULL_HANDLE;
-    VkImageView _renderImageView = VK_NULL_HANDLE;
+    std::vector<RenderTarget> _targets;
+    std::vector<RetiredTarget> _retiredTargets;
+    u32 _currentTarget = 0;
+    u32 _targetWidth = 0;    // Allocated attachment extent, at least _width x _height
+    u32 _targetHeight = 0;
+    bool _dynamicRendering = false;
     VkSampler _sampler = VK_NULL_HANDLE;
-    VkFramebuffer _framebuffer = VK_NULL_HANDLE;
     VkRenderPass _renderPass = VK_NULL_HANDLE;
     
-    // Depth buffer
-    VkImage _depthImage = VK_NULL_HANDLE;
-    VkDeviceMemory _depthImageMemory = VK_NULL_HANDLE;
-    VkImageView _depthImageView = VK_NULL_HANDLE;
-    
-    // ImGui texture ID for displaying the rendered result
-    VkDescriptorSet _imguiTexture = VK_NULL_HANDLE;
-    
-    // Command buffer for rendering
+    // Command buffers for rendering, one per frame in flight
+    std::vector<VkCommandBuffer> _commandBuffers;
     VkCommandBuffer _commandBuffer = VK_NULL_HANDLE;
     VkCommandPool _commandPool = VK_NULL_HANDLE;
     
@@ -211,6 +267,7 @@ private:
     u32 _height = 600;
     bool _initialized = false;
     bool _enabled = true;
+    bool _animating = false;
     bool _needsResize = false;
 };
 
@@ -47,9 +47,10 @@ protected:
         if (_torusMesh) TVK_LOG_INFO("  Torus: {} vertices, {} indices", _torusMesh->GetVertexCount(), _torusMesh->GetIndexCount());
         
         SetClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        SetAnimating(true);
         
         _pipeline = tvk::CreateScope<tvk::Pipeline>();
-        if (!_pipeline->Create(GetRenderer(), GetRenderPass(), tvk::shaders::basic_vert, tvk::shaders::basic_frag)) {
+        if (!_pipeline->Create(GetRenderer(), MakePipelineDesc(tvk::shaders::basic_vert, tvk::shaders::basic_frag))) {
             TVK_LOG_ERROR("Failed to create graphics pipeline");
         }
     }
@@ -205,6 +206,42 @@ protected:
             ImGui::Separator();
             ImGui::Text("Window: %ux%u", WindowWidth(), WindowHeight());
             ImGui::Separator();
+            auto* renderer = GetRenderer();
+            const auto& latency = renderer->GetLatencyStats();
+            bool lowLatency = renderer->IsLowLatency();
+            if (ImGui::Checkbox("Low Latency", &lowLatency)) {
+                renderer->SetLowLatency(lowLatency);
+            }
+            bool onDemand = IsOnDemand();
+            if (ImGui::Checkbox("On-Demand Rendering", &onDemand)) {
+                SetOnDemand(onDemand);
+            }
+            int framesInFlight = static_cast<int>(renderer->GetFramesInFlight());
+            if (ImGui::SliderInt("Frames in Flight", &framesInFlight, 1, static_cast<int>(renderer->GetMaxFramesInFlight()))) {
+                renderer->SetFramesInFlight(static_cast<tvk::u32>(framesInFlight));
+            }
+            ImGui::Text("Latency: %.2f ms (%s)", latency.latencyMs, latency.displayTimed ? "to display" : "to GPU completion");
+            ImGui::Text("Pacing Wait: %.2f ms", latency.paceWaitMs);
+            if (latency.refreshIntervalMs > 0.0f) {
+                ImGui::Text("Refresh: %.2f ms, %u missed", latency.refreshIntervalMs, latency.missedRefreshes);
+            }
+            const auto& gpuScopes = renderer->GetGpuProfiler().GetResults();
+            if (!gpuScopes.empty()) {
+                ImGui::Separator();
+                for (const auto& scope : gpuScopes) {
+                    ImGui::Text("GPU %s: %.3f ms", scope.name.c_str(), scope.timeMs);
+                }
+            }
+            auto& profiler = tvk::Profiler::instance();
+            if (!profiler.isCapturing()) {
+                if (ImGui::Button("Capture Trace")) {
+                    profiler.beginCapture();
+                }
+            } else if (ImGui::Button("Save trace.json")) {
+                profiler.endCapture();
+                profiler.writeChromeTrace("trace.json");
+            }
+            ImGui::Separator();
             auto mousePos = tvk::Input::GetMousePosition();
             ImGui::Text("Mouse: (%.0f, %.0f)", mousePos.x, mousePos.y);
             ImGui::Text("LMB: %s", tvk::Input::IsMouseButtonPressed(tvk::MouseButton::Left) ? "Pressed" : "Released");
@@ -399,6 +436,10 @@ protected:
             
             ImGui::SameLine();
             ImGui::Text("Executions: %d", _computeExecutions);
+            if (!_computeRun.IsComplete()) {
+                ImGui::SameLine();
+                ImGui::TextDisabled("(running)");
+            }
             
             ImGui::Separator();
             
@@ -476,6 +517,7 @@ private:
     }
     
     void CleanupComputeDemo() {
+        _computeRun.Wait();
         if (_computePipeline) {
             _computePipeline->Destroy();
         }
@@ -485,25 +527,16 @@ private:
     
     void RunComputeShader() {
         if (!_computePipeline || !_computeInputBuffer || !_computeOutputBuffer) return;
-        
-        auto& ctx = GetRenderer()->GetContext();
-        VkDevice device = ctx.GetDevice();
-        VkQueue queue = ctx.GetGraphicsQueue();
-        VkCommandPool cmdPool = ctx.GetCommandPool();
-        
-        VkCommandBufferAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.commandPool = cmdPool;
-        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandBufferCount = 1;
-        
-        VkCommandBuffer cmd;
-        vkAllocateCommandBuffers(device, &allocInfo, &cmd);
-        
-        VkCommandBufferBeginInfo beginInfo{};
-        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        vkBeginCommandBuffer(cmd, &beginInfo);
+
+        // One run at a time, the result arrives with a later frame
+        if (!_computeRun.IsComplete()) return;
+
+        auto& computeQueue = GetRenderer()->GetComputeQueue();
+        VkCommandBuffer cmd = computeQueue.Begin();
+        if (cmd == VK_NULL_HANDLE) {
+            TVK_LOG_WARN("Asynchronous compute unavailable");
+            return;
+        }
         
         _computePipeline->Bind(cmd);
         
@@ -514,33 +547,15 @@ private:
         
         _computePipeline->Dispatch(cmd, (COMPUTE_DATA_SIZE + 255) / 256, 1, 1);
         
-        VkMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
-        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
-                             0, 1, &barrier, 0, nullptr, 0, nullptr);
-        
-        vkEndCommandBuffer(cmd);
-        
-        VkSubmitInfo submitInfo{};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &cmd;
-        
-        vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(queue);
-        
-        void* mappedData = _computeOutputBuffer->Map();
-        if (mappedData) {
-            memcpy(_computeOutputData, mappedData, sizeof(float) * COMPUTE_DATA_SIZE);
-            _computeOutputBuffer->Unmap();
-        }
-        
-        vkFreeCommandBuffers(device, cmdPool, 1, &cmd);
+        float multiplier = _computeMultiplier;
+        computeQueue.ReadBuffer(_computeOutputBuffer->GetBuffer(), 0, sizeof(float) * COMPUTE_DATA_SIZE,
+            [this, multiplier](const void* data, VkDeviceSize size) {
+                memcpy(_computeOutputData, data, static_cast<size_t>(size));
+                _computeExecutions++;
+                TVK_LOG_INFO("Compute shader executed (multiplier: {})", multiplier);
+            });
         
-        _computeExecutions++;
-        TVK_LOG_INFO("Compute shader executed (multiplier: {})", _computeMultiplier);
+        _computeRun = computeQueue.Submit();
     }
 
     void OpenImageFile() {
@@ -584,6 +599,7 @@ private:
     float _computeOutputData[COMPUTE_DATA_SIZE] = {};
     float _computeMultiplier = 2.0f;
     int _computeExecutions = 0;
+    tvk::ComputeHandle _computeRun;
     
     int _counter;
     char _textInput[256];
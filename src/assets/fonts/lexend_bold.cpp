@@ -0,0 +1,6575 @@
+/**
+ * @file lexend_bold.cpp
+ * @brief Embedded Lexend Bold font data
+ */
+
+#include "tinyvk/assets/fonts.h"
+
+namespace tvk {
+
+unsigned char lexend_bold[] = {
+
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x47, 0x44, 0x45, 0x46, 0x4F, 0xDB, 0x4D, 0x50, 0x00, 0x00, 0x02, 0x24,
+    0x00, 0x00, 0x01, 0x30, 0x47, 0x50, 0x4F, 0x53, 0x90, 0xDA, 0x41, 0xF8,
+    0x00, 0x00, 0x4F, 0x24, 0x00, 0x00, 0x50, 0xFC, 0x47, 0x53, 0x55, 0x42,
+    0xD0, 0x82, 0x6E, 0x2A, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x0C, 0xF8,
+    0x4F, 0x53, 0x2F, 0x32, 0x84, 0x44, 0x57, 0x6E, 0x00, 0x00, 0x01, 0xC4,
+    0x00, 0x00, 0x00, 0x60, 0x53, 0x54, 0x41, 0x54, 0x79, 0x98, 0x6B, 0xAD,
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x2A, 0x63, 0x6D, 0x61, 0x70,
+    0x77, 0x18, 0x90, 0xFD, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x08, 0x16,
+    0x67, 0x61, 0x73, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x08, 0x67, 0x6C, 0x79, 0x66, 0xD8, 0xD7, 0xD2, 0x07,
+    0x00, 0x00, 0xA0, 0x20, 0x00, 0x00, 0x93, 0x5C, 0x68, 0x65, 0x61, 0x64,
+    0x1B, 0x23, 0x86, 0xD0, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x00, 0x36,
+    0x68, 0x68, 0x65, 0x61, 0x08, 0x97, 0x06, 0x1C, 0x00, 0x00, 0x01, 0x3C,
+    0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78, 0x5A, 0xDB, 0x83, 0x74,
+    0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x0D, 0x34, 0x6C, 0x6F, 0x63, 0x61,
+    0xE2, 0xD1, 0x06, 0x59, 0x00, 0x00, 0x09, 0x58, 0x00, 0x00, 0x06, 0x9C,
+    0x6D, 0x61, 0x78, 0x70, 0x03, 0x61, 0x00, 0xD2, 0x00, 0x00, 0x01, 0x1C,
+    0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0xBA, 0x26, 0xF7, 0xAD,
+    0x00, 0x00, 0x03, 0x54, 0x00, 0x00, 0x06, 0x02, 0x70, 0x6F, 0x73, 0x74,
+    0x0C, 0x72, 0x98, 0x72, 0x00, 0x00, 0x32, 0x38, 0x00, 0x00, 0x1C, 0xEB,
+    0x70, 0x72, 0x65, 0x70, 0x68, 0x06, 0x8C, 0x85, 0x00, 0x00, 0x01, 0x0C,
+    0x00, 0x00, 0x00, 0x07, 0xB8, 0x01, 0xFF, 0x85, 0xB0, 0x04, 0x8D, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x4D, 0x00, 0x64, 0x00, 0x07, 0x00, 0x6C, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0xE8, 0xFF, 0x06,
+    0x00, 0x00, 0x05, 0xD0, 0xFF, 0x27, 0xFD, 0xF8, 0x05, 0x85, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x4D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x02,
+    0x77, 0x67, 0x68, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x03, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xCB, 0x7F, 0xA4, 0x40, 0x3E,
+    0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x03, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0xDA, 0x36, 0x6A, 0x60, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x29, 0xD6, 0x62,
+    0xFF, 0x27, 0xFE, 0xC4, 0x05, 0x85, 0x04, 0x9C, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x4C,
+    0x03, 0x20, 0x00, 0x05, 0x00, 0x00, 0x02, 0x8A, 0x02, 0x58, 0x00, 0x00,
+    0x00, 0x4B, 0x02, 0x8A, 0x02, 0x58, 0x00, 0x00, 0x01, 0x5E, 0x00, 0x32,
+    0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x20, 0x5B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x4F, 0x4E, 0x45, 0x00, 0xC0,
+    0x00, 0x0D, 0xFB, 0x02, 0x03, 0xE8, 0xFF, 0x06, 0x00, 0x00, 0x04, 0xB0,
+    0x01, 0x86, 0x20, 0x00, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D,
+    0x02, 0xBC, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0xBA, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x02, 0x03, 0x0D,
+    0x03, 0x43, 0x00, 0x02, 0x00, 0x03, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00,
+    0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11, 0x03, 0x23, 0x03, 0x42, 0x00, 0x22,
+    0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x13, 0x03, 0x14, 0x03, 0x44, 0x03, 0x45, 0x00, 0x12, 0x00, 0x07,
+    0x00, 0x5E, 0x00, 0x50, 0x00, 0x42, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x24,
+    0x00, 0x1C, 0x00, 0x02, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x68, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x01, 0x6E, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x02, 0x1C,
+    0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01, 0x02, 0xE7, 0x00, 0x01,
+    0x01, 0x73, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01, 0x03, 0x8A,
+    0x00, 0x01, 0x01, 0xC5, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01,
+    0x02, 0xDA, 0x00, 0x01, 0x01, 0x6D, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01,
+    0x01, 0x87, 0x00, 0x02, 0x00, 0x13, 0x00, 0x01, 0x00, 0x7A, 0x00, 0x01,
+    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x01, 0x00, 0x80, 0x01, 0x2B, 0x00, 0x01,
+    0x01, 0x2D, 0x01, 0x48, 0x00, 0x01, 0x01, 0x4A, 0x01, 0x68, 0x00, 0x01,
+    0x01, 0x6A, 0x01, 0x80, 0x00, 0x01, 0x01, 0x82, 0x01, 0x84, 0x00, 0x01,
+    0x01, 0x86, 0x02, 0x18, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x02,
+    0x02, 0xB5, 0x02, 0xB5, 0x00, 0x01, 0x02, 0xB7, 0x02, 0xB7, 0x00, 0x01,
+    0x02, 0xB9, 0x02, 0xB9, 0x00, 0x01, 0x02, 0xBE, 0x02, 0xBE, 0x00, 0x01,
+    0x02, 0xC4, 0x02, 0xC6, 0x00, 0x01, 0x02, 0xCA, 0x02, 0xCA, 0x00, 0x01,
+    0x02, 0xDE, 0x02, 0xDE, 0x00, 0x01, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x03,
+    0x02, 0xFC, 0x03, 0x15, 0x00, 0x03, 0x03, 0x23, 0x03, 0x46, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x01, 0xAA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x00, 0x00, 0xA2, 0x03, 0xB6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x01, 0x00, 0x20, 0x03, 0x96, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x02, 0x00, 0x0E, 0x03, 0x88, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x03, 0x00, 0x36, 0x03, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x04, 0x00, 0x20, 0x03, 0x96, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x05, 0x00, 0x1A, 0x03, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x06, 0x00, 0x20, 0x03, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x08, 0x00, 0x0C, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x09, 0x00, 0x44, 0x02, 0xC8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0B, 0x00, 0x2C, 0x02, 0x9C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0C, 0x00, 0x2C, 0x02, 0x9C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0D, 0x01, 0x22, 0x01, 0x7A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0E, 0x00, 0x36, 0x01, 0x44, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x10, 0x00, 0x0C, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x11, 0x00, 0x12, 0x01, 0x32, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x19, 0x00, 0x0C, 0x03, 0x0C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x00, 0x00, 0x0C, 0x01, 0x26, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x02, 0x00, 0x08, 0x01, 0x1E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x03, 0x00, 0x14, 0x01, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x04, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x05, 0x00, 0x0E, 0x03, 0x88, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x06, 0x00, 0x0C, 0x00, 0xF4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x07, 0x00, 0x10, 0x00, 0xE4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x08, 0x00, 0x08, 0x00, 0xDC, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x09, 0x00, 0x12, 0x01, 0x32, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0A, 0x00, 0x0A, 0x00, 0xD2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0B, 0x00, 0x16, 0x00, 0xBC, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0C, 0x00, 0x22, 0x00, 0x9A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0D, 0x00, 0x18, 0x00, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0E, 0x00, 0x1C, 0x00, 0x66, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0F, 0x00, 0x1A, 0x00, 0x4C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x10, 0x00, 0x1E, 0x00, 0x2E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x11, 0x00, 0x16, 0x00, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x12, 0x00, 0x20, 0x03, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x13, 0x00, 0x18, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6C,
+    0x00, 0x61, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6F,
+    0x00, 0x6C, 0x00, 0x64, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D,
+    0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D,
+    0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6D,
+    0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x2D, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C,
+    0x00, 0x61, 0x00, 0x72, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74,
+    0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E,
+    0x00, 0x42, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x42,
+    0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D,
+    0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x4D,
+    0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6D, 0x00, 0x4C,
+    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x45, 0x00, 0x78,
+    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E,
+    0x00, 0x57, 0x00, 0x65, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42,
+    0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74,
+    0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x73,
+    0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73,
+    0x00, 0x2E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x2E, 0x00, 0x6F,
+    0x00, 0x72, 0x00, 0x67, 0x00, 0x2F, 0x00, 0x4F, 0x00, 0x46, 0x00, 0x4C,
+    0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x46,
+    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53, 0x00, 0x6F,
+    0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65,
+    0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6C, 0x00, 0x69,
+    0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x64,
+    0x00, 0x20, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72,
+    0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53,
+    0x00, 0x49, 0x00, 0x4C, 0x00, 0x20, 0x00, 0x4F, 0x00, 0x70, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74,
+    0x00, 0x20, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x73, 0x00, 0x65, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x56, 0x00, 0x65,
+    0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20,
+    0x00, 0x31, 0x00, 0x2E, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x20, 0x00, 0x54,
+    0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6C, 0x00, 0x69,
+    0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x20,
+    0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x76, 0x00, 0x61,
+    0x00, 0x69, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6C, 0x00, 0x65,
+    0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x20,
+    0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00, 0x51, 0x00, 0x20,
+    0x00, 0x61, 0x00, 0x74, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F,
+    0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74,
+    0x00, 0x73, 0x00, 0x2E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x2E,
+    0x00, 0x6F, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2F, 0x00, 0x4F, 0x00, 0x46,
+    0x00, 0x4C, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73,
+    0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77,
+    0x00, 0x2E, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2E, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x42,
+    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x6E, 0x00, 0x69, 0x00, 0x65, 0x00, 0x20,
+    0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72,
+    0x00, 0x2D, 0x00, 0x54, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x70,
+    0x00, 0x2C, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x6F, 0x00, 0x6D,
+    0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x4A, 0x00, 0x6F, 0x00, 0x63,
+    0x00, 0x6B, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78,
+    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C,
+    0x00, 0x64, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
+    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x37, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x4E, 0x00, 0x45,
+    0x00, 0x3B, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72,
+    0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x52,
+    0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72,
+    0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x20, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61,
+    0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6F,
+    0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39,
+    0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20,
+    0x00, 0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63,
+    0x00, 0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68,
+    0x00, 0x6F, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F,
+    0x00, 0x2F, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75,
+    0x00, 0x62, 0x00, 0x2E, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x2F,
+    0x00, 0x67, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x65,
+    0x00, 0x66, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2F,
+    0x00, 0x6C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x5F, 0x00, 0x6A,
+    0x00, 0x75, 0x00, 0x80, 0x00, 0x8E, 0x00, 0x99, 0x00, 0xA4, 0x00, 0xAF,
+    0x00, 0xBA, 0x00, 0xC5, 0x00, 0xD1, 0x00, 0xDF, 0x00, 0xEB, 0x00, 0xF7,
+    0x01, 0x02, 0x01, 0x0D, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2E, 0x01, 0x39,
+    0x01, 0x44, 0x01, 0x4F, 0x01, 0x5B, 0x01, 0x66, 0x01, 0x75, 0x01, 0x80,
+    0x01, 0xA3, 0x01, 0xAF, 0x01, 0xEB, 0x02, 0x23, 0x02, 0x2F, 0x02, 0x3B,
+    0x02, 0x47, 0x02, 0x57, 0x02, 0x63, 0x02, 0x6F, 0x02, 0x9A, 0x02, 0xA6,
+    0x02, 0xB6, 0x02, 0xE9, 0x02, 0xF5, 0x02, 0xFD, 0x03, 0x09, 0x03, 0x15,
+    0x03, 0x21, 0x03, 0x31, 0x03, 0x4A, 0x03, 0x55, 0x03, 0x60, 0x03, 0x6B,
+    0x03, 0x79, 0x03, 0x84, 0x03, 0x90, 0x03, 0x9E, 0x03, 0xA9, 0x03, 0xB5,
+    0x03, 0xC0, 0x03, 0xCB, 0x03, 0xD6, 0x03, 0xE1, 0x03, 0xEC, 0x03, 0xF7,
+    0x04, 0x02, 0x04, 0x0D, 0x04, 0x18, 0x04, 0x27, 0x04, 0x36, 0x04, 0x42,
+    0x04, 0x4D, 0x04, 0x66, 0x04, 0xA9, 0x04, 0xB5, 0x04, 0xC1, 0x04, 0xCD,
+    0x04, 0xD9, 0x04, 0xE5, 0x04, 0xF1, 0x05, 0x0B, 0x05, 0x37, 0x05, 0x43,
+    0x05, 0x4F, 0x05, 0x5B, 0x05, 0x70, 0x05, 0x7C, 0x05, 0x87, 0x05, 0x92,
+    0x05, 0x9D, 0x05, 0xA8, 0x05, 0xB3, 0x05, 0xBE, 0x05, 0xC9, 0x05, 0xD4,
+    0x05, 0xDF, 0x05, 0xEA, 0x05, 0xF5, 0x06, 0x00, 0x06, 0x0B, 0x06, 0x16,
+    0x06, 0x21, 0x06, 0x4B, 0x06, 0x57, 0x06, 0x75, 0x06, 0x80, 0x06, 0x8F,
+    0x06, 0x9B, 0x06, 0xA6, 0x06, 0xB2, 0x06, 0xBD, 0x06, 0xC9, 0x06, 0xD4,
+    0x06, 0xE0, 0x06, 0xEB, 0x07, 0x03, 0x07, 0x29, 0x07, 0x35, 0x07, 0x5B,
+    0x07, 0x67, 0x07, 0x73, 0x07, 0x7F, 0x07, 0x8B, 0x07, 0x97, 0x07, 0xA3,
+    0x07, 0xD2, 0x07, 0xDE, 0x07, 0xEA, 0x07, 0xF6, 0x08, 0x2A, 0x08, 0x64,
+    0x08, 0x70, 0x08, 0x7C, 0x08, 0x88, 0x08, 0x94, 0x08, 0xA0, 0x08, 0xB0,
+    0x08, 0xBC, 0x08, 0xC8, 0x08, 0xD4, 0x08, 0xDF, 0x08, 0xEB, 0x08, 0xFB,
+    0x09, 0x0B, 0x09, 0x17, 0x09, 0x23, 0x09, 0x2F, 0x09, 0x7E, 0x09, 0x8A,
+    0x09, 0x96, 0x09, 0xA2, 0x09, 0xAE, 0x09, 0xBA, 0x09, 0xC6, 0x09, 0xD2,
+    0x09, 0xDE, 0x09, 0xEE, 0x09, 0xFE, 0x0A, 0x58, 0x0A, 0x9A, 0x0A, 0xA6,
+    0x0A, 0xB2, 0x0A, 0xC2, 0x0A, 0xD2, 0x0A, 0xE2, 0x0B, 0x15, 0x0B, 0x3B,
+    0x0B, 0x62, 0x0B, 0xA5, 0x0B, 0xD3, 0x0B, 0xDE, 0x0B, 0xE9, 0x0B, 0xF4,
+    0x0B, 0xFF, 0x0C, 0x0A, 0x0C, 0x15, 0x0C, 0x20, 0x0C, 0x6E, 0x0C, 0x79,
+    0x0C, 0x84, 0x0C, 0x8F, 0x0C, 0x9E, 0x0C, 0xA9, 0x0C, 0xB4, 0x0C, 0xBF,
+    0x0C, 0xCA, 0x0C, 0xD5, 0x0C, 0xE3, 0x0D, 0x39, 0x0D, 0x77, 0x0D, 0x88,
+    0x0D, 0xA1, 0x0D, 0xAC, 0x0D, 0xB7, 0x0D, 0xC2, 0x0D, 0xCD, 0x0D, 0xD8,
+    0x0D, 0xFC, 0x0E, 0x08, 0x0E, 0x14, 0x0E, 0x20, 0x0E, 0x2C, 0x0E, 0x37,
+    0x0E, 0x43, 0x0E, 0x4F, 0x0E, 0x5B, 0x0E, 0x67, 0x0E, 0x97, 0x0E, 0xA3,
+    0x0E, 0xAF, 0x0E, 0xBB, 0x0E, 0xC7, 0x0E, 0xD3, 0x0E, 0xDF, 0x0E, 0xEB,
+    0x0E, 0xF7, 0x0F, 0x07, 0x0F, 0x4B, 0x0F, 0x57, 0x0F, 0x63, 0x0F, 0x73,
+    0x0F, 0x94, 0x0F, 0xCD, 0x0F, 0xD9, 0x0F, 0xE5, 0x0F, 0xF1, 0x0F, 0xFD,
+    0x10, 0x20, 0x10, 0x3B, 0x10, 0x46, 0x10, 0x51, 0x10, 0x5C, 0x10, 0x67,
+    0x10, 0x72, 0x10, 0x7D, 0x10, 0x88, 0x10, 0x93, 0x10, 0x9E, 0x10, 0xB7,
+    0x10, 0xC2, 0x10, 0xCD, 0x10, 0xD8, 0x10, 0xE3, 0x10, 0xF6, 0x11, 0x05,
+    0x11, 0x11, 0x11, 0x1C, 0x11, 0x27, 0x11, 0x32, 0x11, 0x3D, 0x11, 0x49,
+    0x11, 0x54, 0x11, 0x5F, 0x11, 0x6A, 0x11, 0x75, 0x11, 0x80, 0x11, 0x8B,
+    0x11, 0x96, 0x11, 0xA1, 0x11, 0xAD, 0x11, 0xB8, 0x11, 0xDC, 0x11, 0xE8,
+    0x11, 0xF4, 0x12, 0x00, 0x12, 0x3D, 0x12, 0x48, 0x12, 0x53, 0x12, 0x5E,
+    0x12, 0x6C, 0x12, 0x77, 0x12, 0x82, 0x12, 0x8D, 0x12, 0x98, 0x12, 0xA3,
+    0x12, 0xAF, 0x12, 0xBD, 0x12, 0xC8, 0x12, 0xD4, 0x12, 0xDF, 0x12, 0xEA,
+    0x12, 0xF5, 0x13, 0x00, 0x13, 0x0B, 0x13, 0x16, 0x13, 0x21, 0x13, 0x2C,
+    0x13, 0x38, 0x13, 0x43, 0x13, 0x52, 0x13, 0x5D, 0x13, 0xD3, 0x13, 0xDF,
+    0x14, 0x1D, 0x14, 0x4F, 0x14, 0x5A, 0x14, 0x65, 0x14, 0x70, 0x14, 0x7E,
+    0x14, 0x89, 0x14, 0x94, 0x14, 0xD2, 0x15, 0x24, 0x15, 0x30, 0x15, 0x75,
+    0x15, 0x80, 0x15, 0x8B, 0x15, 0x9B, 0x15, 0xD7, 0x15, 0xE2, 0x15, 0xED,
+    0x15, 0xF8, 0x16, 0x06, 0x16, 0x11, 0x16, 0x1C, 0x16, 0x2A, 0x16, 0x35,
+    0x16, 0x40, 0x16, 0x4B, 0x16, 0x56, 0x16, 0x61, 0x16, 0x6C, 0x16, 0x77,
+    0x16, 0x82, 0x16, 0x8D, 0x16, 0x98, 0x16, 0xA3, 0x16, 0xAE, 0x16, 0xB9,
+    0x17, 0x13, 0x17, 0x1E, 0x17, 0x58, 0x17, 0x80, 0x17, 0xD2, 0x17, 0xDD,
+    0x17, 0xE8, 0x17, 0xF3, 0x17, 0xFE, 0x18, 0x09, 0x18, 0x14, 0x18, 0x40,
+    0x18, 0x74, 0x18, 0x7F, 0x18, 0x8A, 0x18, 0x95, 0x18, 0xB1, 0x18, 0xBD,
+    0x18, 0xC9, 0x18, 0xD5, 0x18, 0xE1, 0x18, 0xED, 0x18, 0xF9, 0x19, 0x05,
+    0x19, 0x11, 0x19, 0x1D, 0x19, 0x28, 0x19, 0x34, 0x19, 0x40, 0x19, 0x4C,
+    0x19, 0x58, 0x19, 0x64, 0x19, 0x74, 0x19, 0x80, 0x19, 0xA7, 0x19, 0xBE,
+    0x19, 0xC9, 0x19, 0xE5, 0x19, 0xF0, 0x1A, 0x0C, 0x1A, 0x18, 0x1A, 0x23,
+    0x1A, 0x2F, 0x1A, 0x3A, 0x1A, 0x46, 0x1A, 0x51, 0x1A, 0x5D, 0x1A, 0x68,
+    0x1A, 0x7D, 0x1A, 0xC4, 0x1A, 0xD0, 0x1A, 0xFC, 0x1B, 0x07, 0x1B, 0x13,
+    0x1B, 0x1E, 0x1B, 0x29, 0x1B, 0x34, 0x1B, 0x3F, 0x1B, 0x74, 0x1B, 0x80,
+    0x1B, 0x8B, 0x1B, 0x96, 0x1B, 0xC8, 0x1B, 0xFA, 0x1C, 0x05, 0x1C, 0x10,
+    0x1C, 0x1B, 0x1C, 0x26, 0x1C, 0x32, 0x1C, 0x40, 0x1C, 0x4B, 0x1C, 0x57,
+    0x1C, 0x62, 0x1C, 0x6D, 0x1C, 0x78, 0x1C, 0x87, 0x1C, 0x96, 0x1C, 0xA1,
+    0x1C, 0xAC, 0x1C, 0xB7, 0x1C, 0xFB, 0x1D, 0x06, 0x1D, 0x11, 0x1D, 0x1C,
+    0x1D, 0x27, 0x1D, 0x32, 0x1D, 0x3D, 0x1D, 0x48, 0x1D, 0x53, 0x1D, 0x5E,
+    0x1D, 0x69, 0x1D, 0xB9, 0x1D, 0xF3, 0x1D, 0xFE, 0x1E, 0x09, 0x1E, 0x14,
+    0x1E, 0x1F, 0x1E, 0x2E, 0x1E, 0x96, 0x1E, 0xD2, 0x1F, 0x0F, 0x1F, 0x4E,
+    0x1F, 0x71, 0x1F, 0x7C, 0x1F, 0x87, 0x1F, 0x92, 0x1F, 0x9D, 0x1F, 0xA8,
+    0x1F, 0xB3, 0x1F, 0xBE, 0x20, 0x13, 0x20, 0x1E, 0x20, 0x29, 0x20, 0x34,
+    0x20, 0x3F, 0x20, 0x4A, 0x20, 0x55, 0x20, 0x60, 0x20, 0x6B, 0x20, 0x76,
+    0x20, 0x84, 0x20, 0xD4, 0x20, 0xE7, 0x21, 0x01, 0x21, 0x0D, 0x21, 0x18,
+    0x21, 0x23, 0x21, 0x2E, 0x21, 0x39, 0x21, 0x44, 0x21, 0x6D, 0x21, 0x78,
+    0x21, 0x83, 0x21, 0x8E, 0x21, 0x99, 0x21, 0xA4, 0x21, 0xAF, 0x21, 0xBA,
+    0x21, 0xC5, 0x21, 0xD0, 0x22, 0x06, 0x22, 0x11, 0x22, 0x1C, 0x22, 0x27,
+    0x22, 0x32, 0x22, 0x3D, 0x22, 0x48, 0x22, 0x53, 0x22, 0x5E, 0x22, 0x6D,
+    0x22, 0x79, 0x22, 0x84, 0x22, 0x8F, 0x22, 0x9A, 0x22, 0xAE, 0x22, 0xCD,
+    0x22, 0xD9, 0x22, 0xE5, 0x22, 0xF1, 0x22, 0xFD, 0x23, 0x1F, 0x23, 0x40,
+    0x23, 0x4B, 0x23, 0x56, 0x23, 0x61, 0x23, 0x6C, 0x23, 0x78, 0x23, 0x83,
+    0x23, 0x8E, 0x23, 0x99, 0x23, 0xA4, 0x23, 0xBC, 0x23, 0xC7, 0x23, 0xD2,
+    0x23, 0xDD, 0x23, 0xE8, 0x23, 0xFC, 0x24, 0x41, 0x24, 0x4C, 0x24, 0x57,
+    0x24, 0x62, 0x24, 0x70, 0x24, 0x7B, 0x24, 0x86, 0x24, 0x91, 0x24, 0x9C,
+    0x24, 0xA7, 0x24, 0xB2, 0x24, 0xC0, 0x24, 0xCB, 0x24, 0xD6, 0x24, 0xE1,
+    0x24, 0xEC, 0x24, 0xF7, 0x25, 0x02, 0x25, 0x0D, 0x25, 0x18, 0x25, 0x23,
+    0x25, 0x2E, 0x25, 0x3A, 0x25, 0x45, 0x25, 0x54, 0x25, 0x5F, 0x25, 0xD6,
+    0x25, 0xE1, 0x25, 0xEC, 0x25, 0xF7, 0x26, 0x02, 0x26, 0x0D, 0x26, 0x18,
+    0x26, 0x24, 0x26, 0x34, 0x26, 0x48, 0x26, 0x58, 0x26, 0x68, 0x26, 0x74,
+    0x26, 0x80, 0x26, 0xB7, 0x26, 0xE9, 0x26, 0xF1, 0x26, 0xF9, 0x27, 0x01,
+    0x27, 0x1D, 0x27, 0x49, 0x27, 0x62, 0x27, 0x97, 0x27, 0xD6, 0x27, 0xF0,
+    0x28, 0x2C, 0x28, 0x72, 0x28, 0x86, 0x28, 0xEA, 0x29, 0x2B, 0x29, 0x37,
+    0x29, 0x64, 0x29, 0x79, 0x29, 0xA7, 0x29, 0xDD, 0x29, 0xFE, 0x2A, 0x33,
+    0x2A, 0x70, 0x2A, 0x83, 0x2A, 0xD2, 0x2B, 0x10, 0x2B, 0x19, 0x2B, 0x22,
+    0x2B, 0x2B, 0x2B, 0x34, 0x2B, 0x3D, 0x2B, 0x46, 0x2B, 0x4F, 0x2B, 0x58,
+    0x2B, 0x61, 0x2B, 0x6A, 0x2B, 0x73, 0x2B, 0x7C, 0x2B, 0x85, 0x2B, 0x8E,
+    0x2B, 0x97, 0x2B, 0xA0, 0x2B, 0xA9, 0x2B, 0xB2, 0x2B, 0xBB, 0x2B, 0xC4,
+    0x2B, 0xCD, 0x2B, 0xD6, 0x2B, 0xDF, 0x2B, 0xE8, 0x2B, 0xF1, 0x2B, 0xFA,
+    0x2C, 0x03, 0x2C, 0x0C, 0x2C, 0x15, 0x2C, 0x1E, 0x2C, 0x2C, 0x2C, 0x3C,
+    0x2C, 0x4C, 0x2C, 0x5D, 0x2C, 0x6D, 0x2C, 0x7D, 0x2C, 0x8E, 0x2C, 0x9E,
+    0x2C, 0x9E, 0x2C, 0x9E, 0x2C, 0x9E, 0x2C, 0x9E, 0x2C, 0x9E, 0x2C, 0x9E,
+    0x2C, 0x9E, 0x2C, 0x9E, 0x2C, 0xB4, 0x2C, 0xD8, 0x2C, 0xE4, 0x2C, 0xF0,
+    0x2D, 0x00, 0x2D, 0x27, 0x2D, 0x4E, 0x2D, 0x8A, 0x2D, 0xC7, 0x2D, 0xD0,
+    0x2D, 0xEC, 0x2E, 0x16, 0x2E, 0x39, 0x2E, 0x48, 0x2E, 0x57, 0x2E, 0x60,
+    0x2E, 0x68, 0x2E, 0x70, 0x2E, 0x78, 0x2E, 0x81, 0x2E, 0x8A, 0x2E, 0x96,
+    0x2E, 0x9E, 0x2E, 0xAA, 0x2E, 0xB6, 0x2E, 0xBE, 0x2E, 0xC6, 0x2E, 0xCE,
+    0x2E, 0xDA, 0x2E, 0xE2, 0x2E, 0xEA, 0x2E, 0xF2, 0x2F, 0x0D, 0x2F, 0x27,
+    0x2F, 0x60, 0x2F, 0x99, 0x2F, 0xAD, 0x2F, 0xC1, 0x2F, 0xC9, 0x2F, 0xD1,
+    0x2F, 0xD9, 0x2F, 0xE1, 0x2F, 0xE9, 0x2F, 0xF1, 0x2F, 0xF9, 0x30, 0x05,
+    0x30, 0x11, 0x30, 0x1D, 0x30, 0x42, 0x30, 0x66, 0x30, 0x72, 0x30, 0x7E,
+    0x30, 0x90, 0x30, 0xA2, 0x30, 0xB8, 0x30, 0xC6, 0x30, 0xD2, 0x30, 0xDE,
+    0x30, 0xE6, 0x30, 0xEE, 0x31, 0x25, 0x31, 0xAC, 0x32, 0x02, 0x32, 0x23,
+    0x32, 0x9A, 0x32, 0xFD, 0x33, 0x55, 0x33, 0x80, 0x33, 0xB2, 0x33, 0xBA,
+    0x33, 0xC7, 0x33, 0xDB, 0x33, 0xEE, 0x34, 0x40, 0x34, 0x5A, 0x34, 0xA5,
+    0x34, 0xFF, 0x35, 0x07, 0x35, 0x50, 0x35, 0x92, 0x35, 0xDB, 0x36, 0x29,
+    0x36, 0x82, 0x36, 0xCA, 0x37, 0x0F, 0x37, 0x2F, 0x37, 0x79, 0x37, 0xA4,
+    0x38, 0x10, 0x38, 0x40, 0x38, 0x6A, 0x38, 0xA2, 0x38, 0xD0, 0x39, 0x19,
+    0x39, 0x50, 0x39, 0x87, 0x39, 0xEF, 0x3A, 0x3A, 0x3A, 0x63, 0x3A, 0x7F,
+    0x3A, 0x8E, 0x3A, 0xA1, 0x3A, 0xAD, 0x3A, 0xC5, 0x3A, 0xFD, 0x3B, 0x10,
+    0x3B, 0x2B, 0x3B, 0x3F, 0x3B, 0x54, 0x3B, 0x6F, 0x3B, 0x8B, 0x3B, 0xA6,
+    0x3C, 0x03, 0x3C, 0x34, 0x3C, 0x45, 0x3C, 0x5A, 0x3C, 0xB5, 0x3C, 0xEF,
+    0x3D, 0x24, 0x3D, 0x70, 0x3D, 0x88, 0x3D, 0xA3, 0x3D, 0xC3, 0x3D, 0xDC,
+    0x3E, 0x0A, 0x3E, 0x52, 0x3E, 0xB8, 0x3F, 0x49, 0x3F, 0x61, 0x3F, 0x83,
+    0x3F, 0xA5, 0x3F, 0xEC, 0x40, 0x2C, 0x40, 0x46, 0x40, 0x60, 0x40, 0x9E,
+    0x40, 0xD6, 0x40, 0xFC, 0x41, 0x28, 0x41, 0x34, 0x41, 0x4A, 0x41, 0x56,
+    0x41, 0x64, 0x41, 0x72, 0x41, 0x90, 0x41, 0xA6, 0x41, 0xCA, 0x41, 0xDD,
+    0x41, 0xF0, 0x42, 0x13, 0x42, 0x2E, 0x42, 0x5A, 0x42, 0x86, 0x42, 0xD1,
+    0x43, 0x04, 0x43, 0x10, 0x43, 0x1D, 0x43, 0x29, 0x43, 0x3E, 0x43, 0x52,
+    0x43, 0x84, 0x43, 0x9A, 0x43, 0xB5, 0x43, 0xD9, 0x43, 0xEC, 0x44, 0x02,
+    0x44, 0x28, 0x44, 0x4C, 0x44, 0x6F, 0x44, 0x97, 0x44, 0xB2, 0x44, 0xBE,
+    0x44, 0xCA, 0x44, 0xD2, 0x44, 0xDA, 0x44, 0xE2, 0x44, 0xEA, 0x44, 0xF2,
+    0x44, 0xFA, 0x45, 0x02, 0x45, 0x0A, 0x45, 0x12, 0x45, 0x1A, 0x45, 0x22,
+    0x45, 0x2A, 0x45, 0x32, 0x45, 0x58, 0x45, 0x85, 0x45, 0x91, 0x45, 0xA7,
+    0x45, 0xB3, 0x45, 0xC1, 0x45, 0xCF, 0x45, 0xED, 0x46, 0x02, 0x46, 0x15,
+    0x46, 0x2F, 0x46, 0x49, 0x46, 0x81, 0x46, 0xBF, 0x46, 0xD2, 0x46, 0xF0,
+    0x47, 0x12, 0x47, 0x34, 0x47, 0x74, 0x47, 0xBB, 0x47, 0xE7, 0x48, 0x12,
+    0x48, 0x1E, 0x48, 0x2A, 0x48, 0x36, 0x48, 0x43, 0x48, 0x4F, 0x48, 0x5B,
+    0x48, 0x67, 0x48, 0x99, 0x48, 0xAF, 0x48, 0xCC, 0x48, 0xDF, 0x49, 0x03,
+    0x49, 0x26, 0x49, 0x4D, 0x49, 0x55, 0x49, 0x5D, 0x49, 0x79, 0x49, 0x94,
+    0x49, 0xA1, 0x49, 0xAE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x04, 0x08, 0x02, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x80, 0x00, 0x06,
+    0x00, 0x50, 0x00, 0x0D, 0x00, 0x2F, 0x00, 0x39, 0x00, 0x7E, 0x01, 0x7E,
+    0x01, 0x8F, 0x01, 0x92, 0x01, 0x9D, 0x01, 0xA1, 0x01, 0xB0, 0x01, 0xD4,
+    0x01, 0xE7, 0x01, 0xEB, 0x01, 0xF2, 0x02, 0x1B, 0x02, 0x2D, 0x02, 0x33,
+    0x02, 0x37, 0x02, 0x59, 0x02, 0x72, 0x02, 0xBC, 0x02, 0xBF, 0x02, 0xC8,
+    0x02, 0xCC, 0x02, 0xDD, 0x03, 0x04, 0x03, 0x0C, 0x03, 0x0F, 0x03, 0x12,
+    0x03, 0x1B, 0x03, 0x24, 0x03, 0x28, 0x03, 0x2E, 0x03, 0x31, 0x03, 0x35,
+    0x03, 0x94, 0x03, 0xA9, 0x03, 0xBC, 0x03, 0xC0, 0x1E, 0x09, 0x1E, 0x0F,
+    0x1E, 0x17, 0x1E, 0x1D, 0x1E, 0x21, 0x1E, 0x25, 0x1E, 0x2B, 0x1E, 0x2F,
+    0x1E, 0x37, 0x1E, 0x3B, 0x1E, 0x49, 0x1E, 0x53, 0x1E, 0x5B, 0x1E, 0x69,
+    0x1E, 0x6F, 0x1E, 0x7B, 0x1E, 0x85, 0x1E, 0x8F, 0x1E, 0x93, 0x1E, 0x97,
+    0x1E, 0x9E, 0x1E, 0xF9, 0x20, 0x0B, 0x20, 0x10, 0x20, 0x15, 0x20, 0x1A,
+    0x20, 0x1E, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30, 0x20, 0x33, 0x20, 0x3A,
+    0x20, 0x44, 0x20, 0x70, 0x20, 0x79, 0x20, 0x89, 0x20, 0xA1, 0x20, 0xA4,
+    0x20, 0xA7, 0x20, 0xA9, 0x20, 0xAD, 0x20, 0xB2, 0x20, 0xB5, 0x20, 0xBA,
+    0x20, 0xBD, 0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2E,
+    0x21, 0x5E, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0F, 0x22, 0x12, 0x22, 0x15,
+    0x22, 0x1A, 0x22, 0x1E, 0x22, 0x2B, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65,
+    0x25, 0xCA, 0xFB, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20,
+    0x00, 0x30, 0x00, 0x3A, 0x00, 0xA0, 0x01, 0x8F, 0x01, 0x92, 0x01, 0x9D,
+    0x01, 0xA0, 0x01, 0xAF, 0x01, 0xC4, 0x01, 0xE6, 0x01, 0xEA, 0x01, 0xF1,
+    0x01, 0xFA, 0x02, 0x2A, 0x02, 0x30, 0x02, 0x37, 0x02, 0x59, 0x02, 0x72,
+    0x02, 0xBB, 0x02, 0xBE, 0x02, 0xC6, 0x02, 0xCC, 0x02, 0xD8, 0x03, 0x00,
+    0x03, 0x06, 0x03, 0x0F, 0x03, 0x11, 0x03, 0x1B, 0x03, 0x23, 0x03, 0x26,
+    0x03, 0x2E, 0x03, 0x31, 0x03, 0x35, 0x03, 0x94, 0x03, 0xA9, 0x03, 0xBC,
+    0x03, 0xC0, 0x1E, 0x08, 0x1E, 0x0C, 0x1E, 0x14, 0x1E, 0x1C, 0x1E, 0x20,
+    0x1E, 0x24, 0x1E, 0x2A, 0x1E, 0x2E, 0x1E, 0x36, 0x1E, 0x3A, 0x1E, 0x42,
+    0x1E, 0x4C, 0x1E, 0x5A, 0x1E, 0x5E, 0x1E, 0x6C, 0x1E, 0x78, 0x1E, 0x80,
+    0x1E, 0x8E, 0x1E, 0x92, 0x1E, 0x97, 0x1E, 0x9E, 0x1E, 0xA0, 0x20, 0x07,
+    0x20, 0x10, 0x20, 0x12, 0x20, 0x18, 0x20, 0x1C, 0x20, 0x20, 0x20, 0x26,
+    0x20, 0x30, 0x20, 0x33, 0x20, 0x39, 0x20, 0x44, 0x20, 0x70, 0x20, 0x74,
+    0x20, 0x80, 0x20, 0xA1, 0x20, 0xA3, 0x20, 0xA6, 0x20, 0xA9, 0x20, 0xAB,
+    0x20, 0xB1, 0x20, 0xB5, 0x20, 0xB9, 0x20, 0xBC, 0x21, 0x13, 0x21, 0x16,
+    0x21, 0x22, 0x21, 0x26, 0x21, 0x2E, 0x21, 0x5B, 0x22, 0x02, 0x22, 0x05,
+    0x22, 0x0F, 0x22, 0x11, 0x22, 0x15, 0x22, 0x19, 0x22, 0x1E, 0x22, 0x2B,
+    0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xCA, 0xFB, 0x01, 0xFF, 0xFF,
+    0x02, 0x54, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x2C,
+    0x01, 0x13, 0xFE, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x33,
+    0xFE, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0xF2,
+    0xFF, 0xEB, 0xFF, 0xEA, 0xFF, 0xE5, 0xFF, 0xE3, 0xFF, 0xE0, 0xFE, 0x8E,
+    0xFE, 0x7A, 0xFE, 0x68, 0xFE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x2F, 0xE2, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0xE2, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0x47, 0xE2, 0xB8, 0xE2, 0x7B, 0xE2, 0x64, 0xE2, 0x15,
+    0xE1, 0xDF, 0xE1, 0xDF, 0xE1, 0xBB, 0xE2, 0x18, 0x00, 0x00, 0xE2, 0x1E,
+    0xE2, 0x21, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0x9F, 0xE1, 0x9F, 0xE1, 0x8A, 0xE1, 0xBA, 0xE1, 0x86, 0xE1, 0x02,
+    0xE0, 0xE4, 0x00, 0x00, 0xE0, 0xD3, 0x00, 0x00, 0xE0, 0xB8, 0x00, 0x00,
+    0xE0, 0xBF, 0xE0, 0xB4, 0xE0, 0x91, 0xE0, 0x73, 0x00, 0x00, 0xDD, 0x1F,
+    0x07, 0x1D, 0x00, 0x01, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xEA,
+    0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x28, 0x03, 0x2A,
+    0x03, 0x2C, 0x03, 0x4C, 0x03, 0x4E, 0x03, 0x50, 0x03, 0x52, 0x03, 0x94,
+    0x03, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9A, 0x03, 0x9C,
+    0x03, 0x9E, 0x00, 0x00, 0x03, 0xA0, 0x03, 0xAA, 0x03, 0xB2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA6,
+    0x03, 0xA8, 0x03, 0xAE, 0x03, 0xB4, 0x03, 0xB6, 0x03, 0xB8, 0x03, 0xBA,
+    0x03, 0xBC, 0x03, 0xBE, 0x03, 0xC0, 0x03, 0xC2, 0x03, 0xD0, 0x03, 0xDE,
+    0x03, 0xE0, 0x03, 0xF6, 0x03, 0xFC, 0x04, 0x02, 0x04, 0x0C, 0x04, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x04, 0xBE, 0x00, 0x00, 0x04, 0xC4,
+    0x04, 0xCA, 0x04, 0xCE, 0x04, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC2, 0x04, 0xC6, 0x00, 0x00,
+    0x04, 0xC6, 0x04, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBC, 0x00, 0x00, 0x04, 0xBC,
+    0x00, 0x00, 0x04, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x02, 0x6E,
+    0x02, 0x9F, 0x02, 0x75, 0x02, 0xBB, 0x02, 0xE7, 0x02, 0xA7, 0x02, 0xA0,
+    0x02, 0x89, 0x02, 0x8A, 0x02, 0x74, 0x02, 0xCE, 0x02, 0x6A, 0x02, 0x7E,
+    0x02, 0x69, 0x02, 0x76, 0x02, 0x6B, 0x02, 0x6C, 0x02, 0xD5, 0x02, 0xD2,
+    0x02, 0xD4, 0x02, 0x70, 0x02, 0xA6, 0x00, 0x01, 0x00, 0x1D, 0x00, 0x1E,
+    0x00, 0x25, 0x00, 0x2F, 0x00, 0x46, 0x00, 0x47, 0x00, 0x4E, 0x00, 0x53,
+    0x00, 0x64, 0x00, 0x66, 0x00, 0x68, 0x00, 0x72, 0x00, 0x74, 0x00, 0x80,
+    0x00, 0xA4, 0x00, 0xA6, 0x00, 0xA7, 0x00, 0xAF, 0x00, 0xBC, 0x00, 0xC3,
+    0x00, 0xDB, 0x00, 0xDC, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xEC, 0x02, 0x8D,
+    0x02, 0x77, 0x02, 0x8E, 0x02, 0xDC, 0x02, 0x85, 0x03, 0x18, 0x01, 0x07,
+    0x01, 0x23, 0x01, 0x24, 0x01, 0x2B, 0x01, 0x32, 0x01, 0x4A, 0x01, 0x4B,
+    0x01, 0x52, 0x01, 0x57, 0x01, 0x69, 0x01, 0x6C, 0x01, 0x6F, 0x01, 0x78,
+    0x01, 0x7A, 0x01, 0x86, 0x01, 0xAA, 0x01, 0xAC, 0x01, 0xAD, 0x01, 0xB5,
+    0x01, 0xC1, 0x01, 0xC9, 0x01, 0xE1, 0x01, 0xE2, 0x01, 0xE7, 0x01, 0xE8,
+    0x01, 0xF2, 0x02, 0x8B, 0x02, 0xAF, 0x02, 0x8C, 0x02, 0xDA, 0x02, 0x66,
+    0x02, 0x6F, 0x02, 0xB8, 0x02, 0xC9, 0x02, 0xBA, 0x02, 0xCB, 0x02, 0xB0,
+    0x02, 0xA9, 0x03, 0x16, 0x02, 0xAA, 0x02, 0x20, 0x02, 0x9B, 0x02, 0xDB,
+    0x02, 0x7F, 0x02, 0xAB, 0x03, 0x20, 0x02, 0xAD, 0x02, 0xD8, 0x02, 0x51,
+    0x02, 0x52, 0x03, 0x19, 0x02, 0xE5, 0x02, 0xA8, 0x02, 0x72, 0x03, 0x21,
+    0x02, 0x50, 0x02, 0x21, 0x02, 0x9C, 0x02, 0x5B, 0x02, 0x5A, 0x02, 0x5C,
+    0x02, 0x71, 0x00, 0x13, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x11,
+    0x00, 0x18, 0x00, 0x1B, 0x00, 0x21, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x34,
+    0x00, 0x3B, 0x00, 0x5E, 0x00, 0x55, 0x00, 0x58, 0x00, 0x5A, 0x00, 0x28,
+    0x00, 0x7E, 0x00, 0x8F, 0x00, 0x81, 0x00, 0x84, 0x00, 0x9F, 0x00, 0x8B,
+    0x02, 0xD0, 0x00, 0x9D, 0x00, 0xCB, 0x00, 0xC4, 0x00, 0xC7, 0x00, 0xC9,
+    0x00, 0xE3, 0x00, 0xA5, 0x01, 0xC0, 0x01, 0x19, 0x01, 0x08, 0x01, 0x10,
+    0x01, 0x20, 0x01, 0x17, 0x01, 0x1E, 0x01, 0x21, 0x01, 0x27, 0x01, 0x41,
+    0x01, 0x33, 0x01, 0x37, 0x01, 0x3E, 0x01, 0x62, 0x01, 0x59, 0x01, 0x5C,
+    0x01, 0x5E, 0x01, 0x2C, 0x01, 0x84, 0x01, 0x95, 0x01, 0x87, 0x01, 0x8A,
+    0x01, 0xA5, 0x01, 0x91, 0x02, 0xD1, 0x01, 0xA3, 0x01, 0xD1, 0x01, 0xCA,
+    0x01, 0xCD, 0x01, 0xCF, 0x01, 0xE9, 0x01, 0xAB, 0x01, 0xEB, 0x00, 0x16,
+    0x01, 0x1C, 0x00, 0x03, 0x01, 0x09, 0x00, 0x17, 0x01, 0x1D, 0x00, 0x1F,
+    0x01, 0x25, 0x00, 0x23, 0x01, 0x29, 0x00, 0x24, 0x01, 0x2A, 0x00, 0x20,
+    0x01, 0x26, 0x00, 0x29, 0x01, 0x2D, 0x00, 0x2A, 0x01, 0x2E, 0x00, 0x41,
+    0x01, 0x44, 0x00, 0x31, 0x01, 0x34, 0x00, 0x3C, 0x01, 0x3F, 0x00, 0x44,
+    0x01, 0x47, 0x00, 0x32, 0x01, 0x35, 0x00, 0x4A, 0x01, 0x4E, 0x00, 0x48,
+    0x01, 0x4C, 0x00, 0x4C, 0x01, 0x50, 0x00, 0x4B, 0x01, 0x4F, 0x00, 0x51,
+    0x01, 0x55, 0x00, 0x4F, 0x01, 0x53, 0x00, 0x63, 0x01, 0x68, 0x00, 0x61,
+    0x01, 0x66, 0x00, 0x56, 0x01, 0x5A, 0x00, 0x62, 0x01, 0x67, 0x00, 0x5C,
+    0x01, 0x58, 0x00, 0x54, 0x01, 0x65, 0x00, 0x65, 0x01, 0x6B, 0x00, 0x67,
+    0x01, 0x6D, 0x01, 0x6E, 0x00, 0x6A, 0x01, 0x70, 0x00, 0x6C, 0x01, 0x72,
+    0x00, 0x6B, 0x01, 0x71, 0x00, 0x6D, 0x01, 0x73, 0x00, 0x71, 0x01, 0x77,
+    0x00, 0x76, 0x01, 0x7B, 0x00, 0x78, 0x01, 0x7E, 0x00, 0x77, 0x01, 0x7D,
+    0x01, 0x7C, 0x00, 0x7F, 0x01, 0x85, 0x00, 0x99, 0x01, 0x9F, 0x00, 0x82,
+    0x01, 0x88, 0x00, 0x97, 0x01, 0x9D, 0x00, 0xA3, 0x01, 0xA9, 0x00, 0xA8,
+    0x01, 0xAE, 0x00, 0xAA, 0x01, 0xB0, 0x00, 0xA9, 0x01, 0xAF, 0x00, 0xB0,
+    0x01, 0xB6, 0x00, 0xB5, 0x01, 0xBB, 0x00, 0xB4, 0x01, 0xBA, 0x00, 0xB2,
+    0x01, 0xB8, 0x00, 0xBF, 0x01, 0xC4, 0x00, 0xBE, 0x01, 0xC3, 0x00, 0xBD,
+    0x01, 0xC2, 0x00, 0xD9, 0x01, 0xDF, 0x00, 0xD5, 0x01, 0xDB, 0x00, 0xC5,
+    0x01, 0xCB, 0x00, 0xD8, 0x01, 0xDE, 0x00, 0xD3, 0x01, 0xD9, 0x00, 0xD7,
+    0x01, 0xDD, 0x00, 0xDE, 0x01, 0xE4, 0x00, 0xE4, 0x01, 0xEA, 0x00, 0xE5,
+    0x00, 0xED, 0x01, 0xF3, 0x00, 0xEF, 0x01, 0xF5, 0x00, 0xEE, 0x01, 0xF4,
+    0x00, 0x91, 0x01, 0x97, 0x00, 0xCD, 0x01, 0xD3, 0x00, 0x27, 0x00, 0x2E,
+    0x01, 0x31, 0x00, 0x69, 0x00, 0x6F, 0x01, 0x75, 0x00, 0x75, 0x00, 0x7C,
+    0x01, 0x82, 0x00, 0x09, 0x01, 0x0F, 0x00, 0x57, 0x01, 0x5B, 0x00, 0x83,
+    0x01, 0x89, 0x00, 0xC6, 0x01, 0xCC, 0x00, 0x49, 0x01, 0x4D, 0x00, 0x9C,
+    0x01, 0xA2, 0x00, 0x26, 0x00, 0x2D, 0x00, 0x19, 0x01, 0x1F, 0x00, 0x1C,
+    0x01, 0x22, 0x00, 0x9E, 0x01, 0xA4, 0x00, 0x10, 0x01, 0x16, 0x00, 0x15,
+    0x01, 0x1B, 0x00, 0x3A, 0x01, 0x3D, 0x00, 0x40, 0x01, 0x43, 0x00, 0x59,
+    0x01, 0x5D, 0x00, 0x60, 0x01, 0x64, 0x00, 0x8A, 0x01, 0x90, 0x00, 0x98,
+    0x01, 0x9E, 0x00, 0xAB, 0x01, 0xB1, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0xC8,
+    0x01, 0xCE, 0x00, 0xD4, 0x01, 0xDA, 0x00, 0xB6, 0x01, 0xBC, 0x00, 0xC0,
+    0x01, 0xC5, 0x00, 0x8C, 0x01, 0x92, 0x00, 0xA2, 0x01, 0xA8, 0x00, 0x8D,
+    0x01, 0x93, 0x00, 0xEA, 0x01, 0xF0, 0x03, 0x48, 0x03, 0x47, 0x03, 0x4A,
+    0x03, 0x49, 0x03, 0x1B, 0x03, 0x1C, 0x03, 0x4C, 0x03, 0x1D, 0x03, 0x17,
+    0x03, 0x1E, 0x03, 0x22, 0x03, 0x1F, 0x03, 0x1A, 0x02, 0xF7, 0x02, 0xF8,
+    0x02, 0xFC, 0x03, 0x01, 0x03, 0x05, 0x02, 0xFF, 0x02, 0xF5, 0x02, 0xF2,
+    0x03, 0x09, 0x03, 0x00, 0x02, 0xFA, 0x02, 0xFD, 0x00, 0x22, 0x01, 0x28,
+    0x00, 0x2B, 0x01, 0x2F, 0x00, 0x2C, 0x01, 0x30, 0x00, 0x43, 0x01, 0x46,
+    0x00, 0x42, 0x01, 0x45, 0x00, 0x33, 0x01, 0x36, 0x00, 0x4D, 0x01, 0x51,
+    0x00, 0x52, 0x01, 0x56, 0x00, 0x50, 0x01, 0x54, 0x00, 0x5B, 0x01, 0x5F,
+    0x00, 0x6E, 0x01, 0x74, 0x00, 0x70, 0x01, 0x76, 0x00, 0x73, 0x01, 0x79,
+    0x00, 0x79, 0x01, 0x7F, 0x00, 0x7A, 0x01, 0x80, 0x00, 0x7D, 0x01, 0x83,
+    0x00, 0xA0, 0x01, 0xA6, 0x00, 0xA1, 0x01, 0xA7, 0x00, 0x9B, 0x01, 0xA1,
+    0x00, 0x9A, 0x01, 0xA0, 0x00, 0xAC, 0x01, 0xB2, 0x00, 0xAE, 0x01, 0xB4,
+    0x00, 0xB7, 0x01, 0xBD, 0x00, 0xB8, 0x01, 0xBE, 0x00, 0xB1, 0x01, 0xB7,
+    0x00, 0xB3, 0x01, 0xB9, 0x00, 0xB9, 0x01, 0xBF, 0x00, 0xC1, 0x01, 0xC7,
+    0x00, 0xC2, 0x01, 0xC8, 0x00, 0xDA, 0x01, 0xE0, 0x00, 0xD6, 0x01, 0xDC,
+    0x00, 0xE0, 0x01, 0xE6, 0x00, 0xDD, 0x01, 0xE3, 0x00, 0xDF, 0x01, 0xE5,
+    0x00, 0xE6, 0x01, 0xEC, 0x00, 0xF0, 0x01, 0xF6, 0x00, 0x12, 0x01, 0x18,
+    0x00, 0x14, 0x01, 0x1A, 0x00, 0x0B, 0x01, 0x11, 0x00, 0x0D, 0x01, 0x13,
+    0x00, 0x0E, 0x01, 0x14, 0x00, 0x0F, 0x01, 0x15, 0x00, 0x0C, 0x01, 0x12,
+    0x00, 0x04, 0x01, 0x0A, 0x00, 0x06, 0x01, 0x0C, 0x00, 0x07, 0x01, 0x0D,
+    0x00, 0x08, 0x01, 0x0E, 0x00, 0x05, 0x01, 0x0B, 0x00, 0x3D, 0x01, 0x40,
+    0x00, 0x3F, 0x01, 0x42, 0x00, 0x45, 0x01, 0x48, 0x00, 0x35, 0x01, 0x38,
+    0x00, 0x37, 0x01, 0x3A, 0x00, 0x38, 0x01, 0x3B, 0x00, 0x39, 0x01, 0x3C,
+    0x00, 0x36, 0x01, 0x39, 0x00, 0x5F, 0x01, 0x63, 0x00, 0x5D, 0x01, 0x61,
+    0x00, 0x8E, 0x01, 0x94, 0x00, 0x90, 0x01, 0x96, 0x00, 0x85, 0x01, 0x8B,
+    0x00, 0x87, 0x01, 0x8D, 0x00, 0x88, 0x01, 0x8E, 0x00, 0x89, 0x01, 0x8F,
+    0x00, 0x86, 0x01, 0x8C, 0x00, 0x92, 0x01, 0x98, 0x00, 0x94, 0x01, 0x9A,
+    0x00, 0x95, 0x01, 0x9B, 0x00, 0x96, 0x01, 0x9C, 0x00, 0x93, 0x01, 0x99,
+    0x00, 0xCA, 0x01, 0xD0, 0x00, 0xCC, 0x01, 0xD2, 0x00, 0xCE, 0x01, 0xD4,
+    0x00, 0xD0, 0x01, 0xD6, 0x00, 0xD1, 0x01, 0xD7, 0x00, 0xD2, 0x01, 0xD8,
+    0x00, 0xCF, 0x01, 0xD5, 0x00, 0xE8, 0x01, 0xEE, 0x00, 0xE7, 0x01, 0xED,
+    0x00, 0xE9, 0x01, 0xEF, 0x00, 0xEB, 0x01, 0xF1, 0x02, 0x62, 0x02, 0x64,
+    0x02, 0x67, 0x02, 0x63, 0x02, 0x68, 0x02, 0x82, 0x02, 0x80, 0x02, 0x81,
+    0x02, 0x83, 0x02, 0x99, 0x02, 0x9A, 0x02, 0x95, 0x02, 0x97, 0x02, 0x98,
+    0x02, 0x96, 0x02, 0xB1, 0x02, 0xB3, 0x02, 0x73, 0x02, 0xBE, 0x02, 0xC1,
+    0x02, 0xBC, 0x02, 0xBD, 0x02, 0xC0, 0x02, 0xC6, 0x02, 0xBF, 0x02, 0xC8,
+    0x02, 0xC2, 0x02, 0xC3, 0x02, 0xC7, 0x02, 0xDE, 0x02, 0xE1, 0x02, 0xE3,
+    0x02, 0xCF, 0x02, 0xCC, 0x02, 0xE4, 0x02, 0xD7, 0x02, 0xD6, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xDE, 0x03, 0x1C, 0x00, 0x02,
+    0x44, 0x46, 0x4C, 0x54, 0x01, 0xAE, 0x6C, 0x61, 0x74, 0x6E, 0x00, 0x0E,
+    0x01, 0x7E, 0x00, 0x09, 0x41, 0x5A, 0x45, 0x20, 0x01, 0x5A, 0x43, 0x41,
+    0x54, 0x20, 0x01, 0x36, 0x43, 0x52, 0x54, 0x20, 0x01, 0x12, 0x4B, 0x41,
+    0x5A, 0x20, 0x00, 0xEE, 0x4D, 0x4F, 0x4C, 0x20, 0x00, 0xCA, 0x4E, 0x4C,
+    0x44, 0x20, 0x00, 0xA6, 0x52, 0x4F, 0x4D, 0x20, 0x00, 0x82, 0x54, 0x41,
+    0x54, 0x20, 0x00, 0x5E, 0x54, 0x52, 0x4B, 0x20, 0x00, 0x3A, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0A, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x09, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
+    0x61, 0x61, 0x6C, 0x74, 0x01, 0x36, 0x63, 0x61, 0x73, 0x65, 0x01, 0x30,
+    0x63, 0x63, 0x6D, 0x70, 0x01, 0x22, 0x63, 0x63, 0x6D, 0x70, 0x01, 0x10,
+    0x64, 0x6C, 0x69, 0x67, 0x01, 0x0A, 0x64, 0x6E, 0x6F, 0x6D, 0x01, 0x04,
+    0x66, 0x72, 0x61, 0x63, 0x00, 0xFA, 0x6C, 0x69, 0x67, 0x61, 0x00, 0xF4,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xEE, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xE8,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xE2, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xDC,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xD6, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xD0,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xCA, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xC4,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xBE, 0x6E, 0x75, 0x6D, 0x72, 0x00, 0xB8,
+    0x6F, 0x72, 0x64, 0x6E, 0x00, 0xB0, 0x73, 0x69, 0x6E, 0x66, 0x00, 0xAA,
+    0x73, 0x73, 0x30, 0x31, 0x00, 0xA4, 0x73, 0x75, 0x62, 0x73, 0x00, 0x9E,
+    0x73, 0x75, 0x70, 0x73, 0x00, 0x98, 0x7A, 0x65, 0x72, 0x6F, 0x00, 0x92,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02,
+    0x00, 0x05, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x08, 0x30, 0x07, 0x72, 0x06, 0xAE,
+    0x06, 0x26, 0x06, 0x26, 0x05, 0xEE, 0x05, 0x98, 0x05, 0x98, 0x05, 0x0A,
+    0x04, 0x80, 0x04, 0x22, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E,
+    0x04, 0x0E, 0x03, 0xEC, 0x03, 0xEC, 0x03, 0xBE, 0x03, 0x82, 0x03, 0x74,
+    0x03, 0x66, 0x03, 0x4E, 0x03, 0x4E, 0x03, 0x40, 0x03, 0x32, 0x03, 0x24,
+    0x03, 0x10, 0x03, 0x32, 0x02, 0xC8, 0x02, 0xBA, 0x02, 0xBA, 0x02, 0x7C,
+    0x02, 0x5A, 0x02, 0x38, 0x01, 0x6A, 0x01, 0x40, 0x01, 0x02, 0x00, 0xEE,
+    0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x72, 0x00, 0x36, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5,
+    0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
+    0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0xF8,
+    0x01, 0xF9, 0x01, 0xFA, 0x01, 0xFB, 0x01, 0xFC, 0x01, 0xFD, 0x01, 0xFE,
+    0x01, 0xFF, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04,
+    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A,
+    0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10,
+    0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16,
+    0x02, 0x17, 0x02, 0x18, 0x00, 0x02, 0x00, 0x05, 0x00, 0x53, 0x00, 0x65,
+    0x00, 0x00, 0x00, 0x69, 0x00, 0x69, 0x00, 0x13, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x14, 0x01, 0x07, 0x01, 0x20, 0x00, 0x15, 0x01, 0x4B, 0x01, 0x51,
+    0x00, 0x2F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x06, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x01, 0x02, 0x26, 0x00, 0x04,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x05, 0x00, 0x26, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12,
+    0x00, 0x0C, 0x02, 0x1F, 0x00, 0x02, 0x01, 0x6F, 0x02, 0x1E, 0x00, 0x02,
+    0x01, 0x57, 0x02, 0x19, 0x00, 0x02, 0x01, 0x4A, 0x02, 0x1C, 0x00, 0x03,
+    0x01, 0x4A, 0x01, 0x6F, 0x02, 0x1A, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x57,
+    0x00, 0x04, 0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1C,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x02, 0x1D,
+    0x00, 0x02, 0x01, 0x65, 0x02, 0x1B, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x65,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x4A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x74, 0x00, 0x37, 0x02, 0x78, 0x02, 0x79,
+    0x02, 0x7A, 0x02, 0x7B, 0x02, 0x7D, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88,
+    0x02, 0x8F, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94,
+    0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xB6, 0x03, 0x34,
+    0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30,
+    0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31,
+    0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B,
+    0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41,
+    0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02,
+    0x00, 0x0D, 0x02, 0x72, 0x02, 0x73, 0x00, 0x00, 0x02, 0x76, 0x02, 0x77,
+    0x00, 0x02, 0x02, 0x7C, 0x02, 0x7C, 0x00, 0x04, 0x02, 0x7E, 0x02, 0x7E,
+    0x00, 0x05, 0x02, 0x80, 0x02, 0x81, 0x00, 0x06, 0x02, 0x89, 0x02, 0x8E,
+    0x00, 0x08, 0x02, 0x9B, 0x02, 0x9E, 0x00, 0x0E, 0x02, 0xA6, 0x02, 0xA6,
+    0x00, 0x12, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x13, 0x02, 0xFC, 0x02, 0xFD,
+    0x00, 0x24, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x26, 0x03, 0x0D, 0x03, 0x0D,
+    0x00, 0x33, 0x03, 0x10, 0x03, 0x12, 0x00, 0x34, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x04, 0x02, 0xB5, 0x00, 0x03, 0x01, 0x86, 0x02, 0x69,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x04, 0x02, 0x20, 0x02, 0x21,
+    0x02, 0x20, 0x02, 0x21, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x80,
+    0x01, 0x07, 0x01, 0x86, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x24,
+    0x00, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x00, 0xD6, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0x80, 0x01, 0x86, 0x00, 0x03, 0x00, 0x01, 0x00, 0xBC, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x01, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x3E, 0xFF, 0xEC, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x26, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x01, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x31, 0x02, 0x3A, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0x00, 0x01, 0x02, 0x45, 0x02, 0x4E,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x59, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0xFF, 0xE3, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x30, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x14, 0x00, 0x29, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x15,
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x26, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x24, 0x00, 0x0B,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x16,
+    0x00, 0x0A, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x01, 0x02, 0x72,
+    0x00, 0x02, 0x00, 0x16, 0x00, 0x06, 0x00, 0x01, 0x00, 0x68, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x68, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
+    0x01, 0x6F, 0x00, 0x01, 0x00, 0x01, 0x01, 0x6F, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x1E, 0x00, 0x02, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x04,
+    0x01, 0xF7, 0x00, 0x02, 0x01, 0x69, 0x00, 0x01, 0x00, 0x04, 0x00, 0xF1,
+    0x00, 0x02, 0x00, 0x64, 0x00, 0x01, 0x00, 0x02, 0x00, 0x55, 0x01, 0x59,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0E,
+    0x00, 0x04, 0x00, 0xB6, 0x00, 0xC0, 0x01, 0xBC, 0x01, 0xC5, 0x00, 0x01,
+    0x00, 0x04, 0x00, 0xB4, 0x00, 0xBF, 0x01, 0xBA, 0x01, 0xC4, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x09,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x57, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x4E, 0x00, 0x02, 0x00, 0x2C, 0x00, 0x0A,
+    0x00, 0x04, 0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x02, 0xED,
+    0x00, 0x02, 0x03, 0x01, 0x02, 0xEC, 0x00, 0x02, 0x03, 0x09, 0x02, 0xEB,
+    0x00, 0x02, 0x02, 0xF7, 0x02, 0xEA, 0x00, 0x02, 0x02, 0xF8, 0x00, 0x04,
+    0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x02, 0xF1, 0x00, 0x02,
+    0x03, 0x01, 0x02, 0xF0, 0x00, 0x02, 0x03, 0x09, 0x02, 0xEF, 0x00, 0x02,
+    0x02, 0xF7, 0x02, 0xEE, 0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x02,
+    0x02, 0xFC, 0x02, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x76, 0x00, 0x70,
+    0x00, 0x6A, 0x00, 0x64, 0x00, 0x5E, 0x00, 0x58, 0x00, 0x52, 0x00, 0x4C,
+    0x00, 0x46, 0x00, 0x40, 0x00, 0x3A, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x27,
+    0x00, 0x2E, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x7C,
+    0x01, 0x31, 0x01, 0x75, 0x01, 0x82, 0x02, 0x1E, 0x02, 0x1F, 0x00, 0x02,
+    0x01, 0x4A, 0x01, 0x6F, 0x00, 0x02, 0x01, 0x4A, 0x01, 0x57, 0x00, 0x02,
+    0x01, 0x7A, 0x01, 0x69, 0x00, 0x02, 0x01, 0x6F, 0x01, 0x69, 0x00, 0x02,
+    0x01, 0x2B, 0x01, 0xF4, 0x00, 0x02, 0x00, 0x74, 0x01, 0x69, 0x00, 0x02,
+    0x00, 0x74, 0x00, 0x64, 0x00, 0x02, 0x00, 0x68, 0x01, 0x69, 0x00, 0x02,
+    0x00, 0x68, 0x02, 0x7D, 0x00, 0x02, 0x00, 0x68, 0x00, 0x64, 0x00, 0x02,
+    0x00, 0x25, 0x01, 0xF4, 0x00, 0x02, 0x00, 0x25, 0x00, 0xEE, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x76, 0x00, 0x06,
+    0x00, 0x64, 0x00, 0x5A, 0x00, 0x50, 0x00, 0x46, 0x00, 0x2C, 0x00, 0x12,
+    0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x03, 0x07, 0x00, 0x02,
+    0x02, 0xF7, 0x03, 0x06, 0x00, 0x02, 0x02, 0xF2, 0x03, 0x08, 0x00, 0x02,
+    0x02, 0xF8, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x03, 0x04,
+    0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x00, 0x02, 0x02, 0xF2, 0x03, 0x03,
+    0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x04, 0x02, 0xFE, 0x00, 0x02,
+    0x02, 0xF5, 0x00, 0x01, 0x00, 0x04, 0x02, 0xF9, 0x00, 0x02, 0x02, 0xF5,
+    0x00, 0x01, 0x00, 0x04, 0x02, 0xF6, 0x00, 0x02, 0x03, 0x05, 0x00, 0x02,
+    0x00, 0x0C, 0x00, 0x06, 0x02, 0xF4, 0x00, 0x02, 0x03, 0x05, 0x02, 0xF3,
+    0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x06, 0x02, 0xF2, 0x02, 0xF5,
+    0x02, 0xF8, 0x02, 0xFD, 0x03, 0x01, 0x03, 0x05, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0x50, 0x00, 0x24, 0x03, 0x34,
+    0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30,
+    0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31,
+    0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B,
+    0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41,
+    0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x01,
+    0x00, 0x24, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE6, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01,
+    0x03, 0x23, 0x03, 0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x52, 0x00, 0x26, 0x01, 0x58, 0x01, 0x6A,
+    0x03, 0x34, 0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D,
+    0x03, 0x30, 0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26,
+    0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C,
+    0x03, 0x31, 0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A,
+    0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40,
+    0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46,
+    0x00, 0x02, 0x00, 0x07, 0x01, 0x57, 0x01, 0x57, 0x00, 0x00, 0x01, 0x69,
+    0x01, 0x69, 0x00, 0x01, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x02, 0x02, 0xFC,
+    0x02, 0xFD, 0x00, 0x13, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x15, 0x03, 0x0D,
+    0x03, 0x0D, 0x00, 0x22, 0x03, 0x10, 0x03, 0x12, 0x00, 0x23, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x88, 0x00, 0x64, 0x00, 0x30, 0x00, 0x0E,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01,
+    0x01, 0x06, 0x00, 0x00, 0x02, 0x22, 0x02, 0x23, 0x01, 0x06, 0x00, 0x03,
+    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x05, 0x02, 0xEA, 0x02, 0xFA,
+    0x00, 0x00, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x11, 0x02, 0xFF, 0x03, 0x0B,
+    0x00, 0x13, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x20, 0x03, 0x10, 0x03, 0x12,
+    0x00, 0x21, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x02, 0x03, 0x0D, 0x03, 0x0F, 0x00, 0x00, 0x03, 0x11, 0x03, 0x15,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x0F,
+    0x02, 0xF2, 0x02, 0xF5, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xFA, 0x02, 0xFC,
+    0x02, 0xFD, 0x02, 0xFF, 0x03, 0x00, 0x03, 0x01, 0x03, 0x05, 0x03, 0x09,
+    0x03, 0x0A, 0x03, 0x0B, 0x03, 0x0C, 0x00, 0x01, 0x00, 0x02, 0x01, 0x57,
+    0x01, 0x69, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x20, 0x00, 0x0D, 0x00, 0xB0, 0x00, 0xA4, 0x00, 0x9A, 0x00, 0x90,
+    0x00, 0x86, 0x00, 0x7C, 0x00, 0x72, 0x00, 0x68, 0x00, 0x5E, 0x00, 0x54,
+    0x00, 0x4A, 0x00, 0x42, 0x00, 0x3C, 0x00, 0x02, 0x00, 0x04, 0x01, 0x07,
+    0x01, 0x07, 0x00, 0x00, 0x02, 0x26, 0x02, 0x2F, 0x00, 0x01, 0x02, 0x72,
+    0x02, 0x72, 0x00, 0x0B, 0x02, 0x76, 0x02, 0x76, 0x00, 0x0C, 0x00, 0x02,
+    0x02, 0x59, 0x02, 0x7A, 0x00, 0x03, 0x02, 0x78, 0x02, 0x7C, 0x02, 0x7D,
+    0x00, 0x04, 0x02, 0x3A, 0x02, 0x44, 0x02, 0x4E, 0x02, 0x58, 0x00, 0x04,
+    0x02, 0x39, 0x02, 0x43, 0x02, 0x4D, 0x02, 0x57, 0x00, 0x04, 0x02, 0x38,
+    0x02, 0x42, 0x02, 0x4C, 0x02, 0x56, 0x00, 0x04, 0x02, 0x37, 0x02, 0x41,
+    0x02, 0x4B, 0x02, 0x55, 0x00, 0x04, 0x02, 0x36, 0x02, 0x40, 0x02, 0x4A,
+    0x02, 0x54, 0x00, 0x04, 0x02, 0x35, 0x02, 0x3F, 0x02, 0x49, 0x02, 0x53,
+    0x00, 0x04, 0x02, 0x34, 0x02, 0x3E, 0x02, 0x48, 0x02, 0x52, 0x00, 0x04,
+    0x02, 0x33, 0x02, 0x3D, 0x02, 0x47, 0x02, 0x51, 0x00, 0x04, 0x02, 0x32,
+    0x02, 0x3C, 0x02, 0x46, 0x02, 0x50, 0x00, 0x05, 0x02, 0x30, 0x02, 0x31,
+    0x02, 0x3B, 0x02, 0x45, 0x02, 0x4F, 0x00, 0x02, 0x01, 0xF8, 0x02, 0x20,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0xFE,
+    0x00, 0x7C, 0x02, 0x20, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5,
+    0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
+    0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x02, 0x21,
+    0x00, 0xB6, 0x00, 0xC0, 0x01, 0xF9, 0x01, 0xFA, 0x01, 0xFB, 0x01, 0xFC,
+    0x01, 0xFD, 0x01, 0xFE, 0x01, 0xFF, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02,
+    0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08,
+    0x02, 0x09, 0x02, 0x0A, 0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E,
+    0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14,
+    0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x01, 0x60, 0x02, 0x21,
+    0x01, 0xBC, 0x01, 0xC5, 0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x34,
+    0x02, 0x35, 0x02, 0x36, 0x02, 0x37, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A,
+    0x02, 0x79, 0x02, 0x7B, 0x02, 0x7D, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88,
+    0x02, 0x8F, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94,
+    0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xB6, 0x03, 0x34,
+    0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30,
+    0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31,
+    0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B,
+    0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41,
+    0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02,
+    0x00, 0x1B, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x53, 0x00, 0x65,
+    0x00, 0x01, 0x00, 0x69, 0x00, 0x69, 0x00, 0x14, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x15, 0x00, 0x80, 0x00, 0x80, 0x00, 0x16, 0x00, 0xB4, 0x00, 0xB4,
+    0x00, 0x17, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x18, 0x01, 0x08, 0x01, 0x20,
+    0x00, 0x19, 0x01, 0x4B, 0x01, 0x51, 0x00, 0x32, 0x01, 0x57, 0x01, 0x57,
+    0x00, 0x39, 0x01, 0x86, 0x01, 0x86, 0x00, 0x3A, 0x01, 0xBA, 0x01, 0xBA,
+    0x00, 0x3B, 0x01, 0xC4, 0x01, 0xC4, 0x00, 0x3C, 0x02, 0x45, 0x02, 0x4E,
+    0x00, 0x3D, 0x02, 0x73, 0x02, 0x73, 0x00, 0x47, 0x02, 0x77, 0x02, 0x77,
+    0x00, 0x48, 0x02, 0x7C, 0x02, 0x7C, 0x00, 0x49, 0x02, 0x7E, 0x02, 0x7E,
+    0x00, 0x4A, 0x02, 0x80, 0x02, 0x81, 0x00, 0x4B, 0x02, 0x89, 0x02, 0x8E,
+    0x00, 0x4D, 0x02, 0x9B, 0x02, 0x9E, 0x00, 0x53, 0x02, 0xA6, 0x02, 0xA6,
+    0x00, 0x57, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x58, 0x02, 0xFC, 0x02, 0xFD,
+    0x00, 0x69, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x6B, 0x03, 0x0D, 0x03, 0x0D,
+    0x00, 0x78, 0x03, 0x10, 0x03, 0x12, 0x00, 0x79, 0x02, 0x48, 0x00, 0x28,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4,
+    0x02, 0xB4, 0xFF, 0xF4, 0x02, 0xB4, 0xFF, 0xF4, 0x04, 0x63, 0xFF, 0xF0,
+    0x04, 0x63, 0xFF, 0xF0, 0x02, 0xC5, 0x00, 0x53, 0x02, 0xBD, 0x00, 0x29,
+    0x02, 0xBD, 0x00, 0x29, 0x02, 0xBD, 0x00, 0x29, 0x02, 0xBD, 0x00, 0x29,
+    0x02, 0xBD, 0x00, 0x29, 0x02, 0xBD, 0x00, 0x29, 0x02, 0xBD, 0x00, 0x29,
+    0x03, 0x0F, 0x00, 0x53, 0x05, 0x98, 0x00, 0x53, 0x05, 0x98, 0x00, 0x53,
+    0x03, 0x0F, 0x00, 0x1D, 0x03, 0x0F, 0x00, 0x53, 0x03, 0x0F, 0x00, 0x1D,
+    0x03, 0x0F, 0x00, 0x53, 0x03, 0x0F, 0x00, 0x53, 0x05, 0x52, 0x00, 0x53,
+    0x05, 0x52, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x3E, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53, 0x02, 0x93, 0x00, 0x53,
+    0x02, 0x71, 0x00, 0x53, 0x03, 0x14, 0x00, 0x29, 0x03, 0x14, 0x00, 0x29,
+    0x03, 0x14, 0x00, 0x29, 0x03, 0x14, 0x00, 0x29, 0x03, 0x14, 0x00, 0x29,
+    0x03, 0x14, 0x00, 0x29, 0x03, 0x14, 0x00, 0x29, 0x03, 0x14, 0x00, 0x53,
+    0x03, 0x24, 0x00, 0x18, 0x03, 0x14, 0x00, 0x53, 0x03, 0x14, 0x00, 0x53,
+    0x03, 0x14, 0x00, 0x53, 0x02, 0x4E, 0x00, 0x4A, 0x04, 0xF1, 0x00, 0x4A,
+    0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A,
+    0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x08, 0x02, 0x4E, 0x00, 0x45,
+    0x02, 0x4E, 0x00, 0x45, 0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A,
+    0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A,
+    0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A, 0x02, 0x4E, 0x00, 0x4A,
+    0x02, 0xA3, 0x00, 0x22, 0x02, 0xA3, 0x00, 0x22, 0x02, 0xE6, 0x00, 0x53,
+    0x02, 0xE6, 0x00, 0x53, 0x02, 0x65, 0x00, 0x53, 0x05, 0x08, 0x00, 0x53,
+    0x02, 0x65, 0x00, 0x2D, 0x02, 0x65, 0x00, 0x53, 0x02, 0x65, 0x00, 0x53,
+    0x02, 0x65, 0x00, 0x53, 0x02, 0x65, 0x00, 0x53, 0x03, 0xB7, 0x00, 0x53,
+    0x02, 0x65, 0x00, 0x53, 0x02, 0x6C, 0xFF, 0xE2, 0x03, 0x74, 0x00, 0x53,
+    0x03, 0x74, 0x00, 0x53, 0x03, 0x2D, 0x00, 0x53, 0x05, 0xD0, 0x00, 0x53,
+    0x03, 0x2D, 0x00, 0x53, 0x03, 0x2D, 0x00, 0x53, 0x03, 0x2D, 0x00, 0x53,
+    0x03, 0x2D, 0x00, 0x53, 0x03, 0x2D, 0x00, 0x53, 0x03, 0x26, 0xFF, 0xC8,
+    0x04, 0x7F, 0x00, 0x53, 0x03, 0x2D, 0x00, 0x53, 0x03, 0x2D, 0x00, 0x53,
+    0x03, 0x2D, 0x00, 0x53, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x37, 0x00, 0x29, 0x03, 0x37, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29, 0x03, 0x39, 0x00, 0x29,
+    0x04, 0x4E, 0x00, 0x29, 0x02, 0xA3, 0x00, 0x53, 0x02, 0xA3, 0x00, 0x53,
+    0x03, 0x39, 0x00, 0x29, 0x02, 0xC1, 0x00, 0x53, 0x02, 0xC1, 0x00, 0x53,
+    0x02, 0xC1, 0x00, 0x53, 0x02, 0xC1, 0x00, 0x53, 0x02, 0xC1, 0x00, 0x35,
+    0x02, 0xC1, 0x00, 0x53, 0x02, 0xC1, 0x00, 0x53, 0x02, 0xC1, 0x00, 0x53,
+    0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07,
+    0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07,
+    0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07,
+    0x02, 0x7E, 0x00, 0x07, 0x02, 0x7E, 0x00, 0x07, 0x03, 0x42, 0x00, 0x53,
+    0x02, 0xFF, 0x00, 0x29, 0x02, 0xB3, 0x00, 0x1F, 0x02, 0xB3, 0x00, 0x1F,
+    0x02, 0xB3, 0x00, 0x1F, 0x02, 0xB3, 0x00, 0x1F, 0x02, 0xB3, 0x00, 0x1F,
+    0x02, 0xB3, 0x00, 0x1F, 0x02, 0xB3, 0x00, 0x1F, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51,
+    0x03, 0x09, 0x00, 0x51, 0x03, 0x09, 0x00, 0x51, 0x02, 0xC7, 0xFF, 0xFC,
+    0x03, 0xDF, 0xFF, 0xFC, 0x03, 0xDF, 0xFF, 0xFC, 0x03, 0xDF, 0xFF, 0xFC,
+    0x03, 0xDF, 0xFF, 0xFC, 0x03, 0xDF, 0xFF, 0xFC, 0x02, 0xC9, 0xFF, 0xF3,
+    0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xBE, 0xFF, 0xF1,
+    0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xBE, 0xFF, 0xF1,
+    0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xBE, 0xFF, 0xF1,
+    0x02, 0xBE, 0xFF, 0xF1, 0x02, 0xB6, 0x00, 0x3C, 0x02, 0xB6, 0x00, 0x3C,
+    0x02, 0xB6, 0x00, 0x3C, 0x02, 0xB6, 0x00, 0x3C, 0x02, 0xB6, 0x00, 0x3C,
+    0x04, 0xF1, 0x00, 0x4A, 0x01, 0x6D, 0x00, 0x53, 0x03, 0xAC, 0x00, 0x53,
+    0x01, 0x6D, 0x00, 0x2C, 0x01, 0x6D, 0xFF, 0xFB, 0x01, 0x6D, 0xFF, 0xF8,
+    0x01, 0x6D, 0xFF, 0xF8, 0x01, 0x6D, 0xFF, 0x97, 0x01, 0x6D, 0xFF, 0xD5,
+    0x01, 0x6D, 0xFF, 0xD5, 0x01, 0x6D, 0x00, 0x4B, 0x01, 0x6D, 0x00, 0x48,
+    0x01, 0x6D, 0x00, 0x34, 0x01, 0x6D, 0x00, 0x31, 0x01, 0x6D, 0xFF, 0xFB,
+    0x01, 0x6D, 0xFF, 0xFC, 0x01, 0x6D, 0x00, 0x34, 0x01, 0x6D, 0xFF, 0xF1,
+    0x02, 0x3F, 0x00, 0x19, 0x02, 0x3F, 0x00, 0x19, 0x04, 0xA4, 0x00, 0x53,
+    0x05, 0x6C, 0x00, 0x53, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x1F,
+    0x03, 0x85, 0x00, 0x1F, 0x03, 0x85, 0x00, 0x1F, 0x02, 0x9F, 0x00, 0x46,
+    0x02, 0x26, 0x00, 0x20, 0x02, 0x26, 0x00, 0x20, 0x02, 0x26, 0x00, 0x20,
+    0x02, 0x26, 0x00, 0x20, 0x02, 0x26, 0x00, 0x20, 0x02, 0x26, 0x00, 0x20,
+    0x02, 0x26, 0x00, 0x20, 0x02, 0x97, 0x00, 0x20, 0x02, 0x5F, 0x00, 0x20,
+    0x03, 0x20, 0x00, 0x20, 0x02, 0x97, 0x00, 0x20, 0x02, 0x97, 0x00, 0x20,
+    0x02, 0x97, 0x00, 0x20, 0x04, 0xDB, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x06, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x20,
+    0x02, 0x4A, 0x00, 0x20, 0x02, 0x4A, 0x00, 0x1B, 0x01, 0x89, 0x00, 0x12,
+    0x02, 0xA6, 0x00, 0x20, 0x02, 0xA6, 0x00, 0x20, 0x02, 0xA6, 0x00, 0x20,
+    0x02, 0xA6, 0x00, 0x20, 0x02, 0xA6, 0x00, 0x20, 0x02, 0xA6, 0x00, 0x20,
+    0x02, 0xA6, 0x00, 0x20, 0x02, 0x8D, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x0E,
+    0x02, 0x8D, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46,
+    0x01, 0x52, 0x00, 0x3E, 0x01, 0x36, 0x00, 0x3E, 0x01, 0x36, 0x00, 0x12,
+    0x01, 0x36, 0xFF, 0xE0, 0x01, 0x36, 0xFF, 0xCE, 0x01, 0x36, 0xFF, 0xCC,
+    0x01, 0x36, 0xFF, 0x73, 0x01, 0x36, 0xFF, 0xBA, 0x01, 0x36, 0xFF, 0xBB,
+    0x01, 0x36, 0x00, 0x30, 0x01, 0x52, 0x00, 0x3A, 0x01, 0x36, 0xFF, 0xFE,
+    0x01, 0x36, 0x00, 0x15, 0x01, 0x36, 0xFF, 0xE0, 0x02, 0xA4, 0x00, 0x3E,
+    0x01, 0x36, 0xFF, 0xE8, 0x01, 0x36, 0x00, 0x0E, 0x01, 0x36, 0xFF, 0xDD,
+    0x01, 0x52, 0xFF, 0xD6, 0x01, 0x52, 0xFF, 0xD6, 0x01, 0x52, 0xFF, 0xD6,
+    0x02, 0x8C, 0x00, 0x46, 0x02, 0x8C, 0x00, 0x46, 0x02, 0x97, 0x00, 0x46,
+    0x01, 0x48, 0x00, 0x47, 0x01, 0x48, 0x00, 0x1A, 0x01, 0xD0, 0x00, 0x47,
+    0x01, 0x48, 0x00, 0x3B, 0x01, 0xEC, 0x00, 0x47, 0x01, 0x48, 0x00, 0x36,
+    0x02, 0x8C, 0x00, 0x47, 0x01, 0x48, 0x00, 0x06, 0x01, 0xB1, 0xFF, 0xFF,
+    0x03, 0xD5, 0x00, 0x46, 0x03, 0xD5, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46,
+    0x02, 0x8D, 0x00, 0x46, 0x02, 0xAD, 0xFF, 0x93, 0x02, 0x8D, 0x00, 0x46,
+    0x02, 0x8D, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46,
+    0x02, 0x97, 0xFF, 0xD6, 0x03, 0xE0, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46,
+    0x02, 0x8D, 0x00, 0x46, 0x02, 0x8D, 0x00, 0x46, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x1F, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x8C, 0x00, 0x20,
+    0x02, 0x8C, 0x00, 0x20, 0x03, 0xE4, 0x00, 0x20, 0x02, 0x9F, 0x00, 0x46,
+    0x02, 0x9F, 0x00, 0x46, 0x02, 0x9F, 0x00, 0x20, 0x01, 0xDE, 0x00, 0x46,
+    0x01, 0xDE, 0x00, 0x46, 0x01, 0xDE, 0x00, 0x42, 0x01, 0xDE, 0x00, 0x34,
+    0x01, 0xDE, 0xFF, 0xE7, 0x01, 0xDE, 0x00, 0x2F, 0x01, 0xDE, 0x00, 0x46,
+    0x01, 0xDE, 0xFF, 0xFF, 0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08,
+    0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08,
+    0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08,
+    0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08, 0x01, 0xF6, 0x00, 0x08,
+    0x02, 0x9D, 0x00, 0x12, 0x01, 0x95, 0x00, 0x11, 0x01, 0x95, 0x00, 0x11,
+    0x01, 0x95, 0x00, 0x11, 0x01, 0x95, 0x00, 0x11, 0x01, 0x95, 0x00, 0x11,
+    0x01, 0x95, 0xFF, 0xE7, 0x01, 0x95, 0x00, 0x11, 0x01, 0x95, 0x00, 0x11,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x22,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E, 0x02, 0x92, 0x00, 0x3E,
+    0x02, 0x6C, 0x00, 0x08, 0x03, 0x51, 0x00, 0x08, 0x03, 0x51, 0x00, 0x08,
+    0x03, 0x51, 0x00, 0x08, 0x03, 0x51, 0x00, 0x08, 0x03, 0x51, 0x00, 0x08,
+    0x02, 0x72, 0x00, 0x13, 0x02, 0x7E, 0x00, 0x05, 0x02, 0x7E, 0x00, 0x05,
+    0x02, 0x7E, 0x00, 0x05, 0x02, 0x7E, 0x00, 0x05, 0x02, 0x7E, 0x00, 0x05,
+    0x02, 0x7E, 0x00, 0x05, 0x02, 0x7E, 0x00, 0x05, 0x02, 0x7E, 0x00, 0x05,
+    0x02, 0x7E, 0x00, 0x05, 0x02, 0x7E, 0x00, 0x05, 0x02, 0x44, 0x00, 0x32,
+    0x02, 0x44, 0x00, 0x32, 0x02, 0x44, 0x00, 0x32, 0x02, 0x44, 0x00, 0x32,
+    0x02, 0x44, 0x00, 0x32, 0x02, 0x88, 0x00, 0x12, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0xFF, 0xFB,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21, 0x02, 0x45, 0x00, 0x21,
+    0x02, 0x45, 0x00, 0x21, 0x02, 0x6D, 0x00, 0x26, 0x02, 0x6D, 0x00, 0x26,
+    0x02, 0x6D, 0x00, 0x26, 0x02, 0x6D, 0x00, 0x26, 0x02, 0x6D, 0x00, 0x26,
+    0x02, 0x6D, 0x00, 0x26, 0x02, 0x6D, 0x00, 0x26, 0x03, 0x12, 0x00, 0x12,
+    0x04, 0x64, 0x00, 0x12, 0x05, 0xB6, 0x00, 0x12, 0x04, 0x5A, 0x00, 0x12,
+    0x04, 0x2D, 0x00, 0x12, 0x02, 0xDB, 0x00, 0x12, 0x02, 0xD1, 0x00, 0x12,
+    0x01, 0x92, 0x00, 0x13, 0x01, 0xA5, 0x00, 0x25, 0x02, 0xC7, 0xFF, 0xF5,
+    0x02, 0xEF, 0x00, 0x1D, 0x02, 0x97, 0x00, 0x48, 0x02, 0x94, 0x00, 0x1C,
+    0x02, 0xC1, 0x00, 0x25, 0x02, 0x4D, 0x00, 0x3D, 0x02, 0x24, 0x00, 0x0A,
+    0x02, 0x6B, 0x00, 0x18, 0x02, 0xA9, 0x00, 0x0D, 0x02, 0x61, 0x00, 0x1C,
+    0x02, 0x4D, 0x00, 0x20, 0x02, 0x2E, 0x00, 0x27, 0x02, 0x5F, 0x00, 0x22,
+    0x02, 0x4C, 0x00, 0x1E, 0x02, 0xC1, 0x00, 0x25, 0x01, 0xAF, 0x00, 0x26,
+    0x01, 0x27, 0x00, 0x10, 0x01, 0x75, 0x00, 0x24, 0x01, 0x6A, 0x00, 0x1A,
+    0x01, 0xA1, 0x00, 0x10, 0x01, 0x75, 0x00, 0x19, 0x01, 0x89, 0x00, 0x24,
+    0x01, 0x4C, 0x00, 0x20, 0x01, 0x8E, 0x00, 0x29, 0x01, 0x7F, 0x00, 0x21,
+    0x01, 0xAF, 0x00, 0x26, 0x01, 0x27, 0x00, 0x10, 0x01, 0x75, 0x00, 0x24,
+    0x01, 0x6A, 0x00, 0x1A, 0x01, 0xA1, 0x00, 0x10, 0x01, 0x75, 0x00, 0x19,
+    0x01, 0x89, 0x00, 0x24, 0x01, 0x4C, 0x00, 0x20, 0x01, 0x8E, 0x00, 0x29,
+    0x01, 0x7F, 0x00, 0x21, 0x01, 0xAF, 0x00, 0x26, 0x01, 0x27, 0x00, 0x10,
+    0x01, 0x75, 0x00, 0x24, 0x01, 0x6A, 0x00, 0x1A, 0x01, 0xA1, 0x00, 0x10,
+    0x01, 0x75, 0x00, 0x19, 0x01, 0x89, 0x00, 0x24, 0x01, 0x4C, 0x00, 0x20,
+    0x01, 0x8E, 0x00, 0x29, 0x01, 0x7F, 0x00, 0x21, 0x01, 0xAF, 0x00, 0x26,
+    0x01, 0x27, 0x00, 0x10, 0x01, 0x75, 0x00, 0x24, 0x01, 0x6A, 0x00, 0x1A,
+    0x01, 0xA1, 0x00, 0x10, 0x01, 0x75, 0x00, 0x19, 0x01, 0x89, 0x00, 0x24,
+    0x01, 0x4C, 0x00, 0x20, 0x01, 0x8E, 0x00, 0x29, 0x01, 0x7F, 0x00, 0x21,
+    0x02, 0x5E, 0xFF, 0xF3, 0x03, 0x4E, 0x00, 0x1A, 0x03, 0x41, 0x00, 0x1A,
+    0x03, 0x6C, 0x00, 0x18, 0x03, 0x6D, 0x00, 0x3C, 0x03, 0x65, 0x00, 0x18,
+    0x03, 0x8B, 0x00, 0x1C, 0x03, 0x74, 0x00, 0x3C, 0x01, 0x15, 0x00, 0x00,
+    0x02, 0x26, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+    0x01, 0x52, 0x00, 0x00, 0x01, 0x52, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x29, 0x01, 0x28, 0x00, 0x21,
+    0x01, 0x0E, 0x00, 0x29, 0x01, 0x30, 0x00, 0x29, 0x03, 0x1C, 0x00, 0x29,
+    0x01, 0x57, 0x00, 0x49, 0x01, 0x57, 0x00, 0x48, 0x02, 0x23, 0x00, 0x18,
+    0x02, 0x23, 0x00, 0x18, 0x01, 0x0E, 0x00, 0x29, 0x01, 0x5A, 0x00, 0x25,
+    0x01, 0xD0, 0x00, 0x0C, 0x02, 0xF8, 0x00, 0x37, 0x02, 0x64, 0x00, 0x03,
+    0x02, 0x54, 0x00, 0x08, 0x01, 0x0E, 0x00, 0x29, 0x01, 0x6B, 0x00, 0x2D,
+    0x02, 0x30, 0x00, 0x03, 0x02, 0x20, 0x00, 0x08, 0x00, 0xA8, 0xFF, 0xF7,
+    0x00, 0x00, 0xFF, 0x27, 0x01, 0xD8, 0x00, 0x33, 0x01, 0xE1, 0x00, 0x3B,
+    0x02, 0x77, 0x00, 0x3B, 0x03, 0xC3, 0x00, 0x3B, 0x02, 0x67, 0x00, 0x33,
+    0x03, 0xB2, 0x00, 0x33, 0x01, 0xD8, 0x00, 0x33, 0x02, 0xAD, 0x00, 0x22,
+    0x01, 0xD8, 0x00, 0x33, 0x02, 0x67, 0x00, 0x33, 0x03, 0xB2, 0x00, 0x33,
+    0x01, 0x90, 0x00, 0x28, 0x01, 0x90, 0x00, 0x03, 0x01, 0xB1, 0x00, 0x25,
+    0x01, 0xB1, 0x00, 0x1D, 0x01, 0xAB, 0x00, 0x50, 0x01, 0xAB, 0x00, 0x20,
+    0x01, 0x65, 0x00, 0x28, 0x01, 0x65, 0x00, 0x03, 0x01, 0xB1, 0x00, 0x25,
+    0x01, 0xB1, 0x00, 0x1D, 0x01, 0xAB, 0x00, 0x50, 0x01, 0xAB, 0x00, 0x20,
+    0x01, 0x28, 0x00, 0x21, 0x02, 0x09, 0x00, 0x21, 0x02, 0x14, 0x00, 0x28,
+    0x02, 0x14, 0x00, 0x1C, 0x01, 0x24, 0x00, 0x28, 0x01, 0x24, 0x00, 0x1C,
+    0x02, 0x55, 0x00, 0x0A, 0x02, 0x56, 0x00, 0x24, 0x01, 0x4E, 0x00, 0x0A,
+    0x01, 0x4E, 0x00, 0x24, 0x01, 0xFB, 0x00, 0x30, 0x01, 0x10, 0x00, 0x30,
+    0x02, 0x55, 0x00, 0x0A, 0x02, 0x56, 0x00, 0x24, 0x01, 0x4E, 0x00, 0x0A,
+    0x01, 0x4E, 0x00, 0x24, 0x02, 0x3E, 0xFF, 0xF8, 0x03, 0xC5, 0x00, 0x28,
+    0x03, 0x19, 0x00, 0x32, 0x03, 0x12, 0x00, 0x29, 0x02, 0x4A, 0x00, 0x1A,
+    0x03, 0x19, 0x00, 0x16, 0x01, 0xFB, 0xFF, 0xFD, 0x03, 0x9A, 0x00, 0x26,
+    0x02, 0x14, 0x00, 0x5D, 0x02, 0x14, 0x00, 0x30, 0x01, 0x66, 0x00, 0x5A,
+    0x01, 0x6A, 0x00, 0x5B, 0x01, 0xB8, 0x00, 0x25, 0x02, 0x46, 0x00, 0x0D,
+    0x01, 0xB2, 0x00, 0x25, 0x02, 0xDB, 0x00, 0x41, 0x04, 0xF1, 0x00, 0x53,
+    0x03, 0xC5, 0x00, 0x28, 0x02, 0xBD, 0x00, 0x29, 0x02, 0x3F, 0x00, 0x30,
+    0x02, 0xBD, 0x00, 0x29, 0x02, 0x35, 0x00, 0x12, 0x02, 0x7F, 0x00, 0x12,
+    0x02, 0x3A, 0x00, 0x28, 0x02, 0xB6, 0x00, 0x13, 0x02, 0x71, 0x00, 0x1D,
+    0x03, 0x14, 0x00, 0x29, 0x03, 0x01, 0x00, 0x1E, 0x02, 0x88, 0x00, 0x11,
+    0x02, 0x77, 0x00, 0x0E, 0x03, 0x0C, 0x00, 0x53, 0x03, 0x71, 0x00, 0x12,
+    0x03, 0x0C, 0x00, 0x21, 0x03, 0x05, 0x00, 0x21, 0x02, 0xBD, 0x00, 0x21,
+    0x02, 0x76, 0x00, 0x1C, 0x02, 0x8B, 0x00, 0x11, 0x03, 0xF6, 0xFF, 0xFF,
+    0x02, 0xBE, 0xFF, 0xF1, 0x01, 0x86, 0x00, 0x3A, 0x02, 0x3D, 0xFF, 0xFC,
+    0x02, 0x57, 0x00, 0x31, 0x02, 0x44, 0x00, 0x21, 0x02, 0x2A, 0x00, 0x27,
+    0x02, 0x55, 0x00, 0x28, 0x02, 0x89, 0x00, 0x4B, 0x02, 0x9A, 0x00, 0x43,
+    0x02, 0x0E, 0x00, 0x1C, 0x02, 0x0E, 0x00, 0x26, 0x02, 0x73, 0x00, 0x41,
+    0x02, 0x73, 0x00, 0x41, 0x02, 0x9B, 0x00, 0x4B, 0x02, 0x76, 0x00, 0x3A,
+    0x02, 0x44, 0x00, 0x1C, 0x02, 0x9E, 0x00, 0x26, 0x02, 0x56, 0x00, 0x05,
+    0x03, 0x9D, 0x00, 0x29, 0x02, 0x8C, 0x00, 0x20, 0x02, 0x88, 0xFF, 0xDB,
+    0x02, 0xEF, 0x00, 0x1D, 0x02, 0xC7, 0xFF, 0xF5, 0x02, 0xF3, 0x00, 0x26,
+    0x02, 0x0B, 0x00, 0x13, 0x02, 0xFB, 0x00, 0x07, 0x02, 0x97, 0x00, 0x48,
+    0x02, 0x6B, 0x00, 0x20, 0x04, 0x02, 0x00, 0x28, 0x05, 0x8E, 0x00, 0x28,
+    0x02, 0xA6, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x72,
+    0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x2D,
+    0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x4A,
+    0x01, 0xF4, 0x00, 0x1A, 0x01, 0xF4, 0x00, 0x8F, 0x01, 0xF4, 0x00, 0x72,
+    0x01, 0xF4, 0x00, 0x72, 0x01, 0xF4, 0x00, 0x0F, 0x01, 0xF4, 0x00, 0x2B,
+    0x01, 0xF4, 0x00, 0x2D, 0x01, 0x92, 0x00, 0x3F, 0x01, 0xF4, 0x00, 0x7C,
+    0x01, 0xF4, 0x00, 0x3C, 0x01, 0xA8, 0x00, 0x47, 0x01, 0xF4, 0x00, 0x8A,
+    0x01, 0xF4, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x3F,
+    0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x8A,
+    0x00, 0x00, 0x00, 0x7C, 0x01, 0x10, 0x00, 0x30, 0x01, 0x24, 0x00, 0x28,
+    0x00, 0xDB, 0x00, 0x2B, 0x00, 0xDB, 0x00, 0x30, 0x01, 0x07, 0x00, 0x3D,
+    0x00, 0xE7, 0x00, 0x43, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x9C, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x4D, 0x00, 0x00, 0x00, 0x24, 0x00, 0xC9, 0x01, 0x02, 0x01, 0x03,
+    0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x00, 0xC7,
+    0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E,
+    0x00, 0x62, 0x01, 0x0F, 0x00, 0xAD, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12,
+    0x01, 0x13, 0x00, 0x63, 0x01, 0x14, 0x00, 0xAE, 0x00, 0x90, 0x01, 0x15,
+    0x00, 0x25, 0x00, 0x26, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x64, 0x01, 0x16,
+    0x01, 0x17, 0x01, 0x18, 0x00, 0x27, 0x01, 0x19, 0x01, 0x1A, 0x00, 0xE9,
+    0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x20,
+    0x00, 0x28, 0x00, 0x65, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x00, 0xC8,
+    0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29,
+    0x00, 0xCA, 0x01, 0x2A, 0x01, 0x2B, 0x00, 0xCB, 0x01, 0x2C, 0x01, 0x2D,
+    0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x00, 0x29,
+    0x00, 0x2A, 0x00, 0xF8, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36,
+    0x01, 0x37, 0x00, 0x2B, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3A, 0x01, 0x3B,
+    0x00, 0x2C, 0x01, 0x3C, 0x00, 0xCC, 0x01, 0x3D, 0x01, 0x3E, 0x00, 0xCD,
+    0x01, 0x3F, 0x00, 0xCE, 0x01, 0x40, 0x00, 0xFA, 0x01, 0x41, 0x00, 0xCF,
+    0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x00, 0x2D,
+    0x01, 0x47, 0x00, 0x2E, 0x01, 0x48, 0x00, 0x2F, 0x01, 0x49, 0x01, 0x4A,
+    0x01, 0x4B, 0x01, 0x4C, 0x01, 0x4D, 0x01, 0x4E, 0x01, 0x4F, 0x01, 0x50,
+    0x00, 0xE2, 0x00, 0x30, 0x01, 0x51, 0x00, 0x31, 0x01, 0x52, 0x01, 0x53,
+    0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59,
+    0x01, 0x5A, 0x00, 0x66, 0x01, 0x5B, 0x00, 0x32, 0x00, 0xD0, 0x01, 0x5C,
+    0x01, 0x5D, 0x00, 0xD1, 0x01, 0x5E, 0x01, 0x5F, 0x01, 0x60, 0x01, 0x61,
+    0x01, 0x62, 0x01, 0x63, 0x00, 0x67, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66,
+    0x00, 0xD3, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6A, 0x01, 0x6B,
+    0x01, 0x6C, 0x01, 0x6D, 0x01, 0x6E, 0x01, 0x6F, 0x01, 0x70, 0x01, 0x71,
+    0x01, 0x72, 0x01, 0x73, 0x00, 0x91, 0x01, 0x74, 0x00, 0xAF, 0x01, 0x75,
+    0x01, 0x76, 0x01, 0x77, 0x00, 0xB0, 0x00, 0x33, 0x00, 0xED, 0x00, 0x34,
+    0x00, 0x35, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7A, 0x01, 0x7B, 0x01, 0x7C,
+    0x01, 0x7D, 0x01, 0x7E, 0x00, 0x36, 0x01, 0x7F, 0x01, 0x80, 0x00, 0xE4,
+    0x01, 0x81, 0x00, 0xFB, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85,
+    0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x00, 0x37, 0x01, 0x89, 0x01, 0x8A,
+    0x01, 0x8B, 0x01, 0x8C, 0x01, 0x8D, 0x01, 0x8E, 0x00, 0x38, 0x00, 0xD4,
+    0x01, 0x8F, 0x01, 0x90, 0x00, 0xD5, 0x01, 0x91, 0x00, 0x68, 0x01, 0x92,
+    0x00, 0xD6, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97,
+    0x01, 0x98, 0x01, 0x99, 0x01, 0x9A, 0x01, 0x9B, 0x01, 0x9C, 0x01, 0x9D,
+    0x01, 0x9E, 0x01, 0x9F, 0x01, 0xA0, 0x01, 0xA1, 0x00, 0x39, 0x00, 0x3A,
+    0x01, 0xA2, 0x01, 0xA3, 0x01, 0xA4, 0x01, 0xA5, 0x00, 0x3B, 0x00, 0x3C,
+    0x00, 0xEB, 0x01, 0xA6, 0x00, 0xBB, 0x01, 0xA7, 0x01, 0xA8, 0x01, 0xA9,
+    0x01, 0xAA, 0x01, 0xAB, 0x01, 0xAC, 0x00, 0x3D, 0x01, 0xAD, 0x00, 0xE6,
+    0x01, 0xAE, 0x01, 0xAF, 0x01, 0xB0, 0x01, 0xB1, 0x01, 0xB2, 0x01, 0xB3,
+    0x01, 0xB4, 0x01, 0xB5, 0x01, 0xB6, 0x01, 0xB7, 0x01, 0xB8, 0x01, 0xB9,
+    0x01, 0xBA, 0x01, 0xBB, 0x01, 0xBC, 0x01, 0xBD, 0x01, 0xBE, 0x01, 0xBF,
+    0x01, 0xC0, 0x01, 0xC1, 0x01, 0xC2, 0x01, 0xC3, 0x01, 0xC4, 0x01, 0xC5,
+    0x00, 0x44, 0x00, 0x69, 0x01, 0xC6, 0x01, 0xC7, 0x01, 0xC8, 0x01, 0xC9,
+    0x01, 0xCA, 0x01, 0xCB, 0x01, 0xCC, 0x00, 0x6B, 0x01, 0xCD, 0x01, 0xCE,
+    0x01, 0xCF, 0x01, 0xD0, 0x01, 0xD1, 0x01, 0xD2, 0x00, 0x6C, 0x01, 0xD3,
+    0x00, 0x6A, 0x01, 0xD4, 0x01, 0xD5, 0x01, 0xD6, 0x01, 0xD7, 0x00, 0x6E,
+    0x01, 0xD8, 0x00, 0x6D, 0x00, 0xA0, 0x01, 0xD9, 0x00, 0x45, 0x00, 0x46,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x6F, 0x01, 0xDA, 0x01, 0xDB, 0x01, 0xDC,
+    0x00, 0x47, 0x00, 0xEA, 0x01, 0xDD, 0x01, 0x01, 0x01, 0xDE, 0x01, 0xDF,
+    0x01, 0xE0, 0x00, 0x48, 0x00, 0x70, 0x01, 0xE1, 0x01, 0xE2, 0x01, 0xE3,
+    0x00, 0x72, 0x01, 0xE4, 0x01, 0xE5, 0x01, 0xE6, 0x01, 0xE7, 0x01, 0xE8,
+    0x01, 0xE9, 0x00, 0x73, 0x01, 0xEA, 0x01, 0xEB, 0x00, 0x71, 0x01, 0xEC,
+    0x01, 0xED, 0x01, 0xEE, 0x01, 0xEF, 0x01, 0xF0, 0x01, 0xF1, 0x01, 0xF2,
+    0x01, 0xF3, 0x00, 0x49, 0x00, 0x4A, 0x00, 0xF9, 0x01, 0xF4, 0x01, 0xF5,
+    0x01, 0xF6, 0x01, 0xF7, 0x01, 0xF8, 0x00, 0x4B, 0x01, 0xF9, 0x01, 0xFA,
+    0x01, 0xFB, 0x01, 0xFC, 0x00, 0x4C, 0x00, 0xD7, 0x00, 0x74, 0x01, 0xFD,
+    0x01, 0xFE, 0x00, 0x76, 0x01, 0xFF, 0x00, 0x77, 0x02, 0x00, 0x02, 0x01,
+    0x02, 0x02, 0x00, 0x75, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+    0x02, 0x07, 0x02, 0x08, 0x00, 0x4D, 0x02, 0x09, 0x02, 0x0A, 0x00, 0x4E,
+    0x02, 0x0B, 0x02, 0x0C, 0x00, 0x4F, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F,
+    0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x00, 0xE3, 0x00, 0x50,
+    0x02, 0x14, 0x00, 0x51, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18,
+    0x02, 0x19, 0x02, 0x1A, 0x02, 0x1B, 0x02, 0x1C, 0x02, 0x1D, 0x00, 0x78,
+    0x02, 0x1E, 0x00, 0x52, 0x00, 0x79, 0x02, 0x1F, 0x02, 0x20, 0x00, 0x7B,
+    0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26,
+    0x00, 0x7C, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x00, 0x7A, 0x02, 0x2A,
+    0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x02, 0x30,
+    0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36,
+    0x00, 0xA1, 0x02, 0x37, 0x00, 0x7D, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A,
+    0x00, 0xB1, 0x00, 0x53, 0x00, 0xEE, 0x00, 0x54, 0x00, 0x55, 0x02, 0x3B,
+    0x02, 0x3C, 0x02, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x02, 0x41,
+    0x00, 0x56, 0x02, 0x42, 0x02, 0x43, 0x00, 0xE5, 0x02, 0x44, 0x00, 0xFC,
+    0x02, 0x45, 0x02, 0x46, 0x02, 0x47, 0x02, 0x48, 0x02, 0x49, 0x00, 0x89,
+    0x00, 0x57, 0x02, 0x4A, 0x02, 0x4B, 0x02, 0x4C, 0x02, 0x4D, 0x02, 0x4E,
+    0x02, 0x4F, 0x02, 0x50, 0x00, 0x58, 0x00, 0x7E, 0x02, 0x51, 0x02, 0x52,
+    0x00, 0x80, 0x02, 0x53, 0x00, 0x81, 0x02, 0x54, 0x00, 0x7F, 0x02, 0x55,
+    0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59, 0x02, 0x5A, 0x02, 0x5B,
+    0x02, 0x5C, 0x02, 0x5D, 0x02, 0x5E, 0x02, 0x5F, 0x02, 0x60, 0x02, 0x61,
+    0x02, 0x62, 0x02, 0x63, 0x00, 0x59, 0x00, 0x5A, 0x02, 0x64, 0x02, 0x65,
+    0x02, 0x66, 0x02, 0x67, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0xEC, 0x02, 0x68,
+    0x00, 0xBA, 0x02, 0x69, 0x02, 0x6A, 0x02, 0x6B, 0x02, 0x6C, 0x02, 0x6D,
+    0x02, 0x6E, 0x00, 0x5D, 0x02, 0x6F, 0x00, 0xE7, 0x02, 0x70, 0x02, 0x71,
+    0x02, 0x72, 0x02, 0x73, 0x02, 0x74, 0x02, 0x75, 0x02, 0x76, 0x02, 0x77,
+    0x02, 0x78, 0x02, 0x79, 0x02, 0x7A, 0x02, 0x7B, 0x02, 0x7C, 0x02, 0x7D,
+    0x02, 0x7E, 0x02, 0x7F, 0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x02, 0x83,
+    0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89,
+    0x02, 0x8A, 0x02, 0x8B, 0x02, 0x8C, 0x02, 0x8D, 0x02, 0x8E, 0x02, 0x8F,
+    0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95,
+    0x02, 0x96, 0x02, 0x97, 0x02, 0x98, 0x00, 0xC0, 0x00, 0xC1, 0x00, 0x9D,
+    0x00, 0x9E, 0x02, 0x99, 0x02, 0x9A, 0x02, 0x9B, 0x00, 0x9B, 0x00, 0x13,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
+    0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E,
+    0x02, 0x9F, 0x02, 0xA0, 0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4,
+    0x02, 0xA5, 0x02, 0xA6, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA9, 0x02, 0xAA,
+    0x02, 0xAB, 0x02, 0xAC, 0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xB0,
+    0x02, 0xB1, 0x02, 0xB2, 0x02, 0xB3, 0x02, 0xB4, 0x02, 0xB5, 0x02, 0xB6,
+    0x02, 0xB7, 0x02, 0xB8, 0x02, 0xB9, 0x02, 0xBA, 0x02, 0xBB, 0x02, 0xBC,
+    0x02, 0xBD, 0x02, 0xBE, 0x02, 0xBF, 0x02, 0xC0, 0x02, 0xC1, 0x02, 0xC2,
+    0x02, 0xC3, 0x02, 0xC4, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6,
+    0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA,
+    0x02, 0xCB, 0x02, 0xCC, 0x00, 0x03, 0x02, 0xCD, 0x02, 0xCE, 0x02, 0xCF,
+    0x00, 0x11, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0xAB, 0x00, 0x04,
+    0x00, 0xA3, 0x00, 0x22, 0x00, 0xA2, 0x00, 0xC3, 0x00, 0x87, 0x00, 0x0D,
+    0x00, 0x06, 0x00, 0x12, 0x00, 0x3F, 0x02, 0xD0, 0x02, 0xD1, 0x02, 0xD2,
+    0x02, 0xD3, 0x02, 0xD4, 0x02, 0xD5, 0x00, 0x10, 0x02, 0xD6, 0x00, 0xB2,
+    0x00, 0xB3, 0x02, 0xD7, 0x02, 0xD8, 0x02, 0xD9, 0x00, 0x42, 0x02, 0xDA,
+    0x02, 0xDB, 0x02, 0xDC, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x5E, 0x00, 0x60,
+    0x00, 0x3E, 0x00, 0x40, 0x02, 0xDD, 0x02, 0xDE, 0x02, 0xDF, 0x02, 0xE0,
+    0x02, 0xE1, 0x02, 0xE2, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xB4, 0x00, 0xB5,
+    0x00, 0xB6, 0x00, 0xB7, 0x00, 0xA9, 0x00, 0xAA, 0x00, 0xBE, 0x00, 0xBF,
+    0x00, 0x05, 0x00, 0x0A, 0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6,
+    0x00, 0xA6, 0x00, 0x23, 0x00, 0x09, 0x00, 0x88, 0x00, 0x86, 0x00, 0x8B,
+    0x00, 0x8A, 0x00, 0x8C, 0x00, 0x83, 0x02, 0xE7, 0x00, 0x5F, 0x00, 0xE8,
+    0x00, 0x82, 0x02, 0xE8, 0x00, 0xC2, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB,
+    0x02, 0xEC, 0x00, 0x84, 0x02, 0xED, 0x00, 0xBD, 0x00, 0x07, 0x02, 0xEE,
+    0x02, 0xEF, 0x00, 0xF7, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3,
+    0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x00, 0x85, 0x02, 0xFA, 0x00, 0x96, 0x02, 0xFB, 0x02, 0xFC, 0x00, 0x0E,
+    0x00, 0xEF, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x20, 0x00, 0x8F, 0x00, 0x21,
+    0x00, 0x1F, 0x00, 0x95, 0x00, 0x94, 0x00, 0x93, 0x00, 0xA7, 0x00, 0x61,
+    0x00, 0xA4, 0x00, 0x41, 0x00, 0x92, 0x02, 0xFD, 0x00, 0x9C, 0x02, 0xFE,
+    0x02, 0xFF, 0x00, 0x9A, 0x00, 0x99, 0x00, 0xA5, 0x03, 0x00, 0x00, 0x98,
+    0x00, 0x08, 0x00, 0xC6, 0x00, 0xB9, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09,
+    0x03, 0x0A, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x03, 0x0F,
+    0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15,
+    0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x03, 0x1B,
+    0x03, 0x1C, 0x03, 0x1D, 0x03, 0x1E, 0x03, 0x1F, 0x03, 0x20, 0x03, 0x21,
+    0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x00, 0x8E,
+    0x00, 0xDC, 0x00, 0x43, 0x00, 0x8D, 0x00, 0xDF, 0x00, 0xD8, 0x00, 0xE1,
+    0x00, 0xDB, 0x00, 0xDD, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDE, 0x00, 0xE0,
+    0x03, 0x2D, 0x03, 0x2E, 0x03, 0x2F, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32,
+    0x03, 0x33, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36, 0x03, 0x37, 0x03, 0x38,
+    0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E,
+    0x03, 0x3F, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44,
+    0x03, 0x45, 0x03, 0x46, 0x03, 0x47, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4A,
+    0x03, 0x4B, 0x03, 0x4C, 0x03, 0x4D, 0x03, 0x4E, 0x03, 0x4F, 0x03, 0x50,
+    0x03, 0x51, 0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56,
+    0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x36, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x34, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x43, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x41, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x32, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x32, 0x07, 0x41, 0x6D, 0x61, 0x63,
+    0x72, 0x6F, 0x6E, 0x07, 0x41, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x0A,
+    0x41, 0x72, 0x69, 0x6E, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x41,
+    0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x30, 0x38, 0x0B, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C,
+    0x65, 0x78, 0x0A, 0x43, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E,
+    0x74, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x46, 0x31, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x43, 0x34, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6F, 0x6E,
+    0x06, 0x44, 0x63, 0x72, 0x6F, 0x61, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x30, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x46, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x35, 0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x45,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31,
+    0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x32, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x34, 0x0A, 0x45, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x36,
+    0x07, 0x45, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x31, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x34,
+    0x07, 0x45, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x43, 0x06, 0x47, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x0B,
+    0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x32, 0x32, 0x0A, 0x47, 0x64, 0x6F, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x32, 0x30, 0x04, 0x48, 0x62, 0x61, 0x72, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x32, 0x41, 0x0B, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66,
+    0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x34, 0x02,
+    0x49, 0x4A, 0x06, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x43, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x38, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x41, 0x07, 0x49, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x49, 0x6F, 0x67, 0x6F, 0x6E, 0x65,
+    0x6B, 0x06, 0x49, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x0B, 0x4A, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x33, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x37,
+    0x06, 0x4C, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x4C, 0x63, 0x61, 0x72,
+    0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x33, 0x42, 0x04, 0x4C,
+    0x64, 0x6F, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x36, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x33, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x32, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x41, 0x06, 0x4E, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x06, 0x4E, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x34, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34,
+    0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x36, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x39, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43,
+    0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x38, 0x03, 0x45, 0x6E,
+    0x67, 0x06, 0x4F, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x44, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x30,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x38, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x36, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x30, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x41,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x30, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x43, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x45,
+    0x05, 0x4F, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x44, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x30, 0x0D, 0x4F,
+    0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x45, 0x07, 0x4F, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x32,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x30, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x45, 0x41, 0x0B, 0x4F, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x43,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x45, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x32, 0x43, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x52, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x35, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x30, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x35, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x31, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x45, 0x06, 0x53,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x36, 0x0B, 0x53, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x31, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x32, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x39,
+    0x45, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x38, 0x46, 0x04, 0x54, 0x62,
+    0x61, 0x72, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x36, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31,
+    0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x43, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x45, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x33, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x31, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x36, 0x05, 0x55, 0x68, 0x6F,
+    0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x38, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x46, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x43, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x45, 0x0D, 0x55, 0x68, 0x75, 0x6E, 0x67,
+    0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x31, 0x36, 0x07, 0x55, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37, 0x41, 0x07, 0x55, 0x6F, 0x67,
+    0x6F, 0x6E, 0x65, 0x6B, 0x05, 0x55, 0x72, 0x69, 0x6E, 0x67, 0x06, 0x55,
+    0x74, 0x69, 0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37,
+    0x38, 0x06, 0x57, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0B, 0x57, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x09, 0x57, 0x64, 0x69,
+    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76,
+    0x65, 0x0B, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65,
+    0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x38, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x46, 0x34, 0x06, 0x59, 0x67, 0x72, 0x61, 0x76, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x36, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x33, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x38,
+    0x06, 0x5A, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0A, 0x5A, 0x64, 0x6F, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x39, 0x32, 0x10, 0x49, 0x61, 0x63, 0x75, 0x74, 0x65, 0x5F, 0x4A, 0x2E,
+    0x6C, 0x6F, 0x63, 0x6C, 0x4E, 0x4C, 0x44, 0x06, 0x49, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x07, 0x49, 0x4A, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49,
+    0x62, 0x72, 0x65, 0x76, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x43, 0x46, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x10,
+    0x49, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x38,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0E, 0x49, 0x64, 0x69, 0x65, 0x72, 0x65,
+    0x73, 0x69, 0x73, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x32, 0x45, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F, 0x49, 0x64,
+    0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x41, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0B, 0x49, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x38, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x41, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x49, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x49, 0x6F, 0x67, 0x6F, 0x6E, 0x65,
+    0x6B, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49, 0x74, 0x69, 0x6C, 0x64,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x4A, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x10, 0x4A, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65,
+    0x78, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x43, 0x37, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x41, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x61, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x46, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x33, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x35, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x39, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x31, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x33, 0x07, 0x61, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07,
+    0x61, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x0A, 0x61, 0x72, 0x69, 0x6E,
+    0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x61, 0x65, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x39, 0x0B, 0x63,
+    0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x0A, 0x63,
+    0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x06, 0x64, 0x63,
+    0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x44,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x46, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x43, 0x36, 0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06,
+    0x65, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x31, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x46, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x43, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x43, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x33, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x43, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x30, 0x35, 0x0A, 0x65, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E,
+    0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x39, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x37, 0x07, 0x65, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x31, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31,
+    0x35, 0x07, 0x65, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x35,
+    0x39, 0x06, 0x67, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x0B, 0x67, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x32, 0x33, 0x0A, 0x67, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63,
+    0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x31, 0x04,
+    0x68, 0x62, 0x61, 0x72, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x42,
+    0x0B, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x35, 0x06, 0x69, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x30, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x32, 0x46, 0x09, 0x69, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x54, 0x52,
+    0x4B, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x42, 0x02, 0x69, 0x6A, 0x07, 0x69, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x69, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x06, 0x69, 0x74, 0x69,
+    0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x37, 0x0B,
+    0x6A, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x33, 0x37, 0x0C, 0x6B, 0x67, 0x72, 0x65,
+    0x65, 0x6E, 0x6C, 0x61, 0x6E, 0x64, 0x69, 0x63, 0x06, 0x6C, 0x61, 0x63,
+    0x75, 0x74, 0x65, 0x06, 0x6C, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x33, 0x43, 0x04, 0x6C, 0x64, 0x6F, 0x74, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x42, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x33, 0x06, 0x6E, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x0B, 0x6E, 0x61, 0x70, 0x6F, 0x73, 0x74, 0x72, 0x6F, 0x70,
+    0x68, 0x65, 0x06, 0x6E, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x34, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x37, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x37, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43,
+    0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x39, 0x03, 0x65, 0x6E,
+    0x67, 0x06, 0x6F, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x44, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x31,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x39, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x35,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x37, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x30, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x42,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x31, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x43, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x46,
+    0x05, 0x6F, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x33, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x44, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x31, 0x0D, 0x6F,
+    0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x46, 0x07, 0x6F, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x33,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x31, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x45, 0x42, 0x0B, 0x6F, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x44,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x46, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x32, 0x44, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x72, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x35, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x31, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x35, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x31, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x46, 0x06, 0x73,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x37, 0x0B, 0x73, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x31, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x33, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x39, 0x04, 0x74, 0x62, 0x61, 0x72, 0x06, 0x74,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x36,
+    0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x39, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x46, 0x06, 0x75, 0x62,
+    0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x35, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x45, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x37,
+    0x05, 0x75, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x31, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x46, 0x0D, 0x75,
+    0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x37, 0x07, 0x75, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37, 0x42,
+    0x07, 0x75, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x05, 0x75, 0x72, 0x69,
+    0x6E, 0x67, 0x06, 0x75, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x37, 0x39, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x0B, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78,
+    0x09, 0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x77,
+    0x67, 0x72, 0x61, 0x76, 0x65, 0x0B, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x38,
+    0x46, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x35, 0x06, 0x79, 0x67,
+    0x72, 0x61, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x37,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x33, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x46, 0x39, 0x06, 0x7A, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0A,
+    0x7A, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x39, 0x33, 0x10, 0x69, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x5F, 0x6A, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x4E, 0x4C, 0x44, 0x06,
+    0x61, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61, 0x62, 0x72, 0x65, 0x76,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x41, 0x46, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x37, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x33, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x42, 0x35, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x45, 0x2E, 0x73, 0x73, 0x30, 0x31,
+    0x10, 0x61, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41,
+    0x35, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x41, 0x44, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x37, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x41, 0x39, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x41, 0x42, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x32, 0x30, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0E,
+    0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x31, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0B, 0x61, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x33, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x33,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x61, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+    0x6E, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x61, 0x6F, 0x67, 0x6F, 0x6E,
+    0x65, 0x6B, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0A, 0x61, 0x72, 0x69, 0x6E,
+    0x67, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F, 0x61, 0x72, 0x69, 0x6E, 0x67,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61,
+    0x74, 0x69, 0x6C, 0x64, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x67,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x67, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x67, 0x63, 0x61, 0x72, 0x6F, 0x6E,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x10, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x32, 0x33, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F,
+    0x67, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x31, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x03, 0x66, 0x5F, 0x66, 0x05, 0x66, 0x5F, 0x66,
+    0x5F, 0x69, 0x06, 0x66, 0x5F, 0x66, 0x5F, 0x69, 0x6A, 0x05, 0x66, 0x5F,
+    0x66, 0x5F, 0x6C, 0x04, 0x66, 0x5F, 0x69, 0x6A, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x39, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x41, 0x39,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x42, 0x43, 0x09, 0x7A, 0x65, 0x72,
+    0x6F, 0x2E, 0x7A, 0x65, 0x72, 0x6F, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E,
+    0x64, 0x6E, 0x6F, 0x6D, 0x08, 0x6F, 0x6E, 0x65, 0x2E, 0x64, 0x6E, 0x6F,
+    0x6D, 0x08, 0x74, 0x77, 0x6F, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x0A, 0x74,
+    0x68, 0x72, 0x65, 0x65, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x09, 0x66, 0x6F,
+    0x75, 0x72, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x09, 0x66, 0x69, 0x76, 0x65,
+    0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x08, 0x73, 0x69, 0x78, 0x2E, 0x64, 0x6E,
+    0x6F, 0x6D, 0x0A, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0x64, 0x6E, 0x6F,
+    0x6D, 0x0A, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x64, 0x6E, 0x6F, 0x6D,
+    0x09, 0x6E, 0x69, 0x6E, 0x65, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x35, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x38, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x39, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E,
+    0x6E, 0x75, 0x6D, 0x72, 0x08, 0x6F, 0x6E, 0x65, 0x2E, 0x6E, 0x75, 0x6D,
+    0x72, 0x08, 0x74, 0x77, 0x6F, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x0A, 0x74,
+    0x68, 0x72, 0x65, 0x65, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x09, 0x66, 0x6F,
+    0x75, 0x72, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x09, 0x66, 0x69, 0x76, 0x65,
+    0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x08, 0x73, 0x69, 0x78, 0x2E, 0x6E, 0x75,
+    0x6D, 0x72, 0x0A, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0x6E, 0x75, 0x6D,
+    0x72, 0x0A, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x6E, 0x75, 0x6D, 0x72,
+    0x09, 0x6E, 0x69, 0x6E, 0x65, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30,
+    0x42, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x37, 0x35, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x37, 0x38, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x39, 0x09, 0x6F, 0x6E, 0x65, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x68, 0x0C, 0x74, 0x68, 0x72, 0x65, 0x65, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x68, 0x73, 0x0B, 0x66, 0x69, 0x76, 0x65, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x68, 0x73, 0x0C, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x02, 0x43, 0x52, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30,
+    0x41, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30, 0x38, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x30, 0x41, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30, 0x42, 0x13, 0x70, 0x65,
+    0x72, 0x69, 0x6F, 0x64, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x62, 0x75, 0x6C, 0x6C, 0x65, 0x74,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0A, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x0E, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x6C, 0x61,
+    0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x16, 0x70, 0x65, 0x72, 0x69,
+    0x6F, 0x64, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x6C,
+    0x6F, 0x63, 0x6C, 0x43, 0x41, 0x54, 0x1B, 0x70, 0x65, 0x72, 0x69, 0x6F,
+    0x64, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x6C, 0x6F,
+    0x63, 0x6C, 0x43, 0x41, 0x54, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x41, 0x44, 0x0A, 0x66, 0x69, 0x67, 0x75, 0x72,
+    0x65, 0x64, 0x61, 0x73, 0x68, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x31,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x31, 0x30, 0x0B, 0x68, 0x79,
+    0x70, 0x68, 0x65, 0x6E, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x65, 0x6E,
+    0x64, 0x61, 0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x65, 0x6D,
+    0x64, 0x61, 0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x6C, 0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x0E, 0x62, 0x72, 0x61, 0x63, 0x65, 0x6C, 0x65,
+    0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0F, 0x62, 0x72, 0x61, 0x63,
+    0x65, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x6C, 0x65, 0x66, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x11, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74,
+    0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x12, 0x67,
+    0x75, 0x69, 0x6C, 0x6C, 0x65, 0x6D, 0x6F, 0x74, 0x6C, 0x65, 0x66, 0x74,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x13, 0x67, 0x75, 0x69, 0x6C, 0x6C, 0x65,
+    0x6D, 0x6F, 0x74, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x12, 0x67, 0x75, 0x69, 0x6C, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x6C,
+    0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x13, 0x67, 0x75, 0x69,
+    0x6C, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x06, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x07,
+    0x75, 0x6E, 0x69, 0x32, 0x31, 0x31, 0x33, 0x09, 0x65, 0x73, 0x74, 0x69,
+    0x6D, 0x61, 0x74, 0x65, 0x64, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x31, 0x31,
+    0x36, 0x07, 0x61, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x42, 0x35, 0x0D, 0x63, 0x6F, 0x6C, 0x6F, 0x6E, 0x6D,
+    0x6F, 0x6E, 0x65, 0x74, 0x61, 0x72, 0x79, 0x04, 0x64, 0x6F, 0x6E, 0x67,
+    0x04, 0x45, 0x75, 0x72, 0x6F, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42,
+    0x32, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x41, 0x44, 0x04, 0x6C, 0x69,
+    0x72, 0x61, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42, 0x41, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x42, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x41, 0x36, 0x06, 0x70, 0x65, 0x73, 0x65, 0x74, 0x61, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x42, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42,
+    0x44, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42, 0x39, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x41, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x31,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x31, 0x35, 0x08, 0x65, 0x6D,
+    0x70, 0x74, 0x79, 0x73, 0x65, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x31,
+    0x32, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x30, 0x36, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x42, 0x35, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x39, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x33, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x39, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x38, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33,
+    0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33,
+    0x30, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x0B, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x30, 0x33, 0x30, 0x34, 0x09, 0x67,
+    0x72, 0x61, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x09, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x31, 0x30, 0x33, 0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x42, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x43, 0x2E, 0x61,
+    0x6C, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x43, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x43, 0x30, 0x33, 0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x41, 0x09, 0x74,
+    0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x38, 0x13, 0x74, 0x69, 0x6C,
+    0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x5F, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33,
+    0x30, 0x33, 0x30, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x38,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x30,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x31,
+    0x0D, 0x68, 0x6F, 0x6F, 0x6B, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x46, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x31, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x31, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x31, 0x42, 0x0C, 0x64,
+    0x6F, 0x74, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x63, 0x6F, 0x6D, 0x62, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x32, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x37, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x32, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x33, 0x31, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x33, 0x35, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x38, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30,
+    0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x37, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x37, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0E, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x0E, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D,
+    0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x31, 0x30, 0x33, 0x30, 0x37, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x42, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30,
+    0x30, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x33, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x39, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x43, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x30, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36,
+    0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x33, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33,
+    0x30, 0x39, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x41, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E, 0x74, 0x69, 0x6C,
+    0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x38, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x18, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x5F, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30,
+    0x33, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x38, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34,
+    0x30, 0x33, 0x30, 0x30, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x12, 0x68, 0x6F, 0x6F, 0x6B, 0x61, 0x62, 0x6F, 0x76, 0x65,
+    0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x46, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x31, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x31, 0x42, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x36, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x37, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x38, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x43, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x42, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x43, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x43, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x28,
+    0x00, 0x54, 0x00, 0x02, 0x44, 0x46, 0x4C, 0x54, 0x00, 0x0E, 0x6C, 0x61,
+    0x74, 0x6E, 0x00, 0x0E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x6B, 0x65,
+    0x72, 0x6E, 0x00, 0x26, 0x6D, 0x61, 0x72, 0x6B, 0x00, 0x1E, 0x6D, 0x6B,
+    0x6D, 0x6B, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x25, 0x56, 0x05, 0x84, 0x03, 0x40,
+    0x02, 0xBE, 0x00, 0x48, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x0A, 0x00, 0x02, 0x00, 0x01, 0x00, 0x28, 0x00, 0x28, 0x00, 0x01,
+    0x00, 0x1E, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x01,
+    0x01, 0x82, 0x02, 0x9A, 0x00, 0x01, 0x01, 0x82, 0x02, 0xAB, 0x00, 0x02,
+    0x00, 0x00, 0x24, 0xCE, 0x00, 0x00, 0x24, 0x74, 0x00, 0x01, 0x00, 0x02,
+    0x03, 0x0D, 0x03, 0x43, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0A,
+    0x00, 0x01, 0x00, 0x01, 0x02, 0x56, 0x02, 0x56, 0x00, 0x01, 0x01, 0x4C,
+    0x00, 0x0C, 0x00, 0x42, 0x01, 0x3A, 0x01, 0x3A, 0x01, 0x3A, 0x01, 0x34,
+    0x01, 0x2E, 0x01, 0x28, 0x01, 0x22, 0x01, 0x34, 0x01, 0x1C, 0x01, 0x3A,
+    0x01, 0x16, 0x01, 0x10, 0x01, 0x16, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x04,
+    0x01, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x3A, 0x01, 0x0A, 0x00, 0xFE,
+    0x01, 0x0A, 0x00, 0xF8, 0x00, 0xF2, 0x00, 0xEC, 0x01, 0x0A, 0x00, 0xE6,
+    0x00, 0xE0, 0x00, 0xE0, 0x01, 0x0A, 0x01, 0x0A, 0x01, 0x0A, 0x00, 0xDA,
+    0x00, 0xD4, 0x00, 0xCE, 0x00, 0xC8, 0x00, 0xC2, 0x00, 0xC8, 0x00, 0xBC,
+    0x00, 0xD4, 0x00, 0xB6, 0x00, 0xB0, 0x00, 0xC2, 0x00, 0xAA, 0x00, 0xA4,
+    0x00, 0x9E, 0x00, 0x98, 0x00, 0xC2, 0x00, 0xC2, 0x00, 0x9E, 0x00, 0x9E,
+    0x00, 0x9E, 0x00, 0x9E, 0x00, 0xD4, 0x00, 0xD4, 0x00, 0x92, 0x00, 0x8C,
+    0x00, 0x92, 0x00, 0xD4, 0x00, 0x92, 0x00, 0x86, 0x00, 0x8C, 0x00, 0xC2,
+    0x00, 0xC2, 0x00, 0xC2, 0x00, 0x01, 0x01, 0x01, 0x04, 0x5D, 0x00, 0x01,
+    0x00, 0xFC, 0x04, 0x5D, 0x00, 0x01, 0x00, 0xFA, 0x04, 0x5D, 0x00, 0x01,
+    0x00, 0xBE, 0x03, 0x7C, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x7C, 0x00, 0x01,
+    0x00, 0xBB, 0x03, 0x7C, 0x00, 0x01, 0x00, 0xE1, 0x03, 0x7C, 0x00, 0x01,
+    0x00, 0xF6, 0x03, 0x8C, 0x00, 0x01, 0x00, 0xEA, 0x03, 0x8C, 0x00, 0x01,
+    0x00, 0xF8, 0x03, 0x8C, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x8C, 0x00, 0x01,
+    0x00, 0xFB, 0x04, 0x5D, 0x00, 0x01, 0x00, 0xFD, 0x04, 0x22, 0x00, 0x01,
+    0x00, 0xFB, 0x03, 0x8C, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xBE, 0x00, 0x01,
+    0x00, 0xFA, 0x02, 0xDD, 0x00, 0x01, 0x00, 0xFB, 0x03, 0xB9, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0xC2, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xF5, 0x00, 0x01,
+    0x00, 0xFB, 0x03, 0xA2, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x34, 0x00, 0x01,
+    0x00, 0xEA, 0x02, 0xBF, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xE7, 0x00, 0x01,
+    0x00, 0xFA, 0x02, 0xF0, 0x00, 0x01, 0x00, 0xFA, 0x03, 0xCA, 0x00, 0x01,
+    0x00, 0xFB, 0x02, 0xF0, 0x00, 0x01, 0x00, 0xBE, 0x03, 0x27, 0x00, 0x01,
+    0x00, 0xE3, 0x03, 0x27, 0x00, 0x01, 0x00, 0xB2, 0x03, 0x27, 0x00, 0x01,
+    0x00, 0xFB, 0x03, 0x27, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x27, 0x00, 0x42,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x96, 0x00, 0x00, 0x23, 0x90, 0x00, 0x00, 0x23, 0x8A,
+    0x00, 0x00, 0x23, 0x84, 0x00, 0x00, 0x23, 0x96, 0x00, 0x00, 0x23, 0x96,
+    0x00, 0x00, 0x23, 0x7E, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x72, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x96,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x96, 0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x6C, 0x00, 0x00, 0x23, 0x9C,
+    0x00, 0x00, 0x23, 0x9C, 0x00, 0x00, 0x23, 0x48, 0x00, 0x00, 0x23, 0x48,
+    0x00, 0x00, 0x23, 0x48, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x48,
+    0x00, 0x00, 0x23, 0x3C, 0x00, 0x00, 0x23, 0x36, 0x00, 0x00, 0x23, 0x30,
+    0x00, 0x00, 0x23, 0x2A, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x24,
+    0x00, 0x00, 0x23, 0x1E, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x18,
+    0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42,
+    0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42,
+    0x00, 0x00, 0x23, 0x48, 0x00, 0x00, 0x23, 0x48, 0x00, 0x00, 0x23, 0x42,
+    0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x48,
+    0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x42,
+    0x00, 0x00, 0x23, 0x42, 0x00, 0x00, 0x23, 0x12, 0x00, 0x00, 0x23, 0x42,
+    0x00, 0x02, 0x00, 0x03, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC,
+    0x03, 0x0C, 0x00, 0x11, 0x03, 0x23, 0x03, 0x42, 0x00, 0x22, 0x00, 0x06,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64,
+    0x00, 0x64, 0x00, 0x01, 0x00, 0x42, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x30,
+    0x00, 0x2A, 0x00, 0x24, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x24,
+    0x00, 0x1E, 0x00, 0x01, 0x00, 0xFA, 0xFF, 0x31, 0x00, 0x01, 0x00, 0xFA,
+    0xFF, 0x14, 0x00, 0x01, 0x00, 0xFB, 0xFF, 0x0A, 0x00, 0x01, 0x00, 0xFA,
+    0xFE, 0xC4, 0x00, 0x01, 0x00, 0xFB, 0xFF, 0x17, 0x00, 0x01, 0x00, 0xFA,
+    0xFF, 0x18, 0x00, 0x08, 0x00, 0x00, 0x21, 0xF4, 0x00, 0x00, 0x21, 0xEE,
+    0x00, 0x00, 0x21, 0xF4, 0x00, 0x00, 0x21, 0xEE, 0x00, 0x00, 0x21, 0xF4,
+    0x00, 0x00, 0x21, 0xF4, 0x00, 0x00, 0x21, 0xF4, 0x00, 0x00, 0x21, 0xEE,
+    0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x13, 0x03, 0x14, 0x03, 0x44, 0x03, 0x45, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x02, 0x14, 0x00, 0xE0, 0x00, 0x02,
+    0x00, 0xEA, 0x00, 0x0C, 0x00, 0x07, 0x00, 0xBE, 0x00, 0xA4, 0x00, 0x72,
+    0x00, 0x58, 0x00, 0x36, 0x00, 0x26, 0x00, 0x10, 0x00, 0x02, 0x1A, 0x82,
+    0x1A, 0x7C, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x02, 0x2D, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x2D, 0x02, 0xE4, 0x00, 0x02, 0x1A, 0x6C, 0x1A, 0x66,
+    0x00, 0x0A, 0x1F, 0x2E, 0x00, 0x01, 0x02, 0x32, 0x02, 0xF0, 0x00, 0x02,
+    0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x03, 0x2A,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x2A, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x0E,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x0E, 0x02, 0xE4, 0x00, 0x03, 0x1A, 0x3A,
+    0x1A, 0x34, 0x00, 0x76, 0x00, 0x70, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x01,
+    0x03, 0xB6, 0x00, 0x00, 0x00, 0x01, 0x03, 0xB6, 0x02, 0xE4, 0x00, 0x03,
+    0x00, 0x2C, 0x00, 0x26, 0x00, 0x20, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E,
+    0x00, 0x01, 0x04, 0x6C, 0x00, 0x00, 0x00, 0x01, 0x04, 0x6C, 0x02, 0xE4,
+    0x00, 0x01, 0x02, 0xA7, 0x00, 0x00, 0x00, 0x01, 0x02, 0xA7, 0x02, 0xE4,
+    0x00, 0x01, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE3, 0x02, 0xE4,
+    0x00, 0x03, 0x19, 0xEE, 0x19, 0xE8, 0x00, 0x2A, 0x00, 0x24, 0x00, 0x14,
+    0x00, 0x0E, 0x00, 0x01, 0x03, 0xBB, 0x00, 0x00, 0x00, 0x01, 0x03, 0xBB,
+    0x02, 0xF0, 0x00, 0x02, 0x19, 0xD4, 0x19, 0xCE, 0x00, 0x10, 0x00, 0x0A,
+    0x00, 0x01, 0x02, 0x4E, 0x00, 0x00, 0x00, 0x01, 0x02, 0x4E, 0x02, 0xE4,
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x4A,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x20, 0xFC, 0x00, 0x00, 0x20, 0xF6,
+    0x00, 0x00, 0x20, 0xF0, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x21, 0x02,
+    0x00, 0x00, 0x20, 0xEA, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x20, 0xDE, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x02,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x20, 0xD8, 0x00, 0x00, 0x21, 0x08,
+    0x00, 0x00, 0x21, 0x08, 0x00, 0x01, 0x20, 0xCC, 0x00, 0x01, 0x20, 0xC6,
+    0x00, 0x01, 0x20, 0xCC, 0x00, 0x01, 0x20, 0xC6, 0x00, 0x01, 0x20, 0xCC,
+    0x00, 0x01, 0x20, 0xCC, 0x00, 0x00, 0x20, 0xB4, 0x00, 0x00, 0x20, 0xB4,
+    0x00, 0x00, 0x20, 0xB4, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xB4,
+    0x00, 0x00, 0x20, 0xA8, 0x00, 0x00, 0x20, 0xA2, 0x00, 0x00, 0x20, 0x9C,
+    0x00, 0x00, 0x20, 0x96, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0x90,
+    0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0x84,
+    0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE,
+    0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE,
+    0x00, 0x00, 0x20, 0xB4, 0x00, 0x00, 0x20, 0xB4, 0x00, 0x00, 0x20, 0xAE,
+    0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xB4,
+    0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0xAE,
+    0x00, 0x00, 0x20, 0xAE, 0x00, 0x00, 0x20, 0x7E, 0x00, 0x00, 0x20, 0xAE,
+    0x00, 0x01, 0x20, 0xCC, 0x00, 0x01, 0x20, 0xC6, 0x00, 0x02, 0x00, 0x06,
+    0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11,
+    0x03, 0x0E, 0x03, 0x11, 0x00, 0x22, 0x03, 0x13, 0x03, 0x14, 0x00, 0x26,
+    0x03, 0x23, 0x03, 0x42, 0x00, 0x28, 0x03, 0x44, 0x03, 0x45, 0x00, 0x48,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x1F, 0xB4,
+    0x1D, 0x64, 0x00, 0x05, 0x1D, 0xDA, 0x00, 0x0C, 0x02, 0x14, 0x1D, 0x52,
+    0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x40, 0x00, 0x00,
+    0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C,
+    0x1D, 0x46, 0x00, 0x00, 0x1D, 0x34, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46,
+    0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x46, 0x00, 0x00,
+    0x1D, 0x34, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x34,
+    0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x34, 0x00, 0x00,
+    0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C,
+    0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46,
+    0x00, 0x00, 0x1D, 0x34, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00,
+    0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x34,
+    0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x34, 0x00, 0x00,
+    0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x34, 0x00, 0x00, 0x1D, 0x4C,
+    0x1D, 0x46, 0x00, 0x00, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46,
+    0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00,
+    0x1D, 0x52, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x22,
+    0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00,
+    0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C,
+    0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46,
+    0x00, 0x00, 0x1D, 0x52, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00,
+    0x1D, 0x3A, 0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x1C,
+    0x00, 0x00, 0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x3A, 0x00, 0x00,
+    0x1D, 0x4C, 0x1D, 0x46, 0x00, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x1D, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0x0A, 0x00, 0x00, 0x1D, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x1D, 0x04, 0x00, 0x00, 0x1C, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xF8, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xEC,
+    0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE6, 0x00, 0x00,
+    0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF8, 0x00, 0x00, 0x1C, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0xEC, 0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xE6, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xE6, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xDA,
+    0x00, 0x00, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xCE, 0x1C, 0xDA, 0x00, 0x00,
+    0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xCE, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xD4,
+    0x00, 0x00, 0x1C, 0xCE, 0x1C, 0xDA, 0x00, 0x00, 0x1C, 0xD4, 0x00, 0x00,
+    0x1C, 0xCE, 0x1C, 0xDA, 0x00, 0x00, 0x1C, 0xC2, 0x00, 0x00, 0x1C, 0xCE,
+    0x1C, 0xDA, 0x00, 0x00, 0x1C, 0xBC, 0x00, 0x00, 0x1C, 0xCE, 0x1C, 0xB6,
+    0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00,
+    0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00, 0x1F, 0x0C,
+    0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0,
+    0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00, 0x1C, 0x9E, 0x1C, 0xB0, 0x00, 0x00,
+    0x1C, 0xA4, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0x98,
+    0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00,
+    0x1C, 0x92, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0x98, 0x00, 0x00, 0x1F, 0x0C,
+    0x1C, 0xB0, 0x00, 0x00, 0x1C, 0x98, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0,
+    0x00, 0x00, 0x1C, 0x98, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00,
+    0x1C, 0x8C, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xA4,
+    0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00,
+    0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xB6, 0x00, 0x00, 0x1C, 0x92,
+    0x1C, 0xB0, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0,
+    0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00,
+    0x1C, 0xA4, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xA4,
+    0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00,
+    0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0x7A, 0x00, 0x00, 0x1F, 0x0C,
+    0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xB6, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0,
+    0x00, 0x00, 0x1C, 0xA4, 0x00, 0x00, 0x1F, 0x0C, 0x1C, 0xB0, 0x00, 0x00,
+    0x1C, 0x74, 0x00, 0x00, 0x1C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x68,
+    0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x5C, 0x00, 0x00,
+    0x1C, 0x62, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x5C, 0x00, 0x00, 0x1C, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x5C, 0x00, 0x00, 0x1C, 0x62, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x68, 0x00, 0x00, 0x1C, 0x56, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x5C, 0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x5C,
+    0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x50, 0x00, 0x00,
+    0x1C, 0x4A, 0x00, 0x00, 0x1C, 0x44, 0x1C, 0x3E, 0x00, 0x00, 0x1C, 0x38,
+    0x00, 0x00, 0x1C, 0x32, 0x1C, 0x50, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00,
+    0x1C, 0x44, 0x1C, 0x26, 0x00, 0x00, 0x1C, 0x4A, 0x00, 0x00, 0x1C, 0x44,
+    0x1C, 0x50, 0x00, 0x00, 0x1C, 0x20, 0x00, 0x00, 0x1C, 0x44, 0x1C, 0x1A,
+    0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x08, 0x00, 0x00, 0x1C, 0x14,
+    0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E,
+    0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00,
+    0x1C, 0x02, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x1B, 0xFC,
+    0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00,
+    0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x1B, 0xF6, 0x00, 0x00, 0x1C, 0x14,
+    0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E,
+    0x00, 0x00, 0x1C, 0x1A, 0x00, 0x00, 0x1B, 0xF0, 0x1C, 0x0E, 0x00, 0x00,
+    0x1B, 0xEA, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x02,
+    0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00,
+    0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x14,
+    0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x1A, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E,
+    0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1C, 0x14, 0x1C, 0x0E, 0x00, 0x00,
+    0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD8,
+    0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD2, 0x00, 0x00,
+    0x1B, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD2, 0x00, 0x00, 0x1B, 0xC6,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xC0, 0x1B, 0xBA, 0x1B, 0xB4, 0x00, 0x00,
+    0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xAE,
+    0x1B, 0xA8, 0x1B, 0xBA, 0x1B, 0xB4, 0x00, 0x00, 0x1B, 0xAE, 0x1B, 0xC0,
+    0x1B, 0xBA, 0x1B, 0xB4, 0x00, 0x00, 0x1B, 0xAE, 0x1B, 0xC0, 0x1B, 0xBA,
+    0x1B, 0xA2, 0x00, 0x00, 0x1B, 0xAE, 0x1B, 0xC0, 0x1B, 0xBA, 0x1B, 0xB4,
+    0x00, 0x00, 0x1B, 0xAE, 0x1B, 0xC0, 0x1B, 0xBA, 0x1B, 0x9C, 0x00, 0x00,
+    0x1B, 0xAE, 0x1B, 0xC0, 0x1B, 0xBA, 0x1B, 0xB4, 0x00, 0x00, 0x1B, 0xAE,
+    0x1B, 0xC0, 0x1B, 0xBA, 0x1B, 0x96, 0x00, 0x00, 0x1B, 0xAE, 0x1F, 0x1E,
+    0x1B, 0x90, 0x1C, 0x6E, 0x00, 0x00, 0x1B, 0x8A, 0x1B, 0x84, 0x00, 0x00,
+    0x1B, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x84, 0x00, 0x00, 0x1B, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x72, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x6C, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x66, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x72,
+    0x00, 0x00, 0x1B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x66, 0x00, 0x00,
+    0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x72, 0x00, 0x00, 0x1B, 0x5A,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x72, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x72, 0x00, 0x00, 0x1B, 0x54, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x66, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x4E,
+    0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x30, 0x1B, 0x48,
+    0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x2A, 0x1B, 0x48, 0x1B, 0x42,
+    0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x2A, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C,
+    0x1B, 0x36, 0x1B, 0x2A, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36,
+    0x1B, 0x24, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x2A,
+    0x1B, 0x48, 0x1B, 0x1E, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x24, 0x1B, 0x48,
+    0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x24, 0x1B, 0x48, 0x1B, 0x42,
+    0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x24, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C,
+    0x1B, 0x36, 0x1B, 0x18, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36,
+    0x1B, 0x2A, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x12,
+    0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x12, 0x1B, 0x48,
+    0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x4E, 0x1B, 0x48, 0x1B, 0x1E,
+    0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x0C, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C,
+    0x1B, 0x36, 0x1B, 0x2A, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36,
+    0x1B, 0x4E, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x30,
+    0x00, 0x00, 0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x4E, 0x00, 0x00,
+    0x1B, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x00, 0x00, 0x1B, 0x42,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x2A, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x2A, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x06, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x2A,
+    0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x2A, 0x1B, 0x48,
+    0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x00, 0x1B, 0x48, 0x1B, 0x42,
+    0x1B, 0x3C, 0x1B, 0x36, 0x1A, 0xFA, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C,
+    0x1B, 0x36, 0x1B, 0x4E, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36,
+    0x1A, 0xF4, 0x1B, 0x48, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xE2, 0x1B, 0x2A,
+    0x1B, 0x48, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xE2, 0x1B, 0x2A, 0x1B, 0x48,
+    0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x00, 0x1B, 0x48, 0x1B, 0x42,
+    0x1B, 0x3C, 0x1B, 0x36, 0x1B, 0x12, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C,
+    0x1B, 0x36, 0x1B, 0x12, 0x1B, 0x48, 0x1B, 0x42, 0x1B, 0x3C, 0x1B, 0x36,
+    0x1A, 0xDC, 0x00, 0x00, 0x1A, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD0,
+    0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD0, 0x00, 0x00,
+    0x1B, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x4E, 0x1B, 0x48, 0x1B, 0x42,
+    0x1B, 0x3C, 0x1B, 0x36, 0x1A, 0xCA, 0x00, 0x00, 0x1A, 0xC4, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xBE, 0x00, 0x00, 0x1A, 0xC4, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0xB8, 0x00, 0x00, 0x1A, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xCA,
+    0x00, 0x00, 0x1A, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAC, 0x00, 0x00,
+    0x1A, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xCA, 0x00, 0x00, 0x1A, 0xA6,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0xB8, 0x00, 0x00, 0x1A, 0xC4, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xCA, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x9A, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x8E,
+    0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00,
+    0x1A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00, 0x1A, 0x94,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x82, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x9A, 0x00, 0x00, 0x1A, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x88, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x9A,
+    0x00, 0x00, 0x1A, 0x76, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00,
+    0x1A, 0x94, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x9A, 0x00, 0x00, 0x1A, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x6A, 0x00, 0x00, 0x1A, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x5E, 0x00, 0x00, 0x1A, 0x58, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x52,
+    0x00, 0x00, 0x1A, 0x4C, 0x00, 0x00, 0x1A, 0x46, 0x1A, 0x52, 0x00, 0x00,
+    0x1A, 0x4C, 0x00, 0x00, 0x1A, 0x46, 0x1A, 0x40, 0x00, 0x00, 0x1A, 0x4C,
+    0x00, 0x00, 0x1A, 0x46, 0x1A, 0x52, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00,
+    0x1A, 0x46, 0x1A, 0x52, 0x00, 0x00, 0x1A, 0x34, 0x00, 0x00, 0x1A, 0x46,
+    0x1A, 0x52, 0x00, 0x00, 0x1A, 0x2E, 0x00, 0x00, 0x1A, 0x46, 0x1A, 0x52,
+    0x00, 0x00, 0x1A, 0x28, 0x00, 0x00, 0x1A, 0x46, 0x1A, 0x22, 0x1A, 0x1C,
+    0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1A, 0x0A, 0x1A, 0x1C, 0x1A, 0x16,
+    0x1A, 0x10, 0x00, 0x00, 0x1A, 0x04, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10,
+    0x00, 0x00, 0x1A, 0x04, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00,
+    0x1A, 0x04, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1A, 0xB8,
+    0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1A, 0x04, 0x1A, 0x1C,
+    0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1A, 0x22, 0x1A, 0x1C, 0x19, 0xFE,
+    0x1A, 0x10, 0x00, 0x00, 0x19, 0xF8, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10,
+    0x00, 0x00, 0x1A, 0x04, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00,
+    0x1A, 0x22, 0x00, 0x00, 0x1A, 0x16, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x0A,
+    0x00, 0x00, 0x1A, 0x16, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x22, 0x00, 0x00,
+    0x19, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF8, 0x00, 0x00, 0x1A, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x1A, 0x16, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x1A, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xF2, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1A, 0x04,
+    0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1A, 0x04, 0x1A, 0x1C,
+    0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x19, 0xEC, 0x1A, 0x1C, 0x1A, 0x16,
+    0x1A, 0x10, 0x00, 0x00, 0x1A, 0x22, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10,
+    0x00, 0x00, 0x1A, 0x04, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00,
+    0x1A, 0x04, 0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x19, 0xE6,
+    0x1A, 0x1C, 0x1A, 0x16, 0x1A, 0x10, 0x00, 0x00, 0x1B, 0xBA, 0x00, 0x00,
+    0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xD4,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xCE, 0x00, 0x00, 0x19, 0xD4, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xC8, 0x00, 0x00, 0x19, 0xD4, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xC8, 0x00, 0x00, 0x19, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x19, 0xC2,
+    0x00, 0x00, 0x19, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x19, 0xBC, 0x00, 0x00,
+    0x19, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x19, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0x22, 0x00, 0x00, 0x19, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00, 0x19, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xAA, 0x00, 0x00, 0x19, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xAA,
+    0x00, 0x00, 0x19, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00,
+    0x19, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x19, 0x9E, 0x00, 0x00, 0x19, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00, 0x19, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00, 0x19, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xAA, 0x00, 0x00, 0x19, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x19, 0x98,
+    0x00, 0x00, 0x19, 0x92, 0x00, 0x00, 0x19, 0x8C, 0x1C, 0xA4, 0x00, 0x00,
+    0x19, 0x92, 0x00, 0x00, 0x19, 0x8C, 0x19, 0x86, 0x00, 0x00, 0x19, 0x92,
+    0x00, 0x00, 0x19, 0x8C, 0x19, 0x86, 0x00, 0x00, 0x19, 0x92, 0x00, 0x00,
+    0x19, 0x8C, 0x19, 0x98, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0x19, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x19, 0x7A,
+    0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x68, 0x00, 0x00, 0x19, 0x74,
+    0x19, 0x6E, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E,
+    0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00,
+    0x19, 0x62, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x5C,
+    0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00,
+    0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x74,
+    0x19, 0x6E, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E,
+    0x00, 0x00, 0x19, 0x7A, 0x00, 0x00, 0x19, 0x50, 0x19, 0x6E, 0x00, 0x00,
+    0x19, 0x4A, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x62,
+    0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00,
+    0x19, 0x74, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x19, 0x74,
+    0x19, 0x6E, 0x00, 0x00, 0x19, 0x7A, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E,
+    0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x19, 0x74, 0x19, 0x6E, 0x00, 0x00,
+    0x19, 0x44, 0x00, 0x00, 0x19, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38,
+    0x00, 0x00, 0x19, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xBA,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xAE, 0x19, 0x32, 0x00, 0x00, 0x19, 0x2C,
+    0x19, 0x26, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26,
+    0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00,
+    0x19, 0x1A, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x20,
+    0x00, 0x00, 0x19, 0x14, 0x19, 0x26, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00,
+    0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x2C,
+    0x19, 0x26, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26,
+    0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00,
+    0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x1A,
+    0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00,
+    0x19, 0x14, 0x19, 0x26, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x2C,
+    0x19, 0x26, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26,
+    0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00,
+    0x19, 0x0E, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x08,
+    0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x32, 0x00, 0x00,
+    0x19, 0x14, 0x19, 0x26, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x19, 0x2C,
+    0x19, 0x26, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26,
+    0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00,
+    0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x19, 0x32,
+    0x00, 0x00, 0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x18, 0xFC, 0x00, 0x00,
+    0x19, 0x2C, 0x19, 0x26, 0x00, 0x00, 0x18, 0xF6, 0x00, 0x00, 0x19, 0x2C,
+    0x19, 0x26, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x2C, 0x19, 0x26,
+    0x00, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x18, 0xEA, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xE4, 0x00, 0x00, 0x18, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDE,
+    0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x18, 0xD8, 0x00, 0x00,
+    0x18, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0x00, 0x00, 0x18, 0xD2,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xCC, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xD8, 0x00, 0x00, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xCC, 0x00, 0x00, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCC,
+    0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00,
+    0x18, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x18, 0xBA, 0x18, 0xB4, 0x18, 0xAE,
+    0x00, 0x00, 0x18, 0xA8, 0x18, 0xBA, 0x18, 0xB4, 0x18, 0xAE, 0x00, 0x00,
+    0x18, 0xA8, 0x18, 0xBA, 0x18, 0xB4, 0x18, 0xAE, 0x00, 0x00, 0x18, 0xA8,
+    0x18, 0xBA, 0x18, 0xB4, 0x18, 0xA2, 0x00, 0x00, 0x18, 0xA8, 0x18, 0xBA,
+    0x18, 0xB4, 0x18, 0x9C, 0x00, 0x00, 0x18, 0xA8, 0x00, 0x00, 0x18, 0xB4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x96, 0x00, 0x00, 0x18, 0x90,
+    0x18, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A,
+    0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00,
+    0x18, 0x84, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x84,
+    0x00, 0x00, 0x18, 0x7E, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00,
+    0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x78, 0x00, 0x00, 0x18, 0x90,
+    0x18, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x18, 0x72, 0x18, 0x8A,
+    0x00, 0x00, 0x18, 0x78, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00,
+    0x18, 0x78, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x78,
+    0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x6C, 0x00, 0x00,
+    0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x66, 0x00, 0x00, 0x18, 0x90,
+    0x18, 0x8A, 0x00, 0x00, 0x18, 0x66, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A,
+    0x00, 0x00, 0x18, 0x96, 0x00, 0x00, 0x18, 0x72, 0x18, 0x8A, 0x00, 0x00,
+    0x18, 0x60, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x84,
+    0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00,
+    0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x18, 0x90,
+    0x18, 0x8A, 0x00, 0x00, 0x18, 0x5A, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A,
+    0x00, 0x00, 0x18, 0x5A, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00,
+    0x18, 0x54, 0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x84,
+    0x00, 0x00, 0x18, 0x90, 0x18, 0x8A, 0x00, 0x00, 0x18, 0x4E, 0x00, 0x00,
+    0x18, 0x48, 0x00, 0x00, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x18, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x36, 0x00, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30,
+    0x00, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2A, 0x00, 0x00,
+    0x18, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x18, 0x90, 0x00, 0x00,
+    0x18, 0x1E, 0x18, 0x24, 0x00, 0x00, 0x18, 0x90, 0x00, 0x00, 0x18, 0x1E,
+    0x18, 0x24, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x1E, 0x18, 0x12,
+    0x00, 0x00, 0x18, 0x90, 0x00, 0x00, 0x18, 0x1E, 0x18, 0x24, 0x00, 0x00,
+    0x18, 0x72, 0x00, 0x00, 0x18, 0x1E, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x06,
+    0x18, 0x00, 0x00, 0x00, 0x17, 0xFA, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE,
+    0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00,
+    0x17, 0xE8, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xE8,
+    0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00,
+    0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xE2, 0x00, 0x00, 0x17, 0xF4,
+    0x17, 0xEE, 0x00, 0x00, 0x17, 0xDC, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE,
+    0x00, 0x00, 0x17, 0xD6, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00,
+    0x17, 0xDC, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x18, 0x0C,
+    0x00, 0x00, 0x17, 0xD0, 0x18, 0x00, 0x00, 0x00, 0x17, 0xCA, 0x00, 0x00,
+    0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x17, 0xF4,
+    0x17, 0xEE, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE,
+    0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x06, 0x18, 0x00, 0x00, 0x00,
+    0x17, 0xE8, 0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xDC,
+    0x00, 0x00, 0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00,
+    0x17, 0xF4, 0x17, 0xEE, 0x00, 0x00, 0x17, 0xC4, 0x00, 0x00, 0x17, 0xBE,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0xB8, 0x00, 0x00, 0x17, 0xBE, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0xB2, 0x00, 0x00, 0x17, 0xAC, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0xB2, 0x00, 0x00, 0x17, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x17, 0xA0,
+    0x00, 0x00, 0x18, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x17, 0x9A, 0x17, 0x94,
+    0x17, 0x8E, 0x00, 0x00, 0x17, 0x88, 0x17, 0x82, 0x17, 0x94, 0x17, 0x8E,
+    0x00, 0x00, 0x17, 0x88, 0x17, 0x9A, 0x17, 0x94, 0x17, 0x8E, 0x00, 0x00,
+    0x17, 0x88, 0x17, 0x9A, 0x17, 0x94, 0x17, 0x7C, 0x00, 0x00, 0x17, 0x88,
+    0x17, 0x9A, 0x17, 0x94, 0x17, 0x8E, 0x00, 0x00, 0x17, 0x88, 0x17, 0x9A,
+    0x17, 0x94, 0x17, 0x76, 0x00, 0x00, 0x17, 0x88, 0x17, 0x9A, 0x17, 0x94,
+    0x17, 0x8E, 0x00, 0x00, 0x17, 0x88, 0x17, 0x9A, 0x17, 0x94, 0x17, 0x70,
+    0x00, 0x00, 0x17, 0x88, 0x17, 0x6A, 0x17, 0x64, 0x17, 0x5E, 0x00, 0x00,
+    0x17, 0x58, 0x17, 0x52, 0x00, 0x00, 0x17, 0x4C, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x52, 0x00, 0x00, 0x17, 0x46, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40,
+    0x00, 0x00, 0x18, 0x90, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3A, 0x00, 0x00,
+    0x18, 0x90, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x00, 0x00, 0x17, 0x2E,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x3A, 0x00, 0x00, 0x18, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x17, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x22, 0x00, 0x00, 0x18, 0x90, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40,
+    0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00,
+    0x18, 0x90, 0x00, 0x00, 0x00, 0x00, 0x17, 0x40, 0x00, 0x00, 0x17, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x3A, 0x00, 0x00, 0x18, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x16, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04,
+    0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xFE,
+    0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xFE, 0x17, 0x10,
+    0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC,
+    0x17, 0x0A, 0x17, 0x04, 0x16, 0xF8, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A,
+    0x17, 0x04, 0x16, 0xFE, 0x17, 0x10, 0x16, 0xF2, 0x17, 0x0A, 0x17, 0x04,
+    0x16, 0xF8, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xF8,
+    0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xF8, 0x17, 0x10,
+    0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xEC, 0x17, 0x10, 0x17, 0xAC,
+    0x17, 0x0A, 0x17, 0x04, 0x16, 0xE6, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A,
+    0x17, 0x04, 0x16, 0xE0, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04,
+    0x16, 0xE0, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x17, 0x16,
+    0x17, 0x10, 0x16, 0xF2, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xDA, 0x17, 0x10,
+    0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC,
+    0x17, 0x0A, 0x17, 0x04, 0x17, 0x16, 0x00, 0x00, 0x17, 0xAC, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xFE, 0x00, 0x00, 0x17, 0xAC, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x16, 0x00, 0x00, 0x16, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDA,
+    0x00, 0x00, 0x17, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00,
+    0x17, 0xAC, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00, 0x17, 0xAC,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A,
+    0x17, 0x04, 0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04,
+    0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xD4,
+    0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xD4, 0x17, 0x10,
+    0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x17, 0x16, 0x17, 0x10, 0x17, 0xAC,
+    0x17, 0x0A, 0x17, 0x04, 0x17, 0x16, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A,
+    0x17, 0x04, 0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04,
+    0x16, 0xFE, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xCE,
+    0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xC8, 0x17, 0x10,
+    0x17, 0xAC, 0x17, 0x0A, 0x17, 0x04, 0x16, 0xC2, 0x17, 0x10, 0x17, 0xAC,
+    0x17, 0x0A, 0x17, 0x04, 0x16, 0xBC, 0x00, 0x00, 0x16, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x32, 0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x32, 0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x32,
+    0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB0, 0x00, 0x00,
+    0x16, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x16, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x16, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xB0, 0x00, 0x00, 0x16, 0x9E, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x98, 0x00, 0x00, 0x16, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB0,
+    0x00, 0x00, 0x16, 0x92, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4, 0x00, 0x00,
+    0x16, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x16, 0xB0, 0x00, 0x00, 0x16, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x86, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x7A, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x74, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x16, 0x7A,
+    0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x16, 0x6E, 0x00, 0x00,
+    0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x16, 0x86, 0x00, 0x00, 0x16, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x7A, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x86, 0x00, 0x00, 0x16, 0x62, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x5C, 0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x16, 0x86,
+    0x00, 0x00, 0x16, 0x56, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5C, 0x00, 0x00,
+    0x16, 0x56, 0x00, 0x00, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x16, 0x4A,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x44, 0x16, 0x3E, 0x16, 0x38, 0x00, 0x00,
+    0x16, 0x32, 0x16, 0x44, 0x16, 0x3E, 0x16, 0x38, 0x00, 0x00, 0x16, 0x32,
+    0x16, 0x44, 0x16, 0x3E, 0x16, 0x38, 0x00, 0x00, 0x16, 0x32, 0x16, 0x44,
+    0x16, 0x3E, 0x16, 0x2C, 0x00, 0x00, 0x16, 0x32, 0x16, 0x44, 0x16, 0x3E,
+    0x16, 0x26, 0x00, 0x00, 0x16, 0x32, 0x16, 0x20, 0x16, 0x3E, 0x16, 0x38,
+    0x00, 0x00, 0x16, 0x32, 0x16, 0x44, 0x16, 0x3E, 0x16, 0x1A, 0x00, 0x00,
+    0x16, 0x32, 0x16, 0x44, 0x16, 0x3E, 0x16, 0x14, 0x00, 0x00, 0x16, 0x32,
+    0x16, 0x0E, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6,
+    0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6, 0x16, 0x08,
+    0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6, 0x16, 0x08, 0x16, 0x02,
+    0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC,
+    0x00, 0x00, 0x15, 0xF0, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00,
+    0x15, 0xEA, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x16, 0x0E,
+    0x16, 0x08, 0x15, 0xE4, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xDE, 0x16, 0x08,
+    0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6, 0x16, 0x08, 0x16, 0x02,
+    0x15, 0xFC, 0x00, 0x00, 0x16, 0x0E, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xF6, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x0E, 0x00, 0x00, 0x15, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x15, 0xDE,
+    0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF6, 0x00, 0x00,
+    0x16, 0x02, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF6, 0x00, 0x00, 0x16, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0xF6, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC,
+    0x00, 0x00, 0x15, 0xF6, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00,
+    0x15, 0xF6, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xD8,
+    0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x16, 0x0E, 0x16, 0x08,
+    0x16, 0x02, 0x15, 0xFC, 0x00, 0x00, 0x15, 0xD2, 0x16, 0x08, 0x16, 0x02,
+    0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC,
+    0x00, 0x00, 0x15, 0xCC, 0x16, 0x08, 0x16, 0x02, 0x15, 0xFC, 0x00, 0x00,
+    0x15, 0xC6, 0x00, 0x00, 0x15, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBA,
+    0x00, 0x00, 0x15, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00,
+    0x15, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x15, 0xB4,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0xA8, 0x00, 0x00, 0x15, 0xB4, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xB4, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x9C, 0x00, 0x00, 0x1C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x96,
+    0x00, 0x00, 0x15, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00,
+    0x15, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00, 0x15, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x84, 0x00, 0x00, 0x15, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x84, 0x00, 0x00, 0x15, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x96, 0x00, 0x00, 0x15, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x78,
+    0x00, 0x00, 0x15, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00,
+    0x15, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00, 0x15, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00, 0x15, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x72, 0x00, 0x00, 0x15, 0x6C, 0x00, 0x00, 0x15, 0x66,
+    0x15, 0x60, 0x00, 0x00, 0x15, 0x6C, 0x00, 0x00, 0x15, 0x66, 0x15, 0x60,
+    0x00, 0x00, 0x15, 0x6C, 0x00, 0x00, 0x15, 0x66, 0x15, 0x5A, 0x00, 0x00,
+    0x15, 0x6C, 0x00, 0x00, 0x15, 0x66, 0x15, 0x72, 0x00, 0x00, 0x15, 0x54,
+    0x00, 0x00, 0x15, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xEE,
+    0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x3C, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x3C,
+    0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x36, 0x00, 0x00,
+    0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00, 0x15, 0x30,
+    0x15, 0x42, 0x00, 0x00, 0x15, 0x36, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42,
+    0x00, 0x00, 0x15, 0x36, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x36, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x3C,
+    0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00,
+    0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x36, 0x00, 0x00, 0x15, 0x48,
+    0x15, 0x42, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00, 0x15, 0x30, 0x15, 0x42,
+    0x00, 0x00, 0x15, 0x36, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x36, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x36,
+    0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x2A, 0x00, 0x00,
+    0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x24, 0x00, 0x00, 0x15, 0x48,
+    0x15, 0x42, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x15, 0x30, 0x15, 0x42,
+    0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x3C, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x3C,
+    0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00,
+    0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x15, 0x48,
+    0x15, 0x42, 0x00, 0x00, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42,
+    0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x3C, 0x00, 0x00, 0x15, 0x48, 0x15, 0x42, 0x00, 0x00, 0x15, 0x12,
+    0x00, 0x00, 0x15, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00,
+    0x15, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x15, 0x0C,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x15, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0xFA, 0x00, 0x00, 0x15, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x15, 0x06,
+    0x00, 0x00, 0x15, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x72, 0x00, 0x00,
+    0x1C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF8, 0x00, 0x00, 0x1C, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0xF8, 0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x74, 0x00, 0x00, 0x1C, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0xF4, 0x00, 0x00, 0x14, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE8,
+    0x00, 0x00, 0x14, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x14, 0xDC, 0x00, 0x00,
+    0x14, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x14, 0xD0, 0x00, 0x00, 0x14, 0xCA,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x16, 0x17, 0x10, 0x17, 0xAC, 0x17, 0x0A,
+    0x17, 0x04, 0x00, 0x01, 0x01, 0xF3, 0x00, 0x00, 0x00, 0x01, 0x01, 0xF3,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x77, 0x00, 0x00, 0x00, 0x01, 0x01, 0x77,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x7B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x7B,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0xBF, 0x00, 0x00, 0x00, 0x01, 0x01, 0xBF,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x37, 0x02, 0xF8, 0x00, 0x01, 0x01, 0x37,
+    0x02, 0xC6, 0x00, 0x01, 0x01, 0x37, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x37,
+    0xFF, 0x1A, 0x00, 0x01, 0x01, 0x37, 0x02, 0x15, 0x00, 0x01, 0x01, 0x23,
+    0x04, 0x16, 0x00, 0x01, 0x01, 0x23, 0x03, 0x3C, 0x00, 0x01, 0x01, 0x23,
+    0x02, 0xF8, 0x00, 0x01, 0x00, 0xE7, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x23,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x23, 0x03, 0x2F, 0x00, 0x01, 0x01, 0x23,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0xED, 0x00, 0x00, 0x00, 0x01, 0x01, 0x23,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x23, 0x02, 0x15, 0x00, 0x01, 0x01, 0x22,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x22, 0x02, 0xF8, 0x00, 0x01, 0x01, 0x22,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x22, 0x01, 0x0B, 0x00, 0x01, 0x01, 0x22,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x22, 0x02, 0x15, 0x00, 0x01, 0x01, 0x2B,
+    0x02, 0xF0, 0x00, 0x01, 0x02, 0x0C, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x3F,
+    0x02, 0xF8, 0x00, 0x01, 0x01, 0x3F, 0x02, 0xF0, 0x00, 0x01, 0x02, 0x0C,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x3F, 0x02, 0x15, 0x00, 0x01, 0x01, 0x39,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x95, 0x02, 0xF0, 0x00, 0x01, 0x01, 0xA9,
+    0x02, 0xF8, 0x00, 0x01, 0x01, 0xA9, 0x02, 0xF0, 0x00, 0x01, 0x01, 0xA9,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xA9, 0x02, 0x15, 0x00, 0x01, 0x01, 0x36,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x36, 0x02, 0x15, 0x00, 0x01, 0x01, 0x4A,
+    0x02, 0xFD, 0x00, 0x01, 0x01, 0x4A, 0x03, 0x3C, 0x00, 0x01, 0x01, 0x4A,
+    0x03, 0xC2, 0x00, 0x01, 0x01, 0x36, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x4A,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x4A, 0x02, 0xF8, 0x00, 0x01, 0x01, 0x0D,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x4A, 0x02, 0xF0, 0x00, 0x01, 0x02, 0x29,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x01, 0x02, 0x7E,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x4A, 0x02, 0x15, 0x00, 0x01, 0x00, 0xCB,
+    0xFF, 0x31, 0x00, 0x01, 0x00, 0xCB, 0xFF, 0x18, 0x00, 0x01, 0x00, 0xC7,
+    0x03, 0x47, 0x00, 0x01, 0x00, 0xCB, 0xFE, 0xC4, 0x00, 0x01, 0x00, 0xCB,
+    0xFF, 0x0A, 0x00, 0x01, 0x00, 0xCB, 0x01, 0x0B, 0x00, 0x01, 0x00, 0xCB,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x2B, 0x03, 0x50, 0x00, 0x01, 0x00, 0xC7,
+    0x02, 0x64, 0x00, 0x01, 0x01, 0x4E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x4E,
+    0x02, 0x15, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0x18, 0x00, 0x01, 0x00, 0xFC,
+    0x02, 0xF8, 0x00, 0x01, 0x00, 0xFD, 0xFE, 0xC4, 0x00, 0x01, 0x00, 0xFD,
+    0xFF, 0x0A, 0x00, 0x01, 0x00, 0xFC, 0x03, 0x2F, 0x00, 0x01, 0x00, 0xFC,
+    0x02, 0xC7, 0x00, 0x01, 0x00, 0xFC, 0x02, 0xF0, 0x00, 0x01, 0x00, 0xFD,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x02, 0x15, 0x00, 0x01, 0x00, 0x9D,
+    0xFF, 0x31, 0x00, 0x01, 0x00, 0x9D, 0xFF, 0x18, 0x00, 0x01, 0x00, 0xD3,
+    0x02, 0xF0, 0x00, 0x01, 0x00, 0x9D, 0xFE, 0xC4, 0x00, 0x01, 0x01, 0x0F,
+    0x02, 0xF0, 0x00, 0x01, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0F,
+    0x02, 0x15, 0x00, 0x01, 0x02, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x02, 0x10,
+    0x02, 0x11, 0x00, 0x01, 0x01, 0x46, 0x03, 0xCA, 0x00, 0x01, 0x01, 0x46,
+    0x03, 0xAA, 0x00, 0x01, 0x01, 0x46, 0x02, 0xFD, 0x00, 0x01, 0x01, 0x46,
+    0x02, 0xE6, 0x00, 0x01, 0x01, 0x32, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x46,
+    0x03, 0xD2, 0x00, 0x01, 0x01, 0x46, 0x02, 0xF8, 0x00, 0x01, 0x01, 0x0A,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x46, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x46,
+    0x03, 0x2F, 0x00, 0x01, 0x01, 0x46, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x46,
+    0x01, 0x0B, 0x00, 0x01, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x02, 0x78,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x46, 0x02, 0x15, 0x00, 0x01, 0x01, 0x47,
+    0xFF, 0x31, 0x00, 0x01, 0x01, 0x65, 0x02, 0xF8, 0x00, 0x01, 0x01, 0x47,
+    0xFE, 0xC4, 0x00, 0x01, 0x01, 0x67, 0x00, 0x00, 0x00, 0x01, 0x01, 0x85,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x65, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x65,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0xEB, 0xFF, 0x18, 0x00, 0x01, 0x01, 0xEB,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xEB, 0x02, 0x15, 0x00, 0x01, 0x00, 0xD9,
+    0x01, 0x72, 0x00, 0x01, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x01, 0x01, 0x65,
+    0x02, 0xE4, 0x00, 0x01, 0x00, 0xD9, 0x02, 0xE4, 0x00, 0x01, 0x00, 0xA4,
+    0xFF, 0x31, 0x00, 0x01, 0x00, 0xA4, 0xFF, 0x18, 0x00, 0x01, 0x00, 0xA4,
+    0xFE, 0xC4, 0x00, 0x01, 0x00, 0xA6, 0x03, 0xB4, 0x00, 0x01, 0x00, 0xA4,
+    0x01, 0x72, 0x00, 0x01, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x01, 0x30,
+    0x02, 0xE4, 0x00, 0x01, 0x00, 0xA4, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x4C,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x46, 0xFE, 0xC4, 0x00, 0x01, 0x01, 0x46,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x46, 0x02, 0xE4, 0x00, 0x01, 0x00, 0xAF,
+    0x02, 0xF0, 0x00, 0x01, 0x00, 0xA5, 0xFF, 0x1A, 0x00, 0x01, 0x00, 0xAF,
+    0x02, 0x15, 0x00, 0x01, 0x00, 0x87, 0x02, 0xF0, 0x00, 0x01, 0x00, 0xA9,
+    0xFF, 0x18, 0x00, 0x01, 0x00, 0x9C, 0x03, 0x2F, 0x00, 0x01, 0x00, 0x9B,
+    0x02, 0xF8, 0x00, 0x01, 0x00, 0x5F, 0x02, 0xF0, 0x00, 0x01, 0x00, 0x9B,
+    0x02, 0xF0, 0x00, 0x01, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9B,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x9B, 0x02, 0x15, 0x00, 0x01, 0x00, 0xF6,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x00, 0xA9,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x47, 0x03, 0xB4, 0x00, 0x01, 0x01, 0x47,
+    0xFF, 0x14, 0x00, 0x01, 0x00, 0xBD, 0x02, 0x7D, 0x00, 0x01, 0x01, 0x47,
+    0x02, 0xE4, 0x00, 0x01, 0x01, 0x53, 0x02, 0xF8, 0x00, 0x01, 0x01, 0x53,
+    0x02, 0xC6, 0x00, 0x01, 0x01, 0x53, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x53,
+    0xFF, 0x1A, 0x00, 0x01, 0x01, 0x53, 0x02, 0x15, 0x00, 0x01, 0x00, 0xC5,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xC5, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x25,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x2E, 0x02, 0xE6, 0x00, 0x01, 0x01, 0x1A,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x2E, 0x02, 0xF8, 0x00, 0x01, 0x00, 0xF2,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x47, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x2E,
+    0x03, 0x2F, 0x00, 0x01, 0x01, 0x47, 0xFF, 0x0A, 0x00, 0x01, 0x01, 0x2E,
+    0x02, 0xF0, 0x00, 0x01, 0x02, 0x0A, 0x00, 0x08, 0x00, 0x01, 0x01, 0x47,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x2E, 0x02, 0x15, 0x00, 0x01, 0x01, 0x4C,
+    0xFF, 0x31, 0x00, 0x01, 0x01, 0x4C, 0xFF, 0x18, 0x00, 0x01, 0x01, 0xD7,
+    0x02, 0x7A, 0x00, 0x01, 0x01, 0x4C, 0x00, 0x00, 0x00, 0x01, 0x02, 0x80,
+    0x02, 0xE4, 0x00, 0x01, 0x01, 0x4C, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x34,
+    0x02, 0xF8, 0x00, 0x01, 0x01, 0x35, 0xFF, 0x0A, 0x00, 0x01, 0x01, 0x34,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0x35, 0x00, 0x00, 0x00, 0x01, 0x01, 0x34,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x50, 0x02, 0xE4, 0x00, 0x01, 0x01, 0xCC,
+    0x02, 0xF0, 0x00, 0x01, 0x01, 0xC3, 0x00, 0x00, 0x00, 0x01, 0x01, 0xCC,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x50, 0x04, 0x16, 0x00, 0x01, 0x01, 0x50,
+    0x03, 0x3C, 0x00, 0x01, 0x01, 0x3C, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x50,
+    0x02, 0xF8, 0x00, 0x01, 0x01, 0x14, 0x02, 0xF0, 0x00, 0x01, 0x01, 0x50,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x50, 0x03, 0x2F, 0x00, 0x01, 0x01, 0x50,
+    0x02, 0xF0, 0x00, 0x01, 0x02, 0x2B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x50,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x50, 0x02, 0x15, 0x00, 0x01, 0x01, 0x8E,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8E,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xBD, 0x03, 0x8C, 0x00, 0x01, 0x00, 0xB6,
+    0xFF, 0x18, 0x00, 0x01, 0x00, 0xB8, 0x04, 0x22, 0x00, 0x01, 0x00, 0x86,
+    0x03, 0x8C, 0x00, 0x01, 0x00, 0xB6, 0x03, 0x8C, 0x00, 0x01, 0x00, 0xB8,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xB6,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xB6, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x5B,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x5B, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x5B,
+    0x01, 0x5E, 0x00, 0x01, 0x01, 0x5B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5B,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x65, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x5F,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x5F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5F,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x65, 0x00, 0x00, 0x00, 0x01, 0x01, 0x65,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0xF6, 0x03, 0x8C, 0x00, 0x01, 0x01, 0xF0,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0xF1, 0x03, 0x8C, 0x00, 0x01, 0x01, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xF0, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x64,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x86, 0x04, 0x5D, 0x00, 0x01, 0x01, 0x84,
+    0x04, 0x5D, 0x00, 0x01, 0x01, 0xB8, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x8B,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x84, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x84,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x86, 0x03, 0x8C, 0x00, 0x01, 0x02, 0x41,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x84, 0x00, 0x00, 0x00, 0x01, 0x02, 0xF5,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x84, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x59,
+    0xFF, 0x31, 0x00, 0x01, 0x01, 0x59, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x59,
+    0xFE, 0xC4, 0x00, 0x01, 0x01, 0x59, 0xFF, 0x0A, 0x00, 0x01, 0x01, 0x59,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x59, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x59,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x59, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x7F, 0x02, 0xBC, 0x00, 0x01, 0x01, 0xA1,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xA1, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x53,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x53, 0xFE, 0xC4, 0x00, 0x01, 0x01, 0x53,
+    0xFF, 0x0A, 0x00, 0x01, 0x01, 0x4B, 0x04, 0x5D, 0x00, 0x01, 0x01, 0x4B,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x4D, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x53,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x4B, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x61,
+    0xFF, 0x31, 0x00, 0x01, 0x01, 0x61, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x24,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x61, 0xFE, 0xC4, 0x00, 0x01, 0x01, 0x54,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x55, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x61,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x54, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x52,
+    0x02, 0xBC, 0x00, 0x01, 0x02, 0x27, 0x00, 0x00, 0x00, 0x01, 0x02, 0x27,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x9C, 0x01, 0x5E, 0x00, 0x01, 0x02, 0xCF,
+    0x00, 0x08, 0x00, 0x01, 0x01, 0x9C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x9C,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0xA3, 0x04, 0x5D, 0x00, 0x01, 0x01, 0x9E,
+    0x04, 0x5D, 0x00, 0x01, 0x01, 0xD1, 0x03, 0x8C, 0x00, 0x01, 0x01, 0xA3,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x9D, 0x04, 0x5D, 0x00, 0x01, 0x01, 0x6D,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x9D, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x9D,
+    0x03, 0x7C, 0x00, 0x01, 0x01, 0x9D, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x9E,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x9D, 0x01, 0x5E, 0x00, 0x01, 0x02, 0xD0,
+    0x00, 0x08, 0x00, 0x01, 0x01, 0x9D, 0x00, 0x00, 0x00, 0x01, 0x03, 0x25,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x9D, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x97,
+    0xFF, 0x31, 0x00, 0x01, 0x01, 0x97, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x97,
+    0xFE, 0xC4, 0x00, 0x01, 0x01, 0x97, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x99,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x97, 0x02, 0xBC, 0x00, 0x01, 0x01, 0xBA,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0xBA, 0x00, 0x00, 0x00, 0x01, 0x01, 0xBA,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xBF, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x6B,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x33, 0xFF, 0x31, 0x00, 0x01, 0x01, 0x33,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x33, 0xFE, 0xC4, 0x00, 0x01, 0x00, 0xB9,
+    0x03, 0x8C, 0x00, 0x01, 0x00, 0xB9, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x33,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x64, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xB8,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x73, 0xFE, 0xC4, 0x00, 0x01, 0x01, 0x73,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x73, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x8D,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x52, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8D,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x2D, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x27,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x28, 0x04, 0x22, 0x00, 0x01, 0x00, 0xF7,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x27, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x28,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0xA5, 0x00, 0x00, 0x00, 0x01, 0x01, 0x27,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x27, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x8A,
+    0xFF, 0x18, 0x00, 0x01, 0x01, 0x8A, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x8A,
+    0xFF, 0x14, 0x00, 0x01, 0x01, 0x94, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x94,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x94, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x8A,
+    0x01, 0x5E, 0x00, 0x01, 0x01, 0x8A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8A,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x8B, 0xFE, 0xC4, 0x00, 0x01, 0x01, 0x9F,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x8B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x9F,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x39, 0x00, 0x00, 0x00, 0x01, 0x01, 0x39,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x64, 0x04, 0x5D, 0x00, 0x01, 0x01, 0x5F,
+    0x04, 0x5D, 0x00, 0x01, 0x01, 0x64, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x2E,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x49, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x5D,
+    0x03, 0x7C, 0x00, 0x01, 0x01, 0x49, 0xFF, 0x0A, 0x00, 0x01, 0x01, 0x5D,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x5F, 0x03, 0x8C, 0x00, 0x01, 0x02, 0x31,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x5D, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x87,
+    0xFF, 0x31, 0x00, 0x01, 0x01, 0x87, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x87,
+    0x03, 0x8C, 0x00, 0x01, 0x00, 0xCD, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x87,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x87, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x97,
+    0xFF, 0x0A, 0x00, 0x01, 0x01, 0xA4, 0x03, 0x8C, 0x00, 0x01, 0x01, 0xA6,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x97, 0x00, 0x00, 0x00, 0x01, 0x01, 0xA4,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x63, 0x00, 0x00, 0x00, 0x01, 0x01, 0x63,
+    0x02, 0xBC, 0x00, 0x01, 0x02, 0xF3, 0x03, 0x8C, 0x00, 0x01, 0x02, 0x32,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0xF1, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x5C,
+    0x04, 0x5D, 0x00, 0x01, 0x01, 0x60, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x2A,
+    0x03, 0x8C, 0x00, 0x01, 0x01, 0x5A, 0xFF, 0x18, 0x00, 0x01, 0x01, 0x5A,
+    0x03, 0x7C, 0x00, 0x01, 0x01, 0x5A, 0x03, 0x8C, 0x00, 0x01, 0x01, 0x5C,
+    0x03, 0x8C, 0x00, 0x01, 0x02, 0x7E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5A,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x5A, 0x02, 0xBC, 0x00, 0x02, 0x00, 0x13,
+    0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x25,
+    0x00, 0x2F, 0x00, 0x74, 0x00, 0x2A, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x70,
+    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x75, 0x00, 0x80, 0x01, 0x05, 0x00, 0x78,
+    0x01, 0x07, 0x01, 0x2B, 0x00, 0xFE, 0x01, 0x2D, 0x01, 0x48, 0x01, 0x23,
+    0x01, 0x4A, 0x01, 0x68, 0x01, 0x3F, 0x01, 0x6A, 0x01, 0x80, 0x01, 0x5E,
+    0x01, 0x82, 0x01, 0x84, 0x01, 0x75, 0x01, 0x86, 0x02, 0x18, 0x01, 0x78,
+    0x02, 0xB5, 0x02, 0xB5, 0x02, 0x0B, 0x02, 0xB7, 0x02, 0xB7, 0x02, 0x0C,
+    0x02, 0xB9, 0x02, 0xB9, 0x02, 0x0D, 0x02, 0xBE, 0x02, 0xBE, 0x02, 0x0E,
+    0x02, 0xC4, 0x02, 0xC6, 0x02, 0x0F, 0x02, 0xCA, 0x02, 0xCA, 0x02, 0x12,
+    0x02, 0xDE, 0x02, 0xDE, 0x02, 0x13, 0x00, 0x4F, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xCE,
+    0x00, 0x00, 0x01, 0xC8, 0x00, 0x00, 0x01, 0xC2, 0x00, 0x00, 0x01, 0xBC,
+    0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xB6,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xAA,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xCE,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xD4,
+    0x00, 0x01, 0x01, 0x9E, 0x00, 0x02, 0x01, 0x98, 0x00, 0x02, 0x01, 0x92,
+    0x00, 0x02, 0x01, 0x98, 0x00, 0x02, 0x01, 0x92, 0x00, 0x03, 0x01, 0x8C,
+    0x00, 0x02, 0x01, 0x98, 0x00, 0x02, 0x01, 0x98, 0x00, 0x04, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x74,
+    0x00, 0x00, 0x01, 0x6E, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x01, 0x62,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x5C, 0x00, 0x00, 0x01, 0x56,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x7A,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0x7A,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A,
+    0x00, 0x00, 0x01, 0x4A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x01, 0x01, 0x44,
+    0x00, 0x02, 0x01, 0x98, 0x00, 0x02, 0x01, 0x92, 0x00, 0x03, 0x01, 0x3E,
+    0x00, 0x01, 0x01, 0x49, 0x00, 0x00, 0x00, 0x01, 0x00, 0x87, 0x02, 0x17,
+    0x00, 0x01, 0x01, 0x2A, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xBE, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xBB, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xE1, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xC2, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xEA, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xF9, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xF1, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xFA, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xFB, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xFA, 0x01, 0x24, 0x00, 0x01, 0x01, 0x56, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x87, 0x02, 0x39, 0x00, 0x01, 0x01, 0x36, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xEA, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x0E, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xF9, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xBE, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xE3, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xB2, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xFB, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xFA, 0x02, 0x0D,
+    0x00, 0x02, 0x00, 0x03, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC,
+    0x03, 0x15, 0x00, 0x11, 0x03, 0x23, 0x03, 0x46, 0x00, 0x2B, 0x00, 0x02,
+    0x00, 0x08, 0x00, 0x02, 0x10, 0x48, 0x00, 0x0A, 0x00, 0x02, 0x0C, 0x48,
+    0x00, 0x04, 0x00, 0x00, 0x0E, 0x30, 0x0C, 0xAC, 0x00, 0x2E, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x14, 0xFF, 0xF6,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCB,
+    0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFB, 0xFF, 0xD3,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xD9, 0xFF, 0xEC, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xEC,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+    0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xFB, 0xFF, 0xCE, 0xFF, 0xF6, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xB5, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDD,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xD3, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE,
+    0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xB5, 0xFF, 0xCE, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xCE, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xD8, 0xFF, 0xCE,
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xDD,
+    0xFF, 0xB0, 0xFF, 0xEC, 0xFF, 0xF6, 0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xE7,
+    0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xB0, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF6, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x88, 0xFF, 0xEB, 0xFF, 0x88, 0xFF, 0xF6, 0xFF, 0xEC,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFD, 0xFF, 0xE7, 0xFF, 0xF6, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x88, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xFB, 0xFF, 0xAC,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0xFF, 0x9C, 0xFF, 0xB5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xBA, 0x00, 0x00, 0xFF, 0x8E,
+    0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9C, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xCE, 0xFF, 0x9C, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x9C, 0x00, 0x0A, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x1E,
+    0xFF, 0xD3, 0xFF, 0xB0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA,
+    0xFF, 0xBA, 0x00, 0x00, 0xFF, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0xFF, 0x9C, 0xFF, 0xEC, 0xFF, 0x9C, 0xFF, 0xF6, 0xFF, 0xF1,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1E, 0xFF, 0xF1, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF1, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xD8, 0xFF, 0xF6,
+    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xEC, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+    0xFF, 0xFD, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x32, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xEA,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xD3,
+    0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xF1, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xFC, 0x00, 0x14, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x0A, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xB5,
+    0x00, 0x08, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0x00, 0x32, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xE3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x32, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0x00, 0x28, 0x00, 0x37, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xF7, 0xFF, 0xC4, 0xFF, 0xF1,
+    0x00, 0x00, 0xFF, 0xF7, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xB0,
+    0xFF, 0xF7, 0xFF, 0xB0, 0xFF, 0xFB, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xC4,
+    0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xB5, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xEC, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0x9C, 0xFF, 0x77, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0xFF, 0xF3, 0xFF, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xDD,
+    0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF6,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xFB,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10,
+    0x00, 0x01, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x25, 0x00, 0x4D, 0x00, 0x1D,
+    0x00, 0x54, 0x00, 0x54, 0x00, 0x46, 0x00, 0x64, 0x00, 0x71, 0x00, 0x47,
+    0x00, 0x75, 0x00, 0x75, 0x00, 0x55, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x56,
+    0x00, 0x80, 0x00, 0xF1, 0x00, 0x57, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xC9,
+    0x01, 0x03, 0x01, 0x20, 0x00, 0xCA, 0x01, 0x23, 0x02, 0x11, 0x00, 0xE8,
+    0x02, 0x19, 0x02, 0x1F, 0x01, 0xD7, 0x02, 0x22, 0x02, 0x22, 0x01, 0xDE,
+    0x02, 0x69, 0x02, 0x6A, 0x01, 0xDF, 0x02, 0x8B, 0x02, 0x8D, 0x01, 0xE1,
+    0x02, 0x97, 0x02, 0x97, 0x01, 0xE4, 0x02, 0x99, 0x02, 0x9A, 0x01, 0xE5,
+    0x00, 0x02, 0x00, 0x40, 0x00, 0x01, 0x00, 0x1A, 0x00, 0x04, 0x00, 0x1B,
+    0x00, 0x1C, 0x00, 0x18, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x1E,
+    0x00, 0x24, 0x00, 0x03, 0x00, 0x25, 0x00, 0x46, 0x00, 0x02, 0x00, 0x47,
+    0x00, 0x4D, 0x00, 0x03, 0x00, 0x4E, 0x00, 0x4E, 0x00, 0x02, 0x00, 0x50,
+    0x00, 0x52, 0x00, 0x02, 0x00, 0x64, 0x00, 0x65, 0x00, 0x11, 0x00, 0x66,
+    0x00, 0x7F, 0x00, 0x02, 0x00, 0x80, 0x00, 0xA3, 0x00, 0x03, 0x00, 0xA4,
+    0x00, 0xA5, 0x00, 0x02, 0x00, 0xA6, 0x00, 0xA6, 0x00, 0x03, 0x00, 0xA7,
+    0x00, 0xAE, 0x00, 0x02, 0x00, 0xAF, 0x00, 0xB9, 0x00, 0x09, 0x00, 0xBA,
+    0x00, 0xBA, 0x00, 0x0C, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x03, 0x00, 0xBC,
+    0x00, 0xC2, 0x00, 0x0F, 0x00, 0xC3, 0x00, 0xDA, 0x00, 0x06, 0x00, 0xDB,
+    0x00, 0xDB, 0x00, 0x1B, 0x00, 0xDC, 0x00, 0xE0, 0x00, 0x12, 0x00, 0xE1,
+    0x00, 0xE1, 0x00, 0x1C, 0x00, 0xE2, 0x00, 0xEB, 0x00, 0x0B, 0x00, 0xEC,
+    0x00, 0xF0, 0x00, 0x13, 0x00, 0xF2, 0x01, 0x02, 0x00, 0x02, 0x01, 0x03,
+    0x01, 0x04, 0x00, 0x11, 0x01, 0x05, 0x01, 0x06, 0x00, 0x02, 0x01, 0x07,
+    0x01, 0x20, 0x00, 0x01, 0x01, 0x23, 0x01, 0x23, 0x00, 0x08, 0x01, 0x24,
+    0x01, 0x49, 0x00, 0x01, 0x01, 0x4A, 0x01, 0x4A, 0x00, 0x0C, 0x01, 0x4B,
+    0x01, 0x51, 0x00, 0x10, 0x01, 0x52, 0x01, 0x56, 0x00, 0x08, 0x01, 0x69,
+    0x01, 0x6B, 0x00, 0x14, 0x01, 0x6C, 0x01, 0x77, 0x00, 0x08, 0x01, 0x78,
+    0x01, 0x7B, 0x00, 0x07, 0x01, 0x7D, 0x01, 0x80, 0x00, 0x07, 0x01, 0x81,
+    0x01, 0x81, 0x00, 0x14, 0x01, 0x82, 0x01, 0x85, 0x00, 0x07, 0x01, 0x86,
+    0x01, 0xA9, 0x00, 0x01, 0x01, 0xAA, 0x01, 0xAA, 0x00, 0x1E, 0x01, 0xAB,
+    0x01, 0xAB, 0x00, 0x08, 0x01, 0xAC, 0x01, 0xAC, 0x00, 0x01, 0x01, 0xAD,
+    0x01, 0xB4, 0x00, 0x07, 0x01, 0xB5, 0x01, 0xBF, 0x00, 0x0A, 0x01, 0xC0,
+    0x01, 0xC0, 0x00, 0x0C, 0x01, 0xC1, 0x01, 0xC8, 0x00, 0x0E, 0x01, 0xC9,
+    0x01, 0xE0, 0x00, 0x05, 0x01, 0xE1, 0x01, 0xE1, 0x00, 0x20, 0x01, 0xE2,
+    0x01, 0xE6, 0x00, 0x16, 0x01, 0xE7, 0x01, 0xE7, 0x00, 0x21, 0x01, 0xE8,
+    0x01, 0xF1, 0x00, 0x0D, 0x01, 0xF2, 0x01, 0xF6, 0x00, 0x15, 0x01, 0xF8,
+    0x02, 0x11, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x0C, 0x02, 0x22,
+    0x02, 0x22, 0x00, 0x04, 0x02, 0x24, 0x02, 0x24, 0x00, 0x05, 0x02, 0x69,
+    0x02, 0x69, 0x00, 0x1F, 0x02, 0x6A, 0x02, 0x6A, 0x00, 0x1D, 0x02, 0x8B,
+    0x02, 0x8D, 0x00, 0x17, 0x02, 0x97, 0x02, 0x97, 0x00, 0x19, 0x02, 0x98,
+    0x02, 0x98, 0x00, 0x1A, 0x02, 0x99, 0x02, 0x99, 0x00, 0x19, 0x02, 0x9A,
+    0x02, 0x9A, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x57, 0x00, 0x01, 0x00, 0x1A,
+    0x00, 0x03, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x1D, 0x00, 0x1D,
+    0x00, 0x26, 0x00, 0x25, 0x00, 0x25, 0x00, 0x01, 0x00, 0x26, 0x00, 0x27,
+    0x00, 0x18, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x2D, 0x00, 0x2E,
+    0x00, 0x15, 0x00, 0x2F, 0x00, 0x45, 0x00, 0x04, 0x00, 0x46, 0x00, 0x46,
+    0x00, 0x27, 0x00, 0x47, 0x00, 0x4D, 0x00, 0x16, 0x00, 0x54, 0x00, 0x54,
+    0x00, 0x0A, 0x00, 0x64, 0x00, 0x65, 0x00, 0x0A, 0x00, 0x66, 0x00, 0x67,
+    0x00, 0x20, 0x00, 0x68, 0x00, 0x68, 0x00, 0x11, 0x00, 0x69, 0x00, 0x69,
+    0x00, 0x0A, 0x00, 0x6A, 0x00, 0x6E, 0x00, 0x11, 0x00, 0x6F, 0x00, 0x6F,
+    0x00, 0x0C, 0x00, 0x70, 0x00, 0x71, 0x00, 0x11, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x0A, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0C, 0x00, 0x80, 0x00, 0xA2,
+    0x00, 0x01, 0x00, 0xA3, 0x00, 0xA3, 0x00, 0x04, 0x00, 0xA4, 0x00, 0xA5,
+    0x00, 0x21, 0x00, 0xA6, 0x00, 0xA6, 0x00, 0x01, 0x00, 0xA7, 0x00, 0xAE,
+    0x00, 0x12, 0x00, 0xAF, 0x00, 0xBA, 0x00, 0x0B, 0x00, 0xBB, 0x00, 0xBB,
+    0x00, 0x01, 0x00, 0xBC, 0x00, 0xC2, 0x00, 0x17, 0x00, 0xC3, 0x00, 0xDA,
+    0x00, 0x05, 0x00, 0xDB, 0x00, 0xDB, 0x00, 0x28, 0x00, 0xDC, 0x00, 0xE0,
+    0x00, 0x1B, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0x29, 0x00, 0xE2, 0x00, 0xEB,
+    0x00, 0x0E, 0x00, 0xEC, 0x00, 0xF0, 0x00, 0x18, 0x00, 0xF1, 0x00, 0xF1,
+    0x00, 0x0A, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x0A, 0x01, 0x03, 0x01, 0x06,
+    0x00, 0x0A, 0x01, 0x23, 0x01, 0x23, 0x00, 0x02, 0x01, 0x24, 0x01, 0x2A,
+    0x00, 0x19, 0x01, 0x2B, 0x01, 0x2B, 0x00, 0x1D, 0x01, 0x2C, 0x01, 0x2C,
+    0x00, 0x01, 0x01, 0x2D, 0x01, 0x2D, 0x00, 0x23, 0x01, 0x2E, 0x01, 0x30,
+    0x00, 0x1D, 0x01, 0x31, 0x01, 0x31, 0x00, 0x15, 0x01, 0x32, 0x01, 0x48,
+    0x00, 0x06, 0x01, 0x49, 0x01, 0x49, 0x00, 0x02, 0x01, 0x4A, 0x01, 0x4A,
+    0x00, 0x24, 0x01, 0x4B, 0x01, 0x51, 0x00, 0x1A, 0x01, 0x52, 0x01, 0x56,
+    0x00, 0x09, 0x01, 0x57, 0x01, 0x64, 0x00, 0x08, 0x01, 0x65, 0x01, 0x65,
+    0x00, 0x0C, 0x01, 0x66, 0x01, 0x68, 0x00, 0x08, 0x01, 0x69, 0x01, 0x6B,
+    0x00, 0x0C, 0x01, 0x6C, 0x01, 0x6E, 0x00, 0x1F, 0x01, 0x6F, 0x01, 0x70,
+    0x00, 0x0F, 0x01, 0x71, 0x01, 0x71, 0x00, 0x23, 0x01, 0x72, 0x01, 0x77,
+    0x00, 0x0F, 0x01, 0x78, 0x01, 0x81, 0x00, 0x09, 0x01, 0x82, 0x01, 0x82,
+    0x00, 0x0C, 0x01, 0x83, 0x01, 0x85, 0x00, 0x09, 0x01, 0x86, 0x01, 0xA8,
+    0x00, 0x02, 0x01, 0xA9, 0x01, 0xA9, 0x00, 0x06, 0x01, 0xAA, 0x01, 0xAB,
+    0x00, 0x02, 0x01, 0xAC, 0x01, 0xAC, 0x00, 0x2A, 0x01, 0xAD, 0x01, 0xB4,
+    0x00, 0x13, 0x01, 0xB5, 0x01, 0xBF, 0x00, 0x0D, 0x01, 0xC0, 0x01, 0xC0,
+    0x00, 0x02, 0x01, 0xC1, 0x01, 0xC8, 0x00, 0x14, 0x01, 0xC9, 0x01, 0xE0,
+    0x00, 0x07, 0x01, 0xE1, 0x01, 0xE1, 0x00, 0x2C, 0x01, 0xE2, 0x01, 0xE6,
+    0x00, 0x1C, 0x01, 0xE7, 0x01, 0xE7, 0x00, 0x2D, 0x01, 0xE8, 0x01, 0xF1,
+    0x00, 0x10, 0x01, 0xF2, 0x01, 0xF6, 0x00, 0x15, 0x01, 0xF7, 0x01, 0xF7,
+    0x00, 0x0C, 0x02, 0x19, 0x02, 0x19, 0x00, 0x24, 0x02, 0x1A, 0x02, 0x1B,
+    0x00, 0x0C, 0x02, 0x1C, 0x02, 0x1C, 0x00, 0x0F, 0x02, 0x1D, 0x02, 0x1D,
+    0x00, 0x0C, 0x02, 0x1E, 0x02, 0x1E, 0x00, 0x08, 0x02, 0x1F, 0x02, 0x1F,
+    0x00, 0x0F, 0x02, 0x22, 0x02, 0x22, 0x00, 0x03, 0x02, 0x69, 0x02, 0x6A,
+    0x00, 0x22, 0x02, 0x8B, 0x02, 0x8D, 0x00, 0x1E, 0x02, 0x97, 0x02, 0x97,
+    0x00, 0x25, 0x02, 0x99, 0x02, 0x99, 0x00, 0x25, 0x02, 0x9A, 0x02, 0x9A,
+    0x00, 0x2B, 0x00, 0x01, 0x02, 0xCA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x60,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xE2, 0x1A, 0xD4, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA,
+    0x1A, 0xAA, 0x19, 0xD8, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xB8,
+    0x19, 0xB8, 0x19, 0x96, 0x19, 0xC6, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96,
+    0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0xC6, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x19, 0x84, 0x19, 0x4A,
+    0x19, 0x30, 0x19, 0x1E, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C,
+    0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x1A, 0xBE, 0x18, 0xF6, 0x18, 0xF6,
+    0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xC8,
+    0x18, 0xBA, 0x18, 0xBA, 0x18, 0xBA, 0x18, 0xBA, 0x18, 0xBA, 0x18, 0xB4,
+    0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6,
+    0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x19, 0xC6, 0x19, 0xC6,
+    0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0x8E, 0x18, 0x64, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x18, 0x8E, 0x18, 0x52, 0x18, 0x48, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x1A, 0xB8, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x36, 0x18, 0x2C,
+    0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C,
+    0x18, 0x2C, 0x18, 0x06, 0x17, 0xE0, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2,
+    0x17, 0xD2, 0x17, 0xD2, 0x17, 0xBC, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE,
+    0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE,
+    0x17, 0xAE, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0x52, 0x1A, 0xEC, 0x17, 0xA4, 0x17, 0x9E,
+    0x17, 0x94, 0x17, 0x8A, 0x17, 0x7C, 0x17, 0x72, 0x17, 0x6C, 0x17, 0x42,
+    0x17, 0x3C, 0x17, 0x32, 0x16, 0xCC, 0x16, 0x66, 0x16, 0x60, 0x15, 0xDE,
+    0x15, 0xD0, 0x15, 0xC2, 0x15, 0xBC, 0x15, 0x46, 0x11, 0x90, 0x0E, 0x46,
+    0x0E, 0x34, 0x0B, 0x22, 0x08, 0x20, 0x07, 0xFA, 0x07, 0xC4, 0x05, 0x2E,
+    0x04, 0xB0, 0x04, 0xB0, 0x04, 0xA6, 0x04, 0x00, 0x03, 0xF2, 0x03, 0xE4,
+    0x03, 0xDE, 0x03, 0xD8, 0x03, 0xD2, 0x03, 0xC4, 0x00, 0x02, 0x00, 0x29,
+    0x00, 0x01, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1A,
+    0x00, 0x25, 0x00, 0x25, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x2E, 0x00, 0x1D,
+    0x00, 0x47, 0x00, 0x4D, 0x00, 0x24, 0x00, 0x53, 0x00, 0x54, 0x00, 0x2B,
+    0x00, 0x64, 0x00, 0x6E, 0x00, 0x2D, 0x00, 0x70, 0x00, 0x71, 0x00, 0x38,
+    0x00, 0x75, 0x00, 0x75, 0x00, 0x3A, 0x00, 0x80, 0x00, 0xA2, 0x00, 0x3B,
+    0x00, 0xA4, 0x00, 0xAE, 0x00, 0x5E, 0x00, 0xBB, 0x00, 0xC2, 0x00, 0x69,
+    0x00, 0xDB, 0x00, 0xEB, 0x00, 0x71, 0x00, 0xF1, 0x00, 0xF1, 0x00, 0x82,
+    0x00, 0xF3, 0x00, 0xF3, 0x00, 0x83, 0x01, 0x03, 0x01, 0x20, 0x00, 0x84,
+    0x01, 0x23, 0x01, 0x23, 0x00, 0xA2, 0x01, 0x2C, 0x01, 0x2C, 0x00, 0xA3,
+    0x01, 0x31, 0x01, 0x56, 0x00, 0xA4, 0x01, 0x6C, 0x01, 0x6E, 0x00, 0xCA,
+    0x01, 0x78, 0x01, 0x81, 0x00, 0xCD, 0x01, 0x83, 0x01, 0xB4, 0x00, 0xD7,
+    0x01, 0xC0, 0x01, 0xC0, 0x01, 0x09, 0x01, 0xE1, 0x01, 0xF6, 0x01, 0x0A,
+    0x01, 0xF8, 0x02, 0x11, 0x01, 0x20, 0x02, 0x19, 0x02, 0x19, 0x01, 0x3A,
+    0x02, 0x22, 0x02, 0x22, 0x01, 0x3B, 0x02, 0x26, 0x02, 0x2F, 0x01, 0x3C,
+    0x02, 0x69, 0x02, 0x6A, 0x01, 0x46, 0x02, 0x6F, 0x02, 0x74, 0x01, 0x48,
+    0x02, 0x76, 0x02, 0x77, 0x01, 0x4E, 0x02, 0x85, 0x02, 0x85, 0x01, 0x50,
+    0x02, 0x89, 0x02, 0x89, 0x01, 0x51, 0x02, 0x8B, 0x02, 0x8D, 0x01, 0x52,
+    0x02, 0x98, 0x02, 0x9A, 0x01, 0x55, 0x02, 0xA6, 0x02, 0xA7, 0x01, 0x58,
+    0x02, 0xC9, 0x02, 0xC9, 0x01, 0x5A, 0x02, 0xD4, 0x02, 0xD5, 0x01, 0x5B,
+    0x02, 0xDD, 0x02, 0xDD, 0x01, 0x5D, 0x02, 0xDF, 0x02, 0xDF, 0x01, 0x5E,
+    0x02, 0xE1, 0x02, 0xE1, 0x01, 0x5F, 0x00, 0x03, 0x02, 0x26, 0xFF, 0xCE,
+    0x02, 0x2E, 0xFF, 0xE2, 0x02, 0x2F, 0xFF, 0xD8, 0x00, 0x01, 0x02, 0x2A,
+    0xFF, 0xB0, 0x00, 0x01, 0x02, 0x27, 0xFF, 0xD8, 0x00, 0x01, 0x02, 0x27,
+    0xFF, 0xEC, 0x00, 0x03, 0x02, 0x27, 0xFF, 0xC4, 0x02, 0x28, 0xFF, 0xE2,
+    0x02, 0x2D, 0xFF, 0xCE, 0x00, 0x03, 0x02, 0x26, 0xFF, 0xD8, 0x02, 0x27,
+    0xFF, 0xE2, 0x02, 0x2A, 0xFF, 0xE2, 0x00, 0x29, 0x00, 0xBC, 0xFF, 0xC9,
+    0x00, 0xBD, 0xFF, 0xC9, 0x00, 0xBE, 0xFF, 0xC9, 0x00, 0xBF, 0xFF, 0xC9,
+    0x00, 0xC0, 0xFF, 0xC9, 0x00, 0xC1, 0xFF, 0xC9, 0x00, 0xC2, 0xFF, 0xC9,
+    0x00, 0xDB, 0xFF, 0xC4, 0x00, 0xDC, 0xFF, 0xD8, 0x00, 0xDD, 0xFF, 0xD8,
+    0x00, 0xDE, 0xFF, 0xD8, 0x00, 0xDF, 0xFF, 0xD8, 0x00, 0xE0, 0xFF, 0xD8,
+    0x00, 0xE2, 0xFF, 0xCE, 0x00, 0xE3, 0xFF, 0xCE, 0x00, 0xE4, 0xFF, 0xCE,
+    0x00, 0xE5, 0xFF, 0xCE, 0x00, 0xE6, 0xFF, 0xCE, 0x00, 0xE7, 0xFF, 0xCE,
+    0x00, 0xE8, 0xFF, 0xCE, 0x00, 0xE9, 0xFF, 0xCE, 0x00, 0xEA, 0xFF, 0xCE,
+    0x00, 0xEB, 0xFF, 0xCE, 0x01, 0x2C, 0xFF, 0xF6, 0x01, 0xE1, 0xFF, 0xE2,
+    0x01, 0xE2, 0xFF, 0xE2, 0x01, 0xE3, 0xFF, 0xE2, 0x01, 0xE4, 0xFF, 0xE2,
+    0x01, 0xE5, 0xFF, 0xE2, 0x01, 0xE6, 0xFF, 0xE2, 0x01, 0xE8, 0xFF, 0xE2,
+    0x01, 0xE9, 0xFF, 0xE2, 0x01, 0xEA, 0xFF, 0xE2, 0x01, 0xEB, 0xFF, 0xE2,
+    0x01, 0xEC, 0xFF, 0xE2, 0x01, 0xED, 0xFF, 0xE2, 0x01, 0xEE, 0xFF, 0xE2,
+    0x01, 0xEF, 0xFF, 0xE2, 0x01, 0xF0, 0xFF, 0xE2, 0x01, 0xF1, 0xFF, 0xE2,
+    0x02, 0x8A, 0xFF, 0xF1, 0x00, 0x02, 0x00, 0xDB, 0xFF, 0xFA, 0x01, 0xE7,
+    0xFF, 0xFD, 0x00, 0x1F, 0x00, 0x01, 0xFF, 0xC4, 0x00, 0x02, 0xFF, 0xC4,
+    0x00, 0x03, 0xFF, 0xC4, 0x00, 0x04, 0xFF, 0xC4, 0x00, 0x05, 0xFF, 0xC4,
+    0x00, 0x06, 0xFF, 0xC4, 0x00, 0x07, 0xFF, 0xC4, 0x00, 0x08, 0xFF, 0xC4,
+    0x00, 0x09, 0xFF, 0xC4, 0x00, 0x0A, 0xFF, 0xC4, 0x00, 0x0B, 0xFF, 0xC4,
+    0x00, 0x0C, 0xFF, 0xC4, 0x00, 0x0D, 0xFF, 0xC4, 0x00, 0x0E, 0xFF, 0xC4,
+    0x00, 0x0F, 0xFF, 0xC4, 0x00, 0x10, 0xFF, 0xC4, 0x00, 0x11, 0xFF, 0xC4,
+    0x00, 0x12, 0xFF, 0xC4, 0x00, 0x13, 0xFF, 0xC4, 0x00, 0x14, 0xFF, 0xC4,
+    0x00, 0x15, 0xFF, 0xC4, 0x00, 0x16, 0xFF, 0xC4, 0x00, 0x17, 0xFF, 0xC4,
+    0x00, 0x18, 0xFF, 0xC4, 0x00, 0x19, 0xFF, 0xC4, 0x00, 0x1A, 0xFF, 0xC4,
+    0x00, 0x64, 0xFF, 0x88, 0x00, 0x65, 0xFF, 0x88, 0x01, 0x03, 0xFF, 0x88,
+    0x01, 0x04, 0xFF, 0x88, 0x02, 0x22, 0xFF, 0xC4, 0x00, 0xA5, 0x00, 0x01,
+    0xFF, 0xB5, 0x00, 0x02, 0xFF, 0xB5, 0x00, 0x03, 0xFF, 0xB5, 0x00, 0x04,
+    0xFF, 0xB5, 0x00, 0x05, 0xFF, 0xB5, 0x00, 0x06, 0xFF, 0xB5, 0x00, 0x07,
+    0xFF, 0xB5, 0x00, 0x08, 0xFF, 0xB5, 0x00, 0x09, 0xFF, 0xB5, 0x00, 0x0A,
+    0xFF, 0xB5, 0x00, 0x0B, 0xFF, 0xB5, 0x00, 0x0C, 0xFF, 0xB5, 0x00, 0x0D,
+    0xFF, 0xB5, 0x00, 0x0E, 0xFF, 0xB5, 0x00, 0x0F, 0xFF, 0xB5, 0x00, 0x10,
+    0xFF, 0xB5, 0x00, 0x11, 0xFF, 0xB5, 0x00, 0x12, 0xFF, 0xB5, 0x00, 0x13,
+    0xFF, 0xB5, 0x00, 0x14, 0xFF, 0xB5, 0x00, 0x15, 0xFF, 0xB5, 0x00, 0x16,
+    0xFF, 0xB5, 0x00, 0x17, 0xFF, 0xB5, 0x00, 0x18, 0xFF, 0xB5, 0x00, 0x19,
+    0xFF, 0xB5, 0x00, 0x1A, 0xFF, 0xB5, 0x00, 0x64, 0xFF, 0x9C, 0x00, 0x65,
+    0xFF, 0x9C, 0x01, 0x03, 0xFF, 0x9C, 0x01, 0x04, 0xFF, 0x9C, 0x01, 0x07,
+    0xFF, 0xD8, 0x01, 0x08, 0xFF, 0xD8, 0x01, 0x09, 0xFF, 0xD8, 0x01, 0x0A,
+    0xFF, 0xD8, 0x01, 0x0B, 0xFF, 0xD8, 0x01, 0x0C, 0xFF, 0xD8, 0x01, 0x0D,
+    0xFF, 0xD8, 0x01, 0x0E, 0xFF, 0xD8, 0x01, 0x0F, 0xFF, 0xD8, 0x01, 0x10,
+    0xFF, 0xD8, 0x01, 0x11, 0xFF, 0xD8, 0x01, 0x12, 0xFF, 0xD8, 0x01, 0x13,
+    0xFF, 0xD8, 0x01, 0x14, 0xFF, 0xD8, 0x01, 0x15, 0xFF, 0xD8, 0x01, 0x16,
+    0xFF, 0xD8, 0x01, 0x17, 0xFF, 0xD8, 0x01, 0x18, 0xFF, 0xD8, 0x01, 0x19,
+    0xFF, 0xD8, 0x01, 0x1A, 0xFF, 0xD8, 0x01, 0x1B, 0xFF, 0xD8, 0x01, 0x1C,
+    0xFF, 0xD8, 0x01, 0x1D, 0xFF, 0xD8, 0x01, 0x1E, 0xFF, 0xD8, 0x01, 0x1F,
+    0xFF, 0xD8, 0x01, 0x20, 0xFF, 0xD8, 0x01, 0x24, 0xFF, 0xD8, 0x01, 0x25,
+    0xFF, 0xD8, 0x01, 0x26, 0xFF, 0xD8, 0x01, 0x27, 0xFF, 0xD8, 0x01, 0x28,
+    0xFF, 0xD8, 0x01, 0x29, 0xFF, 0xD8, 0x01, 0x2A, 0xFF, 0xD8, 0x01, 0x2B,
+    0xFF, 0xD8, 0x01, 0x2C, 0xFF, 0xD8, 0x01, 0x2D, 0xFF, 0xD8, 0x01, 0x2E,
+    0xFF, 0xD8, 0x01, 0x2F, 0xFF, 0xD8, 0x01, 0x30, 0xFF, 0xD8, 0x01, 0x31,
+    0xFF, 0xD8, 0x01, 0x32, 0xFF, 0xD8, 0x01, 0x33, 0xFF, 0xD8, 0x01, 0x34,
+    0xFF, 0xD8, 0x01, 0x35, 0xFF, 0xD8, 0x01, 0x36, 0xFF, 0xD8, 0x01, 0x37,
+    0xFF, 0xD8, 0x01, 0x38, 0xFF, 0xD8, 0x01, 0x39, 0xFF, 0xD8, 0x01, 0x3A,
+    0xFF, 0xD8, 0x01, 0x3B, 0xFF, 0xD8, 0x01, 0x3C, 0xFF, 0xD8, 0x01, 0x3D,
+    0xFF, 0xD8, 0x01, 0x3E, 0xFF, 0xD8, 0x01, 0x3F, 0xFF, 0xD8, 0x01, 0x40,
+    0xFF, 0xD8, 0x01, 0x41, 0xFF, 0xD8, 0x01, 0x42, 0xFF, 0xD8, 0x01, 0x43,
+    0xFF, 0xD8, 0x01, 0x44, 0xFF, 0xD8, 0x01, 0x45, 0xFF, 0xD8, 0x01, 0x46,
+    0xFF, 0xD8, 0x01, 0x47, 0xFF, 0xD8, 0x01, 0x48, 0xFF, 0xD8, 0x01, 0x49,
+    0xFF, 0xD8, 0x01, 0x4B, 0xFF, 0xCE, 0x01, 0x4C, 0xFF, 0xCE, 0x01, 0x4D,
+    0xFF, 0xCE, 0x01, 0x4E, 0xFF, 0xCE, 0x01, 0x4F, 0xFF, 0xCE, 0x01, 0x50,
+    0xFF, 0xCE, 0x01, 0x51, 0xFF, 0xCE, 0x01, 0x86, 0xFF, 0xD8, 0x01, 0x87,
+    0xFF, 0xD8, 0x01, 0x88, 0xFF, 0xD8, 0x01, 0x89, 0xFF, 0xD8, 0x01, 0x8A,
+    0xFF, 0xD8, 0x01, 0x8B, 0xFF, 0xD8, 0x01, 0x8C, 0xFF, 0xD8, 0x01, 0x8D,
+    0xFF, 0xD8, 0x01, 0x8E, 0xFF, 0xD8, 0x01, 0x8F, 0xFF, 0xD8, 0x01, 0x90,
+    0xFF, 0xD8, 0x01, 0x91, 0xFF, 0xD8, 0x01, 0x92, 0xFF, 0xD8, 0x01, 0x93,
+    0xFF, 0xD8, 0x01, 0x94, 0xFF, 0xD8, 0x01, 0x95, 0xFF, 0xD8, 0x01, 0x96,
+    0xFF, 0xD8, 0x01, 0x97, 0xFF, 0xD8, 0x01, 0x98, 0xFF, 0xD8, 0x01, 0x99,
+    0xFF, 0xD8, 0x01, 0x9A, 0xFF, 0xD8, 0x01, 0x9B, 0xFF, 0xD8, 0x01, 0x9C,
+    0xFF, 0xD8, 0x01, 0x9D, 0xFF, 0xD8, 0x01, 0x9E, 0xFF, 0xD8, 0x01, 0x9F,
+    0xFF, 0xD8, 0x01, 0xA0, 0xFF, 0xD8, 0x01, 0xA1, 0xFF, 0xD8, 0x01, 0xA2,
+    0xFF, 0xD8, 0x01, 0xA3, 0xFF, 0xD8, 0x01, 0xA4, 0xFF, 0xD8, 0x01, 0xA5,
+    0xFF, 0xD8, 0x01, 0xA6, 0xFF, 0xD8, 0x01, 0xA7, 0xFF, 0xD8, 0x01, 0xA8,
+    0xFF, 0xD8, 0x01, 0xA9, 0xFF, 0xD8, 0x01, 0xAC, 0xFF, 0xD8, 0x01, 0xF8,
+    0xFF, 0xD8, 0x01, 0xF9, 0xFF, 0xD8, 0x01, 0xFA, 0xFF, 0xD8, 0x01, 0xFB,
+    0xFF, 0xD8, 0x01, 0xFC, 0xFF, 0xD8, 0x01, 0xFD, 0xFF, 0xD8, 0x01, 0xFE,
+    0xFF, 0xD8, 0x01, 0xFF, 0xFF, 0xD8, 0x02, 0x00, 0xFF, 0xD8, 0x02, 0x01,
+    0xFF, 0xD8, 0x02, 0x02, 0xFF, 0xD8, 0x02, 0x03, 0xFF, 0xD8, 0x02, 0x04,
+    0xFF, 0xD8, 0x02, 0x05, 0xFF, 0xD8, 0x02, 0x06, 0xFF, 0xD8, 0x02, 0x07,
+    0xFF, 0xD8, 0x02, 0x08, 0xFF, 0xD8, 0x02, 0x09, 0xFF, 0xD8, 0x02, 0x0A,
+    0xFF, 0xD8, 0x02, 0x0B, 0xFF, 0xD8, 0x02, 0x0C, 0xFF, 0xD8, 0x02, 0x0D,
+    0xFF, 0xD8, 0x02, 0x0E, 0xFF, 0xD8, 0x02, 0x0F, 0xFF, 0xD8, 0x02, 0x10,
+    0xFF, 0xD8, 0x02, 0x11, 0xFF, 0xD8, 0x02, 0x22, 0xFF, 0xB5, 0x00, 0x0D,
+    0x00, 0x01, 0xFF, 0xCE, 0x00, 0x64, 0xFF, 0xC4, 0x00, 0x65, 0xFF, 0xC4,
+    0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA,
+    0x00, 0xE1, 0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88, 0x01, 0x03, 0xFF, 0xC4,
+    0x01, 0x04, 0xFF, 0xC4, 0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE,
+    0x02, 0x81, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0xBC,
+    0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1,
+    0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88, 0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28,
+    0xFF, 0xCE, 0x02, 0x81, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xFF, 0xCE,
+    0x00, 0x1E, 0xFF, 0xE7, 0x00, 0x1F, 0xFF, 0xE7, 0x00, 0x20, 0xFF, 0xE7,
+    0x00, 0x21, 0xFF, 0xE7, 0x00, 0x22, 0xFF, 0xE7, 0x00, 0x23, 0xFF, 0xE7,
+    0x00, 0x24, 0xFF, 0xE7, 0x00, 0x47, 0xFF, 0xE7, 0x00, 0x48, 0xFF, 0xE7,
+    0x00, 0x49, 0xFF, 0xE7, 0x00, 0x4A, 0xFF, 0xE7, 0x00, 0x4B, 0xFF, 0xE7,
+    0x00, 0x4C, 0xFF, 0xE7, 0x00, 0x4D, 0xFF, 0xE7, 0x00, 0x64, 0xFF, 0xCE,
+    0x00, 0x65, 0xFF, 0xCE, 0x00, 0x80, 0xFF, 0xE7, 0x00, 0x81, 0xFF, 0xE7,
+    0x00, 0x82, 0xFF, 0xE7, 0x00, 0x83, 0xFF, 0xE7, 0x00, 0x84, 0xFF, 0xE7,
+    0x00, 0x85, 0xFF, 0xE7, 0x00, 0x86, 0xFF, 0xE7, 0x00, 0x87, 0xFF, 0xE7,
+    0x00, 0x88, 0xFF, 0xE7, 0x00, 0x89, 0xFF, 0xE7, 0x00, 0x8A, 0xFF, 0xE7,
+    0x00, 0x8B, 0xFF, 0xE7, 0x00, 0x8C, 0xFF, 0xE7, 0x00, 0x8D, 0xFF, 0xE7,
+    0x00, 0x8E, 0xFF, 0xE7, 0x00, 0x8F, 0xFF, 0xE7, 0x00, 0x90, 0xFF, 0xE7,
+    0x00, 0x91, 0xFF, 0xE7, 0x00, 0x92, 0xFF, 0xE7, 0x00, 0x93, 0xFF, 0xE7,
+    0x00, 0x94, 0xFF, 0xE7, 0x00, 0x95, 0xFF, 0xE7, 0x00, 0x96, 0xFF, 0xE7,
+    0x00, 0x97, 0xFF, 0xE7, 0x00, 0x98, 0xFF, 0xE7, 0x00, 0x99, 0xFF, 0xE7,
+    0x00, 0x9A, 0xFF, 0xE7, 0x00, 0x9B, 0xFF, 0xE7, 0x00, 0x9C, 0xFF, 0xE7,
+    0x00, 0x9D, 0xFF, 0xE7, 0x00, 0x9E, 0xFF, 0xE7, 0x00, 0x9F, 0xFF, 0xE7,
+    0x00, 0xA0, 0xFF, 0xE7, 0x00, 0xA1, 0xFF, 0xE7, 0x00, 0xA2, 0xFF, 0xE7,
+    0x00, 0xA3, 0xFF, 0xE7, 0x00, 0xA6, 0xFF, 0xE7, 0x00, 0xBB, 0xFF, 0xE7,
+    0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA,
+    0x00, 0xE1, 0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88, 0x01, 0x03, 0xFF, 0xCE,
+    0x01, 0x04, 0xFF, 0xCE, 0x01, 0x07, 0xFF, 0xE7, 0x01, 0x08, 0xFF, 0xE7,
+    0x01, 0x09, 0xFF, 0xE7, 0x01, 0x0A, 0xFF, 0xE7, 0x01, 0x0B, 0xFF, 0xE7,
+    0x01, 0x0C, 0xFF, 0xE7, 0x01, 0x0D, 0xFF, 0xE7, 0x01, 0x0E, 0xFF, 0xE7,
+    0x01, 0x0F, 0xFF, 0xE7, 0x01, 0x10, 0xFF, 0xE7, 0x01, 0x11, 0xFF, 0xE7,
+    0x01, 0x12, 0xFF, 0xE7, 0x01, 0x13, 0xFF, 0xE7, 0x01, 0x14, 0xFF, 0xE7,
+    0x01, 0x15, 0xFF, 0xE7, 0x01, 0x16, 0xFF, 0xE7, 0x01, 0x17, 0xFF, 0xE7,
+    0x01, 0x18, 0xFF, 0xE7, 0x01, 0x19, 0xFF, 0xE7, 0x01, 0x1A, 0xFF, 0xE7,
+    0x01, 0x1B, 0xFF, 0xE7, 0x01, 0x1C, 0xFF, 0xE7, 0x01, 0x1D, 0xFF, 0xE7,
+    0x01, 0x1E, 0xFF, 0xE7, 0x01, 0x1F, 0xFF, 0xE7, 0x01, 0x20, 0xFF, 0xE7,
+    0x01, 0x24, 0xFF, 0xE7, 0x01, 0x25, 0xFF, 0xE7, 0x01, 0x26, 0xFF, 0xE7,
+    0x01, 0x27, 0xFF, 0xE7, 0x01, 0x28, 0xFF, 0xE7, 0x01, 0x29, 0xFF, 0xE7,
+    0x01, 0x2A, 0xFF, 0xE7, 0x01, 0x2B, 0xFF, 0xE7, 0x01, 0x2C, 0xFF, 0xE7,
+    0x01, 0x2D, 0xFF, 0xE7, 0x01, 0x2E, 0xFF, 0xE7, 0x01, 0x2F, 0xFF, 0xE7,
+    0x01, 0x30, 0xFF, 0xE7, 0x01, 0x31, 0xFF, 0xE7, 0x01, 0x32, 0xFF, 0xE7,
+    0x01, 0x33, 0xFF, 0xE7, 0x01, 0x34, 0xFF, 0xE7, 0x01, 0x35, 0xFF, 0xE7,
+    0x01, 0x36, 0xFF, 0xE7, 0x01, 0x37, 0xFF, 0xE7, 0x01, 0x38, 0xFF, 0xE7,
+    0x01, 0x39, 0xFF, 0xE7, 0x01, 0x3A, 0xFF, 0xE7, 0x01, 0x3B, 0xFF, 0xE7,
+    0x01, 0x3C, 0xFF, 0xE7, 0x01, 0x3D, 0xFF, 0xE7, 0x01, 0x3E, 0xFF, 0xE7,
+    0x01, 0x3F, 0xFF, 0xE7, 0x01, 0x40, 0xFF, 0xE7, 0x01, 0x41, 0xFF, 0xE7,
+    0x01, 0x42, 0xFF, 0xE7, 0x01, 0x43, 0xFF, 0xE7, 0x01, 0x44, 0xFF, 0xE7,
+    0x01, 0x45, 0xFF, 0xE7, 0x01, 0x46, 0xFF, 0xE7, 0x01, 0x47, 0xFF, 0xE7,
+    0x01, 0x48, 0xFF, 0xE7, 0x01, 0x49, 0xFF, 0xE7, 0x01, 0x86, 0xFF, 0xE7,
+    0x01, 0x87, 0xFF, 0xE7, 0x01, 0x88, 0xFF, 0xE7, 0x01, 0x89, 0xFF, 0xE7,
+    0x01, 0x8A, 0xFF, 0xE7, 0x01, 0x8B, 0xFF, 0xE7, 0x01, 0x8C, 0xFF, 0xE7,
+    0x01, 0x8D, 0xFF, 0xE7, 0x01, 0x8E, 0xFF, 0xE7, 0x01, 0x8F, 0xFF, 0xE7,
+    0x01, 0x90, 0xFF, 0xE7, 0x01, 0x91, 0xFF, 0xE7, 0x01, 0x92, 0xFF, 0xE7,
+    0x01, 0x93, 0xFF, 0xE7, 0x01, 0x94, 0xFF, 0xE7, 0x01, 0x95, 0xFF, 0xE7,
+    0x01, 0x96, 0xFF, 0xE7, 0x01, 0x97, 0xFF, 0xE7, 0x01, 0x98, 0xFF, 0xE7,
+    0x01, 0x99, 0xFF, 0xE7, 0x01, 0x9A, 0xFF, 0xE7, 0x01, 0x9B, 0xFF, 0xE7,
+    0x01, 0x9C, 0xFF, 0xE7, 0x01, 0x9D, 0xFF, 0xE7, 0x01, 0x9E, 0xFF, 0xE7,
+    0x01, 0x9F, 0xFF, 0xE7, 0x01, 0xA0, 0xFF, 0xE7, 0x01, 0xA1, 0xFF, 0xE7,
+    0x01, 0xA2, 0xFF, 0xE7, 0x01, 0xA3, 0xFF, 0xE7, 0x01, 0xA4, 0xFF, 0xE7,
+    0x01, 0xA5, 0xFF, 0xE7, 0x01, 0xA6, 0xFF, 0xE7, 0x01, 0xA7, 0xFF, 0xE7,
+    0x01, 0xA8, 0xFF, 0xE7, 0x01, 0xA9, 0xFF, 0xE7, 0x01, 0xAC, 0xFF, 0xE7,
+    0x01, 0xF8, 0xFF, 0xE7, 0x01, 0xF9, 0xFF, 0xE7, 0x01, 0xFA, 0xFF, 0xE7,
+    0x01, 0xFB, 0xFF, 0xE7, 0x01, 0xFC, 0xFF, 0xE7, 0x01, 0xFD, 0xFF, 0xE7,
+    0x01, 0xFE, 0xFF, 0xE7, 0x01, 0xFF, 0xFF, 0xE7, 0x02, 0x00, 0xFF, 0xE7,
+    0x02, 0x01, 0xFF, 0xE7, 0x02, 0x02, 0xFF, 0xE7, 0x02, 0x03, 0xFF, 0xE7,
+    0x02, 0x04, 0xFF, 0xE7, 0x02, 0x05, 0xFF, 0xE7, 0x02, 0x06, 0xFF, 0xE7,
+    0x02, 0x07, 0xFF, 0xE7, 0x02, 0x08, 0xFF, 0xE7, 0x02, 0x09, 0xFF, 0xE7,
+    0x02, 0x0A, 0xFF, 0xE7, 0x02, 0x0B, 0xFF, 0xE7, 0x02, 0x0C, 0xFF, 0xE7,
+    0x02, 0x0D, 0xFF, 0xE7, 0x02, 0x0E, 0xFF, 0xE7, 0x02, 0x0F, 0xFF, 0xE7,
+    0x02, 0x10, 0xFF, 0xE7, 0x02, 0x11, 0xFF, 0xE7, 0x02, 0x27, 0xFF, 0xD8,
+    0x02, 0x28, 0xFF, 0xCE, 0x02, 0x81, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x1E,
+    0xFF, 0xE2, 0x00, 0x1F, 0xFF, 0xE2, 0x00, 0x20, 0xFF, 0xE2, 0x00, 0x21,
+    0xFF, 0xE2, 0x00, 0x22, 0xFF, 0xE2, 0x00, 0x23, 0xFF, 0xE2, 0x00, 0x24,
+    0xFF, 0xE2, 0x00, 0x47, 0xFF, 0xE2, 0x00, 0x48, 0xFF, 0xE2, 0x00, 0x49,
+    0xFF, 0xE2, 0x00, 0x4A, 0xFF, 0xE2, 0x00, 0x4B, 0xFF, 0xE2, 0x00, 0x4C,
+    0xFF, 0xE2, 0x00, 0x4D, 0xFF, 0xE2, 0x00, 0x64, 0xFF, 0xD8, 0x00, 0x65,
+    0xFF, 0xD8, 0x00, 0x80, 0xFF, 0xE2, 0x00, 0x81, 0xFF, 0xE2, 0x00, 0x82,
+    0xFF, 0xE2, 0x00, 0x83, 0xFF, 0xE2, 0x00, 0x84, 0xFF, 0xE2, 0x00, 0x85,
+    0xFF, 0xE2, 0x00, 0x86, 0xFF, 0xE2, 0x00, 0x87, 0xFF, 0xE2, 0x00, 0x88,
+    0xFF, 0xE2, 0x00, 0x89, 0xFF, 0xE2, 0x00, 0x8A, 0xFF, 0xE2, 0x00, 0x8B,
+    0xFF, 0xE2, 0x00, 0x8C, 0xFF, 0xE2, 0x00, 0x8D, 0xFF, 0xE2, 0x00, 0x8E,
+    0xFF, 0xE2, 0x00, 0x8F, 0xFF, 0xE2, 0x00, 0x90, 0xFF, 0xE2, 0x00, 0x91,
+    0xFF, 0xE2, 0x00, 0x92, 0xFF, 0xE2, 0x00, 0x93, 0xFF, 0xE2, 0x00, 0x94,
+    0xFF, 0xE2, 0x00, 0x95, 0xFF, 0xE2, 0x00, 0x96, 0xFF, 0xE2, 0x00, 0x97,
+    0xFF, 0xE2, 0x00, 0x98, 0xFF, 0xE2, 0x00, 0x99, 0xFF, 0xE2, 0x00, 0x9A,
+    0xFF, 0xE2, 0x00, 0x9B, 0xFF, 0xE2, 0x00, 0x9C, 0xFF, 0xE2, 0x00, 0x9D,
+    0xFF, 0xE2, 0x00, 0x9E, 0xFF, 0xE2, 0x00, 0x9F, 0xFF, 0xE2, 0x00, 0xA0,
+    0xFF, 0xE2, 0x00, 0xA1, 0xFF, 0xE2, 0x00, 0xA2, 0xFF, 0xE2, 0x00, 0xA3,
+    0xFF, 0xE2, 0x00, 0xA6, 0xFF, 0xE2, 0x00, 0xBB, 0xFF, 0xE2, 0x01, 0x03,
+    0xFF, 0xD8, 0x01, 0x04, 0xFF, 0xD8, 0x01, 0x07, 0xFF, 0xE7, 0x01, 0x08,
+    0xFF, 0xE7, 0x01, 0x09, 0xFF, 0xE7, 0x01, 0x0A, 0xFF, 0xE7, 0x01, 0x0B,
+    0xFF, 0xE7, 0x01, 0x0C, 0xFF, 0xE7, 0x01, 0x0D, 0xFF, 0xE7, 0x01, 0x0E,
+    0xFF, 0xE7, 0x01, 0x0F, 0xFF, 0xE7, 0x01, 0x10, 0xFF, 0xE7, 0x01, 0x11,
+    0xFF, 0xE7, 0x01, 0x12, 0xFF, 0xE7, 0x01, 0x13, 0xFF, 0xE7, 0x01, 0x14,
+    0xFF, 0xE7, 0x01, 0x15, 0xFF, 0xE7, 0x01, 0x16, 0xFF, 0xE7, 0x01, 0x17,
+    0xFF, 0xE7, 0x01, 0x18, 0xFF, 0xE7, 0x01, 0x19, 0xFF, 0xE7, 0x01, 0x1A,
+    0xFF, 0xE7, 0x01, 0x1B, 0xFF, 0xE7, 0x01, 0x1C, 0xFF, 0xE7, 0x01, 0x1D,
+    0xFF, 0xE7, 0x01, 0x1E, 0xFF, 0xE7, 0x01, 0x1F, 0xFF, 0xE7, 0x01, 0x20,
+    0xFF, 0xE7, 0x01, 0x24, 0xFF, 0xE7, 0x01, 0x25, 0xFF, 0xE7, 0x01, 0x26,
+    0xFF, 0xE7, 0x01, 0x27, 0xFF, 0xE7, 0x01, 0x28, 0xFF, 0xE7, 0x01, 0x29,
+    0xFF, 0xE7, 0x01, 0x2A, 0xFF, 0xE7, 0x01, 0x2B, 0xFF, 0xE7, 0x01, 0x2C,
+    0xFF, 0xE7, 0x01, 0x2D, 0xFF, 0xE7, 0x01, 0x2E, 0xFF, 0xE7, 0x01, 0x2F,
+    0xFF, 0xE7, 0x01, 0x30, 0xFF, 0xE7, 0x01, 0x31, 0xFF, 0xE7, 0x01, 0x32,
+    0xFF, 0xE7, 0x01, 0x33, 0xFF, 0xE7, 0x01, 0x34, 0xFF, 0xE7, 0x01, 0x35,
+    0xFF, 0xE7, 0x01, 0x36, 0xFF, 0xE7, 0x01, 0x37, 0xFF, 0xE7, 0x01, 0x38,
+    0xFF, 0xE7, 0x01, 0x39, 0xFF, 0xE7, 0x01, 0x3A, 0xFF, 0xE7, 0x01, 0x3B,
+    0xFF, 0xE7, 0x01, 0x3C, 0xFF, 0xE7, 0x01, 0x3D, 0xFF, 0xE7, 0x01, 0x3E,
+    0xFF, 0xE7, 0x01, 0x3F, 0xFF, 0xE7, 0x01, 0x40, 0xFF, 0xE7, 0x01, 0x41,
+    0xFF, 0xE7, 0x01, 0x42, 0xFF, 0xE7, 0x01, 0x43, 0xFF, 0xE7, 0x01, 0x44,
+    0xFF, 0xE7, 0x01, 0x45, 0xFF, 0xE7, 0x01, 0x46, 0xFF, 0xE7, 0x01, 0x47,
+    0xFF, 0xE7, 0x01, 0x48, 0xFF, 0xE7, 0x01, 0x49, 0xFF, 0xE7, 0x01, 0x4B,
+    0xFF, 0xE8, 0x01, 0x4C, 0xFF, 0xE8, 0x01, 0x4D, 0xFF, 0xE8, 0x01, 0x4E,
+    0xFF, 0xE8, 0x01, 0x4F, 0xFF, 0xE8, 0x01, 0x50, 0xFF, 0xE8, 0x01, 0x51,
+    0xFF, 0xE8, 0x01, 0x69, 0x00, 0x1E, 0x01, 0x6A, 0x00, 0x1E, 0x01, 0x6B,
+    0x00, 0x1E, 0x01, 0x81, 0x00, 0x1E, 0x01, 0x86, 0xFF, 0xE7, 0x01, 0x87,
+    0xFF, 0xE7, 0x01, 0x88, 0xFF, 0xE7, 0x01, 0x89, 0xFF, 0xE7, 0x01, 0x8A,
+    0xFF, 0xE7, 0x01, 0x8B, 0xFF, 0xE7, 0x01, 0x8C, 0xFF, 0xE7, 0x01, 0x8D,
+    0xFF, 0xE7, 0x01, 0x8E, 0xFF, 0xE7, 0x01, 0x8F, 0xFF, 0xE7, 0x01, 0x90,
+    0xFF, 0xE7, 0x01, 0x91, 0xFF, 0xE7, 0x01, 0x92, 0xFF, 0xE7, 0x01, 0x93,
+    0xFF, 0xE7, 0x01, 0x94, 0xFF, 0xE7, 0x01, 0x95, 0xFF, 0xE7, 0x01, 0x96,
+    0xFF, 0xE7, 0x01, 0x97, 0xFF, 0xE7, 0x01, 0x98, 0xFF, 0xE7, 0x01, 0x99,
+    0xFF, 0xE7, 0x01, 0x9A, 0xFF, 0xE7, 0x01, 0x9B, 0xFF, 0xE7, 0x01, 0x9C,
+    0xFF, 0xE7, 0x01, 0x9D, 0xFF, 0xE7, 0x01, 0x9E, 0xFF, 0xE7, 0x01, 0x9F,
+    0xFF, 0xE7, 0x01, 0xA0, 0xFF, 0xE7, 0x01, 0xA1, 0xFF, 0xE7, 0x01, 0xA2,
+    0xFF, 0xE7, 0x01, 0xA3, 0xFF, 0xE7, 0x01, 0xA4, 0xFF, 0xE7, 0x01, 0xA5,
+    0xFF, 0xE7, 0x01, 0xA6, 0xFF, 0xE7, 0x01, 0xA7, 0xFF, 0xE7, 0x01, 0xA8,
+    0xFF, 0xE7, 0x01, 0xA9, 0xFF, 0xE7, 0x01, 0xAA, 0x00, 0x1E, 0x01, 0xAB,
+    0x00, 0x0F, 0x01, 0xAC, 0xFF, 0xE7, 0x01, 0xF8, 0xFF, 0xE7, 0x01, 0xF9,
+    0xFF, 0xE7, 0x01, 0xFA, 0xFF, 0xE7, 0x01, 0xFB, 0xFF, 0xE7, 0x01, 0xFC,
+    0xFF, 0xE7, 0x01, 0xFD, 0xFF, 0xE7, 0x01, 0xFE, 0xFF, 0xE7, 0x01, 0xFF,
+    0xFF, 0xE7, 0x02, 0x00, 0xFF, 0xE7, 0x02, 0x01, 0xFF, 0xE7, 0x02, 0x02,
+    0xFF, 0xE7, 0x02, 0x03, 0xFF, 0xE7, 0x02, 0x04, 0xFF, 0xE7, 0x02, 0x05,
+    0xFF, 0xE7, 0x02, 0x06, 0xFF, 0xE7, 0x02, 0x07, 0xFF, 0xE7, 0x02, 0x08,
+    0xFF, 0xE7, 0x02, 0x09, 0xFF, 0xE7, 0x02, 0x0A, 0xFF, 0xE7, 0x02, 0x0B,
+    0xFF, 0xE7, 0x02, 0x0C, 0xFF, 0xE7, 0x02, 0x0D, 0xFF, 0xE7, 0x02, 0x0E,
+    0xFF, 0xE7, 0x02, 0x0F, 0xFF, 0xE7, 0x02, 0x10, 0xFF, 0xE7, 0x02, 0x11,
+    0xFF, 0xE7, 0x00, 0x04, 0x00, 0xDB, 0xFF, 0xE3, 0x01, 0x2C, 0xFF, 0xDE,
+    0x01, 0xAB, 0x00, 0x08, 0x01, 0xE1, 0xFF, 0xEB, 0x00, 0xD2, 0x00, 0x1E,
+    0xFF, 0xCE, 0x00, 0x1F, 0xFF, 0xCE, 0x00, 0x20, 0xFF, 0xCE, 0x00, 0x21,
+    0xFF, 0xCE, 0x00, 0x22, 0xFF, 0xCE, 0x00, 0x23, 0xFF, 0xCE, 0x00, 0x24,
+    0xFF, 0xCE, 0x00, 0x47, 0xFF, 0xCE, 0x00, 0x48, 0xFF, 0xCE, 0x00, 0x49,
+    0xFF, 0xCE, 0x00, 0x4A, 0xFF, 0xCE, 0x00, 0x4B, 0xFF, 0xCE, 0x00, 0x4C,
+    0xFF, 0xCE, 0x00, 0x4D, 0xFF, 0xCE, 0x00, 0x80, 0xFF, 0xCE, 0x00, 0x81,
+    0xFF, 0xCE, 0x00, 0x82, 0xFF, 0xCE, 0x00, 0x83, 0xFF, 0xCE, 0x00, 0x84,
+    0xFF, 0xCE, 0x00, 0x85, 0xFF, 0xCE, 0x00, 0x86, 0xFF, 0xCE, 0x00, 0x87,
+    0xFF, 0xCE, 0x00, 0x88, 0xFF, 0xCE, 0x00, 0x89, 0xFF, 0xCE, 0x00, 0x8A,
+    0xFF, 0xCE, 0x00, 0x8B, 0xFF, 0xCE, 0x00, 0x8C, 0xFF, 0xCE, 0x00, 0x8D,
+    0xFF, 0xCE, 0x00, 0x8E, 0xFF, 0xCE, 0x00, 0x8F, 0xFF, 0xCE, 0x00, 0x90,
+    0xFF, 0xCE, 0x00, 0x91, 0xFF, 0xCE, 0x00, 0x92, 0xFF, 0xCE, 0x00, 0x93,
+    0xFF, 0xCE, 0x00, 0x94, 0xFF, 0xCE, 0x00, 0x95, 0xFF, 0xCE, 0x00, 0x96,
+    0xFF, 0xCE, 0x00, 0x97, 0xFF, 0xCE, 0x00, 0x98, 0xFF, 0xCE, 0x00, 0x99,
+    0xFF, 0xCE, 0x00, 0x9A, 0xFF, 0xCE, 0x00, 0x9B, 0xFF, 0xCE, 0x00, 0x9C,
+    0xFF, 0xCE, 0x00, 0x9D, 0xFF, 0xCE, 0x00, 0x9E, 0xFF, 0xCE, 0x00, 0x9F,
+    0xFF, 0xCE, 0x00, 0xA0, 0xFF, 0xCE, 0x00, 0xA1, 0xFF, 0xCE, 0x00, 0xA2,
+    0xFF, 0xCE, 0x00, 0xA3, 0xFF, 0xCE, 0x00, 0xA6, 0xFF, 0xCE, 0x00, 0xBB,
+    0xFF, 0xCE, 0x00, 0xBC, 0xFF, 0xC4, 0x00, 0xBD, 0xFF, 0xC4, 0x00, 0xBE,
+    0xFF, 0xC4, 0x00, 0xBF, 0xFF, 0xC4, 0x00, 0xC0, 0xFF, 0xC4, 0x00, 0xC1,
+    0xFF, 0xC4, 0x00, 0xC2, 0xFF, 0xC4, 0x00, 0xDB, 0xFF, 0xD8, 0x00, 0xDC,
+    0xFF, 0xD8, 0x00, 0xDD, 0xFF, 0xD8, 0x00, 0xDE, 0xFF, 0xD8, 0x00, 0xDF,
+    0xFF, 0xD8, 0x00, 0xE0, 0xFF, 0xD8, 0x00, 0xE2, 0xFF, 0xB0, 0x00, 0xE3,
+    0xFF, 0xB0, 0x00, 0xE4, 0xFF, 0xB0, 0x00, 0xE5, 0xFF, 0xB0, 0x00, 0xE6,
+    0xFF, 0xB0, 0x00, 0xE7, 0xFF, 0xB0, 0x00, 0xE8, 0xFF, 0xB0, 0x00, 0xE9,
+    0xFF, 0xB0, 0x00, 0xEA, 0xFF, 0xB0, 0x00, 0xEB, 0xFF, 0xB0, 0x01, 0x07,
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x0A,
+    0x00, 0x00, 0x01, 0x0B, 0x00, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x01, 0x0D,
+    0x00, 0x00, 0x01, 0x0E, 0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x01, 0x13,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x01, 0x15, 0x00, 0x00, 0x01, 0x16,
+    0x00, 0x00, 0x01, 0x17, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x19,
+    0x00, 0x00, 0x01, 0x1A, 0x00, 0x00, 0x01, 0x1B, 0x00, 0x00, 0x01, 0x1C,
+    0x00, 0x00, 0x01, 0x1D, 0x00, 0x00, 0x01, 0x1E, 0x00, 0x00, 0x01, 0x1F,
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x01, 0x25,
+    0x00, 0x00, 0x01, 0x26, 0x00, 0x00, 0x01, 0x27, 0x00, 0x00, 0x01, 0x28,
+    0x00, 0x00, 0x01, 0x29, 0x00, 0x00, 0x01, 0x2A, 0x00, 0x00, 0x01, 0x2B,
+    0x00, 0x00, 0x01, 0x2C, 0xFF, 0xEA, 0x01, 0x2D, 0x00, 0x00, 0x01, 0x2E,
+    0x00, 0x00, 0x01, 0x2F, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x01, 0x31,
+    0x00, 0x00, 0x01, 0x32, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x01, 0x34,
+    0x00, 0x00, 0x01, 0x35, 0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x37,
+    0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x01, 0x39, 0x00, 0x00, 0x01, 0x3A,
+    0x00, 0x00, 0x01, 0x3B, 0x00, 0x00, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3D,
+    0x00, 0x00, 0x01, 0x3E, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x01, 0x43,
+    0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x01, 0x45, 0x00, 0x00, 0x01, 0x46,
+    0x00, 0x00, 0x01, 0x47, 0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x01, 0x49,
+    0x00, 0x00, 0x01, 0x69, 0x00, 0x3C, 0x01, 0x6A, 0x00, 0x3C, 0x01, 0x6B,
+    0x00, 0x3C, 0x01, 0x81, 0x00, 0x3C, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87,
+    0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x8A,
+    0x00, 0x00, 0x01, 0x8B, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x01, 0x8D,
+    0x00, 0x00, 0x01, 0x8E, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x01, 0x90,
+    0x00, 0x00, 0x01, 0x91, 0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x01, 0x93,
+    0x00, 0x00, 0x01, 0x94, 0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x96,
+    0x00, 0x00, 0x01, 0x97, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x01, 0x99,
+    0x00, 0x00, 0x01, 0x9A, 0x00, 0x00, 0x01, 0x9B, 0x00, 0x00, 0x01, 0x9C,
+    0x00, 0x00, 0x01, 0x9D, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x00, 0x01, 0x9F,
+    0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x01, 0xA1, 0x00, 0x00, 0x01, 0xA2,
+    0x00, 0x00, 0x01, 0xA3, 0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xA5,
+    0x00, 0x00, 0x01, 0xA6, 0x00, 0x00, 0x01, 0xA7, 0x00, 0x00, 0x01, 0xA8,
+    0x00, 0x00, 0x01, 0xA9, 0x00, 0x00, 0x01, 0xAC, 0x00, 0x00, 0x01, 0xC0,
+    0xFF, 0xFA, 0x01, 0xE1, 0xFF, 0xF9, 0x01, 0xE7, 0xFF, 0xFF, 0x01, 0xF8,
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x01, 0xFB,
+    0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xFE,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x02, 0x04,
+    0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x02, 0x07,
+    0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x02, 0x0A,
+    0x00, 0x00, 0x02, 0x0B, 0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x02, 0x0D,
+    0x00, 0x00, 0x02, 0x0E, 0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x02, 0x10,
+    0x00, 0x00, 0x02, 0x11, 0x00, 0x00, 0x02, 0x77, 0xFF, 0xA4, 0x00, 0xED,
+    0x00, 0x01, 0xFF, 0x9C, 0x00, 0x02, 0xFF, 0x9C, 0x00, 0x03, 0xFF, 0x9C,
+    0x00, 0x04, 0xFF, 0x9C, 0x00, 0x05, 0xFF, 0x9C, 0x00, 0x06, 0xFF, 0x9C,
+    0x00, 0x07, 0xFF, 0x9C, 0x00, 0x08, 0xFF, 0x9C, 0x00, 0x09, 0xFF, 0x9C,
+    0x00, 0x0A, 0xFF, 0x9C, 0x00, 0x0B, 0xFF, 0x9C, 0x00, 0x0C, 0xFF, 0x9C,
+    0x00, 0x0D, 0xFF, 0x9C, 0x00, 0x0E, 0xFF, 0x9C, 0x00, 0x0F, 0xFF, 0x9C,
+    0x00, 0x10, 0xFF, 0x9C, 0x00, 0x11, 0xFF, 0x9C, 0x00, 0x12, 0xFF, 0x9C,
+    0x00, 0x13, 0xFF, 0x9C, 0x00, 0x14, 0xFF, 0x9C, 0x00, 0x15, 0xFF, 0x9C,
+    0x00, 0x16, 0xFF, 0x9C, 0x00, 0x17, 0xFF, 0x9C, 0x00, 0x18, 0xFF, 0x9C,
+    0x00, 0x19, 0xFF, 0x9C, 0x00, 0x1A, 0xFF, 0x9C, 0x00, 0x1E, 0xFF, 0xD8,
+    0x00, 0x1F, 0xFF, 0xD8, 0x00, 0x20, 0xFF, 0xD8, 0x00, 0x21, 0xFF, 0xD8,
+    0x00, 0x22, 0xFF, 0xD8, 0x00, 0x23, 0xFF, 0xD8, 0x00, 0x24, 0xFF, 0xD8,
+    0x00, 0x47, 0xFF, 0xD8, 0x00, 0x48, 0xFF, 0xD8, 0x00, 0x49, 0xFF, 0xD8,
+    0x00, 0x4A, 0xFF, 0xD8, 0x00, 0x4B, 0xFF, 0xD8, 0x00, 0x4C, 0xFF, 0xD8,
+    0x00, 0x4D, 0xFF, 0xD8, 0x00, 0x64, 0xFF, 0xCE, 0x00, 0x65, 0xFF, 0xCE,
+    0x00, 0x80, 0xFF, 0xD8, 0x00, 0x81, 0xFF, 0xD8, 0x00, 0x82, 0xFF, 0xD8,
+    0x00, 0x83, 0xFF, 0xD8, 0x00, 0x84, 0xFF, 0xD8, 0x00, 0x85, 0xFF, 0xD8,
+    0x00, 0x86, 0xFF, 0xD8, 0x00, 0x87, 0xFF, 0xD8, 0x00, 0x88, 0xFF, 0xD8,
+    0x00, 0x89, 0xFF, 0xD8, 0x00, 0x8A, 0xFF, 0xD8, 0x00, 0x8B, 0xFF, 0xD8,
+    0x00, 0x8C, 0xFF, 0xD8, 0x00, 0x8D, 0xFF, 0xD8, 0x00, 0x8E, 0xFF, 0xD8,
+    0x00, 0x8F, 0xFF, 0xD8, 0x00, 0x90, 0xFF, 0xD8, 0x00, 0x91, 0xFF, 0xD8,
+    0x00, 0x92, 0xFF, 0xD8, 0x00, 0x93, 0xFF, 0xD8, 0x00, 0x94, 0xFF, 0xD8,
+    0x00, 0x95, 0xFF, 0xD8, 0x00, 0x96, 0xFF, 0xD8, 0x00, 0x97, 0xFF, 0xD8,
+    0x00, 0x98, 0xFF, 0xD8, 0x00, 0x99, 0xFF, 0xD8, 0x00, 0x9A, 0xFF, 0xD8,
+    0x00, 0x9B, 0xFF, 0xD8, 0x00, 0x9C, 0xFF, 0xD8, 0x00, 0x9D, 0xFF, 0xD8,
+    0x00, 0x9E, 0xFF, 0xD8, 0x00, 0x9F, 0xFF, 0xD8, 0x00, 0xA0, 0xFF, 0xD8,
+    0x00, 0xA1, 0xFF, 0xD8, 0x00, 0xA2, 0xFF, 0xD8, 0x00, 0xA3, 0xFF, 0xD8,
+    0x00, 0xA6, 0xFF, 0xD8, 0x00, 0xBB, 0xFF, 0xD8, 0x01, 0x03, 0xFF, 0xCE,
+    0x01, 0x04, 0xFF, 0xCE, 0x01, 0x07, 0xFF, 0xCE, 0x01, 0x08, 0xFF, 0xCE,
+    0x01, 0x09, 0xFF, 0xCE, 0x01, 0x0A, 0xFF, 0xCE, 0x01, 0x0B, 0xFF, 0xCE,
+    0x01, 0x0C, 0xFF, 0xCE, 0x01, 0x0D, 0xFF, 0xCE, 0x01, 0x0E, 0xFF, 0xCE,
+    0x01, 0x0F, 0xFF, 0xCE, 0x01, 0x10, 0xFF, 0xCE, 0x01, 0x11, 0xFF, 0xCE,
+    0x01, 0x12, 0xFF, 0xCE, 0x01, 0x13, 0xFF, 0xCE, 0x01, 0x14, 0xFF, 0xCE,
+    0x01, 0x15, 0xFF, 0xCE, 0x01, 0x16, 0xFF, 0xCE, 0x01, 0x17, 0xFF, 0xCE,
+    0x01, 0x18, 0xFF, 0xCE, 0x01, 0x19, 0xFF, 0xCE, 0x01, 0x1A, 0xFF, 0xCE,
+    0x01, 0x1B, 0xFF, 0xCE, 0x01, 0x1C, 0xFF, 0xCE, 0x01, 0x1D, 0xFF, 0xCE,
+    0x01, 0x1E, 0xFF, 0xCE, 0x01, 0x1F, 0xFF, 0xCE, 0x01, 0x20, 0xFF, 0xCE,
+    0x01, 0x24, 0xFF, 0xCE, 0x01, 0x25, 0xFF, 0xCE, 0x01, 0x26, 0xFF, 0xCE,
+    0x01, 0x27, 0xFF, 0xCE, 0x01, 0x28, 0xFF, 0xCE, 0x01, 0x29, 0xFF, 0xCE,
+    0x01, 0x2A, 0xFF, 0xCE, 0x01, 0x2B, 0xFF, 0xCE, 0x01, 0x2C, 0xFF, 0xE0,
+    0x01, 0x2D, 0xFF, 0xCE, 0x01, 0x2E, 0xFF, 0xCE, 0x01, 0x2F, 0xFF, 0xCE,
+    0x01, 0x30, 0xFF, 0xCE, 0x01, 0x31, 0xFF, 0xCE, 0x01, 0x32, 0xFF, 0xCE,
+    0x01, 0x33, 0xFF, 0xCE, 0x01, 0x34, 0xFF, 0xCE, 0x01, 0x35, 0xFF, 0xCE,
+    0x01, 0x36, 0xFF, 0xCE, 0x01, 0x37, 0xFF, 0xCE, 0x01, 0x38, 0xFF, 0xCE,
+    0x01, 0x39, 0xFF, 0xCE, 0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x3B, 0xFF, 0xCE,
+    0x01, 0x3C, 0xFF, 0xCE, 0x01, 0x3D, 0xFF, 0xCE, 0x01, 0x3E, 0xFF, 0xCE,
+    0x01, 0x3F, 0xFF, 0xCE, 0x01, 0x40, 0xFF, 0xCE, 0x01, 0x41, 0xFF, 0xCE,
+    0x01, 0x42, 0xFF, 0xCE, 0x01, 0x43, 0xFF, 0xCE, 0x01, 0x44, 0xFF, 0xCE,
+    0x01, 0x45, 0xFF, 0xCE, 0x01, 0x46, 0xFF, 0xCE, 0x01, 0x47, 0xFF, 0xCE,
+    0x01, 0x48, 0xFF, 0xCE, 0x01, 0x49, 0xFF, 0xCE, 0x01, 0x4B, 0xFF, 0xCE,
+    0x01, 0x4C, 0xFF, 0xCE, 0x01, 0x4D, 0xFF, 0xCE, 0x01, 0x4E, 0xFF, 0xCE,
+    0x01, 0x4F, 0xFF, 0xCE, 0x01, 0x50, 0xFF, 0xCE, 0x01, 0x51, 0xFF, 0xCE,
+    0x01, 0x86, 0xFF, 0xCE, 0x01, 0x87, 0xFF, 0xCE, 0x01, 0x88, 0xFF, 0xCE,
+    0x01, 0x89, 0xFF, 0xCE, 0x01, 0x8A, 0xFF, 0xCE, 0x01, 0x8B, 0xFF, 0xCE,
+    0x01, 0x8C, 0xFF, 0xCE, 0x01, 0x8D, 0xFF, 0xCE, 0x01, 0x8E, 0xFF, 0xCE,
+    0x01, 0x8F, 0xFF, 0xCE, 0x01, 0x90, 0xFF, 0xCE, 0x01, 0x91, 0xFF, 0xCE,
+    0x01, 0x92, 0xFF, 0xCE, 0x01, 0x93, 0xFF, 0xCE, 0x01, 0x94, 0xFF, 0xCE,
+    0x01, 0x95, 0xFF, 0xCE, 0x01, 0x96, 0xFF, 0xCE, 0x01, 0x97, 0xFF, 0xCE,
+    0x01, 0x98, 0xFF, 0xCE, 0x01, 0x99, 0xFF, 0xCE, 0x01, 0x9A, 0xFF, 0xCE,
+    0x01, 0x9B, 0xFF, 0xCE, 0x01, 0x9C, 0xFF, 0xCE, 0x01, 0x9D, 0xFF, 0xCE,
+    0x01, 0x9E, 0xFF, 0xCE, 0x01, 0x9F, 0xFF, 0xCE, 0x01, 0xA0, 0xFF, 0xCE,
+    0x01, 0xA1, 0xFF, 0xCE, 0x01, 0xA2, 0xFF, 0xCE, 0x01, 0xA3, 0xFF, 0xCE,
+    0x01, 0xA4, 0xFF, 0xCE, 0x01, 0xA5, 0xFF, 0xCE, 0x01, 0xA6, 0xFF, 0xCE,
+    0x01, 0xA7, 0xFF, 0xCE, 0x01, 0xA8, 0xFF, 0xCE, 0x01, 0xA9, 0xFF, 0xCE,
+    0x01, 0xAC, 0xFF, 0xCE, 0x01, 0xB5, 0xFF, 0xE2, 0x01, 0xB6, 0xFF, 0xE2,
+    0x01, 0xB7, 0xFF, 0xE2, 0x01, 0xB8, 0xFF, 0xE2, 0x01, 0xB9, 0xFF, 0xE2,
+    0x01, 0xBA, 0xFF, 0xE2, 0x01, 0xBB, 0xFF, 0xE2, 0x01, 0xBC, 0xFF, 0xE2,
+    0x01, 0xBD, 0xFF, 0xE2, 0x01, 0xBE, 0xFF, 0xE2, 0x01, 0xBF, 0xFF, 0xE2,
+    0x01, 0xC0, 0xFF, 0xF4, 0x01, 0xE1, 0xFF, 0xFF, 0x01, 0xE7, 0xFF, 0xFA,
+    0x01, 0xF8, 0xFF, 0xCE, 0x01, 0xF9, 0xFF, 0xCE, 0x01, 0xFA, 0xFF, 0xCE,
+    0x01, 0xFB, 0xFF, 0xCE, 0x01, 0xFC, 0xFF, 0xCE, 0x01, 0xFD, 0xFF, 0xCE,
+    0x01, 0xFE, 0xFF, 0xCE, 0x01, 0xFF, 0xFF, 0xCE, 0x02, 0x00, 0xFF, 0xCE,
+    0x02, 0x01, 0xFF, 0xCE, 0x02, 0x02, 0xFF, 0xCE, 0x02, 0x03, 0xFF, 0xCE,
+    0x02, 0x04, 0xFF, 0xCE, 0x02, 0x05, 0xFF, 0xCE, 0x02, 0x06, 0xFF, 0xCE,
+    0x02, 0x07, 0xFF, 0xCE, 0x02, 0x08, 0xFF, 0xCE, 0x02, 0x09, 0xFF, 0xCE,
+    0x02, 0x0A, 0xFF, 0xCE, 0x02, 0x0B, 0xFF, 0xCE, 0x02, 0x0C, 0xFF, 0xCE,
+    0x02, 0x0D, 0xFF, 0xCE, 0x02, 0x0E, 0xFF, 0xCE, 0x02, 0x0F, 0xFF, 0xCE,
+    0x02, 0x10, 0xFF, 0xCE, 0x02, 0x11, 0xFF, 0xCE, 0x02, 0x22, 0xFF, 0x9C,
+    0x02, 0x26, 0xFF, 0xCE, 0x02, 0x27, 0xFF, 0xE2, 0x02, 0x28, 0xFF, 0xE2,
+    0x02, 0x2A, 0xFF, 0xC4, 0x02, 0x2C, 0xFF, 0xCE, 0x02, 0x76, 0xFF, 0xA4,
+    0x00, 0x1D, 0x00, 0x01, 0xFF, 0xB5, 0x00, 0x02, 0xFF, 0xB5, 0x00, 0x03,
+    0xFF, 0xB5, 0x00, 0x04, 0xFF, 0xB5, 0x00, 0x05, 0xFF, 0xB5, 0x00, 0x06,
+    0xFF, 0xB5, 0x00, 0x07, 0xFF, 0xB5, 0x00, 0x08, 0xFF, 0xB5, 0x00, 0x09,
+    0xFF, 0xB5, 0x00, 0x0A, 0xFF, 0xB5, 0x00, 0x0B, 0xFF, 0xB5, 0x00, 0x0C,
+    0xFF, 0xB5, 0x00, 0x0D, 0xFF, 0xB5, 0x00, 0x0E, 0xFF, 0xB5, 0x00, 0x0F,
+    0xFF, 0xB5, 0x00, 0x10, 0xFF, 0xB5, 0x00, 0x11, 0xFF, 0xB5, 0x00, 0x12,
+    0xFF, 0xB5, 0x00, 0x13, 0xFF, 0xB5, 0x00, 0x14, 0xFF, 0xB5, 0x00, 0x15,
+    0xFF, 0xB5, 0x00, 0x16, 0xFF, 0xB5, 0x00, 0x17, 0xFF, 0xB5, 0x00, 0x18,
+    0xFF, 0xB5, 0x00, 0x19, 0xFF, 0xB5, 0x00, 0x1A, 0xFF, 0xB5, 0x01, 0x2C,
+    0xFF, 0xE7, 0x01, 0xE1, 0x00, 0x06, 0x02, 0x22, 0xFF, 0xB5, 0x00, 0x01,
+    0x00, 0xDB, 0xFF, 0xF8, 0x00, 0x03, 0x00, 0xDB, 0xFF, 0xF4, 0x01, 0x2C,
+    0x00, 0x0A, 0x01, 0xE7, 0xFF, 0xFA, 0x00, 0x03, 0x00, 0xDB, 0xFF, 0xEF,
+    0x01, 0x2C, 0xFF, 0xE2, 0x01, 0xE1, 0xFF, 0xF7, 0x00, 0x20, 0x00, 0x01,
+    0xFF, 0xD8, 0x00, 0x02, 0xFF, 0xD8, 0x00, 0x03, 0xFF, 0xD8, 0x00, 0x04,
+    0xFF, 0xD8, 0x00, 0x05, 0xFF, 0xD8, 0x00, 0x06, 0xFF, 0xD8, 0x00, 0x07,
+    0xFF, 0xD8, 0x00, 0x08, 0xFF, 0xD8, 0x00, 0x09, 0xFF, 0xD8, 0x00, 0x0A,
+    0xFF, 0xD8, 0x00, 0x0B, 0xFF, 0xD8, 0x00, 0x0C, 0xFF, 0xD8, 0x00, 0x0D,
+    0xFF, 0xD8, 0x00, 0x0E, 0xFF, 0xD8, 0x00, 0x0F, 0xFF, 0xD8, 0x00, 0x10,
+    0xFF, 0xD8, 0x00, 0x11, 0xFF, 0xD8, 0x00, 0x12, 0xFF, 0xD8, 0x00, 0x13,
+    0xFF, 0xD8, 0x00, 0x14, 0xFF, 0xD8, 0x00, 0x15, 0xFF, 0xD8, 0x00, 0x16,
+    0xFF, 0xD8, 0x00, 0x17, 0xFF, 0xD8, 0x00, 0x18, 0xFF, 0xD8, 0x00, 0x19,
+    0xFF, 0xD8, 0x00, 0x1A, 0xFF, 0xD8, 0x00, 0x64, 0xFF, 0xB5, 0x00, 0x65,
+    0xFF, 0xB5, 0x01, 0x03, 0xFF, 0xB5, 0x01, 0x04, 0xFF, 0xB5, 0x01, 0x2C,
+    0xFF, 0xF1, 0x02, 0x22, 0xFF, 0xD8, 0x00, 0x01, 0x00, 0xDB, 0xFF, 0xFA,
+    0x00, 0x19, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xBD, 0xFF, 0x9C, 0x00, 0xBE,
+    0xFF, 0x9C, 0x00, 0xBF, 0xFF, 0x9C, 0x00, 0xC0, 0xFF, 0x9C, 0x00, 0xC1,
+    0xFF, 0x9C, 0x00, 0xC2, 0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x88, 0x00, 0xDC,
+    0xFF, 0xB0, 0x00, 0xDD, 0xFF, 0xB0, 0x00, 0xDE, 0xFF, 0xB0, 0x00, 0xDF,
+    0xFF, 0xB0, 0x00, 0xE0, 0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88, 0x00, 0xE3,
+    0xFF, 0x88, 0x00, 0xE4, 0xFF, 0x88, 0x00, 0xE5, 0xFF, 0x88, 0x00, 0xE6,
+    0xFF, 0x88, 0x00, 0xE7, 0xFF, 0x88, 0x00, 0xE8, 0xFF, 0x88, 0x00, 0xE9,
+    0xFF, 0x88, 0x00, 0xEA, 0xFF, 0x88, 0x00, 0xEB, 0xFF, 0x88, 0x01, 0xE1,
+    0xFF, 0xD8, 0x02, 0x2A, 0xFF, 0xE7, 0x00, 0x19, 0x00, 0xBC, 0xFF, 0x9C,
+    0x00, 0xBD, 0xFF, 0x9C, 0x00, 0xBE, 0xFF, 0x9C, 0x00, 0xBF, 0xFF, 0x9C,
+    0x00, 0xC0, 0xFF, 0x9C, 0x00, 0xC1, 0xFF, 0x9C, 0x00, 0xC2, 0xFF, 0x9C,
+    0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xB0, 0x00, 0xDD, 0xFF, 0xB0,
+    0x00, 0xDE, 0xFF, 0xB0, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0xE0, 0xFF, 0xB0,
+    0x00, 0xE2, 0xFF, 0x88, 0x00, 0xE3, 0xFF, 0x88, 0x00, 0xE4, 0xFF, 0x88,
+    0x00, 0xE5, 0xFF, 0x88, 0x00, 0xE6, 0xFF, 0x88, 0x00, 0xE7, 0xFF, 0x88,
+    0x00, 0xE8, 0xFF, 0x88, 0x00, 0xE9, 0xFF, 0x88, 0x00, 0xEA, 0xFF, 0x88,
+    0x00, 0xEB, 0xFF, 0x88, 0x01, 0xE1, 0xFF, 0xD8, 0x02, 0x2A, 0xFF, 0xE7,
+    0x00, 0x02, 0x02, 0x76, 0xFF, 0xCE, 0x02, 0xE1, 0xFF, 0xD8, 0x00, 0x01,
+    0x02, 0xE1, 0xFF, 0xE2, 0x00, 0x0A, 0x02, 0x27, 0xFF, 0xF1, 0x02, 0x28,
+    0xFF, 0xEC, 0x02, 0x2A, 0xFF, 0xE7, 0x02, 0x2C, 0xFF, 0xEC, 0x02, 0x2E,
+    0xFF, 0xEC, 0x02, 0x69, 0xFF, 0xB0, 0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x76,
+    0xFF, 0x88, 0x02, 0xD5, 0xFF, 0xCE, 0x02, 0xE1, 0xFF, 0xA6, 0x00, 0x01,
+    0x02, 0xE1, 0xFF, 0xEC, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0xE1,
+    0xFF, 0xEC, 0x00, 0x03, 0x02, 0x28, 0xFF, 0xEC, 0x02, 0x2D, 0xFF, 0xEC,
+    0x02, 0xDF, 0xFF, 0xC4, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xE7, 0x02, 0xE1,
+    0xFF, 0xE2, 0x00, 0x02, 0x02, 0x2A, 0xFF, 0xEC, 0x02, 0x8C, 0x00, 0x0A,
+    0x00, 0x01, 0x02, 0xD5, 0xFF, 0xD8, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xCE,
+    0x02, 0xE1, 0xFF, 0xCE, 0x00, 0x03, 0x02, 0x6A, 0x00, 0x00, 0x02, 0x76,
+    0xFF, 0xEC, 0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x05, 0x01, 0x2C, 0xFF, 0xFD,
+    0x02, 0x72, 0xFF, 0xFA, 0x02, 0x76, 0xFF, 0xFF, 0x02, 0x77, 0xFF, 0xFA,
+    0x02, 0xA7, 0xFF, 0xFD, 0x00, 0x03, 0x02, 0x6A, 0xFF, 0xD8, 0x02, 0x76,
+    0xFF, 0xEC, 0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x09, 0x01, 0x2C, 0xFF, 0xFC,
+    0x02, 0x6A, 0xFF, 0xD8, 0x02, 0x70, 0x00, 0x04, 0x02, 0x71, 0xFF, 0xF4,
+    0x02, 0x74, 0x00, 0x06, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0x77, 0xFF, 0xFF,
+    0x02, 0x85, 0xFF, 0xEB, 0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x09, 0x01, 0xE1,
+    0xFF, 0xFD, 0x01, 0xE7, 0xFF, 0xFD, 0x02, 0x72, 0x00, 0x0A, 0x02, 0x74,
+    0xFF, 0xEC, 0x02, 0x76, 0xFF, 0xF4, 0x02, 0x77, 0xFF, 0xFB, 0x02, 0x85,
+    0xFF, 0xDE, 0x02, 0x8A, 0xFF, 0xE7, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x02,
+    0x02, 0x74, 0x00, 0x14, 0x02, 0x76, 0xFF, 0xEC, 0x00, 0x04, 0x00, 0xDB,
+    0xFF, 0xF6, 0x02, 0x77, 0xFF, 0xFA, 0x02, 0x85, 0x00, 0x01, 0x02, 0x8A,
+    0x00, 0x1E, 0x00, 0x02, 0x02, 0x6A, 0xFF, 0xFD, 0x02, 0x77, 0xFF, 0xE2,
+    0x00, 0x04, 0x02, 0x74, 0x00, 0x1E, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0x8A,
+    0x00, 0x1E, 0x02, 0x8E, 0x00, 0x28, 0x00, 0x0A, 0x00, 0x53, 0xFF, 0xF1,
+    0x01, 0xE7, 0xFF, 0xFD, 0x02, 0x71, 0xFF, 0xEC, 0x02, 0x72, 0x00, 0x0A,
+    0x02, 0x74, 0xFF, 0xF1, 0x02, 0x76, 0xFF, 0xE3, 0x02, 0x77, 0xFF, 0xCE,
+    0x02, 0x85, 0xFF, 0xCA, 0x02, 0x8A, 0xFF, 0xE2, 0x02, 0x8C, 0xFF, 0xE7,
+    0x00, 0x04, 0x02, 0x76, 0xFF, 0xCE, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x8A,
+    0xFF, 0xE7, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x01, 0x02, 0x77, 0xFF, 0xE2,
+    0x00, 0x03, 0x02, 0x76, 0xFF, 0x88, 0x02, 0x81, 0xFF, 0x88, 0x02, 0xA7,
+    0xFF, 0xCE, 0x00, 0x01, 0x02, 0x81, 0xFF, 0xB0, 0x00, 0x03, 0x02, 0x76,
+    0xFF, 0xB0, 0x02, 0x81, 0xFF, 0xBA, 0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x0B,
+    0x02, 0x6F, 0xFF, 0xFA, 0x02, 0x70, 0x00, 0x07, 0x02, 0x71, 0xFF, 0xEC,
+    0x02, 0x72, 0xFF, 0xF4, 0x02, 0x73, 0xFF, 0xF8, 0x02, 0x76, 0xFF, 0xB0,
+    0x02, 0x81, 0xFF, 0x9C, 0x02, 0x85, 0xFF, 0xE3, 0x02, 0xA6, 0xFF, 0xFA,
+    0x02, 0xA7, 0xFF, 0xCE, 0x02, 0xAC, 0x00, 0x06, 0x00, 0x05, 0x02, 0x76,
+    0xFF, 0xC4, 0x02, 0x7E, 0xFF, 0x9C, 0x02, 0x80, 0xFF, 0x9C, 0x02, 0x81,
+    0xFF, 0x9C, 0x02, 0xA7, 0xFF, 0xC9, 0x00, 0x04, 0x02, 0x77, 0xFF, 0xD8,
+    0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80, 0x00, 0x00, 0x02, 0x81, 0xFF, 0xC4,
+    0x00, 0x04, 0x02, 0x77, 0xFF, 0xD8, 0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80,
+    0xFF, 0xC4, 0x02, 0x81, 0xFF, 0xC4, 0x00, 0x06, 0x00, 0x53, 0xFF, 0xF1,
+    0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x85, 0xFF, 0xF6,
+    0x02, 0x8A, 0xFF, 0xE2, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x0E, 0x01, 0xE1,
+    0x00, 0x03, 0x01, 0xE7, 0xFF, 0xFD, 0x02, 0x69, 0xFF, 0x9C, 0x02, 0x6A,
+    0xFF, 0x9C, 0x02, 0x6E, 0x00, 0x0A, 0x02, 0x6F, 0x00, 0x14, 0x02, 0x71,
+    0xFF, 0xEC, 0x02, 0x72, 0x00, 0x19, 0x02, 0x73, 0x00, 0x04, 0x02, 0x74,
+    0xFF, 0xFB, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xEC, 0x02, 0x85,
+    0xFF, 0xCA, 0x02, 0xAC, 0xFF, 0xF0, 0x00, 0x04, 0x02, 0x69, 0xFF, 0x9C,
+    0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x76, 0xFF, 0xB0, 0x02, 0x77, 0xFF, 0xCE,
+    0x00, 0x08, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x4E,
+    0x00, 0x00, 0x02, 0x74, 0xFF, 0xB5, 0x02, 0x77, 0xFF, 0x9C, 0x02, 0x7E,
+    0xFF, 0xC4, 0x02, 0x80, 0xFF, 0xC4, 0x02, 0x81, 0xFF, 0xC4, 0x00, 0x03,
+    0x02, 0x7E, 0xFF, 0xA6, 0x02, 0x80, 0xFF, 0xA6, 0x02, 0x81, 0xFF, 0xA6,
+    0x00, 0x04, 0x02, 0x76, 0xFF, 0xCE, 0x02, 0x8A, 0x00, 0x28, 0x02, 0x8C,
+    0x00, 0x28, 0x02, 0x8E, 0x00, 0x1E, 0x00, 0x34, 0x00, 0x1E, 0xFF, 0xF1,
+    0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x20, 0xFF, 0xF1, 0x00, 0x21, 0xFF, 0xF1,
+    0x00, 0x22, 0xFF, 0xF1, 0x00, 0x23, 0xFF, 0xF1, 0x00, 0x24, 0xFF, 0xF1,
+    0x00, 0x47, 0xFF, 0xF1, 0x00, 0x48, 0xFF, 0xF1, 0x00, 0x49, 0xFF, 0xF1,
+    0x00, 0x4A, 0xFF, 0xF1, 0x00, 0x4B, 0xFF, 0xF1, 0x00, 0x4C, 0xFF, 0xF1,
+    0x00, 0x4D, 0xFF, 0xF1, 0x00, 0x80, 0xFF, 0xF1, 0x00, 0x81, 0xFF, 0xF1,
+    0x00, 0x82, 0xFF, 0xF1, 0x00, 0x83, 0xFF, 0xF1, 0x00, 0x84, 0xFF, 0xF1,
+    0x00, 0x85, 0xFF, 0xF1, 0x00, 0x86, 0xFF, 0xF1, 0x00, 0x87, 0xFF, 0xF1,
+    0x00, 0x88, 0xFF, 0xF1, 0x00, 0x89, 0xFF, 0xF1, 0x00, 0x8A, 0xFF, 0xF1,
+    0x00, 0x8B, 0xFF, 0xF1, 0x00, 0x8C, 0xFF, 0xF1, 0x00, 0x8D, 0xFF, 0xF1,
+    0x00, 0x8E, 0xFF, 0xF1, 0x00, 0x8F, 0xFF, 0xF1, 0x00, 0x90, 0xFF, 0xF1,
+    0x00, 0x91, 0xFF, 0xF1, 0x00, 0x92, 0xFF, 0xF1, 0x00, 0x93, 0xFF, 0xF1,
+    0x00, 0x94, 0xFF, 0xF1, 0x00, 0x95, 0xFF, 0xF1, 0x00, 0x96, 0xFF, 0xF1,
+    0x00, 0x97, 0xFF, 0xF1, 0x00, 0x98, 0xFF, 0xF1, 0x00, 0x99, 0xFF, 0xF1,
+    0x00, 0x9A, 0xFF, 0xF1, 0x00, 0x9B, 0xFF, 0xF1, 0x00, 0x9C, 0xFF, 0xF1,
+    0x00, 0x9D, 0xFF, 0xF1, 0x00, 0x9E, 0xFF, 0xF1, 0x00, 0x9F, 0xFF, 0xF1,
+    0x00, 0xA0, 0xFF, 0xF1, 0x00, 0xA1, 0xFF, 0xF1, 0x00, 0xA2, 0xFF, 0xF1,
+    0x00, 0xA3, 0xFF, 0xF1, 0x00, 0xA6, 0xFF, 0xF1, 0x00, 0xBB, 0xFF, 0xF1,
+    0x00, 0x03, 0x00, 0x53, 0xFF, 0xF6, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77,
+    0xFF, 0xCE, 0x00, 0x01, 0x02, 0x77, 0xFF, 0xD8, 0x00, 0x05, 0x00, 0x53,
+    0xFF, 0xF1, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x8A,
+    0xFF, 0xE2, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x03, 0x02, 0x8A, 0x00, 0x14,
+    0x02, 0x98, 0x00, 0x28, 0x02, 0x9A, 0x00, 0x28, 0x00, 0x02, 0x02, 0x76,
+    0xFF, 0xD8, 0x02, 0x8A, 0xFF, 0xEC, 0x00, 0x07, 0x02, 0x74, 0xFF, 0xB5,
+    0x02, 0x77, 0xFF, 0x9C, 0x02, 0x7E, 0xFF, 0xCE, 0x02, 0x80, 0xFF, 0xCE,
+    0x02, 0x81, 0xFF, 0xCE, 0x02, 0x99, 0xFF, 0xC4, 0x02, 0x9A, 0xFF, 0xC4,
+    0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x02, 0x20, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x16, 0x00, 0x21, 0x00, 0x00, 0x73, 0x22, 0x35, 0x11, 0x34, 0x33,
+    0x21, 0x32, 0x15, 0x11, 0x14, 0x23, 0x25, 0x21, 0x32, 0x36, 0x27, 0x01,
+    0x26, 0x06, 0x15, 0x11, 0x14, 0x25, 0x16, 0x36, 0x35, 0x11, 0x34, 0x23,
+    0x21, 0x22, 0x06, 0x17, 0x4B, 0x23, 0x23, 0x01, 0xB2, 0x23, 0x23, 0xFE,
+    0x4E, 0x01, 0x9D, 0x03, 0x02, 0x02, 0xFE, 0x61, 0x02, 0x04, 0x01, 0xB6,
+    0x02, 0x04, 0x05, 0xFE, 0x62, 0x03, 0x02, 0x02, 0x23, 0x02, 0x76, 0x23,
+    0x23, 0xFD, 0x8A, 0x23, 0x1E, 0x04, 0x02, 0x02, 0x57, 0x03, 0x01, 0x04,
+    0xFD, 0xAA, 0x05, 0x23, 0x03, 0x01, 0x04, 0x02, 0x56, 0x05, 0x04, 0x02,
+    0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x02, 0xBC, 0x00, 0x11,
+    0x00, 0x15, 0x00, 0x00, 0x63, 0x01, 0x33, 0x01, 0x23, 0x03, 0x2E, 0x03,
+    0x27, 0x37, 0x0E, 0x03, 0x07, 0x03, 0x27, 0x37, 0x21, 0x17, 0x0C, 0x01,
+    0x17, 0xA0, 0x01, 0x15, 0xC5, 0x78, 0x0A, 0x10, 0x0E, 0x0D, 0x05, 0x20,
+    0x06, 0x0D, 0x0E, 0x11, 0x0A, 0x78, 0x39, 0x3B, 0x01, 0x44, 0x37, 0x02,
+    0xBC, 0xFD, 0x44, 0x01, 0x45, 0x1B, 0x2E, 0x2C, 0x2E, 0x1B, 0x01, 0x1D,
+    0x2E, 0x2A, 0x2E, 0x1C, 0xFE, 0xBB, 0x74, 0x8C, 0x8C, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x61, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x02, 0xC0, 0x03, 0xA3, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x32, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x02, 0xC0, 0x04, 0x57, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x34, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0x18, 0x02, 0xC0,
+    0x03, 0xA3, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E,
+    0x60, 0x00, 0x00, 0x06, 0x03, 0x32, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x02, 0xC0, 0x04, 0x57, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x33, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x02, 0xC0, 0x04, 0x5E, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x36, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0,
+    0x04, 0x52, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x35,
+    0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xA2,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x60, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xA1, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x60, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x04, 0x54, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2E, 0x00, 0x9F, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0xFF, 0x18, 0x02, 0xC0, 0x03, 0xA1, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x60, 0x00, 0x00, 0x06, 0x03, 0x2C,
+    0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x04, 0x54,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2D, 0x00, 0x79,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x04, 0x5A,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x03, 0x30, 0x00, 0x9B,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x04, 0x52,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2F, 0x60, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xCB, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0x30, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xAC, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x5F, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
+    0xFF, 0x18, 0x02, 0xC0, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+    0x02, 0xC0, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x28, 0x69, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0,
+    0x03, 0xE0, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40,
+    0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xA4,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0x60, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0x86, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x5F, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0xFF, 0x27, 0x02, 0xC0, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x46, 0x01, 0x35, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0xAC, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x37, 0x5F, 0x00, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x02, 0xC0, 0x04, 0x8A, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x37, 0x5F, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x61,
+    0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xC0, 0x03, 0x9B,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0x5F, 0x00,
+    0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0x2F, 0x02, 0xBC, 0x00, 0x13,
+    0x00, 0x00, 0x63, 0x01, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15,
+    0x21, 0x15, 0x21, 0x35, 0x21, 0x37, 0x33, 0x11, 0x17, 0x01, 0x10, 0x01,
+    0xE8, 0x02, 0x57, 0xFE, 0xB8, 0x01, 0x1B, 0xFE, 0xE5, 0x01, 0x48, 0xFD,
+    0xFB, 0xFE, 0xEF, 0x68, 0xA9, 0x19, 0xFE, 0x88, 0x02, 0xBC, 0xA1, 0x6D,
+    0x98, 0x75, 0xA1, 0x8A, 0x98, 0x01, 0x0C, 0x08, 0xFD, 0xDA, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x04, 0x2F, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x1B,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0x9C, 0x02, 0xBC, 0x00, 0x13, 0x00, 0x1E,
+    0x00, 0x28, 0x00, 0x00, 0x73, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x27, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27, 0x33,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23, 0x53, 0x01, 0x3D, 0x4A, 0x67,
+    0x36, 0x3A, 0x37, 0x03, 0x2E, 0x45, 0x26, 0x27, 0x47, 0x5D, 0x37, 0x8E,
+    0x88, 0x17, 0x1F, 0x11, 0x12, 0x22, 0x18, 0x83, 0x64, 0x18, 0x20, 0x10,
+    0x24, 0x27, 0x61, 0x02, 0xBC, 0x2A, 0x4C, 0x34, 0x3E, 0x52, 0x0E, 0x13,
+    0x0B, 0x31, 0x47, 0x2E, 0x36, 0x50, 0x36, 0x1A, 0x9F, 0x0F, 0x1E, 0x15,
+    0x14, 0x1A, 0x0F, 0x89, 0x0E, 0x1B, 0x12, 0x1B, 0x20, 0x00, 0x00, 0x01,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xAD, 0x02, 0xCE, 0x00, 0x25, 0x00, 0x00,
+    0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02,
+    0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0xA1, 0x52, 0x8A,
+    0x65, 0x37, 0x39, 0x66, 0x8C, 0x53, 0x32, 0x5F, 0x54, 0x21, 0x77, 0x11,
+    0x2A, 0x35, 0x20, 0x25, 0x41, 0x30, 0x1B, 0x1B, 0x33, 0x47, 0x2C, 0x1F,
+    0x37, 0x2E, 0x12, 0x5E, 0x19, 0x55, 0x67, 0x0A, 0x36, 0x61, 0x85, 0x50,
+    0x4F, 0x85, 0x62, 0x36, 0x19, 0x30, 0x24, 0x8A, 0x13, 0x1E, 0x11, 0x19,
+    0x30, 0x44, 0x2C, 0x2A, 0x43, 0x2F, 0x1A, 0x12, 0x1E, 0x12, 0x95, 0x1C,
+    0x2C, 0x19, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x02, 0xAD, 0x03, 0xB9,
+    0x06, 0x26, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xAB,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x02, 0xAD, 0x03, 0xA2,
+    0x06, 0x26, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x09, 0x02, 0xAD, 0x02, 0xCE,
+    0x06, 0x26, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x45, 0x00, 0x9C,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x09, 0x02, 0xAD, 0x03, 0xB9,
+    0x06, 0x26, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x27, 0x03, 0x45, 0x00, 0x9C,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xAB, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xAD, 0x03, 0xA1, 0x06, 0x26, 0x00, 0x1E,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xAA, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xAD, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x1E,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x26, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0xE6, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x1B,
+    0x00, 0x00, 0x73, 0x11, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
+    0x23, 0x27, 0x27, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23,
+    0x23, 0x37, 0x53, 0x01, 0x2E, 0x4F, 0x82, 0x60, 0x34, 0x34, 0x60, 0x82,
+    0x4F, 0x68, 0x1F, 0x82, 0x25, 0x3B, 0x2A, 0x18, 0x18, 0x2B, 0x3A, 0x25,
+    0x85, 0x22, 0x02, 0xBC, 0x34, 0x5D, 0x80, 0x4D, 0x4C, 0x81, 0x5D, 0x34,
+    0x7E, 0x2D, 0x1A, 0x2F, 0x42, 0x28, 0x28, 0x42, 0x2F, 0x1A, 0x2B, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x05, 0x5D, 0x02, 0xBC, 0x04, 0x26,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x00, 0xEC, 0x02, 0xE2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x05, 0x5D, 0x03, 0xA2, 0x04, 0x26,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x00, 0xEC, 0x02, 0xE2, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x03, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1D,
+    0x00, 0x00, 0x02, 0xE6, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1F,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x01, 0x11, 0x21, 0x32, 0x1E, 0x02,
+    0x15, 0x14, 0x0E, 0x02, 0x23, 0x27, 0x27, 0x33, 0x32, 0x3E, 0x02, 0x35,
+    0x34, 0x2E, 0x02, 0x23, 0x23, 0x37, 0x1D, 0x01, 0x5F, 0xFE, 0xD7, 0x01,
+    0x2E, 0x4F, 0x82, 0x60, 0x34, 0x34, 0x60, 0x82, 0x4F, 0x68, 0x1F, 0x82,
+    0x25, 0x3B, 0x2A, 0x18, 0x18, 0x2B, 0x3A, 0x25, 0x85, 0x22, 0x01, 0x1C,
+    0x84, 0x84, 0xFE, 0xE4, 0x02, 0xBC, 0x34, 0x5D, 0x80, 0x4D, 0x4C, 0x81,
+    0x5D, 0x34, 0x7E, 0x2D, 0x1A, 0x2F, 0x42, 0x28, 0x28, 0x42, 0x2F, 0x1A,
+    0x2B, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0xE6, 0x03, 0xA2,
+    0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0x8D,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00, 0x02, 0xE6, 0x02, 0xBC,
+    0x06, 0x06, 0x00, 0x28, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x18,
+    0x02, 0xE6, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0x8D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x31,
+    0x02, 0xE6, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x14, 0x00, 0x8D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00,
+    0x05, 0x1C, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0xF2, 0x03, 0x0E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00,
+    0x05, 0x1C, 0x03, 0x20, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27,
+    0x01, 0xF2, 0x03, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFD, 0x03, 0x36,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x02, 0xBC,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x11, 0x21, 0x15, 0x21, 0x11,
+    0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x53, 0x01, 0xFD, 0xFE, 0xC1, 0x01,
+    0x4E, 0xFE, 0x52, 0x01, 0x77, 0x02, 0xBC, 0xA3, 0xFE, 0x8A, 0xA3, 0x01,
+    0x16, 0x9A, 0x9A, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F,
+    0x03, 0xB9, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0x64, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xA3,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 0x63, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xA2, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x63, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0xFF, 0x09, 0x02, 0x5F, 0x03, 0xA3, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x45, 0x4F, 0x00, 0x00, 0x06, 0x03, 0x32,
+    0x63, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xA1,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x63, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0xA2, 0x04, 0x54, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2E, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x18, 0x02, 0x5F, 0x03, 0xA1, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x4F, 0x00, 0x00, 0x06,
+    0x03, 0x2C, 0x63, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F,
+    0x04, 0x54, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2D,
+    0x7C, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x93, 0x04, 0x5A,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0x03, 0x30, 0x00, 0x9F,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x04, 0x52,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2F, 0x63, 0x00,
+    0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xCB, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0x34, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xAC, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x63, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0x00, 0x00, 0x02, 0x5F, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x26, 0x63, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x18,
+    0x02, 0x5F, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x4F, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F,
+    0x03, 0xB9, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28,
+    0x6D, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xE0,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x63, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0xA4, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0x63, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x03, 0x86, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0x00, 0x00, 0x02, 0x5F, 0x04, 0x8A, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x3C, 0x62, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x64,
+    0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0x5F, 0x04, 0x8A,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x03, 0x3C, 0x62, 0x00,
+    0x00, 0x07, 0x03, 0x28, 0x00, 0x6D, 0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x53,
+    0xFF, 0x27, 0x02, 0x5F, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x46, 0x00, 0xE7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0x00, 0x00, 0x02, 0x5F, 0x03, 0x9B, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x38, 0x62, 0x00, 0x00, 0x03, 0x00, 0x53, 0x00, 0x00,
+    0x02, 0x42, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x11, 0x27, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15,
+    0x53, 0xC6, 0x68, 0x01, 0x6A, 0xFE, 0x96, 0x01, 0x91, 0x02, 0xBC, 0xFD,
+    0x44, 0xFF, 0x9F, 0x9F, 0x01, 0x12, 0xAB, 0xAB, 0x00, 0x01, 0x00, 0x29,
+    0xFF, 0xF6, 0x02, 0xEC, 0x02, 0xCE, 0x00, 0x2F, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x3E, 0x02, 0x35, 0x35, 0x17, 0x23, 0x35, 0x21, 0x1E, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x01, 0x9D, 0x57, 0x8A, 0x61, 0x32, 0x37, 0x68, 0x8D, 0x56,
+    0x3B, 0x69, 0x54, 0x1E, 0x76, 0x16, 0x31, 0x39, 0x23, 0x27, 0x41, 0x30,
+    0x1B, 0x1C, 0x32, 0x45, 0x28, 0x1C, 0x30, 0x23, 0x14, 0x1A, 0xB8, 0x01,
+    0x52, 0x01, 0x03, 0x01, 0x32, 0x5A, 0x7A, 0x0A, 0x36, 0x62, 0x86, 0x4E,
+    0x4F, 0x85, 0x62, 0x36, 0x1E, 0x34, 0x20, 0x7E, 0x15, 0x1E, 0x12, 0x1D,
+    0x33, 0x47, 0x2A, 0x29, 0x47, 0x34, 0x1D, 0x12, 0x1F, 0x2B, 0x19, 0x1C,
+    0x2A, 0x90, 0x0B, 0x2D, 0x2C, 0x09, 0x43, 0x72, 0x52, 0x2E, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xEC, 0x03, 0xA3, 0x06, 0x26, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x32, 0x00, 0xA5, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xEC, 0x03, 0xA2, 0x06, 0x26, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0xA5, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xEC, 0x03, 0xA1, 0x06, 0x26, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xA5, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFE, 0xC4, 0x02, 0xEC, 0x02, 0xCE, 0x06, 0x26, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x44, 0x00, 0x91, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xEC, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x26, 0x00, 0xA5, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x02, 0xEC, 0x03, 0x86, 0x06, 0x26, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0xA4, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0xC1, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x61, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11,
+    0x03, 0x37, 0x21, 0x15, 0x01, 0xFB, 0xC6, 0xFD, 0x92, 0xC6, 0x7B, 0x01,
+    0x01, 0xC9, 0x02, 0xBC, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x06,
+    0xAE, 0xAE, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x03, 0x0F, 0x02, 0xBC,
+    0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x53, 0x35,
+    0x33, 0x17, 0x21, 0x37, 0x33, 0x15, 0x23, 0x27, 0x21, 0x07, 0x01, 0x11,
+    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x03, 0x37, 0x21, 0x15, 0x18, 0x50,
+    0x5A, 0x01, 0x8A, 0x6A, 0x59, 0x58, 0x5F, 0xFE, 0x60, 0x52, 0x01, 0x9E,
+    0xC6, 0xFD, 0x93, 0xC6, 0x7B, 0x01, 0x01, 0xC9, 0x01, 0xE5, 0x9A, 0x0A,
+    0x0A, 0x9A, 0x0A, 0x0A, 0xFE, 0x1B, 0x02, 0xBC, 0xFD, 0x44, 0x02, 0xBC,
+    0xFD, 0x44, 0x01, 0x06, 0xAE, 0xAE, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x14,
+    0x02, 0xC1, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x13, 0x00, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00,
+    0x02, 0xC1, 0x03, 0xA1, 0x06, 0x26, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2C, 0x00, 0x90, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x18,
+    0x02, 0xC1, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4A, 0x00, 0x00,
+    0x02, 0x03, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x35, 0x33, 0x11,
+    0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x33, 0x15, 0x4A, 0x7A, 0x7A, 0x01,
+    0xB9, 0x79, 0x79, 0xA2, 0x01, 0x78, 0xA2, 0xA2, 0xFE, 0x88, 0xA2, 0x00,
+    0xFF, 0xFF, 0x00, 0x4A, 0xFF, 0xF6, 0x04, 0xA6, 0x02, 0xBC, 0x04, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x07, 0x00, 0x64, 0x02, 0x4E, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x4A, 0x00, 0x00, 0x02, 0x03, 0x03, 0xB9, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x2D, 0x00, 0xFF, 0xFF,
+    0x00, 0x4A, 0x00, 0x00, 0x02, 0x03, 0x03, 0xA3, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x4A,
+    0x00, 0x00, 0x02, 0x03, 0x03, 0xA2, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x31, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0x00, 0x00,
+    0x02, 0x03, 0x03, 0xA1, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x2C, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x02, 0x03,
+    0x03, 0xCB, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41,
+    0xFD, 0x00, 0xFF, 0xFF, 0x00, 0x45, 0x00, 0x00, 0x02, 0x07, 0x03, 0xAC,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x2C, 0x00,
+    0xFF, 0xFF, 0x00, 0x45, 0x00, 0x00, 0x02, 0x07, 0x04, 0x9C, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x24, 0x2C, 0x00, 0xFF, 0xFF,
+    0x00, 0x4A, 0x00, 0x00, 0x02, 0x03, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x4A,
+    0xFF, 0x18, 0x02, 0x03, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0x00, 0x00,
+    0x02, 0x03, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x28, 0x36, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0x00, 0x00, 0x02, 0x03,
+    0x03, 0xE0, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40,
+    0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0x00, 0x00, 0x02, 0x03, 0x03, 0xA4,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0x2D, 0x00,
+    0xFF, 0xFF, 0x00, 0x4A, 0x00, 0x00, 0x02, 0x03, 0x03, 0x86, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x2C, 0x00, 0xFF, 0xFF,
+    0x00, 0x4A, 0xFF, 0x27, 0x02, 0x03, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x46, 0x5C, 0x00, 0xFF, 0xFF, 0x00, 0x4A,
+    0x00, 0x00, 0x02, 0x03, 0x03, 0x9B, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x38, 0x2C, 0x00, 0x00, 0x01, 0x00, 0x22, 0xFF, 0xF6,
+    0x02, 0x58, 0x02, 0xBC, 0x00, 0x1A, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02,
+    0x27, 0x37, 0x1E, 0x03, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x23, 0x35,
+    0x21, 0x15, 0x23, 0x11, 0x14, 0x0E, 0x02, 0x01, 0x07, 0x28, 0x46, 0x3A,
+    0x2C, 0x11, 0x6F, 0x0B, 0x15, 0x16, 0x19, 0x0D, 0x13, 0x1D, 0x10, 0x81,
+    0x01, 0xAC, 0x6C, 0x23, 0x3E, 0x53, 0x0A, 0x11, 0x20, 0x2F, 0x1D, 0x73,
+    0x10, 0x19, 0x0F, 0x09, 0x12, 0x20, 0x16, 0x01, 0x25, 0xAA, 0xAA, 0xFE,
+    0xC3, 0x35, 0x52, 0x3A, 0x1E, 0x00, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0xF6,
+    0x02, 0x58, 0x03, 0xA1, 0x06, 0x26, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2C, 0x00, 0x93, 0x00, 0x00, 0x00, 0x03, 0x00, 0x53, 0x00, 0x00,
+    0x02, 0xF1, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x77, 0x27, 0x01, 0x33, 0x01, 0x11, 0x33, 0x11, 0x33, 0x01, 0x37, 0x01,
+    0xDF, 0x3E, 0x01, 0x53, 0xE4, 0xFD, 0x7B, 0xC6, 0xF5, 0xFF, 0x00, 0x82,
+    0x01, 0x61, 0xC9, 0x9A, 0x01, 0x59, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44,
+    0x01, 0x50, 0x70, 0xFE, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFE, 0xC4,
+    0x02, 0xF1, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x66, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x44, 0x79, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x00, 0x02, 0x4A,
+    0x02, 0xBC, 0x00, 0x05, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x21, 0x15,
+    0x53, 0xC6, 0x01, 0x31, 0x02, 0xBC, 0xFD, 0xEF, 0xAB, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0xFF, 0xF6, 0x04, 0xBD, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x64, 0x02, 0x65, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x2D, 0x00, 0x00, 0x02, 0x4A, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0xBE, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0x00, 0x00, 0x02, 0x4A, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xFB, 0x00, 0xE7, 0x00, 0x06, 0xFF, 0xFF, 0x00, 0x53,
+    0xFE, 0xC4, 0x02, 0x4A, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x44, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00,
+    0x02, 0x4A, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0x69, 0x01, 0x65, 0x01, 0x36, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x18,
+    0x02, 0x4A, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x29, 0x03, 0x80,
+    0x03, 0x2F, 0x04, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x02, 0x65, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x31, 0x02, 0x4A,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14,
+    0x38, 0x00, 0x00, 0x02, 0xFF, 0xE2, 0x00, 0x00, 0x02, 0x50, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x77, 0x27, 0x25, 0x17, 0x01, 0x11,
+    0x33, 0x11, 0x21, 0x15, 0x1B, 0x39, 0x01, 0x84, 0x39, 0xFE, 0xBB, 0xC5,
+    0x01, 0x31, 0xE5, 0x94, 0xA9, 0x94, 0xFE, 0x72, 0x02, 0xBC, 0xFD, 0xEF,
+    0xAB, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x00, 0x03, 0x21, 0x02, 0xBC,
+    0x00, 0x15, 0x00, 0x00, 0x73, 0x11, 0x33, 0x13, 0x27, 0x01, 0x33, 0x11,
+    0x23, 0x35, 0x34, 0x36, 0x37, 0x17, 0x03, 0x23, 0x03, 0x37, 0x16, 0x16,
+    0x15, 0x15, 0x53, 0xAD, 0xFF, 0x87, 0x01, 0x02, 0xA7, 0xBF, 0x09, 0x0B,
+    0x16, 0xB3, 0x42, 0xAF, 0x16, 0x0B, 0x09, 0x02, 0xBC, 0xFE, 0x61, 0x01,
+    0x01, 0x9E, 0xFD, 0x44, 0xBB, 0x5A, 0x90, 0x47, 0x3B, 0xFE, 0xEB, 0x01,
+    0x15, 0x3B, 0x43, 0x8D, 0x61, 0xBB, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x18,
+    0x03, 0x21, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x72, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x00,
+    0x02, 0xDA, 0x02, 0xBC, 0x00, 0x17, 0x00, 0x00, 0x73, 0x11, 0x33, 0x01,
+    0x27, 0x2E, 0x03, 0x34, 0x35, 0x35, 0x33, 0x11, 0x23, 0x01, 0x17, 0x1E,
+    0x04, 0x15, 0x15, 0x53, 0xB1, 0x01, 0x54, 0x29, 0x05, 0x07, 0x05, 0x03,
+    0xBF, 0xB3, 0xFE, 0x92, 0x45, 0x05, 0x07, 0x04, 0x03, 0x01, 0x02, 0xBC,
+    0xFE, 0x2E, 0x0A, 0x25, 0x3C, 0x36, 0x36, 0x40, 0x28, 0x93, 0xFD, 0x44,
+    0x01, 0xF4, 0x11, 0x29, 0x3C, 0x30, 0x2C, 0x32, 0x20, 0xD0, 0xFF, 0xFF,
+    0x00, 0x53, 0xFF, 0xF6, 0x05, 0x85, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x64, 0x03, 0x2D, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0xDA, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x9E, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0xDA, 0x03, 0xA2, 0x06, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0x9D, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0xFE, 0xC4, 0x02, 0xDA, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x44, 0x00, 0x9D, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0xDA, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x26, 0x00, 0x9D, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0xFF, 0x18, 0x02, 0xDA, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xC8, 0xFF, 0x33, 0x02, 0xD3, 0x02, 0xBC, 0x00, 0x1D, 0x00, 0x00,
+    0x57, 0x27, 0x32, 0x36, 0x35, 0x11, 0x33, 0x01, 0x27, 0x2E, 0x03, 0x35,
+    0x35, 0x33, 0x11, 0x23, 0x01, 0x17, 0x1E, 0x03, 0x14, 0x15, 0x15, 0x14,
+    0x06, 0x06, 0x18, 0x50, 0x43, 0x41, 0xB1, 0x01, 0x54, 0x29, 0x06, 0x08,
+    0x04, 0x02, 0xBF, 0xB3, 0xFE, 0x92, 0x45, 0x06, 0x08, 0x04, 0x02, 0x36,
+    0x6D, 0xCD, 0x91, 0x3B, 0x3C, 0x02, 0x81, 0xFE, 0x2E, 0x0A, 0x2F, 0x47,
+    0x41, 0x4B, 0x33, 0x93, 0xFD, 0x44, 0x01, 0xF4, 0x11, 0x2B, 0x44, 0x38,
+    0x35, 0x3A, 0x24, 0x9A, 0x4F, 0x61, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0xFF, 0x29, 0x04, 0x48, 0x03, 0x2F, 0x04, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x69, 0x03, 0x2D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0xFF, 0x31, 0x02, 0xDA, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x14, 0x00, 0x9D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0x00, 0x00, 0x02, 0xDA, 0x03, 0x9B, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x38, 0x00, 0x9C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x53,
+    0xFF, 0x33, 0x02, 0xDA, 0x02, 0xBC, 0x00, 0x21, 0x00, 0x00, 0x45, 0x27,
+    0x32, 0x3E, 0x02, 0x35, 0x35, 0x17, 0x01, 0x37, 0x1E, 0x04, 0x15, 0x15,
+    0x23, 0x11, 0x33, 0x01, 0x07, 0x2E, 0x02, 0x34, 0x35, 0x35, 0x33, 0x11,
+    0x14, 0x06, 0x06, 0x01, 0xE7, 0x50, 0x16, 0x31, 0x2A, 0x19, 0x09, 0xFE,
+    0xCE, 0x0F, 0x01, 0x03, 0x04, 0x02, 0x01, 0xBF, 0xB1, 0x01, 0x37, 0x0F,
+    0x06, 0x07, 0x04, 0xBF, 0x3A, 0x6D, 0xCD, 0x91, 0x07, 0x0F, 0x16, 0x10,
+    0x36, 0x38, 0x01, 0x9E, 0x07, 0x10, 0x25, 0x26, 0x26, 0x22, 0x0C, 0xF4,
+    0x02, 0xBC, 0xFE, 0x56, 0x06, 0x2D, 0x45, 0x3C, 0x43, 0x2C, 0x93, 0xFD,
+    0x40, 0x48, 0x59, 0x28, 0x00, 0x02, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10,
+    0x02, 0xCE, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
+    0x27, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
+    0x15, 0x14, 0x1E, 0x02, 0x01, 0x9D, 0x51, 0x88, 0x64, 0x37, 0x37, 0x64,
+    0x88, 0x51, 0x51, 0x87, 0x65, 0x36, 0x36, 0x65, 0x87, 0x51, 0x24, 0x3E,
+    0x2E, 0x19, 0x19, 0x2E, 0x3E, 0x24, 0x25, 0x3E, 0x2E, 0x19, 0x19, 0x2E,
+    0x3E, 0x0A, 0x36, 0x62, 0x85, 0x4F, 0x50, 0x84, 0x62, 0x36, 0x36, 0x62,
+    0x84, 0x4F, 0x50, 0x85, 0x62, 0x36, 0xB8, 0x1A, 0x31, 0x42, 0x27, 0x27,
+    0x42, 0x31, 0x1A, 0x1A, 0x31, 0x41, 0x28, 0x27, 0x42, 0x31, 0x1A, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xB9, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xA3, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x32, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xA2, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xA1, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xA2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x04, 0x54, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2E, 0x00, 0xE2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x18, 0x03, 0x10, 0x03, 0xA1, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x0E, 0x00, 0xA3, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2C, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x03, 0x10, 0x04, 0x54, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2D, 0x00, 0xBB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x03, 0x10, 0x04, 0x5A, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x30, 0x00, 0xDE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x03, 0x10, 0x04, 0x52, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2F, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x03, 0x10, 0x03, 0xCB, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x41, 0x73, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6,
+    0x03, 0x10, 0x03, 0xAC, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x23, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6,
+    0x03, 0x10, 0x04, 0x56, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27,
+    0x03, 0x23, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0xA2,
+    0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x04, 0x56,
+    0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x26, 0x00, 0xA3,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0xA2, 0x00, 0xD0, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0x18, 0x03, 0x10, 0x02, 0xCE, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xA3, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xB9, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0xAC, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xE0, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x29, 0xFF, 0xF6, 0x03, 0x1E, 0x03, 0x3F, 0x00, 0x23, 0x00, 0x37,
+    0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x14, 0x0E,
+    0x02, 0x07, 0x37, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E,
+    0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E,
+    0x02, 0x01, 0x9D, 0x51, 0x88, 0x64, 0x37, 0x37, 0x64, 0x88, 0x51, 0x14,
+    0x2E, 0x18, 0x12, 0x22, 0x13, 0x1B, 0x24, 0x13, 0x8E, 0x0E, 0x24, 0x41,
+    0x34, 0x1F, 0x26, 0x36, 0x1E, 0x36, 0x65, 0x87, 0x51, 0x24, 0x3E, 0x2E,
+    0x19, 0x19, 0x2E, 0x3E, 0x24, 0x25, 0x3E, 0x2E, 0x19, 0x19, 0x2E, 0x3E,
+    0x0A, 0x36, 0x62, 0x85, 0x4F, 0x50, 0x84, 0x62, 0x36, 0x06, 0x04, 0x04,
+    0x08, 0x1E, 0x3C, 0x2D, 0x2A, 0x4E, 0x3F, 0x26, 0x01, 0x17, 0x21, 0x56,
+    0x65, 0x3A, 0x4F, 0x85, 0x62, 0x36, 0xB8, 0x1A, 0x31, 0x42, 0x27, 0x27,
+    0x42, 0x31, 0x1A, 0x1A, 0x31, 0x41, 0x28, 0x27, 0x42, 0x31, 0x1A, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x1E, 0x03, 0xB9, 0x06, 0x26,
+    0x00, 0x91, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x18, 0x03, 0x1E, 0x03, 0x3F, 0x06, 0x26,
+    0x00, 0x91, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x1E, 0x03, 0xB9, 0x06, 0x26,
+    0x00, 0x91, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0xAC, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x1E, 0x03, 0xE0, 0x06, 0x26,
+    0x00, 0x91, 0x00, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0xA2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x1E, 0x03, 0x9B, 0x06, 0x26,
+    0x00, 0x91, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0xA2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xD4, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2B, 0x00, 0xDB, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0xA4, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x42, 0x00, 0xA3, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x03, 0x86, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0xA2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x04, 0x8A, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x3C, 0x00, 0xA2, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0xA3, 0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x03, 0x10, 0x04, 0x8A, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x27, 0x03, 0x3C, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28,
+    0x00, 0xAC, 0x00, 0xD0, 0x00, 0x03, 0x00, 0x29, 0xFF, 0x27, 0x03, 0x10,
+    0x02, 0xCE, 0x00, 0x17, 0x00, 0x2B, 0x00, 0x3F, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x03, 0x15, 0x14, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x22, 0x2E, 0x02, 0x35,
+    0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27,
+    0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15,
+    0x14, 0x1E, 0x02, 0x02, 0x01, 0x35, 0x43, 0x1E, 0x38, 0x49, 0x2B, 0x21,
+    0x14, 0x29, 0x22, 0x14, 0x0F, 0x0B, 0x0A, 0x0E, 0x07, 0x4C, 0x12, 0x44,
+    0x93, 0x51, 0x88, 0x64, 0x37, 0x37, 0x64, 0x88, 0x51, 0x51, 0x87, 0x65,
+    0x36, 0x36, 0x65, 0x87, 0x51, 0x24, 0x3E, 0x2E, 0x19, 0x19, 0x2E, 0x3E,
+    0x24, 0x25, 0x3E, 0x2E, 0x19, 0x19, 0x2E, 0x3E, 0xD9, 0x41, 0x32, 0x22,
+    0x39, 0x30, 0x2B, 0x15, 0x31, 0x0C, 0x1C, 0x1D, 0x22, 0x13, 0x0E, 0x11,
+    0x0B, 0x0C, 0x38, 0x20, 0x33, 0xCF, 0x36, 0x62, 0x85, 0x4F, 0x50, 0x84,
+    0x62, 0x36, 0x36, 0x62, 0x84, 0x50, 0x4F, 0x85, 0x62, 0x36, 0xB8, 0x1A,
+    0x31, 0x42, 0x27, 0x27, 0x42, 0x31, 0x1A, 0x1A, 0x31, 0x41, 0x28, 0x27,
+    0x42, 0x31, 0x1A, 0x00, 0x00, 0x03, 0x00, 0x29, 0xFF, 0xDF, 0x03, 0x10,
+    0x02, 0xE5, 0x00, 0x03, 0x00, 0x17, 0x00, 0x2B, 0x00, 0x00, 0x57, 0x27,
+    0x01, 0x17, 0x01, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x34,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x92, 0x3F,
+    0x02, 0x4D, 0x44, 0xFE, 0xB9, 0x51, 0x88, 0x64, 0x37, 0x37, 0x64, 0x88,
+    0x50, 0x52, 0x87, 0x64, 0x37, 0x37, 0x64, 0x87, 0x52, 0x25, 0x3E, 0x2E,
+    0x19, 0x19, 0x2E, 0x3E, 0x25, 0x24, 0x3E, 0x2E, 0x19, 0x19, 0x2E, 0x3E,
+    0x21, 0x35, 0x02, 0xD1, 0x2F, 0xFD, 0x40, 0x36, 0x62, 0x85, 0x4F, 0x50,
+    0x84, 0x62, 0x36, 0x36, 0x62, 0x84, 0x4F, 0x50, 0x85, 0x62, 0x36, 0xB8,
+    0x1A, 0x31, 0x42, 0x27, 0x27, 0x42, 0x31, 0x1A, 0x1A, 0x31, 0x41, 0x28,
+    0x27, 0x42, 0x31, 0x1A, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xDF, 0x03, 0x10,
+    0x03, 0xB9, 0x06, 0x26, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29,
+    0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10,
+    0x03, 0x9B, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38,
+    0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10,
+    0x04, 0x8A, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x38,
+    0x00, 0xA2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA3, 0x00, 0xD0,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x03, 0x10, 0x04, 0x7C, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x38, 0x00, 0xA2, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x23, 0x00, 0xA2, 0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x03, 0x10, 0x04, 0x56, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x27, 0x03, 0x38, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C,
+    0x00, 0xA2, 0x00, 0xD0, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x04, 0x1A,
+    0x02, 0xBC, 0x00, 0x14, 0x00, 0x21, 0x00, 0x00, 0x61, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21,
+    0x15, 0x21, 0x15, 0x01, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x11, 0x23, 0x22,
+    0x0E, 0x02, 0x01, 0x77, 0x4D, 0x7B, 0x57, 0x2F, 0x32, 0x5D, 0x82, 0x51,
+    0x02, 0x8F, 0xFE, 0xB3, 0x01, 0x16, 0xFE, 0xEA, 0x01, 0x4D, 0xFC, 0xD7,
+    0x16, 0x29, 0x3B, 0x27, 0x7D, 0x7A, 0x27, 0x3D, 0x2A, 0x16, 0x32, 0x5D,
+    0x81, 0x4E, 0x4E, 0x80, 0x5E, 0x32, 0xA3, 0x65, 0x9A, 0x77, 0xA3, 0x01,
+    0x5E, 0x2A, 0x43, 0x2E, 0x18, 0x01, 0x66, 0x18, 0x2F, 0x42, 0x00, 0x02,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0x7A, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x17,
+    0x00, 0x00, 0x73, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x23, 0x15, 0x03, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x23, 0x53, 0x01, 0x36, 0x45, 0x6D, 0x3F, 0x3F, 0x6D, 0x45, 0x70,
+    0x03, 0x51, 0x15, 0x20, 0x13, 0x13, 0x20, 0x15, 0x51, 0x02, 0xBC, 0x3D,
+    0x6A, 0x45, 0x47, 0x6F, 0x40, 0xDA, 0x01, 0x85, 0x11, 0x20, 0x17, 0x17,
+    0x1E, 0x0F, 0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x02, 0x7A, 0x02, 0xBC,
+    0x00, 0x0E, 0x00, 0x19, 0x00, 0x00, 0x73, 0x11, 0x33, 0x15, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x11, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x53, 0xC6, 0x70, 0x45,
+    0x6D, 0x3F, 0x3F, 0x6D, 0x45, 0x70, 0x4E, 0x15, 0x20, 0x13, 0x13, 0x20,
+    0x15, 0x4E, 0x02, 0xBC, 0x69, 0x3D, 0x6A, 0x44, 0x47, 0x70, 0x3F, 0x72,
+    0x01, 0x1C, 0x12, 0x20, 0x16, 0x17, 0x1E, 0x10, 0x00, 0x03, 0x00, 0x29,
+    0xFF, 0x92, 0x03, 0x10, 0x02, 0xCE, 0x00, 0x03, 0x00, 0x17, 0x00, 0x2B,
+    0x00, 0x00, 0x45, 0x01, 0x37, 0x01, 0x05, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32,
+    0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x1E, 0x02, 0x02, 0x68, 0xFE, 0xF3, 0x8D, 0x01, 0x0A, 0xFE, 0xAB, 0x51,
+    0x88, 0x64, 0x37, 0x37, 0x64, 0x88, 0x51, 0x51, 0x87, 0x65, 0x36, 0x36,
+    0x65, 0x87, 0x51, 0x24, 0x3E, 0x2E, 0x19, 0x19, 0x2E, 0x3E, 0x24, 0x25,
+    0x3E, 0x2E, 0x19, 0x19, 0x2E, 0x3E, 0x6E, 0x01, 0x71, 0x64, 0xFE, 0x92,
+    0x03, 0x36, 0x62, 0x85, 0x4F, 0x50, 0x84, 0x62, 0x36, 0x36, 0x62, 0x84,
+    0x50, 0x4F, 0x85, 0x62, 0x36, 0xB8, 0x1A, 0x31, 0x42, 0x27, 0x27, 0x42,
+    0x31, 0x1A, 0x1A, 0x31, 0x41, 0x28, 0x27, 0x42, 0x31, 0x1A, 0x00, 0x03,
+    0x00, 0x53, 0x00, 0x00, 0x02, 0xA9, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x10,
+    0x00, 0x1B, 0x00, 0x00, 0x73, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x23, 0x23, 0x15, 0x33, 0x03, 0x37, 0x13, 0x01, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x53, 0x01, 0x43, 0x47,
+    0x70, 0x3F, 0x3F, 0x70, 0x47, 0x89, 0xBD, 0xB2, 0xCB, 0xC6, 0xFE, 0x64,
+    0x6E, 0x1A, 0x23, 0x13, 0x14, 0x27, 0x1D, 0x66, 0x02, 0xBC, 0x3A, 0x64,
+    0x41, 0x46, 0x6C, 0x3D, 0xEE, 0x01, 0x3C, 0x19, 0xFE, 0xAB, 0x01, 0x7C,
+    0x15, 0x25, 0x19, 0x18, 0x23, 0x13, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00,
+    0x02, 0xA9, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x29, 0x5A, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0x00, 0x00, 0x02, 0xA9,
+    0x03, 0xA2, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31,
+    0x5A, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFE, 0xC4, 0x02, 0xA9, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x67, 0x00,
+    0xFF, 0xFF, 0x00, 0x35, 0x00, 0x00, 0x02, 0xA9, 0x03, 0xCB, 0x06, 0x26,
+    0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0x2A, 0x00, 0xFF, 0xFF,
+    0x00, 0x53, 0xFF, 0x18, 0x02, 0xA9, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xA7,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x67, 0x00, 0xFF, 0xFF, 0x00, 0x53,
+    0x00, 0x00, 0x02, 0xA9, 0x03, 0xA4, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x42, 0x5A, 0x00, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0x31,
+    0x02, 0xA9, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0x67, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D,
+    0x02, 0xCE, 0x00, 0x36, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x27, 0x37,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x27, 0x2E,
+    0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E,
+    0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03,
+    0x15, 0x14, 0x06, 0x06, 0x01, 0x43, 0x4B, 0x75, 0x59, 0x23, 0x74, 0x32,
+    0x6A, 0x32, 0x16, 0x24, 0x13, 0x10, 0x1C, 0x22, 0x22, 0x10, 0x3B, 0x58,
+    0x3B, 0x1D, 0x2E, 0x4C, 0x63, 0x36, 0x4A, 0x68, 0x47, 0x1A, 0x76, 0x15,
+    0x31, 0x34, 0x1B, 0x19, 0x25, 0x14, 0x16, 0x22, 0x27, 0x10, 0x37, 0x5B,
+    0x44, 0x24, 0x4B, 0x7F, 0x0A, 0x22, 0x40, 0x2B, 0x83, 0x41, 0x2B, 0x09,
+    0x15, 0x10, 0x0E, 0x14, 0x0F, 0x0C, 0x07, 0x04, 0x0D, 0x28, 0x37, 0x48,
+    0x2D, 0x31, 0x52, 0x3B, 0x1F, 0x1D, 0x36, 0x24, 0x72, 0x17, 0x1E, 0x0F,
+    0x0A, 0x13, 0x10, 0x0E, 0x15, 0x0E, 0x09, 0x03, 0x0B, 0x23, 0x35, 0x4C,
+    0x33, 0x4B, 0x67, 0x35, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D,
+    0x03, 0xB9, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0x52, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D, 0x03, 0xCF,
+    0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2A, 0x62, 0x00,
+    0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D, 0x03, 0xA2, 0x06, 0x26,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x52, 0x00, 0xFF, 0xFF,
+    0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D, 0x04, 0x79, 0x06, 0x26, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x31, 0x52, 0x00, 0x00, 0x07, 0x03, 0x26,
+    0x00, 0x51, 0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x09, 0x02, 0x5D,
+    0x02, 0xCE, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x45,
+    0x59, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D, 0x03, 0xA1,
+    0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x51, 0x00,
+    0xFF, 0xFF, 0x00, 0x07, 0xFE, 0xC4, 0x02, 0x5D, 0x02, 0xCE, 0x06, 0x26,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x59, 0x00, 0xFF, 0xFF,
+    0x00, 0x07, 0xFF, 0xF6, 0x02, 0x5D, 0x03, 0xA8, 0x06, 0x26, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x52, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+    0xFF, 0x18, 0x02, 0x5D, 0x02, 0xCE, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x59, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x18,
+    0x02, 0x5D, 0x03, 0xA8, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x0E, 0x59, 0x00, 0x00, 0x06, 0x03, 0x26, 0x52, 0x00, 0x00, 0x01,
+    0x00, 0x53, 0xFF, 0xF6, 0x03, 0x20, 0x02, 0xD6, 0x00, 0x3B, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17,
+    0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x15, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16,
+    0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x02, 0x1F, 0x2D, 0x57, 0x45,
+    0x14, 0x66, 0x1A, 0x34, 0x18, 0x1D, 0x20, 0x16, 0x2F, 0x27, 0x28, 0x2E,
+    0x14, 0x24, 0x3B, 0x49, 0x25, 0x38, 0x1E, 0x5E, 0x29, 0x2B, 0x46, 0x30,
+    0x1B, 0xC6, 0x5F, 0xA9, 0x71, 0x44, 0x81, 0x38, 0x31, 0x3F, 0x1D, 0x13,
+    0x26, 0x1C, 0x2B, 0x41, 0x23, 0x46, 0x74, 0x0A, 0x17, 0x27, 0x17, 0x7A,
+    0x19, 0x1B, 0x1D, 0x14, 0x11, 0x1B, 0x20, 0x15, 0x17, 0x29, 0x31, 0x1F,
+    0x21, 0x3A, 0x2A, 0x19, 0x01, 0x27, 0x0B, 0x10, 0x20, 0x3E, 0x59, 0x38,
+    0xFE, 0xA9, 0x01, 0x5E, 0x71, 0xA9, 0x5E, 0x14, 0x18, 0x8C, 0x04, 0x17,
+    0x20, 0x12, 0x11, 0x1C, 0x1A, 0x0D, 0x16, 0x2D, 0x41, 0x35, 0x39, 0x5E,
+    0x37, 0x00, 0x00, 0x01, 0x00, 0x29, 0xFF, 0xF6, 0x02, 0xD5, 0x02, 0xC6,
+    0x00, 0x2A, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x27, 0x35, 0x21, 0x17,
+    0x21, 0x1E, 0x03, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23,
+    0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15,
+    0x14, 0x0E, 0x02, 0x01, 0x7F, 0x44, 0x79, 0x5D, 0x39, 0x03, 0x02, 0x7E,
+    0x09, 0xFE, 0x4E, 0x08, 0x1C, 0x22, 0x28, 0x13, 0x20, 0x33, 0x26, 0x15,
+    0x17, 0x2B, 0x3B, 0x24, 0x26, 0x3C, 0x38, 0x1F, 0x4B, 0x2E, 0x51, 0x5B,
+    0x3A, 0x47, 0x7D, 0x5F, 0x36, 0x35, 0x5F, 0x7B, 0x0A, 0x30, 0x58, 0x76,
+    0x45, 0x6C, 0x9A, 0x17, 0x23, 0x18, 0x0C, 0x16, 0x2D, 0x42, 0x2D, 0x28,
+    0x41, 0x2F, 0x18, 0x0D, 0x1B, 0x17, 0x9A, 0x21, 0x28, 0x13, 0x38, 0x63,
+    0x82, 0x4B, 0x4B, 0x82, 0x63, 0x38, 0x00, 0x01, 0x00, 0x1F, 0x00, 0x00,
+    0x02, 0x94, 0x02, 0xBC, 0x00, 0x07, 0x00, 0x00, 0x73, 0x11, 0x23, 0x35,
+    0x21, 0x15, 0x23, 0x11, 0xF3, 0xD4, 0x02, 0x75, 0xDB, 0x02, 0x11, 0xAB,
+    0xAB, 0xFD, 0xEF, 0x00, 0x00, 0x02, 0x00, 0x1F, 0x00, 0x00, 0x02, 0x94,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x01, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0xB0, 0x01, 0x5F, 0xFE,
+    0xE4, 0xD4, 0x02, 0x75, 0xDB, 0x01, 0x1D, 0x84, 0x84, 0xFE, 0xE3, 0x02,
+    0x11, 0xAB, 0xAB, 0xFD, 0xEF, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0x00, 0x00,
+    0x02, 0x94, 0x03, 0xA2, 0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x31, 0x5F, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x09, 0x02, 0x94,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x45,
+    0x5F, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFE, 0xC4, 0x02, 0x94, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x5F, 0x00,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x18, 0x02, 0x94, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x5F, 0x00, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0x31, 0x02, 0x94, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x14, 0x5F, 0x00, 0x00, 0x01, 0x00, 0x51,
+    0xFF, 0xFA, 0x02, 0xB7, 0x02, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x01, 0x84, 0x59, 0x8B,
+    0x4F, 0xC8, 0x1C, 0x31, 0x1E, 0x21, 0x32, 0x1E, 0xC2, 0x4F, 0x8A, 0x06,
+    0x47, 0x7C, 0x50, 0x01, 0xAF, 0xFE, 0x5A, 0x21, 0x33, 0x1D, 0x1D, 0x33,
+    0x21, 0x01, 0xA6, 0xFE, 0x51, 0x50, 0x7C, 0x47, 0xFF, 0xFF, 0x00, 0x51,
+    0xFF, 0xFA, 0x02, 0xB7, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0x8B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51,
+    0xFF, 0xFA, 0x02, 0xB7, 0x03, 0xA3, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x32, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51,
+    0xFF, 0xFA, 0x02, 0xB7, 0x03, 0xA2, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51,
+    0xFF, 0xFA, 0x02, 0xB7, 0x03, 0xA1, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2C, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51,
+    0xFF, 0xFA, 0x02, 0xB7, 0x03, 0xCB, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x41, 0x5A, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0xAC, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x23, 0x00, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0x18,
+    0x02, 0xB7, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x28, 0x00, 0x93, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0xE0, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x40, 0x00, 0x8A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x51, 0xFF, 0xFA,
+    0x03, 0x23, 0x03, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
+    0x11, 0x33, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x07, 0x37, 0x11,
+    0x14, 0x06, 0x06, 0x01, 0x84, 0x59, 0x8B, 0x4F, 0xC8, 0x1C, 0x31, 0x1E,
+    0x21, 0x32, 0x1E, 0x48, 0x2D, 0x2B, 0x8E, 0x21, 0x47, 0x3A, 0x36, 0x4F,
+    0x8A, 0x06, 0x47, 0x7C, 0x50, 0x01, 0xAF, 0xFE, 0x5A, 0x21, 0x33, 0x1D,
+    0x1D, 0x33, 0x21, 0x01, 0xA6, 0x42, 0x41, 0x35, 0x5E, 0x3E, 0x05, 0x2C,
+    0xFE, 0x78, 0x50, 0x7C, 0x47, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x03, 0x23, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x29, 0x00, 0x8B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0x18,
+    0x03, 0x23, 0x03, 0x3F, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x03, 0x23, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x28, 0x00, 0x93, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x03, 0x23, 0x03, 0xE0, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x40, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x03, 0x23, 0x03, 0x9B, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x38, 0x00, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0xD4, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2B, 0x00, 0xC3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0xA4, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x42, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0x86, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x3C, 0x00, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x04, 0x7C, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x27,
+    0x03, 0x3C, 0x00, 0x89, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0x89,
+    0x00, 0xD0, 0x00, 0x02, 0x00, 0x51, 0xFF, 0x27, 0x02, 0xB7, 0x02, 0xBC,
+    0x00, 0x17, 0x00, 0x2D, 0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x3E,
+    0x02, 0x37, 0x17, 0x0E, 0x03, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
+    0x17, 0x06, 0x06, 0x27, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06,
+    0x06, 0x01, 0xD4, 0x35, 0x43, 0x1F, 0x37, 0x49, 0x2C, 0x21, 0x15, 0x29,
+    0x22, 0x14, 0x0F, 0x0B, 0x0A, 0x0E, 0x07, 0x4C, 0x11, 0x44, 0x80, 0x59,
+    0x8B, 0x4F, 0xC8, 0x1C, 0x31, 0x1E, 0x21, 0x32, 0x1E, 0xC2, 0x4F, 0x8A,
+    0xD9, 0x41, 0x32, 0x22, 0x39, 0x30, 0x2B, 0x15, 0x31, 0x0C, 0x1C, 0x1D,
+    0x22, 0x13, 0x0E, 0x11, 0x0B, 0x0C, 0x38, 0x20, 0x33, 0xD3, 0x47, 0x7C,
+    0x50, 0x01, 0xAF, 0xFE, 0x5A, 0x21, 0x33, 0x1D, 0x1D, 0x33, 0x21, 0x01,
+    0xA6, 0xFE, 0x51, 0x50, 0x7C, 0x47, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0xAC, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x37, 0x00, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x03, 0x9B, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x38, 0x00, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x51, 0xFF, 0xFA,
+    0x02, 0xB7, 0x04, 0x8A, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x27,
+    0x03, 0x38, 0x00, 0x89, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x8B,
+    0x00, 0xD0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xCB, 0x02, 0xBC,
+    0x00, 0x10, 0x00, 0x00, 0x61, 0x01, 0x33, 0x13, 0x1E, 0x03, 0x17, 0x23,
+    0x3E, 0x02, 0x37, 0x13, 0x33, 0x01, 0x01, 0x13, 0xFE, 0xE9, 0xC8, 0x79,
+    0x0C, 0x10, 0x0C, 0x0C, 0x06, 0x21, 0x09, 0x10, 0x13, 0x0F, 0x77, 0xC3,
+    0xFE, 0xE7, 0x02, 0xBC, 0xFE, 0xBA, 0x1F, 0x2D, 0x27, 0x2B, 0x1E, 0x27,
+    0x36, 0x36, 0x29, 0x01, 0x46, 0xFD, 0x44, 0x00, 0x00, 0x01, 0xFF, 0xFC,
+    0x00, 0x00, 0x03, 0xE3, 0x02, 0xBC, 0x00, 0x22, 0x00, 0x00, 0x73, 0x03,
+    0x33, 0x13, 0x1E, 0x03, 0x17, 0x23, 0x3E, 0x02, 0x37, 0x13, 0x33, 0x13,
+    0x1E, 0x02, 0x17, 0x07, 0x36, 0x34, 0x3E, 0x02, 0x37, 0x13, 0x33, 0x03,
+    0x23, 0x03, 0x33, 0x03, 0xC7, 0xCB, 0xC7, 0x5B, 0x07, 0x0B, 0x06, 0x04,
+    0x01, 0x13, 0x03, 0x05, 0x0C, 0x0C, 0x5E, 0x99, 0x5D, 0x0E, 0x0F, 0x08,
+    0x02, 0x11, 0x01, 0x02, 0x04, 0x08, 0x06, 0x5B, 0xC1, 0xCC, 0x9A, 0x9E,
+    0x18, 0x8E, 0x02, 0xBC, 0xFE, 0xB0, 0x1D, 0x37, 0x2F, 0x28, 0x0D, 0x1E,
+    0x39, 0x3D, 0x24, 0x01, 0x02, 0xFE, 0xFE, 0x26, 0x3F, 0x38, 0x1A, 0x01,
+    0x0F, 0x1E, 0x21, 0x26, 0x2B, 0x19, 0x01, 0x50, 0xFD, 0x44, 0x01, 0x83,
+    0xFE, 0x7D, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE3, 0x03, 0xB9,
+    0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xF6,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE3, 0x03, 0xA1,
+    0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xF5,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE3, 0x03, 0xAC,
+    0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0xF5,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xE3, 0x03, 0xB9,
+    0x06, 0x26, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0xFF,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF3, 0x00, 0x00, 0x02, 0xD6, 0x02, 0xBC,
+    0x00, 0x05, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x00, 0x61, 0x03, 0x01, 0x33,
+    0x13, 0x01, 0x21, 0x01, 0x17, 0x03, 0x13, 0x27, 0x13, 0x33, 0x01, 0xE7,
+    0xD9, 0xFE, 0xEA, 0xEF, 0xD4, 0x01, 0x1B, 0xFD, 0x1D, 0x01, 0x0B, 0xA9,
+    0xCF, 0xF3, 0xA8, 0xC4, 0xE5, 0x01, 0x3A, 0x01, 0x82, 0xFE, 0xCA, 0xFE,
+    0x7A, 0x01, 0x7D, 0x4F, 0xFE, 0xD2, 0x01, 0x45, 0x4C, 0x01, 0x2B, 0x00,
+    0x00, 0x01, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x00, 0x61, 0x11, 0x17, 0x01, 0x33, 0x13, 0x27, 0x13, 0x33, 0x01,
+    0x37, 0x11, 0x01, 0x05, 0x07, 0xFE, 0xE5, 0xDE, 0xD8, 0x75, 0xC3, 0xD8,
+    0xFE, 0xF1, 0x0F, 0x01, 0x5D, 0x31, 0x01, 0x90, 0xFE, 0xCA, 0x03, 0x01,
+    0x33, 0xFE, 0x65, 0x44, 0xFE, 0x9B, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+    0x02, 0xCD, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x29, 0x65, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD,
+    0x03, 0xA1, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C,
+    0x65, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD, 0x03, 0xAC,
+    0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x64, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x65, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF1, 0xFF, 0x18, 0x02, 0xCD, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xE2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x65, 0x00, 0xFF, 0xFF, 0xFF, 0xF1,
+    0x00, 0x00, 0x02, 0xCD, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x28, 0x6E, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+    0x02, 0xCD, 0x03, 0xE0, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x40, 0x65, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD,
+    0x03, 0x86, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C,
+    0x64, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD, 0x03, 0x9B,
+    0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0x64, 0x00,
+    0x00, 0x01, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x7B, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x00, 0x73, 0x35, 0x01, 0x17, 0x21, 0x35, 0x21, 0x15, 0x01, 0x27,
+    0x21, 0x15, 0x3C, 0x01, 0x6E, 0x4F, 0xFE, 0x5D, 0x02, 0x1A, 0xFE, 0x94,
+    0x50, 0x01, 0xC7, 0x81, 0x01, 0xE4, 0x5C, 0xB3, 0x80, 0xFE, 0x1B, 0x52,
+    0xA9, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x7B, 0x03, 0xB9,
+    0x06, 0x26, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x63, 0x00,
+    0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x7B, 0x03, 0xA2, 0x06, 0x26,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x61, 0x00, 0xFF, 0xFF,
+    0x00, 0x3C, 0x00, 0x00, 0x02, 0x7B, 0x03, 0xA8, 0x06, 0x26, 0x00, 0xEC,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x3C,
+    0xFF, 0x18, 0x02, 0x7B, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0xFF, 0xF6,
+    0x04, 0xA6, 0x03, 0xB9, 0x04, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x29, 0x2D, 0x00, 0x00, 0x27, 0x00, 0x64, 0x02, 0x4E, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x02, 0xE1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x53,
+    0x00, 0x00, 0x01, 0x19, 0x02, 0xBC, 0x00, 0x06, 0x00, 0x00, 0x73, 0x11,
+    0x33, 0x32, 0x32, 0x33, 0x11, 0x53, 0x63, 0x19, 0x32, 0x18, 0x02, 0xBC,
+    0xFD, 0x44, 0xFF, 0xFF, 0x00, 0x53, 0xFF, 0xF6, 0x03, 0x59, 0x02, 0xBC,
+    0x04, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x01, 0x6D,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2C, 0x00, 0x00, 0x01, 0x42, 0x03, 0xB9,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0xBD, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x01, 0x71, 0x03, 0xA3, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 0xBC, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x00, 0x01, 0x75, 0x03, 0xA2, 0x06, 0x26, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x01, 0x74, 0x03, 0xA1, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x2C, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0x97, 0x00, 0x00,
+    0x01, 0x76, 0x03, 0xCB, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x41, 0xFF, 0x8C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00,
+    0x01, 0x97, 0x03, 0xAC, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x23, 0xBB, 0x00, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x01, 0x97,
+    0x04, 0x9C, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x24,
+    0xBB, 0x00, 0xFF, 0xFF, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x22, 0x03, 0xA8,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0xBC, 0x00,
+    0xFF, 0xFF, 0x00, 0x48, 0xFF, 0x18, 0x01, 0x25, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xBC, 0x00, 0xFF, 0xFF,
+    0x00, 0x34, 0x00, 0x00, 0x01, 0x4B, 0x03, 0xB9, 0x06, 0x26, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0xC5, 0x00, 0xFF, 0xFF, 0x00, 0x31,
+    0x00, 0x00, 0x01, 0x3C, 0x03, 0xE0, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x40, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+    0x01, 0x71, 0x03, 0xA4, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x42, 0xBC, 0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0x6F,
+    0x03, 0x86, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C,
+    0xBB, 0x00, 0xFF, 0xFF, 0x00, 0x34, 0xFF, 0x27, 0x01, 0x30, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x46, 0xFF, 0xB8,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0x7B, 0x03, 0x9B,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0xBB, 0x00,
+    0x00, 0x01, 0x00, 0x19, 0xFF, 0xF6, 0x01, 0xEC, 0x02, 0xBC, 0x00, 0x15,
+    0x00, 0x00, 0x57, 0x22, 0x2E, 0x02, 0x27, 0x37, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x0E, 0x02, 0xFC, 0x2B, 0x48,
+    0x39, 0x2A, 0x0D, 0x73, 0x0E, 0x1C, 0x20, 0x12, 0x13, 0x20, 0x12, 0xBF,
+    0x22, 0x40, 0x59, 0x0A, 0x11, 0x1E, 0x2A, 0x19, 0x74, 0x13, 0x1B, 0x0D,
+    0x11, 0x21, 0x17, 0x01, 0xD2, 0xFE, 0x19, 0x35, 0x52, 0x3A, 0x1E, 0x00,
+    0xFF, 0xFF, 0x00, 0x19, 0xFF, 0xF6, 0x02, 0x4C, 0x03, 0xA1, 0x06, 0x26,
+    0x01, 0x03, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0x94, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0xFF, 0xF6, 0x04, 0x51, 0x02, 0xBC, 0x04, 0x26,
+    0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x02, 0x65, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x53, 0xFF, 0xF6, 0x05, 0x19, 0x02, 0xBC, 0x04, 0x26,
+    0x00, 0x74, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x03, 0x2D, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x02, 0x20, 0x00, 0x18,
+    0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x1E, 0x02, 0x17, 0x27, 0x35, 0x33, 0x11, 0x23, 0x35, 0x17,
+    0x0E, 0x03, 0x37, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x07, 0x42, 0x69, 0x3D, 0x3C,
+    0x6A, 0x45, 0x25, 0x3E, 0x2E, 0x22, 0x0B, 0x26, 0xB7, 0xBB, 0x29, 0x09,
+    0x23, 0x32, 0x3D, 0x10, 0x20, 0x2E, 0x19, 0x19, 0x2E, 0x20, 0x20, 0x2D,
+    0x18, 0x18, 0x2D, 0x09, 0x47, 0x7D, 0x50, 0x52, 0x7C, 0x47, 0x14, 0x26,
+    0x30, 0x1C, 0x02, 0x79, 0xFD, 0xEB, 0x82, 0x02, 0x1D, 0x32, 0x25, 0x15,
+    0x99, 0x1D, 0x38, 0x26, 0x27, 0x38, 0x1D, 0x1D, 0x38, 0x27, 0x26, 0x38,
+    0x1D, 0x00, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0x2D,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x56, 0x08,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0x0D, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x56, 0x08, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0xE6, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xEA, 0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0x18, 0x02, 0x59, 0x03, 0x0D, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x0E, 0x56, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x56, 0x08,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0xE6, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEB, 0x56, 0x08, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0xEE, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xEC, 0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xF7, 0x02, 0x59, 0x03, 0xD4, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xED, 0x55, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7,
+    0x02, 0x59, 0x03, 0x20, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFD, 0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59,
+    0x03, 0x18, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC,
+    0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0xA6, 0x03, 0xD3,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x02, 0xEE, 0x00, 0x9E,
+    0x00, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x18, 0x02, 0x59, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x56, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7,
+    0x02, 0x59, 0x03, 0xD3, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEF, 0x6E, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x88,
+    0x03, 0xD9, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF0,
+    0x00, 0x93, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59,
+    0x03, 0xD3, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1,
+    0x55, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0x38,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0x1A, 0x08,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0x2F, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x55, 0x08, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0x18, 0x02, 0x59, 0x02, 0x20, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x56, 0x00, 0xFF, 0xFF, 0x00, 0x1F,
+    0xFF, 0xF7, 0x02, 0x59, 0x03, 0x2E, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF7, 0x42, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7,
+    0x02, 0x59, 0x03, 0x4A, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x09, 0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59,
+    0x03, 0x17, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B,
+    0x56, 0x08, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x02, 0xEF,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x56, 0x08,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0x28, 0x02, 0x59, 0x02, 0x20, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x03, 0x12, 0x00, 0xD5, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x03, 0x4F, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x56, 0x08, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59, 0x04, 0x53, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x56, 0x08, 0x00, 0x07, 0x02, 0xF8,
+    0x00, 0x56, 0x01, 0x2F, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF7, 0x02, 0x59,
+    0x03, 0x09, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01,
+    0x56, 0x08, 0x00, 0x02, 0x00, 0x1F, 0xFF, 0xF6, 0x03, 0x6C, 0x02, 0x20,
+    0x00, 0x40, 0x00, 0x55, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x21, 0x07, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x23,
+    0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x07,
+    0x07, 0x21, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x36, 0x37, 0x17, 0x0E, 0x02, 0x37, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0xD6,
+    0x34, 0x53, 0x30, 0x1F, 0x3C, 0x5A, 0x3C, 0x01, 0xB8, 0x06, 0x01, 0x14,
+    0x25, 0x18, 0x24, 0x30, 0x19, 0x24, 0x44, 0x32, 0x22, 0x33, 0x1C, 0x4E,
+    0x23, 0x46, 0x47, 0x24, 0x5B, 0x84, 0x47, 0x28, 0x48, 0x61, 0x3A, 0x4B,
+    0x74, 0x40, 0x02, 0x01, 0xFD, 0xB2, 0x0F, 0x1A, 0x12, 0x08, 0x0D, 0x17,
+    0x0F, 0x16, 0x27, 0x20, 0x0A, 0x39, 0x14, 0x44, 0x52, 0x5D, 0x0A, 0x15,
+    0x1E, 0x15, 0x26, 0x31, 0x15, 0x6B, 0x18, 0x49, 0x5F, 0x37, 0x30, 0x4F,
+    0x37, 0x1E, 0x0A, 0x28, 0x47, 0x30, 0x28, 0x3C, 0x2A, 0x14, 0x0A, 0x13,
+    0x16, 0x20, 0x13, 0x1B, 0x32, 0x23, 0x27, 0x3B, 0x20, 0x10, 0x14, 0x79,
+    0x1C, 0x21, 0x0F, 0x47, 0x7C, 0x51, 0x3C, 0x66, 0x4B, 0x29, 0x47, 0x7B,
+    0x50, 0x32, 0x07, 0x0E, 0x14, 0x0D, 0x0D, 0x15, 0x0C, 0x0E, 0x1A, 0x13,
+    0x59, 0x1F, 0x2E, 0x17, 0xFF, 0x4D, 0x14, 0x1B, 0x10, 0x07, 0x1A, 0x20,
+    0x69, 0x1F, 0x2F, 0x1B, 0x15, 0x2E, 0x46, 0x31, 0x70, 0x00, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0xF6, 0x03, 0x6C, 0x03, 0x2D, 0x06, 0x26, 0x01, 0x21,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xF8, 0x00, 0xD2, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x46, 0xFF, 0xF5, 0x02, 0x7F, 0x02, 0xE4, 0x00, 0x18, 0x00, 0x28,
+    0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x27, 0x37, 0x07, 0x23, 0x11, 0x33,
+    0x11, 0x27, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x99, 0x25, 0x42, 0x34, 0x22, 0x05, 0x26,
+    0x0D, 0xAA, 0xBB, 0x28, 0x06, 0x23, 0x32, 0x3E, 0x22, 0x45, 0x69, 0x3D,
+    0x3C, 0x68, 0x78, 0x20, 0x2D, 0x19, 0x18, 0x2E, 0x20, 0x20, 0x2E, 0x19,
+    0x19, 0x2E, 0x0B, 0x13, 0x21, 0x2C, 0x19, 0x0A, 0x77, 0x02, 0xE3, 0xFE,
+    0xB0, 0x0D, 0x1B, 0x2E, 0x23, 0x13, 0x47, 0x7E, 0x51, 0x51, 0x7D, 0x47,
+    0x99, 0x1F, 0x37, 0x26, 0x27, 0x38, 0x1D, 0x1D, 0x38, 0x27, 0x26, 0x37,
+    0x1F, 0x00, 0x00, 0x01, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x19, 0x02, 0x20,
+    0x00, 0x1F, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15,
+    0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x01,
+    0x34, 0x4F, 0x7D, 0x48, 0x48, 0x7D, 0x4F, 0x48, 0x79, 0x24, 0x65, 0x0B,
+    0x22, 0x29, 0x19, 0x21, 0x32, 0x1B, 0x1A, 0x33, 0x21, 0x19, 0x29, 0x21,
+    0x0C, 0x65, 0x25, 0x79, 0x0A, 0x48, 0x7D, 0x50, 0x50, 0x7D, 0x48, 0x2E,
+    0x2B, 0x78, 0x0E, 0x17, 0x0D, 0x1E, 0x35, 0x22, 0x22, 0x34, 0x20, 0x0C,
+    0x16, 0x0F, 0x79, 0x2A, 0x2E, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x19, 0x03, 0x2D, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x3A, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x19,
+    0x03, 0x20, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x3A, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x09, 0x02, 0x19, 0x02, 0x20,
+    0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0x3A, 0x00,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x09, 0x02, 0x19, 0x03, 0x2D, 0x06, 0x26,
+    0x01, 0x24, 0x00, 0x00, 0x00, 0x26, 0x03, 0x11, 0x3A, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x3A, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x19,
+    0x03, 0x18, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC,
+    0x3A, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x19, 0x03, 0x2F,
+    0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x3A, 0x08,
+    0x00, 0x02, 0x00, 0x20, 0xFF, 0xF5, 0x02, 0x59, 0x02, 0xE4, 0x00, 0x18,
+    0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x1E, 0x02, 0x17, 0x07, 0x11, 0x33, 0x11, 0x23, 0x27, 0x17,
+    0x0E, 0x03, 0x37, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x08, 0x43, 0x69, 0x3C, 0x3D,
+    0x6A, 0x44, 0x23, 0x40, 0x33, 0x23, 0x05, 0x2B, 0xBB, 0xA9, 0x0D, 0x25,
+    0x04, 0x22, 0x33, 0x43, 0x11, 0x20, 0x2E, 0x18, 0x18, 0x2E, 0x20, 0x20,
+    0x2E, 0x18, 0x18, 0x2E, 0x0B, 0x47, 0x7D, 0x51, 0x51, 0x7D, 0x48, 0x14,
+    0x24, 0x30, 0x1B, 0x0C, 0x01, 0x53, 0xFD, 0x1C, 0x77, 0x07, 0x1A, 0x2C,
+    0x22, 0x13, 0x98, 0x1F, 0x37, 0x27, 0x27, 0x39, 0x1D, 0x1D, 0x39, 0x27,
+    0x27, 0x37, 0x1F, 0x00, 0x00, 0x03, 0x00, 0x20, 0xFF, 0xF9, 0x02, 0x40,
+    0x02, 0xEC, 0x00, 0x1E, 0x00, 0x2E, 0x00, 0x36, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x27,
+    0x2E, 0x04, 0x27, 0x37, 0x1E, 0x04, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x03, 0x27, 0x3F, 0x02, 0x17, 0x07, 0x07, 0x01, 0x2E, 0x51,
+    0x79, 0x44, 0x2A, 0x48, 0x5F, 0x33, 0x32, 0x4F, 0x36, 0x0A, 0x75, 0x02,
+    0x10, 0x1E, 0x2D, 0x40, 0x2A, 0x32, 0x41, 0x6F, 0x57, 0x3D, 0x21, 0x44,
+    0x7B, 0x51, 0x1B, 0x2E, 0x1B, 0x1B, 0x2E, 0x1B, 0x1C, 0x2E, 0x1A, 0x1A,
+    0x2E, 0x80, 0x0D, 0xA5, 0x3B, 0x92, 0x12, 0x71, 0x2D, 0x07, 0x46, 0x75,
+    0x4A, 0x34, 0x5E, 0x47, 0x28, 0x27, 0x4A, 0x32, 0x1F, 0x2B, 0x45, 0x38,
+    0x2C, 0x21, 0x0D, 0x6F, 0x0F, 0x39, 0x52, 0x69, 0x7D, 0x49, 0x58, 0x87,
+    0x4B, 0x9A, 0x1E, 0x35, 0x20, 0x1F, 0x33, 0x1E, 0x1D, 0x33, 0x20, 0x20,
+    0x35, 0x1E, 0x01, 0x6D, 0x41, 0x2B, 0x1E, 0x21, 0x42, 0x1A, 0x1B, 0x00,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF5, 0x03, 0x65, 0x02, 0xE4, 0x04, 0x26,
+    0x01, 0x2B, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x02, 0x03, 0x00, 0x2E,
+    0x00, 0x03, 0x00, 0x20, 0xFF, 0xF5, 0x02, 0x86, 0x02, 0xE4, 0x00, 0x03,
+    0x00, 0x1C, 0x00, 0x2C, 0x00, 0x00, 0x41, 0x35, 0x21, 0x15, 0x01, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x07,
+    0x11, 0x33, 0x11, 0x23, 0x27, 0x17, 0x0E, 0x03, 0x37, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x01, 0x27, 0x01, 0x5F, 0xFE, 0x82, 0x43, 0x69, 0x3C, 0x3D, 0x6A, 0x44,
+    0x23, 0x40, 0x33, 0x23, 0x05, 0x2B, 0xBB, 0xA9, 0x0D, 0x25, 0x04, 0x22,
+    0x33, 0x43, 0x11, 0x20, 0x2E, 0x18, 0x18, 0x2E, 0x20, 0x20, 0x2E, 0x18,
+    0x18, 0x2E, 0x02, 0x38, 0x84, 0x84, 0xFD, 0xBD, 0x47, 0x7D, 0x51, 0x51,
+    0x7D, 0x48, 0x14, 0x24, 0x30, 0x1B, 0x0C, 0x01, 0x53, 0xFD, 0x1C, 0x77,
+    0x07, 0x1A, 0x2C, 0x22, 0x13, 0x98, 0x1F, 0x37, 0x27, 0x27, 0x39, 0x1D,
+    0x1D, 0x39, 0x27, 0x27, 0x37, 0x1F, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x18,
+    0x02, 0x59, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x52, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x31, 0x02, 0x59,
+    0x02, 0xE4, 0x06, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14,
+    0x52, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF5, 0x04, 0xA5, 0x03, 0x20,
+    0x04, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x01, 0xF2, 0x02, 0x97,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xFD, 0x02, 0xBF, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x02, 0x20, 0x00, 0x27, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
+    0x07, 0x07, 0x21, 0x27, 0x21, 0x07, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0x01, 0x47, 0x5B, 0x84, 0x48, 0x28, 0x48, 0x63, 0x3B, 0x3A, 0x5F,
+    0x45, 0x25, 0x02, 0x01, 0xFE, 0x5C, 0x17, 0x01, 0x26, 0x12, 0x17, 0x26,
+    0x18, 0x22, 0x2D, 0x18, 0x21, 0x41, 0x2F, 0x1F, 0x2F, 0x1B, 0x56, 0x23,
+    0x47, 0x46, 0x0A, 0x47, 0x7D, 0x50, 0x3C, 0x66, 0x4B, 0x29, 0x28, 0x4A,
+    0x64, 0x3C, 0x2A, 0x5D, 0x14, 0x13, 0x16, 0x21, 0x12, 0x1B, 0x32, 0x23,
+    0x28, 0x3A, 0x20, 0x10, 0x14, 0x79, 0x1C, 0x21, 0x0F, 0x00, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x03, 0x2D, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x31, 0x03, 0x0D, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFF, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x31, 0x03, 0x20, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFD, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x09, 0x02, 0x31,
+    0x03, 0x0D, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x26, 0x03, 0x11,
+    0x4C, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x31, 0x03, 0x18, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x84, 0x03, 0xD3, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEE, 0x7C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x18, 0x02, 0x31,
+    0x03, 0x18, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E,
+    0x4D, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x31, 0x03, 0xD3, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xEF, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x66, 0x03, 0xD9, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF0, 0x71, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31,
+    0x03, 0xD3, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1,
+    0x33, 0x08, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xF6, 0x02, 0x31, 0x03, 0x38,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0xF8, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x03, 0x2F, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x33, 0x08, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0x18, 0x02, 0x31, 0x02, 0x20, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x4D, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x31, 0x03, 0x2E, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF7, 0x20, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31,
+    0x03, 0x4A, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09,
+    0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x03, 0x17,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B, 0x34, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x02, 0xEF, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x34, 0x08, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0xF6, 0x02, 0x31, 0x03, 0xF5, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x08, 0x34, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x31, 0x03, 0xF5, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x07, 0x34, 0x08, 0x00, 0x02, 0x00, 0x20, 0xFF, 0x31,
+    0x02, 0x31, 0x02, 0x20, 0x00, 0x15, 0x00, 0x3D, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x27, 0x22, 0x26, 0x26, 0x35,
+    0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x07, 0x21, 0x27, 0x21,
+    0x07, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x7B, 0x35, 0x3F,
+    0x33, 0x5E, 0x3F, 0x1E, 0x38, 0x3F, 0x0F, 0x0A, 0x09, 0x10, 0x08, 0x4C,
+    0x0C, 0x25, 0x35, 0x57, 0x5B, 0x84, 0x48, 0x28, 0x48, 0x63, 0x3B, 0x3A,
+    0x5F, 0x45, 0x25, 0x02, 0x01, 0xFE, 0x5C, 0x17, 0x01, 0x26, 0x12, 0x17,
+    0x26, 0x18, 0x22, 0x2D, 0x18, 0x21, 0x41, 0x2F, 0x1F, 0x2F, 0x1B, 0x56,
+    0x23, 0x47, 0x46, 0xCF, 0x40, 0x2D, 0x28, 0x40, 0x3B, 0x1E, 0x37, 0x1E,
+    0x2F, 0x1B, 0x0E, 0x0E, 0x0B, 0x0C, 0x38, 0x13, 0x26, 0x19, 0xC5, 0x47,
+    0x7D, 0x50, 0x3C, 0x66, 0x4B, 0x29, 0x28, 0x4A, 0x64, 0x3C, 0x2A, 0x5D,
+    0x14, 0x13, 0x16, 0x21, 0x12, 0x1B, 0x32, 0x23, 0x28, 0x3A, 0x20, 0x10,
+    0x14, 0x79, 0x1C, 0x21, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x31, 0x03, 0x09, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x01, 0x34, 0x08, 0x00, 0x01, 0x00, 0x1B, 0xFF, 0xF5, 0x02, 0x2A,
+    0x02, 0x1F, 0x00, 0x26, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x37,
+    0x21, 0x17, 0x21, 0x37, 0x15, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x1C, 0x4C, 0x75, 0x40, 0x01,
+    0x01, 0xA4, 0x17, 0xFE, 0xDA, 0x12, 0x01, 0x15, 0x27, 0x18, 0x23, 0x2D,
+    0x17, 0x21, 0x40, 0x30, 0x1F, 0x2F, 0x1B, 0x56, 0x24, 0x46, 0x46, 0x24,
+    0x5C, 0x83, 0x48, 0x28, 0x48, 0x63, 0x0B, 0x47, 0x7C, 0x4F, 0x2A, 0x5D,
+    0x14, 0x13, 0x15, 0x21, 0x13, 0x1B, 0x33, 0x23, 0x27, 0x3A, 0x21, 0x11,
+    0x14, 0x79, 0x1C, 0x21, 0x0F, 0x47, 0x7C, 0x51, 0x3C, 0x66, 0x4B, 0x29,
+    0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x01, 0xA4, 0x02, 0xE8, 0x00, 0x14,
+    0x00, 0x18, 0x00, 0x00, 0x73, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x22,
+    0x22, 0x03, 0x35, 0x21, 0x15, 0x5D, 0x30, 0x56, 0x39, 0x28, 0x43, 0x1D,
+    0x32, 0x0D, 0x16, 0x08, 0x11, 0x15, 0x09, 0x5D, 0x22, 0x2F, 0x58, 0x01,
+    0x6C, 0x02, 0x21, 0x37, 0x5A, 0x36, 0x16, 0x14, 0x85, 0x04, 0x05, 0x0C,
+    0x18, 0x11, 0xFD, 0xF3, 0x01, 0x6F, 0x95, 0x95, 0x00, 0x02, 0x00, 0x20,
+    0xFF, 0x1A, 0x02, 0x64, 0x02, 0x20, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x27, 0x37, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35,
+    0x35, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x1E, 0x03, 0x17, 0x07, 0x37, 0x33, 0x11, 0x14, 0x0E, 0x02,
+    0x03, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x3D, 0x45, 0x88, 0x2B, 0x3F, 0x16, 0x31,
+    0x36, 0x1E, 0x30, 0x3D, 0x1D, 0x27, 0x07, 0x36, 0x51, 0x2C, 0x48, 0x6E,
+    0x40, 0x3F, 0x6C, 0x46, 0x1E, 0x36, 0x2F, 0x24, 0x17, 0x04, 0x26, 0x09,
+    0xAE, 0x28, 0x4D, 0x6D, 0x40, 0x22, 0x30, 0x1A, 0x1A, 0x30, 0x22, 0x22,
+    0x30, 0x19, 0x19, 0x30, 0xE6, 0x27, 0x1F, 0x7F, 0x0E, 0x15, 0x0A, 0x1B,
+    0x38, 0x2C, 0x54, 0x05, 0x21, 0x35, 0x1F, 0x41, 0x74, 0x4E, 0x51, 0x7B,
+    0x46, 0x0C, 0x16, 0x1F, 0x24, 0x14, 0x09, 0x77, 0xFE, 0x1C, 0x43, 0x67,
+    0x48, 0x25, 0x01, 0x79, 0x1E, 0x36, 0x26, 0x26, 0x37, 0x1D, 0x1D, 0x37,
+    0x26, 0x26, 0x36, 0x1E, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x1A, 0x02, 0x64,
+    0x03, 0x0D, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF,
+    0x59, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x1A, 0x02, 0x64, 0x03, 0x20,
+    0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x59, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x1A, 0x02, 0x64, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x59, 0x08, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0x1A, 0x02, 0x64, 0x03, 0x66, 0x06, 0x26, 0x01, 0x4B,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0C, 0x59, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0x1A, 0x02, 0x64, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF5, 0x59, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x1A,
+    0x02, 0x64, 0x02, 0xEF, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x59, 0x08, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x02, 0x50,
+    0x02, 0xE4, 0x00, 0x1C, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x07, 0x3E,
+    0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26,
+    0x07, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x22, 0x22, 0x46, 0xB6, 0x26,
+    0x0A, 0x3A, 0x50, 0x2C, 0x3C, 0x53, 0x2B, 0xBA, 0x10, 0x20, 0x16, 0x11,
+    0x1D, 0x16, 0x0B, 0x5D, 0x22, 0x2F, 0x02, 0xE4, 0xFE, 0xC5, 0x0C, 0x26,
+    0x3B, 0x22, 0x31, 0x61, 0x46, 0xFE, 0xB8, 0x01, 0x39, 0x1A, 0x23, 0x12,
+    0x01, 0x0A, 0x15, 0x1A, 0x10, 0xFE, 0xC2, 0x00, 0x00, 0x02, 0x00, 0x0E,
+    0x00, 0x00, 0x02, 0x50, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00,
+    0x53, 0x35, 0x21, 0x15, 0x01, 0x11, 0x33, 0x11, 0x07, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x07, 0x22,
+    0x0E, 0x02, 0x15, 0x11, 0x23, 0x22, 0x22, 0x0E, 0x01, 0x5F, 0xFE, 0xD9,
+    0xB6, 0x26, 0x0A, 0x3A, 0x50, 0x2C, 0x3C, 0x53, 0x2B, 0xBA, 0x10, 0x20,
+    0x16, 0x11, 0x1D, 0x16, 0x0B, 0x5D, 0x22, 0x2F, 0x02, 0x3B, 0x84, 0x84,
+    0xFD, 0xC5, 0x02, 0xE4, 0xFE, 0xC5, 0x0C, 0x26, 0x3B, 0x22, 0x31, 0x61,
+    0x46, 0xFE, 0xB8, 0x01, 0x39, 0x1A, 0x23, 0x12, 0x01, 0x0A, 0x15, 0x1A,
+    0x10, 0xFE, 0xC2, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x14, 0x02, 0x50,
+    0x02, 0xE4, 0x06, 0x26, 0x01, 0x52, 0x00, 0x00, 0x00, 0x06, 0x03, 0x13,
+    0x4D, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x02, 0x50, 0x03, 0xC9,
+    0x06, 0x26, 0x01, 0x52, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x4D, 0x28,
+    0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x18, 0x02, 0x50, 0x02, 0xE4, 0x06, 0x26,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x4D, 0x00, 0x00, 0x02,
+    0x00, 0x3E, 0x00, 0x00, 0x01, 0x14, 0x03, 0x2F, 0x00, 0x03, 0x00, 0x0F,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x03, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x4C, 0xBA, 0x5D, 0x33, 0x38, 0x39,
+    0x32, 0x32, 0x39, 0x3A, 0x02, 0x15, 0xFD, 0xEB, 0x02, 0x7A, 0x2F, 0x2B,
+    0x28, 0x33, 0x2F, 0x2C, 0x28, 0x32, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0xF8, 0x02, 0x15, 0x00, 0x03, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11,
+    0x3E, 0xBA, 0x02, 0x15, 0xFD, 0xEB, 0xFF, 0xFF, 0x00, 0x12, 0x00, 0x00,
+    0x01, 0x23, 0x03, 0x2D, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF8, 0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x01, 0x56, 0x03, 0x0D, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xFF, 0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xCE, 0x00, 0x00,
+    0x01, 0x68, 0x03, 0x20, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xFD, 0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xCC, 0x00, 0x00,
+    0x01, 0x6A, 0x03, 0x18, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xFC, 0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x73, 0x00, 0x00,
+    0x01, 0x4A, 0x03, 0x38, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0A, 0xFF, 0x65, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xBA, 0x00, 0x00,
+    0x01, 0x7B, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF2, 0xFF, 0xA0, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xBB, 0x00, 0x00,
+    0x01, 0x7C, 0x03, 0xFC, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF3, 0xFF, 0xA2, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x30, 0x00, 0x00,
+    0x01, 0x06, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF5, 0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x3A, 0xFF, 0x18,
+    0x01, 0x18, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x57, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0xAF, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x0F,
+    0x03, 0x2E, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF7,
+    0xFF, 0x8D, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x15, 0x00, 0x00, 0x01, 0x21,
+    0x03, 0x4A, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x09,
+    0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0x56,
+    0x03, 0x17, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0B,
+    0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0x29, 0x02, 0x6D,
+    0x03, 0x2F, 0x04, 0x26, 0x01, 0x57, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x01, 0x52, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x01, 0x4E,
+    0x02, 0xEF, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05,
+    0xFF, 0xA1, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x0E, 0xFF, 0x28, 0x01, 0x09,
+    0x03, 0x2F, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x27, 0x02, 0xF5,
+    0xFF, 0xA1, 0x00, 0x08, 0x00, 0x07, 0x03, 0x12, 0xFF, 0x92, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xDD, 0x00, 0x00, 0x01, 0x59, 0x03, 0x09, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x01, 0xFF, 0xA1, 0x00, 0x08,
+    0x00, 0x02, 0xFF, 0xD6, 0xFF, 0x29, 0x01, 0x1B, 0x03, 0x2F, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x00, 0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33,
+    0x11, 0x14, 0x06, 0x06, 0x13, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x1D, 0x47, 0x31, 0x35, 0x14, 0xBA, 0x35, 0x69,
+    0x44, 0x33, 0x38, 0x39, 0x32, 0x32, 0x39, 0x3A, 0xD7, 0x90, 0x16, 0x38,
+    0x34, 0x01, 0xDA, 0xFD, 0xFA, 0x53, 0x65, 0x2E, 0x03, 0x51, 0x2F, 0x2B,
+    0x28, 0x33, 0x2F, 0x2C, 0x28, 0x32, 0x00, 0x01, 0xFF, 0xD6, 0xFF, 0x29,
+    0x01, 0x0A, 0x02, 0x15, 0x00, 0x0B, 0x00, 0x00, 0x57, 0x27, 0x32, 0x36,
+    0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x1D, 0x47, 0x31, 0x35,
+    0x14, 0xBA, 0x35, 0x69, 0xD7, 0x90, 0x16, 0x38, 0x34, 0x01, 0xDA, 0xFD,
+    0xFA, 0x53, 0x65, 0x2E, 0xFF, 0xFF, 0xFF, 0xD6, 0xFF, 0x29, 0x01, 0x7F,
+    0x03, 0x18, 0x06, 0x26, 0x01, 0x6A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC,
+    0xB5, 0x08, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x02, 0x92, 0x02, 0xE4,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x27, 0x13, 0x33,
+    0x01, 0x11, 0x33, 0x11, 0x33, 0x27, 0x37, 0x01, 0xFC, 0x54, 0xF7, 0xF3,
+    0xFD, 0xB4, 0xBB, 0xB0, 0xB6, 0x83, 0x01, 0x0A, 0x98, 0x7C, 0x01, 0x01,
+    0xFD, 0xEB, 0x02, 0xE4, 0xFD, 0x1C, 0xF8, 0x60, 0xFE, 0xA8, 0xFF, 0xFF,
+    0x00, 0x46, 0xFE, 0xC4, 0x02, 0x92, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6C,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0x4C, 0x00, 0x00, 0x03, 0x00, 0x46,
+    0x00, 0x00, 0x02, 0x8E, 0x02, 0x15, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x77, 0x27, 0x13, 0x33, 0x01, 0x11, 0x33, 0x11, 0x33, 0x27,
+    0x37, 0x01, 0xFB, 0x54, 0xF7, 0xF0, 0xFD, 0xB8, 0xBA, 0xAE, 0xAC, 0x81,
+    0x01, 0x01, 0x7E, 0x7A, 0x01, 0x1D, 0xFD, 0xEB, 0x02, 0x15, 0xFD, 0xEB,
+    0xFF, 0x5C, 0xFE, 0xA5, 0x00, 0x01, 0x00, 0x47, 0x00, 0x00, 0x01, 0x01,
+    0x02, 0xE4, 0x00, 0x03, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x47, 0xBA,
+    0x02, 0xE4, 0xFD, 0x1C, 0xFF, 0xFF, 0x00, 0x1A, 0x00, 0x00, 0x01, 0x30,
+    0x03, 0xE1, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0xAB, 0x28, 0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00, 0x02, 0x16, 0x02, 0xE4,
+    0x04, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x00, 0xB3,
+    0x00, 0x2E, 0xFF, 0xFF, 0x00, 0x3B, 0xFE, 0xC4, 0x01, 0x0D, 0x02, 0xE4,
+    0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0xAA, 0x00,
+    0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00, 0x01, 0xF9, 0x02, 0xE4, 0x04, 0x26,
+    0x01, 0x6F, 0x00, 0x00, 0x00, 0x07, 0x02, 0x69, 0x01, 0x15, 0x01, 0x36,
+    0xFF, 0xFF, 0x00, 0x36, 0xFF, 0x18, 0x01, 0x13, 0x02, 0xE4, 0x06, 0x26,
+    0x01, 0x6F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xAA, 0x00, 0xFF, 0xFF,
+    0x00, 0x47, 0xFF, 0x29, 0x02, 0x55, 0x03, 0x2F, 0x04, 0x26, 0x01, 0x6F,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x69, 0x01, 0x3A, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x06, 0xFF, 0x31, 0x01, 0x43, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x14, 0xAA, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0x00, 0x00, 0x01, 0xB1, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x77, 0x27, 0x25, 0x17, 0x01, 0x11, 0x33, 0x11, 0x39, 0x3A, 0x01, 0x79,
+    0x39, 0xFE, 0xCB, 0xBA, 0xEB, 0x95, 0xA4, 0x94, 0xFE, 0x70, 0x02, 0xE4,
+    0xFD, 0x1C, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x98, 0x02, 0x20,
+    0x00, 0x31, 0x00, 0x00, 0x73, 0x11, 0x33, 0x17, 0x27, 0x3E, 0x03, 0x33,
+    0x32, 0x16, 0x16, 0x17, 0x27, 0x37, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15,
+    0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11,
+    0x46, 0xAE, 0x07, 0x17, 0x0E, 0x26, 0x2E, 0x30, 0x16, 0x25, 0x3F, 0x31,
+    0x10, 0x1D, 0x08, 0x0F, 0x29, 0x32, 0x35, 0x18, 0x41, 0x58, 0x2C, 0xBA,
+    0x10, 0x1E, 0x16, 0x11, 0x1D, 0x14, 0x0C, 0xBA, 0x10, 0x1E, 0x16, 0x11,
+    0x1D, 0x14, 0x0C, 0x02, 0x15, 0x58, 0x04, 0x1A, 0x24, 0x17, 0x0A, 0x15,
+    0x32, 0x2D, 0x02, 0x0E, 0x1A, 0x24, 0x1A, 0x0C, 0x32, 0x61, 0x46, 0xFE,
+    0xB9, 0x01, 0x38, 0x1A, 0x23, 0x12, 0x0B, 0x15, 0x19, 0x11, 0xFE, 0xC3,
+    0x01, 0x39, 0x19, 0x22, 0x13, 0x0B, 0x14, 0x1A, 0x10, 0xFE, 0xC2, 0x00,
+    0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x18, 0x03, 0x98, 0x02, 0x20, 0x06, 0x26,
+    0x01, 0x78, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xF1, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x02, 0x50, 0x02, 0x20, 0x00, 0x1C,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x17, 0x07, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x07, 0x22, 0x0E, 0x02,
+    0x15, 0x11, 0x23, 0x22, 0x22, 0x46, 0xAE, 0x08, 0x26, 0x0A, 0x3A, 0x50,
+    0x2C, 0x3C, 0x53, 0x2B, 0xBA, 0x10, 0x20, 0x16, 0x11, 0x1D, 0x16, 0x0B,
+    0x5D, 0x22, 0x2F, 0x02, 0x15, 0x6C, 0x0C, 0x26, 0x3B, 0x22, 0x31, 0x61,
+    0x46, 0xFE, 0xB8, 0x01, 0x39, 0x1A, 0x23, 0x12, 0x01, 0x0A, 0x15, 0x1A,
+    0x10, 0xFE, 0xC2, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x02, 0x50,
+    0x03, 0x2D, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x6B, 0x08, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x00, 0x02, 0x70, 0x02, 0xBC,
+    0x04, 0x27, 0x02, 0xA0, 0xFF, 0x63, 0x00, 0x00, 0x00, 0x06, 0x01, 0x7A,
+    0x20, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x02, 0x50, 0x03, 0x20,
+    0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x6B, 0x08,
+    0xFF, 0xFF, 0x00, 0x46, 0xFE, 0xC4, 0x02, 0x50, 0x02, 0x20, 0x06, 0x26,
+    0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0x4D, 0x00, 0xFF, 0xFF,
+    0x00, 0x46, 0x00, 0x00, 0x02, 0x50, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x7A,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x6B, 0x08, 0xFF, 0xFF, 0x00, 0x46,
+    0xFF, 0x18, 0x02, 0x50, 0x02, 0x20, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x4D, 0x00, 0x00, 0x01, 0xFF, 0xD6, 0xFF, 0x29,
+    0x02, 0x5A, 0x02, 0x20, 0x00, 0x22, 0x00, 0x00, 0x57, 0x27, 0x32, 0x3E,
+    0x02, 0x35, 0x11, 0x33, 0x17, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x07, 0x22, 0x0E, 0x02, 0x15,
+    0x11, 0x0E, 0x02, 0x1D, 0x47, 0x25, 0x2F, 0x1B, 0x0B, 0xAE, 0x07, 0x13,
+    0x10, 0x36, 0x43, 0x25, 0x3C, 0x53, 0x2B, 0xBA, 0x10, 0x1F, 0x17, 0x11,
+    0x1E, 0x15, 0x0C, 0x01, 0x37, 0x69, 0xD7, 0x90, 0x0A, 0x18, 0x2A, 0x21,
+    0x01, 0xEF, 0x67, 0x16, 0x1B, 0x2A, 0x17, 0x31, 0x60, 0x47, 0xFE, 0xB8,
+    0x01, 0x39, 0x1A, 0x23, 0x12, 0x01, 0x0A, 0x15, 0x1A, 0x10, 0xFE, 0xD0,
+    0x4C, 0x66, 0x33, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x29, 0x03, 0xA8,
+    0x03, 0x2F, 0x04, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x02, 0x8D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x31, 0x02, 0x50,
+    0x02, 0x20, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14,
+    0x4D, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x02, 0x50, 0x03, 0x09,
+    0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x6B, 0x08,
+    0x00, 0x01, 0x00, 0x46, 0xFF, 0x33, 0x02, 0x50, 0x02, 0x20, 0x00, 0x1F,
+    0x00, 0x00, 0x45, 0x27, 0x32, 0x36, 0x37, 0x11, 0x34, 0x26, 0x26, 0x07,
+    0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x33, 0x17, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x06, 0x06, 0x01, 0x5D, 0x45, 0x42,
+    0x3A, 0x02, 0x10, 0x20, 0x16, 0x11, 0x1D, 0x16, 0x0B, 0xBB, 0xAE, 0x04,
+    0x13, 0x32, 0x3A, 0x1F, 0x3C, 0x53, 0x2B, 0x36, 0x6D, 0xCD, 0x91, 0x38,
+    0x38, 0x01, 0x05, 0x1A, 0x23, 0x12, 0x01, 0x0A, 0x15, 0x1A, 0x10, 0xFE,
+    0xC2, 0x02, 0x15, 0x3A, 0x15, 0x1F, 0x11, 0x31, 0x61, 0x46, 0xFE, 0xB4,
+    0x45, 0x59, 0x2B, 0x00, 0x00, 0x02, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D,
+    0x02, 0x20, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x47, 0x55, 0x86, 0x4C, 0x4C, 0x86, 0x55,
+    0x55, 0x85, 0x4C, 0x4C, 0x85, 0x55, 0x1E, 0x31, 0x1B, 0x1B, 0x31, 0x1E,
+    0x1F, 0x30, 0x1C, 0x1C, 0x30, 0x0A, 0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48,
+    0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48, 0x9D, 0x1F, 0x37, 0x22, 0x24, 0x36,
+    0x1F, 0x1F, 0x37, 0x23, 0x22, 0x37, 0x1F, 0x00, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x6D, 0x03, 0x2D, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x6D, 0x03, 0x0D, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFF, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D,
+    0x03, 0x20, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x4C, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x9D, 0x03, 0xD3, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x07, 0x02, 0xEE, 0x00, 0x94, 0x00, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x18, 0x02, 0x6D, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x4C, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D,
+    0x03, 0xD3, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF,
+    0x64, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x7E, 0x03, 0xD9,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF0, 0x00, 0x89,
+    0x00, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0xD3,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1, 0x4B, 0x08,
+    0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0x38, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0x10, 0x08, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0x2F, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x4B, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x6D, 0x03, 0xD2, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x26, 0x02, 0xF2, 0x4B, 0x08, 0x00, 0x07, 0x03, 0x05, 0x00, 0x4C,
+    0x00, 0xEB, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0xD2,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x02, 0xF5, 0x4C, 0x08,
+    0x00, 0x07, 0x03, 0x05, 0x00, 0x4C, 0x00, 0xEB, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0x18, 0x02, 0x6D, 0x02, 0x20, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x4C, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x6D, 0x03, 0x2E, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF7, 0x38, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D,
+    0x03, 0x4A, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09,
+    0x4C, 0x08, 0x00, 0x02, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x8A, 0x02, 0x87,
+    0x00, 0x1D, 0x00, 0x2D, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x33, 0x14, 0x06, 0x06, 0x07, 0x37, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x47, 0x55, 0x86, 0x4C, 0x4C, 0x86, 0x55,
+    0x0F, 0x1E, 0x0D, 0x0C, 0x14, 0x07, 0x2A, 0x2C, 0x8C, 0x1C, 0x3E, 0x31,
+    0x0F, 0x2D, 0x32, 0x4C, 0x85, 0x55, 0x1E, 0x31, 0x1B, 0x1B, 0x31, 0x1E,
+    0x1F, 0x30, 0x1C, 0x1C, 0x30, 0x0A, 0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48,
+    0x03, 0x02, 0x02, 0x04, 0x3B, 0x37, 0x2E, 0x53, 0x39, 0x0A, 0x19, 0x25,
+    0x6B, 0x41, 0x51, 0x7C, 0x48, 0x9D, 0x1F, 0x37, 0x22, 0x24, 0x36, 0x1F,
+    0x1F, 0x37, 0x23, 0x22, 0x37, 0x1F, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x8A, 0x03, 0x2D, 0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x18, 0x02, 0x8A,
+    0x02, 0x87, 0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x4C, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x8A, 0x03, 0x2E,
+    0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x38, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x8A, 0x03, 0x4A, 0x06, 0x26,
+    0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x4C, 0x08, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0xF6, 0x02, 0x8A, 0x03, 0x09, 0x06, 0x26, 0x01, 0x97,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x6D, 0x03, 0x38, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFA, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x6D, 0x03, 0x17, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0B, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D,
+    0x02, 0xEF, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05,
+    0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0xF5,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x08, 0x4C, 0x08,
+    0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0xF5, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x07, 0x4C, 0x08, 0x00, 0x03,
+    0x00, 0x20, 0xFF, 0x31, 0x02, 0x6D, 0x02, 0x20, 0x00, 0x15, 0x00, 0x25,
+    0x00, 0x35, 0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37,
+    0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0x27, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x7C, 0x35,
+    0x3E, 0x33, 0x5D, 0x3F, 0x1C, 0x36, 0x3D, 0x0D, 0x0A, 0x09, 0x10, 0x08,
+    0x4C, 0x0C, 0x25, 0x35, 0x58, 0x55, 0x86, 0x4C, 0x4C, 0x86, 0x55, 0x55,
+    0x85, 0x4C, 0x4C, 0x85, 0x55, 0x1E, 0x31, 0x1B, 0x1B, 0x31, 0x1E, 0x1F,
+    0x30, 0x1C, 0x1C, 0x30, 0xCF, 0x41, 0x2D, 0x28, 0x40, 0x3A, 0x1E, 0x38,
+    0x1D, 0x2F, 0x1B, 0x0D, 0x0F, 0x0B, 0x0C, 0x38, 0x13, 0x26, 0x19, 0xC5,
+    0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48, 0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48,
+    0x9D, 0x1F, 0x37, 0x22, 0x24, 0x36, 0x1F, 0x1F, 0x37, 0x23, 0x22, 0x37,
+    0x1F, 0x00, 0x00, 0x03, 0x00, 0x20, 0xFF, 0xDD, 0x02, 0x6D, 0x02, 0x37,
+    0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x57, 0x27, 0x01, 0x17,
+    0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x7E, 0x42, 0x01, 0xD2,
+    0x43, 0xFE, 0xF6, 0x55, 0x86, 0x4C, 0x4C, 0x86, 0x55, 0x55, 0x85, 0x4C,
+    0x4C, 0x85, 0x55, 0x1E, 0x31, 0x1B, 0x1B, 0x31, 0x1E, 0x1F, 0x30, 0x1C,
+    0x1C, 0x30, 0x23, 0x30, 0x02, 0x2A, 0x31, 0xFD, 0xF0, 0x48, 0x7C, 0x51,
+    0x51, 0x7C, 0x48, 0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48, 0x9D, 0x1F, 0x37,
+    0x22, 0x24, 0x36, 0x1F, 0x1F, 0x37, 0x23, 0x22, 0x37, 0x1F, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0xDD, 0x02, 0x6D, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xA3,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20,
+    0xFF, 0xF6, 0x02, 0x6D, 0x03, 0x09, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6,
+    0x02, 0x6D, 0x03, 0xF8, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x03, 0x4C, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D,
+    0x03, 0xDB, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x02,
+    0x4B, 0x08, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0xF6, 0x02, 0x6D, 0x03, 0xC9,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x03, 0x01, 0x4C, 0x08,
+    0x00, 0x07, 0x03, 0x05, 0x00, 0x4C, 0x00, 0xE3, 0x00, 0x02, 0x00, 0x20,
+    0xFF, 0xF6, 0x03, 0xCB, 0x02, 0x20, 0x00, 0x39, 0x00, 0x49, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x23, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x07, 0x21, 0x27,
+    0x33, 0x07, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26,
+    0x26, 0x27, 0x33, 0x0E, 0x02, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x47, 0x55,
+    0x86, 0x4C, 0x4C, 0x86, 0x55, 0x2E, 0x50, 0x45, 0x19, 0x21, 0x17, 0x3C,
+    0x49, 0x29, 0x3A, 0x60, 0x46, 0x24, 0x01, 0x01, 0xFE, 0x97, 0x06, 0xF4,
+    0x2D, 0x16, 0x28, 0x1B, 0x1C, 0x26, 0x17, 0x09, 0x1A, 0x3B, 0x32, 0x22,
+    0x33, 0x1D, 0x56, 0x23, 0x46, 0x47, 0x24, 0x31, 0x55, 0x44, 0x1A, 0x20,
+    0x16, 0x41, 0x51, 0x2E, 0x1E, 0x31, 0x1B, 0x1B, 0x31, 0x1E, 0x1F, 0x30,
+    0x1C, 0x1C, 0x30, 0x0A, 0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48, 0x16, 0x2B,
+    0x1F, 0x1F, 0x2B, 0x16, 0x28, 0x4A, 0x64, 0x3C, 0x2A, 0x5D, 0x24, 0x22,
+    0x17, 0x20, 0x13, 0x12, 0x1F, 0x27, 0x16, 0x28, 0x3B, 0x21, 0x10, 0x14,
+    0x79, 0x1B, 0x22, 0x0F, 0x17, 0x2C, 0x21, 0x20, 0x2D, 0x17, 0x9D, 0x1F,
+    0x37, 0x22, 0x24, 0x36, 0x1F, 0x1F, 0x37, 0x23, 0x22, 0x37, 0x1F, 0x00,
+    0x00, 0x02, 0x00, 0x46, 0xFF, 0x24, 0x02, 0x7F, 0x02, 0x20, 0x00, 0x16,
+    0x00, 0x26, 0x00, 0x00, 0x57, 0x11, 0x33, 0x17, 0x27, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27,
+    0x37, 0x11, 0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x46, 0xAE, 0x09, 0x24, 0x06, 0x37,
+    0x52, 0x30, 0x43, 0x68, 0x3C, 0x3C, 0x6A, 0x44, 0x2D, 0x51, 0x37, 0x08,
+    0x2A, 0x61, 0x20, 0x2E, 0x18, 0x18, 0x2E, 0x20, 0x20, 0x2E, 0x18, 0x18,
+    0x2E, 0xDC, 0x02, 0xF1, 0x76, 0x09, 0x22, 0x36, 0x20, 0x47, 0x7C, 0x52,
+    0x50, 0x7D, 0x47, 0x21, 0x39, 0x24, 0x0E, 0xFE, 0xA1, 0x01, 0x6C, 0x1E,
+    0x37, 0x26, 0x27, 0x37, 0x1E, 0x1D, 0x38, 0x27, 0x26, 0x37, 0x1E, 0x00,
+    0x00, 0x02, 0x00, 0x46, 0xFF, 0x24, 0x02, 0x7F, 0x02, 0xE4, 0x00, 0x17,
+    0x00, 0x27, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x27, 0x3E, 0x02, 0x33,
+    0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27,
+    0x37, 0x11, 0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x46, 0xBC, 0x29, 0x06, 0x37, 0x52,
+    0x30, 0x33, 0x54, 0x3E, 0x22, 0x3C, 0x6A, 0x44, 0x2D, 0x51, 0x37, 0x08,
+    0x2A, 0x61, 0x20, 0x2E, 0x18, 0x18, 0x2E, 0x20, 0x20, 0x2E, 0x18, 0x18,
+    0x2E, 0xDC, 0x03, 0xC0, 0xFE, 0xBB, 0x09, 0x22, 0x36, 0x20, 0x28, 0x4B,
+    0x64, 0x3E, 0x50, 0x7D, 0x47, 0x21, 0x39, 0x24, 0x0E, 0xFE, 0xA1, 0x01,
+    0x6C, 0x1E, 0x37, 0x26, 0x27, 0x37, 0x1E, 0x1D, 0x38, 0x27, 0x26, 0x37,
+    0x1E, 0x00, 0x00, 0x02, 0x00, 0x20, 0xFF, 0x24, 0x02, 0x58, 0x02, 0x20,
+    0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x45, 0x11, 0x17, 0x0E, 0x03, 0x23,
+    0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17,
+    0x07, 0x37, 0x33, 0x11, 0x01, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x9D, 0x29, 0x05,
+    0x22, 0x33, 0x3F, 0x22, 0x44, 0x6A, 0x3D, 0x3C, 0x68, 0x43, 0x25, 0x43,
+    0x34, 0x22, 0x04, 0x27, 0x09, 0xAD, 0xFE, 0xE4, 0x20, 0x2E, 0x18, 0x18,
+    0x2E, 0x20, 0x20, 0x2E, 0x18, 0x18, 0x2E, 0xDC, 0x01, 0x5E, 0x0C, 0x1A,
+    0x2F, 0x22, 0x14, 0x47, 0x7C, 0x51, 0x52, 0x7C, 0x47, 0x13, 0x22, 0x2D,
+    0x1A, 0x08, 0x79, 0xFD, 0x0F, 0x01, 0x6C, 0x1D, 0x37, 0x27, 0x27, 0x38,
+    0x1D, 0x1D, 0x38, 0x27, 0x26, 0x38, 0x1D, 0x00, 0x00, 0x01, 0x00, 0x46,
+    0x00, 0x00, 0x01, 0xD4, 0x02, 0x20, 0x00, 0x15, 0x00, 0x00, 0x73, 0x11,
+    0x33, 0x17, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x15, 0x46, 0xAE, 0x0A, 0x27, 0x0D, 0x37,
+    0x4E, 0x2B, 0x12, 0x20, 0x0E, 0x33, 0x0B, 0x28, 0x17, 0x14, 0x20, 0x16,
+    0x0C, 0x02, 0x15, 0xAF, 0x1E, 0x2C, 0x47, 0x29, 0x05, 0x04, 0xCE, 0x07,
+    0x0B, 0x0D, 0x18, 0x21, 0x16, 0xFF, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00,
+    0x01, 0xD4, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x15, 0x08, 0xFF, 0xFF, 0x00, 0x42, 0x00, 0x00, 0x01, 0xDD,
+    0x03, 0x20, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x15, 0x08, 0xFF, 0xFF, 0x00, 0x34, 0xFE, 0xC4, 0x01, 0xD4, 0x02, 0x20,
+    0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0xA3, 0x00,
+    0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x01, 0xD4, 0x03, 0x38, 0x06, 0x26,
+    0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0xD9, 0x08, 0xFF, 0xFF,
+    0x00, 0x2F, 0xFF, 0x18, 0x01, 0xD4, 0x02, 0x20, 0x06, 0x26, 0x01, 0xAD,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xA3, 0x00, 0xFF, 0xFF, 0x00, 0x46,
+    0x00, 0x00, 0x01, 0xD4, 0x03, 0x17, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0x15, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31,
+    0x01, 0xD4, 0x02, 0x20, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0xA3, 0x00, 0x00, 0x01, 0x00, 0x08, 0xFF, 0xF6, 0x01, 0xE7,
+    0x02, 0x20, 0x00, 0x39, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x27, 0x26, 0x26, 0x27, 0x26,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x17,
+    0x16, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0xFC, 0x53, 0x7E, 0x23, 0x6D, 0x20, 0x51, 0x1F, 0x0B, 0x12, 0x0B, 0x07,
+    0x11, 0x09, 0x29, 0x22, 0x2A, 0x42, 0x17, 0x16, 0x19, 0x24, 0x40, 0x50,
+    0x2A, 0x2F, 0x53, 0x49, 0x1D, 0x60, 0x11, 0x2D, 0x30, 0x15, 0x0D, 0x12,
+    0x0C, 0x06, 0x0A, 0x0B, 0x09, 0x2B, 0x29, 0x2E, 0x44, 0x15, 0x0F, 0x10,
+    0x3D, 0x6A, 0x0A, 0x34, 0x29, 0x5E, 0x1D, 0x1C, 0x04, 0x09, 0x0B, 0x07,
+    0x11, 0x09, 0x04, 0x0D, 0x08, 0x0B, 0x1F, 0x15, 0x15, 0x37, 0x21, 0x28,
+    0x3E, 0x2D, 0x17, 0x13, 0x23, 0x19, 0x6A, 0x0F, 0x1A, 0x11, 0x04, 0x08,
+    0x0C, 0x07, 0x09, 0x10, 0x05, 0x05, 0x0F, 0x0B, 0x0D, 0x22, 0x16, 0x11,
+    0x29, 0x19, 0x35, 0x53, 0x2F, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF6,
+    0x01, 0xE7, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x02, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF6, 0x01, 0xE7,
+    0x03, 0x46, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF9,
+    0x12, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF6, 0x01, 0xE7, 0x03, 0x20,
+    0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x02, 0x08,
+    0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF6, 0x01, 0xE7, 0x03, 0xDF, 0x06, 0x26,
+    0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFE, 0x02, 0x08, 0xFF, 0xFF,
+    0x00, 0x08, 0xFF, 0x09, 0x01, 0xE7, 0x02, 0x20, 0x06, 0x26, 0x01, 0xB5,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0x02, 0x00, 0xFF, 0xFF, 0x00, 0x08,
+    0xFF, 0xF6, 0x01, 0xE7, 0x03, 0x18, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x02, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0xFE, 0xC4,
+    0x01, 0xE7, 0x02, 0x20, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x10, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0xF6, 0x01, 0xE7,
+    0x03, 0x2F, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5,
+    0x02, 0x08, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0x18, 0x01, 0xE7, 0x02, 0x20,
+    0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x03, 0x00,
+    0xFF, 0xFF, 0x00, 0x08, 0xFF, 0x18, 0x01, 0xE7, 0x03, 0x2F, 0x06, 0x26,
+    0x01, 0xB5, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x03, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0x02, 0x08, 0x00, 0x02, 0x00, 0x12, 0xFF, 0xF6, 0x02, 0x8E,
+    0x02, 0xDE, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x35,
+    0x3E, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07,
+    0x27, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06, 0x01, 0x35, 0x33, 0x15, 0x01,
+    0xAD, 0x27, 0x3E, 0x18, 0x44, 0x0E, 0x16, 0x0D, 0x18, 0x1C, 0x17, 0x26,
+    0x2F, 0x17, 0x12, 0x18, 0x0F, 0x06, 0x23, 0x1E, 0x20, 0x1E, 0xB9, 0x3C,
+    0x72, 0x50, 0x41, 0x69, 0x3F, 0x1C, 0x34, 0x24, 0x02, 0x2B, 0x46, 0x33,
+    0x1C, 0x3A, 0x66, 0xFE, 0x24, 0x9F, 0x0A, 0x16, 0x16, 0x87, 0x0B, 0x08,
+    0x1D, 0x1C, 0x17, 0x26, 0x1E, 0x18, 0x0B, 0x5E, 0x08, 0x11, 0x12, 0x17,
+    0x0E, 0x1C, 0x1E, 0x25, 0x20, 0xFE, 0x10, 0x01, 0xF3, 0x46, 0x6A, 0x3B,
+    0x28, 0x4D, 0x37, 0x23, 0x46, 0x39, 0x10, 0x32, 0x0D, 0x2B, 0x3A, 0x48,
+    0x2D, 0x3D, 0x60, 0x38, 0x01, 0x65, 0x9D, 0x9D, 0x00, 0x02, 0x00, 0x11,
+    0x00, 0x00, 0x01, 0x80, 0x02, 0x9C, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x11, 0x01, 0x35, 0x21, 0x15, 0x69, 0xBA, 0xFE, 0xEE,
+    0x01, 0x6F, 0x02, 0x9C, 0xFD, 0x64, 0x01, 0x77, 0x9E, 0x9E, 0x00, 0x03,
+    0x00, 0x11, 0x00, 0x00, 0x01, 0x80, 0x02, 0x9C, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x05, 0x11, 0x33, 0x11,
+    0x01, 0x35, 0x21, 0x15, 0x19, 0x01, 0x5F, 0xFE, 0xF1, 0xBA, 0xFE, 0xEE,
+    0x01, 0x6F, 0xB9, 0x83, 0x83, 0xB9, 0x02, 0x9C, 0xFD, 0x64, 0x01, 0x77,
+    0x9E, 0x9E, 0xFF, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x02, 0x11, 0x03, 0x50,
+    0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x00, 0xAE,
+    0x00, 0x99, 0xFF, 0xFF, 0x00, 0x11, 0xFF, 0x09, 0x01, 0x80, 0x02, 0x9C,
+    0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0xD0, 0x00,
+    0xFF, 0xFF, 0x00, 0x11, 0xFE, 0xC4, 0x01, 0x80, 0x02, 0x9C, 0x06, 0x26,
+    0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0xD1, 0x00, 0xFF, 0xFF,
+    0xFF, 0xE7, 0x00, 0x00, 0x01, 0xA7, 0x03, 0x7E, 0x06, 0x26, 0x01, 0xC1,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0xCD, 0x57, 0xFF, 0xFF, 0x00, 0x11,
+    0xFF, 0x18, 0x01, 0x80, 0x02, 0x9C, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0xD1, 0x00, 0xFF, 0xFF, 0x00, 0x11, 0xFF, 0x31,
+    0x01, 0x80, 0x02, 0x9C, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0xD1, 0x00, 0x00, 0x01, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A,
+    0x02, 0x15, 0x00, 0x19, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x11,
+    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33,
+    0x11, 0x23, 0x27, 0x37, 0x0E, 0x02, 0xFA, 0x3C, 0x54, 0x2C, 0xBA, 0x12,
+    0x20, 0x17, 0x12, 0x1D, 0x14, 0x0C, 0xBA, 0xAC, 0x0A, 0x23, 0x0B, 0x38,
+    0x4E, 0x0B, 0x33, 0x60, 0x44, 0x01, 0x49, 0xFE, 0xCA, 0x1A, 0x24, 0x13,
+    0x0A, 0x15, 0x1B, 0x10, 0x01, 0x3D, 0xFD, 0xEB, 0x6C, 0x0C, 0x25, 0x3C,
+    0x22, 0x00, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x2D,
+    0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x50, 0x08,
+    0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x0D, 0x06, 0x26,
+    0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x50, 0x08, 0xFF, 0xFF,
+    0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x20, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x50, 0x08, 0xFF, 0xFF, 0x00, 0x3E,
+    0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x18, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x50, 0x08, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0xF5,
+    0x02, 0x4A, 0x03, 0x38, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0A, 0x13, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A,
+    0x03, 0x2F, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2,
+    0x4F, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0x18, 0x02, 0x4A, 0x02, 0x15,
+    0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x50, 0x00,
+    0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x2E, 0x06, 0x26,
+    0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x3C, 0x08, 0xFF, 0xFF,
+    0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x4A, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x4F, 0x08, 0x00, 0x01, 0x00, 0x3E,
+    0xFF, 0xF5, 0x02, 0xB8, 0x02, 0x87, 0x00, 0x23, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E,
+    0x02, 0x35, 0x11, 0x32, 0x3E, 0x02, 0x35, 0x33, 0x14, 0x06, 0x06, 0x07,
+    0x37, 0x11, 0x23, 0x27, 0x17, 0x0E, 0x02, 0xFA, 0x3C, 0x54, 0x2C, 0xBA,
+    0x12, 0x20, 0x17, 0x12, 0x1D, 0x14, 0x0C, 0x30, 0x3C, 0x22, 0x0D, 0x8D,
+    0x21, 0x42, 0x33, 0x28, 0xAC, 0x0A, 0x15, 0x10, 0x36, 0x43, 0x0B, 0x33,
+    0x60, 0x44, 0x01, 0x49, 0xFE, 0xCA, 0x1A, 0x24, 0x13, 0x0A, 0x15, 0x1B,
+    0x10, 0x01, 0x3D, 0x0D, 0x1A, 0x2C, 0x1F, 0x31, 0x57, 0x38, 0x02, 0x28,
+    0xFE, 0x13, 0x6C, 0x15, 0x1D, 0x2C, 0x19, 0x00, 0xFF, 0xFF, 0x00, 0x3E,
+    0xFF, 0xF5, 0x02, 0xB8, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x50, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0x18,
+    0x02, 0xB8, 0x02, 0x87, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x50, 0x00, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0xB8,
+    0x03, 0x2E, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7,
+    0x3C, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0xB8, 0x03, 0x4A,
+    0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x4F, 0x08,
+    0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0xB8, 0x03, 0x09, 0x06, 0x26,
+    0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x4F, 0x08, 0xFF, 0xFF,
+    0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x38, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFA, 0x4F, 0x08, 0xFF, 0xFF, 0x00, 0x3E,
+    0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x17, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0x50, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5,
+    0x02, 0x4A, 0x02, 0xEF, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x50, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A,
+    0x03, 0xF9, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x26, 0x03, 0x05,
+    0x50, 0x08, 0x00, 0x07, 0x02, 0xF2, 0x00, 0x4F, 0x00, 0xD2, 0xFF, 0xFF,
+    0x00, 0x3E, 0xFF, 0x28, 0x02, 0x4A, 0x02, 0x15, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x12, 0x00, 0xD2, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x3E, 0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x4F, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x4F, 0x08, 0xFF, 0xFF, 0x00, 0x3E,
+    0xFF, 0xF5, 0x02, 0x4A, 0x03, 0x09, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x4F, 0x08, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0xF5,
+    0x02, 0x4A, 0x03, 0xF8, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x03, 0x4F, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x02, 0x64,
+    0x02, 0x15, 0x00, 0x07, 0x00, 0x00, 0x73, 0x03, 0x33, 0x13, 0x07, 0x13,
+    0x33, 0x03, 0xE6, 0xDE, 0xCF, 0x77, 0x30, 0x78, 0xCE, 0xE9, 0x02, 0x15,
+    0xFE, 0x72, 0x01, 0x01, 0x8F, 0xFD, 0xEB, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x00, 0x03, 0x49, 0x02, 0x15, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x03,
+    0x33, 0x13, 0x27, 0x37, 0x33, 0x17, 0x07, 0x13, 0x33, 0x03, 0x23, 0x03,
+    0x33, 0x03, 0xB5, 0xAD, 0xC5, 0x56, 0x15, 0x61, 0x6C, 0x69, 0x15, 0x55,
+    0xC5, 0xB6, 0x8C, 0x65, 0x07, 0x68, 0x02, 0x15, 0xFE, 0xBD, 0x04, 0xFB,
+    0xFB, 0x03, 0x01, 0x42, 0xFD, 0xEB, 0x01, 0x06, 0xFE, 0xFA, 0xFF, 0xFF,
+    0x00, 0x08, 0x00, 0x00, 0x03, 0x49, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xE2,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xF8, 0x00, 0xAF, 0x00, 0x08, 0xFF, 0xFF,
+    0x00, 0x08, 0x00, 0x00, 0x03, 0x49, 0x03, 0x18, 0x06, 0x26, 0x01, 0xE2,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xFC, 0x00, 0xAF, 0x00, 0x08, 0xFF, 0xFF,
+    0x00, 0x08, 0x00, 0x00, 0x03, 0x49, 0x03, 0x2F, 0x06, 0x26, 0x01, 0xE2,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xF2, 0x00, 0xAE, 0x00, 0x08, 0xFF, 0xFF,
+    0x00, 0x08, 0x00, 0x00, 0x03, 0x49, 0x03, 0x2E, 0x06, 0x26, 0x01, 0xE2,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xF7, 0x00, 0x9B, 0x00, 0x08, 0x00, 0x03,
+    0x00, 0x13, 0x00, 0x00, 0x02, 0x5F, 0x02, 0x15, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x61, 0x27, 0x27, 0x03, 0x33, 0x17, 0x17, 0x13,
+    0x21, 0x13, 0x17, 0x07, 0x37, 0x27, 0x37, 0x33, 0x01, 0x84, 0x58, 0x45,
+    0xCC, 0xDC, 0x52, 0x4B, 0xCB, 0xFD, 0xB4, 0xD9, 0x62, 0x60, 0x92, 0x61,
+    0x5E, 0xDB, 0x95, 0x61, 0x01, 0x1F, 0x8A, 0x67, 0xFE, 0xDC, 0x01, 0x37,
+    0x74, 0xC3, 0xDD, 0x74, 0xC4, 0x00, 0x00, 0x01, 0x00, 0x05, 0xFF, 0x1A,
+    0x02, 0x79, 0x02, 0x15, 0x00, 0x10, 0x00, 0x00, 0x57, 0x13, 0x17, 0x03,
+    0x33, 0x17, 0x16, 0x16, 0x17, 0x07, 0x36, 0x36, 0x37, 0x37, 0x33, 0x03,
+    0x07, 0x80, 0x80, 0x02, 0xFD, 0xD0, 0x59, 0x0B, 0x11, 0x04, 0x15, 0x04,
+    0x10, 0x0A, 0x51, 0xD1, 0xE7, 0x5D, 0xE6, 0x01, 0x2E, 0x52, 0x02, 0x1F,
+    0xD4, 0x19, 0x31, 0x16, 0x10, 0x0D, 0x2E, 0x1E, 0xEB, 0xFD, 0xEB, 0xE6,
+    0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x79, 0x03, 0x2D, 0x06, 0x26,
+    0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x45, 0x08, 0xFF, 0xFF,
+    0x00, 0x05, 0xFF, 0x1A, 0x02, 0x79, 0x03, 0x18, 0x06, 0x26, 0x01, 0xE8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x45, 0x08, 0xFF, 0xFF, 0x00, 0x05,
+    0xFF, 0x1A, 0x02, 0x79, 0x03, 0x2F, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF2, 0x44, 0x08, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A,
+    0x02, 0x79, 0x03, 0x2F, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0x45, 0x08, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x18, 0x02, 0x7B,
+    0x02, 0x15, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E,
+    0x01, 0x12, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x79,
+    0x03, 0x2E, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7,
+    0x31, 0x08, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x79, 0x03, 0x4A,
+    0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x45, 0x08,
+    0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x79, 0x02, 0xEF, 0x06, 0x26,
+    0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x45, 0x08, 0xFF, 0xFF,
+    0x00, 0x05, 0xFF, 0x1A, 0x02, 0x79, 0x03, 0x09, 0x06, 0x26, 0x01, 0xE8,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x45, 0x08, 0x00, 0x01, 0x00, 0x32,
+    0x00, 0x00, 0x02, 0x0E, 0x02, 0x15, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x35,
+    0x01, 0x15, 0x21, 0x35, 0x21, 0x15, 0x01, 0x27, 0x21, 0x15, 0x32, 0x01,
+    0x20, 0xFE, 0xE0, 0x01, 0xD2, 0xFE, 0xF5, 0x04, 0x01, 0x19, 0x5E, 0x01,
+    0x6A, 0x47, 0x94, 0x64, 0xFE, 0xA3, 0x40, 0x94, 0xFF, 0xFF, 0x00, 0x32,
+    0x00, 0x00, 0x02, 0x0E, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x28, 0x08, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00,
+    0x02, 0x0E, 0x03, 0x20, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFD, 0x28, 0x08, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x02, 0x0E,
+    0x03, 0x2F, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5,
+    0x28, 0x08, 0xFF, 0xFF, 0x00, 0x32, 0xFF, 0x18, 0x02, 0x0E, 0x02, 0x15,
+    0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x28, 0x00,
+    0xFF, 0xFF, 0x00, 0x12, 0xFF, 0x29, 0x02, 0x6E, 0x03, 0x2D, 0x04, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x27, 0x02, 0xF8, 0xFF, 0xA1, 0x00, 0x08,
+    0x00, 0x27, 0x01, 0x6A, 0x01, 0x36, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF8,
+    0x00, 0xEB, 0x00, 0x08, 0x00, 0x02, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E,
+    0x02, 0x20, 0x00, 0x10, 0x00, 0x2E, 0x00, 0x00, 0x61, 0x11, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x11, 0x05, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x33, 0x07,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
+    0x37, 0x17, 0x0E, 0x02, 0x01, 0x57, 0x26, 0x27, 0x24, 0x39, 0x1C, 0x6B,
+    0x30, 0x81, 0x51, 0x45, 0x68, 0x39, 0xFE, 0xC5, 0x33, 0x50, 0x2F, 0x1E,
+    0x3B, 0x59, 0x3A, 0xAB, 0x09, 0x96, 0x10, 0x19, 0x12, 0x09, 0x0D, 0x18,
+    0x0F, 0x16, 0x27, 0x20, 0x0A, 0x1D, 0x15, 0x3B, 0x45, 0x01, 0x40, 0x28,
+    0x20, 0x1A, 0x20, 0x69, 0x2E, 0x3B, 0x28, 0x54, 0x42, 0xFE, 0x9E, 0x0A,
+    0x28, 0x47, 0x30, 0x28, 0x3C, 0x29, 0x15, 0x6B, 0x06, 0x0C, 0x10, 0x0B,
+    0x0B, 0x12, 0x0A, 0x0E, 0x1A, 0x13, 0x48, 0x22, 0x35, 0x1E, 0xFF, 0xFF,
+    0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x2D, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x0D, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFF, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6,
+    0x02, 0x0E, 0x03, 0xE6, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEA, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x18, 0x02, 0x0E,
+    0x03, 0x0D, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E,
+    0x29, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0xF6, 0x02, 0x0E, 0x03, 0xE6, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xEB, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6,
+    0x02, 0x0E, 0x03, 0xEE, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEC, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E,
+    0x03, 0xD4, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xED,
+    0x28, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x20,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x29, 0x08,
+    0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x29, 0x08, 0xFF, 0xFF,
+    0x00, 0x21, 0xFF, 0xF6, 0x02, 0x79, 0x03, 0xD3, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xEE, 0x71, 0x08, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0x18, 0x02, 0x0E, 0x03, 0x18, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x0E, 0x29, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x29, 0x08,
+    0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x18, 0x03, 0xD3, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF, 0x41, 0x08, 0xFF, 0xFF,
+    0x00, 0x21, 0xFF, 0xF6, 0x02, 0x5B, 0x03, 0xD9, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF0, 0x66, 0x08, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0xF6, 0x02, 0x0E, 0x03, 0xD3, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF1, 0x28, 0x08, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xF6,
+    0x02, 0x0E, 0x03, 0x38, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0A, 0xED, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E,
+    0x03, 0x2F, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2,
+    0x28, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x18, 0x02, 0x0E, 0x02, 0x20,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x29, 0x00,
+    0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x2E, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x15, 0x08, 0xFF, 0xFF,
+    0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x4A, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x17, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6,
+    0x02, 0x0E, 0x02, 0xEF, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x28, 0x02, 0x0E,
+    0x02, 0x20, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x03, 0x12,
+    0x00, 0x96, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E,
+    0x03, 0x4F, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00,
+    0x29, 0x08, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x0E, 0x04, 0x53,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x29, 0x08,
+    0x00, 0x07, 0x02, 0xF8, 0x00, 0x29, 0x01, 0x2F, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0xF6, 0x02, 0x0E, 0x03, 0x09, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x29, 0x08, 0x00, 0x03, 0x00, 0x26, 0xFF, 0x18,
+    0x02, 0x58, 0x02, 0x1F, 0x00, 0x37, 0x00, 0x45, 0x00, 0x55, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x07, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x37, 0x07, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x16, 0x17, 0x27, 0x33, 0x15, 0x23, 0x37, 0x1E, 0x02, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x13, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x01, 0x3F, 0x8A, 0x8F, 0x17, 0x2E, 0x26, 0x05, 0x1F, 0x27, 0x1B, 0x2D,
+    0x1A, 0x03, 0x25, 0x29, 0x10, 0x3E, 0x6B, 0x40, 0x0F, 0x1B, 0x24, 0x1E,
+    0x39, 0xF4, 0x67, 0x16, 0x05, 0x07, 0x03, 0x3D, 0x6A, 0x40, 0x1C, 0x10,
+    0x13, 0x12, 0x11, 0x2D, 0x83, 0x96, 0x43, 0x7F, 0x58, 0x1D, 0x2A, 0x17,
+    0x33, 0x2B, 0x2A, 0x32, 0x17, 0x29, 0x0E, 0x13, 0x1E, 0x11, 0x11, 0x1E,
+    0x13, 0x13, 0x1D, 0x12, 0x12, 0x1D, 0xE8, 0x5E, 0x54, 0x1E, 0x33, 0x28,
+    0x0C, 0x08, 0x07, 0x2A, 0x1C, 0x18, 0x23, 0x14, 0x01, 0x12, 0x1D, 0x32,
+    0x30, 0x1B, 0x31, 0x52, 0x30, 0x02, 0x08, 0x09, 0x09, 0x7D, 0x1C, 0x0E,
+    0x18, 0x16, 0x0C, 0x33, 0x55, 0x32, 0x0E, 0x0E, 0x0D, 0x0E, 0x57, 0x5A,
+    0x38, 0x50, 0x2A, 0x81, 0x0E, 0x15, 0x0E, 0x16, 0x1A, 0x1A, 0x16, 0x0E,
+    0x15, 0x0E, 0x01, 0x92, 0x0F, 0x1B, 0x13, 0x0F, 0x1A, 0x0F, 0x0F, 0x1A,
+    0x0F, 0x12, 0x1B, 0x10, 0xFF, 0xFF, 0x00, 0x26, 0xFF, 0x18, 0x02, 0x58,
+    0x03, 0x0D, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF,
+    0x3D, 0x08, 0xFF, 0xFF, 0x00, 0x26, 0xFF, 0x18, 0x02, 0x58, 0x03, 0x20,
+    0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x3D, 0x08,
+    0xFF, 0xFF, 0x00, 0x26, 0xFF, 0x18, 0x02, 0x58, 0x03, 0x18, 0x06, 0x26,
+    0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x3D, 0x08, 0xFF, 0xFF,
+    0x00, 0x26, 0xFF, 0x18, 0x02, 0x58, 0x03, 0x66, 0x06, 0x26, 0x02, 0x12,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0C, 0x3D, 0x08, 0xFF, 0xFF, 0x00, 0x26,
+    0xFF, 0x18, 0x02, 0x58, 0x03, 0x2F, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF5, 0x3D, 0x08, 0xFF, 0xFF, 0x00, 0x26, 0xFF, 0x18,
+    0x02, 0x58, 0x02, 0xEF, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x3D, 0x08, 0xFF, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x03, 0x2D,
+    0x02, 0xE8, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x01, 0x4A,
+    0x01, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x04, 0x26,
+    0x03, 0x2F, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x4A,
+    0x01, 0x89, 0x00, 0x00, 0x00, 0x07, 0x01, 0x57, 0x03, 0x12, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x12, 0xFF, 0x29, 0x05, 0x7F, 0x03, 0x2F, 0x04, 0x26,
+    0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x4A, 0x01, 0x89, 0x00, 0x00,
+    0x00, 0x27, 0x01, 0x57, 0x03, 0x12, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x04, 0x64, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x12, 0x00, 0x00, 0x04, 0x13,
+    0x02, 0xE8, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x4A,
+    0x01, 0x89, 0x00, 0x00, 0x00, 0x07, 0x01, 0x6F, 0x03, 0x12, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x12, 0xFF, 0x29, 0x03, 0xF6, 0x03, 0x2F, 0x04, 0x26,
+    0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x57, 0x01, 0x89, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x69, 0x02, 0xDB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x12,
+    0x00, 0x00, 0x02, 0x9D, 0x03, 0x2F, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x57, 0x01, 0x89, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x12,
+    0x00, 0x00, 0x02, 0x8A, 0x02, 0xE8, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x6F, 0x01, 0x89, 0x00, 0x00, 0x00, 0x02, 0x00, 0x13,
+    0x01, 0x86, 0x01, 0x6C, 0x02, 0xD2, 0x00, 0x15, 0x00, 0x24, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x27, 0x35, 0x33, 0x11, 0x23, 0x35, 0x37, 0x14, 0x06, 0x06, 0x37, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x16, 0x8A, 0x24, 0x36, 0x1D, 0x22, 0x3B, 0x26, 0x3A, 0x35, 0x17, 0x7E,
+    0x7E, 0x17, 0x1C, 0x36, 0x0D, 0x0E, 0x17, 0x0D, 0x1B, 0x18, 0x0E, 0x15,
+    0x0C, 0x0B, 0x15, 0x01, 0x86, 0x2B, 0x4E, 0x33, 0x2E, 0x48, 0x2A, 0x3F,
+    0x3B, 0x30, 0x43, 0xFE, 0xC6, 0x49, 0x1E, 0x1D, 0x34, 0x21, 0x65, 0x11,
+    0x1E, 0x13, 0x1E, 0x22, 0x11, 0x1C, 0x10, 0x16, 0x1E, 0x11, 0x00, 0x02,
+    0x00, 0x25, 0x01, 0x89, 0x01, 0x80, 0x02, 0xCF, 0x00, 0x0F, 0x00, 0x1F,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0xD1, 0x32,
+    0x4D, 0x2D, 0x2D, 0x4D, 0x32, 0x31, 0x50, 0x2E, 0x2D, 0x50, 0x33, 0x10,
+    0x15, 0x0C, 0x0B, 0x16, 0x10, 0x0E, 0x16, 0x0C, 0x0C, 0x15, 0x01, 0x89,
+    0x2A, 0x49, 0x2F, 0x2F, 0x49, 0x2C, 0x2C, 0x4A, 0x2E, 0x2F, 0x49, 0x2A,
+    0x5B, 0x12, 0x22, 0x15, 0x16, 0x1F, 0x11, 0x12, 0x20, 0x14, 0x16, 0x21,
+    0x12, 0x00, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x02, 0xD6, 0x02, 0xE7,
+    0x06, 0x06, 0x02, 0xE1, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1D, 0x00, 0x00,
+    0x02, 0xD2, 0x02, 0xCE, 0x06, 0x06, 0x02, 0xE0, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x48, 0xFF, 0x5C, 0x02, 0x50, 0x02, 0x15, 0x06, 0x06, 0x02, 0xE5,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x1C, 0x00, 0x00, 0x02, 0x85, 0x02, 0x15,
+    0x00, 0x0F, 0x00, 0x00, 0x73, 0x11, 0x17, 0x23, 0x35, 0x21, 0x15, 0x23,
+    0x37, 0x11, 0x23, 0x11, 0x17, 0x23, 0x37, 0x11, 0x66, 0x11, 0x5B, 0x02,
+    0x69, 0x53, 0x09, 0xB1, 0x0A, 0x8B, 0x0D, 0x01, 0xE3, 0x6C, 0x9E, 0x9E,
+    0x46, 0xFE, 0x43, 0x01, 0xD3, 0x5C, 0x46, 0xFE, 0x43, 0x00, 0x00, 0x02,
+    0x00, 0x25, 0xFF, 0xF6, 0x02, 0x9C, 0x02, 0xC6, 0x00, 0x0F, 0x00, 0x1B,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x01, 0x60, 0x65, 0x8D, 0x49, 0x49,
+    0x8D, 0x65, 0x65, 0x8E, 0x49, 0x49, 0x8E, 0x65, 0x3D, 0x43, 0x43, 0x3D,
+    0x3D, 0x43, 0x43, 0x0A, 0x55, 0xA1, 0x72, 0x72, 0xA1, 0x55, 0x55, 0xA1,
+    0x72, 0x72, 0xA1, 0x55, 0xA5, 0x65, 0x5E, 0x62, 0x6A, 0x6A, 0x62, 0x5E,
+    0x65, 0x00, 0x00, 0x02, 0x00, 0x3D, 0x00, 0x00, 0x02, 0x1C, 0x02, 0xC6,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x11, 0x17, 0x07, 0x27, 0x37,
+    0x33, 0x11, 0x05, 0x35, 0x21, 0x15, 0xD1, 0x25, 0x9C, 0x1D, 0xCD, 0x87,
+    0xFE, 0xB8, 0x01, 0xD3, 0x31, 0x02, 0x38, 0x6F, 0x45, 0xB1, 0x60, 0xFD,
+    0x6B, 0x31, 0xAB, 0xAB, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x00, 0x02, 0x25,
+    0x02, 0xCF, 0x00, 0x22, 0x00, 0x00, 0x73, 0x27, 0x37, 0x3E, 0x03, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x17,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x03, 0x07, 0x07, 0x27, 0x21, 0x15, 0x2C,
+    0x22, 0xC8, 0x12, 0x29, 0x27, 0x18, 0x0E, 0x1D, 0x17, 0x14, 0x24, 0x21,
+    0x11, 0x91, 0x16, 0x52, 0x6B, 0x3B, 0x3F, 0x68, 0x3E, 0x09, 0x14, 0x20,
+    0x2E, 0x1F, 0x9F, 0x14, 0x01, 0x60, 0x52, 0xD7, 0x13, 0x31, 0x33, 0x31,
+    0x12, 0x0E, 0x17, 0x0F, 0x13, 0x29, 0x21, 0x4C, 0x3A, 0x5B, 0x34, 0x01,
+    0x01, 0x34, 0x5D, 0x3E, 0x14, 0x2D, 0x30, 0x37, 0x3D, 0x22, 0xAD, 0x61,
+    0xAB, 0x00, 0x00, 0x01, 0x00, 0x18, 0xFF, 0xF6, 0x02, 0x44, 0x02, 0xC4,
+    0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x1E, 0x02, 0x33,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07,
+    0x27, 0x37, 0x17, 0x25, 0x35, 0x21, 0x17, 0x07, 0x27, 0x36, 0x36, 0x33,
+    0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x01, 0x2F, 0x59, 0x88, 0x36,
+    0x8C, 0x14, 0x2E, 0x33, 0x1B, 0x19, 0x2A, 0x19, 0x18, 0x2C, 0x1F, 0x0E,
+    0x21, 0x23, 0x12, 0x29, 0x95, 0x3A, 0xFE, 0xDF, 0x01, 0xBC, 0x23, 0xE9,
+    0x2E, 0x08, 0x25, 0x14, 0x2F, 0x56, 0x42, 0x26, 0x4A, 0x7D, 0x0A, 0x48,
+    0x5B, 0x5A, 0x22, 0x28, 0x11, 0x14, 0x26, 0x1A, 0x1B, 0x25, 0x13, 0x06,
+    0x0C, 0x09, 0x6B, 0xA1, 0x16, 0x08, 0xA2, 0x47, 0xF5, 0x39, 0x04, 0x07,
+    0x23, 0x3D, 0x51, 0x30, 0x46, 0x6F, 0x40, 0x00, 0x00, 0x01, 0x00, 0x0D,
+    0x00, 0x00, 0x02, 0x89, 0x02, 0xC4, 0x00, 0x0B, 0x00, 0x00, 0x61, 0x11,
+    0x17, 0x01, 0x27, 0x21, 0x15, 0x21, 0x27, 0x01, 0x33, 0x11, 0x01, 0x5C,
+    0x79, 0xFE, 0xF8, 0x21, 0x01, 0xDD, 0xFD, 0xD4, 0x50, 0x01, 0x6C, 0xA2,
+    0x02, 0x37, 0x01, 0xFE, 0xBE, 0x26, 0x9F, 0x96, 0x01, 0xB3, 0xFD, 0x3C,
+    0x00, 0x01, 0x00, 0x1C, 0xFF, 0xF9, 0x02, 0x31, 0x02, 0xC4, 0x00, 0x26,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x13,
+    0x21, 0x15, 0x21, 0x37, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x01, 0x26, 0x54, 0x88, 0x2E, 0x6A, 0x26, 0x46,
+    0x2B, 0x1D, 0x2B, 0x18, 0x19, 0x2C, 0x1D, 0x19, 0x29, 0x2C, 0x1B, 0x50,
+    0x2D, 0x01, 0x9D, 0xFE, 0xB9, 0x36, 0x21, 0x4B, 0x17, 0x3B, 0x41, 0x22,
+    0x44, 0x6B, 0x3E, 0x47, 0x78, 0x07, 0x40, 0x3C, 0x74, 0x2A, 0x20, 0x17,
+    0x28, 0x18, 0x1A, 0x28, 0x18, 0x0A, 0x13, 0x12, 0x69, 0x01, 0x3A, 0xA2,
+    0x49, 0xDE, 0x11, 0x13, 0x1D, 0x12, 0x3D, 0x6E, 0x47, 0x45, 0x6F, 0x41,
+    0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x02, 0x37, 0x02, 0xC6, 0x00, 0x1F,
+    0x00, 0x2F, 0x00, 0x00, 0x61, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x37, 0x37, 0x33, 0x17, 0x07, 0x0E, 0x02, 0x07, 0x27, 0x3E, 0x03, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01,
+    0x2B, 0x38, 0x60, 0x49, 0x2A, 0x10, 0x1C, 0x27, 0x17, 0x65, 0xB5, 0x04,
+    0x94, 0x18, 0x21, 0x1D, 0x13, 0x24, 0x06, 0x2C, 0x3F, 0x44, 0x1F, 0x3C,
+    0x64, 0x3C, 0x46, 0x7A, 0x49, 0x1C, 0x2C, 0x19, 0x1A, 0x2C, 0x1B, 0x1C,
+    0x2C, 0x19, 0x19, 0x2C, 0x27, 0x47, 0x5D, 0x35, 0x28, 0x47, 0x42, 0x46,
+    0x26, 0xA9, 0x0A, 0xE3, 0x26, 0x40, 0x43, 0x2C, 0x35, 0x26, 0x40, 0x30,
+    0x1A, 0x3F, 0x68, 0x3E, 0x4A, 0x76, 0x44, 0x9E, 0x18, 0x2C, 0x1C, 0x18,
+    0x2B, 0x1A, 0x19, 0x2A, 0x1A, 0x1C, 0x2B, 0x19, 0x00, 0x01, 0x00, 0x27,
+    0x00, 0x00, 0x02, 0x0B, 0x02, 0xC4, 0x00, 0x07, 0x00, 0x00, 0x73, 0x01,
+    0x17, 0x21, 0x35, 0x21, 0x17, 0x01, 0x48, 0x01, 0x13, 0x40, 0xFE, 0x8C,
+    0x01, 0xD3, 0x11, 0xFE, 0xFF, 0x02, 0x80, 0x66, 0xAA, 0x56, 0xFD, 0x92,
+    0x00, 0x03, 0x00, 0x22, 0xFF, 0xFD, 0x02, 0x3D, 0x02, 0xCD, 0x00, 0x25,
+    0x00, 0x35, 0x00, 0x45, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x3E, 0x02, 0x37, 0x07, 0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x27, 0x1E, 0x03, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x13, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x2F,
+    0x4B, 0x7A, 0x48, 0x16, 0x2B, 0x3F, 0x28, 0x0E, 0x1E, 0x2F, 0x21, 0x13,
+    0x42, 0x6E, 0x44, 0x44, 0x6E, 0x42, 0x11, 0x21, 0x30, 0x20, 0x0B, 0x25,
+    0x3D, 0x2D, 0x18, 0x48, 0x7B, 0x4B, 0x18, 0x26, 0x16, 0x15, 0x26, 0x19,
+    0x18, 0x26, 0x16, 0x16, 0x26, 0x18, 0x15, 0x22, 0x13, 0x13, 0x22, 0x15,
+    0x15, 0x22, 0x13, 0x13, 0x22, 0x03, 0x37, 0x5F, 0x3C, 0x2B, 0x43, 0x31,
+    0x22, 0x0A, 0x31, 0x0B, 0x21, 0x2B, 0x31, 0x1D, 0x38, 0x56, 0x31, 0x31,
+    0x56, 0x38, 0x1D, 0x31, 0x29, 0x22, 0x0C, 0x2D, 0x08, 0x1F, 0x31, 0x43,
+    0x2C, 0x3D, 0x5F, 0x36, 0x95, 0x13, 0x22, 0x16, 0x17, 0x22, 0x14, 0x14,
+    0x22, 0x17, 0x15, 0x22, 0x14, 0x01, 0x30, 0x11, 0x1D, 0x14, 0x13, 0x1F,
+    0x12, 0x12, 0x1F, 0x13, 0x14, 0x1D, 0x11, 0x00, 0x00, 0x02, 0x00, 0x1E,
+    0x00, 0x00, 0x02, 0x36, 0x02, 0xCF, 0x00, 0x1B, 0x00, 0x2B, 0x00, 0x00,
+    0x73, 0x27, 0x13, 0x17, 0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x07,
+    0x03, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0xC7, 0x04, 0xE1, 0x28, 0x06, 0x2D, 0x41, 0x48,
+    0x1F, 0x39, 0x60, 0x3A, 0x47, 0x79, 0x4D, 0x37, 0x61, 0x4A, 0x29, 0x0E,
+    0x1B, 0x22, 0x14, 0x5B, 0x5A, 0x1B, 0x2A, 0x18, 0x18, 0x2A, 0x1B, 0x1B,
+    0x28, 0x18, 0x19, 0x29, 0x0A, 0x01, 0xBA, 0x32, 0x26, 0x40, 0x2F, 0x1B,
+    0x41, 0x69, 0x3D, 0x4A, 0x76, 0x46, 0x27, 0x44, 0x58, 0x33, 0x28, 0x4B,
+    0x48, 0x49, 0x27, 0xAE, 0x01, 0x78, 0x19, 0x2A, 0x19, 0x1C, 0x2A, 0x18,
+    0x17, 0x2B, 0x1C, 0x18, 0x2A, 0x1A, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0xF6,
+    0x02, 0x9C, 0x02, 0xC6, 0x06, 0x26, 0x02, 0x26, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0x69, 0x00, 0xD9, 0x01, 0x0D, 0x00, 0x02, 0x00, 0x26, 0xFF, 0xF6,
+    0x01, 0x88, 0x01, 0x80, 0x00, 0x0F, 0x00, 0x1C, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0xD8, 0x33, 0x50, 0x2F, 0x2D, 0x50, 0x35, 0x35, 0x4F,
+    0x2C, 0x2D, 0x50, 0x33, 0x11, 0x18, 0x0C, 0x1B, 0x1A, 0x19, 0x1D, 0x1C,
+    0x0A, 0x33, 0x59, 0x38, 0x3B, 0x59, 0x32, 0x32, 0x59, 0x3B, 0x38, 0x59,
+    0x33, 0x73, 0x14, 0x25, 0x18, 0x26, 0x2D, 0x2D, 0x26, 0x24, 0x2D, 0x00,
+    0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF3, 0x01, 0x75, 0x00, 0x0A,
+    0x00, 0x00, 0x73, 0x11, 0x17, 0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0x22,
+    0x22, 0x6F, 0x17, 0x43, 0x33, 0x7F, 0x64, 0x42, 0x10, 0x20, 0x01, 0x2B,
+    0x33, 0x28, 0x5B, 0x4A, 0xFE, 0x8B, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00,
+    0x01, 0x5C, 0x01, 0x80, 0x00, 0x1D, 0x00, 0x00, 0x73, 0x27, 0x37, 0x3E,
+    0x02, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x37, 0x33, 0x15,
+    0x3A, 0x0F, 0x68, 0x12, 0x1F, 0x13, 0x0C, 0x0C, 0x15, 0x22, 0x0B, 0x59,
+    0x17, 0x32, 0x39, 0x23, 0x29, 0x3D, 0x21, 0x2A, 0x41, 0x21, 0x30, 0x01,
+    0xC7, 0x59, 0x4C, 0x0D, 0x1C, 0x1D, 0x0D, 0x0C, 0x0F, 0x21, 0x13, 0x3F,
+    0x20, 0x2C, 0x16, 0x1F, 0x33, 0x1F, 0x2D, 0x41, 0x2D, 0x13, 0x1D, 0x20,
+    0x64, 0x00, 0x00, 0x01, 0x00, 0x1A, 0xFF, 0xF6, 0x01, 0x41, 0x01, 0x76,
+    0x00, 0x23, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x37,
+    0x17, 0x23, 0x35, 0x33, 0x17, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0xB6, 0x20, 0x32, 0x2E, 0x1C, 0x33, 0x10, 0x25,
+    0x14, 0x14, 0x1A, 0x17, 0x16, 0x0E, 0x1C, 0x0E, 0x18, 0xA1, 0x03, 0xB2,
+    0xE8, 0x0B, 0x81, 0x02, 0x0D, 0x1B, 0x09, 0x2A, 0x3D, 0x27, 0x3F, 0x0A,
+    0x07, 0x0F, 0x0C, 0x58, 0x08, 0x0B, 0x13, 0x0E, 0x0C, 0x10, 0x05, 0x04,
+    0x3F, 0x68, 0x26, 0x64, 0x5C, 0x58, 0x06, 0x08, 0x08, 0x39, 0x2E, 0x25,
+    0x37, 0x1F, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x01, 0x7F, 0x01, 0x77,
+    0x00, 0x03, 0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x65, 0x33, 0x15, 0x23,
+    0x27, 0x27, 0x33, 0x07, 0x35, 0x17, 0x13, 0x23, 0x35, 0x17, 0x23, 0x27,
+    0x37, 0x33, 0x01, 0x36, 0x49, 0x49, 0xC0, 0x10, 0x94, 0x28, 0x1D, 0x57,
+    0x8D, 0x27, 0xBB, 0x15, 0xBA, 0x7C, 0xA4, 0x64, 0x42, 0x22, 0x29, 0x9F,
+    0x0B, 0xFE, 0xF1, 0x68, 0x28, 0x55, 0xE2, 0x00, 0x00, 0x01, 0x00, 0x19,
+    0xFF, 0xF6, 0x01, 0x4B, 0x01, 0x75, 0x00, 0x22, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x22, 0x06, 0x07, 0x27, 0x37, 0x33, 0x15, 0x23, 0x37, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0xA1, 0x21, 0x4F,
+    0x18, 0x36, 0x14, 0x2A, 0x19, 0x14, 0x17, 0x18, 0x14, 0x12, 0x26, 0x13,
+    0x33, 0x1C, 0xF4, 0xBC, 0x33, 0x21, 0x1B, 0x0F, 0x29, 0x1D, 0x25, 0x3B,
+    0x24, 0x2B, 0x4C, 0x0A, 0x17, 0x12, 0x57, 0x0B, 0x0B, 0x13, 0x10, 0x0E,
+    0x13, 0x08, 0x0C, 0x32, 0xB3, 0x64, 0x34, 0x8D, 0x15, 0x11, 0x0C, 0x1D,
+    0x32, 0x1F, 0x28, 0x3C, 0x22, 0x00, 0x00, 0x02, 0x00, 0x24, 0xFF, 0xF6,
+    0x01, 0x63, 0x01, 0x80, 0x00, 0x1C, 0x00, 0x28, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0xCA, 0x4A, 0x5C, 0x2B, 0x54, 0x3B, 0x24, 0x42, 0x1A,
+    0x31, 0x10, 0x26, 0x0B, 0x28, 0x27, 0x02, 0x41, 0x12, 0x49, 0x2B, 0x27,
+    0x3B, 0x21, 0x27, 0x45, 0x2B, 0x11, 0x19, 0x17, 0x11, 0x13, 0x18, 0x17,
+    0x0A, 0x5F, 0x55, 0x3D, 0x61, 0x38, 0x12, 0x14, 0x52, 0x0C, 0x09, 0x33,
+    0x30, 0x44, 0x39, 0x42, 0x1F, 0x37, 0x23, 0x27, 0x3B, 0x20, 0x5A, 0x17,
+    0x11, 0x0F, 0x18, 0x17, 0x10, 0x11, 0x17, 0x00, 0x00, 0x01, 0x00, 0x20,
+    0x00, 0x00, 0x01, 0x3E, 0x01, 0x75, 0x00, 0x08, 0x00, 0x00, 0x73, 0x35,
+    0x13, 0x17, 0x23, 0x35, 0x33, 0x17, 0x03, 0x33, 0x87, 0x2A, 0xC4, 0xF5,
+    0x29, 0x85, 0x09, 0x01, 0x2A, 0x30, 0x72, 0x48, 0xFE, 0xD3, 0x00, 0x03,
+    0x00, 0x29, 0xFF, 0xF5, 0x01, 0x65, 0x01, 0x80, 0x00, 0x1E, 0x00, 0x2A,
+    0x00, 0x36, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37,
+    0x07, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x0E, 0x02, 0x07, 0x27, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x37, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xC7, 0x2B,
+    0x48, 0x2B, 0x2D, 0x2C, 0x03, 0x23, 0x28, 0x26, 0x43, 0x2A, 0x2B, 0x43,
+    0x27, 0x01, 0x11, 0x22, 0x18, 0x01, 0x27, 0x2F, 0x2A, 0x48, 0x2C, 0x13,
+    0x1C, 0x1B, 0x13, 0x14, 0x1B, 0x1B, 0x14, 0x12, 0x18, 0x18, 0x12, 0x11,
+    0x18, 0x19, 0x0B, 0x20, 0x34, 0x1F, 0x27, 0x32, 0x09, 0x14, 0x0C, 0x2E,
+    0x22, 0x1F, 0x31, 0x1E, 0x1E, 0x31, 0x1F, 0x17, 0x22, 0x19, 0x0A, 0x14,
+    0x07, 0x34, 0x27, 0x1F, 0x34, 0x20, 0x53, 0x19, 0x13, 0x10, 0x1A, 0x19,
+    0x11, 0x13, 0x19, 0x9F, 0x16, 0x0F, 0x11, 0x16, 0x16, 0x11, 0x0F, 0x16,
+    0x00, 0x02, 0x00, 0x21, 0xFF, 0xF6, 0x01, 0x60, 0x01, 0x80, 0x00, 0x1D,
+    0x00, 0x29, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x36, 0x37, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xA6, 0x24,
+    0x42, 0x1A, 0x30, 0x11, 0x24, 0x10, 0x1A, 0x21, 0x12, 0x01, 0x41, 0x13,
+    0x48, 0x2C, 0x26, 0x3B, 0x21, 0x28, 0x4A, 0x2F, 0x47, 0x57, 0x2B, 0x54,
+    0x2B, 0x13, 0x18, 0x18, 0x12, 0x10, 0x19, 0x17, 0x0A, 0x11, 0x15, 0x51,
+    0x0B, 0x0A, 0x17, 0x2D, 0x1F, 0x45, 0x3A, 0x42, 0x20, 0x36, 0x24, 0x27,
+    0x3B, 0x20, 0x60, 0x55, 0x3D, 0x61, 0x37, 0xE0, 0x17, 0x10, 0x11, 0x17,
+    0x17, 0x11, 0x0F, 0x18, 0xFF, 0xFF, 0x00, 0x26, 0xFF, 0x38, 0x01, 0x88,
+    0x00, 0xC2, 0x06, 0x07, 0x02, 0x31, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF,
+    0x00, 0x10, 0xFF, 0x38, 0x00, 0xF3, 0x00, 0xAD, 0x06, 0x07, 0x02, 0x32,
+    0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x38, 0x01, 0x5C,
+    0x00, 0xB8, 0x06, 0x07, 0x02, 0x33, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF,
+    0x00, 0x1A, 0xFF, 0x38, 0x01, 0x41, 0x00, 0xB8, 0x06, 0x07, 0x02, 0x34,
+    0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x10, 0xFF, 0x38, 0x01, 0x7F,
+    0x00, 0xAF, 0x06, 0x07, 0x02, 0x35, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF,
+    0x00, 0x19, 0xFF, 0x2E, 0x01, 0x4B, 0x00, 0xAD, 0x06, 0x07, 0x02, 0x36,
+    0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x38, 0x01, 0x63,
+    0x00, 0xC2, 0x06, 0x07, 0x02, 0x37, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF,
+    0x00, 0x20, 0xFF, 0x38, 0x01, 0x3E, 0x00, 0xAD, 0x06, 0x07, 0x02, 0x38,
+    0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x37, 0x01, 0x65,
+    0x00, 0xC2, 0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF,
+    0x00, 0x21, 0xFF, 0x38, 0x01, 0x60, 0x00, 0xC2, 0x06, 0x07, 0x02, 0x3A,
+    0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x26, 0x01, 0x56, 0x01, 0x88,
+    0x02, 0xE0, 0x06, 0x07, 0x02, 0x31, 0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF,
+    0x00, 0x10, 0x01, 0x69, 0x00, 0xF3, 0x02, 0xDE, 0x06, 0x07, 0x02, 0x32,
+    0x00, 0x00, 0x01, 0x69, 0xFF, 0xFF, 0x00, 0x24, 0x01, 0x5C, 0x01, 0x5C,
+    0x02, 0xDC, 0x06, 0x07, 0x02, 0x33, 0x00, 0x00, 0x01, 0x5C, 0xFF, 0xFF,
+    0x00, 0x1A, 0x01, 0x56, 0x01, 0x41, 0x02, 0xD6, 0x06, 0x07, 0x02, 0x34,
+    0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF, 0x00, 0x10, 0x01, 0x5E, 0x01, 0x7F,
+    0x02, 0xD5, 0x06, 0x07, 0x02, 0x35, 0x00, 0x00, 0x01, 0x5E, 0xFF, 0xFF,
+    0x00, 0x19, 0x01, 0x57, 0x01, 0x4B, 0x02, 0xD6, 0x06, 0x07, 0x02, 0x36,
+    0x00, 0x00, 0x01, 0x61, 0xFF, 0xFF, 0x00, 0x24, 0x01, 0x58, 0x01, 0x63,
+    0x02, 0xE2, 0x06, 0x07, 0x02, 0x37, 0x00, 0x00, 0x01, 0x62, 0xFF, 0xFF,
+    0x00, 0x20, 0x01, 0x64, 0x01, 0x3E, 0x02, 0xD9, 0x06, 0x07, 0x02, 0x38,
+    0x00, 0x00, 0x01, 0x64, 0xFF, 0xFF, 0x00, 0x29, 0x01, 0x55, 0x01, 0x65,
+    0x02, 0xE0, 0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF,
+    0x00, 0x21, 0x01, 0x56, 0x01, 0x60, 0x02, 0xE0, 0x06, 0x07, 0x02, 0x3A,
+    0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF, 0x00, 0x26, 0x01, 0x9C, 0x01, 0x88,
+    0x03, 0x26, 0x06, 0x07, 0x02, 0x31, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF,
+    0x00, 0x10, 0x01, 0xAF, 0x00, 0xF3, 0x03, 0x24, 0x06, 0x07, 0x02, 0x32,
+    0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0x00, 0x24, 0x01, 0xA2, 0x01, 0x5C,
+    0x03, 0x22, 0x06, 0x07, 0x02, 0x33, 0x00, 0x00, 0x01, 0xA2, 0xFF, 0xFF,
+    0x00, 0x1A, 0x01, 0x9C, 0x01, 0x41, 0x03, 0x1C, 0x06, 0x07, 0x02, 0x34,
+    0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF, 0x00, 0x10, 0x01, 0xA4, 0x01, 0x7F,
+    0x03, 0x1B, 0x06, 0x07, 0x02, 0x35, 0x00, 0x00, 0x01, 0xA4, 0xFF, 0xFF,
+    0x00, 0x19, 0x01, 0x9D, 0x01, 0x4B, 0x03, 0x1C, 0x06, 0x07, 0x02, 0x36,
+    0x00, 0x00, 0x01, 0xA7, 0xFF, 0xFF, 0x00, 0x24, 0x01, 0x9E, 0x01, 0x63,
+    0x03, 0x28, 0x06, 0x07, 0x02, 0x37, 0x00, 0x00, 0x01, 0xA8, 0xFF, 0xFF,
+    0x00, 0x20, 0x01, 0xAA, 0x01, 0x3E, 0x03, 0x1F, 0x06, 0x07, 0x02, 0x38,
+    0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFF, 0x00, 0x29, 0x01, 0x9B, 0x01, 0x65,
+    0x03, 0x26, 0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF,
+    0x00, 0x21, 0x01, 0x9C, 0x01, 0x60, 0x03, 0x26, 0x06, 0x07, 0x02, 0x3A,
+    0x00, 0x00, 0x01, 0xA6, 0x00, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0x02, 0x6B,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x63, 0x01, 0x33, 0x01, 0x0D, 0x01,
+    0xD3, 0xA5, 0xFE, 0x2C, 0x02, 0xBC, 0xFD, 0x44, 0xFF, 0xFF, 0x00, 0x1A,
+    0x00, 0x00, 0x03, 0x27, 0x02, 0xDE, 0x04, 0x27, 0x02, 0x32, 0x00, 0x09,
+    0x01, 0x69, 0x00, 0x26, 0x02, 0x59, 0x5C, 0x00, 0x00, 0x07, 0x02, 0x33,
+    0x01, 0xCB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1A, 0x00, 0x00, 0x03, 0x21,
+    0x02, 0xDE, 0x04, 0x27, 0x02, 0x32, 0x00, 0x09, 0x01, 0x69, 0x00, 0x26,
+    0x02, 0x59, 0x5C, 0x00, 0x00, 0x07, 0x02, 0x35, 0x01, 0xA2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x18, 0x00, 0x00, 0x03, 0x4C, 0x02, 0xD6, 0x04, 0x27,
+    0x02, 0x34, 0xFF, 0xFE, 0x01, 0x60, 0x00, 0x27, 0x02, 0x59, 0x00, 0x89,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0x35, 0x01, 0xCD, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x3C, 0xFF, 0xF5, 0x03, 0x4B, 0x02, 0xDE, 0x04, 0x27, 0x02, 0x32,
+    0x00, 0x2C, 0x01, 0x69, 0x00, 0x26, 0x02, 0x59, 0x78, 0x00, 0x00, 0x07,
+    0x02, 0x39, 0x01, 0xE6, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0xF5,
+    0x03, 0x43, 0x02, 0xD6, 0x04, 0x27, 0x02, 0x34, 0xFF, 0xFE, 0x01, 0x60,
+    0x00, 0x26, 0x02, 0x59, 0x75, 0x00, 0x00, 0x07, 0x02, 0x39, 0x01, 0xDE,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1C, 0xFF, 0xF5, 0x03, 0x69, 0x02, 0xD6,
+    0x04, 0x27, 0x02, 0x36, 0x00, 0x03, 0x01, 0x61, 0x00, 0x27, 0x02, 0x59,
+    0x00, 0x8D, 0x00, 0x00, 0x00, 0x07, 0x02, 0x39, 0x02, 0x04, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xF5, 0x03, 0x52, 0x02, 0xD9, 0x04, 0x27,
+    0x02, 0x38, 0x00, 0x1C, 0x01, 0x64, 0x00, 0x26, 0x02, 0x59, 0x6D, 0x00,
+    0x00, 0x07, 0x02, 0x39, 0x01, 0xEC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29,
+    0xFF, 0xF5, 0x00, 0xE5, 0x00, 0xB5, 0x00, 0x0B, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x87, 0x2D,
+    0x31, 0x34, 0x2A, 0x2C, 0x32, 0x34, 0x0B, 0x32, 0x2E, 0x2A, 0x36, 0x32,
+    0x2E, 0x2A, 0x36, 0x00, 0x00, 0x01, 0x00, 0x21, 0xFF, 0x2F, 0x00, 0xFF,
+    0x00, 0x88, 0x00, 0x15, 0x00, 0x00, 0x57, 0x27, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x0E, 0x02, 0x53, 0x32, 0x2B, 0x33, 0x0A, 0x12, 0x18, 0x13, 0x33,
+    0x27, 0x1F, 0x31, 0x1D, 0x19, 0x2F, 0x3F, 0xD1, 0x3D, 0x12, 0x39, 0x13,
+    0x0A, 0x14, 0x0C, 0x11, 0x23, 0x16, 0x22, 0x28, 0x21, 0x3B, 0x27, 0x23,
+    0x43, 0x3A, 0x2B, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF5, 0x00, 0xE5,
+    0x02, 0x1F, 0x06, 0x26, 0x02, 0x69, 0x00, 0x00, 0x00, 0x07, 0x02, 0x69,
+    0x00, 0x00, 0x01, 0x6B, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x2F, 0x01, 0x07,
+    0x02, 0x20, 0x04, 0x26, 0x02, 0x6A, 0x07, 0x00, 0x00, 0x07, 0x02, 0x69,
+    0x00, 0x0E, 0x01, 0x6C, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF5, 0x02, 0xF3,
+    0x00, 0xB5, 0x04, 0x26, 0x02, 0x69, 0x00, 0x00, 0x00, 0x27, 0x02, 0x69,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x02, 0x69, 0x02, 0x0E, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x49, 0xFF, 0xF5, 0x01, 0x0D, 0x02, 0xCD, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x00, 0x53, 0x2E, 0x02, 0x35, 0x35, 0x33, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x03, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x70, 0x09, 0x12, 0x0C, 0xC4, 0x0C, 0x12, 0x09, 0x3B,
+    0x2C, 0x32, 0x35, 0x29, 0x2D, 0x31, 0x34, 0x01, 0x06, 0x3B, 0x80, 0x7E,
+    0x3B, 0x53, 0x53, 0x3B, 0x7F, 0x7F, 0x3B, 0xFE, 0xEF, 0x32, 0x2E, 0x2A,
+    0x36, 0x32, 0x2E, 0x2A, 0x36, 0x00, 0x00, 0x02, 0x00, 0x48, 0xFF, 0x45,
+    0x01, 0x0C, 0x02, 0x1D, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x53, 0x1E,
+    0x02, 0x15, 0x15, 0x23, 0x35, 0x34, 0x36, 0x36, 0x37, 0x13, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0xE5, 0x09, 0x12,
+    0x0C, 0xC4, 0x0C, 0x12, 0x09, 0x3B, 0x2C, 0x32, 0x34, 0x2A, 0x2D, 0x31,
+    0x34, 0x01, 0x0C, 0x3B, 0x7F, 0x7F, 0x3B, 0x53, 0x53, 0x3B, 0x80, 0x7E,
+    0x3B, 0x01, 0x11, 0x32, 0x2E, 0x2A, 0x36, 0x32, 0x2E, 0x2A, 0x36, 0x00,
+    0x00, 0x02, 0x00, 0x18, 0xFF, 0xF5, 0x01, 0xFB, 0x02, 0xCE, 0x00, 0x1C,
+    0x00, 0x28, 0x00, 0x00, 0x77, 0x27, 0x3E, 0x04, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x0E, 0x02, 0x0F, 0x02, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x23, 0x22, 0x26, 0xC4, 0x23, 0x19, 0x30, 0x2A, 0x21, 0x12, 0x0E,
+    0x1A, 0x11, 0x1E, 0x3E, 0x1D, 0x7D, 0x2F, 0x7F, 0x46, 0x43, 0x6D, 0x3F,
+    0x20, 0x3A, 0x4E, 0x2E, 0x06, 0x7F, 0x34, 0x2A, 0x2C, 0x32, 0x35, 0x29,
+    0x2D, 0x31, 0xFD, 0x7E, 0x06, 0x10, 0x14, 0x1A, 0x21, 0x13, 0x10, 0x15,
+    0x0C, 0x2B, 0x36, 0x77, 0x47, 0x4D, 0x36, 0x5F, 0x3A, 0x27, 0x4C, 0x42,
+    0x31, 0x0D, 0x0F, 0xA8, 0x2A, 0x36, 0x32, 0x2E, 0x2A, 0x36, 0x32, 0x00,
+    0x00, 0x02, 0x00, 0x18, 0xFF, 0x48, 0x01, 0xFB, 0x02, 0x21, 0x00, 0x1C,
+    0x00, 0x28, 0x00, 0x00, 0x41, 0x17, 0x0E, 0x04, 0x15, 0x14, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35,
+    0x34, 0x3E, 0x02, 0x3F, 0x02, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x01, 0x4F, 0x23, 0x19, 0x30, 0x2A, 0x21, 0x12,
+    0x0E, 0x1A, 0x11, 0x1F, 0x3D, 0x1D, 0x7D, 0x2F, 0x7F, 0x46, 0x43, 0x6C,
+    0x40, 0x20, 0x3A, 0x4E, 0x2E, 0x07, 0x7F, 0x35, 0x29, 0x2D, 0x31, 0x34,
+    0x2A, 0x2C, 0x32, 0x01, 0x19, 0x7E, 0x06, 0x10, 0x14, 0x1A, 0x20, 0x14,
+    0x0F, 0x16, 0x0C, 0x2B, 0x36, 0x77, 0x47, 0x4D, 0x36, 0x5F, 0x3A, 0x28,
+    0x4B, 0x42, 0x31, 0x0D, 0x0F, 0xA8, 0x2A, 0x36, 0x32, 0x2E, 0x2A, 0x36,
+    0x32, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0xFD, 0x00, 0xE5, 0x01, 0xBD,
+    0x06, 0x07, 0x02, 0x69, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x25,
+    0x00, 0xD8, 0x01, 0x36, 0x01, 0xE8, 0x00, 0x0F, 0x00, 0x00, 0x77, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0xAD, 0x25, 0x3E, 0x25, 0x24, 0x3E, 0x26, 0x26, 0x3E, 0x25,
+    0x25, 0x3E, 0xD8, 0x24, 0x3E, 0x25, 0x26, 0x3E, 0x25, 0x25, 0x3E, 0x26,
+    0x25, 0x3E, 0x24, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x01, 0x57, 0x01, 0xC5,
+    0x02, 0xF0, 0x00, 0x17, 0x00, 0x00, 0x53, 0x37, 0x17, 0x07, 0x27, 0x37,
+    0x15, 0x27, 0x37, 0x17, 0x07, 0x27, 0x33, 0x07, 0x27, 0x37, 0x17, 0x07,
+    0x35, 0x17, 0x07, 0x27, 0x33, 0x17, 0xA9, 0x11, 0x17, 0x88, 0x3D, 0x91,
+    0x91, 0x3D, 0x8B, 0x1A, 0x14, 0x85, 0x11, 0x14, 0x82, 0x3D, 0x96, 0x94,
+    0x3D, 0x7D, 0x12, 0x12, 0x01, 0x57, 0x91, 0x04, 0x5C, 0x68, 0x36, 0x0A,
+    0x40, 0x6A, 0x6A, 0x03, 0x97, 0x98, 0x05, 0x68, 0x6A, 0x40, 0x0A, 0x35,
+    0x68, 0x60, 0x91, 0x00, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x02, 0xC0,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
+    0x61, 0x13, 0x33, 0x03, 0x25, 0x35, 0x21, 0x15, 0x05, 0x13, 0x33, 0x03,
+    0x03, 0x35, 0x21, 0x15, 0x01, 0x71, 0x78, 0xA4, 0x78, 0xFE, 0x22, 0x02,
+    0x64, 0xFD, 0xD1, 0x78, 0xA5, 0x78, 0xB4, 0x02, 0x63, 0x02, 0xBC, 0xFD,
+    0x44, 0x8C, 0x95, 0x95, 0x8C, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0xA4, 0x95,
+    0x95, 0x00, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x6E, 0x02, 0x5F, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x00, 0x57, 0x01, 0x33, 0x01, 0x03, 0x01, 0xA2, 0xBA,
+    0xFE, 0x60, 0x92, 0x03, 0x4E, 0xFC, 0xB2, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0xFF, 0x95, 0x02, 0x52, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x45, 0x01,
+    0x33, 0x01, 0x01, 0x96, 0xFE, 0x72, 0xBA, 0x01, 0x90, 0x6B, 0x03, 0x27,
+    0xFC, 0xD9, 0xFF, 0xFF, 0x00, 0x29, 0x01, 0x2B, 0x00, 0xE5, 0x01, 0xEB,
+    0x06, 0x07, 0x02, 0x69, 0x00, 0x00, 0x01, 0x36, 0xFF, 0xFF, 0x00, 0x2D,
+    0x00, 0xDB, 0x01, 0x3E, 0x01, 0xEB, 0x04, 0x06, 0x02, 0x73, 0x08, 0x03,
+    0xFF, 0xFF, 0x00, 0x03, 0xFF, 0x6E, 0x02, 0x5F, 0x02, 0xBC, 0x04, 0x06,
+    0x02, 0x76, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0xFF, 0x95, 0x02, 0x52,
+    0x02, 0xBC, 0x04, 0x06, 0x02, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x01, 0x2B, 0x00, 0xB3, 0x01, 0xEB, 0x04, 0x07, 0x02, 0x69, 0xFF, 0xCE,
+    0x01, 0x36, 0xFF, 0xFF, 0xFF, 0x27, 0x01, 0x2B, 0xFF, 0xE3, 0x01, 0xEB,
+    0x04, 0x07, 0x02, 0x69, 0xFE, 0xFE, 0x01, 0x36, 0x00, 0x01, 0x00, 0x33,
+    0x00, 0xCC, 0x01, 0xA6, 0x01, 0x73, 0x00, 0x03, 0x00, 0x00, 0x77, 0x35,
+    0x21, 0x15, 0x33, 0x01, 0x73, 0xCC, 0xA7, 0xA7, 0xFF, 0xFF, 0x00, 0x3B,
+    0x00, 0xCC, 0x01, 0xAE, 0x01, 0x73, 0x06, 0x06, 0x02, 0x7E, 0x08, 0x00,
+    0x00, 0x01, 0x00, 0x3B, 0x00, 0xD4, 0x02, 0x3D, 0x01, 0x6E, 0x00, 0x03,
+    0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x3B, 0x02, 0x02, 0xD4, 0x9A, 0x9A,
+    0x00, 0x01, 0x00, 0x3B, 0x00, 0xD4, 0x03, 0x88, 0x01, 0x6E, 0x00, 0x03,
+    0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x3B, 0x03, 0x4D, 0xD4, 0x9A, 0x9A,
+    0xFF, 0xFF, 0x00, 0x33, 0x00, 0xD4, 0x02, 0x34, 0x01, 0x6E, 0x06, 0x06,
+    0x02, 0x80, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x33, 0x00, 0xD4, 0x03, 0x80,
+    0x01, 0x6E, 0x06, 0x06, 0x02, 0x81, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x33,
+    0x00, 0xCC, 0x01, 0xA6, 0x01, 0x73, 0x06, 0x06, 0x02, 0x7E, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x22, 0xFF, 0x31, 0x02, 0x8B, 0xFF, 0xCC, 0x00, 0x03,
+    0x00, 0x00, 0x57, 0x35, 0x21, 0x15, 0x22, 0x02, 0x69, 0xCF, 0x9B, 0x9B,
+    0xFF, 0xFF, 0x00, 0x33, 0x00, 0xF7, 0x01, 0xA6, 0x01, 0x9E, 0x06, 0x06,
+    0x02, 0x7E, 0x00, 0x2B, 0xFF, 0xFF, 0x00, 0x33, 0x00, 0xFF, 0x02, 0x34,
+    0x01, 0x99, 0x06, 0x06, 0x02, 0x80, 0xF8, 0x2B, 0xFF, 0xFF, 0x00, 0x33,
+    0x01, 0x02, 0x03, 0x80, 0x01, 0x9C, 0x06, 0x06, 0x02, 0x81, 0xF8, 0x2E,
+    0x00, 0x01, 0x00, 0x28, 0xFF, 0x46, 0x01, 0x8D, 0x02, 0xBE, 0x00, 0x0D,
+    0x00, 0x00, 0x45, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x17, 0x01, 0x22, 0x7A, 0x80, 0x81, 0x7A, 0x6A, 0x58,
+    0x53, 0x53, 0x58, 0xBA, 0x4C, 0xE4, 0x8C, 0x8B, 0xE5, 0x4C, 0x5F, 0x3C,
+    0xB9, 0x68, 0x68, 0xB9, 0x3C, 0x00, 0x00, 0x01, 0x00, 0x03, 0xFF, 0x46,
+    0x01, 0x68, 0x02, 0xBE, 0x00, 0x0D, 0x00, 0x00, 0x57, 0x27, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x27, 0x37, 0x16, 0x16, 0x15, 0x14, 0x06, 0x6D, 0x6A,
+    0x58, 0x53, 0x53, 0x58, 0x6B, 0x7A, 0x80, 0x81, 0xBA, 0x5F, 0x3C, 0xB9,
+    0x68, 0x68, 0xB9, 0x3C, 0x5F, 0x4C, 0xE4, 0x8C, 0x8B, 0xE5, 0x00, 0x01,
+    0x00, 0x25, 0xFF, 0x30, 0x01, 0x94, 0x02, 0xC4, 0x00, 0x25, 0x00, 0x00,
+    0x45, 0x2E, 0x03, 0x35, 0x37, 0x34, 0x26, 0x27, 0x23, 0x35, 0x33, 0x36,
+    0x36, 0x35, 0x27, 0x34, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x17, 0x14,
+    0x06, 0x07, 0x35, 0x16, 0x16, 0x15, 0x07, 0x14, 0x16, 0x16, 0x17, 0x01,
+    0x6A, 0x35, 0x4E, 0x34, 0x1A, 0x01, 0x28, 0x27, 0x26, 0x28, 0x27, 0x26,
+    0x01, 0x67, 0x6A, 0x2A, 0x20, 0x23, 0x0F, 0x02, 0x4F, 0x58, 0x58, 0x4F,
+    0x02, 0x0F, 0x23, 0x20, 0xD0, 0x0B, 0x21, 0x31, 0x42, 0x2A, 0x5F, 0x2E,
+    0x28, 0x01, 0x96, 0x01, 0x27, 0x2F, 0x5F, 0x52, 0x61, 0x16, 0x87, 0x0B,
+    0x13, 0x23, 0x20, 0x4E, 0x3A, 0x4F, 0x14, 0x13, 0x16, 0x4F, 0x39, 0x4E,
+    0x1D, 0x1F, 0x12, 0x0A, 0x00, 0x01, 0x00, 0x1D, 0xFF, 0x30, 0x01, 0x8D,
+    0x02, 0xC4, 0x00, 0x25, 0x00, 0x00, 0x57, 0x27, 0x3E, 0x02, 0x35, 0x27,
+    0x34, 0x36, 0x37, 0x15, 0x26, 0x26, 0x35, 0x37, 0x34, 0x26, 0x26, 0x27,
+    0x37, 0x1E, 0x03, 0x15, 0x07, 0x14, 0x16, 0x17, 0x33, 0x15, 0x23, 0x06,
+    0x06, 0x15, 0x17, 0x14, 0x06, 0x48, 0x2B, 0x20, 0x24, 0x0F, 0x02, 0x4F,
+    0x57, 0x57, 0x4F, 0x02, 0x0F, 0x24, 0x20, 0x2B, 0x34, 0x4F, 0x33, 0x1A,
+    0x01, 0x28, 0x27, 0x27, 0x29, 0x27, 0x26, 0x01, 0x66, 0xD0, 0x87, 0x0B,
+    0x13, 0x23, 0x20, 0x4E, 0x3A, 0x4F, 0x14, 0x13, 0x16, 0x4F, 0x39, 0x4E,
+    0x1E, 0x1E, 0x12, 0x0A, 0x90, 0x0A, 0x22, 0x31, 0x42, 0x2A, 0x5F, 0x2E,
+    0x28, 0x01, 0x96, 0x01, 0x27, 0x2F, 0x5F, 0x52, 0x61, 0x00, 0x00, 0x01,
+    0x00, 0x50, 0xFF, 0x42, 0x01, 0x8B, 0x02, 0xBC, 0x00, 0x09, 0x00, 0x00,
+    0x57, 0x11, 0x21, 0x15, 0x23, 0x37, 0x11, 0x27, 0x33, 0x15, 0x50, 0x01,
+    0x3B, 0x8C, 0x06, 0x0A, 0x90, 0xBE, 0x03, 0x7A, 0xA3, 0x08, 0xFD, 0xB8,
+    0x0C, 0xA3, 0x00, 0x01, 0x00, 0x20, 0xFF, 0x42, 0x01, 0x5B, 0x02, 0xBC,
+    0x00, 0x09, 0x00, 0x00, 0x57, 0x35, 0x33, 0x07, 0x11, 0x17, 0x23, 0x35,
+    0x21, 0x11, 0x20, 0x8C, 0x06, 0x0A, 0x90, 0x01, 0x3B, 0xBE, 0xA3, 0x08,
+    0x02, 0x48, 0x0C, 0xA3, 0xFC, 0x86, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x78,
+    0x01, 0x8D, 0x02, 0xF0, 0x04, 0x06, 0x02, 0x89, 0x00, 0x32, 0xFF, 0xFF,
+    0x00, 0x03, 0xFF, 0x78, 0x01, 0x68, 0x02, 0xF0, 0x04, 0x06, 0x02, 0x8A,
+    0x00, 0x32, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0x62, 0x01, 0x94, 0x02, 0xF6,
+    0x06, 0x06, 0x02, 0x8B, 0x00, 0x32, 0xFF, 0xFF, 0x00, 0x1D, 0xFF, 0x62,
+    0x01, 0x8D, 0x02, 0xF6, 0x06, 0x06, 0x02, 0x8C, 0x00, 0x32, 0xFF, 0xFF,
+    0x00, 0x50, 0xFF, 0x6A, 0x01, 0x8B, 0x02, 0xE4, 0x06, 0x06, 0x02, 0x8D,
+    0x00, 0x28, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x6A, 0x01, 0x5B, 0x02, 0xE4,
+    0x06, 0x06, 0x02, 0x8E, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x2F,
+    0x00, 0xFF, 0x00, 0x88, 0x06, 0x06, 0x02, 0x6A, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x21, 0xFF, 0x2F, 0x01, 0xE0, 0x00, 0x88, 0x04, 0x26, 0x02, 0x6A,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0x6A, 0x00, 0xE1, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0x01, 0x95, 0x01, 0xF8, 0x02, 0xEB, 0x04, 0x26, 0x02, 0x99,
+    0x00, 0xFB, 0x00, 0x07, 0x02, 0x99, 0x00, 0xF0, 0xFF, 0xFB, 0xFF, 0xFF,
+    0x00, 0x1C, 0x01, 0x98, 0x01, 0xEC, 0x02, 0xEE, 0x04, 0x26, 0x02, 0x9A,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0x9A, 0x00, 0xF1, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x28, 0x01, 0x9A, 0x01, 0x07, 0x02, 0xF0, 0x00, 0x15, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x97, 0x20, 0x32,
+    0x1D, 0x19, 0x30, 0x3F, 0x26, 0x31, 0x2B, 0x33, 0x0B, 0x11, 0x19, 0x13,
+    0x33, 0x01, 0x9A, 0x21, 0x3C, 0x26, 0x23, 0x42, 0x39, 0x2B, 0x0A, 0x3D,
+    0x11, 0x38, 0x14, 0x09, 0x15, 0x0B, 0x10, 0x23, 0x16, 0x22, 0x28, 0x00,
+    0x00, 0x01, 0x00, 0x1C, 0x01, 0x98, 0x00, 0xFC, 0x02, 0xEE, 0x00, 0x15,
+    0x00, 0x00, 0x53, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x4E,
+    0x32, 0x2B, 0x34, 0x0B, 0x11, 0x19, 0x13, 0x33, 0x27, 0x1F, 0x32, 0x1E,
+    0x1A, 0x2F, 0x40, 0x01, 0x98, 0x3D, 0x12, 0x38, 0x13, 0x0A, 0x15, 0x0A,
+    0x10, 0x23, 0x16, 0x22, 0x28, 0x21, 0x3B, 0x27, 0x22, 0x42, 0x3A, 0x2A,
+    0xFF, 0xFF, 0x00, 0x0A, 0x00, 0x10, 0x02, 0x31, 0x01, 0xF6, 0x04, 0x27,
+    0x02, 0x9D, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0x9D, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x24, 0x00, 0x13, 0x02, 0x4C, 0x01, 0xF9, 0x04, 0x27,
+    0x02, 0x9E, 0x01, 0x08, 0x00, 0x00, 0x00, 0x06, 0x02, 0x9E, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0A, 0x00, 0x10, 0x01, 0x2A, 0x01, 0xF6, 0x00, 0x07,
+    0x00, 0x00, 0x77, 0x27, 0x35, 0x37, 0x17, 0x07, 0x35, 0x17, 0xC1, 0xB7,
+    0xB7, 0x69, 0x7C, 0x7C, 0x10, 0xEA, 0x11, 0xEB, 0x48, 0xC1, 0x2C, 0xC1,
+    0x00, 0x01, 0x00, 0x24, 0x00, 0x13, 0x01, 0x44, 0x01, 0xF9, 0x00, 0x07,
+    0x00, 0x00, 0x77, 0x27, 0x37, 0x15, 0x27, 0x37, 0x17, 0x15, 0x8D, 0x69,
+    0x7C, 0x7C, 0x68, 0xB8, 0x13, 0x48, 0xC1, 0x2C, 0xC1, 0x48, 0xEA, 0x11,
+    0x00, 0x02, 0x00, 0x30, 0x01, 0xB2, 0x01, 0xE6, 0x02, 0xBC, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x41, 0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03,
+    0x01, 0x1A, 0x13, 0xB9, 0x55, 0xFE, 0x9F, 0x13, 0xB8, 0x55, 0x01, 0xB2,
+    0x01, 0x0A, 0xFE, 0xF6, 0x01, 0x0A, 0xFE, 0xF6, 0x00, 0x01, 0x00, 0x30,
+    0x01, 0xB2, 0x00, 0xFB, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x53, 0x13,
+    0x33, 0x03, 0x30, 0x13, 0xB8, 0x55, 0x01, 0xB2, 0x01, 0x0A, 0xFE, 0xF6,
+    0xFF, 0xFF, 0x00, 0x0A, 0x00, 0x5A, 0x02, 0x31, 0x02, 0x40, 0x04, 0x27,
+    0x02, 0x9D, 0x01, 0x07, 0x00, 0x4A, 0x00, 0x06, 0x02, 0x9D, 0x00, 0x4A,
+    0xFF, 0xFF, 0x00, 0x24, 0x00, 0x5D, 0x02, 0x4C, 0x02, 0x43, 0x04, 0x27,
+    0x02, 0x9E, 0x01, 0x08, 0x00, 0x4A, 0x00, 0x06, 0x02, 0x9E, 0x00, 0x4A,
+    0xFF, 0xFF, 0x00, 0x0A, 0x00, 0x61, 0x01, 0x2A, 0x02, 0x47, 0x06, 0x06,
+    0x02, 0x9D, 0x00, 0x51, 0xFF, 0xFF, 0x00, 0x24, 0x00, 0x64, 0x01, 0x44,
+    0x02, 0x4A, 0x06, 0x06, 0x02, 0x9E, 0x00, 0x51, 0x00, 0x02, 0xFF, 0xF8,
+    0xFF, 0xE1, 0x02, 0x44, 0x02, 0xBF, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x00,
+    0x57, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37,
+    0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x03, 0x06, 0x06, 0x03, 0x35, 0x05, 0x15, 0x76, 0x24, 0x3F,
+    0x1B, 0x41, 0x10, 0x19, 0x11, 0x0E, 0x14, 0x0E, 0x05, 0x32, 0x10, 0x73,
+    0x5E, 0x27, 0x42, 0x20, 0x41, 0x10, 0x1A, 0x0F, 0x19, 0x18, 0x05, 0x34,
+    0x12, 0x78, 0x79, 0x01, 0x8A, 0x1F, 0x0F, 0x11, 0x99, 0x08, 0x07, 0x11,
+    0x21, 0x19, 0x01, 0x2D, 0x61, 0x5B, 0x13, 0x14, 0x99, 0x0D, 0x09, 0x20,
+    0x19, 0xFE, 0xCF, 0x68, 0x62, 0x01, 0x3E, 0x96, 0x01, 0x96, 0x00, 0x02,
+    0x00, 0x28, 0xFF, 0x5E, 0x03, 0x9D, 0x02, 0xC6, 0x00, 0x50, 0x00, 0x62,
+    0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x35, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E,
+    0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x37, 0x33, 0x03, 0x06, 0x16,
+    0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E,
+    0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0x03, 0x32, 0x36, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x01, 0x9E, 0x57, 0x8B, 0x61,
+    0x33, 0x53, 0x93, 0xC3, 0x6F, 0x50, 0x80, 0x5C, 0x31, 0x27, 0x46, 0x5D,
+    0x36, 0x28, 0x3E, 0x23, 0x02, 0x1F, 0x10, 0x33, 0x43, 0x28, 0x2F, 0x4B,
+    0x2B, 0x26, 0x43, 0x59, 0x32, 0x1F, 0x31, 0x1F, 0x03, 0x21, 0x1E, 0xA4,
+    0x3F, 0x03, 0x08, 0x12, 0x0C, 0x1A, 0x2E, 0x21, 0x14, 0x41, 0x7A, 0x56,
+    0x67, 0xA4, 0x75, 0x3D, 0x27, 0x4A, 0x6E, 0x46, 0x2F, 0x44, 0x3E, 0x26,
+    0x25, 0x3B, 0x54, 0x48, 0x0D, 0x17, 0x2B, 0x20, 0x06, 0x02, 0x03, 0x0A,
+    0x16, 0x12, 0x1C, 0x2E, 0x19, 0x16, 0xA2, 0x35, 0x61, 0x88, 0x52, 0x75,
+    0xBB, 0x83, 0x45, 0x2D, 0x54, 0x73, 0x46, 0x46, 0x7D, 0x62, 0x38, 0x1A,
+    0x30, 0x1F, 0x11, 0x23, 0x12, 0x14, 0x31, 0x46, 0x24, 0x30, 0x56, 0x38,
+    0x31, 0x66, 0x56, 0x35, 0x22, 0x3C, 0x27, 0x0D, 0x85, 0xFE, 0xC0, 0x0F,
+    0x12, 0x07, 0x25, 0x42, 0x55, 0x31, 0x4C, 0x6C, 0x39, 0x39, 0x6E, 0x9D,
+    0x63, 0x45, 0x6B, 0x4C, 0x27, 0x0D, 0x1B, 0x14, 0x43, 0x1E, 0x1F, 0x0C,
+    0x01, 0x59, 0x1E, 0x34, 0x21, 0x0D, 0x15, 0x0B, 0x11, 0x19, 0x0E, 0x2A,
+    0x46, 0x29, 0x1D, 0x22, 0x00, 0x02, 0x00, 0x32, 0xFF, 0xF6, 0x03, 0x29,
+    0x02, 0xCE, 0x00, 0x20, 0x00, 0x3B, 0x00, 0x00, 0x61, 0x2F, 0x02, 0x2E,
+    0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x1F, 0x03, 0x05,
+    0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x33, 0x0E, 0x04, 0x02, 0x46,
+    0x3C, 0x51, 0x86, 0x2E, 0x39, 0x1D, 0x0B, 0x3B, 0x68, 0x45, 0x34, 0x5D,
+    0x43, 0x0E, 0x95, 0x0F, 0x21, 0x16, 0x11, 0x19, 0x0E, 0x23, 0x35, 0x37,
+    0x14, 0x2E, 0x57, 0xA6, 0xFE, 0x27, 0x52, 0x81, 0x4B, 0x54, 0x53, 0x73,
+    0x33, 0x37, 0x1E, 0x37, 0x28, 0x25, 0x43, 0x34, 0x20, 0x04, 0xAF, 0x08,
+    0x2E, 0x46, 0x5A, 0x6B, 0x3D, 0x49, 0x8C, 0x2F, 0x4A, 0x3C, 0x32, 0x15,
+    0x37, 0x57, 0x32, 0x21, 0x3C, 0x28, 0x57, 0x27, 0x18, 0x0B, 0x17, 0x10,
+    0x13, 0x37, 0x3E, 0x38, 0x14, 0x30, 0x4D, 0xAE, 0x0A, 0x3C, 0x69, 0x42,
+    0x46, 0x75, 0x1E, 0x6A, 0x0C, 0x33, 0x26, 0x1E, 0x2B, 0x17, 0x20, 0x39,
+    0x51, 0x31, 0x41, 0x70, 0x5A, 0x40, 0x21, 0x00, 0x00, 0x01, 0x00, 0x29,
+    0x00, 0x00, 0x02, 0xBF, 0x02, 0xBC, 0x00, 0x13, 0x00, 0x00, 0x73, 0x11,
+    0x17, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x11,
+    0x23, 0x11, 0x17, 0x23, 0x37, 0x11, 0xF8, 0x39, 0x4C, 0x36, 0x55, 0x31,
+    0x38, 0x65, 0x44, 0x01, 0xB5, 0xBF, 0x42, 0xE9, 0x5E, 0x01, 0x3A, 0x2B,
+    0x37, 0x5F, 0x3D, 0x42, 0x62, 0x36, 0xFD, 0x44, 0x02, 0x94, 0x40, 0x38,
+    0xFD, 0x74, 0x00, 0x02, 0x00, 0x1A, 0xFF, 0x6E, 0x02, 0x29, 0x02, 0xCE,
+    0x00, 0x2A, 0x00, 0x52, 0x00, 0x00, 0x65, 0x27, 0x3E, 0x02, 0x35, 0x34,
+    0x26, 0x27, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x17, 0x17, 0x16, 0x16, 0x15, 0x0E, 0x02, 0x03, 0x22, 0x26, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14,
+    0x16, 0x17, 0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x01, 0x68, 0x35,
+    0x18, 0x1F, 0x10, 0x1A, 0x1C, 0x41, 0x29, 0x44, 0x31, 0x1B, 0x1B, 0x3A,
+    0x5B, 0x40, 0x35, 0x5A, 0x46, 0x18, 0x5F, 0x1D, 0x33, 0x2C, 0x12, 0x1F,
+    0x1F, 0x16, 0x24, 0x14, 0x52, 0x47, 0x46, 0x01, 0x2E, 0x55, 0x98, 0x35,
+    0x5D, 0x49, 0x18, 0x5D, 0x2E, 0x4B, 0x1C, 0x21, 0x1F, 0x1B, 0x29, 0x18,
+    0x48, 0x46, 0x45, 0x2D, 0x55, 0x3C, 0x35, 0x16, 0x1E, 0x0E, 0x1B, 0x1D,
+    0x3B, 0x3B, 0x54, 0x2E, 0x31, 0x6A, 0x86, 0x58, 0x03, 0x0E, 0x16, 0x0D,
+    0x11, 0x15, 0x0C, 0x1A, 0x12, 0x27, 0x2E, 0x3C, 0x27, 0x21, 0x3C, 0x2F,
+    0x1A, 0x17, 0x29, 0x1B, 0x65, 0x19, 0x1A, 0x0A, 0x16, 0x11, 0x10, 0x15,
+    0x11, 0x09, 0x21, 0x1E, 0x50, 0x38, 0x29, 0x41, 0x29, 0xFE, 0xE3, 0x18,
+    0x2B, 0x1A, 0x67, 0x26, 0x1B, 0x15, 0x15, 0x0E, 0x16, 0x13, 0x0A, 0x1C,
+    0x1D, 0x51, 0x37, 0x29, 0x41, 0x2B, 0x04, 0x5A, 0x02, 0x0E, 0x15, 0x0E,
+    0x11, 0x17, 0x0C, 0x17, 0x19, 0x32, 0x43, 0x32, 0x30, 0x50, 0x30, 0x00,
+    0x00, 0x03, 0x00, 0x16, 0xFF, 0xE8, 0x03, 0x01, 0x02, 0xD4, 0x00, 0x13,
+    0x00, 0x32, 0x00, 0x46, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E,
+    0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x07, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x01, 0x8B, 0x4E, 0x87,
+    0x67, 0x39, 0x39, 0x67, 0x87, 0x4E, 0x4E, 0x87, 0x68, 0x39, 0x39, 0x68,
+    0x87, 0x3F, 0x3B, 0x5F, 0x39, 0x39, 0x5F, 0x3B, 0x25, 0x44, 0x21, 0x36,
+    0x0C, 0x18, 0x15, 0x09, 0x15, 0x1E, 0x12, 0x12, 0x1E, 0x15, 0x0E, 0x24,
+    0x12, 0x38, 0x20, 0x48, 0x35, 0x3F, 0x6D, 0x52, 0x2E, 0x2E, 0x52, 0x6D,
+    0x3F, 0x3E, 0x6D, 0x52, 0x2E, 0x2E, 0x52, 0x6D, 0x18, 0x3A, 0x66, 0x88,
+    0x4E, 0x4E, 0x88, 0x66, 0x3A, 0x3A, 0x66, 0x88, 0x4E, 0x4E, 0x88, 0x66,
+    0x3A, 0xA8, 0x36, 0x5C, 0x3B, 0x39, 0x5F, 0x38, 0x19, 0x19, 0x76, 0x09,
+    0x0B, 0x05, 0x12, 0x1C, 0x13, 0x13, 0x1D, 0x11, 0x0A, 0x0E, 0x78, 0x16,
+    0x16, 0x5E, 0x2F, 0x52, 0x6D, 0x3E, 0x3E, 0x6E, 0x51, 0x2F, 0x2F, 0x51,
+    0x6E, 0x3E, 0x3E, 0x6D, 0x52, 0x2F, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0xE2,
+    0x02, 0x02, 0x02, 0xE6, 0x00, 0x12, 0x00, 0x22, 0x00, 0x26, 0x00, 0x32,
+    0x00, 0x3D, 0x00, 0x00, 0x65, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x37, 0x27, 0x37, 0x17, 0x23, 0x35, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x23, 0x23, 0x37, 0x15, 0x35, 0x27, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+    0x23, 0x23, 0x37, 0x01, 0x04, 0x49, 0x78, 0x46, 0x29, 0x48, 0x5F, 0x37,
+    0x34, 0x5C, 0x46, 0x28, 0x28, 0x46, 0x5B, 0x35, 0x34, 0x56, 0x34, 0x34,
+    0x56, 0x34, 0x37, 0x5B, 0x36, 0x36, 0x5B, 0x59, 0x25, 0x4A, 0x3C, 0xEE,
+    0x7F, 0x28, 0x32, 0x35, 0x25, 0x31, 0x0C, 0x0C, 0x1D, 0x09, 0x0D, 0x0B,
+    0x09, 0x1F, 0x0C, 0xE2, 0x45, 0x75, 0x48, 0x36, 0x5E, 0x46, 0x28, 0x28,
+    0x47, 0x5D, 0x36, 0x36, 0x5E, 0x46, 0x28, 0x40, 0x34, 0x58, 0x36, 0x36,
+    0x58, 0x35, 0x35, 0x58, 0x36, 0x37, 0x58, 0x33, 0x4D, 0x53, 0x13, 0x66,
+    0xEF, 0x2B, 0x23, 0x23, 0x2C, 0x0D, 0x5F, 0x80, 0x07, 0x0A, 0x09, 0x09,
+    0x09, 0x08, 0x00, 0x03, 0x00, 0x26, 0x01, 0x43, 0x03, 0x67, 0x02, 0xBC,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x41, 0x11, 0x33, 0x17,
+    0x23, 0x37, 0x33, 0x11, 0x23, 0x13, 0x37, 0x07, 0x23, 0x27, 0x17, 0x13,
+    0x21, 0x11, 0x33, 0x11, 0x27, 0x35, 0x21, 0x15, 0x01, 0x8D, 0x90, 0x7A,
+    0x38, 0x7A, 0x8E, 0x8C, 0x09, 0x4C, 0x95, 0x42, 0x9B, 0x53, 0x0A, 0xFE,
+    0x5C, 0x91, 0xE2, 0x01, 0x34, 0x01, 0x43, 0x01, 0x79, 0xBE, 0xBE, 0xFE,
+    0x87, 0x01, 0x0D, 0x2B, 0xF2, 0xFA, 0x32, 0xFE, 0xF2, 0x01, 0x61, 0xFE,
+    0x9F, 0xFD, 0x7C, 0x7C, 0x00, 0x02, 0x00, 0x5D, 0x01, 0x87, 0x01, 0xB7,
+    0x02, 0xCD, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x0A, 0x30, 0x4F, 0x2E, 0x2E, 0x4D, 0x32,
+    0x32, 0x4D, 0x2E, 0x2E, 0x4F, 0x30, 0x0E, 0x17, 0x0E, 0x0E, 0x16, 0x0F,
+    0x0F, 0x17, 0x0D, 0x0E, 0x17, 0x01, 0x87, 0x2B, 0x4A, 0x2D, 0x2E, 0x4B,
+    0x2B, 0x2B, 0x4B, 0x2D, 0x2D, 0x4B, 0x2B, 0x6C, 0x0F, 0x19, 0x0F, 0x0F,
+    0x19, 0x0E, 0x0F, 0x19, 0x0F, 0x0F, 0x19, 0x0E, 0xFF, 0xFF, 0x00, 0x30,
+    0x01, 0xB2, 0x01, 0xE6, 0x02, 0xBC, 0x06, 0x06, 0x02, 0x9F, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x5A, 0xFF, 0x3F, 0x01, 0x0B, 0x02, 0xE4, 0x00, 0x03,
+    0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x5A, 0xB1, 0xC1, 0x03, 0xA5, 0xFC,
+    0x5B, 0x00, 0x00, 0x02, 0x00, 0x5B, 0xFF, 0x36, 0x01, 0x0F, 0x02, 0xE4,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x03, 0x11,
+    0x33, 0x11, 0x5B, 0xB4, 0xB4, 0xB4, 0xCA, 0x01, 0x88, 0xFE, 0x78, 0x02,
+    0x27, 0x01, 0x87, 0xFE, 0x79, 0x00, 0x00, 0x02, 0x00, 0x25, 0x00, 0xC7,
+    0x01, 0x93, 0x02, 0xD1, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x77, 0x11,
+    0x33, 0x11, 0x25, 0x35, 0x21, 0x15, 0x81, 0xB6, 0xFE, 0xEE, 0x01, 0x6E,
+    0xC7, 0x02, 0x0A, 0xFD, 0xF6, 0xE1, 0x9B, 0x9B, 0x00, 0x01, 0x00, 0x0D,
+    0xFF, 0xF6, 0x02, 0x32, 0x02, 0xF3, 0x00, 0x38, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x07, 0x0E, 0x02, 0x07, 0x27, 0x36, 0x36, 0x37,
+    0x3E, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x0E, 0x03,
+    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x01, 0x3C, 0x42, 0x64, 0x38, 0x0C, 0x17, 0x0E, 0x1C, 0x53, 0x68, 0x39,
+    0x43, 0x50, 0x26, 0x47, 0x33, 0x2D, 0x6D, 0x7D, 0x44, 0x2A, 0x57, 0x9A,
+    0x38, 0x23, 0x37, 0x26, 0x14, 0x10, 0x10, 0x09, 0x10, 0x10, 0x0D, 0x07,
+    0x0C, 0x1B, 0x19, 0x10, 0x11, 0x1F, 0x15, 0x0E, 0x18, 0x18, 0x0C, 0x42,
+    0x26, 0x5E, 0x0A, 0x4D, 0x89, 0x57, 0x2B, 0x5C, 0x5B, 0x27, 0x45, 0x58,
+    0x2A, 0x4E, 0x3E, 0x30, 0x6E, 0x73, 0x36, 0x30, 0x55, 0x4B, 0x21, 0x4E,
+    0x2A, 0x5C, 0x3E, 0x26, 0x4B, 0x4B, 0x45, 0x1E, 0x19, 0x1F, 0x09, 0x11,
+    0x1A, 0x12, 0x1B, 0x52, 0x5C, 0x59, 0x22, 0x1F, 0x2F, 0x1B, 0x09, 0x12,
+    0x0B, 0x95, 0x21, 0x1F, 0x00, 0x03, 0x00, 0x25, 0x00, 0xA5, 0x01, 0x8D,
+    0x02, 0xD4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x11,
+    0x33, 0x11, 0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x7E, 0xB7,
+    0xFE, 0xF0, 0x01, 0x68, 0xFE, 0x98, 0x01, 0x68, 0xA5, 0x02, 0x2F, 0xFD,
+    0xD1, 0x8C, 0x8B, 0x8B, 0xBE, 0x8B, 0x8B, 0x00, 0x00, 0x02, 0x00, 0x41,
+    0xFF, 0xF5, 0x02, 0x94, 0x02, 0x45, 0x00, 0x24, 0x00, 0x32, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x16, 0x06, 0x23, 0x21, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06,
+    0x03, 0x27, 0x21, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x01, 0x77, 0x5B, 0x8C, 0x4F, 0x4C, 0x88, 0x59, 0x53, 0x80, 0x4D,
+    0x05, 0x01, 0x0D, 0x0A, 0xFE, 0x6D, 0x0D, 0x18, 0x28, 0x30, 0x18, 0x45,
+    0x65, 0x24, 0x07, 0x0A, 0x09, 0x0D, 0x03, 0x03, 0x30, 0x73, 0xD4, 0x11,
+    0x01, 0x14, 0x12, 0x0F, 0x1E, 0x2D, 0x1F, 0x29, 0x36, 0x19, 0x0B, 0x4D,
+    0x86, 0x55, 0x56, 0x86, 0x4C, 0x44, 0x7B, 0x51, 0x0A, 0x0E, 0x07, 0xAC,
+    0x16, 0x22, 0x18, 0x0C, 0x34, 0x3B, 0x0B, 0x0B, 0x09, 0x03, 0x08, 0x04,
+    0x46, 0x38, 0x01, 0x45, 0x0A, 0x09, 0x74, 0x16, 0x27, 0x20, 0x13, 0x20,
+    0x32, 0x1E, 0x00, 0x04, 0x00, 0x53, 0x00, 0x00, 0x04, 0xB8, 0x02, 0xC9,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x23, 0x00, 0x3B, 0x00, 0x00, 0x41, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x35, 0x21, 0x15, 0x03, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x11,
+    0x33, 0x01, 0x27, 0x2E, 0x03, 0x34, 0x35, 0x35, 0x33, 0x11, 0x23, 0x01,
+    0x17, 0x1E, 0x04, 0x15, 0x15, 0x03, 0xF1, 0x39, 0x58, 0x33, 0x34, 0x58,
+    0x38, 0x38, 0x5A, 0x35, 0x34, 0x5A, 0xF5, 0x01, 0x7E, 0xC2, 0x11, 0x18,
+    0x0E, 0x0E, 0x18, 0x11, 0x10, 0x17, 0x0E, 0x0E, 0x17, 0xFC, 0x72, 0xB1,
+    0x01, 0x54, 0x29, 0x05, 0x07, 0x05, 0x03, 0xBF, 0xB3, 0xFE, 0x92, 0x45,
+    0x05, 0x07, 0x04, 0x03, 0x01, 0x01, 0x39, 0x34, 0x59, 0x39, 0x3A, 0x5B,
+    0x35, 0x36, 0x5B, 0x39, 0x38, 0x5A, 0x34, 0xC0, 0x90, 0x90, 0x01, 0x48,
+    0x10, 0x1C, 0x12, 0x14, 0x1D, 0x11, 0x11, 0x1D, 0x14, 0x13, 0x1B, 0x10,
+    0xFE, 0x3F, 0x02, 0xBC, 0xFE, 0x2E, 0x0A, 0x25, 0x3C, 0x36, 0x36, 0x40,
+    0x28, 0x93, 0xFD, 0x44, 0x01, 0xF4, 0x11, 0x29, 0x3C, 0x30, 0x2C, 0x32,
+    0x20, 0xD0, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xC2, 0x03, 0x9D, 0x03, 0x2A,
+    0x06, 0x06, 0x02, 0xA6, 0x00, 0x64, 0x00, 0x02, 0x00, 0x29, 0xFF, 0x9F,
+    0x02, 0xAD, 0x03, 0x22, 0x00, 0x0B, 0x00, 0x31, 0x00, 0x00, 0x45, 0x35,
+    0x37, 0x11, 0x27, 0x35, 0x33, 0x15, 0x07, 0x11, 0x17, 0x15, 0x27, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x58, 0x20, 0x20, 0x84, 0x1A,
+    0x1A, 0x3B, 0x52, 0x8A, 0x65, 0x37, 0x39, 0x66, 0x8C, 0x53, 0x32, 0x5F,
+    0x54, 0x21, 0x77, 0x11, 0x2A, 0x35, 0x20, 0x25, 0x41, 0x30, 0x1B, 0x1B,
+    0x33, 0x47, 0x2C, 0x1F, 0x37, 0x2E, 0x12, 0x5E, 0x19, 0x55, 0x67, 0x61,
+    0x6B, 0x29, 0x02, 0x52, 0x35, 0x68, 0x68, 0x34, 0xFD, 0xAB, 0x28, 0x6A,
+    0x57, 0x36, 0x61, 0x85, 0x50, 0x4F, 0x85, 0x62, 0x36, 0x19, 0x30, 0x24,
+    0x8A, 0x13, 0x1E, 0x11, 0x19, 0x30, 0x44, 0x2C, 0x2A, 0x43, 0x2F, 0x1A,
+    0x12, 0x1E, 0x12, 0x95, 0x1C, 0x2C, 0x19, 0x00, 0x00, 0x02, 0x00, 0x30,
+    0x00, 0x00, 0x02, 0x32, 0x02, 0xC4, 0x00, 0x1F, 0x00, 0x2B, 0x00, 0x00,
+    0x65, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x35, 0x37, 0x11, 0x27,
+    0x35, 0x33, 0x15, 0x07, 0x11, 0x17, 0x15, 0x01, 0x4D, 0x52, 0x80, 0x4B,
+    0x4B, 0x80, 0x52, 0x48, 0x79, 0x24, 0x65, 0x0C, 0x21, 0x29, 0x19, 0x24,
+    0x35, 0x1E, 0x1E, 0x34, 0x25, 0x19, 0x29, 0x21, 0x0C, 0x65, 0x25, 0x79,
+    0x80, 0x23, 0x23, 0x83, 0x1D, 0x1D, 0x4E, 0x48, 0x7D, 0x50, 0x50, 0x7D,
+    0x48, 0x2E, 0x2B, 0x78, 0x0E, 0x17, 0x0D, 0x1E, 0x35, 0x22, 0x22, 0x34,
+    0x20, 0x0C, 0x16, 0x0F, 0x79, 0x2A, 0x2E, 0x4E, 0x6C, 0x26, 0x01, 0x96,
+    0x36, 0x66, 0x67, 0x33, 0xFE, 0x66, 0x25, 0x6B, 0x00, 0x03, 0x00, 0x29,
+    0xFF, 0xAD, 0x02, 0xAD, 0x03, 0x1D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x2D,
+    0x00, 0x00, 0x57, 0x27, 0x01, 0x17, 0x03, 0x27, 0x01, 0x17, 0x03, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xE4, 0x36, 0x01, 0x45, 0x35, 0xFA,
+    0x36, 0x01, 0x3B, 0x35, 0xC7, 0x52, 0x8A, 0x65, 0x37, 0x39, 0x66, 0x8C,
+    0x53, 0x32, 0x5F, 0x54, 0x21, 0x77, 0x11, 0x2A, 0x35, 0x20, 0x25, 0x41,
+    0x30, 0x1B, 0x1B, 0x33, 0x47, 0x2C, 0x1F, 0x37, 0x2E, 0x12, 0x5E, 0x19,
+    0x55, 0x67, 0x53, 0x16, 0x03, 0x5A, 0x16, 0xFC, 0xAB, 0x17, 0x03, 0x3F,
+    0x17, 0xFD, 0x05, 0x36, 0x61, 0x85, 0x50, 0x4F, 0x85, 0x62, 0x36, 0x19,
+    0x30, 0x24, 0x8A, 0x13, 0x1E, 0x11, 0x19, 0x30, 0x44, 0x2C, 0x2A, 0x43,
+    0x2F, 0x1A, 0x12, 0x1E, 0x12, 0x95, 0x1C, 0x2C, 0x19, 0x00, 0x00, 0x06,
+    0x00, 0x12, 0x00, 0x32, 0x02, 0x26, 0x02, 0x36, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x65, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x27, 0x37, 0x17, 0x27, 0x27, 0x37, 0x17, 0x17, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x17, 0x27, 0x37, 0x17, 0x27, 0x27, 0x37, 0x17, 0x01, 0x1B,
+    0x40, 0x65, 0x39, 0x39, 0x65, 0x40, 0x40, 0x63, 0x3A, 0x3A, 0x63, 0xD8,
+    0x6F, 0x54, 0x6E, 0x76, 0x4E, 0x70, 0x51, 0x48, 0x14, 0x1F, 0x10, 0x10,
+    0x1F, 0x14, 0x14, 0x1F, 0x12, 0x12, 0x1F, 0xAF, 0x53, 0x6D, 0x56, 0x5B,
+    0x70, 0x5B, 0x70, 0x68, 0x34, 0x5C, 0x3B, 0x3B, 0x5C, 0x34, 0x34, 0x5C,
+    0x3B, 0x3B, 0x5C, 0x34, 0x36, 0x71, 0x55, 0x73, 0xF3, 0x4D, 0x6F, 0x50,
+    0xF9, 0x12, 0x21, 0x15, 0x16, 0x21, 0x12, 0x12, 0x21, 0x16, 0x15, 0x21,
+    0x12, 0xB7, 0x52, 0x72, 0x54, 0xC6, 0x6F, 0x5D, 0x70, 0x00, 0x00, 0x03,
+    0x00, 0x12, 0xFF, 0xA5, 0x02, 0x5D, 0x03, 0x16, 0x00, 0x32, 0x00, 0x36,
+    0x00, 0x3A, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x27, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06,
+    0x07, 0x13, 0x17, 0x13, 0x13, 0x27, 0x03, 0x33, 0x01, 0x43, 0x68, 0x95,
+    0x34, 0x54, 0x3A, 0x72, 0x37, 0x16, 0x24, 0x13, 0x10, 0x1C, 0x22, 0x22,
+    0x10, 0x4F, 0x68, 0x34, 0x2E, 0x4C, 0x63, 0x36, 0x57, 0x8B, 0x3D, 0x46,
+    0x2D, 0x6C, 0x38, 0x19, 0x25, 0x14, 0x16, 0x22, 0x27, 0x10, 0x37, 0x5B,
+    0x44, 0x24, 0x4B, 0x7F, 0x8D, 0x11, 0x49, 0x10, 0x02, 0x49, 0x10, 0x6A,
+    0x0A, 0x3A, 0x35, 0x96, 0x35, 0x2C, 0x09, 0x15, 0x10, 0x0E, 0x14, 0x0F,
+    0x0C, 0x07, 0x04, 0x12, 0x3B, 0x57, 0x3D, 0x31, 0x52, 0x3B, 0x1F, 0x2E,
+    0x35, 0x89, 0x25, 0x22, 0x0A, 0x13, 0x10, 0x0E, 0x15, 0x0E, 0x09, 0x03,
+    0x0B, 0x23, 0x35, 0x4C, 0x33, 0x4B, 0x67, 0x35, 0x51, 0x01, 0xD7, 0x21,
+    0xFE, 0x4A, 0x01, 0xB4, 0x21, 0x01, 0x9C, 0x00, 0x00, 0x04, 0x00, 0x28,
+    0xFF, 0xEF, 0x02, 0x15, 0x02, 0xC8, 0x00, 0x16, 0x00, 0x1A, 0x00, 0x2A,
+    0x00, 0x2E, 0x00, 0x00, 0x77, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x17, 0x27, 0x11, 0x33, 0x11, 0x23, 0x35, 0x17,
+    0x14, 0x06, 0x06, 0x07, 0x35, 0x21, 0x15, 0x03, 0x32, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x03,
+    0x35, 0x21, 0x15, 0xD0, 0x2D, 0x4C, 0x2F, 0x2F, 0x4D, 0x30, 0x21, 0x35,
+    0x25, 0x07, 0x27, 0xA4, 0xA4, 0x29, 0x26, 0x3F, 0xC2, 0x01, 0xB7, 0xE6,
+    0x0E, 0x17, 0x0D, 0x0D, 0x17, 0x0E, 0x0F, 0x18, 0x0C, 0x0C, 0x18, 0x17,
+    0x01, 0x39, 0x92, 0x32, 0x53, 0x32, 0x2F, 0x4C, 0x2D, 0x19, 0x2E, 0x20,
+    0x0A, 0x01, 0x34, 0xFD, 0xD4, 0x6E, 0x0C, 0x19, 0x31, 0x22, 0xA3, 0x71,
+    0x71, 0x01, 0x23, 0x0F, 0x19, 0x0F, 0x11, 0x1A, 0x0F, 0x0F, 0x19, 0x12,
+    0x10, 0x19, 0x0E, 0x01, 0x0B, 0x66, 0x66, 0x00, 0x00, 0x03, 0x00, 0x13,
+    0xFF, 0xF6, 0x02, 0x9C, 0x02, 0xCE, 0x00, 0x24, 0x00, 0x28, 0x00, 0x2C,
+    0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x35,
+    0x05, 0x15, 0x25, 0x35, 0x21, 0x15, 0x01, 0xD6, 0x52, 0x8B, 0x66, 0x38,
+    0x38, 0x66, 0x8B, 0x52, 0x25, 0x43, 0x3F, 0x1F, 0x5F, 0x21, 0x37, 0x20,
+    0x23, 0x3C, 0x2B, 0x18, 0x18, 0x2B, 0x3B, 0x24, 0x17, 0x27, 0x25, 0x16,
+    0x59, 0x20, 0x3E, 0x41, 0xFE, 0x1B, 0x01, 0xE1, 0xFE, 0x1F, 0x01, 0xE1,
+    0x0A, 0x36, 0x61, 0x86, 0x4F, 0x50, 0x84, 0x62, 0x36, 0x0B, 0x18, 0x15,
+    0x9C, 0x18, 0x0D, 0x1C, 0x32, 0x46, 0x29, 0x2A, 0x45, 0x33, 0x1C, 0x06,
+    0x10, 0x10, 0x9F, 0x14, 0x17, 0x0A, 0x01, 0x0F, 0x42, 0x01, 0x41, 0x77,
+    0x41, 0x42, 0x00, 0x04, 0x00, 0x1D, 0x00, 0x00, 0x02, 0x42, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x77, 0x35,
+    0x21, 0x15, 0x05, 0x11, 0x33, 0x11, 0x27, 0x35, 0x21, 0x15, 0x01, 0x35,
+    0x21, 0x15, 0x1D, 0x01, 0x60, 0xFE, 0xD6, 0xC6, 0x68, 0x01, 0x6A, 0xFE,
+    0x96, 0x01, 0x91, 0x42, 0x84, 0x84, 0x42, 0x02, 0xBC, 0xFD, 0x44, 0xFF,
+    0x9F, 0x9F, 0x01, 0x12, 0xAB, 0xAB, 0x00, 0x02, 0x00, 0x29, 0xFF, 0x79,
+    0x02, 0xEC, 0x03, 0x1E, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x3E, 0x02, 0x35, 0x35, 0x17, 0x23, 0x35, 0x21, 0x1E, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x07, 0x11, 0x33, 0x11, 0x01, 0x9D, 0x57, 0x8A, 0x61, 0x32,
+    0x37, 0x68, 0x8D, 0x56, 0x3B, 0x69, 0x54, 0x1E, 0x76, 0x16, 0x31, 0x39,
+    0x23, 0x27, 0x41, 0x30, 0x1B, 0x1C, 0x32, 0x45, 0x28, 0x1C, 0x30, 0x23,
+    0x14, 0x43, 0xE1, 0x01, 0x52, 0x01, 0x03, 0x01, 0x32, 0x5A, 0x7A, 0x73,
+    0x43, 0x0A, 0x36, 0x62, 0x86, 0x4E, 0x4F, 0x85, 0x62, 0x36, 0x1E, 0x34,
+    0x20, 0x7E, 0x15, 0x1E, 0x12, 0x1D, 0x33, 0x47, 0x2A, 0x29, 0x47, 0x34,
+    0x1D, 0x12, 0x1F, 0x2B, 0x19, 0x1C, 0x2A, 0x90, 0x0B, 0x2D, 0x2C, 0x09,
+    0x43, 0x72, 0x52, 0x2E, 0x7D, 0x03, 0xA5, 0xFC, 0x5B, 0x00, 0x00, 0x05,
+    0x00, 0x1E, 0x00, 0x00, 0x03, 0x0C, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x77, 0x27, 0x01, 0x33,
+    0x01, 0x35, 0x33, 0x07, 0x03, 0x11, 0x33, 0x11, 0x33, 0x01, 0x37, 0x01,
+    0x01, 0x35, 0x21, 0x15, 0xFA, 0x3A, 0x01, 0x52, 0xE1, 0xFD, 0x2B, 0xB5,
+    0x04, 0x61, 0xC6, 0xF5, 0xFF, 0x00, 0x82, 0x01, 0x61, 0xFE, 0x75, 0x01,
+    0x29, 0xD2, 0x99, 0x01, 0x51, 0xFE, 0xA0, 0x42, 0x42, 0xFE, 0xA4, 0x02,
+    0xBC, 0xFD, 0x44, 0x01, 0x58, 0x70, 0xFE, 0x38, 0x01, 0x5C, 0x42, 0x42,
+    0x00, 0x04, 0x00, 0x11, 0xFF, 0xEB, 0x02, 0x78, 0x02, 0xCE, 0x00, 0x24,
+    0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x00, 0x77, 0x27, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x27, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x17, 0x22, 0x26, 0x27, 0x2E,
+    0x02, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x25, 0x35,
+    0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0xB2, 0x4B, 0x1A, 0x23, 0x0C, 0x14,
+    0x0C, 0x0C, 0x05, 0x3E, 0x71, 0x4C, 0x49, 0x6B, 0x1A, 0x8E, 0x08, 0x13,
+    0x19, 0x0E, 0x17, 0x25, 0x16, 0x0F, 0x09, 0x0C, 0x0F, 0x1B, 0x3F, 0xDB,
+    0x1F, 0x43, 0x1E, 0x0D, 0x24, 0x24, 0x0E, 0x15, 0x2F, 0x32, 0x1A, 0x3E,
+    0x28, 0x71, 0x42, 0x13, 0x2D, 0x2B, 0x15, 0x30, 0x16, 0x1F, 0x3E, 0x20,
+    0x49, 0x23, 0x5F, 0xFE, 0x39, 0x01, 0xC5, 0xFE, 0x3B, 0x01, 0xC5, 0x35,
+    0x15, 0x0E, 0x46, 0x2B, 0x1C, 0x3F, 0x3C, 0x25, 0x30, 0x22, 0x10, 0x46,
+    0x68, 0x39, 0x31, 0x2C, 0x70, 0x0E, 0x10, 0x07, 0x14, 0x25, 0x18, 0x1F,
+    0x38, 0x1D, 0x25, 0x40, 0x15, 0x1F, 0x38, 0x3A, 0x6B, 0x10, 0x09, 0x04,
+    0x0A, 0x08, 0x0B, 0x12, 0x0B, 0x78, 0x1B, 0x27, 0x0A, 0x0F, 0x07, 0x0F,
+    0x10, 0x13, 0x73, 0x1F, 0x23, 0xF9, 0x40, 0x40, 0x76, 0x40, 0x40, 0x00,
+    0x00, 0x03, 0x00, 0x0E, 0xFF, 0xF6, 0x02, 0x78, 0x02, 0xBC, 0x00, 0x11,
+    0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x11, 0x33,
+    0x11, 0x27, 0x32, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x03, 0x25, 0x27, 0x25,
+    0x17, 0x05, 0x27, 0x25, 0x17, 0x01, 0x21, 0x34, 0x57, 0x24, 0xB7, 0x11,
+    0x24, 0x3B, 0x2F, 0x26, 0x0F, 0x9D, 0x1A, 0x49, 0x59, 0x65, 0xFE, 0xDA,
+    0x20, 0x01, 0xA9, 0x20, 0xFE, 0x53, 0x1F, 0x01, 0xA9, 0x20, 0x0A, 0x10,
+    0x0B, 0x02, 0xAB, 0xFD, 0xBB, 0x14, 0x0D, 0x1E, 0x30, 0x21, 0x30, 0x3C,
+    0x56, 0x36, 0x19, 0xA4, 0x35, 0xF0, 0x35, 0x4A, 0x36, 0xF0, 0x36, 0x00,
+    0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x02, 0xB9, 0x03, 0x31, 0x00, 0x15,
+    0x00, 0x19, 0x00, 0x00, 0x73, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x11, 0x37, 0x11, 0x33, 0x11, 0x53, 0x4F, 0x8B, 0x59, 0x59, 0x8B,
+    0x4F, 0xC8, 0x1C, 0x31, 0x1E, 0x21, 0x32, 0x1D, 0x4D, 0x42, 0x01, 0xAF,
+    0x50, 0x7C, 0x47, 0x47, 0x7C, 0x50, 0xFE, 0x51, 0x01, 0xA6, 0x21, 0x33,
+    0x1E, 0x1E, 0x33, 0x21, 0xFE, 0x5A, 0x84, 0x02, 0xAD, 0xFD, 0x53, 0x00,
+    0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x03, 0x5E, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x23, 0x00, 0x00, 0x53, 0x35, 0x33, 0x17, 0x21, 0x37, 0x33, 0x15,
+    0x23, 0x27, 0x21, 0x07, 0x03, 0x11, 0x33, 0x01, 0x27, 0x2E, 0x03, 0x34,
+    0x35, 0x35, 0x33, 0x11, 0x23, 0x01, 0x17, 0x1E, 0x04, 0x15, 0x15, 0x12,
+    0x80, 0x22, 0x02, 0x0A, 0x2A, 0x76, 0x7B, 0x29, 0xFD, 0xF4, 0x1E, 0x15,
+    0xB1, 0x01, 0x54, 0x29, 0x05, 0x07, 0x05, 0x03, 0xBF, 0xB3, 0xFE, 0x92,
+    0x45, 0x05, 0x07, 0x04, 0x03, 0x01, 0x01, 0x33, 0x45, 0x0D, 0x0D, 0x45,
+    0x1A, 0x1A, 0xFE, 0xCD, 0x02, 0xBC, 0xFE, 0x2E, 0x0A, 0x25, 0x3C, 0x36,
+    0x36, 0x40, 0x28, 0x93, 0xFD, 0x44, 0x01, 0xF4, 0x11, 0x29, 0x3C, 0x30,
+    0x2C, 0x32, 0x20, 0xD0, 0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x02, 0xF1,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x35,
+    0x21, 0x15, 0x01, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x23, 0x15, 0x03, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x23, 0x21, 0x02, 0xD0, 0xFD, 0x8B, 0x01, 0x36, 0x45, 0x6D, 0x3F,
+    0x3F, 0x6D, 0x45, 0x70, 0x04, 0x52, 0x15, 0x20, 0x13, 0x13, 0x20, 0x15,
+    0x52, 0x01, 0xA8, 0x42, 0x42, 0xFE, 0x58, 0x02, 0xBC, 0x3D, 0x6A, 0x45,
+    0x47, 0x6F, 0x40, 0xDA, 0x01, 0x85, 0x11, 0x20, 0x17, 0x17, 0x1E, 0x0F,
+    0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x02, 0xE9, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x24, 0x00, 0x2F, 0x00, 0x00, 0x53, 0x35, 0x33, 0x17,
+    0x21, 0x37, 0x33, 0x15, 0x23, 0x27, 0x21, 0x07, 0x07, 0x35, 0x33, 0x17,
+    0x21, 0x37, 0x33, 0x15, 0x23, 0x27, 0x21, 0x07, 0x03, 0x11, 0x21, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x03, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x21, 0x62, 0x20, 0x01,
+    0x66, 0x29, 0xB7, 0xBC, 0x28, 0xFE, 0x99, 0x1D, 0x60, 0x62, 0x20, 0x01,
+    0x76, 0x29, 0xA7, 0xAA, 0x29, 0xFE, 0x88, 0x1D, 0x09, 0x01, 0x36, 0x46,
+    0x6D, 0x3E, 0x3E, 0x6D, 0x46, 0x70, 0x03, 0x52, 0x14, 0x20, 0x13, 0x13,
+    0x20, 0x14, 0x52, 0x01, 0xDA, 0x4A, 0x08, 0x08, 0x4A, 0x21, 0x21, 0x6D,
+    0x49, 0x21, 0x21, 0x49, 0x07, 0x07, 0xFE, 0x93, 0x02, 0xBC, 0x3D, 0x6A,
+    0x45, 0x47, 0x6F, 0x40, 0xDA, 0x01, 0x85, 0x11, 0x20, 0x17, 0x17, 0x1E,
+    0x0F, 0x00, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x02, 0x94, 0x02, 0xBC,
+    0x00, 0x0D, 0x00, 0x11, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x73, 0x11,
+    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x37, 0x11,
+    0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x33, 0x15, 0x37, 0x27, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0x6D, 0x01, 0x36,
+    0x46, 0x6D, 0x3E, 0x3E, 0x6D, 0x46, 0xB9, 0x49, 0xFE, 0xEE, 0x01, 0x7C,
+    0xFE, 0x84, 0xA1, 0x6E, 0x47, 0x99, 0x14, 0x20, 0x13, 0x13, 0x20, 0x14,
+    0x99, 0x47, 0x02, 0xBC, 0x3D, 0x6A, 0x45, 0x47, 0x6F, 0x40, 0x40, 0xFE,
+    0xE6, 0x67, 0x41, 0x41, 0x74, 0x62, 0x62, 0x8B, 0x1F, 0x11, 0x20, 0x17,
+    0x17, 0x1E, 0x0F, 0x52, 0x00, 0x03, 0x00, 0x1C, 0xFF, 0xF7, 0x02, 0x58,
+    0x02, 0xB3, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x00, 0x77, 0x27,
+    0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x21,
+    0x15, 0x23, 0x27, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x17, 0x03,
+    0x37, 0x13, 0x01, 0x35, 0x21, 0x15, 0xB6, 0x5D, 0x86, 0x26, 0x29, 0x13,
+    0x28, 0x1C, 0xBB, 0x02, 0x3B, 0xED, 0x4A, 0x29, 0x4B, 0x3A, 0x21, 0x24,
+    0x42, 0x5A, 0x36, 0x37, 0xD6, 0xCA, 0xEA, 0xFE, 0x8F, 0x01, 0xBB, 0xF6,
+    0x55, 0x28, 0x2D, 0x26, 0x18, 0x23, 0x13, 0x9F, 0x7E, 0x56, 0x0D, 0x1E,
+    0x2B, 0x3E, 0x2B, 0x30, 0x4D, 0x3A, 0x1F, 0xFF, 0x01, 0x54, 0x19, 0xFE,
+    0x93, 0x01, 0xAF, 0x41, 0x41, 0x00, 0x00, 0x03, 0x00, 0x11, 0xFF, 0xEB,
+    0x02, 0x7B, 0x02, 0xCE, 0x00, 0x27, 0x00, 0x42, 0x00, 0x46, 0x00, 0x00,
+    0x77, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x02, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x17, 0x22, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x01, 0x35, 0x21, 0x15, 0xB4, 0x4B, 0x14, 0x20, 0x12, 0x08,
+    0x0D, 0x0D, 0x06, 0x0C, 0x0C, 0x05, 0x40, 0x74, 0x4F, 0x49, 0x6B, 0x1A,
+    0x8E, 0x08, 0x16, 0x1B, 0x0F, 0x19, 0x26, 0x16, 0x0F, 0x0A, 0x0B, 0x0F,
+    0x1B, 0x3E, 0xE1, 0x28, 0x48, 0x16, 0x0D, 0x22, 0x26, 0x15, 0x22, 0x42,
+    0x25, 0x41, 0x2E, 0x69, 0x36, 0x20, 0x31, 0x2B, 0x15, 0x33, 0x1F, 0x14,
+    0x36, 0x1E, 0x52, 0x25, 0x63, 0xFE, 0x39, 0x01, 0xB1, 0x35, 0x15, 0x0B,
+    0x29, 0x2F, 0x15, 0x0E, 0x28, 0x2D, 0x2A, 0x11, 0x25, 0x30, 0x22, 0x10,
+    0x46, 0x68, 0x39, 0x31, 0x2C, 0x70, 0x0E, 0x10, 0x07, 0x14, 0x25, 0x18,
+    0x1F, 0x38, 0x1D, 0x25, 0x40, 0x15, 0x1F, 0x38, 0x3A, 0x6B, 0x12, 0x07,
+    0x04, 0x0A, 0x08, 0x16, 0x12, 0x85, 0x1C, 0x22, 0x0A, 0x0F, 0x07, 0x0F,
+    0x11, 0x12, 0x7C, 0x21, 0x21, 0x01, 0x3C, 0x61, 0x61, 0x00, 0x00, 0x02,
+    0xFF, 0xFF, 0x00, 0x00, 0x03, 0xF7, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x2E,
+    0x00, 0x00, 0x43, 0x35, 0x33, 0x17, 0x21, 0x37, 0x33, 0x15, 0x23, 0x27,
+    0x21, 0x07, 0x13, 0x03, 0x33, 0x13, 0x1E, 0x03, 0x17, 0x23, 0x3E, 0x02,
+    0x37, 0x13, 0x33, 0x13, 0x1E, 0x02, 0x17, 0x07, 0x3E, 0x04, 0x37, 0x13,
+    0x33, 0x03, 0x23, 0x03, 0x33, 0x03, 0x01, 0xAD, 0x22, 0x02, 0x3C, 0x29,
+    0xC4, 0xE5, 0x2B, 0xFE, 0x00, 0x21, 0x04, 0xCB, 0xC7, 0x5B, 0x08, 0x0A,
+    0x07, 0x03, 0x01, 0x12, 0x02, 0x06, 0x0B, 0x0D, 0x5D, 0x9A, 0x5D, 0x0D,
+    0x10, 0x08, 0x01, 0x11, 0x01, 0x01, 0x01, 0x04, 0x08, 0x07, 0x5A, 0xC2,
+    0xCD, 0x9A, 0x9E, 0x18, 0x8E, 0x01, 0x42, 0x5D, 0x10, 0x10, 0x5D, 0x0C,
+    0x0C, 0xFE, 0xBE, 0x02, 0xBC, 0xFE, 0xB0, 0x1D, 0x37, 0x2F, 0x28, 0x0D,
+    0x1E, 0x39, 0x3D, 0x24, 0x01, 0x02, 0xFE, 0xFE, 0x26, 0x3F, 0x38, 0x1A,
+    0x01, 0x0F, 0x1E, 0x21, 0x26, 0x2B, 0x19, 0x01, 0x50, 0xFD, 0x44, 0x01,
+    0x83, 0xFE, 0x7D, 0x00, 0x00, 0x03, 0xFF, 0xF1, 0x00, 0x00, 0x02, 0xCD,
+    0x02, 0xBC, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x61, 0x11,
+    0x17, 0x01, 0x33, 0x13, 0x27, 0x13, 0x33, 0x01, 0x37, 0x11, 0x25, 0x35,
+    0x05, 0x15, 0x25, 0x35, 0x05, 0x15, 0x01, 0x05, 0x07, 0xFE, 0xE5, 0xDE,
+    0xD8, 0x75, 0xC3, 0xD8, 0xFE, 0xF1, 0x0F, 0xFE, 0xBF, 0x01, 0xBD, 0xFE,
+    0x43, 0x01, 0xBD, 0x01, 0x5D, 0x31, 0x01, 0x90, 0xFE, 0xCA, 0x03, 0x01,
+    0x33, 0xFE, 0x65, 0x44, 0xFE, 0x9B, 0x8A, 0x41, 0x01, 0x40, 0x73, 0x41,
+    0x01, 0x40, 0x00, 0x01, 0x00, 0x3A, 0x00, 0xA9, 0x01, 0x4B, 0x01, 0xBA,
+    0x00, 0x0F, 0x00, 0x00, 0x77, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0xC5, 0x26, 0x3F, 0x26,
+    0x26, 0x3F, 0x26, 0x24, 0x3D, 0x25, 0x25, 0x3D, 0xA9, 0x25, 0x3D, 0x25,
+    0x26, 0x3E, 0x26, 0x26, 0x3E, 0x26, 0x25, 0x3D, 0x25, 0x00, 0x00, 0x01,
+    0xFF, 0xFC, 0xFF, 0x95, 0x02, 0x42, 0x02, 0xF4, 0x00, 0x03, 0x00, 0x00,
+    0x47, 0x01, 0x33, 0x01, 0x04, 0x01, 0xA0, 0xA6, 0xFE, 0x5B, 0x6B, 0x03,
+    0x5F, 0xFC, 0xA1, 0x00, 0x00, 0x02, 0x00, 0x31, 0x00, 0x26, 0x02, 0x26,
+    0x02, 0x11, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15,
+    0x05, 0x11, 0x33, 0x11, 0x31, 0x01, 0xF5, 0xFE, 0xB6, 0x9F, 0xD3, 0x94,
+    0x94, 0xAD, 0x01, 0xEB, 0xFE, 0x15, 0x00, 0x01, 0x00, 0x21, 0x00, 0xDC,
+    0x02, 0x23, 0x01, 0x78, 0x00, 0x03, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15,
+    0x21, 0x02, 0x02, 0xDC, 0x9C, 0x9C, 0x00, 0x02, 0x00, 0x27, 0x00, 0x28,
+    0x02, 0x03, 0x02, 0x05, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x65, 0x01,
+    0x37, 0x01, 0x05, 0x27, 0x01, 0x17, 0x01, 0x94, 0xFE, 0x93, 0x6F, 0x01,
+    0x6D, 0xFE, 0x93, 0x6E, 0x01, 0x6C, 0x6E, 0x29, 0x01, 0x6E, 0x6E, 0xFE,
+    0x93, 0x70, 0x70, 0x01, 0x6D, 0x6F, 0x00, 0x03, 0x00, 0x28, 0xFF, 0xD7,
+    0x02, 0x2E, 0x02, 0x3E, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
+    0x77, 0x35, 0x21, 0x15, 0x05, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x03, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x28, 0x02, 0x06, 0xFE, 0xFC, 0x1F, 0x2E, 0x19, 0x1A, 0x2D, 0x1F, 0x1F,
+    0x2E, 0x19, 0x1A, 0x2D, 0x1F, 0x1F, 0x2E, 0x19, 0x1A, 0x2D, 0x1F, 0x1F,
+    0x2E, 0x19, 0x1A, 0x2D, 0xC1, 0x94, 0x94, 0xEA, 0x16, 0x2B, 0x1D, 0x1C,
+    0x2A, 0x18, 0x15, 0x2B, 0x1E, 0x1B, 0x2A, 0x19, 0x01, 0xAA, 0x16, 0x2B,
+    0x1D, 0x1B, 0x2B, 0x19, 0x17, 0x2A, 0x1E, 0x1B, 0x2A, 0x19, 0x00, 0x02,
+    0x00, 0x4B, 0x00, 0x5C, 0x02, 0x3E, 0x01, 0xD7, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x05, 0x35, 0x21, 0x15, 0x4B, 0x01,
+    0xF3, 0xFE, 0x0D, 0x01, 0xF3, 0x01, 0x43, 0x94, 0x94, 0xE7, 0x94, 0x94,
+    0x00, 0x03, 0x00, 0x43, 0x00, 0x15, 0x02, 0x57, 0x02, 0x1E, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x01, 0x33, 0x01, 0x27, 0x35,
+    0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x79, 0x01, 0x05, 0xA0, 0xFE, 0xF8,
+    0xD3, 0x02, 0x14, 0xFD, 0xEC, 0x02, 0x14, 0x15, 0x02, 0x09, 0xFD, 0xF7,
+    0x48, 0x92, 0x92, 0xE7, 0x92, 0x92, 0x00, 0x01, 0x00, 0x1C, 0xFF, 0xEB,
+    0x01, 0xF5, 0x02, 0x1D, 0x00, 0x07, 0x00, 0x00, 0x57, 0x27, 0x25, 0x15,
+    0x25, 0x37, 0x05, 0x15, 0x65, 0x49, 0x01, 0x4B, 0xFE, 0xB5, 0x49, 0x01,
+    0x90, 0x15, 0x96, 0xA6, 0x46, 0xA6, 0x96, 0xE5, 0x68, 0x00, 0x00, 0x01,
+    0x00, 0x26, 0xFF, 0xEB, 0x01, 0xFF, 0x02, 0x1D, 0x00, 0x07, 0x00, 0x00,
+    0x45, 0x25, 0x35, 0x25, 0x17, 0x05, 0x35, 0x05, 0x01, 0xB6, 0xFE, 0x70,
+    0x01, 0x90, 0x49, 0xFE, 0xB5, 0x01, 0x4B, 0x15, 0xE5, 0x68, 0xE5, 0x96,
+    0xA6, 0x46, 0xA6, 0x00, 0x00, 0x02, 0x00, 0x41, 0x00, 0x00, 0x02, 0x32,
+    0x02, 0x48, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x27, 0x25, 0x07,
+    0x25, 0x37, 0x05, 0x15, 0x01, 0x35, 0x21, 0x15, 0x64, 0x13, 0x01, 0x65,
+    0x01, 0xFE, 0x9B, 0x14, 0x01, 0xCE, 0xFE, 0x0F, 0x01, 0xF1, 0xA6, 0x8A,
+    0x65, 0x3B, 0x65, 0x89, 0x99, 0x70, 0xFE, 0xC1, 0x93, 0x93, 0x00, 0x02,
+    0x00, 0x41, 0x00, 0x00, 0x02, 0x32, 0x02, 0x48, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x65, 0x25, 0x35, 0x25, 0x17, 0x05, 0x27, 0x05, 0x01, 0x35,
+    0x21, 0x15, 0x02, 0x0F, 0xFE, 0x32, 0x01, 0xCE, 0x14, 0xFE, 0x9B, 0x01,
+    0x01, 0x65, 0xFE, 0x1F, 0x01, 0xF1, 0xA6, 0x99, 0x70, 0x99, 0x89, 0x65,
+    0x3B, 0x65, 0xFE, 0xD0, 0x93, 0x93, 0x00, 0x03, 0x00, 0x4B, 0xFF, 0xF8,
+    0x02, 0x50, 0x02, 0x53, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x53, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x25, 0x11, 0x33, 0x11,
+    0x4B, 0x02, 0x02, 0xFE, 0x00, 0x02, 0x03, 0xFE, 0xA7, 0xAB, 0x01, 0x45,
+    0x94, 0x94, 0xFE, 0xB3, 0x94, 0x94, 0xD2, 0x01, 0x89, 0xFE, 0x77, 0x00,
+    0x00, 0x02, 0x00, 0x3A, 0x00, 0x37, 0x02, 0x3B, 0x01, 0xE0, 0x00, 0x1F,
+    0x00, 0x3F, 0x00, 0x00, 0x41, 0x22, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x23,
+    0x22, 0x06, 0x15, 0x07, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
+    0x1E, 0x02, 0x33, 0x32, 0x36, 0x27, 0x37, 0x14, 0x06, 0x06, 0x07, 0x22,
+    0x26, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x07, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x27,
+    0x37, 0x14, 0x06, 0x06, 0x01, 0xB7, 0x16, 0x30, 0x30, 0x16, 0x0F, 0x1C,
+    0x1C, 0x0F, 0x11, 0x11, 0x79, 0x21, 0x45, 0x34, 0x13, 0x2C, 0x2D, 0x11,
+    0x0A, 0x1A, 0x1B, 0x0B, 0x13, 0x16, 0x01, 0x78, 0x1D, 0x3B, 0x2C, 0x16,
+    0x30, 0x30, 0x16, 0x0F, 0x1C, 0x1C, 0x0F, 0x11, 0x11, 0x79, 0x20, 0x40,
+    0x32, 0x15, 0x2E, 0x2E, 0x14, 0x0A, 0x1A, 0x1B, 0x0B, 0x13, 0x16, 0x01,
+    0x78, 0x1D, 0x3B, 0x01, 0x1D, 0x0C, 0x12, 0x08, 0x06, 0x0B, 0x07, 0x18,
+    0x17, 0x04, 0x3B, 0x52, 0x2B, 0x0F, 0x12, 0x07, 0x04, 0x0B, 0x08, 0x14,
+    0x12, 0x03, 0x38, 0x4D, 0x28, 0xE6, 0x0C, 0x12, 0x09, 0x06, 0x0B, 0x07,
+    0x18, 0x18, 0x04, 0x3B, 0x53, 0x2A, 0x0D, 0x12, 0x08, 0x05, 0x0B, 0x07,
+    0x13, 0x13, 0x03, 0x38, 0x4E, 0x28, 0x00, 0x01, 0x00, 0x1C, 0x00, 0xB6,
+    0x02, 0x24, 0x01, 0x9D, 0x00, 0x1F, 0x00, 0x00, 0x65, 0x22, 0x26, 0x26,
+    0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x33, 0x32,
+    0x1E, 0x02, 0x17, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x27, 0x17, 0x14, 0x06,
+    0x06, 0x01, 0x8B, 0x11, 0x25, 0x24, 0x13, 0x0E, 0x20, 0x1C, 0x0A, 0x14,
+    0x15, 0x85, 0x50, 0x56, 0x0C, 0x1D, 0x1C, 0x1B, 0x0B, 0x0C, 0x1B, 0x1A,
+    0x0C, 0x11, 0x16, 0x02, 0x85, 0x22, 0x45, 0xC0, 0x08, 0x0D, 0x08, 0x06,
+    0x0C, 0x09, 0x22, 0x20, 0x6C, 0x74, 0x07, 0x09, 0x0B, 0x05, 0x05, 0x0C,
+    0x08, 0x25, 0x1B, 0x01, 0x49, 0x61, 0x32, 0x00, 0x00, 0x01, 0x00, 0x26,
+    0x00, 0x64, 0x02, 0x78, 0x01, 0xA5, 0x00, 0x06, 0x00, 0x00, 0x65, 0x35,
+    0x17, 0x21, 0x35, 0x21, 0x11, 0x01, 0xCD, 0x55, 0xFE, 0x04, 0x02, 0x52,
+    0x64, 0xDB, 0x38, 0x9E, 0xFE, 0xBF, 0x00, 0x01, 0x00, 0x05, 0x01, 0x66,
+    0x02, 0x51, 0x02, 0xDF, 0x00, 0x07, 0x00, 0x00, 0x53, 0x13, 0x33, 0x13,
+    0x23, 0x03, 0x37, 0x03, 0x05, 0xDF, 0x8E, 0xDF, 0xB6, 0xA7, 0x70, 0xAC,
+    0x01, 0x66, 0x01, 0x79, 0xFE, 0x87, 0x01, 0x24, 0x01, 0xFE, 0xDB, 0x00,
+    0x00, 0x02, 0x00, 0x29, 0x00, 0x1E, 0x03, 0x74, 0x01, 0xE7, 0x00, 0x1E,
+    0x00, 0x3E, 0x00, 0x00, 0x65, 0x22, 0x26, 0x27, 0x27, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x37,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x21, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x17,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x07, 0x0E, 0x02, 0x02, 0xAB, 0x38, 0x58, 0x35, 0x77, 0x19,
+    0x37, 0x1D, 0x11, 0x1B, 0x0F, 0x0F, 0x1B, 0x12, 0x1E, 0x2F, 0x1F, 0x71,
+    0x22, 0x3F, 0x42, 0x26, 0x3C, 0x5C, 0x33, 0x32, 0x5B, 0xFE, 0x0B, 0x3C,
+    0x5B, 0x32, 0x33, 0x5C, 0x3C, 0x26, 0x3F, 0x3F, 0x26, 0x71, 0x1D, 0x31,
+    0x1D, 0x12, 0x1B, 0x10, 0x10, 0x1B, 0x12, 0x1C, 0x33, 0x1D, 0x76, 0x22,
+    0x3D, 0x41, 0x1E, 0x2A, 0x36, 0x8B, 0x1F, 0x1A, 0x10, 0x1B, 0x14, 0x14,
+    0x1C, 0x0F, 0x1B, 0x20, 0x85, 0x29, 0x2B, 0x0F, 0x38, 0x67, 0x45, 0x46,
+    0x66, 0x39, 0x39, 0x66, 0x46, 0x45, 0x67, 0x38, 0x11, 0x2A, 0x28, 0x85,
+    0x23, 0x18, 0x0F, 0x1C, 0x14, 0x14, 0x1B, 0x10, 0x1C, 0x1D, 0x8A, 0x28,
+    0x2A, 0x0F, 0x00, 0x03, 0x00, 0x20, 0xFF, 0xF3, 0x02, 0x6D, 0x02, 0x20,
+    0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x57, 0x27, 0x01, 0x17,
+    0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x62, 0x40, 0x01, 0xF1,
+    0x3D, 0xFE, 0xF7, 0x55, 0x86, 0x4C, 0x4C, 0x86, 0x55, 0x55, 0x85, 0x4C,
+    0x4C, 0x85, 0x55, 0x1E, 0x31, 0x1B, 0x1B, 0x31, 0x1E, 0x1F, 0x30, 0x1C,
+    0x1C, 0x30, 0x0D, 0x42, 0x01, 0xE2, 0x42, 0xFE, 0x21, 0x48, 0x7C, 0x51,
+    0x51, 0x7C, 0x48, 0x48, 0x7C, 0x51, 0x51, 0x7C, 0x48, 0x9D, 0x1F, 0x37,
+    0x22, 0x24, 0x36, 0x1F, 0x1F, 0x37, 0x23, 0x22, 0x37, 0x1F, 0x00, 0x01,
+    0xFF, 0xDB, 0xFF, 0x79, 0x02, 0xA6, 0x02, 0xFA, 0x00, 0x20, 0x00, 0x00,
+    0x57, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
+    0x37, 0x13, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x07, 0x03, 0x0E, 0x02, 0x91, 0x19, 0x3B, 0x3F, 0x23,
+    0x64, 0x10, 0x27, 0x12, 0x11, 0x1A, 0x14, 0x04, 0x4E, 0x0F, 0x39, 0x57,
+    0x3B, 0x3B, 0x56, 0x22, 0x3A, 0x16, 0x2E, 0x13, 0x13, 0x1E, 0x15, 0x05,
+    0x45, 0x0E, 0x41, 0x62, 0x87, 0x0E, 0x1E, 0x17, 0xA3, 0x0D, 0x12, 0x12,
+    0x21, 0x17, 0x01, 0x99, 0x49, 0x5E, 0x30, 0x20, 0x1C, 0x99, 0x0F, 0x11,
+    0x14, 0x27, 0x1D, 0xFE, 0x77, 0x4F, 0x69, 0x33, 0x00, 0x01, 0x00, 0x1D,
+    0x00, 0x00, 0x02, 0xD2, 0x02, 0xCE, 0x00, 0x36, 0x00, 0x00, 0x73, 0x35,
+    0x33, 0x07, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
+    0x15, 0x14, 0x06, 0x06, 0x07, 0x27, 0x33, 0x15, 0x21, 0x35, 0x3E, 0x02,
+    0x37, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15,
+    0x14, 0x16, 0x16, 0x17, 0x1E, 0x03, 0x17, 0x15, 0x37, 0xC0, 0x33, 0x30,
+    0x4C, 0x2B, 0x34, 0x5E, 0x7F, 0x49, 0x4A, 0x7F, 0x5E, 0x34, 0x2C, 0x4B,
+    0x30, 0x33, 0xC0, 0xFE, 0xEA, 0x0C, 0x1E, 0x1C, 0x09, 0x0A, 0x10, 0x08,
+    0x17, 0x2B, 0x38, 0x22, 0x21, 0x39, 0x2A, 0x17, 0x0B, 0x12, 0x0C, 0x09,
+    0x13, 0x13, 0x12, 0x07, 0xA4, 0x20, 0x2B, 0x5C, 0x64, 0x36, 0x40, 0x6D,
+    0x50, 0x2C, 0x2C, 0x51, 0x6C, 0x41, 0x35, 0x64, 0x5C, 0x2B, 0x20, 0xA4,
+    0xC5, 0x0A, 0x1C, 0x1F, 0x11, 0x11, 0x24, 0x26, 0x15, 0x1E, 0x34, 0x25,
+    0x16, 0x15, 0x26, 0x34, 0x1E, 0x17, 0x2B, 0x26, 0x13, 0x0E, 0x17, 0x13,
+    0x0E, 0x05, 0xC5, 0x00, 0x00, 0x02, 0xFF, 0xF5, 0x00, 0x00, 0x02, 0xD6,
+    0x02, 0xE7, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x63, 0x01, 0x01, 0x25,
+    0x27, 0x21, 0x07, 0x03, 0x33, 0x0B, 0x01, 0x6E, 0x01, 0x73, 0xFD, 0xDF,
+    0x43, 0x01, 0xEC, 0x4B, 0xEA, 0x74, 0x02, 0xE7, 0xFD, 0x19, 0x40, 0x56,
+    0x59, 0x01, 0xD5, 0x00, 0x00, 0x03, 0x00, 0x26, 0xFF, 0x38, 0x02, 0xCD,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x11,
+    0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x01, 0x35, 0x21, 0x15, 0x01, 0xC1,
+    0xB8, 0xFE, 0x00, 0xB8, 0xFE, 0xF5, 0x02, 0xA7, 0xC8, 0x03, 0x4C, 0xFC,
+    0xB4, 0x03, 0x49, 0xFC, 0xB7, 0x02, 0xDB, 0xA9, 0xA9, 0x00, 0x00, 0x01,
+    0x00, 0x13, 0xFF, 0xEF, 0x01, 0xF1, 0x02, 0xB5, 0x00, 0x0F, 0x00, 0x00,
+    0x57, 0x27, 0x13, 0x17, 0x03, 0x37, 0x21, 0x15, 0x21, 0x37, 0x13, 0x15,
+    0x03, 0x27, 0x21, 0x15, 0x3F, 0x2C, 0xDB, 0x03, 0xDE, 0x2C, 0x01, 0xB2,
+    0xFE, 0x98, 0x3C, 0xD0, 0xD1, 0x35, 0x01, 0x62, 0x11, 0x64, 0x01, 0x1C,
+    0x3B, 0x01, 0x1D, 0x64, 0xA4, 0x5F, 0xFE, 0xEA, 0x0F, 0xFE, 0xEA, 0x5E,
+    0xA4, 0x00, 0x00, 0x01, 0x00, 0x07, 0xFF, 0x63, 0x03, 0x08, 0x02, 0xBC,
+    0x00, 0x0A, 0x00, 0x00, 0x57, 0x03, 0x33, 0x13, 0x07, 0x13, 0x21, 0x15,
+    0x23, 0x37, 0x01, 0xCD, 0xC6, 0xC0, 0x6B, 0x45, 0xF4, 0x01, 0x27, 0xF7,
+    0x6B, 0xFE, 0xF4, 0x9D, 0x01, 0xEA, 0xFE, 0xAD, 0x08, 0x02, 0xCA, 0xC8,
+    0x56, 0xFD, 0x19, 0x00, 0x00, 0x01, 0x00, 0x48, 0xFF, 0x5C, 0x02, 0x50,
+    0x02, 0x15, 0x00, 0x1C, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x14, 0x16,
+    0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x23, 0x27, 0x17,
+    0x0E, 0x02, 0x07, 0x22, 0x26, 0x26, 0x27, 0x37, 0x17, 0x48, 0xB9, 0x10,
+    0x20, 0x16, 0x12, 0x1D, 0x15, 0x0C, 0xB9, 0xAB, 0x09, 0x13, 0x18, 0x2F,
+    0x3A, 0x28, 0x08, 0x0C, 0x09, 0x02, 0x12, 0x08, 0xA4, 0x02, 0xB9, 0xFE,
+    0xC9, 0x1A, 0x24, 0x12, 0x0B, 0x15, 0x1C, 0x10, 0x01, 0x3B, 0xFD, 0xEB,
+    0x5D, 0x07, 0x23, 0x28, 0x13, 0x04, 0x02, 0x05, 0x02, 0x47, 0xE8, 0x00,
+    0x00, 0x02, 0x00, 0x20, 0xFF, 0xF9, 0x02, 0x4B, 0x02, 0xF0, 0x00, 0x20,
+    0x00, 0x30, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x04, 0x27, 0x37, 0x16, 0x16,
+    0x17, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01,
+    0x2E, 0x38, 0x62, 0x4B, 0x29, 0x2A, 0x48, 0x5E, 0x32, 0x27, 0x4C, 0x46,
+    0x1C, 0x4D, 0x02, 0x16, 0x27, 0x3A, 0x4F, 0x32, 0x3D, 0x48, 0x74, 0x2B,
+    0x3E, 0x39, 0x2A, 0x4B, 0x69, 0x3C, 0x20, 0x33, 0x1D, 0x1D, 0x33, 0x20,
+    0x1D, 0x2E, 0x1B, 0x1B, 0x2E, 0x07, 0x2A, 0x4A, 0x63, 0x39, 0x32, 0x59,
+    0x44, 0x27, 0x1A, 0x41, 0x3A, 0x11, 0x20, 0x3E, 0x3A, 0x32, 0x26, 0x0D,
+    0x9A, 0x16, 0x47, 0x2E, 0x40, 0xA2, 0x5A, 0x40, 0x6E, 0x54, 0x2E, 0xA5,
+    0x1C, 0x31, 0x1E, 0x1E, 0x30, 0x1C, 0x1C, 0x30, 0x1E, 0x1E, 0x31, 0x1C,
+    0x00, 0x05, 0x00, 0x28, 0xFF, 0xF6, 0x03, 0xD9, 0x02, 0xD5, 0x00, 0x03,
+    0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x43, 0x00, 0x00, 0x73, 0x01,
+    0x33, 0x01, 0x03, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0xBE, 0x01, 0xCF, 0xA9, 0xFE, 0x2C,
+    0x80, 0x35, 0x55, 0x30, 0x2F, 0x54, 0x37, 0x37, 0x54, 0x2E, 0x30, 0x54,
+    0x35, 0x0F, 0x13, 0x0A, 0x0A, 0x13, 0x0F, 0x0E, 0x14, 0x0C, 0x0B, 0x15,
+    0x02, 0x4C, 0x35, 0x55, 0x30, 0x2F, 0x54, 0x37, 0x37, 0x53, 0x2F, 0x31,
+    0x53, 0x35, 0x0E, 0x14, 0x0A, 0x0A, 0x14, 0x0E, 0x0E, 0x15, 0x0B, 0x0A,
+    0x16, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x49, 0x33, 0x5A, 0x38, 0x3B, 0x59,
+    0x33, 0x33, 0x59, 0x3B, 0x38, 0x59, 0x34, 0x73, 0x14, 0x25, 0x19, 0x19,
+    0x26, 0x15, 0x15, 0x26, 0x19, 0x19, 0x25, 0x14, 0xFE, 0x3A, 0x34, 0x59,
+    0x38, 0x3B, 0x59, 0x33, 0x33, 0x59, 0x3B, 0x38, 0x59, 0x34, 0x73, 0x15,
+    0x24, 0x19, 0x1A, 0x25, 0x15, 0x15, 0x25, 0x1A, 0x19, 0x24, 0x15, 0x00,
+    0x00, 0x07, 0x00, 0x28, 0xFF, 0xF7, 0x05, 0x64, 0x02, 0xCE, 0x00, 0x03,
+    0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x43, 0x00, 0x53, 0x00, 0x63,
+    0x00, 0x00, 0x73, 0x01, 0x33, 0x01, 0x03, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x05, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0xBB, 0x01, 0xCF, 0xAA, 0xFE, 0x2C,
+    0x7E, 0x35, 0x55, 0x30, 0x2F, 0x54, 0x37, 0x37, 0x54, 0x2E, 0x30, 0x54,
+    0x35, 0x0F, 0x13, 0x0A, 0x0A, 0x13, 0x0F, 0x0E, 0x14, 0x0C, 0x0B, 0x15,
+    0x02, 0x3F, 0x36, 0x54, 0x31, 0x30, 0x54, 0x37, 0x37, 0x53, 0x2E, 0x30,
+    0x53, 0x35, 0x0E, 0x14, 0x0A, 0x0A, 0x14, 0x0E, 0x0F, 0x14, 0x0B, 0x0A,
+    0x15, 0x01, 0xA7, 0x35, 0x55, 0x30, 0x2F, 0x54, 0x37, 0x37, 0x53, 0x2F,
+    0x30, 0x54, 0x35, 0x0F, 0x13, 0x0A, 0x0A, 0x13, 0x0F, 0x0E, 0x15, 0x0B,
+    0x0B, 0x15, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x42, 0x34, 0x59, 0x39, 0x3A,
+    0x59, 0x33, 0x33, 0x59, 0x3A, 0x39, 0x59, 0x34, 0x73, 0x15, 0x25, 0x19,
+    0x19, 0x26, 0x14, 0x15, 0x25, 0x19, 0x19, 0x25, 0x15, 0xFE, 0x42, 0x34,
+    0x59, 0x38, 0x3B, 0x59, 0x33, 0x33, 0x59, 0x3B, 0x38, 0x59, 0x34, 0x73,
+    0x14, 0x25, 0x19, 0x19, 0x26, 0x15, 0x15, 0x26, 0x19, 0x19, 0x25, 0x14,
+    0x73, 0x34, 0x59, 0x38, 0x3B, 0x59, 0x33, 0x33, 0x59, 0x3B, 0x38, 0x59,
+    0x34, 0x73, 0x14, 0x25, 0x19, 0x19, 0x26, 0x15, 0x15, 0x26, 0x19, 0x19,
+    0x25, 0x14, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xB9, 0x02, 0x81, 0x02, 0xD3,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x45, 0x09, 0x02, 0x05, 0x37, 0x27,
+    0x07, 0x01, 0x54, 0xFE, 0xD4, 0x01, 0x2C, 0x01, 0x2D, 0xFE, 0xD4, 0x63,
+    0x64, 0x63, 0x47, 0x01, 0x8F, 0x01, 0x8B, 0xFE, 0x78, 0x92, 0x8E, 0x8C,
+    0x8A, 0x00, 0x00, 0x02, 0x00, 0x3F, 0x02, 0x4B, 0x01, 0xB5, 0x03, 0xDD,
+    0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17,
+    0xFA, 0x47, 0x65, 0x0F, 0x6E, 0x0B, 0x2B, 0x17, 0x17, 0x2B, 0x0B, 0x6E,
+    0x0F, 0x65, 0x3D, 0x44, 0x64, 0x6A, 0x02, 0x4B, 0x4E, 0x45, 0x0C, 0x1F,
+    0x16, 0x16, 0x1F, 0x0C, 0x45, 0x4E, 0xB5, 0x31, 0xAC, 0x4C, 0x00, 0x02,
+    0x00, 0x3F, 0x02, 0x4B, 0x01, 0xB5, 0x03, 0xDD, 0x00, 0x0D, 0x00, 0x11,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0xFA, 0x47, 0x65, 0x0F,
+    0x6E, 0x0B, 0x2B, 0x17, 0x17, 0x2B, 0x0B, 0x6E, 0x0E, 0x65, 0x4A, 0x8A,
+    0x6A, 0x64, 0x02, 0x4B, 0x4E, 0x46, 0x0C, 0x1F, 0x17, 0x17, 0x1F, 0x0C,
+    0x45, 0x4F, 0xB5, 0x91, 0x4C, 0xAC, 0x00, 0x02, 0x00, 0x3F, 0x02, 0x4B,
+    0x01, 0xB5, 0x03, 0xE6, 0x00, 0x0D, 0x00, 0x2D, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x27, 0x26, 0x26, 0x35, 0x36, 0x36, 0x37, 0x36, 0x36, 0x37, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x06, 0x17, 0xFA, 0x47, 0x65, 0x0F,
+    0x6E, 0x0B, 0x2B, 0x17, 0x17, 0x2B, 0x0B, 0x6E, 0x0E, 0x65, 0x63, 0x0A,
+    0x0A, 0x01, 0x09, 0x0F, 0x0A, 0x10, 0x01, 0x13, 0x0F, 0x15, 0x2D, 0x17,
+    0x18, 0x15, 0x44, 0x27, 0x3C, 0x4E, 0x21, 0x13, 0x0F, 0x16, 0x01, 0x01,
+    0x02, 0x4B, 0x4E, 0x46, 0x0C, 0x1F, 0x17, 0x17, 0x1F, 0x0C, 0x45, 0x4F,
+    0xB1, 0x09, 0x16, 0x0B, 0x0B, 0x13, 0x0A, 0x07, 0x0E, 0x08, 0x0A, 0x0A,
+    0x0C, 0x08, 0x5F, 0x0B, 0x11, 0x34, 0x2F, 0x22, 0x21, 0x0B, 0x08, 0x10,
+    0x0B, 0x01, 0x04, 0x02, 0x00, 0x02, 0x00, 0x3C, 0x02, 0x4B, 0x01, 0xB8,
+    0x03, 0xCC, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x37, 0x22,
+    0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06,
+    0x06, 0xFB, 0x48, 0x64, 0x0F, 0x6E, 0x0B, 0x2B, 0x17, 0x16, 0x2C, 0x0B,
+    0x6E, 0x0E, 0x65, 0x07, 0x11, 0x29, 0x19, 0x11, 0x18, 0x08, 0x0F, 0x16,
+    0x02, 0x63, 0x3F, 0x34, 0x10, 0x28, 0x15, 0x10, 0x18, 0x0D, 0x0E, 0x15,
+    0x02, 0x62, 0x1C, 0x31, 0x02, 0x4B, 0x4E, 0x46, 0x0C, 0x1F, 0x17, 0x17,
+    0x1F, 0x0C, 0x45, 0x4F, 0xF1, 0x09, 0x0A, 0x08, 0x06, 0x11, 0x12, 0x0D,
+    0x37, 0x4B, 0x08, 0x0A, 0x06, 0x09, 0x13, 0x11, 0x0E, 0x21, 0x3C, 0x25,
+    0x00, 0x02, 0xFF, 0xF4, 0x02, 0x4E, 0x02, 0x08, 0x03, 0xCB, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33,
+    0x37, 0x27, 0x37, 0x17, 0x28, 0x34, 0x8C, 0x64, 0x8B, 0x33, 0x99, 0x1E,
+    0xBD, 0x44, 0x64, 0x6A, 0x02, 0x4E, 0x3F, 0x6A, 0x6A, 0x3F, 0x43, 0x5D,
+    0x30, 0xAD, 0x4C, 0x00, 0x00, 0x02, 0x00, 0x25, 0x02, 0x4E, 0x01, 0xD8,
+    0x03, 0xCA, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33,
+    0x17, 0x07, 0x27, 0x33, 0x37, 0x27, 0x37, 0x17, 0x58, 0x33, 0x8C, 0x63,
+    0x8C, 0x33, 0x99, 0x1E, 0xA2, 0x8B, 0x6A, 0x65, 0x02, 0x4E, 0x3E, 0x6A,
+    0x6A, 0x3E, 0x42, 0x5D, 0x91, 0x4C, 0xAC, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0x02, 0x4E, 0x01, 0xF5, 0x03, 0xD1, 0x00, 0x07, 0x00, 0x27, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x26, 0x26, 0x35,
+    0x36, 0x36, 0x37, 0x36, 0x36, 0x37, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06,
+    0x15, 0x14, 0x14, 0x17, 0x33, 0x34, 0x8D, 0x63, 0x8C, 0x33, 0x99, 0x1E,
+    0x91, 0x09, 0x0B, 0x01, 0x09, 0x0F, 0x0A, 0x10, 0x01, 0x12, 0x10, 0x15,
+    0x2D, 0x16, 0x19, 0x15, 0x44, 0x27, 0x3D, 0x4D, 0x20, 0x14, 0x0F, 0x16,
+    0x01, 0x02, 0x4E, 0x3F, 0x6A, 0x6A, 0x3F, 0x43, 0x57, 0x09, 0x15, 0x0C,
+    0x0A, 0x13, 0x0A, 0x07, 0x0F, 0x07, 0x0A, 0x0B, 0x0C, 0x09, 0x5F, 0x0B,
+    0x11, 0x34, 0x2F, 0x22, 0x21, 0x0B, 0x07, 0x11, 0x0B, 0x01, 0x04, 0x02,
+    0x00, 0x02, 0x00, 0x3C, 0x02, 0x4E, 0x01, 0xB8, 0x03, 0xCA, 0x00, 0x07,
+    0x00, 0x22, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33,
+    0x37, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x14, 0x06, 0x06, 0x71, 0x34, 0x8C, 0x63, 0x8C, 0x33, 0x99, 0x1E, 0x40,
+    0x11, 0x29, 0x19, 0x11, 0x18, 0x08, 0x0F, 0x16, 0x02, 0x63, 0x3F, 0x34,
+    0x10, 0x28, 0x15, 0x10, 0x18, 0x0D, 0x0E, 0x15, 0x02, 0x62, 0x1C, 0x31,
+    0x02, 0x4E, 0x3F, 0x6A, 0x6A, 0x3F, 0x43, 0xA9, 0x09, 0x0A, 0x08, 0x07,
+    0x12, 0x12, 0x0E, 0x36, 0x4C, 0x09, 0x09, 0x07, 0x08, 0x13, 0x10, 0x0E,
+    0x21, 0x3C, 0x25, 0x00, 0x00, 0x02, 0x00, 0x1A, 0x02, 0x6B, 0x01, 0xDB,
+    0x03, 0x27, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x41, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x21, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x7C, 0x2E, 0x31,
+    0x33, 0x2C, 0x2D, 0x32, 0x33, 0xFE, 0xD1, 0x2E, 0x31, 0x33, 0x2C, 0x2D,
+    0x32, 0x33, 0x02, 0x6B, 0x31, 0x2D, 0x29, 0x35, 0x30, 0x2E, 0x2A, 0x34,
+    0x31, 0x2D, 0x29, 0x35, 0x30, 0x2E, 0x2A, 0x34, 0x00, 0x03, 0x00, 0x19,
+    0x02, 0x54, 0x01, 0xDA, 0x03, 0xF3, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x33, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x27, 0x27, 0x37, 0x17, 0x78, 0x2D, 0x32, 0x33, 0x2C, 0x2E,
+    0x31, 0x33, 0xD7, 0x2D, 0x32, 0x33, 0x2C, 0x2E, 0x31, 0x33, 0x9E, 0x4A,
+    0x5D, 0x71, 0x02, 0x54, 0x31, 0x2D, 0x29, 0x35, 0x30, 0x2E, 0x29, 0x35,
+    0x31, 0x2D, 0x29, 0x35, 0x30, 0x2E, 0x29, 0x35, 0xBF, 0x2F, 0xB1, 0x50,
+    0xFF, 0xFF, 0x00, 0x1A, 0x02, 0x6B, 0x01, 0xDB, 0x03, 0xC9, 0x06, 0x26,
+    0x02, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0x00, 0x00, 0x00, 0xE3,
+    0x00, 0x01, 0x00, 0x8F, 0x02, 0x71, 0x01, 0x65, 0x03, 0x27, 0x00, 0x0B,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0xFA, 0x32, 0x39, 0x3A, 0x31, 0x32, 0x39, 0x3A, 0x02, 0x71,
+    0x30, 0x2B, 0x28, 0x33, 0x30, 0x2B, 0x28, 0x33, 0xFF, 0xFF, 0x00, 0x47,
+    0x02, 0x71, 0x01, 0xAD, 0x03, 0xC9, 0x06, 0x26, 0x02, 0xF5, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x05, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x01, 0x00, 0x72,
+    0x02, 0x3E, 0x01, 0x82, 0x03, 0x25, 0x00, 0x03, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x01, 0x4C, 0xDA, 0x4D, 0xC3, 0x02, 0x3E, 0x75, 0x72, 0x95,
+    0x00, 0x01, 0x00, 0x72, 0x02, 0x3D, 0x01, 0x82, 0x03, 0x24, 0x00, 0x03,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0xA8, 0x36, 0xC3, 0x4D, 0x02, 0x3D,
+    0x52, 0x95, 0x72, 0x00, 0x00, 0x02, 0x00, 0x27, 0x02, 0x5E, 0x01, 0xCE,
+    0x03, 0x3E, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17,
+    0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x01, 0x4A, 0x4B, 0x5F, 0x70, 0xFE, 0xBA, 0x2E, 0x33, 0x34, 0x2D, 0x2D,
+    0x33, 0x34, 0x02, 0x5E, 0x30, 0xB0, 0x50, 0x8F, 0x2B, 0x26, 0x25, 0x2D,
+    0x2A, 0x28, 0x23, 0x2E, 0x00, 0x02, 0x00, 0x0F, 0x02, 0x3A, 0x01, 0xE6,
+    0x03, 0x2F, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17,
+    0x05, 0x27, 0x37, 0x17, 0x01, 0x31, 0x4D, 0x9C, 0x66, 0xFE, 0x7B, 0x52,
+    0x8D, 0x6C, 0x02, 0x3E, 0x33, 0xBD, 0x5D, 0x97, 0x2E, 0xC7, 0x55, 0x00,
+    0x00, 0x01, 0x00, 0x91, 0x01, 0xA0, 0x01, 0x63, 0x02, 0xB6, 0x00, 0x15,
+    0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x0E, 0x02, 0xC1, 0x30,
+    0x0E, 0x26, 0x1D, 0x0E, 0x0D, 0x16, 0x14, 0x32, 0x25, 0x2F, 0x40, 0x16,
+    0x2B, 0x3C, 0x01, 0xA0, 0x3C, 0x05, 0x12, 0x18, 0x0D, 0x0A, 0x09, 0x07,
+    0x0A, 0x1C, 0x16, 0x25, 0x23, 0x33, 0x37, 0x21, 0x37, 0x2B, 0x1F, 0x00,
+    0x00, 0x01, 0x00, 0x2B, 0x02, 0x4E, 0x01, 0xC9, 0x03, 0x10, 0x00, 0x07,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x6D, 0x42,
+    0x9D, 0x64, 0x9D, 0x42, 0x9C, 0x1E, 0x02, 0x4E, 0x39, 0x89, 0x89, 0x39,
+    0x5C, 0x00, 0x00, 0x01, 0x00, 0x2D, 0x02, 0x56, 0x01, 0xC7, 0x03, 0x18,
+    0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x23, 0x37, 0x17, 0x07,
+    0xC8, 0x9B, 0x42, 0x9A, 0x1E, 0x9A, 0x42, 0x9B, 0x02, 0x56, 0x89, 0x39,
+    0x5C, 0x5C, 0x39, 0x89, 0x00, 0x02, 0x00, 0x2D, 0x02, 0x4E, 0x01, 0xC7,
+    0x03, 0xD6, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17,
+    0x23, 0x37, 0x17, 0x07, 0x27, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0xC8, 0x9B, 0x42, 0x9A, 0x1E, 0x9A, 0x42, 0x9B,
+    0x32, 0x32, 0x39, 0x3A, 0x31, 0x32, 0x39, 0x3A, 0x02, 0x4E, 0x89, 0x3A,
+    0x5D, 0x5D, 0x3A, 0x89, 0xD3, 0x2F, 0x2C, 0x27, 0x33, 0x2F, 0x2B, 0x28,
+    0x33, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x02, 0x56, 0x01, 0xB5, 0x03, 0x04,
+    0x00, 0x0D, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0xFA, 0x47, 0x65, 0x0F, 0x74, 0x09,
+    0x27, 0x17, 0x17, 0x27, 0x09, 0x74, 0x0F, 0x65, 0x02, 0x56, 0x56, 0x4C,
+    0x0C, 0x1C, 0x20, 0x20, 0x1C, 0x0C, 0x4C, 0x56, 0x00, 0x02, 0x00, 0x7C,
+    0x02, 0x54, 0x01, 0x78, 0x03, 0x47, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0xFA, 0x21, 0x39, 0x24, 0x23, 0x39, 0x22, 0x23,
+    0x39, 0x22, 0x23, 0x39, 0x22, 0x0E, 0x12, 0x12, 0x0E, 0x0E, 0x12, 0x13,
+    0x02, 0x54, 0x21, 0x36, 0x21, 0x22, 0x38, 0x21, 0x21, 0x38, 0x22, 0x21,
+    0x36, 0x21, 0x59, 0x12, 0x0D, 0x0F, 0x12, 0x12, 0x0E, 0x0E, 0x12, 0x00,
+    0x00, 0x01, 0x00, 0x3C, 0x02, 0x5D, 0x01, 0xB8, 0x03, 0x00, 0x00, 0x1A,
+    0x00, 0x00, 0x41, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x14, 0x06, 0x06, 0x01, 0x46, 0x10, 0x26, 0x1B, 0x11, 0x17,
+    0x07, 0x0F, 0x16, 0x02, 0x63, 0x3F, 0x36, 0x10, 0x25, 0x1A, 0x0B, 0x19,
+    0x0D, 0x0E, 0x15, 0x02, 0x62, 0x1D, 0x33, 0x02, 0x5D, 0x0A, 0x12, 0x0D,
+    0x0A, 0x15, 0x16, 0x0D, 0x3C, 0x52, 0x09, 0x11, 0x08, 0x0F, 0x15, 0x16,
+    0x0E, 0x25, 0x42, 0x28, 0x00, 0x03, 0x00, 0x24, 0x02, 0x5D, 0x01, 0xD1,
+    0x03, 0xD3, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x32, 0x00, 0x00, 0x41, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x21, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x17, 0x22,
+    0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06,
+    0x06, 0x01, 0x76, 0x2C, 0x2F, 0x32, 0x29, 0x2B, 0x30, 0x31, 0xFE, 0xDF,
+    0x2C, 0x2F, 0x32, 0x29, 0x2B, 0x2F, 0x31, 0x9F, 0x10, 0x27, 0x1A, 0x12,
+    0x16, 0x07, 0x0F, 0x16, 0x03, 0x62, 0x3F, 0x36, 0x10, 0x25, 0x1A, 0x0B,
+    0x19, 0x0C, 0x0E, 0x16, 0x01, 0x63, 0x1D, 0x33, 0x03, 0x2E, 0x2B, 0x27,
+    0x25, 0x2E, 0x2B, 0x28, 0x24, 0x2E, 0x2B, 0x27, 0x25, 0x2E, 0x2B, 0x28,
+    0x24, 0x2E, 0xD1, 0x0A, 0x12, 0x0D, 0x0A, 0x15, 0x16, 0x0D, 0x3C, 0x52,
+    0x09, 0x11, 0x08, 0x0F, 0x15, 0x16, 0x0E, 0x25, 0x42, 0x28, 0x00, 0x02,
+    0x00, 0x3C, 0x02, 0x5D, 0x01, 0xB8, 0x03, 0xF0, 0x00, 0x1A, 0x00, 0x1E,
+    0x00, 0x00, 0x41, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x14, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0x01, 0x46, 0x10,
+    0x26, 0x1B, 0x11, 0x17, 0x07, 0x0F, 0x16, 0x02, 0x63, 0x3F, 0x36, 0x10,
+    0x25, 0x1A, 0x0B, 0x19, 0x0D, 0x0E, 0x15, 0x02, 0x62, 0x1D, 0x33, 0x63,
+    0x4A, 0x5E, 0x70, 0x02, 0x5D, 0x0A, 0x12, 0x0D, 0x0A, 0x15, 0x16, 0x0D,
+    0x3C, 0x52, 0x09, 0x11, 0x08, 0x0F, 0x15, 0x16, 0x0E, 0x25, 0x42, 0x28,
+    0xB3, 0x30, 0xB0, 0x4F, 0xFF, 0xFF, 0x00, 0x3B, 0x02, 0x5D, 0x01, 0xB7,
+    0x03, 0xC1, 0x04, 0x26, 0x03, 0x01, 0xFF, 0x00, 0x02, 0x07, 0x03, 0x05,
+    0x00, 0x00, 0x00, 0xDA, 0x00, 0x01, 0x00, 0x47, 0x02, 0x76, 0x01, 0xAD,
+    0x02, 0xE7, 0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x47, 0x01,
+    0x66, 0x02, 0x76, 0x71, 0x71, 0x00, 0xFF, 0xFF, 0x00, 0x1A, 0x02, 0x76,
+    0x01, 0xDB, 0x03, 0xF1, 0x06, 0x26, 0x03, 0x05, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF2, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x02, 0x00, 0x47, 0x02, 0x6C,
+    0x01, 0xAD, 0x03, 0xED, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x05, 0x35, 0x21, 0x15, 0x01, 0x02, 0x84, 0x70, 0x5F, 0xFE,
+    0xFA, 0x01, 0x66, 0x03, 0x0D, 0x90, 0x50, 0xB0, 0xD1, 0x71, 0x71, 0x00,
+    0x00, 0x02, 0x00, 0x47, 0x02, 0x6C, 0x01, 0xAD, 0x03, 0xED, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x27, 0x27, 0x37, 0x17,
+    0x47, 0x01, 0x66, 0xAA, 0x4A, 0x5E, 0x70, 0x02, 0x6C, 0x71, 0x71, 0xA1,
+    0x30, 0xB0, 0x50, 0x00, 0x00, 0x01, 0x00, 0x74, 0x02, 0x46, 0x01, 0x80,
+    0x03, 0x42, 0x00, 0x1F, 0x00, 0x00, 0x53, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0xE0, 0x08, 0x0D, 0x0E, 0x13, 0x0C, 0x12, 0x11, 0x0E, 0x16,
+    0x2D, 0x19, 0x1B, 0x17, 0x48, 0x2A, 0x3A, 0x49, 0x1E, 0x10, 0x10, 0x18,
+    0x02, 0x01, 0x02, 0x46, 0x09, 0x17, 0x0D, 0x0E, 0x17, 0x0E, 0x08, 0x0F,
+    0x0B, 0x09, 0x0A, 0x0E, 0x09, 0x5E, 0x0C, 0x14, 0x33, 0x2E, 0x24, 0x24,
+    0x0C, 0x0A, 0x15, 0x0A, 0x03, 0x07, 0x03, 0x00, 0x00, 0x02, 0x00, 0x0F,
+    0x02, 0x3A, 0x01, 0xE6, 0x03, 0x2F, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x41, 0x27, 0x37, 0x17, 0x05, 0x27, 0x37, 0x17, 0x01, 0x93, 0xA7, 0x6C,
+    0x8E, 0xFE, 0xDD, 0xB4, 0x65, 0x9C, 0x02, 0x3A, 0xA0, 0x55, 0xC7, 0x2A,
+    0x93, 0x5D, 0xBD, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x02, 0x60, 0x01, 0xB5,
+    0x03, 0x0E, 0x00, 0x0D, 0x00, 0x00, 0x53, 0x27, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0xB3, 0x74, 0x0F, 0x65,
+    0x47, 0x47, 0x65, 0x0F, 0x74, 0x09, 0x27, 0x17, 0x17, 0x27, 0x02, 0x60,
+    0x0C, 0x4C, 0x56, 0x56, 0x4C, 0x0C, 0x1C, 0x20, 0x20, 0x00, 0x00, 0x01,
+    0x00, 0x91, 0x02, 0x47, 0x01, 0x63, 0x03, 0x5D, 0x00, 0x15, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02, 0x15,
+    0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0xFC, 0x2C, 0x3F, 0x18,
+    0x2C, 0x3C, 0x22, 0x30, 0x0D, 0x27, 0x1D, 0x0F, 0x0C, 0x15, 0x15, 0x35,
+    0x02, 0x47, 0x35, 0x39, 0x1E, 0x32, 0x2A, 0x21, 0x0D, 0x3C, 0x04, 0x12,
+    0x18, 0x0E, 0x0A, 0x0A, 0x06, 0x09, 0x1C, 0x17, 0x25, 0x23, 0x00, 0x01,
+    0x00, 0x87, 0x01, 0xC8, 0x01, 0x6E, 0x02, 0xAB, 0x00, 0x08, 0x00, 0x00,
+    0x53, 0x35, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x87, 0x2E, 0x2D,
+    0x8C, 0x36, 0x66, 0x01, 0xC8, 0x71, 0x39, 0x39, 0x41, 0x66, 0x3C, 0x00,
+    0x00, 0x01, 0x00, 0x8B, 0xFF, 0x18, 0x01, 0x69, 0xFF, 0xD4, 0x00, 0x0B,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0xFA, 0x34, 0x3B, 0x3C, 0x33, 0x34, 0x3B, 0x3C, 0xE8, 0x31,
+    0x2D, 0x2A, 0x34, 0x31, 0x2D, 0x29, 0x35, 0x00, 0x00, 0x02, 0x00, 0x1A,
+    0xFF, 0x17, 0x01, 0xDB, 0xFF, 0xD4, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x01, 0x7C, 0x2E, 0x31, 0x33, 0x2C, 0x2D, 0x32, 0x33, 0xFE, 0xD1, 0x2E,
+    0x31, 0x33, 0x2C, 0x2D, 0x32, 0x33, 0xE9, 0x31, 0x2D, 0x2A, 0x35, 0x31,
+    0x2E, 0x29, 0x35, 0x31, 0x2D, 0x2A, 0x35, 0x31, 0x2E, 0x29, 0x35, 0x00,
+    0x00, 0x01, 0x00, 0x91, 0xFE, 0xC4, 0x01, 0x63, 0xFF, 0xDB, 0x00, 0x15,
+    0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x0E, 0x02, 0xC1, 0x30,
+    0x0E, 0x26, 0x1D, 0x0E, 0x0D, 0x16, 0x14, 0x35, 0x26, 0x2D, 0x3E, 0x16,
+    0x2B, 0x3C, 0xFE, 0xC4, 0x3C, 0x05, 0x12, 0x17, 0x0F, 0x09, 0x0A, 0x06,
+    0x0A, 0x1C, 0x16, 0x25, 0x24, 0x37, 0x38, 0x1D, 0x31, 0x2A, 0x22, 0x00,
+    0x00, 0x01, 0x00, 0x8A, 0xFF, 0x09, 0x01, 0x6B, 0x00, 0x18, 0x00, 0x14,
+    0x00, 0x00, 0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x27, 0x37, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x94, 0x0A,
+    0x13, 0x2A, 0x1D, 0x12, 0x1C, 0x10, 0x14, 0x44, 0x5C, 0x2F, 0x35, 0x33,
+    0x28, 0x41, 0x4A, 0xF6, 0x54, 0x08, 0x10, 0x0B, 0x0A, 0x0E, 0x06, 0x0F,
+    0x6A, 0x41, 0x05, 0x38, 0x25, 0x21, 0x2A, 0x19, 0x08, 0x00, 0x00, 0x01,
+    0x00, 0x7C, 0xFF, 0x28, 0x01, 0x78, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00,
+    0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02,
+    0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xFA, 0x24,
+    0x39, 0x21, 0x16, 0x2B, 0x42, 0x2D, 0x2A, 0x1A, 0x2D, 0x1B, 0x0E, 0x0B,
+    0x0A, 0x0D, 0x08, 0x4C, 0x0C, 0x25, 0x30, 0xD8, 0x1F, 0x34, 0x20, 0x1A,
+    0x2C, 0x25, 0x1F, 0x0B, 0x30, 0x06, 0x17, 0x1E, 0x11, 0x0B, 0x0E, 0x0C,
+    0x0C, 0x38, 0x13, 0x26, 0x1A, 0x00, 0x00, 0x01, 0x00, 0x3F, 0xFF, 0x14,
+    0x01, 0xB5, 0xFF, 0xC3, 0x00, 0x0D, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0xFA, 0x47,
+    0x65, 0x0F, 0x74, 0x09, 0x28, 0x16, 0x16, 0x28, 0x09, 0x74, 0x0F, 0x65,
+    0xEC, 0x57, 0x4C, 0x0C, 0x1D, 0x1F, 0x1F, 0x1D, 0x0C, 0x4C, 0x57, 0x00,
+    0x00, 0x01, 0x00, 0x5C, 0xFF, 0x31, 0x01, 0x98, 0xFF, 0xBA, 0x00, 0x03,
+    0x00, 0x00, 0x57, 0x35, 0x21, 0x15, 0x5C, 0x01, 0x3C, 0xCF, 0x89, 0x89,
+    0x00, 0x01, 0x00, 0x4A, 0x00, 0xE2, 0x01, 0xAA, 0x01, 0x66, 0x00, 0x03,
+    0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x4A, 0x01, 0x60, 0xE2, 0x84, 0x84,
+    0xFF, 0xFF, 0x00, 0x1A, 0x02, 0x6B, 0x01, 0xDB, 0x03, 0x27, 0x04, 0x06,
+    0x02, 0xF2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8F, 0x02, 0x71, 0x01, 0x65,
+    0x03, 0x27, 0x04, 0x06, 0x02, 0xF5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x72,
+    0x02, 0x3E, 0x01, 0x82, 0x03, 0x25, 0x04, 0x06, 0x02, 0xF7, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x72, 0x02, 0x3D, 0x01, 0x82, 0x03, 0x24, 0x04, 0x06,
+    0x02, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x02, 0x3A, 0x01, 0xE6,
+    0x03, 0x2F, 0x04, 0x06, 0x02, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2B,
+    0x02, 0x4E, 0x01, 0xC9, 0x03, 0x10, 0x04, 0x06, 0x02, 0xFC, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x2D, 0x02, 0x56, 0x01, 0xC7, 0x03, 0x18, 0x04, 0x06,
+    0x02, 0xFD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3F, 0x02, 0x56, 0x01, 0xB5,
+    0x03, 0x04, 0x04, 0x06, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x7C,
+    0x02, 0x54, 0x01, 0x78, 0x03, 0x47, 0x04, 0x06, 0x03, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x3C, 0x02, 0x5D, 0x01, 0xB8, 0x03, 0x00, 0x04, 0x06,
+    0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x47, 0x02, 0x76, 0x01, 0xAD,
+    0x02, 0xE7, 0x04, 0x06, 0x03, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x8A,
+    0xFF, 0x09, 0x01, 0x6B, 0x00, 0x18, 0x04, 0x06, 0x03, 0x11, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x7C, 0xFF, 0x28, 0x01, 0x78, 0x00, 0x30, 0x04, 0x06,
+    0x03, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1A, 0x02, 0xF0, 0x01, 0xDB,
+    0x03, 0xAC, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x41, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x21, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x7C, 0x2D, 0x31,
+    0x32, 0x2C, 0x2E, 0x31, 0x32, 0xFE, 0xCF, 0x2D, 0x31, 0x32, 0x2C, 0x2E,
+    0x31, 0x32, 0x02, 0xF0, 0x31, 0x2D, 0x28, 0x36, 0x31, 0x2D, 0x29, 0x35,
+    0x31, 0x2D, 0x28, 0x36, 0x31, 0x2D, 0x29, 0x35, 0x00, 0x03, 0x00, 0x1A,
+    0x02, 0xF0, 0x01, 0xDB, 0x04, 0x9C, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x1B,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x01, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x33, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x99, 0x29, 0xDD, 0x3A, 0xFE, 0xF1,
+    0x2D, 0x31, 0x32, 0x2C, 0x2E, 0x31, 0x32, 0xD7, 0x2D, 0x31, 0x32, 0x2C,
+    0x2E, 0x31, 0x32, 0x03, 0xCB, 0x5D, 0x74, 0x81, 0xFE, 0xD5, 0x31, 0x2D,
+    0x28, 0x36, 0x31, 0x2D, 0x29, 0x35, 0x31, 0x2D, 0x28, 0x36, 0x31, 0x2D,
+    0x29, 0x35, 0xFF, 0xFF, 0x00, 0x1A, 0x02, 0xF0, 0x01, 0xDB, 0x04, 0x56,
+    0x06, 0x26, 0x03, 0x23, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x00,
+    0x00, 0xD0, 0x00, 0x01, 0x00, 0x8F, 0x02, 0xF3, 0x01, 0x65, 0x03, 0xA8,
+    0x00, 0x0B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0xFA, 0x33, 0x38, 0x39, 0x32, 0x33, 0x38, 0x39,
+    0x02, 0xF3, 0x2F, 0x2C, 0x27, 0x33, 0x2F, 0x2B, 0x28, 0x33, 0xFF, 0xFF,
+    0x00, 0x41, 0x02, 0xF3, 0x01, 0xB4, 0x04, 0x56, 0x04, 0x26, 0x03, 0x26,
+    0x01, 0x00, 0x02, 0x07, 0x03, 0x3C, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x01,
+    0x00, 0x6F, 0x02, 0xE8, 0x01, 0x85, 0x03, 0xB9, 0x00, 0x03, 0x00, 0x00,
+    0x41, 0x27, 0x37, 0x17, 0x01, 0x5C, 0xED, 0x3A, 0xDC, 0x02, 0xE8, 0x50,
+    0x81, 0x73, 0x00, 0x01, 0x00, 0x6F, 0x02, 0xE8, 0x01, 0x85, 0x03, 0xB9,
+    0x00, 0x03, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x97, 0x28, 0xDC, 0x3A,
+    0x02, 0xE8, 0x5E, 0x73, 0x81, 0x00, 0x00, 0x02, 0x00, 0x27, 0x02, 0xF0,
+    0x01, 0xCE, 0x03, 0xCF, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x01, 0x4A, 0x4B, 0x5F, 0x70, 0xFE, 0xBA, 0x2E, 0x33, 0x34,
+    0x2D, 0x2D, 0x33, 0x34, 0x02, 0xF0, 0x2F, 0xB0, 0x4F, 0x90, 0x2B, 0x27,
+    0x24, 0x2E, 0x2B, 0x27, 0x24, 0x2E, 0x00, 0x02, 0x00, 0x09, 0x02, 0xF0,
+    0x01, 0xEB, 0x03, 0xD4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x17, 0x17, 0x27, 0x37, 0x17, 0x42, 0x39, 0x9F, 0x50, 0x32, 0x36,
+    0xA8, 0x4F, 0x02, 0xF3, 0x4F, 0x92, 0x6D, 0x77, 0x52, 0x8F, 0x72, 0x00,
+    0x00, 0x01, 0x00, 0x3C, 0x02, 0xF1, 0x01, 0xB8, 0x03, 0xA1, 0x00, 0x07,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x73, 0x37,
+    0x8E, 0x61, 0x8D, 0x36, 0x97, 0x1E, 0x02, 0xF1, 0x43, 0x6D, 0x6D, 0x43,
+    0x4A, 0x00, 0x00, 0x02, 0x00, 0x24, 0x02, 0xEC, 0x01, 0xD0, 0x04, 0x54,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07,
+    0x27, 0x33, 0x37, 0x27, 0x37, 0x17, 0x56, 0x32, 0x8D, 0x61, 0x8D, 0x33,
+    0x9A, 0x1E, 0x9C, 0x8A, 0x6A, 0x64, 0x02, 0xEC, 0x40, 0x67, 0x67, 0x40,
+    0x41, 0x4A, 0x91, 0x4C, 0xAD, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x02, 0xEC,
+    0x01, 0xFF, 0x04, 0x54, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x27, 0x37, 0x17, 0x30, 0x33,
+    0x8D, 0x61, 0x8D, 0x33, 0x99, 0x1D, 0xAC, 0x44, 0x64, 0x6A, 0x02, 0xEC,
+    0x40, 0x67, 0x67, 0x40, 0x41, 0x49, 0x31, 0xAD, 0x4D, 0x00, 0x00, 0x02,
+    0x00, 0x38, 0x02, 0xEC, 0x01, 0xBD, 0x04, 0x52, 0x00, 0x07, 0x00, 0x22,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x22,
+    0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06,
+    0x06, 0x6F, 0x32, 0x8D, 0x61, 0x8C, 0x32, 0x9A, 0x1E, 0x45, 0x16, 0x28,
+    0x16, 0x13, 0x19, 0x0A, 0x11, 0x12, 0x03, 0x66, 0x45, 0x37, 0x15, 0x21,
+    0x19, 0x10, 0x1A, 0x0A, 0x10, 0x0D, 0x03, 0x66, 0x1D, 0x31, 0x02, 0xEC,
+    0x40, 0x67, 0x67, 0x40, 0x41, 0x94, 0x0B, 0x08, 0x08, 0x09, 0x14, 0x11,
+    0x01, 0x41, 0x4D, 0x09, 0x0B, 0x07, 0x07, 0x14, 0x11, 0x02, 0x28, 0x41,
+    0x26, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0xEC, 0x01, 0xF4, 0x04, 0x5A,
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07,
+    0x27, 0x33, 0x37, 0x26, 0x26, 0x35, 0x36, 0x36, 0x37, 0x36, 0x36, 0x37,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x14, 0x17, 0x33, 0x33,
+    0x8E, 0x61, 0x8D, 0x33, 0x9A, 0x1E, 0x90, 0x09, 0x0B, 0x01, 0x09, 0x10,
+    0x09, 0x10, 0x01, 0x12, 0x10, 0x15, 0x2C, 0x17, 0x19, 0x15, 0x44, 0x27,
+    0x3D, 0x4D, 0x20, 0x14, 0x0F, 0x16, 0x01, 0x02, 0xEC, 0x40, 0x67, 0x67,
+    0x40, 0x41, 0x45, 0x09, 0x15, 0x0C, 0x0A, 0x12, 0x0B, 0x06, 0x0F, 0x07,
+    0x0A, 0x0B, 0x0D, 0x08, 0x5F, 0x0B, 0x11, 0x34, 0x2F, 0x21, 0x21, 0x0B,
+    0x08, 0x10, 0x0A, 0x02, 0x03, 0x02, 0x00, 0x01, 0x00, 0x3C, 0x02, 0xF2,
+    0x01, 0xB8, 0x03, 0xA2, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17,
+    0x23, 0x37, 0x17, 0x07, 0xC8, 0x8C, 0x36, 0x97, 0x1E, 0x97, 0x36, 0x8C,
+    0x02, 0xF2, 0x6D, 0x43, 0x4A, 0x4A, 0x43, 0x6D, 0x00, 0x01, 0x00, 0x3F,
+    0x02, 0xF8, 0x01, 0xB5, 0x03, 0xA3, 0x00, 0x0F, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0xFA, 0x2F, 0x4E, 0x34, 0x0A, 0x74, 0x09, 0x27, 0x17, 0x17, 0x27,
+    0x09, 0x74, 0x0A, 0x34, 0x4D, 0x02, 0xF8, 0x27, 0x48, 0x30, 0x0C, 0x1A,
+    0x1F, 0x1F, 0x1A, 0x0C, 0x30, 0x48, 0x27, 0x00, 0x00, 0x02, 0x00, 0x3F,
+    0x02, 0xE6, 0x01, 0xB5, 0x04, 0x57, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0xFA, 0x47, 0x65, 0x0F, 0x6D, 0x0C,
+    0x2B, 0x17, 0x17, 0x2B, 0x0C, 0x6D, 0x0F, 0x65, 0x4A, 0x8A, 0x6A, 0x64,
+    0x02, 0xE6, 0x4D, 0x45, 0x0C, 0x20, 0x15, 0x15, 0x20, 0x0C, 0x44, 0x4E,
+    0x94, 0x91, 0x4C, 0xAC, 0x00, 0x02, 0x00, 0x3F, 0x02, 0xE6, 0x01, 0xB5,
+    0x04, 0x57, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x27,
+    0x37, 0x17, 0xFA, 0x47, 0x65, 0x0F, 0x6D, 0x0C, 0x2B, 0x17, 0x17, 0x2B,
+    0x0C, 0x6D, 0x0F, 0x65, 0x3D, 0x44, 0x65, 0x6A, 0x02, 0xE6, 0x4E, 0x44,
+    0x0C, 0x20, 0x15, 0x15, 0x20, 0x0C, 0x44, 0x4E, 0x94, 0x31, 0xAC, 0x4C,
+    0x00, 0x02, 0x00, 0x38, 0x02, 0xE6, 0x01, 0xBD, 0x04, 0x52, 0x00, 0x0D,
+    0x00, 0x28, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06, 0x06, 0xFA, 0x47, 0x65,
+    0x0F, 0x6D, 0x0C, 0x2B, 0x17, 0x17, 0x2B, 0x0C, 0x6D, 0x0F, 0x65, 0x09,
+    0x13, 0x24, 0x19, 0x13, 0x19, 0x0A, 0x11, 0x12, 0x03, 0x66, 0x45, 0x37,
+    0x15, 0x25, 0x17, 0x10, 0x18, 0x0A, 0x10, 0x0D, 0x03, 0x66, 0x1D, 0x34,
+    0x02, 0xE6, 0x4D, 0x44, 0x0C, 0x1F, 0x15, 0x15, 0x1F, 0x0C, 0x44, 0x4D,
+    0xD9, 0x0A, 0x0B, 0x09, 0x09, 0x14, 0x12, 0x01, 0x42, 0x4F, 0x0C, 0x0B,
+    0x08, 0x09, 0x16, 0x12, 0x02, 0x28, 0x43, 0x26, 0x00, 0x02, 0x00, 0x3F,
+    0x02, 0xE6, 0x01, 0xB5, 0x04, 0x5E, 0x00, 0x0D, 0x00, 0x2D, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x37,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x06, 0x17, 0xFA, 0x47,
+    0x65, 0x0F, 0x6D, 0x0A, 0x2D, 0x17, 0x17, 0x2D, 0x0A, 0x6D, 0x0F, 0x65,
+    0x62, 0x0A, 0x0A, 0x09, 0x0E, 0x09, 0x11, 0x01, 0x13, 0x10, 0x15, 0x2C,
+    0x17, 0x18, 0x15, 0x44, 0x27, 0x3D, 0x4D, 0x21, 0x13, 0x0F, 0x16, 0x01,
+    0x01, 0x02, 0xE6, 0x4E, 0x44, 0x0C, 0x20, 0x15, 0x15, 0x20, 0x0C, 0x44,
+    0x4E, 0x90, 0x09, 0x15, 0x0B, 0x0B, 0x13, 0x09, 0x07, 0x0F, 0x07, 0x0A,
+    0x0A, 0x0B, 0x09, 0x5E, 0x0C, 0x11, 0x34, 0x2F, 0x22, 0x20, 0x0B, 0x08,
+    0x11, 0x0A, 0x01, 0x03, 0x03, 0x00, 0x00, 0x02, 0x00, 0x6C, 0x02, 0x9F,
+    0x01, 0x89, 0x03, 0xAC, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0xFB, 0x26, 0x41, 0x28, 0x27, 0x41, 0x27, 0x26, 0x41, 0x27,
+    0x27, 0x41, 0x26, 0x0F, 0x16, 0x16, 0x0F, 0x0F, 0x17, 0x17, 0x02, 0x9F,
+    0x24, 0x3B, 0x23, 0x26, 0x3F, 0x26, 0x26, 0x3F, 0x26, 0x23, 0x3B, 0x24,
+    0x5C, 0x16, 0x10, 0x11, 0x15, 0x16, 0x10, 0x10, 0x16, 0x00, 0x00, 0x01,
+    0x00, 0x36, 0x03, 0x00, 0x01, 0xBF, 0x03, 0x9B, 0x00, 0x1A, 0x00, 0x00,
+    0x41, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x27, 0x33,
+    0x14, 0x06, 0x06, 0x01, 0x49, 0x12, 0x26, 0x19, 0x13, 0x18, 0x0A, 0x0F,
+    0x10, 0x6E, 0x49, 0x3D, 0x10, 0x21, 0x1E, 0x11, 0x14, 0x09, 0x0D, 0x0D,
+    0x01, 0x6D, 0x1D, 0x36, 0x03, 0x00, 0x0B, 0x0B, 0x09, 0x09, 0x15, 0x12,
+    0x47, 0x53, 0x08, 0x0E, 0x09, 0x08, 0x16, 0x11, 0x2B, 0x47, 0x29, 0x00,
+    0xFF, 0xFF, 0x00, 0x19, 0x03, 0x00, 0x01, 0xDA, 0x04, 0x7C, 0x04, 0x26,
+    0x03, 0x38, 0xFF, 0x00, 0x02, 0x07, 0x03, 0x23, 0xFF, 0xFF, 0x00, 0xD0,
+    0xFF, 0xFF, 0x00, 0x35, 0x03, 0x00, 0x01, 0xBE, 0x04, 0x8A, 0x04, 0x26,
+    0x03, 0x38, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x01, 0x00, 0xD0,
+    0xFF, 0xFF, 0x00, 0x35, 0x03, 0x00, 0x01, 0xBE, 0x04, 0x56, 0x04, 0x26,
+    0x03, 0x38, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x3C, 0xFF, 0xFF, 0x00, 0xD0,
+    0x00, 0x01, 0x00, 0x41, 0x03, 0x15, 0x01, 0xB4, 0x03, 0x86, 0x00, 0x03,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x41, 0x01, 0x73, 0x03, 0x15, 0x71,
+    0x71, 0x00, 0xFF, 0xFF, 0x00, 0x19, 0x03, 0x15, 0x01, 0xDA, 0x04, 0x7C,
+    0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00, 0x02, 0x07, 0x03, 0x23, 0xFF, 0xFF,
+    0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x40, 0x03, 0x15, 0x01, 0xB3, 0x04, 0x8A,
+    0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x09,
+    0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x40, 0x03, 0x15, 0x01, 0xB3, 0x04, 0x8A,
+    0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x01,
+    0x00, 0xD0, 0x00, 0x01, 0x00, 0x74, 0x02, 0xE5, 0x01, 0x80, 0x03, 0xE0,
+    0x00, 0x1F, 0x00, 0x00, 0x53, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17,
+    0xE0, 0x08, 0x0D, 0x0E, 0x13, 0x0C, 0x12, 0x11, 0x0E, 0x16, 0x2D, 0x19,
+    0x1B, 0x17, 0x48, 0x2A, 0x3A, 0x49, 0x1E, 0x10, 0x10, 0x18, 0x02, 0x01,
+    0x02, 0xE5, 0x09, 0x16, 0x0D, 0x0E, 0x18, 0x0D, 0x09, 0x0E, 0x0B, 0x09,
+    0x0A, 0x0D, 0x0A, 0x5E, 0x0C, 0x14, 0x33, 0x2E, 0x24, 0x24, 0x0C, 0x0A,
+    0x14, 0x0A, 0x03, 0x07, 0x04, 0x00, 0x00, 0x02, 0x00, 0x0B, 0x02, 0xDF,
+    0x01, 0xE9, 0x03, 0xCB, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x05, 0x27, 0x37, 0x17, 0x01, 0xAA, 0xAC, 0x58, 0x93, 0xFE,
+    0xD9, 0xB7, 0x57, 0x9D, 0x02, 0xE3, 0x82, 0x66, 0x9E, 0x4E, 0x7E, 0x6B,
+    0x9B, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x02, 0xF9, 0x01, 0xB5, 0x03, 0xA4,
+    0x00, 0x0F, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0xB3, 0x74, 0x0A, 0x34, 0x4E,
+    0x2F, 0x30, 0x4D, 0x34, 0x0A, 0x74, 0x09, 0x27, 0x17, 0x17, 0x27, 0x02,
+    0xF9, 0x0C, 0x31, 0x47, 0x27, 0x27, 0x47, 0x31, 0x0C, 0x1A, 0x1F, 0x1F,
+    0x00, 0x01, 0x00, 0x87, 0x01, 0xA4, 0x01, 0x6E, 0x02, 0x9A, 0x00, 0x08,
+    0x00, 0x00, 0x53, 0x35, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x87,
+    0x2D, 0x2C, 0x8E, 0x37, 0x66, 0x01, 0xA4, 0x73, 0x42, 0x41, 0x47, 0x6F,
+    0x40, 0x00, 0x00, 0x01, 0x00, 0x91, 0xFE, 0xC4, 0x01, 0x63, 0xFF, 0xDA,
+    0x00, 0x15, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x0E, 0x02,
+    0xC1, 0x30, 0x0E, 0x26, 0x1D, 0x0E, 0x0D, 0x16, 0x14, 0x32, 0x25, 0x2F,
+    0x40, 0x16, 0x2B, 0x3C, 0xFE, 0xC4, 0x3C, 0x05, 0x12, 0x18, 0x0D, 0x0A,
+    0x09, 0x07, 0x0A, 0x1C, 0x16, 0x25, 0x23, 0x33, 0x37, 0x21, 0x37, 0x2B,
+    0x1F, 0x00, 0x00, 0x01, 0x00, 0x8A, 0xFF, 0x09, 0x01, 0x6B, 0x00, 0x18,
+    0x00, 0x14, 0x00, 0x00, 0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+    0x26, 0x23, 0x27, 0x37, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02,
+    0x94, 0x0A, 0x13, 0x2A, 0x1D, 0x12, 0x1C, 0x10, 0x14, 0x44, 0x5C, 0x2F,
+    0x35, 0x33, 0x28, 0x41, 0x4A, 0xF6, 0x54, 0x08, 0x10, 0x0B, 0x0A, 0x0E,
+    0x06, 0x0F, 0x6A, 0x41, 0x05, 0x38, 0x25, 0x21, 0x2A, 0x19, 0x08, 0x00,
+    0x00, 0x01, 0x00, 0x7C, 0xFF, 0x27, 0x01, 0x78, 0x00, 0x31, 0x00, 0x17,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17,
+    0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0xFA, 0x24, 0x39, 0x21, 0x18, 0x2D, 0x40, 0x27, 0x21, 0x17, 0x27, 0x17,
+    0x0D, 0x0B, 0x0B, 0x0E, 0x07, 0x4C, 0x11, 0x3F, 0xD9, 0x1C, 0x31, 0x20,
+    0x1A, 0x30, 0x28, 0x21, 0x0A, 0x31, 0x04, 0x17, 0x1E, 0x10, 0x0C, 0x10,
+    0x0B, 0x0C, 0x38, 0x24, 0x2F, 0x00, 0xFF, 0xFF, 0x00, 0x30, 0x01, 0xB2,
+    0x00, 0xFB, 0x02, 0xBC, 0x06, 0x06, 0x02, 0xA0, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0x01, 0x9A, 0x01, 0x07, 0x02, 0xF0, 0x06, 0x06, 0x02, 0x99,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x2B, 0x02, 0x04, 0x00, 0xA9, 0x02, 0xF7,
+    0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xA9, 0x22, 0x39, 0x23,
+    0x22, 0x39, 0x22, 0x01, 0x0E, 0x12, 0x12, 0x0E, 0x02, 0x04, 0x21, 0x37,
+    0x21, 0x22, 0x37, 0x21, 0x5A, 0x12, 0x0E, 0x0E, 0x11, 0x00, 0x00, 0x01,
+    0x00, 0x30, 0x02, 0x04, 0x00, 0xAD, 0x02, 0xF7, 0x00, 0x0F, 0x00, 0x00,
+    0x53, 0x35, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x35, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x30, 0x0D, 0x12, 0x12, 0x0D, 0x22, 0x39, 0x22,
+    0x23, 0x38, 0x02, 0x04, 0x5A, 0x11, 0x0E, 0x0E, 0x12, 0x5A, 0x21, 0x37,
+    0x22, 0x21, 0x37, 0x21, 0x00, 0x01, 0x00, 0x3D, 0xFF, 0x6D, 0x00, 0xCA,
+    0x00, 0xC5, 0x00, 0x03, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x3D, 0x8D,
+    0x93, 0x01, 0x58, 0xFE, 0xA8, 0x00, 0x00, 0x01, 0x00, 0x43, 0x01, 0x70,
+    0x00, 0xA4, 0x02, 0xC8, 0x00, 0x03, 0x00, 0x00, 0x53, 0x11, 0x33, 0x11,
+    0x43, 0x61, 0x01, 0x70, 0x01, 0x58, 0xFE, 0xA8};
+
+unsigned int lexend_bold_size = 78716;
+
+} // namespace tvk
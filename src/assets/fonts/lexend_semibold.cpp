@@ -0,0 +1,6577 @@
+/**
+ * @file lexend_semibold.cpp
+ * @brief Embedded Lexend SemiBold font data
+ */
+
+#include "tinyvk/assets/fonts.h"
+
+namespace tvk {
+
+unsigned char lexend_semibold[] = {
+
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x47, 0x44, 0x45, 0x46, 0x4F, 0x8C, 0x4C, 0xCF, 0x00, 0x00, 0x02, 0x24,
+    0x00, 0x00, 0x01, 0x30, 0x47, 0x50, 0x4F, 0x53, 0x3A, 0x73, 0x9D, 0xBA,
+    0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x50, 0xF0, 0x47, 0x53, 0x55, 0x42,
+    0xD0, 0x82, 0x6E, 0x2A, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 0x0C, 0xF8,
+    0x4F, 0x53, 0x2F, 0x32, 0x83, 0x7C, 0x57, 0x6E, 0x00, 0x00, 0x01, 0xC4,
+    0x00, 0x00, 0x00, 0x60, 0x53, 0x54, 0x41, 0x54, 0x79, 0x96, 0x6A, 0xE5,
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x2A, 0x63, 0x6D, 0x61, 0x70,
+    0x77, 0x18, 0x90, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x08, 0x16,
+    0x67, 0x61, 0x73, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x08, 0x67, 0x6C, 0x79, 0x66, 0x1B, 0xB1, 0x85, 0x59,
+    0x00, 0x00, 0xA0, 0x10, 0x00, 0x00, 0x93, 0x86, 0x68, 0x65, 0x61, 0x64,
+    0x1B, 0x18, 0x86, 0xC2, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x00, 0x36,
+    0x68, 0x68, 0x65, 0x61, 0x08, 0x8C, 0x06, 0x1A, 0x00, 0x00, 0x01, 0x3C,
+    0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78, 0x15, 0xF5, 0x9A, 0x47,
+    0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0D, 0x34, 0x6C, 0x6F, 0x63, 0x61,
+    0xED, 0x61, 0x10, 0xF7, 0x00, 0x00, 0x09, 0x54, 0x00, 0x00, 0x06, 0x9C,
+    0x6D, 0x61, 0x78, 0x70, 0x03, 0x61, 0x00, 0xD2, 0x00, 0x00, 0x01, 0x1C,
+    0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0xBA, 0xB0, 0xF6, 0x75,
+    0x00, 0x00, 0x03, 0x54, 0x00, 0x00, 0x05, 0xFE, 0x70, 0x6F, 0x73, 0x74,
+    0x0C, 0x72, 0x98, 0x72, 0x00, 0x00, 0x32, 0x34, 0x00, 0x00, 0x1C, 0xEB,
+    0x70, 0x72, 0x65, 0x70, 0x68, 0x06, 0x8C, 0x85, 0x00, 0x00, 0x01, 0x0C,
+    0x00, 0x00, 0x00, 0x07, 0xB8, 0x01, 0xFF, 0x85, 0xB0, 0x04, 0x8D, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x4D, 0x00, 0x64, 0x00, 0x07, 0x00, 0x6C, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0xE8, 0xFF, 0x06,
+    0x00, 0x00, 0x05, 0xB4, 0xFF, 0x2B, 0xFE, 0x12, 0x05, 0x76, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x4D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x02,
+    0x77, 0x67, 0x68, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xCB, 0x1C, 0xB3, 0xE4, 0x64,
+    0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x03, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0xDA, 0x36, 0x6A, 0x60, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x29, 0xD6, 0x62,
+    0xFF, 0x2B, 0xFE, 0xEB, 0x05, 0x76, 0x04, 0x67, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x4C,
+    0x02, 0x58, 0x00, 0x05, 0x00, 0x00, 0x02, 0x8A, 0x02, 0x58, 0x00, 0x00,
+    0x00, 0x4B, 0x02, 0x8A, 0x02, 0x58, 0x00, 0x00, 0x01, 0x5E, 0x00, 0x32,
+    0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x20, 0x5B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x4F, 0x4E, 0x45, 0x00, 0xC0,
+    0x00, 0x0D, 0xFB, 0x02, 0x03, 0xE8, 0xFF, 0x06, 0x00, 0x00, 0x04, 0xB0,
+    0x01, 0x86, 0x20, 0x00, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D,
+    0x02, 0xBC, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0xBA, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x02, 0x03, 0x0D,
+    0x03, 0x43, 0x00, 0x02, 0x00, 0x03, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00,
+    0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11, 0x03, 0x23, 0x03, 0x42, 0x00, 0x22,
+    0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x13, 0x03, 0x14, 0x03, 0x44, 0x03, 0x45, 0x00, 0x12, 0x00, 0x07,
+    0x00, 0x5E, 0x00, 0x50, 0x00, 0x42, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x24,
+    0x00, 0x1C, 0x00, 0x02, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x54, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x01, 0x5A, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0xE7,
+    0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01, 0x02, 0xCB, 0x00, 0x01,
+    0x01, 0x66, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01, 0x03, 0x72,
+    0x00, 0x01, 0x01, 0xB9, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01,
+    0x02, 0xC3, 0x00, 0x01, 0x01, 0x62, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01,
+    0x01, 0x83, 0x00, 0x02, 0x00, 0x13, 0x00, 0x01, 0x00, 0x7A, 0x00, 0x01,
+    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x01, 0x00, 0x80, 0x01, 0x2B, 0x00, 0x01,
+    0x01, 0x2D, 0x01, 0x48, 0x00, 0x01, 0x01, 0x4A, 0x01, 0x68, 0x00, 0x01,
+    0x01, 0x6A, 0x01, 0x80, 0x00, 0x01, 0x01, 0x82, 0x01, 0x84, 0x00, 0x01,
+    0x01, 0x86, 0x02, 0x18, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x02,
+    0x02, 0xB5, 0x02, 0xB5, 0x00, 0x01, 0x02, 0xB7, 0x02, 0xB7, 0x00, 0x01,
+    0x02, 0xB9, 0x02, 0xB9, 0x00, 0x01, 0x02, 0xBE, 0x02, 0xBE, 0x00, 0x01,
+    0x02, 0xC4, 0x02, 0xC6, 0x00, 0x01, 0x02, 0xCA, 0x02, 0xCA, 0x00, 0x01,
+    0x02, 0xDE, 0x02, 0xDE, 0x00, 0x01, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x03,
+    0x02, 0xFC, 0x03, 0x15, 0x00, 0x03, 0x03, 0x23, 0x03, 0x46, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x23, 0x01, 0xAA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x00, 0x00, 0xA2, 0x03, 0xB2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x01, 0x00, 0x1E, 0x03, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x02, 0x00, 0x0E, 0x03, 0x86, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x03, 0x00, 0x34, 0x03, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x04, 0x00, 0x1E, 0x03, 0x94, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x05, 0x00, 0x1A, 0x03, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x06, 0x00, 0x1E, 0x03, 0x1A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x08, 0x00, 0x0C, 0x03, 0x0E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x09, 0x00, 0x44, 0x02, 0xCA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0B, 0x00, 0x2C, 0x02, 0x9E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0C, 0x00, 0x2C, 0x02, 0x9E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0D, 0x01, 0x22, 0x01, 0x7C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x0E, 0x00, 0x36, 0x01, 0x46, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x10, 0x00, 0x0C, 0x03, 0x0E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x11, 0x00, 0x10, 0x01, 0x36, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x19, 0x00, 0x0C, 0x03, 0x0E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x00, 0x00, 0x0C, 0x01, 0x2A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x02, 0x00, 0x08, 0x01, 0x22, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x03, 0x00, 0x14, 0x01, 0x0E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x04, 0x00, 0x0A, 0x01, 0x04, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x05, 0x00, 0x0E, 0x03, 0x86, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x06, 0x00, 0x0C, 0x00, 0xF8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x07, 0x00, 0x10, 0x01, 0x36, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x08, 0x00, 0x08, 0x00, 0xF0, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x09, 0x00, 0x12, 0x00, 0xDE, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0A, 0x00, 0x0A, 0x00, 0xD4, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0B, 0x00, 0x16, 0x00, 0xBE, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0C, 0x00, 0x22, 0x00, 0x9C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0D, 0x00, 0x18, 0x00, 0x84, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0E, 0x00, 0x1C, 0x00, 0x68, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x0F, 0x00, 0x1A, 0x00, 0x4E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x10, 0x00, 0x1E, 0x03, 0x1A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x11, 0x00, 0x16, 0x00, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x12, 0x00, 0x20, 0x00, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x01, 0x13, 0x00, 0x18, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6C,
+    0x00, 0x61, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78,
+    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C,
+    0x00, 0x64, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64,
+    0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x2D, 0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75,
+    0x00, 0x6D, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75,
+    0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x4C, 0x00, 0x69,
+    0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78,
+    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69,
+    0x00, 0x6E, 0x00, 0x42, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63, 0x00, 0x6B,
+    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x42,
+    0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C,
+    0x00, 0x64, 0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75,
+    0x00, 0x6D, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C,
+    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x54, 0x00, 0x68,
+    0x00, 0x69, 0x00, 0x6E, 0x00, 0x57, 0x00, 0x65, 0x00, 0x69, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69,
+    0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F,
+    0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70, 0x00, 0x74,
+    0x00, 0x73, 0x00, 0x2E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x2E,
+    0x00, 0x6F, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2F, 0x00, 0x4F, 0x00, 0x46,
+    0x00, 0x4C, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20,
+    0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x53,
+    0x00, 0x6F, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77, 0x00, 0x61, 0x00, 0x72,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6C,
+    0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65,
+    0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x65,
+    0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20,
+    0x00, 0x53, 0x00, 0x49, 0x00, 0x4C, 0x00, 0x20, 0x00, 0x4F, 0x00, 0x70,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E,
+    0x00, 0x74, 0x00, 0x20, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x56,
+    0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E,
+    0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x20,
+    0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x6C,
+    0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65,
+    0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20, 0x00, 0x61, 0x00, 0x76,
+    0x00, 0x61, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x62, 0x00, 0x6C,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68,
+    0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46, 0x00, 0x41, 0x00, 0x51,
+    0x00, 0x20, 0x00, 0x61, 0x00, 0x74, 0x00, 0x3A, 0x00, 0x20, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F,
+    0x00, 0x2F, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69, 0x00, 0x70,
+    0x00, 0x74, 0x00, 0x73, 0x00, 0x2E, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6C,
+    0x00, 0x2E, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2F, 0x00, 0x4F,
+    0x00, 0x46, 0x00, 0x4C, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70,
+    0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x77, 0x00, 0x77,
+    0x00, 0x77, 0x00, 0x2E, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x64, 0x00, 0x2E, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D,
+    0x00, 0x42, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x6E, 0x00, 0x69, 0x00, 0x65,
+    0x00, 0x20, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61, 0x00, 0x76, 0x00, 0x65,
+    0x00, 0x72, 0x00, 0x2D, 0x00, 0x54, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x75,
+    0x00, 0x70, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x6F,
+    0x00, 0x6D, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x4A, 0x00, 0x6F,
+    0x00, 0x63, 0x00, 0x6B, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x4C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x4C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x53,
+    0x00, 0x65, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C,
+    0x00, 0x64, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
+    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30,
+    0x00, 0x30, 0x00, 0x37, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x4E, 0x00, 0x45,
+    0x00, 0x3B, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69,
+    0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x52, 0x00, 0x65,
+    0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20,
+    0x00, 0x53, 0x00, 0x65, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6F,
+    0x00, 0x6C, 0x00, 0x64, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x70, 0x00, 0x79,
+    0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x20,
+    0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x20, 0x00, 0x54,
+    0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78,
+    0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72,
+    0x00, 0x6F, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63, 0x00, 0x74, 0x00, 0x20,
+    0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68, 0x00, 0x6F, 0x00, 0x72,
+    0x00, 0x73, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74,
+    0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x67,
+    0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75, 0x00, 0x62, 0x00, 0x2E,
+    0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x2F, 0x00, 0x67, 0x00, 0x6F,
+    0x00, 0x6F, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x66, 0x00, 0x6F,
+    0x00, 0x6E, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2F, 0x00, 0x6C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x29, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x00, 0x5E, 0x00, 0x69, 0x00, 0x74, 0x00, 0x7F,
+    0x00, 0x8D, 0x00, 0x98, 0x00, 0xA3, 0x00, 0xAE, 0x00, 0xB9, 0x00, 0xC4,
+    0x00, 0xD0, 0x00, 0xDE, 0x00, 0xEA, 0x00, 0xF6, 0x01, 0x01, 0x01, 0x0C,
+    0x01, 0x17, 0x01, 0x22, 0x01, 0x2D, 0x01, 0x38, 0x01, 0x43, 0x01, 0x4E,
+    0x01, 0x5A, 0x01, 0x65, 0x01, 0x74, 0x01, 0x7F, 0x01, 0xA2, 0x01, 0xAE,
+    0x01, 0xEA, 0x02, 0x22, 0x02, 0x2E, 0x02, 0x3A, 0x02, 0x46, 0x02, 0x56,
+    0x02, 0x62, 0x02, 0x6E, 0x02, 0x99, 0x02, 0xA5, 0x02, 0xB5, 0x02, 0xE8,
+    0x02, 0xF4, 0x02, 0xFC, 0x03, 0x08, 0x03, 0x14, 0x03, 0x20, 0x03, 0x30,
+    0x03, 0x49, 0x03, 0x54, 0x03, 0x5F, 0x03, 0x6A, 0x03, 0x78, 0x03, 0x83,
+    0x03, 0x8F, 0x03, 0x9D, 0x03, 0xA8, 0x03, 0xB4, 0x03, 0xBF, 0x03, 0xCA,
+    0x03, 0xD5, 0x03, 0xE0, 0x03, 0xEB, 0x03, 0xF6, 0x04, 0x01, 0x04, 0x0C,
+    0x04, 0x17, 0x04, 0x26, 0x04, 0x35, 0x04, 0x41, 0x04, 0x4C, 0x04, 0x66,
+    0x04, 0xA9, 0x04, 0xB5, 0x04, 0xC1, 0x04, 0xCD, 0x04, 0xD9, 0x04, 0xE5,
+    0x04, 0xF1, 0x05, 0x0B, 0x05, 0x37, 0x05, 0x43, 0x05, 0x4F, 0x05, 0x5B,
+    0x05, 0x70, 0x05, 0x7C, 0x05, 0x87, 0x05, 0x92, 0x05, 0x9D, 0x05, 0xA8,
+    0x05, 0xB3, 0x05, 0xBE, 0x05, 0xC9, 0x05, 0xD4, 0x05, 0xDF, 0x05, 0xEA,
+    0x05, 0xF5, 0x06, 0x00, 0x06, 0x0B, 0x06, 0x16, 0x06, 0x21, 0x06, 0x4B,
+    0x06, 0x57, 0x06, 0x75, 0x06, 0x80, 0x06, 0x8F, 0x06, 0x9B, 0x06, 0xA6,
+    0x06, 0xB2, 0x06, 0xBD, 0x06, 0xC9, 0x06, 0xD4, 0x06, 0xE0, 0x06, 0xEB,
+    0x07, 0x03, 0x07, 0x29, 0x07, 0x35, 0x07, 0x5B, 0x07, 0x67, 0x07, 0x73,
+    0x07, 0x7F, 0x07, 0x8B, 0x07, 0x97, 0x07, 0xA3, 0x07, 0xD1, 0x07, 0xDD,
+    0x07, 0xE9, 0x07, 0xF5, 0x08, 0x2A, 0x08, 0x64, 0x08, 0x70, 0x08, 0x7C,
+    0x08, 0x88, 0x08, 0x94, 0x08, 0xA0, 0x08, 0xB0, 0x08, 0xBC, 0x08, 0xC8,
+    0x08, 0xD4, 0x08, 0xDF, 0x08, 0xEB, 0x08, 0xFB, 0x09, 0x0B, 0x09, 0x17,
+    0x09, 0x23, 0x09, 0x2F, 0x09, 0x7E, 0x09, 0x8A, 0x09, 0x96, 0x09, 0xA2,
+    0x09, 0xAE, 0x09, 0xBA, 0x09, 0xC6, 0x09, 0xD2, 0x09, 0xDE, 0x09, 0xEE,
+    0x09, 0xFE, 0x0A, 0x58, 0x0A, 0x9A, 0x0A, 0xA6, 0x0A, 0xB2, 0x0A, 0xC2,
+    0x0A, 0xD2, 0x0A, 0xE2, 0x0B, 0x15, 0x0B, 0x3B, 0x0B, 0x62, 0x0B, 0xA5,
+    0x0B, 0xD3, 0x0B, 0xDE, 0x0B, 0xE9, 0x0B, 0xF4, 0x0B, 0xFF, 0x0C, 0x0A,
+    0x0C, 0x15, 0x0C, 0x20, 0x0C, 0x6E, 0x0C, 0x79, 0x0C, 0x84, 0x0C, 0x8F,
+    0x0C, 0x9E, 0x0C, 0xA9, 0x0C, 0xB4, 0x0C, 0xBF, 0x0C, 0xCA, 0x0C, 0xD5,
+    0x0C, 0xE3, 0x0D, 0x3A, 0x0D, 0x78, 0x0D, 0x89, 0x0D, 0xA1, 0x0D, 0xAC,
+    0x0D, 0xB7, 0x0D, 0xC2, 0x0D, 0xCD, 0x0D, 0xD8, 0x0D, 0xFC, 0x0E, 0x08,
+    0x0E, 0x14, 0x0E, 0x20, 0x0E, 0x2C, 0x0E, 0x37, 0x0E, 0x43, 0x0E, 0x4F,
+    0x0E, 0x5B, 0x0E, 0x67, 0x0E, 0x97, 0x0E, 0xA3, 0x0E, 0xAF, 0x0E, 0xBB,
+    0x0E, 0xC7, 0x0E, 0xD3, 0x0E, 0xDF, 0x0E, 0xEB, 0x0E, 0xF7, 0x0F, 0x07,
+    0x0F, 0x4B, 0x0F, 0x57, 0x0F, 0x63, 0x0F, 0x73, 0x0F, 0x94, 0x0F, 0xCE,
+    0x0F, 0xDA, 0x0F, 0xE6, 0x0F, 0xF2, 0x0F, 0xFE, 0x10, 0x21, 0x10, 0x3C,
+    0x10, 0x47, 0x10, 0x52, 0x10, 0x5D, 0x10, 0x68, 0x10, 0x73, 0x10, 0x7E,
+    0x10, 0x89, 0x10, 0x94, 0x10, 0x9F, 0x10, 0xB8, 0x10, 0xC3, 0x10, 0xCE,
+    0x10, 0xD9, 0x10, 0xE4, 0x10, 0xF7, 0x11, 0x06, 0x11, 0x12, 0x11, 0x1D,
+    0x11, 0x28, 0x11, 0x33, 0x11, 0x3E, 0x11, 0x4A, 0x11, 0x55, 0x11, 0x60,
+    0x11, 0x6B, 0x11, 0x76, 0x11, 0x81, 0x11, 0x8C, 0x11, 0x97, 0x11, 0xA2,
+    0x11, 0xAE, 0x11, 0xB9, 0x11, 0xDD, 0x11, 0xE9, 0x11, 0xF5, 0x12, 0x01,
+    0x12, 0x3E, 0x12, 0x49, 0x12, 0x54, 0x12, 0x5F, 0x12, 0x6D, 0x12, 0x78,
+    0x12, 0x83, 0x12, 0x8E, 0x12, 0x99, 0x12, 0xA4, 0x12, 0xB0, 0x12, 0xBE,
+    0x12, 0xC9, 0x12, 0xD5, 0x12, 0xE0, 0x12, 0xEB, 0x12, 0xF6, 0x13, 0x01,
+    0x13, 0x0C, 0x13, 0x17, 0x13, 0x22, 0x13, 0x2D, 0x13, 0x39, 0x13, 0x44,
+    0x13, 0x53, 0x13, 0x5E, 0x13, 0xD4, 0x13, 0xE0, 0x14, 0x1E, 0x14, 0x50,
+    0x14, 0x5B, 0x14, 0x66, 0x14, 0x71, 0x14, 0x7F, 0x14, 0x8A, 0x14, 0x95,
+    0x14, 0xD3, 0x15, 0x25, 0x15, 0x31, 0x15, 0x76, 0x15, 0x81, 0x15, 0x8C,
+    0x15, 0x9C, 0x15, 0xD8, 0x15, 0xE3, 0x15, 0xEE, 0x15, 0xF9, 0x16, 0x07,
+    0x16, 0x12, 0x16, 0x1D, 0x16, 0x2B, 0x16, 0x36, 0x16, 0x41, 0x16, 0x4C,
+    0x16, 0x57, 0x16, 0x62, 0x16, 0x6D, 0x16, 0x78, 0x16, 0x83, 0x16, 0x8E,
+    0x16, 0x99, 0x16, 0xA4, 0x16, 0xAF, 0x16, 0xBA, 0x17, 0x14, 0x17, 0x1F,
+    0x17, 0x59, 0x17, 0x81, 0x17, 0xD3, 0x17, 0xDE, 0x17, 0xE9, 0x17, 0xF4,
+    0x17, 0xFF, 0x18, 0x0A, 0x18, 0x15, 0x18, 0x41, 0x18, 0x74, 0x18, 0x7F,
+    0x18, 0x8A, 0x18, 0x95, 0x18, 0xB1, 0x18, 0xBD, 0x18, 0xC9, 0x18, 0xD5,
+    0x18, 0xE1, 0x18, 0xED, 0x18, 0xF9, 0x19, 0x05, 0x19, 0x11, 0x19, 0x1D,
+    0x19, 0x28, 0x19, 0x34, 0x19, 0x40, 0x19, 0x4C, 0x19, 0x58, 0x19, 0x64,
+    0x19, 0x74, 0x19, 0x80, 0x19, 0xA7, 0x19, 0xBE, 0x19, 0xC9, 0x19, 0xE5,
+    0x19, 0xF0, 0x1A, 0x0C, 0x1A, 0x18, 0x1A, 0x23, 0x1A, 0x2E, 0x1A, 0x39,
+    0x1A, 0x45, 0x1A, 0x50, 0x1A, 0x5C, 0x1A, 0x67, 0x1A, 0x7C, 0x1A, 0xC3,
+    0x1A, 0xCF, 0x1A, 0xFB, 0x1B, 0x06, 0x1B, 0x11, 0x1B, 0x1C, 0x1B, 0x27,
+    0x1B, 0x32, 0x1B, 0x3D, 0x1B, 0x72, 0x1B, 0x7E, 0x1B, 0x89, 0x1B, 0x94,
+    0x1B, 0xC6, 0x1B, 0xFA, 0x1C, 0x05, 0x1C, 0x10, 0x1C, 0x1B, 0x1C, 0x26,
+    0x1C, 0x32, 0x1C, 0x40, 0x1C, 0x4B, 0x1C, 0x56, 0x1C, 0x61, 0x1C, 0x6C,
+    0x1C, 0x77, 0x1C, 0x86, 0x1C, 0x95, 0x1C, 0xA0, 0x1C, 0xAB, 0x1C, 0xB6,
+    0x1C, 0xFC, 0x1D, 0x07, 0x1D, 0x12, 0x1D, 0x1D, 0x1D, 0x28, 0x1D, 0x33,
+    0x1D, 0x3E, 0x1D, 0x49, 0x1D, 0x54, 0x1D, 0x5F, 0x1D, 0x6A, 0x1D, 0xBC,
+    0x1D, 0xF8, 0x1E, 0x03, 0x1E, 0x0E, 0x1E, 0x19, 0x1E, 0x24, 0x1E, 0x33,
+    0x1E, 0x9D, 0x1E, 0xD9, 0x1F, 0x16, 0x1F, 0x55, 0x1F, 0x79, 0x1F, 0x84,
+    0x1F, 0x8F, 0x1F, 0x9A, 0x1F, 0xA5, 0x1F, 0xB0, 0x1F, 0xBB, 0x1F, 0xC6,
+    0x20, 0x1B, 0x20, 0x26, 0x20, 0x31, 0x20, 0x3C, 0x20, 0x47, 0x20, 0x52,
+    0x20, 0x5D, 0x20, 0x68, 0x20, 0x73, 0x20, 0x7E, 0x20, 0x8C, 0x20, 0xDC,
+    0x20, 0xEF, 0x21, 0x08, 0x21, 0x14, 0x21, 0x1F, 0x21, 0x2A, 0x21, 0x35,
+    0x21, 0x40, 0x21, 0x4B, 0x21, 0x74, 0x21, 0x7F, 0x21, 0x8A, 0x21, 0x95,
+    0x21, 0xA0, 0x21, 0xAB, 0x21, 0xB6, 0x21, 0xC1, 0x21, 0xCC, 0x21, 0xD7,
+    0x22, 0x0D, 0x22, 0x18, 0x22, 0x23, 0x22, 0x2E, 0x22, 0x39, 0x22, 0x44,
+    0x22, 0x4F, 0x22, 0x5A, 0x22, 0x65, 0x22, 0x74, 0x22, 0x80, 0x22, 0x8B,
+    0x22, 0x96, 0x22, 0xA1, 0x22, 0xB5, 0x22, 0xD6, 0x22, 0xE2, 0x22, 0xEE,
+    0x22, 0xFA, 0x23, 0x06, 0x23, 0x28, 0x23, 0x4B, 0x23, 0x56, 0x23, 0x61,
+    0x23, 0x6C, 0x23, 0x77, 0x23, 0x83, 0x23, 0x8E, 0x23, 0x99, 0x23, 0xA4,
+    0x23, 0xAF, 0x23, 0xC7, 0x23, 0xD2, 0x23, 0xDD, 0x23, 0xE8, 0x23, 0xF3,
+    0x24, 0x07, 0x24, 0x4C, 0x24, 0x57, 0x24, 0x62, 0x24, 0x6D, 0x24, 0x7B,
+    0x24, 0x86, 0x24, 0x91, 0x24, 0x9C, 0x24, 0xA7, 0x24, 0xB2, 0x24, 0xBD,
+    0x24, 0xCB, 0x24, 0xD6, 0x24, 0xE1, 0x24, 0xEC, 0x24, 0xF7, 0x25, 0x02,
+    0x25, 0x0D, 0x25, 0x18, 0x25, 0x23, 0x25, 0x2E, 0x25, 0x39, 0x25, 0x45,
+    0x25, 0x50, 0x25, 0x5F, 0x25, 0x6A, 0x25, 0xE1, 0x25, 0xEC, 0x25, 0xF7,
+    0x26, 0x02, 0x26, 0x0D, 0x26, 0x18, 0x26, 0x23, 0x26, 0x2F, 0x26, 0x3F,
+    0x26, 0x53, 0x26, 0x63, 0x26, 0x73, 0x26, 0x7F, 0x26, 0x8B, 0x26, 0xC2,
+    0x26, 0xF4, 0x26, 0xFC, 0x27, 0x04, 0x27, 0x0C, 0x27, 0x28, 0x27, 0x54,
+    0x27, 0x6D, 0x27, 0xA1, 0x27, 0xE0, 0x27, 0xFA, 0x28, 0x36, 0x28, 0x7C,
+    0x28, 0x90, 0x28, 0xF4, 0x29, 0x35, 0x29, 0x41, 0x29, 0x6E, 0x29, 0x84,
+    0x29, 0xB2, 0x29, 0xE8, 0x2A, 0x09, 0x2A, 0x3E, 0x2A, 0x7B, 0x2A, 0x8E,
+    0x2A, 0xDD, 0x2B, 0x1B, 0x2B, 0x24, 0x2B, 0x2D, 0x2B, 0x36, 0x2B, 0x3F,
+    0x2B, 0x48, 0x2B, 0x51, 0x2B, 0x5A, 0x2B, 0x63, 0x2B, 0x6C, 0x2B, 0x75,
+    0x2B, 0x7E, 0x2B, 0x87, 0x2B, 0x90, 0x2B, 0x99, 0x2B, 0xA2, 0x2B, 0xAB,
+    0x2B, 0xB4, 0x2B, 0xBD, 0x2B, 0xC6, 0x2B, 0xCF, 0x2B, 0xD8, 0x2B, 0xE1,
+    0x2B, 0xEA, 0x2B, 0xF3, 0x2B, 0xFC, 0x2C, 0x05, 0x2C, 0x0E, 0x2C, 0x17,
+    0x2C, 0x20, 0x2C, 0x29, 0x2C, 0x37, 0x2C, 0x47, 0x2C, 0x57, 0x2C, 0x67,
+    0x2C, 0x77, 0x2C, 0x87, 0x2C, 0x98, 0x2C, 0xA8, 0x2C, 0xA8, 0x2C, 0xA8,
+    0x2C, 0xA8, 0x2C, 0xA8, 0x2C, 0xA8, 0x2C, 0xA8, 0x2C, 0xA8, 0x2C, 0xA8,
+    0x2C, 0xBE, 0x2C, 0xE2, 0x2C, 0xEE, 0x2C, 0xFA, 0x2D, 0x0A, 0x2D, 0x30,
+    0x2D, 0x57, 0x2D, 0x93, 0x2D, 0xD0, 0x2D, 0xD9, 0x2D, 0xF5, 0x2E, 0x20,
+    0x2E, 0x43, 0x2E, 0x52, 0x2E, 0x61, 0x2E, 0x6A, 0x2E, 0x72, 0x2E, 0x7A,
+    0x2E, 0x82, 0x2E, 0x8B, 0x2E, 0x94, 0x2E, 0xA0, 0x2E, 0xA8, 0x2E, 0xB4,
+    0x2E, 0xC0, 0x2E, 0xC8, 0x2E, 0xD0, 0x2E, 0xD8, 0x2E, 0xE4, 0x2E, 0xEC,
+    0x2E, 0xF4, 0x2E, 0xFC, 0x2F, 0x17, 0x2F, 0x31, 0x2F, 0x6A, 0x2F, 0xA3,
+    0x2F, 0xB7, 0x2F, 0xCB, 0x2F, 0xD3, 0x2F, 0xDB, 0x2F, 0xE3, 0x2F, 0xEB,
+    0x2F, 0xF3, 0x2F, 0xFB, 0x30, 0x03, 0x30, 0x0F, 0x30, 0x1B, 0x30, 0x27,
+    0x30, 0x4C, 0x30, 0x70, 0x30, 0x7C, 0x30, 0x88, 0x30, 0x9B, 0x30, 0xAE,
+    0x30, 0xC4, 0x30, 0xD2, 0x30, 0xDE, 0x30, 0xEA, 0x30, 0xF2, 0x30, 0xFA,
+    0x31, 0x31, 0x31, 0xB9, 0x32, 0x0F, 0x32, 0x30, 0x32, 0xA7, 0x33, 0x0A,
+    0x33, 0x62, 0x33, 0x8E, 0x33, 0xC0, 0x33, 0xC8, 0x33, 0xD5, 0x33, 0xE9,
+    0x33, 0xFC, 0x34, 0x4F, 0x34, 0x68, 0x34, 0xB3, 0x35, 0x0D, 0x35, 0x15,
+    0x35, 0x5E, 0x35, 0xA0, 0x35, 0xE9, 0x36, 0x37, 0x36, 0x90, 0x36, 0xD8,
+    0x37, 0x1D, 0x37, 0x3D, 0x37, 0x87, 0x37, 0xB3, 0x38, 0x1F, 0x38, 0x4E,
+    0x38, 0x78, 0x38, 0xB0, 0x38, 0xDE, 0x39, 0x27, 0x39, 0x5E, 0x39, 0x95,
+    0x39, 0xFD, 0x3A, 0x49, 0x3A, 0x72, 0x3A, 0x8E, 0x3A, 0x9D, 0x3A, 0xB0,
+    0x3A, 0xBC, 0x3A, 0xD4, 0x3B, 0x0C, 0x3B, 0x1F, 0x3B, 0x3A, 0x3B, 0x4E,
+    0x3B, 0x63, 0x3B, 0x7E, 0x3B, 0x9A, 0x3B, 0xB5, 0x3C, 0x13, 0x3C, 0x44,
+    0x3C, 0x55, 0x3C, 0x6A, 0x3C, 0xC5, 0x3D, 0x01, 0x3D, 0x36, 0x3D, 0x82,
+    0x3D, 0x9A, 0x3D, 0xB4, 0x3D, 0xD4, 0x3D, 0xED, 0x3E, 0x1B, 0x3E, 0x63,
+    0x3E, 0xC9, 0x3F, 0x5A, 0x3F, 0x72, 0x3F, 0x94, 0x3F, 0xB6, 0x3F, 0xFC,
+    0x40, 0x3D, 0x40, 0x57, 0x40, 0x71, 0x40, 0xAF, 0x40, 0xE7, 0x41, 0x0D,
+    0x41, 0x39, 0x41, 0x45, 0x41, 0x5B, 0x41, 0x67, 0x41, 0x75, 0x41, 0x83,
+    0x41, 0xA1, 0x41, 0xB7, 0x41, 0xDB, 0x41, 0xEE, 0x42, 0x01, 0x42, 0x24,
+    0x42, 0x3F, 0x42, 0x6B, 0x42, 0x98, 0x42, 0xE4, 0x43, 0x18, 0x43, 0x24,
+    0x43, 0x31, 0x43, 0x3D, 0x43, 0x51, 0x43, 0x65, 0x43, 0x97, 0x43, 0xAD,
+    0x43, 0xC8, 0x43, 0xEC, 0x43, 0xFF, 0x44, 0x15, 0x44, 0x3B, 0x44, 0x5F,
+    0x44, 0x82, 0x44, 0xAA, 0x44, 0xC5, 0x44, 0xD1, 0x44, 0xDD, 0x44, 0xE5,
+    0x44, 0xED, 0x44, 0xF5, 0x44, 0xFD, 0x45, 0x05, 0x45, 0x0D, 0x45, 0x15,
+    0x45, 0x1D, 0x45, 0x25, 0x45, 0x2D, 0x45, 0x35, 0x45, 0x3D, 0x45, 0x45,
+    0x45, 0x6B, 0x45, 0x98, 0x45, 0xA4, 0x45, 0xBA, 0x45, 0xC6, 0x45, 0xD4,
+    0x45, 0xE2, 0x46, 0x00, 0x46, 0x15, 0x46, 0x28, 0x46, 0x42, 0x46, 0x5C,
+    0x46, 0x94, 0x46, 0xD2, 0x46, 0xE5, 0x47, 0x03, 0x47, 0x25, 0x47, 0x47,
+    0x47, 0x88, 0x47, 0xCF, 0x47, 0xFB, 0x48, 0x26, 0x48, 0x32, 0x48, 0x3E,
+    0x48, 0x4A, 0x48, 0x57, 0x48, 0x63, 0x48, 0x6F, 0x48, 0x7B, 0x48, 0xAD,
+    0x48, 0xC3, 0x48, 0xE0, 0x48, 0xF3, 0x49, 0x17, 0x49, 0x3A, 0x49, 0x61,
+    0x49, 0x69, 0x49, 0x71, 0x49, 0x8D, 0x49, 0xA9, 0x49, 0xB6, 0x49, 0xC3,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04, 0x08, 0x02,
+    0x00, 0x00, 0x00, 0xD0, 0x00, 0x80, 0x00, 0x06, 0x00, 0x50, 0x00, 0x0D,
+    0x00, 0x2F, 0x00, 0x39, 0x00, 0x7E, 0x01, 0x7E, 0x01, 0x8F, 0x01, 0x92,
+    0x01, 0x9D, 0x01, 0xA1, 0x01, 0xB0, 0x01, 0xD4, 0x01, 0xE7, 0x01, 0xEB,
+    0x01, 0xF2, 0x02, 0x1B, 0x02, 0x2D, 0x02, 0x33, 0x02, 0x37, 0x02, 0x59,
+    0x02, 0x72, 0x02, 0xBC, 0x02, 0xBF, 0x02, 0xC8, 0x02, 0xCC, 0x02, 0xDD,
+    0x03, 0x04, 0x03, 0x0C, 0x03, 0x0F, 0x03, 0x12, 0x03, 0x1B, 0x03, 0x24,
+    0x03, 0x28, 0x03, 0x2E, 0x03, 0x31, 0x03, 0x35, 0x03, 0x94, 0x03, 0xA9,
+    0x03, 0xBC, 0x03, 0xC0, 0x1E, 0x09, 0x1E, 0x0F, 0x1E, 0x17, 0x1E, 0x1D,
+    0x1E, 0x21, 0x1E, 0x25, 0x1E, 0x2B, 0x1E, 0x2F, 0x1E, 0x37, 0x1E, 0x3B,
+    0x1E, 0x49, 0x1E, 0x53, 0x1E, 0x5B, 0x1E, 0x69, 0x1E, 0x6F, 0x1E, 0x7B,
+    0x1E, 0x85, 0x1E, 0x8F, 0x1E, 0x93, 0x1E, 0x97, 0x1E, 0x9E, 0x1E, 0xF9,
+    0x20, 0x0B, 0x20, 0x10, 0x20, 0x15, 0x20, 0x1A, 0x20, 0x1E, 0x20, 0x22,
+    0x20, 0x26, 0x20, 0x30, 0x20, 0x33, 0x20, 0x3A, 0x20, 0x44, 0x20, 0x70,
+    0x20, 0x79, 0x20, 0x89, 0x20, 0xA1, 0x20, 0xA4, 0x20, 0xA7, 0x20, 0xA9,
+    0x20, 0xAD, 0x20, 0xB2, 0x20, 0xB5, 0x20, 0xBA, 0x20, 0xBD, 0x21, 0x13,
+    0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2E, 0x21, 0x5E, 0x22, 0x02,
+    0x22, 0x06, 0x22, 0x0F, 0x22, 0x12, 0x22, 0x15, 0x22, 0x1A, 0x22, 0x1E,
+    0x22, 0x2B, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65, 0x25, 0xCA, 0xFB, 0x02,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20, 0x00, 0x30, 0x00, 0x3A,
+    0x00, 0xA0, 0x01, 0x8F, 0x01, 0x92, 0x01, 0x9D, 0x01, 0xA0, 0x01, 0xAF,
+    0x01, 0xC4, 0x01, 0xE6, 0x01, 0xEA, 0x01, 0xF1, 0x01, 0xFA, 0x02, 0x2A,
+    0x02, 0x30, 0x02, 0x37, 0x02, 0x59, 0x02, 0x72, 0x02, 0xBB, 0x02, 0xBE,
+    0x02, 0xC6, 0x02, 0xCC, 0x02, 0xD8, 0x03, 0x00, 0x03, 0x06, 0x03, 0x0F,
+    0x03, 0x11, 0x03, 0x1B, 0x03, 0x23, 0x03, 0x26, 0x03, 0x2E, 0x03, 0x31,
+    0x03, 0x35, 0x03, 0x94, 0x03, 0xA9, 0x03, 0xBC, 0x03, 0xC0, 0x1E, 0x08,
+    0x1E, 0x0C, 0x1E, 0x14, 0x1E, 0x1C, 0x1E, 0x20, 0x1E, 0x24, 0x1E, 0x2A,
+    0x1E, 0x2E, 0x1E, 0x36, 0x1E, 0x3A, 0x1E, 0x42, 0x1E, 0x4C, 0x1E, 0x5A,
+    0x1E, 0x5E, 0x1E, 0x6C, 0x1E, 0x78, 0x1E, 0x80, 0x1E, 0x8E, 0x1E, 0x92,
+    0x1E, 0x97, 0x1E, 0x9E, 0x1E, 0xA0, 0x20, 0x07, 0x20, 0x10, 0x20, 0x12,
+    0x20, 0x18, 0x20, 0x1C, 0x20, 0x20, 0x20, 0x26, 0x20, 0x30, 0x20, 0x33,
+    0x20, 0x39, 0x20, 0x44, 0x20, 0x70, 0x20, 0x74, 0x20, 0x80, 0x20, 0xA1,
+    0x20, 0xA3, 0x20, 0xA6, 0x20, 0xA9, 0x20, 0xAB, 0x20, 0xB1, 0x20, 0xB5,
+    0x20, 0xB9, 0x20, 0xBC, 0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26,
+    0x21, 0x2E, 0x21, 0x5B, 0x22, 0x02, 0x22, 0x05, 0x22, 0x0F, 0x22, 0x11,
+    0x22, 0x15, 0x22, 0x19, 0x22, 0x1E, 0x22, 0x2B, 0x22, 0x48, 0x22, 0x60,
+    0x22, 0x64, 0x25, 0xCA, 0xFB, 0x01, 0xFF, 0xFF, 0x02, 0x54, 0x00, 0x00,
+    0x01, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x2C, 0x01, 0x13, 0xFE, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x33, 0xFE, 0xF0, 0xFF, 0x0F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0xF2, 0xFF, 0xEB, 0xFF, 0xEA,
+    0xFF, 0xE5, 0xFF, 0xE3, 0xFF, 0xE0, 0xFE, 0x8E, 0xFE, 0x7A, 0xFE, 0x68,
+    0xFE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE3, 0x2F, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x00,
+    0xE2, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x47,
+    0xE2, 0xB8, 0xE2, 0x7B, 0xE2, 0x64, 0xE2, 0x15, 0xE1, 0xDF, 0xE1, 0xDF,
+    0xE1, 0xBB, 0xE2, 0x18, 0x00, 0x00, 0xE2, 0x1E, 0xE2, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0x02, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x9F, 0xE1, 0x9F,
+    0xE1, 0x8A, 0xE1, 0xBA, 0xE1, 0x86, 0xE1, 0x02, 0xE0, 0xE4, 0x00, 0x00,
+    0xE0, 0xD3, 0x00, 0x00, 0xE0, 0xB8, 0x00, 0x00, 0xE0, 0xBF, 0xE0, 0xB4,
+    0xE0, 0x91, 0xE0, 0x73, 0x00, 0x00, 0xDD, 0x1F, 0x07, 0x1D, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xEA, 0x01, 0x72, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x28, 0x03, 0x2A, 0x03, 0x2C, 0x03, 0x4C,
+    0x03, 0x4E, 0x03, 0x50, 0x03, 0x52, 0x03, 0x94, 0x03, 0x9A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x9A, 0x03, 0x9C, 0x03, 0x9E, 0x00, 0x00,
+    0x03, 0xA0, 0x03, 0xAA, 0x03, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA6, 0x03, 0xA8, 0x03, 0xAE,
+    0x03, 0xB4, 0x03, 0xB6, 0x03, 0xB8, 0x03, 0xBA, 0x03, 0xBC, 0x03, 0xBE,
+    0x03, 0xC0, 0x03, 0xC2, 0x03, 0xD0, 0x03, 0xDE, 0x03, 0xE0, 0x03, 0xF6,
+    0x03, 0xFC, 0x04, 0x02, 0x04, 0x0C, 0x04, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x0C, 0x04, 0xBE, 0x00, 0x00, 0x04, 0xC4, 0x04, 0xCA, 0x04, 0xCE,
+    0x04, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC4, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xC2, 0x04, 0xC6, 0x00, 0x00, 0x04, 0xC6, 0x04, 0xC8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0xBC, 0x00, 0x00, 0x04, 0xBC, 0x00, 0x00, 0x04, 0xBC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xB6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x02, 0x6E, 0x02, 0x9F, 0x02, 0x75,
+    0x02, 0xBB, 0x02, 0xE7, 0x02, 0xA7, 0x02, 0xA0, 0x02, 0x89, 0x02, 0x8A,
+    0x02, 0x74, 0x02, 0xCE, 0x02, 0x6A, 0x02, 0x7E, 0x02, 0x69, 0x02, 0x76,
+    0x02, 0x6B, 0x02, 0x6C, 0x02, 0xD5, 0x02, 0xD2, 0x02, 0xD4, 0x02, 0x70,
+    0x02, 0xA6, 0x00, 0x01, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x25, 0x00, 0x2F,
+    0x00, 0x46, 0x00, 0x47, 0x00, 0x4E, 0x00, 0x53, 0x00, 0x64, 0x00, 0x66,
+    0x00, 0x68, 0x00, 0x72, 0x00, 0x74, 0x00, 0x80, 0x00, 0xA4, 0x00, 0xA6,
+    0x00, 0xA7, 0x00, 0xAF, 0x00, 0xBC, 0x00, 0xC3, 0x00, 0xDB, 0x00, 0xDC,
+    0x00, 0xE1, 0x00, 0xE2, 0x00, 0xEC, 0x02, 0x8D, 0x02, 0x77, 0x02, 0x8E,
+    0x02, 0xDC, 0x02, 0x85, 0x03, 0x18, 0x01, 0x07, 0x01, 0x23, 0x01, 0x24,
+    0x01, 0x2B, 0x01, 0x32, 0x01, 0x4A, 0x01, 0x4B, 0x01, 0x52, 0x01, 0x57,
+    0x01, 0x69, 0x01, 0x6C, 0x01, 0x6F, 0x01, 0x78, 0x01, 0x7A, 0x01, 0x86,
+    0x01, 0xAA, 0x01, 0xAC, 0x01, 0xAD, 0x01, 0xB5, 0x01, 0xC1, 0x01, 0xC9,
+    0x01, 0xE1, 0x01, 0xE2, 0x01, 0xE7, 0x01, 0xE8, 0x01, 0xF2, 0x02, 0x8B,
+    0x02, 0xAF, 0x02, 0x8C, 0x02, 0xDA, 0x02, 0x66, 0x02, 0x6F, 0x02, 0xB8,
+    0x02, 0xC9, 0x02, 0xBA, 0x02, 0xCB, 0x02, 0xB0, 0x02, 0xA9, 0x03, 0x16,
+    0x02, 0xAA, 0x02, 0x20, 0x02, 0x9B, 0x02, 0xDB, 0x02, 0x7F, 0x02, 0xAB,
+    0x03, 0x20, 0x02, 0xAD, 0x02, 0xD8, 0x02, 0x51, 0x02, 0x52, 0x03, 0x19,
+    0x02, 0xE5, 0x02, 0xA8, 0x02, 0x72, 0x03, 0x21, 0x02, 0x50, 0x02, 0x21,
+    0x02, 0x9C, 0x02, 0x5B, 0x02, 0x5A, 0x02, 0x5C, 0x02, 0x71, 0x00, 0x13,
+    0x00, 0x02, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1B,
+    0x00, 0x21, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x34, 0x00, 0x3B, 0x00, 0x5E,
+    0x00, 0x55, 0x00, 0x58, 0x00, 0x5A, 0x00, 0x28, 0x00, 0x7E, 0x00, 0x8F,
+    0x00, 0x81, 0x00, 0x84, 0x00, 0x9F, 0x00, 0x8B, 0x02, 0xD0, 0x00, 0x9D,
+    0x00, 0xCB, 0x00, 0xC4, 0x00, 0xC7, 0x00, 0xC9, 0x00, 0xE3, 0x00, 0xA5,
+    0x01, 0xC0, 0x01, 0x19, 0x01, 0x08, 0x01, 0x10, 0x01, 0x20, 0x01, 0x17,
+    0x01, 0x1E, 0x01, 0x21, 0x01, 0x27, 0x01, 0x41, 0x01, 0x33, 0x01, 0x37,
+    0x01, 0x3E, 0x01, 0x62, 0x01, 0x59, 0x01, 0x5C, 0x01, 0x5E, 0x01, 0x2C,
+    0x01, 0x84, 0x01, 0x95, 0x01, 0x87, 0x01, 0x8A, 0x01, 0xA5, 0x01, 0x91,
+    0x02, 0xD1, 0x01, 0xA3, 0x01, 0xD1, 0x01, 0xCA, 0x01, 0xCD, 0x01, 0xCF,
+    0x01, 0xE9, 0x01, 0xAB, 0x01, 0xEB, 0x00, 0x16, 0x01, 0x1C, 0x00, 0x03,
+    0x01, 0x09, 0x00, 0x17, 0x01, 0x1D, 0x00, 0x1F, 0x01, 0x25, 0x00, 0x23,
+    0x01, 0x29, 0x00, 0x24, 0x01, 0x2A, 0x00, 0x20, 0x01, 0x26, 0x00, 0x29,
+    0x01, 0x2D, 0x00, 0x2A, 0x01, 0x2E, 0x00, 0x41, 0x01, 0x44, 0x00, 0x31,
+    0x01, 0x34, 0x00, 0x3C, 0x01, 0x3F, 0x00, 0x44, 0x01, 0x47, 0x00, 0x32,
+    0x01, 0x35, 0x00, 0x4A, 0x01, 0x4E, 0x00, 0x48, 0x01, 0x4C, 0x00, 0x4C,
+    0x01, 0x50, 0x00, 0x4B, 0x01, 0x4F, 0x00, 0x51, 0x01, 0x55, 0x00, 0x4F,
+    0x01, 0x53, 0x00, 0x63, 0x01, 0x68, 0x00, 0x61, 0x01, 0x66, 0x00, 0x56,
+    0x01, 0x5A, 0x00, 0x62, 0x01, 0x67, 0x00, 0x5C, 0x01, 0x58, 0x00, 0x54,
+    0x01, 0x65, 0x00, 0x65, 0x01, 0x6B, 0x00, 0x67, 0x01, 0x6D, 0x01, 0x6E,
+    0x00, 0x6A, 0x01, 0x70, 0x00, 0x6C, 0x01, 0x72, 0x00, 0x6B, 0x01, 0x71,
+    0x00, 0x6D, 0x01, 0x73, 0x00, 0x71, 0x01, 0x77, 0x00, 0x76, 0x01, 0x7B,
+    0x00, 0x78, 0x01, 0x7E, 0x00, 0x77, 0x01, 0x7D, 0x01, 0x7C, 0x00, 0x7F,
+    0x01, 0x85, 0x00, 0x99, 0x01, 0x9F, 0x00, 0x82, 0x01, 0x88, 0x00, 0x97,
+    0x01, 0x9D, 0x00, 0xA3, 0x01, 0xA9, 0x00, 0xA8, 0x01, 0xAE, 0x00, 0xAA,
+    0x01, 0xB0, 0x00, 0xA9, 0x01, 0xAF, 0x00, 0xB0, 0x01, 0xB6, 0x00, 0xB5,
+    0x01, 0xBB, 0x00, 0xB4, 0x01, 0xBA, 0x00, 0xB2, 0x01, 0xB8, 0x00, 0xBF,
+    0x01, 0xC4, 0x00, 0xBE, 0x01, 0xC3, 0x00, 0xBD, 0x01, 0xC2, 0x00, 0xD9,
+    0x01, 0xDF, 0x00, 0xD5, 0x01, 0xDB, 0x00, 0xC5, 0x01, 0xCB, 0x00, 0xD8,
+    0x01, 0xDE, 0x00, 0xD3, 0x01, 0xD9, 0x00, 0xD7, 0x01, 0xDD, 0x00, 0xDE,
+    0x01, 0xE4, 0x00, 0xE4, 0x01, 0xEA, 0x00, 0xE5, 0x00, 0xED, 0x01, 0xF3,
+    0x00, 0xEF, 0x01, 0xF5, 0x00, 0xEE, 0x01, 0xF4, 0x00, 0x91, 0x01, 0x97,
+    0x00, 0xCD, 0x01, 0xD3, 0x00, 0x27, 0x00, 0x2E, 0x01, 0x31, 0x00, 0x69,
+    0x00, 0x6F, 0x01, 0x75, 0x00, 0x75, 0x00, 0x7C, 0x01, 0x82, 0x00, 0x09,
+    0x01, 0x0F, 0x00, 0x57, 0x01, 0x5B, 0x00, 0x83, 0x01, 0x89, 0x00, 0xC6,
+    0x01, 0xCC, 0x00, 0x49, 0x01, 0x4D, 0x00, 0x9C, 0x01, 0xA2, 0x00, 0x26,
+    0x00, 0x2D, 0x00, 0x19, 0x01, 0x1F, 0x00, 0x1C, 0x01, 0x22, 0x00, 0x9E,
+    0x01, 0xA4, 0x00, 0x10, 0x01, 0x16, 0x00, 0x15, 0x01, 0x1B, 0x00, 0x3A,
+    0x01, 0x3D, 0x00, 0x40, 0x01, 0x43, 0x00, 0x59, 0x01, 0x5D, 0x00, 0x60,
+    0x01, 0x64, 0x00, 0x8A, 0x01, 0x90, 0x00, 0x98, 0x01, 0x9E, 0x00, 0xAB,
+    0x01, 0xB1, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0xC8, 0x01, 0xCE, 0x00, 0xD4,
+    0x01, 0xDA, 0x00, 0xB6, 0x01, 0xBC, 0x00, 0xC0, 0x01, 0xC5, 0x00, 0x8C,
+    0x01, 0x92, 0x00, 0xA2, 0x01, 0xA8, 0x00, 0x8D, 0x01, 0x93, 0x00, 0xEA,
+    0x01, 0xF0, 0x03, 0x48, 0x03, 0x47, 0x03, 0x4A, 0x03, 0x49, 0x03, 0x1B,
+    0x03, 0x1C, 0x03, 0x4C, 0x03, 0x1D, 0x03, 0x17, 0x03, 0x1E, 0x03, 0x22,
+    0x03, 0x1F, 0x03, 0x1A, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xFC, 0x03, 0x01,
+    0x03, 0x05, 0x02, 0xFF, 0x02, 0xF5, 0x02, 0xF2, 0x03, 0x09, 0x03, 0x00,
+    0x02, 0xFA, 0x02, 0xFD, 0x00, 0x22, 0x01, 0x28, 0x00, 0x2B, 0x01, 0x2F,
+    0x00, 0x2C, 0x01, 0x30, 0x00, 0x43, 0x01, 0x46, 0x00, 0x42, 0x01, 0x45,
+    0x00, 0x33, 0x01, 0x36, 0x00, 0x4D, 0x01, 0x51, 0x00, 0x52, 0x01, 0x56,
+    0x00, 0x50, 0x01, 0x54, 0x00, 0x5B, 0x01, 0x5F, 0x00, 0x6E, 0x01, 0x74,
+    0x00, 0x70, 0x01, 0x76, 0x00, 0x73, 0x01, 0x79, 0x00, 0x79, 0x01, 0x7F,
+    0x00, 0x7A, 0x01, 0x80, 0x00, 0x7D, 0x01, 0x83, 0x00, 0xA0, 0x01, 0xA6,
+    0x00, 0xA1, 0x01, 0xA7, 0x00, 0x9B, 0x01, 0xA1, 0x00, 0x9A, 0x01, 0xA0,
+    0x00, 0xAC, 0x01, 0xB2, 0x00, 0xAE, 0x01, 0xB4, 0x00, 0xB7, 0x01, 0xBD,
+    0x00, 0xB8, 0x01, 0xBE, 0x00, 0xB1, 0x01, 0xB7, 0x00, 0xB3, 0x01, 0xB9,
+    0x00, 0xB9, 0x01, 0xBF, 0x00, 0xC1, 0x01, 0xC7, 0x00, 0xC2, 0x01, 0xC8,
+    0x00, 0xDA, 0x01, 0xE0, 0x00, 0xD6, 0x01, 0xDC, 0x00, 0xE0, 0x01, 0xE6,
+    0x00, 0xDD, 0x01, 0xE3, 0x00, 0xDF, 0x01, 0xE5, 0x00, 0xE6, 0x01, 0xEC,
+    0x00, 0xF0, 0x01, 0xF6, 0x00, 0x12, 0x01, 0x18, 0x00, 0x14, 0x01, 0x1A,
+    0x00, 0x0B, 0x01, 0x11, 0x00, 0x0D, 0x01, 0x13, 0x00, 0x0E, 0x01, 0x14,
+    0x00, 0x0F, 0x01, 0x15, 0x00, 0x0C, 0x01, 0x12, 0x00, 0x04, 0x01, 0x0A,
+    0x00, 0x06, 0x01, 0x0C, 0x00, 0x07, 0x01, 0x0D, 0x00, 0x08, 0x01, 0x0E,
+    0x00, 0x05, 0x01, 0x0B, 0x00, 0x3D, 0x01, 0x40, 0x00, 0x3F, 0x01, 0x42,
+    0x00, 0x45, 0x01, 0x48, 0x00, 0x35, 0x01, 0x38, 0x00, 0x37, 0x01, 0x3A,
+    0x00, 0x38, 0x01, 0x3B, 0x00, 0x39, 0x01, 0x3C, 0x00, 0x36, 0x01, 0x39,
+    0x00, 0x5F, 0x01, 0x63, 0x00, 0x5D, 0x01, 0x61, 0x00, 0x8E, 0x01, 0x94,
+    0x00, 0x90, 0x01, 0x96, 0x00, 0x85, 0x01, 0x8B, 0x00, 0x87, 0x01, 0x8D,
+    0x00, 0x88, 0x01, 0x8E, 0x00, 0x89, 0x01, 0x8F, 0x00, 0x86, 0x01, 0x8C,
+    0x00, 0x92, 0x01, 0x98, 0x00, 0x94, 0x01, 0x9A, 0x00, 0x95, 0x01, 0x9B,
+    0x00, 0x96, 0x01, 0x9C, 0x00, 0x93, 0x01, 0x99, 0x00, 0xCA, 0x01, 0xD0,
+    0x00, 0xCC, 0x01, 0xD2, 0x00, 0xCE, 0x01, 0xD4, 0x00, 0xD0, 0x01, 0xD6,
+    0x00, 0xD1, 0x01, 0xD7, 0x00, 0xD2, 0x01, 0xD8, 0x00, 0xCF, 0x01, 0xD5,
+    0x00, 0xE8, 0x01, 0xEE, 0x00, 0xE7, 0x01, 0xED, 0x00, 0xE9, 0x01, 0xEF,
+    0x00, 0xEB, 0x01, 0xF1, 0x02, 0x62, 0x02, 0x64, 0x02, 0x67, 0x02, 0x63,
+    0x02, 0x68, 0x02, 0x82, 0x02, 0x80, 0x02, 0x81, 0x02, 0x83, 0x02, 0x99,
+    0x02, 0x9A, 0x02, 0x95, 0x02, 0x97, 0x02, 0x98, 0x02, 0x96, 0x02, 0xB1,
+    0x02, 0xB3, 0x02, 0x73, 0x02, 0xBE, 0x02, 0xC1, 0x02, 0xBC, 0x02, 0xBD,
+    0x02, 0xC0, 0x02, 0xC6, 0x02, 0xBF, 0x02, 0xC8, 0x02, 0xC2, 0x02, 0xC3,
+    0x02, 0xC7, 0x02, 0xDE, 0x02, 0xE1, 0x02, 0xE3, 0x02, 0xCF, 0x02, 0xCC,
+    0x02, 0xE4, 0x02, 0xD7, 0x02, 0xD6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x0A, 0x01, 0xDE, 0x03, 0x1C, 0x00, 0x02, 0x44, 0x46, 0x4C, 0x54,
+    0x01, 0xAE, 0x6C, 0x61, 0x74, 0x6E, 0x00, 0x0E, 0x01, 0x7E, 0x00, 0x09,
+    0x41, 0x5A, 0x45, 0x20, 0x01, 0x5A, 0x43, 0x41, 0x54, 0x20, 0x01, 0x36,
+    0x43, 0x52, 0x54, 0x20, 0x01, 0x12, 0x4B, 0x41, 0x5A, 0x20, 0x00, 0xEE,
+    0x4D, 0x4F, 0x4C, 0x20, 0x00, 0xCA, 0x4E, 0x4C, 0x44, 0x20, 0x00, 0xA6,
+    0x52, 0x4F, 0x4D, 0x20, 0x00, 0x82, 0x54, 0x41, 0x54, 0x20, 0x00, 0x5E,
+    0x54, 0x52, 0x4B, 0x20, 0x00, 0x3A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x0F, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x0C, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x0A, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x09, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x08, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0E,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04, 0x00, 0x05,
+    0x00, 0x06, 0x00, 0x07, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x61, 0x61, 0x6C, 0x74,
+    0x01, 0x36, 0x63, 0x61, 0x73, 0x65, 0x01, 0x30, 0x63, 0x63, 0x6D, 0x70,
+    0x01, 0x22, 0x63, 0x63, 0x6D, 0x70, 0x01, 0x10, 0x64, 0x6C, 0x69, 0x67,
+    0x01, 0x0A, 0x64, 0x6E, 0x6F, 0x6D, 0x01, 0x04, 0x66, 0x72, 0x61, 0x63,
+    0x00, 0xFA, 0x6C, 0x69, 0x67, 0x61, 0x00, 0xF4, 0x6C, 0x6F, 0x63, 0x6C,
+    0x00, 0xEE, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xE8, 0x6C, 0x6F, 0x63, 0x6C,
+    0x00, 0xE2, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xDC, 0x6C, 0x6F, 0x63, 0x6C,
+    0x00, 0xD6, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xD0, 0x6C, 0x6F, 0x63, 0x6C,
+    0x00, 0xCA, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xC4, 0x6C, 0x6F, 0x63, 0x6C,
+    0x00, 0xBE, 0x6E, 0x75, 0x6D, 0x72, 0x00, 0xB8, 0x6F, 0x72, 0x64, 0x6E,
+    0x00, 0xB0, 0x73, 0x69, 0x6E, 0x66, 0x00, 0xAA, 0x73, 0x73, 0x30, 0x31,
+    0x00, 0xA4, 0x73, 0x75, 0x62, 0x73, 0x00, 0x9E, 0x73, 0x75, 0x70, 0x73,
+    0x00, 0x98, 0x7A, 0x65, 0x72, 0x6F, 0x00, 0x92, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x22, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1B, 0x00, 0x1C,
+    0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x05, 0x00, 0x08,
+    0x00, 0x09, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x02, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x28, 0x08, 0x30, 0x07, 0x72, 0x06, 0xAE, 0x06, 0x26, 0x06, 0x26,
+    0x05, 0xEE, 0x05, 0x98, 0x05, 0x98, 0x05, 0x0A, 0x04, 0x80, 0x04, 0x22,
+    0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E, 0x03, 0xEC,
+    0x03, 0xEC, 0x03, 0xBE, 0x03, 0x82, 0x03, 0x74, 0x03, 0x66, 0x03, 0x4E,
+    0x03, 0x4E, 0x03, 0x40, 0x03, 0x32, 0x03, 0x24, 0x03, 0x10, 0x03, 0x32,
+    0x02, 0xC8, 0x02, 0xBA, 0x02, 0xBA, 0x02, 0x7C, 0x02, 0x5A, 0x02, 0x38,
+    0x01, 0x6A, 0x01, 0x40, 0x01, 0x02, 0x00, 0xEE, 0x00, 0x52, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x72, 0x00, 0x36,
+    0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6, 0x00, 0xF7,
+    0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFD,
+    0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03,
+    0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0xF8, 0x01, 0xF9, 0x01, 0xFA,
+    0x01, 0xFB, 0x01, 0xFC, 0x01, 0xFD, 0x01, 0xFE, 0x01, 0xFF, 0x02, 0x00,
+    0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+    0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0B, 0x02, 0x0C,
+    0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12,
+    0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18,
+    0x00, 0x02, 0x00, 0x05, 0x00, 0x53, 0x00, 0x65, 0x00, 0x00, 0x00, 0x69,
+    0x00, 0x69, 0x00, 0x13, 0x00, 0x75, 0x00, 0x75, 0x00, 0x14, 0x01, 0x07,
+    0x01, 0x20, 0x00, 0x15, 0x01, 0x4B, 0x01, 0x51, 0x00, 0x2F, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x0A,
+    0x00, 0x01, 0x00, 0x01, 0x02, 0x26, 0x00, 0x04, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x01, 0x00, 0x08, 0x00, 0x05,
+    0x00, 0x26, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12, 0x00, 0x0C, 0x02, 0x1F,
+    0x00, 0x02, 0x01, 0x6F, 0x02, 0x1E, 0x00, 0x02, 0x01, 0x57, 0x02, 0x19,
+    0x00, 0x02, 0x01, 0x4A, 0x02, 0x1C, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x6F,
+    0x02, 0x1A, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x57, 0x00, 0x04, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x02, 0x1D, 0x00, 0x02, 0x01, 0x65,
+    0x02, 0x1B, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x65, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x4A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x74, 0x00, 0x37, 0x02, 0x78, 0x02, 0x79, 0x02, 0x7A, 0x02, 0x7B,
+    0x02, 0x7D, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x8F, 0x02, 0x90,
+    0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0xA1, 0x02, 0xA2,
+    0x02, 0xA3, 0x02, 0xA4, 0x02, 0xB6, 0x03, 0x34, 0x03, 0x33, 0x03, 0x36,
+    0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30, 0x03, 0x2F, 0x03, 0x23,
+    0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29,
+    0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31, 0x03, 0x32, 0x03, 0x37,
+    0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D,
+    0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43,
+    0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02, 0x00, 0x0D, 0x02, 0x72,
+    0x02, 0x73, 0x00, 0x00, 0x02, 0x76, 0x02, 0x77, 0x00, 0x02, 0x02, 0x7C,
+    0x02, 0x7C, 0x00, 0x04, 0x02, 0x7E, 0x02, 0x7E, 0x00, 0x05, 0x02, 0x80,
+    0x02, 0x81, 0x00, 0x06, 0x02, 0x89, 0x02, 0x8E, 0x00, 0x08, 0x02, 0x9B,
+    0x02, 0x9E, 0x00, 0x0E, 0x02, 0xA6, 0x02, 0xA6, 0x00, 0x12, 0x02, 0xEA,
+    0x02, 0xFA, 0x00, 0x13, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x24, 0x02, 0xFF,
+    0x03, 0x0B, 0x00, 0x26, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x33, 0x03, 0x10,
+    0x03, 0x12, 0x00, 0x34, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x04,
+    0x02, 0xB5, 0x00, 0x03, 0x01, 0x86, 0x02, 0x69, 0x00, 0x01, 0x00, 0x01,
+    0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x0E, 0x00, 0x04, 0x02, 0x20, 0x02, 0x21, 0x02, 0x20, 0x02, 0x21,
+    0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x80, 0x01, 0x07, 0x01, 0x86,
+    0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x24, 0x00, 0x0A, 0x00, 0x03,
+    0x00, 0x01, 0x00, 0xD6, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x02, 0x00, 0x80, 0x01, 0x86,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0xBC, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01,
+    0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x3E, 0xFF, 0xEC, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x26,
+    0x00, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x02, 0x00, 0x01,
+    0x02, 0x31, 0x02, 0x3A, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x1C,
+    0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1E,
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x45, 0x02, 0x4E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x59, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x06, 0xFF, 0xE3, 0x00, 0x01, 0x00, 0x01, 0x02, 0x76,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x30,
+    0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x22, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x14, 0x00, 0x29, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x15, 0x00, 0x02, 0x00, 0x01,
+    0x02, 0x26, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x24, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x16, 0x00, 0x0A, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x0E, 0x00, 0x01, 0x00, 0x01, 0x02, 0x72, 0x00, 0x02, 0x00, 0x16,
+    0x00, 0x06, 0x00, 0x01, 0x00, 0x68, 0x00, 0x01, 0x00, 0x01, 0x00, 0x68,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01, 0x01, 0x6F, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x6F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1E, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x04, 0x01, 0xF7, 0x00, 0x02,
+    0x01, 0x69, 0x00, 0x01, 0x00, 0x04, 0x00, 0xF1, 0x00, 0x02, 0x00, 0x64,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x55, 0x01, 0x59, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x04, 0x00, 0xB6,
+    0x00, 0xC0, 0x01, 0xBC, 0x01, 0xC5, 0x00, 0x01, 0x00, 0x04, 0x00, 0xB4,
+    0x00, 0xBF, 0x01, 0xBA, 0x01, 0xC4, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x09, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x57, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x4E, 0x00, 0x02, 0x00, 0x2C, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x1C,
+    0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x02, 0xED, 0x00, 0x02, 0x03, 0x01,
+    0x02, 0xEC, 0x00, 0x02, 0x03, 0x09, 0x02, 0xEB, 0x00, 0x02, 0x02, 0xF7,
+    0x02, 0xEA, 0x00, 0x02, 0x02, 0xF8, 0x00, 0x04, 0x00, 0x1C, 0x00, 0x16,
+    0x00, 0x10, 0x00, 0x0A, 0x02, 0xF1, 0x00, 0x02, 0x03, 0x01, 0x02, 0xF0,
+    0x00, 0x02, 0x03, 0x09, 0x02, 0xEF, 0x00, 0x02, 0x02, 0xF7, 0x02, 0xEE,
+    0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x02, 0x02, 0xFC, 0x02, 0xFF,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1E,
+    0x00, 0x0C, 0x00, 0x7C, 0x00, 0x76, 0x00, 0x70, 0x00, 0x6A, 0x00, 0x64,
+    0x00, 0x5E, 0x00, 0x58, 0x00, 0x52, 0x00, 0x4C, 0x00, 0x46, 0x00, 0x40,
+    0x00, 0x3A, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x27, 0x00, 0x2E, 0x00, 0x69,
+    0x00, 0x6D, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x7C, 0x01, 0x31, 0x01, 0x75,
+    0x01, 0x82, 0x02, 0x1E, 0x02, 0x1F, 0x00, 0x02, 0x01, 0x4A, 0x01, 0x6F,
+    0x00, 0x02, 0x01, 0x4A, 0x01, 0x57, 0x00, 0x02, 0x01, 0x7A, 0x01, 0x69,
+    0x00, 0x02, 0x01, 0x6F, 0x01, 0x69, 0x00, 0x02, 0x01, 0x2B, 0x01, 0xF4,
+    0x00, 0x02, 0x00, 0x74, 0x01, 0x69, 0x00, 0x02, 0x00, 0x74, 0x00, 0x64,
+    0x00, 0x02, 0x00, 0x68, 0x01, 0x69, 0x00, 0x02, 0x00, 0x68, 0x02, 0x7D,
+    0x00, 0x02, 0x00, 0x68, 0x00, 0x64, 0x00, 0x02, 0x00, 0x25, 0x01, 0xF4,
+    0x00, 0x02, 0x00, 0x25, 0x00, 0xEE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x76, 0x00, 0x06, 0x00, 0x64, 0x00, 0x5A,
+    0x00, 0x50, 0x00, 0x46, 0x00, 0x2C, 0x00, 0x12, 0x00, 0x03, 0x00, 0x14,
+    0x00, 0x0E, 0x00, 0x08, 0x03, 0x07, 0x00, 0x02, 0x02, 0xF7, 0x03, 0x06,
+    0x00, 0x02, 0x02, 0xF2, 0x03, 0x08, 0x00, 0x02, 0x02, 0xF8, 0x00, 0x03,
+    0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x03, 0x04, 0x00, 0x02, 0x03, 0x05,
+    0x03, 0x02, 0x00, 0x02, 0x02, 0xF2, 0x03, 0x03, 0x00, 0x02, 0x02, 0xF8,
+    0x00, 0x01, 0x00, 0x04, 0x02, 0xFE, 0x00, 0x02, 0x02, 0xF5, 0x00, 0x01,
+    0x00, 0x04, 0x02, 0xF9, 0x00, 0x02, 0x02, 0xF5, 0x00, 0x01, 0x00, 0x04,
+    0x02, 0xF6, 0x00, 0x02, 0x03, 0x05, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06,
+    0x02, 0xF4, 0x00, 0x02, 0x03, 0x05, 0x02, 0xF3, 0x00, 0x02, 0x02, 0xF8,
+    0x00, 0x01, 0x00, 0x06, 0x02, 0xF2, 0x02, 0xF5, 0x02, 0xF8, 0x02, 0xFD,
+    0x03, 0x01, 0x03, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x02, 0x01, 0x50, 0x00, 0x24, 0x03, 0x34, 0x03, 0x33, 0x03, 0x36,
+    0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30, 0x03, 0x2F, 0x03, 0x23,
+    0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29,
+    0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31, 0x03, 0x32, 0x03, 0x37,
+    0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D,
+    0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43,
+    0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x1C, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x00, 0x24, 0x00, 0x01,
+    0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xE6, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01, 0x03, 0x23, 0x03, 0x46,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x52, 0x00, 0x26, 0x01, 0x58, 0x01, 0x6A, 0x03, 0x34, 0x03, 0x33,
+    0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30, 0x03, 0x2F,
+    0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28,
+    0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31, 0x03, 0x32,
+    0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C,
+    0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42,
+    0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02, 0x00, 0x07,
+    0x01, 0x57, 0x01, 0x57, 0x00, 0x00, 0x01, 0x69, 0x01, 0x69, 0x00, 0x01,
+    0x02, 0xEA, 0x02, 0xFA, 0x00, 0x02, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x13,
+    0x02, 0xFF, 0x03, 0x0B, 0x00, 0x15, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x22,
+    0x03, 0x10, 0x03, 0x12, 0x00, 0x23, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x88, 0x00, 0x64, 0x00, 0x30, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x01, 0x06, 0x00, 0x00,
+    0x02, 0x22, 0x02, 0x23, 0x01, 0x06, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x05, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC,
+    0x02, 0xFD, 0x00, 0x11, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x13, 0x03, 0x0D,
+    0x03, 0x0D, 0x00, 0x20, 0x03, 0x10, 0x03, 0x12, 0x00, 0x21, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x02, 0x00, 0x14, 0x00, 0x36,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x03, 0x0D,
+    0x03, 0x0F, 0x00, 0x00, 0x03, 0x11, 0x03, 0x15, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x0F, 0x02, 0xF2, 0x02, 0xF5,
+    0x02, 0xF7, 0x02, 0xF8, 0x02, 0xFA, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFF,
+    0x03, 0x00, 0x03, 0x01, 0x03, 0x05, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x0B,
+    0x03, 0x0C, 0x00, 0x01, 0x00, 0x02, 0x01, 0x57, 0x01, 0x69, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x20, 0x00, 0x0D,
+    0x00, 0xB0, 0x00, 0xA4, 0x00, 0x9A, 0x00, 0x90, 0x00, 0x86, 0x00, 0x7C,
+    0x00, 0x72, 0x00, 0x68, 0x00, 0x5E, 0x00, 0x54, 0x00, 0x4A, 0x00, 0x42,
+    0x00, 0x3C, 0x00, 0x02, 0x00, 0x04, 0x01, 0x07, 0x01, 0x07, 0x00, 0x00,
+    0x02, 0x26, 0x02, 0x2F, 0x00, 0x01, 0x02, 0x72, 0x02, 0x72, 0x00, 0x0B,
+    0x02, 0x76, 0x02, 0x76, 0x00, 0x0C, 0x00, 0x02, 0x02, 0x59, 0x02, 0x7A,
+    0x00, 0x03, 0x02, 0x78, 0x02, 0x7C, 0x02, 0x7D, 0x00, 0x04, 0x02, 0x3A,
+    0x02, 0x44, 0x02, 0x4E, 0x02, 0x58, 0x00, 0x04, 0x02, 0x39, 0x02, 0x43,
+    0x02, 0x4D, 0x02, 0x57, 0x00, 0x04, 0x02, 0x38, 0x02, 0x42, 0x02, 0x4C,
+    0x02, 0x56, 0x00, 0x04, 0x02, 0x37, 0x02, 0x41, 0x02, 0x4B, 0x02, 0x55,
+    0x00, 0x04, 0x02, 0x36, 0x02, 0x40, 0x02, 0x4A, 0x02, 0x54, 0x00, 0x04,
+    0x02, 0x35, 0x02, 0x3F, 0x02, 0x49, 0x02, 0x53, 0x00, 0x04, 0x02, 0x34,
+    0x02, 0x3E, 0x02, 0x48, 0x02, 0x52, 0x00, 0x04, 0x02, 0x33, 0x02, 0x3D,
+    0x02, 0x47, 0x02, 0x51, 0x00, 0x04, 0x02, 0x32, 0x02, 0x3C, 0x02, 0x46,
+    0x02, 0x50, 0x00, 0x05, 0x02, 0x30, 0x02, 0x31, 0x02, 0x3B, 0x02, 0x45,
+    0x02, 0x4F, 0x00, 0x02, 0x01, 0xF8, 0x02, 0x20, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x7C, 0x02, 0x20,
+    0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6, 0x00, 0xF7,
+    0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB, 0x00, 0xFC, 0x00, 0xFD,
+    0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x03,
+    0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x02, 0x21, 0x00, 0xB6, 0x00, 0xC0,
+    0x01, 0xF9, 0x01, 0xFA, 0x01, 0xFB, 0x01, 0xFC, 0x01, 0xFD, 0x01, 0xFE,
+    0x01, 0xFF, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04,
+    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A,
+    0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10,
+    0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16,
+    0x02, 0x17, 0x02, 0x18, 0x01, 0x60, 0x02, 0x21, 0x01, 0xBC, 0x01, 0xC5,
+    0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36,
+    0x02, 0x37, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x02, 0x79, 0x02, 0x7B,
+    0x02, 0x7D, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x8F, 0x02, 0x90,
+    0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0xA1, 0x02, 0xA2,
+    0x02, 0xA3, 0x02, 0xA4, 0x02, 0xB6, 0x03, 0x34, 0x03, 0x33, 0x03, 0x36,
+    0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30, 0x03, 0x2F, 0x03, 0x23,
+    0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29,
+    0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31, 0x03, 0x32, 0x03, 0x37,
+    0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D,
+    0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43,
+    0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02, 0x00, 0x1B, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x53, 0x00, 0x65, 0x00, 0x01, 0x00, 0x69,
+    0x00, 0x69, 0x00, 0x14, 0x00, 0x75, 0x00, 0x75, 0x00, 0x15, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x16, 0x00, 0xB4, 0x00, 0xB4, 0x00, 0x17, 0x00, 0xBF,
+    0x00, 0xBF, 0x00, 0x18, 0x01, 0x08, 0x01, 0x20, 0x00, 0x19, 0x01, 0x4B,
+    0x01, 0x51, 0x00, 0x32, 0x01, 0x57, 0x01, 0x57, 0x00, 0x39, 0x01, 0x86,
+    0x01, 0x86, 0x00, 0x3A, 0x01, 0xBA, 0x01, 0xBA, 0x00, 0x3B, 0x01, 0xC4,
+    0x01, 0xC4, 0x00, 0x3C, 0x02, 0x45, 0x02, 0x4E, 0x00, 0x3D, 0x02, 0x73,
+    0x02, 0x73, 0x00, 0x47, 0x02, 0x77, 0x02, 0x77, 0x00, 0x48, 0x02, 0x7C,
+    0x02, 0x7C, 0x00, 0x49, 0x02, 0x7E, 0x02, 0x7E, 0x00, 0x4A, 0x02, 0x80,
+    0x02, 0x81, 0x00, 0x4B, 0x02, 0x89, 0x02, 0x8E, 0x00, 0x4D, 0x02, 0x9B,
+    0x02, 0x9E, 0x00, 0x53, 0x02, 0xA6, 0x02, 0xA6, 0x00, 0x57, 0x02, 0xEA,
+    0x02, 0xFA, 0x00, 0x58, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x69, 0x02, 0xFF,
+    0x03, 0x0B, 0x00, 0x6B, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x78, 0x03, 0x10,
+    0x03, 0x12, 0x00, 0x79, 0x02, 0x48, 0x00, 0x28, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07, 0x02, 0xB8, 0x00, 0x07,
+    0x02, 0xB8, 0x00, 0x07, 0x04, 0x11, 0xFF, 0xFB, 0x04, 0x11, 0xFF, 0xFB,
+    0x02, 0xB6, 0x00, 0x5B, 0x02, 0xB1, 0x00, 0x2D, 0x02, 0xB1, 0x00, 0x2D,
+    0x02, 0xB1, 0x00, 0x2D, 0x02, 0xB1, 0x00, 0x2D, 0x02, 0xB1, 0x00, 0x2D,
+    0x02, 0xB1, 0x00, 0x2D, 0x02, 0xB1, 0x00, 0x2D, 0x02, 0xFC, 0x00, 0x5B,
+    0x05, 0x73, 0x00, 0x5B, 0x05, 0x73, 0x00, 0x5B, 0x02, 0xFC, 0x00, 0x28,
+    0x02, 0xFC, 0x00, 0x5B, 0x02, 0xFC, 0x00, 0x28, 0x02, 0xFC, 0x00, 0x5B,
+    0x02, 0xFC, 0x00, 0x5B, 0x05, 0x0C, 0x00, 0x5B, 0x05, 0x0C, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x45,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B,
+    0x02, 0x7B, 0x00, 0x5B, 0x02, 0x7B, 0x00, 0x5B, 0x02, 0x65, 0x00, 0x5B,
+    0x03, 0x09, 0x00, 0x2D, 0x03, 0x09, 0x00, 0x2D, 0x03, 0x09, 0x00, 0x2D,
+    0x03, 0x09, 0x00, 0x2D, 0x03, 0x09, 0x00, 0x2D, 0x03, 0x09, 0x00, 0x2D,
+    0x03, 0x09, 0x00, 0x2D, 0x03, 0x05, 0x00, 0x5B, 0x03, 0x40, 0x00, 0x29,
+    0x03, 0x05, 0x00, 0x5B, 0x03, 0x05, 0x00, 0x5B, 0x03, 0x05, 0x00, 0x5B,
+    0x02, 0x12, 0x00, 0x49, 0x04, 0xA4, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49,
+    0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49,
+    0x02, 0x12, 0xFF, 0xFC, 0x02, 0x12, 0x00, 0x44, 0x02, 0x12, 0x00, 0x44,
+    0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49,
+    0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49,
+    0x02, 0x12, 0x00, 0x49, 0x02, 0x12, 0x00, 0x49, 0x02, 0x92, 0x00, 0x2B,
+    0x02, 0x92, 0x00, 0x2B, 0x02, 0xE1, 0x00, 0x5B, 0x02, 0xE1, 0x00, 0x5B,
+    0x02, 0x5E, 0x00, 0x5B, 0x04, 0xEF, 0x00, 0x5B, 0x02, 0x5E, 0x00, 0x34,
+    0x02, 0x5E, 0x00, 0x5B, 0x02, 0x5E, 0x00, 0x5B, 0x02, 0x5E, 0x00, 0x5B,
+    0x02, 0x5E, 0x00, 0x5B, 0x03, 0x89, 0x00, 0x5B, 0x02, 0x5E, 0x00, 0x5B,
+    0x02, 0x75, 0x00, 0x07, 0x03, 0x69, 0x00, 0x5B, 0x03, 0x69, 0x00, 0x5B,
+    0x03, 0x22, 0x00, 0x5B, 0x05, 0xB4, 0x00, 0x5B, 0x03, 0x22, 0x00, 0x5B,
+    0x03, 0x22, 0x00, 0x5B, 0x03, 0x22, 0x00, 0x5B, 0x03, 0x22, 0x00, 0x5B,
+    0x03, 0x22, 0x00, 0x5B, 0x03, 0x17, 0xFF, 0xD4, 0x04, 0x4E, 0x00, 0x5B,
+    0x03, 0x22, 0x00, 0x5B, 0x03, 0x22, 0x00, 0x5B, 0x03, 0x22, 0x00, 0x5B,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x1B, 0x00, 0x2C,
+    0x03, 0x1B, 0x00, 0x2C, 0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D,
+    0x03, 0x22, 0x00, 0x2D, 0x03, 0x22, 0x00, 0x2D, 0x04, 0x26, 0x00, 0x2D,
+    0x02, 0x8D, 0x00, 0x5B, 0x02, 0x8D, 0x00, 0x5B, 0x03, 0x22, 0x00, 0x2D,
+    0x02, 0xBC, 0x00, 0x5B, 0x02, 0xBC, 0x00, 0x5B, 0x02, 0xBC, 0x00, 0x5B,
+    0x02, 0xBC, 0x00, 0x5B, 0x02, 0xBC, 0x00, 0x3B, 0x02, 0xBC, 0x00, 0x5B,
+    0x02, 0xBC, 0x00, 0x5B, 0x02, 0xBC, 0x00, 0x5B, 0x02, 0x77, 0x00, 0x1E,
+    0x02, 0x77, 0x00, 0x1E, 0x02, 0x77, 0x00, 0x1E, 0x02, 0x77, 0x00, 0x1E,
+    0x02, 0x77, 0x00, 0x1E, 0x02, 0x77, 0x00, 0x1E, 0x02, 0x77, 0x00, 0x1E,
+    0x02, 0x77, 0x00, 0x1E, 0x02, 0x77, 0x00, 0x1E, 0x02, 0x77, 0x00, 0x1E,
+    0x02, 0x77, 0x00, 0x1E, 0x03, 0x1B, 0x00, 0x5B, 0x03, 0x06, 0x00, 0x2D,
+    0x02, 0x76, 0x00, 0x21, 0x02, 0x76, 0x00, 0x21, 0x02, 0x76, 0x00, 0x21,
+    0x02, 0x76, 0x00, 0x21, 0x02, 0x76, 0x00, 0x21, 0x02, 0x76, 0x00, 0x21,
+    0x02, 0x76, 0x00, 0x21, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55, 0x02, 0xF5, 0x00, 0x55,
+    0x02, 0xF5, 0x00, 0x55, 0x02, 0xC9, 0x00, 0x0B, 0x03, 0xE2, 0x00, 0x0B,
+    0x03, 0xE2, 0x00, 0x0B, 0x03, 0xE2, 0x00, 0x0B, 0x03, 0xE2, 0x00, 0x0B,
+    0x03, 0xE2, 0x00, 0x0B, 0x02, 0xBA, 0x00, 0x07, 0x02, 0xA7, 0xFF, 0xFE,
+    0x02, 0xA7, 0xFF, 0xFE, 0x02, 0xA7, 0xFF, 0xFE, 0x02, 0xA7, 0xFF, 0xFE,
+    0x02, 0xA7, 0xFF, 0xFE, 0x02, 0xA7, 0xFF, 0xFE, 0x02, 0xA7, 0xFF, 0xFE,
+    0x02, 0xA7, 0xFF, 0xFE, 0x02, 0xA7, 0xFF, 0xFE, 0x02, 0xA7, 0xFF, 0xFE,
+    0x02, 0xA3, 0x00, 0x3C, 0x02, 0xA3, 0x00, 0x3C, 0x02, 0xA3, 0x00, 0x3C,
+    0x02, 0xA3, 0x00, 0x3C, 0x02, 0xA3, 0x00, 0x3C, 0x04, 0xA4, 0x00, 0x49,
+    0x01, 0x4E, 0x00, 0x5C, 0x03, 0x91, 0x00, 0x5C, 0x01, 0x4E, 0x00, 0x33,
+    0x01, 0x4E, 0xFF, 0xFA, 0x01, 0x4E, 0xFF, 0xF7, 0x01, 0x4E, 0xFF, 0xF9,
+    0x01, 0x4E, 0xFF, 0x9A, 0x01, 0x4E, 0xFF, 0xE2, 0x01, 0x4E, 0xFF, 0xE2,
+    0x01, 0x4E, 0x00, 0x50, 0x01, 0x4E, 0x00, 0x4F, 0x01, 0x4E, 0x00, 0x27,
+    0x01, 0x4E, 0x00, 0x34, 0x01, 0x4E, 0xFF, 0xFA, 0x01, 0x4E, 0xFF, 0xF8,
+    0x01, 0x4E, 0x00, 0x1D, 0x01, 0x4E, 0xFF, 0xEE, 0x02, 0x43, 0x00, 0x26,
+    0x02, 0x43, 0x00, 0x26, 0x04, 0xA1, 0x00, 0x5B, 0x05, 0x65, 0x00, 0x5B,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23,
+    0x02, 0x8B, 0x00, 0x23, 0x02, 0x8B, 0x00, 0x23, 0x03, 0x84, 0x00, 0x23,
+    0x03, 0x84, 0x00, 0x23, 0x02, 0x89, 0x00, 0x47, 0x02, 0x1E, 0x00, 0x24,
+    0x02, 0x1E, 0x00, 0x24, 0x02, 0x1E, 0x00, 0x24, 0x02, 0x1E, 0x00, 0x24,
+    0x02, 0x1E, 0x00, 0x24, 0x02, 0x1E, 0x00, 0x24, 0x02, 0x1E, 0x00, 0x24,
+    0x02, 0x88, 0x00, 0x24, 0x02, 0x4E, 0x00, 0x24, 0x02, 0xD1, 0x00, 0x24,
+    0x02, 0x88, 0x00, 0x24, 0x02, 0x88, 0x00, 0x24, 0x02, 0x88, 0x00, 0x24,
+    0x04, 0x98, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x17, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24, 0x02, 0x4A, 0x00, 0x24,
+    0x02, 0x4A, 0x00, 0x22, 0x01, 0x89, 0x00, 0x21, 0x02, 0x97, 0x00, 0x24,
+    0x02, 0x97, 0x00, 0x24, 0x02, 0x97, 0x00, 0x24, 0x02, 0x97, 0x00, 0x24,
+    0x02, 0x97, 0x00, 0x24, 0x02, 0x97, 0x00, 0x24, 0x02, 0x97, 0x00, 0x24,
+    0x02, 0x6E, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x0D, 0x02, 0x6E, 0x00, 0x47,
+    0x02, 0x6E, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x47, 0x01, 0x32, 0x00, 0x42,
+    0x01, 0x12, 0x00, 0x42, 0x01, 0x12, 0x00, 0x11, 0x01, 0x12, 0xFF, 0xDB,
+    0x01, 0x12, 0xFF, 0xD9, 0x01, 0x12, 0xFF, 0xD3, 0x01, 0x12, 0xFF, 0x6E,
+    0x01, 0x12, 0xFF, 0xC5, 0x01, 0x12, 0xFF, 0xC6, 0x01, 0x12, 0x00, 0x31,
+    0x01, 0x32, 0x00, 0x41, 0x01, 0x12, 0xFF, 0xFD, 0x01, 0x12, 0x00, 0x16,
+    0x01, 0x12, 0xFF, 0xDB, 0x02, 0x5D, 0x00, 0x42, 0x01, 0x12, 0xFF, 0xE9,
+    0x01, 0x12, 0xFF, 0xF9, 0x01, 0x12, 0xFF, 0xD9, 0x01, 0x2B, 0xFF, 0xDD,
+    0x01, 0x2A, 0xFF, 0xDC, 0x01, 0x2A, 0xFF, 0xDC, 0x02, 0x5F, 0x00, 0x47,
+    0x02, 0x5F, 0x00, 0x47, 0x02, 0x5D, 0x00, 0x47, 0x01, 0x1F, 0x00, 0x48,
+    0x01, 0x1F, 0x00, 0x1C, 0x01, 0x69, 0x00, 0x48, 0x01, 0x1F, 0x00, 0x38,
+    0x01, 0xA1, 0x00, 0x48, 0x01, 0x1F, 0x00, 0x37, 0x02, 0x3C, 0x00, 0x48,
+    0x01, 0x1F, 0xFF, 0xFB, 0x01, 0x51, 0xFF, 0xFE, 0x03, 0xB5, 0x00, 0x46,
+    0x03, 0xB5, 0x00, 0x46, 0x02, 0x6E, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x47,
+    0x02, 0x93, 0xFF, 0xAF, 0x02, 0x6E, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x47,
+    0x02, 0x6E, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x47, 0x02, 0x7A, 0xFF, 0xDD,
+    0x03, 0x99, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x47, 0x02, 0x6E, 0x00, 0x47,
+    0x02, 0x6E, 0x00, 0x47, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x22,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24, 0x02, 0x79, 0x00, 0x24,
+    0x03, 0xEF, 0x00, 0x24, 0x02, 0x8A, 0x00, 0x47, 0x02, 0x8A, 0x00, 0x47,
+    0x02, 0x89, 0x00, 0x24, 0x01, 0xB6, 0x00, 0x47, 0x01, 0xB6, 0x00, 0x47,
+    0x01, 0xB6, 0x00, 0x47, 0x01, 0xB6, 0x00, 0x33, 0x01, 0xB6, 0xFF, 0xE6,
+    0x01, 0xB6, 0x00, 0x33, 0x01, 0xB6, 0x00, 0x47, 0x01, 0xB6, 0xFF, 0xF6,
+    0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19,
+    0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19,
+    0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19,
+    0x01, 0xEA, 0x00, 0x19, 0x01, 0xEA, 0x00, 0x19, 0x02, 0x9A, 0x00, 0x21,
+    0x01, 0x8A, 0x00, 0x17, 0x01, 0x8A, 0x00, 0x17, 0x01, 0x8A, 0x00, 0x17,
+    0x01, 0x8A, 0x00, 0x17, 0x01, 0x8A, 0x00, 0x17, 0x01, 0x8A, 0x00, 0x00,
+    0x01, 0x8A, 0x00, 0x17, 0x01, 0x8A, 0x00, 0x17, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x21, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43,
+    0x02, 0x76, 0x00, 0x43, 0x02, 0x76, 0x00, 0x43, 0x02, 0x53, 0x00, 0x0F,
+    0x03, 0x37, 0x00, 0x0F, 0x03, 0x37, 0x00, 0x0F, 0x03, 0x37, 0x00, 0x0F,
+    0x03, 0x37, 0x00, 0x0F, 0x03, 0x37, 0x00, 0x0F, 0x02, 0x50, 0x00, 0x12,
+    0x02, 0x5F, 0x00, 0x05, 0x02, 0x5F, 0x00, 0x05, 0x02, 0x5F, 0x00, 0x05,
+    0x02, 0x5F, 0x00, 0x05, 0x02, 0x5F, 0x00, 0x05, 0x02, 0x5F, 0x00, 0x05,
+    0x02, 0x5F, 0x00, 0x05, 0x02, 0x5F, 0x00, 0x05, 0x02, 0x5F, 0x00, 0x05,
+    0x02, 0x5F, 0x00, 0x05, 0x02, 0x11, 0x00, 0x32, 0x02, 0x11, 0x00, 0x32,
+    0x02, 0x11, 0x00, 0x32, 0x02, 0x11, 0x00, 0x32, 0x02, 0x11, 0x00, 0x32,
+    0x02, 0x3C, 0x00, 0x11, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0xFF, 0xFC, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29, 0x02, 0x2C, 0x00, 0x29,
+    0x02, 0x41, 0x00, 0x22, 0x02, 0x41, 0x00, 0x22, 0x02, 0x41, 0x00, 0x22,
+    0x02, 0x41, 0x00, 0x22, 0x02, 0x41, 0x00, 0x22, 0x02, 0x41, 0x00, 0x22,
+    0x02, 0x41, 0x00, 0x22, 0x03, 0x12, 0x00, 0x21, 0x04, 0x44, 0x00, 0x21,
+    0x05, 0x6F, 0x00, 0x21, 0x04, 0x31, 0x00, 0x21, 0x03, 0xE6, 0x00, 0x21,
+    0x02, 0xBB, 0x00, 0x21, 0x02, 0xA8, 0x00, 0x21, 0x01, 0x7F, 0x00, 0x11,
+    0x01, 0x81, 0x00, 0x1C, 0x02, 0xC7, 0x00, 0x02, 0x02, 0xC6, 0x00, 0x1B,
+    0x02, 0x6E, 0x00, 0x4C, 0x02, 0x7B, 0x00, 0x22, 0x02, 0x8D, 0x00, 0x2A,
+    0x02, 0x1E, 0x00, 0x4B, 0x02, 0x24, 0x00, 0x22, 0x02, 0x3B, 0x00, 0x16,
+    0x02, 0x88, 0x00, 0x16, 0x02, 0x4B, 0x00, 0x22, 0x02, 0x3C, 0x00, 0x24,
+    0x02, 0x25, 0x00, 0x32, 0x02, 0x50, 0x00, 0x2C, 0x02, 0x39, 0x00, 0x1E,
+    0x02, 0x8D, 0x00, 0x2A, 0x01, 0x8B, 0x00, 0x22, 0x01, 0x20, 0x00, 0x21,
+    0x01, 0x66, 0x00, 0x27, 0x01, 0x5F, 0x00, 0x2B, 0x01, 0x92, 0x00, 0x1F,
+    0x01, 0x6D, 0x00, 0x26, 0x01, 0x6E, 0x00, 0x23, 0x01, 0x49, 0x00, 0x2B,
+    0x01, 0x76, 0x00, 0x2A, 0x01, 0x64, 0x00, 0x22, 0x01, 0x8B, 0x00, 0x22,
+    0x01, 0x20, 0x00, 0x21, 0x01, 0x66, 0x00, 0x27, 0x01, 0x5F, 0x00, 0x2B,
+    0x01, 0x92, 0x00, 0x1F, 0x01, 0x6D, 0x00, 0x26, 0x01, 0x6E, 0x00, 0x23,
+    0x01, 0x49, 0x00, 0x2B, 0x01, 0x76, 0x00, 0x2A, 0x01, 0x64, 0x00, 0x22,
+    0x01, 0x8B, 0x00, 0x22, 0x01, 0x20, 0x00, 0x21, 0x01, 0x66, 0x00, 0x27,
+    0x01, 0x5F, 0x00, 0x2B, 0x01, 0x92, 0x00, 0x1F, 0x01, 0x6D, 0x00, 0x26,
+    0x01, 0x6E, 0x00, 0x23, 0x01, 0x49, 0x00, 0x2B, 0x01, 0x76, 0x00, 0x2A,
+    0x01, 0x64, 0x00, 0x22, 0x01, 0x8B, 0x00, 0x22, 0x01, 0x20, 0x00, 0x21,
+    0x01, 0x66, 0x00, 0x27, 0x01, 0x5F, 0x00, 0x2B, 0x01, 0x92, 0x00, 0x1F,
+    0x01, 0x6D, 0x00, 0x26, 0x01, 0x6E, 0x00, 0x23, 0x01, 0x49, 0x00, 0x2B,
+    0x01, 0x76, 0x00, 0x2A, 0x01, 0x64, 0x00, 0x22, 0x02, 0x5E, 0x00, 0x04,
+    0x03, 0x2D, 0x00, 0x29, 0x03, 0x2C, 0x00, 0x29, 0x03, 0x3F, 0x00, 0x16,
+    0x03, 0x40, 0x00, 0x3C, 0x03, 0x43, 0x00, 0x16, 0x03, 0x6B, 0x00, 0x22,
+    0x03, 0x50, 0x00, 0x3C, 0x01, 0x15, 0x00, 0x00, 0x02, 0x26, 0x00, 0x00,
+    0x00, 0x66, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x33, 0x00, 0x00,
+    0x01, 0x33, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0x00, 0x2B, 0x01, 0x19, 0x00, 0x2A, 0x00, 0xF7, 0x00, 0x2B,
+    0x01, 0x19, 0x00, 0x2B, 0x02, 0xB6, 0x00, 0x2B, 0x01, 0x1E, 0x00, 0x3C,
+    0x01, 0x1E, 0x00, 0x3B, 0x02, 0x10, 0x00, 0x17, 0x02, 0x10, 0x00, 0x17,
+    0x00, 0xF7, 0x00, 0x2B, 0x01, 0x5A, 0x00, 0x25, 0x01, 0xA7, 0x00, 0x15,
+    0x02, 0xCC, 0x00, 0x2A, 0x02, 0x47, 0x00, 0x0B, 0x02, 0x3F, 0x00, 0x1D,
+    0x00, 0xF7, 0x00, 0x2B, 0x01, 0x6B, 0x00, 0x2D, 0x02, 0x27, 0x00, 0x0B,
+    0x02, 0x20, 0x00, 0x1D, 0x00, 0x88, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0x2B,
+    0x01, 0xAF, 0x00, 0x34, 0x01, 0xB2, 0x00, 0x38, 0x02, 0x39, 0x00, 0x38,
+    0x03, 0x90, 0x00, 0x38, 0x02, 0x31, 0x00, 0x34, 0x03, 0x89, 0x00, 0x34,
+    0x01, 0xAF, 0x00, 0x34, 0x02, 0xB0, 0x00, 0x2C, 0x01, 0xAF, 0x00, 0x34,
+    0x02, 0x31, 0x00, 0x34, 0x03, 0x89, 0x00, 0x34, 0x01, 0x7E, 0x00, 0x28,
+    0x01, 0x7E, 0x00, 0x0C, 0x01, 0xA6, 0x00, 0x28, 0x01, 0xA6, 0x00, 0x1A,
+    0x01, 0x9E, 0x00, 0x50, 0x01, 0x9E, 0x00, 0x32, 0x01, 0x65, 0x00, 0x28,
+    0x01, 0x65, 0x00, 0x0C, 0x01, 0xA6, 0x00, 0x28, 0x01, 0xA6, 0x00, 0x1A,
+    0x01, 0x9E, 0x00, 0x50, 0x01, 0x9E, 0x00, 0x32, 0x01, 0x19, 0x00, 0x2A,
+    0x01, 0xFA, 0x00, 0x2A, 0x01, 0xE7, 0x00, 0x28, 0x01, 0xE6, 0x00, 0x18,
+    0x01, 0x09, 0x00, 0x28, 0x01, 0x09, 0x00, 0x18, 0x02, 0x1A, 0x00, 0x0B,
+    0x02, 0x1D, 0x00, 0x26, 0x01, 0x2D, 0x00, 0x0B, 0x01, 0x2F, 0x00, 0x26,
+    0x01, 0xC8, 0x00, 0x2A, 0x00, 0xED, 0x00, 0x2A, 0x02, 0x1A, 0x00, 0x0B,
+    0x02, 0x1D, 0x00, 0x26, 0x01, 0x2D, 0x00, 0x0B, 0x01, 0x2F, 0x00, 0x26,
+    0x02, 0x21, 0xFF, 0xFF, 0x03, 0xC5, 0x00, 0x28, 0x02, 0xFC, 0x00, 0x32,
+    0x02, 0xEB, 0x00, 0x2D, 0x02, 0x37, 0x00, 0x26, 0x03, 0x15, 0x00, 0x1D,
+    0x01, 0xFB, 0x00, 0x0E, 0x03, 0x56, 0x00, 0x21, 0x02, 0x14, 0x00, 0x66,
+    0x01, 0xD4, 0x00, 0x2A, 0x01, 0x22, 0x00, 0x4E, 0x01, 0x29, 0x00, 0x50,
+    0x01, 0xB8, 0x00, 0x2A, 0x02, 0x2F, 0x00, 0x13, 0x01, 0xA2, 0x00, 0x2A,
+    0x02, 0xA5, 0x00, 0x36, 0x04, 0xC2, 0x00, 0x5B, 0x03, 0xC5, 0x00, 0x28,
+    0x02, 0xB1, 0x00, 0x2D, 0x02, 0x2A, 0x00, 0x2C, 0x02, 0xB1, 0x00, 0x2D,
+    0x02, 0x2D, 0x00, 0x23, 0x02, 0x77, 0x00, 0x23, 0x02, 0x10, 0x00, 0x28,
+    0x02, 0x9D, 0x00, 0x11, 0x02, 0x65, 0x00, 0x21, 0x03, 0x09, 0x00, 0x2D,
+    0x02, 0xFC, 0x00, 0x1E, 0x02, 0x74, 0x00, 0x18, 0x02, 0x6C, 0x00, 0x15,
+    0x03, 0x01, 0x00, 0x5B, 0x03, 0x43, 0x00, 0x0E, 0x03, 0x12, 0x00, 0x44,
+    0x03, 0x10, 0x00, 0x44, 0x02, 0xCB, 0x00, 0x44, 0x02, 0x46, 0x00, 0x31,
+    0x02, 0x75, 0x00, 0x18, 0x03, 0xED, 0x00, 0x0C, 0x02, 0xA7, 0xFF, 0xFE,
+    0x01, 0x38, 0x00, 0x36, 0x02, 0x32, 0x00, 0x0A, 0x02, 0x53, 0x00, 0x2F,
+    0x02, 0x44, 0x00, 0x2A, 0x02, 0x05, 0x00, 0x25, 0x02, 0x55, 0x00, 0x2D,
+    0x02, 0x5D, 0x00, 0x3E, 0x02, 0x65, 0x00, 0x3A, 0x02, 0x0D, 0x00, 0x30,
+    0x02, 0x0D, 0x00, 0x2C, 0x02, 0x73, 0x00, 0x42, 0x02, 0x73, 0x00, 0x40,
+    0x02, 0x6E, 0x00, 0x3E, 0x02, 0x50, 0x00, 0x36, 0x02, 0x1F, 0x00, 0x23,
+    0x02, 0x9E, 0x00, 0x2C, 0x02, 0x4C, 0x00, 0x12, 0x03, 0x7E, 0x00, 0x2B,
+    0x02, 0x79, 0x00, 0x22, 0x02, 0x55, 0xFF, 0xEF, 0x02, 0xC6, 0x00, 0x1B,
+    0x02, 0xC7, 0x00, 0x02, 0x02, 0xDA, 0x00, 0x21, 0x02, 0x0B, 0x00, 0x2A,
+    0x02, 0xD1, 0x00, 0x0B, 0x02, 0x6E, 0x00, 0x4C, 0x02, 0x5C, 0x00, 0x24,
+    0x03, 0x9F, 0x00, 0x28, 0x05, 0x12, 0x00, 0x28, 0x02, 0x7A, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xA3,
+    0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x83,
+    0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xA2,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4B,
+    0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4A,
+    0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x5A,
+    0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x94,
+    0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xA2,
+    0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x61, 0x01, 0xF4, 0x00, 0x37,
+    0x01, 0xF4, 0x00, 0xA3, 0x01, 0xF4, 0x00, 0x83, 0x01, 0xF4, 0x00, 0x83,
+    0x01, 0xF4, 0x00, 0x20, 0x01, 0xF4, 0x00, 0x45, 0x01, 0xF4, 0x00, 0x4B,
+    0x01, 0x92, 0x00, 0x4C, 0x01, 0xF4, 0x00, 0x85, 0x01, 0xF4, 0x00, 0x4B,
+    0x01, 0xA8, 0x00, 0x5A, 0x01, 0xF4, 0x00, 0x91, 0x01, 0xF4, 0x00, 0x85,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x35,
+    0x00, 0x00, 0x00, 0xA3, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x7B,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x00, 0x1E,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x4A,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x7D,
+    0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x35,
+    0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x94,
+    0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x85,
+    0x00, 0xED, 0x00, 0x2A, 0x01, 0x09, 0x00, 0x28, 0x00, 0xDC, 0x00, 0x25,
+    0x00, 0xDC, 0x00, 0x37, 0x00, 0xF6, 0x00, 0x40, 0x00, 0xE7, 0x00, 0x43,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9C, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x4D, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0xC9, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05,
+    0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x00, 0xC7, 0x01, 0x09, 0x01, 0x0A,
+    0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E, 0x00, 0x62, 0x01, 0x0F,
+    0x00, 0xAD, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x00, 0x63,
+    0x01, 0x14, 0x00, 0xAE, 0x00, 0x90, 0x01, 0x15, 0x00, 0x25, 0x00, 0x26,
+    0x00, 0xFD, 0x00, 0xFF, 0x00, 0x64, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18,
+    0x00, 0x27, 0x01, 0x19, 0x01, 0x1A, 0x00, 0xE9, 0x01, 0x1B, 0x01, 0x1C,
+    0x01, 0x1D, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x20, 0x00, 0x28, 0x00, 0x65,
+    0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x00, 0xC8, 0x01, 0x24, 0x01, 0x25,
+    0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x00, 0xCA, 0x01, 0x2A,
+    0x01, 0x2B, 0x00, 0xCB, 0x01, 0x2C, 0x01, 0x2D, 0x01, 0x2E, 0x01, 0x2F,
+    0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x00, 0x29, 0x00, 0x2A, 0x00, 0xF8,
+    0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x00, 0x2B,
+    0x01, 0x38, 0x01, 0x39, 0x01, 0x3A, 0x01, 0x3B, 0x00, 0x2C, 0x01, 0x3C,
+    0x00, 0xCC, 0x01, 0x3D, 0x01, 0x3E, 0x00, 0xCD, 0x01, 0x3F, 0x00, 0xCE,
+    0x01, 0x40, 0x00, 0xFA, 0x01, 0x41, 0x00, 0xCF, 0x01, 0x42, 0x01, 0x43,
+    0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x00, 0x2D, 0x01, 0x47, 0x00, 0x2E,
+    0x01, 0x48, 0x00, 0x2F, 0x01, 0x49, 0x01, 0x4A, 0x01, 0x4B, 0x01, 0x4C,
+    0x01, 0x4D, 0x01, 0x4E, 0x01, 0x4F, 0x01, 0x50, 0x00, 0xE2, 0x00, 0x30,
+    0x01, 0x51, 0x00, 0x31, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55,
+    0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59, 0x01, 0x5A, 0x00, 0x66,
+    0x01, 0x5B, 0x00, 0x32, 0x00, 0xD0, 0x01, 0x5C, 0x01, 0x5D, 0x00, 0xD1,
+    0x01, 0x5E, 0x01, 0x5F, 0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63,
+    0x00, 0x67, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x00, 0xD3, 0x01, 0x67,
+    0x01, 0x68, 0x01, 0x69, 0x01, 0x6A, 0x01, 0x6B, 0x01, 0x6C, 0x01, 0x6D,
+    0x01, 0x6E, 0x01, 0x6F, 0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73,
+    0x00, 0x91, 0x01, 0x74, 0x00, 0xAF, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77,
+    0x00, 0xB0, 0x00, 0x33, 0x00, 0xED, 0x00, 0x34, 0x00, 0x35, 0x01, 0x78,
+    0x01, 0x79, 0x01, 0x7A, 0x01, 0x7B, 0x01, 0x7C, 0x01, 0x7D, 0x01, 0x7E,
+    0x00, 0x36, 0x01, 0x7F, 0x01, 0x80, 0x00, 0xE4, 0x01, 0x81, 0x00, 0xFB,
+    0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x86, 0x01, 0x87,
+    0x01, 0x88, 0x00, 0x37, 0x01, 0x89, 0x01, 0x8A, 0x01, 0x8B, 0x01, 0x8C,
+    0x01, 0x8D, 0x01, 0x8E, 0x00, 0x38, 0x00, 0xD4, 0x01, 0x8F, 0x01, 0x90,
+    0x00, 0xD5, 0x01, 0x91, 0x00, 0x68, 0x01, 0x92, 0x00, 0xD6, 0x01, 0x93,
+    0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97, 0x01, 0x98, 0x01, 0x99,
+    0x01, 0x9A, 0x01, 0x9B, 0x01, 0x9C, 0x01, 0x9D, 0x01, 0x9E, 0x01, 0x9F,
+    0x01, 0xA0, 0x01, 0xA1, 0x00, 0x39, 0x00, 0x3A, 0x01, 0xA2, 0x01, 0xA3,
+    0x01, 0xA4, 0x01, 0xA5, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0xEB, 0x01, 0xA6,
+    0x00, 0xBB, 0x01, 0xA7, 0x01, 0xA8, 0x01, 0xA9, 0x01, 0xAA, 0x01, 0xAB,
+    0x01, 0xAC, 0x00, 0x3D, 0x01, 0xAD, 0x00, 0xE6, 0x01, 0xAE, 0x01, 0xAF,
+    0x01, 0xB0, 0x01, 0xB1, 0x01, 0xB2, 0x01, 0xB3, 0x01, 0xB4, 0x01, 0xB5,
+    0x01, 0xB6, 0x01, 0xB7, 0x01, 0xB8, 0x01, 0xB9, 0x01, 0xBA, 0x01, 0xBB,
+    0x01, 0xBC, 0x01, 0xBD, 0x01, 0xBE, 0x01, 0xBF, 0x01, 0xC0, 0x01, 0xC1,
+    0x01, 0xC2, 0x01, 0xC3, 0x01, 0xC4, 0x01, 0xC5, 0x00, 0x44, 0x00, 0x69,
+    0x01, 0xC6, 0x01, 0xC7, 0x01, 0xC8, 0x01, 0xC9, 0x01, 0xCA, 0x01, 0xCB,
+    0x01, 0xCC, 0x00, 0x6B, 0x01, 0xCD, 0x01, 0xCE, 0x01, 0xCF, 0x01, 0xD0,
+    0x01, 0xD1, 0x01, 0xD2, 0x00, 0x6C, 0x01, 0xD3, 0x00, 0x6A, 0x01, 0xD4,
+    0x01, 0xD5, 0x01, 0xD6, 0x01, 0xD7, 0x00, 0x6E, 0x01, 0xD8, 0x00, 0x6D,
+    0x00, 0xA0, 0x01, 0xD9, 0x00, 0x45, 0x00, 0x46, 0x00, 0xFE, 0x01, 0x00,
+    0x00, 0x6F, 0x01, 0xDA, 0x01, 0xDB, 0x01, 0xDC, 0x00, 0x47, 0x00, 0xEA,
+    0x01, 0xDD, 0x01, 0x01, 0x01, 0xDE, 0x01, 0xDF, 0x01, 0xE0, 0x00, 0x48,
+    0x00, 0x70, 0x01, 0xE1, 0x01, 0xE2, 0x01, 0xE3, 0x00, 0x72, 0x01, 0xE4,
+    0x01, 0xE5, 0x01, 0xE6, 0x01, 0xE7, 0x01, 0xE8, 0x01, 0xE9, 0x00, 0x73,
+    0x01, 0xEA, 0x01, 0xEB, 0x00, 0x71, 0x01, 0xEC, 0x01, 0xED, 0x01, 0xEE,
+    0x01, 0xEF, 0x01, 0xF0, 0x01, 0xF1, 0x01, 0xF2, 0x01, 0xF3, 0x00, 0x49,
+    0x00, 0x4A, 0x00, 0xF9, 0x01, 0xF4, 0x01, 0xF5, 0x01, 0xF6, 0x01, 0xF7,
+    0x01, 0xF8, 0x00, 0x4B, 0x01, 0xF9, 0x01, 0xFA, 0x01, 0xFB, 0x01, 0xFC,
+    0x00, 0x4C, 0x00, 0xD7, 0x00, 0x74, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0x76,
+    0x01, 0xFF, 0x00, 0x77, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x00, 0x75,
+    0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08,
+    0x00, 0x4D, 0x02, 0x09, 0x02, 0x0A, 0x00, 0x4E, 0x02, 0x0B, 0x02, 0x0C,
+    0x00, 0x4F, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11,
+    0x02, 0x12, 0x02, 0x13, 0x00, 0xE3, 0x00, 0x50, 0x02, 0x14, 0x00, 0x51,
+    0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x02, 0x19, 0x02, 0x1A,
+    0x02, 0x1B, 0x02, 0x1C, 0x02, 0x1D, 0x00, 0x78, 0x02, 0x1E, 0x00, 0x52,
+    0x00, 0x79, 0x02, 0x1F, 0x02, 0x20, 0x00, 0x7B, 0x02, 0x21, 0x02, 0x22,
+    0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x00, 0x7C, 0x02, 0x27,
+    0x02, 0x28, 0x02, 0x29, 0x00, 0x7A, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C,
+    0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x02, 0x31, 0x02, 0x32,
+    0x02, 0x33, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36, 0x00, 0xA1, 0x02, 0x37,
+    0x00, 0x7D, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x00, 0xB1, 0x00, 0x53,
+    0x00, 0xEE, 0x00, 0x54, 0x00, 0x55, 0x02, 0x3B, 0x02, 0x3C, 0x02, 0x3D,
+    0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x02, 0x41, 0x00, 0x56, 0x02, 0x42,
+    0x02, 0x43, 0x00, 0xE5, 0x02, 0x44, 0x00, 0xFC, 0x02, 0x45, 0x02, 0x46,
+    0x02, 0x47, 0x02, 0x48, 0x02, 0x49, 0x00, 0x89, 0x00, 0x57, 0x02, 0x4A,
+    0x02, 0x4B, 0x02, 0x4C, 0x02, 0x4D, 0x02, 0x4E, 0x02, 0x4F, 0x02, 0x50,
+    0x00, 0x58, 0x00, 0x7E, 0x02, 0x51, 0x02, 0x52, 0x00, 0x80, 0x02, 0x53,
+    0x00, 0x81, 0x02, 0x54, 0x00, 0x7F, 0x02, 0x55, 0x02, 0x56, 0x02, 0x57,
+    0x02, 0x58, 0x02, 0x59, 0x02, 0x5A, 0x02, 0x5B, 0x02, 0x5C, 0x02, 0x5D,
+    0x02, 0x5E, 0x02, 0x5F, 0x02, 0x60, 0x02, 0x61, 0x02, 0x62, 0x02, 0x63,
+    0x00, 0x59, 0x00, 0x5A, 0x02, 0x64, 0x02, 0x65, 0x02, 0x66, 0x02, 0x67,
+    0x00, 0x5B, 0x00, 0x5C, 0x00, 0xEC, 0x02, 0x68, 0x00, 0xBA, 0x02, 0x69,
+    0x02, 0x6A, 0x02, 0x6B, 0x02, 0x6C, 0x02, 0x6D, 0x02, 0x6E, 0x00, 0x5D,
+    0x02, 0x6F, 0x00, 0xE7, 0x02, 0x70, 0x02, 0x71, 0x02, 0x72, 0x02, 0x73,
+    0x02, 0x74, 0x02, 0x75, 0x02, 0x76, 0x02, 0x77, 0x02, 0x78, 0x02, 0x79,
+    0x02, 0x7A, 0x02, 0x7B, 0x02, 0x7C, 0x02, 0x7D, 0x02, 0x7E, 0x02, 0x7F,
+    0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x02, 0x83, 0x02, 0x84, 0x02, 0x85,
+    0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89, 0x02, 0x8A, 0x02, 0x8B,
+    0x02, 0x8C, 0x02, 0x8D, 0x02, 0x8E, 0x02, 0x8F, 0x02, 0x90, 0x02, 0x91,
+    0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95, 0x02, 0x96, 0x02, 0x97,
+    0x02, 0x98, 0x00, 0xC0, 0x00, 0xC1, 0x00, 0x9D, 0x00, 0x9E, 0x02, 0x99,
+    0x02, 0x9A, 0x02, 0x9B, 0x00, 0x9B, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
+    0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B,
+    0x00, 0x1C, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E, 0x02, 0x9F, 0x02, 0xA0,
+    0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xA5, 0x02, 0xA6,
+    0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA9, 0x02, 0xAA, 0x02, 0xAB, 0x02, 0xAC,
+    0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xB0, 0x02, 0xB1, 0x02, 0xB2,
+    0x02, 0xB3, 0x02, 0xB4, 0x02, 0xB5, 0x02, 0xB6, 0x02, 0xB7, 0x02, 0xB8,
+    0x02, 0xB9, 0x02, 0xBA, 0x02, 0xBB, 0x02, 0xBC, 0x02, 0xBD, 0x02, 0xBE,
+    0x02, 0xBF, 0x02, 0xC0, 0x02, 0xC1, 0x02, 0xC2, 0x02, 0xC3, 0x02, 0xC4,
+    0x00, 0xBC, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6, 0x02, 0xC5, 0x02, 0xC6,
+    0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA, 0x02, 0xCB, 0x02, 0xCC,
+    0x00, 0x03, 0x02, 0xCD, 0x02, 0xCE, 0x02, 0xCF, 0x00, 0x11, 0x00, 0x0F,
+    0x00, 0x1D, 0x00, 0x1E, 0x00, 0xAB, 0x00, 0x04, 0x00, 0xA3, 0x00, 0x22,
+    0x00, 0xA2, 0x00, 0xC3, 0x00, 0x87, 0x00, 0x0D, 0x00, 0x06, 0x00, 0x12,
+    0x00, 0x3F, 0x02, 0xD0, 0x02, 0xD1, 0x02, 0xD2, 0x02, 0xD3, 0x02, 0xD4,
+    0x02, 0xD5, 0x00, 0x10, 0x02, 0xD6, 0x00, 0xB2, 0x00, 0xB3, 0x02, 0xD7,
+    0x02, 0xD8, 0x02, 0xD9, 0x00, 0x42, 0x02, 0xDA, 0x02, 0xDB, 0x02, 0xDC,
+    0x00, 0x0B, 0x00, 0x0C, 0x00, 0x5E, 0x00, 0x60, 0x00, 0x3E, 0x00, 0x40,
+    0x02, 0xDD, 0x02, 0xDE, 0x02, 0xDF, 0x02, 0xE0, 0x02, 0xE1, 0x02, 0xE2,
+    0x00, 0xC4, 0x00, 0xC5, 0x00, 0xB4, 0x00, 0xB5, 0x00, 0xB6, 0x00, 0xB7,
+    0x00, 0xA9, 0x00, 0xAA, 0x00, 0xBE, 0x00, 0xBF, 0x00, 0x05, 0x00, 0x0A,
+    0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6, 0x00, 0xA6, 0x00, 0x23,
+    0x00, 0x09, 0x00, 0x88, 0x00, 0x86, 0x00, 0x8B, 0x00, 0x8A, 0x00, 0x8C,
+    0x00, 0x83, 0x02, 0xE7, 0x00, 0x5F, 0x00, 0xE8, 0x00, 0x82, 0x02, 0xE8,
+    0x00, 0xC2, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x02, 0xEC, 0x00, 0x84,
+    0x02, 0xED, 0x00, 0xBD, 0x00, 0x07, 0x02, 0xEE, 0x02, 0xEF, 0x00, 0xF7,
+    0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5,
+    0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x00, 0x85, 0x02, 0xFA,
+    0x00, 0x96, 0x02, 0xFB, 0x02, 0xFC, 0x00, 0x0E, 0x00, 0xEF, 0x00, 0xF0,
+    0x00, 0xB8, 0x00, 0x20, 0x00, 0x8F, 0x00, 0x21, 0x00, 0x1F, 0x00, 0x95,
+    0x00, 0x94, 0x00, 0x93, 0x00, 0xA7, 0x00, 0x61, 0x00, 0xA4, 0x00, 0x41,
+    0x00, 0x92, 0x02, 0xFD, 0x00, 0x9C, 0x02, 0xFE, 0x02, 0xFF, 0x00, 0x9A,
+    0x00, 0x99, 0x00, 0xA5, 0x03, 0x00, 0x00, 0x98, 0x00, 0x08, 0x00, 0xC6,
+    0x00, 0xB9, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03, 0x03, 0x04, 0x03, 0x05,
+    0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09, 0x03, 0x0A, 0x03, 0x0B,
+    0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15, 0x03, 0x16, 0x03, 0x17,
+    0x03, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x03, 0x1B, 0x03, 0x1C, 0x03, 0x1D,
+    0x03, 0x1E, 0x03, 0x1F, 0x03, 0x20, 0x03, 0x21, 0x03, 0x22, 0x03, 0x23,
+    0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29,
+    0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x00, 0x8E, 0x00, 0xDC, 0x00, 0x43,
+    0x00, 0x8D, 0x00, 0xDF, 0x00, 0xD8, 0x00, 0xE1, 0x00, 0xDB, 0x00, 0xDD,
+    0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDE, 0x00, 0xE0, 0x03, 0x2D, 0x03, 0x2E,
+    0x03, 0x2F, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32, 0x03, 0x33, 0x03, 0x34,
+    0x03, 0x35, 0x03, 0x36, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A,
+    0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40,
+    0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46,
+    0x03, 0x47, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4A, 0x03, 0x4B, 0x03, 0x4C,
+    0x03, 0x4D, 0x03, 0x4E, 0x03, 0x4F, 0x03, 0x50, 0x03, 0x51, 0x03, 0x52,
+    0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56, 0x06, 0x41, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x32, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x34, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x38, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x30, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x32, 0x07, 0x41, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07,
+    0x41, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x0A, 0x41, 0x72, 0x69, 0x6E,
+    0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x41, 0x45, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x38, 0x0B, 0x43,
+    0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x0A, 0x43,
+    0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x46, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43,
+    0x34, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x06, 0x44, 0x63, 0x72,
+    0x6F, 0x61, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x43, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x46, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x35, 0x06,
+    0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x45, 0x63, 0x61, 0x72, 0x6F,
+    0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x43, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x30, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x34, 0x0A, 0x45, 0x64,
+    0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x41,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x36, 0x07, 0x45, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x36,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x34, 0x07, 0x45, 0x6F, 0x67,
+    0x6F, 0x6E, 0x65, 0x6B, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x43,
+    0x06, 0x47, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x0B, 0x47, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x32, 0x32, 0x0A, 0x47, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65,
+    0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x30, 0x04, 0x48,
+    0x62, 0x61, 0x72, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x41, 0x0B,
+    0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x34, 0x02, 0x49, 0x4A, 0x06, 0x49,
+    0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43,
+    0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x38, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x32, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x38, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x30, 0x41, 0x07, 0x49, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+    0x6E, 0x07, 0x49, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x06, 0x49, 0x74,
+    0x69, 0x6C, 0x64, 0x65, 0x0B, 0x4A, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D,
+    0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x33, 0x36,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x37, 0x06, 0x4C, 0x61, 0x63,
+    0x75, 0x74, 0x65, 0x06, 0x4C, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x33, 0x42, 0x04, 0x4C, 0x64, 0x6F, 0x74, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x41, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x41, 0x06, 0x4E, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x4E,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x34,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x34, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x34, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x39,
+    0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x42, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x34, 0x38, 0x03, 0x45, 0x6E, 0x67, 0x06, 0x4F, 0x62,
+    0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x31,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x30, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x32,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x34, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x43,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x41, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x33, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x43,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x45, 0x05, 0x4F, 0x68, 0x6F,
+    0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x41, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x45, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x30, 0x0D, 0x4F, 0x68, 0x75, 0x6E, 0x67,
+    0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x30, 0x45, 0x07, 0x4F, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x32, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x35, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x45, 0x41,
+    0x0B, 0x4F, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x43, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x34, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x43,
+    0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x52, 0x63, 0x61, 0x72,
+    0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x35, 0x36, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x32, 0x31, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x35, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x35, 0x45, 0x06, 0x53, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x34, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x36, 0x0B, 0x53, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31,
+    0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x30, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x39, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x38, 0x46, 0x04, 0x54, 0x62, 0x61, 0x72, 0x06, 0x54,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x36,
+    0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x41, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x45, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x44, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x34, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x45, 0x36, 0x05, 0x55, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x46, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x41, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x45, 0x0D, 0x55, 0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D,
+    0x6C, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x36,
+    0x07, 0x55, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x37, 0x41, 0x07, 0x55, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B,
+    0x05, 0x55, 0x72, 0x69, 0x6E, 0x67, 0x06, 0x55, 0x74, 0x69, 0x6C, 0x64,
+    0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37, 0x38, 0x06, 0x57, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x0B, 0x57, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D,
+    0x66, 0x6C, 0x65, 0x78, 0x09, 0x57, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73,
+    0x69, 0x73, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76, 0x65, 0x0B, 0x59, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x38, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46,
+    0x34, 0x06, 0x59, 0x67, 0x72, 0x61, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x46, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x32,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x38, 0x06, 0x5A, 0x61, 0x63,
+    0x75, 0x74, 0x65, 0x0A, 0x5A, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65,
+    0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x39, 0x32, 0x10, 0x49,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x5F, 0x4A, 0x2E, 0x6C, 0x6F, 0x63, 0x6C,
+    0x4E, 0x4C, 0x44, 0x06, 0x49, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x07, 0x49,
+    0x4A, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49, 0x62, 0x72, 0x65, 0x76,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x43, 0x46, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x10, 0x49, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E, 0x73, 0x73, 0x30, 0x31,
+    0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x38, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0E, 0x49, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x45,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F, 0x49, 0x64, 0x6F, 0x74, 0x61, 0x63,
+    0x63, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x41, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49,
+    0x67, 0x72, 0x61, 0x76, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x43, 0x38, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x41, 0x2E, 0x73, 0x73, 0x30, 0x31,
+    0x0C, 0x49, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0C, 0x49, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0B, 0x49, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x06, 0x4A, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x10, 0x4A, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x37, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x41, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x06, 0x61, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x31, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x37, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x31, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x33, 0x07,
+    0x61, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x61, 0x6F, 0x67, 0x6F,
+    0x6E, 0x65, 0x6B, 0x0A, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x07, 0x61, 0x65, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x30, 0x39, 0x0B, 0x63, 0x63, 0x69, 0x72, 0x63,
+    0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x0A, 0x63, 0x64, 0x6F, 0x74, 0x61,
+    0x63, 0x63, 0x65, 0x6E, 0x74, 0x06, 0x64, 0x63, 0x61, 0x72, 0x6F, 0x6E,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x44, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x30, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x36,
+    0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x65, 0x63, 0x61, 0x72,
+    0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x44, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x42, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x43, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x31, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x43, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x43, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x35, 0x0A, 0x65,
+    0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42,
+    0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x37, 0x07, 0x65, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31,
+    0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x35, 0x07, 0x65, 0x6F,
+    0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42,
+    0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x35, 0x39, 0x06, 0x67, 0x63,
+    0x61, 0x72, 0x6F, 0x6E, 0x0B, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D,
+    0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x32, 0x33,
+    0x0A, 0x67, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x31, 0x04, 0x68, 0x62, 0x61, 0x72,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x42, 0x0B, 0x68, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x32, 0x35, 0x06, 0x69, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x46, 0x09,
+    0x69, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x54, 0x52, 0x4B, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x42, 0x02, 0x69, 0x6A,
+    0x07, 0x69, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x69, 0x6F, 0x67,
+    0x6F, 0x6E, 0x65, 0x6B, 0x06, 0x69, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x37, 0x0B, 0x6A, 0x63, 0x69, 0x72,
+    0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x33, 0x37, 0x0C, 0x6B, 0x67, 0x72, 0x65, 0x65, 0x6E, 0x6C, 0x61,
+    0x6E, 0x64, 0x69, 0x63, 0x06, 0x6C, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x6C, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x33, 0x43, 0x04, 0x6C, 0x64, 0x6F, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x33, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x39, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x34, 0x33, 0x06, 0x6E, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0B, 0x6E,
+    0x61, 0x70, 0x6F, 0x73, 0x74, 0x72, 0x6F, 0x70, 0x68, 0x65, 0x06, 0x6E,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x34,
+    0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x35, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x34, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x37,
+    0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x43, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x34, 0x39, 0x03, 0x65, 0x6E, 0x67, 0x06, 0x6F, 0x62,
+    0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x32,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x31, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x33,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x35, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x44,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x42, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x33, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x44,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x46, 0x05, 0x6F, 0x68, 0x6F,
+    0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x42, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x46, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x31, 0x0D, 0x6F, 0x68, 0x75, 0x6E, 0x67,
+    0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x30, 0x46, 0x07, 0x6F, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x33, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x35, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x45, 0x42,
+    0x0B, 0x6F, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x44, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x34, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x44,
+    0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x72, 0x63, 0x61, 0x72,
+    0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x35, 0x37, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x32, 0x31, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x35, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x33, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x35, 0x46, 0x06, 0x73, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x35, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x37, 0x0B, 0x73, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x31, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x39, 0x04, 0x74, 0x62, 0x61, 0x72, 0x06, 0x74, 0x63, 0x61, 0x72, 0x6F,
+    0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x36, 0x33, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x39,
+    0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x44, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x46, 0x06, 0x75, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x34, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x31, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x35,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x37, 0x05, 0x75, 0x68, 0x6F,
+    0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x39, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x46, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x44, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x46, 0x0D, 0x75, 0x68, 0x75, 0x6E, 0x67,
+    0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x31, 0x37, 0x07, 0x75, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37, 0x42, 0x07, 0x75, 0x6F, 0x67,
+    0x6F, 0x6E, 0x65, 0x6B, 0x05, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x06, 0x75,
+    0x74, 0x69, 0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37,
+    0x39, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0B, 0x77, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x09, 0x77, 0x64, 0x69,
+    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x77, 0x67, 0x72, 0x61, 0x76,
+    0x65, 0x0B, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65,
+    0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x38, 0x46, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x46, 0x35, 0x06, 0x79, 0x67, 0x72, 0x61, 0x76, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x37, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x33, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x39,
+    0x06, 0x7A, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0A, 0x7A, 0x64, 0x6F, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x39, 0x33, 0x10, 0x69, 0x61, 0x63, 0x75, 0x74, 0x65, 0x5F, 0x6A, 0x2E,
+    0x6C, 0x6F, 0x63, 0x6C, 0x4E, 0x4C, 0x44, 0x06, 0x61, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0B, 0x61, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0B, 0x61, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x46, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x37, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x31,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42,
+    0x33, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x42, 0x35, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x45, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x10, 0x61, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x35, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x44, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x37, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x39,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41,
+    0x42, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x30, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0E, 0x61, 0x64, 0x69, 0x65,
+    0x72, 0x65, 0x73, 0x69, 0x73, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x41, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B,
+    0x61, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x33, 0x2E, 0x73, 0x73, 0x30, 0x31,
+    0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x33, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0C, 0x61, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x61, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0A, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0F, 0x61, 0x72, 0x69, 0x6E, 0x67, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61, 0x74, 0x69, 0x6C, 0x64,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x67, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0B, 0x67, 0x62, 0x72, 0x65, 0x76, 0x65, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0B, 0x67, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x10, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65,
+    0x78, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x32, 0x33, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F, 0x67, 0x64, 0x6F, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31,
+    0x03, 0x66, 0x5F, 0x66, 0x05, 0x66, 0x5F, 0x66, 0x5F, 0x69, 0x06, 0x66,
+    0x5F, 0x66, 0x5F, 0x69, 0x6A, 0x05, 0x66, 0x5F, 0x66, 0x5F, 0x6C, 0x04,
+    0x66, 0x5F, 0x69, 0x6A, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x39, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x41, 0x39, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x42, 0x43, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E, 0x7A, 0x65,
+    0x72, 0x6F, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E, 0x64, 0x6E, 0x6F, 0x6D,
+    0x08, 0x6F, 0x6E, 0x65, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x08, 0x74, 0x77,
+    0x6F, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x0A, 0x74, 0x68, 0x72, 0x65, 0x65,
+    0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x09, 0x66, 0x6F, 0x75, 0x72, 0x2E, 0x64,
+    0x6E, 0x6F, 0x6D, 0x09, 0x66, 0x69, 0x76, 0x65, 0x2E, 0x64, 0x6E, 0x6F,
+    0x6D, 0x08, 0x73, 0x69, 0x78, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x0A, 0x73,
+    0x65, 0x76, 0x65, 0x6E, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x0A, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x09, 0x6E, 0x69, 0x6E,
+    0x65, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x31, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x34, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x37, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x39, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E, 0x6E, 0x75, 0x6D, 0x72,
+    0x08, 0x6F, 0x6E, 0x65, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x08, 0x74, 0x77,
+    0x6F, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x0A, 0x74, 0x68, 0x72, 0x65, 0x65,
+    0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x09, 0x66, 0x6F, 0x75, 0x72, 0x2E, 0x6E,
+    0x75, 0x6D, 0x72, 0x09, 0x66, 0x69, 0x76, 0x65, 0x2E, 0x6E, 0x75, 0x6D,
+    0x72, 0x08, 0x73, 0x69, 0x78, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x0A, 0x73,
+    0x65, 0x76, 0x65, 0x6E, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x0A, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x09, 0x6E, 0x69, 0x6E,
+    0x65, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30, 0x42, 0x39, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30,
+    0x42, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x37, 0x34, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x37, 0x37, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x39, 0x09, 0x6F, 0x6E, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68,
+    0x0C, 0x74, 0x68, 0x72, 0x65, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68,
+    0x73, 0x0B, 0x66, 0x69, 0x76, 0x65, 0x65, 0x69, 0x67, 0x68, 0x74, 0x68,
+    0x73, 0x0C, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x65, 0x69, 0x67, 0x68, 0x74,
+    0x68, 0x73, 0x02, 0x43, 0x52, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30,
+    0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30, 0x41, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x30, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30, 0x41,
+    0x30, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30, 0x39, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x30, 0x42, 0x13, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64,
+    0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x0B, 0x62, 0x75, 0x6C, 0x6C, 0x65, 0x74, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x0A, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0E, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x16, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x63, 0x65,
+    0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x43,
+    0x41, 0x54, 0x1B, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x63, 0x65, 0x6E,
+    0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x43, 0x41,
+    0x54, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30,
+    0x41, 0x44, 0x0A, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x61, 0x73,
+    0x68, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x31, 0x35, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x31, 0x30, 0x0B, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6E,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x65, 0x6E, 0x64, 0x61, 0x73, 0x68,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x65, 0x6D, 0x64, 0x61, 0x73, 0x68,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x6C,
+    0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0F, 0x70, 0x61, 0x72,
+    0x65, 0x6E, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0E, 0x62, 0x72, 0x61, 0x63, 0x65, 0x6C, 0x65, 0x66, 0x74, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x0F, 0x62, 0x72, 0x61, 0x63, 0x65, 0x72, 0x69, 0x67,
+    0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x62, 0x72, 0x61, 0x63,
+    0x6B, 0x65, 0x74, 0x6C, 0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x11, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x72, 0x69, 0x67, 0x68,
+    0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x12, 0x67, 0x75, 0x69, 0x6C, 0x6C,
+    0x65, 0x6D, 0x6F, 0x74, 0x6C, 0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x13, 0x67, 0x75, 0x69, 0x6C, 0x6C, 0x65, 0x6D, 0x6F, 0x74, 0x72,
+    0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x12, 0x67, 0x75,
+    0x69, 0x6C, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x6C, 0x65, 0x66, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x13, 0x67, 0x75, 0x69, 0x6C, 0x73, 0x69, 0x6E,
+    0x67, 0x6C, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x06, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x07, 0x75, 0x6E, 0x69, 0x32,
+    0x31, 0x31, 0x33, 0x09, 0x65, 0x73, 0x74, 0x69, 0x6D, 0x61, 0x74, 0x65,
+    0x64, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x31, 0x31, 0x36, 0x07, 0x61, 0x74,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42,
+    0x35, 0x0D, 0x63, 0x6F, 0x6C, 0x6F, 0x6E, 0x6D, 0x6F, 0x6E, 0x65, 0x74,
+    0x61, 0x72, 0x79, 0x04, 0x64, 0x6F, 0x6E, 0x67, 0x04, 0x45, 0x75, 0x72,
+    0x6F, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42, 0x32, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x41, 0x44, 0x04, 0x6C, 0x69, 0x72, 0x61, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x42, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x42, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x41, 0x36, 0x06, 0x70,
+    0x65, 0x73, 0x65, 0x74, 0x61, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42,
+    0x31, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42, 0x44, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x42, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x41,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x31, 0x39, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x32, 0x31, 0x35, 0x08, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x73,
+    0x65, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x31, 0x32, 0x36, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x32, 0x30, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30,
+    0x42, 0x35, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33,
+    0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33,
+    0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33,
+    0x30, 0x39, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33,
+    0x30, 0x33, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33,
+    0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33,
+    0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33,
+    0x30, 0x39, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33,
+    0x30, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x0B, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30, 0x31, 0x0B, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30, 0x34, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x37, 0x30, 0x33, 0x30, 0x34, 0x09, 0x67, 0x72, 0x61, 0x76, 0x65,
+    0x63, 0x6F, 0x6D, 0x62, 0x09, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x31, 0x30, 0x33,
+    0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x42, 0x0B, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x43, 0x2E, 0x61, 0x6C, 0x74, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x43, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x43, 0x30, 0x33,
+    0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x41, 0x09, 0x74, 0x69, 0x6C, 0x64, 0x65,
+    0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33,
+    0x30, 0x33, 0x30, 0x38, 0x13, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x5F, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x0B, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x38, 0x0B, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x31, 0x0D, 0x68, 0x6F, 0x6F,
+    0x6B, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x31, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x31, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x31, 0x42, 0x0C, 0x64, 0x6F, 0x74, 0x62, 0x65,
+    0x6C, 0x6F, 0x77, 0x63, 0x6F, 0x6D, 0x62, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x32, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x36, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x32, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x33, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x33, 0x35, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38,
+    0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x30,
+    0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E, 0x67, 0x72, 0x61,
+    0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x31, 0x30, 0x33,
+    0x30, 0x37, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x42, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x32, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x30, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33,
+    0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x33, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x39,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30,
+    0x43, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x30, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x31,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30,
+    0x36, 0x30, 0x33, 0x30, 0x33, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x39, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x41, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x0E, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x38, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x18, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x5F, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30,
+    0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x38, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x30,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30,
+    0x34, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x12, 0x68,
+    0x6F, 0x6F, 0x6B, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30,
+    0x46, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x31, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x31, 0x42, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x32, 0x36, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x32, 0x37, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x32, 0x38, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x42, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x46, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x43, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x43, 0x38, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x28, 0x00, 0x54, 0x00, 0x02,
+    0x44, 0x46, 0x4C, 0x54, 0x00, 0x0E, 0x6C, 0x61, 0x74, 0x6E, 0x00, 0x0E,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x6B, 0x65, 0x72, 0x6E, 0x00, 0x26,
+    0x6D, 0x61, 0x72, 0x6B, 0x00, 0x1E, 0x6D, 0x6B, 0x6D, 0x6B, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x25, 0x4A, 0x05, 0x9C, 0x03, 0x52, 0x02, 0xD6, 0x00, 0x48,
+    0x00, 0x0E, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x02,
+    0x00, 0x01, 0x00, 0x28, 0x00, 0x28, 0x00, 0x01, 0x00, 0x1E, 0x00, 0x0C,
+    0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x01, 0x01, 0x75, 0x02, 0x7F,
+    0x00, 0x01, 0x01, 0x74, 0x02, 0x87, 0x00, 0x02, 0x00, 0x00, 0x24, 0xC2,
+    0x00, 0x00, 0x24, 0x6E, 0x00, 0x01, 0x00, 0x02, 0x03, 0x0D, 0x03, 0x43,
+    0x00, 0x06, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x01,
+    0x02, 0x6E, 0x02, 0x6E, 0x00, 0x01, 0x01, 0x64, 0x00, 0x0C, 0x00, 0x42,
+    0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x01, 0x52, 0x01, 0x4C, 0x01, 0x46,
+    0x01, 0x40, 0x01, 0x3A, 0x01, 0x34, 0x01, 0x2E, 0x01, 0x28, 0x01, 0x34,
+    0x01, 0x28, 0x01, 0x22, 0x01, 0x22, 0x01, 0x1C, 0x01, 0x16, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x52, 0x01, 0x22, 0x01, 0x10, 0x01, 0x16, 0x01, 0x0A,
+    0x01, 0x04, 0x00, 0xFE, 0x01, 0x22, 0x00, 0xF8, 0x00, 0xF2, 0x00, 0xF2,
+    0x01, 0x16, 0x01, 0x16, 0x01, 0x22, 0x00, 0xEC, 0x00, 0xE6, 0x00, 0xE0,
+    0x00, 0xDA, 0x00, 0xE6, 0x00, 0xD4, 0x00, 0xCE, 0x00, 0xC8, 0x00, 0xC2,
+    0x00, 0xBC, 0x00, 0xB6, 0x00, 0xB0, 0x00, 0xAA, 0x00, 0xA4, 0x00, 0x9E,
+    0x00, 0xE6, 0x00, 0xE6, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98,
+    0x00, 0x92, 0x00, 0xB6, 0x00, 0xDA, 0x00, 0x8C, 0x00, 0xDA, 0x00, 0xB6,
+    0x00, 0xDA, 0x00, 0x86, 0x00, 0x8C, 0x00, 0xB6, 0x00, 0xE6, 0x00, 0xE6,
+    0x00, 0x01, 0x00, 0xF8, 0x04, 0x1E, 0x00, 0x01, 0x01, 0x00, 0x04, 0x1E,
+    0x00, 0x01, 0x00, 0xFB, 0x03, 0x73, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x65,
+    0x00, 0x01, 0x00, 0xC5, 0x03, 0x65, 0x00, 0x01, 0x00, 0xFB, 0x03, 0x65,
+    0x00, 0x01, 0x00, 0xBC, 0x03, 0x65, 0x00, 0x01, 0x00, 0xE0, 0x03, 0x65,
+    0x00, 0x01, 0x00, 0xFB, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xF7, 0x03, 0x6D,
+    0x00, 0x01, 0x00, 0xEA, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xF6, 0x03, 0x6D,
+    0x00, 0x01, 0x00, 0xF9, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xFB, 0x04, 0x1E,
+    0x00, 0x01, 0x00, 0xFA, 0x04, 0x1E, 0x00, 0x01, 0x01, 0x00, 0x03, 0xB3,
+    0x00, 0x01, 0x00, 0xFA, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xC2,
+    0x00, 0x01, 0x00, 0xFA, 0x02, 0xCC, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x80,
+    0x00, 0x01, 0x00, 0xFA, 0x03, 0x9E, 0x00, 0x01, 0x00, 0xFB, 0x03, 0x06,
+    0x00, 0x01, 0x00, 0xFA, 0x03, 0x7F, 0x00, 0x01, 0x00, 0xFB, 0x03, 0x13,
+    0x00, 0x01, 0x00, 0xFB, 0x02, 0xD6, 0x00, 0x01, 0x00, 0xEA, 0x02, 0xC2,
+    0x00, 0x01, 0x00, 0xFA, 0x02, 0xD6, 0x00, 0x01, 0x00, 0xFA, 0x03, 0xA2,
+    0x00, 0x01, 0x00, 0xF9, 0x03, 0x1E, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xD9,
+    0x00, 0x01, 0x00, 0xFB, 0x03, 0x1E, 0x00, 0x01, 0x00, 0xC1, 0x03, 0x1E,
+    0x00, 0x01, 0x00, 0xE4, 0x03, 0x1E, 0x00, 0x01, 0x00, 0xB7, 0x03, 0x1E,
+    0x00, 0x01, 0x00, 0xFA, 0x03, 0x1E, 0x00, 0x42, 0x00, 0x00, 0x23, 0x78,
+    0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78,
+    0x00, 0x00, 0x23, 0x72, 0x00, 0x00, 0x23, 0x6C, 0x00, 0x00, 0x23, 0x66,
+    0x00, 0x00, 0x23, 0x60, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x5A,
+    0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78,
+    0x00, 0x00, 0x23, 0x54, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x4E,
+    0x00, 0x00, 0x23, 0x60, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78,
+    0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x60,
+    0x00, 0x00, 0x23, 0x60, 0x00, 0x00, 0x23, 0x60, 0x00, 0x00, 0x23, 0x60,
+    0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78,
+    0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x60,
+    0x00, 0x00, 0x23, 0x48, 0x00, 0x00, 0x23, 0x78, 0x00, 0x00, 0x23, 0x78,
+    0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24,
+    0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x1E, 0x00, 0x00, 0x23, 0x1E,
+    0x00, 0x00, 0x23, 0x18, 0x00, 0x00, 0x23, 0x12, 0x00, 0x00, 0x23, 0x0C,
+    0x00, 0x00, 0x23, 0x1E, 0x00, 0x00, 0x23, 0x06, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x23, 0x1E, 0x00, 0x00, 0x22, 0xFA, 0x00, 0x00, 0x23, 0x24,
+    0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24,
+    0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x1E,
+    0x00, 0x00, 0x23, 0x1E, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24,
+    0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x1E, 0x00, 0x00, 0x23, 0x24,
+    0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x24, 0x00, 0x00, 0x23, 0x1E,
+    0x00, 0x00, 0x22, 0xF4, 0x00, 0x00, 0x23, 0x24, 0x00, 0x02, 0x00, 0x03,
+    0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11,
+    0x03, 0x23, 0x03, 0x42, 0x00, 0x22, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x01,
+    0x00, 0x3C, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x2A, 0x00, 0x2A, 0x00, 0x24,
+    0x19, 0x14, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x24, 0x00, 0x12, 0x00, 0x01,
+    0x00, 0xFA, 0xFF, 0x0B, 0x00, 0x01, 0x00, 0xFB, 0xFF, 0x40, 0x00, 0x01,
+    0x00, 0xFA, 0xFF, 0x15, 0x00, 0x01, 0x00, 0xFA, 0xFE, 0xEB, 0x00, 0x01,
+    0x00, 0xFA, 0xFF, 0x26, 0x00, 0x08, 0x00, 0x00, 0x21, 0xD6, 0x00, 0x00,
+    0x21, 0xD6, 0x00, 0x00, 0x21, 0xD6, 0x00, 0x00, 0x21, 0xD0, 0x00, 0x00,
+    0x21, 0xD6, 0x00, 0x00, 0x21, 0xD0, 0x00, 0x00, 0x21, 0xD6, 0x00, 0x00,
+    0x21, 0xD6, 0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10,
+    0x03, 0x11, 0x03, 0x13, 0x03, 0x14, 0x03, 0x44, 0x03, 0x45, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x02, 0x1A, 0x00, 0xE6,
+    0x00, 0x02, 0x00, 0xF0, 0x00, 0x0C, 0x00, 0x07, 0x00, 0xC4, 0x00, 0xAA,
+    0x00, 0x78, 0x00, 0x5E, 0x00, 0x3C, 0x00, 0x26, 0x00, 0x10, 0x00, 0x02,
+    0x1A, 0x70, 0x1A, 0x6A, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x02, 0x19,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x19, 0x02, 0xE4, 0x00, 0x02, 0x1A, 0x5A,
+    0x1A, 0x54, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x02, 0x22, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x22, 0x02, 0xD9, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x16,
+    0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0xDB, 0x02, 0xE4, 0x00, 0x01, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0xF3, 0x02, 0xE4, 0x00, 0x03, 0x1A, 0x22, 0x1A, 0x1C, 0x00, 0x76,
+    0x00, 0x70, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x01, 0x03, 0xA2, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0xA2, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x2C, 0x00, 0x26,
+    0x00, 0x20, 0x00, 0x1A, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x01, 0x04, 0x4F,
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x4F, 0x02, 0xE4, 0x00, 0x01, 0x02, 0x96,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x96, 0x02, 0xE4, 0x00, 0x01, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xDC, 0x02, 0xE4, 0x00, 0x03, 0x19, 0xD6,
+    0x19, 0xD0, 0x00, 0x2A, 0x00, 0x24, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x01,
+    0x03, 0xAB, 0x00, 0x00, 0x00, 0x01, 0x03, 0xAB, 0x02, 0xD9, 0x00, 0x02,
+    0x19, 0xBC, 0x19, 0xB6, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x02, 0x4E,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x4E, 0x02, 0xE4, 0x00, 0x02, 0x00, 0x01,
+    0x02, 0x19, 0x02, 0x1F, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x20, 0xE4,
+    0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4,
+    0x00, 0x00, 0x20, 0xDE, 0x00, 0x00, 0x20, 0xD8, 0x00, 0x00, 0x20, 0xD2,
+    0x00, 0x00, 0x20, 0xCC, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xC6,
+    0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4,
+    0x00, 0x00, 0x20, 0xC0, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xBA,
+    0x00, 0x00, 0x20, 0xCC, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4,
+    0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xCC,
+    0x00, 0x00, 0x20, 0xCC, 0x00, 0x00, 0x20, 0xCC, 0x00, 0x00, 0x20, 0xCC,
+    0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4,
+    0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xCC,
+    0x00, 0x00, 0x20, 0xB4, 0x00, 0x00, 0x20, 0xE4, 0x00, 0x00, 0x20, 0xE4,
+    0x00, 0x01, 0x20, 0xA8, 0x00, 0x01, 0x20, 0xA8, 0x00, 0x01, 0x20, 0xA8,
+    0x00, 0x01, 0x20, 0xA2, 0x00, 0x01, 0x20, 0xA8, 0x00, 0x01, 0x20, 0xA2,
+    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90,
+    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x20, 0x8A,
+    0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x20, 0x7E, 0x00, 0x00, 0x20, 0x78,
+    0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x20, 0x72, 0x00, 0x00, 0x20, 0x6C,
+    0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x20, 0x66, 0x00, 0x00, 0x20, 0x90,
+    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90,
+    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x8A,
+    0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90,
+    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x00, 0x20, 0x90,
+    0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x8A,
+    0x00, 0x00, 0x20, 0x60, 0x00, 0x00, 0x20, 0x90, 0x00, 0x01, 0x20, 0xA8,
+    0x00, 0x01, 0x20, 0xA8, 0x00, 0x02, 0x00, 0x06, 0x02, 0xEA, 0x02, 0xFA,
+    0x00, 0x00, 0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11, 0x03, 0x0E, 0x03, 0x11,
+    0x00, 0x22, 0x03, 0x13, 0x03, 0x14, 0x00, 0x26, 0x03, 0x23, 0x03, 0x42,
+    0x00, 0x28, 0x03, 0x44, 0x03, 0x45, 0x00, 0x48, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x1F, 0x90, 0x1D, 0x46, 0x00, 0x05,
+    0x1D, 0xBC, 0x00, 0x0C, 0x02, 0x14, 0x1D, 0x34, 0x00, 0x00, 0x1D, 0x2E,
+    0x1D, 0x28, 0x00, 0x00, 0x1D, 0x22, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28,
+    0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00,
+    0x1D, 0x16, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x1C,
+    0x00, 0x00, 0x1D, 0x10, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x16, 0x00, 0x00,
+    0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x1D, 0x2E,
+    0x1D, 0x28, 0x00, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28,
+    0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00,
+    0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x16,
+    0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00,
+    0x1D, 0x10, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x1D, 0x2E,
+    0x1D, 0x28, 0x00, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28,
+    0x00, 0x00, 0x1D, 0x16, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00,
+    0x1D, 0x0A, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x1C,
+    0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x34, 0x00, 0x00,
+    0x1D, 0x10, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x04, 0x00, 0x00, 0x1D, 0x2E,
+    0x1D, 0x28, 0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28,
+    0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00,
+    0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1D, 0x34,
+    0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1C, 0xFE, 0x00, 0x00,
+    0x1D, 0x2E, 0x1D, 0x28, 0x00, 0x00, 0x1C, 0xF8, 0x00, 0x00, 0x1D, 0x2E,
+    0x1D, 0x28, 0x00, 0x00, 0x1D, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x1D, 0x28,
+    0x00, 0x00, 0x1C, 0xF2, 0x00, 0x00, 0x1C, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xE6, 0x00, 0x00, 0x1C, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x34,
+    0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00,
+    0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0xCE, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xCE,
+    0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xCE, 0x00, 0x00,
+    0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xC2, 0x00, 0x00, 0x1C, 0xBC,
+    0x00, 0x00, 0x1C, 0xB6, 0x1C, 0xC2, 0x00, 0x00, 0x1C, 0xBC, 0x00, 0x00,
+    0x1C, 0xB6, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xBC, 0x00, 0x00, 0x1C, 0xB6,
+    0x1C, 0xC2, 0x00, 0x00, 0x1C, 0xBC, 0x00, 0x00, 0x1C, 0xB6, 0x1C, 0xC2,
+    0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00, 0x1C, 0xB6, 0x1C, 0xC2, 0x00, 0x00,
+    0x1C, 0xA4, 0x00, 0x00, 0x1C, 0xB6, 0x1C, 0x9E, 0x00, 0x00, 0x1C, 0x98,
+    0x1C, 0x92, 0x00, 0x00, 0x1C, 0x8C, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92,
+    0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00,
+    0x1C, 0x86, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86,
+    0x00, 0x00, 0x1C, 0x80, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00,
+    0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x7A, 0x00, 0x00, 0x1C, 0x98,
+    0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1C, 0x74, 0x1C, 0x92,
+    0x00, 0x00, 0x1C, 0x7A, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00,
+    0x1C, 0x7A, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x7A,
+    0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x6E, 0x00, 0x00,
+    0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1C, 0x98,
+    0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92,
+    0x00, 0x00, 0x1C, 0x9E, 0x00, 0x00, 0x1C, 0x74, 0x1C, 0x92, 0x00, 0x00,
+    0x1C, 0x68, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86,
+    0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00,
+    0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1C, 0x98,
+    0x1C, 0x92, 0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92,
+    0x00, 0x00, 0x1C, 0x5C, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00,
+    0x1C, 0x9E, 0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x86,
+    0x00, 0x00, 0x1C, 0x98, 0x1C, 0x92, 0x00, 0x00, 0x1C, 0x56, 0x00, 0x00,
+    0x1C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x4A, 0x00, 0x00, 0x1C, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E, 0x00, 0x00, 0x1C, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x3E, 0x00, 0x00, 0x1C, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x3E, 0x00, 0x00, 0x1C, 0x44, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x4A,
+    0x00, 0x00, 0x1C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E, 0x00, 0x00,
+    0x1C, 0x44, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E, 0x00, 0x00, 0x1C, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x32, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00,
+    0x1C, 0x26, 0x1C, 0x20, 0x00, 0x00, 0x1C, 0x1A, 0x00, 0x00, 0x1C, 0x14,
+    0x1C, 0x32, 0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x26, 0x1C, 0x08,
+    0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x26, 0x1C, 0x32, 0x00, 0x00,
+    0x1C, 0x02, 0x00, 0x00, 0x1C, 0x26, 0x1B, 0xFC, 0x00, 0x00, 0x1B, 0xF6,
+    0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF0,
+    0x00, 0x00, 0x1B, 0xEA, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00,
+    0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xE4,
+    0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00,
+    0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x1B, 0xF6,
+    0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0,
+    0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00,
+    0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xFC,
+    0x00, 0x00, 0x1B, 0xD2, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xCC, 0x00, 0x00,
+    0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xF6,
+    0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0,
+    0x00, 0x00, 0x1B, 0xE4, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00,
+    0x1B, 0xFC, 0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xE4,
+    0x00, 0x00, 0x1B, 0xF6, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xC6, 0x00, 0x00,
+    0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xBA, 0x00, 0x00, 0x1B, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xB4, 0x00, 0x00, 0x1B, 0xAE, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xB4, 0x00, 0x00, 0x1B, 0xA8, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0xA2, 0x1B, 0x9C, 0x1B, 0x96, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00,
+    0x1B, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x90, 0x1B, 0x8A, 0x1B, 0x9C,
+    0x1B, 0x96, 0x00, 0x00, 0x1B, 0x90, 0x1B, 0xA2, 0x1B, 0x9C, 0x1B, 0x96,
+    0x00, 0x00, 0x1B, 0x90, 0x1B, 0xA2, 0x1B, 0x9C, 0x1B, 0x84, 0x00, 0x00,
+    0x1B, 0x90, 0x1B, 0xA2, 0x1B, 0x9C, 0x1B, 0x96, 0x00, 0x00, 0x1B, 0x90,
+    0x1B, 0xA2, 0x1B, 0x9C, 0x1B, 0x7E, 0x00, 0x00, 0x1B, 0x90, 0x1B, 0xA2,
+    0x1B, 0x9C, 0x1B, 0x96, 0x00, 0x00, 0x1B, 0x90, 0x1B, 0xA2, 0x1B, 0x9C,
+    0x1B, 0x78, 0x00, 0x00, 0x1B, 0x90, 0x1B, 0x72, 0x1B, 0x6C, 0x1B, 0x66,
+    0x00, 0x00, 0x1B, 0x60, 0x1B, 0x5A, 0x00, 0x00, 0x1B, 0x54, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x5A, 0x00, 0x00, 0x1B, 0x4E, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x48, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x3C,
+    0x00, 0x00, 0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x36, 0x00, 0x00,
+    0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x48, 0x00, 0x00, 0x1B, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x36, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x48, 0x00, 0x00, 0x1B, 0x2A, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x48, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x48,
+    0x00, 0x00, 0x1B, 0x24, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x36, 0x00, 0x00,
+    0x1B, 0x42, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1E, 0x1B, 0x18, 0x1B, 0x12,
+    0x1B, 0x0C, 0x1B, 0x06, 0x1B, 0x00, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C,
+    0x1B, 0x06, 0x1A, 0xFA, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06,
+    0x1A, 0xFA, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA,
+    0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xF4, 0x1B, 0x18,
+    0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA, 0x1B, 0x18, 0x1A, 0xEE,
+    0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xF4, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C,
+    0x1B, 0x06, 0x1A, 0xF4, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06,
+    0x1A, 0xF4, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xE8,
+    0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA, 0x1B, 0x18,
+    0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xE2, 0x1B, 0x18, 0x1B, 0x12,
+    0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xE2, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C,
+    0x1B, 0x06, 0x1B, 0x1E, 0x1B, 0x18, 0x1A, 0xEE, 0x1B, 0x0C, 0x1B, 0x06,
+    0x1A, 0xDC, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA,
+    0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1B, 0x1E, 0x00, 0x00,
+    0x1B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x1B, 0x12,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x1E, 0x00, 0x00, 0x1A, 0xEE, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xDC, 0x00, 0x00, 0x1B, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0xFA, 0x00, 0x00, 0x1B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFA,
+    0x00, 0x00, 0x1B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xD6, 0x1B, 0x18,
+    0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA, 0x1B, 0x18, 0x1B, 0x12,
+    0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C,
+    0x1B, 0x06, 0x1A, 0xD0, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06,
+    0x1A, 0xCA, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1B, 0x1E,
+    0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xC4, 0x1B, 0x18,
+    0x1A, 0xBE, 0x1B, 0x0C, 0x1B, 0x06, 0x1C, 0xCE, 0x1B, 0x18, 0x1A, 0xBE,
+    0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xFA, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C,
+    0x1B, 0x06, 0x1A, 0xD0, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06,
+    0x1A, 0xE2, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xE2,
+    0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06, 0x1A, 0xB8, 0x00, 0x00,
+    0x1A, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xAC, 0x00, 0x00, 0x1B, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0xAC, 0x00, 0x00, 0x1B, 0x66, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x1E, 0x1B, 0x18, 0x1B, 0x12, 0x1B, 0x0C, 0x1B, 0x06,
+    0x1A, 0xA6, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x9A,
+    0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00,
+    0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA6, 0x00, 0x00, 0x1A, 0x8E,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0xA6, 0x00, 0x00, 0x1A, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x94, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xA6,
+    0x00, 0x00, 0x1A, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x76, 0x00, 0x00,
+    0x1A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1A, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x6A, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x6A, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x64, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x76,
+    0x00, 0x00, 0x1A, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x6A, 0x00, 0x00,
+    0x1A, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x76, 0x00, 0x00, 0x1A, 0x58,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x6A, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x76, 0x00, 0x00, 0x1A, 0x52, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x6A, 0x00, 0x00, 0x1A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x4C,
+    0x00, 0x00, 0x1A, 0x46, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x32, 0x00, 0x00,
+    0x1C, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x1A, 0x3A,
+    0x00, 0x00, 0x1A, 0x34, 0x1A, 0x40, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00,
+    0x1A, 0x34, 0x1A, 0x2E, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00, 0x1A, 0x34,
+    0x1A, 0x40, 0x00, 0x00, 0x1A, 0x28, 0x00, 0x00, 0x1A, 0x34, 0x1A, 0x40,
+    0x00, 0x00, 0x1A, 0x22, 0x00, 0x00, 0x1A, 0x34, 0x1A, 0x40, 0x00, 0x00,
+    0x1A, 0x1C, 0x00, 0x00, 0x1A, 0x34, 0x1A, 0x40, 0x00, 0x00, 0x1A, 0x16,
+    0x00, 0x00, 0x1A, 0x34, 0x1A, 0x10, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE,
+    0x00, 0x00, 0x19, 0xF8, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0xF2, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2,
+    0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2, 0x1A, 0x0A,
+    0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xEC, 0x1A, 0x0A, 0x1A, 0x04,
+    0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE,
+    0x00, 0x00, 0x1A, 0x10, 0x1A, 0x0A, 0x19, 0xE6, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0xE0, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2,
+    0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x1A, 0x10, 0x00, 0x00,
+    0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF8, 0x00, 0x00, 0x1A, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x10, 0x00, 0x00, 0x19, 0xE6, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xF2, 0x00, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF2,
+    0x00, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x19, 0xDA, 0x1A, 0x0A,
+    0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2, 0x1A, 0x0A, 0x1A, 0x04,
+    0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE,
+    0x00, 0x00, 0x19, 0xD4, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00,
+    0x1A, 0x10, 0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xCE,
+    0x1A, 0x0A, 0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xF2, 0x1A, 0x0A,
+    0x1A, 0x04, 0x19, 0xFE, 0x00, 0x00, 0x19, 0xC8, 0x1A, 0x0A, 0x1A, 0x04,
+    0x19, 0xFE, 0x00, 0x00, 0x19, 0xC2, 0x00, 0x00, 0x19, 0xBC, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xB6, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xAA, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xA4,
+    0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xA4, 0x00, 0x00,
+    0x19, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x19, 0x9E, 0x00, 0x00, 0x19, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x98, 0x00, 0x00, 0x1A, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x92, 0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00,
+    0x1D, 0x04, 0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86,
+    0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86, 0x00, 0x00,
+    0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86, 0x00, 0x00, 0x19, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x92, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x86, 0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86,
+    0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86, 0x00, 0x00,
+    0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x9E, 0x00, 0x00, 0x19, 0x7A,
+    0x00, 0x00, 0x19, 0x74, 0x1C, 0x8C, 0x00, 0x00, 0x19, 0x7A, 0x00, 0x00,
+    0x19, 0x74, 0x1C, 0x86, 0x00, 0x00, 0x19, 0x7A, 0x00, 0x00, 0x19, 0x74,
+    0x1C, 0x86, 0x00, 0x00, 0x19, 0x7A, 0x00, 0x00, 0x19, 0x74, 0x1C, 0x9E,
+    0x00, 0x00, 0x19, 0x6E, 0x00, 0x00, 0x19, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00, 0x19, 0x68,
+    0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x62,
+    0x00, 0x00, 0x19, 0x5C, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00,
+    0x19, 0x56, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x19, 0x56,
+    0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00,
+    0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x19, 0x50, 0x00, 0x00, 0x19, 0x68,
+    0x19, 0x62, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62,
+    0x00, 0x00, 0x19, 0x4A, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00,
+    0x19, 0x56, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x1B, 0xA2,
+    0x00, 0x00, 0x19, 0x44, 0x19, 0x62, 0x00, 0x00, 0x19, 0x3E, 0x00, 0x00,
+    0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x68,
+    0x19, 0x62, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62,
+    0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00,
+    0x1B, 0xA2, 0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x19, 0x56,
+    0x00, 0x00, 0x19, 0x68, 0x19, 0x62, 0x00, 0x00, 0x19, 0x38, 0x00, 0x00,
+    0x19, 0x32, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2C, 0x00, 0x00, 0x19, 0x32,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x9C, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x90, 0x19, 0x26, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0x1A, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A,
+    0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x14, 0x00, 0x00,
+    0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x0E,
+    0x19, 0xFE, 0x00, 0x00, 0x19, 0x14, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE,
+    0x00, 0x00, 0x19, 0x14, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0x14, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A,
+    0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00,
+    0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x19, 0x20,
+    0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00, 0x19, 0x0E, 0x19, 0xFE,
+    0x00, 0x00, 0x19, 0x14, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0x14, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x14,
+    0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00,
+    0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x18, 0xFC, 0x00, 0x00, 0x19, 0x20,
+    0x19, 0xFE, 0x00, 0x00, 0x19, 0x26, 0x00, 0x00, 0x19, 0x0E, 0x19, 0xFE,
+    0x00, 0x00, 0x18, 0xF6, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0x1A, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A,
+    0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x1A, 0x00, 0x00,
+    0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x19, 0x26, 0x00, 0x00, 0x19, 0x20,
+    0x19, 0xFE, 0x00, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE,
+    0x00, 0x00, 0x18, 0xEA, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00,
+    0x19, 0x1A, 0x00, 0x00, 0x19, 0x20, 0x19, 0xFE, 0x00, 0x00, 0x18, 0xE4,
+    0x00, 0x00, 0x18, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x18, 0xD8, 0x00, 0x00,
+    0x18, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x18, 0xCC,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xC6, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xBA, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0xBA, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x18, 0xC6,
+    0x00, 0x00, 0x18, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x18, 0xBA, 0x00, 0x00,
+    0x18, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x18, 0xBA, 0x00, 0x00, 0x18, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0xAE, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xA8, 0x18, 0xA2, 0x18, 0x9C, 0x00, 0x00, 0x18, 0x96,
+    0x18, 0xA8, 0x18, 0xA2, 0x18, 0x9C, 0x00, 0x00, 0x18, 0x96, 0x18, 0xA8,
+    0x18, 0xA2, 0x18, 0x9C, 0x00, 0x00, 0x18, 0x96, 0x18, 0xA8, 0x18, 0xA2,
+    0x18, 0x90, 0x00, 0x00, 0x18, 0x96, 0x18, 0xA8, 0x18, 0xA2, 0x18, 0x8A,
+    0x00, 0x00, 0x18, 0x96, 0x00, 0x00, 0x18, 0xA2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00,
+    0x18, 0x72, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x72,
+    0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x72, 0x00, 0x00,
+    0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x18, 0x6C,
+    0x18, 0x78, 0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78,
+    0x00, 0x00, 0x18, 0x66, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00,
+    0x18, 0x72, 0x00, 0x00, 0x18, 0x60, 0x18, 0x78, 0x00, 0x00, 0x18, 0x5A,
+    0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x5A, 0x00, 0x00,
+    0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x5A, 0x00, 0x00, 0x18, 0x7E,
+    0x18, 0x78, 0x00, 0x00, 0x18, 0x54, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78,
+    0x00, 0x00, 0x18, 0x4E, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00,
+    0x18, 0x4E, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x84,
+    0x00, 0x00, 0x18, 0x60, 0x18, 0x78, 0x00, 0x00, 0x18, 0x48, 0x00, 0x00,
+    0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x18, 0x7E,
+    0x18, 0x78, 0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78,
+    0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00,
+    0x18, 0x42, 0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x42,
+    0x00, 0x00, 0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x3C, 0x00, 0x00,
+    0x18, 0x7E, 0x18, 0x78, 0x00, 0x00, 0x18, 0x72, 0x00, 0x00, 0x18, 0x7E,
+    0x18, 0x78, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x2A, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x1E, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1E,
+    0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1E, 0x00, 0x00,
+    0x18, 0x24, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x12, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x1E, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x0C, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x18, 0x00, 0x18, 0x0C,
+    0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x00,
+    0x17, 0xFA, 0x00, 0x00, 0x18, 0x00, 0x17, 0xF4, 0x00, 0x00, 0x18, 0x06,
+    0x00, 0x00, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x17, 0xEE, 0x00, 0x00,
+    0x18, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x17, 0xE2, 0x17, 0xDC, 0x00, 0x00,
+    0x17, 0xD6, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xC4,
+    0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xC4, 0x00, 0x00,
+    0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xC4, 0x00, 0x00, 0x17, 0xD0,
+    0x17, 0xCA, 0x00, 0x00, 0x17, 0xC4, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA,
+    0x00, 0x00, 0x17, 0xBE, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00,
+    0x17, 0xB8, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xB2,
+    0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xB8, 0x00, 0x00,
+    0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x17, 0xAC,
+    0x17, 0xDC, 0x00, 0x00, 0x17, 0xA6, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA,
+    0x00, 0x00, 0x17, 0xC4, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00,
+    0x17, 0xC4, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xE8,
+    0x00, 0x00, 0x17, 0xE2, 0x17, 0xDC, 0x00, 0x00, 0x17, 0xC4, 0x00, 0x00,
+    0x17, 0xD0, 0x17, 0xCA, 0x00, 0x00, 0x17, 0xB8, 0x00, 0x00, 0x17, 0xD0,
+    0x17, 0xCA, 0x00, 0x00, 0x17, 0xC4, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xCA,
+    0x00, 0x00, 0x17, 0xA0, 0x00, 0x00, 0x17, 0x9A, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x94, 0x00, 0x00, 0x17, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x17, 0x8E,
+    0x00, 0x00, 0x1B, 0x96, 0x00, 0x00, 0x00, 0x00, 0x17, 0x8E, 0x00, 0x00,
+    0x1B, 0x84, 0x00, 0x00, 0x00, 0x00, 0x17, 0x88, 0x00, 0x00, 0x18, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x82, 0x17, 0x7C, 0x17, 0x76, 0x00, 0x00,
+    0x17, 0x70, 0x17, 0x6A, 0x17, 0x7C, 0x17, 0x76, 0x00, 0x00, 0x17, 0x70,
+    0x17, 0x82, 0x17, 0x7C, 0x17, 0x76, 0x00, 0x00, 0x17, 0x70, 0x17, 0x82,
+    0x17, 0x7C, 0x17, 0x64, 0x00, 0x00, 0x17, 0x70, 0x17, 0x82, 0x17, 0x7C,
+    0x17, 0x76, 0x00, 0x00, 0x17, 0x70, 0x17, 0x82, 0x17, 0x7C, 0x17, 0x5E,
+    0x00, 0x00, 0x17, 0x70, 0x17, 0x82, 0x17, 0x7C, 0x17, 0x76, 0x00, 0x00,
+    0x17, 0x70, 0x17, 0x82, 0x17, 0x7C, 0x17, 0x58, 0x00, 0x00, 0x17, 0x70,
+    0x17, 0x52, 0x17, 0x4C, 0x17, 0x46, 0x00, 0x00, 0x17, 0x40, 0x17, 0x3A,
+    0x00, 0x00, 0x17, 0x34, 0x00, 0x00, 0x00, 0x00, 0x17, 0x3A, 0x00, 0x00,
+    0x17, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x00, 0x00, 0x18, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x22, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x1C, 0x00, 0x00, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x22, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28,
+    0x00, 0x00, 0x17, 0x16, 0x00, 0x00, 0x00, 0x00, 0x17, 0x10, 0x00, 0x00,
+    0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x00, 0x00, 0x17, 0xEE,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x28, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x28, 0x00, 0x00, 0x17, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x22, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04,
+    0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE,
+    0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE, 0x16, 0xF8,
+    0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2,
+    0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC,
+    0x16, 0xE0, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6,
+    0x16, 0xFE, 0x16, 0xDA, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE0, 0x16, 0xFE,
+    0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE0, 0x16, 0xFE, 0x16, 0xF8,
+    0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE0, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2,
+    0x16, 0xEC, 0x16, 0xD4, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC,
+    0x16, 0xCE, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xC8,
+    0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xC8, 0x16, 0xFE,
+    0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x17, 0x04, 0x16, 0xFE, 0x16, 0xDA,
+    0x16, 0xF2, 0x16, 0xEC, 0x16, 0xC2, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2,
+    0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC,
+    0x17, 0x04, 0x00, 0x00, 0x16, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x16, 0xE6,
+    0x00, 0x00, 0x16, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00,
+    0x16, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC2, 0x00, 0x00, 0x16, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xE6, 0x00, 0x00, 0x16, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xE6, 0x00, 0x00, 0x16, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0xE6, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6,
+    0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE,
+    0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xBC, 0x16, 0xFE, 0x16, 0xF8,
+    0x16, 0xF2, 0x16, 0xEC, 0x16, 0xBC, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2,
+    0x16, 0xEC, 0x17, 0x04, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC,
+    0x17, 0x04, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6,
+    0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xE6, 0x16, 0xFE,
+    0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x16, 0xB6, 0x16, 0xFE, 0x16, 0xF8,
+    0x16, 0xF2, 0x16, 0xEC, 0x16, 0xB0, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2,
+    0x16, 0xEC, 0x16, 0xAA, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC,
+    0x16, 0xA4, 0x00, 0x00, 0x16, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x16, 0x98,
+    0x00, 0x00, 0x18, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x16, 0x98, 0x00, 0x00,
+    0x18, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x16, 0x98, 0x00, 0x00, 0x18, 0xCC,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x92, 0x00, 0x00, 0x16, 0x8C, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x86, 0x00, 0x00, 0x16, 0x8C, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x86, 0x00, 0x00, 0x16, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x92,
+    0x00, 0x00, 0x16, 0x80, 0x00, 0x00, 0x00, 0x00, 0x16, 0x7A, 0x00, 0x00,
+    0x16, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x92, 0x00, 0x00, 0x16, 0x74,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x86, 0x00, 0x00, 0x16, 0x8C, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x92, 0x00, 0x00, 0x16, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x68, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x62,
+    0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5C, 0x00, 0x00,
+    0x1F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x62, 0x00, 0x00, 0x1F, 0x3C,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x56, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x68, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x62, 0x00, 0x00, 0x1F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x68,
+    0x00, 0x00, 0x16, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x16, 0x44, 0x00, 0x00,
+    0x1F, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x16, 0x68, 0x00, 0x00, 0x16, 0x3E,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x44, 0x00, 0x00, 0x16, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x38, 0x00, 0x00, 0x16, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x2C, 0x16, 0x26, 0x18, 0x30, 0x00, 0x00, 0x16, 0x20, 0x16, 0x2C,
+    0x16, 0x26, 0x18, 0x30, 0x00, 0x00, 0x16, 0x20, 0x16, 0x2C, 0x16, 0x26,
+    0x18, 0x30, 0x00, 0x00, 0x16, 0x20, 0x16, 0x2C, 0x16, 0x26, 0x16, 0x1A,
+    0x00, 0x00, 0x16, 0x20, 0x16, 0x2C, 0x16, 0x26, 0x16, 0x14, 0x00, 0x00,
+    0x16, 0x20, 0x16, 0x0E, 0x16, 0x26, 0x18, 0x30, 0x00, 0x00, 0x16, 0x20,
+    0x16, 0x2C, 0x16, 0x26, 0x16, 0x08, 0x00, 0x00, 0x16, 0x20, 0x16, 0x2C,
+    0x16, 0x26, 0x16, 0x02, 0x00, 0x00, 0x16, 0x20, 0x15, 0xFC, 0x15, 0xF6,
+    0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A,
+    0x15, 0xF0, 0x00, 0x00, 0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0,
+    0x00, 0x00, 0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00,
+    0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xE4,
+    0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xDE, 0x15, 0xF6,
+    0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xFC, 0x15, 0xF6, 0x1A, 0x1C,
+    0x15, 0xF0, 0x00, 0x00, 0x15, 0xD8, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0,
+    0x00, 0x00, 0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00,
+    0x15, 0xFC, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEA,
+    0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFC, 0x00, 0x00,
+    0x1A, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x15, 0xD8, 0x00, 0x00, 0x1A, 0x3A,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0xEA, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xEA, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xEA,
+    0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xEA, 0x15, 0xF6,
+    0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xD2, 0x15, 0xF6, 0x1A, 0x3A,
+    0x15, 0xF0, 0x00, 0x00, 0x15, 0xFC, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0,
+    0x00, 0x00, 0x15, 0xCC, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00,
+    0x15, 0xEA, 0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xC6,
+    0x15, 0xF6, 0x1A, 0x3A, 0x15, 0xF0, 0x00, 0x00, 0x15, 0xC0, 0x00, 0x00,
+    0x15, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x15, 0xB4, 0x00, 0x00, 0x15, 0xAE,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0xA8, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xA8, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9C,
+    0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x15, 0x96, 0x00, 0x00,
+    0x15, 0x90, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00, 0x19, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x84, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x84, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x7E, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x7E,
+    0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x8A, 0x00, 0x00,
+    0x15, 0x78, 0x00, 0x00, 0x00, 0x00, 0x15, 0x72, 0x00, 0x00, 0x19, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x84, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x84, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x84, 0x00, 0x00, 0x19, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6C,
+    0x00, 0x00, 0x1B, 0xF6, 0x00, 0x00, 0x15, 0x66, 0x15, 0x60, 0x00, 0x00,
+    0x1B, 0xF6, 0x00, 0x00, 0x15, 0x66, 0x15, 0x60, 0x00, 0x00, 0x1B, 0xF6,
+    0x00, 0x00, 0x15, 0x66, 0x15, 0x5A, 0x00, 0x00, 0x1B, 0xF6, 0x00, 0x00,
+    0x15, 0x66, 0x15, 0x6C, 0x00, 0x00, 0x1B, 0xD2, 0x00, 0x00, 0x15, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCA, 0x00, 0x00, 0x15, 0x54,
+    0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00, 0x15, 0x4E,
+    0x15, 0x48, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48,
+    0x00, 0x00, 0x15, 0x42, 0x00, 0x00, 0x15, 0x36, 0x15, 0x48, 0x00, 0x00,
+    0x15, 0x3C, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x3C,
+    0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00,
+    0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00, 0x15, 0x4E,
+    0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48,
+    0x00, 0x00, 0x15, 0x30, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00,
+    0x15, 0x42, 0x00, 0x00, 0x15, 0x36, 0x15, 0x48, 0x00, 0x00, 0x15, 0x3C,
+    0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00,
+    0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00, 0x15, 0x4E,
+    0x15, 0x48, 0x00, 0x00, 0x15, 0x2A, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48,
+    0x00, 0x00, 0x15, 0x24, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00,
+    0x15, 0x54, 0x00, 0x00, 0x15, 0x36, 0x15, 0x48, 0x00, 0x00, 0x15, 0x1E,
+    0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00, 0x15, 0x4E,
+    0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48,
+    0x00, 0x00, 0x15, 0x54, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00,
+    0x15, 0x18, 0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x12,
+    0x00, 0x00, 0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x42, 0x00, 0x00,
+    0x15, 0x4E, 0x15, 0x48, 0x00, 0x00, 0x15, 0x0C, 0x00, 0x00, 0x15, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFA,
+    0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF4, 0x00, 0x00,
+    0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x15, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x48, 0x00, 0x00, 0x1B, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0xE0, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x56,
+    0x00, 0x00, 0x1C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0xEE, 0x00, 0x00,
+    0x14, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE2, 0x00, 0x00, 0x1C, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0xDC, 0x00, 0x00, 0x14, 0xD6, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0xD0, 0x00, 0x00, 0x14, 0xCA, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0x04, 0x16, 0xFE, 0x16, 0xF8, 0x16, 0xF2, 0x16, 0xEC, 0x00, 0x01,
+    0x01, 0xF2, 0x00, 0x00, 0x00, 0x01, 0x01, 0xF2, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x87, 0x00, 0x00, 0x00, 0x01, 0x01, 0x87, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x84, 0x02, 0xBC, 0x00, 0x01, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xA4, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x20, 0x02, 0xDD, 0x00, 0x01,
+    0x01, 0x20, 0x02, 0xC6, 0x00, 0x01, 0x01, 0x20, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x20, 0xFF, 0x1A, 0x00, 0x01, 0x01, 0x20, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x16, 0x03, 0xDF, 0x00, 0x01, 0x01, 0x16, 0x03, 0x17, 0x00, 0x01,
+    0x01, 0x02, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x16, 0x02, 0xDD, 0x00, 0x01,
+    0x00, 0xD7, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x17, 0x03, 0x22, 0x00, 0x01,
+    0x01, 0x16, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x16, 0x03, 0x22, 0x00, 0x01,
+    0x01, 0x16, 0x02, 0xD9, 0x00, 0x01, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x16, 0x00, 0x00, 0x00, 0x01, 0x01, 0x16, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x09, 0x02, 0xDD, 0x00, 0x01, 0x01, 0x09, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x09, 0x01, 0x09, 0x00, 0x01, 0x01, 0x09, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x1C, 0x02, 0xD9, 0x00, 0x01, 0x01, 0xF1, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0x30, 0x02, 0xDD, 0x00, 0x01, 0x01, 0x30, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x30, 0x02, 0x11, 0x00, 0x01, 0x01, 0x28, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x28, 0x02, 0x11, 0x00, 0x01, 0x01, 0x88, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x9C, 0x02, 0xDD, 0x00, 0x01, 0x01, 0x9C, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x9C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x9C, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x2A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2A, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x3B, 0x03, 0x0A, 0x00, 0x01, 0x01, 0x3B, 0x03, 0x17, 0x00, 0x01,
+    0x01, 0x3B, 0x03, 0x83, 0x00, 0x01, 0x01, 0x27, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x3B, 0x02, 0xDD, 0x00, 0x01, 0x00, 0xFC, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x3B, 0x02, 0xD9, 0x00, 0x01, 0x02, 0x1E, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x62, 0x02, 0x11, 0x00, 0x01, 0x01, 0x3B, 0x02, 0x11, 0x00, 0x01,
+    0x00, 0xC5, 0xFF, 0x40, 0x00, 0x01, 0x00, 0xC5, 0xFF, 0x26, 0x00, 0x01,
+    0x00, 0xC4, 0x03, 0x30, 0x00, 0x01, 0x00, 0xC5, 0xFE, 0xEB, 0x00, 0x01,
+    0x00, 0xC5, 0xFF, 0x0B, 0x00, 0x01, 0x00, 0xC5, 0x01, 0x09, 0x00, 0x01,
+    0x01, 0x1B, 0x03, 0x2F, 0x00, 0x01, 0x00, 0xC4, 0x02, 0x64, 0x00, 0x01,
+    0x01, 0x4D, 0x00, 0x00, 0x00, 0x01, 0x01, 0x4D, 0x02, 0x11, 0x00, 0x01,
+    0x00, 0xFB, 0xFF, 0x26, 0x00, 0x01, 0x00, 0xF5, 0x02, 0xDD, 0x00, 0x01,
+    0x00, 0xFB, 0xFE, 0xEB, 0x00, 0x01, 0x00, 0xFB, 0xFF, 0x0B, 0x00, 0x01,
+    0x00, 0xF5, 0x03, 0x22, 0x00, 0x01, 0x00, 0xF5, 0x02, 0xC6, 0x00, 0x01,
+    0x00, 0xF5, 0x02, 0xD9, 0x00, 0x01, 0x00, 0xF5, 0x02, 0x11, 0x00, 0x01,
+    0x00, 0x8C, 0xFF, 0x40, 0x00, 0x01, 0x00, 0x8C, 0xFF, 0x26, 0x00, 0x01,
+    0x00, 0xC0, 0x02, 0xD9, 0x00, 0x01, 0x00, 0x8C, 0xFE, 0xEB, 0x00, 0x01,
+    0x01, 0x00, 0x02, 0xD9, 0x00, 0x01, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x02, 0x11, 0x00, 0x01, 0x01, 0x45, 0x02, 0x11, 0x00, 0x01,
+    0x02, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x06, 0x02, 0x0F, 0x00, 0x01,
+    0x01, 0x3D, 0x03, 0xA2, 0x00, 0x01, 0x01, 0x3C, 0x03, 0x83, 0x00, 0x01,
+    0x01, 0x3D, 0x03, 0x0A, 0x00, 0x01, 0x01, 0x3D, 0x02, 0xCF, 0x00, 0x01,
+    0x01, 0x29, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x3D, 0x03, 0xA6, 0x00, 0x01,
+    0x01, 0x3D, 0x02, 0xDD, 0x00, 0x01, 0x00, 0xFD, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x3D, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x3D, 0x03, 0x22, 0x00, 0x01,
+    0x01, 0x3D, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x3D, 0x01, 0x09, 0x00, 0x01,
+    0x01, 0xE2, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3D, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x65, 0x02, 0x11, 0x00, 0x01, 0x01, 0x3D, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x38, 0xFF, 0x40, 0x00, 0x01, 0x01, 0x56, 0x02, 0xDD, 0x00, 0x01,
+    0x01, 0x38, 0xFE, 0xEB, 0x00, 0x01, 0x01, 0x7A, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x56, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x56, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0xDB, 0xFF, 0x26, 0x00, 0x01, 0x01, 0xDB, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xDB, 0x02, 0x11, 0x00, 0x01, 0x00, 0xA8, 0x01, 0x72, 0x00, 0x01,
+    0x00, 0xA8, 0x00, 0x00, 0x00, 0x01, 0x01, 0x17, 0x02, 0xE4, 0x00, 0x01,
+    0x00, 0xA8, 0x02, 0xE4, 0x00, 0x01, 0x00, 0x90, 0xFF, 0x40, 0x00, 0x01,
+    0x00, 0x90, 0xFF, 0x26, 0x00, 0x01, 0x00, 0x90, 0xFE, 0xEB, 0x00, 0x01,
+    0x00, 0x96, 0x03, 0x95, 0x00, 0x01, 0x00, 0x90, 0x01, 0x72, 0x00, 0x01,
+    0x00, 0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x02, 0xE4, 0x00, 0x01,
+    0x00, 0x90, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x2E, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x2F, 0x02, 0xE4, 0x00, 0x01, 0x00, 0x9C, 0x02, 0xD9, 0x00, 0x01,
+    0x00, 0x94, 0xFF, 0x1A, 0x00, 0x01, 0x00, 0x9C, 0x02, 0x11, 0x00, 0x01,
+    0x00, 0x74, 0x02, 0xD9, 0x00, 0x01, 0x00, 0x99, 0xFF, 0x26, 0x00, 0x01,
+    0x00, 0x89, 0x03, 0x22, 0x00, 0x01, 0x00, 0x88, 0x02, 0xDD, 0x00, 0x01,
+    0x00, 0x49, 0x02, 0xD9, 0x00, 0x01, 0x00, 0x88, 0x02, 0xD9, 0x00, 0x01,
+    0x00, 0xC9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x88, 0x02, 0x11, 0x00, 0x01, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x99, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x38, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x38, 0x03, 0x95, 0x00, 0x01,
+    0x01, 0x38, 0xFF, 0x15, 0x00, 0x01, 0x00, 0xA6, 0x02, 0x7E, 0x00, 0x01,
+    0x01, 0x38, 0x00, 0x00, 0x00, 0x01, 0x01, 0x38, 0x02, 0xE4, 0x00, 0x01,
+    0x01, 0x4C, 0x02, 0xDD, 0x00, 0x01, 0x01, 0x4C, 0x02, 0xC6, 0x00, 0x01,
+    0x01, 0x4C, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x4C, 0xFF, 0x1A, 0x00, 0x01,
+    0x01, 0x4C, 0x02, 0x11, 0x00, 0x01, 0x00, 0xC5, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0xC5, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x25, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x31, 0x02, 0xCF, 0x00, 0x01, 0x01, 0x1D, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x31, 0x02, 0xDD, 0x00, 0x01, 0x00, 0xF2, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0x31, 0x03, 0x22, 0x00, 0x01, 0x01, 0x42, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0x32, 0x03, 0x22, 0x00, 0x01, 0x01, 0x42, 0xFF, 0x0B, 0x00, 0x01,
+    0x01, 0x31, 0x02, 0xD9, 0x00, 0x01, 0x01, 0xFE, 0x00, 0x04, 0x00, 0x01,
+    0x01, 0x42, 0x00, 0x00, 0x00, 0x01, 0x01, 0x31, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x44, 0xFF, 0x40, 0x00, 0x01, 0x01, 0x44, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0xE6, 0x02, 0x7A, 0x00, 0x01, 0x01, 0x44, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x67, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x44, 0x02, 0xE4, 0x00, 0x01,
+    0x01, 0x2D, 0x02, 0xDD, 0x00, 0x01, 0x01, 0x2E, 0xFF, 0x0B, 0x00, 0x01,
+    0x01, 0x2D, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x2D, 0x02, 0x11, 0x00, 0x01, 0x01, 0x45, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x45, 0x02, 0xE4, 0x00, 0x01, 0x01, 0xC7, 0x02, 0xD9, 0x00, 0x01,
+    0x01, 0xC2, 0x00, 0x00, 0x00, 0x01, 0x01, 0xC7, 0x02, 0x11, 0x00, 0x01,
+    0x01, 0x46, 0x03, 0xDF, 0x00, 0x01, 0x01, 0x46, 0x03, 0x17, 0x00, 0x01,
+    0x01, 0x32, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x46, 0x02, 0xDD, 0x00, 0x01,
+    0x01, 0x07, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x47, 0x03, 0x22, 0x00, 0x01,
+    0x01, 0x46, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x46, 0x03, 0x22, 0x00, 0x01,
+    0x01, 0x46, 0x02, 0xD9, 0x00, 0x01, 0x01, 0x46, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x46, 0x02, 0x11, 0x00, 0x01, 0x01, 0x9F, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x21, 0x00, 0x00, 0x00, 0x01, 0x01, 0x9F, 0x02, 0xBC, 0x00, 0x01,
+    0x00, 0xA5, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xA7, 0xFF, 0x26, 0x00, 0x01,
+    0x00, 0xAD, 0x03, 0xB3, 0x00, 0x01, 0x00, 0x75, 0x03, 0x6D, 0x00, 0x01,
+    0x00, 0xA7, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xAD, 0x03, 0x6D, 0x00, 0x01,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0x01, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x52, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x52, 0x01, 0x5E, 0x00, 0x01,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x01, 0x01, 0x54, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0x54, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x54, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x54, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x5E, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0xEF, 0x03, 0x6D, 0x00, 0x01, 0x01, 0xF1, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0xF7, 0x03, 0x6D, 0x00, 0x01, 0x01, 0xF1, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xF1, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x65, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x65, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x81, 0x04, 0x1E, 0x00, 0x01,
+    0x01, 0x7B, 0x03, 0x73, 0x00, 0x01, 0x01, 0x7B, 0x04, 0x1E, 0x00, 0x01,
+    0x01, 0xAF, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x78, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x7B, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x49, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x7B, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x81, 0x03, 0x6D, 0x00, 0x01,
+    0x02, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x7B, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0xE1, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x7B, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x3B, 0xFF, 0x40, 0x00, 0x01, 0x01, 0x3B, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0x3B, 0xFE, 0xEB, 0x00, 0x01, 0x01, 0x3B, 0xFF, 0x0B, 0x00, 0x01,
+    0x01, 0x3B, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x3B, 0x01, 0x5E, 0x00, 0x01,
+    0x01, 0x3B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3B, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x8E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8E, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x50, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x50, 0xFE, 0xEB, 0x00, 0x01,
+    0x01, 0x50, 0xFF, 0x0B, 0x00, 0x01, 0x01, 0x4C, 0x04, 0x1E, 0x00, 0x01,
+    0x01, 0x4C, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x50, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x4C, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x5E, 0xFF, 0x40, 0x00, 0x01,
+    0x01, 0x5E, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x16, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x5E, 0xFE, 0xEB, 0x00, 0x01, 0x01, 0x48, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x4E, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x5E, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x48, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x47, 0x02, 0xBC, 0x00, 0x01,
+    0x02, 0x14, 0x00, 0x00, 0x00, 0x01, 0x02, 0x14, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x8D, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8D, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x8F, 0x04, 0x1E, 0x00, 0x01, 0x01, 0x97, 0x04, 0x1E, 0x00, 0x01,
+    0x01, 0xC6, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x8F, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x91, 0x04, 0x1E, 0x00, 0x01, 0x01, 0x5F, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x91, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x91, 0x03, 0x65, 0x00, 0x01,
+    0x01, 0x91, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x97, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x91, 0x01, 0x5E, 0x00, 0x01, 0x02, 0x7C, 0x00, 0x04, 0x00, 0x01,
+    0x01, 0x91, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0E, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x91, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x92, 0xFF, 0x40, 0x00, 0x01,
+    0x01, 0x92, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x92, 0xFE, 0xEB, 0x00, 0x01,
+    0x01, 0x92, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x98, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x92, 0x00, 0x00, 0x00, 0x01, 0x01, 0x92, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0xB5, 0xFF, 0x26, 0x00, 0x01, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xB5, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xC0, 0x01, 0x5E, 0x00, 0x01,
+    0x01, 0x47, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5A, 0x02, 0xBC, 0x00, 0x01,
+    0x00, 0xBF, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x2F, 0xFF, 0x40, 0x00, 0x01,
+    0x01, 0x2F, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x2F, 0xFE, 0xEB, 0x00, 0x01,
+    0x00, 0xAE, 0x03, 0x6D, 0x00, 0x01, 0x00, 0xA8, 0x01, 0x5E, 0x00, 0x01,
+    0x01, 0x2F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x43, 0x02, 0xBC, 0x00, 0x01,
+    0x00, 0xA7, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x70, 0xFE, 0xEB, 0x00, 0x01,
+    0x01, 0x70, 0x00, 0x00, 0x00, 0x01, 0x01, 0x70, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x9C, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x49, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x9C, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x07, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x09, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x0F, 0x03, 0xB3, 0x00, 0x01,
+    0x00, 0xD7, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x09, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x0F, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x7C, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x09, 0x00, 0x00, 0x00, 0x01, 0x01, 0x09, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x83, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x83, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x83, 0xFF, 0x15, 0x00, 0x01, 0x01, 0xA1, 0x01, 0x5E, 0x00, 0x01,
+    0x01, 0xA1, 0x00, 0x00, 0x00, 0x01, 0x01, 0xA1, 0x02, 0xBC, 0x00, 0x01,
+    0x01, 0x83, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x83, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x83, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x84, 0xFE, 0xEB, 0x00, 0x01,
+    0x01, 0x99, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x84, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x99, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x32, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x32, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x4F, 0x04, 0x1E, 0x00, 0x01,
+    0x01, 0x58, 0x04, 0x1E, 0x00, 0x01, 0x01, 0x4F, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x1F, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x3E, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0x52, 0x03, 0x65, 0x00, 0x01, 0x01, 0x3E, 0xFF, 0x0B, 0x00, 0x01,
+    0x01, 0x52, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x58, 0x03, 0x6D, 0x00, 0x01,
+    0x02, 0x15, 0x00, 0x00, 0x00, 0x01, 0x01, 0x3E, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x52, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x7E, 0xFF, 0x40, 0x00, 0x01,
+    0x01, 0x7E, 0xFF, 0x26, 0x00, 0x01, 0x01, 0x7E, 0x03, 0x6D, 0x00, 0x01,
+    0x00, 0xC4, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x7E, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x7E, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x86, 0xFF, 0x0B, 0x00, 0x01,
+    0x01, 0x94, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x9A, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x01, 0x01, 0x94, 0x02, 0xBC, 0x00, 0x01,
+    0x02, 0xBE, 0x03, 0x6D, 0x00, 0x01, 0x02, 0x09, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0xB8, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x62, 0x04, 0x24, 0x00, 0x01,
+    0x01, 0x5C, 0x03, 0x73, 0x00, 0x01, 0x01, 0x5A, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x2A, 0x03, 0x6D, 0x00, 0x01, 0x01, 0x5C, 0xFF, 0x26, 0x00, 0x01,
+    0x01, 0x5C, 0x03, 0x65, 0x00, 0x01, 0x01, 0x5C, 0x03, 0x6D, 0x00, 0x01,
+    0x01, 0x62, 0x03, 0x6D, 0x00, 0x01, 0x02, 0x92, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x5C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x5C, 0x02, 0xBC, 0x00, 0x02,
+    0x00, 0x13, 0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2C,
+    0x00, 0x25, 0x00, 0x2F, 0x00, 0x74, 0x00, 0x2A, 0x00, 0x76, 0x00, 0x7A,
+    0x00, 0x70, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x75, 0x00, 0x80, 0x01, 0x05,
+    0x00, 0x78, 0x01, 0x07, 0x01, 0x2B, 0x00, 0xFE, 0x01, 0x2D, 0x01, 0x48,
+    0x01, 0x23, 0x01, 0x4A, 0x01, 0x68, 0x01, 0x3F, 0x01, 0x6A, 0x01, 0x80,
+    0x01, 0x5E, 0x01, 0x82, 0x01, 0x84, 0x01, 0x75, 0x01, 0x86, 0x02, 0x18,
+    0x01, 0x78, 0x02, 0xB5, 0x02, 0xB5, 0x02, 0x0B, 0x02, 0xB7, 0x02, 0xB7,
+    0x02, 0x0C, 0x02, 0xB9, 0x02, 0xB9, 0x02, 0x0D, 0x02, 0xBE, 0x02, 0xBE,
+    0x02, 0x0E, 0x02, 0xC4, 0x02, 0xC6, 0x02, 0x0F, 0x02, 0xCA, 0x02, 0xCA,
+    0x02, 0x12, 0x02, 0xDE, 0x02, 0xDE, 0x02, 0x13, 0x00, 0x4F, 0x00, 0x00,
+    0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xCE, 0x00, 0x00, 0x01, 0xC8, 0x00, 0x00, 0x01, 0xC2, 0x00, 0x00,
+    0x01, 0xBC, 0x00, 0x00, 0x01, 0xB6, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xB0, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xCE, 0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xA4, 0x00, 0x00, 0x01, 0xB6, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xB6, 0x00, 0x00, 0x01, 0xB6, 0x00, 0x00, 0x01, 0xB6, 0x00, 0x00,
+    0x01, 0xB6, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xB6, 0x00, 0x00, 0x01, 0x9E, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00,
+    0x01, 0xCE, 0x00, 0x01, 0x01, 0x98, 0x00, 0x02, 0x01, 0x92, 0x00, 0x02,
+    0x01, 0x92, 0x00, 0x02, 0x01, 0x92, 0x00, 0x02, 0x01, 0x8C, 0x00, 0x03,
+    0x01, 0x86, 0x00, 0x02, 0x01, 0x92, 0x00, 0x02, 0x01, 0x8C, 0x00, 0x04,
+    0x01, 0x80, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00,
+    0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00,
+    0x01, 0x74, 0x00, 0x00, 0x01, 0x6E, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00,
+    0x01, 0x62, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x01, 0x5C, 0x00, 0x00,
+    0x01, 0x56, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00,
+    0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00,
+    0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00,
+    0x01, 0x74, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00,
+    0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00,
+    0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x00,
+    0x01, 0x74, 0x00, 0x00, 0x01, 0x4A, 0x00, 0x00, 0x01, 0x7A, 0x00, 0x01,
+    0x01, 0x44, 0x00, 0x02, 0x01, 0x92, 0x00, 0x02, 0x01, 0x92, 0x00, 0x03,
+    0x01, 0x3E, 0x00, 0x01, 0x01, 0x4F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x94,
+    0x02, 0x06, 0x00, 0x01, 0x01, 0x2C, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xC5,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xBC, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xE0,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xC3, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xEA,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xF0, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xFB,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xFA,
+    0x01, 0x26, 0x00, 0x01, 0x01, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFB,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x01, 0x00, 0x94,
+    0x02, 0x15, 0x00, 0x01, 0x01, 0x3A, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xEA,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x0E, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xF9,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xFB, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xC1,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xE4, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xB7,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xFA, 0x02, 0x0D, 0x00, 0x02, 0x00, 0x03,
+    0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC, 0x03, 0x15, 0x00, 0x11,
+    0x03, 0x23, 0x03, 0x46, 0x00, 0x2B, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02,
+    0x10, 0x48, 0x00, 0x0A, 0x00, 0x02, 0x0C, 0x48, 0x00, 0x04, 0x00, 0x00,
+    0x0E, 0x30, 0x0C, 0xAC, 0x00, 0x2E, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x14, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0x00, 0x00, 0xFF, 0xF4,
+    0x00, 0x00, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFB, 0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD9,
+    0xFF, 0xEC, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF1, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0xFF, 0xEC, 0xFF, 0xE7,
+    0xFF, 0xFB, 0xFF, 0xCE, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA,
+    0xFF, 0xB5, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0xFF, 0xD3, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xB5, 0xFF, 0xCE, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xCE, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xCE, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xD8, 0xFF, 0xCE, 0xFF, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xDD, 0xFF, 0xB0, 0xFF, 0xEC,
+    0xFF, 0xF6, 0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xDC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xB0, 0xFF, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF6, 0xFF, 0x9C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88,
+    0xFF, 0xEB, 0xFF, 0x88, 0xFF, 0xF6, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0xFF, 0xF1,
+    0xFF, 0xFD, 0xFF, 0xE7, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0xFF, 0xF2, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88,
+    0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xFB, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x88, 0xFF, 0x9C, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xF6,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x32, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+    0xFF, 0xF1, 0xFF, 0xBA, 0x00, 0x00, 0xFF, 0x8E, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x9C, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xCE, 0xFF, 0x9C,
+    0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9C, 0x00, 0x0A,
+    0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xD3, 0xFF, 0xB0,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xBA, 0x00, 0x00,
+    0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xFF, 0x9C,
+    0xFF, 0xEC, 0xFF, 0x9C, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF1,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF1, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7,
+    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xD8, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xFD,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0xFF, 0xEC, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0xFF, 0xFD, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF6,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xFB, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xF4,
+    0xFF, 0xF1, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFC, 0x00, 0x14,
+    0x00, 0x00, 0xFF, 0xD8, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0A,
+    0x00, 0x0F, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xB5, 0x00, 0x08, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0x00, 0x32, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+    0x00, 0x28, 0x00, 0x37, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF1,
+    0x00, 0x00, 0xFF, 0xF7, 0xFF, 0xC4, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xF7,
+    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xB0, 0xFF, 0xF7, 0xFF, 0xB0,
+    0xFF, 0xFB, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 0xE2,
+    0xFF, 0xB5, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xEC, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0xFF, 0x9C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x88, 0xFF, 0xF3, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xD8, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01, 0x00, 0x1D,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0x4D, 0x00, 0x1D, 0x00, 0x54, 0x00, 0x54,
+    0x00, 0x46, 0x00, 0x64, 0x00, 0x71, 0x00, 0x47, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x55, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x56, 0x00, 0x80, 0x00, 0xF1,
+    0x00, 0x57, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xC9, 0x01, 0x03, 0x01, 0x20,
+    0x00, 0xCA, 0x01, 0x23, 0x02, 0x11, 0x00, 0xE8, 0x02, 0x19, 0x02, 0x1F,
+    0x01, 0xD7, 0x02, 0x22, 0x02, 0x22, 0x01, 0xDE, 0x02, 0x69, 0x02, 0x6A,
+    0x01, 0xDF, 0x02, 0x8B, 0x02, 0x8D, 0x01, 0xE1, 0x02, 0x97, 0x02, 0x97,
+    0x01, 0xE4, 0x02, 0x99, 0x02, 0x9A, 0x01, 0xE5, 0x00, 0x02, 0x00, 0x40,
+    0x00, 0x01, 0x00, 0x1A, 0x00, 0x04, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x18,
+    0x00, 0x1D, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x24, 0x00, 0x03,
+    0x00, 0x25, 0x00, 0x46, 0x00, 0x02, 0x00, 0x47, 0x00, 0x4D, 0x00, 0x03,
+    0x00, 0x4E, 0x00, 0x4E, 0x00, 0x02, 0x00, 0x50, 0x00, 0x52, 0x00, 0x02,
+    0x00, 0x64, 0x00, 0x65, 0x00, 0x11, 0x00, 0x66, 0x00, 0x7F, 0x00, 0x02,
+    0x00, 0x80, 0x00, 0xA3, 0x00, 0x03, 0x00, 0xA4, 0x00, 0xA5, 0x00, 0x02,
+    0x00, 0xA6, 0x00, 0xA6, 0x00, 0x03, 0x00, 0xA7, 0x00, 0xAE, 0x00, 0x02,
+    0x00, 0xAF, 0x00, 0xB9, 0x00, 0x09, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0x0C,
+    0x00, 0xBB, 0x00, 0xBB, 0x00, 0x03, 0x00, 0xBC, 0x00, 0xC2, 0x00, 0x0F,
+    0x00, 0xC3, 0x00, 0xDA, 0x00, 0x06, 0x00, 0xDB, 0x00, 0xDB, 0x00, 0x1B,
+    0x00, 0xDC, 0x00, 0xE0, 0x00, 0x12, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0x1C,
+    0x00, 0xE2, 0x00, 0xEB, 0x00, 0x0B, 0x00, 0xEC, 0x00, 0xF0, 0x00, 0x13,
+    0x00, 0xF2, 0x01, 0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x04, 0x00, 0x11,
+    0x01, 0x05, 0x01, 0x06, 0x00, 0x02, 0x01, 0x07, 0x01, 0x20, 0x00, 0x01,
+    0x01, 0x23, 0x01, 0x23, 0x00, 0x08, 0x01, 0x24, 0x01, 0x49, 0x00, 0x01,
+    0x01, 0x4A, 0x01, 0x4A, 0x00, 0x0C, 0x01, 0x4B, 0x01, 0x51, 0x00, 0x10,
+    0x01, 0x52, 0x01, 0x56, 0x00, 0x08, 0x01, 0x69, 0x01, 0x6B, 0x00, 0x14,
+    0x01, 0x6C, 0x01, 0x77, 0x00, 0x08, 0x01, 0x78, 0x01, 0x7B, 0x00, 0x07,
+    0x01, 0x7D, 0x01, 0x80, 0x00, 0x07, 0x01, 0x81, 0x01, 0x81, 0x00, 0x14,
+    0x01, 0x82, 0x01, 0x85, 0x00, 0x07, 0x01, 0x86, 0x01, 0xA9, 0x00, 0x01,
+    0x01, 0xAA, 0x01, 0xAA, 0x00, 0x1E, 0x01, 0xAB, 0x01, 0xAB, 0x00, 0x08,
+    0x01, 0xAC, 0x01, 0xAC, 0x00, 0x01, 0x01, 0xAD, 0x01, 0xB4, 0x00, 0x07,
+    0x01, 0xB5, 0x01, 0xBF, 0x00, 0x0A, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x0C,
+    0x01, 0xC1, 0x01, 0xC8, 0x00, 0x0E, 0x01, 0xC9, 0x01, 0xE0, 0x00, 0x05,
+    0x01, 0xE1, 0x01, 0xE1, 0x00, 0x20, 0x01, 0xE2, 0x01, 0xE6, 0x00, 0x16,
+    0x01, 0xE7, 0x01, 0xE7, 0x00, 0x21, 0x01, 0xE8, 0x01, 0xF1, 0x00, 0x0D,
+    0x01, 0xF2, 0x01, 0xF6, 0x00, 0x15, 0x01, 0xF8, 0x02, 0x11, 0x00, 0x01,
+    0x02, 0x19, 0x02, 0x1F, 0x00, 0x0C, 0x02, 0x22, 0x02, 0x22, 0x00, 0x04,
+    0x02, 0x24, 0x02, 0x24, 0x00, 0x05, 0x02, 0x69, 0x02, 0x69, 0x00, 0x1F,
+    0x02, 0x6A, 0x02, 0x6A, 0x00, 0x1D, 0x02, 0x8B, 0x02, 0x8D, 0x00, 0x17,
+    0x02, 0x97, 0x02, 0x97, 0x00, 0x19, 0x02, 0x98, 0x02, 0x98, 0x00, 0x1A,
+    0x02, 0x99, 0x02, 0x99, 0x00, 0x19, 0x02, 0x9A, 0x02, 0x9A, 0x00, 0x1A,
+    0x00, 0x02, 0x00, 0x57, 0x00, 0x01, 0x00, 0x1A, 0x00, 0x03, 0x00, 0x1B,
+    0x00, 0x1C, 0x00, 0x04, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x26, 0x00, 0x25,
+    0x00, 0x25, 0x00, 0x01, 0x00, 0x26, 0x00, 0x27, 0x00, 0x18, 0x00, 0x28,
+    0x00, 0x2C, 0x00, 0x01, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x15, 0x00, 0x2F,
+    0x00, 0x45, 0x00, 0x04, 0x00, 0x46, 0x00, 0x46, 0x00, 0x27, 0x00, 0x47,
+    0x00, 0x4D, 0x00, 0x16, 0x00, 0x54, 0x00, 0x54, 0x00, 0x0A, 0x00, 0x64,
+    0x00, 0x65, 0x00, 0x0A, 0x00, 0x66, 0x00, 0x67, 0x00, 0x20, 0x00, 0x68,
+    0x00, 0x68, 0x00, 0x11, 0x00, 0x69, 0x00, 0x69, 0x00, 0x0A, 0x00, 0x6A,
+    0x00, 0x6E, 0x00, 0x11, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x0C, 0x00, 0x70,
+    0x00, 0x71, 0x00, 0x11, 0x00, 0x75, 0x00, 0x75, 0x00, 0x0A, 0x00, 0x7C,
+    0x00, 0x7C, 0x00, 0x0C, 0x00, 0x80, 0x00, 0xA2, 0x00, 0x01, 0x00, 0xA3,
+    0x00, 0xA3, 0x00, 0x04, 0x00, 0xA4, 0x00, 0xA5, 0x00, 0x21, 0x00, 0xA6,
+    0x00, 0xA6, 0x00, 0x01, 0x00, 0xA7, 0x00, 0xAE, 0x00, 0x12, 0x00, 0xAF,
+    0x00, 0xBA, 0x00, 0x0B, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x01, 0x00, 0xBC,
+    0x00, 0xC2, 0x00, 0x17, 0x00, 0xC3, 0x00, 0xDA, 0x00, 0x05, 0x00, 0xDB,
+    0x00, 0xDB, 0x00, 0x28, 0x00, 0xDC, 0x00, 0xE0, 0x00, 0x1B, 0x00, 0xE1,
+    0x00, 0xE1, 0x00, 0x29, 0x00, 0xE2, 0x00, 0xEB, 0x00, 0x0E, 0x00, 0xEC,
+    0x00, 0xF0, 0x00, 0x18, 0x00, 0xF1, 0x00, 0xF1, 0x00, 0x0A, 0x00, 0xF3,
+    0x00, 0xF3, 0x00, 0x0A, 0x01, 0x03, 0x01, 0x06, 0x00, 0x0A, 0x01, 0x23,
+    0x01, 0x23, 0x00, 0x02, 0x01, 0x24, 0x01, 0x2A, 0x00, 0x19, 0x01, 0x2B,
+    0x01, 0x2B, 0x00, 0x1D, 0x01, 0x2C, 0x01, 0x2C, 0x00, 0x01, 0x01, 0x2D,
+    0x01, 0x2D, 0x00, 0x23, 0x01, 0x2E, 0x01, 0x30, 0x00, 0x1D, 0x01, 0x31,
+    0x01, 0x31, 0x00, 0x15, 0x01, 0x32, 0x01, 0x48, 0x00, 0x06, 0x01, 0x49,
+    0x01, 0x49, 0x00, 0x02, 0x01, 0x4A, 0x01, 0x4A, 0x00, 0x24, 0x01, 0x4B,
+    0x01, 0x51, 0x00, 0x1A, 0x01, 0x52, 0x01, 0x56, 0x00, 0x09, 0x01, 0x57,
+    0x01, 0x64, 0x00, 0x08, 0x01, 0x65, 0x01, 0x65, 0x00, 0x0C, 0x01, 0x66,
+    0x01, 0x68, 0x00, 0x08, 0x01, 0x69, 0x01, 0x6B, 0x00, 0x0C, 0x01, 0x6C,
+    0x01, 0x6E, 0x00, 0x1F, 0x01, 0x6F, 0x01, 0x70, 0x00, 0x0F, 0x01, 0x71,
+    0x01, 0x71, 0x00, 0x23, 0x01, 0x72, 0x01, 0x77, 0x00, 0x0F, 0x01, 0x78,
+    0x01, 0x81, 0x00, 0x09, 0x01, 0x82, 0x01, 0x82, 0x00, 0x0C, 0x01, 0x83,
+    0x01, 0x85, 0x00, 0x09, 0x01, 0x86, 0x01, 0xA8, 0x00, 0x02, 0x01, 0xA9,
+    0x01, 0xA9, 0x00, 0x06, 0x01, 0xAA, 0x01, 0xAB, 0x00, 0x02, 0x01, 0xAC,
+    0x01, 0xAC, 0x00, 0x2A, 0x01, 0xAD, 0x01, 0xB4, 0x00, 0x13, 0x01, 0xB5,
+    0x01, 0xBF, 0x00, 0x0D, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x02, 0x01, 0xC1,
+    0x01, 0xC8, 0x00, 0x14, 0x01, 0xC9, 0x01, 0xE0, 0x00, 0x07, 0x01, 0xE1,
+    0x01, 0xE1, 0x00, 0x2C, 0x01, 0xE2, 0x01, 0xE6, 0x00, 0x1C, 0x01, 0xE7,
+    0x01, 0xE7, 0x00, 0x2D, 0x01, 0xE8, 0x01, 0xF1, 0x00, 0x10, 0x01, 0xF2,
+    0x01, 0xF6, 0x00, 0x15, 0x01, 0xF7, 0x01, 0xF7, 0x00, 0x0C, 0x02, 0x19,
+    0x02, 0x19, 0x00, 0x24, 0x02, 0x1A, 0x02, 0x1B, 0x00, 0x0C, 0x02, 0x1C,
+    0x02, 0x1C, 0x00, 0x0F, 0x02, 0x1D, 0x02, 0x1D, 0x00, 0x0C, 0x02, 0x1E,
+    0x02, 0x1E, 0x00, 0x08, 0x02, 0x1F, 0x02, 0x1F, 0x00, 0x0F, 0x02, 0x22,
+    0x02, 0x22, 0x00, 0x03, 0x02, 0x69, 0x02, 0x6A, 0x00, 0x22, 0x02, 0x8B,
+    0x02, 0x8D, 0x00, 0x1E, 0x02, 0x97, 0x02, 0x97, 0x00, 0x25, 0x02, 0x99,
+    0x02, 0x99, 0x00, 0x25, 0x02, 0x9A, 0x02, 0x9A, 0x00, 0x2B, 0x00, 0x01,
+    0x02, 0xCA, 0x00, 0x04, 0x00, 0x00, 0x01, 0x60, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xE2, 0x1A, 0xD4, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xAA, 0x1A, 0xAA,
+    0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x19, 0xD8,
+    0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xB8, 0x19, 0xB8, 0x19, 0x96,
+    0x19, 0xC6, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96,
+    0x19, 0x96, 0x19, 0x96, 0x19, 0xC6, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x19, 0x84, 0x19, 0x4A, 0x19, 0x30, 0x19, 0x1E,
+    0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C,
+    0x19, 0x0C, 0x1A, 0xBE, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6,
+    0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xC8, 0x18, 0xBA, 0x18, 0xBA,
+    0x18, 0xBA, 0x18, 0xBA, 0x18, 0xBA, 0x18, 0xB4, 0x18, 0xA6, 0x18, 0xA6,
+    0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6,
+    0x18, 0xA6, 0x18, 0xA6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6,
+    0x19, 0xC6, 0x19, 0xC6, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0x8E, 0x18, 0x64,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x18, 0x8E, 0x18, 0x52, 0x18, 0x48, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x1A, 0xB8,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x36, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C,
+    0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x06,
+    0x17, 0xE0, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2,
+    0x17, 0xBC, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE,
+    0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0x52, 0x1A, 0xEC, 0x17, 0xA4, 0x17, 0x9E, 0x17, 0x94, 0x17, 0x8A,
+    0x17, 0x7C, 0x17, 0x72, 0x17, 0x6C, 0x17, 0x42, 0x17, 0x3C, 0x17, 0x32,
+    0x16, 0xCC, 0x16, 0x66, 0x16, 0x60, 0x15, 0xDE, 0x15, 0xD0, 0x15, 0xC2,
+    0x15, 0xBC, 0x15, 0x46, 0x11, 0x90, 0x0E, 0x46, 0x0E, 0x34, 0x0B, 0x22,
+    0x08, 0x20, 0x07, 0xFA, 0x07, 0xC4, 0x05, 0x2E, 0x04, 0xB0, 0x04, 0xB0,
+    0x04, 0xA6, 0x04, 0x00, 0x03, 0xF2, 0x03, 0xE4, 0x03, 0xDE, 0x03, 0xD8,
+    0x03, 0xD2, 0x03, 0xC4, 0x00, 0x02, 0x00, 0x29, 0x00, 0x01, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1A, 0x00, 0x25, 0x00, 0x25,
+    0x00, 0x1C, 0x00, 0x28, 0x00, 0x2E, 0x00, 0x1D, 0x00, 0x47, 0x00, 0x4D,
+    0x00, 0x24, 0x00, 0x53, 0x00, 0x54, 0x00, 0x2B, 0x00, 0x64, 0x00, 0x6E,
+    0x00, 0x2D, 0x00, 0x70, 0x00, 0x71, 0x00, 0x38, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x3A, 0x00, 0x80, 0x00, 0xA2, 0x00, 0x3B, 0x00, 0xA4, 0x00, 0xAE,
+    0x00, 0x5E, 0x00, 0xBB, 0x00, 0xC2, 0x00, 0x69, 0x00, 0xDB, 0x00, 0xEB,
+    0x00, 0x71, 0x00, 0xF1, 0x00, 0xF1, 0x00, 0x82, 0x00, 0xF3, 0x00, 0xF3,
+    0x00, 0x83, 0x01, 0x03, 0x01, 0x20, 0x00, 0x84, 0x01, 0x23, 0x01, 0x23,
+    0x00, 0xA2, 0x01, 0x2C, 0x01, 0x2C, 0x00, 0xA3, 0x01, 0x31, 0x01, 0x56,
+    0x00, 0xA4, 0x01, 0x6C, 0x01, 0x6E, 0x00, 0xCA, 0x01, 0x78, 0x01, 0x81,
+    0x00, 0xCD, 0x01, 0x83, 0x01, 0xB4, 0x00, 0xD7, 0x01, 0xC0, 0x01, 0xC0,
+    0x01, 0x09, 0x01, 0xE1, 0x01, 0xF6, 0x01, 0x0A, 0x01, 0xF8, 0x02, 0x11,
+    0x01, 0x20, 0x02, 0x19, 0x02, 0x19, 0x01, 0x3A, 0x02, 0x22, 0x02, 0x22,
+    0x01, 0x3B, 0x02, 0x26, 0x02, 0x2F, 0x01, 0x3C, 0x02, 0x69, 0x02, 0x6A,
+    0x01, 0x46, 0x02, 0x6F, 0x02, 0x74, 0x01, 0x48, 0x02, 0x76, 0x02, 0x77,
+    0x01, 0x4E, 0x02, 0x85, 0x02, 0x85, 0x01, 0x50, 0x02, 0x89, 0x02, 0x89,
+    0x01, 0x51, 0x02, 0x8B, 0x02, 0x8D, 0x01, 0x52, 0x02, 0x98, 0x02, 0x9A,
+    0x01, 0x55, 0x02, 0xA6, 0x02, 0xA7, 0x01, 0x58, 0x02, 0xC9, 0x02, 0xC9,
+    0x01, 0x5A, 0x02, 0xD4, 0x02, 0xD5, 0x01, 0x5B, 0x02, 0xDD, 0x02, 0xDD,
+    0x01, 0x5D, 0x02, 0xDF, 0x02, 0xDF, 0x01, 0x5E, 0x02, 0xE1, 0x02, 0xE1,
+    0x01, 0x5F, 0x00, 0x03, 0x02, 0x26, 0xFF, 0xCE, 0x02, 0x2E, 0xFF, 0xE2,
+    0x02, 0x2F, 0xFF, 0xD8, 0x00, 0x01, 0x02, 0x2A, 0xFF, 0xB0, 0x00, 0x01,
+    0x02, 0x27, 0xFF, 0xD8, 0x00, 0x01, 0x02, 0x27, 0xFF, 0xEC, 0x00, 0x03,
+    0x02, 0x27, 0xFF, 0xC4, 0x02, 0x28, 0xFF, 0xE2, 0x02, 0x2D, 0xFF, 0xCE,
+    0x00, 0x03, 0x02, 0x26, 0xFF, 0xD8, 0x02, 0x27, 0xFF, 0xE2, 0x02, 0x2A,
+    0xFF, 0xE2, 0x00, 0x29, 0x00, 0xBC, 0xFF, 0xC9, 0x00, 0xBD, 0xFF, 0xC9,
+    0x00, 0xBE, 0xFF, 0xC9, 0x00, 0xBF, 0xFF, 0xC9, 0x00, 0xC0, 0xFF, 0xC9,
+    0x00, 0xC1, 0xFF, 0xC9, 0x00, 0xC2, 0xFF, 0xC9, 0x00, 0xDB, 0xFF, 0xC4,
+    0x00, 0xDC, 0xFF, 0xD8, 0x00, 0xDD, 0xFF, 0xD8, 0x00, 0xDE, 0xFF, 0xD8,
+    0x00, 0xDF, 0xFF, 0xD8, 0x00, 0xE0, 0xFF, 0xD8, 0x00, 0xE2, 0xFF, 0xCE,
+    0x00, 0xE3, 0xFF, 0xCE, 0x00, 0xE4, 0xFF, 0xCE, 0x00, 0xE5, 0xFF, 0xCE,
+    0x00, 0xE6, 0xFF, 0xCE, 0x00, 0xE7, 0xFF, 0xCE, 0x00, 0xE8, 0xFF, 0xCE,
+    0x00, 0xE9, 0xFF, 0xCE, 0x00, 0xEA, 0xFF, 0xCE, 0x00, 0xEB, 0xFF, 0xCE,
+    0x01, 0x2C, 0xFF, 0xF6, 0x01, 0xE1, 0xFF, 0xE2, 0x01, 0xE2, 0xFF, 0xE2,
+    0x01, 0xE3, 0xFF, 0xE2, 0x01, 0xE4, 0xFF, 0xE2, 0x01, 0xE5, 0xFF, 0xE2,
+    0x01, 0xE6, 0xFF, 0xE2, 0x01, 0xE8, 0xFF, 0xE2, 0x01, 0xE9, 0xFF, 0xE2,
+    0x01, 0xEA, 0xFF, 0xE2, 0x01, 0xEB, 0xFF, 0xE2, 0x01, 0xEC, 0xFF, 0xE2,
+    0x01, 0xED, 0xFF, 0xE2, 0x01, 0xEE, 0xFF, 0xE2, 0x01, 0xEF, 0xFF, 0xE2,
+    0x01, 0xF0, 0xFF, 0xE2, 0x01, 0xF1, 0xFF, 0xE2, 0x02, 0x8A, 0xFF, 0xF1,
+    0x00, 0x02, 0x00, 0xDB, 0xFF, 0xFA, 0x01, 0xE7, 0xFF, 0xFD, 0x00, 0x1F,
+    0x00, 0x01, 0xFF, 0xC4, 0x00, 0x02, 0xFF, 0xC4, 0x00, 0x03, 0xFF, 0xC4,
+    0x00, 0x04, 0xFF, 0xC4, 0x00, 0x05, 0xFF, 0xC4, 0x00, 0x06, 0xFF, 0xC4,
+    0x00, 0x07, 0xFF, 0xC4, 0x00, 0x08, 0xFF, 0xC4, 0x00, 0x09, 0xFF, 0xC4,
+    0x00, 0x0A, 0xFF, 0xC4, 0x00, 0x0B, 0xFF, 0xC4, 0x00, 0x0C, 0xFF, 0xC4,
+    0x00, 0x0D, 0xFF, 0xC4, 0x00, 0x0E, 0xFF, 0xC4, 0x00, 0x0F, 0xFF, 0xC4,
+    0x00, 0x10, 0xFF, 0xC4, 0x00, 0x11, 0xFF, 0xC4, 0x00, 0x12, 0xFF, 0xC4,
+    0x00, 0x13, 0xFF, 0xC4, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x15, 0xFF, 0xC4,
+    0x00, 0x16, 0xFF, 0xC4, 0x00, 0x17, 0xFF, 0xC4, 0x00, 0x18, 0xFF, 0xC4,
+    0x00, 0x19, 0xFF, 0xC4, 0x00, 0x1A, 0xFF, 0xC4, 0x00, 0x64, 0xFF, 0x88,
+    0x00, 0x65, 0xFF, 0x88, 0x01, 0x03, 0xFF, 0x88, 0x01, 0x04, 0xFF, 0x88,
+    0x02, 0x22, 0xFF, 0xC4, 0x00, 0xA5, 0x00, 0x01, 0xFF, 0xB5, 0x00, 0x02,
+    0xFF, 0xB5, 0x00, 0x03, 0xFF, 0xB5, 0x00, 0x04, 0xFF, 0xB5, 0x00, 0x05,
+    0xFF, 0xB5, 0x00, 0x06, 0xFF, 0xB5, 0x00, 0x07, 0xFF, 0xB5, 0x00, 0x08,
+    0xFF, 0xB5, 0x00, 0x09, 0xFF, 0xB5, 0x00, 0x0A, 0xFF, 0xB5, 0x00, 0x0B,
+    0xFF, 0xB5, 0x00, 0x0C, 0xFF, 0xB5, 0x00, 0x0D, 0xFF, 0xB5, 0x00, 0x0E,
+    0xFF, 0xB5, 0x00, 0x0F, 0xFF, 0xB5, 0x00, 0x10, 0xFF, 0xB5, 0x00, 0x11,
+    0xFF, 0xB5, 0x00, 0x12, 0xFF, 0xB5, 0x00, 0x13, 0xFF, 0xB5, 0x00, 0x14,
+    0xFF, 0xB5, 0x00, 0x15, 0xFF, 0xB5, 0x00, 0x16, 0xFF, 0xB5, 0x00, 0x17,
+    0xFF, 0xB5, 0x00, 0x18, 0xFF, 0xB5, 0x00, 0x19, 0xFF, 0xB5, 0x00, 0x1A,
+    0xFF, 0xB5, 0x00, 0x64, 0xFF, 0x9C, 0x00, 0x65, 0xFF, 0x9C, 0x01, 0x03,
+    0xFF, 0x9C, 0x01, 0x04, 0xFF, 0x9C, 0x01, 0x07, 0xFF, 0xD8, 0x01, 0x08,
+    0xFF, 0xD8, 0x01, 0x09, 0xFF, 0xD8, 0x01, 0x0A, 0xFF, 0xD8, 0x01, 0x0B,
+    0xFF, 0xD8, 0x01, 0x0C, 0xFF, 0xD8, 0x01, 0x0D, 0xFF, 0xD8, 0x01, 0x0E,
+    0xFF, 0xD8, 0x01, 0x0F, 0xFF, 0xD8, 0x01, 0x10, 0xFF, 0xD8, 0x01, 0x11,
+    0xFF, 0xD8, 0x01, 0x12, 0xFF, 0xD8, 0x01, 0x13, 0xFF, 0xD8, 0x01, 0x14,
+    0xFF, 0xD8, 0x01, 0x15, 0xFF, 0xD8, 0x01, 0x16, 0xFF, 0xD8, 0x01, 0x17,
+    0xFF, 0xD8, 0x01, 0x18, 0xFF, 0xD8, 0x01, 0x19, 0xFF, 0xD8, 0x01, 0x1A,
+    0xFF, 0xD8, 0x01, 0x1B, 0xFF, 0xD8, 0x01, 0x1C, 0xFF, 0xD8, 0x01, 0x1D,
+    0xFF, 0xD8, 0x01, 0x1E, 0xFF, 0xD8, 0x01, 0x1F, 0xFF, 0xD8, 0x01, 0x20,
+    0xFF, 0xD8, 0x01, 0x24, 0xFF, 0xD8, 0x01, 0x25, 0xFF, 0xD8, 0x01, 0x26,
+    0xFF, 0xD8, 0x01, 0x27, 0xFF, 0xD8, 0x01, 0x28, 0xFF, 0xD8, 0x01, 0x29,
+    0xFF, 0xD8, 0x01, 0x2A, 0xFF, 0xD8, 0x01, 0x2B, 0xFF, 0xD8, 0x01, 0x2C,
+    0xFF, 0xD8, 0x01, 0x2D, 0xFF, 0xD8, 0x01, 0x2E, 0xFF, 0xD8, 0x01, 0x2F,
+    0xFF, 0xD8, 0x01, 0x30, 0xFF, 0xD8, 0x01, 0x31, 0xFF, 0xD8, 0x01, 0x32,
+    0xFF, 0xD8, 0x01, 0x33, 0xFF, 0xD8, 0x01, 0x34, 0xFF, 0xD8, 0x01, 0x35,
+    0xFF, 0xD8, 0x01, 0x36, 0xFF, 0xD8, 0x01, 0x37, 0xFF, 0xD8, 0x01, 0x38,
+    0xFF, 0xD8, 0x01, 0x39, 0xFF, 0xD8, 0x01, 0x3A, 0xFF, 0xD8, 0x01, 0x3B,
+    0xFF, 0xD8, 0x01, 0x3C, 0xFF, 0xD8, 0x01, 0x3D, 0xFF, 0xD8, 0x01, 0x3E,
+    0xFF, 0xD8, 0x01, 0x3F, 0xFF, 0xD8, 0x01, 0x40, 0xFF, 0xD8, 0x01, 0x41,
+    0xFF, 0xD8, 0x01, 0x42, 0xFF, 0xD8, 0x01, 0x43, 0xFF, 0xD8, 0x01, 0x44,
+    0xFF, 0xD8, 0x01, 0x45, 0xFF, 0xD8, 0x01, 0x46, 0xFF, 0xD8, 0x01, 0x47,
+    0xFF, 0xD8, 0x01, 0x48, 0xFF, 0xD8, 0x01, 0x49, 0xFF, 0xD8, 0x01, 0x4B,
+    0xFF, 0xCE, 0x01, 0x4C, 0xFF, 0xCE, 0x01, 0x4D, 0xFF, 0xCE, 0x01, 0x4E,
+    0xFF, 0xCE, 0x01, 0x4F, 0xFF, 0xCE, 0x01, 0x50, 0xFF, 0xCE, 0x01, 0x51,
+    0xFF, 0xCE, 0x01, 0x86, 0xFF, 0xD8, 0x01, 0x87, 0xFF, 0xD8, 0x01, 0x88,
+    0xFF, 0xD8, 0x01, 0x89, 0xFF, 0xD8, 0x01, 0x8A, 0xFF, 0xD8, 0x01, 0x8B,
+    0xFF, 0xD8, 0x01, 0x8C, 0xFF, 0xD8, 0x01, 0x8D, 0xFF, 0xD8, 0x01, 0x8E,
+    0xFF, 0xD8, 0x01, 0x8F, 0xFF, 0xD8, 0x01, 0x90, 0xFF, 0xD8, 0x01, 0x91,
+    0xFF, 0xD8, 0x01, 0x92, 0xFF, 0xD8, 0x01, 0x93, 0xFF, 0xD8, 0x01, 0x94,
+    0xFF, 0xD8, 0x01, 0x95, 0xFF, 0xD8, 0x01, 0x96, 0xFF, 0xD8, 0x01, 0x97,
+    0xFF, 0xD8, 0x01, 0x98, 0xFF, 0xD8, 0x01, 0x99, 0xFF, 0xD8, 0x01, 0x9A,
+    0xFF, 0xD8, 0x01, 0x9B, 0xFF, 0xD8, 0x01, 0x9C, 0xFF, 0xD8, 0x01, 0x9D,
+    0xFF, 0xD8, 0x01, 0x9E, 0xFF, 0xD8, 0x01, 0x9F, 0xFF, 0xD8, 0x01, 0xA0,
+    0xFF, 0xD8, 0x01, 0xA1, 0xFF, 0xD8, 0x01, 0xA2, 0xFF, 0xD8, 0x01, 0xA3,
+    0xFF, 0xD8, 0x01, 0xA4, 0xFF, 0xD8, 0x01, 0xA5, 0xFF, 0xD8, 0x01, 0xA6,
+    0xFF, 0xD8, 0x01, 0xA7, 0xFF, 0xD8, 0x01, 0xA8, 0xFF, 0xD8, 0x01, 0xA9,
+    0xFF, 0xD8, 0x01, 0xAC, 0xFF, 0xD8, 0x01, 0xF8, 0xFF, 0xD8, 0x01, 0xF9,
+    0xFF, 0xD8, 0x01, 0xFA, 0xFF, 0xD8, 0x01, 0xFB, 0xFF, 0xD8, 0x01, 0xFC,
+    0xFF, 0xD8, 0x01, 0xFD, 0xFF, 0xD8, 0x01, 0xFE, 0xFF, 0xD8, 0x01, 0xFF,
+    0xFF, 0xD8, 0x02, 0x00, 0xFF, 0xD8, 0x02, 0x01, 0xFF, 0xD8, 0x02, 0x02,
+    0xFF, 0xD8, 0x02, 0x03, 0xFF, 0xD8, 0x02, 0x04, 0xFF, 0xD8, 0x02, 0x05,
+    0xFF, 0xD8, 0x02, 0x06, 0xFF, 0xD8, 0x02, 0x07, 0xFF, 0xD8, 0x02, 0x08,
+    0xFF, 0xD8, 0x02, 0x09, 0xFF, 0xD8, 0x02, 0x0A, 0xFF, 0xD8, 0x02, 0x0B,
+    0xFF, 0xD8, 0x02, 0x0C, 0xFF, 0xD8, 0x02, 0x0D, 0xFF, 0xD8, 0x02, 0x0E,
+    0xFF, 0xD8, 0x02, 0x0F, 0xFF, 0xD8, 0x02, 0x10, 0xFF, 0xD8, 0x02, 0x11,
+    0xFF, 0xD8, 0x02, 0x22, 0xFF, 0xB5, 0x00, 0x0D, 0x00, 0x01, 0xFF, 0xCE,
+    0x00, 0x64, 0xFF, 0xC4, 0x00, 0x65, 0xFF, 0xC4, 0x00, 0xBC, 0xFF, 0x9C,
+    0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1, 0xFF, 0xB0,
+    0x00, 0xE2, 0xFF, 0x88, 0x01, 0x03, 0xFF, 0xC4, 0x01, 0x04, 0xFF, 0xC4,
+    0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE, 0x02, 0x81, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xDB,
+    0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1, 0xFF, 0xB0, 0x00, 0xE2,
+    0xFF, 0x88, 0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE, 0x02, 0x81,
+    0x00, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0x1E, 0xFF, 0xE7,
+    0x00, 0x1F, 0xFF, 0xE7, 0x00, 0x20, 0xFF, 0xE7, 0x00, 0x21, 0xFF, 0xE7,
+    0x00, 0x22, 0xFF, 0xE7, 0x00, 0x23, 0xFF, 0xE7, 0x00, 0x24, 0xFF, 0xE7,
+    0x00, 0x47, 0xFF, 0xE7, 0x00, 0x48, 0xFF, 0xE7, 0x00, 0x49, 0xFF, 0xE7,
+    0x00, 0x4A, 0xFF, 0xE7, 0x00, 0x4B, 0xFF, 0xE7, 0x00, 0x4C, 0xFF, 0xE7,
+    0x00, 0x4D, 0xFF, 0xE7, 0x00, 0x64, 0xFF, 0xCE, 0x00, 0x65, 0xFF, 0xCE,
+    0x00, 0x80, 0xFF, 0xE7, 0x00, 0x81, 0xFF, 0xE7, 0x00, 0x82, 0xFF, 0xE7,
+    0x00, 0x83, 0xFF, 0xE7, 0x00, 0x84, 0xFF, 0xE7, 0x00, 0x85, 0xFF, 0xE7,
+    0x00, 0x86, 0xFF, 0xE7, 0x00, 0x87, 0xFF, 0xE7, 0x00, 0x88, 0xFF, 0xE7,
+    0x00, 0x89, 0xFF, 0xE7, 0x00, 0x8A, 0xFF, 0xE7, 0x00, 0x8B, 0xFF, 0xE7,
+    0x00, 0x8C, 0xFF, 0xE7, 0x00, 0x8D, 0xFF, 0xE7, 0x00, 0x8E, 0xFF, 0xE7,
+    0x00, 0x8F, 0xFF, 0xE7, 0x00, 0x90, 0xFF, 0xE7, 0x00, 0x91, 0xFF, 0xE7,
+    0x00, 0x92, 0xFF, 0xE7, 0x00, 0x93, 0xFF, 0xE7, 0x00, 0x94, 0xFF, 0xE7,
+    0x00, 0x95, 0xFF, 0xE7, 0x00, 0x96, 0xFF, 0xE7, 0x00, 0x97, 0xFF, 0xE7,
+    0x00, 0x98, 0xFF, 0xE7, 0x00, 0x99, 0xFF, 0xE7, 0x00, 0x9A, 0xFF, 0xE7,
+    0x00, 0x9B, 0xFF, 0xE7, 0x00, 0x9C, 0xFF, 0xE7, 0x00, 0x9D, 0xFF, 0xE7,
+    0x00, 0x9E, 0xFF, 0xE7, 0x00, 0x9F, 0xFF, 0xE7, 0x00, 0xA0, 0xFF, 0xE7,
+    0x00, 0xA1, 0xFF, 0xE7, 0x00, 0xA2, 0xFF, 0xE7, 0x00, 0xA3, 0xFF, 0xE7,
+    0x00, 0xA6, 0xFF, 0xE7, 0x00, 0xBB, 0xFF, 0xE7, 0x00, 0xBC, 0xFF, 0x9C,
+    0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1, 0xFF, 0xB0,
+    0x00, 0xE2, 0xFF, 0x88, 0x01, 0x03, 0xFF, 0xCE, 0x01, 0x04, 0xFF, 0xCE,
+    0x01, 0x07, 0xFF, 0xE7, 0x01, 0x08, 0xFF, 0xE7, 0x01, 0x09, 0xFF, 0xE7,
+    0x01, 0x0A, 0xFF, 0xE7, 0x01, 0x0B, 0xFF, 0xE7, 0x01, 0x0C, 0xFF, 0xE7,
+    0x01, 0x0D, 0xFF, 0xE7, 0x01, 0x0E, 0xFF, 0xE7, 0x01, 0x0F, 0xFF, 0xE7,
+    0x01, 0x10, 0xFF, 0xE7, 0x01, 0x11, 0xFF, 0xE7, 0x01, 0x12, 0xFF, 0xE7,
+    0x01, 0x13, 0xFF, 0xE7, 0x01, 0x14, 0xFF, 0xE7, 0x01, 0x15, 0xFF, 0xE7,
+    0x01, 0x16, 0xFF, 0xE7, 0x01, 0x17, 0xFF, 0xE7, 0x01, 0x18, 0xFF, 0xE7,
+    0x01, 0x19, 0xFF, 0xE7, 0x01, 0x1A, 0xFF, 0xE7, 0x01, 0x1B, 0xFF, 0xE7,
+    0x01, 0x1C, 0xFF, 0xE7, 0x01, 0x1D, 0xFF, 0xE7, 0x01, 0x1E, 0xFF, 0xE7,
+    0x01, 0x1F, 0xFF, 0xE7, 0x01, 0x20, 0xFF, 0xE7, 0x01, 0x24, 0xFF, 0xE7,
+    0x01, 0x25, 0xFF, 0xE7, 0x01, 0x26, 0xFF, 0xE7, 0x01, 0x27, 0xFF, 0xE7,
+    0x01, 0x28, 0xFF, 0xE7, 0x01, 0x29, 0xFF, 0xE7, 0x01, 0x2A, 0xFF, 0xE7,
+    0x01, 0x2B, 0xFF, 0xE7, 0x01, 0x2C, 0xFF, 0xE7, 0x01, 0x2D, 0xFF, 0xE7,
+    0x01, 0x2E, 0xFF, 0xE7, 0x01, 0x2F, 0xFF, 0xE7, 0x01, 0x30, 0xFF, 0xE7,
+    0x01, 0x31, 0xFF, 0xE7, 0x01, 0x32, 0xFF, 0xE7, 0x01, 0x33, 0xFF, 0xE7,
+    0x01, 0x34, 0xFF, 0xE7, 0x01, 0x35, 0xFF, 0xE7, 0x01, 0x36, 0xFF, 0xE7,
+    0x01, 0x37, 0xFF, 0xE7, 0x01, 0x38, 0xFF, 0xE7, 0x01, 0x39, 0xFF, 0xE7,
+    0x01, 0x3A, 0xFF, 0xE7, 0x01, 0x3B, 0xFF, 0xE7, 0x01, 0x3C, 0xFF, 0xE7,
+    0x01, 0x3D, 0xFF, 0xE7, 0x01, 0x3E, 0xFF, 0xE7, 0x01, 0x3F, 0xFF, 0xE7,
+    0x01, 0x40, 0xFF, 0xE7, 0x01, 0x41, 0xFF, 0xE7, 0x01, 0x42, 0xFF, 0xE7,
+    0x01, 0x43, 0xFF, 0xE7, 0x01, 0x44, 0xFF, 0xE7, 0x01, 0x45, 0xFF, 0xE7,
+    0x01, 0x46, 0xFF, 0xE7, 0x01, 0x47, 0xFF, 0xE7, 0x01, 0x48, 0xFF, 0xE7,
+    0x01, 0x49, 0xFF, 0xE7, 0x01, 0x86, 0xFF, 0xE7, 0x01, 0x87, 0xFF, 0xE7,
+    0x01, 0x88, 0xFF, 0xE7, 0x01, 0x89, 0xFF, 0xE7, 0x01, 0x8A, 0xFF, 0xE7,
+    0x01, 0x8B, 0xFF, 0xE7, 0x01, 0x8C, 0xFF, 0xE7, 0x01, 0x8D, 0xFF, 0xE7,
+    0x01, 0x8E, 0xFF, 0xE7, 0x01, 0x8F, 0xFF, 0xE7, 0x01, 0x90, 0xFF, 0xE7,
+    0x01, 0x91, 0xFF, 0xE7, 0x01, 0x92, 0xFF, 0xE7, 0x01, 0x93, 0xFF, 0xE7,
+    0x01, 0x94, 0xFF, 0xE7, 0x01, 0x95, 0xFF, 0xE7, 0x01, 0x96, 0xFF, 0xE7,
+    0x01, 0x97, 0xFF, 0xE7, 0x01, 0x98, 0xFF, 0xE7, 0x01, 0x99, 0xFF, 0xE7,
+    0x01, 0x9A, 0xFF, 0xE7, 0x01, 0x9B, 0xFF, 0xE7, 0x01, 0x9C, 0xFF, 0xE7,
+    0x01, 0x9D, 0xFF, 0xE7, 0x01, 0x9E, 0xFF, 0xE7, 0x01, 0x9F, 0xFF, 0xE7,
+    0x01, 0xA0, 0xFF, 0xE7, 0x01, 0xA1, 0xFF, 0xE7, 0x01, 0xA2, 0xFF, 0xE7,
+    0x01, 0xA3, 0xFF, 0xE7, 0x01, 0xA4, 0xFF, 0xE7, 0x01, 0xA5, 0xFF, 0xE7,
+    0x01, 0xA6, 0xFF, 0xE7, 0x01, 0xA7, 0xFF, 0xE7, 0x01, 0xA8, 0xFF, 0xE7,
+    0x01, 0xA9, 0xFF, 0xE7, 0x01, 0xAC, 0xFF, 0xE7, 0x01, 0xF8, 0xFF, 0xE7,
+    0x01, 0xF9, 0xFF, 0xE7, 0x01, 0xFA, 0xFF, 0xE7, 0x01, 0xFB, 0xFF, 0xE7,
+    0x01, 0xFC, 0xFF, 0xE7, 0x01, 0xFD, 0xFF, 0xE7, 0x01, 0xFE, 0xFF, 0xE7,
+    0x01, 0xFF, 0xFF, 0xE7, 0x02, 0x00, 0xFF, 0xE7, 0x02, 0x01, 0xFF, 0xE7,
+    0x02, 0x02, 0xFF, 0xE7, 0x02, 0x03, 0xFF, 0xE7, 0x02, 0x04, 0xFF, 0xE7,
+    0x02, 0x05, 0xFF, 0xE7, 0x02, 0x06, 0xFF, 0xE7, 0x02, 0x07, 0xFF, 0xE7,
+    0x02, 0x08, 0xFF, 0xE7, 0x02, 0x09, 0xFF, 0xE7, 0x02, 0x0A, 0xFF, 0xE7,
+    0x02, 0x0B, 0xFF, 0xE7, 0x02, 0x0C, 0xFF, 0xE7, 0x02, 0x0D, 0xFF, 0xE7,
+    0x02, 0x0E, 0xFF, 0xE7, 0x02, 0x0F, 0xFF, 0xE7, 0x02, 0x10, 0xFF, 0xE7,
+    0x02, 0x11, 0xFF, 0xE7, 0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE,
+    0x02, 0x81, 0x00, 0x00, 0x00, 0xC4, 0x00, 0x1E, 0xFF, 0xE2, 0x00, 0x1F,
+    0xFF, 0xE2, 0x00, 0x20, 0xFF, 0xE2, 0x00, 0x21, 0xFF, 0xE2, 0x00, 0x22,
+    0xFF, 0xE2, 0x00, 0x23, 0xFF, 0xE2, 0x00, 0x24, 0xFF, 0xE2, 0x00, 0x47,
+    0xFF, 0xE2, 0x00, 0x48, 0xFF, 0xE2, 0x00, 0x49, 0xFF, 0xE2, 0x00, 0x4A,
+    0xFF, 0xE2, 0x00, 0x4B, 0xFF, 0xE2, 0x00, 0x4C, 0xFF, 0xE2, 0x00, 0x4D,
+    0xFF, 0xE2, 0x00, 0x64, 0xFF, 0xD8, 0x00, 0x65, 0xFF, 0xD8, 0x00, 0x80,
+    0xFF, 0xE2, 0x00, 0x81, 0xFF, 0xE2, 0x00, 0x82, 0xFF, 0xE2, 0x00, 0x83,
+    0xFF, 0xE2, 0x00, 0x84, 0xFF, 0xE2, 0x00, 0x85, 0xFF, 0xE2, 0x00, 0x86,
+    0xFF, 0xE2, 0x00, 0x87, 0xFF, 0xE2, 0x00, 0x88, 0xFF, 0xE2, 0x00, 0x89,
+    0xFF, 0xE2, 0x00, 0x8A, 0xFF, 0xE2, 0x00, 0x8B, 0xFF, 0xE2, 0x00, 0x8C,
+    0xFF, 0xE2, 0x00, 0x8D, 0xFF, 0xE2, 0x00, 0x8E, 0xFF, 0xE2, 0x00, 0x8F,
+    0xFF, 0xE2, 0x00, 0x90, 0xFF, 0xE2, 0x00, 0x91, 0xFF, 0xE2, 0x00, 0x92,
+    0xFF, 0xE2, 0x00, 0x93, 0xFF, 0xE2, 0x00, 0x94, 0xFF, 0xE2, 0x00, 0x95,
+    0xFF, 0xE2, 0x00, 0x96, 0xFF, 0xE2, 0x00, 0x97, 0xFF, 0xE2, 0x00, 0x98,
+    0xFF, 0xE2, 0x00, 0x99, 0xFF, 0xE2, 0x00, 0x9A, 0xFF, 0xE2, 0x00, 0x9B,
+    0xFF, 0xE2, 0x00, 0x9C, 0xFF, 0xE2, 0x00, 0x9D, 0xFF, 0xE2, 0x00, 0x9E,
+    0xFF, 0xE2, 0x00, 0x9F, 0xFF, 0xE2, 0x00, 0xA0, 0xFF, 0xE2, 0x00, 0xA1,
+    0xFF, 0xE2, 0x00, 0xA2, 0xFF, 0xE2, 0x00, 0xA3, 0xFF, 0xE2, 0x00, 0xA6,
+    0xFF, 0xE2, 0x00, 0xBB, 0xFF, 0xE2, 0x01, 0x03, 0xFF, 0xD8, 0x01, 0x04,
+    0xFF, 0xD8, 0x01, 0x07, 0xFF, 0xE7, 0x01, 0x08, 0xFF, 0xE7, 0x01, 0x09,
+    0xFF, 0xE7, 0x01, 0x0A, 0xFF, 0xE7, 0x01, 0x0B, 0xFF, 0xE7, 0x01, 0x0C,
+    0xFF, 0xE7, 0x01, 0x0D, 0xFF, 0xE7, 0x01, 0x0E, 0xFF, 0xE7, 0x01, 0x0F,
+    0xFF, 0xE7, 0x01, 0x10, 0xFF, 0xE7, 0x01, 0x11, 0xFF, 0xE7, 0x01, 0x12,
+    0xFF, 0xE7, 0x01, 0x13, 0xFF, 0xE7, 0x01, 0x14, 0xFF, 0xE7, 0x01, 0x15,
+    0xFF, 0xE7, 0x01, 0x16, 0xFF, 0xE7, 0x01, 0x17, 0xFF, 0xE7, 0x01, 0x18,
+    0xFF, 0xE7, 0x01, 0x19, 0xFF, 0xE7, 0x01, 0x1A, 0xFF, 0xE7, 0x01, 0x1B,
+    0xFF, 0xE7, 0x01, 0x1C, 0xFF, 0xE7, 0x01, 0x1D, 0xFF, 0xE7, 0x01, 0x1E,
+    0xFF, 0xE7, 0x01, 0x1F, 0xFF, 0xE7, 0x01, 0x20, 0xFF, 0xE7, 0x01, 0x24,
+    0xFF, 0xE7, 0x01, 0x25, 0xFF, 0xE7, 0x01, 0x26, 0xFF, 0xE7, 0x01, 0x27,
+    0xFF, 0xE7, 0x01, 0x28, 0xFF, 0xE7, 0x01, 0x29, 0xFF, 0xE7, 0x01, 0x2A,
+    0xFF, 0xE7, 0x01, 0x2B, 0xFF, 0xE7, 0x01, 0x2C, 0xFF, 0xE7, 0x01, 0x2D,
+    0xFF, 0xE7, 0x01, 0x2E, 0xFF, 0xE7, 0x01, 0x2F, 0xFF, 0xE7, 0x01, 0x30,
+    0xFF, 0xE7, 0x01, 0x31, 0xFF, 0xE7, 0x01, 0x32, 0xFF, 0xE7, 0x01, 0x33,
+    0xFF, 0xE7, 0x01, 0x34, 0xFF, 0xE7, 0x01, 0x35, 0xFF, 0xE7, 0x01, 0x36,
+    0xFF, 0xE7, 0x01, 0x37, 0xFF, 0xE7, 0x01, 0x38, 0xFF, 0xE7, 0x01, 0x39,
+    0xFF, 0xE7, 0x01, 0x3A, 0xFF, 0xE7, 0x01, 0x3B, 0xFF, 0xE7, 0x01, 0x3C,
+    0xFF, 0xE7, 0x01, 0x3D, 0xFF, 0xE7, 0x01, 0x3E, 0xFF, 0xE7, 0x01, 0x3F,
+    0xFF, 0xE7, 0x01, 0x40, 0xFF, 0xE7, 0x01, 0x41, 0xFF, 0xE7, 0x01, 0x42,
+    0xFF, 0xE7, 0x01, 0x43, 0xFF, 0xE7, 0x01, 0x44, 0xFF, 0xE7, 0x01, 0x45,
+    0xFF, 0xE7, 0x01, 0x46, 0xFF, 0xE7, 0x01, 0x47, 0xFF, 0xE7, 0x01, 0x48,
+    0xFF, 0xE7, 0x01, 0x49, 0xFF, 0xE7, 0x01, 0x4B, 0xFF, 0xE8, 0x01, 0x4C,
+    0xFF, 0xE8, 0x01, 0x4D, 0xFF, 0xE8, 0x01, 0x4E, 0xFF, 0xE8, 0x01, 0x4F,
+    0xFF, 0xE8, 0x01, 0x50, 0xFF, 0xE8, 0x01, 0x51, 0xFF, 0xE8, 0x01, 0x69,
+    0x00, 0x1E, 0x01, 0x6A, 0x00, 0x1E, 0x01, 0x6B, 0x00, 0x1E, 0x01, 0x81,
+    0x00, 0x1E, 0x01, 0x86, 0xFF, 0xE7, 0x01, 0x87, 0xFF, 0xE7, 0x01, 0x88,
+    0xFF, 0xE7, 0x01, 0x89, 0xFF, 0xE7, 0x01, 0x8A, 0xFF, 0xE7, 0x01, 0x8B,
+    0xFF, 0xE7, 0x01, 0x8C, 0xFF, 0xE7, 0x01, 0x8D, 0xFF, 0xE7, 0x01, 0x8E,
+    0xFF, 0xE7, 0x01, 0x8F, 0xFF, 0xE7, 0x01, 0x90, 0xFF, 0xE7, 0x01, 0x91,
+    0xFF, 0xE7, 0x01, 0x92, 0xFF, 0xE7, 0x01, 0x93, 0xFF, 0xE7, 0x01, 0x94,
+    0xFF, 0xE7, 0x01, 0x95, 0xFF, 0xE7, 0x01, 0x96, 0xFF, 0xE7, 0x01, 0x97,
+    0xFF, 0xE7, 0x01, 0x98, 0xFF, 0xE7, 0x01, 0x99, 0xFF, 0xE7, 0x01, 0x9A,
+    0xFF, 0xE7, 0x01, 0x9B, 0xFF, 0xE7, 0x01, 0x9C, 0xFF, 0xE7, 0x01, 0x9D,
+    0xFF, 0xE7, 0x01, 0x9E, 0xFF, 0xE7, 0x01, 0x9F, 0xFF, 0xE7, 0x01, 0xA0,
+    0xFF, 0xE7, 0x01, 0xA1, 0xFF, 0xE7, 0x01, 0xA2, 0xFF, 0xE7, 0x01, 0xA3,
+    0xFF, 0xE7, 0x01, 0xA4, 0xFF, 0xE7, 0x01, 0xA5, 0xFF, 0xE7, 0x01, 0xA6,
+    0xFF, 0xE7, 0x01, 0xA7, 0xFF, 0xE7, 0x01, 0xA8, 0xFF, 0xE7, 0x01, 0xA9,
+    0xFF, 0xE7, 0x01, 0xAA, 0x00, 0x1E, 0x01, 0xAB, 0x00, 0x0F, 0x01, 0xAC,
+    0xFF, 0xE7, 0x01, 0xF8, 0xFF, 0xE7, 0x01, 0xF9, 0xFF, 0xE7, 0x01, 0xFA,
+    0xFF, 0xE7, 0x01, 0xFB, 0xFF, 0xE7, 0x01, 0xFC, 0xFF, 0xE7, 0x01, 0xFD,
+    0xFF, 0xE7, 0x01, 0xFE, 0xFF, 0xE7, 0x01, 0xFF, 0xFF, 0xE7, 0x02, 0x00,
+    0xFF, 0xE7, 0x02, 0x01, 0xFF, 0xE7, 0x02, 0x02, 0xFF, 0xE7, 0x02, 0x03,
+    0xFF, 0xE7, 0x02, 0x04, 0xFF, 0xE7, 0x02, 0x05, 0xFF, 0xE7, 0x02, 0x06,
+    0xFF, 0xE7, 0x02, 0x07, 0xFF, 0xE7, 0x02, 0x08, 0xFF, 0xE7, 0x02, 0x09,
+    0xFF, 0xE7, 0x02, 0x0A, 0xFF, 0xE7, 0x02, 0x0B, 0xFF, 0xE7, 0x02, 0x0C,
+    0xFF, 0xE7, 0x02, 0x0D, 0xFF, 0xE7, 0x02, 0x0E, 0xFF, 0xE7, 0x02, 0x0F,
+    0xFF, 0xE7, 0x02, 0x10, 0xFF, 0xE7, 0x02, 0x11, 0xFF, 0xE7, 0x00, 0x04,
+    0x00, 0xDB, 0xFF, 0xE3, 0x01, 0x2C, 0xFF, 0xDE, 0x01, 0xAB, 0x00, 0x08,
+    0x01, 0xE1, 0xFF, 0xEB, 0x00, 0xD2, 0x00, 0x1E, 0xFF, 0xCE, 0x00, 0x1F,
+    0xFF, 0xCE, 0x00, 0x20, 0xFF, 0xCE, 0x00, 0x21, 0xFF, 0xCE, 0x00, 0x22,
+    0xFF, 0xCE, 0x00, 0x23, 0xFF, 0xCE, 0x00, 0x24, 0xFF, 0xCE, 0x00, 0x47,
+    0xFF, 0xCE, 0x00, 0x48, 0xFF, 0xCE, 0x00, 0x49, 0xFF, 0xCE, 0x00, 0x4A,
+    0xFF, 0xCE, 0x00, 0x4B, 0xFF, 0xCE, 0x00, 0x4C, 0xFF, 0xCE, 0x00, 0x4D,
+    0xFF, 0xCE, 0x00, 0x80, 0xFF, 0xCE, 0x00, 0x81, 0xFF, 0xCE, 0x00, 0x82,
+    0xFF, 0xCE, 0x00, 0x83, 0xFF, 0xCE, 0x00, 0x84, 0xFF, 0xCE, 0x00, 0x85,
+    0xFF, 0xCE, 0x00, 0x86, 0xFF, 0xCE, 0x00, 0x87, 0xFF, 0xCE, 0x00, 0x88,
+    0xFF, 0xCE, 0x00, 0x89, 0xFF, 0xCE, 0x00, 0x8A, 0xFF, 0xCE, 0x00, 0x8B,
+    0xFF, 0xCE, 0x00, 0x8C, 0xFF, 0xCE, 0x00, 0x8D, 0xFF, 0xCE, 0x00, 0x8E,
+    0xFF, 0xCE, 0x00, 0x8F, 0xFF, 0xCE, 0x00, 0x90, 0xFF, 0xCE, 0x00, 0x91,
+    0xFF, 0xCE, 0x00, 0x92, 0xFF, 0xCE, 0x00, 0x93, 0xFF, 0xCE, 0x00, 0x94,
+    0xFF, 0xCE, 0x00, 0x95, 0xFF, 0xCE, 0x00, 0x96, 0xFF, 0xCE, 0x00, 0x97,
+    0xFF, 0xCE, 0x00, 0x98, 0xFF, 0xCE, 0x00, 0x99, 0xFF, 0xCE, 0x00, 0x9A,
+    0xFF, 0xCE, 0x00, 0x9B, 0xFF, 0xCE, 0x00, 0x9C, 0xFF, 0xCE, 0x00, 0x9D,
+    0xFF, 0xCE, 0x00, 0x9E, 0xFF, 0xCE, 0x00, 0x9F, 0xFF, 0xCE, 0x00, 0xA0,
+    0xFF, 0xCE, 0x00, 0xA1, 0xFF, 0xCE, 0x00, 0xA2, 0xFF, 0xCE, 0x00, 0xA3,
+    0xFF, 0xCE, 0x00, 0xA6, 0xFF, 0xCE, 0x00, 0xBB, 0xFF, 0xCE, 0x00, 0xBC,
+    0xFF, 0xC4, 0x00, 0xBD, 0xFF, 0xC4, 0x00, 0xBE, 0xFF, 0xC4, 0x00, 0xBF,
+    0xFF, 0xC4, 0x00, 0xC0, 0xFF, 0xC4, 0x00, 0xC1, 0xFF, 0xC4, 0x00, 0xC2,
+    0xFF, 0xC4, 0x00, 0xDB, 0xFF, 0xD8, 0x00, 0xDC, 0xFF, 0xD8, 0x00, 0xDD,
+    0xFF, 0xD8, 0x00, 0xDE, 0xFF, 0xD8, 0x00, 0xDF, 0xFF, 0xD8, 0x00, 0xE0,
+    0xFF, 0xD8, 0x00, 0xE2, 0xFF, 0xB0, 0x00, 0xE3, 0xFF, 0xB0, 0x00, 0xE4,
+    0xFF, 0xB0, 0x00, 0xE5, 0xFF, 0xB0, 0x00, 0xE6, 0xFF, 0xB0, 0x00, 0xE7,
+    0xFF, 0xB0, 0x00, 0xE8, 0xFF, 0xB0, 0x00, 0xE9, 0xFF, 0xB0, 0x00, 0xEA,
+    0xFF, 0xB0, 0x00, 0xEB, 0xFF, 0xB0, 0x01, 0x07, 0x00, 0x00, 0x01, 0x08,
+    0x00, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x01, 0x0B,
+    0x00, 0x00, 0x01, 0x0C, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00, 0x01, 0x0E,
+    0x00, 0x00, 0x01, 0x0F, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x11,
+    0x00, 0x00, 0x01, 0x12, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x01, 0x15, 0x00, 0x00, 0x01, 0x16, 0x00, 0x00, 0x01, 0x17,
+    0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x1A,
+    0x00, 0x00, 0x01, 0x1B, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x00, 0x01, 0x1D,
+    0x00, 0x00, 0x01, 0x1E, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x20,
+    0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x01, 0x25, 0x00, 0x00, 0x01, 0x26,
+    0x00, 0x00, 0x01, 0x27, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x01, 0x29,
+    0x00, 0x00, 0x01, 0x2A, 0x00, 0x00, 0x01, 0x2B, 0x00, 0x00, 0x01, 0x2C,
+    0xFF, 0xEA, 0x01, 0x2D, 0x00, 0x00, 0x01, 0x2E, 0x00, 0x00, 0x01, 0x2F,
+    0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x01, 0x32,
+    0x00, 0x00, 0x01, 0x33, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x01, 0x35,
+    0x00, 0x00, 0x01, 0x36, 0x00, 0x00, 0x01, 0x37, 0x00, 0x00, 0x01, 0x38,
+    0x00, 0x00, 0x01, 0x39, 0x00, 0x00, 0x01, 0x3A, 0x00, 0x00, 0x01, 0x3B,
+    0x00, 0x00, 0x01, 0x3C, 0x00, 0x00, 0x01, 0x3D, 0x00, 0x00, 0x01, 0x3E,
+    0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x41,
+    0x00, 0x00, 0x01, 0x42, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x01, 0x44,
+    0x00, 0x00, 0x01, 0x45, 0x00, 0x00, 0x01, 0x46, 0x00, 0x00, 0x01, 0x47,
+    0x00, 0x00, 0x01, 0x48, 0x00, 0x00, 0x01, 0x49, 0x00, 0x00, 0x01, 0x69,
+    0x00, 0x3C, 0x01, 0x6A, 0x00, 0x3C, 0x01, 0x6B, 0x00, 0x3C, 0x01, 0x81,
+    0x00, 0x3C, 0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x88,
+    0x00, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x01, 0x8B,
+    0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x8E,
+    0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x91,
+    0x00, 0x00, 0x01, 0x92, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0x01, 0x94,
+    0x00, 0x00, 0x01, 0x95, 0x00, 0x00, 0x01, 0x96, 0x00, 0x00, 0x01, 0x97,
+    0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x01, 0x9A,
+    0x00, 0x00, 0x01, 0x9B, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x00, 0x01, 0x9D,
+    0x00, 0x00, 0x01, 0x9E, 0x00, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x01, 0xA0,
+    0x00, 0x00, 0x01, 0xA1, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x01, 0xA3,
+    0x00, 0x00, 0x01, 0xA4, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x01, 0xA6,
+    0x00, 0x00, 0x01, 0xA7, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x01, 0xA9,
+    0x00, 0x00, 0x01, 0xAC, 0x00, 0x00, 0x01, 0xC0, 0xFF, 0xFA, 0x01, 0xE1,
+    0xFF, 0xF9, 0x01, 0xE7, 0xFF, 0xFF, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF9,
+    0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x01, 0xFC,
+    0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02,
+    0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x05,
+    0x00, 0x00, 0x02, 0x06, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x02, 0x08,
+    0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x02, 0x0B,
+    0x00, 0x00, 0x02, 0x0C, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x00, 0x02, 0x0E,
+    0x00, 0x00, 0x02, 0x0F, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x11,
+    0x00, 0x00, 0x02, 0x77, 0xFF, 0xA4, 0x00, 0xED, 0x00, 0x01, 0xFF, 0x9C,
+    0x00, 0x02, 0xFF, 0x9C, 0x00, 0x03, 0xFF, 0x9C, 0x00, 0x04, 0xFF, 0x9C,
+    0x00, 0x05, 0xFF, 0x9C, 0x00, 0x06, 0xFF, 0x9C, 0x00, 0x07, 0xFF, 0x9C,
+    0x00, 0x08, 0xFF, 0x9C, 0x00, 0x09, 0xFF, 0x9C, 0x00, 0x0A, 0xFF, 0x9C,
+    0x00, 0x0B, 0xFF, 0x9C, 0x00, 0x0C, 0xFF, 0x9C, 0x00, 0x0D, 0xFF, 0x9C,
+    0x00, 0x0E, 0xFF, 0x9C, 0x00, 0x0F, 0xFF, 0x9C, 0x00, 0x10, 0xFF, 0x9C,
+    0x00, 0x11, 0xFF, 0x9C, 0x00, 0x12, 0xFF, 0x9C, 0x00, 0x13, 0xFF, 0x9C,
+    0x00, 0x14, 0xFF, 0x9C, 0x00, 0x15, 0xFF, 0x9C, 0x00, 0x16, 0xFF, 0x9C,
+    0x00, 0x17, 0xFF, 0x9C, 0x00, 0x18, 0xFF, 0x9C, 0x00, 0x19, 0xFF, 0x9C,
+    0x00, 0x1A, 0xFF, 0x9C, 0x00, 0x1E, 0xFF, 0xD8, 0x00, 0x1F, 0xFF, 0xD8,
+    0x00, 0x20, 0xFF, 0xD8, 0x00, 0x21, 0xFF, 0xD8, 0x00, 0x22, 0xFF, 0xD8,
+    0x00, 0x23, 0xFF, 0xD8, 0x00, 0x24, 0xFF, 0xD8, 0x00, 0x47, 0xFF, 0xD8,
+    0x00, 0x48, 0xFF, 0xD8, 0x00, 0x49, 0xFF, 0xD8, 0x00, 0x4A, 0xFF, 0xD8,
+    0x00, 0x4B, 0xFF, 0xD8, 0x00, 0x4C, 0xFF, 0xD8, 0x00, 0x4D, 0xFF, 0xD8,
+    0x00, 0x64, 0xFF, 0xCE, 0x00, 0x65, 0xFF, 0xCE, 0x00, 0x80, 0xFF, 0xD8,
+    0x00, 0x81, 0xFF, 0xD8, 0x00, 0x82, 0xFF, 0xD8, 0x00, 0x83, 0xFF, 0xD8,
+    0x00, 0x84, 0xFF, 0xD8, 0x00, 0x85, 0xFF, 0xD8, 0x00, 0x86, 0xFF, 0xD8,
+    0x00, 0x87, 0xFF, 0xD8, 0x00, 0x88, 0xFF, 0xD8, 0x00, 0x89, 0xFF, 0xD8,
+    0x00, 0x8A, 0xFF, 0xD8, 0x00, 0x8B, 0xFF, 0xD8, 0x00, 0x8C, 0xFF, 0xD8,
+    0x00, 0x8D, 0xFF, 0xD8, 0x00, 0x8E, 0xFF, 0xD8, 0x00, 0x8F, 0xFF, 0xD8,
+    0x00, 0x90, 0xFF, 0xD8, 0x00, 0x91, 0xFF, 0xD8, 0x00, 0x92, 0xFF, 0xD8,
+    0x00, 0x93, 0xFF, 0xD8, 0x00, 0x94, 0xFF, 0xD8, 0x00, 0x95, 0xFF, 0xD8,
+    0x00, 0x96, 0xFF, 0xD8, 0x00, 0x97, 0xFF, 0xD8, 0x00, 0x98, 0xFF, 0xD8,
+    0x00, 0x99, 0xFF, 0xD8, 0x00, 0x9A, 0xFF, 0xD8, 0x00, 0x9B, 0xFF, 0xD8,
+    0x00, 0x9C, 0xFF, 0xD8, 0x00, 0x9D, 0xFF, 0xD8, 0x00, 0x9E, 0xFF, 0xD8,
+    0x00, 0x9F, 0xFF, 0xD8, 0x00, 0xA0, 0xFF, 0xD8, 0x00, 0xA1, 0xFF, 0xD8,
+    0x00, 0xA2, 0xFF, 0xD8, 0x00, 0xA3, 0xFF, 0xD8, 0x00, 0xA6, 0xFF, 0xD8,
+    0x00, 0xBB, 0xFF, 0xD8, 0x01, 0x03, 0xFF, 0xCE, 0x01, 0x04, 0xFF, 0xCE,
+    0x01, 0x07, 0xFF, 0xCE, 0x01, 0x08, 0xFF, 0xCE, 0x01, 0x09, 0xFF, 0xCE,
+    0x01, 0x0A, 0xFF, 0xCE, 0x01, 0x0B, 0xFF, 0xCE, 0x01, 0x0C, 0xFF, 0xCE,
+    0x01, 0x0D, 0xFF, 0xCE, 0x01, 0x0E, 0xFF, 0xCE, 0x01, 0x0F, 0xFF, 0xCE,
+    0x01, 0x10, 0xFF, 0xCE, 0x01, 0x11, 0xFF, 0xCE, 0x01, 0x12, 0xFF, 0xCE,
+    0x01, 0x13, 0xFF, 0xCE, 0x01, 0x14, 0xFF, 0xCE, 0x01, 0x15, 0xFF, 0xCE,
+    0x01, 0x16, 0xFF, 0xCE, 0x01, 0x17, 0xFF, 0xCE, 0x01, 0x18, 0xFF, 0xCE,
+    0x01, 0x19, 0xFF, 0xCE, 0x01, 0x1A, 0xFF, 0xCE, 0x01, 0x1B, 0xFF, 0xCE,
+    0x01, 0x1C, 0xFF, 0xCE, 0x01, 0x1D, 0xFF, 0xCE, 0x01, 0x1E, 0xFF, 0xCE,
+    0x01, 0x1F, 0xFF, 0xCE, 0x01, 0x20, 0xFF, 0xCE, 0x01, 0x24, 0xFF, 0xCE,
+    0x01, 0x25, 0xFF, 0xCE, 0x01, 0x26, 0xFF, 0xCE, 0x01, 0x27, 0xFF, 0xCE,
+    0x01, 0x28, 0xFF, 0xCE, 0x01, 0x29, 0xFF, 0xCE, 0x01, 0x2A, 0xFF, 0xCE,
+    0x01, 0x2B, 0xFF, 0xCE, 0x01, 0x2C, 0xFF, 0xE0, 0x01, 0x2D, 0xFF, 0xCE,
+    0x01, 0x2E, 0xFF, 0xCE, 0x01, 0x2F, 0xFF, 0xCE, 0x01, 0x30, 0xFF, 0xCE,
+    0x01, 0x31, 0xFF, 0xCE, 0x01, 0x32, 0xFF, 0xCE, 0x01, 0x33, 0xFF, 0xCE,
+    0x01, 0x34, 0xFF, 0xCE, 0x01, 0x35, 0xFF, 0xCE, 0x01, 0x36, 0xFF, 0xCE,
+    0x01, 0x37, 0xFF, 0xCE, 0x01, 0x38, 0xFF, 0xCE, 0x01, 0x39, 0xFF, 0xCE,
+    0x01, 0x3A, 0xFF, 0xCE, 0x01, 0x3B, 0xFF, 0xCE, 0x01, 0x3C, 0xFF, 0xCE,
+    0x01, 0x3D, 0xFF, 0xCE, 0x01, 0x3E, 0xFF, 0xCE, 0x01, 0x3F, 0xFF, 0xCE,
+    0x01, 0x40, 0xFF, 0xCE, 0x01, 0x41, 0xFF, 0xCE, 0x01, 0x42, 0xFF, 0xCE,
+    0x01, 0x43, 0xFF, 0xCE, 0x01, 0x44, 0xFF, 0xCE, 0x01, 0x45, 0xFF, 0xCE,
+    0x01, 0x46, 0xFF, 0xCE, 0x01, 0x47, 0xFF, 0xCE, 0x01, 0x48, 0xFF, 0xCE,
+    0x01, 0x49, 0xFF, 0xCE, 0x01, 0x4B, 0xFF, 0xCE, 0x01, 0x4C, 0xFF, 0xCE,
+    0x01, 0x4D, 0xFF, 0xCE, 0x01, 0x4E, 0xFF, 0xCE, 0x01, 0x4F, 0xFF, 0xCE,
+    0x01, 0x50, 0xFF, 0xCE, 0x01, 0x51, 0xFF, 0xCE, 0x01, 0x86, 0xFF, 0xCE,
+    0x01, 0x87, 0xFF, 0xCE, 0x01, 0x88, 0xFF, 0xCE, 0x01, 0x89, 0xFF, 0xCE,
+    0x01, 0x8A, 0xFF, 0xCE, 0x01, 0x8B, 0xFF, 0xCE, 0x01, 0x8C, 0xFF, 0xCE,
+    0x01, 0x8D, 0xFF, 0xCE, 0x01, 0x8E, 0xFF, 0xCE, 0x01, 0x8F, 0xFF, 0xCE,
+    0x01, 0x90, 0xFF, 0xCE, 0x01, 0x91, 0xFF, 0xCE, 0x01, 0x92, 0xFF, 0xCE,
+    0x01, 0x93, 0xFF, 0xCE, 0x01, 0x94, 0xFF, 0xCE, 0x01, 0x95, 0xFF, 0xCE,
+    0x01, 0x96, 0xFF, 0xCE, 0x01, 0x97, 0xFF, 0xCE, 0x01, 0x98, 0xFF, 0xCE,
+    0x01, 0x99, 0xFF, 0xCE, 0x01, 0x9A, 0xFF, 0xCE, 0x01, 0x9B, 0xFF, 0xCE,
+    0x01, 0x9C, 0xFF, 0xCE, 0x01, 0x9D, 0xFF, 0xCE, 0x01, 0x9E, 0xFF, 0xCE,
+    0x01, 0x9F, 0xFF, 0xCE, 0x01, 0xA0, 0xFF, 0xCE, 0x01, 0xA1, 0xFF, 0xCE,
+    0x01, 0xA2, 0xFF, 0xCE, 0x01, 0xA3, 0xFF, 0xCE, 0x01, 0xA4, 0xFF, 0xCE,
+    0x01, 0xA5, 0xFF, 0xCE, 0x01, 0xA6, 0xFF, 0xCE, 0x01, 0xA7, 0xFF, 0xCE,
+    0x01, 0xA8, 0xFF, 0xCE, 0x01, 0xA9, 0xFF, 0xCE, 0x01, 0xAC, 0xFF, 0xCE,
+    0x01, 0xB5, 0xFF, 0xE2, 0x01, 0xB6, 0xFF, 0xE2, 0x01, 0xB7, 0xFF, 0xE2,
+    0x01, 0xB8, 0xFF, 0xE2, 0x01, 0xB9, 0xFF, 0xE2, 0x01, 0xBA, 0xFF, 0xE2,
+    0x01, 0xBB, 0xFF, 0xE2, 0x01, 0xBC, 0xFF, 0xE2, 0x01, 0xBD, 0xFF, 0xE2,
+    0x01, 0xBE, 0xFF, 0xE2, 0x01, 0xBF, 0xFF, 0xE2, 0x01, 0xC0, 0xFF, 0xF4,
+    0x01, 0xE1, 0xFF, 0xFF, 0x01, 0xE7, 0xFF, 0xFA, 0x01, 0xF8, 0xFF, 0xCE,
+    0x01, 0xF9, 0xFF, 0xCE, 0x01, 0xFA, 0xFF, 0xCE, 0x01, 0xFB, 0xFF, 0xCE,
+    0x01, 0xFC, 0xFF, 0xCE, 0x01, 0xFD, 0xFF, 0xCE, 0x01, 0xFE, 0xFF, 0xCE,
+    0x01, 0xFF, 0xFF, 0xCE, 0x02, 0x00, 0xFF, 0xCE, 0x02, 0x01, 0xFF, 0xCE,
+    0x02, 0x02, 0xFF, 0xCE, 0x02, 0x03, 0xFF, 0xCE, 0x02, 0x04, 0xFF, 0xCE,
+    0x02, 0x05, 0xFF, 0xCE, 0x02, 0x06, 0xFF, 0xCE, 0x02, 0x07, 0xFF, 0xCE,
+    0x02, 0x08, 0xFF, 0xCE, 0x02, 0x09, 0xFF, 0xCE, 0x02, 0x0A, 0xFF, 0xCE,
+    0x02, 0x0B, 0xFF, 0xCE, 0x02, 0x0C, 0xFF, 0xCE, 0x02, 0x0D, 0xFF, 0xCE,
+    0x02, 0x0E, 0xFF, 0xCE, 0x02, 0x0F, 0xFF, 0xCE, 0x02, 0x10, 0xFF, 0xCE,
+    0x02, 0x11, 0xFF, 0xCE, 0x02, 0x22, 0xFF, 0x9C, 0x02, 0x26, 0xFF, 0xCE,
+    0x02, 0x27, 0xFF, 0xE2, 0x02, 0x28, 0xFF, 0xE2, 0x02, 0x2A, 0xFF, 0xC4,
+    0x02, 0x2C, 0xFF, 0xCE, 0x02, 0x76, 0xFF, 0xA4, 0x00, 0x1D, 0x00, 0x01,
+    0xFF, 0xB5, 0x00, 0x02, 0xFF, 0xB5, 0x00, 0x03, 0xFF, 0xB5, 0x00, 0x04,
+    0xFF, 0xB5, 0x00, 0x05, 0xFF, 0xB5, 0x00, 0x06, 0xFF, 0xB5, 0x00, 0x07,
+    0xFF, 0xB5, 0x00, 0x08, 0xFF, 0xB5, 0x00, 0x09, 0xFF, 0xB5, 0x00, 0x0A,
+    0xFF, 0xB5, 0x00, 0x0B, 0xFF, 0xB5, 0x00, 0x0C, 0xFF, 0xB5, 0x00, 0x0D,
+    0xFF, 0xB5, 0x00, 0x0E, 0xFF, 0xB5, 0x00, 0x0F, 0xFF, 0xB5, 0x00, 0x10,
+    0xFF, 0xB5, 0x00, 0x11, 0xFF, 0xB5, 0x00, 0x12, 0xFF, 0xB5, 0x00, 0x13,
+    0xFF, 0xB5, 0x00, 0x14, 0xFF, 0xB5, 0x00, 0x15, 0xFF, 0xB5, 0x00, 0x16,
+    0xFF, 0xB5, 0x00, 0x17, 0xFF, 0xB5, 0x00, 0x18, 0xFF, 0xB5, 0x00, 0x19,
+    0xFF, 0xB5, 0x00, 0x1A, 0xFF, 0xB5, 0x01, 0x2C, 0xFF, 0xE7, 0x01, 0xE1,
+    0x00, 0x06, 0x02, 0x22, 0xFF, 0xB5, 0x00, 0x01, 0x00, 0xDB, 0xFF, 0xF8,
+    0x00, 0x03, 0x00, 0xDB, 0xFF, 0xF4, 0x01, 0x2C, 0x00, 0x0A, 0x01, 0xE7,
+    0xFF, 0xFA, 0x00, 0x03, 0x00, 0xDB, 0xFF, 0xEF, 0x01, 0x2C, 0xFF, 0xE2,
+    0x01, 0xE1, 0xFF, 0xF7, 0x00, 0x20, 0x00, 0x01, 0xFF, 0xD8, 0x00, 0x02,
+    0xFF, 0xD8, 0x00, 0x03, 0xFF, 0xD8, 0x00, 0x04, 0xFF, 0xD8, 0x00, 0x05,
+    0xFF, 0xD8, 0x00, 0x06, 0xFF, 0xD8, 0x00, 0x07, 0xFF, 0xD8, 0x00, 0x08,
+    0xFF, 0xD8, 0x00, 0x09, 0xFF, 0xD8, 0x00, 0x0A, 0xFF, 0xD8, 0x00, 0x0B,
+    0xFF, 0xD8, 0x00, 0x0C, 0xFF, 0xD8, 0x00, 0x0D, 0xFF, 0xD8, 0x00, 0x0E,
+    0xFF, 0xD8, 0x00, 0x0F, 0xFF, 0xD8, 0x00, 0x10, 0xFF, 0xD8, 0x00, 0x11,
+    0xFF, 0xD8, 0x00, 0x12, 0xFF, 0xD8, 0x00, 0x13, 0xFF, 0xD8, 0x00, 0x14,
+    0xFF, 0xD8, 0x00, 0x15, 0xFF, 0xD8, 0x00, 0x16, 0xFF, 0xD8, 0x00, 0x17,
+    0xFF, 0xD8, 0x00, 0x18, 0xFF, 0xD8, 0x00, 0x19, 0xFF, 0xD8, 0x00, 0x1A,
+    0xFF, 0xD8, 0x00, 0x64, 0xFF, 0xB5, 0x00, 0x65, 0xFF, 0xB5, 0x01, 0x03,
+    0xFF, 0xB5, 0x01, 0x04, 0xFF, 0xB5, 0x01, 0x2C, 0xFF, 0xF1, 0x02, 0x22,
+    0xFF, 0xD8, 0x00, 0x01, 0x00, 0xDB, 0xFF, 0xFA, 0x00, 0x19, 0x00, 0xBC,
+    0xFF, 0x9C, 0x00, 0xBD, 0xFF, 0x9C, 0x00, 0xBE, 0xFF, 0x9C, 0x00, 0xBF,
+    0xFF, 0x9C, 0x00, 0xC0, 0xFF, 0x9C, 0x00, 0xC1, 0xFF, 0x9C, 0x00, 0xC2,
+    0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x88, 0x00, 0xDC, 0xFF, 0xB0, 0x00, 0xDD,
+    0xFF, 0xB0, 0x00, 0xDE, 0xFF, 0xB0, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0xE0,
+    0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88, 0x00, 0xE3, 0xFF, 0x88, 0x00, 0xE4,
+    0xFF, 0x88, 0x00, 0xE5, 0xFF, 0x88, 0x00, 0xE6, 0xFF, 0x88, 0x00, 0xE7,
+    0xFF, 0x88, 0x00, 0xE8, 0xFF, 0x88, 0x00, 0xE9, 0xFF, 0x88, 0x00, 0xEA,
+    0xFF, 0x88, 0x00, 0xEB, 0xFF, 0x88, 0x01, 0xE1, 0xFF, 0xD8, 0x02, 0x2A,
+    0xFF, 0xE7, 0x00, 0x19, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xBD, 0xFF, 0x9C,
+    0x00, 0xBE, 0xFF, 0x9C, 0x00, 0xBF, 0xFF, 0x9C, 0x00, 0xC0, 0xFF, 0x9C,
+    0x00, 0xC1, 0xFF, 0x9C, 0x00, 0xC2, 0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x9C,
+    0x00, 0xDC, 0xFF, 0xB0, 0x00, 0xDD, 0xFF, 0xB0, 0x00, 0xDE, 0xFF, 0xB0,
+    0x00, 0xDF, 0xFF, 0xB0, 0x00, 0xE0, 0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88,
+    0x00, 0xE3, 0xFF, 0x88, 0x00, 0xE4, 0xFF, 0x88, 0x00, 0xE5, 0xFF, 0x88,
+    0x00, 0xE6, 0xFF, 0x88, 0x00, 0xE7, 0xFF, 0x88, 0x00, 0xE8, 0xFF, 0x88,
+    0x00, 0xE9, 0xFF, 0x88, 0x00, 0xEA, 0xFF, 0x88, 0x00, 0xEB, 0xFF, 0x88,
+    0x01, 0xE1, 0xFF, 0xD8, 0x02, 0x2A, 0xFF, 0xE7, 0x00, 0x02, 0x02, 0x76,
+    0xFF, 0xCE, 0x02, 0xE1, 0xFF, 0xD8, 0x00, 0x01, 0x02, 0xE1, 0xFF, 0xE2,
+    0x00, 0x0A, 0x02, 0x27, 0xFF, 0xF1, 0x02, 0x28, 0xFF, 0xEC, 0x02, 0x2A,
+    0xFF, 0xE7, 0x02, 0x2C, 0xFF, 0xEC, 0x02, 0x2E, 0xFF, 0xEC, 0x02, 0x69,
+    0xFF, 0xB0, 0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x76, 0xFF, 0x88, 0x02, 0xD5,
+    0xFF, 0xCE, 0x02, 0xE1, 0xFF, 0xA6, 0x00, 0x01, 0x02, 0xE1, 0xFF, 0xEC,
+    0x00, 0x02, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0xE1, 0xFF, 0xEC, 0x00, 0x03,
+    0x02, 0x28, 0xFF, 0xEC, 0x02, 0x2D, 0xFF, 0xEC, 0x02, 0xDF, 0xFF, 0xC4,
+    0x00, 0x02, 0x02, 0x76, 0xFF, 0xE7, 0x02, 0xE1, 0xFF, 0xE2, 0x00, 0x02,
+    0x02, 0x2A, 0xFF, 0xEC, 0x02, 0x8C, 0x00, 0x0A, 0x00, 0x01, 0x02, 0xD5,
+    0xFF, 0xD8, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xCE, 0x02, 0xE1, 0xFF, 0xCE,
+    0x00, 0x03, 0x02, 0x6A, 0x00, 0x00, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0xA7,
+    0xFF, 0xE2, 0x00, 0x05, 0x01, 0x2C, 0xFF, 0xFD, 0x02, 0x72, 0xFF, 0xFA,
+    0x02, 0x76, 0xFF, 0xFF, 0x02, 0x77, 0xFF, 0xFA, 0x02, 0xA7, 0xFF, 0xFD,
+    0x00, 0x03, 0x02, 0x6A, 0xFF, 0xD8, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0xA7,
+    0xFF, 0xE2, 0x00, 0x09, 0x01, 0x2C, 0xFF, 0xFC, 0x02, 0x6A, 0xFF, 0xD8,
+    0x02, 0x70, 0x00, 0x04, 0x02, 0x71, 0xFF, 0xF4, 0x02, 0x74, 0x00, 0x06,
+    0x02, 0x76, 0xFF, 0xEC, 0x02, 0x77, 0xFF, 0xFF, 0x02, 0x85, 0xFF, 0xEB,
+    0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x09, 0x01, 0xE1, 0xFF, 0xFD, 0x01, 0xE7,
+    0xFF, 0xFD, 0x02, 0x72, 0x00, 0x0A, 0x02, 0x74, 0xFF, 0xEC, 0x02, 0x76,
+    0xFF, 0xF4, 0x02, 0x77, 0xFF, 0xFB, 0x02, 0x85, 0xFF, 0xDE, 0x02, 0x8A,
+    0xFF, 0xE7, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x02, 0x02, 0x74, 0x00, 0x14,
+    0x02, 0x76, 0xFF, 0xEC, 0x00, 0x04, 0x00, 0xDB, 0xFF, 0xF6, 0x02, 0x77,
+    0xFF, 0xFA, 0x02, 0x85, 0x00, 0x01, 0x02, 0x8A, 0x00, 0x1E, 0x00, 0x02,
+    0x02, 0x6A, 0xFF, 0xFD, 0x02, 0x77, 0xFF, 0xE2, 0x00, 0x04, 0x02, 0x74,
+    0x00, 0x1E, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0x8A, 0x00, 0x1E, 0x02, 0x8E,
+    0x00, 0x28, 0x00, 0x0A, 0x00, 0x53, 0xFF, 0xF1, 0x01, 0xE7, 0xFF, 0xFD,
+    0x02, 0x71, 0xFF, 0xEC, 0x02, 0x72, 0x00, 0x0A, 0x02, 0x74, 0xFF, 0xF1,
+    0x02, 0x76, 0xFF, 0xE3, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x85, 0xFF, 0xCA,
+    0x02, 0x8A, 0xFF, 0xE2, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x04, 0x02, 0x76,
+    0xFF, 0xCE, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x8A, 0xFF, 0xE7, 0x02, 0x8C,
+    0xFF, 0xE7, 0x00, 0x01, 0x02, 0x77, 0xFF, 0xE2, 0x00, 0x03, 0x02, 0x76,
+    0xFF, 0x88, 0x02, 0x81, 0xFF, 0x88, 0x02, 0xA7, 0xFF, 0xCE, 0x00, 0x01,
+    0x02, 0x81, 0xFF, 0xB0, 0x00, 0x03, 0x02, 0x76, 0xFF, 0xB0, 0x02, 0x81,
+    0xFF, 0xBA, 0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x0B, 0x02, 0x6F, 0xFF, 0xFA,
+    0x02, 0x70, 0x00, 0x07, 0x02, 0x71, 0xFF, 0xEC, 0x02, 0x72, 0xFF, 0xF4,
+    0x02, 0x73, 0xFF, 0xF8, 0x02, 0x76, 0xFF, 0xB0, 0x02, 0x81, 0xFF, 0x9C,
+    0x02, 0x85, 0xFF, 0xE3, 0x02, 0xA6, 0xFF, 0xFA, 0x02, 0xA7, 0xFF, 0xCE,
+    0x02, 0xAC, 0x00, 0x06, 0x00, 0x05, 0x02, 0x76, 0xFF, 0xC4, 0x02, 0x7E,
+    0xFF, 0x9C, 0x02, 0x80, 0xFF, 0x9C, 0x02, 0x81, 0xFF, 0x9C, 0x02, 0xA7,
+    0xFF, 0xC9, 0x00, 0x04, 0x02, 0x77, 0xFF, 0xD8, 0x02, 0x7E, 0xFF, 0xC4,
+    0x02, 0x80, 0x00, 0x00, 0x02, 0x81, 0xFF, 0xC4, 0x00, 0x04, 0x02, 0x77,
+    0xFF, 0xD8, 0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80, 0xFF, 0xC4, 0x02, 0x81,
+    0xFF, 0xC4, 0x00, 0x06, 0x00, 0x53, 0xFF, 0xF1, 0x02, 0x76, 0xFF, 0xD8,
+    0x02, 0x77, 0xFF, 0xCE, 0x02, 0x85, 0xFF, 0xF6, 0x02, 0x8A, 0xFF, 0xE2,
+    0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x0E, 0x01, 0xE1, 0x00, 0x03, 0x01, 0xE7,
+    0xFF, 0xFD, 0x02, 0x69, 0xFF, 0x9C, 0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x6E,
+    0x00, 0x0A, 0x02, 0x6F, 0x00, 0x14, 0x02, 0x71, 0xFF, 0xEC, 0x02, 0x72,
+    0x00, 0x19, 0x02, 0x73, 0x00, 0x04, 0x02, 0x74, 0xFF, 0xFB, 0x02, 0x76,
+    0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xEC, 0x02, 0x85, 0xFF, 0xCA, 0x02, 0xAC,
+    0xFF, 0xF0, 0x00, 0x04, 0x02, 0x69, 0xFF, 0x9C, 0x02, 0x6A, 0xFF, 0x9C,
+    0x02, 0x76, 0xFF, 0xB0, 0x02, 0x77, 0xFF, 0xCE, 0x00, 0x08, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x02, 0x74,
+    0xFF, 0xB5, 0x02, 0x77, 0xFF, 0x9C, 0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80,
+    0xFF, 0xC4, 0x02, 0x81, 0xFF, 0xC4, 0x00, 0x03, 0x02, 0x7E, 0xFF, 0xA6,
+    0x02, 0x80, 0xFF, 0xA6, 0x02, 0x81, 0xFF, 0xA6, 0x00, 0x04, 0x02, 0x76,
+    0xFF, 0xCE, 0x02, 0x8A, 0x00, 0x28, 0x02, 0x8C, 0x00, 0x28, 0x02, 0x8E,
+    0x00, 0x1E, 0x00, 0x34, 0x00, 0x1E, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0xF1,
+    0x00, 0x20, 0xFF, 0xF1, 0x00, 0x21, 0xFF, 0xF1, 0x00, 0x22, 0xFF, 0xF1,
+    0x00, 0x23, 0xFF, 0xF1, 0x00, 0x24, 0xFF, 0xF1, 0x00, 0x47, 0xFF, 0xF1,
+    0x00, 0x48, 0xFF, 0xF1, 0x00, 0x49, 0xFF, 0xF1, 0x00, 0x4A, 0xFF, 0xF1,
+    0x00, 0x4B, 0xFF, 0xF1, 0x00, 0x4C, 0xFF, 0xF1, 0x00, 0x4D, 0xFF, 0xF1,
+    0x00, 0x80, 0xFF, 0xF1, 0x00, 0x81, 0xFF, 0xF1, 0x00, 0x82, 0xFF, 0xF1,
+    0x00, 0x83, 0xFF, 0xF1, 0x00, 0x84, 0xFF, 0xF1, 0x00, 0x85, 0xFF, 0xF1,
+    0x00, 0x86, 0xFF, 0xF1, 0x00, 0x87, 0xFF, 0xF1, 0x00, 0x88, 0xFF, 0xF1,
+    0x00, 0x89, 0xFF, 0xF1, 0x00, 0x8A, 0xFF, 0xF1, 0x00, 0x8B, 0xFF, 0xF1,
+    0x00, 0x8C, 0xFF, 0xF1, 0x00, 0x8D, 0xFF, 0xF1, 0x00, 0x8E, 0xFF, 0xF1,
+    0x00, 0x8F, 0xFF, 0xF1, 0x00, 0x90, 0xFF, 0xF1, 0x00, 0x91, 0xFF, 0xF1,
+    0x00, 0x92, 0xFF, 0xF1, 0x00, 0x93, 0xFF, 0xF1, 0x00, 0x94, 0xFF, 0xF1,
+    0x00, 0x95, 0xFF, 0xF1, 0x00, 0x96, 0xFF, 0xF1, 0x00, 0x97, 0xFF, 0xF1,
+    0x00, 0x98, 0xFF, 0xF1, 0x00, 0x99, 0xFF, 0xF1, 0x00, 0x9A, 0xFF, 0xF1,
+    0x00, 0x9B, 0xFF, 0xF1, 0x00, 0x9C, 0xFF, 0xF1, 0x00, 0x9D, 0xFF, 0xF1,
+    0x00, 0x9E, 0xFF, 0xF1, 0x00, 0x9F, 0xFF, 0xF1, 0x00, 0xA0, 0xFF, 0xF1,
+    0x00, 0xA1, 0xFF, 0xF1, 0x00, 0xA2, 0xFF, 0xF1, 0x00, 0xA3, 0xFF, 0xF1,
+    0x00, 0xA6, 0xFF, 0xF1, 0x00, 0xBB, 0xFF, 0xF1, 0x00, 0x03, 0x00, 0x53,
+    0xFF, 0xF6, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xCE, 0x00, 0x01,
+    0x02, 0x77, 0xFF, 0xD8, 0x00, 0x05, 0x00, 0x53, 0xFF, 0xF1, 0x02, 0x76,
+    0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x8A, 0xFF, 0xE2, 0x02, 0x8C,
+    0xFF, 0xE7, 0x00, 0x03, 0x02, 0x8A, 0x00, 0x14, 0x02, 0x98, 0x00, 0x28,
+    0x02, 0x9A, 0x00, 0x28, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x8A,
+    0xFF, 0xEC, 0x00, 0x07, 0x02, 0x74, 0xFF, 0xB5, 0x02, 0x77, 0xFF, 0x9C,
+    0x02, 0x7E, 0xFF, 0xCE, 0x02, 0x80, 0xFF, 0xCE, 0x02, 0x81, 0xFF, 0xCE,
+    0x02, 0x99, 0xFF, 0xC4, 0x02, 0x9A, 0xFF, 0xC4, 0x00, 0x03, 0x00, 0x28,
+    0x00, 0x00, 0x02, 0x20, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x16, 0x00, 0x21,
+    0x00, 0x00, 0x73, 0x22, 0x35, 0x11, 0x34, 0x33, 0x21, 0x32, 0x15, 0x11,
+    0x14, 0x23, 0x25, 0x21, 0x32, 0x36, 0x27, 0x01, 0x26, 0x06, 0x15, 0x11,
+    0x14, 0x25, 0x16, 0x36, 0x35, 0x11, 0x34, 0x23, 0x21, 0x22, 0x06, 0x17,
+    0x4B, 0x23, 0x23, 0x01, 0xB2, 0x23, 0x23, 0xFE, 0x4E, 0x01, 0x9D, 0x03,
+    0x02, 0x02, 0xFE, 0x61, 0x02, 0x04, 0x01, 0xB6, 0x02, 0x04, 0x05, 0xFE,
+    0x62, 0x03, 0x02, 0x02, 0x23, 0x02, 0x76, 0x23, 0x23, 0xFD, 0x8A, 0x23,
+    0x1E, 0x04, 0x02, 0x02, 0x57, 0x03, 0x01, 0x04, 0xFD, 0xAA, 0x05, 0x23,
+    0x03, 0x01, 0x04, 0x02, 0x56, 0x05, 0x04, 0x02, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x02, 0xBC, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00,
+    0x73, 0x01, 0x33, 0x01, 0x23, 0x03, 0x2E, 0x03, 0x27, 0x33, 0x0E, 0x03,
+    0x07, 0x03, 0x27, 0x37, 0x21, 0x17, 0x07, 0x01, 0x13, 0x86, 0x01, 0x11,
+    0x9A, 0x8D, 0x06, 0x11, 0x12, 0x10, 0x04, 0x1B, 0x06, 0x0F, 0x10, 0x12,
+    0x08, 0x8D, 0x15, 0x31, 0x01, 0x41, 0x32, 0x02, 0xBC, 0xFD, 0x44, 0x01,
+    0x79, 0x10, 0x32, 0x38, 0x33, 0x11, 0x16, 0x31, 0x33, 0x30, 0x17, 0xFE,
+    0x8A, 0x93, 0x78, 0x78, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1,
+    0x03, 0xA8, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0x6C, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x03, 0x91,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 0x62, 0x00,
+    0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x04, 0x41, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x34, 0x62, 0x00, 0xFF, 0xFF,
+    0x00, 0x07, 0xFF, 0x26, 0x02, 0xB1, 0x03, 0x91, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x62, 0x00, 0x00, 0x06, 0x03, 0x32,
+    0x62, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x04, 0x41,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x33, 0x62, 0x00,
+    0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x04, 0x45, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x36, 0x62, 0x00, 0xFF, 0xFF,
+    0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x04, 0x35, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x35, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x31, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00,
+    0x02, 0xB1, 0x03, 0x8D, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x2C, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1,
+    0x04, 0x33, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2E,
+    0x00, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x26, 0x02, 0xB1,
+    0x03, 0x8D, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E,
+    0x62, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x04, 0x35, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2D, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x04, 0x37, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x30, 0x00, 0x98, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x04, 0x34, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x2F, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00,
+    0x02, 0xB1, 0x03, 0xB8, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x41, 0x30, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23,
+    0x62, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x26, 0x02, 0xB1, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x62, 0x00,
+    0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x61, 0x00, 0xFF, 0xFF,
+    0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x03, 0xCC, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x03, 0x91, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x42, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00,
+    0x02, 0xB1, 0x03, 0x71, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x3C, 0x61, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x30, 0x02, 0xB2,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x03, 0x46,
+    0x01, 0x43, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x37,
+    0x61, 0x00, 0xFF, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB1, 0x04, 0x5E,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x03, 0x37, 0x61, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0x6C, 0x00, 0xB7, 0xFF, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x02, 0xB1, 0x03, 0x85, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x38, 0x61, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x00,
+    0x03, 0xD1, 0x02, 0xBC, 0x00, 0x13, 0x00, 0x00, 0x63, 0x01, 0x21, 0x15,
+    0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x35, 0x21, 0x37,
+    0x33, 0x11, 0x17, 0x01, 0x05, 0x01, 0xE8, 0x01, 0xEE, 0xFE, 0xB8, 0x01,
+    0x1B, 0xFE, 0xE5, 0x01, 0x48, 0xFE, 0x2A, 0xFE, 0xF5, 0x52, 0xB9, 0x19,
+    0xFE, 0x88, 0x02, 0xBC, 0x7D, 0xA0, 0x79, 0xA9, 0x7D, 0x92, 0x78, 0x01,
+    0x24, 0x08, 0xFD, 0xDA, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x03, 0xD1,
+    0x03, 0xA8, 0x06, 0x26, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29,
+    0x01, 0xC8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x89,
+    0x02, 0xBC, 0x00, 0x13, 0x00, 0x1E, 0x00, 0x28, 0x00, 0x00, 0x73, 0x11,
+    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07, 0x27, 0x1E, 0x02, 0x15,
+    0x14, 0x0E, 0x02, 0x23, 0x27, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+    0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x23, 0x5B, 0x01, 0x30, 0x46, 0x61, 0x32, 0x3C, 0x38, 0x01, 0x2F, 0x45,
+    0x26, 0x22, 0x42, 0x59, 0x37, 0xAA, 0xA4, 0x20, 0x2D, 0x18, 0x1A, 0x2F,
+    0x21, 0x9F, 0x8E, 0x1B, 0x28, 0x15, 0x30, 0x31, 0x85, 0x02, 0xBC, 0x29,
+    0x4E, 0x36, 0x3C, 0x50, 0x0F, 0x14, 0x0B, 0x32, 0x4A, 0x2F, 0x34, 0x4F,
+    0x34, 0x1B, 0x82, 0x13, 0x28, 0x1B, 0x1A, 0x24, 0x13, 0x77, 0x14, 0x22,
+    0x17, 0x25, 0x28, 0x00, 0x00, 0x01, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0x97,
+    0x02, 0xC7, 0x00, 0x25, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17,
+    0x0E, 0x02, 0x01, 0x8E, 0x4D, 0x81, 0x5F, 0x34, 0x36, 0x62, 0x84, 0x4D,
+    0x32, 0x61, 0x51, 0x1D, 0x5E, 0x17, 0x34, 0x39, 0x20, 0x2B, 0x4B, 0x38,
+    0x21, 0x20, 0x3A, 0x51, 0x31, 0x20, 0x3C, 0x33, 0x14, 0x4A, 0x19, 0x51,
+    0x64, 0x0A, 0x35, 0x61, 0x85, 0x4F, 0x4D, 0x83, 0x61, 0x36, 0x1B, 0x34,
+    0x24, 0x68, 0x18, 0x23, 0x13, 0x20, 0x39, 0x51, 0x31, 0x32, 0x51, 0x39,
+    0x1F, 0x12, 0x20, 0x15, 0x75, 0x1B, 0x2C, 0x19, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0x97, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0x97, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x00, 0x9A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0x0A, 0x02, 0x97, 0x02, 0xC7, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x45, 0x00, 0x8C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0x0A, 0x02, 0x97, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x27, 0x03, 0x45, 0x00, 0x8C, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29,
+    0x00, 0xA4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0x97,
+    0x03, 0x8D, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C,
+    0x00, 0x99, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0x97,
+    0x03, 0x8F, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x26,
+    0x00, 0x9A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x02, 0xCF,
+    0x02, 0xBC, 0x00, 0x0C, 0x00, 0x1B, 0x00, 0x00, 0x73, 0x11, 0x21, 0x32,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27, 0x27, 0x33, 0x32, 0x3E,
+    0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x37, 0x5B, 0x01, 0x1F, 0x4D,
+    0x7D, 0x5B, 0x30, 0x30, 0x5A, 0x7E, 0x4D, 0x89, 0x10, 0x94, 0x2D, 0x48,
+    0x33, 0x1A, 0x1A, 0x33, 0x48, 0x2D, 0x97, 0x13, 0x02, 0xBC, 0x33, 0x5D,
+    0x80, 0x4E, 0x4D, 0x81, 0x5D, 0x33, 0x6D, 0x1A, 0x1F, 0x37, 0x50, 0x31,
+    0x31, 0x4F, 0x38, 0x1F, 0x18, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x05, 0x3A, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0xEC, 0x02, 0xCF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x05, 0x3A, 0x03, 0x8E, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0xEC, 0x02, 0xCF, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x03, 0x28,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x00, 0x02, 0xCF, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x01, 0x11, 0x21, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27,
+    0x27, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x37,
+    0x28, 0x01, 0x33, 0xFF, 0x00, 0x01, 0x1F, 0x4D, 0x7D, 0x5B, 0x30, 0x30,
+    0x5A, 0x7E, 0x4D, 0x89, 0x10, 0x94, 0x2D, 0x48, 0x33, 0x1A, 0x1A, 0x33,
+    0x48, 0x2D, 0x97, 0x13, 0x01, 0x27, 0x6E, 0x6E, 0xFE, 0xD9, 0x02, 0xBC,
+    0x33, 0x5D, 0x80, 0x4E, 0x4D, 0x81, 0x5D, 0x33, 0x6D, 0x1A, 0x1F, 0x37,
+    0x50, 0x31, 0x31, 0x4F, 0x38, 0x1F, 0x18, 0x00, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0xCF, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x00, 0x84, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0x00, 0x00, 0x02, 0xCF, 0x02, 0xBC, 0x06, 0x06, 0x00, 0x28, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26, 0x02, 0xCF, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x84, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x40, 0x02, 0xCF, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x03, 0x14, 0x00, 0x84, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x04, 0xDB, 0x02, 0xBC, 0x04, 0x26,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x01, 0xF2, 0x02, 0xFB, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x04, 0xDB, 0x03, 0x07, 0x04, 0x26,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x27, 0x01, 0xF2, 0x02, 0xFB, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xFD, 0x03, 0x0A, 0x00, 0x04, 0x00, 0x02, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x3B, 0x02, 0xBC, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x73, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15,
+    0x5B, 0x01, 0xD9, 0xFE, 0xBA, 0x01, 0x4D, 0xFE, 0x66, 0x01, 0x63, 0x02,
+    0xBC, 0x84, 0xFE, 0x4C, 0x84, 0x01, 0x25, 0x80, 0x80, 0x00, 0xFF, 0xFF,
+    0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x3B, 0x03, 0x91, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x32, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0x3B, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x31, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x0A, 0x02, 0x3B,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x03, 0x45,
+    0x43, 0x00, 0x00, 0x06, 0x03, 0x32, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x3B, 0x03, 0x8D, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x2C, 0x57, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0x7E, 0x04, 0x33, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2E, 0x00, 0x96, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26,
+    0x02, 0x3B, 0x03, 0x8D, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x0E, 0x44, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x57, 0x00, 0xFF, 0xFF,
+    0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B, 0x04, 0x35, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x2D, 0x72, 0x00, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x6A, 0x04, 0x37, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x30, 0x00, 0x8D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x3B, 0x04, 0x34, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x2F, 0x57, 0x00, 0xFF, 0xFF, 0x00, 0x45, 0x00, 0x00,
+    0x02, 0x3B, 0x03, 0xB8, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x41, 0x25, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23,
+    0x57, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B, 0x03, 0x8F,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x58, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26, 0x02, 0x3B, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x44, 0x00, 0xFF, 0xFF,
+    0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x56, 0x00, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x3B, 0x03, 0xCC, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x40, 0x57, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0x3B, 0x03, 0x91, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x42, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B,
+    0x03, 0x71, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C,
+    0x57, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B, 0x04, 0x59,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x03, 0x3C, 0x57, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0x62, 0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x5B,
+    0x00, 0x00, 0x02, 0x3B, 0x04, 0x59, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x3C, 0x57, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x56,
+    0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x30, 0x02, 0x3B, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0x03, 0x46, 0x00, 0xC6,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x3B, 0x03, 0x85,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0x57, 0x00,
+    0x00, 0x03, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x34, 0x02, 0xBC, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x03, 0x35,
+    0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x5B, 0x96, 0x51, 0x01, 0x6A, 0xFE,
+    0x96, 0x01, 0x94, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x16, 0x81, 0x81, 0x01,
+    0x1F, 0x87, 0x87, 0x00, 0x00, 0x01, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xDF,
+    0x02, 0xC7, 0x00, 0x2F, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35,
+    0x17, 0x23, 0x35, 0x21, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x9C,
+    0x51, 0x87, 0x62, 0x35, 0x37, 0x65, 0x88, 0x51, 0x38, 0x66, 0x54, 0x1C,
+    0x5D, 0x1A, 0x38, 0x3F, 0x21, 0x2F, 0x4F, 0x3C, 0x21, 0x23, 0x3D, 0x52,
+    0x2F, 0x22, 0x3B, 0x2D, 0x19, 0x14, 0xC8, 0x01, 0x44, 0x01, 0x03, 0x01,
+    0x31, 0x57, 0x76, 0x0A, 0x37, 0x62, 0x84, 0x4D, 0x4D, 0x83, 0x61, 0x36,
+    0x1E, 0x34, 0x22, 0x62, 0x19, 0x23, 0x13, 0x22, 0x3C, 0x52, 0x30, 0x2F,
+    0x53, 0x3D, 0x23, 0x14, 0x25, 0x32, 0x1C, 0x18, 0x1C, 0x7D, 0x0B, 0x20,
+    0x1F, 0x09, 0x44, 0x72, 0x52, 0x2D, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xDF, 0x03, 0x91, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x32, 0x00, 0x9F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xDF, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x31, 0x00, 0x9F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xDF, 0x03, 0x8D, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2C, 0x00, 0x9E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFE, 0xEB,
+    0x02, 0xDF, 0x02, 0xC7, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x44, 0x00, 0x8A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xDF, 0x03, 0x8F, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x26, 0x00, 0x9F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xDF, 0x03, 0x71, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x3C, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0xAA, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x61, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x03, 0x37, 0x21, 0x15,
+    0x02, 0x14, 0x96, 0xFD, 0xB1, 0x96, 0x5A, 0x01, 0x01, 0xC9, 0x02, 0xBC,
+    0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x19, 0x88, 0x88, 0x00, 0x04,
+    0x00, 0x29, 0x00, 0x00, 0x03, 0x18, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x0F,
+    0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x53, 0x35, 0x33, 0x17, 0x21, 0x37,
+    0x33, 0x15, 0x23, 0x27, 0x21, 0x07, 0x01, 0x11, 0x33, 0x11, 0x21, 0x11,
+    0x33, 0x11, 0x03, 0x37, 0x21, 0x15, 0x29, 0x64, 0x42, 0x01, 0x8A, 0x45,
+    0x7A, 0x76, 0x3D, 0xFE, 0x60, 0x3E, 0x01, 0xAC, 0x96, 0xFD, 0xB0, 0x96,
+    0x5A, 0x01, 0x01, 0xC9, 0x01, 0xDC, 0x7F, 0x0A, 0x0A, 0x7F, 0x0A, 0x0A,
+    0xFE, 0x24, 0x02, 0xBC, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x19,
+    0x88, 0x88, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x15, 0x02, 0xAA, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x13, 0x00, 0x89,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0xAA, 0x03, 0x8D,
+    0x06, 0x26, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0x89,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26, 0x02, 0xAA, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x4E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x89,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x49, 0x00, 0x00, 0x01, 0xC9, 0x02, 0xBC,
+    0x00, 0x0B, 0x00, 0x00, 0x73, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15,
+    0x23, 0x11, 0x33, 0x15, 0x49, 0x75, 0x75, 0x01, 0x80, 0x75, 0x75, 0x81,
+    0x01, 0xBA, 0x81, 0x81, 0xFE, 0x46, 0x81, 0x00, 0xFF, 0xFF, 0x00, 0x49,
+    0xFF, 0xF6, 0x04, 0x66, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x64, 0x02, 0x12, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x49,
+    0x00, 0x00, 0x01, 0xC9, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x29, 0x1A, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00,
+    0x01, 0xC9, 0x03, 0x91, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x32, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00, 0x01, 0xC9,
+    0x03, 0x8E, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31,
+    0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00, 0x01, 0xC9, 0x03, 0x8D,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x0E, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xC9, 0x03, 0xB8, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0xDD, 0x00, 0xFF, 0xFF,
+    0x00, 0x44, 0x00, 0x00, 0x01, 0xCE, 0x03, 0x91, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x44,
+    0x00, 0x00, 0x01, 0xCE, 0x04, 0x67, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x24, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00,
+    0x01, 0xC9, 0x03, 0x8F, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x26, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0x26, 0x01, 0xC9,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00, 0x01, 0xC9, 0x03, 0xA8,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x0E, 0x00,
+    0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00, 0x01, 0xC9, 0x03, 0xCC, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x0E, 0x00, 0xFF, 0xFF,
+    0x00, 0x49, 0x00, 0x00, 0x01, 0xC9, 0x03, 0x91, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x49,
+    0x00, 0x00, 0x01, 0xC9, 0x03, 0x71, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x3C, 0x0E, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0x30,
+    0x01, 0xC9, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x46, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0x00, 0x00, 0x01, 0xC9,
+    0x03, 0x85, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38,
+    0x0E, 0x00, 0x00, 0x01, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x54, 0x02, 0xBC,
+    0x00, 0x1A, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x27, 0x37, 0x1E, 0x03,
+    0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11,
+    0x14, 0x0E, 0x02, 0x01, 0x04, 0x26, 0x42, 0x36, 0x2C, 0x0F, 0x57, 0x11,
+    0x1D, 0x1B, 0x1C, 0x10, 0x1C, 0x2B, 0x17, 0x80, 0x01, 0x7F, 0x6C, 0x22,
+    0x3E, 0x53, 0x0A, 0x12, 0x20, 0x2F, 0x1D, 0x5B, 0x17, 0x1E, 0x13, 0x07,
+    0x1A, 0x2E, 0x1E, 0x01, 0x51, 0x85, 0x85, 0xFE, 0x9E, 0x32, 0x52, 0x3B,
+    0x20, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0x8D,
+    0x06, 0x26, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xA2,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x5B, 0x00, 0x00, 0x02, 0xD3, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x27, 0x01, 0x33,
+    0x01, 0x11, 0x33, 0x11, 0x21, 0x01, 0x37, 0x01, 0xCC, 0x20, 0x01, 0x62,
+    0xB6, 0xFD, 0x97, 0x96, 0x01, 0x30, 0xFE, 0xFA, 0x67, 0x01, 0x51, 0xCF,
+    0x88, 0x01, 0x65, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x5B, 0x5A,
+    0xFE, 0x4B, 0xFF, 0xFF, 0x00, 0x5B, 0xFE, 0xEB, 0x02, 0xD3, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x66, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x76, 0x00,
+    0x00, 0x01, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x2E, 0x02, 0xBC, 0x00, 0x05,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x21, 0x15, 0x5B, 0x96, 0x01, 0x3D,
+    0x02, 0xBC, 0xFD, 0xCB, 0x87, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0xF6,
+    0x04, 0xB2, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x64, 0x02, 0x5E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x34, 0x00, 0x00,
+    0x02, 0x2E, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x29, 0xB8, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x2E,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB,
+    0x00, 0xB5, 0x00, 0x09, 0xFF, 0xFF, 0x00, 0x5B, 0xFE, 0xEB, 0x02, 0x2E,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44,
+    0x35, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0x2E, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x02, 0x69, 0x01, 0x5A,
+    0x01, 0x36, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26, 0x02, 0x2E, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x35, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x32, 0x03, 0x51, 0x03, 0x18, 0x04, 0x26,
+    0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69, 0x02, 0x5E, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x40, 0x02, 0x2E, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x68, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14, 0x35, 0x00, 0x00, 0x02,
+    0x00, 0x07, 0x00, 0x00, 0x02, 0x46, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x09,
+    0x00, 0x00, 0x77, 0x27, 0x25, 0x17, 0x01, 0x11, 0x33, 0x11, 0x21, 0x15,
+    0x31, 0x2A, 0x01, 0x50, 0x2C, 0xFE, 0xF0, 0x96, 0x01, 0x3D, 0xF4, 0x6B,
+    0x95, 0x6F, 0xFE, 0x7B, 0x02, 0xBC, 0xFD, 0xCB, 0x87, 0x00, 0x00, 0x01,
+    0x00, 0x5B, 0x00, 0x00, 0x03, 0x0E, 0x02, 0xBC, 0x00, 0x15, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x13, 0x27, 0x01, 0x33, 0x11, 0x23, 0x35, 0x34, 0x36,
+    0x37, 0x17, 0x03, 0x23, 0x03, 0x37, 0x16, 0x16, 0x15, 0x15, 0x5B, 0x89,
+    0xFF, 0x5A, 0x01, 0x02, 0x83, 0x93, 0x09, 0x0B, 0x12, 0xCD, 0x42, 0xC9,
+    0x11, 0x0B, 0x09, 0x02, 0xBC, 0xFE, 0x61, 0x01, 0x01, 0x9E, 0xFD, 0x44,
+    0xF0, 0x5A, 0x90, 0x47, 0x2F, 0xFE, 0xC2, 0x01, 0x3C, 0x31, 0x43, 0x8D,
+    0x61, 0xF0, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26, 0x03, 0x0E, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x72, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xBB,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x5B, 0x00, 0x00, 0x02, 0xC7, 0x02, 0xBC,
+    0x00, 0x17, 0x00, 0x00, 0x73, 0x11, 0x33, 0x01, 0x23, 0x2E, 0x04, 0x35,
+    0x35, 0x33, 0x11, 0x23, 0x01, 0x17, 0x1E, 0x04, 0x15, 0x15, 0x5B, 0x86,
+    0x01, 0x83, 0x1C, 0x04, 0x06, 0x05, 0x03, 0x02, 0x93, 0x88, 0xFE, 0x75,
+    0x26, 0x05, 0x07, 0x05, 0x02, 0x01, 0x02, 0xBC, 0xFD, 0xF5, 0x1F, 0x3B,
+    0x3D, 0x41, 0x49, 0x2B, 0xBF, 0xFD, 0x44, 0x02, 0x10, 0x01, 0x34, 0x49,
+    0x36, 0x28, 0x24, 0x14, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0xF6,
+    0x05, 0x76, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x64, 0x03, 0x22, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0xC7, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x29, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0xC7, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x31, 0x00, 0x98, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFE, 0xEB,
+    0x02, 0xC7, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x44, 0x00, 0x98, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0xC7, 0x03, 0x8F, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x26, 0x00, 0x98, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26,
+    0x02, 0xC7, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0x98, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD4, 0xFF, 0x37,
+    0x02, 0xBC, 0x02, 0xBC, 0x00, 0x1D, 0x00, 0x00, 0x57, 0x27, 0x32, 0x36,
+    0x35, 0x11, 0x33, 0x01, 0x23, 0x2E, 0x03, 0x35, 0x35, 0x33, 0x11, 0x23,
+    0x01, 0x17, 0x1E, 0x04, 0x15, 0x15, 0x14, 0x06, 0x06, 0x0E, 0x3A, 0x3E,
+    0x3D, 0x87, 0x01, 0x82, 0x1B, 0x06, 0x07, 0x05, 0x02, 0x93, 0x89, 0xFE,
+    0x75, 0x26, 0x04, 0x07, 0x05, 0x03, 0x01, 0x32, 0x5F, 0xC9, 0x6E, 0x3C,
+    0x3B, 0x02, 0xA0, 0xFD, 0xF5, 0x26, 0x4A, 0x4F, 0x58, 0x35, 0xBF, 0xFD,
+    0x44, 0x02, 0x10, 0x01, 0x26, 0x42, 0x3C, 0x36, 0x32, 0x19, 0xF0, 0x41,
+    0x57, 0x2B, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x32, 0x04, 0x16, 0x03, 0x18,
+    0x04, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69, 0x03, 0x22,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x40, 0x02, 0xC7, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07, 0x03, 0x14, 0x00, 0x97,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0x00, 0x00, 0x02, 0xC7, 0x03, 0x85,
+    0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0x97,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x5B, 0xFF, 0x37, 0x02, 0xC7, 0x02, 0xBC,
+    0x00, 0x21, 0x00, 0x00, 0x45, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x17,
+    0x01, 0x37, 0x1E, 0x04, 0x15, 0x11, 0x23, 0x11, 0x33, 0x01, 0x07, 0x2E,
+    0x03, 0x35, 0x35, 0x33, 0x11, 0x14, 0x06, 0x06, 0x01, 0xF3, 0x3A, 0x1A,
+    0x2E, 0x22, 0x15, 0x08, 0xFE, 0x91, 0x0D, 0x02, 0x05, 0x04, 0x03, 0x02,
+    0x93, 0x86, 0x01, 0x75, 0x0F, 0x05, 0x07, 0x05, 0x02, 0x93, 0x33, 0x60,
+    0xC9, 0x6E, 0x0B, 0x17, 0x22, 0x18, 0x40, 0x42, 0x01, 0xE8, 0x0B, 0x1A,
+    0x34, 0x33, 0x2F, 0x27, 0x0E, 0xFE, 0xF3, 0x02, 0xBC, 0xFE, 0x08, 0x08,
+    0x26, 0x48, 0x4D, 0x54, 0x32, 0xBF, 0xFD, 0x35, 0x3D, 0x53, 0x2A, 0x00,
+    0x00, 0x02, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5, 0x02, 0xCA, 0x00, 0x13,
+    0x00, 0x27, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02,
+    0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02,
+    0x01, 0x92, 0x4E, 0x82, 0x61, 0x34, 0x34, 0x61, 0x82, 0x4D, 0x4E, 0x81,
+    0x61, 0x34, 0x34, 0x61, 0x81, 0x4E, 0x2D, 0x4A, 0x36, 0x1F, 0x1F, 0x36,
+    0x4A, 0x2D, 0x2C, 0x4A, 0x38, 0x1D, 0x1D, 0x38, 0x4A, 0x0A, 0x36, 0x61,
+    0x85, 0x4E, 0x4F, 0x84, 0x61, 0x36, 0x36, 0x62, 0x84, 0x4E, 0x4E, 0x84,
+    0x62, 0x36, 0x8E, 0x21, 0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x21,
+    0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x91, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x32, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x8E, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x8D, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2C, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x04, 0x33, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2E, 0x00, 0xD5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0x26, 0x02, 0xF5, 0x03, 0x8D, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x27, 0x03, 0x0E, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C,
+    0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5,
+    0x04, 0x35, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2D,
+    0x00, 0xB2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5,
+    0x04, 0x37, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x30,
+    0x00, 0xCD, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5,
+    0x04, 0x34, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2F,
+    0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5,
+    0x03, 0xB8, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41,
+    0x65, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x91,
+    0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0x97,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5, 0x04, 0x22,
+    0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x23, 0x00, 0x97,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x96, 0x00, 0xB1, 0xFF, 0xFF,
+    0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5, 0x04, 0x22, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x27, 0x03, 0x26, 0x00, 0x97, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x3C, 0x00, 0x96, 0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x26,
+    0x02, 0xF5, 0x02, 0xCA, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xF5, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x28, 0x00, 0x96, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xF5, 0x03, 0xCC, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x40, 0x00, 0x97, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2D, 0xFF, 0xF6,
+    0x02, 0xF5, 0x03, 0x36, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x14, 0x0E, 0x02, 0x07, 0x37, 0x1E,
+    0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E,
+    0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x01, 0x91, 0x4D,
+    0x82, 0x61, 0x34, 0x34, 0x61, 0x82, 0x4D, 0x17, 0x2A, 0x14, 0x0F, 0x1D,
+    0x0F, 0x1C, 0x27, 0x13, 0x73, 0x0F, 0x20, 0x39, 0x2A, 0x13, 0x2B, 0x3E,
+    0x21, 0x34, 0x61, 0x81, 0x4E, 0x2D, 0x4A, 0x36, 0x1F, 0x1F, 0x36, 0x4A,
+    0x2D, 0x2C, 0x4A, 0x38, 0x1D, 0x1D, 0x38, 0x4A, 0x0A, 0x36, 0x61, 0x85,
+    0x4E, 0x4F, 0x84, 0x61, 0x36, 0x05, 0x05, 0x03, 0x06, 0x1D, 0x38, 0x2A,
+    0x28, 0x46, 0x37, 0x22, 0x03, 0x17, 0x1F, 0x5A, 0x6C, 0x3E, 0x4E, 0x84,
+    0x62, 0x36, 0x8E, 0x21, 0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x21,
+    0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x91, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0x26, 0x02, 0xF5, 0x03, 0x36, 0x06, 0x26, 0x00, 0x91, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x0E, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0xA8, 0x06, 0x26, 0x00, 0x91, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x28, 0x00, 0x96, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0xCC, 0x06, 0x26, 0x00, 0x91, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x40, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x85, 0x06, 0x26, 0x00, 0x91, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x38, 0x00, 0x96, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0xBC, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2B, 0x00, 0xCE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x91, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x42, 0x00, 0x97, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x71, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x3C, 0x00, 0x96, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x04, 0x59, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x27, 0x03, 0x3C, 0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29,
+    0x00, 0xA2, 0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5,
+    0x04, 0x59, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x3C,
+    0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x96, 0x00, 0xB1,
+    0x00, 0x03, 0x00, 0x2D, 0xFF, 0x30, 0x02, 0xF5, 0x02, 0xCA, 0x00, 0x17,
+    0x00, 0x2B, 0x00, 0x3F, 0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x3E,
+    0x02, 0x37, 0x17, 0x0E, 0x03, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37,
+    0x17, 0x06, 0x06, 0x27, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33,
+    0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35,
+    0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x01,
+    0xEB, 0x30, 0x42, 0x1D, 0x32, 0x43, 0x27, 0x23, 0x19, 0x2A, 0x1F, 0x11,
+    0x10, 0x0E, 0x0A, 0x10, 0x08, 0x41, 0x0D, 0x41, 0x84, 0x4D, 0x82, 0x61,
+    0x34, 0x34, 0x61, 0x82, 0x4D, 0x4E, 0x81, 0x61, 0x34, 0x34, 0x61, 0x81,
+    0x4E, 0x2D, 0x4A, 0x36, 0x1F, 0x1F, 0x36, 0x4A, 0x2D, 0x2C, 0x4A, 0x38,
+    0x1D, 0x1D, 0x38, 0x4A, 0xD0, 0x3B, 0x32, 0x20, 0x36, 0x2E, 0x28, 0x13,
+    0x2E, 0x0F, 0x1E, 0x1E, 0x1F, 0x11, 0x10, 0x14, 0x0C, 0x0C, 0x2F, 0x1D,
+    0x2B, 0xC6, 0x36, 0x61, 0x85, 0x4E, 0x4F, 0x84, 0x61, 0x36, 0x36, 0x62,
+    0x84, 0x4E, 0x4E, 0x84, 0x62, 0x36, 0x8E, 0x21, 0x3B, 0x50, 0x30, 0x30,
+    0x50, 0x3B, 0x21, 0x21, 0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x00,
+    0x00, 0x03, 0x00, 0x2C, 0xFF, 0xDF, 0x02, 0xF5, 0x02, 0xE5, 0x00, 0x03,
+    0x00, 0x17, 0x00, 0x2B, 0x00, 0x00, 0x57, 0x27, 0x01, 0x17, 0x01, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x86, 0x3F, 0x02, 0x4D, 0x44, 0xFE,
+    0xB9, 0x4E, 0x82, 0x60, 0x35, 0x35, 0x60, 0x82, 0x4E, 0x4D, 0x82, 0x60,
+    0x35, 0x35, 0x60, 0x82, 0x4D, 0x2C, 0x4A, 0x37, 0x1E, 0x1E, 0x37, 0x4A,
+    0x2C, 0x2D, 0x4A, 0x37, 0x1E, 0x1E, 0x37, 0x4A, 0x21, 0x35, 0x02, 0xD1,
+    0x2F, 0xFD, 0x40, 0x36, 0x61, 0x85, 0x4E, 0x4F, 0x84, 0x61, 0x36, 0x36,
+    0x62, 0x84, 0x4E, 0x4E, 0x84, 0x62, 0x36, 0x8E, 0x21, 0x3B, 0x50, 0x30,
+    0x30, 0x50, 0x3B, 0x21, 0x21, 0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21,
+    0xFF, 0xFF, 0x00, 0x2C, 0xFF, 0xDF, 0x02, 0xF5, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0x9D, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x9E, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5, 0x03, 0x85, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0x96, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5, 0x04, 0x59, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x38, 0x00, 0x96, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0xA2, 0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x02, 0xF5, 0x04, 0x42, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x27, 0x03, 0x38, 0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23,
+    0x00, 0x97, 0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xF5,
+    0x04, 0x22, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x38,
+    0x00, 0x96, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x96, 0x00, 0xB1,
+    0x00, 0x02, 0x00, 0x2D, 0x00, 0x00, 0x03, 0xE6, 0x02, 0xBC, 0x00, 0x14,
+    0x00, 0x21, 0x00, 0x00, 0x61, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x21, 0x15, 0x01,
+    0x14, 0x1E, 0x02, 0x33, 0x33, 0x11, 0x23, 0x22, 0x0E, 0x02, 0x01, 0x77,
+    0x4C, 0x7A, 0x56, 0x2E, 0x31, 0x5C, 0x81, 0x50, 0x02, 0x5B, 0xFE, 0xB3,
+    0x01, 0x16, 0xFE, 0xEA, 0x01, 0x4D, 0xFC, 0xDF, 0x19, 0x32, 0x48, 0x2D,
+    0x81, 0x74, 0x31, 0x4C, 0x35, 0x1B, 0x32, 0x5D, 0x81, 0x4E, 0x4E, 0x80,
+    0x5E, 0x32, 0x84, 0x91, 0x80, 0xA3, 0x84, 0x01, 0x5E, 0x32, 0x50, 0x37,
+    0x1E, 0x01, 0xAE, 0x1E, 0x38, 0x4F, 0x00, 0x02, 0x00, 0x5B, 0x00, 0x00,
+    0x02, 0x62, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x17, 0x00, 0x00, 0x73, 0x11,
+    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x03,
+    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x5B, 0x01,
+    0x29, 0x3F, 0x64, 0x3B, 0x3B, 0x64, 0x3F, 0x93, 0x02, 0x84, 0x18, 0x26,
+    0x17, 0x17, 0x26, 0x18, 0x84, 0x02, 0xBC, 0x3B, 0x66, 0x40, 0x41, 0x68,
+    0x3D, 0xF5, 0x01, 0x7C, 0x19, 0x2A, 0x1B, 0x1B, 0x28, 0x18, 0x00, 0x02,
+    0x00, 0x5B, 0x00, 0x00, 0x02, 0x62, 0x02, 0xBC, 0x00, 0x0E, 0x00, 0x19,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x15, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x23, 0x23, 0x15, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x23, 0x5B, 0x96, 0x93, 0x3F, 0x64, 0x3B, 0x3B, 0x64,
+    0x3F, 0x93, 0x82, 0x18, 0x26, 0x17, 0x17, 0x26, 0x18, 0x82, 0x02, 0xBC,
+    0x74, 0x3B, 0x66, 0x40, 0x41, 0x69, 0x3D, 0x80, 0x01, 0x07, 0x19, 0x2A,
+    0x1B, 0x1B, 0x29, 0x17, 0x00, 0x03, 0x00, 0x2D, 0xFF, 0x92, 0x02, 0xF5,
+    0x02, 0xCA, 0x00, 0x03, 0x00, 0x17, 0x00, 0x2B, 0x00, 0x00, 0x45, 0x01,
+    0x37, 0x01, 0x25, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x34,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x02, 0x67,
+    0xFE, 0xF5, 0x71, 0x01, 0x08, 0xFE, 0xBC, 0x4D, 0x82, 0x61, 0x34, 0x34,
+    0x61, 0x82, 0x4D, 0x4E, 0x81, 0x61, 0x34, 0x34, 0x61, 0x81, 0x4E, 0x2D,
+    0x4A, 0x36, 0x1F, 0x1F, 0x36, 0x4A, 0x2D, 0x2C, 0x4A, 0x38, 0x1D, 0x1D,
+    0x38, 0x4A, 0x6E, 0x01, 0x66, 0x4E, 0xFE, 0x9D, 0x13, 0x36, 0x61, 0x85,
+    0x4E, 0x4F, 0x84, 0x61, 0x36, 0x36, 0x62, 0x84, 0x4E, 0x4E, 0x84, 0x62,
+    0x36, 0x8E, 0x21, 0x3B, 0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x21, 0x3B,
+    0x50, 0x30, 0x30, 0x50, 0x3B, 0x21, 0x00, 0x03, 0x00, 0x5B, 0xFF, 0xFF,
+    0x02, 0x96, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x1B, 0x00, 0x00,
+    0x73, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23,
+    0x15, 0x33, 0x03, 0x37, 0x13, 0x01, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x23, 0x5B, 0x01, 0x36, 0x41, 0x6A, 0x3D, 0x3D, 0x6A,
+    0x41, 0xA5, 0xFC, 0xB2, 0x9A, 0xC6, 0xFE, 0x56, 0x9E, 0x1B, 0x29, 0x16,
+    0x1A, 0x32, 0x21, 0x8B, 0x02, 0xBC, 0x3B, 0x64, 0x40, 0x3F, 0x67, 0x3C,
+    0xFB, 0x01, 0x3C, 0x19, 0xFE, 0xAA, 0x01, 0x76, 0x19, 0x2D, 0x1C, 0x1E,
+    0x2C, 0x19, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0xFF, 0x02, 0x96, 0x03, 0xA8,
+    0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x59, 0x00,
+    0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0xFF, 0x02, 0x96, 0x03, 0x8E, 0x06, 0x26,
+    0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x4E, 0x00, 0xFF, 0xFF,
+    0x00, 0x5B, 0xFE, 0xEB, 0x02, 0x96, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xA7,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x64, 0x00, 0xFF, 0xFF, 0x00, 0x3B,
+    0xFF, 0xFF, 0x02, 0x96, 0x03, 0xB8, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x41, 0x1C, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x26,
+    0x02, 0x96, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x64, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0xFF, 0x02, 0x96,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42,
+    0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x5B, 0xFF, 0x40, 0x02, 0x96, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14, 0x64, 0x00,
+    0x00, 0x01, 0x00, 0x1E, 0xFF, 0xF6, 0x02, 0x4A, 0x02, 0xCA, 0x00, 0x36,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E,
+    0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06,
+    0x01, 0x3E, 0x41, 0x6B, 0x53, 0x21, 0x5E, 0x31, 0x61, 0x39, 0x1F, 0x31,
+    0x1C, 0x0E, 0x1A, 0x24, 0x2C, 0x1A, 0x38, 0x54, 0x38, 0x1B, 0x28, 0x47,
+    0x5D, 0x34, 0x40, 0x60, 0x47, 0x18, 0x5F, 0x15, 0x31, 0x39, 0x1E, 0x21,
+    0x30, 0x1B, 0x12, 0x22, 0x30, 0x1D, 0x37, 0x58, 0x3F, 0x22, 0x44, 0x78,
+    0x0A, 0x20, 0x3E, 0x2C, 0x6B, 0x44, 0x31, 0x12, 0x1F, 0x16, 0x10, 0x1B,
+    0x15, 0x11, 0x0D, 0x04, 0x0D, 0x25, 0x37, 0x46, 0x2C, 0x2D, 0x4D, 0x38,
+    0x1E, 0x1C, 0x37, 0x27, 0x5C, 0x1C, 0x26, 0x13, 0x11, 0x21, 0x16, 0x12,
+    0x1C, 0x15, 0x10, 0x06, 0x0B, 0x24, 0x33, 0x45, 0x2B, 0x47, 0x64, 0x35,
+    0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0xF6, 0x02, 0x4A, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x5C, 0x00, 0xFF, 0xFF,
+    0x00, 0x1E, 0xFF, 0xF6, 0x02, 0x4A, 0x03, 0xB6, 0x06, 0x26, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x2A, 0x62, 0x00, 0xFF, 0xFF, 0x00, 0x1E,
+    0xFF, 0xF6, 0x02, 0x4A, 0x03, 0x8E, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x31, 0x52, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0xF6,
+    0x02, 0x4A, 0x04, 0x40, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x31, 0x52, 0x00, 0x00, 0x07, 0x03, 0x26, 0x00, 0x52, 0x00, 0xB1,
+    0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0x0A, 0x02, 0x4A, 0x02, 0xCA, 0x06, 0x26,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x45, 0x55, 0x00, 0xFF, 0xFF,
+    0x00, 0x1E, 0xFF, 0xF6, 0x02, 0x4A, 0x03, 0x8D, 0x06, 0x26, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x51, 0x00, 0xFF, 0xFF, 0x00, 0x1E,
+    0xFE, 0xEB, 0x02, 0x4A, 0x02, 0xCA, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x44, 0x56, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0xF6,
+    0x02, 0x4A, 0x03, 0x8F, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x26, 0x52, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0x26, 0x02, 0x4A,
+    0x02, 0xCA, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x56, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0x26, 0x02, 0x4A, 0x03, 0x8F,
+    0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x56, 0x00,
+    0x00, 0x06, 0x03, 0x26, 0x52, 0x00, 0x00, 0x01, 0x00, 0x5B, 0xFF, 0xF6,
+    0x02, 0xEF, 0x02, 0xD6, 0x00, 0x3B, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x26, 0x26, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x03, 0x23, 0x13, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x17, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x15,
+    0x14, 0x06, 0x06, 0x02, 0x03, 0x2A, 0x50, 0x41, 0x15, 0x54, 0x1A, 0x3D,
+    0x1D, 0x29, 0x2F, 0x17, 0x35, 0x2D, 0x2C, 0x34, 0x18, 0x20, 0x39, 0x4A,
+    0x2A, 0x34, 0x1F, 0x61, 0x2A, 0x2E, 0x48, 0x34, 0x1D, 0x01, 0x96, 0x01,
+    0x55, 0x99, 0x66, 0x41, 0x79, 0x36, 0x03, 0x39, 0x4C, 0x26, 0x15, 0x29,
+    0x1F, 0x31, 0x44, 0x25, 0x41, 0x6B, 0x0A, 0x16, 0x27, 0x18, 0x63, 0x1B,
+    0x21, 0x25, 0x1F, 0x14, 0x1F, 0x22, 0x18, 0x18, 0x2E, 0x35, 0x22, 0x25,
+    0x3C, 0x2E, 0x1B, 0x02, 0x26, 0x0B, 0x10, 0x24, 0x45, 0x62, 0x3F, 0xFE,
+    0xAA, 0x01, 0x5D, 0x71, 0xA9, 0x5E, 0x15, 0x17, 0x68, 0x07, 0x1F, 0x28,
+    0x18, 0x13, 0x1F, 0x1D, 0x0F, 0x16, 0x2F, 0x44, 0x37, 0x37, 0x5B, 0x36,
+    0x00, 0x01, 0x00, 0x2D, 0xFF, 0xF6, 0x02, 0xD9, 0x02, 0xC6, 0x00, 0x2A,
+    0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x27, 0x35, 0x21, 0x17, 0x21, 0x1E,
+    0x03, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06,
+    0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E,
+    0x02, 0x01, 0x83, 0x44, 0x79, 0x5D, 0x39, 0x03, 0x02, 0x7E, 0x09, 0xFE,
+    0x13, 0x09, 0x23, 0x32, 0x3E, 0x20, 0x2A, 0x46, 0x35, 0x1C, 0x1D, 0x36,
+    0x4B, 0x2E, 0x28, 0x42, 0x3B, 0x1D, 0x48, 0x29, 0x51, 0x5D, 0x3B, 0x47,
+    0x7D, 0x5F, 0x36, 0x35, 0x5F, 0x7B, 0x0A, 0x30, 0x58, 0x76, 0x45, 0x5D,
+    0x7C, 0x22, 0x39, 0x29, 0x17, 0x1F, 0x3A, 0x53, 0x34, 0x33, 0x52, 0x3A,
+    0x1F, 0x0F, 0x1F, 0x18, 0x6D, 0x22, 0x2C, 0x14, 0x38, 0x63, 0x82, 0x4B,
+    0x4B, 0x82, 0x63, 0x38, 0x00, 0x01, 0x00, 0x21, 0x00, 0x00, 0x02, 0x55,
+    0x02, 0xBC, 0x00, 0x07, 0x00, 0x00, 0x73, 0x11, 0x23, 0x35, 0x21, 0x15,
+    0x23, 0x11, 0xED, 0xCC, 0x02, 0x34, 0xD2, 0x02, 0x35, 0x87, 0x87, 0xFD,
+    0xCB, 0x00, 0x00, 0x02, 0x00, 0x21, 0x00, 0x00, 0x02, 0x55, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x03, 0x11,
+    0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0xA4, 0x01, 0x33, 0xEA, 0xCC, 0x02,
+    0x34, 0xD2, 0x01, 0x29, 0x6D, 0x6D, 0xFE, 0xD7, 0x02, 0x35, 0x87, 0x87,
+    0xFD, 0xCB, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00, 0x02, 0x55, 0x03, 0x8E,
+    0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x41, 0x00,
+    0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x0A, 0x02, 0x55, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x45, 0x40, 0x00, 0xFF, 0xFF,
+    0x00, 0x21, 0xFE, 0xEB, 0x02, 0x55, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x41, 0x00, 0xFF, 0xFF, 0x00, 0x21,
+    0xFF, 0x26, 0x02, 0x55, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x41, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x40,
+    0x02, 0x55, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0x40, 0x00, 0x00, 0x01, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0,
+    0x02, 0xBD, 0x00, 0x15, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x11,
+    0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33,
+    0x11, 0x14, 0x06, 0x06, 0x01, 0x7B, 0x55, 0x85, 0x4C, 0x97, 0x26, 0x41,
+    0x28, 0x29, 0x43, 0x27, 0x92, 0x4B, 0x86, 0x06, 0x47, 0x7D, 0x4F, 0x01,
+    0xB0, 0xFE, 0x59, 0x2A, 0x43, 0x28, 0x28, 0x43, 0x2A, 0x01, 0xA7, 0xFE,
+    0x50, 0x4F, 0x7D, 0x47, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0,
+    0x03, 0xA8, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29,
+    0x00, 0x8B, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x32,
+    0x00, 0x81, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0,
+    0x03, 0x8E, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31,
+    0x00, 0x81, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0,
+    0x03, 0x8D, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C,
+    0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0,
+    0x03, 0xB8, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41,
+    0x4F, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0x91,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0x26, 0x02, 0xA0, 0x02, 0xBD,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x81,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0xA8,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0xCC,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x55, 0xFF, 0xFA, 0x03, 0x0F, 0x03, 0x36,
+    0x00, 0x1E, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11,
+    0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x32, 0x36,
+    0x35, 0x33, 0x14, 0x06, 0x06, 0x07, 0x37, 0x11, 0x14, 0x06, 0x06, 0x01,
+    0x7B, 0x55, 0x85, 0x4C, 0x97, 0x26, 0x41, 0x28, 0x29, 0x43, 0x27, 0x36,
+    0x2F, 0x29, 0x73, 0x21, 0x44, 0x33, 0x29, 0x4B, 0x86, 0x06, 0x47, 0x7D,
+    0x4F, 0x01, 0xB0, 0xFE, 0x59, 0x2A, 0x43, 0x28, 0x28, 0x43, 0x2A, 0x01,
+    0xA7, 0x3F, 0x3A, 0x35, 0x58, 0x37, 0x07, 0x31, 0xFE, 0x71, 0x4F, 0x7D,
+    0x47, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x03, 0x0F, 0x03, 0xA8,
+    0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x8B,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0x26, 0x03, 0x0F, 0x03, 0x36,
+    0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x81,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x03, 0x0F, 0x03, 0xA8,
+    0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x03, 0x0F, 0x03, 0xCC,
+    0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x03, 0x0F, 0x03, 0x85,
+    0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0xBC,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2B, 0x00, 0xB8,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0x91,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x42, 0x00, 0x81,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0x71,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x04, 0x42,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x27, 0x03, 0x3C, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0x80, 0x00, 0xB1, 0x00, 0x02,
+    0x00, 0x55, 0xFF, 0x30, 0x02, 0xA0, 0x02, 0xBD, 0x00, 0x17, 0x00, 0x2D,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E,
+    0x03, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27,
+    0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x01, 0xC2, 0x30,
+    0x42, 0x1C, 0x33, 0x43, 0x26, 0x24, 0x19, 0x2A, 0x1F, 0x11, 0x10, 0x0E,
+    0x0A, 0x10, 0x08, 0x41, 0x0D, 0x42, 0x70, 0x55, 0x85, 0x4C, 0x97, 0x26,
+    0x41, 0x28, 0x29, 0x43, 0x27, 0x92, 0x4B, 0x86, 0xD0, 0x3B, 0x32, 0x20,
+    0x36, 0x2E, 0x28, 0x13, 0x2E, 0x0F, 0x1E, 0x1E, 0x1F, 0x11, 0x10, 0x14,
+    0x0C, 0x0C, 0x2F, 0x1D, 0x2B, 0xCA, 0x47, 0x7D, 0x4F, 0x01, 0xB0, 0xFE,
+    0x59, 0x2A, 0x43, 0x28, 0x28, 0x43, 0x2A, 0x01, 0xA7, 0xFE, 0x50, 0x4F,
+    0x7D, 0x47, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0x91,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x37, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x03, 0x85,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0x80,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFA, 0x02, 0xA0, 0x04, 0x59,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x27, 0x03, 0x38, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x8B, 0x00, 0xB1, 0x00, 0x01,
+    0x00, 0x0B, 0x00, 0x00, 0x02, 0xBE, 0x02, 0xBC, 0x00, 0x10, 0x00, 0x00,
+    0x61, 0x01, 0x33, 0x13, 0x1E, 0x03, 0x17, 0x07, 0x3E, 0x02, 0x37, 0x13,
+    0x33, 0x01, 0x01, 0x22, 0xFE, 0xE9, 0x9F, 0x92, 0x0C, 0x11, 0x0D, 0x0C,
+    0x06, 0x1D, 0x08, 0x0F, 0x15, 0x0F, 0x8A, 0x9E, 0xFE, 0xE7, 0x02, 0xBC,
+    0xFE, 0x85, 0x1F, 0x2F, 0x29, 0x27, 0x17, 0x01, 0x1F, 0x35, 0x3B, 0x27,
+    0x01, 0x7B, 0xFD, 0x44, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xD7,
+    0x02, 0xBC, 0x00, 0x22, 0x00, 0x00, 0x73, 0x03, 0x33, 0x13, 0x1E, 0x03,
+    0x17, 0x27, 0x3E, 0x02, 0x37, 0x13, 0x33, 0x13, 0x1E, 0x02, 0x17, 0x07,
+    0x3E, 0x04, 0x37, 0x13, 0x33, 0x03, 0x23, 0x03, 0x17, 0x03, 0xE0, 0xD5,
+    0x9A, 0x72, 0x07, 0x0B, 0x07, 0x05, 0x02, 0x18, 0x09, 0x0C, 0x0B, 0x08,
+    0x6E, 0x7C, 0x6C, 0x0C, 0x0F, 0x0A, 0x04, 0x15, 0x03, 0x03, 0x03, 0x04,
+    0x08, 0x08, 0x71, 0x98, 0xD7, 0x70, 0xAC, 0x10, 0xA1, 0x02, 0xBC, 0xFE,
+    0x79, 0x15, 0x31, 0x2D, 0x27, 0x0D, 0x01, 0x2A, 0x39, 0x2D, 0x17, 0x01,
+    0x21, 0xFE, 0xDF, 0x1E, 0x37, 0x33, 0x1A, 0x04, 0x15, 0x1F, 0x1A, 0x1B,
+    0x25, 0x19, 0x01, 0x85, 0xFD, 0x44, 0x01, 0x9E, 0x02, 0xFE, 0x64, 0x00,
+    0xFF, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xD7, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x01, 0x01, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xD7, 0x03, 0x8D, 0x06, 0x26,
+    0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xF6, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xD7, 0x03, 0x91, 0x06, 0x26,
+    0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0xF6, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xD7, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0xDC, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0xF6, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x02, 0xB3, 0x02, 0xBC, 0x00, 0x05,
+    0x00, 0x09, 0x00, 0x0D, 0x00, 0x00, 0x61, 0x03, 0x01, 0x33, 0x13, 0x01,
+    0x21, 0x01, 0x17, 0x03, 0x13, 0x27, 0x13, 0x33, 0x01, 0xFB, 0xD9, 0xFE,
+    0xEA, 0xB8, 0xD4, 0x01, 0x1B, 0xFD, 0x54, 0x01, 0x0B, 0x72, 0xCF, 0xF3,
+    0x71, 0xC4, 0xAE, 0x01, 0x3A, 0x01, 0x82, 0xFE, 0xCA, 0xFE, 0x7A, 0x01,
+    0x7D, 0x4F, 0xFE, 0xD2, 0x01, 0x45, 0x4C, 0x01, 0x2B, 0x00, 0x00, 0x01,
+    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x00,
+    0x61, 0x11, 0x17, 0x01, 0x33, 0x13, 0x27, 0x13, 0x33, 0x01, 0x37, 0x11,
+    0x01, 0x12, 0x07, 0xFE, 0xE5, 0xAD, 0xD8, 0x44, 0xC3, 0xA7, 0xFE, 0xF1,
+    0x0F, 0x01, 0x5D, 0x31, 0x01, 0x90, 0xFE, 0xCA, 0x03, 0x01, 0x33, 0xFE,
+    0x65, 0x44, 0xFE, 0x9B, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9,
+    0x03, 0xA8, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0x64, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9, 0x03, 0x8D,
+    0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x59, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9, 0x03, 0x91, 0x06, 0x26,
+    0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x59, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9, 0x03, 0x8F, 0x06, 0x26, 0x00, 0xE2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x5A, 0x00, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0x26, 0x02, 0xA9, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x5A, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x02, 0xA9, 0x03, 0xA8, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x28, 0x59, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9,
+    0x03, 0xCC, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40,
+    0x59, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9, 0x03, 0x71,
+    0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x59, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x02, 0xA9, 0x03, 0x85, 0x06, 0x26,
+    0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0x59, 0x00, 0x00, 0x01,
+    0x00, 0x3C, 0x00, 0x00, 0x02, 0x6A, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x00,
+    0x73, 0x35, 0x01, 0x17, 0x21, 0x35, 0x21, 0x15, 0x01, 0x27, 0x21, 0x15,
+    0x3C, 0x01, 0x7F, 0x2D, 0xFE, 0x6E, 0x02, 0x09, 0xFE, 0x83, 0x2E, 0x01,
+    0xB6, 0x66, 0x01, 0xFF, 0x34, 0x8B, 0x65, 0xFE, 0x00, 0x2F, 0x86, 0x00,
+    0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x6A, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x63, 0x00, 0xFF, 0xFF,
+    0x00, 0x3C, 0x00, 0x00, 0x02, 0x6A, 0x03, 0x8E, 0x06, 0x26, 0x00, 0xEC,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x3C,
+    0x00, 0x00, 0x02, 0x6A, 0x03, 0x8F, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x26, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0x26,
+    0x02, 0x6A, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x58, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x04, 0x66,
+    0x03, 0xA8, 0x04, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x26, 0x03, 0x29,
+    0x1A, 0x00, 0x00, 0x27, 0x00, 0x64, 0x02, 0x12, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x29, 0x02, 0xBF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5C, 0x00, 0x00,
+    0x00, 0xF2, 0x02, 0xBC, 0x00, 0x06, 0x00, 0x00, 0x73, 0x11, 0x33, 0x32,
+    0x32, 0x33, 0x11, 0x5C, 0x4B, 0x13, 0x26, 0x12, 0x02, 0xBC, 0xFD, 0x44,
+    0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0xF6, 0x03, 0x36, 0x02, 0xBC, 0x04, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x01, 0x4E, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x33, 0x00, 0x00, 0x01, 0x30, 0x03, 0xA8, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0xB8, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x00, 0x00, 0x01, 0x55, 0x03, 0x91, 0x06, 0x26, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x00, 0x00, 0x01, 0x57, 0x03, 0x8E, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x31, 0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x01, 0x55, 0x03, 0x8D, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x2C, 0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0x9A, 0x00, 0x00, 0x01, 0x50,
+    0x03, 0xB8, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x41,
+    0xFF, 0x7B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x01, 0x6C,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23,
+    0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x01, 0x6C, 0x04, 0x67,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x24, 0xAD, 0x00,
+    0xFF, 0xFF, 0x00, 0x50, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x8F, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0xAD, 0x00, 0xFF, 0xFF,
+    0x00, 0x4F, 0xFF, 0x26, 0x01, 0x00, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xAD, 0x00, 0xFF, 0xFF, 0x00, 0x27,
+    0x00, 0x00, 0x01, 0x25, 0x03, 0xA8, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x28, 0xAC, 0x00, 0xFF, 0xFF, 0x00, 0x34, 0x00, 0x00,
+    0x01, 0x19, 0x03, 0xCC, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x40, 0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x01, 0x55,
+    0x03, 0x91, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42,
+    0xAD, 0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x56, 0x03, 0x71,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0xAC, 0x00,
+    0xFF, 0xFF, 0x00, 0x1D, 0xFF, 0x30, 0x01, 0x07, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x46, 0xFF, 0x98, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xEE, 0x00, 0x00, 0x01, 0x60, 0x03, 0x85, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0xAC, 0x00, 0x00, 0x01,
+    0x00, 0x26, 0xFF, 0xF6, 0x01, 0xE8, 0x02, 0xBC, 0x00, 0x15, 0x00, 0x00,
+    0x57, 0x22, 0x2E, 0x02, 0x27, 0x37, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
+    0x35, 0x11, 0x33, 0x11, 0x14, 0x0E, 0x02, 0xFE, 0x26, 0x43, 0x36, 0x2A,
+    0x0F, 0x5B, 0x16, 0x23, 0x25, 0x16, 0x1C, 0x2B, 0x19, 0x93, 0x22, 0x3E,
+    0x56, 0x0A, 0x12, 0x20, 0x2C, 0x1B, 0x5C, 0x1E, 0x22, 0x0D, 0x19, 0x2F,
+    0x1E, 0x01, 0xD8, 0xFE, 0x19, 0x32, 0x52, 0x3B, 0x20, 0x00, 0xFF, 0xFF,
+    0x00, 0x26, 0xFF, 0xF6, 0x02, 0x4D, 0x03, 0x8D, 0x06, 0x26, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xA5, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x5B, 0xFF, 0xF6, 0x04, 0x46, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x02, 0x5E, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x5B, 0xFF, 0xF6, 0x05, 0x0A, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x03, 0x22, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x02, 0x1C, 0x00, 0x18, 0x00, 0x28,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x1E, 0x02, 0x17, 0x27, 0x35, 0x33, 0x11, 0x23, 0x35, 0x37, 0x0E, 0x03,
+    0x37, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x0D, 0x42, 0x6A, 0x3E, 0x3F, 0x6C, 0x45,
+    0x27, 0x41, 0x31, 0x22, 0x07, 0x1E, 0x8D, 0x8F, 0x20, 0x08, 0x24, 0x35,
+    0x42, 0x02, 0x28, 0x3C, 0x21, 0x21, 0x3C, 0x28, 0x27, 0x3B, 0x22, 0x22,
+    0x3B, 0x0A, 0x48, 0x7C, 0x50, 0x50, 0x7C, 0x46, 0x17, 0x28, 0x34, 0x1E,
+    0x05, 0x81, 0xFD, 0xEF, 0x7F, 0x03, 0x1C, 0x32, 0x27, 0x17, 0x7B, 0x26,
+    0x45, 0x2E, 0x2D, 0x44, 0x27, 0x27, 0x44, 0x2D, 0x2E, 0x45, 0x26, 0x00,
+    0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0x1C, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x4C, 0x04, 0xFF, 0xFF,
+    0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x02, 0xFF, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23,
+    0xFF, 0xF6, 0x02, 0x44, 0x03, 0xC5, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xEA, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0x26,
+    0x02, 0x44, 0x02, 0xFF, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x0E, 0x4C, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x4C, 0x04, 0xFF, 0xFF,
+    0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0xC5, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xEB, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23,
+    0xFF, 0xF6, 0x02, 0x44, 0x03, 0xD1, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xEC, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6,
+    0x02, 0x44, 0x03, 0xBB, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xED, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44,
+    0x03, 0x07, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0x03,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x4C, 0x04,
+    0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x7D, 0x03, 0xB8, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x02, 0xEE, 0x00, 0x8F, 0x00, 0x04,
+    0xFF, 0xFF, 0x00, 0x23, 0xFF, 0x26, 0x02, 0x44, 0x03, 0x03, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x4C, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44,
+    0x03, 0xB7, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF,
+    0x62, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x64, 0x03, 0xBB,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF0, 0x00, 0x84,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0xB5,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1, 0x4B, 0x04,
+    0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0x21, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0x0C, 0x04, 0xFF, 0xFF,
+    0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0x18, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x4C, 0x04, 0xFF, 0xFF, 0x00, 0x23,
+    0xFF, 0x26, 0x02, 0x44, 0x02, 0x1C, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x4C, 0x00, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6,
+    0x02, 0x44, 0x03, 0x1D, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF7, 0x38, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44,
+    0x03, 0x2E, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09,
+    0x4B, 0x04, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0x09,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B, 0x4C, 0x04,
+    0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x02, 0xDD, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x4C, 0x04, 0xFF, 0xFF,
+    0x00, 0x23, 0xFF, 0x31, 0x02, 0x48, 0x02, 0x1C, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x12, 0x00, 0xD9, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x03, 0x3E, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x4B, 0x04, 0xFF, 0xFF, 0x00, 0x23,
+    0xFF, 0xF6, 0x02, 0x44, 0x04, 0x22, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x4B, 0x04, 0x00, 0x07, 0x02, 0xF8, 0x00, 0x4C,
+    0x01, 0x0A, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0xF6, 0x02, 0x44, 0x02, 0xF8,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x4B, 0x04,
+    0x00, 0x02, 0x00, 0x23, 0xFF, 0xF6, 0x03, 0x63, 0x02, 0x1C, 0x00, 0x40,
+    0x00, 0x55, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x21, 0x07, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x1E, 0x02, 0x07, 0x07, 0x21, 0x22,
+    0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17,
+    0x0E, 0x02, 0x13, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x15, 0xD7, 0x34, 0x51, 0x2F,
+    0x1E, 0x3C, 0x59, 0x3B, 0x01, 0xD6, 0x0C, 0x01, 0x1E, 0x30, 0x1D, 0x2C,
+    0x3B, 0x1F, 0x2B, 0x4E, 0x33, 0x25, 0x3B, 0x22, 0x3F, 0x1D, 0x45, 0x49,
+    0x25, 0x56, 0x7E, 0x46, 0x27, 0x45, 0x5E, 0x37, 0x48, 0x6F, 0x3F, 0x01,
+    0x01, 0xFD, 0xAF, 0x18, 0x25, 0x1A, 0x0C, 0x11, 0x20, 0x14, 0x1E, 0x35,
+    0x2A, 0x0C, 0x31, 0x15, 0x44, 0x51, 0x68, 0x0E, 0x1A, 0x24, 0x15, 0x29,
+    0x3D, 0x1A, 0x55, 0x1A, 0x47, 0x55, 0x2F, 0x30, 0x4B, 0x37, 0x1C, 0x0A,
+    0x28, 0x47, 0x30, 0x29, 0x3E, 0x2A, 0x15, 0x0D, 0x15, 0x1C, 0x2B, 0x18,
+    0x21, 0x42, 0x2F, 0x2F, 0x46, 0x28, 0x15, 0x1C, 0x61, 0x19, 0x22, 0x12,
+    0x45, 0x7B, 0x4F, 0x3D, 0x66, 0x4B, 0x29, 0x01, 0x44, 0x77, 0x4C, 0x2F,
+    0x09, 0x13, 0x1A, 0x11, 0x12, 0x1B, 0x10, 0x14, 0x24, 0x17, 0x4D, 0x21,
+    0x31, 0x1B, 0x01, 0x05, 0x59, 0x13, 0x1D, 0x14, 0x0A, 0x1F, 0x23, 0x55,
+    0x20, 0x2E, 0x19, 0x15, 0x29, 0x3E, 0x2A, 0x77, 0xFF, 0xFF, 0x00, 0x23,
+    0xFF, 0xF6, 0x03, 0x63, 0x03, 0x1C, 0x06, 0x26, 0x01, 0x21, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xF8, 0x00, 0xCD, 0x00, 0x04, 0x00, 0x02, 0x00, 0x47,
+    0xFF, 0xF6, 0x02, 0x65, 0x02, 0xE4, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00,
+    0x45, 0x22, 0x2E, 0x02, 0x27, 0x37, 0x07, 0x23, 0x11, 0x33, 0x11, 0x27,
+    0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x78, 0x23, 0x42, 0x36, 0x24, 0x05, 0x20, 0x07, 0x86,
+    0x8F, 0x1C, 0x06, 0x22, 0x34, 0x3E, 0x21, 0x45, 0x6D, 0x3E, 0x3D, 0x6C,
+    0x66, 0x28, 0x3B, 0x22, 0x21, 0x3C, 0x28, 0x28, 0x3C, 0x21, 0x21, 0x3C,
+    0x0A, 0x14, 0x23, 0x2D, 0x18, 0x0C, 0x7C, 0x02, 0xE2, 0xFE, 0xB1, 0x0B,
+    0x18, 0x2D, 0x23, 0x14, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x79, 0x27,
+    0x45, 0x2E, 0x2D, 0x46, 0x26, 0x26, 0x46, 0x2D, 0x2E, 0x45, 0x27, 0x00,
+    0x00, 0x01, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x0B, 0x02, 0x1C, 0x00, 0x1F,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x01, 0x2D, 0x4C,
+    0x78, 0x45, 0x45, 0x78, 0x4C, 0x47, 0x76, 0x21, 0x4E, 0x0E, 0x2A, 0x31,
+    0x1A, 0x29, 0x3F, 0x24, 0x25, 0x40, 0x28, 0x1A, 0x2E, 0x29, 0x11, 0x4D,
+    0x21, 0x79, 0x0A, 0x48, 0x7C, 0x4F, 0x4F, 0x7C, 0x48, 0x34, 0x2E, 0x5E,
+    0x13, 0x1F, 0x12, 0x27, 0x44, 0x2C, 0x2A, 0x44, 0x28, 0x0E, 0x1E, 0x15,
+    0x5E, 0x2B, 0x35, 0x00, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x0B,
+    0x03, 0x1C, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x33, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x0B, 0x03, 0x07,
+    0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x33, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x0A, 0x02, 0x0B, 0x02, 0x1C, 0x06, 0x26,
+    0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0x33, 0x00, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0x0A, 0x02, 0x0B, 0x03, 0x1C, 0x06, 0x26, 0x01, 0x24,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x11, 0x33, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x33, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x0B, 0x03, 0x03,
+    0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x33, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x0B, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0x24, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x33, 0x04, 0x00, 0x02,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x46, 0x02, 0xE4, 0x00, 0x18, 0x00, 0x28,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x1E, 0x02, 0x17, 0x07, 0x11, 0x33, 0x11, 0x23, 0x27, 0x17, 0x0E, 0x03,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x16, 0x46, 0x6D, 0x3F, 0x3F, 0x6D, 0x46,
+    0x25, 0x45, 0x37, 0x22, 0x02, 0x24, 0x8F, 0x87, 0x06, 0x1C, 0x02, 0x20,
+    0x35, 0x43, 0x05, 0x28, 0x3C, 0x22, 0x22, 0x3C, 0x28, 0x28, 0x3B, 0x21,
+    0x21, 0x3B, 0x0A, 0x47, 0x7B, 0x51, 0x4F, 0x7D, 0x47, 0x17, 0x28, 0x31,
+    0x1A, 0x07, 0x01, 0x59, 0xFD, 0x1C, 0x7A, 0x03, 0x19, 0x2E, 0x25, 0x15,
+    0x76, 0x28, 0x46, 0x2F, 0x2E, 0x46, 0x28, 0x28, 0x46, 0x2E, 0x2F, 0x46,
+    0x28, 0x00, 0x00, 0x03, 0x00, 0x24, 0xFF, 0xF9, 0x02, 0x29, 0x02, 0xE8,
+    0x00, 0x1E, 0x00, 0x2E, 0x00, 0x36, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x27, 0x2E, 0x04,
+    0x27, 0x37, 0x1E, 0x04, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x03, 0x27, 0x3F, 0x02, 0x17, 0x07, 0x07, 0x01, 0x26, 0x4A, 0x75, 0x43,
+    0x28, 0x45, 0x59, 0x31, 0x32, 0x4F, 0x36, 0x0A, 0x51, 0x02, 0x13, 0x22,
+    0x34, 0x48, 0x2F, 0x2E, 0x3E, 0x69, 0x53, 0x3A, 0x1E, 0x41, 0x75, 0x4C,
+    0x23, 0x3A, 0x21, 0x21, 0x3A, 0x23, 0x24, 0x39, 0x22, 0x22, 0x39, 0x6B,
+    0x0D, 0x9B, 0x38, 0x92, 0x12, 0x71, 0x2A, 0x07, 0x47, 0x78, 0x4A, 0x35,
+    0x5F, 0x49, 0x29, 0x2A, 0x4D, 0x35, 0x1F, 0x2C, 0x49, 0x3A, 0x2E, 0x24,
+    0x0E, 0x5E, 0x0F, 0x39, 0x52, 0x69, 0x7E, 0x49, 0x57, 0x84, 0x4A, 0x7B,
+    0x27, 0x42, 0x29, 0x28, 0x40, 0x27, 0x26, 0x40, 0x29, 0x29, 0x42, 0x27,
+    0x01, 0x95, 0x41, 0x27, 0x19, 0x21, 0x42, 0x1A, 0x16, 0x00, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x03, 0x2C, 0x02, 0xE4, 0x04, 0x26, 0x01, 0x2B,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x01, 0xDA, 0x00, 0x31, 0x00, 0x03,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x80, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x1C,
+    0x00, 0x2C, 0x00, 0x00, 0x41, 0x35, 0x21, 0x15, 0x01, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x07, 0x11, 0x33,
+    0x11, 0x23, 0x27, 0x17, 0x0E, 0x03, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x4D,
+    0x01, 0x33, 0xFE, 0x96, 0x46, 0x6D, 0x3F, 0x3F, 0x6D, 0x46, 0x25, 0x45,
+    0x37, 0x22, 0x02, 0x24, 0x8F, 0x87, 0x06, 0x1C, 0x02, 0x20, 0x35, 0x43,
+    0x05, 0x28, 0x3C, 0x22, 0x22, 0x3C, 0x28, 0x28, 0x3B, 0x21, 0x21, 0x3B,
+    0x02, 0x43, 0x6E, 0x6E, 0xFD, 0xB3, 0x47, 0x7B, 0x51, 0x4F, 0x7D, 0x47,
+    0x17, 0x28, 0x31, 0x1A, 0x07, 0x01, 0x59, 0xFD, 0x1C, 0x7A, 0x03, 0x19,
+    0x2E, 0x25, 0x15, 0x76, 0x28, 0x46, 0x2F, 0x2E, 0x46, 0x28, 0x28, 0x46,
+    0x2E, 0x2F, 0x46, 0x28, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x26, 0x02, 0x46,
+    0x02, 0xE4, 0x06, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x4A, 0x00, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x40, 0x02, 0x46, 0x02, 0xE4,
+    0x06, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14, 0x49, 0x00,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x04, 0x67, 0x03, 0x07, 0x04, 0x26,
+    0x01, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x01, 0xF2, 0x02, 0x88, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xFD, 0x02, 0x96, 0x00, 0x04, 0x00, 0x01, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x2A, 0x02, 0x1D, 0x00, 0x27, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x07,
+    0x21, 0x27, 0x21, 0x07, 0x35, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15,
+    0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x42,
+    0x56, 0x81, 0x47, 0x28, 0x48, 0x63, 0x3A, 0x36, 0x5C, 0x43, 0x24, 0x02,
+    0x01, 0xFE, 0x57, 0x17, 0x01, 0x4B, 0x10, 0x02, 0x1F, 0x30, 0x1E, 0x2C,
+    0x3D, 0x20, 0x29, 0x4B, 0x33, 0x23, 0x3A, 0x21, 0x44, 0x1D, 0x46, 0x4A,
+    0x0A, 0x46, 0x7A, 0x4F, 0x3E, 0x66, 0x4B, 0x29, 0x28, 0x47, 0x61, 0x38,
+    0x2C, 0x57, 0x12, 0x16, 0x1B, 0x2B, 0x19, 0x22, 0x42, 0x2F, 0x30, 0x46,
+    0x27, 0x16, 0x1B, 0x5F, 0x1A, 0x23, 0x12, 0x00, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x2A, 0x03, 0x1C, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6,
+    0x02, 0x2A, 0x02, 0xFF, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFF, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A,
+    0x03, 0x07, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x0A, 0x02, 0x2A, 0x02, 0xFF,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x26, 0x03, 0x11, 0x47, 0x00,
+    0x00, 0x06, 0x02, 0xFF, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6,
+    0x02, 0x2A, 0x03, 0x03, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x69,
+    0x03, 0xB8, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEE,
+    0x7B, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x26, 0x02, 0x2A, 0x03, 0x03,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x48, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6,
+    0x02, 0x2A, 0x03, 0xB7, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEF, 0x4D, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x4F,
+    0x03, 0xBB, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF0,
+    0x70, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A, 0x03, 0xB5,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1, 0x36, 0x04,
+    0xFF, 0xFF, 0x00, 0x17, 0xFF, 0xF6, 0x02, 0x2A, 0x03, 0x21, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0xF7, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A, 0x03, 0x18, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x2A, 0x03, 0x18, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF5, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x26,
+    0x02, 0x2A, 0x02, 0x1D, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x48, 0x00, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A,
+    0x03, 0x1D, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7,
+    0x23, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A, 0x03, 0x2E,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x37, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A, 0x03, 0x09, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B, 0x37, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A, 0x02, 0xDD, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x2A, 0x03, 0xC6, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x08, 0x37, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6,
+    0x02, 0x2A, 0x03, 0xC6, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x07, 0x37, 0x04, 0x00, 0x02, 0x00, 0x24, 0xFF, 0x34, 0x02, 0x2A,
+    0x02, 0x1D, 0x00, 0x15, 0x00, 0x3D, 0x00, 0x00, 0x45, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x33, 0x32,
+    0x36, 0x37, 0x17, 0x0E, 0x02, 0x27, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E,
+    0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x07, 0x21, 0x27, 0x21, 0x07, 0x35,
+    0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x82, 0x36, 0x3C, 0x33, 0x5A, 0x39,
+    0x1A, 0x3B, 0x3D, 0x12, 0x0E, 0x0C, 0x10, 0x09, 0x41, 0x0A, 0x23, 0x31,
+    0x5E, 0x56, 0x81, 0x47, 0x28, 0x48, 0x63, 0x3A, 0x36, 0x5C, 0x43, 0x24,
+    0x02, 0x01, 0xFE, 0x57, 0x17, 0x01, 0x4B, 0x10, 0x02, 0x1F, 0x30, 0x1E,
+    0x2C, 0x3D, 0x20, 0x29, 0x4B, 0x33, 0x23, 0x3A, 0x21, 0x44, 0x1D, 0x46,
+    0x4A, 0xCC, 0x3E, 0x2B, 0x2A, 0x40, 0x36, 0x1A, 0x2C, 0x20, 0x37, 0x1D,
+    0x10, 0x14, 0x0D, 0x0C, 0x30, 0x11, 0x22, 0x15, 0xC2, 0x46, 0x7A, 0x4F,
+    0x3E, 0x66, 0x4B, 0x29, 0x28, 0x47, 0x61, 0x38, 0x2C, 0x57, 0x12, 0x16,
+    0x1B, 0x2B, 0x19, 0x22, 0x42, 0x2F, 0x30, 0x46, 0x27, 0x16, 0x1B, 0x5F,
+    0x1A, 0x23, 0x12, 0x00, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x2A,
+    0x02, 0xF8, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01,
+    0x37, 0x04, 0x00, 0x01, 0x00, 0x22, 0xFF, 0xF4, 0x02, 0x26, 0x02, 0x1B,
+    0x00, 0x26, 0x00, 0x00, 0x45, 0x2E, 0x02, 0x35, 0x37, 0x21, 0x17, 0x21,
+    0x37, 0x15, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x0E, 0x02, 0x01, 0x19, 0x48, 0x70, 0x3F, 0x01, 0x01, 0xA9, 0x17,
+    0xFE, 0xB5, 0x10, 0x03, 0x1D, 0x31, 0x1E, 0x2D, 0x3D, 0x1F, 0x29, 0x4A,
+    0x34, 0x23, 0x3A, 0x21, 0x44, 0x1E, 0x45, 0x4A, 0x24, 0x57, 0x80, 0x47,
+    0x28, 0x48, 0x62, 0x0C, 0x01, 0x44, 0x78, 0x4B, 0x2C, 0x57, 0x12, 0x16,
+    0x1B, 0x2C, 0x18, 0x22, 0x42, 0x2F, 0x30, 0x46, 0x27, 0x16, 0x1B, 0x5F,
+    0x1A, 0x23, 0x12, 0x46, 0x7A, 0x4F, 0x3E, 0x66, 0x4B, 0x29, 0x00, 0x02,
+    0x00, 0x21, 0x00, 0x00, 0x01, 0x94, 0x02, 0xE5, 0x00, 0x14, 0x00, 0x18,
+    0x00, 0x00, 0x73, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11, 0x23, 0x22, 0x22, 0x03,
+    0x35, 0x21, 0x15, 0x70, 0x2C, 0x4D, 0x34, 0x23, 0x3E, 0x16, 0x2A, 0x0D,
+    0x1B, 0x0B, 0x13, 0x19, 0x0C, 0x47, 0x17, 0x24, 0x5C, 0x01, 0x50, 0x02,
+    0x36, 0x31, 0x50, 0x2E, 0x17, 0x13, 0x69, 0x08, 0x0B, 0x0D, 0x19, 0x13,
+    0xFD, 0xD4, 0x01, 0x8C, 0x78, 0x78, 0x00, 0x02, 0x00, 0x24, 0xFF, 0x1A,
+    0x02, 0x51, 0x02, 0x1C, 0x00, 0x28, 0x00, 0x38, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x27, 0x37, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x35, 0x17,
+    0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x1E, 0x03, 0x17, 0x07, 0x37, 0x33, 0x11, 0x14, 0x0E, 0x02, 0x03, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x38, 0x3F, 0x7A, 0x27, 0x33, 0x14, 0x34, 0x39, 0x1E,
+    0x34, 0x43, 0x22, 0x18, 0x06, 0x37, 0x51, 0x2C, 0x49, 0x72, 0x42, 0x41,
+    0x71, 0x48, 0x1E, 0x37, 0x2F, 0x25, 0x18, 0x03, 0x1D, 0x04, 0x88, 0x26,
+    0x49, 0x69, 0x3D, 0x2A, 0x3F, 0x22, 0x22, 0x3F, 0x2A, 0x29, 0x3E, 0x23,
+    0x23, 0x3E, 0xE6, 0x25, 0x1E, 0x65, 0x0E, 0x16, 0x0C, 0x20, 0x40, 0x30,
+    0x5C, 0x05, 0x21, 0x37, 0x21, 0x44, 0x78, 0x4F, 0x4F, 0x7B, 0x47, 0x0E,
+    0x19, 0x1F, 0x24, 0x12, 0x08, 0x79, 0xFE, 0x17, 0x41, 0x64, 0x45, 0x24,
+    0x01, 0x58, 0x26, 0x44, 0x2E, 0x2D, 0x45, 0x26, 0x27, 0x45, 0x2C, 0x2D,
+    0x45, 0x26, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x1A, 0x02, 0x51, 0x02, 0xFF,
+    0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x52, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x1A, 0x02, 0x51, 0x03, 0x07, 0x06, 0x26,
+    0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x52, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0x1A, 0x02, 0x51, 0x03, 0x03, 0x06, 0x26, 0x01, 0x4B,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x52, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0x1A, 0x02, 0x51, 0x03, 0x43, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0C, 0x52, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x1A,
+    0x02, 0x51, 0x03, 0x18, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0x52, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x1A, 0x02, 0x51,
+    0x02, 0xDD, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05,
+    0x52, 0x04, 0x00, 0x01, 0x00, 0x47, 0x00, 0x00, 0x02, 0x2D, 0x02, 0xE4,
+    0x00, 0x1C, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x07, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x07, 0x22,
+    0x0E, 0x02, 0x15, 0x11, 0x23, 0x22, 0x22, 0x47, 0x8C, 0x1C, 0x0B, 0x39,
+    0x50, 0x2C, 0x3C, 0x51, 0x29, 0x8E, 0x14, 0x29, 0x1E, 0x18, 0x29, 0x1D,
+    0x11, 0x46, 0x17, 0x24, 0x02, 0xE4, 0xFE, 0xC1, 0x0C, 0x24, 0x3B, 0x24,
+    0x30, 0x61, 0x47, 0xFE, 0xBC, 0x01, 0x39, 0x24, 0x30, 0x16, 0x01, 0x0F,
+    0x1C, 0x24, 0x15, 0xFE, 0xC2, 0x00, 0x00, 0x02, 0x00, 0x0D, 0x00, 0x00,
+    0x02, 0x2D, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x53, 0x35,
+    0x21, 0x15, 0x03, 0x11, 0x33, 0x11, 0x07, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x07, 0x22, 0x0E, 0x02,
+    0x15, 0x11, 0x23, 0x22, 0x22, 0x0D, 0x01, 0x33, 0xF9, 0x8C, 0x1C, 0x0B,
+    0x39, 0x50, 0x2C, 0x3C, 0x51, 0x29, 0x8E, 0x14, 0x29, 0x1E, 0x18, 0x29,
+    0x1D, 0x11, 0x46, 0x17, 0x24, 0x02, 0x47, 0x6D, 0x6D, 0xFD, 0xB9, 0x02,
+    0xE4, 0xFE, 0xC1, 0x0C, 0x24, 0x3B, 0x24, 0x30, 0x61, 0x47, 0xFE, 0xBC,
+    0x01, 0x39, 0x24, 0x30, 0x16, 0x01, 0x0F, 0x1C, 0x24, 0x15, 0xFE, 0xC2,
+    0xFF, 0xFF, 0x00, 0x47, 0xFF, 0x15, 0x02, 0x2D, 0x02, 0xE4, 0x06, 0x26,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x06, 0x03, 0x13, 0x3E, 0x00, 0xFF, 0xFF,
+    0x00, 0x47, 0x00, 0x00, 0x02, 0x2D, 0x03, 0xB5, 0x06, 0x26, 0x01, 0x52,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x3D, 0x28, 0xFF, 0xFF, 0x00, 0x47,
+    0xFF, 0x26, 0x02, 0x2D, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x52, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x3E, 0x00, 0x00, 0x02, 0x00, 0x42, 0x00, 0x00,
+    0x00, 0xF0, 0x03, 0x18, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x11,
+    0x33, 0x11, 0x03, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x53, 0x8E, 0x48, 0x29, 0x2E, 0x2F, 0x28, 0x29, 0x2E, 0x2F,
+    0x02, 0x11, 0xFD, 0xEF, 0x02, 0x7D, 0x29, 0x25, 0x22, 0x2B, 0x29, 0x24,
+    0x22, 0x2C, 0x00, 0x01, 0x00, 0x42, 0x00, 0x00, 0x00, 0xD0, 0x02, 0x11,
+    0x00, 0x03, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x42, 0x8E, 0x02, 0x11,
+    0xFD, 0xEF, 0xFF, 0xFF, 0x00, 0x11, 0x00, 0x00, 0x01, 0x00, 0x03, 0x1C,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF8, 0xFF, 0x8E,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0x01, 0x36, 0x02, 0xFF,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFF, 0xFF, 0x8E,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xD9, 0x00, 0x00, 0x01, 0x37, 0x03, 0x07,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFD, 0xFF, 0x8E,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x01, 0x3D, 0x03, 0x03,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFC, 0xFF, 0x8E,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x01, 0x23, 0x03, 0x21,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0A, 0xFF, 0x4E,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x01, 0x4B, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF2, 0xFF, 0x8E,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x01, 0x4C, 0x03, 0xDD,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF3, 0xFF, 0x8F,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0x31, 0x00, 0x00, 0x00, 0xDF, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF5, 0xFF, 0x8E,
+    0x00, 0x04, 0xFF, 0xFF, 0x00, 0x41, 0xFF, 0x26, 0x00, 0xF1, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0x57, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x9F, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xEC, 0x03, 0x1D, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF7, 0xFF, 0x7A, 0x00, 0x04,
+    0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x00, 0xFA, 0x03, 0x2E, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x09, 0xFF, 0x8E, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xDB, 0x00, 0x00, 0x01, 0x36, 0x03, 0x09, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0B, 0xFF, 0x8E, 0x00, 0x04,
+    0xFF, 0xFF, 0x00, 0x42, 0xFF, 0x32, 0x02, 0x26, 0x03, 0x18, 0x04, 0x26,
+    0x01, 0x57, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69, 0x01, 0x32, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x01, 0x28, 0x02, 0xDD, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0xFF, 0x8E, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x31, 0x00, 0xE2, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x27, 0x02, 0xF5, 0xFF, 0x8E, 0x00, 0x04,
+    0x00, 0x07, 0x03, 0x12, 0xFF, 0x73, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD9,
+    0x00, 0x00, 0x01, 0x37, 0x02, 0xF8, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x01, 0xFF, 0x8E, 0x00, 0x04, 0x00, 0x02, 0xFF, 0xDD,
+    0xFF, 0x32, 0x00, 0xF4, 0x03, 0x18, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00,
+    0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06,
+    0x13, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x12, 0x35, 0x2B, 0x34, 0x17, 0x8E, 0x31, 0x5C, 0x49, 0x29, 0x2E, 0x2F,
+    0x28, 0x29, 0x2E, 0x2F, 0xCE, 0x6E, 0x18, 0x37, 0x2D, 0x01, 0xF5, 0xFD,
+    0xE9, 0x41, 0x59, 0x2E, 0x03, 0x4B, 0x29, 0x25, 0x22, 0x2B, 0x29, 0x24,
+    0x22, 0x2C, 0x00, 0x01, 0xFF, 0xDC, 0xFF, 0x32, 0x00, 0xE1, 0x02, 0x11,
+    0x00, 0x0B, 0x00, 0x00, 0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33,
+    0x11, 0x14, 0x06, 0x06, 0x12, 0x36, 0x2C, 0x33, 0x18, 0x8E, 0x32, 0x5C,
+    0xCE, 0x6E, 0x18, 0x37, 0x2D, 0x01, 0xF5, 0xFD, 0xE9, 0x41, 0x59, 0x2E,
+    0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0x32, 0x01, 0x50, 0x03, 0x03, 0x06, 0x26,
+    0x01, 0x6A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0xA2, 0x04, 0x00, 0x03,
+    0x00, 0x47, 0x00, 0x00, 0x02, 0x59, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x77, 0x27, 0x37, 0x33, 0x01, 0x11, 0x33, 0x11,
+    0x33, 0x27, 0x37, 0x01, 0xCE, 0x2A, 0xFA, 0xBB, 0xFD, 0xEE, 0x8E, 0xD8,
+    0xBE, 0x64, 0x01, 0x05, 0x9F, 0x75, 0xFD, 0xFD, 0xEF, 0x02, 0xE4, 0xFD,
+    0x1C, 0xEF, 0x50, 0xFE, 0xC1, 0x00, 0xFF, 0xFF, 0x00, 0x47, 0xFE, 0xEB,
+    0x02, 0x59, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x10, 0x35, 0x00, 0x00, 0x03, 0x00, 0x47, 0xFF, 0xFF, 0x02, 0x4B,
+    0x02, 0x11, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x27,
+    0x13, 0x33, 0x01, 0x11, 0x33, 0x11, 0x33, 0x03, 0x37, 0x13, 0xCA, 0x2A,
+    0xFA, 0xB1, 0xFD, 0xFC, 0x8A, 0xD2, 0xB8, 0x62, 0xFB, 0x8D, 0x6F, 0x01,
+    0x15, 0xFD, 0xEF, 0x02, 0x11, 0xFD, 0xEF, 0x01, 0x08, 0x44, 0xFE, 0xB3,
+    0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x00, 0xD6, 0x02, 0xE4, 0x00, 0x03,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x48, 0x8E, 0x02, 0xE4, 0xFD, 0x1C,
+    0xFF, 0xFF, 0x00, 0x1C, 0x00, 0x00, 0x01, 0x19, 0x03, 0xD0, 0x06, 0x26,
+    0x01, 0x6F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0xA0, 0x28, 0xFF, 0xFF,
+    0x00, 0x48, 0x00, 0x00, 0x01, 0xC4, 0x02, 0xE4, 0x04, 0x26, 0x01, 0x6F,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFB, 0x72, 0x31, 0xFF, 0xFF, 0x00, 0x38,
+    0xFE, 0xEB, 0x00, 0xE8, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x10, 0x96, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0x00, 0x00,
+    0x01, 0xB3, 0x02, 0xE4, 0x04, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0x69, 0x00, 0xE6, 0x01, 0x36, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0x26,
+    0x00, 0xE8, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x96, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0xFF, 0x32, 0x02, 0x04,
+    0x03, 0x18, 0x04, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x01, 0x11, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x40, 0x01, 0x24,
+    0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14,
+    0x95, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0x53, 0x02, 0xE4,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x25, 0x17, 0x03, 0x11,
+    0x33, 0x11, 0x2B, 0x2D, 0x01, 0x27, 0x2E, 0xF3, 0x8E, 0x01, 0x0A, 0x6E,
+    0x81, 0x6C, 0xFE, 0x73, 0x02, 0xE4, 0xFD, 0x1C, 0x00, 0x01, 0x00, 0x46,
+    0x00, 0x00, 0x03, 0x75, 0x02, 0x1B, 0x00, 0x31, 0x00, 0x00, 0x73, 0x11,
+    0x33, 0x17, 0x07, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x17, 0x27, 0x37,
+    0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26,
+    0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x46, 0x89, 0x03, 0x15, 0x0B, 0x25,
+    0x30, 0x36, 0x1B, 0x29, 0x42, 0x2E, 0x0D, 0x16, 0x07, 0x0D, 0x28, 0x32,
+    0x36, 0x1A, 0x3E, 0x52, 0x29, 0x8E, 0x14, 0x26, 0x1E, 0x17, 0x27, 0x1D,
+    0x10, 0x8F, 0x14, 0x26, 0x1C, 0x17, 0x27, 0x1C, 0x10, 0x02, 0x11, 0x65,
+    0x04, 0x1A, 0x2A, 0x1E, 0x11, 0x1A, 0x37, 0x2D, 0x02, 0x10, 0x18, 0x28,
+    0x1C, 0x10, 0x31, 0x62, 0x47, 0xFE, 0xBF, 0x01, 0x37, 0x24, 0x2E, 0x17,
+    0x0F, 0x1B, 0x25, 0x15, 0xFE, 0xC4, 0x01, 0x38, 0x21, 0x2F, 0x18, 0x0F,
+    0x1B, 0x24, 0x15, 0xFE, 0xC3, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x26,
+    0x03, 0x75, 0x02, 0x1B, 0x06, 0x26, 0x01, 0x78, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0x00, 0xE1, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47, 0x00, 0x00,
+    0x02, 0x2D, 0x02, 0x1C, 0x00, 0x1C, 0x00, 0x00, 0x73, 0x11, 0x33, 0x17,
+    0x07, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34,
+    0x26, 0x26, 0x07, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x22, 0x22, 0x47,
+    0x88, 0x04, 0x1C, 0x0B, 0x39, 0x50, 0x2C, 0x3C, 0x51, 0x29, 0x8E, 0x14,
+    0x29, 0x1E, 0x18, 0x29, 0x1D, 0x11, 0x46, 0x17, 0x24, 0x02, 0x11, 0x6C,
+    0x0C, 0x24, 0x3B, 0x24, 0x30, 0x61, 0x47, 0xFE, 0xBC, 0x01, 0x39, 0x24,
+    0x30, 0x16, 0x01, 0x0F, 0x1C, 0x24, 0x15, 0xFE, 0xC2, 0x00, 0xFF, 0xFF,
+    0x00, 0x47, 0x00, 0x00, 0x02, 0x2D, 0x03, 0x1C, 0x06, 0x26, 0x01, 0x7A,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x5C, 0x04, 0xFF, 0xFF, 0xFF, 0xAF,
+    0x00, 0x00, 0x02, 0x52, 0x02, 0xBC, 0x04, 0x26, 0x02, 0xA0, 0x85, 0x00,
+    0x00, 0x06, 0x01, 0x7A, 0x25, 0x00, 0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00,
+    0x02, 0x2D, 0x03, 0x07, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFD, 0x5C, 0x04, 0xFF, 0xFF, 0x00, 0x47, 0xFE, 0xEB, 0x02, 0x2D,
+    0x02, 0x1C, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10,
+    0x3E, 0x00, 0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00, 0x02, 0x2D, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x5C, 0x04,
+    0xFF, 0xFF, 0x00, 0x47, 0xFF, 0x26, 0x02, 0x2D, 0x02, 0x1C, 0x06, 0x26,
+    0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x3E, 0x00, 0x00, 0x01,
+    0xFF, 0xDD, 0xFF, 0x32, 0x02, 0x39, 0x02, 0x1C, 0x00, 0x22, 0x00, 0x00,
+    0x57, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33, 0x17, 0x27, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x07,
+    0x22, 0x0E, 0x02, 0x15, 0x11, 0x0E, 0x02, 0x12, 0x35, 0x20, 0x2D, 0x1C,
+    0x0D, 0x88, 0x04, 0x10, 0x0F, 0x37, 0x48, 0x26, 0x3C, 0x51, 0x29, 0x8E,
+    0x14, 0x28, 0x1F, 0x18, 0x28, 0x1E, 0x11, 0x01, 0x31, 0x5C, 0xCE, 0x6E,
+    0x0C, 0x1C, 0x2B, 0x1F, 0x01, 0xFF, 0x74, 0x16, 0x1D, 0x30, 0x1C, 0x31,
+    0x5F, 0x48, 0xFE, 0xBC, 0x01, 0x39, 0x25, 0x2F, 0x16, 0x01, 0x0F, 0x1C,
+    0x24, 0x15, 0xFE, 0xBC, 0x3F, 0x59, 0x30, 0x00, 0xFF, 0xFF, 0x00, 0x47,
+    0xFF, 0x32, 0x03, 0x62, 0x03, 0x18, 0x04, 0x26, 0x01, 0x7A, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x69, 0x02, 0x6E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x47,
+    0xFF, 0x40, 0x02, 0x2D, 0x02, 0x1C, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x14, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00,
+    0x02, 0x2D, 0x02, 0xF8, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x01, 0x5B, 0x04, 0x00, 0x01, 0x00, 0x47, 0xFF, 0x37, 0x02, 0x2D,
+    0x02, 0x1C, 0x00, 0x1F, 0x00, 0x00, 0x45, 0x27, 0x32, 0x36, 0x37, 0x11,
+    0x34, 0x26, 0x26, 0x07, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x33,
+    0x17, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x06, 0x06,
+    0x01, 0x5C, 0x35, 0x3D, 0x3A, 0x01, 0x14, 0x29, 0x1E, 0x18, 0x29, 0x1D,
+    0x11, 0x8E, 0x88, 0x02, 0x12, 0x35, 0x3E, 0x21, 0x3C, 0x51, 0x29, 0x32,
+    0x5D, 0xC9, 0x6E, 0x3A, 0x39, 0x01, 0x21, 0x24, 0x30, 0x16, 0x01, 0x0F,
+    0x1C, 0x24, 0x15, 0xFE, 0xC2, 0x02, 0x11, 0x47, 0x17, 0x25, 0x16, 0x30,
+    0x61, 0x47, 0xFE, 0xAD, 0x3B, 0x53, 0x2C, 0x00, 0x00, 0x02, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x54, 0x02, 0x1C, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x27, 0x36, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x17, 0x06, 0x16, 0x16, 0x01, 0x3D, 0x51, 0x7F,
+    0x49, 0x49, 0x7F, 0x51, 0x50, 0x7F, 0x48, 0x48, 0x7F, 0x50, 0x27, 0x3E,
+    0x23, 0x01, 0x01, 0x23, 0x3E, 0x27, 0x28, 0x3E, 0x24, 0x01, 0x01, 0x24,
+    0x3E, 0x0A, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x47, 0x7C, 0x50, 0x50,
+    0x7C, 0x47, 0x7C, 0x27, 0x45, 0x2B, 0x2C, 0x45, 0x27, 0x28, 0x44, 0x2C,
+    0x2B, 0x45, 0x27, 0x00, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54,
+    0x03, 0x1C, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x43, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x02, 0xFF,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x43, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0x07, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x43, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0x03, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x43, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x74, 0x03, 0xB8, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xEE, 0x00, 0x86, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0x26, 0x02, 0x54, 0x03, 0x03, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x0E, 0x43, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x43, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0xB7, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF, 0x59, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x5B, 0x03, 0xBB, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF0, 0x7B, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x54, 0x03, 0xB5, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF1, 0x42, 0x04, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0xF6,
+    0x02, 0x54, 0x03, 0x21, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0A, 0x03, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54,
+    0x03, 0x18, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2,
+    0x42, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0xA9,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x02, 0xF2, 0x42, 0x04,
+    0x00, 0x07, 0x03, 0x05, 0x00, 0x43, 0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x54, 0x03, 0xA9, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x26, 0x02, 0xF5, 0x43, 0x04, 0x00, 0x07, 0x03, 0x05, 0x00, 0x43,
+    0x00, 0xD0, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x26, 0x02, 0x54, 0x02, 0x1C,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x43, 0x00,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0x1D, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x2F, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0x2E, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x42, 0x04, 0x00, 0x02, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x60, 0x02, 0x83, 0x00, 0x1D, 0x00, 0x2D, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x07, 0x37,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x27, 0x36,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x06, 0x16, 0x16, 0x01, 0x3D,
+    0x51, 0x7F, 0x49, 0x49, 0x7F, 0x51, 0x12, 0x22, 0x0E, 0x0A, 0x11, 0x07,
+    0x29, 0x29, 0x6D, 0x19, 0x38, 0x2D, 0x0B, 0x30, 0x37, 0x48, 0x7F, 0x50,
+    0x27, 0x3E, 0x23, 0x01, 0x01, 0x23, 0x3E, 0x27, 0x28, 0x3E, 0x24, 0x01,
+    0x01, 0x24, 0x3E, 0x0A, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x05, 0x03,
+    0x02, 0x03, 0x3B, 0x39, 0x2E, 0x4E, 0x35, 0x09, 0x19, 0x24, 0x70, 0x45,
+    0x50, 0x7C, 0x47, 0x7C, 0x27, 0x45, 0x2B, 0x2C, 0x45, 0x27, 0x28, 0x44,
+    0x2C, 0x2B, 0x45, 0x27, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x60,
+    0x03, 0x1C, 0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x43, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0x26, 0x02, 0x60, 0x02, 0x83,
+    0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x43, 0x00,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x60, 0x03, 0x1D, 0x06, 0x26,
+    0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x2F, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x60, 0x03, 0x2E, 0x06, 0x26, 0x01, 0x97,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x42, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x60, 0x02, 0xF8, 0x06, 0x26, 0x01, 0x97, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x42, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6,
+    0x02, 0x54, 0x03, 0x21, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFA, 0x42, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54,
+    0x03, 0x09, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B,
+    0x43, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x02, 0xDD,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x43, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0xC6, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x08, 0x43, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0xC6, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x07, 0x43, 0x04, 0x00, 0x03, 0x00, 0x24,
+    0xFF, 0x34, 0x02, 0x54, 0x02, 0x1C, 0x00, 0x15, 0x00, 0x25, 0x00, 0x35,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x27,
+    0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x27, 0x36, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x17, 0x06, 0x16, 0x16, 0x01, 0x7B, 0x33, 0x3B, 0x32,
+    0x58, 0x38, 0x12, 0x32, 0x3A, 0x10, 0x0D, 0x0A, 0x12, 0x08, 0x41, 0x0A,
+    0x23, 0x31, 0x5C, 0x51, 0x7F, 0x49, 0x49, 0x7F, 0x51, 0x50, 0x7F, 0x48,
+    0x48, 0x7F, 0x50, 0x27, 0x3E, 0x23, 0x01, 0x01, 0x23, 0x3E, 0x27, 0x28,
+    0x3E, 0x24, 0x01, 0x01, 0x24, 0x3E, 0xCC, 0x3F, 0x2B, 0x2A, 0x40, 0x35,
+    0x1A, 0x2F, 0x1F, 0x32, 0x20, 0x0F, 0x15, 0x0D, 0x0C, 0x30, 0x11, 0x22,
+    0x15, 0xC2, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x47, 0x7C, 0x50, 0x50,
+    0x7C, 0x47, 0x7C, 0x27, 0x45, 0x2B, 0x2C, 0x45, 0x27, 0x28, 0x44, 0x2C,
+    0x2B, 0x45, 0x27, 0x00, 0x00, 0x03, 0x00, 0x24, 0xFF, 0xDD, 0x02, 0x54,
+    0x02, 0x2B, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x57, 0x27,
+    0x01, 0x17, 0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x27, 0x36,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x06, 0x16, 0x16, 0x74, 0x42,
+    0x01, 0xCB, 0x43, 0xFE, 0xFD, 0x51, 0x7F, 0x49, 0x49, 0x7F, 0x51, 0x50,
+    0x7F, 0x48, 0x48, 0x7F, 0x50, 0x27, 0x3E, 0x23, 0x01, 0x01, 0x23, 0x3E,
+    0x27, 0x28, 0x3E, 0x24, 0x01, 0x01, 0x24, 0x3E, 0x23, 0x30, 0x02, 0x1E,
+    0x31, 0xFD, 0xFC, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x47, 0x7C, 0x50,
+    0x50, 0x7C, 0x47, 0x7C, 0x27, 0x45, 0x2B, 0x2C, 0x45, 0x27, 0x28, 0x44,
+    0x2C, 0x2B, 0x45, 0x27, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xDD, 0x02, 0x54,
+    0x03, 0x1C, 0x06, 0x26, 0x01, 0xA3, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x43, 0x04, 0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x02, 0xF8,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x42, 0x04,
+    0xFF, 0xFF, 0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0xD2, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x03, 0x42, 0x04, 0xFF, 0xFF,
+    0x00, 0x24, 0xFF, 0xF6, 0x02, 0x54, 0x03, 0xBB, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x02, 0x42, 0x04, 0xFF, 0xFF, 0x00, 0x24,
+    0xFF, 0xF6, 0x02, 0x54, 0x03, 0xA6, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x01, 0x42, 0x04, 0x00, 0x07, 0x03, 0x05, 0x00, 0x43,
+    0x00, 0xCC, 0x00, 0x02, 0x00, 0x24, 0xFF, 0xF6, 0x03, 0xCF, 0x02, 0x1C,
+    0x00, 0x39, 0x00, 0x49, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x3E, 0x02, 0x33, 0x32,
+    0x1E, 0x02, 0x07, 0x07, 0x21, 0x35, 0x21, 0x07, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37,
+    0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x0E, 0x02, 0x27,
+    0x32, 0x36, 0x36, 0x27, 0x36, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17,
+    0x06, 0x16, 0x16, 0x01, 0x3D, 0x51, 0x7F, 0x49, 0x49, 0x7F, 0x51, 0x31,
+    0x54, 0x45, 0x18, 0x20, 0x18, 0x40, 0x4F, 0x2D, 0x37, 0x5D, 0x43, 0x25,
+    0x02, 0x01, 0xFE, 0x79, 0x01, 0x2F, 0x2D, 0x1F, 0x36, 0x21, 0x20, 0x30,
+    0x21, 0x0F, 0x22, 0x47, 0x38, 0x24, 0x3C, 0x22, 0x44, 0x1D, 0x46, 0x49,
+    0x25, 0x34, 0x59, 0x46, 0x18, 0x20, 0x17, 0x44, 0x54, 0x30, 0x27, 0x3E,
+    0x23, 0x01, 0x01, 0x23, 0x3E, 0x27, 0x28, 0x3E, 0x24, 0x01, 0x01, 0x24,
+    0x3E, 0x0A, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x1B, 0x34, 0x24, 0x25,
+    0x33, 0x1B, 0x27, 0x47, 0x61, 0x38, 0x2C, 0x57, 0x28, 0x26, 0x1F, 0x2D,
+    0x19, 0x15, 0x27, 0x35, 0x20, 0x2E, 0x48, 0x29, 0x16, 0x1B, 0x5F, 0x19,
+    0x24, 0x12, 0x1B, 0x34, 0x24, 0x01, 0x25, 0x33, 0x1C, 0x7C, 0x27, 0x45,
+    0x2B, 0x2C, 0x45, 0x27, 0x28, 0x44, 0x2C, 0x2B, 0x45, 0x27, 0x00, 0x02,
+    0x00, 0x47, 0xFF, 0x24, 0x02, 0x66, 0x02, 0x1B, 0x00, 0x16, 0x00, 0x26,
+    0x00, 0x00, 0x57, 0x11, 0x33, 0x17, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x11,
+    0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x47, 0x89, 0x04, 0x1A, 0x07, 0x37, 0x52, 0x2D,
+    0x45, 0x6C, 0x3E, 0x3E, 0x6C, 0x45, 0x2E, 0x53, 0x39, 0x08, 0x21, 0x81,
+    0x27, 0x3C, 0x22, 0x22, 0x3B, 0x28, 0x28, 0x3C, 0x22, 0x22, 0x3C, 0xDC,
+    0x02, 0xED, 0x77, 0x09, 0x20, 0x36, 0x22, 0x47, 0x7B, 0x50, 0x4F, 0x7C,
+    0x47, 0x23, 0x3A, 0x21, 0x0E, 0xFE, 0xA1, 0x01, 0x4D, 0x26, 0x45, 0x2D,
+    0x2D, 0x44, 0x26, 0x25, 0x45, 0x2D, 0x2D, 0x45, 0x26, 0x00, 0x00, 0x02,
+    0x00, 0x47, 0xFF, 0x24, 0x02, 0x66, 0x02, 0xE4, 0x00, 0x17, 0x00, 0x27,
+    0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E,
+    0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x37, 0x11,
+    0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x47, 0x8F, 0x1C, 0x07, 0x37, 0x52, 0x2D, 0x34,
+    0x57, 0x40, 0x24, 0x3E, 0x6C, 0x45, 0x2E, 0x53, 0x39, 0x08, 0x21, 0x81,
+    0x27, 0x3C, 0x22, 0x22, 0x3B, 0x28, 0x28, 0x3C, 0x22, 0x22, 0x3C, 0xDC,
+    0x03, 0xC0, 0xFE, 0xB6, 0x09, 0x20, 0x36, 0x22, 0x28, 0x4A, 0x64, 0x3C,
+    0x4F, 0x7C, 0x47, 0x23, 0x3A, 0x21, 0x0E, 0xFE, 0xA1, 0x01, 0x4D, 0x26,
+    0x45, 0x2D, 0x2D, 0x44, 0x26, 0x25, 0x45, 0x2D, 0x2D, 0x45, 0x26, 0x00,
+    0x00, 0x02, 0x00, 0x24, 0xFF, 0x24, 0x02, 0x42, 0x02, 0x1C, 0x00, 0x18,
+    0x00, 0x28, 0x00, 0x00, 0x45, 0x11, 0x17, 0x0E, 0x03, 0x23, 0x22, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x07, 0x37,
+    0x33, 0x11, 0x01, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0xB4, 0x1D, 0x02, 0x21, 0x35,
+    0x40, 0x23, 0x46, 0x6D, 0x3F, 0x3E, 0x6C, 0x44, 0x27, 0x45, 0x36, 0x22,
+    0x02, 0x23, 0x05, 0x88, 0xFE, 0xF1, 0x28, 0x3C, 0x21, 0x21, 0x3C, 0x28,
+    0x28, 0x3C, 0x21, 0x21, 0x3C, 0xDC, 0x01, 0x5B, 0x05, 0x19, 0x2F, 0x26,
+    0x16, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x17, 0x26, 0x30, 0x1A, 0x05,
+    0x82, 0xFD, 0x12, 0x01, 0x4D, 0x26, 0x44, 0x2E, 0x2E, 0x45, 0x26, 0x27,
+    0x45, 0x2D, 0x2D, 0x45, 0x26, 0x00, 0x00, 0x01, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0xAC, 0x02, 0x1C, 0x00, 0x15, 0x00, 0x00, 0x73, 0x11, 0x33, 0x17,
+    0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x11, 0x47, 0x89, 0x05, 0x18, 0x0C, 0x36, 0x49, 0x28,
+    0x11, 0x20, 0x0B, 0x26, 0x0B, 0x23, 0x12, 0x18, 0x29, 0x1E, 0x11, 0x02,
+    0x11, 0xAA, 0x23, 0x29, 0x43, 0x26, 0x06, 0x04, 0x9C, 0x06, 0x09, 0x11,
+    0x1F, 0x2A, 0x19, 0xFE, 0xEE, 0x00, 0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0xAC, 0x03, 0x1C, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x06, 0x04, 0xFF, 0xFF, 0x00, 0x47, 0x00, 0x00, 0x01, 0xAE,
+    0x03, 0x07, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x06, 0x04, 0xFF, 0xFF, 0x00, 0x33, 0xFE, 0xEB, 0x01, 0xAC, 0x02, 0x1C,
+    0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0x92, 0x00,
+    0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x01, 0xAC, 0x03, 0x21, 0x06, 0x26,
+    0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0xC6, 0x04, 0xFF, 0xFF,
+    0x00, 0x33, 0xFF, 0x26, 0x01, 0xAC, 0x02, 0x1C, 0x06, 0x26, 0x01, 0xAD,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x92, 0x00, 0xFF, 0xFF, 0x00, 0x47,
+    0x00, 0x00, 0x01, 0xAD, 0x03, 0x09, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0x06, 0x04, 0xFF, 0xFF, 0xFF, 0xF6, 0xFF, 0x40,
+    0x01, 0xAC, 0x02, 0x1C, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0x91, 0x00, 0x00, 0x01, 0x00, 0x19, 0xFF, 0xF6, 0x01, 0xCC,
+    0x02, 0x1C, 0x00, 0x39, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x27, 0x26, 0x26, 0x27, 0x26,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x17,
+    0x16, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0xF9, 0x4A, 0x73, 0x23, 0x59, 0x1E, 0x4C, 0x26, 0x0F, 0x19, 0x12, 0x09,
+    0x12, 0x0A, 0x2A, 0x21, 0x33, 0x47, 0x15, 0x12, 0x13, 0x20, 0x39, 0x4A,
+    0x29, 0x29, 0x4E, 0x43, 0x19, 0x4C, 0x12, 0x2D, 0x30, 0x13, 0x11, 0x1B,
+    0x12, 0x09, 0x0B, 0x0A, 0x0B, 0x2B, 0x25, 0x30, 0x43, 0x14, 0x11, 0x10,
+    0x37, 0x60, 0x0A, 0x31, 0x2B, 0x4C, 0x21, 0x1D, 0x07, 0x0D, 0x13, 0x0B,
+    0x16, 0x0C, 0x06, 0x0F, 0x09, 0x0D, 0x23, 0x16, 0x15, 0x31, 0x1E, 0x24,
+    0x3B, 0x2A, 0x17, 0x14, 0x25, 0x19, 0x54, 0x11, 0x1C, 0x10, 0x06, 0x0D,
+    0x12, 0x0B, 0x0B, 0x14, 0x07, 0x06, 0x10, 0x0A, 0x0D, 0x20, 0x15, 0x12,
+    0x2E, 0x1C, 0x31, 0x4C, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x19, 0xFF, 0xF6,
+    0x01, 0xCC, 0x03, 0x1C, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0xFB, 0x04, 0xFF, 0xFF, 0x00, 0x19, 0xFF, 0xF6, 0x01, 0xCC,
+    0x03, 0x34, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF9,
+    0x0B, 0x04, 0xFF, 0xFF, 0x00, 0x19, 0xFF, 0xF6, 0x01, 0xCC, 0x03, 0x07,
+    0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0xFB, 0x04,
+    0xFF, 0xFF, 0x00, 0x19, 0xFF, 0xF6, 0x01, 0xCC, 0x03, 0xAE, 0x06, 0x26,
+    0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFE, 0xFB, 0x04, 0xFF, 0xFF,
+    0x00, 0x19, 0xFF, 0x0A, 0x01, 0xCC, 0x02, 0x1C, 0x06, 0x26, 0x01, 0xB5,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x19,
+    0xFF, 0xF6, 0x01, 0xCC, 0x03, 0x03, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0xFB, 0x04, 0xFF, 0xFF, 0x00, 0x19, 0xFE, 0xEB,
+    0x01, 0xCC, 0x02, 0x1C, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x10, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x19, 0xFF, 0xF6, 0x01, 0xCC,
+    0x03, 0x18, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5,
+    0xFB, 0x04, 0xFF, 0xFF, 0x00, 0x19, 0xFF, 0x26, 0x01, 0xCC, 0x02, 0x1C,
+    0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x01, 0x00,
+    0xFF, 0xFF, 0x00, 0x19, 0xFF, 0x26, 0x01, 0xCC, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0xB5, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x01, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0xFB, 0x04, 0x00, 0x02, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x7D,
+    0x02, 0xDE, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x35,
+    0x3E, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11, 0x23, 0x11,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07,
+    0x27, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06, 0x01, 0x35, 0x33, 0x15, 0x01,
+    0xA9, 0x2C, 0x43, 0x19, 0x3B, 0x15, 0x23, 0x12, 0x24, 0x2B, 0x16, 0x2A,
+    0x3A, 0x24, 0x18, 0x22, 0x15, 0x0B, 0x2F, 0x29, 0x2D, 0x31, 0x8B, 0x3A,
+    0x6A, 0x4B, 0x3E, 0x61, 0x37, 0x1A, 0x32, 0x21, 0x02, 0x29, 0x43, 0x31,
+    0x1A, 0x37, 0x5F, 0xFE, 0x3A, 0x91, 0x0A, 0x1C, 0x1C, 0x5C, 0x11, 0x0E,
+    0x31, 0x2A, 0x1F, 0x33, 0x28, 0x1D, 0x0B, 0x4F, 0x0A, 0x16, 0x18, 0x1C,
+    0x0F, 0x21, 0x24, 0x3B, 0x31, 0xFE, 0x0D, 0x01, 0xF3, 0x46, 0x6A, 0x3B,
+    0x29, 0x4A, 0x33, 0x1E, 0x3D, 0x31, 0x0F, 0x1A, 0x0D, 0x2C, 0x3D, 0x4A,
+    0x2C, 0x3D, 0x60, 0x38, 0x01, 0x83, 0x7B, 0x7B, 0x00, 0x02, 0x00, 0x17,
+    0x00, 0x00, 0x01, 0x75, 0x02, 0x97, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x7A, 0x8E, 0xF1, 0x01,
+    0x5E, 0x02, 0x97, 0xFD, 0x69, 0x01, 0x92, 0x7F, 0x7F, 0x00, 0x00, 0x03,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x75, 0x02, 0x97, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x07, 0x11, 0x33, 0x11,
+    0x03, 0x35, 0x21, 0x15, 0x2A, 0x01, 0x33, 0xE3, 0x8E, 0xF1, 0x01, 0x5E,
+    0xCA, 0x6E, 0x6E, 0xCA, 0x02, 0x97, 0xFD, 0x69, 0x01, 0x92, 0x7F, 0x7F,
+    0xFF, 0xFF, 0x00, 0x17, 0x00, 0x00, 0x01, 0xE0, 0x03, 0x2F, 0x06, 0x26,
+    0x01, 0xC1, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x00, 0x8D, 0x00, 0x7D,
+    0xFF, 0xFF, 0x00, 0x17, 0xFF, 0x0A, 0x01, 0x75, 0x02, 0x97, 0x06, 0x26,
+    0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0xCA, 0x00, 0xFF, 0xFF,
+    0x00, 0x17, 0xFE, 0xEB, 0x01, 0x75, 0x02, 0x97, 0x06, 0x26, 0x01, 0xC1,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0xCB, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x86, 0x03, 0x6B, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF2, 0xC9, 0x57, 0xFF, 0xFF, 0x00, 0x17, 0xFF, 0x26,
+    0x01, 0x75, 0x02, 0x97, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0xCB, 0x00, 0xFF, 0xFF, 0x00, 0x17, 0xFF, 0x40, 0x01, 0x75,
+    0x02, 0x97, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14,
+    0xCA, 0x00, 0x00, 0x01, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E, 0x02, 0x11,
+    0x00, 0x19, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11,
+    0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x23,
+    0x27, 0x37, 0x0E, 0x02, 0xFD, 0x3A, 0x53, 0x2D, 0x8E, 0x18, 0x2C, 0x20,
+    0x17, 0x27, 0x1D, 0x10, 0x8E, 0x87, 0x05, 0x1A, 0x0C, 0x38, 0x4E, 0x0A,
+    0x33, 0x5F, 0x43, 0x01, 0x46, 0xFE, 0xD1, 0x24, 0x35, 0x1C, 0x0F, 0x1C,
+    0x26, 0x16, 0x01, 0x3D, 0xFD, 0xEF, 0x6D, 0x0C, 0x25, 0x3C, 0x22, 0x00,
+    0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x1C, 0x06, 0x26,
+    0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x41, 0x04, 0xFF, 0xFF,
+    0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E, 0x02, 0xFF, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43,
+    0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x07, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6,
+    0x02, 0x2E, 0x03, 0x03, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xF6, 0x02, 0x2E,
+    0x03, 0x21, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A,
+    0x02, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x41, 0x04,
+    0xFF, 0xFF, 0x00, 0x43, 0xFF, 0x26, 0x02, 0x2E, 0x02, 0x11, 0x06, 0x26,
+    0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x41, 0x00, 0xFF, 0xFF,
+    0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x1D, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x2D, 0x04, 0xFF, 0xFF, 0x00, 0x43,
+    0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x2E, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x09, 0x41, 0x04, 0x00, 0x01, 0x00, 0x43, 0xFF, 0xF6,
+    0x02, 0x8A, 0x02, 0x83, 0x00, 0x23, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26,
+    0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35,
+    0x11, 0x32, 0x3E, 0x02, 0x35, 0x33, 0x14, 0x06, 0x06, 0x07, 0x37, 0x11,
+    0x23, 0x27, 0x17, 0x0E, 0x02, 0xFD, 0x3A, 0x53, 0x2D, 0x8E, 0x18, 0x2C,
+    0x20, 0x17, 0x27, 0x1D, 0x10, 0x23, 0x30, 0x1D, 0x0D, 0x6D, 0x1A, 0x38,
+    0x2D, 0x23, 0x87, 0x05, 0x10, 0x0E, 0x38, 0x47, 0x0A, 0x33, 0x5F, 0x43,
+    0x01, 0x46, 0xFE, 0xD1, 0x24, 0x35, 0x1C, 0x0F, 0x1C, 0x26, 0x16, 0x01,
+    0x3D, 0x0D, 0x1C, 0x2B, 0x1E, 0x2C, 0x4D, 0x34, 0x08, 0x31, 0xFE, 0x01,
+    0x77, 0x15, 0x1F, 0x32, 0x1B, 0x00, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6,
+    0x02, 0x8A, 0x03, 0x1C, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0x26, 0x02, 0x8A,
+    0x02, 0x83, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x41, 0x00, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x8A, 0x03, 0x1D,
+    0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x2D, 0x04,
+    0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x8A, 0x03, 0x2E, 0x06, 0x26,
+    0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x41, 0x04, 0xFF, 0xFF,
+    0x00, 0x43, 0xFF, 0xF6, 0x02, 0x8A, 0x02, 0xF8, 0x06, 0x26, 0x01, 0xD3,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43,
+    0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x21, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFA, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6,
+    0x02, 0x2E, 0x03, 0x09, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0B, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E,
+    0x02, 0xDD, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05,
+    0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E, 0x03, 0xBE,
+    0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x26, 0x03, 0x05, 0x41, 0x04,
+    0x00, 0x07, 0x02, 0xF2, 0x00, 0x41, 0x00, 0xAA, 0xFF, 0xFF, 0x00, 0x43,
+    0xFF, 0x31, 0x02, 0x38, 0x02, 0x11, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x12, 0x00, 0xC9, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x43,
+    0xFF, 0xF6, 0x02, 0x2E, 0x03, 0x3E, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x00, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6,
+    0x02, 0x2E, 0x02, 0xF8, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x01, 0x41, 0x04, 0xFF, 0xFF, 0x00, 0x43, 0xFF, 0xF6, 0x02, 0x2E,
+    0x03, 0xD2, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x03,
+    0x41, 0x04, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x02, 0x43, 0x02, 0x11,
+    0x00, 0x07, 0x00, 0x00, 0x73, 0x03, 0x33, 0x13, 0x07, 0x13, 0x33, 0x03,
+    0xED, 0xDE, 0x9C, 0x8D, 0x21, 0x94, 0x98, 0xE9, 0x02, 0x11, 0xFE, 0x75,
+    0x06, 0x01, 0x91, 0xFD, 0xEF, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00,
+    0x03, 0x28, 0x02, 0x12, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x03, 0x37, 0x13,
+    0x27, 0x13, 0x33, 0x13, 0x07, 0x13, 0x33, 0x03, 0x23, 0x03, 0x17, 0x03,
+    0xC0, 0xB1, 0x94, 0x6C, 0x16, 0x77, 0x54, 0x7C, 0x18, 0x6C, 0x94, 0xB4,
+    0x67, 0x7D, 0x10, 0x7A, 0x02, 0x11, 0x01, 0xFE, 0x97, 0x03, 0x01, 0x19,
+    0xFE, 0xE6, 0x02, 0x01, 0x68, 0xFD, 0xEF, 0x01, 0x2D, 0x02, 0xFE, 0xD5,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x28, 0x03, 0x1C, 0x06, 0x26,
+    0x01, 0xE2, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF8, 0x00, 0xA2, 0x00, 0x04,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x28, 0x03, 0x03, 0x06, 0x26,
+    0x01, 0xE2, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFC, 0x00, 0xA2, 0x00, 0x04,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x28, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0xE2, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF2, 0x00, 0xA1, 0x00, 0x04,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x03, 0x28, 0x03, 0x1D, 0x06, 0x26,
+    0x01, 0xE2, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF7, 0x00, 0x8E, 0x00, 0x04,
+    0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x02, 0x3F, 0x02, 0x11, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x61, 0x27, 0x27, 0x03, 0x33, 0x17,
+    0x17, 0x13, 0x21, 0x13, 0x17, 0x07, 0x37, 0x27, 0x37, 0x33, 0x01, 0x95,
+    0x83, 0x28, 0xD6, 0xAC, 0x80, 0x2C, 0xD3, 0xFD, 0xD3, 0xD3, 0x4E, 0x7A,
+    0xAD, 0x4C, 0x71, 0xA7, 0xBB, 0x38, 0x01, 0x1E, 0xB5, 0x3B, 0xFE, 0xDF,
+    0x01, 0x21, 0x5D, 0xC4, 0xEE, 0x5D, 0xC6, 0x00, 0x00, 0x01, 0x00, 0x05,
+    0xFF, 0x1A, 0x02, 0x5A, 0x02, 0x11, 0x00, 0x10, 0x00, 0x00, 0x57, 0x13,
+    0x17, 0x01, 0x33, 0x13, 0x16, 0x16, 0x17, 0x07, 0x36, 0x36, 0x37, 0x13,
+    0x33, 0x03, 0x07, 0x91, 0x74, 0x02, 0xFE, 0xFE, 0xA1, 0x81, 0x08, 0x0F,
+    0x05, 0x18, 0x07, 0x0F, 0x08, 0x6F, 0xA2, 0xDE, 0x5B, 0xE6, 0x01, 0x10,
+    0x52, 0x02, 0x39, 0xFE, 0xCF, 0x11, 0x2D, 0x14, 0x0B, 0x11, 0x2C, 0x19,
+    0x01, 0x38, 0xFD, 0xEF, 0xE6, 0x00, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A,
+    0x02, 0x5A, 0x03, 0x1C, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x36, 0x04, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x5A,
+    0x03, 0x03, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC,
+    0x36, 0x04, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x5A, 0x03, 0x18,
+    0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x36, 0x04,
+    0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x5A, 0x03, 0x18, 0x06, 0x26,
+    0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x36, 0x04, 0xFF, 0xFF,
+    0x00, 0x05, 0xFF, 0x1A, 0x02, 0x5A, 0x02, 0x11, 0x06, 0x26, 0x01, 0xE8,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xF7, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x05, 0xFF, 0x1A, 0x02, 0x5A, 0x03, 0x1D, 0x06, 0x26, 0x01, 0xE8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x22, 0x04, 0xFF, 0xFF, 0x00, 0x05,
+    0xFF, 0x1A, 0x02, 0x5A, 0x03, 0x2E, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x09, 0x36, 0x04, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A,
+    0x02, 0x5A, 0x02, 0xDD, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x36, 0x04, 0xFF, 0xFF, 0x00, 0x05, 0xFF, 0x1A, 0x02, 0x5A,
+    0x02, 0xF8, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01,
+    0x36, 0x04, 0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0xDF, 0x02, 0x11,
+    0x00, 0x0B, 0x00, 0x00, 0x73, 0x35, 0x01, 0x15, 0x21, 0x35, 0x21, 0x15,
+    0x01, 0x27, 0x21, 0x15, 0x32, 0x01, 0x17, 0xFE, 0xE9, 0x01, 0xA6, 0xFE,
+    0xF5, 0x04, 0x01, 0x16, 0x5A, 0x01, 0x6A, 0x28, 0x75, 0x5C, 0xFE, 0x9F,
+    0x21, 0x75, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0xDF, 0x03, 0x1C,
+    0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x0F, 0x04,
+    0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0xDF, 0x03, 0x07, 0x06, 0x26,
+    0x01, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x0F, 0x04, 0xFF, 0xFF,
+    0x00, 0x32, 0x00, 0x00, 0x01, 0xDF, 0x03, 0x18, 0x06, 0x26, 0x01, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x0F, 0x04, 0xFF, 0xFF, 0x00, 0x32,
+    0xFF, 0x26, 0x01, 0xDF, 0x02, 0x11, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x11, 0xFF, 0x32,
+    0x02, 0x25, 0x03, 0x1C, 0x04, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x27,
+    0x02, 0xF8, 0xFF, 0x8E, 0x00, 0x04, 0x00, 0x27, 0x01, 0x6A, 0x01, 0x12,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0xF8, 0x00, 0xB4, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x02, 0x1C, 0x00, 0x10, 0x00, 0x2E,
+    0x00, 0x00, 0x61, 0x11, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x05, 0x22, 0x26, 0x26, 0x35,
+    0x34, 0x3E, 0x02, 0x33, 0x33, 0x07, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x6C,
+    0x33, 0x2C, 0x28, 0x41, 0x1C, 0x56, 0x30, 0x76, 0x47, 0x41, 0x5F, 0x34,
+    0xFE, 0xE8, 0x33, 0x50, 0x2F, 0x1E, 0x3B, 0x59, 0x3A, 0x9E, 0x09, 0x96,
+    0x18, 0x25, 0x1A, 0x0C, 0x12, 0x1F, 0x14, 0x1E, 0x35, 0x2A, 0x0C, 0x1A,
+    0x15, 0x3C, 0x47, 0x01, 0x4B, 0x2B, 0x2C, 0x1F, 0x23, 0x55, 0x31, 0x36,
+    0x28, 0x51, 0x3C, 0xFE, 0x99, 0x0A, 0x28, 0x47, 0x30, 0x29, 0x3E, 0x2A,
+    0x15, 0x5E, 0x08, 0x12, 0x18, 0x10, 0x11, 0x1A, 0x0F, 0x14, 0x24, 0x17,
+    0x45, 0x23, 0x34, 0x1E, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3,
+    0x03, 0x1C, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x02, 0xFF,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x1C, 0x04,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0xC5, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEA, 0x1C, 0x04, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0x26, 0x01, 0xF3, 0x02, 0xFF, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x1C, 0x00, 0x00, 0x06, 0x02, 0xFF,
+    0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0xC5,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEB, 0x1C, 0x04,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0xD1, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEC, 0x1C, 0x04, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0xBB, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xED, 0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x01, 0xF3, 0x03, 0x07, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6,
+    0x01, 0xF3, 0x03, 0x03, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x02, 0x4E,
+    0x03, 0xB8, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEE,
+    0x60, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0x26, 0x01, 0xF3, 0x03, 0x03,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x1C, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6,
+    0x01, 0xF4, 0x03, 0xB7, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEF, 0x32, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x02, 0x34,
+    0x03, 0xBB, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF0,
+    0x55, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0xB5,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1, 0x1B, 0x04,
+    0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0x21, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0xDC, 0x04, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0x18, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0x26, 0x01, 0xF3, 0x02, 0x1C, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x1C, 0x00, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6,
+    0x01, 0xF3, 0x03, 0x1D, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF7, 0x08, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3,
+    0x03, 0x2E, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09,
+    0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0x09,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B, 0x1C, 0x04,
+    0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x02, 0xDD, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x1C, 0x04, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0x31, 0x01, 0xFD, 0x02, 0x1C, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x12, 0x00, 0x8F, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x03, 0x3E, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x1C, 0x04, 0xFF, 0xFF, 0x00, 0x29,
+    0xFF, 0xF6, 0x01, 0xF3, 0x04, 0x22, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x1C, 0x04, 0x00, 0x07, 0x02, 0xF8, 0x00, 0x1C,
+    0x01, 0x0A, 0xFF, 0xFF, 0x00, 0x29, 0xFF, 0xF6, 0x01, 0xF3, 0x02, 0xF8,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x1C, 0x04,
+    0x00, 0x03, 0x00, 0x22, 0xFF, 0x14, 0x02, 0x27, 0x02, 0x19, 0x00, 0x37,
+    0x00, 0x45, 0x00, 0x55, 0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x37, 0x07, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x07, 0x2E,
+    0x02, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x27, 0x33,
+    0x15, 0x23, 0x37, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x24, 0x7E, 0x84, 0x14, 0x2C,
+    0x22, 0x01, 0x28, 0x26, 0x17, 0x2B, 0x21, 0x04, 0x23, 0x26, 0x0F, 0x3B,
+    0x63, 0x3D, 0x11, 0x1B, 0x22, 0x16, 0x34, 0xDF, 0x66, 0x12, 0x0C, 0x0D,
+    0x04, 0x3A, 0x63, 0x3D, 0x2D, 0x13, 0x15, 0x15, 0x13, 0x3C, 0x79, 0x8A,
+    0x3E, 0x74, 0x52, 0x24, 0x35, 0x1C, 0x3F, 0x36, 0x33, 0x3F, 0x1C, 0x34,
+    0x16, 0x18, 0x26, 0x17, 0x17, 0x26, 0x18, 0x19, 0x26, 0x17, 0x17, 0x26,
+    0xEC, 0x5E, 0x4D, 0x1B, 0x30, 0x27, 0x0D, 0x08, 0x0B, 0x2E, 0x1B, 0x15,
+    0x23, 0x18, 0x04, 0x14, 0x1E, 0x32, 0x2F, 0x1A, 0x33, 0x52, 0x31, 0x04,
+    0x08, 0x07, 0x08, 0x67, 0x1C, 0x18, 0x20, 0x1A, 0x0E, 0x33, 0x55, 0x32,
+    0x10, 0x0E, 0x10, 0x11, 0x59, 0x52, 0x33, 0x4D, 0x2B, 0x6C, 0x10, 0x1D,
+    0x12, 0x1C, 0x22, 0x22, 0x1C, 0x12, 0x1D, 0x10, 0x01, 0x92, 0x14, 0x24,
+    0x17, 0x15, 0x23, 0x14, 0x14, 0x23, 0x15, 0x16, 0x24, 0x15, 0xFF, 0xFF,
+    0x00, 0x22, 0xFF, 0x14, 0x02, 0x27, 0x02, 0xFF, 0x06, 0x26, 0x02, 0x12,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x26, 0x04, 0xFF, 0xFF, 0x00, 0x22,
+    0xFF, 0x14, 0x02, 0x27, 0x03, 0x07, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x26, 0x04, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0x14,
+    0x02, 0x27, 0x03, 0x03, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x26, 0x04, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0x14, 0x02, 0x27,
+    0x03, 0x43, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0C,
+    0x26, 0x04, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0x14, 0x02, 0x27, 0x03, 0x18,
+    0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x26, 0x04,
+    0xFF, 0xFF, 0x00, 0x22, 0xFF, 0x14, 0x02, 0x27, 0x02, 0xDD, 0x06, 0x26,
+    0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x26, 0x04, 0xFF, 0xFF,
+    0x00, 0x21, 0x00, 0x00, 0x03, 0x1D, 0x02, 0xE5, 0x04, 0x26, 0x01, 0x4A,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x4A, 0x01, 0x89, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x21, 0x00, 0x00, 0x04, 0x02, 0x03, 0x18, 0x04, 0x26, 0x01, 0x4A,
+    0x00, 0x00, 0x00, 0x27, 0x01, 0x4A, 0x01, 0x89, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x57, 0x03, 0x12, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x32,
+    0x05, 0x38, 0x03, 0x18, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x27,
+    0x01, 0x4A, 0x01, 0x89, 0x00, 0x00, 0x00, 0x27, 0x01, 0x57, 0x03, 0x12,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0x69, 0x04, 0x44, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x21, 0x00, 0x00, 0x03, 0xE8, 0x02, 0xE5, 0x04, 0x26, 0x01, 0x4A,
+    0x00, 0x00, 0x00, 0x27, 0x01, 0x4A, 0x01, 0x89, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x6F, 0x03, 0x12, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x32,
+    0x03, 0xAF, 0x03, 0x18, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x27,
+    0x01, 0x57, 0x01, 0x89, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69, 0x02, 0xBB,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00, 0x02, 0x79, 0x03, 0x18,
+    0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x01, 0x57, 0x01, 0x89,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00, 0x02, 0x5F, 0x02, 0xE5,
+    0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x01, 0x6F, 0x01, 0x89,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x11, 0x01, 0x87, 0x01, 0x5D, 0x02, 0xD1,
+    0x00, 0x15, 0x00, 0x24, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x27, 0x35, 0x33, 0x11, 0x23, 0x35,
+    0x37, 0x14, 0x06, 0x06, 0x37, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x8D, 0x26, 0x38, 0x1E, 0x23,
+    0x3D, 0x28, 0x35, 0x35, 0x13, 0x6D, 0x6D, 0x13, 0x1D, 0x36, 0x05, 0x13,
+    0x1C, 0x10, 0x22, 0x1E, 0x0F, 0x1A, 0x0E, 0x0D, 0x19, 0x01, 0x87, 0x2B,
+    0x4D, 0x33, 0x2E, 0x48, 0x29, 0x41, 0x3C, 0x34, 0x43, 0xFE, 0xC6, 0x49,
+    0x22, 0x1E, 0x36, 0x21, 0x53, 0x14, 0x25, 0x19, 0x26, 0x2C, 0x15, 0x23,
+    0x15, 0x1B, 0x27, 0x15, 0x00, 0x02, 0x00, 0x1C, 0x01, 0x88, 0x01, 0x65,
+    0x02, 0xCA, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0xC0, 0x30, 0x49, 0x2B, 0x2B, 0x49, 0x30, 0x2F,
+    0x4A, 0x2C, 0x2B, 0x4B, 0x30, 0x12, 0x1B, 0x0F, 0x0E, 0x1B, 0x13, 0x12,
+    0x1A, 0x0F, 0x0F, 0x1B, 0x01, 0x88, 0x2A, 0x48, 0x2E, 0x2E, 0x4A, 0x2A,
+    0x2B, 0x4A, 0x2D, 0x2E, 0x48, 0x2A, 0x51, 0x14, 0x24, 0x18, 0x19, 0x23,
+    0x14, 0x15, 0x24, 0x17, 0x18, 0x24, 0x14, 0x00, 0xFF, 0xFF, 0x00, 0x02,
+    0x00, 0x00, 0x02, 0xC9, 0x02, 0xD9, 0x06, 0x06, 0x02, 0xE1, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x1B, 0x00, 0x00, 0x02, 0xAB, 0x02, 0xCA, 0x06, 0x06,
+    0x02, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x4C, 0xFF, 0x60, 0x02, 0x27,
+    0x02, 0x11, 0x06, 0x06, 0x02, 0xE5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x22,
+    0x00, 0x00, 0x02, 0x5F, 0x02, 0x12, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x11,
+    0x17, 0x23, 0x35, 0x21, 0x15, 0x23, 0x37, 0x11, 0x23, 0x11, 0x17, 0x23,
+    0x37, 0x11, 0x6C, 0x11, 0x5B, 0x02, 0x3D, 0x53, 0x09, 0x83, 0x0A, 0xBA,
+    0x0D, 0x01, 0xE0, 0x4E, 0x80, 0x80, 0x28, 0xFE, 0x46, 0x01, 0xD0, 0x3E,
+    0x28, 0xFE, 0x46, 0x00, 0x00, 0x02, 0x00, 0x2A, 0xFF, 0xF6, 0x02, 0x63,
+    0x02, 0xC6, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16,
+    0x01, 0x46, 0x5A, 0x7F, 0x43, 0x43, 0x7F, 0x5A, 0x5A, 0x80, 0x43, 0x43,
+    0x80, 0x5A, 0x44, 0x49, 0x49, 0x44, 0x44, 0x49, 0x49, 0x0A, 0x56, 0xA1,
+    0x71, 0x71, 0xA1, 0x56, 0x56, 0xA1, 0x71, 0x71, 0xA1, 0x56, 0x81, 0x78,
+    0x6F, 0x71, 0x7A, 0x7A, 0x71, 0x6F, 0x78, 0x00, 0x00, 0x02, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0xE7, 0x02, 0xC6, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x77, 0x11, 0x17, 0x07, 0x27, 0x37, 0x33, 0x11, 0x05, 0x35, 0x21, 0x15,
+    0xD5, 0x25, 0x92, 0x1D, 0xC3, 0x5B, 0xFE, 0xF1, 0x01, 0x8D, 0x31, 0x02,
+    0x38, 0x43, 0x47, 0x85, 0x62, 0xFD, 0x6B, 0x31, 0x87, 0x87, 0x00, 0x01,
+    0x00, 0x22, 0x00, 0x00, 0x02, 0x14, 0x02, 0xCA, 0x00, 0x22, 0x00, 0x00,
+    0x73, 0x27, 0x37, 0x3E, 0x03, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E,
+    0x03, 0x07, 0x07, 0x27, 0x21, 0x15, 0x46, 0x21, 0xCF, 0x11, 0x27, 0x25,
+    0x16, 0x14, 0x26, 0x1C, 0x1A, 0x2E, 0x28, 0x0F, 0x70, 0x14, 0x4A, 0x66,
+    0x3A, 0x3D, 0x62, 0x38, 0x09, 0x15, 0x21, 0x2F, 0x1E, 0x9F, 0x14, 0x01,
+    0x5C, 0x52, 0xE5, 0x12, 0x30, 0x33, 0x30, 0x15, 0x17, 0x23, 0x14, 0x1B,
+    0x34, 0x25, 0x3E, 0x3A, 0x57, 0x30, 0x33, 0x5A, 0x3B, 0x16, 0x2E, 0x32,
+    0x37, 0x3D, 0x21, 0xAD, 0x3D, 0x87, 0x00, 0x01, 0x00, 0x16, 0xFF, 0xF6,
+    0x02, 0x16, 0x02, 0xC0, 0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27,
+    0x37, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x07, 0x27, 0x37, 0x17, 0x25, 0x35, 0x21, 0x17, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x01,
+    0x14, 0x52, 0x79, 0x33, 0x6E, 0x17, 0x30, 0x33, 0x1C, 0x1E, 0x34, 0x1F,
+    0x1A, 0x32, 0x22, 0x0F, 0x23, 0x27, 0x16, 0x23, 0xB9, 0x26, 0xFE, 0xDA,
+    0x01, 0xA5, 0x1B, 0xE7, 0x22, 0x08, 0x25, 0x0F, 0x2E, 0x50, 0x3E, 0x23,
+    0x45, 0x75, 0x0A, 0x46, 0x55, 0x46, 0x23, 0x2C, 0x14, 0x1D, 0x32, 0x21,
+    0x22, 0x2E, 0x18, 0x06, 0x0D, 0x0A, 0x5D, 0xCA, 0x1B, 0x04, 0x81, 0x37,
+    0xFA, 0x29, 0x04, 0x07, 0x22, 0x3C, 0x50, 0x2E, 0x45, 0x6D, 0x3F, 0x00,
+    0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x02, 0x63, 0x02, 0xC0, 0x00, 0x0B,
+    0x00, 0x00, 0x61, 0x11, 0x17, 0x03, 0x27, 0x21, 0x15, 0x21, 0x27, 0x01,
+    0x33, 0x11, 0x01, 0x5E, 0x46, 0xF6, 0x11, 0x01, 0xC6, 0xFD, 0xF1, 0x3E,
+    0x01, 0x61, 0x78, 0x02, 0x36, 0x04, 0xFE, 0xD3, 0x18, 0x7E, 0x76, 0x01,
+    0xAB, 0xFD, 0x40, 0x00, 0x00, 0x01, 0x00, 0x22, 0xFF, 0xF9, 0x02, 0x15,
+    0x02, 0xC0, 0x00, 0x26, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x07, 0x27, 0x13, 0x21, 0x15, 0x21, 0x37, 0x07, 0x27, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x01, 0x12, 0x4C, 0x7B,
+    0x29, 0x51, 0x2B, 0x46, 0x2A, 0x23, 0x38, 0x20, 0x20, 0x35, 0x22, 0x16,
+    0x26, 0x2E, 0x21, 0x44, 0x2B, 0x01, 0x8A, 0xFE, 0xC2, 0x25, 0x21, 0x30,
+    0x0F, 0x35, 0x3F, 0x1E, 0x42, 0x67, 0x3D, 0x44, 0x76, 0x07, 0x3F, 0x3C,
+    0x5A, 0x30, 0x22, 0x1D, 0x34, 0x20, 0x21, 0x34, 0x1F, 0x07, 0x13, 0x12,
+    0x5A, 0x01, 0x31, 0x81, 0x2C, 0xDE, 0x17, 0x0E, 0x19, 0x0F, 0x3C, 0x6B,
+    0x45, 0x45, 0x6F, 0x41, 0x00, 0x02, 0x00, 0x24, 0x00, 0x00, 0x02, 0x1F,
+    0x02, 0xC7, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x61, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x37, 0x37, 0x33, 0x17, 0x07, 0x0E, 0x02, 0x07,
+    0x27, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
+    0x14, 0x16, 0x16, 0x01, 0x22, 0x35, 0x5D, 0x45, 0x27, 0x0F, 0x1E, 0x2A,
+    0x1A, 0x60, 0x8C, 0x04, 0x7F, 0x1B, 0x29, 0x1F, 0x0D, 0x1D, 0x0D, 0x2C,
+    0x38, 0x3E, 0x1E, 0x3B, 0x63, 0x3B, 0x41, 0x72, 0x48, 0x22, 0x35, 0x1E,
+    0x1F, 0x34, 0x21, 0x23, 0x37, 0x1F, 0x1F, 0x36, 0x26, 0x45, 0x5B, 0x35,
+    0x22, 0x44, 0x4A, 0x4F, 0x2C, 0xA1, 0x0A, 0xCD, 0x2C, 0x50, 0x4A, 0x26,
+    0x50, 0x22, 0x37, 0x27, 0x15, 0x3F, 0x68, 0x3E, 0x4B, 0x75, 0x44, 0x7F,
+    0x1F, 0x38, 0x24, 0x1F, 0x37, 0x22, 0x21, 0x36, 0x20, 0x24, 0x37, 0x21,
+    0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x02, 0x02, 0x02, 0xC0, 0x00, 0x07,
+    0x00, 0x00, 0x73, 0x01, 0x17, 0x21, 0x35, 0x21, 0x17, 0x01, 0x5D, 0x01,
+    0x1B, 0x24, 0xFE, 0x96, 0x01, 0xC1, 0x0F, 0xFE, 0xF4, 0x02, 0x7C, 0x41,
+    0x85, 0x4D, 0xFD, 0x8D, 0x00, 0x03, 0x00, 0x2C, 0xFF, 0xFD, 0x02, 0x24,
+    0x02, 0xC4, 0x00, 0x25, 0x00, 0x35, 0x00, 0x45, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x07, 0x2E, 0x03, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x27,
+    0x1E, 0x03, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x13, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x28, 0x46, 0x72, 0x44, 0x13, 0x27, 0x38, 0x25, 0x0A,
+    0x1C, 0x2C, 0x20, 0x10, 0x3E, 0x69, 0x40, 0x40, 0x68, 0x3E, 0x0F, 0x1F,
+    0x2D, 0x1D, 0x07, 0x21, 0x37, 0x27, 0x16, 0x44, 0x72, 0x46, 0x1E, 0x32,
+    0x1C, 0x1C, 0x31, 0x1F, 0x1F, 0x31, 0x1C, 0x1C, 0x31, 0x1F, 0x1B, 0x2A,
+    0x19, 0x19, 0x2A, 0x1B, 0x1B, 0x2B, 0x18, 0x18, 0x2B, 0x03, 0x37, 0x5E,
+    0x3A, 0x24, 0x3C, 0x30, 0x24, 0x0D, 0x23, 0x0B, 0x1F, 0x28, 0x2F, 0x1A,
+    0x36, 0x56, 0x33, 0x33, 0x56, 0x36, 0x1A, 0x2E, 0x27, 0x20, 0x0C, 0x1F,
+    0x0A, 0x23, 0x31, 0x3C, 0x23, 0x3B, 0x5E, 0x36, 0x7B, 0x18, 0x29, 0x1B,
+    0x1C, 0x2B, 0x1A, 0x1A, 0x2B, 0x1C, 0x1A, 0x29, 0x19, 0x01, 0x37, 0x15,
+    0x23, 0x18, 0x17, 0x25, 0x16, 0x16, 0x25, 0x17, 0x18, 0x23, 0x15, 0x00,
+    0x00, 0x02, 0x00, 0x1E, 0x00, 0x00, 0x02, 0x1B, 0x02, 0xCB, 0x00, 0x1B,
+    0x00, 0x2B, 0x00, 0x00, 0x73, 0x27, 0x13, 0x17, 0x0E, 0x03, 0x23, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x07, 0x07, 0x03, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0xD6, 0x04, 0xD8, 0x15,
+    0x0D, 0x2C, 0x39, 0x3E, 0x1E, 0x39, 0x60, 0x3A, 0x43, 0x74, 0x49, 0x34,
+    0x5C, 0x46, 0x27, 0x0C, 0x18, 0x25, 0x18, 0x57, 0x4F, 0x22, 0x34, 0x1E,
+    0x1D, 0x34, 0x22, 0x1F, 0x31, 0x1D, 0x1D, 0x31, 0x0A, 0x01, 0xBA, 0x43,
+    0x22, 0x36, 0x29, 0x15, 0x3E, 0x66, 0x3D, 0x48, 0x74, 0x43, 0x25, 0x43,
+    0x56, 0x31, 0x20, 0x42, 0x47, 0x53, 0x32, 0xAE, 0x01, 0x67, 0x1E, 0x33,
+    0x1F, 0x22, 0x35, 0x1F, 0x1E, 0x34, 0x23, 0x1E, 0x33, 0x20, 0xFF, 0xFF,
+    0x00, 0x2A, 0xFF, 0xF6, 0x02, 0x63, 0x02, 0xC6, 0x06, 0x26, 0x02, 0x26,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0x69, 0x00, 0xCB, 0x01, 0x1A, 0x00, 0x02,
+    0x00, 0x22, 0xFF, 0xF6, 0x01, 0x69, 0x01, 0x73, 0x00, 0x0F, 0x00, 0x1C,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xC7, 0x30, 0x4A, 0x2B, 0x2A,
+    0x4A, 0x31, 0x30, 0x4A, 0x28, 0x2A, 0x4A, 0x2E, 0x13, 0x1B, 0x0F, 0x21,
+    0x1C, 0x1D, 0x23, 0x22, 0x0A, 0x32, 0x55, 0x37, 0x38, 0x56, 0x31, 0x31,
+    0x56, 0x38, 0x37, 0x55, 0x32, 0x5D, 0x18, 0x2C, 0x1D, 0x2C, 0x36, 0x36,
+    0x2C, 0x2C, 0x35, 0x00, 0x00, 0x01, 0x00, 0x21, 0xFF, 0xFF, 0x00, 0xDC,
+    0x01, 0x67, 0x00, 0x0A, 0x00, 0x00, 0x57, 0x11, 0x17, 0x07, 0x27, 0x37,
+    0x33, 0x11, 0x23, 0x22, 0x22, 0x77, 0x0E, 0x3A, 0x2A, 0x6F, 0x4C, 0x32,
+    0x0C, 0x19, 0x01, 0x01, 0x1E, 0x22, 0x24, 0x4E, 0x42, 0xFE, 0x98, 0x00,
+    0x00, 0x01, 0x00, 0x27, 0x00, 0x00, 0x01, 0x40, 0x01, 0x74, 0x00, 0x1D,
+    0x00, 0x00, 0x73, 0x27, 0x37, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x07, 0x07, 0x37, 0x33, 0x15, 0x3E, 0x0C, 0x65, 0x0D, 0x1D, 0x13,
+    0x0F, 0x0F, 0x12, 0x26, 0x10, 0x47, 0x13, 0x2F, 0x36, 0x20, 0x25, 0x36,
+    0x1F, 0x24, 0x33, 0x19, 0x3A, 0x02, 0xAF, 0x50, 0x58, 0x0A, 0x1B, 0x1F,
+    0x0F, 0x0E, 0x11, 0x1D, 0x18, 0x33, 0x1D, 0x2A, 0x15, 0x1C, 0x31, 0x1D,
+    0x25, 0x39, 0x2C, 0x11, 0x30, 0x14, 0x53, 0x00, 0x00, 0x01, 0x00, 0x2B,
+    0xFF, 0xF6, 0x01, 0x34, 0x01, 0x69, 0x00, 0x23, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x37, 0x17, 0x23, 0x35, 0x33, 0x17, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0xAD, 0x19,
+    0x2C, 0x29, 0x14, 0x29, 0x12, 0x23, 0x12, 0x18, 0x1F, 0x1C, 0x18, 0x0D,
+    0x1D, 0x0E, 0x16, 0x81, 0x0C, 0x99, 0xD0, 0x09, 0x71, 0x08, 0x09, 0x15,
+    0x07, 0x30, 0x3B, 0x25, 0x3D, 0x0A, 0x08, 0x0F, 0x0B, 0x47, 0x0B, 0x0A,
+    0x17, 0x14, 0x11, 0x15, 0x07, 0x04, 0x3C, 0x5F, 0x15, 0x53, 0x4E, 0x55,
+    0x07, 0x05, 0x06, 0x39, 0x2F, 0x24, 0x37, 0x1F, 0x00, 0x03, 0x00, 0x1F,
+    0xFF, 0xFF, 0x01, 0x68, 0x01, 0x6D, 0x00, 0x03, 0x00, 0x09, 0x00, 0x11,
+    0x00, 0x00, 0x65, 0x33, 0x15, 0x23, 0x27, 0x27, 0x33, 0x07, 0x35, 0x17,
+    0x13, 0x23, 0x35, 0x17, 0x23, 0x27, 0x37, 0x33, 0x01, 0x1D, 0x4B, 0x4B,
+    0xB2, 0x10, 0x90, 0x1C, 0x1D, 0x41, 0x6A, 0x1A, 0xAB, 0x13, 0xB1, 0x5D,
+    0x9C, 0x53, 0x31, 0x22, 0x1D, 0x9C, 0x0B, 0xFE, 0xEF, 0x67, 0x1D, 0x4D,
+    0xD7, 0x00, 0x00, 0x01, 0x00, 0x26, 0xFF, 0xF7, 0x01, 0x3E, 0x01, 0x66,
+    0x00, 0x22, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x37, 0x33,
+    0x15, 0x23, 0x37, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x9E, 0x1D, 0x45, 0x16, 0x2D, 0x11, 0x28, 0x16, 0x19,
+    0x1F, 0x1C, 0x18, 0x11, 0x21, 0x16, 0x2A, 0x19, 0xDF, 0xB0, 0x27, 0x18,
+    0x1D, 0x0F, 0x2C, 0x1E, 0x21, 0x36, 0x20, 0x29, 0x48, 0x09, 0x16, 0x11,
+    0x47, 0x0C, 0x0D, 0x19, 0x15, 0x12, 0x19, 0x08, 0x0E, 0x2C, 0xAB, 0x54,
+    0x24, 0x85, 0x13, 0x15, 0x12, 0x1E, 0x33, 0x1F, 0x28, 0x3C, 0x20, 0x00,
+    0x00, 0x02, 0x00, 0x23, 0xFF, 0xF7, 0x01, 0x45, 0x01, 0x72, 0x00, 0x1C,
+    0x00, 0x28, 0x00, 0x00, 0x57, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x07, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xB8, 0x44, 0x51,
+    0x28, 0x49, 0x33, 0x22, 0x3B, 0x16, 0x28, 0x0E, 0x24, 0x0F, 0x23, 0x29,
+    0x01, 0x35, 0x12, 0x43, 0x29, 0x23, 0x37, 0x1E, 0x25, 0x40, 0x27, 0x13,
+    0x1B, 0x19, 0x14, 0x16, 0x1B, 0x1B, 0x09, 0x5F, 0x4E, 0x3C, 0x5D, 0x35,
+    0x14, 0x12, 0x44, 0x0B, 0x0B, 0x35, 0x32, 0x40, 0x36, 0x3D, 0x1F, 0x32,
+    0x20, 0x27, 0x3B, 0x20, 0x4C, 0x1B, 0x15, 0x13, 0x1C, 0x1B, 0x13, 0x15,
+    0x1C, 0x00, 0x00, 0x01, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x33, 0x01, 0x66,
+    0x00, 0x08, 0x00, 0x00, 0x73, 0x35, 0x13, 0x17, 0x23, 0x35, 0x33, 0x17,
+    0x03, 0x44, 0x88, 0x1A, 0xBB, 0xE6, 0x22, 0x88, 0x09, 0x01, 0x2A, 0x27,
+    0x5A, 0x3D, 0xFE, 0xD7, 0x00, 0x03, 0x00, 0x2A, 0xFF, 0xF5, 0x01, 0x4C,
+    0x01, 0x72, 0x00, 0x1E, 0x00, 0x2A, 0x00, 0x36, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x07, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x0E, 0x02, 0x07, 0x27, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0x37, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0xBC, 0x29, 0x41, 0x28, 0x2B, 0x28, 0x03, 0x20,
+    0x25, 0x24, 0x3C, 0x27, 0x25, 0x3E, 0x24, 0x01, 0x10, 0x1F, 0x16, 0x01,
+    0x24, 0x2C, 0x28, 0x41, 0x27, 0x15, 0x1E, 0x1E, 0x15, 0x16, 0x1E, 0x1E,
+    0x16, 0x13, 0x1A, 0x1A, 0x13, 0x14, 0x19, 0x1A, 0x0B, 0x1F, 0x32, 0x1F,
+    0x21, 0x30, 0x0D, 0x10, 0x0C, 0x2A, 0x1F, 0x1E, 0x2F, 0x1D, 0x1D, 0x2F,
+    0x1E, 0x14, 0x1F, 0x19, 0x09, 0x10, 0x0B, 0x32, 0x21, 0x1F, 0x32, 0x1F,
+    0x48, 0x1C, 0x14, 0x13, 0x1A, 0x1A, 0x13, 0x14, 0x1C, 0xA1, 0x16, 0x10,
+    0x11, 0x17, 0x16, 0x12, 0x10, 0x16, 0x00, 0x02, 0x00, 0x22, 0xFF, 0xF7,
+    0x01, 0x43, 0x01, 0x72, 0x00, 0x1D, 0x00, 0x29, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x37, 0x06,
+    0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x14, 0x16, 0x9F, 0x21, 0x3B, 0x16, 0x28, 0x0E, 0x23, 0x12,
+    0x16, 0x21, 0x13, 0x35, 0x11, 0x43, 0x29, 0x24, 0x36, 0x1E, 0x26, 0x42,
+    0x29, 0x42, 0x4E, 0x27, 0x4A, 0x25, 0x15, 0x1C, 0x1B, 0x15, 0x13, 0x1C,
+    0x1A, 0x09, 0x14, 0x12, 0x44, 0x0B, 0x0B, 0x18, 0x2E, 0x21, 0x3F, 0x35,
+    0x3D, 0x1E, 0x34, 0x1F, 0x26, 0x3B, 0x21, 0x5F, 0x4E, 0x3C, 0x5D, 0x35,
+    0xD0, 0x1B, 0x13, 0x15, 0x1C, 0x1B, 0x15, 0x13, 0x1C, 0x00, 0xFF, 0xFF,
+    0x00, 0x22, 0xFF, 0x38, 0x01, 0x69, 0x00, 0xB5, 0x06, 0x07, 0x02, 0x31,
+    0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0x37, 0x00, 0xDC,
+    0x00, 0x9F, 0x06, 0x07, 0x02, 0x32, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF,
+    0x00, 0x27, 0xFF, 0x38, 0x01, 0x40, 0x00, 0xAC, 0x06, 0x07, 0x02, 0x33,
+    0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0x38, 0x01, 0x34,
+    0x00, 0xAB, 0x06, 0x07, 0x02, 0x34, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF,
+    0x00, 0x1F, 0xFF, 0x37, 0x01, 0x68, 0x00, 0xA5, 0x06, 0x07, 0x02, 0x35,
+    0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x26, 0xFF, 0x2F, 0x01, 0x3E,
+    0x00, 0x9E, 0x06, 0x07, 0x02, 0x36, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF,
+    0x00, 0x23, 0xFF, 0x39, 0x01, 0x45, 0x00, 0xB4, 0x06, 0x07, 0x02, 0x37,
+    0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0x38, 0x01, 0x33,
+    0x00, 0x9E, 0x06, 0x07, 0x02, 0x38, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF,
+    0x00, 0x2A, 0xFF, 0x37, 0x01, 0x4C, 0x00, 0xB4, 0x06, 0x07, 0x02, 0x39,
+    0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0x39, 0x01, 0x43,
+    0x00, 0xB4, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF,
+    0x00, 0x22, 0x01, 0x56, 0x01, 0x69, 0x02, 0xD3, 0x06, 0x07, 0x02, 0x31,
+    0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF, 0x00, 0x21, 0x01, 0x68, 0x00, 0xDC,
+    0x02, 0xD0, 0x06, 0x07, 0x02, 0x32, 0x00, 0x00, 0x01, 0x69, 0xFF, 0xFF,
+    0x00, 0x27, 0x01, 0x5C, 0x01, 0x40, 0x02, 0xD0, 0x06, 0x07, 0x02, 0x33,
+    0x00, 0x00, 0x01, 0x5C, 0xFF, 0xFF, 0x00, 0x2B, 0x01, 0x56, 0x01, 0x34,
+    0x02, 0xC9, 0x06, 0x07, 0x02, 0x34, 0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF,
+    0x00, 0x1F, 0x01, 0x5D, 0x01, 0x68, 0x02, 0xCB, 0x06, 0x07, 0x02, 0x35,
+    0x00, 0x00, 0x01, 0x5E, 0xFF, 0xFF, 0x00, 0x26, 0x01, 0x58, 0x01, 0x3E,
+    0x02, 0xC7, 0x06, 0x07, 0x02, 0x36, 0x00, 0x00, 0x01, 0x61, 0xFF, 0xFF,
+    0x00, 0x23, 0x01, 0x59, 0x01, 0x45, 0x02, 0xD4, 0x06, 0x07, 0x02, 0x37,
+    0x00, 0x00, 0x01, 0x62, 0xFF, 0xFF, 0x00, 0x2B, 0x01, 0x64, 0x01, 0x33,
+    0x02, 0xCA, 0x06, 0x07, 0x02, 0x38, 0x00, 0x00, 0x01, 0x64, 0xFF, 0xFF,
+    0x00, 0x2A, 0x01, 0x55, 0x01, 0x4C, 0x02, 0xD2, 0x06, 0x07, 0x02, 0x39,
+    0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF, 0x00, 0x22, 0x01, 0x57, 0x01, 0x43,
+    0x02, 0xD2, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF,
+    0x00, 0x22, 0x01, 0x9C, 0x01, 0x69, 0x03, 0x19, 0x06, 0x07, 0x02, 0x31,
+    0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF, 0x00, 0x21, 0x01, 0xAE, 0x00, 0xDC,
+    0x03, 0x16, 0x06, 0x07, 0x02, 0x32, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF,
+    0x00, 0x27, 0x01, 0xA2, 0x01, 0x40, 0x03, 0x16, 0x06, 0x07, 0x02, 0x33,
+    0x00, 0x00, 0x01, 0xA2, 0xFF, 0xFF, 0x00, 0x2B, 0x01, 0x9C, 0x01, 0x34,
+    0x03, 0x0F, 0x06, 0x07, 0x02, 0x34, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF,
+    0x00, 0x1F, 0x01, 0xA3, 0x01, 0x68, 0x03, 0x11, 0x06, 0x07, 0x02, 0x35,
+    0x00, 0x00, 0x01, 0xA4, 0xFF, 0xFF, 0x00, 0x26, 0x01, 0x9E, 0x01, 0x3E,
+    0x03, 0x0D, 0x06, 0x07, 0x02, 0x36, 0x00, 0x00, 0x01, 0xA7, 0xFF, 0xFF,
+    0x00, 0x23, 0x01, 0x9F, 0x01, 0x45, 0x03, 0x1A, 0x06, 0x07, 0x02, 0x37,
+    0x00, 0x00, 0x01, 0xA8, 0xFF, 0xFF, 0x00, 0x2B, 0x01, 0xAA, 0x01, 0x33,
+    0x03, 0x10, 0x06, 0x07, 0x02, 0x38, 0x00, 0x00, 0x01, 0xAA, 0xFF, 0xFF,
+    0x00, 0x2A, 0x01, 0x9B, 0x01, 0x4C, 0x03, 0x18, 0x06, 0x07, 0x02, 0x39,
+    0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF, 0x00, 0x22, 0x01, 0x9D, 0x01, 0x43,
+    0x03, 0x18, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00, 0x01, 0xA6, 0x00, 0x01,
+    0x00, 0x04, 0x00, 0x00, 0x02, 0x5A, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00,
+    0x73, 0x01, 0x33, 0x01, 0x04, 0x01, 0xD3, 0x83, 0xFE, 0x2C, 0x02, 0xBC,
+    0xFD, 0x44, 0xFF, 0xFF, 0x00, 0x29, 0x00, 0x00, 0x03, 0x0A, 0x02, 0xD0,
+    0x04, 0x27, 0x02, 0x32, 0x00, 0x08, 0x01, 0x69, 0x00, 0x26, 0x02, 0x59,
+    0x5D, 0x00, 0x00, 0x07, 0x02, 0x33, 0x01, 0xCA, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x29, 0xFF, 0xFF, 0x03, 0x06, 0x02, 0xD0, 0x04, 0x27, 0x02, 0x32,
+    0x00, 0x08, 0x01, 0x69, 0x00, 0x26, 0x02, 0x59, 0x5B, 0x00, 0x00, 0x07,
+    0x02, 0x35, 0x01, 0x9E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0xFF, 0xFF,
+    0x03, 0x19, 0x02, 0xC9, 0x04, 0x27, 0x02, 0x34, 0xFF, 0xEB, 0x01, 0x60,
+    0x00, 0x26, 0x02, 0x59, 0x76, 0x00, 0x00, 0x07, 0x02, 0x35, 0x01, 0xB1,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xF5, 0x03, 0x14, 0x02, 0xD0,
+    0x04, 0x27, 0x02, 0x32, 0x00, 0x1B, 0x01, 0x69, 0x00, 0x26, 0x02, 0x59,
+    0x5A, 0x00, 0x00, 0x07, 0x02, 0x39, 0x01, 0xC8, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x16, 0xFF, 0xF5, 0x03, 0x17, 0x02, 0xC9, 0x04, 0x27, 0x02, 0x34,
+    0xFF, 0xEB, 0x01, 0x60, 0x00, 0x26, 0x02, 0x59, 0x62, 0x00, 0x00, 0x07,
+    0x02, 0x39, 0x01, 0xCB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x22, 0xFF, 0xF5,
+    0x03, 0x3F, 0x02, 0xC7, 0x04, 0x27, 0x02, 0x36, 0xFF, 0xFC, 0x01, 0x61,
+    0x00, 0x27, 0x02, 0x59, 0x00, 0x86, 0x00, 0x00, 0x00, 0x07, 0x02, 0x39,
+    0x01, 0xF3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0xF5, 0x03, 0x24,
+    0x02, 0xCA, 0x04, 0x27, 0x02, 0x38, 0x00, 0x11, 0x01, 0x64, 0x00, 0x26,
+    0x02, 0x59, 0x62, 0x00, 0x00, 0x07, 0x02, 0x39, 0x01, 0xD9, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x2B, 0xFF, 0xF5, 0x00, 0xCC, 0x00, 0x9E, 0x00, 0x0B,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x7C, 0x27, 0x2A, 0x2D, 0x24, 0x26, 0x2A, 0x2C, 0x0B, 0x2C,
+    0x29, 0x25, 0x2F, 0x2C, 0x28, 0x26, 0x2F, 0x00, 0x00, 0x01, 0x00, 0x2A,
+    0xFF, 0x3F, 0x00, 0xED, 0x00, 0x7E, 0x00, 0x15, 0x00, 0x00, 0x57, 0x27,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x56, 0x2C, 0x27, 0x2F, 0x0A,
+    0x11, 0x16, 0x0F, 0x2A, 0x21, 0x1B, 0x2D, 0x1A, 0x16, 0x29, 0x37, 0xC1,
+    0x35, 0x13, 0x36, 0x14, 0x09, 0x14, 0x0F, 0x11, 0x1F, 0x12, 0x1D, 0x22,
+    0x1F, 0x37, 0x24, 0x20, 0x3D, 0x35, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x2B,
+    0xFF, 0xF6, 0x00, 0xCC, 0x02, 0x1B, 0x06, 0x26, 0x02, 0x69, 0x00, 0x01,
+    0x00, 0x07, 0x02, 0x69, 0x00, 0x00, 0x01, 0x7C, 0xFF, 0xFF, 0x00, 0x2B,
+    0xFF, 0x3F, 0x00, 0xEE, 0x02, 0x1B, 0x04, 0x26, 0x02, 0x6A, 0x01, 0x00,
+    0x00, 0x07, 0x02, 0x69, 0x00, 0x10, 0x01, 0x7D, 0xFF, 0xFF, 0x00, 0x2B,
+    0xFF, 0xF5, 0x02, 0x8B, 0x00, 0x9E, 0x04, 0x26, 0x02, 0x69, 0x00, 0x00,
+    0x00, 0x27, 0x02, 0x69, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x07, 0x02, 0x69,
+    0x01, 0xBF, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3C, 0xFF, 0xF5, 0x00, 0xDE,
+    0x02, 0xC4, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x77, 0x2E, 0x02, 0x35,
+    0x35, 0x33, 0x15, 0x14, 0x06, 0x06, 0x07, 0x03, 0x22, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x63, 0x08, 0x0F, 0x08, 0x95,
+    0x09, 0x0E, 0x08, 0x2D, 0x27, 0x2A, 0x2D, 0x24, 0x26, 0x2B, 0x2D, 0xFB,
+    0x3D, 0x84, 0x81, 0x3B, 0x4C, 0x4C, 0x3D, 0x84, 0x82, 0x3A, 0xFE, 0xFA,
+    0x2C, 0x29, 0x25, 0x2F, 0x2C, 0x28, 0x26, 0x2F, 0x00, 0x02, 0x00, 0x3B,
+    0xFF, 0x4E, 0x00, 0xDD, 0x02, 0x1D, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00,
+    0x53, 0x1E, 0x02, 0x15, 0x15, 0x23, 0x35, 0x34, 0x36, 0x36, 0x37, 0x13,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0xB6,
+    0x08, 0x0F, 0x08, 0x95, 0x09, 0x0E, 0x08, 0x2D, 0x27, 0x2A, 0x2D, 0x24,
+    0x26, 0x2B, 0x2D, 0x01, 0x17, 0x3D, 0x83, 0x82, 0x3B, 0x4C, 0x4C, 0x3D,
+    0x84, 0x82, 0x3A, 0x01, 0x06, 0x2C, 0x29, 0x25, 0x2F, 0x2C, 0x28, 0x26,
+    0x2F, 0x00, 0x00, 0x02, 0x00, 0x17, 0xFF, 0xF5, 0x01, 0xE8, 0x02, 0xC9,
+    0x00, 0x1C, 0x00, 0x28, 0x00, 0x00, 0x77, 0x27, 0x3E, 0x04, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x14, 0x0E, 0x02, 0x0F, 0x02, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0xC3, 0x1F, 0x21, 0x37, 0x2C, 0x1F,
+    0x11, 0x18, 0x28, 0x1B, 0x23, 0x45, 0x1B, 0x63, 0x2D, 0x7B, 0x43, 0x41,
+    0x68, 0x3D, 0x1E, 0x35, 0x48, 0x2B, 0x0C, 0x77, 0x2C, 0x24, 0x27, 0x2A,
+    0x2C, 0x25, 0x26, 0x2A, 0xE6, 0x87, 0x08, 0x15, 0x18, 0x1E, 0x25, 0x15,
+    0x16, 0x23, 0x13, 0x31, 0x34, 0x59, 0x44, 0x4B, 0x35, 0x5C, 0x39, 0x24,
+    0x45, 0x3D, 0x2E, 0x0E, 0x37, 0x9C, 0x25, 0x2F, 0x2C, 0x28, 0x26, 0x2F,
+    0x2C, 0x00, 0x00, 0x02, 0x00, 0x17, 0xFF, 0x4D, 0x01, 0xE8, 0x02, 0x21,
+    0x00, 0x1C, 0x00, 0x28, 0x00, 0x00, 0x41, 0x17, 0x0E, 0x04, 0x15, 0x14,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x3F, 0x02, 0x14, 0x06, 0x23, 0x22, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x01, 0x3C, 0x1F, 0x21, 0x37, 0x2C,
+    0x1F, 0x11, 0x18, 0x28, 0x1B, 0x23, 0x45, 0x1B, 0x63, 0x2D, 0x7B, 0x43,
+    0x41, 0x68, 0x3D, 0x1E, 0x35, 0x48, 0x2B, 0x0C, 0x77, 0x2C, 0x25, 0x26,
+    0x2A, 0x2C, 0x24, 0x27, 0x2A, 0x01, 0x30, 0x87, 0x08, 0x15, 0x18, 0x1E,
+    0x24, 0x16, 0x16, 0x23, 0x13, 0x31, 0x34, 0x59, 0x44, 0x4B, 0x35, 0x5C,
+    0x39, 0x24, 0x45, 0x3D, 0x2E, 0x0E, 0x37, 0x9C, 0x25, 0x2F, 0x2C, 0x28,
+    0x26, 0x2F, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0x00, 0xFD, 0x00, 0xCC,
+    0x01, 0xA6, 0x06, 0x07, 0x02, 0x69, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01,
+    0x00, 0x25, 0x00, 0xD8, 0x01, 0x36, 0x01, 0xE8, 0x00, 0x0F, 0x00, 0x00,
+    0x77, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0xAD, 0x25, 0x3E, 0x25, 0x24, 0x3E, 0x26, 0x26,
+    0x3E, 0x25, 0x25, 0x3E, 0xD8, 0x24, 0x3E, 0x25, 0x26, 0x3E, 0x25, 0x25,
+    0x3E, 0x26, 0x25, 0x3E, 0x24, 0x00, 0x00, 0x01, 0x00, 0x15, 0x01, 0x68,
+    0x01, 0x92, 0x02, 0xD4, 0x00, 0x17, 0x00, 0x00, 0x53, 0x37, 0x17, 0x07,
+    0x27, 0x37, 0x07, 0x27, 0x37, 0x17, 0x07, 0x27, 0x33, 0x07, 0x27, 0x37,
+    0x17, 0x07, 0x35, 0x17, 0x07, 0x27, 0x17, 0x17, 0xA4, 0x0C, 0x0D, 0x76,
+    0x30, 0x7F, 0x01, 0x80, 0x31, 0x79, 0x0F, 0x0D, 0x65, 0x0D, 0x0D, 0x73,
+    0x31, 0x82, 0x80, 0x30, 0x72, 0x0E, 0x0E, 0x01, 0x68, 0x81, 0x02, 0x50,
+    0x54, 0x36, 0x08, 0x3B, 0x53, 0x56, 0x01, 0x84, 0x8B, 0x07, 0x56, 0x54,
+    0x3B, 0x0B, 0x37, 0x52, 0x52, 0x02, 0x81, 0x00, 0x00, 0x04, 0x00, 0x2A,
+    0x00, 0x00, 0x02, 0xA2, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x61, 0x13, 0x33, 0x03, 0x25, 0x35, 0x21, 0x15,
+    0x05, 0x13, 0x33, 0x03, 0x03, 0x35, 0x21, 0x15, 0x01, 0x70, 0x78, 0x7C,
+    0x78, 0xFE, 0x3E, 0x02, 0x53, 0xFD, 0xEC, 0x78, 0x7C, 0x78, 0x95, 0x02,
+    0x52, 0x02, 0xBC, 0xFD, 0x44, 0x9D, 0x73, 0x73, 0x9D, 0x02, 0xBC, 0xFD,
+    0x44, 0x01, 0xB5, 0x73, 0x73, 0x00, 0x00, 0x01, 0x00, 0x0B, 0xFF, 0x75,
+    0x02, 0x36, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x57, 0x01, 0x33, 0x01,
+    0x0B, 0x01, 0x9F, 0x8C, 0xFE, 0x62, 0x8B, 0x03, 0x47, 0xFC, 0xB9, 0x00,
+    0x00, 0x01, 0x00, 0x1D, 0xFF, 0x95, 0x02, 0x39, 0x02, 0xBC, 0x00, 0x03,
+    0x00, 0x00, 0x45, 0x01, 0x33, 0x01, 0x01, 0xAB, 0xFE, 0x72, 0x8C, 0x01,
+    0x90, 0x6B, 0x03, 0x27, 0xFC, 0xD9, 0xFF, 0xFF, 0x00, 0x2B, 0x01, 0x2B,
+    0x00, 0xCC, 0x01, 0xD4, 0x06, 0x07, 0x02, 0x69, 0x00, 0x00, 0x01, 0x36,
+    0xFF, 0xFF, 0x00, 0x2D, 0x00, 0xDB, 0x01, 0x3E, 0x01, 0xEB, 0x04, 0x06,
+    0x02, 0x73, 0x08, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0x75, 0x02, 0x36,
+    0x02, 0xBC, 0x04, 0x06, 0x02, 0x76, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1D,
+    0xFF, 0x95, 0x02, 0x39, 0x02, 0xBC, 0x04, 0x06, 0x02, 0x77, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xF4, 0x01, 0x2B, 0x00, 0x95, 0x01, 0xD4, 0x04, 0x07,
+    0x02, 0x69, 0xFF, 0xC9, 0x01, 0x36, 0xFF, 0xFF, 0xFF, 0x2B, 0x01, 0x2B,
+    0xFF, 0xCC, 0x01, 0xD4, 0x04, 0x07, 0x02, 0x69, 0xFF, 0x00, 0x01, 0x36,
+    0x00, 0x01, 0x00, 0x34, 0x00, 0xDD, 0x01, 0x7B, 0x01, 0x61, 0x00, 0x03,
+    0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x34, 0x01, 0x47, 0xDD, 0x84, 0x84,
+    0xFF, 0xFF, 0x00, 0x38, 0x00, 0xDD, 0x01, 0x7F, 0x01, 0x61, 0x06, 0x06,
+    0x02, 0x7E, 0x04, 0x00, 0x00, 0x01, 0x00, 0x38, 0x00, 0xE1, 0x02, 0x01,
+    0x01, 0x5E, 0x00, 0x03, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x38, 0x01,
+    0xC9, 0xE1, 0x7D, 0x7D, 0x00, 0x01, 0x00, 0x38, 0x00, 0xE1, 0x03, 0x59,
+    0x01, 0x5F, 0x00, 0x03, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x38, 0x03,
+    0x21, 0xE1, 0x7E, 0x7E, 0xFF, 0xFF, 0x00, 0x34, 0x00, 0xE1, 0x01, 0xFD,
+    0x01, 0x5E, 0x06, 0x06, 0x02, 0x80, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x34,
+    0x00, 0xE1, 0x03, 0x55, 0x01, 0x5F, 0x06, 0x06, 0x02, 0x81, 0xFC, 0x00,
+    0xFF, 0xFF, 0x00, 0x34, 0x00, 0xDD, 0x01, 0x7B, 0x01, 0x61, 0x06, 0x06,
+    0x02, 0x7E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2C, 0xFF, 0x4A, 0x02, 0x84,
+    0xFF, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x57, 0x35, 0x21, 0x15, 0x2C, 0x02,
+    0x58, 0xB6, 0x72, 0x72, 0xFF, 0xFF, 0x00, 0x34, 0x01, 0x08, 0x01, 0x7B,
+    0x01, 0x8C, 0x06, 0x06, 0x02, 0x7E, 0x00, 0x2B, 0xFF, 0xFF, 0x00, 0x34,
+    0x01, 0x0C, 0x01, 0xFD, 0x01, 0x89, 0x06, 0x06, 0x02, 0x80, 0xFC, 0x2B,
+    0xFF, 0xFF, 0x00, 0x34, 0x01, 0x0F, 0x03, 0x55, 0x01, 0x8D, 0x06, 0x06,
+    0x02, 0x81, 0xFC, 0x2E, 0x00, 0x01, 0x00, 0x28, 0xFF, 0x46, 0x01, 0x72,
+    0x02, 0xBE, 0x00, 0x0D, 0x00, 0x00, 0x45, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x01, 0x22, 0x7A, 0x80,
+    0x81, 0x7A, 0x4F, 0x60, 0x5F, 0x5F, 0x60, 0xBA, 0x4C, 0xE4, 0x8C, 0x8B,
+    0xE5, 0x4C, 0x4E, 0x42, 0xBF, 0x6D, 0x6D, 0xBF, 0x42, 0x00, 0x00, 0x01,
+    0x00, 0x0C, 0xFF, 0x46, 0x01, 0x56, 0x02, 0xBE, 0x00, 0x0D, 0x00, 0x00,
+    0x57, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x37, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x5B, 0x4F, 0x60, 0x5F, 0x5F, 0x60, 0x50, 0x7A, 0x80, 0x81,
+    0xBA, 0x4E, 0x42, 0xBF, 0x6D, 0x6D, 0xBF, 0x42, 0x4E, 0x4C, 0xE4, 0x8C,
+    0x8B, 0xE5, 0x00, 0x01, 0x00, 0x28, 0xFF, 0x34, 0x01, 0x8B, 0x02, 0xC0,
+    0x00, 0x25, 0x00, 0x00, 0x45, 0x2E, 0x03, 0x35, 0x37, 0x34, 0x26, 0x27,
+    0x23, 0x35, 0x33, 0x36, 0x36, 0x35, 0x27, 0x34, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0x15, 0x17, 0x14, 0x06, 0x07, 0x35, 0x16, 0x16, 0x15, 0x07, 0x14,
+    0x16, 0x16, 0x17, 0x01, 0x6D, 0x32, 0x4A, 0x30, 0x17, 0x01, 0x2E, 0x2B,
+    0x2A, 0x2C, 0x2B, 0x2C, 0x01, 0x5D, 0x66, 0x1E, 0x26, 0x2B, 0x11, 0x02,
+    0x41, 0x44, 0x44, 0x41, 0x02, 0x11, 0x2B, 0x26, 0xCC, 0x0A, 0x21, 0x2F,
+    0x41, 0x2A, 0x5F, 0x35, 0x35, 0x01, 0x6E, 0x01, 0x34, 0x36, 0x5F, 0x52,
+    0x5D, 0x16, 0x64, 0x0D, 0x1A, 0x2B, 0x25, 0x57, 0x3A, 0x4E, 0x11, 0x0B,
+    0x13, 0x4E, 0x39, 0x57, 0x23, 0x29, 0x1A, 0x0D, 0x00, 0x01, 0x00, 0x1A,
+    0xFF, 0x34, 0x01, 0x7D, 0x02, 0xC0, 0x00, 0x25, 0x00, 0x00, 0x57, 0x27,
+    0x3E, 0x02, 0x35, 0x27, 0x34, 0x36, 0x37, 0x17, 0x26, 0x26, 0x35, 0x37,
+    0x34, 0x26, 0x26, 0x27, 0x37, 0x1E, 0x03, 0x15, 0x07, 0x14, 0x16, 0x17,
+    0x33, 0x15, 0x23, 0x06, 0x06, 0x15, 0x17, 0x14, 0x06, 0x38, 0x1E, 0x26,
+    0x2A, 0x13, 0x02, 0x41, 0x43, 0x01, 0x44, 0x41, 0x02, 0x12, 0x2A, 0x27,
+    0x1E, 0x33, 0x49, 0x31, 0x17, 0x01, 0x2E, 0x2B, 0x29, 0x2B, 0x2B, 0x2C,
+    0x01, 0x5E, 0xCC, 0x64, 0x0D, 0x1A, 0x2B, 0x25, 0x57, 0x3A, 0x4E, 0x11,
+    0x0B, 0x13, 0x4E, 0x39, 0x57, 0x24, 0x28, 0x1A, 0x0D, 0x68, 0x0A, 0x21,
+    0x2F, 0x41, 0x2A, 0x5F, 0x35, 0x35, 0x01, 0x6E, 0x01, 0x34, 0x36, 0x5F,
+    0x52, 0x5D, 0x00, 0x01, 0x00, 0x50, 0xFF, 0x42, 0x01, 0x6C, 0x02, 0xBC,
+    0x00, 0x09, 0x00, 0x00, 0x57, 0x11, 0x21, 0x15, 0x23, 0x37, 0x11, 0x27,
+    0x33, 0x15, 0x50, 0x01, 0x1C, 0x9C, 0x06, 0x0A, 0xA0, 0xBE, 0x03, 0x7A,
+    0x76, 0x08, 0xFD, 0x5E, 0x0C, 0x76, 0x00, 0x01, 0x00, 0x32, 0xFF, 0x42,
+    0x01, 0x4E, 0x02, 0xBC, 0x00, 0x09, 0x00, 0x00, 0x57, 0x35, 0x33, 0x07,
+    0x11, 0x17, 0x23, 0x35, 0x21, 0x11, 0x32, 0x9C, 0x06, 0x0A, 0xA0, 0x01,
+    0x1C, 0xBE, 0x76, 0x08, 0x02, 0xA2, 0x0C, 0x76, 0xFC, 0x86, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0x78, 0x01, 0x72, 0x02, 0xF0, 0x04, 0x06, 0x02, 0x89,
+    0x00, 0x32, 0xFF, 0xFF, 0x00, 0x0C, 0xFF, 0x78, 0x01, 0x56, 0x02, 0xF0,
+    0x04, 0x06, 0x02, 0x8A, 0x00, 0x32, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x66,
+    0x01, 0x8B, 0x02, 0xF2, 0x06, 0x06, 0x02, 0x8B, 0x00, 0x32, 0xFF, 0xFF,
+    0x00, 0x1A, 0xFF, 0x66, 0x01, 0x7D, 0x02, 0xF2, 0x06, 0x06, 0x02, 0x8C,
+    0x00, 0x32, 0xFF, 0xFF, 0x00, 0x50, 0xFF, 0x6A, 0x01, 0x6C, 0x02, 0xE4,
+    0x06, 0x06, 0x02, 0x8D, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x32, 0xFF, 0x6A,
+    0x01, 0x4E, 0x02, 0xE4, 0x06, 0x06, 0x02, 0x8E, 0x00, 0x28, 0xFF, 0xFF,
+    0x00, 0x2A, 0xFF, 0x3F, 0x00, 0xED, 0x00, 0x7E, 0x06, 0x06, 0x02, 0x6A,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2A, 0xFF, 0x3F, 0x01, 0xCE, 0x00, 0x7E,
+    0x04, 0x26, 0x02, 0x6A, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6A, 0x00, 0xE1,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0x01, 0xBA, 0x01, 0xCF, 0x02, 0xED,
+    0x04, 0x26, 0x02, 0x99, 0x00, 0xFB, 0x00, 0x07, 0x02, 0x99, 0x00, 0xDF,
+    0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x18, 0x01, 0xBC, 0x01, 0xBE, 0x02, 0xEF,
+    0x04, 0x26, 0x02, 0x9A, 0x00, 0x00, 0x00, 0x07, 0x02, 0x9A, 0x00, 0xDD,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x01, 0xBF, 0x00, 0xF1, 0x02, 0xF2,
+    0x00, 0x15, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
+    0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x90, 0x1D, 0x2F, 0x1C, 0x18, 0x2A, 0x3A, 0x21, 0x2C, 0x29, 0x33,
+    0x11, 0x0D, 0x17, 0x11, 0x2A, 0x01, 0xBF, 0x1F, 0x37, 0x24, 0x1E, 0x39,
+    0x32, 0x27, 0x09, 0x35, 0x12, 0x32, 0x12, 0x0C, 0x14, 0x09, 0x12, 0x1D,
+    0x11, 0x1D, 0x22, 0x00, 0x00, 0x01, 0x00, 0x18, 0x01, 0xBC, 0x00, 0xE1,
+    0x02, 0xEF, 0x00, 0x15, 0x00, 0x00, 0x53, 0x27, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x0E, 0x02, 0x43, 0x2B, 0x29, 0x33, 0x11, 0x0D, 0x17, 0x11, 0x29,
+    0x21, 0x1E, 0x2F, 0x1C, 0x18, 0x2B, 0x39, 0x01, 0xBC, 0x35, 0x11, 0x33,
+    0x12, 0x0C, 0x15, 0x08, 0x12, 0x1D, 0x11, 0x1D, 0x22, 0x1F, 0x37, 0x24,
+    0x1E, 0x39, 0x32, 0x26, 0xFF, 0xFF, 0x00, 0x0B, 0x00, 0x22, 0x01, 0xF4,
+    0x01, 0xE5, 0x04, 0x27, 0x02, 0x9D, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0x9D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x26, 0x00, 0x24, 0x02, 0x11,
+    0x01, 0xE7, 0x04, 0x27, 0x02, 0x9E, 0x00, 0xEF, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0x9E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x00, 0x22, 0x01, 0x07,
+    0x01, 0xE5, 0x00, 0x07, 0x00, 0x00, 0x77, 0x27, 0x35, 0x37, 0x17, 0x07,
+    0x37, 0x17, 0xB5, 0xAA, 0xA9, 0x53, 0x7A, 0x01, 0x79, 0x22, 0xDB, 0x0A,
+    0xDE, 0x39, 0xB6, 0x1B, 0xB6, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00, 0x24,
+    0x01, 0x23, 0x01, 0xE7, 0x00, 0x07, 0x00, 0x00, 0x77, 0x27, 0x37, 0x07,
+    0x27, 0x37, 0x17, 0x15, 0x79, 0x52, 0x79, 0x01, 0x79, 0x53, 0xAA, 0x24,
+    0x39, 0xB6, 0x1B, 0xB6, 0x39, 0xDB, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x2A,
+    0x01, 0xB6, 0x01, 0xB0, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x41, 0x13, 0x33, 0x03, 0x21, 0x13, 0x33, 0x03, 0x01, 0x07, 0x15, 0x94,
+    0x52, 0xFE, 0xCC, 0x15, 0x95, 0x53, 0x01, 0xB6, 0x01, 0x06, 0xFE, 0xFA,
+    0x01, 0x06, 0xFE, 0xFA, 0x00, 0x01, 0x00, 0x2A, 0x01, 0xB6, 0x00, 0xD4,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x53, 0x13, 0x33, 0x03, 0x2A, 0x15,
+    0x95, 0x53, 0x01, 0xB6, 0x01, 0x06, 0xFE, 0xFA, 0xFF, 0xFF, 0x00, 0x0B,
+    0x00, 0x6C, 0x01, 0xF4, 0x02, 0x2F, 0x04, 0x27, 0x02, 0x9D, 0x00, 0xEC,
+    0x00, 0x4A, 0x00, 0x06, 0x02, 0x9D, 0x00, 0x4A, 0xFF, 0xFF, 0x00, 0x26,
+    0x00, 0x6E, 0x02, 0x11, 0x02, 0x31, 0x04, 0x27, 0x02, 0x9E, 0x00, 0xEF,
+    0x00, 0x4A, 0x00, 0x06, 0x02, 0x9E, 0x00, 0x4A, 0xFF, 0xFF, 0x00, 0x0B,
+    0x00, 0x73, 0x01, 0x07, 0x02, 0x36, 0x06, 0x06, 0x02, 0x9D, 0x00, 0x51,
+    0xFF, 0xFF, 0x00, 0x26, 0x00, 0x75, 0x01, 0x23, 0x02, 0x38, 0x06, 0x06,
+    0x02, 0x9E, 0x00, 0x51, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xE1, 0x02, 0x22,
+    0x02, 0xB9, 0x00, 0x1C, 0x00, 0x20, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x13, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x03, 0x06,
+    0x06, 0x03, 0x35, 0x05, 0x15, 0x6A, 0x1E, 0x38, 0x15, 0x2D, 0x0F, 0x1A,
+    0x11, 0x0F, 0x17, 0x10, 0x05, 0x3E, 0x0E, 0x63, 0x53, 0x24, 0x3E, 0x1D,
+    0x2E, 0x14, 0x1D, 0x0F, 0x21, 0x23, 0x07, 0x3E, 0x10, 0x61, 0x69, 0x01,
+    0x7D, 0x1F, 0x10, 0x10, 0x6C, 0x08, 0x07, 0x11, 0x21, 0x19, 0x01, 0x66,
+    0x57, 0x53, 0x12, 0x13, 0x69, 0x0A, 0x08, 0x25, 0x23, 0xFE, 0x9B, 0x5A,
+    0x55, 0x01, 0x66, 0x72, 0x01, 0x72, 0x00, 0x02, 0x00, 0x28, 0xFF, 0x5E,
+    0x03, 0x9D, 0x02, 0xC6, 0x00, 0x50, 0x00, 0x62, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x16, 0x17, 0x07, 0x37, 0x33, 0x03, 0x06, 0x16, 0x16, 0x33, 0x32, 0x3E,
+    0x02, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E,
+    0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x03, 0x32, 0x36,
+    0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x01, 0x9E, 0x57, 0x8B, 0x61, 0x33, 0x53, 0x93, 0xC3,
+    0x6F, 0x50, 0x80, 0x5C, 0x31, 0x27, 0x46, 0x5D, 0x36, 0x25, 0x3A, 0x20,
+    0x05, 0x01, 0x16, 0x10, 0x33, 0x43, 0x28, 0x2D, 0x47, 0x28, 0x23, 0x42,
+    0x58, 0x34, 0x1F, 0x31, 0x1F, 0x03, 0x1C, 0x1C, 0x82, 0x38, 0x03, 0x0A,
+    0x14, 0x0C, 0x1C, 0x31, 0x24, 0x15, 0x40, 0x7A, 0x56, 0x66, 0xA5, 0x75,
+    0x3E, 0x27, 0x4A, 0x6E, 0x46, 0x2F, 0x44, 0x3E, 0x26, 0x25, 0x3B, 0x54,
+    0x48, 0x16, 0x1C, 0x36, 0x27, 0x05, 0x03, 0x04, 0x10, 0x1E, 0x16, 0x22,
+    0x37, 0x20, 0x1E, 0xA2, 0x35, 0x61, 0x88, 0x52, 0x75, 0xBB, 0x83, 0x45,
+    0x2D, 0x54, 0x73, 0x46, 0x45, 0x7C, 0x61, 0x37, 0x1A, 0x2D, 0x1F, 0x11,
+    0x22, 0x12, 0x14, 0x30, 0x44, 0x23, 0x2F, 0x54, 0x37, 0x30, 0x63, 0x53,
+    0x33, 0x20, 0x38, 0x26, 0x26, 0x99, 0xFE, 0xC6, 0x11, 0x15, 0x0A, 0x27,
+    0x44, 0x59, 0x32, 0x4B, 0x6C, 0x39, 0x39, 0x6E, 0x9C, 0x63, 0x45, 0x6B,
+    0x4C, 0x27, 0x0D, 0x1B, 0x14, 0x43, 0x1E, 0x1F, 0x0C, 0x01, 0x42, 0x25,
+    0x3C, 0x23, 0x0F, 0x18, 0x0B, 0x16, 0x20, 0x11, 0x32, 0x50, 0x2C, 0x25,
+    0x2A, 0x00, 0x00, 0x02, 0x00, 0x32, 0xFF, 0xF6, 0x02, 0xF4, 0x02, 0xCA,
+    0x00, 0x20, 0x00, 0x3B, 0x00, 0x00, 0x61, 0x2F, 0x02, 0x2E, 0x03, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x1F, 0x03, 0x05, 0x22, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x33, 0x32, 0x3E, 0x02, 0x37, 0x33, 0x0E, 0x04, 0x02, 0x42, 0x4C, 0x2E,
+    0x9C, 0x22, 0x33, 0x21, 0x10, 0x38, 0x62, 0x41, 0x30, 0x55, 0x3E, 0x0D,
+    0x6F, 0x11, 0x2D, 0x20, 0x18, 0x22, 0x12, 0x1D, 0x2D, 0x2F, 0x12, 0x5F,
+    0x38, 0x9A, 0xFE, 0x4C, 0x4C, 0x7A, 0x48, 0x55, 0x54, 0x58, 0x3A, 0x3A,
+    0x22, 0x43, 0x2E, 0x29, 0x47, 0x38, 0x24, 0x07, 0x83, 0x09, 0x2B, 0x41,
+    0x54, 0x65, 0x50, 0x2C, 0xA8, 0x25, 0x42, 0x3B, 0x34, 0x17, 0x35, 0x54,
+    0x30, 0x21, 0x3B, 0x28, 0x43, 0x2A, 0x22, 0x10, 0x1D, 0x16, 0x15, 0x36,
+    0x39, 0x33, 0x13, 0x68, 0x35, 0xA5, 0x0A, 0x3D, 0x67, 0x3E, 0x4B, 0x74,
+    0x1F, 0x5B, 0x0C, 0x3B, 0x2F, 0x25, 0x36, 0x1E, 0x22, 0x3D, 0x55, 0x35,
+    0x3F, 0x6C, 0x56, 0x3E, 0x20, 0x00, 0x00, 0x01, 0x00, 0x2D, 0x00, 0x00,
+    0x02, 0x90, 0x02, 0xBC, 0x00, 0x13, 0x00, 0x00, 0x73, 0x11, 0x17, 0x23,
+    0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x21, 0x11, 0x23, 0x11,
+    0x17, 0x23, 0x37, 0x11, 0xF7, 0x27, 0x35, 0x36, 0x55, 0x31, 0x38, 0x65,
+    0x44, 0x01, 0x82, 0x93, 0x27, 0xDE, 0x44, 0x01, 0x3A, 0x27, 0x36, 0x5F,
+    0x3C, 0x41, 0x62, 0x35, 0xFD, 0x44, 0x02, 0x94, 0x40, 0x38, 0xFD, 0x74,
+    0x00, 0x02, 0x00, 0x26, 0xFF, 0x75, 0x02, 0x16, 0x02, 0xCB, 0x00, 0x2A,
+    0x00, 0x52, 0x00, 0x00, 0x65, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x27,
+    0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17,
+    0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x17, 0x17,
+    0x16, 0x16, 0x07, 0x0E, 0x02, 0x03, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x27, 0x27, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x17,
+    0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x01, 0x54, 0x1F, 0x1F, 0x27,
+    0x12, 0x1C, 0x20, 0x63, 0x18, 0x35, 0x2F, 0x1D, 0x1A, 0x36, 0x53, 0x38,
+    0x2C, 0x4E, 0x3E, 0x17, 0x4A, 0x17, 0x2E, 0x2D, 0x16, 0x25, 0x2C, 0x13,
+    0x24, 0x19, 0x57, 0x4B, 0x48, 0x02, 0x02, 0x2F, 0x55, 0x7E, 0x2D, 0x57,
+    0x49, 0x1A, 0x47, 0x28, 0x54, 0x23, 0x29, 0x2D, 0x17, 0x25, 0x18, 0x60,
+    0x46, 0x45, 0x2B, 0x52, 0x39, 0x1E, 0x17, 0x20, 0x11, 0x21, 0x24, 0x4F,
+    0x2F, 0x4C, 0x2C, 0x2F, 0x62, 0x83, 0x4A, 0x03, 0x13, 0x1B, 0x10, 0x14,
+    0x1A, 0x0B, 0x20, 0x0A, 0x1D, 0x2A, 0x3E, 0x29, 0x24, 0x3E, 0x2F, 0x1B,
+    0x15, 0x27, 0x1B, 0x53, 0x15, 0x1A, 0x0B, 0x21, 0x1A, 0x10, 0x1A, 0x15,
+    0x08, 0x1E, 0x1A, 0x4F, 0x38, 0x2E, 0x41, 0x25, 0xFE, 0xEF, 0x17, 0x2A,
+    0x1A, 0x5A, 0x24, 0x24, 0x1E, 0x1C, 0x10, 0x18, 0x13, 0x08, 0x21, 0x19,
+    0x4E, 0x39, 0x29, 0x44, 0x2A, 0x02, 0x4F, 0x03, 0x12, 0x19, 0x12, 0x14,
+    0x1E, 0x0C, 0x1A, 0x11, 0x2D, 0x40, 0x30, 0x32, 0x4F, 0x2E, 0x00, 0x03,
+    0x00, 0x1D, 0xFF, 0xF1, 0x02, 0xF7, 0x02, 0xCB, 0x00, 0x13, 0x00, 0x32,
+    0x00, 0x46, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x07, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x01, 0x8A, 0x4C, 0x85, 0x63, 0x39,
+    0x39, 0x63, 0x85, 0x4C, 0x4C, 0x84, 0x65, 0x38, 0x38, 0x65, 0x84, 0x3B,
+    0x3C, 0x60, 0x39, 0x39, 0x60, 0x3C, 0x23, 0x43, 0x1F, 0x2D, 0x10, 0x1C,
+    0x19, 0x0B, 0x1D, 0x2E, 0x1A, 0x1A, 0x2E, 0x1D, 0x13, 0x2A, 0x16, 0x2E,
+    0x1F, 0x46, 0x35, 0x3D, 0x69, 0x50, 0x2D, 0x2D, 0x50, 0x69, 0x3D, 0x3C,
+    0x6A, 0x4F, 0x2E, 0x2E, 0x4E, 0x6B, 0x0F, 0x38, 0x64, 0x84, 0x4D, 0x4D,
+    0x84, 0x64, 0x38, 0x38, 0x64, 0x84, 0x4D, 0x4D, 0x84, 0x64, 0x38, 0x9E,
+    0x36, 0x5D, 0x3C, 0x39, 0x5E, 0x38, 0x18, 0x17, 0x60, 0x0C, 0x0E, 0x07,
+    0x1A, 0x2C, 0x1B, 0x1D, 0x2D, 0x19, 0x10, 0x10, 0x60, 0x16, 0x16, 0x54,
+    0x2D, 0x50, 0x69, 0x3D, 0x3D, 0x6A, 0x4F, 0x2D, 0x2D, 0x4F, 0x6A, 0x3D,
+    0x3D, 0x69, 0x50, 0x2D, 0x00, 0x05, 0x00, 0x0E, 0x00, 0xF3, 0x01, 0xF4,
+    0x02, 0xD5, 0x00, 0x12, 0x00, 0x22, 0x00, 0x26, 0x00, 0x32, 0x00, 0x3D,
+    0x00, 0x00, 0x65, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x37, 0x27,
+    0x37, 0x17, 0x23, 0x35, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x23,
+    0x37, 0x15, 0x35, 0x27, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x23,
+    0x37, 0x01, 0x03, 0x44, 0x6F, 0x42, 0x26, 0x43, 0x59, 0x33, 0x32, 0x57,
+    0x42, 0x26, 0x25, 0x42, 0x57, 0x33, 0x31, 0x51, 0x30, 0x30, 0x51, 0x31,
+    0x33, 0x52, 0x31, 0x31, 0x52, 0x55, 0x25, 0x3F, 0x33, 0xCF, 0x76, 0x24,
+    0x2E, 0x30, 0x22, 0x3D, 0x10, 0x0E, 0x27, 0x0D, 0x12, 0x0F, 0x0E, 0x2B,
+    0x10, 0xF3, 0x41, 0x6D, 0x43, 0x33, 0x57, 0x41, 0x26, 0x26, 0x42, 0x57,
+    0x32, 0x32, 0x58, 0x41, 0x26, 0x40, 0x2F, 0x51, 0x31, 0x31, 0x51, 0x30,
+    0x30, 0x51, 0x31, 0x32, 0x50, 0x2F, 0x3C, 0x5C, 0x10, 0x6C, 0xEF, 0x2A,
+    0x21, 0x21, 0x2B, 0x0B, 0x63, 0x80, 0x07, 0x0D, 0x0A, 0x0B, 0x0C, 0x08,
+    0x00, 0x03, 0x00, 0x21, 0x01, 0x4C, 0x03, 0x20, 0x02, 0xBC, 0x00, 0x0F,
+    0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x41, 0x11, 0x33, 0x17, 0x23, 0x37,
+    0x33, 0x11, 0x23, 0x13, 0x37, 0x07, 0x23, 0x27, 0x17, 0x13, 0x21, 0x11,
+    0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x01, 0x77, 0x68, 0x87, 0x38, 0x88,
+    0x6A, 0x6E, 0x04, 0x3C, 0x88, 0x42, 0x8D, 0x45, 0x04, 0xFE, 0x96, 0x6D,
+    0xC6, 0x01, 0x23, 0x01, 0x4C, 0x01, 0x70, 0xDD, 0xDD, 0xFE, 0x90, 0x01,
+    0x1B, 0x14, 0xE5, 0xED, 0x17, 0xFE, 0xE0, 0x01, 0x58, 0xFE, 0xA8, 0x01,
+    0x0F, 0x61, 0x61, 0x00, 0x00, 0x02, 0x00, 0x66, 0x01, 0x8B, 0x01, 0xAE,
+    0x02, 0xC9, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x41, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x0A, 0x2E, 0x4A, 0x2C, 0x2B, 0x4A, 0x2F,
+    0x2F, 0x4A, 0x2B, 0x2C, 0x4A, 0x2E, 0x13, 0x1E, 0x12, 0x12, 0x1E, 0x13,
+    0x13, 0x1F, 0x11, 0x12, 0x1E, 0x01, 0x8B, 0x2A, 0x48, 0x2C, 0x2D, 0x49,
+    0x2A, 0x2A, 0x49, 0x2C, 0x2C, 0x49, 0x2A, 0x57, 0x13, 0x21, 0x14, 0x14,
+    0x21, 0x12, 0x13, 0x21, 0x14, 0x14, 0x21, 0x12, 0xFF, 0xFF, 0x00, 0x2A,
+    0x01, 0xB6, 0x01, 0xB0, 0x02, 0xBC, 0x06, 0x06, 0x02, 0x9F, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x4E, 0xFF, 0x3F, 0x00, 0xD4, 0x02, 0xE4, 0x00, 0x03,
+    0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x4E, 0x86, 0xC1, 0x03, 0xA5, 0xFC,
+    0x5B, 0x00, 0x00, 0x02, 0x00, 0x50, 0xFF, 0x36, 0x00, 0xD8, 0x02, 0xE4,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x03, 0x11,
+    0x33, 0x11, 0x50, 0x88, 0x88, 0x88, 0xCA, 0x01, 0x8C, 0xFE, 0x74, 0x02,
+    0x23, 0x01, 0x8B, 0xFE, 0x75, 0x00, 0x00, 0x02, 0x00, 0x2A, 0x00, 0xD0,
+    0x01, 0x8E, 0x02, 0xD1, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x77, 0x11,
+    0x33, 0x11, 0x27, 0x35, 0x21, 0x15, 0x97, 0x89, 0xF6, 0x01, 0x64, 0xD0,
+    0x02, 0x01, 0xFD, 0xFF, 0xFE, 0x75, 0x75, 0x00, 0x00, 0x01, 0x00, 0x13,
+    0xFF, 0xF6, 0x02, 0x1B, 0x02, 0xF3, 0x00, 0x38, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x3E, 0x02, 0x33, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x07, 0x0E, 0x02, 0x07, 0x27, 0x36, 0x36, 0x37,
+    0x3E, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x07, 0x0E, 0x03,
+    0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x01, 0x2D, 0x39, 0x58, 0x32, 0x0D, 0x19, 0x10, 0x1B, 0x4A, 0x5A, 0x31,
+    0x40, 0x4B, 0x26, 0x47, 0x33, 0x29, 0x66, 0x74, 0x40, 0x25, 0x53, 0x90,
+    0x37, 0x22, 0x36, 0x26, 0x14, 0x16, 0x14, 0x0F, 0x1C, 0x1A, 0x18, 0x0B,
+    0x0B, 0x15, 0x13, 0x0A, 0x17, 0x2A, 0x1C, 0x0E, 0x1E, 0x1E, 0x0C, 0x2F,
+    0x23, 0x56, 0x0A, 0x48, 0x80, 0x51, 0x2E, 0x63, 0x62, 0x2A, 0x42, 0x58,
+    0x2D, 0x01, 0x4D, 0x3E, 0x30, 0x6F, 0x72, 0x36, 0x2D, 0x51, 0x46, 0x1E,
+    0x42, 0x28, 0x60, 0x3C, 0x25, 0x4C, 0x4B, 0x47, 0x1F, 0x1A, 0x21, 0x12,
+    0x22, 0x32, 0x1F, 0x1E, 0x4A, 0x4D, 0x48, 0x1C, 0x2A, 0x42, 0x25, 0x0D,
+    0x14, 0x09, 0x66, 0x20, 0x20, 0x00, 0x00, 0x03, 0x00, 0x2A, 0x00, 0xB4,
+    0x01, 0x78, 0x02, 0xD4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x77, 0x11, 0x33, 0x11, 0x27, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15,
+    0x8E, 0x89, 0xED, 0x01, 0x4E, 0xFE, 0xB2, 0x01, 0x4E, 0xB4, 0x02, 0x20,
+    0xFD, 0xE0, 0x9F, 0x6D, 0x6D, 0xA5, 0x6D, 0x6D, 0x00, 0x02, 0x00, 0x36,
+    0xFF, 0xF5, 0x02, 0x72, 0x02, 0x45, 0x00, 0x24, 0x00, 0x32, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x16, 0x06, 0x23, 0x21, 0x37, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06,
+    0x03, 0x27, 0x21, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x01, 0x59, 0x56, 0x84, 0x49, 0x48, 0x82, 0x55, 0x51, 0x7C, 0x4A,
+    0x05, 0x01, 0x0D, 0x0A, 0xFE, 0x64, 0x09, 0x19, 0x2A, 0x36, 0x1C, 0x44,
+    0x61, 0x25, 0x07, 0x0A, 0x09, 0x0D, 0x03, 0x03, 0x30, 0x6E, 0xE2, 0x0D,
+    0x01, 0x37, 0x0D, 0x13, 0x25, 0x35, 0x23, 0x2C, 0x40, 0x21, 0x0B, 0x4D,
+    0x86, 0x55, 0x56, 0x86, 0x4C, 0x44, 0x7B, 0x51, 0x0A, 0x0E, 0x07, 0xB8,
+    0x0D, 0x1C, 0x18, 0x0F, 0x35, 0x3A, 0x0B, 0x0B, 0x09, 0x03, 0x08, 0x04,
+    0x45, 0x39, 0x01, 0x45, 0x0A, 0x06, 0x88, 0x0B, 0x1E, 0x1D, 0x13, 0x1F,
+    0x2A, 0x10, 0x00, 0x04, 0x00, 0x5B, 0x00, 0x00, 0x04, 0x92, 0x02, 0xC6,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x23, 0x00, 0x3B, 0x00, 0x00, 0x41, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x35, 0x21, 0x15, 0x03, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x11,
+    0x33, 0x01, 0x23, 0x2E, 0x04, 0x35, 0x35, 0x33, 0x11, 0x23, 0x01, 0x17,
+    0x1E, 0x04, 0x15, 0x15, 0x03, 0xD6, 0x34, 0x53, 0x2F, 0x30, 0x52, 0x34,
+    0x35, 0x54, 0x31, 0x30, 0x54, 0xE4, 0x01, 0x6A, 0xBC, 0x15, 0x20, 0x11,
+    0x11, 0x20, 0x15, 0x14, 0x1E, 0x11, 0x11, 0x1E, 0xFC, 0x99, 0x86, 0x01,
+    0x83, 0x1C, 0x04, 0x06, 0x05, 0x03, 0x02, 0x93, 0x88, 0xFE, 0x75, 0x26,
+    0x05, 0x07, 0x05, 0x02, 0x01, 0x01, 0x51, 0x30, 0x53, 0x36, 0x36, 0x55,
+    0x31, 0x32, 0x55, 0x35, 0x35, 0x54, 0x30, 0xB1, 0x72, 0x72, 0x01, 0x1D,
+    0x13, 0x23, 0x17, 0x18, 0x24, 0x14, 0x14, 0x24, 0x18, 0x17, 0x23, 0x13,
+    0xFE, 0x43, 0x02, 0xBC, 0xFD, 0xF5, 0x1F, 0x3B, 0x3D, 0x41, 0x49, 0x2B,
+    0xBF, 0xFD, 0x44, 0x02, 0x10, 0x01, 0x34, 0x49, 0x36, 0x28, 0x24, 0x14,
+    0xFC, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xC2, 0x03, 0x9D, 0x03, 0x2A,
+    0x06, 0x06, 0x02, 0xA6, 0x00, 0x64, 0x00, 0x02, 0x00, 0x2D, 0xFF, 0xA8,
+    0x02, 0x97, 0x03, 0x14, 0x00, 0x0B, 0x00, 0x31, 0x00, 0x00, 0x45, 0x35,
+    0x37, 0x11, 0x27, 0x35, 0x33, 0x15, 0x07, 0x11, 0x17, 0x15, 0x27, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x4C, 0x11, 0x11, 0x77, 0x12,
+    0x12, 0x35, 0x4D, 0x81, 0x5F, 0x34, 0x36, 0x62, 0x84, 0x4D, 0x32, 0x61,
+    0x51, 0x1D, 0x5E, 0x17, 0x34, 0x39, 0x20, 0x2B, 0x4B, 0x38, 0x21, 0x20,
+    0x3A, 0x51, 0x31, 0x20, 0x3C, 0x33, 0x14, 0x4A, 0x19, 0x51, 0x64, 0x58,
+    0x66, 0x30, 0x02, 0x43, 0x2C, 0x67, 0x63, 0x2D, 0xFD, 0xB6, 0x2A, 0x68,
+    0x4E, 0x35, 0x61, 0x85, 0x4F, 0x4D, 0x83, 0x61, 0x36, 0x1B, 0x34, 0x24,
+    0x68, 0x18, 0x23, 0x13, 0x20, 0x39, 0x51, 0x31, 0x32, 0x51, 0x39, 0x1F,
+    0x12, 0x20, 0x15, 0x75, 0x1B, 0x2C, 0x19, 0x00, 0x00, 0x02, 0x00, 0x2C,
+    0x00, 0x00, 0x02, 0x17, 0x02, 0xC0, 0x00, 0x1F, 0x00, 0x2B, 0x00, 0x00,
+    0x65, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x35, 0x37, 0x11, 0x27,
+    0x35, 0x33, 0x15, 0x07, 0x11, 0x17, 0x15, 0x01, 0x39, 0x4D, 0x7A, 0x46,
+    0x46, 0x7A, 0x4D, 0x47, 0x75, 0x22, 0x4E, 0x0E, 0x2A, 0x31, 0x1A, 0x2A,
+    0x41, 0x25, 0x26, 0x41, 0x2A, 0x1A, 0x2E, 0x29, 0x11, 0x4D, 0x22, 0x78,
+    0x7B, 0x13, 0x13, 0x70, 0x11, 0x11, 0x4E, 0x48, 0x7C, 0x4F, 0x4F, 0x7C,
+    0x48, 0x34, 0x2E, 0x5E, 0x13, 0x1F, 0x12, 0x27, 0x44, 0x2C, 0x2A, 0x44,
+    0x28, 0x0E, 0x1E, 0x15, 0x5E, 0x2B, 0x35, 0x4E, 0x6C, 0x25, 0x01, 0x9D,
+    0x30, 0x62, 0x63, 0x2A, 0xFE, 0x5C, 0x24, 0x6B, 0x00, 0x03, 0x00, 0x2D,
+    0xFF, 0x8F, 0x02, 0x97, 0x03, 0x16, 0x00, 0x03, 0x00, 0x07, 0x00, 0x2D,
+    0x00, 0x00, 0x57, 0x27, 0x01, 0x17, 0x01, 0x27, 0x01, 0x17, 0x03, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xF7, 0x42, 0x01, 0x7F, 0x3F, 0xFE,
+    0x52, 0x42, 0x01, 0x79, 0x40, 0xAE, 0x4D, 0x81, 0x5F, 0x34, 0x36, 0x62,
+    0x84, 0x4D, 0x32, 0x61, 0x51, 0x1D, 0x5E, 0x17, 0x34, 0x39, 0x20, 0x2B,
+    0x4B, 0x38, 0x21, 0x20, 0x3A, 0x51, 0x31, 0x20, 0x3C, 0x33, 0x14, 0x4A,
+    0x19, 0x51, 0x64, 0x71, 0x1E, 0x03, 0x62, 0x1B, 0xFC, 0xAF, 0x1E, 0x03,
+    0x55, 0x1A, 0xFC, 0xFA, 0x35, 0x61, 0x85, 0x4F, 0x4D, 0x83, 0x61, 0x36,
+    0x1B, 0x34, 0x24, 0x68, 0x18, 0x23, 0x13, 0x20, 0x39, 0x51, 0x31, 0x32,
+    0x51, 0x39, 0x1F, 0x12, 0x20, 0x15, 0x75, 0x1B, 0x2C, 0x19, 0x00, 0x06,
+    0x00, 0x23, 0x00, 0x43, 0x02, 0x0B, 0x02, 0x23, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x65, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x27, 0x37, 0x17, 0x27, 0x27, 0x37, 0x17, 0x17, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x17, 0x27, 0x37, 0x17, 0x27, 0x27, 0x37, 0x17, 0x01, 0x19,
+    0x38, 0x5A, 0x35, 0x35, 0x5A, 0x38, 0x38, 0x5A, 0x34, 0x34, 0x5A, 0xCF,
+    0x5A, 0x59, 0x58, 0x5D, 0x59, 0x5A, 0x5A, 0x42, 0x17, 0x21, 0x14, 0x14,
+    0x21, 0x17, 0x16, 0x22, 0x14, 0x14, 0x22, 0xAE, 0x5B, 0x58, 0x5C, 0x5B,
+    0x59, 0x5B, 0x5A, 0x71, 0x32, 0x57, 0x36, 0x37, 0x56, 0x32, 0x32, 0x57,
+    0x36, 0x36, 0x57, 0x32, 0x2E, 0x5A, 0x5C, 0x5B, 0xD1, 0x55, 0x59, 0x56,
+    0xE9, 0x15, 0x25, 0x18, 0x19, 0x26, 0x15, 0x15, 0x26, 0x19, 0x18, 0x25,
+    0x15, 0x96, 0x57, 0x5B, 0x58, 0xC8, 0x59, 0x60, 0x5A, 0x00, 0x00, 0x03,
+    0x00, 0x23, 0xFF, 0xA5, 0x02, 0x4A, 0x03, 0x12, 0x00, 0x32, 0x00, 0x36,
+    0x00, 0x3A, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x27, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06,
+    0x07, 0x13, 0x17, 0x13, 0x13, 0x27, 0x03, 0x33, 0x01, 0x3E, 0x5E, 0x8B,
+    0x32, 0x4E, 0x36, 0x65, 0x3B, 0x1F, 0x31, 0x1C, 0x0E, 0x1A, 0x24, 0x2C,
+    0x1A, 0x4B, 0x64, 0x30, 0x28, 0x47, 0x5D, 0x34, 0x54, 0x81, 0x2F, 0x48,
+    0x25, 0x5F, 0x35, 0x21, 0x30, 0x1B, 0x12, 0x22, 0x30, 0x1D, 0x37, 0x58,
+    0x3F, 0x22, 0x44, 0x78, 0x8C, 0x08, 0x55, 0x08, 0x16, 0x55, 0x08, 0x65,
+    0x0A, 0x3F, 0x3D, 0x74, 0x3E, 0x32, 0x12, 0x1F, 0x16, 0x10, 0x1B, 0x15,
+    0x11, 0x0D, 0x04, 0x10, 0x3A, 0x56, 0x3B, 0x2D, 0x4D, 0x38, 0x1E, 0x37,
+    0x39, 0x68, 0x2B, 0x2C, 0x11, 0x21, 0x16, 0x12, 0x1C, 0x15, 0x10, 0x06,
+    0x0B, 0x24, 0x33, 0x45, 0x2B, 0x47, 0x64, 0x35, 0x51, 0x01, 0xCE, 0x21,
+    0xFE, 0x53, 0x01, 0xAC, 0x21, 0x01, 0xA0, 0x00, 0x00, 0x04, 0x00, 0x28,
+    0xFF, 0xF8, 0x01, 0xF1, 0x02, 0xC1, 0x00, 0x16, 0x00, 0x1A, 0x00, 0x2A,
+    0x00, 0x2E, 0x00, 0x00, 0x77, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x17, 0x27, 0x11, 0x33, 0x11, 0x23, 0x35, 0x17,
+    0x14, 0x06, 0x06, 0x07, 0x35, 0x21, 0x15, 0x03, 0x32, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x03,
+    0x35, 0x21, 0x15, 0xC7, 0x2A, 0x49, 0x2C, 0x2C, 0x4A, 0x2D, 0x21, 0x35,
+    0x25, 0x07, 0x22, 0x80, 0x80, 0x1E, 0x25, 0x3C, 0xBB, 0x01, 0x9C, 0xDE,
+    0x14, 0x1F, 0x12, 0x12, 0x1F, 0x14, 0x13, 0x1E, 0x10, 0x10, 0x1E, 0x05,
+    0x01, 0x1E, 0x92, 0x31, 0x51, 0x31, 0x30, 0x4E, 0x2E, 0x1B, 0x33, 0x22,
+    0x13, 0x01, 0x2D, 0xFD, 0xDB, 0x6E, 0x08, 0x19, 0x34, 0x23, 0x9A, 0x5F,
+    0x5F, 0x01, 0x01, 0x15, 0x23, 0x14, 0x16, 0x23, 0x15, 0x14, 0x23, 0x17,
+    0x16, 0x22, 0x14, 0x01, 0x20, 0x5B, 0x5B, 0x00, 0x00, 0x03, 0x00, 0x11,
+    0xFF, 0xF6, 0x02, 0x73, 0x02, 0xC7, 0x00, 0x24, 0x00, 0x28, 0x00, 0x2C,
+    0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x25, 0x35,
+    0x05, 0x15, 0x25, 0x35, 0x05, 0x15, 0x01, 0xC0, 0x4D, 0x83, 0x60, 0x34,
+    0x34, 0x61, 0x82, 0x4D, 0x21, 0x3D, 0x3A, 0x1B, 0x47, 0x1D, 0x39, 0x1E,
+    0x2C, 0x4B, 0x37, 0x1E, 0x1E, 0x36, 0x4B, 0x2D, 0x16, 0x26, 0x25, 0x14,
+    0x43, 0x1C, 0x3A, 0x3B, 0xFE, 0x32, 0x01, 0xB7, 0xFE, 0x49, 0x01, 0xB7,
+    0x0A, 0x35, 0x60, 0x85, 0x50, 0x4E, 0x83, 0x61, 0x35, 0x0A, 0x17, 0x11,
+    0x76, 0x14, 0x10, 0x21, 0x3E, 0x52, 0x32, 0x33, 0x55, 0x3D, 0x20, 0x06,
+    0x10, 0x0E, 0x77, 0x12, 0x15, 0x0B, 0xFA, 0x51, 0x01, 0x50, 0x85, 0x51,
+    0x01, 0x50, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x02, 0x34, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x77, 0x35,
+    0x21, 0x15, 0x07, 0x11, 0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x01, 0x35,
+    0x21, 0x15, 0x21, 0x01, 0x33, 0xF9, 0x96, 0x51, 0x01, 0x6A, 0xFE, 0x96,
+    0x01, 0x94, 0x63, 0x6E, 0x6E, 0x63, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x16,
+    0x81, 0x81, 0x01, 0x1F, 0x87, 0x87, 0x00, 0x02, 0x00, 0x2D, 0xFF, 0x78,
+    0x02, 0xDF, 0x03, 0x1D, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x3E, 0x02, 0x35, 0x35, 0x17, 0x23, 0x35, 0x21, 0x1E, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x07, 0x11, 0x33, 0x11, 0x01, 0x9C, 0x51, 0x87, 0x62, 0x35,
+    0x37, 0x65, 0x88, 0x51, 0x38, 0x66, 0x54, 0x1C, 0x5D, 0x1A, 0x38, 0x3F,
+    0x21, 0x2F, 0x4F, 0x3C, 0x21, 0x23, 0x3D, 0x52, 0x2F, 0x22, 0x3B, 0x2D,
+    0x19, 0x28, 0xDC, 0x01, 0x44, 0x01, 0x03, 0x01, 0x31, 0x57, 0x76, 0x89,
+    0x52, 0x0A, 0x37, 0x62, 0x84, 0x4D, 0x4D, 0x83, 0x61, 0x36, 0x1E, 0x34,
+    0x22, 0x62, 0x19, 0x23, 0x13, 0x22, 0x3C, 0x52, 0x30, 0x2F, 0x53, 0x3D,
+    0x23, 0x14, 0x25, 0x32, 0x1C, 0x18, 0x1C, 0x7D, 0x0B, 0x20, 0x1F, 0x09,
+    0x44, 0x72, 0x52, 0x2D, 0x7E, 0x03, 0xA5, 0xFC, 0x5B, 0x00, 0x00, 0x05,
+    0x00, 0x1E, 0x00, 0x00, 0x02, 0xEE, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x77, 0x27, 0x01, 0x33,
+    0x01, 0x35, 0x33, 0x07, 0x03, 0x11, 0x33, 0x11, 0x21, 0x01, 0x37, 0x01,
+    0x01, 0x35, 0x21, 0x15, 0xE7, 0x1E, 0x01, 0x62, 0xB4, 0xFD, 0x3F, 0xB1,
+    0x04, 0x55, 0x96, 0x01, 0x30, 0xFE, 0xFA, 0x67, 0x01, 0x51, 0xFE, 0x8F,
+    0x01, 0x12, 0xD3, 0x88, 0x01, 0x61, 0xFE, 0x91, 0x52, 0x52, 0xFE, 0xB3,
+    0x02, 0xBC, 0xFD, 0x44, 0x01, 0x5F, 0x5A, 0xFE, 0x47, 0x01, 0x4D, 0x52,
+    0x52, 0x00, 0x00, 0x04, 0x00, 0x18, 0xFF, 0xEB, 0x02, 0x62, 0x02, 0xCA,
+    0x00, 0x24, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48, 0x00, 0x00, 0x77, 0x27,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15,
+    0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x17, 0x22, 0x26,
+    0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0xBC, 0x4B, 0x18, 0x21,
+    0x0C, 0x14, 0x0C, 0x0C, 0x05, 0x3B, 0x6A, 0x49, 0x45, 0x67, 0x18, 0x69,
+    0x0C, 0x1C, 0x21, 0x14, 0x1E, 0x30, 0x1B, 0x12, 0x0A, 0x0B, 0x11, 0x15,
+    0x2F, 0xD1, 0x1B, 0x43, 0x1A, 0x0D, 0x24, 0x24, 0x0E, 0x15, 0x2F, 0x32,
+    0x1A, 0x32, 0x28, 0x69, 0x3E, 0x13, 0x2D, 0x2B, 0x15, 0x30, 0x16, 0x1D,
+    0x3C, 0x1E, 0x3E, 0x21, 0x5B, 0xFE, 0x48, 0x01, 0xAD, 0xFE, 0x53, 0x01,
+    0xAD, 0x35, 0x15, 0x0D, 0x47, 0x2B, 0x1C, 0x3F, 0x3C, 0x25, 0x30, 0x22,
+    0x10, 0x45, 0x66, 0x38, 0x2F, 0x2A, 0x52, 0x0F, 0x12, 0x0A, 0x1C, 0x30,
+    0x20, 0x1F, 0x41, 0x1D, 0x21, 0x43, 0x1A, 0x1E, 0x39, 0x38, 0x69, 0x11,
+    0x08, 0x04, 0x0A, 0x08, 0x0A, 0x10, 0x0A, 0x5E, 0x1A, 0x1F, 0x0A, 0x0F,
+    0x07, 0x0F, 0x11, 0x12, 0x58, 0x1E, 0x20, 0xEC, 0x4B, 0x4B, 0x77, 0x4B,
+    0x4B, 0x00, 0x00, 0x03, 0x00, 0x15, 0xFF, 0xF6, 0x02, 0x51, 0x02, 0xBC,
+    0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27,
+    0x11, 0x33, 0x11, 0x27, 0x32, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x03, 0x27,
+    0x27, 0x25, 0x17, 0x05, 0x27, 0x25, 0x17, 0x01, 0x06, 0x2A, 0x3D, 0x16,
+    0x89, 0x0D, 0x25, 0x42, 0x35, 0x2A, 0x0D, 0x79, 0x0E, 0x41, 0x5A, 0x6B,
+    0xF8, 0x23, 0x01, 0x7B, 0x27, 0xFE, 0x75, 0x24, 0x01, 0x7C, 0x27, 0x0A,
+    0x0A, 0x08, 0x02, 0xB4, 0xFD, 0x97, 0x1D, 0x0F, 0x21, 0x30, 0x20, 0x24,
+    0x32, 0x4F, 0x37, 0x1E, 0xAF, 0x3E, 0xD6, 0x3D, 0x33, 0x3D, 0xD6, 0x3D,
+    0x00, 0x02, 0x00, 0x5B, 0x00, 0x00, 0x02, 0xA6, 0x03, 0x28, 0x00, 0x15,
+    0x00, 0x19, 0x00, 0x00, 0x73, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x11, 0x37, 0x11, 0x33, 0x11, 0x5B, 0x4C, 0x85, 0x55, 0x55, 0x85,
+    0x4B, 0x96, 0x27, 0x41, 0x27, 0x2A, 0x43, 0x27, 0x69, 0x53, 0x01, 0xB0,
+    0x4F, 0x7D, 0x47, 0x47, 0x7D, 0x4F, 0xFE, 0x50, 0x01, 0xA7, 0x2A, 0x43,
+    0x27, 0x27, 0x43, 0x2A, 0xFE, 0x59, 0xC5, 0x02, 0x63, 0xFD, 0x9D, 0x00,
+    0x00, 0x02, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x35, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x23, 0x00, 0x00, 0x53, 0x35, 0x33, 0x17, 0x21, 0x37, 0x33, 0x15,
+    0x23, 0x27, 0x21, 0x07, 0x03, 0x11, 0x33, 0x01, 0x23, 0x2E, 0x04, 0x35,
+    0x35, 0x33, 0x11, 0x23, 0x01, 0x17, 0x1E, 0x04, 0x15, 0x15, 0x0E, 0x6D,
+    0x22, 0x02, 0x06, 0x2A, 0x68, 0x6D, 0x29, 0xFD, 0xF8, 0x1E, 0x0B, 0x86,
+    0x01, 0x83, 0x1C, 0x04, 0x07, 0x05, 0x03, 0x01, 0x93, 0x88, 0xFE, 0x74,
+    0x27, 0x05, 0x07, 0x04, 0x03, 0x01, 0x01, 0x36, 0x53, 0x0B, 0x0B, 0x53,
+    0x10, 0x10, 0xFE, 0xCA, 0x02, 0xBC, 0xFD, 0xF5, 0x1F, 0x3B, 0x3D, 0x41,
+    0x49, 0x2B, 0xBF, 0xFD, 0x44, 0x02, 0x10, 0x01, 0x34, 0x49, 0x36, 0x28,
+    0x24, 0x14, 0xFC, 0x00, 0x00, 0x03, 0x00, 0x44, 0x00, 0x00, 0x02, 0xE4,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x35,
+    0x21, 0x15, 0x01, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x23, 0x15, 0x03, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x23, 0x44, 0x02, 0xA0, 0xFD, 0xB5, 0x01, 0x28, 0x3F, 0x65, 0x3B,
+    0x3B, 0x65, 0x3F, 0x92, 0x02, 0x84, 0x17, 0x27, 0x17, 0x17, 0x27, 0x17,
+    0x84, 0x01, 0xAE, 0x50, 0x50, 0xFE, 0x52, 0x02, 0xBC, 0x3B, 0x66, 0x40,
+    0x41, 0x68, 0x3D, 0xF5, 0x01, 0x7C, 0x19, 0x2A, 0x1B, 0x1B, 0x28, 0x18,
+    0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x02, 0xE3, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x24, 0x00, 0x2F, 0x00, 0x00, 0x53, 0x35, 0x33, 0x17,
+    0x21, 0x37, 0x33, 0x15, 0x23, 0x27, 0x21, 0x07, 0x27, 0x35, 0x33, 0x17,
+    0x21, 0x37, 0x33, 0x15, 0x23, 0x27, 0x21, 0x07, 0x03, 0x11, 0x21, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x03, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x44, 0x6B, 0x1B, 0x01,
+    0x54, 0x26, 0x9F, 0xA4, 0x23, 0xFE, 0xAB, 0x1B, 0x68, 0x6D, 0x1B, 0x01,
+    0x56, 0x27, 0x9A, 0x99, 0x25, 0xFE, 0xA4, 0x1C, 0x12, 0x01, 0x29, 0x3F,
+    0x64, 0x3B, 0x3B, 0x64, 0x3F, 0x93, 0x01, 0x83, 0x18, 0x27, 0x17, 0x17,
+    0x27, 0x18, 0x83, 0x01, 0xAF, 0x4A, 0x09, 0x09, 0x4A, 0x17, 0x17, 0x0A,
+    0x49, 0x17, 0x17, 0x49, 0x08, 0x08, 0xFE, 0x47, 0x02, 0xBC, 0x3B, 0x66,
+    0x40, 0x41, 0x68, 0x3D, 0xF5, 0x01, 0x7C, 0x19, 0x2A, 0x1B, 0x1B, 0x28,
+    0x18, 0x00, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x02, 0xA0, 0x02, 0xBC,
+    0x00, 0x0D, 0x00, 0x11, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00, 0x73, 0x11,
+    0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x37, 0x11,
+    0x27, 0x35, 0x21, 0x15, 0x25, 0x35, 0x33, 0x15, 0x37, 0x27, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0x99, 0x01, 0x29,
+    0x3E, 0x65, 0x3B, 0x3B, 0x65, 0x3E, 0xB9, 0x26, 0xEB, 0x01, 0x40, 0xFE,
+    0xC0, 0x82, 0x67, 0x25, 0xA9, 0x18, 0x26, 0x17, 0x17, 0x26, 0x18, 0xA9,
+    0x25, 0x02, 0xBC, 0x3B, 0x66, 0x40, 0x41, 0x68, 0x3D, 0x25, 0xFE, 0xE6,
+    0x6E, 0x4F, 0x4F, 0x88, 0x60, 0x60, 0x70, 0x16, 0x19, 0x2A, 0x1B, 0x1B,
+    0x28, 0x18, 0x2E, 0x00, 0x00, 0x03, 0x00, 0x31, 0xFF, 0xFB, 0x02, 0x28,
+    0x02, 0xB8, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x00, 0x77, 0x27,
+    0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x21,
+    0x15, 0x23, 0x27, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x13, 0x03,
+    0x37, 0x13, 0x01, 0x35, 0x21, 0x15, 0xAB, 0x42, 0x78, 0x29, 0x32, 0x1B,
+    0x31, 0x22, 0x9D, 0x01, 0xF5, 0xD5, 0x57, 0x2C, 0x4D, 0x3C, 0x22, 0x24,
+    0x3F, 0x55, 0x31, 0x5F, 0xDC, 0x9A, 0xF0, 0xFE, 0xD5, 0x01, 0x5E, 0xFF,
+    0x45, 0x2D, 0x37, 0x2B, 0x1E, 0x2C, 0x19, 0x82, 0x72, 0x4A, 0x06, 0x1D,
+    0x2F, 0x40, 0x29, 0x2D, 0x4E, 0x3A, 0x21, 0xFE, 0xFD, 0x01, 0x47, 0x19,
+    0xFE, 0x9F, 0x01, 0xB1, 0x4E, 0x4E, 0x00, 0x03, 0x00, 0x18, 0xFF, 0xEB,
+    0x02, 0x63, 0x02, 0xCA, 0x00, 0x27, 0x00, 0x42, 0x00, 0x46, 0x00, 0x00,
+    0x77, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x02, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x17, 0x22, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x01, 0x35, 0x21, 0x15, 0xBD, 0x4B, 0x12, 0x1B, 0x10, 0x05,
+    0x09, 0x0E, 0x08, 0x0C, 0x0C, 0x05, 0x3C, 0x6C, 0x4A, 0x45, 0x67, 0x18,
+    0x69, 0x0C, 0x1D, 0x23, 0x13, 0x1F, 0x30, 0x1C, 0x13, 0x09, 0x0B, 0x12,
+    0x16, 0x2F, 0xD4, 0x1F, 0x46, 0x16, 0x0D, 0x22, 0x26, 0x11, 0x20, 0x48,
+    0x25, 0x33, 0x2A, 0x65, 0x33, 0x1E, 0x30, 0x2B, 0x15, 0x32, 0x1A, 0x18,
+    0x38, 0x1D, 0x42, 0x22, 0x5D, 0xFE, 0x48, 0x01, 0xA4, 0x35, 0x15, 0x0A,
+    0x27, 0x31, 0x19, 0x0E, 0x22, 0x28, 0x2B, 0x18, 0x25, 0x30, 0x22, 0x10,
+    0x45, 0x66, 0x38, 0x2F, 0x2A, 0x52, 0x0F, 0x12, 0x0A, 0x1C, 0x30, 0x20,
+    0x1F, 0x41, 0x1D, 0x21, 0x43, 0x1A, 0x1E, 0x39, 0x38, 0x69, 0x12, 0x07,
+    0x04, 0x0A, 0x08, 0x13, 0x11, 0x64, 0x1A, 0x1D, 0x0A, 0x0F, 0x07, 0x0F,
+    0x11, 0x12, 0x5C, 0x1E, 0x20, 0x01, 0x4B, 0x5B, 0x5B, 0x00, 0x00, 0x02,
+    0x00, 0x0C, 0x00, 0x00, 0x03, 0xD8, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x2E,
+    0x00, 0x00, 0x53, 0x35, 0x33, 0x17, 0x21, 0x37, 0x33, 0x15, 0x23, 0x27,
+    0x21, 0x07, 0x13, 0x03, 0x33, 0x13, 0x1E, 0x03, 0x17, 0x27, 0x3E, 0x02,
+    0x37, 0x13, 0x33, 0x13, 0x1E, 0x02, 0x17, 0x07, 0x3E, 0x04, 0x37, 0x13,
+    0x33, 0x03, 0x23, 0x03, 0x17, 0x03, 0x18, 0x91, 0x21, 0x02, 0x4C, 0x26,
+    0x98, 0xB3, 0x2E, 0xFD, 0xF2, 0x29, 0x26, 0xD6, 0x9B, 0x72, 0x07, 0x0A,
+    0x07, 0x06, 0x02, 0x18, 0x09, 0x0B, 0x0B, 0x08, 0x6F, 0x7B, 0x6D, 0x0B,
+    0x10, 0x0A, 0x04, 0x16, 0x03, 0x03, 0x03, 0x04, 0x09, 0x07, 0x71, 0x98,
+    0xD6, 0x70, 0xAC, 0x10, 0xA1, 0x01, 0x42, 0x5D, 0x0F, 0x0F, 0x5D, 0x0D,
+    0x0D, 0xFE, 0xBE, 0x02, 0xBC, 0xFE, 0x79, 0x15, 0x31, 0x2D, 0x27, 0x0D,
+    0x01, 0x2A, 0x39, 0x2D, 0x17, 0x01, 0x21, 0xFE, 0xDF, 0x1E, 0x37, 0x33,
+    0x1A, 0x04, 0x15, 0x1F, 0x1A, 0x1B, 0x25, 0x19, 0x01, 0x85, 0xFD, 0x44,
+    0x01, 0x9E, 0x02, 0xFE, 0x64, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
+    0x02, 0xA9, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00,
+    0x61, 0x11, 0x17, 0x01, 0x33, 0x13, 0x27, 0x13, 0x33, 0x01, 0x37, 0x11,
+    0x25, 0x35, 0x05, 0x15, 0x25, 0x35, 0x05, 0x15, 0x01, 0x12, 0x07, 0xFE,
+    0xE5, 0xAD, 0xD8, 0x44, 0xC3, 0xA7, 0xFE, 0xF1, 0x0F, 0xFE, 0xE6, 0x01,
+    0xAC, 0xFE, 0x54, 0x01, 0xAC, 0x01, 0x5D, 0x31, 0x01, 0x90, 0xFE, 0xCA,
+    0x03, 0x01, 0x33, 0xFE, 0x65, 0x44, 0xFE, 0x9B, 0x71, 0x4B, 0x01, 0x4C,
+    0x82, 0x4C, 0x01, 0x4C, 0x00, 0x01, 0x00, 0x36, 0x00, 0xC9, 0x01, 0x02,
+    0x01, 0x95, 0x00, 0x0F, 0x00, 0x00, 0x77, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x9E, 0x1D,
+    0x2F, 0x1C, 0x1C, 0x2F, 0x1D, 0x1A, 0x2F, 0x1B, 0x1B, 0x2F, 0xC9, 0x1B,
+    0x2E, 0x1D, 0x1B, 0x2F, 0x1C, 0x1C, 0x2F, 0x1B, 0x1D, 0x2E, 0x1B, 0x00,
+    0x00, 0x01, 0x00, 0x0A, 0xFF, 0x95, 0x02, 0x28, 0x02, 0xF4, 0x00, 0x03,
+    0x00, 0x00, 0x57, 0x01, 0x33, 0x01, 0x0A, 0x01, 0xA5, 0x79, 0xFE, 0x5A,
+    0x6B, 0x03, 0x5F, 0xFC, 0xA1, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x28,
+    0x02, 0x24, 0x02, 0x0F, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x77, 0x35,
+    0x21, 0x15, 0x05, 0x11, 0x33, 0x11, 0x2F, 0x01, 0xF5, 0xFE, 0xC4, 0x82,
+    0xE0, 0x75, 0x75, 0xB8, 0x01, 0xE7, 0xFE, 0x19, 0x00, 0x01, 0x00, 0x2A,
+    0x00, 0xEA, 0x02, 0x1A, 0x01, 0x63, 0x00, 0x03, 0x00, 0x00, 0x77, 0x35,
+    0x21, 0x15, 0x2A, 0x01, 0xF0, 0xEA, 0x79, 0x79, 0x00, 0x02, 0x00, 0x25,
+    0x00, 0x39, 0x01, 0xE0, 0x01, 0xF4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x65, 0x01, 0x37, 0x01, 0x05, 0x27, 0x01, 0x17, 0x01, 0x8A, 0xFE, 0x9B,
+    0x56, 0x01, 0x65, 0xFE, 0x9A, 0x53, 0x01, 0x64, 0x54, 0x3D, 0x01, 0x64,
+    0x53, 0xFE, 0x9C, 0x57, 0x56, 0x01, 0x65, 0x55, 0x00, 0x03, 0x00, 0x2D,
+    0xFF, 0xF5, 0x02, 0x28, 0x02, 0x17, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23,
+    0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x05, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x03, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x2D, 0x01, 0xFB, 0xFE, 0xFF, 0x18, 0x25, 0x15, 0x15, 0x25,
+    0x18, 0x19, 0x25, 0x14, 0x14, 0x25, 0x19, 0x18, 0x25, 0x15, 0x15, 0x25,
+    0x18, 0x19, 0x25, 0x14, 0x15, 0x25, 0xCC, 0x76, 0x76, 0xD7, 0x14, 0x23,
+    0x18, 0x16, 0x24, 0x14, 0x13, 0x24, 0x17, 0x17, 0x23, 0x15, 0x01, 0x85,
+    0x14, 0x23, 0x17, 0x17, 0x23, 0x15, 0x13, 0x24, 0x18, 0x15, 0x24, 0x15,
+    0x00, 0x02, 0x00, 0x3E, 0x00, 0x77, 0x02, 0x1F, 0x01, 0xBC, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x05, 0x35, 0x21, 0x15,
+    0x3E, 0x01, 0xE1, 0xFE, 0x1F, 0x01, 0xE1, 0x01, 0x47, 0x75, 0x75, 0xD0,
+    0x74, 0x74, 0x00, 0x03, 0x00, 0x3A, 0x00, 0x19, 0x02, 0x2B, 0x02, 0x1B,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x01, 0x33, 0x01,
+    0x27, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15, 0x6E, 0x01, 0x09, 0x78,
+    0xFE, 0xF3, 0xA8, 0x01, 0xF1, 0xFE, 0x0F, 0x01, 0xF1, 0x19, 0x02, 0x02,
+    0xFD, 0xFE, 0x5E, 0x74, 0x74, 0xD0, 0x75, 0x75, 0x00, 0x01, 0x00, 0x30,
+    0xFF, 0xF8, 0x01, 0xE7, 0x02, 0x06, 0x00, 0x07, 0x00, 0x00, 0x57, 0x27,
+    0x25, 0x15, 0x25, 0x37, 0x05, 0x15, 0x6C, 0x3C, 0x01, 0x5A, 0xFE, 0xA6,
+    0x3C, 0x01, 0x7B, 0x08, 0x6E, 0xBC, 0x45, 0xBB, 0x6E, 0xD9, 0x5C, 0x00,
+    0x00, 0x01, 0x00, 0x2C, 0xFF, 0xF8, 0x01, 0xE3, 0x02, 0x06, 0x00, 0x07,
+    0x00, 0x00, 0x45, 0x25, 0x35, 0x25, 0x17, 0x05, 0x35, 0x05, 0x01, 0xA7,
+    0xFE, 0x85, 0x01, 0x7B, 0x3C, 0xFE, 0xA6, 0x01, 0x5A, 0x08, 0xD9, 0x5C,
+    0xD9, 0x6E, 0xBB, 0x45, 0xBC, 0x00, 0x00, 0x02, 0x00, 0x42, 0x00, 0x00,
+    0x02, 0x33, 0x02, 0x25, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x27,
+    0x25, 0x07, 0x25, 0x37, 0x05, 0x15, 0x01, 0x35, 0x21, 0x15, 0x74, 0x14,
+    0x01, 0x75, 0x03, 0xFE, 0x89, 0x19, 0x01, 0xBE, 0xFE, 0x10, 0x01, 0xF1,
+    0x97, 0x6C, 0x7B, 0x3D, 0x7D, 0x67, 0x9B, 0x57, 0xFE, 0xCD, 0x74, 0x74,
+    0x00, 0x02, 0x00, 0x40, 0x00, 0x00, 0x02, 0x31, 0x02, 0x25, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x65, 0x25, 0x35, 0x25, 0x17, 0x05, 0x27, 0x05,
+    0x01, 0x35, 0x21, 0x15, 0x01, 0xFF, 0xFE, 0x42, 0x01, 0xBE, 0x19, 0xFE,
+    0x89, 0x03, 0x01, 0x75, 0xFE, 0x2D, 0x01, 0xF1, 0x97, 0x9C, 0x57, 0x9B,
+    0x67, 0x7D, 0x3D, 0x7B, 0xFE, 0xFD, 0x74, 0x74, 0x00, 0x03, 0x00, 0x3E,
+    0xFF, 0xFB, 0x02, 0x30, 0x02, 0x32, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x25, 0x11,
+    0x33, 0x11, 0x3E, 0x01, 0xF1, 0xFE, 0x10, 0x01, 0xF1, 0xFE, 0xC3, 0x88,
+    0x01, 0x30, 0x75, 0x75, 0xFE, 0xCB, 0x77, 0x77, 0xB0, 0x01, 0x87, 0xFE,
+    0x79, 0x00, 0x00, 0x02, 0x00, 0x36, 0x00, 0x50, 0x02, 0x1A, 0x01, 0xC7,
+    0x00, 0x1F, 0x00, 0x3F, 0x00, 0x00, 0x41, 0x22, 0x26, 0x26, 0x27, 0x2E,
+    0x02, 0x23, 0x22, 0x06, 0x17, 0x07, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x17, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x27, 0x37, 0x14, 0x06, 0x06,
+    0x07, 0x22, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x17, 0x07,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x27, 0x37, 0x14, 0x06, 0x06, 0x01, 0xA0, 0x14, 0x32, 0x30, 0x13,
+    0x0D, 0x21, 0x21, 0x0F, 0x10, 0x14, 0x01, 0x60, 0x1F, 0x3C, 0x2E, 0x12,
+    0x2F, 0x2D, 0x11, 0x0B, 0x20, 0x20, 0x0C, 0x13, 0x13, 0x01, 0x60, 0x1B,
+    0x37, 0x28, 0x14, 0x32, 0x30, 0x13, 0x0D, 0x21, 0x21, 0x0F, 0x10, 0x14,
+    0x01, 0x60, 0x1E, 0x3B, 0x2C, 0x13, 0x30, 0x2E, 0x12, 0x0B, 0x20, 0x20,
+    0x0C, 0x13, 0x13, 0x01, 0x60, 0x1B, 0x37, 0x01, 0x1C, 0x0E, 0x12, 0x08,
+    0x06, 0x0D, 0x0A, 0x18, 0x16, 0x04, 0x30, 0x44, 0x24, 0x0F, 0x12, 0x07,
+    0x05, 0x0E, 0x0A, 0x15, 0x1A, 0x02, 0x30, 0x43, 0x24, 0xCC, 0x0D, 0x13,
+    0x07, 0x06, 0x0D, 0x0A, 0x18, 0x15, 0x05, 0x30, 0x44, 0x24, 0x0E, 0x12,
+    0x08, 0x05, 0x0D, 0x0B, 0x15, 0x1A, 0x02, 0x30, 0x43, 0x23, 0x00, 0x01,
+    0x00, 0x23, 0x00, 0xCE, 0x01, 0xFB, 0x01, 0x82, 0x00, 0x1F, 0x00, 0x00,
+    0x65, 0x22, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x23,
+    0x34, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x1E, 0x02, 0x33, 0x32, 0x36,
+    0x27, 0x17, 0x14, 0x06, 0x06, 0x01, 0x76, 0x10, 0x28, 0x28, 0x11, 0x0E,
+    0x22, 0x1D, 0x09, 0x13, 0x14, 0x65, 0x46, 0x48, 0x0C, 0x1E, 0x1D, 0x1D,
+    0x0B, 0x0E, 0x1D, 0x1C, 0x0A, 0x11, 0x15, 0x02, 0x66, 0x1E, 0x3B, 0xD1,
+    0x0A, 0x0F, 0x06, 0x07, 0x0C, 0x08, 0x1F, 0x1E, 0x57, 0x5D, 0x06, 0x0B,
+    0x0B, 0x05, 0x05, 0x0C, 0x08, 0x1F, 0x18, 0x02, 0x38, 0x4C, 0x28, 0x00,
+    0x00, 0x01, 0x00, 0x2C, 0x00, 0x6D, 0x02, 0x72, 0x01, 0x9C, 0x00, 0x06,
+    0x00, 0x00, 0x65, 0x35, 0x17, 0x21, 0x35, 0x21, 0x11, 0x01, 0xEA, 0x32,
+    0xFE, 0x10, 0x02, 0x46, 0x6D, 0xD2, 0x21, 0x7E, 0xFE, 0xD1, 0x00, 0x01,
+    0x00, 0x12, 0x01, 0x6B, 0x02, 0x3B, 0x02, 0xDB, 0x00, 0x07, 0x00, 0x00,
+    0x53, 0x13, 0x33, 0x13, 0x23, 0x03, 0x37, 0x03, 0x12, 0xD9, 0x77, 0xD9,
+    0x93, 0xA1, 0x40, 0xA5, 0x01, 0x6B, 0x01, 0x70, 0xFE, 0x90, 0x01, 0x16,
+    0x02, 0xFE, 0xE8, 0x00, 0x00, 0x02, 0x00, 0x2B, 0x00, 0x27, 0x03, 0x53,
+    0x01, 0xCC, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x00, 0x65, 0x22, 0x26, 0x27,
+    0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x37, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x21, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x17, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x07, 0x0E, 0x02, 0x02, 0x9C, 0x32,
+    0x4F, 0x30, 0x93, 0x17, 0x37, 0x1B, 0x17, 0x23, 0x14, 0x14, 0x23, 0x18,
+    0x1C, 0x2F, 0x1B, 0x8E, 0x21, 0x39, 0x3A, 0x22, 0x36, 0x54, 0x2F, 0x2E,
+    0x53, 0xFE, 0x11, 0x37, 0x53, 0x2E, 0x2F, 0x54, 0x37, 0x22, 0x38, 0x38,
+    0x23, 0x8E, 0x1B, 0x31, 0x1B, 0x17, 0x23, 0x14, 0x14, 0x24, 0x16, 0x1B,
+    0x35, 0x1A, 0x92, 0x1F, 0x37, 0x39, 0x27, 0x26, 0x30, 0xA2, 0x1A, 0x1A,
+    0x16, 0x27, 0x1C, 0x1C, 0x28, 0x16, 0x1A, 0x1C, 0x9B, 0x25, 0x27, 0x0F,
+    0x34, 0x5F, 0x3F, 0x41, 0x5E, 0x34, 0x34, 0x5E, 0x41, 0x3F, 0x5F, 0x34,
+    0x0F, 0x28, 0x24, 0x9B, 0x1E, 0x18, 0x16, 0x28, 0x1C, 0x1C, 0x27, 0x16,
+    0x1A, 0x1A, 0xA1, 0x23, 0x25, 0x0F, 0x00, 0x03, 0x00, 0x22, 0xFF, 0xF3,
+    0x02, 0x54, 0x02, 0x1C, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x00,
+    0x57, 0x27, 0x01, 0x17, 0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36,
+    0x27, 0x36, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x17, 0x06, 0x16, 0x16,
+    0x62, 0x40, 0x01, 0xF1, 0x3D, 0xFE, 0xED, 0x51, 0x7F, 0x49, 0x49, 0x7F,
+    0x51, 0x50, 0x7F, 0x48, 0x48, 0x7F, 0x50, 0x27, 0x3E, 0x23, 0x01, 0x01,
+    0x23, 0x3E, 0x27, 0x28, 0x3E, 0x24, 0x01, 0x01, 0x24, 0x3E, 0x0D, 0x42,
+    0x01, 0xE2, 0x42, 0xFE, 0x21, 0x47, 0x7C, 0x50, 0x50, 0x7C, 0x47, 0x47,
+    0x7C, 0x50, 0x50, 0x7C, 0x47, 0x7C, 0x27, 0x45, 0x2B, 0x2C, 0x45, 0x27,
+    0x28, 0x44, 0x2C, 0x2B, 0x45, 0x27, 0x00, 0x01, 0xFF, 0xEF, 0xFF, 0x7D,
+    0x02, 0x67, 0x02, 0xF1, 0x00, 0x20, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26,
+    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x13, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07,
+    0x03, 0x0E, 0x02, 0x7F, 0x14, 0x2F, 0x33, 0x1A, 0x47, 0x0E, 0x26, 0x12,
+    0x12, 0x1C, 0x14, 0x04, 0x50, 0x0D, 0x34, 0x4E, 0x35, 0x2F, 0x48, 0x1A,
+    0x2A, 0x15, 0x2F, 0x13, 0x13, 0x1E, 0x15, 0x05, 0x4B, 0x0C, 0x37, 0x55,
+    0x83, 0x0D, 0x18, 0x13, 0x77, 0x0B, 0x0E, 0x13, 0x25, 0x1A, 0x01, 0xBE,
+    0x45, 0x5B, 0x2E, 0x18, 0x17, 0x7A, 0x0F, 0x0F, 0x14, 0x29, 0x1E, 0xFE,
+    0x4A, 0x49, 0x5F, 0x30, 0x00, 0x01, 0x00, 0x1B, 0x00, 0x00, 0x02, 0xAB,
+    0x02, 0xCA, 0x00, 0x36, 0x00, 0x00, 0x73, 0x35, 0x33, 0x07, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06,
+    0x07, 0x27, 0x33, 0x15, 0x21, 0x35, 0x3E, 0x02, 0x37, 0x3E, 0x02, 0x35,
+    0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x17,
+    0x1E, 0x03, 0x17, 0x15, 0x2E, 0xB6, 0x26, 0x31, 0x49, 0x29, 0x31, 0x5A,
+    0x77, 0x47, 0x46, 0x77, 0x59, 0x31, 0x28, 0x49, 0x31, 0x22, 0xB1, 0xFE,
+    0xF9, 0x14, 0x22, 0x1A, 0x07, 0x11, 0x19, 0x0C, 0x1B, 0x33, 0x44, 0x28,
+    0x29, 0x44, 0x33, 0x1B, 0x13, 0x24, 0x17, 0x0A, 0x11, 0x11, 0x0C, 0x05,
+    0x80, 0x20, 0x2F, 0x68, 0x6D, 0x38, 0x41, 0x6E, 0x52, 0x2D, 0x2D, 0x52,
+    0x6F, 0x41, 0x37, 0x6D, 0x68, 0x2E, 0x1F, 0x80, 0x7A, 0x16, 0x26, 0x1F,
+    0x0C, 0x1A, 0x35, 0x3C, 0x23, 0x26, 0x41, 0x30, 0x1B, 0x1B, 0x30, 0x41,
+    0x26, 0x2B, 0x46, 0x3E, 0x1E, 0x0E, 0x16, 0x12, 0x0E, 0x04, 0x7A, 0x00,
+    0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0xC9, 0x02, 0xD9, 0x00, 0x02,
+    0x00, 0x08, 0x00, 0x00, 0x73, 0x01, 0x01, 0x25, 0x27, 0x21, 0x07, 0x03,
+    0x33, 0x02, 0x01, 0x61, 0x01, 0x66, 0xFD, 0xD5, 0x28, 0x01, 0xE4, 0x30,
+    0xE6, 0x3E, 0x02, 0xD9, 0xFD, 0x27, 0x40, 0x32, 0x35, 0x01, 0xD5, 0x00,
+    0x00, 0x03, 0x00, 0x21, 0xFF, 0x38, 0x02, 0xB9, 0x02, 0xBC, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x11, 0x33, 0x11, 0x21, 0x11,
+    0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x01, 0xD0, 0x8E, 0xFE, 0x1E, 0x8E,
+    0xE9, 0x02, 0x98, 0xC8, 0x03, 0x52, 0xFC, 0xAE, 0x03, 0x49, 0xFC, 0xB7,
+    0x03, 0x01, 0x83, 0x83, 0x00, 0x01, 0x00, 0x2A, 0xFF, 0xF8, 0x01, 0xE8,
+    0x02, 0xAC, 0x00, 0x0F, 0x00, 0x00, 0x57, 0x27, 0x13, 0x17, 0x03, 0x37,
+    0x21, 0x15, 0x21, 0x37, 0x13, 0x15, 0x03, 0x27, 0x21, 0x15, 0x56, 0x2C,
+    0xDF, 0x03, 0xE2, 0x2C, 0x01, 0x92, 0xFE, 0xA1, 0x21, 0xD4, 0xD5, 0x1A,
+    0x01, 0x59, 0x08, 0x64, 0x01, 0x13, 0x3B, 0x01, 0x14, 0x64, 0x78, 0x33,
+    0xFE, 0xF3, 0x0F, 0xFE, 0xF3, 0x32, 0x78, 0x00, 0x00, 0x01, 0x00, 0x0B,
+    0xFF, 0x71, 0x02, 0xCD, 0x02, 0xBC, 0x00, 0x0A, 0x00, 0x00, 0x57, 0x03,
+    0x33, 0x13, 0x27, 0x01, 0x33, 0x15, 0x23, 0x37, 0x01, 0xC6, 0xBB, 0x94,
+    0x7A, 0x3D, 0x01, 0x01, 0xF0, 0xCF, 0x53, 0xFE, 0xF1, 0x8F, 0x01, 0xCF,
+    0xFE, 0x8E, 0x08, 0x02, 0xE6, 0x91, 0x31, 0xFD, 0x15, 0x00, 0x00, 0x01,
+    0x00, 0x4C, 0xFF, 0x60, 0x02, 0x27, 0x02, 0x11, 0x00, 0x1C, 0x00, 0x00,
+    0x57, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35,
+    0x11, 0x33, 0x11, 0x23, 0x27, 0x17, 0x0E, 0x02, 0x07, 0x22, 0x26, 0x26,
+    0x27, 0x37, 0x17, 0x4C, 0x8A, 0x15, 0x28, 0x1D, 0x18, 0x27, 0x1D, 0x11,
+    0x8A, 0x83, 0x05, 0x0D, 0x11, 0x30, 0x3C, 0x25, 0x0F, 0x1C, 0x14, 0x05,
+    0x0C, 0x04, 0xA0, 0x02, 0xB1, 0xFE, 0xCD, 0x25, 0x32, 0x1A, 0x11, 0x1F,
+    0x28, 0x17, 0x01, 0x35, 0xFD, 0xEF, 0x68, 0x0B, 0x23, 0x2D, 0x16, 0x02,
+    0x09, 0x10, 0x0B, 0x28, 0xE1, 0x00, 0x00, 0x02, 0x00, 0x24, 0xFF, 0xF9,
+    0x02, 0x38, 0x02, 0xE7, 0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x04, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x0E,
+    0x02, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x2A, 0x37, 0x5E, 0x49, 0x28, 0x29,
+    0x46, 0x5A, 0x31, 0x2A, 0x4A, 0x43, 0x1E, 0x38, 0x02, 0x19, 0x2C, 0x3C,
+    0x4D, 0x2D, 0x2D, 0x43, 0x76, 0x2D, 0x33, 0x34, 0x28, 0x48, 0x62, 0x39,
+    0x27, 0x3F, 0x25, 0x25, 0x3F, 0x27, 0x26, 0x3C, 0x24, 0x24, 0x3C, 0x07,
+    0x2A, 0x4A, 0x63, 0x39, 0x35, 0x5D, 0x48, 0x29, 0x1E, 0x47, 0x3D, 0x11,
+    0x23, 0x47, 0x41, 0x38, 0x2C, 0x0D, 0x72, 0x11, 0x53, 0x3B, 0x40, 0x99,
+    0x4F, 0x3E, 0x6A, 0x52, 0x2D, 0x7C, 0x28, 0x43, 0x29, 0x29, 0x42, 0x27,
+    0x27, 0x42, 0x29, 0x29, 0x43, 0x28, 0x00, 0x05, 0x00, 0x28, 0xFF, 0xF7,
+    0x03, 0x70, 0x02, 0xCC, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33,
+    0x00, 0x43, 0x00, 0x00, 0x73, 0x01, 0x33, 0x01, 0x03, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x9D, 0x01, 0xCF, 0x87, 0xFE, 0x2C, 0x4E, 0x31, 0x4D, 0x2B, 0x2B, 0x4D,
+    0x31, 0x32, 0x4B, 0x2B, 0x2C, 0x4C, 0x30, 0x12, 0x1A, 0x0E, 0x0E, 0x1A,
+    0x12, 0x12, 0x1B, 0x0E, 0x0E, 0x1B, 0x02, 0x0A, 0x31, 0x4D, 0x2C, 0x2B,
+    0x4D, 0x32, 0x31, 0x4C, 0x2A, 0x2B, 0x4C, 0x30, 0x12, 0x1A, 0x0E, 0x0E,
+    0x1A, 0x12, 0x13, 0x1A, 0x0F, 0x0E, 0x1B, 0x02, 0xBC, 0xFD, 0x44, 0x01,
+    0x49, 0x32, 0x57, 0x38, 0x38, 0x59, 0x31, 0x31, 0x59, 0x38, 0x37, 0x57,
+    0x33, 0x5E, 0x18, 0x2D, 0x1E, 0x1E, 0x2E, 0x18, 0x19, 0x2D, 0x1E, 0x1E,
+    0x2D, 0x18, 0xFE, 0x50, 0x32, 0x57, 0x38, 0x38, 0x58, 0x32, 0x32, 0x58,
+    0x38, 0x37, 0x58, 0x32, 0x5D, 0x19, 0x2C, 0x1F, 0x1E, 0x2D, 0x19, 0x19,
+    0x2D, 0x1E, 0x1F, 0x2C, 0x19, 0x00, 0x00, 0x07, 0x00, 0x28, 0xFF, 0xF7,
+    0x04, 0xE4, 0x02, 0xC9, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33,
+    0x00, 0x43, 0x00, 0x53, 0x00, 0x63, 0x00, 0x00, 0x73, 0x01, 0x33, 0x01,
+    0x03, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x05, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0xA1, 0x01, 0xCF, 0x86, 0xFE, 0x2C, 0x51, 0x31, 0x4D, 0x2B, 0x2B, 0x4D,
+    0x31, 0x32, 0x4B, 0x2B, 0x2C, 0x4C, 0x30, 0x12, 0x1A, 0x0E, 0x0E, 0x1A,
+    0x12, 0x12, 0x1B, 0x0E, 0x0E, 0x1B, 0x02, 0x03, 0x30, 0x4D, 0x2C, 0x2B,
+    0x4D, 0x31, 0x32, 0x4C, 0x2A, 0x2C, 0x4B, 0x31, 0x12, 0x1A, 0x0E, 0x0E,
+    0x1A, 0x12, 0x12, 0x1B, 0x0E, 0x0E, 0x1B, 0x01, 0x8C, 0x31, 0x4C, 0x2C,
+    0x2B, 0x4D, 0x31, 0x32, 0x4C, 0x2A, 0x2C, 0x4B, 0x31, 0x13, 0x19, 0x0E,
+    0x0E, 0x19, 0x13, 0x12, 0x1B, 0x0E, 0x0E, 0x1B, 0x02, 0xBC, 0xFD, 0x44,
+    0x01, 0x46, 0x32, 0x57, 0x38, 0x38, 0x59, 0x31, 0x31, 0x59, 0x38, 0x37,
+    0x57, 0x33, 0x5E, 0x18, 0x2C, 0x1F, 0x1E, 0x2D, 0x19, 0x19, 0x2D, 0x1E,
+    0x1F, 0x2C, 0x18, 0xFE, 0x53, 0x33, 0x57, 0x37, 0x38, 0x59, 0x31, 0x31,
+    0x59, 0x38, 0x37, 0x57, 0x33, 0x5D, 0x19, 0x2D, 0x1E, 0x1E, 0x2D, 0x19,
+    0x18, 0x2E, 0x1E, 0x1E, 0x2D, 0x19, 0x5D, 0x33, 0x57, 0x37, 0x38, 0x59,
+    0x31, 0x31, 0x58, 0x39, 0x37, 0x57, 0x33, 0x5D, 0x19, 0x2D, 0x1E, 0x1E,
+    0x2E, 0x18, 0x18, 0x2E, 0x1E, 0x1E, 0x2D, 0x19, 0x00, 0x02, 0x00, 0x25,
+    0xFF, 0xC8, 0x02, 0x56, 0x02, 0xC2, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x45, 0x09, 0x02, 0x05, 0x37, 0x27, 0x07, 0x01, 0x3D, 0xFE, 0xE8, 0x01,
+    0x18, 0x01, 0x19, 0xFE, 0xE8, 0x84, 0x84, 0x84, 0x38, 0x01, 0x7F, 0x01,
+    0x7B, 0xFE, 0x88, 0xC1, 0xBE, 0xB9, 0xB8, 0x00, 0x00, 0x02, 0x00, 0x4C,
+    0x02, 0x4C, 0x01, 0xA8, 0x03, 0xC2, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0xFA, 0x44, 0x5B, 0x0F, 0x5B, 0x0C,
+    0x2D, 0x1A, 0x1A, 0x2D, 0x0C, 0x5B, 0x0F, 0x5B, 0x3B, 0x3C, 0x5A, 0x60,
+    0x02, 0x4C, 0x4B, 0x41, 0x0C, 0x1E, 0x1D, 0x1D, 0x1E, 0x0C, 0x41, 0x4B,
+    0xAD, 0x2A, 0x9F, 0x45, 0x00, 0x02, 0x00, 0x4C, 0x02, 0x4C, 0x01, 0xA8,
+    0x03, 0xC2, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x27,
+    0x37, 0x17, 0xFA, 0x44, 0x5B, 0x0F, 0x5B, 0x0C, 0x2D, 0x1A, 0x1A, 0x2D,
+    0x0C, 0x5B, 0x0E, 0x5C, 0x43, 0x82, 0x60, 0x5B, 0x02, 0x4C, 0x4E, 0x44,
+    0x0C, 0x21, 0x20, 0x20, 0x21, 0x0C, 0x44, 0x4E, 0xAC, 0x84, 0x46, 0x9F,
+    0x00, 0x02, 0x00, 0x4C, 0x02, 0x4C, 0x01, 0xA8, 0x03, 0xCD, 0x00, 0x0D,
+    0x00, 0x2D, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0xFA, 0x44, 0x5B, 0x0F, 0x5B, 0x0C, 0x2D, 0x1A, 0x1A, 0x2D,
+    0x0C, 0x5B, 0x0E, 0x5C, 0x5D, 0x08, 0x09, 0x0A, 0x10, 0x0D, 0x0F, 0x11,
+    0x0F, 0x12, 0x29, 0x14, 0x14, 0x15, 0x3A, 0x1D, 0x38, 0x40, 0x1B, 0x11,
+    0x10, 0x13, 0x01, 0x01, 0x02, 0x4C, 0x4E, 0x44, 0x0C, 0x21, 0x20, 0x20,
+    0x21, 0x0C, 0x44, 0x4E, 0xAC, 0x0A, 0x14, 0x0A, 0x0A, 0x14, 0x0B, 0x09,
+    0x0D, 0x07, 0x0A, 0x09, 0x0B, 0x08, 0x4D, 0x0D, 0x0D, 0x30, 0x27, 0x1D,
+    0x1F, 0x09, 0x08, 0x0F, 0x0A, 0x03, 0x05, 0x02, 0x00, 0x02, 0x00, 0x4B,
+    0x02, 0x4C, 0x01, 0xA9, 0x03, 0xB8, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x14, 0x06, 0x06, 0xFA, 0x43, 0x5C, 0x0E, 0x5A, 0x0D, 0x2C,
+    0x1A, 0x1B, 0x2C, 0x0C, 0x5B, 0x0E, 0x5C, 0x0A, 0x18, 0x27, 0x15, 0x0F,
+    0x16, 0x0B, 0x0E, 0x15, 0x03, 0x53, 0x02, 0x3B, 0x2C, 0x14, 0x25, 0x14,
+    0x0E, 0x18, 0x0B, 0x0E, 0x14, 0x03, 0x52, 0x18, 0x2B, 0x02, 0x4C, 0x4E,
+    0x44, 0x0C, 0x21, 0x20, 0x20, 0x21, 0x0C, 0x44, 0x4E, 0xEA, 0x0E, 0x09,
+    0x06, 0x09, 0x13, 0x12, 0x0C, 0x30, 0x45, 0x0E, 0x09, 0x07, 0x08, 0x13,
+    0x12, 0x0C, 0x1F, 0x35, 0x21, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x02, 0x57,
+    0x01, 0xEE, 0x03, 0xB4, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x27, 0x37, 0x17, 0x36, 0x2C,
+    0x7F, 0x5C, 0x7F, 0x2D, 0x8F, 0x1E, 0xA9, 0x3C, 0x5B, 0x60, 0x02, 0x57,
+    0x2F, 0x6E, 0x6E, 0x2F, 0x46, 0x4E, 0x2A, 0x9F, 0x45, 0x00, 0x00, 0x02,
+    0x00, 0x37, 0x02, 0x57, 0x01, 0xC1, 0x03, 0xB3, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x27,
+    0x37, 0x17, 0x63, 0x2C, 0x7F, 0x5C, 0x7F, 0x2D, 0x8F, 0x1E, 0x95, 0x81,
+    0x5F, 0x5B, 0x02, 0x57, 0x2F, 0x6D, 0x6D, 0x2F, 0x46, 0x4D, 0x84, 0x45,
+    0x9E, 0x00, 0x00, 0x02, 0x00, 0x14, 0x02, 0x57, 0x01, 0xE0, 0x03, 0xB7,
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07,
+    0x27, 0x33, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x37,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x41, 0x2D,
+    0x7F, 0x5D, 0x7E, 0x2C, 0x90, 0x1E, 0x89, 0x08, 0x09, 0x0B, 0x0F, 0x0E,
+    0x0E, 0x01, 0x12, 0x0E, 0x13, 0x29, 0x14, 0x13, 0x15, 0x39, 0x1D, 0x38,
+    0x41, 0x1C, 0x10, 0x11, 0x13, 0x01, 0x01, 0x02, 0x57, 0x2F, 0x6E, 0x6E,
+    0x2F, 0x46, 0x44, 0x0A, 0x14, 0x0A, 0x0A, 0x15, 0x0A, 0x09, 0x0D, 0x08,
+    0x09, 0x09, 0x09, 0x0A, 0x4E, 0x0C, 0x0E, 0x30, 0x27, 0x1D, 0x1F, 0x09,
+    0x09, 0x0E, 0x0A, 0x03, 0x05, 0x03, 0x00, 0x02, 0x00, 0x4B, 0x02, 0x57,
+    0x01, 0xA9, 0x03, 0xB1, 0x00, 0x07, 0x00, 0x22, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06, 0x06, 0x7A, 0x2C, 0x7E,
+    0x5D, 0x7E, 0x2C, 0x90, 0x1E, 0x3F, 0x18, 0x27, 0x15, 0x0F, 0x16, 0x0B,
+    0x0E, 0x15, 0x03, 0x53, 0x02, 0x3B, 0x2C, 0x14, 0x25, 0x14, 0x0E, 0x18,
+    0x0B, 0x0E, 0x14, 0x03, 0x52, 0x18, 0x2B, 0x02, 0x57, 0x2F, 0x6E, 0x6E,
+    0x2F, 0x46, 0x93, 0x0E, 0x09, 0x06, 0x08, 0x12, 0x12, 0x0C, 0x30, 0x44,
+    0x0D, 0x09, 0x07, 0x08, 0x13, 0x12, 0x0C, 0x1F, 0x35, 0x21, 0x00, 0x02,
+    0x00, 0x37, 0x02, 0x77, 0x01, 0xBD, 0x03, 0x14, 0x00, 0x0B, 0x00, 0x17,
+    0x00, 0x00, 0x41, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x01, 0x6C, 0x27, 0x2A, 0x2C, 0x25, 0x27, 0x2A, 0x2C, 0xFE,
+    0xF7, 0x26, 0x2B, 0x2C, 0x25, 0x27, 0x2A, 0x2B, 0x02, 0x77, 0x29, 0x26,
+    0x23, 0x2B, 0x28, 0x26, 0x23, 0x2C, 0x29, 0x26, 0x23, 0x2B, 0x28, 0x26,
+    0x23, 0x2C, 0x00, 0x03, 0x00, 0x37, 0x02, 0x69, 0x01, 0xBD, 0x03, 0xDA,
+    0x00, 0x0B, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x33, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x27, 0x27, 0x37, 0x17,
+    0x88, 0x27, 0x2A, 0x2C, 0x25, 0x27, 0x2A, 0x2C, 0xBF, 0x27, 0x2A, 0x2B,
+    0x26, 0x26, 0x2B, 0x2C, 0x8B, 0x3F, 0x57, 0x64, 0x02, 0x69, 0x29, 0x25,
+    0x23, 0x2C, 0x29, 0x26, 0x23, 0x2B, 0x29, 0x25, 0x23, 0x2C, 0x29, 0x26,
+    0x23, 0x2B, 0xA7, 0x29, 0xA1, 0x47, 0xFF, 0xFF, 0x00, 0x37, 0x02, 0x77,
+    0x01, 0xBD, 0x03, 0xA6, 0x06, 0x26, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x05, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x01, 0x00, 0xA3, 0x02, 0x7A,
+    0x01, 0x51, 0x03, 0x14, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0xFA, 0x29, 0x2E, 0x2F,
+    0x28, 0x29, 0x2E, 0x2F, 0x02, 0x7A, 0x28, 0x25, 0x22, 0x2B, 0x28, 0x25,
+    0x22, 0x2B, 0xFF, 0xFF, 0x00, 0x5A, 0x02, 0x7A, 0x01, 0x9A, 0x03, 0xA6,
+    0x06, 0x26, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0x00, 0x00,
+    0x00, 0xCC, 0x00, 0x01, 0x00, 0x83, 0x02, 0x4F, 0x01, 0x71, 0x03, 0x19,
+    0x00, 0x03, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x01, 0x46, 0xC3, 0x47,
+    0xA7, 0x02, 0x4F, 0x69, 0x61, 0x88, 0x00, 0x01, 0x00, 0x83, 0x02, 0x4E,
+    0x01, 0x71, 0x03, 0x19, 0x00, 0x03, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17,
+    0xAE, 0x2B, 0xA7, 0x47, 0x02, 0x4E, 0x42, 0x89, 0x62, 0x00, 0x00, 0x02,
+    0x00, 0x3D, 0x02, 0x69, 0x01, 0xB7, 0x03, 0x30, 0x00, 0x03, 0x00, 0x0F,
+    0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x05, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x3B, 0x3E, 0x5D, 0x5D, 0xFE,
+    0xD8, 0x27, 0x2B, 0x2C, 0x26, 0x27, 0x2B, 0x2C, 0x02, 0x69, 0x2A, 0x9D,
+    0x43, 0x7F, 0x26, 0x23, 0x20, 0x28, 0x26, 0x22, 0x21, 0x28, 0x00, 0x02,
+    0x00, 0x20, 0x02, 0x4D, 0x01, 0xD5, 0x03, 0x1E, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x05, 0x27, 0x37, 0x17, 0x01, 0x24,
+    0x37, 0x96, 0x52, 0xFE, 0x83, 0x38, 0x8E, 0x55, 0x02, 0x4F, 0x33, 0x9B,
+    0x57, 0x79, 0x31, 0xA0, 0x54, 0x00, 0x00, 0x01, 0x00, 0xA2, 0x01, 0xC7,
+    0x01, 0x52, 0x02, 0xB3, 0x00, 0x15, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02,
+    0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x0E, 0x02, 0xC4, 0x22, 0x0E, 0x1E, 0x16, 0x0A, 0x0C, 0x14,
+    0x10, 0x2A, 0x21, 0x27, 0x36, 0x14, 0x25, 0x34, 0x01, 0xC7, 0x32, 0x05,
+    0x11, 0x17, 0x0B, 0x08, 0x09, 0x04, 0x07, 0x17, 0x13, 0x1D, 0x1F, 0x2F,
+    0x2C, 0x1A, 0x2D, 0x24, 0x1C, 0x00, 0x00, 0x01, 0x00, 0x45, 0x02, 0x57,
+    0x01, 0xAF, 0x02, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33,
+    0x17, 0x07, 0x27, 0x33, 0x78, 0x33, 0x87, 0x5C, 0x87, 0x33, 0x91, 0x1E,
+    0x02, 0x57, 0x2C, 0x7C, 0x7C, 0x2C, 0x52, 0x00, 0x00, 0x01, 0x00, 0x4B,
+    0x02, 0x5B, 0x01, 0xA9, 0x03, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x17, 0x23, 0x37, 0x17, 0x07, 0xCC, 0x81, 0x33, 0x8B, 0x1E, 0x8B,
+    0x33, 0x81, 0x02, 0x5B, 0x7C, 0x2C, 0x52, 0x52, 0x2C, 0x7C, 0x00, 0x02,
+    0x00, 0x4B, 0x02, 0x57, 0x01, 0xA9, 0x03, 0xAB, 0x00, 0x07, 0x00, 0x13,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x23, 0x37, 0x17, 0x07, 0x27, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0xCC, 0x81,
+    0x33, 0x8B, 0x1E, 0x8B, 0x33, 0x81, 0x2E, 0x29, 0x2E, 0x2F, 0x28, 0x29,
+    0x2E, 0x2F, 0x02, 0x57, 0x7D, 0x2C, 0x52, 0x52, 0x2C, 0x7D, 0xB9, 0x29,
+    0x24, 0x23, 0x2B, 0x29, 0x25, 0x22, 0x2B, 0x00, 0x00, 0x01, 0x00, 0x4C,
+    0x02, 0x51, 0x01, 0xA8, 0x02, 0xFB, 0x00, 0x0D, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0xFA, 0x44, 0x5B, 0x0F, 0x5E, 0x0B, 0x2B, 0x1A, 0x1A, 0x2B, 0x0B, 0x5E,
+    0x0F, 0x5B, 0x02, 0x51, 0x55, 0x49, 0x0C, 0x22, 0x27, 0x27, 0x22, 0x0C,
+    0x49, 0x55, 0x00, 0x02, 0x00, 0x85, 0x02, 0x58, 0x01, 0x6F, 0x03, 0x3A,
+    0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xFA, 0x1E,
+    0x36, 0x21, 0x20, 0x36, 0x1F, 0x20, 0x35, 0x20, 0x20, 0x35, 0x20, 0x11,
+    0x18, 0x18, 0x11, 0x11, 0x18, 0x18, 0x02, 0x58, 0x1F, 0x33, 0x1F, 0x1F,
+    0x33, 0x1F, 0x1F, 0x33, 0x1F, 0x1F, 0x33, 0x1F, 0x4A, 0x16, 0x11, 0x11,
+    0x17, 0x17, 0x11, 0x11, 0x16, 0x00, 0x00, 0x01, 0x00, 0x4B, 0x02, 0x62,
+    0x01, 0xA9, 0x02, 0xF5, 0x00, 0x1A, 0x00, 0x00, 0x41, 0x22, 0x26, 0x27,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06, 0x06, 0x01,
+    0x39, 0x12, 0x20, 0x15, 0x12, 0x14, 0x08, 0x0E, 0x15, 0x03, 0x53, 0x02,
+    0x3D, 0x33, 0x12, 0x20, 0x14, 0x0F, 0x16, 0x0A, 0x0E, 0x14, 0x03, 0x52,
+    0x1D, 0x31, 0x02, 0x62, 0x0E, 0x0E, 0x0F, 0x0C, 0x19, 0x1A, 0x0B, 0x36,
+    0x4E, 0x0D, 0x0F, 0x0C, 0x0F, 0x1B, 0x18, 0x0C, 0x22, 0x3D, 0x24, 0x00,
+    0x00, 0x03, 0x00, 0x3C, 0x02, 0x62, 0x01, 0xB8, 0x03, 0xB7, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x32, 0x00, 0x00, 0x41, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x17, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x69, 0x26, 0x29,
+    0x2B, 0x24, 0x26, 0x29, 0x2A, 0xFE, 0xFD, 0x26, 0x29, 0x2B, 0x24, 0x26,
+    0x29, 0x2B, 0x8A, 0x12, 0x20, 0x15, 0x12, 0x15, 0x07, 0x0E, 0x15, 0x03,
+    0x53, 0x01, 0x3D, 0x34, 0x12, 0x1F, 0x14, 0x10, 0x16, 0x0A, 0x0E, 0x14,
+    0x03, 0x52, 0x01, 0x1C, 0x32, 0x03, 0x25, 0x26, 0x23, 0x20, 0x29, 0x26,
+    0x23, 0x20, 0x29, 0x26, 0x23, 0x20, 0x29, 0x26, 0x23, 0x20, 0x29, 0xC3,
+    0x0E, 0x0E, 0x0F, 0x0C, 0x19, 0x1A, 0x0B, 0x36, 0x4E, 0x0D, 0x0F, 0x0C,
+    0x0F, 0x1B, 0x18, 0x0C, 0x22, 0x3D, 0x24, 0x00, 0x00, 0x02, 0x00, 0x4B,
+    0x02, 0x62, 0x01, 0xA9, 0x03, 0xCE, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x00,
+    0x41, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x14, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0x01, 0x39, 0x12, 0x20, 0x15,
+    0x12, 0x14, 0x08, 0x0E, 0x15, 0x03, 0x53, 0x02, 0x3D, 0x33, 0x12, 0x20,
+    0x14, 0x0F, 0x16, 0x0A, 0x0E, 0x14, 0x03, 0x52, 0x1D, 0x31, 0x55, 0x3F,
+    0x5D, 0x5E, 0x02, 0x62, 0x0E, 0x0E, 0x0F, 0x0C, 0x19, 0x1A, 0x0B, 0x36,
+    0x4E, 0x0D, 0x0F, 0x0C, 0x0F, 0x1B, 0x18, 0x0C, 0x22, 0x3D, 0x24, 0xA5,
+    0x2A, 0x9D, 0x44, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0x02, 0x62, 0x01, 0xA8,
+    0x03, 0xA2, 0x04, 0x26, 0x03, 0x01, 0xFF, 0x00, 0x02, 0x07, 0x03, 0x05,
+    0x00, 0x00, 0x00, 0xC9, 0x00, 0x01, 0x00, 0x5A, 0x02, 0x7D, 0x01, 0x9A,
+    0x02, 0xD9, 0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x5A, 0x01,
+    0x40, 0x02, 0x7D, 0x5C, 0x5C, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0x02, 0x7D,
+    0x01, 0xBD, 0x03, 0xBA, 0x06, 0x26, 0x03, 0x05, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF2, 0x00, 0x00, 0x00, 0xA6, 0x00, 0x02, 0x00, 0x5A, 0x02, 0x73,
+    0x01, 0x9A, 0x03, 0xC2, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x07, 0x35, 0x21, 0x15, 0x01, 0x06, 0x7C, 0x5D, 0x5D, 0xEA,
+    0x01, 0x40, 0x02, 0xFB, 0x83, 0x44, 0x9E, 0xB1, 0x5C, 0x5C, 0x00, 0x02,
+    0x00, 0x5A, 0x02, 0x73, 0x01, 0x9A, 0x03, 0xC2, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x27, 0x27, 0x37, 0x17, 0x5A, 0x01,
+    0x40, 0x9C, 0x3E, 0x5D, 0x5D, 0x02, 0x73, 0x5C, 0x5C, 0x88, 0x29, 0x9E,
+    0x44, 0x00, 0x00, 0x01, 0x00, 0x88, 0x02, 0x4C, 0x01, 0x6D, 0x03, 0x2A,
+    0x00, 0x1F, 0x00, 0x00, 0x53, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17,
+    0xE2, 0x07, 0x0B, 0x0C, 0x12, 0x0F, 0x0F, 0x11, 0x0D, 0x13, 0x2A, 0x14,
+    0x15, 0x16, 0x3B, 0x1E, 0x37, 0x3F, 0x1A, 0x10, 0x10, 0x14, 0x02, 0x01,
+    0x02, 0x4C, 0x0A, 0x14, 0x0B, 0x0B, 0x17, 0x0C, 0x0A, 0x0D, 0x09, 0x09,
+    0x09, 0x0B, 0x09, 0x4D, 0x0C, 0x10, 0x30, 0x26, 0x1E, 0x21, 0x09, 0x0A,
+    0x10, 0x0A, 0x04, 0x06, 0x04, 0x00, 0x00, 0x02, 0x00, 0x20, 0x02, 0x4D,
+    0x01, 0xD5, 0x03, 0x1E, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x05, 0x27, 0x37, 0x17, 0x01, 0x9C, 0xAB, 0x56, 0x8E, 0xFE,
+    0xFC, 0xB1, 0x52, 0x95, 0x02, 0x4D, 0x7D, 0x54, 0xA0, 0x2F, 0x77, 0x57,
+    0x9B, 0x00, 0x00, 0x01, 0x00, 0x4C, 0x02, 0x5B, 0x01, 0xA8, 0x03, 0x05,
+    0x00, 0x0D, 0x00, 0x00, 0x53, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0xAA, 0x5E, 0x0F, 0x5B, 0x44, 0x44,
+    0x5B, 0x0F, 0x5E, 0x0B, 0x2B, 0x1A, 0x1A, 0x2B, 0x02, 0x5B, 0x0C, 0x4A,
+    0x54, 0x54, 0x4A, 0x0C, 0x22, 0x28, 0x28, 0x00, 0x00, 0x01, 0x00, 0xA2,
+    0x02, 0x53, 0x01, 0x52, 0x03, 0x3F, 0x00, 0x15, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16,
+    0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0xFD, 0x23, 0x38, 0x1A, 0x2A, 0x32,
+    0x18, 0x22, 0x0D, 0x1F, 0x16, 0x0E, 0x0A, 0x0F, 0x13, 0x2D, 0x02, 0x53,
+    0x2D, 0x30, 0x1C, 0x2D, 0x23, 0x1B, 0x08, 0x33, 0x03, 0x11, 0x17, 0x0D,
+    0x0A, 0x07, 0x04, 0x06, 0x14, 0x16, 0x1E, 0x1E, 0x00, 0x01, 0x00, 0x94,
+    0x01, 0xBE, 0x01, 0x60, 0x02, 0x87, 0x00, 0x08, 0x00, 0x00, 0x53, 0x35,
+    0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x94, 0x30, 0x2F, 0x6D, 0x2B,
+    0x5A, 0x01, 0xBE, 0x57, 0x39, 0x39, 0x39, 0x5B, 0x35, 0x00, 0x00, 0x01,
+    0x00, 0xA2, 0xFF, 0x26, 0x01, 0x52, 0xFF, 0xC3, 0x00, 0x0B, 0x00, 0x00,
+    0x57, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0xFA, 0x2A, 0x2E, 0x2F, 0x29, 0x2A, 0x2E, 0x2F, 0xDA, 0x29, 0x26, 0x22,
+    0x2C, 0x29, 0x25, 0x23, 0x2C, 0x00, 0x00, 0x02, 0x00, 0x37, 0xFF, 0x26,
+    0x01, 0xBD, 0xFF, 0xC3, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x21, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x6C,
+    0x27, 0x2A, 0x2C, 0x25, 0x27, 0x2A, 0x2C, 0xFE, 0xF7, 0x26, 0x2B, 0x2C,
+    0x25, 0x27, 0x2A, 0x2B, 0xDA, 0x29, 0x25, 0x23, 0x2C, 0x29, 0x26, 0x23,
+    0x2B, 0x29, 0x25, 0x23, 0x2C, 0x29, 0x26, 0x23, 0x2B, 0x00, 0x00, 0x01,
+    0x00, 0xA2, 0xFE, 0xEB, 0x01, 0x52, 0xFF, 0xD7, 0x00, 0x15, 0x00, 0x00,
+    0x53, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x0E, 0x02, 0xC4, 0x22, 0x0E, 0x1E,
+    0x16, 0x0A, 0x0C, 0x14, 0x10, 0x2B, 0x22, 0x27, 0x34, 0x14, 0x25, 0x34,
+    0xFE, 0xEB, 0x33, 0x04, 0x12, 0x16, 0x0C, 0x07, 0x09, 0x05, 0x07, 0x17,
+    0x12, 0x1D, 0x1F, 0x30, 0x2C, 0x18, 0x2A, 0x24, 0x1E, 0x00, 0x00, 0x01,
+    0x00, 0x91, 0xFF, 0x0A, 0x01, 0x64, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00,
+    0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x27, 0x37,
+    0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x9A, 0x09, 0x16, 0x2F,
+    0x21, 0x1A, 0x24, 0x0F, 0x10, 0x46, 0x4B, 0x2D, 0x33, 0x33, 0x26, 0x3C,
+    0x47, 0xF5, 0x44, 0x0C, 0x14, 0x0C, 0x0D, 0x0E, 0x08, 0x0C, 0x6E, 0x44,
+    0x07, 0x34, 0x24, 0x1D, 0x29, 0x1A, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x85,
+    0xFF, 0x31, 0x01, 0x6F, 0x00, 0x2D, 0x00, 0x18, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xFA, 0x20, 0x36, 0x1F,
+    0x16, 0x2B, 0x40, 0x2A, 0x25, 0x1C, 0x2F, 0x1C, 0x10, 0x0E, 0x0A, 0x0F,
+    0x08, 0x42, 0x09, 0x22, 0x2D, 0xCF, 0x1D, 0x31, 0x1E, 0x19, 0x2B, 0x24,
+    0x1C, 0x0C, 0x2D, 0x06, 0x1A, 0x20, 0x12, 0x0E, 0x10, 0x0C, 0x0C, 0x30,
+    0x11, 0x22, 0x14, 0x00, 0x00, 0x01, 0x00, 0x4C, 0xFF, 0x15, 0x01, 0xA8,
+    0xFF, 0xBF, 0x00, 0x0D, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0xFA, 0x42, 0x5D, 0x0F,
+    0x5E, 0x0B, 0x2C, 0x19, 0x19, 0x2C, 0x0B, 0x5E, 0x0F, 0x5D, 0xEB, 0x55,
+    0x49, 0x0C, 0x22, 0x27, 0x27, 0x22, 0x0C, 0x49, 0x55, 0x00, 0x00, 0x01,
+    0x00, 0x65, 0xFF, 0x40, 0x01, 0x8F, 0xFF, 0xA8, 0x00, 0x03, 0x00, 0x00,
+    0x57, 0x35, 0x21, 0x15, 0x65, 0x01, 0x2A, 0xC0, 0x68, 0x68, 0x00, 0x01,
+    0x00, 0x61, 0x00, 0xEF, 0x01, 0x93, 0x01, 0x5D, 0x00, 0x03, 0x00, 0x00,
+    0x77, 0x35, 0x21, 0x15, 0x61, 0x01, 0x32, 0xEF, 0x6E, 0x6E, 0xFF, 0xFF,
+    0x00, 0x37, 0x02, 0x77, 0x01, 0xBD, 0x03, 0x14, 0x04, 0x06, 0x02, 0xF2,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA3, 0x02, 0x7A, 0x01, 0x51, 0x03, 0x14,
+    0x04, 0x06, 0x02, 0xF5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x83, 0x02, 0x4F,
+    0x01, 0x71, 0x03, 0x19, 0x04, 0x06, 0x02, 0xF7, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x83, 0x02, 0x4E, 0x01, 0x71, 0x03, 0x19, 0x04, 0x06, 0x02, 0xF8,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0x02, 0x4D, 0x01, 0xD5, 0x03, 0x1E,
+    0x04, 0x06, 0x02, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x45, 0x02, 0x57,
+    0x01, 0xAF, 0x02, 0xFF, 0x04, 0x06, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x4B, 0x02, 0x5B, 0x01, 0xA9, 0x03, 0x03, 0x04, 0x06, 0x02, 0xFD,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x4C, 0x02, 0x51, 0x01, 0xA8, 0x02, 0xFB,
+    0x04, 0x06, 0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x85, 0x02, 0x58,
+    0x01, 0x6F, 0x03, 0x3A, 0x04, 0x06, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x4B, 0x02, 0x62, 0x01, 0xA9, 0x02, 0xF5, 0x04, 0x06, 0x03, 0x01,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5A, 0x02, 0x7D, 0x01, 0x9A, 0x02, 0xD9,
+    0x04, 0x06, 0x03, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x91, 0xFF, 0x0A,
+    0x01, 0x64, 0x00, 0x18, 0x04, 0x06, 0x03, 0x11, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x85, 0xFF, 0x31, 0x01, 0x6F, 0x00, 0x2D, 0x04, 0x06, 0x03, 0x12,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0x02, 0xF3, 0x01, 0xBF, 0x03, 0x91,
+    0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x41, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x21, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x6E, 0x28, 0x29, 0x2A, 0x27,
+    0x28, 0x29, 0x2A, 0xFE, 0xF2, 0x29, 0x29, 0x2A, 0x28, 0x28, 0x29, 0x2A,
+    0x02, 0xF3, 0x2B, 0x24, 0x21, 0x2E, 0x2A, 0x25, 0x20, 0x2F, 0x2B, 0x24,
+    0x21, 0x2E, 0x2A, 0x25, 0x20, 0x2F, 0x00, 0x03, 0x00, 0x35, 0x02, 0xF3,
+    0x01, 0xBF, 0x04, 0x67, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x17, 0x03, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x33, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0xA8, 0x21, 0xC8, 0x34, 0xFC, 0x29, 0x29, 0x2A,
+    0x28, 0x28, 0x29, 0x2A, 0xC0, 0x28, 0x29, 0x2A, 0x27, 0x28, 0x29, 0x2A,
+    0x03, 0xAD, 0x48, 0x72, 0x6D, 0xFE, 0xF9, 0x2B, 0x24, 0x21, 0x2E, 0x2A,
+    0x25, 0x20, 0x2F, 0x2B, 0x24, 0x21, 0x2E, 0x2A, 0x25, 0x20, 0x2F, 0x00,
+    0xFF, 0xFF, 0x00, 0x35, 0x02, 0xF3, 0x01, 0xBF, 0x04, 0x22, 0x06, 0x26,
+    0x03, 0x23, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0xFF, 0xFF, 0x00, 0xB1,
+    0x00, 0x01, 0x00, 0xA3, 0x02, 0xF5, 0x01, 0x51, 0x03, 0x8F, 0x00, 0x0B,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0xFA, 0x2A, 0x2D, 0x2D, 0x2A, 0x2A, 0x2D, 0x2D, 0x02, 0xF5,
+    0x2A, 0x23, 0x20, 0x2D, 0x29, 0x24, 0x1F, 0x2E, 0xFF, 0xFF, 0x00, 0x4C,
+    0x02, 0xF5, 0x01, 0xA9, 0x04, 0x22, 0x04, 0x26, 0x03, 0x26, 0x01, 0x00,
+    0x02, 0x07, 0x03, 0x3C, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x01, 0x00, 0x7B,
+    0x02, 0xEE, 0x01, 0x79, 0x03, 0xA8, 0x00, 0x03, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x01, 0x56, 0xDB, 0x35, 0xC9, 0x02, 0xEE, 0x4D, 0x6D, 0x73,
+    0x00, 0x01, 0x00, 0x7C, 0x02, 0xEE, 0x01, 0x78, 0x03, 0xA8, 0x00, 0x03,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x9E, 0x22, 0xC8, 0x34, 0x02, 0xEE,
+    0x47, 0x73, 0x6D, 0x00, 0x00, 0x02, 0x00, 0x3D, 0x02, 0xEF, 0x01, 0xB7,
+    0x03, 0xB6, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17,
+    0x05, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0x01, 0x3B, 0x3E, 0x5D, 0x5D, 0xFE, 0xD8, 0x27, 0x2B, 0x2C, 0x26, 0x27,
+    0x2B, 0x2C, 0x02, 0xEF, 0x2A, 0x9D, 0x43, 0x7F, 0x26, 0x23, 0x20, 0x28,
+    0x25, 0x23, 0x20, 0x29, 0x00, 0x02, 0x00, 0x1E, 0x02, 0xEF, 0x01, 0xD6,
+    0x03, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17,
+    0x17, 0x27, 0x37, 0x17, 0x4D, 0x2F, 0x91, 0x4B, 0x2A, 0x2E, 0x95, 0x4B,
+    0x02, 0xF0, 0x3F, 0x8D, 0x5B, 0x72, 0x40, 0x8B, 0x5D, 0x00, 0x00, 0x01,
+    0x00, 0x4C, 0x02, 0xF2, 0x01, 0xA9, 0x03, 0x8D, 0x00, 0x07, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x79, 0x2D, 0x84, 0x54,
+    0x85, 0x2E, 0x8F, 0x1D, 0x02, 0xF2, 0x32, 0x69, 0x69, 0x32, 0x46, 0x00,
+    0x00, 0x02, 0x00, 0x33, 0x02, 0xF0, 0x01, 0xC1, 0x04, 0x35, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33,
+    0x37, 0x27, 0x37, 0x17, 0x5D, 0x2A, 0x82, 0x54, 0x82, 0x29, 0x91, 0x1D,
+    0x99, 0x81, 0x5F, 0x5C, 0x02, 0xF0, 0x31, 0x64, 0x64, 0x31, 0x40, 0x3B,
+    0x84, 0x46, 0x9F, 0x00, 0x00, 0x02, 0x00, 0x10, 0x02, 0xF0, 0x01, 0xE8,
+    0x04, 0x33, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33,
+    0x17, 0x07, 0x27, 0x33, 0x37, 0x27, 0x37, 0x17, 0x39, 0x29, 0x81, 0x55,
+    0x81, 0x29, 0x91, 0x1D, 0xA0, 0x3C, 0x5A, 0x60, 0x02, 0xF0, 0x31, 0x64,
+    0x64, 0x31, 0x40, 0x3B, 0x29, 0x9F, 0x45, 0x00, 0x00, 0x02, 0x00, 0x49,
+    0x02, 0xF0, 0x01, 0xAC, 0x04, 0x34, 0x00, 0x07, 0x00, 0x22, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x22, 0x26, 0x27,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x78, 0x2A,
+    0x82, 0x54, 0x82, 0x29, 0x91, 0x1D, 0x42, 0x17, 0x29, 0x13, 0x12, 0x19,
+    0x0A, 0x0F, 0x13, 0x04, 0x54, 0x02, 0x3E, 0x2F, 0x15, 0x22, 0x15, 0x0E,
+    0x1B, 0x0A, 0x0F, 0x0E, 0x04, 0x54, 0x01, 0x18, 0x2B, 0x02, 0xF0, 0x31,
+    0x64, 0x64, 0x31, 0x40, 0x84, 0x0D, 0x08, 0x08, 0x09, 0x14, 0x11, 0x06,
+    0x34, 0x45, 0x0D, 0x09, 0x06, 0x0A, 0x14, 0x12, 0x06, 0x21, 0x38, 0x21,
+    0x00, 0x02, 0x00, 0x18, 0x02, 0xF0, 0x01, 0xDD, 0x04, 0x37, 0x00, 0x07,
+    0x00, 0x27, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33,
+    0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x37, 0x34, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x42, 0x2A, 0x82, 0x54,
+    0x82, 0x29, 0x91, 0x1D, 0x83, 0x07, 0x0A, 0x09, 0x11, 0x0C, 0x10, 0x01,
+    0x12, 0x0E, 0x13, 0x29, 0x14, 0x13, 0x15, 0x39, 0x1D, 0x38, 0x41, 0x1D,
+    0x0F, 0x11, 0x13, 0x01, 0x01, 0x02, 0xF0, 0x31, 0x64, 0x64, 0x31, 0x40,
+    0x38, 0x08, 0x14, 0x0A, 0x0A, 0x12, 0x0B, 0x09, 0x0D, 0x05, 0x0A, 0x09,
+    0x0B, 0x08, 0x4D, 0x0C, 0x0E, 0x30, 0x27, 0x1B, 0x1C, 0x0A, 0x09, 0x0F,
+    0x08, 0x02, 0x05, 0x02, 0x00, 0x01, 0x00, 0x4A, 0x02, 0xF3, 0x01, 0xAA,
+    0x03, 0x8E, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x23, 0x37,
+    0x17, 0x07, 0xCC, 0x82, 0x2E, 0x91, 0x1E, 0x91, 0x2E, 0x82, 0x02, 0xF3,
+    0x6B, 0x30, 0x44, 0x44, 0x30, 0x6B, 0x00, 0x01, 0x00, 0x4C, 0x02, 0xF3,
+    0x01, 0xA8, 0x03, 0x91, 0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26,
+    0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xFA,
+    0x2C, 0x48, 0x30, 0x0A, 0x5E, 0x0A, 0x2B, 0x1B, 0x1B, 0x2B, 0x0A, 0x5E,
+    0x09, 0x31, 0x47, 0x02, 0xF3, 0x26, 0x42, 0x2A, 0x0C, 0x19, 0x24, 0x24,
+    0x19, 0x0C, 0x2A, 0x42, 0x26, 0x00, 0x00, 0x02, 0x00, 0x4C, 0x02, 0xEB,
+    0x01, 0xA8, 0x04, 0x41, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x27, 0x27, 0x37, 0x17, 0xFA, 0x42, 0x5E, 0x0E, 0x59, 0x0D, 0x2C, 0x1C,
+    0x1B, 0x2E, 0x0C, 0x59, 0x0E, 0x5E, 0x44, 0x81, 0x5F, 0x5C, 0x02, 0xEB,
+    0x4A, 0x42, 0x0C, 0x22, 0x1C, 0x1C, 0x22, 0x0C, 0x42, 0x4A, 0x8C, 0x85,
+    0x45, 0x9F, 0x00, 0x02, 0x00, 0x4C, 0x02, 0xEB, 0x01, 0xA8, 0x04, 0x41,
+    0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17,
+    0xFA, 0x42, 0x5E, 0x0E, 0x59, 0x0C, 0x2E, 0x1B, 0x1B, 0x2E, 0x0C, 0x59,
+    0x0E, 0x5E, 0x3A, 0x39, 0x5B, 0x5F, 0x02, 0xEB, 0x4A, 0x42, 0x0C, 0x22,
+    0x1C, 0x1C, 0x22, 0x0C, 0x42, 0x4A, 0x8C, 0x2B, 0x9F, 0x45, 0x00, 0x02,
+    0x00, 0x49, 0x02, 0xEB, 0x01, 0xAC, 0x04, 0x35, 0x00, 0x0D, 0x00, 0x28,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xFA, 0x42, 0x5E, 0x0E, 0x59, 0x0C,
+    0x2E, 0x1B, 0x1B, 0x2E, 0x0C, 0x59, 0x0E, 0x5E, 0x0D, 0x15, 0x28, 0x14,
+    0x12, 0x19, 0x0A, 0x0F, 0x13, 0x04, 0x54, 0x02, 0x3E, 0x2F, 0x15, 0x24,
+    0x14, 0x0F, 0x19, 0x0A, 0x0F, 0x0E, 0x04, 0x54, 0x01, 0x18, 0x2C, 0x02,
+    0xEB, 0x47, 0x3E, 0x0C, 0x1F, 0x18, 0x18, 0x1F, 0x0C, 0x3E, 0x47, 0xC8,
+    0x0D, 0x09, 0x08, 0x0A, 0x15, 0x11, 0x06, 0x35, 0x45, 0x0E, 0x09, 0x06,
+    0x0B, 0x14, 0x13, 0x06, 0x22, 0x38, 0x21, 0x00, 0x00, 0x02, 0x00, 0x4C,
+    0x02, 0xEB, 0x01, 0xA8, 0x04, 0x45, 0x00, 0x0D, 0x00, 0x2D, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x27, 0x26, 0x26, 0x35, 0x36, 0x36, 0x37, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0xFA, 0x42,
+    0x5E, 0x0E, 0x59, 0x0C, 0x2E, 0x1B, 0x1B, 0x2E, 0x0C, 0x59, 0x0E, 0x5E,
+    0x5A, 0x07, 0x0A, 0x01, 0x09, 0x10, 0x0C, 0x10, 0x12, 0x0E, 0x13, 0x28,
+    0x14, 0x14, 0x15, 0x39, 0x1D, 0x39, 0x40, 0x1C, 0x10, 0x11, 0x13, 0x01,
+    0x01, 0x02, 0xEB, 0x4A, 0x42, 0x0C, 0x22, 0x1C, 0x1C, 0x22, 0x0C, 0x42,
+    0x4A, 0x8A, 0x09, 0x13, 0x0B, 0x09, 0x13, 0x0B, 0x08, 0x0D, 0x06, 0x09,
+    0x09, 0x0B, 0x08, 0x4E, 0x0B, 0x0F, 0x30, 0x27, 0x1B, 0x1D, 0x09, 0x0A,
+    0x0F, 0x08, 0x02, 0x04, 0x03, 0x00, 0x00, 0x02, 0x00, 0x7D, 0x02, 0xA3,
+    0x01, 0x78, 0x03, 0x91, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x14, 0x16, 0xFA, 0x20, 0x39, 0x24, 0x23, 0x39, 0x21, 0x22, 0x39, 0x23,
+    0x23, 0x39, 0x22, 0x13, 0x1A, 0x1B, 0x12, 0x11, 0x1A, 0x1A, 0x02, 0xA3,
+    0x21, 0x35, 0x1F, 0x22, 0x37, 0x20, 0x20, 0x37, 0x22, 0x1F, 0x35, 0x21,
+    0x4B, 0x18, 0x12, 0x14, 0x17, 0x18, 0x13, 0x12, 0x18, 0x00, 0x00, 0x01,
+    0x00, 0x41, 0x03, 0x00, 0x01, 0xB4, 0x03, 0x85, 0x00, 0x1A, 0x00, 0x00,
+    0x41, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x27, 0x33,
+    0x14, 0x06, 0x06, 0x01, 0x47, 0x15, 0x2A, 0x17, 0x12, 0x19, 0x0A, 0x0D,
+    0x11, 0x5D, 0x48, 0x34, 0x12, 0x25, 0x18, 0x10, 0x17, 0x09, 0x0E, 0x0F,
+    0x01, 0x5C, 0x1B, 0x31, 0x03, 0x00, 0x0D, 0x0A, 0x07, 0x09, 0x14, 0x13,
+    0x3F, 0x46, 0x0B, 0x0C, 0x07, 0x08, 0x15, 0x11, 0x24, 0x3D, 0x24, 0x00,
+    0xFF, 0xFF, 0x00, 0x35, 0x03, 0x00, 0x01, 0xBF, 0x04, 0x42, 0x04, 0x26,
+    0x03, 0x38, 0xFF, 0x00, 0x02, 0x07, 0x03, 0x23, 0x00, 0x00, 0x00, 0xB1,
+    0xFF, 0xFF, 0x00, 0x40, 0x03, 0x00, 0x01, 0xB3, 0x04, 0x59, 0x04, 0x26,
+    0x03, 0x38, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x0A, 0x00, 0xB1,
+    0xFF, 0xFF, 0x00, 0x40, 0x03, 0x00, 0x01, 0xB3, 0x04, 0x22, 0x04, 0x26,
+    0x03, 0x38, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x3C, 0xFF, 0xFF, 0x00, 0xB1,
+    0x00, 0x01, 0x00, 0x4C, 0x03, 0x14, 0x01, 0xA9, 0x03, 0x71, 0x00, 0x03,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x4C, 0x01, 0x5D, 0x03, 0x14, 0x5D,
+    0x5D, 0x00, 0xFF, 0xFF, 0x00, 0x35, 0x03, 0x14, 0x01, 0xBF, 0x04, 0x42,
+    0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00, 0x02, 0x07, 0x03, 0x23, 0x00, 0x00,
+    0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x4B, 0x03, 0x14, 0x01, 0xA8, 0x04, 0x59,
+    0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x28, 0xFF, 0xFF,
+    0x00, 0xB1, 0xFF, 0xFF, 0x00, 0x4B, 0x03, 0x14, 0x01, 0xA8, 0x04, 0x59,
+    0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x0A,
+    0x00, 0xB1, 0x00, 0x01, 0x00, 0x88, 0x02, 0xEE, 0x01, 0x6D, 0x03, 0xCC,
+    0x00, 0x1F, 0x00, 0x00, 0x53, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17,
+    0xE2, 0x07, 0x0B, 0x0C, 0x12, 0x0F, 0x0F, 0x11, 0x0D, 0x13, 0x2A, 0x14,
+    0x15, 0x16, 0x3B, 0x1E, 0x37, 0x3F, 0x1A, 0x10, 0x10, 0x14, 0x02, 0x01,
+    0x02, 0xEE, 0x09, 0x15, 0x0B, 0x0B, 0x17, 0x0C, 0x0A, 0x0D, 0x09, 0x09,
+    0x09, 0x0C, 0x08, 0x4D, 0x0C, 0x10, 0x30, 0x26, 0x1E, 0x21, 0x09, 0x0A,
+    0x10, 0x0A, 0x04, 0x06, 0x04, 0x00, 0x00, 0x02, 0x00, 0x1F, 0x02, 0xE7,
+    0x01, 0xD5, 0x03, 0xB8, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x41, 0x27,
+    0x37, 0x17, 0x05, 0x27, 0x37, 0x17, 0x01, 0xA3, 0xA8, 0x4F, 0x8B, 0xFE,
+    0xF8, 0xAE, 0x4F, 0x90, 0x02, 0xE9, 0x77, 0x58, 0x93, 0x3E, 0x75, 0x5B,
+    0x92, 0x00, 0x00, 0x01, 0x00, 0x4C, 0x02, 0xF4, 0x01, 0xA8, 0x03, 0x91,
+    0x00, 0x0F, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0xAA, 0x5E, 0x0A, 0x30, 0x48,
+    0x2C, 0x2D, 0x47, 0x31, 0x09, 0x5E, 0x0A, 0x2B, 0x1B, 0x1B, 0x2B, 0x02,
+    0xF4, 0x0C, 0x2A, 0x42, 0x25, 0x25, 0x42, 0x2A, 0x0C, 0x19, 0x24, 0x24,
+    0x00, 0x01, 0x00, 0x94, 0x01, 0xA4, 0x01, 0x61, 0x02, 0x7F, 0x00, 0x08,
+    0x00, 0x00, 0x53, 0x35, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0x94,
+    0x2D, 0x2C, 0x74, 0x31, 0x5A, 0x01, 0xA4, 0x62, 0x3C, 0x3D, 0x41, 0x63,
+    0x37, 0x00, 0x00, 0x01, 0x00, 0xA2, 0xFE, 0xEB, 0x01, 0x52, 0xFF, 0xD7,
+    0x00, 0x15, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x27,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x0E, 0x02,
+    0xC4, 0x22, 0x0E, 0x1E, 0x16, 0x0A, 0x0C, 0x14, 0x10, 0x2A, 0x21, 0x27,
+    0x36, 0x14, 0x25, 0x34, 0xFE, 0xEB, 0x32, 0x05, 0x11, 0x17, 0x0B, 0x08,
+    0x09, 0x04, 0x07, 0x17, 0x13, 0x1D, 0x1F, 0x2F, 0x2C, 0x1A, 0x2D, 0x24,
+    0x1C, 0x00, 0x00, 0x01, 0x00, 0x91, 0xFF, 0x0A, 0x01, 0x63, 0x00, 0x18,
+    0x00, 0x14, 0x00, 0x00, 0x57, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26,
+    0x26, 0x23, 0x27, 0x37, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02,
+    0x99, 0x08, 0x15, 0x30, 0x21, 0x1B, 0x23, 0x10, 0x10, 0x46, 0x4B, 0x2C,
+    0x33, 0x32, 0x25, 0x3C, 0x47, 0xF5, 0x44, 0x0C, 0x14, 0x0C, 0x0D, 0x0E,
+    0x08, 0x0C, 0x6E, 0x44, 0x07, 0x34, 0x24, 0x1D, 0x29, 0x1A, 0x0B, 0x00,
+    0x00, 0x01, 0x00, 0x85, 0xFF, 0x30, 0x01, 0x6F, 0x00, 0x32, 0x00, 0x17,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17,
+    0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0xFA, 0x20, 0x36, 0x1F, 0x16, 0x2B, 0x3C, 0x26, 0x27, 0x1A, 0x2D, 0x1A,
+    0x10, 0x0D, 0x0B, 0x10, 0x07, 0x42, 0x0D, 0x3F, 0xD0, 0x1C, 0x30, 0x1E,
+    0x19, 0x2E, 0x28, 0x1F, 0x0A, 0x32, 0x05, 0x19, 0x21, 0x11, 0x0E, 0x13,
+    0x0C, 0x0C, 0x2F, 0x1F, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x2A, 0x01, 0xB6,
+    0x00, 0xD4, 0x02, 0xBC, 0x06, 0x06, 0x02, 0xA0, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0x01, 0xBF, 0x00, 0xF1, 0x02, 0xF2, 0x06, 0x06, 0x02, 0x99,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x25, 0x02, 0x0B, 0x00, 0x9A, 0x02, 0xEE,
+    0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x37, 0x17, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x9A, 0x1E, 0x35, 0x22,
+    0x20, 0x35, 0x1F, 0x01, 0x11, 0x17, 0x17, 0x11, 0x02, 0x0B, 0x1F, 0x33,
+    0x1F, 0x1F, 0x33, 0x1F, 0x01, 0x4C, 0x14, 0x12, 0x10, 0x16, 0x00, 0x01,
+    0x00, 0x37, 0x02, 0x0B, 0x00, 0xAC, 0x02, 0xEE, 0x00, 0x0F, 0x00, 0x00,
+    0x53, 0x35, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x37, 0x1E, 0x02, 0x15,
+    0x14, 0x06, 0x06, 0x37, 0x11, 0x17, 0x16, 0x12, 0x01, 0x1F, 0x35, 0x20,
+    0x21, 0x34, 0x02, 0x0B, 0x4B, 0x16, 0x10, 0x11, 0x15, 0x4C, 0x01, 0x1F,
+    0x33, 0x1F, 0x1F, 0x33, 0x1F, 0x00, 0x00, 0x01, 0x00, 0x40, 0xFF, 0x6D,
+    0x00, 0xB6, 0x00, 0xC5, 0x00, 0x03, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11,
+    0x40, 0x76, 0x93, 0x01, 0x58, 0xFE, 0xA8, 0x00, 0x00, 0x01, 0x00, 0x43,
+    0x01, 0x70, 0x00, 0xA4, 0x02, 0xC8, 0x00, 0x03, 0x00, 0x00, 0x53, 0x11,
+    0x33, 0x11, 0x43, 0x61, 0x01, 0x70, 0x01, 0x58, 0xFE, 0xA8, 0x00, 0x00};
+
+unsigned int lexend_semibold_size = 78744;
+
+} // namespace tvk
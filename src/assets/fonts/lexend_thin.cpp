@@ -0,0 +1,6547 @@
+/**
+ * @file lexend_thin.cpp
+ * @brief Embedded Lexend Thin font data
+ */
+
+#include "tinyvk/assets/fonts.h"
+
+namespace tvk {
+
+unsigned char lexend_thin[] = {
+
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x47, 0x44, 0x45, 0x46, 0x4D, 0xA8, 0x49, 0x00, 0x00, 0x00, 0x02, 0x24,
+    0x00, 0x00, 0x01, 0x2C, 0x47, 0x50, 0x4F, 0x53, 0x68, 0x80, 0x1A, 0x71,
+    0x00, 0x00, 0x4F, 0x0C, 0x00, 0x00, 0x50, 0x2A, 0x47, 0x53, 0x55, 0x42,
+    0xD0, 0x82, 0x6E, 0x2A, 0x00, 0x00, 0x17, 0xF4, 0x00, 0x00, 0x0C, 0xF8,
+    0x4F, 0x53, 0x2F, 0x32, 0x82, 0x1E, 0x57, 0x6E, 0x00, 0x00, 0x01, 0xC4,
+    0x00, 0x00, 0x00, 0x60, 0x53, 0x54, 0x41, 0x54, 0x79, 0x91, 0x68, 0xF1,
+    0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x2A, 0x63, 0x6D, 0x61, 0x70,
+    0x77, 0x18, 0x90, 0xFD, 0x00, 0x00, 0x0F, 0xDC, 0x00, 0x00, 0x08, 0x16,
+    0x67, 0x61, 0x73, 0x70, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x08, 0x67, 0x6C, 0x79, 0x66, 0xAD, 0xC3, 0x0F, 0xF5,
+    0x00, 0x00, 0x9F, 0x38, 0x00, 0x00, 0x92, 0xF4, 0x68, 0x65, 0x61, 0x64,
+    0x1A, 0xBF, 0x86, 0x6F, 0x00, 0x00, 0x01, 0x8C, 0x00, 0x00, 0x00, 0x36,
+    0x68, 0x68, 0x65, 0x61, 0x08, 0x33, 0x05, 0xE2, 0x00, 0x00, 0x01, 0x3C,
+    0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78, 0x74, 0x6E, 0xCC, 0x34,
+    0x00, 0x00, 0x24, 0xEC, 0x00, 0x00, 0x0D, 0x34, 0x6C, 0x6F, 0x63, 0x61,
+    0xBC, 0x20, 0xDF, 0x8D, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x06, 0x9C,
+    0x6D, 0x61, 0x78, 0x70, 0x03, 0x61, 0x00, 0xD2, 0x00, 0x00, 0x01, 0x1C,
+    0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0xB9, 0xD8, 0xF4, 0xC3,
+    0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x05, 0xEE, 0x70, 0x6F, 0x73, 0x74,
+    0x0C, 0x72, 0x98, 0x72, 0x00, 0x00, 0x32, 0x20, 0x00, 0x00, 0x1C, 0xEB,
+    0x70, 0x72, 0x65, 0x70, 0x68, 0x06, 0x8C, 0x85, 0x00, 0x00, 0x01, 0x0C,
+    0x00, 0x00, 0x00, 0x07, 0xB8, 0x01, 0xFF, 0x85, 0xB0, 0x04, 0x8D, 0x00,
+    0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0x4D, 0x00, 0x64, 0x00, 0x07, 0x00, 0x6C, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x03, 0xE8, 0xFF, 0x06,
+    0x00, 0x00, 0x05, 0x2E, 0xFF, 0x56, 0xFE, 0x60, 0x04, 0xF2, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x4D, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x02,
+    0x77, 0x67, 0x68, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xCB, 0x4B, 0xA7, 0xE7, 0x78,
+    0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x03, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0xDA, 0x36, 0x6A, 0x60, 0x00, 0x00, 0x00, 0x00, 0xDD, 0x29, 0xD6, 0x62,
+    0xFF, 0x56, 0xFF, 0x10, 0x04, 0xF2, 0x03, 0xEF, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x4C,
+    0x00, 0xFA, 0x00, 0x05, 0x00, 0x00, 0x02, 0x8A, 0x02, 0x58, 0x00, 0x00,
+    0x00, 0x4B, 0x02, 0x8A, 0x02, 0x58, 0x00, 0x00, 0x01, 0x5E, 0x00, 0x32,
+    0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x20, 0x5B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x4F, 0x4E, 0x45, 0x00, 0xC0,
+    0x00, 0x0D, 0xFB, 0x02, 0x03, 0xE8, 0xFF, 0x06, 0x00, 0x00, 0x04, 0xB0,
+    0x01, 0x86, 0x20, 0x00, 0x01, 0x93, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0D,
+    0x02, 0xBC, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0xB6, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x02, 0x03, 0x0D,
+    0x03, 0x43, 0x00, 0x02, 0x00, 0x03, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00,
+    0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11, 0x03, 0x23, 0x03, 0x42, 0x00, 0x22,
+    0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x13, 0x03, 0x14, 0x03, 0x44, 0x03, 0x45, 0x00, 0x12, 0x00, 0x07,
+    0x00, 0x5A, 0x00, 0x4C, 0x00, 0x42, 0x00, 0x34, 0x00, 0x2C, 0x00, 0x24,
+    0x00, 0x1C, 0x00, 0x02, 0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x01, 0x01, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x4C,
+    0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01, 0x02, 0x34, 0x00, 0x01,
+    0x01, 0x1A, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x01, 0x02, 0xA8,
+    0x00, 0x02, 0x00, 0x0A, 0x00, 0x06, 0x00, 0x01, 0x02, 0x31, 0x00, 0x01,
+    0x01, 0x19, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x01, 0x54, 0x00, 0x02,
+    0x00, 0x13, 0x00, 0x01, 0x00, 0x7A, 0x00, 0x01, 0x00, 0x7C, 0x00, 0x7E,
+    0x00, 0x01, 0x00, 0x80, 0x01, 0x2B, 0x00, 0x01, 0x01, 0x2D, 0x01, 0x48,
+    0x00, 0x01, 0x01, 0x4A, 0x01, 0x68, 0x00, 0x01, 0x01, 0x6A, 0x01, 0x80,
+    0x00, 0x01, 0x01, 0x82, 0x01, 0x84, 0x00, 0x01, 0x01, 0x86, 0x02, 0x18,
+    0x00, 0x01, 0x02, 0x19, 0x02, 0x1F, 0x00, 0x02, 0x02, 0xB5, 0x02, 0xB5,
+    0x00, 0x01, 0x02, 0xB7, 0x02, 0xB7, 0x00, 0x01, 0x02, 0xB9, 0x02, 0xB9,
+    0x00, 0x01, 0x02, 0xBE, 0x02, 0xBE, 0x00, 0x01, 0x02, 0xC4, 0x02, 0xC6,
+    0x00, 0x01, 0x02, 0xCA, 0x02, 0xCA, 0x00, 0x01, 0x02, 0xDE, 0x02, 0xDE,
+    0x00, 0x01, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x03, 0x02, 0xFC, 0x03, 0x15,
+    0x00, 0x03, 0x03, 0x23, 0x03, 0x46, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23,
+    0x01, 0xAA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0xA2,
+    0x03, 0xA2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x16,
+    0x03, 0x8C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E,
+    0x03, 0x7E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x2C,
+    0x03, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x16,
+    0x03, 0x8C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x1A,
+    0x03, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x16,
+    0x03, 0x22, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x08, 0x00, 0x0C,
+    0x03, 0x16, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x44,
+    0x02, 0xD2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0B, 0x00, 0x2C,
+    0x02, 0xA6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0C, 0x00, 0x2C,
+    0x02, 0xA6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0D, 0x01, 0x22,
+    0x01, 0x84, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0E, 0x00, 0x36,
+    0x01, 0x4E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x10, 0x00, 0x0C,
+    0x03, 0x16, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x11, 0x00, 0x08,
+    0x01, 0x46, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x19, 0x00, 0x0C,
+    0x03, 0x16, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x00, 0x00, 0x0C,
+    0x01, 0x3A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x02, 0x00, 0x08,
+    0x01, 0x46, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x03, 0x00, 0x14,
+    0x01, 0x26, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x04, 0x00, 0x0A,
+    0x01, 0x1C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x05, 0x00, 0x0E,
+    0x03, 0x7E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x06, 0x00, 0x0C,
+    0x01, 0x10, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x07, 0x00, 0x10,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x08, 0x00, 0x08,
+    0x00, 0xF8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x09, 0x00, 0x12,
+    0x00, 0xE6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0A, 0x00, 0x0A,
+    0x00, 0xDC, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0B, 0x00, 0x16,
+    0x03, 0x22, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0C, 0x00, 0x22,
+    0x00, 0xBA, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0D, 0x00, 0x18,
+    0x00, 0xA2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0E, 0x00, 0x1C,
+    0x00, 0x86, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x0F, 0x00, 0x1A,
+    0x00, 0x6C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x10, 0x00, 0x1E,
+    0x00, 0x4E, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x11, 0x00, 0x16,
+    0x00, 0x38, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x12, 0x00, 0x20,
+    0x00, 0x18, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x01, 0x13, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x42, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x63,
+    0x00, 0x6B, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72,
+    0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D,
+    0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x4C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x53,
+    0x00, 0x65, 0x00, 0x6D, 0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C,
+    0x00, 0x64, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x2D, 0x00, 0x4D, 0x00, 0x65, 0x00, 0x64, 0x00, 0x69,
+    0x00, 0x75, 0x00, 0x6D, 0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65,
+    0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67,
+    0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x4C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x4C,
+    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x4C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D, 0x00, 0x45,
+    0x00, 0x78, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69,
+    0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x42, 0x00, 0x6C, 0x00, 0x61,
+    0x00, 0x63, 0x00, 0x6B, 0x00, 0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x72,
+    0x00, 0x61, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x42,
+    0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x53, 0x00, 0x65, 0x00, 0x6D,
+    0x00, 0x69, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6C, 0x00, 0x64, 0x00, 0x4D,
+    0x00, 0x65, 0x00, 0x64, 0x00, 0x69, 0x00, 0x75, 0x00, 0x6D, 0x00, 0x4C,
+    0x00, 0x69, 0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x45, 0x00, 0x78,
+    0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x4C, 0x00, 0x69, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x57, 0x00, 0x65, 0x00, 0x69, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E,
+    0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A,
+    0x00, 0x2F, 0x00, 0x2F, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72, 0x00, 0x69,
+    0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2E, 0x00, 0x73, 0x00, 0x69,
+    0x00, 0x6C, 0x00, 0x2E, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2F,
+    0x00, 0x4F, 0x00, 0x46, 0x00, 0x4C, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69,
+    0x00, 0x73, 0x00, 0x20, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74,
+    0x00, 0x20, 0x00, 0x53, 0x00, 0x6F, 0x00, 0x66, 0x00, 0x74, 0x00, 0x77,
+    0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73,
+    0x00, 0x20, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x73, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x75, 0x00, 0x6E,
+    0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x74, 0x00, 0x68,
+    0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x49, 0x00, 0x4C, 0x00, 0x20,
+    0x00, 0x4F, 0x00, 0x70, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x46,
+    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x4C, 0x00, 0x69,
+    0x00, 0x63, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x73, 0x00, 0x65, 0x00, 0x2C,
+    0x00, 0x20, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69,
+    0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x31,
+    0x00, 0x2E, 0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73,
+    0x00, 0x20, 0x00, 0x6C, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6E,
+    0x00, 0x73, 0x00, 0x65, 0x00, 0x20, 0x00, 0x69, 0x00, 0x73, 0x00, 0x20,
+    0x00, 0x61, 0x00, 0x76, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6C, 0x00, 0x61,
+    0x00, 0x62, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x20, 0x00, 0x77, 0x00, 0x69,
+    0x00, 0x74, 0x00, 0x68, 0x00, 0x20, 0x00, 0x61, 0x00, 0x20, 0x00, 0x46,
+    0x00, 0x41, 0x00, 0x51, 0x00, 0x20, 0x00, 0x61, 0x00, 0x74, 0x00, 0x3A,
+    0x00, 0x20, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73,
+    0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72,
+    0x00, 0x69, 0x00, 0x70, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2E, 0x00, 0x73,
+    0x00, 0x69, 0x00, 0x6C, 0x00, 0x2E, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x67,
+    0x00, 0x2F, 0x00, 0x4F, 0x00, 0x46, 0x00, 0x4C, 0x00, 0x68, 0x00, 0x74,
+    0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F, 0x00, 0x2F,
+    0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2E, 0x00, 0x6C, 0x00, 0x65,
+    0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2E, 0x00, 0x63,
+    0x00, 0x6F, 0x00, 0x6D, 0x00, 0x42, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x6E,
+    0x00, 0x69, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x68, 0x00, 0x61,
+    0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00, 0x2D, 0x00, 0x54, 0x00, 0x72,
+    0x00, 0x6F, 0x00, 0x75, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x54,
+    0x00, 0x68, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20,
+    0x00, 0x4A, 0x00, 0x6F, 0x00, 0x63, 0x00, 0x6B, 0x00, 0x69, 0x00, 0x6E,
+    0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x4C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x2D, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x56,
+    0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E,
+    0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37,
+    0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x4E, 0x00, 0x4F, 0x00, 0x4E, 0x00, 0x45, 0x00, 0x3B, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x2D,
+    0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x52, 0x00, 0x65,
+    0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20,
+    0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x43, 0x00, 0x6F,
+    0x00, 0x70, 0x00, 0x79, 0x00, 0x72, 0x00, 0x69, 0x00, 0x67, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39,
+    0x00, 0x20, 0x00, 0x54, 0x00, 0x68, 0x00, 0x65, 0x00, 0x20, 0x00, 0x4C,
+    0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64, 0x00, 0x20,
+    0x00, 0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x6A, 0x00, 0x65, 0x00, 0x63,
+    0x00, 0x74, 0x00, 0x20, 0x00, 0x41, 0x00, 0x75, 0x00, 0x74, 0x00, 0x68,
+    0x00, 0x6F, 0x00, 0x72, 0x00, 0x73, 0x00, 0x20, 0x00, 0x28, 0x00, 0x68,
+    0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3A, 0x00, 0x2F,
+    0x00, 0x2F, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75,
+    0x00, 0x62, 0x00, 0x2E, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x2F,
+    0x00, 0x67, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x67, 0x00, 0x6C, 0x00, 0x65,
+    0x00, 0x66, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x73, 0x00, 0x2F,
+    0x00, 0x6C, 0x00, 0x65, 0x00, 0x78, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x64,
+    0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x5F, 0x00, 0x6A,
+    0x00, 0x75, 0x00, 0x80, 0x00, 0x8E, 0x00, 0x99, 0x00, 0xA4, 0x00, 0xAF,
+    0x00, 0xBA, 0x00, 0xC5, 0x00, 0xD1, 0x00, 0xDF, 0x00, 0xEB, 0x00, 0xF7,
+    0x01, 0x02, 0x01, 0x0D, 0x01, 0x18, 0x01, 0x23, 0x01, 0x2E, 0x01, 0x39,
+    0x01, 0x44, 0x01, 0x4F, 0x01, 0x5B, 0x01, 0x66, 0x01, 0x75, 0x01, 0x80,
+    0x01, 0xA4, 0x01, 0xB0, 0x01, 0xEC, 0x02, 0x24, 0x02, 0x30, 0x02, 0x3C,
+    0x02, 0x48, 0x02, 0x58, 0x02, 0x64, 0x02, 0x70, 0x02, 0x9A, 0x02, 0xA6,
+    0x02, 0xB6, 0x02, 0xE8, 0x02, 0xF3, 0x02, 0xFB, 0x03, 0x06, 0x03, 0x11,
+    0x03, 0x1D, 0x03, 0x2D, 0x03, 0x46, 0x03, 0x51, 0x03, 0x5C, 0x03, 0x67,
+    0x03, 0x75, 0x03, 0x80, 0x03, 0x8C, 0x03, 0x9A, 0x03, 0xA5, 0x03, 0xB0,
+    0x03, 0xBB, 0x03, 0xC6, 0x03, 0xD1, 0x03, 0xDC, 0x03, 0xE7, 0x03, 0xF2,
+    0x03, 0xFD, 0x04, 0x08, 0x04, 0x13, 0x04, 0x22, 0x04, 0x31, 0x04, 0x3D,
+    0x04, 0x48, 0x04, 0x62, 0x04, 0xA4, 0x04, 0xB0, 0x04, 0xBC, 0x04, 0xC8,
+    0x04, 0xD4, 0x04, 0xE0, 0x04, 0xEC, 0x05, 0x06, 0x05, 0x30, 0x05, 0x3C,
+    0x05, 0x48, 0x05, 0x54, 0x05, 0x69, 0x05, 0x75, 0x05, 0x80, 0x05, 0x8B,
+    0x05, 0x96, 0x05, 0xA1, 0x05, 0xAC, 0x05, 0xB7, 0x05, 0xC2, 0x05, 0xCD,
+    0x05, 0xD8, 0x05, 0xE3, 0x05, 0xEE, 0x05, 0xF9, 0x06, 0x04, 0x06, 0x0F,
+    0x06, 0x1A, 0x06, 0x43, 0x06, 0x4F, 0x06, 0x6D, 0x06, 0x78, 0x06, 0x87,
+    0x06, 0x93, 0x06, 0x9E, 0x06, 0xAA, 0x06, 0xB5, 0x06, 0xC1, 0x06, 0xCC,
+    0x06, 0xD8, 0x06, 0xE3, 0x06, 0xFB, 0x07, 0x23, 0x07, 0x2F, 0x07, 0x56,
+    0x07, 0x62, 0x07, 0x6E, 0x07, 0x7A, 0x07, 0x86, 0x07, 0x92, 0x07, 0x9E,
+    0x07, 0xCD, 0x07, 0xD9, 0x07, 0xE5, 0x07, 0xF1, 0x08, 0x25, 0x08, 0x5F,
+    0x08, 0x6B, 0x08, 0x77, 0x08, 0x83, 0x08, 0x8F, 0x08, 0x9B, 0x08, 0xAB,
+    0x08, 0xB7, 0x08, 0xC3, 0x08, 0xCF, 0x08, 0xDA, 0x08, 0xE6, 0x08, 0xF6,
+    0x09, 0x06, 0x09, 0x12, 0x09, 0x1E, 0x09, 0x2A, 0x09, 0x79, 0x09, 0x85,
+    0x09, 0x91, 0x09, 0x9D, 0x09, 0xA9, 0x09, 0xB5, 0x09, 0xC1, 0x09, 0xCD,
+    0x09, 0xD9, 0x09, 0xE9, 0x09, 0xF9, 0x0A, 0x53, 0x0A, 0x95, 0x0A, 0xA1,
+    0x0A, 0xAD, 0x0A, 0xBD, 0x0A, 0xCD, 0x0A, 0xDD, 0x0B, 0x11, 0x0B, 0x37,
+    0x0B, 0x5E, 0x0B, 0xA0, 0x0B, 0xCF, 0x0B, 0xDA, 0x0B, 0xE5, 0x0B, 0xF0,
+    0x0B, 0xFB, 0x0C, 0x06, 0x0C, 0x11, 0x0C, 0x1C, 0x0C, 0x6A, 0x0C, 0x75,
+    0x0C, 0x80, 0x0C, 0x8B, 0x0C, 0x9A, 0x0C, 0xA5, 0x0C, 0xB0, 0x0C, 0xBB,
+    0x0C, 0xC6, 0x0C, 0xD1, 0x0C, 0xDF, 0x0D, 0x35, 0x0D, 0x73, 0x0D, 0x84,
+    0x0D, 0x9C, 0x0D, 0xA7, 0x0D, 0xB2, 0x0D, 0xBD, 0x0D, 0xC8, 0x0D, 0xD3,
+    0x0D, 0xF7, 0x0E, 0x03, 0x0E, 0x0E, 0x0E, 0x19, 0x0E, 0x24, 0x0E, 0x2F,
+    0x0E, 0x3A, 0x0E, 0x45, 0x0E, 0x50, 0x0E, 0x5B, 0x0E, 0x8A, 0x0E, 0x96,
+    0x0E, 0xA1, 0x0E, 0xAC, 0x0E, 0xB7, 0x0E, 0xC2, 0x0E, 0xCE, 0x0E, 0xD9,
+    0x0E, 0xE4, 0x0E, 0xF3, 0x0F, 0x37, 0x0F, 0x42, 0x0F, 0x4D, 0x0F, 0x5C,
+    0x0F, 0x7D, 0x0F, 0xB5, 0x0F, 0xC1, 0x0F, 0xCD, 0x0F, 0xD9, 0x0F, 0xE5,
+    0x10, 0x07, 0x10, 0x22, 0x10, 0x2D, 0x10, 0x38, 0x10, 0x43, 0x10, 0x4E,
+    0x10, 0x59, 0x10, 0x64, 0x10, 0x6F, 0x10, 0x7A, 0x10, 0x85, 0x10, 0x9E,
+    0x10, 0xA9, 0x10, 0xB4, 0x10, 0xBF, 0x10, 0xCA, 0x10, 0xDD, 0x10, 0xEC,
+    0x10, 0xF8, 0x11, 0x03, 0x11, 0x0E, 0x11, 0x19, 0x11, 0x24, 0x11, 0x30,
+    0x11, 0x3B, 0x11, 0x46, 0x11, 0x51, 0x11, 0x5C, 0x11, 0x67, 0x11, 0x72,
+    0x11, 0x7D, 0x11, 0x88, 0x11, 0x94, 0x11, 0x9F, 0x11, 0xC3, 0x11, 0xCF,
+    0x11, 0xDB, 0x11, 0xE7, 0x12, 0x24, 0x12, 0x2F, 0x12, 0x3A, 0x12, 0x45,
+    0x12, 0x53, 0x12, 0x5E, 0x12, 0x69, 0x12, 0x74, 0x12, 0x7F, 0x12, 0x8A,
+    0x12, 0x96, 0x12, 0xA4, 0x12, 0xAF, 0x12, 0xBA, 0x12, 0xC5, 0x12, 0xD0,
+    0x12, 0xDB, 0x12, 0xE6, 0x12, 0xF1, 0x12, 0xFC, 0x13, 0x07, 0x13, 0x12,
+    0x13, 0x1E, 0x13, 0x29, 0x13, 0x38, 0x13, 0x43, 0x13, 0xB9, 0x13, 0xC5,
+    0x14, 0x03, 0x14, 0x35, 0x14, 0x40, 0x14, 0x4B, 0x14, 0x56, 0x14, 0x64,
+    0x14, 0x6F, 0x14, 0x7A, 0x14, 0xB7, 0x15, 0x09, 0x15, 0x15, 0x15, 0x5A,
+    0x15, 0x65, 0x15, 0x70, 0x15, 0x80, 0x15, 0xBC, 0x15, 0xC7, 0x15, 0xD2,
+    0x15, 0xDD, 0x15, 0xEB, 0x15, 0xF6, 0x16, 0x01, 0x16, 0x0F, 0x16, 0x1A,
+    0x16, 0x25, 0x16, 0x30, 0x16, 0x3B, 0x16, 0x46, 0x16, 0x51, 0x16, 0x5C,
+    0x16, 0x67, 0x16, 0x72, 0x16, 0x7D, 0x16, 0x88, 0x16, 0x93, 0x16, 0x9E,
+    0x16, 0xF8, 0x17, 0x03, 0x17, 0x3D, 0x17, 0x65, 0x17, 0xB7, 0x17, 0xC2,
+    0x17, 0xCD, 0x17, 0xD8, 0x17, 0xE3, 0x17, 0xEE, 0x17, 0xF9, 0x18, 0x24,
+    0x18, 0x57, 0x18, 0x62, 0x18, 0x6D, 0x18, 0x78, 0x18, 0x94, 0x18, 0xA0,
+    0x18, 0xAC, 0x18, 0xB8, 0x18, 0xC4, 0x18, 0xD0, 0x18, 0xDC, 0x18, 0xE8,
+    0x18, 0xF4, 0x19, 0x00, 0x19, 0x0C, 0x19, 0x18, 0x19, 0x24, 0x19, 0x30,
+    0x19, 0x3C, 0x19, 0x48, 0x19, 0x58, 0x19, 0x64, 0x19, 0x8B, 0x19, 0xA2,
+    0x19, 0xAE, 0x19, 0xCB, 0x19, 0xD6, 0x19, 0xF3, 0x19, 0xFF, 0x1A, 0x0A,
+    0x1A, 0x15, 0x1A, 0x21, 0x1A, 0x2D, 0x1A, 0x39, 0x1A, 0x45, 0x1A, 0x51,
+    0x1A, 0x66, 0x1A, 0xAD, 0x1A, 0xB9, 0x1A, 0xE4, 0x1A, 0xEF, 0x1A, 0xFA,
+    0x1B, 0x05, 0x1B, 0x10, 0x1B, 0x1B, 0x1B, 0x26, 0x1B, 0x5A, 0x1B, 0x66,
+    0x1B, 0x71, 0x1B, 0x7C, 0x1B, 0xAD, 0x1B, 0xDF, 0x1B, 0xEA, 0x1B, 0xF5,
+    0x1C, 0x00, 0x1C, 0x0B, 0x1C, 0x16, 0x1C, 0x24, 0x1C, 0x2F, 0x1C, 0x3A,
+    0x1C, 0x45, 0x1C, 0x50, 0x1C, 0x5B, 0x1C, 0x6A, 0x1C, 0x79, 0x1C, 0x84,
+    0x1C, 0x8F, 0x1C, 0x9A, 0x1C, 0xDE, 0x1C, 0xE9, 0x1C, 0xF4, 0x1C, 0xFF,
+    0x1D, 0x0A, 0x1D, 0x15, 0x1D, 0x20, 0x1D, 0x2B, 0x1D, 0x36, 0x1D, 0x41,
+    0x1D, 0x4C, 0x1D, 0x9C, 0x1D, 0xD6, 0x1D, 0xE1, 0x1D, 0xEC, 0x1D, 0xF7,
+    0x1E, 0x02, 0x1E, 0x11, 0x1E, 0x7A, 0x1E, 0xB5, 0x1E, 0xF1, 0x1F, 0x2F,
+    0x1F, 0x53, 0x1F, 0x5E, 0x1F, 0x69, 0x1F, 0x75, 0x1F, 0x80, 0x1F, 0x8C,
+    0x1F, 0x97, 0x1F, 0xA3, 0x1F, 0xF8, 0x20, 0x03, 0x20, 0x0E, 0x20, 0x19,
+    0x20, 0x24, 0x20, 0x2F, 0x20, 0x3A, 0x20, 0x45, 0x20, 0x50, 0x20, 0x5B,
+    0x20, 0x69, 0x20, 0xB9, 0x20, 0xCC, 0x20, 0xE5, 0x20, 0xF0, 0x20, 0xFB,
+    0x21, 0x06, 0x21, 0x11, 0x21, 0x1C, 0x21, 0x27, 0x21, 0x50, 0x21, 0x5B,
+    0x21, 0x66, 0x21, 0x71, 0x21, 0x7C, 0x21, 0x87, 0x21, 0x92, 0x21, 0x9D,
+    0x21, 0xA8, 0x21, 0xB3, 0x21, 0xE9, 0x21, 0xF4, 0x21, 0xFF, 0x22, 0x0A,
+    0x22, 0x15, 0x22, 0x20, 0x22, 0x2B, 0x22, 0x36, 0x22, 0x41, 0x22, 0x50,
+    0x22, 0x5C, 0x22, 0x67, 0x22, 0x72, 0x22, 0x7D, 0x22, 0x90, 0x22, 0xAF,
+    0x22, 0xBB, 0x22, 0xC7, 0x22, 0xD3, 0x22, 0xDF, 0x23, 0x02, 0x23, 0x24,
+    0x23, 0x2F, 0x23, 0x3A, 0x23, 0x45, 0x23, 0x50, 0x23, 0x5C, 0x23, 0x67,
+    0x23, 0x72, 0x23, 0x7D, 0x23, 0x88, 0x23, 0xA1, 0x23, 0xAC, 0x23, 0xB7,
+    0x23, 0xC2, 0x23, 0xCD, 0x23, 0xE1, 0x24, 0x25, 0x24, 0x30, 0x24, 0x3B,
+    0x24, 0x46, 0x24, 0x54, 0x24, 0x5F, 0x24, 0x6A, 0x24, 0x75, 0x24, 0x80,
+    0x24, 0x8B, 0x24, 0x96, 0x24, 0xA4, 0x24, 0xAF, 0x24, 0xBA, 0x24, 0xC5,
+    0x24, 0xD0, 0x24, 0xDB, 0x24, 0xE6, 0x24, 0xF1, 0x24, 0xFC, 0x25, 0x07,
+    0x25, 0x12, 0x25, 0x1E, 0x25, 0x29, 0x25, 0x38, 0x25, 0x43, 0x25, 0xBA,
+    0x25, 0xC5, 0x25, 0xD0, 0x25, 0xDB, 0x25, 0xE6, 0x25, 0xF1, 0x25, 0xFC,
+    0x26, 0x08, 0x26, 0x18, 0x26, 0x2C, 0x26, 0x3C, 0x26, 0x4C, 0x26, 0x58,
+    0x26, 0x64, 0x26, 0x9C, 0x26, 0xCE, 0x26, 0xD6, 0x26, 0xDE, 0x26, 0xE6,
+    0x27, 0x02, 0x27, 0x2E, 0x27, 0x46, 0x27, 0x7C, 0x27, 0xBC, 0x27, 0xD6,
+    0x28, 0x13, 0x28, 0x5A, 0x28, 0x6E, 0x28, 0xD2, 0x29, 0x14, 0x29, 0x20,
+    0x29, 0x4D, 0x29, 0x62, 0x29, 0x90, 0x29, 0xC6, 0x29, 0xE7, 0x2A, 0x1B,
+    0x2A, 0x58, 0x2A, 0x6C, 0x2A, 0xBB, 0x2A, 0xF9, 0x2B, 0x02, 0x2B, 0x0B,
+    0x2B, 0x14, 0x2B, 0x1D, 0x2B, 0x26, 0x2B, 0x2F, 0x2B, 0x38, 0x2B, 0x41,
+    0x2B, 0x4A, 0x2B, 0x53, 0x2B, 0x5C, 0x2B, 0x65, 0x2B, 0x6E, 0x2B, 0x77,
+    0x2B, 0x80, 0x2B, 0x89, 0x2B, 0x92, 0x2B, 0x9B, 0x2B, 0xA4, 0x2B, 0xAD,
+    0x2B, 0xB6, 0x2B, 0xBF, 0x2B, 0xC8, 0x2B, 0xD1, 0x2B, 0xDA, 0x2B, 0xE3,
+    0x2B, 0xEC, 0x2B, 0xF5, 0x2B, 0xFE, 0x2C, 0x07, 0x2C, 0x15, 0x2C, 0x25,
+    0x2C, 0x35, 0x2C, 0x45, 0x2C, 0x55, 0x2C, 0x65, 0x2C, 0x75, 0x2C, 0x85,
+    0x2C, 0x85, 0x2C, 0x85, 0x2C, 0x85, 0x2C, 0x85, 0x2C, 0x85, 0x2C, 0x85,
+    0x2C, 0x85, 0x2C, 0x85, 0x2C, 0x9B, 0x2C, 0xBF, 0x2C, 0xCB, 0x2C, 0xD7,
+    0x2C, 0xE7, 0x2D, 0x0F, 0x2D, 0x37, 0x2D, 0x73, 0x2D, 0xAF, 0x2D, 0xB8,
+    0x2D, 0xD4, 0x2D, 0xFF, 0x2E, 0x22, 0x2E, 0x31, 0x2E, 0x40, 0x2E, 0x49,
+    0x2E, 0x51, 0x2E, 0x59, 0x2E, 0x61, 0x2E, 0x6A, 0x2E, 0x73, 0x2E, 0x80,
+    0x2E, 0x88, 0x2E, 0x95, 0x2E, 0xA2, 0x2E, 0xAA, 0x2E, 0xB2, 0x2E, 0xBA,
+    0x2E, 0xC6, 0x2E, 0xCE, 0x2E, 0xD6, 0x2E, 0xDE, 0x2E, 0xF9, 0x2F, 0x13,
+    0x2F, 0x4C, 0x2F, 0x85, 0x2F, 0x99, 0x2F, 0xAD, 0x2F, 0xB5, 0x2F, 0xBD,
+    0x2F, 0xC5, 0x2F, 0xCD, 0x2F, 0xD5, 0x2F, 0xDD, 0x2F, 0xE5, 0x2F, 0xF1,
+    0x2F, 0xFD, 0x30, 0x09, 0x30, 0x2E, 0x30, 0x52, 0x30, 0x5E, 0x30, 0x6A,
+    0x30, 0x7C, 0x30, 0x8E, 0x30, 0xA3, 0x30, 0xB1, 0x30, 0xBD, 0x30, 0xC9,
+    0x30, 0xD1, 0x30, 0xD9, 0x31, 0x10, 0x31, 0x97, 0x31, 0xEE, 0x32, 0x0F,
+    0x32, 0x85, 0x32, 0xE8, 0x33, 0x41, 0x33, 0x6C, 0x33, 0x9E, 0x33, 0xA6,
+    0x33, 0xB3, 0x33, 0xC7, 0x33, 0xDA, 0x34, 0x2C, 0x34, 0x45, 0x34, 0x91,
+    0x34, 0xEB, 0x34, 0xF3, 0x35, 0x3A, 0x35, 0x7B, 0x35, 0xC4, 0x36, 0x13,
+    0x36, 0x6A, 0x36, 0xB1, 0x36, 0xF6, 0x37, 0x16, 0x37, 0x5F, 0x37, 0x8B,
+    0x37, 0xF7, 0x38, 0x25, 0x38, 0x4F, 0x38, 0x86, 0x38, 0xB4, 0x38, 0xF8,
+    0x39, 0x2E, 0x39, 0x65, 0x39, 0xCD, 0x3A, 0x15, 0x3A, 0x3D, 0x3A, 0x59,
+    0x3A, 0x68, 0x3A, 0x7B, 0x3A, 0x88, 0x3A, 0xA0, 0x3A, 0xD8, 0x3A, 0xEB,
+    0x3B, 0x06, 0x3B, 0x1A, 0x3B, 0x2F, 0x3B, 0x4A, 0x3B, 0x65, 0x3B, 0x7F,
+    0x3B, 0xDB, 0x3C, 0x0B, 0x3C, 0x1D, 0x3C, 0x31, 0x3C, 0x8C, 0x3C, 0xC6,
+    0x3C, 0xFB, 0x3D, 0x46, 0x3D, 0x5E, 0x3D, 0x78, 0x3D, 0x99, 0x3D, 0xB1,
+    0x3D, 0xDE, 0x3E, 0x26, 0x3E, 0x8C, 0x3F, 0x1D, 0x3F, 0x36, 0x3F, 0x58,
+    0x3F, 0x7A, 0x3F, 0xC0, 0x40, 0x01, 0x40, 0x1B, 0x40, 0x35, 0x40, 0x73,
+    0x40, 0xAB, 0x40, 0xD1, 0x40, 0xFD, 0x41, 0x09, 0x41, 0x1F, 0x41, 0x2B,
+    0x41, 0x39, 0x41, 0x47, 0x41, 0x65, 0x41, 0x7A, 0x41, 0x9E, 0x41, 0xB1,
+    0x41, 0xC4, 0x41, 0xE7, 0x42, 0x02, 0x42, 0x2E, 0x42, 0x5A, 0x42, 0xA4,
+    0x42, 0xD7, 0x42, 0xE3, 0x42, 0xF0, 0x42, 0xFC, 0x43, 0x10, 0x43, 0x24,
+    0x43, 0x56, 0x43, 0x6B, 0x43, 0x86, 0x43, 0xAA, 0x43, 0xBD, 0x43, 0xD3,
+    0x43, 0xF8, 0x44, 0x1B, 0x44, 0x3E, 0x44, 0x66, 0x44, 0x81, 0x44, 0x8D,
+    0x44, 0x9A, 0x44, 0xA2, 0x44, 0xAA, 0x44, 0xB2, 0x44, 0xBA, 0x44, 0xC2,
+    0x44, 0xCA, 0x44, 0xD2, 0x44, 0xDA, 0x44, 0xE2, 0x44, 0xEA, 0x44, 0xF2,
+    0x44, 0xFA, 0x45, 0x02, 0x45, 0x28, 0x45, 0x54, 0x45, 0x60, 0x45, 0x76,
+    0x45, 0x82, 0x45, 0x90, 0x45, 0x9E, 0x45, 0xBC, 0x45, 0xD1, 0x45, 0xE4,
+    0x45, 0xFE, 0x46, 0x18, 0x46, 0x50, 0x46, 0x8E, 0x46, 0xA1, 0x46, 0xBF,
+    0x46, 0xE1, 0x47, 0x03, 0x47, 0x44, 0x47, 0x8A, 0x47, 0xB6, 0x47, 0xE1,
+    0x47, 0xED, 0x47, 0xF9, 0x48, 0x05, 0x48, 0x12, 0x48, 0x1E, 0x48, 0x2A,
+    0x48, 0x36, 0x48, 0x68, 0x48, 0x7D, 0x48, 0x9A, 0x48, 0xAD, 0x48, 0xD0,
+    0x48, 0xF3, 0x49, 0x1A, 0x49, 0x22, 0x49, 0x2A, 0x49, 0x45, 0x49, 0x60,
+    0x49, 0x6D, 0x49, 0x7A, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x04, 0x08, 0x02, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x80, 0x00, 0x06,
+    0x00, 0x50, 0x00, 0x0D, 0x00, 0x2F, 0x00, 0x39, 0x00, 0x7E, 0x01, 0x7E,
+    0x01, 0x8F, 0x01, 0x92, 0x01, 0x9D, 0x01, 0xA1, 0x01, 0xB0, 0x01, 0xD4,
+    0x01, 0xE7, 0x01, 0xEB, 0x01, 0xF2, 0x02, 0x1B, 0x02, 0x2D, 0x02, 0x33,
+    0x02, 0x37, 0x02, 0x59, 0x02, 0x72, 0x02, 0xBC, 0x02, 0xBF, 0x02, 0xC8,
+    0x02, 0xCC, 0x02, 0xDD, 0x03, 0x04, 0x03, 0x0C, 0x03, 0x0F, 0x03, 0x12,
+    0x03, 0x1B, 0x03, 0x24, 0x03, 0x28, 0x03, 0x2E, 0x03, 0x31, 0x03, 0x35,
+    0x03, 0x94, 0x03, 0xA9, 0x03, 0xBC, 0x03, 0xC0, 0x1E, 0x09, 0x1E, 0x0F,
+    0x1E, 0x17, 0x1E, 0x1D, 0x1E, 0x21, 0x1E, 0x25, 0x1E, 0x2B, 0x1E, 0x2F,
+    0x1E, 0x37, 0x1E, 0x3B, 0x1E, 0x49, 0x1E, 0x53, 0x1E, 0x5B, 0x1E, 0x69,
+    0x1E, 0x6F, 0x1E, 0x7B, 0x1E, 0x85, 0x1E, 0x8F, 0x1E, 0x93, 0x1E, 0x97,
+    0x1E, 0x9E, 0x1E, 0xF9, 0x20, 0x0B, 0x20, 0x10, 0x20, 0x15, 0x20, 0x1A,
+    0x20, 0x1E, 0x20, 0x22, 0x20, 0x26, 0x20, 0x30, 0x20, 0x33, 0x20, 0x3A,
+    0x20, 0x44, 0x20, 0x70, 0x20, 0x79, 0x20, 0x89, 0x20, 0xA1, 0x20, 0xA4,
+    0x20, 0xA7, 0x20, 0xA9, 0x20, 0xAD, 0x20, 0xB2, 0x20, 0xB5, 0x20, 0xBA,
+    0x20, 0xBD, 0x21, 0x13, 0x21, 0x16, 0x21, 0x22, 0x21, 0x26, 0x21, 0x2E,
+    0x21, 0x5E, 0x22, 0x02, 0x22, 0x06, 0x22, 0x0F, 0x22, 0x12, 0x22, 0x15,
+    0x22, 0x1A, 0x22, 0x1E, 0x22, 0x2B, 0x22, 0x48, 0x22, 0x60, 0x22, 0x65,
+    0x25, 0xCA, 0xFB, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x20,
+    0x00, 0x30, 0x00, 0x3A, 0x00, 0xA0, 0x01, 0x8F, 0x01, 0x92, 0x01, 0x9D,
+    0x01, 0xA0, 0x01, 0xAF, 0x01, 0xC4, 0x01, 0xE6, 0x01, 0xEA, 0x01, 0xF1,
+    0x01, 0xFA, 0x02, 0x2A, 0x02, 0x30, 0x02, 0x37, 0x02, 0x59, 0x02, 0x72,
+    0x02, 0xBB, 0x02, 0xBE, 0x02, 0xC6, 0x02, 0xCC, 0x02, 0xD8, 0x03, 0x00,
+    0x03, 0x06, 0x03, 0x0F, 0x03, 0x11, 0x03, 0x1B, 0x03, 0x23, 0x03, 0x26,
+    0x03, 0x2E, 0x03, 0x31, 0x03, 0x35, 0x03, 0x94, 0x03, 0xA9, 0x03, 0xBC,
+    0x03, 0xC0, 0x1E, 0x08, 0x1E, 0x0C, 0x1E, 0x14, 0x1E, 0x1C, 0x1E, 0x20,
+    0x1E, 0x24, 0x1E, 0x2A, 0x1E, 0x2E, 0x1E, 0x36, 0x1E, 0x3A, 0x1E, 0x42,
+    0x1E, 0x4C, 0x1E, 0x5A, 0x1E, 0x5E, 0x1E, 0x6C, 0x1E, 0x78, 0x1E, 0x80,
+    0x1E, 0x8E, 0x1E, 0x92, 0x1E, 0x97, 0x1E, 0x9E, 0x1E, 0xA0, 0x20, 0x07,
+    0x20, 0x10, 0x20, 0x12, 0x20, 0x18, 0x20, 0x1C, 0x20, 0x20, 0x20, 0x26,
+    0x20, 0x30, 0x20, 0x33, 0x20, 0x39, 0x20, 0x44, 0x20, 0x70, 0x20, 0x74,
+    0x20, 0x80, 0x20, 0xA1, 0x20, 0xA3, 0x20, 0xA6, 0x20, 0xA9, 0x20, 0xAB,
+    0x20, 0xB1, 0x20, 0xB5, 0x20, 0xB9, 0x20, 0xBC, 0x21, 0x13, 0x21, 0x16,
+    0x21, 0x22, 0x21, 0x26, 0x21, 0x2E, 0x21, 0x5B, 0x22, 0x02, 0x22, 0x05,
+    0x22, 0x0F, 0x22, 0x11, 0x22, 0x15, 0x22, 0x19, 0x22, 0x1E, 0x22, 0x2B,
+    0x22, 0x48, 0x22, 0x60, 0x22, 0x64, 0x25, 0xCA, 0xFB, 0x01, 0xFF, 0xFF,
+    0x02, 0x54, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x2C,
+    0x01, 0x13, 0xFE, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x33,
+    0xFE, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFA, 0xFF, 0xF2,
+    0xFF, 0xEB, 0xFF, 0xEA, 0xFF, 0xE5, 0xFF, 0xE3, 0xFF, 0xE0, 0xFE, 0x8E,
+    0xFE, 0x7A, 0xFE, 0x68, 0xFE, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x2F, 0xE2, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0xE2, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0x47, 0xE2, 0xB8, 0xE2, 0x7B, 0xE2, 0x64, 0xE2, 0x15,
+    0xE1, 0xDF, 0xE1, 0xDF, 0xE1, 0xBB, 0xE2, 0x18, 0x00, 0x00, 0xE2, 0x1E,
+    0xE2, 0x21, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0x9F, 0xE1, 0x9F, 0xE1, 0x8A, 0xE1, 0xBA, 0xE1, 0x86, 0xE1, 0x02,
+    0xE0, 0xE4, 0x00, 0x00, 0xE0, 0xD3, 0x00, 0x00, 0xE0, 0xB8, 0x00, 0x00,
+    0xE0, 0xBF, 0xE0, 0xB4, 0xE0, 0x91, 0xE0, 0x73, 0x00, 0x00, 0xDD, 0x1F,
+    0x07, 0x1D, 0x00, 0x01, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0xEA,
+    0x01, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x28, 0x03, 0x2A,
+    0x03, 0x2C, 0x03, 0x4C, 0x03, 0x4E, 0x03, 0x50, 0x03, 0x52, 0x03, 0x94,
+    0x03, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9A, 0x03, 0x9C,
+    0x03, 0x9E, 0x00, 0x00, 0x03, 0xA0, 0x03, 0xAA, 0x03, 0xB2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xA6,
+    0x03, 0xA8, 0x03, 0xAE, 0x03, 0xB4, 0x03, 0xB6, 0x03, 0xB8, 0x03, 0xBA,
+    0x03, 0xBC, 0x03, 0xBE, 0x03, 0xC0, 0x03, 0xC2, 0x03, 0xD0, 0x03, 0xDE,
+    0x03, 0xE0, 0x03, 0xF6, 0x03, 0xFC, 0x04, 0x02, 0x04, 0x0C, 0x04, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x04, 0xBE, 0x00, 0x00, 0x04, 0xC4,
+    0x04, 0xCA, 0x04, 0xCE, 0x04, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xC2, 0x04, 0xC6, 0x00, 0x00,
+    0x04, 0xC6, 0x04, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBC, 0x00, 0x00, 0x04, 0xBC,
+    0x00, 0x00, 0x04, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x65, 0x02, 0x6E,
+    0x02, 0x9F, 0x02, 0x75, 0x02, 0xBB, 0x02, 0xE7, 0x02, 0xA7, 0x02, 0xA0,
+    0x02, 0x89, 0x02, 0x8A, 0x02, 0x74, 0x02, 0xCE, 0x02, 0x6A, 0x02, 0x7E,
+    0x02, 0x69, 0x02, 0x76, 0x02, 0x6B, 0x02, 0x6C, 0x02, 0xD5, 0x02, 0xD2,
+    0x02, 0xD4, 0x02, 0x70, 0x02, 0xA6, 0x00, 0x01, 0x00, 0x1D, 0x00, 0x1E,
+    0x00, 0x25, 0x00, 0x2F, 0x00, 0x46, 0x00, 0x47, 0x00, 0x4E, 0x00, 0x53,
+    0x00, 0x64, 0x00, 0x66, 0x00, 0x68, 0x00, 0x72, 0x00, 0x74, 0x00, 0x80,
+    0x00, 0xA4, 0x00, 0xA6, 0x00, 0xA7, 0x00, 0xAF, 0x00, 0xBC, 0x00, 0xC3,
+    0x00, 0xDB, 0x00, 0xDC, 0x00, 0xE1, 0x00, 0xE2, 0x00, 0xEC, 0x02, 0x8D,
+    0x02, 0x77, 0x02, 0x8E, 0x02, 0xDC, 0x02, 0x85, 0x03, 0x18, 0x01, 0x07,
+    0x01, 0x23, 0x01, 0x24, 0x01, 0x2B, 0x01, 0x32, 0x01, 0x4A, 0x01, 0x4B,
+    0x01, 0x52, 0x01, 0x57, 0x01, 0x69, 0x01, 0x6C, 0x01, 0x6F, 0x01, 0x78,
+    0x01, 0x7A, 0x01, 0x86, 0x01, 0xAA, 0x01, 0xAC, 0x01, 0xAD, 0x01, 0xB5,
+    0x01, 0xC1, 0x01, 0xC9, 0x01, 0xE1, 0x01, 0xE2, 0x01, 0xE7, 0x01, 0xE8,
+    0x01, 0xF2, 0x02, 0x8B, 0x02, 0xAF, 0x02, 0x8C, 0x02, 0xDA, 0x02, 0x66,
+    0x02, 0x6F, 0x02, 0xB8, 0x02, 0xC9, 0x02, 0xBA, 0x02, 0xCB, 0x02, 0xB0,
+    0x02, 0xA9, 0x03, 0x16, 0x02, 0xAA, 0x02, 0x20, 0x02, 0x9B, 0x02, 0xDB,
+    0x02, 0x7F, 0x02, 0xAB, 0x03, 0x20, 0x02, 0xAD, 0x02, 0xD8, 0x02, 0x51,
+    0x02, 0x52, 0x03, 0x19, 0x02, 0xE5, 0x02, 0xA8, 0x02, 0x72, 0x03, 0x21,
+    0x02, 0x50, 0x02, 0x21, 0x02, 0x9C, 0x02, 0x5B, 0x02, 0x5A, 0x02, 0x5C,
+    0x02, 0x71, 0x00, 0x13, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x11,
+    0x00, 0x18, 0x00, 0x1B, 0x00, 0x21, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x34,
+    0x00, 0x3B, 0x00, 0x5E, 0x00, 0x55, 0x00, 0x58, 0x00, 0x5A, 0x00, 0x28,
+    0x00, 0x7E, 0x00, 0x8F, 0x00, 0x81, 0x00, 0x84, 0x00, 0x9F, 0x00, 0x8B,
+    0x02, 0xD0, 0x00, 0x9D, 0x00, 0xCB, 0x00, 0xC4, 0x00, 0xC7, 0x00, 0xC9,
+    0x00, 0xE3, 0x00, 0xA5, 0x01, 0xC0, 0x01, 0x19, 0x01, 0x08, 0x01, 0x10,
+    0x01, 0x20, 0x01, 0x17, 0x01, 0x1E, 0x01, 0x21, 0x01, 0x27, 0x01, 0x41,
+    0x01, 0x33, 0x01, 0x37, 0x01, 0x3E, 0x01, 0x62, 0x01, 0x59, 0x01, 0x5C,
+    0x01, 0x5E, 0x01, 0x2C, 0x01, 0x84, 0x01, 0x95, 0x01, 0x87, 0x01, 0x8A,
+    0x01, 0xA5, 0x01, 0x91, 0x02, 0xD1, 0x01, 0xA3, 0x01, 0xD1, 0x01, 0xCA,
+    0x01, 0xCD, 0x01, 0xCF, 0x01, 0xE9, 0x01, 0xAB, 0x01, 0xEB, 0x00, 0x16,
+    0x01, 0x1C, 0x00, 0x03, 0x01, 0x09, 0x00, 0x17, 0x01, 0x1D, 0x00, 0x1F,
+    0x01, 0x25, 0x00, 0x23, 0x01, 0x29, 0x00, 0x24, 0x01, 0x2A, 0x00, 0x20,
+    0x01, 0x26, 0x00, 0x29, 0x01, 0x2D, 0x00, 0x2A, 0x01, 0x2E, 0x00, 0x41,
+    0x01, 0x44, 0x00, 0x31, 0x01, 0x34, 0x00, 0x3C, 0x01, 0x3F, 0x00, 0x44,
+    0x01, 0x47, 0x00, 0x32, 0x01, 0x35, 0x00, 0x4A, 0x01, 0x4E, 0x00, 0x48,
+    0x01, 0x4C, 0x00, 0x4C, 0x01, 0x50, 0x00, 0x4B, 0x01, 0x4F, 0x00, 0x51,
+    0x01, 0x55, 0x00, 0x4F, 0x01, 0x53, 0x00, 0x63, 0x01, 0x68, 0x00, 0x61,
+    0x01, 0x66, 0x00, 0x56, 0x01, 0x5A, 0x00, 0x62, 0x01, 0x67, 0x00, 0x5C,
+    0x01, 0x58, 0x00, 0x54, 0x01, 0x65, 0x00, 0x65, 0x01, 0x6B, 0x00, 0x67,
+    0x01, 0x6D, 0x01, 0x6E, 0x00, 0x6A, 0x01, 0x70, 0x00, 0x6C, 0x01, 0x72,
+    0x00, 0x6B, 0x01, 0x71, 0x00, 0x6D, 0x01, 0x73, 0x00, 0x71, 0x01, 0x77,
+    0x00, 0x76, 0x01, 0x7B, 0x00, 0x78, 0x01, 0x7E, 0x00, 0x77, 0x01, 0x7D,
+    0x01, 0x7C, 0x00, 0x7F, 0x01, 0x85, 0x00, 0x99, 0x01, 0x9F, 0x00, 0x82,
+    0x01, 0x88, 0x00, 0x97, 0x01, 0x9D, 0x00, 0xA3, 0x01, 0xA9, 0x00, 0xA8,
+    0x01, 0xAE, 0x00, 0xAA, 0x01, 0xB0, 0x00, 0xA9, 0x01, 0xAF, 0x00, 0xB0,
+    0x01, 0xB6, 0x00, 0xB5, 0x01, 0xBB, 0x00, 0xB4, 0x01, 0xBA, 0x00, 0xB2,
+    0x01, 0xB8, 0x00, 0xBF, 0x01, 0xC4, 0x00, 0xBE, 0x01, 0xC3, 0x00, 0xBD,
+    0x01, 0xC2, 0x00, 0xD9, 0x01, 0xDF, 0x00, 0xD5, 0x01, 0xDB, 0x00, 0xC5,
+    0x01, 0xCB, 0x00, 0xD8, 0x01, 0xDE, 0x00, 0xD3, 0x01, 0xD9, 0x00, 0xD7,
+    0x01, 0xDD, 0x00, 0xDE, 0x01, 0xE4, 0x00, 0xE4, 0x01, 0xEA, 0x00, 0xE5,
+    0x00, 0xED, 0x01, 0xF3, 0x00, 0xEF, 0x01, 0xF5, 0x00, 0xEE, 0x01, 0xF4,
+    0x00, 0x91, 0x01, 0x97, 0x00, 0xCD, 0x01, 0xD3, 0x00, 0x27, 0x00, 0x2E,
+    0x01, 0x31, 0x00, 0x69, 0x00, 0x6F, 0x01, 0x75, 0x00, 0x75, 0x00, 0x7C,
+    0x01, 0x82, 0x00, 0x09, 0x01, 0x0F, 0x00, 0x57, 0x01, 0x5B, 0x00, 0x83,
+    0x01, 0x89, 0x00, 0xC6, 0x01, 0xCC, 0x00, 0x49, 0x01, 0x4D, 0x00, 0x9C,
+    0x01, 0xA2, 0x00, 0x26, 0x00, 0x2D, 0x00, 0x19, 0x01, 0x1F, 0x00, 0x1C,
+    0x01, 0x22, 0x00, 0x9E, 0x01, 0xA4, 0x00, 0x10, 0x01, 0x16, 0x00, 0x15,
+    0x01, 0x1B, 0x00, 0x3A, 0x01, 0x3D, 0x00, 0x40, 0x01, 0x43, 0x00, 0x59,
+    0x01, 0x5D, 0x00, 0x60, 0x01, 0x64, 0x00, 0x8A, 0x01, 0x90, 0x00, 0x98,
+    0x01, 0x9E, 0x00, 0xAB, 0x01, 0xB1, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0xC8,
+    0x01, 0xCE, 0x00, 0xD4, 0x01, 0xDA, 0x00, 0xB6, 0x01, 0xBC, 0x00, 0xC0,
+    0x01, 0xC5, 0x00, 0x8C, 0x01, 0x92, 0x00, 0xA2, 0x01, 0xA8, 0x00, 0x8D,
+    0x01, 0x93, 0x00, 0xEA, 0x01, 0xF0, 0x03, 0x48, 0x03, 0x47, 0x03, 0x4A,
+    0x03, 0x49, 0x03, 0x1B, 0x03, 0x1C, 0x03, 0x4C, 0x03, 0x1D, 0x03, 0x17,
+    0x03, 0x1E, 0x03, 0x22, 0x03, 0x1F, 0x03, 0x1A, 0x02, 0xF7, 0x02, 0xF8,
+    0x02, 0xFC, 0x03, 0x01, 0x03, 0x05, 0x02, 0xFF, 0x02, 0xF5, 0x02, 0xF2,
+    0x03, 0x09, 0x03, 0x00, 0x02, 0xFA, 0x02, 0xFD, 0x00, 0x22, 0x01, 0x28,
+    0x00, 0x2B, 0x01, 0x2F, 0x00, 0x2C, 0x01, 0x30, 0x00, 0x43, 0x01, 0x46,
+    0x00, 0x42, 0x01, 0x45, 0x00, 0x33, 0x01, 0x36, 0x00, 0x4D, 0x01, 0x51,
+    0x00, 0x52, 0x01, 0x56, 0x00, 0x50, 0x01, 0x54, 0x00, 0x5B, 0x01, 0x5F,
+    0x00, 0x6E, 0x01, 0x74, 0x00, 0x70, 0x01, 0x76, 0x00, 0x73, 0x01, 0x79,
+    0x00, 0x79, 0x01, 0x7F, 0x00, 0x7A, 0x01, 0x80, 0x00, 0x7D, 0x01, 0x83,
+    0x00, 0xA0, 0x01, 0xA6, 0x00, 0xA1, 0x01, 0xA7, 0x00, 0x9B, 0x01, 0xA1,
+    0x00, 0x9A, 0x01, 0xA0, 0x00, 0xAC, 0x01, 0xB2, 0x00, 0xAE, 0x01, 0xB4,
+    0x00, 0xB7, 0x01, 0xBD, 0x00, 0xB8, 0x01, 0xBE, 0x00, 0xB1, 0x01, 0xB7,
+    0x00, 0xB3, 0x01, 0xB9, 0x00, 0xB9, 0x01, 0xBF, 0x00, 0xC1, 0x01, 0xC7,
+    0x00, 0xC2, 0x01, 0xC8, 0x00, 0xDA, 0x01, 0xE0, 0x00, 0xD6, 0x01, 0xDC,
+    0x00, 0xE0, 0x01, 0xE6, 0x00, 0xDD, 0x01, 0xE3, 0x00, 0xDF, 0x01, 0xE5,
+    0x00, 0xE6, 0x01, 0xEC, 0x00, 0xF0, 0x01, 0xF6, 0x00, 0x12, 0x01, 0x18,
+    0x00, 0x14, 0x01, 0x1A, 0x00, 0x0B, 0x01, 0x11, 0x00, 0x0D, 0x01, 0x13,
+    0x00, 0x0E, 0x01, 0x14, 0x00, 0x0F, 0x01, 0x15, 0x00, 0x0C, 0x01, 0x12,
+    0x00, 0x04, 0x01, 0x0A, 0x00, 0x06, 0x01, 0x0C, 0x00, 0x07, 0x01, 0x0D,
+    0x00, 0x08, 0x01, 0x0E, 0x00, 0x05, 0x01, 0x0B, 0x00, 0x3D, 0x01, 0x40,
+    0x00, 0x3F, 0x01, 0x42, 0x00, 0x45, 0x01, 0x48, 0x00, 0x35, 0x01, 0x38,
+    0x00, 0x37, 0x01, 0x3A, 0x00, 0x38, 0x01, 0x3B, 0x00, 0x39, 0x01, 0x3C,
+    0x00, 0x36, 0x01, 0x39, 0x00, 0x5F, 0x01, 0x63, 0x00, 0x5D, 0x01, 0x61,
+    0x00, 0x8E, 0x01, 0x94, 0x00, 0x90, 0x01, 0x96, 0x00, 0x85, 0x01, 0x8B,
+    0x00, 0x87, 0x01, 0x8D, 0x00, 0x88, 0x01, 0x8E, 0x00, 0x89, 0x01, 0x8F,
+    0x00, 0x86, 0x01, 0x8C, 0x00, 0x92, 0x01, 0x98, 0x00, 0x94, 0x01, 0x9A,
+    0x00, 0x95, 0x01, 0x9B, 0x00, 0x96, 0x01, 0x9C, 0x00, 0x93, 0x01, 0x99,
+    0x00, 0xCA, 0x01, 0xD0, 0x00, 0xCC, 0x01, 0xD2, 0x00, 0xCE, 0x01, 0xD4,
+    0x00, 0xD0, 0x01, 0xD6, 0x00, 0xD1, 0x01, 0xD7, 0x00, 0xD2, 0x01, 0xD8,
+    0x00, 0xCF, 0x01, 0xD5, 0x00, 0xE8, 0x01, 0xEE, 0x00, 0xE7, 0x01, 0xED,
+    0x00, 0xE9, 0x01, 0xEF, 0x00, 0xEB, 0x01, 0xF1, 0x02, 0x62, 0x02, 0x64,
+    0x02, 0x67, 0x02, 0x63, 0x02, 0x68, 0x02, 0x82, 0x02, 0x80, 0x02, 0x81,
+    0x02, 0x83, 0x02, 0x99, 0x02, 0x9A, 0x02, 0x95, 0x02, 0x97, 0x02, 0x98,
+    0x02, 0x96, 0x02, 0xB1, 0x02, 0xB3, 0x02, 0x73, 0x02, 0xBE, 0x02, 0xC1,
+    0x02, 0xBC, 0x02, 0xBD, 0x02, 0xC0, 0x02, 0xC6, 0x02, 0xBF, 0x02, 0xC8,
+    0x02, 0xC2, 0x02, 0xC3, 0x02, 0xC7, 0x02, 0xDE, 0x02, 0xE1, 0x02, 0xE3,
+    0x02, 0xCF, 0x02, 0xCC, 0x02, 0xE4, 0x02, 0xD7, 0x02, 0xD6, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xDE, 0x03, 0x1C, 0x00, 0x02,
+    0x44, 0x46, 0x4C, 0x54, 0x01, 0xAE, 0x6C, 0x61, 0x74, 0x6E, 0x00, 0x0E,
+    0x01, 0x7E, 0x00, 0x09, 0x41, 0x5A, 0x45, 0x20, 0x01, 0x5A, 0x43, 0x41,
+    0x54, 0x20, 0x01, 0x36, 0x43, 0x52, 0x54, 0x20, 0x01, 0x12, 0x4B, 0x41,
+    0x5A, 0x20, 0x00, 0xEE, 0x4D, 0x4F, 0x4C, 0x20, 0x00, 0xCA, 0x4E, 0x4C,
+    0x44, 0x20, 0x00, 0xA6, 0x52, 0x4F, 0x4D, 0x20, 0x00, 0x82, 0x54, 0x41,
+    0x54, 0x20, 0x00, 0x5E, 0x54, 0x52, 0x4B, 0x20, 0x00, 0x3A, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x0A, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x09, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
+    0x61, 0x61, 0x6C, 0x74, 0x01, 0x36, 0x63, 0x61, 0x73, 0x65, 0x01, 0x30,
+    0x63, 0x63, 0x6D, 0x70, 0x01, 0x22, 0x63, 0x63, 0x6D, 0x70, 0x01, 0x10,
+    0x64, 0x6C, 0x69, 0x67, 0x01, 0x0A, 0x64, 0x6E, 0x6F, 0x6D, 0x01, 0x04,
+    0x66, 0x72, 0x61, 0x63, 0x00, 0xFA, 0x6C, 0x69, 0x67, 0x61, 0x00, 0xF4,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xEE, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xE8,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xE2, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xDC,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xD6, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xD0,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xCA, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xC4,
+    0x6C, 0x6F, 0x63, 0x6C, 0x00, 0xBE, 0x6E, 0x75, 0x6D, 0x72, 0x00, 0xB8,
+    0x6F, 0x72, 0x64, 0x6E, 0x00, 0xB0, 0x73, 0x69, 0x6E, 0x66, 0x00, 0xAA,
+    0x73, 0x73, 0x30, 0x31, 0x00, 0xA4, 0x73, 0x75, 0x62, 0x73, 0x00, 0x9E,
+    0x73, 0x75, 0x70, 0x73, 0x00, 0x98, 0x7A, 0x65, 0x72, 0x6F, 0x00, 0x92,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20,
+    0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x0B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02,
+    0x00, 0x05, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x08, 0x30, 0x07, 0x72, 0x06, 0xAE,
+    0x06, 0x26, 0x06, 0x26, 0x05, 0xEE, 0x05, 0x98, 0x05, 0x98, 0x05, 0x0A,
+    0x04, 0x80, 0x04, 0x22, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E, 0x04, 0x0E,
+    0x04, 0x0E, 0x03, 0xEC, 0x03, 0xEC, 0x03, 0xBE, 0x03, 0x82, 0x03, 0x74,
+    0x03, 0x66, 0x03, 0x4E, 0x03, 0x4E, 0x03, 0x40, 0x03, 0x32, 0x03, 0x24,
+    0x03, 0x10, 0x03, 0x32, 0x02, 0xC8, 0x02, 0xBA, 0x02, 0xBA, 0x02, 0x7C,
+    0x02, 0x5A, 0x02, 0x38, 0x01, 0x6A, 0x01, 0x40, 0x01, 0x02, 0x00, 0xEE,
+    0x00, 0x52, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02,
+    0x00, 0x72, 0x00, 0x36, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5,
+    0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
+    0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0xF8,
+    0x01, 0xF9, 0x01, 0xFA, 0x01, 0xFB, 0x01, 0xFC, 0x01, 0xFD, 0x01, 0xFE,
+    0x01, 0xFF, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04,
+    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A,
+    0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10,
+    0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14, 0x02, 0x15, 0x02, 0x16,
+    0x02, 0x17, 0x02, 0x18, 0x00, 0x02, 0x00, 0x05, 0x00, 0x53, 0x00, 0x65,
+    0x00, 0x00, 0x00, 0x69, 0x00, 0x69, 0x00, 0x13, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x14, 0x01, 0x07, 0x01, 0x20, 0x00, 0x15, 0x01, 0x4B, 0x01, 0x51,
+    0x00, 0x2F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x06, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x01, 0x02, 0x26, 0x00, 0x04,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x5A, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x05, 0x00, 0x26, 0x00, 0x1E, 0x00, 0x18, 0x00, 0x12,
+    0x00, 0x0C, 0x02, 0x1F, 0x00, 0x02, 0x01, 0x6F, 0x02, 0x1E, 0x00, 0x02,
+    0x01, 0x57, 0x02, 0x19, 0x00, 0x02, 0x01, 0x4A, 0x02, 0x1C, 0x00, 0x03,
+    0x01, 0x4A, 0x01, 0x6F, 0x02, 0x1A, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x57,
+    0x00, 0x04, 0x00, 0x08, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x1C,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x02, 0x1D,
+    0x00, 0x02, 0x01, 0x65, 0x02, 0x1B, 0x00, 0x03, 0x01, 0x4A, 0x01, 0x65,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x4A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x74, 0x00, 0x37, 0x02, 0x78, 0x02, 0x79,
+    0x02, 0x7A, 0x02, 0x7B, 0x02, 0x7D, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88,
+    0x02, 0x8F, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94,
+    0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xB6, 0x03, 0x34,
+    0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30,
+    0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31,
+    0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B,
+    0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41,
+    0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02,
+    0x00, 0x0D, 0x02, 0x72, 0x02, 0x73, 0x00, 0x00, 0x02, 0x76, 0x02, 0x77,
+    0x00, 0x02, 0x02, 0x7C, 0x02, 0x7C, 0x00, 0x04, 0x02, 0x7E, 0x02, 0x7E,
+    0x00, 0x05, 0x02, 0x80, 0x02, 0x81, 0x00, 0x06, 0x02, 0x89, 0x02, 0x8E,
+    0x00, 0x08, 0x02, 0x9B, 0x02, 0x9E, 0x00, 0x0E, 0x02, 0xA6, 0x02, 0xA6,
+    0x00, 0x12, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x13, 0x02, 0xFC, 0x02, 0xFD,
+    0x00, 0x24, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x26, 0x03, 0x0D, 0x03, 0x0D,
+    0x00, 0x33, 0x03, 0x10, 0x03, 0x12, 0x00, 0x34, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x14, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x04, 0x02, 0xB5, 0x00, 0x03, 0x01, 0x86, 0x02, 0x69,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x04, 0x02, 0x20, 0x02, 0x21,
+    0x02, 0x20, 0x02, 0x21, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x80,
+    0x01, 0x07, 0x01, 0x86, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x24,
+    0x00, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x00, 0xD6, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01, 0x00, 0x02,
+    0x00, 0x80, 0x01, 0x86, 0x00, 0x03, 0x00, 0x01, 0x00, 0xBC, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x01, 0x01, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x3E, 0xFF, 0xEC, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x26, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x01, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1F,
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x31, 0x02, 0x3A, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x01, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x1E, 0x00, 0x02, 0x00, 0x01, 0x02, 0x45, 0x02, 0x4E,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x59, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0xFF, 0xE3, 0x00, 0x01,
+    0x00, 0x01, 0x02, 0x76, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x30, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x22, 0x00, 0x1F, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x14, 0x00, 0x29, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x15,
+    0x00, 0x02, 0x00, 0x01, 0x02, 0x26, 0x02, 0x2F, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x24, 0x00, 0x0B,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x16,
+    0x00, 0x0A, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x01, 0x02, 0x72,
+    0x00, 0x02, 0x00, 0x16, 0x00, 0x06, 0x00, 0x01, 0x00, 0x68, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x68, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x01,
+    0x01, 0x6F, 0x00, 0x01, 0x00, 0x01, 0x01, 0x6F, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x1E, 0x00, 0x02, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x04,
+    0x01, 0xF7, 0x00, 0x02, 0x01, 0x69, 0x00, 0x01, 0x00, 0x04, 0x00, 0xF1,
+    0x00, 0x02, 0x00, 0x64, 0x00, 0x01, 0x00, 0x02, 0x00, 0x55, 0x01, 0x59,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x0E,
+    0x00, 0x04, 0x00, 0xB6, 0x00, 0xC0, 0x01, 0xBC, 0x01, 0xC5, 0x00, 0x01,
+    0x00, 0x04, 0x00, 0xB4, 0x00, 0xBF, 0x01, 0xBA, 0x01, 0xC4, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x06, 0x00, 0x09,
+    0x00, 0x01, 0x00, 0x01, 0x01, 0x57, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x00, 0x4E, 0x00, 0x02, 0x00, 0x2C, 0x00, 0x0A,
+    0x00, 0x04, 0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x02, 0xED,
+    0x00, 0x02, 0x03, 0x01, 0x02, 0xEC, 0x00, 0x02, 0x03, 0x09, 0x02, 0xEB,
+    0x00, 0x02, 0x02, 0xF7, 0x02, 0xEA, 0x00, 0x02, 0x02, 0xF8, 0x00, 0x04,
+    0x00, 0x1C, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0A, 0x02, 0xF1, 0x00, 0x02,
+    0x03, 0x01, 0x02, 0xF0, 0x00, 0x02, 0x03, 0x09, 0x02, 0xEF, 0x00, 0x02,
+    0x02, 0xF7, 0x02, 0xEE, 0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x02,
+    0x02, 0xFC, 0x02, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x1E, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x76, 0x00, 0x70,
+    0x00, 0x6A, 0x00, 0x64, 0x00, 0x5E, 0x00, 0x58, 0x00, 0x52, 0x00, 0x4C,
+    0x00, 0x46, 0x00, 0x40, 0x00, 0x3A, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x27,
+    0x00, 0x2E, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x6F, 0x00, 0x75, 0x00, 0x7C,
+    0x01, 0x31, 0x01, 0x75, 0x01, 0x82, 0x02, 0x1E, 0x02, 0x1F, 0x00, 0x02,
+    0x01, 0x4A, 0x01, 0x6F, 0x00, 0x02, 0x01, 0x4A, 0x01, 0x57, 0x00, 0x02,
+    0x01, 0x7A, 0x01, 0x69, 0x00, 0x02, 0x01, 0x6F, 0x01, 0x69, 0x00, 0x02,
+    0x01, 0x2B, 0x01, 0xF4, 0x00, 0x02, 0x00, 0x74, 0x01, 0x69, 0x00, 0x02,
+    0x00, 0x74, 0x00, 0x64, 0x00, 0x02, 0x00, 0x68, 0x01, 0x69, 0x00, 0x02,
+    0x00, 0x68, 0x02, 0x7D, 0x00, 0x02, 0x00, 0x68, 0x00, 0x64, 0x00, 0x02,
+    0x00, 0x25, 0x01, 0xF4, 0x00, 0x02, 0x00, 0x25, 0x00, 0xEE, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x00, 0x76, 0x00, 0x06,
+    0x00, 0x64, 0x00, 0x5A, 0x00, 0x50, 0x00, 0x46, 0x00, 0x2C, 0x00, 0x12,
+    0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x03, 0x07, 0x00, 0x02,
+    0x02, 0xF7, 0x03, 0x06, 0x00, 0x02, 0x02, 0xF2, 0x03, 0x08, 0x00, 0x02,
+    0x02, 0xF8, 0x00, 0x03, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x08, 0x03, 0x04,
+    0x00, 0x02, 0x03, 0x05, 0x03, 0x02, 0x00, 0x02, 0x02, 0xF2, 0x03, 0x03,
+    0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x04, 0x02, 0xFE, 0x00, 0x02,
+    0x02, 0xF5, 0x00, 0x01, 0x00, 0x04, 0x02, 0xF9, 0x00, 0x02, 0x02, 0xF5,
+    0x00, 0x01, 0x00, 0x04, 0x02, 0xF6, 0x00, 0x02, 0x03, 0x05, 0x00, 0x02,
+    0x00, 0x0C, 0x00, 0x06, 0x02, 0xF4, 0x00, 0x02, 0x03, 0x05, 0x02, 0xF3,
+    0x00, 0x02, 0x02, 0xF8, 0x00, 0x01, 0x00, 0x06, 0x02, 0xF2, 0x02, 0xF5,
+    0x02, 0xF8, 0x02, 0xFD, 0x03, 0x01, 0x03, 0x05, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x01, 0x50, 0x00, 0x24, 0x03, 0x34,
+    0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30,
+    0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31,
+    0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B,
+    0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41,
+    0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x1C, 0x00, 0x0A, 0x00, 0x03, 0x00, 0x01,
+    0x00, 0x24, 0x00, 0x01, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xE6, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x02, 0x00, 0x01,
+    0x03, 0x23, 0x03, 0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x02, 0x00, 0x52, 0x00, 0x26, 0x01, 0x58, 0x01, 0x6A,
+    0x03, 0x34, 0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D,
+    0x03, 0x30, 0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26,
+    0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C,
+    0x03, 0x31, 0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A,
+    0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40,
+    0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46,
+    0x00, 0x02, 0x00, 0x07, 0x01, 0x57, 0x01, 0x57, 0x00, 0x00, 0x01, 0x69,
+    0x01, 0x69, 0x00, 0x01, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x02, 0x02, 0xFC,
+    0x02, 0xFD, 0x00, 0x13, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x15, 0x03, 0x0D,
+    0x03, 0x0D, 0x00, 0x22, 0x03, 0x10, 0x03, 0x12, 0x00, 0x23, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x88, 0x00, 0x64, 0x00, 0x30, 0x00, 0x0E,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01,
+    0x01, 0x06, 0x00, 0x00, 0x02, 0x22, 0x02, 0x23, 0x01, 0x06, 0x00, 0x03,
+    0x00, 0x01, 0x00, 0x12, 0x00, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x05, 0x02, 0xEA, 0x02, 0xFA,
+    0x00, 0x00, 0x02, 0xFC, 0x02, 0xFD, 0x00, 0x11, 0x02, 0xFF, 0x03, 0x0B,
+    0x00, 0x13, 0x03, 0x0D, 0x03, 0x0D, 0x00, 0x20, 0x03, 0x10, 0x03, 0x12,
+    0x00, 0x21, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x58, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x02,
+    0x00, 0x02, 0x03, 0x0D, 0x03, 0x0F, 0x00, 0x00, 0x03, 0x11, 0x03, 0x15,
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x34, 0x00, 0x01,
+    0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x0F,
+    0x02, 0xF2, 0x02, 0xF5, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xFA, 0x02, 0xFC,
+    0x02, 0xFD, 0x02, 0xFF, 0x03, 0x00, 0x03, 0x01, 0x03, 0x05, 0x03, 0x09,
+    0x03, 0x0A, 0x03, 0x0B, 0x03, 0x0C, 0x00, 0x01, 0x00, 0x02, 0x01, 0x57,
+    0x01, 0x69, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01,
+    0x00, 0x20, 0x00, 0x0D, 0x00, 0xB0, 0x00, 0xA4, 0x00, 0x9A, 0x00, 0x90,
+    0x00, 0x86, 0x00, 0x7C, 0x00, 0x72, 0x00, 0x68, 0x00, 0x5E, 0x00, 0x54,
+    0x00, 0x4A, 0x00, 0x42, 0x00, 0x3C, 0x00, 0x02, 0x00, 0x04, 0x01, 0x07,
+    0x01, 0x07, 0x00, 0x00, 0x02, 0x26, 0x02, 0x2F, 0x00, 0x01, 0x02, 0x72,
+    0x02, 0x72, 0x00, 0x0B, 0x02, 0x76, 0x02, 0x76, 0x00, 0x0C, 0x00, 0x02,
+    0x02, 0x59, 0x02, 0x7A, 0x00, 0x03, 0x02, 0x78, 0x02, 0x7C, 0x02, 0x7D,
+    0x00, 0x04, 0x02, 0x3A, 0x02, 0x44, 0x02, 0x4E, 0x02, 0x58, 0x00, 0x04,
+    0x02, 0x39, 0x02, 0x43, 0x02, 0x4D, 0x02, 0x57, 0x00, 0x04, 0x02, 0x38,
+    0x02, 0x42, 0x02, 0x4C, 0x02, 0x56, 0x00, 0x04, 0x02, 0x37, 0x02, 0x41,
+    0x02, 0x4B, 0x02, 0x55, 0x00, 0x04, 0x02, 0x36, 0x02, 0x40, 0x02, 0x4A,
+    0x02, 0x54, 0x00, 0x04, 0x02, 0x35, 0x02, 0x3F, 0x02, 0x49, 0x02, 0x53,
+    0x00, 0x04, 0x02, 0x34, 0x02, 0x3E, 0x02, 0x48, 0x02, 0x52, 0x00, 0x04,
+    0x02, 0x33, 0x02, 0x3D, 0x02, 0x47, 0x02, 0x51, 0x00, 0x04, 0x02, 0x32,
+    0x02, 0x3C, 0x02, 0x46, 0x02, 0x50, 0x00, 0x05, 0x02, 0x30, 0x02, 0x31,
+    0x02, 0x3B, 0x02, 0x45, 0x02, 0x4F, 0x00, 0x02, 0x01, 0xF8, 0x02, 0x20,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0xFE,
+    0x00, 0x7C, 0x02, 0x20, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5,
+    0x00, 0xF6, 0x00, 0xF7, 0x00, 0xF8, 0x00, 0xF9, 0x00, 0xFA, 0x00, 0xFB,
+    0x00, 0xFC, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x00, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x02, 0x21,
+    0x00, 0xB6, 0x00, 0xC0, 0x01, 0xF9, 0x01, 0xFA, 0x01, 0xFB, 0x01, 0xFC,
+    0x01, 0xFD, 0x01, 0xFE, 0x01, 0xFF, 0x02, 0x00, 0x02, 0x01, 0x02, 0x02,
+    0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08,
+    0x02, 0x09, 0x02, 0x0A, 0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E,
+    0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x14,
+    0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18, 0x01, 0x60, 0x02, 0x21,
+    0x01, 0xBC, 0x01, 0xC5, 0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x34,
+    0x02, 0x35, 0x02, 0x36, 0x02, 0x37, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A,
+    0x02, 0x79, 0x02, 0x7B, 0x02, 0x7D, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88,
+    0x02, 0x8F, 0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94,
+    0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4, 0x02, 0xB6, 0x03, 0x34,
+    0x03, 0x33, 0x03, 0x36, 0x03, 0x35, 0x03, 0x2E, 0x03, 0x2D, 0x03, 0x30,
+    0x03, 0x2F, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x31,
+    0x03, 0x32, 0x03, 0x37, 0x03, 0x38, 0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B,
+    0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x40, 0x03, 0x41,
+    0x03, 0x42, 0x03, 0x43, 0x03, 0x44, 0x03, 0x45, 0x03, 0x46, 0x00, 0x02,
+    0x00, 0x1B, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x53, 0x00, 0x65,
+    0x00, 0x01, 0x00, 0x69, 0x00, 0x69, 0x00, 0x14, 0x00, 0x75, 0x00, 0x75,
+    0x00, 0x15, 0x00, 0x80, 0x00, 0x80, 0x00, 0x16, 0x00, 0xB4, 0x00, 0xB4,
+    0x00, 0x17, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x18, 0x01, 0x08, 0x01, 0x20,
+    0x00, 0x19, 0x01, 0x4B, 0x01, 0x51, 0x00, 0x32, 0x01, 0x57, 0x01, 0x57,
+    0x00, 0x39, 0x01, 0x86, 0x01, 0x86, 0x00, 0x3A, 0x01, 0xBA, 0x01, 0xBA,
+    0x00, 0x3B, 0x01, 0xC4, 0x01, 0xC4, 0x00, 0x3C, 0x02, 0x45, 0x02, 0x4E,
+    0x00, 0x3D, 0x02, 0x73, 0x02, 0x73, 0x00, 0x47, 0x02, 0x77, 0x02, 0x77,
+    0x00, 0x48, 0x02, 0x7C, 0x02, 0x7C, 0x00, 0x49, 0x02, 0x7E, 0x02, 0x7E,
+    0x00, 0x4A, 0x02, 0x80, 0x02, 0x81, 0x00, 0x4B, 0x02, 0x89, 0x02, 0x8E,
+    0x00, 0x4D, 0x02, 0x9B, 0x02, 0x9E, 0x00, 0x53, 0x02, 0xA6, 0x02, 0xA6,
+    0x00, 0x57, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x58, 0x02, 0xFC, 0x02, 0xFD,
+    0x00, 0x69, 0x02, 0xFF, 0x03, 0x0B, 0x00, 0x6B, 0x03, 0x0D, 0x03, 0x0D,
+    0x00, 0x78, 0x03, 0x10, 0x03, 0x12, 0x00, 0x79, 0x02, 0x48, 0x00, 0x28,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14,
+    0x02, 0x63, 0x00, 0x14, 0x02, 0x63, 0x00, 0x14, 0x03, 0x9E, 0x00, 0x00,
+    0x03, 0x9E, 0x00, 0x00, 0x02, 0x8C, 0x00, 0x6E, 0x02, 0xB2, 0x00, 0x37,
+    0x02, 0xB2, 0x00, 0x37, 0x02, 0xB2, 0x00, 0x37, 0x02, 0xB2, 0x00, 0x37,
+    0x02, 0xB2, 0x00, 0x37, 0x02, 0xB2, 0x00, 0x37, 0x02, 0xB2, 0x00, 0x37,
+    0x02, 0xE1, 0x00, 0x6E, 0x05, 0x2E, 0x00, 0x6E, 0x05, 0x2E, 0x00, 0x6E,
+    0x02, 0xE1, 0x00, 0x18, 0x02, 0xE1, 0x00, 0x6E, 0x02, 0xE1, 0x00, 0x18,
+    0x02, 0xE1, 0x00, 0x6E, 0x02, 0xE1, 0x00, 0x6E, 0x04, 0x8D, 0x00, 0x6E,
+    0x04, 0x8D, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x5E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x02, 0x3F, 0x00, 0x6E, 0x02, 0xFF, 0x00, 0x37, 0x02, 0xFE, 0x00, 0x37,
+    0x02, 0xFE, 0x00, 0x37, 0x02, 0xFE, 0x00, 0x37, 0x02, 0xFE, 0x00, 0x37,
+    0x02, 0xFE, 0x00, 0x37, 0x02, 0xFE, 0x00, 0x37, 0x02, 0xDC, 0x00, 0x6E,
+    0x02, 0xDB, 0x00, 0x18, 0x02, 0xDC, 0x00, 0x6E, 0x02, 0xDC, 0x00, 0x6E,
+    0x02, 0xDC, 0x00, 0x6E, 0x01, 0x82, 0x00, 0x32, 0x03, 0xB1, 0x00, 0x32,
+    0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32,
+    0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0xFF, 0xE6, 0x01, 0x82, 0x00, 0x32,
+    0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32,
+    0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32,
+    0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32, 0x01, 0x82, 0x00, 0x32,
+    0x02, 0x2F, 0x00, 0x14, 0x02, 0x2F, 0x00, 0x14, 0x02, 0x7C, 0x00, 0x6E,
+    0x02, 0x7C, 0x00, 0x6E, 0x02, 0x15, 0x00, 0x6E, 0x04, 0x44, 0x00, 0x6E,
+    0x02, 0x15, 0x00, 0x3B, 0x02, 0x15, 0x00, 0x6E, 0x02, 0x15, 0x00, 0x6E,
+    0x02, 0x15, 0x00, 0x6E, 0x02, 0x15, 0x00, 0x6E, 0x02, 0xAB, 0x00, 0x6E,
+    0x02, 0x15, 0x00, 0x6E, 0x02, 0x05, 0xFF, 0xF7, 0x03, 0x47, 0x00, 0x6E,
+    0x03, 0x47, 0x00, 0x6E, 0x02, 0xDB, 0x00, 0x6E, 0x05, 0x0A, 0x00, 0x6E,
+    0x02, 0xDB, 0x00, 0x6E, 0x02, 0xDB, 0x00, 0x6E, 0x02, 0xDB, 0x00, 0x6E,
+    0x02, 0xDB, 0x00, 0x6E, 0x02, 0xDB, 0x00, 0x6E, 0x02, 0xDB, 0xFF, 0xFE,
+    0x03, 0x71, 0x00, 0x6E, 0x02, 0xDB, 0x00, 0x6E, 0x02, 0xDB, 0x00, 0x6E,
+    0x02, 0xDB, 0x00, 0x6E, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x36, 0x03, 0x1E, 0x00, 0x36, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37, 0x03, 0x1E, 0x00, 0x37,
+    0x03, 0xEA, 0x00, 0x37, 0x02, 0x58, 0x00, 0x6E, 0x02, 0x36, 0x00, 0x6E,
+    0x03, 0x1E, 0x00, 0x37, 0x02, 0x61, 0x00, 0x6E, 0x02, 0x61, 0x00, 0x6E,
+    0x02, 0x61, 0x00, 0x6E, 0x02, 0x61, 0x00, 0x6E, 0x02, 0x61, 0x00, 0x4C,
+    0x02, 0x61, 0x00, 0x6E, 0x02, 0x61, 0x00, 0x6E, 0x02, 0x61, 0x00, 0x6E,
+    0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B,
+    0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B,
+    0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B,
+    0x02, 0x37, 0x00, 0x2B, 0x02, 0x37, 0x00, 0x2B, 0x02, 0xC3, 0x00, 0x6E,
+    0x03, 0x1B, 0x00, 0x36, 0x01, 0xE8, 0x00, 0x14, 0x01, 0xE8, 0x00, 0x14,
+    0x01, 0xE8, 0x00, 0x14, 0x01, 0xE8, 0x00, 0x14, 0x01, 0xE8, 0x00, 0x14,
+    0x01, 0xE8, 0x00, 0x14, 0x01, 0xE8, 0x00, 0x14, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E,
+    0x02, 0xE8, 0x00, 0x6E, 0x02, 0xE8, 0x00, 0x6E, 0x02, 0x5C, 0x00, 0x14,
+    0x03, 0x51, 0x00, 0x14, 0x03, 0x51, 0x00, 0x14, 0x03, 0x51, 0x00, 0x14,
+    0x03, 0x51, 0x00, 0x14, 0x03, 0x51, 0x00, 0x14, 0x02, 0x48, 0x00, 0x16,
+    0x02, 0x50, 0x00, 0x14, 0x02, 0x50, 0x00, 0x14, 0x02, 0x50, 0x00, 0x14,
+    0x02, 0x50, 0x00, 0x14, 0x02, 0x50, 0x00, 0x14, 0x02, 0x50, 0x00, 0x14,
+    0x02, 0x50, 0x00, 0x14, 0x02, 0x50, 0x00, 0x14, 0x02, 0x50, 0x00, 0x14,
+    0x02, 0x50, 0x00, 0x14, 0x02, 0x7A, 0x00, 0x3C, 0x02, 0x7A, 0x00, 0x3C,
+    0x02, 0x7A, 0x00, 0x3C, 0x02, 0x7A, 0x00, 0x3C, 0x02, 0x7A, 0x00, 0x3C,
+    0x03, 0xB1, 0x00, 0x32, 0x01, 0x34, 0x00, 0x8F, 0x03, 0x36, 0x00, 0x8F,
+    0x01, 0x34, 0x00, 0x5C, 0x01, 0x34, 0x00, 0x16, 0x01, 0x34, 0x00, 0x21,
+    0x01, 0x34, 0x00, 0x20, 0x01, 0x34, 0xFF, 0xBF, 0x01, 0x34, 0x00, 0x34,
+    0x01, 0x34, 0x00, 0x34, 0x01, 0x34, 0x00, 0x7E, 0x01, 0x34, 0x00, 0x7E,
+    0x01, 0x34, 0x00, 0x34, 0x01, 0x34, 0x00, 0x48, 0x01, 0x34, 0x00, 0x16,
+    0x01, 0x34, 0x00, 0x12, 0x01, 0x34, 0x00, 0x05, 0x01, 0x34, 0x00, 0x15,
+    0x02, 0x02, 0x00, 0x14, 0x02, 0x02, 0x00, 0x14, 0x04, 0x17, 0x00, 0x6E,
+    0x04, 0xDD, 0x00, 0x6E, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x28,
+    0x03, 0xB3, 0x00, 0x28, 0x03, 0xB3, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x46,
+    0x02, 0x0E, 0x00, 0x28, 0x02, 0x0E, 0x00, 0x28, 0x02, 0x0E, 0x00, 0x28,
+    0x02, 0x0E, 0x00, 0x28, 0x02, 0x0E, 0x00, 0x28, 0x02, 0x0E, 0x00, 0x28,
+    0x02, 0x0E, 0x00, 0x28, 0x02, 0x5C, 0x00, 0x28, 0x02, 0x40, 0x00, 0x28,
+    0x02, 0x3C, 0x00, 0x28, 0x02, 0x5C, 0x00, 0x28, 0x02, 0x5C, 0x00, 0x28,
+    0x02, 0x5C, 0x00, 0x28, 0x04, 0x09, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x28,
+    0x02, 0x21, 0x00, 0x28, 0x02, 0x21, 0x00, 0x23, 0x01, 0x54, 0x00, 0x1E,
+    0x02, 0x5B, 0x00, 0x28, 0x02, 0x5B, 0x00, 0x28, 0x02, 0x5B, 0x00, 0x28,
+    0x02, 0x5B, 0x00, 0x28, 0x02, 0x5B, 0x00, 0x28, 0x02, 0x5B, 0x00, 0x28,
+    0x02, 0x5B, 0x00, 0x28, 0x02, 0x1D, 0x00, 0x46, 0x02, 0x1D, 0xFF, 0xF0,
+    0x02, 0x1D, 0x00, 0x46, 0x02, 0x1D, 0x00, 0x46, 0x02, 0x1D, 0x00, 0x46,
+    0x00, 0xC4, 0x00, 0x46, 0x00, 0xA2, 0x00, 0x46, 0x00, 0xA2, 0x00, 0x18,
+    0x00, 0xA2, 0xFF, 0xCD, 0x00, 0xA2, 0xFF, 0xD8, 0x00, 0xA2, 0xFF, 0xD8,
+    0x00, 0xA2, 0xFF, 0x92, 0x00, 0xA2, 0xFF, 0xEA, 0x00, 0xA2, 0xFF, 0xEA,
+    0x00, 0xA2, 0x00, 0x35, 0x00, 0xC4, 0x00, 0x46, 0x00, 0xA2, 0xFF, 0xF0,
+    0x00, 0xA2, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xCD, 0x01, 0x5A, 0x00, 0x46,
+    0x00, 0xA2, 0xFF, 0xCA, 0x00, 0xA2, 0xFF, 0xC1, 0x00, 0xA2, 0xFF, 0xD3,
+    0x00, 0x96, 0xFF, 0xD6, 0x00, 0xB2, 0xFF, 0xE0, 0x00, 0xB2, 0xFF, 0xE0,
+    0x01, 0xDC, 0x00, 0x46, 0x01, 0xDC, 0x00, 0x46, 0x01, 0xE2, 0x00, 0x46,
+    0x00, 0xCE, 0x00, 0x5C, 0x00, 0xCE, 0x00, 0x29, 0x00, 0xA6, 0x00, 0x5C,
+    0x00, 0xCE, 0x00, 0x48, 0x00, 0xC4, 0x00, 0x5C, 0x00, 0xCE, 0x00, 0x4B,
+    0x01, 0x56, 0x00, 0x5C, 0x00, 0xCE, 0xFF, 0xE0, 0x01, 0x24, 0x00, 0x0A,
+    0x03, 0x6D, 0x00, 0x41, 0x03, 0x6D, 0x00, 0x41, 0x02, 0x1D, 0x00, 0x46,
+    0x02, 0x1D, 0x00, 0x46, 0x02, 0x49, 0xFF, 0xF6, 0x02, 0x1D, 0x00, 0x46,
+    0x02, 0x1D, 0x00, 0x46, 0x02, 0x1D, 0x00, 0x46, 0x02, 0x1D, 0x00, 0x46,
+    0x02, 0x1D, 0xFF, 0xD6, 0x02, 0xB3, 0x00, 0x46, 0x02, 0x1D, 0x00, 0x46,
+    0x02, 0x1D, 0x00, 0x46, 0x02, 0x1D, 0x00, 0x46, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28, 0x02, 0x67, 0x00, 0x28,
+    0x02, 0x67, 0x00, 0x28, 0x04, 0x22, 0x00, 0x28, 0x02, 0x5A, 0x00, 0x46,
+    0x02, 0x64, 0x00, 0x46, 0x02, 0x63, 0x00, 0x28, 0x01, 0x37, 0x00, 0x46,
+    0x01, 0x37, 0x00, 0x46, 0x01, 0x37, 0x00, 0x43, 0x01, 0x37, 0x00, 0x37,
+    0x01, 0x37, 0xFF, 0xFD, 0x01, 0x37, 0x00, 0x3A, 0x01, 0x37, 0x00, 0x38,
+    0x01, 0x37, 0xFF, 0xCF, 0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D,
+    0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D,
+    0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D,
+    0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D, 0x01, 0xDF, 0x00, 0x2D,
+    0x02, 0x5E, 0x00, 0x1E, 0x01, 0x5E, 0x00, 0x14, 0x01, 0x5E, 0x00, 0x14,
+    0x01, 0x5E, 0x00, 0x14, 0x01, 0x5E, 0x00, 0x14, 0x01, 0x5E, 0x00, 0x14,
+    0x01, 0x5E, 0x00, 0x14, 0x01, 0x5E, 0x00, 0x14, 0x01, 0x5E, 0x00, 0x14,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49, 0x02, 0x1A, 0x00, 0x49,
+    0x01, 0xD3, 0x00, 0x0F, 0x02, 0xE7, 0x00, 0x0F, 0x02, 0xE7, 0x00, 0x0F,
+    0x02, 0xE7, 0x00, 0x0F, 0x02, 0xE7, 0x00, 0x0F, 0x02, 0xE7, 0x00, 0x0F,
+    0x01, 0xDB, 0x00, 0x0A, 0x01, 0xF5, 0x00, 0x0F, 0x01, 0xF5, 0x00, 0x0F,
+    0x01, 0xF5, 0x00, 0x0F, 0x01, 0xF5, 0x00, 0x0F, 0x01, 0xF5, 0x00, 0x0F,
+    0x01, 0xF5, 0x00, 0x0F, 0x01, 0xF5, 0x00, 0x0F, 0x01, 0xF5, 0x00, 0x0F,
+    0x01, 0xF5, 0x00, 0x0F, 0x01, 0xF5, 0x00, 0x0F, 0x01, 0xAD, 0x00, 0x23,
+    0x01, 0xAD, 0x00, 0x23, 0x01, 0xAD, 0x00, 0x23, 0x01, 0xAD, 0x00, 0x23,
+    0x01, 0xAD, 0x00, 0x23, 0x01, 0x54, 0x00, 0x18, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28, 0x02, 0x19, 0x00, 0x28,
+    0x02, 0x19, 0x00, 0x28, 0x02, 0x44, 0x00, 0x3B, 0x02, 0x44, 0x00, 0x3B,
+    0x02, 0x44, 0x00, 0x3B, 0x02, 0x44, 0x00, 0x3B, 0x02, 0x44, 0x00, 0x3B,
+    0x02, 0x44, 0x00, 0x3B, 0x02, 0x44, 0x00, 0x3B, 0x02, 0xA8, 0x00, 0x1E,
+    0x03, 0x6C, 0x00, 0x1E, 0x04, 0x02, 0x00, 0x1E, 0x03, 0x76, 0x00, 0x1E,
+    0x02, 0xAE, 0x00, 0x1E, 0x02, 0x18, 0x00, 0x1E, 0x02, 0x22, 0x00, 0x1E,
+    0x01, 0x6D, 0x00, 0x1E, 0x01, 0x68, 0x00, 0x28, 0x02, 0xC3, 0x00, 0x08,
+    0x02, 0xA3, 0x00, 0x19, 0x02, 0x25, 0x00, 0x49, 0x02, 0x66, 0x00, 0x28,
+    0x02, 0x6C, 0x00, 0x34, 0x01, 0x7B, 0x00, 0x27, 0x02, 0x24, 0x00, 0x38,
+    0x02, 0x11, 0x00, 0x14, 0x02, 0x6C, 0x00, 0x23, 0x02, 0x38, 0x00, 0x27,
+    0x02, 0x5D, 0x00, 0x43, 0x01, 0xD2, 0x00, 0x00, 0x02, 0x44, 0x00, 0x37,
+    0x02, 0x24, 0x00, 0x2F, 0x02, 0x6C, 0x00, 0x34, 0x01, 0x6C, 0x00, 0x1E,
+    0x01, 0x15, 0x00, 0x38, 0x01, 0x5A, 0x00, 0x48, 0x01, 0x56, 0x00, 0x42,
+    0x01, 0x86, 0x00, 0x3A, 0x01, 0x63, 0x00, 0x41, 0x01, 0x57, 0x00, 0x34,
+    0x01, 0x46, 0x00, 0x3E, 0x01, 0x61, 0x00, 0x3E, 0x01, 0x4D, 0x00, 0x30,
+    0x01, 0x6C, 0x00, 0x1E, 0x01, 0x19, 0x00, 0x38, 0x01, 0x5A, 0x00, 0x48,
+    0x01, 0x56, 0x00, 0x42, 0x01, 0x86, 0x00, 0x3A, 0x01, 0x66, 0x00, 0x41,
+    0x01, 0x57, 0x00, 0x34, 0x01, 0x46, 0x00, 0x3E, 0x01, 0x61, 0x00, 0x3E,
+    0x01, 0x4D, 0x00, 0x30, 0x01, 0x6C, 0x00, 0x1E, 0x01, 0x19, 0x00, 0x38,
+    0x01, 0x5A, 0x00, 0x48, 0x01, 0x56, 0x00, 0x42, 0x01, 0x86, 0x00, 0x3A,
+    0x01, 0x66, 0x00, 0x41, 0x01, 0x57, 0x00, 0x34, 0x01, 0x46, 0x00, 0x3E,
+    0x01, 0x61, 0x00, 0x3E, 0x01, 0x4D, 0x00, 0x30, 0x01, 0x6C, 0x00, 0x1E,
+    0x01, 0x19, 0x00, 0x38, 0x01, 0x5A, 0x00, 0x48, 0x01, 0x56, 0x00, 0x42,
+    0x01, 0x86, 0x00, 0x3A, 0x01, 0x66, 0x00, 0x41, 0x01, 0x57, 0x00, 0x34,
+    0x01, 0x46, 0x00, 0x3E, 0x01, 0x61, 0x00, 0x3E, 0x01, 0x4D, 0x00, 0x30,
+    0x02, 0x5E, 0x00, 0x34, 0x02, 0xFC, 0x00, 0x3E, 0x02, 0xEF, 0x00, 0x42,
+    0x02, 0xB6, 0x00, 0x14, 0x03, 0x31, 0x00, 0x6C, 0x02, 0xC6, 0x00, 0x14,
+    0x03, 0x0D, 0x00, 0x27, 0x03, 0x19, 0x00, 0x5E, 0x01, 0x15, 0x00, 0x00,
+    0x02, 0x26, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00,
+    0x01, 0x18, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0xCD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x54, 0x00, 0xD8, 0x00, 0x4A,
+    0x00, 0xE4, 0x00, 0x54, 0x00, 0xE2, 0x00, 0x54, 0x02, 0xAC, 0x00, 0x54,
+    0x00, 0xFE, 0x00, 0x62, 0x00, 0xFE, 0x00, 0x62, 0x01, 0xB6, 0x00, 0x00,
+    0x01, 0xB6, 0x00, 0x00, 0x00, 0xE4, 0x00, 0x54, 0x01, 0x5B, 0x00, 0x66,
+    0x01, 0x92, 0x00, 0x35, 0x02, 0xAF, 0x00, 0x29, 0x02, 0x36, 0x00, 0x4B,
+    0x02, 0x09, 0x00, 0x25, 0x00, 0xE4, 0x00, 0x54, 0x01, 0x6B, 0x00, 0x6E,
+    0x02, 0x20, 0x00, 0x4B, 0x02, 0x20, 0x00, 0x25, 0x00, 0x30, 0xFF, 0xF7,
+    0x00, 0x00, 0xFF, 0x56, 0x01, 0x8A, 0x00, 0x3C, 0x01, 0x8A, 0x00, 0x3C,
+    0x02, 0x02, 0x00, 0x35, 0x03, 0x64, 0x00, 0x35, 0x02, 0x10, 0x00, 0x3C,
+    0x03, 0x72, 0x00, 0x3C, 0x01, 0x8A, 0x00, 0x3C, 0x02, 0xB8, 0x00, 0x38,
+    0x01, 0x8A, 0x00, 0x3C, 0x02, 0x10, 0x00, 0x3C, 0x03, 0x72, 0x00, 0x3C,
+    0x01, 0x4F, 0x00, 0x3C, 0x01, 0x4F, 0x00, 0x0A, 0x01, 0x92, 0x00, 0x3F,
+    0x01, 0x92, 0x00, 0x35, 0x01, 0x3F, 0x00, 0x4B, 0x01, 0x3F, 0x00, 0x20,
+    0x01, 0x65, 0x00, 0x3C, 0x01, 0x65, 0x00, 0x0A, 0x01, 0x92, 0x00, 0x3F,
+    0x01, 0x92, 0x00, 0x35, 0x01, 0x3F, 0x00, 0x4B, 0x01, 0x3F, 0x00, 0x20,
+    0x00, 0xD8, 0x00, 0x4A, 0x01, 0x43, 0x00, 0x4A, 0x01, 0x57, 0x00, 0x50,
+    0x01, 0x51, 0x00, 0x50, 0x00, 0xEC, 0x00, 0x50, 0x00, 0xEC, 0x00, 0x50,
+    0x01, 0xC3, 0x00, 0x28, 0x01, 0xEB, 0x00, 0x2D, 0x01, 0x0C, 0x00, 0x28,
+    0x01, 0x13, 0x00, 0x2D, 0x01, 0x48, 0x00, 0x50, 0x00, 0xBB, 0x00, 0x38,
+    0x01, 0xC3, 0x00, 0x28, 0x01, 0xEB, 0x00, 0x2D, 0x01, 0x0C, 0x00, 0x28,
+    0x01, 0x13, 0x00, 0x2D, 0x02, 0x07, 0x00, 0x04, 0x03, 0xDA, 0x00, 0x37,
+    0x02, 0x90, 0x00, 0x32, 0x02, 0x3A, 0x00, 0x37, 0x02, 0x1B, 0x00, 0x4C,
+    0x03, 0x12, 0x00, 0x23, 0x02, 0x0D, 0x00, 0x1C, 0x02, 0xF5, 0x00, 0x28,
+    0x02, 0x14, 0x00, 0x6E, 0x01, 0x48, 0x00, 0x50, 0x00, 0xDF, 0x00, 0x64,
+    0x00, 0xE0, 0x00, 0x65, 0x01, 0xB6, 0x00, 0x3C, 0x02, 0x1B, 0x00, 0x2E,
+    0x01, 0xB0, 0x00, 0x3C, 0x02, 0x75, 0x00, 0x2B, 0x04, 0x96, 0x00, 0x6E,
+    0x03, 0xDA, 0x00, 0x37, 0x02, 0xB2, 0x00, 0x37, 0x02, 0x12, 0x00, 0x2C,
+    0x02, 0xB2, 0x00, 0x37, 0x02, 0x33, 0x00, 0x50, 0x02, 0x36, 0x00, 0x37,
+    0x01, 0xEB, 0x00, 0x28, 0x02, 0x86, 0x00, 0x0F, 0x02, 0x5A, 0x00, 0x10,
+    0x02, 0xFF, 0x00, 0x37, 0x02, 0x9A, 0x00, 0x32, 0x02, 0x62, 0x00, 0x3B,
+    0x02, 0x61, 0x00, 0x4E, 0x02, 0xE9, 0x00, 0x6E, 0x03, 0x16, 0x00, 0x28,
+    0x03, 0x17, 0x00, 0x5D, 0x03, 0x0F, 0x00, 0x5D, 0x02, 0xAB, 0x00, 0x5D,
+    0x02, 0x3B, 0x00, 0x50, 0x02, 0x62, 0x00, 0x3B, 0x03, 0x81, 0x00, 0x14,
+    0x02, 0x50, 0x00, 0x14, 0x00, 0xF4, 0x00, 0x5F, 0x02, 0x27, 0x00, 0x3A,
+    0x02, 0x4E, 0x00, 0x3C, 0x02, 0x5A, 0x00, 0x3C, 0x01, 0xBC, 0x00, 0x28,
+    0x02, 0x4C, 0x00, 0x38, 0x02, 0x36, 0x00, 0x41, 0x02, 0x36, 0x00, 0x41,
+    0x01, 0xD6, 0x00, 0x38, 0x01, 0xD8, 0x00, 0x30, 0x02, 0x4C, 0x00, 0x50,
+    0x02, 0x4C, 0x00, 0x4B, 0x02, 0x5E, 0x00, 0x41, 0x02, 0x23, 0x00, 0x64,
+    0x01, 0xFE, 0x00, 0x4C, 0x02, 0x9E, 0x00, 0x41, 0x02, 0x48, 0x00, 0x32,
+    0x03, 0x63, 0x00, 0x23, 0x02, 0x67, 0x00, 0x28, 0x02, 0x29, 0x00, 0x00,
+    0x02, 0xA3, 0x00, 0x19, 0x02, 0xC3, 0x00, 0x08, 0x02, 0xC4, 0x00, 0x1C,
+    0x02, 0x0B, 0x00, 0x3B, 0x02, 0xAC, 0x00, 0x2F, 0x02, 0x25, 0x00, 0x49,
+    0x02, 0x40, 0x00, 0x28, 0x03, 0x3F, 0x00, 0x28, 0x04, 0xA2, 0x00, 0x28,
+    0x02, 0x54, 0x00, 0x24, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76,
+    0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x59,
+    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x77,
+    0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x73,
+    0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0xAD,
+    0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x71,
+    0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x9E,
+    0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x73,
+    0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0xA9,
+    0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xDB,
+    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x93,
+    0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x00, 0x00, 0xA0,
+    0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x74,
+    0x01, 0xF4, 0x00, 0x93, 0x01, 0xF4, 0x00, 0xDE, 0x01, 0xF4, 0x00, 0xAD,
+    0x01, 0xF4, 0x00, 0xAD, 0x01, 0xF4, 0x00, 0x71, 0x01, 0xF4, 0x00, 0x81,
+    0x01, 0xF4, 0x00, 0x81, 0x01, 0x58, 0x00, 0x76, 0x01, 0xF4, 0x00, 0x9E,
+    0x01, 0xF4, 0x00, 0x7C, 0x01, 0xA8, 0x00, 0x73, 0x01, 0xF4, 0x00, 0xAF,
+    0x01, 0xF4, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x94,
+    0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x73,
+    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x99,
+    0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x00, 0x57,
+    0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76,
+    0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76,
+    0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x75,
+    0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x73,
+    0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72,
+    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x76,
+    0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x9B, 0x00, 0xBB, 0x00, 0x38, 0x00, 0xEC, 0x00, 0x50,
+    0x00, 0xFE, 0x00, 0x43, 0x00, 0xD4, 0x00, 0x34, 0x00, 0xDE, 0x00, 0x64,
+    0x00, 0xE7, 0x00, 0x68, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x9C, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x4D, 0x00, 0x00, 0x00, 0x24, 0x00, 0xC9, 0x01, 0x02, 0x01, 0x03,
+    0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08, 0x00, 0xC7,
+    0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E,
+    0x00, 0x62, 0x01, 0x0F, 0x00, 0xAD, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12,
+    0x01, 0x13, 0x00, 0x63, 0x01, 0x14, 0x00, 0xAE, 0x00, 0x90, 0x01, 0x15,
+    0x00, 0x25, 0x00, 0x26, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x64, 0x01, 0x16,
+    0x01, 0x17, 0x01, 0x18, 0x00, 0x27, 0x01, 0x19, 0x01, 0x1A, 0x00, 0xE9,
+    0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x20,
+    0x00, 0x28, 0x00, 0x65, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x00, 0xC8,
+    0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29,
+    0x00, 0xCA, 0x01, 0x2A, 0x01, 0x2B, 0x00, 0xCB, 0x01, 0x2C, 0x01, 0x2D,
+    0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x00, 0x29,
+    0x00, 0x2A, 0x00, 0xF8, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36,
+    0x01, 0x37, 0x00, 0x2B, 0x01, 0x38, 0x01, 0x39, 0x01, 0x3A, 0x01, 0x3B,
+    0x00, 0x2C, 0x01, 0x3C, 0x00, 0xCC, 0x01, 0x3D, 0x01, 0x3E, 0x00, 0xCD,
+    0x01, 0x3F, 0x00, 0xCE, 0x01, 0x40, 0x00, 0xFA, 0x01, 0x41, 0x00, 0xCF,
+    0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x00, 0x2D,
+    0x01, 0x47, 0x00, 0x2E, 0x01, 0x48, 0x00, 0x2F, 0x01, 0x49, 0x01, 0x4A,
+    0x01, 0x4B, 0x01, 0x4C, 0x01, 0x4D, 0x01, 0x4E, 0x01, 0x4F, 0x01, 0x50,
+    0x00, 0xE2, 0x00, 0x30, 0x01, 0x51, 0x00, 0x31, 0x01, 0x52, 0x01, 0x53,
+    0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57, 0x01, 0x58, 0x01, 0x59,
+    0x01, 0x5A, 0x00, 0x66, 0x01, 0x5B, 0x00, 0x32, 0x00, 0xD0, 0x01, 0x5C,
+    0x01, 0x5D, 0x00, 0xD1, 0x01, 0x5E, 0x01, 0x5F, 0x01, 0x60, 0x01, 0x61,
+    0x01, 0x62, 0x01, 0x63, 0x00, 0x67, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66,
+    0x00, 0xD3, 0x01, 0x67, 0x01, 0x68, 0x01, 0x69, 0x01, 0x6A, 0x01, 0x6B,
+    0x01, 0x6C, 0x01, 0x6D, 0x01, 0x6E, 0x01, 0x6F, 0x01, 0x70, 0x01, 0x71,
+    0x01, 0x72, 0x01, 0x73, 0x00, 0x91, 0x01, 0x74, 0x00, 0xAF, 0x01, 0x75,
+    0x01, 0x76, 0x01, 0x77, 0x00, 0xB0, 0x00, 0x33, 0x00, 0xED, 0x00, 0x34,
+    0x00, 0x35, 0x01, 0x78, 0x01, 0x79, 0x01, 0x7A, 0x01, 0x7B, 0x01, 0x7C,
+    0x01, 0x7D, 0x01, 0x7E, 0x00, 0x36, 0x01, 0x7F, 0x01, 0x80, 0x00, 0xE4,
+    0x01, 0x81, 0x00, 0xFB, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85,
+    0x01, 0x86, 0x01, 0x87, 0x01, 0x88, 0x00, 0x37, 0x01, 0x89, 0x01, 0x8A,
+    0x01, 0x8B, 0x01, 0x8C, 0x01, 0x8D, 0x01, 0x8E, 0x00, 0x38, 0x00, 0xD4,
+    0x01, 0x8F, 0x01, 0x90, 0x00, 0xD5, 0x01, 0x91, 0x00, 0x68, 0x01, 0x92,
+    0x00, 0xD6, 0x01, 0x93, 0x01, 0x94, 0x01, 0x95, 0x01, 0x96, 0x01, 0x97,
+    0x01, 0x98, 0x01, 0x99, 0x01, 0x9A, 0x01, 0x9B, 0x01, 0x9C, 0x01, 0x9D,
+    0x01, 0x9E, 0x01, 0x9F, 0x01, 0xA0, 0x01, 0xA1, 0x00, 0x39, 0x00, 0x3A,
+    0x01, 0xA2, 0x01, 0xA3, 0x01, 0xA4, 0x01, 0xA5, 0x00, 0x3B, 0x00, 0x3C,
+    0x00, 0xEB, 0x01, 0xA6, 0x00, 0xBB, 0x01, 0xA7, 0x01, 0xA8, 0x01, 0xA9,
+    0x01, 0xAA, 0x01, 0xAB, 0x01, 0xAC, 0x00, 0x3D, 0x01, 0xAD, 0x00, 0xE6,
+    0x01, 0xAE, 0x01, 0xAF, 0x01, 0xB0, 0x01, 0xB1, 0x01, 0xB2, 0x01, 0xB3,
+    0x01, 0xB4, 0x01, 0xB5, 0x01, 0xB6, 0x01, 0xB7, 0x01, 0xB8, 0x01, 0xB9,
+    0x01, 0xBA, 0x01, 0xBB, 0x01, 0xBC, 0x01, 0xBD, 0x01, 0xBE, 0x01, 0xBF,
+    0x01, 0xC0, 0x01, 0xC1, 0x01, 0xC2, 0x01, 0xC3, 0x01, 0xC4, 0x01, 0xC5,
+    0x00, 0x44, 0x00, 0x69, 0x01, 0xC6, 0x01, 0xC7, 0x01, 0xC8, 0x01, 0xC9,
+    0x01, 0xCA, 0x01, 0xCB, 0x01, 0xCC, 0x00, 0x6B, 0x01, 0xCD, 0x01, 0xCE,
+    0x01, 0xCF, 0x01, 0xD0, 0x01, 0xD1, 0x01, 0xD2, 0x00, 0x6C, 0x01, 0xD3,
+    0x00, 0x6A, 0x01, 0xD4, 0x01, 0xD5, 0x01, 0xD6, 0x01, 0xD7, 0x00, 0x6E,
+    0x01, 0xD8, 0x00, 0x6D, 0x00, 0xA0, 0x01, 0xD9, 0x00, 0x45, 0x00, 0x46,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x6F, 0x01, 0xDA, 0x01, 0xDB, 0x01, 0xDC,
+    0x00, 0x47, 0x00, 0xEA, 0x01, 0xDD, 0x01, 0x01, 0x01, 0xDE, 0x01, 0xDF,
+    0x01, 0xE0, 0x00, 0x48, 0x00, 0x70, 0x01, 0xE1, 0x01, 0xE2, 0x01, 0xE3,
+    0x00, 0x72, 0x01, 0xE4, 0x01, 0xE5, 0x01, 0xE6, 0x01, 0xE7, 0x01, 0xE8,
+    0x01, 0xE9, 0x00, 0x73, 0x01, 0xEA, 0x01, 0xEB, 0x00, 0x71, 0x01, 0xEC,
+    0x01, 0xED, 0x01, 0xEE, 0x01, 0xEF, 0x01, 0xF0, 0x01, 0xF1, 0x01, 0xF2,
+    0x01, 0xF3, 0x00, 0x49, 0x00, 0x4A, 0x00, 0xF9, 0x01, 0xF4, 0x01, 0xF5,
+    0x01, 0xF6, 0x01, 0xF7, 0x01, 0xF8, 0x00, 0x4B, 0x01, 0xF9, 0x01, 0xFA,
+    0x01, 0xFB, 0x01, 0xFC, 0x00, 0x4C, 0x00, 0xD7, 0x00, 0x74, 0x01, 0xFD,
+    0x01, 0xFE, 0x00, 0x76, 0x01, 0xFF, 0x00, 0x77, 0x02, 0x00, 0x02, 0x01,
+    0x02, 0x02, 0x00, 0x75, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+    0x02, 0x07, 0x02, 0x08, 0x00, 0x4D, 0x02, 0x09, 0x02, 0x0A, 0x00, 0x4E,
+    0x02, 0x0B, 0x02, 0x0C, 0x00, 0x4F, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F,
+    0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x00, 0xE3, 0x00, 0x50,
+    0x02, 0x14, 0x00, 0x51, 0x02, 0x15, 0x02, 0x16, 0x02, 0x17, 0x02, 0x18,
+    0x02, 0x19, 0x02, 0x1A, 0x02, 0x1B, 0x02, 0x1C, 0x02, 0x1D, 0x00, 0x78,
+    0x02, 0x1E, 0x00, 0x52, 0x00, 0x79, 0x02, 0x1F, 0x02, 0x20, 0x00, 0x7B,
+    0x02, 0x21, 0x02, 0x22, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26,
+    0x00, 0x7C, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x00, 0x7A, 0x02, 0x2A,
+    0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x02, 0x30,
+    0x02, 0x31, 0x02, 0x32, 0x02, 0x33, 0x02, 0x34, 0x02, 0x35, 0x02, 0x36,
+    0x00, 0xA1, 0x02, 0x37, 0x00, 0x7D, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A,
+    0x00, 0xB1, 0x00, 0x53, 0x00, 0xEE, 0x00, 0x54, 0x00, 0x55, 0x02, 0x3B,
+    0x02, 0x3C, 0x02, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x02, 0x41,
+    0x00, 0x56, 0x02, 0x42, 0x02, 0x43, 0x00, 0xE5, 0x02, 0x44, 0x00, 0xFC,
+    0x02, 0x45, 0x02, 0x46, 0x02, 0x47, 0x02, 0x48, 0x02, 0x49, 0x00, 0x89,
+    0x00, 0x57, 0x02, 0x4A, 0x02, 0x4B, 0x02, 0x4C, 0x02, 0x4D, 0x02, 0x4E,
+    0x02, 0x4F, 0x02, 0x50, 0x00, 0x58, 0x00, 0x7E, 0x02, 0x51, 0x02, 0x52,
+    0x00, 0x80, 0x02, 0x53, 0x00, 0x81, 0x02, 0x54, 0x00, 0x7F, 0x02, 0x55,
+    0x02, 0x56, 0x02, 0x57, 0x02, 0x58, 0x02, 0x59, 0x02, 0x5A, 0x02, 0x5B,
+    0x02, 0x5C, 0x02, 0x5D, 0x02, 0x5E, 0x02, 0x5F, 0x02, 0x60, 0x02, 0x61,
+    0x02, 0x62, 0x02, 0x63, 0x00, 0x59, 0x00, 0x5A, 0x02, 0x64, 0x02, 0x65,
+    0x02, 0x66, 0x02, 0x67, 0x00, 0x5B, 0x00, 0x5C, 0x00, 0xEC, 0x02, 0x68,
+    0x00, 0xBA, 0x02, 0x69, 0x02, 0x6A, 0x02, 0x6B, 0x02, 0x6C, 0x02, 0x6D,
+    0x02, 0x6E, 0x00, 0x5D, 0x02, 0x6F, 0x00, 0xE7, 0x02, 0x70, 0x02, 0x71,
+    0x02, 0x72, 0x02, 0x73, 0x02, 0x74, 0x02, 0x75, 0x02, 0x76, 0x02, 0x77,
+    0x02, 0x78, 0x02, 0x79, 0x02, 0x7A, 0x02, 0x7B, 0x02, 0x7C, 0x02, 0x7D,
+    0x02, 0x7E, 0x02, 0x7F, 0x02, 0x80, 0x02, 0x81, 0x02, 0x82, 0x02, 0x83,
+    0x02, 0x84, 0x02, 0x85, 0x02, 0x86, 0x02, 0x87, 0x02, 0x88, 0x02, 0x89,
+    0x02, 0x8A, 0x02, 0x8B, 0x02, 0x8C, 0x02, 0x8D, 0x02, 0x8E, 0x02, 0x8F,
+    0x02, 0x90, 0x02, 0x91, 0x02, 0x92, 0x02, 0x93, 0x02, 0x94, 0x02, 0x95,
+    0x02, 0x96, 0x02, 0x97, 0x02, 0x98, 0x00, 0xC0, 0x00, 0xC1, 0x00, 0x9D,
+    0x00, 0x9E, 0x02, 0x99, 0x02, 0x9A, 0x02, 0x9B, 0x00, 0x9B, 0x00, 0x13,
+    0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
+    0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x02, 0x9C, 0x02, 0x9D, 0x02, 0x9E,
+    0x02, 0x9F, 0x02, 0xA0, 0x02, 0xA1, 0x02, 0xA2, 0x02, 0xA3, 0x02, 0xA4,
+    0x02, 0xA5, 0x02, 0xA6, 0x02, 0xA7, 0x02, 0xA8, 0x02, 0xA9, 0x02, 0xAA,
+    0x02, 0xAB, 0x02, 0xAC, 0x02, 0xAD, 0x02, 0xAE, 0x02, 0xAF, 0x02, 0xB0,
+    0x02, 0xB1, 0x02, 0xB2, 0x02, 0xB3, 0x02, 0xB4, 0x02, 0xB5, 0x02, 0xB6,
+    0x02, 0xB7, 0x02, 0xB8, 0x02, 0xB9, 0x02, 0xBA, 0x02, 0xBB, 0x02, 0xBC,
+    0x02, 0xBD, 0x02, 0xBE, 0x02, 0xBF, 0x02, 0xC0, 0x02, 0xC1, 0x02, 0xC2,
+    0x02, 0xC3, 0x02, 0xC4, 0x00, 0xBC, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xF6,
+    0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA,
+    0x02, 0xCB, 0x02, 0xCC, 0x00, 0x03, 0x02, 0xCD, 0x02, 0xCE, 0x02, 0xCF,
+    0x00, 0x11, 0x00, 0x0F, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0xAB, 0x00, 0x04,
+    0x00, 0xA3, 0x00, 0x22, 0x00, 0xA2, 0x00, 0xC3, 0x00, 0x87, 0x00, 0x0D,
+    0x00, 0x06, 0x00, 0x12, 0x00, 0x3F, 0x02, 0xD0, 0x02, 0xD1, 0x02, 0xD2,
+    0x02, 0xD3, 0x02, 0xD4, 0x02, 0xD5, 0x00, 0x10, 0x02, 0xD6, 0x00, 0xB2,
+    0x00, 0xB3, 0x02, 0xD7, 0x02, 0xD8, 0x02, 0xD9, 0x00, 0x42, 0x02, 0xDA,
+    0x02, 0xDB, 0x02, 0xDC, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x5E, 0x00, 0x60,
+    0x00, 0x3E, 0x00, 0x40, 0x02, 0xDD, 0x02, 0xDE, 0x02, 0xDF, 0x02, 0xE0,
+    0x02, 0xE1, 0x02, 0xE2, 0x00, 0xC4, 0x00, 0xC5, 0x00, 0xB4, 0x00, 0xB5,
+    0x00, 0xB6, 0x00, 0xB7, 0x00, 0xA9, 0x00, 0xAA, 0x00, 0xBE, 0x00, 0xBF,
+    0x00, 0x05, 0x00, 0x0A, 0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6,
+    0x00, 0xA6, 0x00, 0x23, 0x00, 0x09, 0x00, 0x88, 0x00, 0x86, 0x00, 0x8B,
+    0x00, 0x8A, 0x00, 0x8C, 0x00, 0x83, 0x02, 0xE7, 0x00, 0x5F, 0x00, 0xE8,
+    0x00, 0x82, 0x02, 0xE8, 0x00, 0xC2, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB,
+    0x02, 0xEC, 0x00, 0x84, 0x02, 0xED, 0x00, 0xBD, 0x00, 0x07, 0x02, 0xEE,
+    0x02, 0xEF, 0x00, 0xF7, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3,
+    0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x00, 0x85, 0x02, 0xFA, 0x00, 0x96, 0x02, 0xFB, 0x02, 0xFC, 0x00, 0x0E,
+    0x00, 0xEF, 0x00, 0xF0, 0x00, 0xB8, 0x00, 0x20, 0x00, 0x8F, 0x00, 0x21,
+    0x00, 0x1F, 0x00, 0x95, 0x00, 0x94, 0x00, 0x93, 0x00, 0xA7, 0x00, 0x61,
+    0x00, 0xA4, 0x00, 0x41, 0x00, 0x92, 0x02, 0xFD, 0x00, 0x9C, 0x02, 0xFE,
+    0x02, 0xFF, 0x00, 0x9A, 0x00, 0x99, 0x00, 0xA5, 0x03, 0x00, 0x00, 0x98,
+    0x00, 0x08, 0x00, 0xC6, 0x00, 0xB9, 0x03, 0x01, 0x03, 0x02, 0x03, 0x03,
+    0x03, 0x04, 0x03, 0x05, 0x03, 0x06, 0x03, 0x07, 0x03, 0x08, 0x03, 0x09,
+    0x03, 0x0A, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x03, 0x0F,
+    0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x14, 0x03, 0x15,
+    0x03, 0x16, 0x03, 0x17, 0x03, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x03, 0x1B,
+    0x03, 0x1C, 0x03, 0x1D, 0x03, 0x1E, 0x03, 0x1F, 0x03, 0x20, 0x03, 0x21,
+    0x03, 0x22, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x00, 0x8E,
+    0x00, 0xDC, 0x00, 0x43, 0x00, 0x8D, 0x00, 0xDF, 0x00, 0xD8, 0x00, 0xE1,
+    0x00, 0xDB, 0x00, 0xDD, 0x00, 0xD9, 0x00, 0xDA, 0x00, 0xDE, 0x00, 0xE0,
+    0x03, 0x2D, 0x03, 0x2E, 0x03, 0x2F, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32,
+    0x03, 0x33, 0x03, 0x34, 0x03, 0x35, 0x03, 0x36, 0x03, 0x37, 0x03, 0x38,
+    0x03, 0x39, 0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x03, 0x3E,
+    0x03, 0x3F, 0x03, 0x40, 0x03, 0x41, 0x03, 0x42, 0x03, 0x43, 0x03, 0x44,
+    0x03, 0x45, 0x03, 0x46, 0x03, 0x47, 0x03, 0x48, 0x03, 0x49, 0x03, 0x4A,
+    0x03, 0x4B, 0x03, 0x4C, 0x03, 0x4D, 0x03, 0x4E, 0x03, 0x4F, 0x03, 0x50,
+    0x03, 0x51, 0x03, 0x52, 0x03, 0x53, 0x03, 0x54, 0x03, 0x55, 0x03, 0x56,
+    0x06, 0x41, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x36, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x34, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x43, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x41, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x32, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x32, 0x07, 0x41, 0x6D, 0x61, 0x63,
+    0x72, 0x6F, 0x6E, 0x07, 0x41, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x0A,
+    0x41, 0x72, 0x69, 0x6E, 0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x41,
+    0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x30, 0x38, 0x0B, 0x43, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C,
+    0x65, 0x78, 0x0A, 0x43, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E,
+    0x74, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x46, 0x31, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x43, 0x34, 0x06, 0x44, 0x63, 0x61, 0x72, 0x6F, 0x6E,
+    0x06, 0x44, 0x63, 0x72, 0x6F, 0x61, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x30, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x46, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x35, 0x06, 0x45, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06, 0x45,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31,
+    0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x32, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x34, 0x0A, 0x45, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x38, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x36,
+    0x07, 0x45, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x31, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31, 0x34,
+    0x07, 0x45, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x43, 0x06, 0x47, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x0B,
+    0x47, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x32, 0x32, 0x0A, 0x47, 0x64, 0x6F, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x32, 0x30, 0x04, 0x48, 0x62, 0x61, 0x72, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x32, 0x41, 0x0B, 0x48, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66,
+    0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x34, 0x02,
+    0x49, 0x4A, 0x06, 0x49, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x43, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43,
+    0x38, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x41, 0x07, 0x49, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x49, 0x6F, 0x67, 0x6F, 0x6E, 0x65,
+    0x6B, 0x06, 0x49, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x0B, 0x4A, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x33, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x37,
+    0x06, 0x4C, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06, 0x4C, 0x63, 0x61, 0x72,
+    0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x33, 0x42, 0x04, 0x4C,
+    0x64, 0x6F, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x36, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x33, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x32, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x41, 0x06, 0x4E, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x06, 0x4E, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x34, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34,
+    0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x36, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x39, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43,
+    0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x38, 0x03, 0x45, 0x6E,
+    0x67, 0x06, 0x4F, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x44, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x30,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x38, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x36, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x30, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x41,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x30, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x43, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x45,
+    0x05, 0x4F, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x44, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x30, 0x0D, 0x4F,
+    0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x45, 0x07, 0x4F, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x32,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x30, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x45, 0x41, 0x0B, 0x4F, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x43,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x45, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x32, 0x43, 0x06, 0x52, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x52, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x35, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x30, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x35, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x31, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x45, 0x06, 0x53,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x36, 0x0B, 0x53, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x31, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x32, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x39,
+    0x45, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x38, 0x46, 0x04, 0x54, 0x62,
+    0x61, 0x72, 0x06, 0x54, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x36, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31,
+    0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x43, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x45, 0x06, 0x55, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x33, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x31, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x36, 0x05, 0x55, 0x68, 0x6F,
+    0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x38, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x46, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x41, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x43, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x45, 0x0D, 0x55, 0x68, 0x75, 0x6E, 0x67,
+    0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x31, 0x36, 0x07, 0x55, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37, 0x41, 0x07, 0x55, 0x6F, 0x67,
+    0x6F, 0x6E, 0x65, 0x6B, 0x05, 0x55, 0x72, 0x69, 0x6E, 0x67, 0x06, 0x55,
+    0x74, 0x69, 0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37,
+    0x38, 0x06, 0x57, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0B, 0x57, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x09, 0x57, 0x64, 0x69,
+    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x57, 0x67, 0x72, 0x61, 0x76,
+    0x65, 0x0B, 0x59, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65,
+    0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x38, 0x45, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x46, 0x34, 0x06, 0x59, 0x67, 0x72, 0x61, 0x76, 0x65,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x36, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x33, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x38,
+    0x06, 0x5A, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0A, 0x5A, 0x64, 0x6F, 0x74,
+    0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x39, 0x32, 0x10, 0x49, 0x61, 0x63, 0x75, 0x74, 0x65, 0x5F, 0x4A, 0x2E,
+    0x6C, 0x6F, 0x63, 0x6C, 0x4E, 0x4C, 0x44, 0x06, 0x49, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x07, 0x49, 0x4A, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49,
+    0x62, 0x72, 0x65, 0x76, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x43, 0x46, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x10,
+    0x49, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x38,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0E, 0x49, 0x64, 0x69, 0x65, 0x72, 0x65,
+    0x73, 0x69, 0x73, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x32, 0x45, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F, 0x49, 0x64,
+    0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x41, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0B, 0x49, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x38, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x41, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x49, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x49, 0x6F, 0x67, 0x6F, 0x6E, 0x65,
+    0x6B, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x49, 0x74, 0x69, 0x6C, 0x64,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x4A, 0x2E, 0x73, 0x73, 0x30,
+    0x31, 0x10, 0x4A, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65,
+    0x78, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x43, 0x37, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x41, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x61, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x46, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x33, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x35, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x39, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x31, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x30, 0x33, 0x07, 0x61, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07,
+    0x61, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x0A, 0x61, 0x72, 0x69, 0x6E,
+    0x67, 0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x61, 0x65, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x39, 0x0B, 0x63,
+    0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x0A, 0x63,
+    0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x06, 0x64, 0x63,
+    0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x44,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x30, 0x46, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x43, 0x36, 0x06, 0x65, 0x62, 0x72, 0x65, 0x76, 0x65, 0x06,
+    0x65, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x31, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x46, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x43, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x43, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x33, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x43, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x30, 0x35, 0x0A, 0x65, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E,
+    0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x42, 0x39, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x37, 0x07, 0x65, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x31, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x31,
+    0x35, 0x07, 0x65, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x35,
+    0x39, 0x06, 0x67, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x0B, 0x67, 0x63, 0x69,
+    0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x32, 0x33, 0x0A, 0x67, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63,
+    0x65, 0x6E, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x31, 0x04,
+    0x68, 0x62, 0x61, 0x72, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x42,
+    0x0B, 0x68, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x35, 0x06, 0x69, 0x62, 0x72,
+    0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x30, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x32, 0x46, 0x09, 0x69, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x54, 0x52,
+    0x4B, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x42, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x43, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30,
+    0x42, 0x02, 0x69, 0x6A, 0x07, 0x69, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x6E,
+    0x07, 0x69, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x06, 0x69, 0x74, 0x69,
+    0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x37, 0x0B,
+    0x6A, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x33, 0x37, 0x0C, 0x6B, 0x67, 0x72, 0x65,
+    0x65, 0x6E, 0x6C, 0x61, 0x6E, 0x64, 0x69, 0x63, 0x06, 0x6C, 0x61, 0x63,
+    0x75, 0x74, 0x65, 0x06, 0x6C, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x33, 0x43, 0x04, 0x6C, 0x64, 0x6F, 0x74, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x31, 0x43, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x33, 0x42, 0x07,
+    0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x33, 0x06, 0x6E, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x0B, 0x6E, 0x61, 0x70, 0x6F, 0x73, 0x74, 0x72, 0x6F, 0x70,
+    0x68, 0x65, 0x06, 0x6E, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x31, 0x34, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x37, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x37, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x43,
+    0x43, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x39, 0x03, 0x65, 0x6E,
+    0x67, 0x06, 0x6F, 0x62, 0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x44, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x31,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x39, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x44, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x35,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x44, 0x37, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x30, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x32, 0x42,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x31, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x43, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x43, 0x46,
+    0x05, 0x6F, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x33, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x44, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x44, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x31, 0x0D, 0x6F,
+    0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x46, 0x07, 0x6F, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x33,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x31, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x31, 0x45, 0x42, 0x0B, 0x6F, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x61,
+    0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x44,
+    0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x34, 0x46, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x32, 0x32, 0x44, 0x06, 0x72, 0x61, 0x63, 0x75, 0x74, 0x65, 0x06,
+    0x72, 0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31,
+    0x35, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x31, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x35, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32,
+    0x31, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x35, 0x46, 0x06, 0x73,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x37, 0x0B, 0x73, 0x63,
+    0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x32, 0x31, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x31, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x33, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x36, 0x39, 0x04, 0x74, 0x62, 0x61, 0x72, 0x06, 0x74,
+    0x63, 0x61, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x36,
+    0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x42, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x39, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36,
+    0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x36, 0x46, 0x06, 0x75, 0x62,
+    0x72, 0x65, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x31, 0x44, 0x34,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x35, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x45, 0x35, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x37,
+    0x05, 0x75, 0x68, 0x6F, 0x72, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x31, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x45, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x45, 0x44, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x45, 0x46, 0x0D, 0x75,
+    0x68, 0x75, 0x6E, 0x67, 0x61, 0x72, 0x75, 0x6D, 0x6C, 0x61, 0x75, 0x74,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x31, 0x37, 0x07, 0x75, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x6E, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x37, 0x42,
+    0x07, 0x75, 0x6F, 0x67, 0x6F, 0x6E, 0x65, 0x6B, 0x05, 0x75, 0x72, 0x69,
+    0x6E, 0x67, 0x06, 0x75, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x07, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x37, 0x39, 0x06, 0x77, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x0B, 0x77, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78,
+    0x09, 0x77, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x06, 0x77,
+    0x67, 0x72, 0x61, 0x76, 0x65, 0x0B, 0x79, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6D, 0x66, 0x6C, 0x65, 0x78, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x38,
+    0x46, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x35, 0x06, 0x79, 0x67,
+    0x72, 0x61, 0x76, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x46, 0x37,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x33, 0x33, 0x07, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x46, 0x39, 0x06, 0x7A, 0x61, 0x63, 0x75, 0x74, 0x65, 0x0A,
+    0x7A, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x07, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x39, 0x33, 0x10, 0x69, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x5F, 0x6A, 0x2E, 0x6C, 0x6F, 0x63, 0x6C, 0x4E, 0x4C, 0x44, 0x06,
+    0x61, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61, 0x61, 0x63, 0x75, 0x74,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61, 0x62, 0x72, 0x65, 0x76,
+    0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x41, 0x46, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x42, 0x37, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x42, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x42, 0x33, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x31, 0x45, 0x42, 0x35, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x31, 0x43, 0x45, 0x2E, 0x73, 0x73, 0x30, 0x31,
+    0x10, 0x61, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6D, 0x66, 0x6C, 0x65, 0x78,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41,
+    0x35, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45,
+    0x41, 0x44, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31,
+    0x45, 0x41, 0x37, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69,
+    0x31, 0x45, 0x41, 0x39, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E,
+    0x69, 0x31, 0x45, 0x41, 0x42, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x32, 0x30, 0x31, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0E,
+    0x61, 0x64, 0x69, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2E, 0x73, 0x73,
+    0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x31, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0B, 0x61, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x41, 0x33, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x30, 0x33,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x61, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+    0x6E, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x61, 0x6F, 0x67, 0x6F, 0x6E,
+    0x65, 0x6B, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0A, 0x61, 0x72, 0x69, 0x6E,
+    0x67, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F, 0x61, 0x72, 0x69, 0x6E, 0x67,
+    0x61, 0x63, 0x75, 0x74, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x61,
+    0x74, 0x69, 0x6C, 0x64, 0x65, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x06, 0x67,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x67, 0x62, 0x72, 0x65, 0x76, 0x65,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x0B, 0x67, 0x63, 0x61, 0x72, 0x6F, 0x6E,
+    0x2E, 0x73, 0x73, 0x30, 0x31, 0x10, 0x67, 0x63, 0x69, 0x72, 0x63, 0x75,
+    0x6D, 0x66, 0x6C, 0x65, 0x78, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x31, 0x32, 0x33, 0x2E, 0x73, 0x73, 0x30, 0x31, 0x0F,
+    0x67, 0x64, 0x6F, 0x74, 0x61, 0x63, 0x63, 0x65, 0x6E, 0x74, 0x2E, 0x73,
+    0x73, 0x30, 0x31, 0x0C, 0x75, 0x6E, 0x69, 0x31, 0x45, 0x32, 0x31, 0x2E,
+    0x73, 0x73, 0x30, 0x31, 0x03, 0x66, 0x5F, 0x66, 0x05, 0x66, 0x5F, 0x66,
+    0x5F, 0x69, 0x06, 0x66, 0x5F, 0x66, 0x5F, 0x69, 0x6A, 0x05, 0x66, 0x5F,
+    0x66, 0x5F, 0x6C, 0x04, 0x66, 0x5F, 0x69, 0x6A, 0x07, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x39, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x41, 0x39,
+    0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x42, 0x43, 0x09, 0x7A, 0x65, 0x72,
+    0x6F, 0x2E, 0x7A, 0x65, 0x72, 0x6F, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E,
+    0x64, 0x6E, 0x6F, 0x6D, 0x08, 0x6F, 0x6E, 0x65, 0x2E, 0x64, 0x6E, 0x6F,
+    0x6D, 0x08, 0x74, 0x77, 0x6F, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x0A, 0x74,
+    0x68, 0x72, 0x65, 0x65, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x09, 0x66, 0x6F,
+    0x75, 0x72, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x09, 0x66, 0x69, 0x76, 0x65,
+    0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x08, 0x73, 0x69, 0x78, 0x2E, 0x64, 0x6E,
+    0x6F, 0x6D, 0x0A, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0x64, 0x6E, 0x6F,
+    0x6D, 0x0A, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x64, 0x6E, 0x6F, 0x6D,
+    0x09, 0x6E, 0x69, 0x6E, 0x65, 0x2E, 0x64, 0x6E, 0x6F, 0x6D, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x35, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x38, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x38, 0x38, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x38, 0x39, 0x09, 0x7A, 0x65, 0x72, 0x6F, 0x2E,
+    0x6E, 0x75, 0x6D, 0x72, 0x08, 0x6F, 0x6E, 0x65, 0x2E, 0x6E, 0x75, 0x6D,
+    0x72, 0x08, 0x74, 0x77, 0x6F, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x0A, 0x74,
+    0x68, 0x72, 0x65, 0x65, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x09, 0x66, 0x6F,
+    0x75, 0x72, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x09, 0x66, 0x69, 0x76, 0x65,
+    0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x08, 0x73, 0x69, 0x78, 0x2E, 0x6E, 0x75,
+    0x6D, 0x72, 0x0A, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x2E, 0x6E, 0x75, 0x6D,
+    0x72, 0x0A, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x6E, 0x75, 0x6D, 0x72,
+    0x09, 0x6E, 0x69, 0x6E, 0x65, 0x2E, 0x6E, 0x75, 0x6D, 0x72, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30,
+    0x42, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x30, 0x42, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x42, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x37, 0x35, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x37, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x37, 0x38, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x37, 0x39, 0x09, 0x6F, 0x6E, 0x65, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x68, 0x0C, 0x74, 0x68, 0x72, 0x65, 0x65, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x68, 0x73, 0x0B, 0x66, 0x69, 0x76, 0x65, 0x65, 0x69,
+    0x67, 0x68, 0x74, 0x68, 0x73, 0x0C, 0x73, 0x65, 0x76, 0x65, 0x6E, 0x65,
+    0x69, 0x67, 0x68, 0x74, 0x68, 0x73, 0x02, 0x43, 0x52, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30,
+    0x41, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30, 0x38, 0x07, 0x75, 0x6E,
+    0x69, 0x30, 0x30, 0x41, 0x30, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x30, 0x42, 0x13, 0x70, 0x65,
+    0x72, 0x69, 0x6F, 0x64, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x62, 0x75, 0x6C, 0x6C, 0x65, 0x74,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x0A, 0x73, 0x6C, 0x61, 0x73, 0x68, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x0E, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x6C, 0x61,
+    0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x16, 0x70, 0x65, 0x72, 0x69,
+    0x6F, 0x64, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x6C,
+    0x6F, 0x63, 0x6C, 0x43, 0x41, 0x54, 0x1B, 0x70, 0x65, 0x72, 0x69, 0x6F,
+    0x64, 0x63, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x6C, 0x6F,
+    0x63, 0x6C, 0x43, 0x41, 0x54, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x41, 0x44, 0x0A, 0x66, 0x69, 0x67, 0x75, 0x72,
+    0x65, 0x64, 0x61, 0x73, 0x68, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x31,
+    0x35, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x31, 0x30, 0x0B, 0x68, 0x79,
+    0x70, 0x68, 0x65, 0x6E, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x65, 0x6E,
+    0x64, 0x61, 0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0B, 0x65, 0x6D,
+    0x64, 0x61, 0x73, 0x68, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x6C, 0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0F, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x0E, 0x62, 0x72, 0x61, 0x63, 0x65, 0x6C, 0x65,
+    0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0F, 0x62, 0x72, 0x61, 0x63,
+    0x65, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x6C, 0x65, 0x66, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x11, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74,
+    0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x12, 0x67,
+    0x75, 0x69, 0x6C, 0x6C, 0x65, 0x6D, 0x6F, 0x74, 0x6C, 0x65, 0x66, 0x74,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x13, 0x67, 0x75, 0x69, 0x6C, 0x6C, 0x65,
+    0x6D, 0x6F, 0x74, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x12, 0x67, 0x75, 0x69, 0x6C, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x6C,
+    0x65, 0x66, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x13, 0x67, 0x75, 0x69,
+    0x6C, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x06, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x07,
+    0x75, 0x6E, 0x69, 0x32, 0x31, 0x31, 0x33, 0x09, 0x65, 0x73, 0x74, 0x69,
+    0x6D, 0x61, 0x74, 0x65, 0x64, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x31, 0x31,
+    0x36, 0x07, 0x61, 0x74, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x42, 0x35, 0x0D, 0x63, 0x6F, 0x6C, 0x6F, 0x6E, 0x6D,
+    0x6F, 0x6E, 0x65, 0x74, 0x61, 0x72, 0x79, 0x04, 0x64, 0x6F, 0x6E, 0x67,
+    0x04, 0x45, 0x75, 0x72, 0x6F, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42,
+    0x32, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x41, 0x44, 0x04, 0x6C, 0x69,
+    0x72, 0x61, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42, 0x41, 0x07, 0x75,
+    0x6E, 0x69, 0x32, 0x30, 0x42, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30,
+    0x41, 0x36, 0x06, 0x70, 0x65, 0x73, 0x65, 0x74, 0x61, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x42, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42,
+    0x44, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x30, 0x42, 0x39, 0x07, 0x75, 0x6E,
+    0x69, 0x32, 0x30, 0x41, 0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x31,
+    0x39, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x31, 0x35, 0x08, 0x65, 0x6D,
+    0x70, 0x74, 0x79, 0x73, 0x65, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x31,
+    0x32, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x32, 0x32, 0x30, 0x36, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x30, 0x42, 0x35, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x39, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x30, 0x33, 0x30, 0x33, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x30, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x39, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x33, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x38, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33,
+    0x30, 0x31, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33,
+    0x30, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x0B, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x37, 0x30, 0x33, 0x30, 0x34, 0x09, 0x67,
+    0x72, 0x61, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x09, 0x61, 0x63, 0x75,
+    0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x31, 0x30, 0x33, 0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x42, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x43, 0x2E, 0x61,
+    0x6C, 0x74, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x43, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x43, 0x30, 0x33, 0x30, 0x37, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x41, 0x09, 0x74,
+    0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x38, 0x13, 0x74, 0x69, 0x6C,
+    0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x5F, 0x61, 0x63, 0x75, 0x74, 0x65,
+    0x63, 0x6F, 0x6D, 0x62, 0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33,
+    0x30, 0x33, 0x30, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x38,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x30,
+    0x0B, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x31,
+    0x0D, 0x68, 0x6F, 0x6F, 0x6B, 0x61, 0x62, 0x6F, 0x76, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x46, 0x07, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x31, 0x31, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x31, 0x32, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x31, 0x42, 0x0C, 0x64,
+    0x6F, 0x74, 0x62, 0x65, 0x6C, 0x6F, 0x77, 0x63, 0x6F, 0x6D, 0x62, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x34, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x32, 0x36, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x37, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x38, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x32, 0x45, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x33, 0x31, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x33, 0x35, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x38, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69,
+    0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x38, 0x30, 0x33, 0x30,
+    0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x37, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x37, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0E, 0x67, 0x72, 0x61, 0x76, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x0E, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D,
+    0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x31, 0x30, 0x33, 0x30, 0x37, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x42, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30,
+    0x30, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33,
+    0x30, 0x32, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32, 0x30, 0x33, 0x30, 0x33, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x32,
+    0x30, 0x33, 0x30, 0x39, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x43, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x30, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36,
+    0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33, 0x30, 0x33, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x36, 0x30, 0x33,
+    0x30, 0x39, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30,
+    0x33, 0x30, 0x41, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0E, 0x74, 0x69, 0x6C,
+    0x64, 0x65, 0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x33, 0x30, 0x33, 0x30, 0x38, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x18, 0x74, 0x69, 0x6C, 0x64, 0x65, 0x63, 0x6F,
+    0x6D, 0x62, 0x5F, 0x61, 0x63, 0x75, 0x74, 0x65, 0x63, 0x6F, 0x6D, 0x62,
+    0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30,
+    0x33, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x38, 0x2E,
+    0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x30, 0x34,
+    0x30, 0x33, 0x30, 0x30, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x10, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x34, 0x30, 0x33, 0x30, 0x31, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x12, 0x68, 0x6F, 0x6F, 0x6B, 0x61, 0x62, 0x6F, 0x76, 0x65,
+    0x63, 0x6F, 0x6D, 0x62, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75, 0x6E,
+    0x69, 0x30, 0x33, 0x30, 0x46, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C, 0x75,
+    0x6E, 0x69, 0x30, 0x33, 0x31, 0x31, 0x2E, 0x63, 0x61, 0x73, 0x65, 0x0C,
+    0x75, 0x6E, 0x69, 0x30, 0x33, 0x31, 0x42, 0x2E, 0x63, 0x61, 0x73, 0x65,
+    0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x36, 0x2E, 0x63, 0x61, 0x73,
+    0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x37, 0x2E, 0x63, 0x61,
+    0x73, 0x65, 0x0C, 0x75, 0x6E, 0x69, 0x30, 0x33, 0x32, 0x38, 0x2E, 0x63,
+    0x61, 0x73, 0x65, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x43, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x42, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x42, 0x46, 0x07, 0x75, 0x6E, 0x69, 0x30, 0x32, 0x42, 0x45, 0x07,
+    0x75, 0x6E, 0x69, 0x30, 0x32, 0x43, 0x43, 0x07, 0x75, 0x6E, 0x69, 0x30,
+    0x32, 0x43, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x28,
+    0x00, 0x54, 0x00, 0x02, 0x44, 0x46, 0x4C, 0x54, 0x00, 0x0E, 0x6C, 0x61,
+    0x74, 0x6E, 0x00, 0x0E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x6B, 0x65,
+    0x72, 0x6E, 0x00, 0x26, 0x6D, 0x61, 0x72, 0x6B, 0x00, 0x1E, 0x6D, 0x6B,
+    0x6D, 0x6B, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x04,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x24, 0x84, 0x05, 0x1E, 0x02, 0xF8,
+    0x02, 0x88, 0x00, 0x48, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01,
+    0x00, 0x0A, 0x00, 0x02, 0x00, 0x01, 0x00, 0x28, 0x00, 0x28, 0x00, 0x01,
+    0x00, 0x1E, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x01,
+    0x01, 0x4E, 0x02, 0x70, 0x00, 0x01, 0x01, 0x49, 0x02, 0x70, 0x00, 0x02,
+    0x00, 0x00, 0x23, 0xFC, 0x00, 0x00, 0x23, 0xA2, 0x00, 0x01, 0x00, 0x02,
+    0x03, 0x0D, 0x03, 0x43, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0A,
+    0x00, 0x01, 0x00, 0x01, 0x02, 0x20, 0x02, 0x20, 0x00, 0x01, 0x01, 0x16,
+    0x00, 0x0C, 0x00, 0x42, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x04,
+    0x00, 0xFE, 0x1A, 0xE8, 0x00, 0xF8, 0x01, 0x04, 0x00, 0xF2, 0x01, 0x04,
+    0x00, 0xEC, 0x00, 0xF2, 0x00, 0xEC, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xE6,
+    0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x01, 0x04, 0x00, 0xF2, 0x00, 0xE0,
+    0x00, 0xF2, 0x00, 0xDA, 0x00, 0xF2, 0x00, 0xEC, 0x00, 0xF2, 0x00, 0xD4,
+    0x00, 0xCE, 0x00, 0xCE, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xF2, 0x23, 0xB6,
+    0x00, 0xC8, 0x00, 0xC2, 0x00, 0xBC, 0x00, 0xC8, 0x00, 0xBC, 0x00, 0xB6,
+    0x00, 0xB6, 0x00, 0xB0, 0x00, 0xB6, 0x00, 0xC8, 0x00, 0xAA, 0x00, 0xA4,
+    0x00, 0xC8, 0x00, 0x9E, 0x00, 0xC8, 0x00, 0xC8, 0x00, 0xC8, 0x00, 0xC8,
+    0x00, 0xC8, 0x00, 0xC8, 0x00, 0x98, 0x00, 0xB6, 0x00, 0xBC, 0x00, 0x92,
+    0x00, 0xBC, 0x00, 0xC8, 0x00, 0xBC, 0x00, 0x8C, 0x00, 0x92, 0x00, 0xC8,
+    0x00, 0x86, 0x00, 0xC8, 0x00, 0x01, 0x00, 0xF9, 0x03, 0x34, 0x00, 0x01,
+    0x00, 0xE6, 0x03, 0xAC, 0x00, 0x01, 0x01, 0x0E, 0x03, 0xAC, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0x43, 0x00, 0x01, 0x00, 0xD0, 0x03, 0x34, 0x00, 0x01,
+    0x00, 0xD2, 0x03, 0x34, 0x00, 0x01, 0x00, 0xED, 0x03, 0x34, 0x00, 0x01,
+    0x00, 0xE4, 0x03, 0x34, 0x00, 0x01, 0x00, 0xFB, 0x03, 0x34, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0xAC, 0x00, 0x01, 0x01, 0x0E, 0x03, 0x34, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0x34, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xA8, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0x25, 0x00, 0x01, 0x00, 0xFA, 0x03, 0x2F, 0x00, 0x01,
+    0x00, 0xFA, 0x02, 0xD0, 0x00, 0x01, 0x00, 0xE4, 0x02, 0xBD, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0x57, 0x00, 0x01, 0x00, 0xFA, 0x02, 0xB2, 0x00, 0x01,
+    0x00, 0xF2, 0x03, 0x16, 0x00, 0x01, 0x00, 0xD3, 0x03, 0x16, 0x00, 0x01,
+    0x00, 0xFA, 0x03, 0x16, 0x00, 0x42, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x22, 0xFA, 0x00, 0x00, 0x22, 0xF4, 0x00, 0x00, 0x22, 0xEE, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x22, 0xE8, 0x00, 0x00, 0x22, 0xE2, 0x00, 0x00, 0x22, 0xDC, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x22, 0xD6, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x22, 0xD0, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xA6, 0x00, 0x00,
+    0x22, 0xA0, 0x00, 0x00, 0x22, 0x9A, 0x00, 0x00, 0x22, 0x94, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0x8E, 0x00, 0x00, 0x22, 0x88, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0x82, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0x7C, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x00,
+    0x22, 0x76, 0x00, 0x00, 0x22, 0xAC, 0x00, 0x02, 0x00, 0x03, 0x02, 0xEA,
+    0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11, 0x03, 0x23,
+    0x03, 0x42, 0x00, 0x22, 0x00, 0x06, 0x00, 0x10, 0x00, 0x01, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x52, 0x00, 0x52, 0x00, 0x01, 0x00, 0x30,
+    0x00, 0x0C, 0x00, 0x08, 0x18, 0x96, 0x18, 0x96, 0x18, 0x9C, 0x00, 0x1E,
+    0x00, 0x18, 0x00, 0x12, 0x18, 0x9C, 0x00, 0x1E, 0x00, 0x01, 0x00, 0xFB,
+    0xFF, 0x87, 0x00, 0x01, 0x00, 0xFA, 0xFF, 0x4B, 0x00, 0x01, 0x00, 0xFA,
+    0xFF, 0x1D, 0x00, 0x08, 0x00, 0x00, 0x21, 0x6A, 0x00, 0x00, 0x21, 0x6A,
+    0x00, 0x00, 0x21, 0x6A, 0x00, 0x00, 0x21, 0x64, 0x00, 0x00, 0x21, 0x6A,
+    0x00, 0x00, 0x21, 0x6A, 0x00, 0x00, 0x21, 0x6A, 0x00, 0x00, 0x21, 0x10,
+    0x00, 0x01, 0x00, 0x08, 0x03, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11,
+    0x03, 0x13, 0x03, 0x14, 0x03, 0x44, 0x03, 0x45, 0x00, 0x05, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x01, 0xF6, 0x00, 0xC2, 0x00, 0x02,
+    0x00, 0xCC, 0x00, 0x0C, 0x00, 0x07, 0x00, 0xA0, 0x00, 0x86, 0x00, 0x6C,
+    0x00, 0x52, 0x00, 0x3C, 0x00, 0x26, 0x00, 0x10, 0x00, 0x02, 0x1A, 0x10,
+    0x1A, 0x0A, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x01, 0xBB, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0xBB, 0x02, 0xE4, 0x00, 0x02, 0x19, 0xFA, 0x19, 0xF4,
+    0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x01, 0xB6, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0xB6, 0x02, 0xB2, 0x00, 0x02, 0x19, 0x00, 0x18, 0xF4, 0x00, 0x10,
+    0x00, 0x0A, 0x00, 0x01, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x01, 0x01, 0xF2,
+    0x02, 0xE4, 0x00, 0x03, 0x19, 0xCE, 0x19, 0xC8, 0x00, 0x5E, 0x00, 0x58,
+    0x00, 0x14, 0x00, 0x0E, 0x00, 0x01, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x01,
+    0x03, 0x0F, 0x02, 0xE4, 0x00, 0x03, 0x19, 0xB4, 0x19, 0xAE, 0x00, 0x44,
+    0x00, 0x3E, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x01, 0x03, 0x52, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x52, 0x02, 0xE4, 0x00, 0x03, 0x19, 0x9A, 0x19, 0x94,
+    0x00, 0x2A, 0x00, 0x24, 0x00, 0x14, 0x00, 0x0E, 0x00, 0x01, 0x03, 0x0A,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x0A, 0x02, 0xB2, 0x00, 0x02, 0x19, 0x80,
+    0x19, 0x7A, 0x00, 0x10, 0x00, 0x0A, 0x00, 0x01, 0x01, 0xFE, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0xFE, 0x02, 0xE4, 0x00, 0x02, 0x00, 0x01, 0x02, 0x19,
+    0x02, 0x1F, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x96, 0x00, 0x00, 0x20, 0x90, 0x00, 0x00, 0x20, 0x8A, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x84, 0x00, 0x00, 0x20, 0x7E, 0x00, 0x00, 0x20, 0x78, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x72, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00,
+    0x20, 0x6C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x00, 0x20, 0x9C, 0x00, 0x01,
+    0x20, 0x60, 0x00, 0x01, 0x20, 0x60, 0x00, 0x01, 0x20, 0x60, 0x00, 0x01,
+    0x20, 0x5A, 0x00, 0x01, 0x20, 0x60, 0x00, 0x01, 0x20, 0x60, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x42, 0x00, 0x00,
+    0x20, 0x3C, 0x00, 0x00, 0x20, 0x36, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x2A, 0x00, 0x00, 0x20, 0x24, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x1E, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x18, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00, 0x20, 0x48, 0x00, 0x00,
+    0x20, 0x12, 0x00, 0x00, 0x20, 0x48, 0x00, 0x01, 0x20, 0x60, 0x00, 0x01,
+    0x20, 0x06, 0x00, 0x02, 0x00, 0x06, 0x02, 0xEA, 0x02, 0xFA, 0x00, 0x00,
+    0x02, 0xFC, 0x03, 0x0C, 0x00, 0x11, 0x03, 0x0E, 0x03, 0x11, 0x00, 0x22,
+    0x03, 0x13, 0x03, 0x14, 0x00, 0x26, 0x03, 0x23, 0x03, 0x42, 0x00, 0x28,
+    0x03, 0x44, 0x03, 0x45, 0x00, 0x48, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x00, 0x01, 0x1F, 0x48, 0x1C, 0xF2, 0x00, 0x05, 0x1D, 0x68,
+    0x00, 0x0C, 0x02, 0x14, 0x1C, 0xE0, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4,
+    0x00, 0x00, 0x1C, 0xCE, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00,
+    0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8,
+    0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00,
+    0x1C, 0xC2, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA,
+    0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4,
+    0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00,
+    0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8,
+    0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00,
+    0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xC2,
+    0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4,
+    0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00,
+    0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xBC,
+    0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00,
+    0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00, 0x1C, 0xC2,
+    0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xB6, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4,
+    0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00,
+    0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xC8,
+    0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00,
+    0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xB0, 0x00, 0x00, 0x1C, 0xDA,
+    0x1C, 0xD4, 0x00, 0x00, 0x1C, 0xAA, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4,
+    0x00, 0x00, 0x1C, 0xC8, 0x00, 0x00, 0x1C, 0xDA, 0x1C, 0xD4, 0x00, 0x00,
+    0x1C, 0xA4, 0x00, 0x00, 0x1C, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x98,
+    0x00, 0x00, 0x1C, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x92, 0x00, 0x00,
+    0x1C, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1C, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x7A, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x74, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x86, 0x00, 0x00, 0x1C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x7A,
+    0x00, 0x00, 0x1C, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x74, 0x00, 0x00,
+    0x1C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x74, 0x00, 0x00, 0x1C, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x68, 0x00, 0x00, 0x1C, 0x62, 0x00, 0x00,
+    0x1C, 0x5C, 0x1C, 0x68, 0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x1C, 0x5C,
+    0x1C, 0x56, 0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x1C, 0x5C, 0x1C, 0x68,
+    0x00, 0x00, 0x1C, 0x62, 0x00, 0x00, 0x1C, 0x5C, 0x1C, 0x68, 0x00, 0x00,
+    0x1C, 0x50, 0x00, 0x00, 0x1C, 0x5C, 0x1C, 0x68, 0x00, 0x00, 0x1C, 0x4A,
+    0x00, 0x00, 0x1C, 0x5C, 0x1C, 0x44, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38,
+    0x00, 0x00, 0x1C, 0x32, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00,
+    0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C,
+    0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00,
+    0x1C, 0x26, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E,
+    0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38,
+    0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x20, 0x1C, 0x38, 0x00, 0x00,
+    0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C,
+    0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00,
+    0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x1A, 0x00, 0x00, 0x1C, 0x3E,
+    0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38,
+    0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00,
+    0x1C, 0x44, 0x00, 0x00, 0x1C, 0x20, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x14,
+    0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00,
+    0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E,
+    0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38,
+    0x00, 0x00, 0x1C, 0x0E, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00,
+    0x1C, 0x08, 0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x44,
+    0x00, 0x00, 0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x2C, 0x00, 0x00,
+    0x1C, 0x3E, 0x1C, 0x38, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00, 0x1B, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xF6, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xEA, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0xEA, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xEA,
+    0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF6, 0x00, 0x00,
+    0x1B, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xEA, 0x00, 0x00, 0x1B, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xEA, 0x00, 0x00, 0x1B, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x1B, 0xD2,
+    0x1B, 0xDE, 0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x1B, 0xD2, 0x1B, 0xDE,
+    0x00, 0x00, 0x1B, 0xCC, 0x00, 0x00, 0x1B, 0xD2, 0x1B, 0xC6, 0x00, 0x00,
+    0x1B, 0xD8, 0x00, 0x00, 0x1B, 0xD2, 0x1B, 0xDE, 0x00, 0x00, 0x1B, 0xC0,
+    0x00, 0x00, 0x1B, 0xD2, 0x1B, 0xBA, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xAE, 0x00, 0x00,
+    0x1B, 0xA8, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xA2,
+    0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00,
+    0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00, 0x1B, 0xB4,
+    0x1B, 0xAE, 0x00, 0x00, 0x1B, 0x9C, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE,
+    0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00,
+    0x1B, 0xA8, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xA2,
+    0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xBA, 0x00, 0x00,
+    0x1B, 0x96, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x00, 0x1B, 0xB4,
+    0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE,
+    0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00,
+    0x1B, 0xA2, 0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xBA,
+    0x00, 0x00, 0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0xA2, 0x00, 0x00,
+    0x1B, 0xB4, 0x1B, 0xAE, 0x00, 0x00, 0x1B, 0x8A, 0x00, 0x00, 0x1B, 0x84,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x7E, 0x00, 0x00, 0x1B, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0x78, 0x00, 0x00, 0x1B, 0x72, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x78, 0x00, 0x00, 0x1B, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x66,
+    0x1B, 0x60, 0x1B, 0x5A, 0x00, 0x00, 0x1B, 0x54, 0x00, 0x00, 0x1B, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x54, 0x1B, 0x4E, 0x1B, 0x60, 0x1B, 0x5A,
+    0x00, 0x00, 0x1B, 0x54, 0x1B, 0x66, 0x1B, 0x60, 0x1B, 0x5A, 0x00, 0x00,
+    0x1B, 0x54, 0x1B, 0x66, 0x1B, 0x60, 0x1B, 0x48, 0x00, 0x00, 0x1B, 0x54,
+    0x1B, 0x66, 0x1B, 0x60, 0x1B, 0x5A, 0x00, 0x00, 0x1B, 0x54, 0x1B, 0x66,
+    0x1B, 0x60, 0x1B, 0x42, 0x00, 0x00, 0x1B, 0x54, 0x1B, 0x66, 0x1B, 0x60,
+    0x1B, 0x5A, 0x00, 0x00, 0x1B, 0x54, 0x1B, 0x66, 0x1B, 0x60, 0x1B, 0x3C,
+    0x00, 0x00, 0x1B, 0x54, 0x1B, 0x36, 0x1B, 0x30, 0x1B, 0x2A, 0x00, 0x00,
+    0x1B, 0x24, 0x1B, 0x1E, 0x00, 0x00, 0x1B, 0x18, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0x1E, 0x00, 0x00, 0x1B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xDE,
+    0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x0C, 0x00, 0x00,
+    0x1B, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC6, 0x00, 0x00, 0x1B, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x1B, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xC6, 0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0xDE, 0x00, 0x00, 0x1B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xDE,
+    0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00,
+    0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC6, 0x00, 0x00, 0x1B, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x86, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE,
+    0x1A, 0xE8, 0x1C, 0x7A, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8,
+    0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74,
+    0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA,
+    0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4,
+    0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xE2, 0x1A, 0xEE,
+    0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8,
+    0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74,
+    0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xDC, 0x1A, 0xFA,
+    0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4,
+    0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xD6, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE,
+    0x1A, 0xE8, 0x1A, 0xD6, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8,
+    0x1C, 0x86, 0x1A, 0xFA, 0x1A, 0xE2, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xD0,
+    0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA,
+    0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x86, 0x00, 0x00, 0x1A, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x7A, 0x00, 0x00, 0x1A, 0xF4, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x86, 0x00, 0x00, 0x1A, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0xD0, 0x00, 0x00, 0x1A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x74,
+    0x00, 0x00, 0x1A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x74, 0x00, 0x00,
+    0x1A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xCA, 0x1A, 0xFA, 0x1A, 0xF4,
+    0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE,
+    0x1A, 0xE8, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8,
+    0x1A, 0xC4, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xBE,
+    0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x86, 0x1A, 0xFA,
+    0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1C, 0x86, 0x1A, 0xB8, 0x1A, 0xF4,
+    0x1A, 0xB2, 0x1A, 0xAC, 0x1C, 0x7A, 0x1A, 0xB8, 0x1A, 0xF4, 0x1A, 0xB2,
+    0x1A, 0xAC, 0x1C, 0x74, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8,
+    0x1A, 0xC4, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xD6,
+    0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xD6, 0x1A, 0xFA,
+    0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0xA6, 0x00, 0x00, 0x1A, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x9A, 0x00, 0x00, 0x1A, 0x94, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x8E, 0x00, 0x00, 0x1C, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x86, 0x1A, 0xFA, 0x1A, 0xF4, 0x1A, 0xEE, 0x1A, 0xE8, 0x1A, 0x88,
+    0x00, 0x00, 0x1A, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x7C, 0x00, 0x00,
+    0x1A, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x76, 0x00, 0x00, 0x1A, 0x82,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00, 0x1A, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x6A, 0x00, 0x00, 0x1A, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x88, 0x00, 0x00, 0x1A, 0x64, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x76,
+    0x00, 0x00, 0x1A, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x88, 0x00, 0x00,
+    0x1A, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x58, 0x00, 0x00, 0x1C, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x52, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x4C, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x4C, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x46,
+    0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x58, 0x00, 0x00,
+    0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x4C, 0x00, 0x00, 0x1C, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x58, 0x00, 0x00, 0x1A, 0x3A, 0x00, 0x00,
+    0x00, 0x00, 0x1A, 0x4C, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x1A, 0x58, 0x00, 0x00, 0x1C, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x4C,
+    0x00, 0x00, 0x1C, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x34, 0x00, 0x00,
+    0x1A, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x28, 0x00, 0x00, 0x1A, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x1C, 0x00, 0x00, 0x1A, 0x16, 0x00, 0x00,
+    0x1A, 0x10, 0x1A, 0x1C, 0x00, 0x00, 0x1A, 0x16, 0x00, 0x00, 0x1A, 0x10,
+    0x1A, 0x0A, 0x00, 0x00, 0x1A, 0x16, 0x00, 0x00, 0x1A, 0x10, 0x1A, 0x1C,
+    0x00, 0x00, 0x1A, 0x04, 0x00, 0x00, 0x1A, 0x10, 0x1A, 0x1C, 0x00, 0x00,
+    0x19, 0xFE, 0x00, 0x00, 0x1A, 0x10, 0x1A, 0x1C, 0x00, 0x00, 0x19, 0xF8,
+    0x00, 0x00, 0x1A, 0x10, 0x1A, 0x1C, 0x00, 0x00, 0x19, 0xF2, 0x00, 0x00,
+    0x1A, 0x10, 0x19, 0xEC, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00,
+    0x19, 0xD4, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xCE,
+    0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6,
+    0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6, 0x19, 0xE0,
+    0x19, 0xDA, 0x00, 0x00, 0x19, 0xC8, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA,
+    0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00,
+    0x19, 0xEC, 0x19, 0xE6, 0x19, 0xC2, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xBC,
+    0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6,
+    0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xEC, 0x00, 0x00, 0x19, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xD4, 0x00, 0x00, 0x19, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xEC, 0x00, 0x00, 0x19, 0xC2, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0xBC, 0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xCE,
+    0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xCE, 0x00, 0x00,
+    0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xB6, 0x19, 0xE6, 0x19, 0xE0,
+    0x19, 0xDA, 0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA,
+    0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00,
+    0x19, 0xB0, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xEC,
+    0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xAA, 0x19, 0xE6,
+    0x19, 0xE0, 0x19, 0xDA, 0x00, 0x00, 0x19, 0xCE, 0x19, 0xE6, 0x19, 0xE0,
+    0x19, 0xDA, 0x00, 0x00, 0x19, 0xA4, 0x19, 0xE6, 0x19, 0xE0, 0x19, 0xDA,
+    0x00, 0x00, 0x19, 0x9E, 0x00, 0x00, 0x19, 0x98, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x92, 0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x86,
+    0x00, 0x00, 0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00,
+    0x19, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0x19, 0x8C,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x7A, 0x00, 0x00, 0x19, 0x8C, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x74, 0x00, 0x00, 0x19, 0x6E, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x68, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x5C,
+    0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00,
+    0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0x68, 0x00, 0x00, 0x19, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x4A, 0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x56,
+    0x00, 0x00, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00,
+    0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x19, 0x56, 0x00, 0x00, 0x19, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x44, 0x00, 0x00, 0x19, 0x3E, 0x00, 0x00,
+    0x19, 0x38, 0x19, 0x32, 0x00, 0x00, 0x19, 0x3E, 0x00, 0x00, 0x19, 0x38,
+    0x19, 0x2C, 0x00, 0x00, 0x19, 0x3E, 0x00, 0x00, 0x19, 0x38, 0x19, 0x2C,
+    0x00, 0x00, 0x19, 0x3E, 0x00, 0x00, 0x19, 0x38, 0x19, 0x44, 0x00, 0x00,
+    0x19, 0x26, 0x00, 0x00, 0x19, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1B, 0xAE, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x14, 0x00, 0x00,
+    0x19, 0x0E, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x08,
+    0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00,
+    0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x19, 0x1A,
+    0x19, 0x14, 0x00, 0x00, 0x19, 0x02, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14,
+    0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00,
+    0x19, 0x0E, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x08,
+    0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x20, 0x00, 0x00,
+    0x18, 0xFC, 0x19, 0x14, 0x00, 0x00, 0x18, 0xF6, 0x00, 0x00, 0x19, 0x1A,
+    0x19, 0x14, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14,
+    0x00, 0x00, 0x19, 0x08, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00,
+    0x19, 0x08, 0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x20,
+    0x00, 0x00, 0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x19, 0x08, 0x00, 0x00,
+    0x19, 0x1A, 0x19, 0x14, 0x00, 0x00, 0x18, 0xF0, 0x00, 0x00, 0x1E, 0xA0,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xD4, 0x00, 0x00, 0x1E, 0xA0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x54,
+    0x18, 0xEA, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD8,
+    0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00,
+    0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xCC, 0x00, 0x00, 0x18, 0xE4,
+    0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x18, 0xC6, 0x18, 0xDE,
+    0x00, 0x00, 0x18, 0xCC, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00,
+    0x18, 0xCC, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xCC,
+    0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00,
+    0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x18, 0xE4,
+    0x18, 0xDE, 0x00, 0x00, 0x18, 0xC0, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE,
+    0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x18, 0xC6, 0x18, 0xDE, 0x00, 0x00,
+    0x18, 0xCC, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xBA,
+    0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xCC, 0x00, 0x00,
+    0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xB4, 0x00, 0x00, 0x18, 0xE4,
+    0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE,
+    0x00, 0x00, 0x18, 0xEA, 0x00, 0x00, 0x18, 0xC6, 0x18, 0xDE, 0x00, 0x00,
+    0x18, 0xAE, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2,
+    0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00,
+    0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x18, 0xE4,
+    0x18, 0xDE, 0x00, 0x00, 0x18, 0xEA, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE,
+    0x00, 0x00, 0x18, 0xA8, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00,
+    0x18, 0xA2, 0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0xD2,
+    0x00, 0x00, 0x18, 0xE4, 0x18, 0xDE, 0x00, 0x00, 0x18, 0x9C, 0x00, 0x00,
+    0x18, 0x96, 0x00, 0x00, 0x00, 0x00, 0x18, 0x90, 0x00, 0x00, 0x18, 0x96,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x8A, 0x00, 0x00, 0x18, 0xE4, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x7E, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x18, 0x78,
+    0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00,
+    0x18, 0x72, 0x00, 0x00, 0x00, 0x00, 0x18, 0x7E, 0x00, 0x00, 0x18, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x78, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x78, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x6C, 0x18, 0x66, 0x19, 0x98, 0x00, 0x00, 0x18, 0x60, 0x18, 0x6C,
+    0x18, 0x66, 0x19, 0x98, 0x00, 0x00, 0x18, 0x60, 0x18, 0x6C, 0x18, 0x66,
+    0x19, 0x98, 0x00, 0x00, 0x18, 0x60, 0x18, 0x6C, 0x18, 0x66, 0x18, 0x5A,
+    0x00, 0x00, 0x18, 0x60, 0x18, 0x6C, 0x18, 0x66, 0x18, 0x54, 0x00, 0x00,
+    0x18, 0x60, 0x00, 0x00, 0x18, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x4E, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x3C,
+    0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00,
+    0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x48,
+    0x18, 0x42, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x30, 0x18, 0x42,
+    0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00,
+    0x18, 0x2A, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x36,
+    0x00, 0x00, 0x18, 0x24, 0x18, 0x42, 0x00, 0x00, 0x18, 0x1E, 0x00, 0x00,
+    0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x48,
+    0x18, 0x42, 0x00, 0x00, 0x18, 0x1E, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42,
+    0x00, 0x00, 0x18, 0x12, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00,
+    0x18, 0x36, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x36,
+    0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x4E, 0x00, 0x00,
+    0x18, 0x24, 0x18, 0x42, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x48,
+    0x18, 0x42, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42,
+    0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00,
+    0x18, 0x36, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x06,
+    0x00, 0x00, 0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00,
+    0x18, 0x48, 0x18, 0x42, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x48,
+    0x18, 0x42, 0x00, 0x00, 0x18, 0x36, 0x00, 0x00, 0x18, 0x48, 0x18, 0x42,
+    0x00, 0x00, 0x17, 0xFA, 0x00, 0x00, 0x17, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0xEE, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x17, 0xE2,
+    0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x17, 0xE2, 0x00, 0x00,
+    0x17, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x17, 0xE2, 0x00, 0x00, 0x17, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x74, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0xE2, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x00, 0x00,
+    0x17, 0xE2, 0x00, 0x00, 0x17, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x17, 0xDC,
+    0x00, 0x00, 0x17, 0xD6, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xDC, 0x00, 0x00,
+    0x17, 0xD6, 0x00, 0x00, 0x17, 0xD0, 0x17, 0xDC, 0x00, 0x00, 0x17, 0xCA,
+    0x00, 0x00, 0x17, 0xD0, 0x17, 0xC4, 0x00, 0x00, 0x17, 0xD6, 0x00, 0x00,
+    0x17, 0xD0, 0x17, 0xDC, 0x00, 0x00, 0x17, 0xBE, 0x00, 0x00, 0x17, 0xD0,
+    0x17, 0xB8, 0x00, 0x00, 0x17, 0xB2, 0x17, 0xAC, 0x00, 0x00, 0x17, 0xA6,
+    0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0x94, 0x00, 0x00,
+    0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0,
+    0x17, 0x9A, 0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A,
+    0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00,
+    0x17, 0x88, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0x8E,
+    0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0x82, 0x00, 0x00,
+    0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0,
+    0x17, 0x9A, 0x00, 0x00, 0x17, 0xB8, 0x00, 0x00, 0x17, 0x7C, 0x17, 0xAC,
+    0x00, 0x00, 0x17, 0x76, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00,
+    0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0x8E,
+    0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00, 0x17, 0xB8, 0x00, 0x00,
+    0x17, 0xB2, 0x17, 0xAC, 0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0,
+    0x17, 0x9A, 0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A,
+    0x00, 0x00, 0x17, 0x8E, 0x00, 0x00, 0x17, 0xA0, 0x17, 0x9A, 0x00, 0x00,
+    0x17, 0x70, 0x00, 0x00, 0x17, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x17, 0x64,
+    0x00, 0x00, 0x17, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x17, 0x5E, 0x00, 0x00,
+    0x17, 0x58, 0x00, 0x00, 0x00, 0x00, 0x17, 0x5E, 0x00, 0x00, 0x17, 0x52,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x2A, 0x00, 0x00, 0x17, 0x4C, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x46, 0x17, 0x40, 0x17, 0x3A, 0x00, 0x00, 0x17, 0x34,
+    0x17, 0x2E, 0x17, 0x40, 0x17, 0x3A, 0x00, 0x00, 0x17, 0x34, 0x17, 0x46,
+    0x17, 0x40, 0x17, 0x3A, 0x00, 0x00, 0x17, 0x34, 0x17, 0x46, 0x17, 0x40,
+    0x17, 0x28, 0x00, 0x00, 0x17, 0x34, 0x17, 0x46, 0x17, 0x40, 0x17, 0x3A,
+    0x00, 0x00, 0x17, 0x34, 0x17, 0x46, 0x17, 0x40, 0x17, 0x22, 0x00, 0x00,
+    0x17, 0x34, 0x17, 0x46, 0x17, 0x40, 0x17, 0x3A, 0x00, 0x00, 0x17, 0x34,
+    0x17, 0x46, 0x17, 0x40, 0x17, 0x1C, 0x00, 0x00, 0x17, 0x34, 0x17, 0x16,
+    0x17, 0x10, 0x17, 0x0A, 0x00, 0x00, 0x17, 0x04, 0x16, 0xFE, 0x00, 0x00,
+    0x16, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFE, 0x00, 0x00, 0x16, 0xF2,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xEC, 0x00, 0x00, 0x17, 0xD6, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xE6, 0x00, 0x00, 0x17, 0xD6, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0xE0, 0x00, 0x00, 0x1E, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDA,
+    0x00, 0x00, 0x17, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEC, 0x00, 0x00,
+    0x16, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDA, 0x00, 0x00, 0x17, 0xD6,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0xEC, 0x00, 0x00, 0x17, 0xBE, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xEC, 0x00, 0x00, 0x17, 0xD6, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0xEC, 0x00, 0x00, 0x16, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDA,
+    0x00, 0x00, 0x17, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC8, 0x16, 0xC2,
+    0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xAA, 0x16, 0xC2, 0x16, 0xBC,
+    0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6,
+    0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0,
+    0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0x9E,
+    0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2,
+    0x16, 0x98, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0x92, 0x16, 0xC2, 0x16, 0xBC,
+    0x16, 0xB6, 0x16, 0xB0, 0x16, 0x8C, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6,
+    0x16, 0xB0, 0x16, 0x92, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0,
+    0x16, 0x86, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4,
+    0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0x80, 0x16, 0xC2,
+    0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0x80, 0x16, 0xC2, 0x16, 0xBC,
+    0x16, 0xB6, 0x16, 0xB0, 0x16, 0xC8, 0x16, 0xC2, 0x16, 0x98, 0x16, 0xB6,
+    0x16, 0xB0, 0x16, 0x7A, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0,
+    0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xC8,
+    0x00, 0x00, 0x16, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAA, 0x00, 0x00,
+    0x16, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC8, 0x00, 0x00, 0x16, 0x98,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x7A, 0x00, 0x00, 0x16, 0xBC, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0xA4, 0x00, 0x00, 0x16, 0xBC, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0xA4, 0x00, 0x00, 0x16, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x16, 0xA4,
+    0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2,
+    0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC,
+    0x16, 0xB6, 0x16, 0xB0, 0x16, 0x74, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6,
+    0x16, 0xB0, 0x16, 0x74, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0,
+    0x16, 0xC8, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xC8,
+    0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xAA, 0x16, 0xC2,
+    0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC,
+    0x16, 0xB6, 0x16, 0xB0, 0x16, 0xA4, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6,
+    0x16, 0xB0, 0x16, 0x6E, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0,
+    0x16, 0x80, 0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x16, 0x68,
+    0x00, 0x00, 0x1B, 0x72, 0x00, 0x00, 0x00, 0x00, 0x16, 0x62, 0x00, 0x00,
+    0x18, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x16, 0x5C, 0x00, 0x00, 0x1C, 0xDA,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x5C, 0x00, 0x00, 0x1C, 0xDA, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x56, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x4A, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x44,
+    0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00, 0x16, 0x56, 0x00, 0x00,
+    0x16, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x16, 0x38, 0x00, 0x00, 0x16, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x56, 0x00, 0x00, 0x16, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x44, 0x00, 0x00, 0x16, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x56, 0x00, 0x00, 0x16, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2A,
+    0x00, 0x00, 0x1E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x16, 0x26, 0x00, 0x00,
+    0x1E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x16, 0x20, 0x00, 0x00, 0x1E, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x1A, 0x00, 0x00, 0x1E, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x14, 0x00, 0x00, 0x1E, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x2A, 0x00, 0x00, 0x16, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x16, 0x1A,
+    0x00, 0x00, 0x1E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x2A, 0x00, 0x00,
+    0x16, 0x08, 0x00, 0x00, 0x00, 0x00, 0x16, 0x1A, 0x00, 0x00, 0x1E, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x2A, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x16, 0x1A, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0xFC, 0x00, 0x00, 0x15, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x15, 0xF0,
+    0x15, 0xEA, 0x15, 0xE4, 0x00, 0x00, 0x15, 0xDE, 0x15, 0xF0, 0x15, 0xEA,
+    0x15, 0xE4, 0x00, 0x00, 0x15, 0xDE, 0x15, 0xF0, 0x15, 0xEA, 0x15, 0xE4,
+    0x00, 0x00, 0x15, 0xDE, 0x15, 0xF0, 0x15, 0xEA, 0x15, 0xD8, 0x00, 0x00,
+    0x15, 0xDE, 0x15, 0xF0, 0x15, 0xEA, 0x15, 0xD2, 0x00, 0x00, 0x15, 0xDE,
+    0x15, 0xCC, 0x15, 0xEA, 0x15, 0xE4, 0x00, 0x00, 0x15, 0xDE, 0x15, 0xF0,
+    0x15, 0xEA, 0x15, 0xC6, 0x00, 0x00, 0x15, 0xDE, 0x15, 0xF0, 0x15, 0xEA,
+    0x15, 0xC0, 0x00, 0x00, 0x15, 0xDE, 0x15, 0xBA, 0x15, 0xB4, 0x15, 0xAE,
+    0x18, 0x42, 0x00, 0x00, 0x15, 0xA8, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42,
+    0x00, 0x00, 0x15, 0xA2, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00,
+    0x15, 0xA2, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xA2,
+    0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0x9C, 0x15, 0xB4,
+    0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xA2, 0x15, 0xB4, 0x15, 0xAE,
+    0x18, 0x42, 0x00, 0x00, 0x15, 0xBA, 0x15, 0xB4, 0x15, 0x96, 0x18, 0x42,
+    0x00, 0x00, 0x15, 0x90, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00,
+    0x15, 0xA2, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xBA,
+    0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x15, 0xA8, 0x00, 0x00,
+    0x15, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x15, 0xBA, 0x00, 0x00, 0x15, 0x96,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x90, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x15, 0xA2,
+    0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xA2, 0x15, 0xB4,
+    0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xA2, 0x15, 0xB4, 0x15, 0xAE,
+    0x18, 0x42, 0x00, 0x00, 0x15, 0x8A, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42,
+    0x00, 0x00, 0x15, 0xBA, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00,
+    0x15, 0x84, 0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xA2,
+    0x15, 0xB4, 0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0xA2, 0x15, 0xB4,
+    0x15, 0xAE, 0x18, 0x42, 0x00, 0x00, 0x15, 0x7E, 0x00, 0x00, 0x15, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x72, 0x00, 0x00, 0x19, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x6C, 0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x66, 0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x66,
+    0x00, 0x00, 0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x60, 0x00, 0x00,
+    0x19, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x15, 0x5A, 0x00, 0x00, 0x15, 0x54,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x0C, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0xAE, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x48, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x48,
+    0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x48, 0x00, 0x00,
+    0x15, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0C, 0x00, 0x00, 0x15, 0x42,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x12, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x48, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x00, 0x00,
+    0x15, 0x48, 0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x48,
+    0x00, 0x00, 0x15, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x15, 0x3C, 0x00, 0x00,
+    0x15, 0x36, 0x00, 0x00, 0x15, 0x30, 0x15, 0x2A, 0x00, 0x00, 0x15, 0x36,
+    0x00, 0x00, 0x15, 0x30, 0x15, 0x9C, 0x00, 0x00, 0x15, 0x36, 0x00, 0x00,
+    0x15, 0x30, 0x15, 0x9C, 0x00, 0x00, 0x15, 0x36, 0x00, 0x00, 0x15, 0x30,
+    0x15, 0x3C, 0x00, 0x00, 0x15, 0x24, 0x00, 0x00, 0x15, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x9A, 0x00, 0x00, 0x15, 0xBA, 0x00, 0x00,
+    0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0xA8, 0x00, 0x00, 0x15, 0xAE,
+    0x15, 0x1E, 0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E,
+    0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00,
+    0x15, 0xA2, 0x00, 0x00, 0x15, 0x96, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x18,
+    0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00,
+    0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x15, 0xAE,
+    0x15, 0x1E, 0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E,
+    0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00,
+    0x15, 0x12, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0xA2,
+    0x00, 0x00, 0x15, 0x96, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00,
+    0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x0C, 0x00, 0x00, 0x15, 0xAE,
+    0x15, 0x1E, 0x00, 0x00, 0x15, 0x18, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E,
+    0x00, 0x00, 0x15, 0x9C, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00,
+    0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0xBA,
+    0x00, 0x00, 0x15, 0x96, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x90, 0x00, 0x00,
+    0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE,
+    0x15, 0x1E, 0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E,
+    0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00,
+    0x15, 0xBA, 0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x84,
+    0x00, 0x00, 0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00,
+    0x15, 0xAE, 0x15, 0x1E, 0x00, 0x00, 0x15, 0xA2, 0x00, 0x00, 0x15, 0xAE,
+    0x15, 0x1E, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x14, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0xF4, 0x00, 0x00, 0x14, 0xFA, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0xF4, 0x00, 0x00, 0x14, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF4,
+    0x00, 0x00, 0x14, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x14, 0xEE, 0x00, 0x00,
+    0x14, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x14, 0xF4, 0x00, 0x00, 0x14, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0xF4, 0x00, 0x00, 0x14, 0xFA, 0x00, 0x00,
+    0x00, 0x00, 0x1B, 0xDE, 0x00, 0x00, 0x1B, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x86, 0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x86,
+    0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x02, 0x00, 0x00,
+    0x1B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x14, 0xE8, 0x00, 0x00, 0x14, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0xDC, 0x00, 0x00, 0x14, 0xD6, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0xDC, 0x00, 0x00, 0x14, 0xD6, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0xD0, 0x00, 0x00, 0x14, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x16, 0xC8,
+    0x16, 0xC2, 0x16, 0xBC, 0x16, 0xB6, 0x16, 0xB0, 0x00, 0x01, 0x01, 0xC1,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xC1, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x7F,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x7F, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x8C,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x8C, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x22,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x22, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x22,
+    0xFF, 0x1A, 0x00, 0x01, 0x01, 0x22, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x21,
+    0x03, 0x75, 0x00, 0x01, 0x01, 0x30, 0x03, 0x16, 0x00, 0x01, 0x01, 0x0E,
+    0x03, 0x16, 0x00, 0x01, 0x01, 0x0D, 0x03, 0x16, 0x00, 0x01, 0x01, 0xD0,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xD7, 0xFF, 0x75, 0x00, 0x01, 0x00, 0xEB,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0xD7, 0x01, 0x07, 0x00, 0x01, 0x00, 0xD7,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xD7, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x73,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0xFB, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x73,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x01, 0x00, 0xEE,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x60, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x74,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x88, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x74,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x01, 0x00, 0xEA,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x0D, 0x02, 0xD0, 0x00, 0x01, 0x01, 0x0D,
+    0x03, 0x25, 0x00, 0x01, 0x00, 0xF9, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x0D,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0xD7, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x0D,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x21, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x0D,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x06, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x0D,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xB0, 0xFF, 0x87, 0x00, 0x01, 0x00, 0xAF,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0xAF, 0x03, 0x09, 0x00, 0x01, 0x00, 0xB0,
+    0xFF, 0x34, 0x00, 0x01, 0x00, 0xA7, 0xFF, 0x1D, 0x00, 0x01, 0x00, 0xAF,
+    0x01, 0x07, 0x00, 0x01, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x01, 0x00, 0xDE,
+    0x02, 0xE4, 0x00, 0x01, 0x00, 0xAF, 0x02, 0x64, 0x00, 0x01, 0x01, 0x2F,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x2F, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xFA,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0xFB, 0xFF, 0x34, 0x00, 0x01, 0x00, 0xF2,
+    0xFF, 0x1D, 0x00, 0x01, 0x00, 0xF0, 0x03, 0x16, 0x00, 0x01, 0x00, 0xF0,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0xF0, 0x02, 0xBD, 0x00, 0x01, 0x01, 0x04,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0x57, 0xFF, 0x87, 0x00, 0x01, 0x00, 0x56,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0x86, 0x02, 0xB2, 0x00, 0x01, 0x00, 0x57,
+    0xFF, 0x34, 0x00, 0x01, 0x00, 0xBC, 0x02, 0xB2, 0x00, 0x01, 0x00, 0xD0,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0xBC,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x32, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x2D,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x3E, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x33,
+    0x03, 0x2F, 0x00, 0x01, 0x01, 0x34, 0x02, 0xA8, 0x00, 0x01, 0x01, 0x20,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x34, 0x03, 0x57, 0x00, 0x01, 0x00, 0xFE,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x57, 0x03, 0x16, 0x00, 0x01, 0x01, 0x34,
+    0x03, 0x16, 0x00, 0x01, 0x01, 0x34, 0xFF, 0x75, 0x00, 0x01, 0x01, 0x35,
+    0x03, 0x16, 0x00, 0x01, 0x01, 0x34, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x48,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x34, 0x01, 0x07, 0x00, 0x01, 0x01, 0xCA,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x34, 0x00, 0x00, 0x00, 0x01, 0x02, 0x53,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x34, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x10,
+    0xFF, 0x87, 0x00, 0x01, 0x01, 0x10, 0xFF, 0x34, 0x00, 0x01, 0x01, 0x14,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x40, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x28,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x14, 0x02, 0x0D, 0x00, 0x01, 0x01, 0xB7,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0xB7, 0x00, 0x00, 0x00, 0x01, 0x01, 0xB7,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xA6, 0x01, 0x72, 0x00, 0x01, 0x00, 0xA6,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xC7, 0x02, 0xE4, 0x00, 0x01, 0x00, 0xA6,
+    0x02, 0xE4, 0x00, 0x01, 0x00, 0x68, 0xFF, 0x87, 0x00, 0x01, 0x00, 0x67,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0x68, 0xFF, 0x34, 0x00, 0x01, 0x00, 0x7B,
+    0x03, 0x5C, 0x00, 0x01, 0x00, 0x67, 0x01, 0x72, 0x00, 0x01, 0x00, 0x67,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x02, 0xE4, 0x00, 0x01, 0x00, 0x67,
+    0x02, 0xE4, 0x00, 0x01, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x00, 0xEE,
+    0xFF, 0x34, 0x00, 0x01, 0x00, 0xED, 0x00, 0x00, 0x00, 0x01, 0x00, 0xED,
+    0x02, 0xE4, 0x00, 0x01, 0x00, 0x59, 0x02, 0xB2, 0x00, 0x01, 0x00, 0x59,
+    0xFF, 0x1A, 0x00, 0x01, 0x00, 0x59, 0x02, 0x0D, 0x00, 0x01, 0x00, 0x3D,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0x62, 0xFF, 0x75, 0x00, 0x01, 0x00, 0x51,
+    0x03, 0x16, 0x00, 0x01, 0x00, 0x1B, 0x02, 0xB2, 0x00, 0x01, 0x00, 0x51,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0x65, 0x02, 0xB2, 0x00, 0x01, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x51, 0x00, 0x00, 0x00, 0x01, 0x00, 0x51,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0x6D, 0x00, 0x00, 0x00, 0x01, 0x00, 0x62,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x62, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x0F,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x0F, 0x03, 0x5C, 0x00, 0x01, 0x01, 0x0F,
+    0xFF, 0x4B, 0x00, 0x01, 0x00, 0x76, 0x02, 0x7E, 0x00, 0x01, 0x01, 0x0F,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x0F, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x24,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x2E, 0xFF, 0x1A, 0x00, 0x01, 0x01, 0x24,
+    0x02, 0x0D, 0x00, 0x01, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x01, 0x00, 0xAA,
+    0x02, 0xE4, 0x00, 0x01, 0x01, 0x11, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x1D,
+    0x02, 0xA8, 0x00, 0x01, 0x01, 0x09, 0x02, 0xB2, 0x00, 0x01, 0x00, 0xE7,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x40, 0x03, 0x16, 0x00, 0x01, 0x01, 0x1D,
+    0x03, 0x16, 0x00, 0x01, 0x01, 0x2A, 0xFF, 0x75, 0x00, 0x01, 0x01, 0x1E,
+    0x03, 0x16, 0x00, 0x01, 0x01, 0x22, 0xFF, 0x1D, 0x00, 0x01, 0x01, 0x1D,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x31, 0x02, 0xB2, 0x00, 0x01, 0x01, 0xD2,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x2A, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1D,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x2F, 0xFF, 0x87, 0x00, 0x01, 0x01, 0x2E,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0xF5, 0x02, 0x7A, 0x00, 0x01, 0x02, 0x1E,
+    0x02, 0xE4, 0x00, 0x01, 0x01, 0x2E, 0x02, 0xE4, 0x00, 0x01, 0x01, 0x2A,
+    0xFF, 0x1D, 0x00, 0x01, 0x01, 0x33, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x47,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x33, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x2D,
+    0x02, 0xE4, 0x00, 0x01, 0x01, 0xEE, 0x02, 0xB2, 0x00, 0x01, 0x01, 0xDA,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0xDA, 0x02, 0x0D, 0x00, 0x01, 0x01, 0x37,
+    0x03, 0x75, 0x00, 0x01, 0x01, 0x23, 0x02, 0xD0, 0x00, 0x01, 0x01, 0x0F,
+    0x02, 0xB2, 0x00, 0x01, 0x00, 0xED, 0x02, 0xB2, 0x00, 0x01, 0x01, 0x46,
+    0x03, 0x16, 0x00, 0x01, 0x01, 0x24, 0x03, 0x16, 0x00, 0x01, 0x01, 0x2D,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x23, 0x03, 0x16, 0x00, 0x01, 0x01, 0x23,
+    0x02, 0xB2, 0x00, 0x01, 0x01, 0x37, 0x02, 0xB2, 0x00, 0x01, 0x02, 0x14,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x2D, 0x00, 0x00, 0x00, 0x01, 0x01, 0x23,
+    0x02, 0x0D, 0x00, 0x01, 0x01, 0x88, 0x02, 0xBC, 0x00, 0x01, 0x00, 0x86,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0x9A, 0xFF, 0x75, 0x00, 0x01, 0x00, 0x52,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0x9A, 0x03, 0x34, 0x00, 0x01, 0x00, 0xAE,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0xA5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x9A,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x9A, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x3D,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x3D, 0x03, 0x34, 0x00, 0x01, 0x01, 0x51,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x3D, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x3D,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x3D, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x14,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x28, 0xFF, 0x75, 0x00, 0x01, 0x01, 0x28,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x3C, 0x03, 0x34, 0x00, 0x01, 0x01, 0x28,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x28, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x24,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x24, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x95,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0xA9, 0x03, 0x34, 0x00, 0x01, 0x01, 0xBD,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0xA9, 0x00, 0x00, 0x00, 0x01, 0x01, 0xA9,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2E,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x88, 0x03, 0xAC, 0x00, 0x01, 0x01, 0x74,
+    0x03, 0x43, 0x00, 0x01, 0x01, 0x74, 0x03, 0xAC, 0x00, 0x01, 0x01, 0xA6,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x60, 0x03, 0x34, 0x00, 0x01, 0x01, 0x74,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x2C, 0x03, 0x34, 0x00, 0x01, 0x01, 0x74,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x88, 0x03, 0x34, 0x00, 0x01, 0x02, 0x0B,
+    0xFF, 0xFA, 0x00, 0x01, 0x01, 0x74, 0x00, 0x00, 0x00, 0x01, 0x02, 0xD4,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x74, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xF5,
+    0xFF, 0x87, 0x00, 0x01, 0x00, 0xF4, 0xFF, 0x75, 0x00, 0x01, 0x00, 0xF5,
+    0xFF, 0x34, 0x00, 0x01, 0x00, 0xED, 0xFF, 0x1D, 0x00, 0x01, 0x00, 0xF4,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0xF4, 0x01, 0x5E, 0x00, 0x01, 0x00, 0xF4,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xF4, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x8E,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x8E, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x62,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x62, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x33,
+    0xFF, 0x34, 0x00, 0x01, 0x01, 0x2B, 0xFF, 0x1D, 0x00, 0x01, 0x01, 0x26,
+    0x03, 0xAC, 0x00, 0x01, 0x01, 0x26, 0x03, 0x34, 0x00, 0x01, 0x01, 0x3A,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x26, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x32,
+    0xFF, 0x87, 0x00, 0x01, 0x01, 0x31, 0xFF, 0x75, 0x00, 0x01, 0x00, 0xDF,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x32, 0xFF, 0x34, 0x00, 0x01, 0x01, 0x27,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x3B, 0x03, 0x34, 0x00, 0x01, 0x01, 0x31,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x27, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x1B,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x2C, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2C,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0xF5, 0x00, 0x00, 0x00, 0x01, 0x01, 0xF5,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x8E, 0x01, 0x5E, 0x00, 0x01, 0x01, 0xE5,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x09, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x7B,
+    0x03, 0xAC, 0x00, 0x01, 0x01, 0xA3, 0x03, 0xAC, 0x00, 0x01, 0x01, 0xC1,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x7B, 0x03, 0x34, 0x00, 0x01, 0x01, 0x8F,
+    0x03, 0xAC, 0x00, 0x01, 0x01, 0x47, 0x03, 0x34, 0x00, 0x01, 0x01, 0x8F,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x8F, 0x01, 0x5E, 0x00, 0x01, 0x01, 0xE6,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x8F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0A,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x6F, 0xFF, 0x87, 0x00, 0x01, 0x01, 0x6F,
+    0xFF, 0x34, 0x00, 0x01, 0x01, 0x82, 0x03, 0x34, 0x00, 0x01, 0x01, 0xA4,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0xA4, 0x00, 0x00, 0x00, 0x01, 0x01, 0xA4,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0x69, 0x01, 0x5E, 0x00, 0x01, 0x00, 0xFB,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x1A, 0x02, 0xBC, 0x00, 0x01, 0x00, 0x69,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x0C, 0xFF, 0x87, 0x00, 0x01, 0x01, 0x0B,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x0C, 0xFF, 0x34, 0x00, 0x01, 0x00, 0x8D,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0x79, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x0B,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x2A, 0x02, 0xBC, 0x00, 0x01, 0x00, 0x79,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x3F, 0xFF, 0x34, 0x00, 0x01, 0x01, 0x3E,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x3E, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x81,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x18, 0x00, 0x00, 0x00, 0x01, 0x01, 0x81,
+    0x02, 0xBC, 0x00, 0x01, 0x00, 0xAD, 0x03, 0x34, 0x00, 0x01, 0x00, 0xC1,
+    0xFF, 0x75, 0x00, 0x01, 0x00, 0x79, 0x03, 0x34, 0x00, 0x01, 0x00, 0xC1,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0xD5, 0x03, 0x34, 0x00, 0x01, 0x01, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0xC1, 0x00, 0x00, 0x00, 0x01, 0x00, 0xC1,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x6E, 0xFF, 0x75, 0x00, 0x01, 0x01, 0x6E,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x6E, 0xFF, 0x4B, 0x00, 0x01, 0x01, 0x6E,
+    0x01, 0x5E, 0x00, 0x01, 0x01, 0x6E, 0x00, 0x00, 0x00, 0x01, 0x01, 0x6E,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x81, 0xFF, 0x34, 0x00, 0x01, 0x01, 0x8D,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8D,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00, 0x01, 0x01, 0x20,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x25, 0x03, 0xAC, 0x00, 0x01, 0x01, 0x4D,
+    0x03, 0xAC, 0x00, 0x01, 0x01, 0x25, 0x03, 0x34, 0x00, 0x01, 0x00, 0xF1,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x1B, 0xFF, 0x75, 0x00, 0x01, 0x01, 0x14,
+    0xFF, 0x1D, 0x00, 0x01, 0x01, 0x39, 0x03, 0x34, 0x00, 0x01, 0x01, 0x4D,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0xDB, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1B,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x39, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x72,
+    0xFF, 0x87, 0x00, 0x01, 0x01, 0x71, 0xFF, 0x75, 0x00, 0x01, 0x01, 0x71,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0x9E, 0x01, 0x5E, 0x00, 0x01, 0x01, 0x71,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x71, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x7C,
+    0xFF, 0x1D, 0x00, 0x01, 0x01, 0x8F, 0x03, 0x34, 0x00, 0x01, 0x01, 0xA3,
+    0x03, 0x34, 0x00, 0x01, 0x01, 0x83, 0x00, 0x00, 0x00, 0x01, 0x01, 0x8F,
+    0x02, 0xBC, 0x00, 0x01, 0x01, 0x46, 0x00, 0x00, 0x00, 0x01, 0x01, 0x46,
+    0x02, 0xBC, 0x00, 0x01, 0x02, 0x8F, 0x03, 0x34, 0x00, 0x01, 0x01, 0xCF,
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x7B, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x46,
+    0x03, 0xBB, 0x00, 0x01, 0x01, 0x32, 0x03, 0x43, 0x00, 0x01, 0x01, 0x1E,
+    0x03, 0x34, 0x00, 0x01, 0x00, 0xEA, 0x03, 0x34, 0x00, 0x01, 0x01, 0x32,
+    0xFF, 0x75, 0x00, 0x01, 0x01, 0x32, 0x03, 0x34, 0x00, 0x01, 0x01, 0x46,
+    0x03, 0x34, 0x00, 0x01, 0x02, 0x35, 0x00, 0x00, 0x00, 0x01, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x32, 0x02, 0xBC, 0x00, 0x02, 0x00, 0x13,
+    0x00, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x25,
+    0x00, 0x2F, 0x00, 0x74, 0x00, 0x2A, 0x00, 0x76, 0x00, 0x7A, 0x00, 0x70,
+    0x00, 0x7C, 0x00, 0x7E, 0x00, 0x75, 0x00, 0x80, 0x01, 0x05, 0x00, 0x78,
+    0x01, 0x07, 0x01, 0x2B, 0x00, 0xFE, 0x01, 0x2D, 0x01, 0x48, 0x01, 0x23,
+    0x01, 0x4A, 0x01, 0x68, 0x01, 0x3F, 0x01, 0x6A, 0x01, 0x80, 0x01, 0x5E,
+    0x01, 0x82, 0x01, 0x84, 0x01, 0x75, 0x01, 0x86, 0x02, 0x18, 0x01, 0x78,
+    0x02, 0xB5, 0x02, 0xB5, 0x02, 0x0B, 0x02, 0xB7, 0x02, 0xB7, 0x02, 0x0C,
+    0x02, 0xB9, 0x02, 0xB9, 0x02, 0x0D, 0x02, 0xBE, 0x02, 0xBE, 0x02, 0x0E,
+    0x02, 0xC4, 0x02, 0xC6, 0x02, 0x0F, 0x02, 0xCA, 0x02, 0xCA, 0x02, 0x12,
+    0x02, 0xDE, 0x02, 0xDE, 0x02, 0x13, 0x00, 0x4F, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, 0x01, 0xCE, 0x00, 0x00, 0x01, 0xC8,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xC2, 0x00, 0x00, 0x01, 0xBC, 0x00, 0x00, 0x01, 0xB6,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xB0, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x01, 0xAA, 0x00, 0x00, 0x01, 0xDA, 0x00, 0x00, 0x01, 0xDA,
+    0x00, 0x01, 0x01, 0xA4, 0x00, 0x02, 0x01, 0x9E, 0x00, 0x02, 0x01, 0x9E,
+    0x00, 0x02, 0x01, 0x9E, 0x00, 0x02, 0x01, 0x98, 0x00, 0x03, 0x01, 0x92,
+    0x00, 0x02, 0x01, 0x9E, 0x00, 0x02, 0x01, 0x9E, 0x00, 0x04, 0x01, 0x8C,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x00, 0x01, 0x7A, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x01, 0x6E,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x01, 0x62,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x5C, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x56, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x86,
+    0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x01, 0x4A,
+    0x00, 0x02, 0x01, 0x9E, 0x00, 0x02, 0x01, 0x44, 0x00, 0x03, 0x01, 0x3E,
+    0x00, 0x01, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xBA, 0x02, 0x09, 0x00, 0x01, 0x01, 0x41, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xFB, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xD0, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xD2, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xED, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xC9, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xE4, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xE7, 0x02, 0xBC, 0x00, 0x01, 0x01, 0x0F, 0x02, 0xBC,
+    0x00, 0x01, 0x00, 0xFA, 0x02, 0xBC, 0x00, 0x01, 0x00, 0xFA, 0x01, 0x2B,
+    0x00, 0x01, 0x01, 0x3B, 0x00, 0x02, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x01, 0x00, 0xC0, 0x02, 0x0D,
+    0x00, 0x01, 0x01, 0x30, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xFB, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xE4, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xE6, 0x02, 0x0D,
+    0x00, 0x01, 0x01, 0x0E, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xCF, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xF0, 0x02, 0x0D, 0x00, 0x01, 0x00, 0xD2, 0x02, 0x0D,
+    0x00, 0x01, 0x00, 0xFA, 0x02, 0x0D, 0x00, 0x02, 0x00, 0x03, 0x02, 0xEA,
+    0x02, 0xFA, 0x00, 0x00, 0x02, 0xFC, 0x03, 0x15, 0x00, 0x11, 0x03, 0x23,
+    0x03, 0x46, 0x00, 0x2B, 0x00, 0x02, 0x00, 0x08, 0x00, 0x02, 0x10, 0x48,
+    0x00, 0x0A, 0x00, 0x02, 0x0C, 0x48, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x30,
+    0x0C, 0xAC, 0x00, 0x2E, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x14, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCB, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00,
+    0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00,
+    0xFF, 0xF1, 0xFF, 0xFB, 0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xDD,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD9, 0xFF, 0xEC,
+    0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0xFF, 0xEC, 0xFF, 0xE7, 0xFF, 0xFB,
+    0xFF, 0xCE, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xB5,
+    0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0xFF, 0xD3, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xF6,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xB5,
+    0xFF, 0xCE, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0xFF, 0xCE, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE,
+    0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xBA, 0xFF, 0xD8, 0xFF, 0xCE, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xDD, 0xFF, 0xB0, 0xFF, 0xEC, 0xFF, 0xF6,
+    0xFF, 0xE9, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0xDC, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xB0, 0xFF, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF6, 0xFF, 0x9C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0xFF, 0xEB,
+    0xFF, 0x88, 0xFF, 0xF6, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFD,
+    0xFF, 0xE7, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF2,
+    0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x00,
+    0xFF, 0xD8, 0xFF, 0xFB, 0xFF, 0xAC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x88, 0xFF, 0x9C, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xFF, 0xF6, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x32,
+    0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0xFF, 0xF1,
+    0xFF, 0xBA, 0x00, 0x00, 0xFF, 0x8E, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0xFF, 0xE7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x9C, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xCE, 0xFF, 0x9C, 0x00, 0x00,
+    0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x9C, 0x00, 0x0A, 0x00, 0x00,
+    0xFF, 0xCE, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xD3, 0xFF, 0xB0, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA, 0xFF, 0xBA, 0x00, 0x00, 0xFF, 0xB0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0xFF, 0x9C, 0xFF, 0xEC,
+    0xFF, 0x9C, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF1, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF1, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00,
+    0xFF, 0xFB, 0xFF, 0xD8, 0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0xFF, 0xEC, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0xFF, 0xFD, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB,
+    0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xFF, 0xF6, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0xFF, 0xD8, 0x00, 0x00, 0xFF, 0xEA, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFB,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xD3, 0x00, 0x00, 0xFF, 0xF4, 0xFF, 0xF1,
+    0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xFC, 0x00, 0x14, 0x00, 0x00,
+    0xFF, 0xD8, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xFB,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x0F,
+    0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xB5, 0x00, 0x08, 0xFF, 0xF1, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x32,
+    0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x28,
+    0x00, 0x37, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8,
+    0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00,
+    0xFF, 0xF7, 0xFF, 0xC4, 0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xF7, 0x00, 0x00,
+    0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0xF6, 0xFF, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xB0, 0xFF, 0xF7, 0xFF, 0xB0, 0xFF, 0xFB,
+    0xFF, 0xF1, 0x00, 0x00, 0xFF, 0xC4, 0x00, 0x00, 0xFF, 0xE2, 0xFF, 0xB5,
+    0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xEC,
+    0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00,
+    0xFF, 0x9C, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x88, 0xFF, 0xF3, 0xFF, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE7, 0x00, 0x00, 0xFF, 0xDD, 0x00, 0x00, 0xFF, 0xF6, 0xFF, 0xF6,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFF, 0xB0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xF6, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x32, 0xFF, 0xF6, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xD8, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE2, 0x00, 0x00,
+    0xFF, 0xF6, 0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFB, 0xFF, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01, 0x00, 0x1D, 0x00, 0x00,
+    0x00, 0x25, 0x00, 0x4D, 0x00, 0x1D, 0x00, 0x54, 0x00, 0x54, 0x00, 0x46,
+    0x00, 0x64, 0x00, 0x71, 0x00, 0x47, 0x00, 0x75, 0x00, 0x75, 0x00, 0x55,
+    0x00, 0x7C, 0x00, 0x7C, 0x00, 0x56, 0x00, 0x80, 0x00, 0xF1, 0x00, 0x57,
+    0x00, 0xF3, 0x00, 0xF3, 0x00, 0xC9, 0x01, 0x03, 0x01, 0x20, 0x00, 0xCA,
+    0x01, 0x23, 0x02, 0x11, 0x00, 0xE8, 0x02, 0x19, 0x02, 0x1F, 0x01, 0xD7,
+    0x02, 0x22, 0x02, 0x22, 0x01, 0xDE, 0x02, 0x69, 0x02, 0x6A, 0x01, 0xDF,
+    0x02, 0x8B, 0x02, 0x8D, 0x01, 0xE1, 0x02, 0x97, 0x02, 0x97, 0x01, 0xE4,
+    0x02, 0x99, 0x02, 0x9A, 0x01, 0xE5, 0x00, 0x02, 0x00, 0x40, 0x00, 0x01,
+    0x00, 0x1A, 0x00, 0x04, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x1D,
+    0x00, 0x1D, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x24, 0x00, 0x03, 0x00, 0x25,
+    0x00, 0x46, 0x00, 0x02, 0x00, 0x47, 0x00, 0x4D, 0x00, 0x03, 0x00, 0x4E,
+    0x00, 0x4E, 0x00, 0x02, 0x00, 0x50, 0x00, 0x52, 0x00, 0x02, 0x00, 0x64,
+    0x00, 0x65, 0x00, 0x11, 0x00, 0x66, 0x00, 0x7F, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0xA3, 0x00, 0x03, 0x00, 0xA4, 0x00, 0xA5, 0x00, 0x02, 0x00, 0xA6,
+    0x00, 0xA6, 0x00, 0x03, 0x00, 0xA7, 0x00, 0xAE, 0x00, 0x02, 0x00, 0xAF,
+    0x00, 0xB9, 0x00, 0x09, 0x00, 0xBA, 0x00, 0xBA, 0x00, 0x0C, 0x00, 0xBB,
+    0x00, 0xBB, 0x00, 0x03, 0x00, 0xBC, 0x00, 0xC2, 0x00, 0x0F, 0x00, 0xC3,
+    0x00, 0xDA, 0x00, 0x06, 0x00, 0xDB, 0x00, 0xDB, 0x00, 0x1B, 0x00, 0xDC,
+    0x00, 0xE0, 0x00, 0x12, 0x00, 0xE1, 0x00, 0xE1, 0x00, 0x1C, 0x00, 0xE2,
+    0x00, 0xEB, 0x00, 0x0B, 0x00, 0xEC, 0x00, 0xF0, 0x00, 0x13, 0x00, 0xF2,
+    0x01, 0x02, 0x00, 0x02, 0x01, 0x03, 0x01, 0x04, 0x00, 0x11, 0x01, 0x05,
+    0x01, 0x06, 0x00, 0x02, 0x01, 0x07, 0x01, 0x20, 0x00, 0x01, 0x01, 0x23,
+    0x01, 0x23, 0x00, 0x08, 0x01, 0x24, 0x01, 0x49, 0x00, 0x01, 0x01, 0x4A,
+    0x01, 0x4A, 0x00, 0x0C, 0x01, 0x4B, 0x01, 0x51, 0x00, 0x10, 0x01, 0x52,
+    0x01, 0x56, 0x00, 0x08, 0x01, 0x69, 0x01, 0x6B, 0x00, 0x14, 0x01, 0x6C,
+    0x01, 0x77, 0x00, 0x08, 0x01, 0x78, 0x01, 0x7B, 0x00, 0x07, 0x01, 0x7D,
+    0x01, 0x80, 0x00, 0x07, 0x01, 0x81, 0x01, 0x81, 0x00, 0x14, 0x01, 0x82,
+    0x01, 0x85, 0x00, 0x07, 0x01, 0x86, 0x01, 0xA9, 0x00, 0x01, 0x01, 0xAA,
+    0x01, 0xAA, 0x00, 0x1E, 0x01, 0xAB, 0x01, 0xAB, 0x00, 0x08, 0x01, 0xAC,
+    0x01, 0xAC, 0x00, 0x01, 0x01, 0xAD, 0x01, 0xB4, 0x00, 0x07, 0x01, 0xB5,
+    0x01, 0xBF, 0x00, 0x0A, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x0C, 0x01, 0xC1,
+    0x01, 0xC8, 0x00, 0x0E, 0x01, 0xC9, 0x01, 0xE0, 0x00, 0x05, 0x01, 0xE1,
+    0x01, 0xE1, 0x00, 0x20, 0x01, 0xE2, 0x01, 0xE6, 0x00, 0x16, 0x01, 0xE7,
+    0x01, 0xE7, 0x00, 0x21, 0x01, 0xE8, 0x01, 0xF1, 0x00, 0x0D, 0x01, 0xF2,
+    0x01, 0xF6, 0x00, 0x15, 0x01, 0xF8, 0x02, 0x11, 0x00, 0x01, 0x02, 0x19,
+    0x02, 0x1F, 0x00, 0x0C, 0x02, 0x22, 0x02, 0x22, 0x00, 0x04, 0x02, 0x24,
+    0x02, 0x24, 0x00, 0x05, 0x02, 0x69, 0x02, 0x69, 0x00, 0x1F, 0x02, 0x6A,
+    0x02, 0x6A, 0x00, 0x1D, 0x02, 0x8B, 0x02, 0x8D, 0x00, 0x17, 0x02, 0x97,
+    0x02, 0x97, 0x00, 0x19, 0x02, 0x98, 0x02, 0x98, 0x00, 0x1A, 0x02, 0x99,
+    0x02, 0x99, 0x00, 0x19, 0x02, 0x9A, 0x02, 0x9A, 0x00, 0x1A, 0x00, 0x02,
+    0x00, 0x57, 0x00, 0x01, 0x00, 0x1A, 0x00, 0x03, 0x00, 0x1B, 0x00, 0x1C,
+    0x00, 0x04, 0x00, 0x1D, 0x00, 0x1D, 0x00, 0x26, 0x00, 0x25, 0x00, 0x25,
+    0x00, 0x01, 0x00, 0x26, 0x00, 0x27, 0x00, 0x18, 0x00, 0x28, 0x00, 0x2C,
+    0x00, 0x01, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x15, 0x00, 0x2F, 0x00, 0x45,
+    0x00, 0x04, 0x00, 0x46, 0x00, 0x46, 0x00, 0x27, 0x00, 0x47, 0x00, 0x4D,
+    0x00, 0x16, 0x00, 0x54, 0x00, 0x54, 0x00, 0x0A, 0x00, 0x64, 0x00, 0x65,
+    0x00, 0x0A, 0x00, 0x66, 0x00, 0x67, 0x00, 0x20, 0x00, 0x68, 0x00, 0x68,
+    0x00, 0x11, 0x00, 0x69, 0x00, 0x69, 0x00, 0x0A, 0x00, 0x6A, 0x00, 0x6E,
+    0x00, 0x11, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x0C, 0x00, 0x70, 0x00, 0x71,
+    0x00, 0x11, 0x00, 0x75, 0x00, 0x75, 0x00, 0x0A, 0x00, 0x7C, 0x00, 0x7C,
+    0x00, 0x0C, 0x00, 0x80, 0x00, 0xA2, 0x00, 0x01, 0x00, 0xA3, 0x00, 0xA3,
+    0x00, 0x04, 0x00, 0xA4, 0x00, 0xA5, 0x00, 0x21, 0x00, 0xA6, 0x00, 0xA6,
+    0x00, 0x01, 0x00, 0xA7, 0x00, 0xAE, 0x00, 0x12, 0x00, 0xAF, 0x00, 0xBA,
+    0x00, 0x0B, 0x00, 0xBB, 0x00, 0xBB, 0x00, 0x01, 0x00, 0xBC, 0x00, 0xC2,
+    0x00, 0x17, 0x00, 0xC3, 0x00, 0xDA, 0x00, 0x05, 0x00, 0xDB, 0x00, 0xDB,
+    0x00, 0x28, 0x00, 0xDC, 0x00, 0xE0, 0x00, 0x1B, 0x00, 0xE1, 0x00, 0xE1,
+    0x00, 0x29, 0x00, 0xE2, 0x00, 0xEB, 0x00, 0x0E, 0x00, 0xEC, 0x00, 0xF0,
+    0x00, 0x18, 0x00, 0xF1, 0x00, 0xF1, 0x00, 0x0A, 0x00, 0xF3, 0x00, 0xF3,
+    0x00, 0x0A, 0x01, 0x03, 0x01, 0x06, 0x00, 0x0A, 0x01, 0x23, 0x01, 0x23,
+    0x00, 0x02, 0x01, 0x24, 0x01, 0x2A, 0x00, 0x19, 0x01, 0x2B, 0x01, 0x2B,
+    0x00, 0x1D, 0x01, 0x2C, 0x01, 0x2C, 0x00, 0x01, 0x01, 0x2D, 0x01, 0x2D,
+    0x00, 0x23, 0x01, 0x2E, 0x01, 0x30, 0x00, 0x1D, 0x01, 0x31, 0x01, 0x31,
+    0x00, 0x15, 0x01, 0x32, 0x01, 0x48, 0x00, 0x06, 0x01, 0x49, 0x01, 0x49,
+    0x00, 0x02, 0x01, 0x4A, 0x01, 0x4A, 0x00, 0x24, 0x01, 0x4B, 0x01, 0x51,
+    0x00, 0x1A, 0x01, 0x52, 0x01, 0x56, 0x00, 0x09, 0x01, 0x57, 0x01, 0x64,
+    0x00, 0x08, 0x01, 0x65, 0x01, 0x65, 0x00, 0x0C, 0x01, 0x66, 0x01, 0x68,
+    0x00, 0x08, 0x01, 0x69, 0x01, 0x6B, 0x00, 0x0C, 0x01, 0x6C, 0x01, 0x6E,
+    0x00, 0x1F, 0x01, 0x6F, 0x01, 0x70, 0x00, 0x0F, 0x01, 0x71, 0x01, 0x71,
+    0x00, 0x23, 0x01, 0x72, 0x01, 0x77, 0x00, 0x0F, 0x01, 0x78, 0x01, 0x81,
+    0x00, 0x09, 0x01, 0x82, 0x01, 0x82, 0x00, 0x0C, 0x01, 0x83, 0x01, 0x85,
+    0x00, 0x09, 0x01, 0x86, 0x01, 0xA8, 0x00, 0x02, 0x01, 0xA9, 0x01, 0xA9,
+    0x00, 0x06, 0x01, 0xAA, 0x01, 0xAB, 0x00, 0x02, 0x01, 0xAC, 0x01, 0xAC,
+    0x00, 0x2A, 0x01, 0xAD, 0x01, 0xB4, 0x00, 0x13, 0x01, 0xB5, 0x01, 0xBF,
+    0x00, 0x0D, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x02, 0x01, 0xC1, 0x01, 0xC8,
+    0x00, 0x14, 0x01, 0xC9, 0x01, 0xE0, 0x00, 0x07, 0x01, 0xE1, 0x01, 0xE1,
+    0x00, 0x2C, 0x01, 0xE2, 0x01, 0xE6, 0x00, 0x1C, 0x01, 0xE7, 0x01, 0xE7,
+    0x00, 0x2D, 0x01, 0xE8, 0x01, 0xF1, 0x00, 0x10, 0x01, 0xF2, 0x01, 0xF6,
+    0x00, 0x15, 0x01, 0xF7, 0x01, 0xF7, 0x00, 0x0C, 0x02, 0x19, 0x02, 0x19,
+    0x00, 0x24, 0x02, 0x1A, 0x02, 0x1B, 0x00, 0x0C, 0x02, 0x1C, 0x02, 0x1C,
+    0x00, 0x0F, 0x02, 0x1D, 0x02, 0x1D, 0x00, 0x0C, 0x02, 0x1E, 0x02, 0x1E,
+    0x00, 0x08, 0x02, 0x1F, 0x02, 0x1F, 0x00, 0x0F, 0x02, 0x22, 0x02, 0x22,
+    0x00, 0x03, 0x02, 0x69, 0x02, 0x6A, 0x00, 0x22, 0x02, 0x8B, 0x02, 0x8D,
+    0x00, 0x1E, 0x02, 0x97, 0x02, 0x97, 0x00, 0x25, 0x02, 0x99, 0x02, 0x99,
+    0x00, 0x25, 0x02, 0x9A, 0x02, 0x9A, 0x00, 0x2B, 0x00, 0x01, 0x02, 0xCA,
+    0x00, 0x04, 0x00, 0x00, 0x01, 0x60, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC,
+    0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xEC, 0x1A, 0xE2,
+    0x1A, 0xD4, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA,
+    0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x1A, 0xAA, 0x19, 0xD8, 0x19, 0xC6,
+    0x19, 0xC6, 0x19, 0xC6, 0x19, 0xB8, 0x19, 0xB8, 0x19, 0x96, 0x19, 0xC6,
+    0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96, 0x19, 0x96,
+    0x19, 0x96, 0x19, 0xC6, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE, 0x1A, 0xBE,
+    0x1A, 0xBE, 0x19, 0x84, 0x19, 0x4A, 0x19, 0x30, 0x19, 0x1E, 0x19, 0x0C,
+    0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C, 0x19, 0x0C,
+    0x1A, 0xBE, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6, 0x18, 0xF6,
+    0x18, 0xF6, 0x18, 0xF6, 0x18, 0xC8, 0x18, 0xBA, 0x18, 0xBA, 0x18, 0xBA,
+    0x18, 0xBA, 0x18, 0xBA, 0x18, 0xB4, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6,
+    0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6, 0x18, 0xA6,
+    0x18, 0xA6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6, 0x19, 0xC6,
+    0x19, 0xC6, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0x8E, 0x18, 0x64, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x18, 0x8E,
+    0x18, 0x52, 0x18, 0x48, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x18, 0x8E, 0x1A, 0xB8, 0x18, 0x8E,
+    0x18, 0x8E, 0x18, 0x36, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C,
+    0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x2C, 0x18, 0x06, 0x17, 0xE0,
+    0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xD2, 0x17, 0xBC,
+    0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE,
+    0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x17, 0xAE, 0x1A, 0xB8, 0x1A, 0xB8,
+    0x1A, 0xB8, 0x1A, 0xB8, 0x1A, 0xB8, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0,
+    0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0xA0, 0x18, 0x52,
+    0x1A, 0xEC, 0x17, 0xA4, 0x17, 0x9E, 0x17, 0x94, 0x17, 0x8A, 0x17, 0x7C,
+    0x17, 0x72, 0x17, 0x6C, 0x17, 0x42, 0x17, 0x3C, 0x17, 0x32, 0x16, 0xCC,
+    0x16, 0x66, 0x16, 0x60, 0x15, 0xDE, 0x15, 0xD0, 0x15, 0xC2, 0x15, 0xBC,
+    0x15, 0x46, 0x11, 0x90, 0x0E, 0x46, 0x0E, 0x34, 0x0B, 0x22, 0x08, 0x20,
+    0x07, 0xFA, 0x07, 0xC4, 0x05, 0x2E, 0x04, 0xB0, 0x04, 0xB0, 0x04, 0xA6,
+    0x04, 0x00, 0x03, 0xF2, 0x03, 0xE4, 0x03, 0xDE, 0x03, 0xD8, 0x03, 0xD2,
+    0x03, 0xC4, 0x00, 0x02, 0x00, 0x29, 0x00, 0x01, 0x00, 0x1A, 0x00, 0x00,
+    0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1A, 0x00, 0x25, 0x00, 0x25, 0x00, 0x1C,
+    0x00, 0x28, 0x00, 0x2E, 0x00, 0x1D, 0x00, 0x47, 0x00, 0x4D, 0x00, 0x24,
+    0x00, 0x53, 0x00, 0x54, 0x00, 0x2B, 0x00, 0x64, 0x00, 0x6E, 0x00, 0x2D,
+    0x00, 0x70, 0x00, 0x71, 0x00, 0x38, 0x00, 0x75, 0x00, 0x75, 0x00, 0x3A,
+    0x00, 0x80, 0x00, 0xA2, 0x00, 0x3B, 0x00, 0xA4, 0x00, 0xAE, 0x00, 0x5E,
+    0x00, 0xBB, 0x00, 0xC2, 0x00, 0x69, 0x00, 0xDB, 0x00, 0xEB, 0x00, 0x71,
+    0x00, 0xF1, 0x00, 0xF1, 0x00, 0x82, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x83,
+    0x01, 0x03, 0x01, 0x20, 0x00, 0x84, 0x01, 0x23, 0x01, 0x23, 0x00, 0xA2,
+    0x01, 0x2C, 0x01, 0x2C, 0x00, 0xA3, 0x01, 0x31, 0x01, 0x56, 0x00, 0xA4,
+    0x01, 0x6C, 0x01, 0x6E, 0x00, 0xCA, 0x01, 0x78, 0x01, 0x81, 0x00, 0xCD,
+    0x01, 0x83, 0x01, 0xB4, 0x00, 0xD7, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0x09,
+    0x01, 0xE1, 0x01, 0xF6, 0x01, 0x0A, 0x01, 0xF8, 0x02, 0x11, 0x01, 0x20,
+    0x02, 0x19, 0x02, 0x19, 0x01, 0x3A, 0x02, 0x22, 0x02, 0x22, 0x01, 0x3B,
+    0x02, 0x26, 0x02, 0x2F, 0x01, 0x3C, 0x02, 0x69, 0x02, 0x6A, 0x01, 0x46,
+    0x02, 0x6F, 0x02, 0x74, 0x01, 0x48, 0x02, 0x76, 0x02, 0x77, 0x01, 0x4E,
+    0x02, 0x85, 0x02, 0x85, 0x01, 0x50, 0x02, 0x89, 0x02, 0x89, 0x01, 0x51,
+    0x02, 0x8B, 0x02, 0x8D, 0x01, 0x52, 0x02, 0x98, 0x02, 0x9A, 0x01, 0x55,
+    0x02, 0xA6, 0x02, 0xA7, 0x01, 0x58, 0x02, 0xC9, 0x02, 0xC9, 0x01, 0x5A,
+    0x02, 0xD4, 0x02, 0xD5, 0x01, 0x5B, 0x02, 0xDD, 0x02, 0xDD, 0x01, 0x5D,
+    0x02, 0xDF, 0x02, 0xDF, 0x01, 0x5E, 0x02, 0xE1, 0x02, 0xE1, 0x01, 0x5F,
+    0x00, 0x03, 0x02, 0x26, 0xFF, 0xCE, 0x02, 0x2E, 0xFF, 0xE2, 0x02, 0x2F,
+    0xFF, 0xD8, 0x00, 0x01, 0x02, 0x2A, 0xFF, 0xB0, 0x00, 0x01, 0x02, 0x27,
+    0xFF, 0xD8, 0x00, 0x01, 0x02, 0x27, 0xFF, 0xEC, 0x00, 0x03, 0x02, 0x27,
+    0xFF, 0xC4, 0x02, 0x28, 0xFF, 0xE2, 0x02, 0x2D, 0xFF, 0xCE, 0x00, 0x03,
+    0x02, 0x26, 0xFF, 0xD8, 0x02, 0x27, 0xFF, 0xE2, 0x02, 0x2A, 0xFF, 0xE2,
+    0x00, 0x29, 0x00, 0xBC, 0xFF, 0xC9, 0x00, 0xBD, 0xFF, 0xC9, 0x00, 0xBE,
+    0xFF, 0xC9, 0x00, 0xBF, 0xFF, 0xC9, 0x00, 0xC0, 0xFF, 0xC9, 0x00, 0xC1,
+    0xFF, 0xC9, 0x00, 0xC2, 0xFF, 0xC9, 0x00, 0xDB, 0xFF, 0xC4, 0x00, 0xDC,
+    0xFF, 0xD8, 0x00, 0xDD, 0xFF, 0xD8, 0x00, 0xDE, 0xFF, 0xD8, 0x00, 0xDF,
+    0xFF, 0xD8, 0x00, 0xE0, 0xFF, 0xD8, 0x00, 0xE2, 0xFF, 0xCE, 0x00, 0xE3,
+    0xFF, 0xCE, 0x00, 0xE4, 0xFF, 0xCE, 0x00, 0xE5, 0xFF, 0xCE, 0x00, 0xE6,
+    0xFF, 0xCE, 0x00, 0xE7, 0xFF, 0xCE, 0x00, 0xE8, 0xFF, 0xCE, 0x00, 0xE9,
+    0xFF, 0xCE, 0x00, 0xEA, 0xFF, 0xCE, 0x00, 0xEB, 0xFF, 0xCE, 0x01, 0x2C,
+    0xFF, 0xF6, 0x01, 0xE1, 0xFF, 0xE2, 0x01, 0xE2, 0xFF, 0xE2, 0x01, 0xE3,
+    0xFF, 0xE2, 0x01, 0xE4, 0xFF, 0xE2, 0x01, 0xE5, 0xFF, 0xE2, 0x01, 0xE6,
+    0xFF, 0xE2, 0x01, 0xE8, 0xFF, 0xE2, 0x01, 0xE9, 0xFF, 0xE2, 0x01, 0xEA,
+    0xFF, 0xE2, 0x01, 0xEB, 0xFF, 0xE2, 0x01, 0xEC, 0xFF, 0xE2, 0x01, 0xED,
+    0xFF, 0xE2, 0x01, 0xEE, 0xFF, 0xE2, 0x01, 0xEF, 0xFF, 0xE2, 0x01, 0xF0,
+    0xFF, 0xE2, 0x01, 0xF1, 0xFF, 0xE2, 0x02, 0x8A, 0xFF, 0xF1, 0x00, 0x02,
+    0x00, 0xDB, 0xFF, 0xFA, 0x01, 0xE7, 0xFF, 0xFD, 0x00, 0x1F, 0x00, 0x01,
+    0xFF, 0xC4, 0x00, 0x02, 0xFF, 0xC4, 0x00, 0x03, 0xFF, 0xC4, 0x00, 0x04,
+    0xFF, 0xC4, 0x00, 0x05, 0xFF, 0xC4, 0x00, 0x06, 0xFF, 0xC4, 0x00, 0x07,
+    0xFF, 0xC4, 0x00, 0x08, 0xFF, 0xC4, 0x00, 0x09, 0xFF, 0xC4, 0x00, 0x0A,
+    0xFF, 0xC4, 0x00, 0x0B, 0xFF, 0xC4, 0x00, 0x0C, 0xFF, 0xC4, 0x00, 0x0D,
+    0xFF, 0xC4, 0x00, 0x0E, 0xFF, 0xC4, 0x00, 0x0F, 0xFF, 0xC4, 0x00, 0x10,
+    0xFF, 0xC4, 0x00, 0x11, 0xFF, 0xC4, 0x00, 0x12, 0xFF, 0xC4, 0x00, 0x13,
+    0xFF, 0xC4, 0x00, 0x14, 0xFF, 0xC4, 0x00, 0x15, 0xFF, 0xC4, 0x00, 0x16,
+    0xFF, 0xC4, 0x00, 0x17, 0xFF, 0xC4, 0x00, 0x18, 0xFF, 0xC4, 0x00, 0x19,
+    0xFF, 0xC4, 0x00, 0x1A, 0xFF, 0xC4, 0x00, 0x64, 0xFF, 0x88, 0x00, 0x65,
+    0xFF, 0x88, 0x01, 0x03, 0xFF, 0x88, 0x01, 0x04, 0xFF, 0x88, 0x02, 0x22,
+    0xFF, 0xC4, 0x00, 0xA5, 0x00, 0x01, 0xFF, 0xB5, 0x00, 0x02, 0xFF, 0xB5,
+    0x00, 0x03, 0xFF, 0xB5, 0x00, 0x04, 0xFF, 0xB5, 0x00, 0x05, 0xFF, 0xB5,
+    0x00, 0x06, 0xFF, 0xB5, 0x00, 0x07, 0xFF, 0xB5, 0x00, 0x08, 0xFF, 0xB5,
+    0x00, 0x09, 0xFF, 0xB5, 0x00, 0x0A, 0xFF, 0xB5, 0x00, 0x0B, 0xFF, 0xB5,
+    0x00, 0x0C, 0xFF, 0xB5, 0x00, 0x0D, 0xFF, 0xB5, 0x00, 0x0E, 0xFF, 0xB5,
+    0x00, 0x0F, 0xFF, 0xB5, 0x00, 0x10, 0xFF, 0xB5, 0x00, 0x11, 0xFF, 0xB5,
+    0x00, 0x12, 0xFF, 0xB5, 0x00, 0x13, 0xFF, 0xB5, 0x00, 0x14, 0xFF, 0xB5,
+    0x00, 0x15, 0xFF, 0xB5, 0x00, 0x16, 0xFF, 0xB5, 0x00, 0x17, 0xFF, 0xB5,
+    0x00, 0x18, 0xFF, 0xB5, 0x00, 0x19, 0xFF, 0xB5, 0x00, 0x1A, 0xFF, 0xB5,
+    0x00, 0x64, 0xFF, 0x9C, 0x00, 0x65, 0xFF, 0x9C, 0x01, 0x03, 0xFF, 0x9C,
+    0x01, 0x04, 0xFF, 0x9C, 0x01, 0x07, 0xFF, 0xD8, 0x01, 0x08, 0xFF, 0xD8,
+    0x01, 0x09, 0xFF, 0xD8, 0x01, 0x0A, 0xFF, 0xD8, 0x01, 0x0B, 0xFF, 0xD8,
+    0x01, 0x0C, 0xFF, 0xD8, 0x01, 0x0D, 0xFF, 0xD8, 0x01, 0x0E, 0xFF, 0xD8,
+    0x01, 0x0F, 0xFF, 0xD8, 0x01, 0x10, 0xFF, 0xD8, 0x01, 0x11, 0xFF, 0xD8,
+    0x01, 0x12, 0xFF, 0xD8, 0x01, 0x13, 0xFF, 0xD8, 0x01, 0x14, 0xFF, 0xD8,
+    0x01, 0x15, 0xFF, 0xD8, 0x01, 0x16, 0xFF, 0xD8, 0x01, 0x17, 0xFF, 0xD8,
+    0x01, 0x18, 0xFF, 0xD8, 0x01, 0x19, 0xFF, 0xD8, 0x01, 0x1A, 0xFF, 0xD8,
+    0x01, 0x1B, 0xFF, 0xD8, 0x01, 0x1C, 0xFF, 0xD8, 0x01, 0x1D, 0xFF, 0xD8,
+    0x01, 0x1E, 0xFF, 0xD8, 0x01, 0x1F, 0xFF, 0xD8, 0x01, 0x20, 0xFF, 0xD8,
+    0x01, 0x24, 0xFF, 0xD8, 0x01, 0x25, 0xFF, 0xD8, 0x01, 0x26, 0xFF, 0xD8,
+    0x01, 0x27, 0xFF, 0xD8, 0x01, 0x28, 0xFF, 0xD8, 0x01, 0x29, 0xFF, 0xD8,
+    0x01, 0x2A, 0xFF, 0xD8, 0x01, 0x2B, 0xFF, 0xD8, 0x01, 0x2C, 0xFF, 0xD8,
+    0x01, 0x2D, 0xFF, 0xD8, 0x01, 0x2E, 0xFF, 0xD8, 0x01, 0x2F, 0xFF, 0xD8,
+    0x01, 0x30, 0xFF, 0xD8, 0x01, 0x31, 0xFF, 0xD8, 0x01, 0x32, 0xFF, 0xD8,
+    0x01, 0x33, 0xFF, 0xD8, 0x01, 0x34, 0xFF, 0xD8, 0x01, 0x35, 0xFF, 0xD8,
+    0x01, 0x36, 0xFF, 0xD8, 0x01, 0x37, 0xFF, 0xD8, 0x01, 0x38, 0xFF, 0xD8,
+    0x01, 0x39, 0xFF, 0xD8, 0x01, 0x3A, 0xFF, 0xD8, 0x01, 0x3B, 0xFF, 0xD8,
+    0x01, 0x3C, 0xFF, 0xD8, 0x01, 0x3D, 0xFF, 0xD8, 0x01, 0x3E, 0xFF, 0xD8,
+    0x01, 0x3F, 0xFF, 0xD8, 0x01, 0x40, 0xFF, 0xD8, 0x01, 0x41, 0xFF, 0xD8,
+    0x01, 0x42, 0xFF, 0xD8, 0x01, 0x43, 0xFF, 0xD8, 0x01, 0x44, 0xFF, 0xD8,
+    0x01, 0x45, 0xFF, 0xD8, 0x01, 0x46, 0xFF, 0xD8, 0x01, 0x47, 0xFF, 0xD8,
+    0x01, 0x48, 0xFF, 0xD8, 0x01, 0x49, 0xFF, 0xD8, 0x01, 0x4B, 0xFF, 0xCE,
+    0x01, 0x4C, 0xFF, 0xCE, 0x01, 0x4D, 0xFF, 0xCE, 0x01, 0x4E, 0xFF, 0xCE,
+    0x01, 0x4F, 0xFF, 0xCE, 0x01, 0x50, 0xFF, 0xCE, 0x01, 0x51, 0xFF, 0xCE,
+    0x01, 0x86, 0xFF, 0xD8, 0x01, 0x87, 0xFF, 0xD8, 0x01, 0x88, 0xFF, 0xD8,
+    0x01, 0x89, 0xFF, 0xD8, 0x01, 0x8A, 0xFF, 0xD8, 0x01, 0x8B, 0xFF, 0xD8,
+    0x01, 0x8C, 0xFF, 0xD8, 0x01, 0x8D, 0xFF, 0xD8, 0x01, 0x8E, 0xFF, 0xD8,
+    0x01, 0x8F, 0xFF, 0xD8, 0x01, 0x90, 0xFF, 0xD8, 0x01, 0x91, 0xFF, 0xD8,
+    0x01, 0x92, 0xFF, 0xD8, 0x01, 0x93, 0xFF, 0xD8, 0x01, 0x94, 0xFF, 0xD8,
+    0x01, 0x95, 0xFF, 0xD8, 0x01, 0x96, 0xFF, 0xD8, 0x01, 0x97, 0xFF, 0xD8,
+    0x01, 0x98, 0xFF, 0xD8, 0x01, 0x99, 0xFF, 0xD8, 0x01, 0x9A, 0xFF, 0xD8,
+    0x01, 0x9B, 0xFF, 0xD8, 0x01, 0x9C, 0xFF, 0xD8, 0x01, 0x9D, 0xFF, 0xD8,
+    0x01, 0x9E, 0xFF, 0xD8, 0x01, 0x9F, 0xFF, 0xD8, 0x01, 0xA0, 0xFF, 0xD8,
+    0x01, 0xA1, 0xFF, 0xD8, 0x01, 0xA2, 0xFF, 0xD8, 0x01, 0xA3, 0xFF, 0xD8,
+    0x01, 0xA4, 0xFF, 0xD8, 0x01, 0xA5, 0xFF, 0xD8, 0x01, 0xA6, 0xFF, 0xD8,
+    0x01, 0xA7, 0xFF, 0xD8, 0x01, 0xA8, 0xFF, 0xD8, 0x01, 0xA9, 0xFF, 0xD8,
+    0x01, 0xAC, 0xFF, 0xD8, 0x01, 0xF8, 0xFF, 0xD8, 0x01, 0xF9, 0xFF, 0xD8,
+    0x01, 0xFA, 0xFF, 0xD8, 0x01, 0xFB, 0xFF, 0xD8, 0x01, 0xFC, 0xFF, 0xD8,
+    0x01, 0xFD, 0xFF, 0xD8, 0x01, 0xFE, 0xFF, 0xD8, 0x01, 0xFF, 0xFF, 0xD8,
+    0x02, 0x00, 0xFF, 0xD8, 0x02, 0x01, 0xFF, 0xD8, 0x02, 0x02, 0xFF, 0xD8,
+    0x02, 0x03, 0xFF, 0xD8, 0x02, 0x04, 0xFF, 0xD8, 0x02, 0x05, 0xFF, 0xD8,
+    0x02, 0x06, 0xFF, 0xD8, 0x02, 0x07, 0xFF, 0xD8, 0x02, 0x08, 0xFF, 0xD8,
+    0x02, 0x09, 0xFF, 0xD8, 0x02, 0x0A, 0xFF, 0xD8, 0x02, 0x0B, 0xFF, 0xD8,
+    0x02, 0x0C, 0xFF, 0xD8, 0x02, 0x0D, 0xFF, 0xD8, 0x02, 0x0E, 0xFF, 0xD8,
+    0x02, 0x0F, 0xFF, 0xD8, 0x02, 0x10, 0xFF, 0xD8, 0x02, 0x11, 0xFF, 0xD8,
+    0x02, 0x22, 0xFF, 0xB5, 0x00, 0x0D, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0x64,
+    0xFF, 0xC4, 0x00, 0x65, 0xFF, 0xC4, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xDB,
+    0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1, 0xFF, 0xB0, 0x00, 0xE2,
+    0xFF, 0x88, 0x01, 0x03, 0xFF, 0xC4, 0x01, 0x04, 0xFF, 0xC4, 0x02, 0x27,
+    0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE, 0x02, 0x81, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x01, 0xFF, 0xCE, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x9C,
+    0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1, 0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88,
+    0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE, 0x02, 0x81, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x01, 0xFF, 0xCE, 0x00, 0x1E, 0xFF, 0xE7, 0x00, 0x1F,
+    0xFF, 0xE7, 0x00, 0x20, 0xFF, 0xE7, 0x00, 0x21, 0xFF, 0xE7, 0x00, 0x22,
+    0xFF, 0xE7, 0x00, 0x23, 0xFF, 0xE7, 0x00, 0x24, 0xFF, 0xE7, 0x00, 0x47,
+    0xFF, 0xE7, 0x00, 0x48, 0xFF, 0xE7, 0x00, 0x49, 0xFF, 0xE7, 0x00, 0x4A,
+    0xFF, 0xE7, 0x00, 0x4B, 0xFF, 0xE7, 0x00, 0x4C, 0xFF, 0xE7, 0x00, 0x4D,
+    0xFF, 0xE7, 0x00, 0x64, 0xFF, 0xCE, 0x00, 0x65, 0xFF, 0xCE, 0x00, 0x80,
+    0xFF, 0xE7, 0x00, 0x81, 0xFF, 0xE7, 0x00, 0x82, 0xFF, 0xE7, 0x00, 0x83,
+    0xFF, 0xE7, 0x00, 0x84, 0xFF, 0xE7, 0x00, 0x85, 0xFF, 0xE7, 0x00, 0x86,
+    0xFF, 0xE7, 0x00, 0x87, 0xFF, 0xE7, 0x00, 0x88, 0xFF, 0xE7, 0x00, 0x89,
+    0xFF, 0xE7, 0x00, 0x8A, 0xFF, 0xE7, 0x00, 0x8B, 0xFF, 0xE7, 0x00, 0x8C,
+    0xFF, 0xE7, 0x00, 0x8D, 0xFF, 0xE7, 0x00, 0x8E, 0xFF, 0xE7, 0x00, 0x8F,
+    0xFF, 0xE7, 0x00, 0x90, 0xFF, 0xE7, 0x00, 0x91, 0xFF, 0xE7, 0x00, 0x92,
+    0xFF, 0xE7, 0x00, 0x93, 0xFF, 0xE7, 0x00, 0x94, 0xFF, 0xE7, 0x00, 0x95,
+    0xFF, 0xE7, 0x00, 0x96, 0xFF, 0xE7, 0x00, 0x97, 0xFF, 0xE7, 0x00, 0x98,
+    0xFF, 0xE7, 0x00, 0x99, 0xFF, 0xE7, 0x00, 0x9A, 0xFF, 0xE7, 0x00, 0x9B,
+    0xFF, 0xE7, 0x00, 0x9C, 0xFF, 0xE7, 0x00, 0x9D, 0xFF, 0xE7, 0x00, 0x9E,
+    0xFF, 0xE7, 0x00, 0x9F, 0xFF, 0xE7, 0x00, 0xA0, 0xFF, 0xE7, 0x00, 0xA1,
+    0xFF, 0xE7, 0x00, 0xA2, 0xFF, 0xE7, 0x00, 0xA3, 0xFF, 0xE7, 0x00, 0xA6,
+    0xFF, 0xE7, 0x00, 0xBB, 0xFF, 0xE7, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xDB,
+    0xFF, 0x9C, 0x00, 0xDC, 0xFF, 0xBA, 0x00, 0xE1, 0xFF, 0xB0, 0x00, 0xE2,
+    0xFF, 0x88, 0x01, 0x03, 0xFF, 0xCE, 0x01, 0x04, 0xFF, 0xCE, 0x01, 0x07,
+    0xFF, 0xE7, 0x01, 0x08, 0xFF, 0xE7, 0x01, 0x09, 0xFF, 0xE7, 0x01, 0x0A,
+    0xFF, 0xE7, 0x01, 0x0B, 0xFF, 0xE7, 0x01, 0x0C, 0xFF, 0xE7, 0x01, 0x0D,
+    0xFF, 0xE7, 0x01, 0x0E, 0xFF, 0xE7, 0x01, 0x0F, 0xFF, 0xE7, 0x01, 0x10,
+    0xFF, 0xE7, 0x01, 0x11, 0xFF, 0xE7, 0x01, 0x12, 0xFF, 0xE7, 0x01, 0x13,
+    0xFF, 0xE7, 0x01, 0x14, 0xFF, 0xE7, 0x01, 0x15, 0xFF, 0xE7, 0x01, 0x16,
+    0xFF, 0xE7, 0x01, 0x17, 0xFF, 0xE7, 0x01, 0x18, 0xFF, 0xE7, 0x01, 0x19,
+    0xFF, 0xE7, 0x01, 0x1A, 0xFF, 0xE7, 0x01, 0x1B, 0xFF, 0xE7, 0x01, 0x1C,
+    0xFF, 0xE7, 0x01, 0x1D, 0xFF, 0xE7, 0x01, 0x1E, 0xFF, 0xE7, 0x01, 0x1F,
+    0xFF, 0xE7, 0x01, 0x20, 0xFF, 0xE7, 0x01, 0x24, 0xFF, 0xE7, 0x01, 0x25,
+    0xFF, 0xE7, 0x01, 0x26, 0xFF, 0xE7, 0x01, 0x27, 0xFF, 0xE7, 0x01, 0x28,
+    0xFF, 0xE7, 0x01, 0x29, 0xFF, 0xE7, 0x01, 0x2A, 0xFF, 0xE7, 0x01, 0x2B,
+    0xFF, 0xE7, 0x01, 0x2C, 0xFF, 0xE7, 0x01, 0x2D, 0xFF, 0xE7, 0x01, 0x2E,
+    0xFF, 0xE7, 0x01, 0x2F, 0xFF, 0xE7, 0x01, 0x30, 0xFF, 0xE7, 0x01, 0x31,
+    0xFF, 0xE7, 0x01, 0x32, 0xFF, 0xE7, 0x01, 0x33, 0xFF, 0xE7, 0x01, 0x34,
+    0xFF, 0xE7, 0x01, 0x35, 0xFF, 0xE7, 0x01, 0x36, 0xFF, 0xE7, 0x01, 0x37,
+    0xFF, 0xE7, 0x01, 0x38, 0xFF, 0xE7, 0x01, 0x39, 0xFF, 0xE7, 0x01, 0x3A,
+    0xFF, 0xE7, 0x01, 0x3B, 0xFF, 0xE7, 0x01, 0x3C, 0xFF, 0xE7, 0x01, 0x3D,
+    0xFF, 0xE7, 0x01, 0x3E, 0xFF, 0xE7, 0x01, 0x3F, 0xFF, 0xE7, 0x01, 0x40,
+    0xFF, 0xE7, 0x01, 0x41, 0xFF, 0xE7, 0x01, 0x42, 0xFF, 0xE7, 0x01, 0x43,
+    0xFF, 0xE7, 0x01, 0x44, 0xFF, 0xE7, 0x01, 0x45, 0xFF, 0xE7, 0x01, 0x46,
+    0xFF, 0xE7, 0x01, 0x47, 0xFF, 0xE7, 0x01, 0x48, 0xFF, 0xE7, 0x01, 0x49,
+    0xFF, 0xE7, 0x01, 0x86, 0xFF, 0xE7, 0x01, 0x87, 0xFF, 0xE7, 0x01, 0x88,
+    0xFF, 0xE7, 0x01, 0x89, 0xFF, 0xE7, 0x01, 0x8A, 0xFF, 0xE7, 0x01, 0x8B,
+    0xFF, 0xE7, 0x01, 0x8C, 0xFF, 0xE7, 0x01, 0x8D, 0xFF, 0xE7, 0x01, 0x8E,
+    0xFF, 0xE7, 0x01, 0x8F, 0xFF, 0xE7, 0x01, 0x90, 0xFF, 0xE7, 0x01, 0x91,
+    0xFF, 0xE7, 0x01, 0x92, 0xFF, 0xE7, 0x01, 0x93, 0xFF, 0xE7, 0x01, 0x94,
+    0xFF, 0xE7, 0x01, 0x95, 0xFF, 0xE7, 0x01, 0x96, 0xFF, 0xE7, 0x01, 0x97,
+    0xFF, 0xE7, 0x01, 0x98, 0xFF, 0xE7, 0x01, 0x99, 0xFF, 0xE7, 0x01, 0x9A,
+    0xFF, 0xE7, 0x01, 0x9B, 0xFF, 0xE7, 0x01, 0x9C, 0xFF, 0xE7, 0x01, 0x9D,
+    0xFF, 0xE7, 0x01, 0x9E, 0xFF, 0xE7, 0x01, 0x9F, 0xFF, 0xE7, 0x01, 0xA0,
+    0xFF, 0xE7, 0x01, 0xA1, 0xFF, 0xE7, 0x01, 0xA2, 0xFF, 0xE7, 0x01, 0xA3,
+    0xFF, 0xE7, 0x01, 0xA4, 0xFF, 0xE7, 0x01, 0xA5, 0xFF, 0xE7, 0x01, 0xA6,
+    0xFF, 0xE7, 0x01, 0xA7, 0xFF, 0xE7, 0x01, 0xA8, 0xFF, 0xE7, 0x01, 0xA9,
+    0xFF, 0xE7, 0x01, 0xAC, 0xFF, 0xE7, 0x01, 0xF8, 0xFF, 0xE7, 0x01, 0xF9,
+    0xFF, 0xE7, 0x01, 0xFA, 0xFF, 0xE7, 0x01, 0xFB, 0xFF, 0xE7, 0x01, 0xFC,
+    0xFF, 0xE7, 0x01, 0xFD, 0xFF, 0xE7, 0x01, 0xFE, 0xFF, 0xE7, 0x01, 0xFF,
+    0xFF, 0xE7, 0x02, 0x00, 0xFF, 0xE7, 0x02, 0x01, 0xFF, 0xE7, 0x02, 0x02,
+    0xFF, 0xE7, 0x02, 0x03, 0xFF, 0xE7, 0x02, 0x04, 0xFF, 0xE7, 0x02, 0x05,
+    0xFF, 0xE7, 0x02, 0x06, 0xFF, 0xE7, 0x02, 0x07, 0xFF, 0xE7, 0x02, 0x08,
+    0xFF, 0xE7, 0x02, 0x09, 0xFF, 0xE7, 0x02, 0x0A, 0xFF, 0xE7, 0x02, 0x0B,
+    0xFF, 0xE7, 0x02, 0x0C, 0xFF, 0xE7, 0x02, 0x0D, 0xFF, 0xE7, 0x02, 0x0E,
+    0xFF, 0xE7, 0x02, 0x0F, 0xFF, 0xE7, 0x02, 0x10, 0xFF, 0xE7, 0x02, 0x11,
+    0xFF, 0xE7, 0x02, 0x27, 0xFF, 0xD8, 0x02, 0x28, 0xFF, 0xCE, 0x02, 0x81,
+    0x00, 0x00, 0x00, 0xC4, 0x00, 0x1E, 0xFF, 0xE2, 0x00, 0x1F, 0xFF, 0xE2,
+    0x00, 0x20, 0xFF, 0xE2, 0x00, 0x21, 0xFF, 0xE2, 0x00, 0x22, 0xFF, 0xE2,
+    0x00, 0x23, 0xFF, 0xE2, 0x00, 0x24, 0xFF, 0xE2, 0x00, 0x47, 0xFF, 0xE2,
+    0x00, 0x48, 0xFF, 0xE2, 0x00, 0x49, 0xFF, 0xE2, 0x00, 0x4A, 0xFF, 0xE2,
+    0x00, 0x4B, 0xFF, 0xE2, 0x00, 0x4C, 0xFF, 0xE2, 0x00, 0x4D, 0xFF, 0xE2,
+    0x00, 0x64, 0xFF, 0xD8, 0x00, 0x65, 0xFF, 0xD8, 0x00, 0x80, 0xFF, 0xE2,
+    0x00, 0x81, 0xFF, 0xE2, 0x00, 0x82, 0xFF, 0xE2, 0x00, 0x83, 0xFF, 0xE2,
+    0x00, 0x84, 0xFF, 0xE2, 0x00, 0x85, 0xFF, 0xE2, 0x00, 0x86, 0xFF, 0xE2,
+    0x00, 0x87, 0xFF, 0xE2, 0x00, 0x88, 0xFF, 0xE2, 0x00, 0x89, 0xFF, 0xE2,
+    0x00, 0x8A, 0xFF, 0xE2, 0x00, 0x8B, 0xFF, 0xE2, 0x00, 0x8C, 0xFF, 0xE2,
+    0x00, 0x8D, 0xFF, 0xE2, 0x00, 0x8E, 0xFF, 0xE2, 0x00, 0x8F, 0xFF, 0xE2,
+    0x00, 0x90, 0xFF, 0xE2, 0x00, 0x91, 0xFF, 0xE2, 0x00, 0x92, 0xFF, 0xE2,
+    0x00, 0x93, 0xFF, 0xE2, 0x00, 0x94, 0xFF, 0xE2, 0x00, 0x95, 0xFF, 0xE2,
+    0x00, 0x96, 0xFF, 0xE2, 0x00, 0x97, 0xFF, 0xE2, 0x00, 0x98, 0xFF, 0xE2,
+    0x00, 0x99, 0xFF, 0xE2, 0x00, 0x9A, 0xFF, 0xE2, 0x00, 0x9B, 0xFF, 0xE2,
+    0x00, 0x9C, 0xFF, 0xE2, 0x00, 0x9D, 0xFF, 0xE2, 0x00, 0x9E, 0xFF, 0xE2,
+    0x00, 0x9F, 0xFF, 0xE2, 0x00, 0xA0, 0xFF, 0xE2, 0x00, 0xA1, 0xFF, 0xE2,
+    0x00, 0xA2, 0xFF, 0xE2, 0x00, 0xA3, 0xFF, 0xE2, 0x00, 0xA6, 0xFF, 0xE2,
+    0x00, 0xBB, 0xFF, 0xE2, 0x01, 0x03, 0xFF, 0xD8, 0x01, 0x04, 0xFF, 0xD8,
+    0x01, 0x07, 0xFF, 0xE7, 0x01, 0x08, 0xFF, 0xE7, 0x01, 0x09, 0xFF, 0xE7,
+    0x01, 0x0A, 0xFF, 0xE7, 0x01, 0x0B, 0xFF, 0xE7, 0x01, 0x0C, 0xFF, 0xE7,
+    0x01, 0x0D, 0xFF, 0xE7, 0x01, 0x0E, 0xFF, 0xE7, 0x01, 0x0F, 0xFF, 0xE7,
+    0x01, 0x10, 0xFF, 0xE7, 0x01, 0x11, 0xFF, 0xE7, 0x01, 0x12, 0xFF, 0xE7,
+    0x01, 0x13, 0xFF, 0xE7, 0x01, 0x14, 0xFF, 0xE7, 0x01, 0x15, 0xFF, 0xE7,
+    0x01, 0x16, 0xFF, 0xE7, 0x01, 0x17, 0xFF, 0xE7, 0x01, 0x18, 0xFF, 0xE7,
+    0x01, 0x19, 0xFF, 0xE7, 0x01, 0x1A, 0xFF, 0xE7, 0x01, 0x1B, 0xFF, 0xE7,
+    0x01, 0x1C, 0xFF, 0xE7, 0x01, 0x1D, 0xFF, 0xE7, 0x01, 0x1E, 0xFF, 0xE7,
+    0x01, 0x1F, 0xFF, 0xE7, 0x01, 0x20, 0xFF, 0xE7, 0x01, 0x24, 0xFF, 0xE7,
+    0x01, 0x25, 0xFF, 0xE7, 0x01, 0x26, 0xFF, 0xE7, 0x01, 0x27, 0xFF, 0xE7,
+    0x01, 0x28, 0xFF, 0xE7, 0x01, 0x29, 0xFF, 0xE7, 0x01, 0x2A, 0xFF, 0xE7,
+    0x01, 0x2B, 0xFF, 0xE7, 0x01, 0x2C, 0xFF, 0xE7, 0x01, 0x2D, 0xFF, 0xE7,
+    0x01, 0x2E, 0xFF, 0xE7, 0x01, 0x2F, 0xFF, 0xE7, 0x01, 0x30, 0xFF, 0xE7,
+    0x01, 0x31, 0xFF, 0xE7, 0x01, 0x32, 0xFF, 0xE7, 0x01, 0x33, 0xFF, 0xE7,
+    0x01, 0x34, 0xFF, 0xE7, 0x01, 0x35, 0xFF, 0xE7, 0x01, 0x36, 0xFF, 0xE7,
+    0x01, 0x37, 0xFF, 0xE7, 0x01, 0x38, 0xFF, 0xE7, 0x01, 0x39, 0xFF, 0xE7,
+    0x01, 0x3A, 0xFF, 0xE7, 0x01, 0x3B, 0xFF, 0xE7, 0x01, 0x3C, 0xFF, 0xE7,
+    0x01, 0x3D, 0xFF, 0xE7, 0x01, 0x3E, 0xFF, 0xE7, 0x01, 0x3F, 0xFF, 0xE7,
+    0x01, 0x40, 0xFF, 0xE7, 0x01, 0x41, 0xFF, 0xE7, 0x01, 0x42, 0xFF, 0xE7,
+    0x01, 0x43, 0xFF, 0xE7, 0x01, 0x44, 0xFF, 0xE7, 0x01, 0x45, 0xFF, 0xE7,
+    0x01, 0x46, 0xFF, 0xE7, 0x01, 0x47, 0xFF, 0xE7, 0x01, 0x48, 0xFF, 0xE7,
+    0x01, 0x49, 0xFF, 0xE7, 0x01, 0x4B, 0xFF, 0xE8, 0x01, 0x4C, 0xFF, 0xE8,
+    0x01, 0x4D, 0xFF, 0xE8, 0x01, 0x4E, 0xFF, 0xE8, 0x01, 0x4F, 0xFF, 0xE8,
+    0x01, 0x50, 0xFF, 0xE8, 0x01, 0x51, 0xFF, 0xE8, 0x01, 0x69, 0x00, 0x1E,
+    0x01, 0x6A, 0x00, 0x1E, 0x01, 0x6B, 0x00, 0x1E, 0x01, 0x81, 0x00, 0x1E,
+    0x01, 0x86, 0xFF, 0xE7, 0x01, 0x87, 0xFF, 0xE7, 0x01, 0x88, 0xFF, 0xE7,
+    0x01, 0x89, 0xFF, 0xE7, 0x01, 0x8A, 0xFF, 0xE7, 0x01, 0x8B, 0xFF, 0xE7,
+    0x01, 0x8C, 0xFF, 0xE7, 0x01, 0x8D, 0xFF, 0xE7, 0x01, 0x8E, 0xFF, 0xE7,
+    0x01, 0x8F, 0xFF, 0xE7, 0x01, 0x90, 0xFF, 0xE7, 0x01, 0x91, 0xFF, 0xE7,
+    0x01, 0x92, 0xFF, 0xE7, 0x01, 0x93, 0xFF, 0xE7, 0x01, 0x94, 0xFF, 0xE7,
+    0x01, 0x95, 0xFF, 0xE7, 0x01, 0x96, 0xFF, 0xE7, 0x01, 0x97, 0xFF, 0xE7,
+    0x01, 0x98, 0xFF, 0xE7, 0x01, 0x99, 0xFF, 0xE7, 0x01, 0x9A, 0xFF, 0xE7,
+    0x01, 0x9B, 0xFF, 0xE7, 0x01, 0x9C, 0xFF, 0xE7, 0x01, 0x9D, 0xFF, 0xE7,
+    0x01, 0x9E, 0xFF, 0xE7, 0x01, 0x9F, 0xFF, 0xE7, 0x01, 0xA0, 0xFF, 0xE7,
+    0x01, 0xA1, 0xFF, 0xE7, 0x01, 0xA2, 0xFF, 0xE7, 0x01, 0xA3, 0xFF, 0xE7,
+    0x01, 0xA4, 0xFF, 0xE7, 0x01, 0xA5, 0xFF, 0xE7, 0x01, 0xA6, 0xFF, 0xE7,
+    0x01, 0xA7, 0xFF, 0xE7, 0x01, 0xA8, 0xFF, 0xE7, 0x01, 0xA9, 0xFF, 0xE7,
+    0x01, 0xAA, 0x00, 0x1E, 0x01, 0xAB, 0x00, 0x0F, 0x01, 0xAC, 0xFF, 0xE7,
+    0x01, 0xF8, 0xFF, 0xE7, 0x01, 0xF9, 0xFF, 0xE7, 0x01, 0xFA, 0xFF, 0xE7,
+    0x01, 0xFB, 0xFF, 0xE7, 0x01, 0xFC, 0xFF, 0xE7, 0x01, 0xFD, 0xFF, 0xE7,
+    0x01, 0xFE, 0xFF, 0xE7, 0x01, 0xFF, 0xFF, 0xE7, 0x02, 0x00, 0xFF, 0xE7,
+    0x02, 0x01, 0xFF, 0xE7, 0x02, 0x02, 0xFF, 0xE7, 0x02, 0x03, 0xFF, 0xE7,
+    0x02, 0x04, 0xFF, 0xE7, 0x02, 0x05, 0xFF, 0xE7, 0x02, 0x06, 0xFF, 0xE7,
+    0x02, 0x07, 0xFF, 0xE7, 0x02, 0x08, 0xFF, 0xE7, 0x02, 0x09, 0xFF, 0xE7,
+    0x02, 0x0A, 0xFF, 0xE7, 0x02, 0x0B, 0xFF, 0xE7, 0x02, 0x0C, 0xFF, 0xE7,
+    0x02, 0x0D, 0xFF, 0xE7, 0x02, 0x0E, 0xFF, 0xE7, 0x02, 0x0F, 0xFF, 0xE7,
+    0x02, 0x10, 0xFF, 0xE7, 0x02, 0x11, 0xFF, 0xE7, 0x00, 0x04, 0x00, 0xDB,
+    0xFF, 0xE3, 0x01, 0x2C, 0xFF, 0xDE, 0x01, 0xAB, 0x00, 0x08, 0x01, 0xE1,
+    0xFF, 0xEB, 0x00, 0xD2, 0x00, 0x1E, 0xFF, 0xCE, 0x00, 0x1F, 0xFF, 0xCE,
+    0x00, 0x20, 0xFF, 0xCE, 0x00, 0x21, 0xFF, 0xCE, 0x00, 0x22, 0xFF, 0xCE,
+    0x00, 0x23, 0xFF, 0xCE, 0x00, 0x24, 0xFF, 0xCE, 0x00, 0x47, 0xFF, 0xCE,
+    0x00, 0x48, 0xFF, 0xCE, 0x00, 0x49, 0xFF, 0xCE, 0x00, 0x4A, 0xFF, 0xCE,
+    0x00, 0x4B, 0xFF, 0xCE, 0x00, 0x4C, 0xFF, 0xCE, 0x00, 0x4D, 0xFF, 0xCE,
+    0x00, 0x80, 0xFF, 0xCE, 0x00, 0x81, 0xFF, 0xCE, 0x00, 0x82, 0xFF, 0xCE,
+    0x00, 0x83, 0xFF, 0xCE, 0x00, 0x84, 0xFF, 0xCE, 0x00, 0x85, 0xFF, 0xCE,
+    0x00, 0x86, 0xFF, 0xCE, 0x00, 0x87, 0xFF, 0xCE, 0x00, 0x88, 0xFF, 0xCE,
+    0x00, 0x89, 0xFF, 0xCE, 0x00, 0x8A, 0xFF, 0xCE, 0x00, 0x8B, 0xFF, 0xCE,
+    0x00, 0x8C, 0xFF, 0xCE, 0x00, 0x8D, 0xFF, 0xCE, 0x00, 0x8E, 0xFF, 0xCE,
+    0x00, 0x8F, 0xFF, 0xCE, 0x00, 0x90, 0xFF, 0xCE, 0x00, 0x91, 0xFF, 0xCE,
+    0x00, 0x92, 0xFF, 0xCE, 0x00, 0x93, 0xFF, 0xCE, 0x00, 0x94, 0xFF, 0xCE,
+    0x00, 0x95, 0xFF, 0xCE, 0x00, 0x96, 0xFF, 0xCE, 0x00, 0x97, 0xFF, 0xCE,
+    0x00, 0x98, 0xFF, 0xCE, 0x00, 0x99, 0xFF, 0xCE, 0x00, 0x9A, 0xFF, 0xCE,
+    0x00, 0x9B, 0xFF, 0xCE, 0x00, 0x9C, 0xFF, 0xCE, 0x00, 0x9D, 0xFF, 0xCE,
+    0x00, 0x9E, 0xFF, 0xCE, 0x00, 0x9F, 0xFF, 0xCE, 0x00, 0xA0, 0xFF, 0xCE,
+    0x00, 0xA1, 0xFF, 0xCE, 0x00, 0xA2, 0xFF, 0xCE, 0x00, 0xA3, 0xFF, 0xCE,
+    0x00, 0xA6, 0xFF, 0xCE, 0x00, 0xBB, 0xFF, 0xCE, 0x00, 0xBC, 0xFF, 0xC4,
+    0x00, 0xBD, 0xFF, 0xC4, 0x00, 0xBE, 0xFF, 0xC4, 0x00, 0xBF, 0xFF, 0xC4,
+    0x00, 0xC0, 0xFF, 0xC4, 0x00, 0xC1, 0xFF, 0xC4, 0x00, 0xC2, 0xFF, 0xC4,
+    0x00, 0xDB, 0xFF, 0xD8, 0x00, 0xDC, 0xFF, 0xD8, 0x00, 0xDD, 0xFF, 0xD8,
+    0x00, 0xDE, 0xFF, 0xD8, 0x00, 0xDF, 0xFF, 0xD8, 0x00, 0xE0, 0xFF, 0xD8,
+    0x00, 0xE2, 0xFF, 0xB0, 0x00, 0xE3, 0xFF, 0xB0, 0x00, 0xE4, 0xFF, 0xB0,
+    0x00, 0xE5, 0xFF, 0xB0, 0x00, 0xE6, 0xFF, 0xB0, 0x00, 0xE7, 0xFF, 0xB0,
+    0x00, 0xE8, 0xFF, 0xB0, 0x00, 0xE9, 0xFF, 0xB0, 0x00, 0xEA, 0xFF, 0xB0,
+    0x00, 0xEB, 0xFF, 0xB0, 0x01, 0x07, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00,
+    0x01, 0x09, 0x00, 0x00, 0x01, 0x0A, 0x00, 0x00, 0x01, 0x0B, 0x00, 0x00,
+    0x01, 0x0C, 0x00, 0x00, 0x01, 0x0D, 0x00, 0x00, 0x01, 0x0E, 0x00, 0x00,
+    0x01, 0x0F, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x01, 0x11, 0x00, 0x00,
+    0x01, 0x12, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00,
+    0x01, 0x15, 0x00, 0x00, 0x01, 0x16, 0x00, 0x00, 0x01, 0x17, 0x00, 0x00,
+    0x01, 0x18, 0x00, 0x00, 0x01, 0x19, 0x00, 0x00, 0x01, 0x1A, 0x00, 0x00,
+    0x01, 0x1B, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x00, 0x01, 0x1D, 0x00, 0x00,
+    0x01, 0x1E, 0x00, 0x00, 0x01, 0x1F, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00,
+    0x01, 0x24, 0x00, 0x00, 0x01, 0x25, 0x00, 0x00, 0x01, 0x26, 0x00, 0x00,
+    0x01, 0x27, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x01, 0x29, 0x00, 0x00,
+    0x01, 0x2A, 0x00, 0x00, 0x01, 0x2B, 0x00, 0x00, 0x01, 0x2C, 0xFF, 0xEA,
+    0x01, 0x2D, 0x00, 0x00, 0x01, 0x2E, 0x00, 0x00, 0x01, 0x2F, 0x00, 0x00,
+    0x01, 0x30, 0x00, 0x00, 0x01, 0x31, 0x00, 0x00, 0x01, 0x32, 0x00, 0x00,
+    0x01, 0x33, 0x00, 0x00, 0x01, 0x34, 0x00, 0x00, 0x01, 0x35, 0x00, 0x00,
+    0x01, 0x36, 0x00, 0x00, 0x01, 0x37, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00,
+    0x01, 0x39, 0x00, 0x00, 0x01, 0x3A, 0x00, 0x00, 0x01, 0x3B, 0x00, 0x00,
+    0x01, 0x3C, 0x00, 0x00, 0x01, 0x3D, 0x00, 0x00, 0x01, 0x3E, 0x00, 0x00,
+    0x01, 0x3F, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00,
+    0x01, 0x42, 0x00, 0x00, 0x01, 0x43, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00,
+    0x01, 0x45, 0x00, 0x00, 0x01, 0x46, 0x00, 0x00, 0x01, 0x47, 0x00, 0x00,
+    0x01, 0x48, 0x00, 0x00, 0x01, 0x49, 0x00, 0x00, 0x01, 0x69, 0x00, 0x3C,
+    0x01, 0x6A, 0x00, 0x3C, 0x01, 0x6B, 0x00, 0x3C, 0x01, 0x81, 0x00, 0x3C,
+    0x01, 0x86, 0x00, 0x00, 0x01, 0x87, 0x00, 0x00, 0x01, 0x88, 0x00, 0x00,
+    0x01, 0x89, 0x00, 0x00, 0x01, 0x8A, 0x00, 0x00, 0x01, 0x8B, 0x00, 0x00,
+    0x01, 0x8C, 0x00, 0x00, 0x01, 0x8D, 0x00, 0x00, 0x01, 0x8E, 0x00, 0x00,
+    0x01, 0x8F, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x91, 0x00, 0x00,
+    0x01, 0x92, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0x01, 0x94, 0x00, 0x00,
+    0x01, 0x95, 0x00, 0x00, 0x01, 0x96, 0x00, 0x00, 0x01, 0x97, 0x00, 0x00,
+    0x01, 0x98, 0x00, 0x00, 0x01, 0x99, 0x00, 0x00, 0x01, 0x9A, 0x00, 0x00,
+    0x01, 0x9B, 0x00, 0x00, 0x01, 0x9C, 0x00, 0x00, 0x01, 0x9D, 0x00, 0x00,
+    0x01, 0x9E, 0x00, 0x00, 0x01, 0x9F, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00,
+    0x01, 0xA1, 0x00, 0x00, 0x01, 0xA2, 0x00, 0x00, 0x01, 0xA3, 0x00, 0x00,
+    0x01, 0xA4, 0x00, 0x00, 0x01, 0xA5, 0x00, 0x00, 0x01, 0xA6, 0x00, 0x00,
+    0x01, 0xA7, 0x00, 0x00, 0x01, 0xA8, 0x00, 0x00, 0x01, 0xA9, 0x00, 0x00,
+    0x01, 0xAC, 0x00, 0x00, 0x01, 0xC0, 0xFF, 0xFA, 0x01, 0xE1, 0xFF, 0xF9,
+    0x01, 0xE7, 0xFF, 0xFF, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF9, 0x00, 0x00,
+    0x01, 0xFA, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00,
+    0x01, 0xFD, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
+    0x02, 0x03, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00,
+    0x02, 0x06, 0x00, 0x00, 0x02, 0x07, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00,
+    0x02, 0x09, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x00, 0x02, 0x0B, 0x00, 0x00,
+    0x02, 0x0C, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x00, 0x02, 0x0E, 0x00, 0x00,
+    0x02, 0x0F, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x02, 0x11, 0x00, 0x00,
+    0x02, 0x77, 0xFF, 0xA4, 0x00, 0xED, 0x00, 0x01, 0xFF, 0x9C, 0x00, 0x02,
+    0xFF, 0x9C, 0x00, 0x03, 0xFF, 0x9C, 0x00, 0x04, 0xFF, 0x9C, 0x00, 0x05,
+    0xFF, 0x9C, 0x00, 0x06, 0xFF, 0x9C, 0x00, 0x07, 0xFF, 0x9C, 0x00, 0x08,
+    0xFF, 0x9C, 0x00, 0x09, 0xFF, 0x9C, 0x00, 0x0A, 0xFF, 0x9C, 0x00, 0x0B,
+    0xFF, 0x9C, 0x00, 0x0C, 0xFF, 0x9C, 0x00, 0x0D, 0xFF, 0x9C, 0x00, 0x0E,
+    0xFF, 0x9C, 0x00, 0x0F, 0xFF, 0x9C, 0x00, 0x10, 0xFF, 0x9C, 0x00, 0x11,
+    0xFF, 0x9C, 0x00, 0x12, 0xFF, 0x9C, 0x00, 0x13, 0xFF, 0x9C, 0x00, 0x14,
+    0xFF, 0x9C, 0x00, 0x15, 0xFF, 0x9C, 0x00, 0x16, 0xFF, 0x9C, 0x00, 0x17,
+    0xFF, 0x9C, 0x00, 0x18, 0xFF, 0x9C, 0x00, 0x19, 0xFF, 0x9C, 0x00, 0x1A,
+    0xFF, 0x9C, 0x00, 0x1E, 0xFF, 0xD8, 0x00, 0x1F, 0xFF, 0xD8, 0x00, 0x20,
+    0xFF, 0xD8, 0x00, 0x21, 0xFF, 0xD8, 0x00, 0x22, 0xFF, 0xD8, 0x00, 0x23,
+    0xFF, 0xD8, 0x00, 0x24, 0xFF, 0xD8, 0x00, 0x47, 0xFF, 0xD8, 0x00, 0x48,
+    0xFF, 0xD8, 0x00, 0x49, 0xFF, 0xD8, 0x00, 0x4A, 0xFF, 0xD8, 0x00, 0x4B,
+    0xFF, 0xD8, 0x00, 0x4C, 0xFF, 0xD8, 0x00, 0x4D, 0xFF, 0xD8, 0x00, 0x64,
+    0xFF, 0xCE, 0x00, 0x65, 0xFF, 0xCE, 0x00, 0x80, 0xFF, 0xD8, 0x00, 0x81,
+    0xFF, 0xD8, 0x00, 0x82, 0xFF, 0xD8, 0x00, 0x83, 0xFF, 0xD8, 0x00, 0x84,
+    0xFF, 0xD8, 0x00, 0x85, 0xFF, 0xD8, 0x00, 0x86, 0xFF, 0xD8, 0x00, 0x87,
+    0xFF, 0xD8, 0x00, 0x88, 0xFF, 0xD8, 0x00, 0x89, 0xFF, 0xD8, 0x00, 0x8A,
+    0xFF, 0xD8, 0x00, 0x8B, 0xFF, 0xD8, 0x00, 0x8C, 0xFF, 0xD8, 0x00, 0x8D,
+    0xFF, 0xD8, 0x00, 0x8E, 0xFF, 0xD8, 0x00, 0x8F, 0xFF, 0xD8, 0x00, 0x90,
+    0xFF, 0xD8, 0x00, 0x91, 0xFF, 0xD8, 0x00, 0x92, 0xFF, 0xD8, 0x00, 0x93,
+    0xFF, 0xD8, 0x00, 0x94, 0xFF, 0xD8, 0x00, 0x95, 0xFF, 0xD8, 0x00, 0x96,
+    0xFF, 0xD8, 0x00, 0x97, 0xFF, 0xD8, 0x00, 0x98, 0xFF, 0xD8, 0x00, 0x99,
+    0xFF, 0xD8, 0x00, 0x9A, 0xFF, 0xD8, 0x00, 0x9B, 0xFF, 0xD8, 0x00, 0x9C,
+    0xFF, 0xD8, 0x00, 0x9D, 0xFF, 0xD8, 0x00, 0x9E, 0xFF, 0xD8, 0x00, 0x9F,
+    0xFF, 0xD8, 0x00, 0xA0, 0xFF, 0xD8, 0x00, 0xA1, 0xFF, 0xD8, 0x00, 0xA2,
+    0xFF, 0xD8, 0x00, 0xA3, 0xFF, 0xD8, 0x00, 0xA6, 0xFF, 0xD8, 0x00, 0xBB,
+    0xFF, 0xD8, 0x01, 0x03, 0xFF, 0xCE, 0x01, 0x04, 0xFF, 0xCE, 0x01, 0x07,
+    0xFF, 0xCE, 0x01, 0x08, 0xFF, 0xCE, 0x01, 0x09, 0xFF, 0xCE, 0x01, 0x0A,
+    0xFF, 0xCE, 0x01, 0x0B, 0xFF, 0xCE, 0x01, 0x0C, 0xFF, 0xCE, 0x01, 0x0D,
+    0xFF, 0xCE, 0x01, 0x0E, 0xFF, 0xCE, 0x01, 0x0F, 0xFF, 0xCE, 0x01, 0x10,
+    0xFF, 0xCE, 0x01, 0x11, 0xFF, 0xCE, 0x01, 0x12, 0xFF, 0xCE, 0x01, 0x13,
+    0xFF, 0xCE, 0x01, 0x14, 0xFF, 0xCE, 0x01, 0x15, 0xFF, 0xCE, 0x01, 0x16,
+    0xFF, 0xCE, 0x01, 0x17, 0xFF, 0xCE, 0x01, 0x18, 0xFF, 0xCE, 0x01, 0x19,
+    0xFF, 0xCE, 0x01, 0x1A, 0xFF, 0xCE, 0x01, 0x1B, 0xFF, 0xCE, 0x01, 0x1C,
+    0xFF, 0xCE, 0x01, 0x1D, 0xFF, 0xCE, 0x01, 0x1E, 0xFF, 0xCE, 0x01, 0x1F,
+    0xFF, 0xCE, 0x01, 0x20, 0xFF, 0xCE, 0x01, 0x24, 0xFF, 0xCE, 0x01, 0x25,
+    0xFF, 0xCE, 0x01, 0x26, 0xFF, 0xCE, 0x01, 0x27, 0xFF, 0xCE, 0x01, 0x28,
+    0xFF, 0xCE, 0x01, 0x29, 0xFF, 0xCE, 0x01, 0x2A, 0xFF, 0xCE, 0x01, 0x2B,
+    0xFF, 0xCE, 0x01, 0x2C, 0xFF, 0xE0, 0x01, 0x2D, 0xFF, 0xCE, 0x01, 0x2E,
+    0xFF, 0xCE, 0x01, 0x2F, 0xFF, 0xCE, 0x01, 0x30, 0xFF, 0xCE, 0x01, 0x31,
+    0xFF, 0xCE, 0x01, 0x32, 0xFF, 0xCE, 0x01, 0x33, 0xFF, 0xCE, 0x01, 0x34,
+    0xFF, 0xCE, 0x01, 0x35, 0xFF, 0xCE, 0x01, 0x36, 0xFF, 0xCE, 0x01, 0x37,
+    0xFF, 0xCE, 0x01, 0x38, 0xFF, 0xCE, 0x01, 0x39, 0xFF, 0xCE, 0x01, 0x3A,
+    0xFF, 0xCE, 0x01, 0x3B, 0xFF, 0xCE, 0x01, 0x3C, 0xFF, 0xCE, 0x01, 0x3D,
+    0xFF, 0xCE, 0x01, 0x3E, 0xFF, 0xCE, 0x01, 0x3F, 0xFF, 0xCE, 0x01, 0x40,
+    0xFF, 0xCE, 0x01, 0x41, 0xFF, 0xCE, 0x01, 0x42, 0xFF, 0xCE, 0x01, 0x43,
+    0xFF, 0xCE, 0x01, 0x44, 0xFF, 0xCE, 0x01, 0x45, 0xFF, 0xCE, 0x01, 0x46,
+    0xFF, 0xCE, 0x01, 0x47, 0xFF, 0xCE, 0x01, 0x48, 0xFF, 0xCE, 0x01, 0x49,
+    0xFF, 0xCE, 0x01, 0x4B, 0xFF, 0xCE, 0x01, 0x4C, 0xFF, 0xCE, 0x01, 0x4D,
+    0xFF, 0xCE, 0x01, 0x4E, 0xFF, 0xCE, 0x01, 0x4F, 0xFF, 0xCE, 0x01, 0x50,
+    0xFF, 0xCE, 0x01, 0x51, 0xFF, 0xCE, 0x01, 0x86, 0xFF, 0xCE, 0x01, 0x87,
+    0xFF, 0xCE, 0x01, 0x88, 0xFF, 0xCE, 0x01, 0x89, 0xFF, 0xCE, 0x01, 0x8A,
+    0xFF, 0xCE, 0x01, 0x8B, 0xFF, 0xCE, 0x01, 0x8C, 0xFF, 0xCE, 0x01, 0x8D,
+    0xFF, 0xCE, 0x01, 0x8E, 0xFF, 0xCE, 0x01, 0x8F, 0xFF, 0xCE, 0x01, 0x90,
+    0xFF, 0xCE, 0x01, 0x91, 0xFF, 0xCE, 0x01, 0x92, 0xFF, 0xCE, 0x01, 0x93,
+    0xFF, 0xCE, 0x01, 0x94, 0xFF, 0xCE, 0x01, 0x95, 0xFF, 0xCE, 0x01, 0x96,
+    0xFF, 0xCE, 0x01, 0x97, 0xFF, 0xCE, 0x01, 0x98, 0xFF, 0xCE, 0x01, 0x99,
+    0xFF, 0xCE, 0x01, 0x9A, 0xFF, 0xCE, 0x01, 0x9B, 0xFF, 0xCE, 0x01, 0x9C,
+    0xFF, 0xCE, 0x01, 0x9D, 0xFF, 0xCE, 0x01, 0x9E, 0xFF, 0xCE, 0x01, 0x9F,
+    0xFF, 0xCE, 0x01, 0xA0, 0xFF, 0xCE, 0x01, 0xA1, 0xFF, 0xCE, 0x01, 0xA2,
+    0xFF, 0xCE, 0x01, 0xA3, 0xFF, 0xCE, 0x01, 0xA4, 0xFF, 0xCE, 0x01, 0xA5,
+    0xFF, 0xCE, 0x01, 0xA6, 0xFF, 0xCE, 0x01, 0xA7, 0xFF, 0xCE, 0x01, 0xA8,
+    0xFF, 0xCE, 0x01, 0xA9, 0xFF, 0xCE, 0x01, 0xAC, 0xFF, 0xCE, 0x01, 0xB5,
+    0xFF, 0xE2, 0x01, 0xB6, 0xFF, 0xE2, 0x01, 0xB7, 0xFF, 0xE2, 0x01, 0xB8,
+    0xFF, 0xE2, 0x01, 0xB9, 0xFF, 0xE2, 0x01, 0xBA, 0xFF, 0xE2, 0x01, 0xBB,
+    0xFF, 0xE2, 0x01, 0xBC, 0xFF, 0xE2, 0x01, 0xBD, 0xFF, 0xE2, 0x01, 0xBE,
+    0xFF, 0xE2, 0x01, 0xBF, 0xFF, 0xE2, 0x01, 0xC0, 0xFF, 0xF4, 0x01, 0xE1,
+    0xFF, 0xFF, 0x01, 0xE7, 0xFF, 0xFA, 0x01, 0xF8, 0xFF, 0xCE, 0x01, 0xF9,
+    0xFF, 0xCE, 0x01, 0xFA, 0xFF, 0xCE, 0x01, 0xFB, 0xFF, 0xCE, 0x01, 0xFC,
+    0xFF, 0xCE, 0x01, 0xFD, 0xFF, 0xCE, 0x01, 0xFE, 0xFF, 0xCE, 0x01, 0xFF,
+    0xFF, 0xCE, 0x02, 0x00, 0xFF, 0xCE, 0x02, 0x01, 0xFF, 0xCE, 0x02, 0x02,
+    0xFF, 0xCE, 0x02, 0x03, 0xFF, 0xCE, 0x02, 0x04, 0xFF, 0xCE, 0x02, 0x05,
+    0xFF, 0xCE, 0x02, 0x06, 0xFF, 0xCE, 0x02, 0x07, 0xFF, 0xCE, 0x02, 0x08,
+    0xFF, 0xCE, 0x02, 0x09, 0xFF, 0xCE, 0x02, 0x0A, 0xFF, 0xCE, 0x02, 0x0B,
+    0xFF, 0xCE, 0x02, 0x0C, 0xFF, 0xCE, 0x02, 0x0D, 0xFF, 0xCE, 0x02, 0x0E,
+    0xFF, 0xCE, 0x02, 0x0F, 0xFF, 0xCE, 0x02, 0x10, 0xFF, 0xCE, 0x02, 0x11,
+    0xFF, 0xCE, 0x02, 0x22, 0xFF, 0x9C, 0x02, 0x26, 0xFF, 0xCE, 0x02, 0x27,
+    0xFF, 0xE2, 0x02, 0x28, 0xFF, 0xE2, 0x02, 0x2A, 0xFF, 0xC4, 0x02, 0x2C,
+    0xFF, 0xCE, 0x02, 0x76, 0xFF, 0xA4, 0x00, 0x1D, 0x00, 0x01, 0xFF, 0xB5,
+    0x00, 0x02, 0xFF, 0xB5, 0x00, 0x03, 0xFF, 0xB5, 0x00, 0x04, 0xFF, 0xB5,
+    0x00, 0x05, 0xFF, 0xB5, 0x00, 0x06, 0xFF, 0xB5, 0x00, 0x07, 0xFF, 0xB5,
+    0x00, 0x08, 0xFF, 0xB5, 0x00, 0x09, 0xFF, 0xB5, 0x00, 0x0A, 0xFF, 0xB5,
+    0x00, 0x0B, 0xFF, 0xB5, 0x00, 0x0C, 0xFF, 0xB5, 0x00, 0x0D, 0xFF, 0xB5,
+    0x00, 0x0E, 0xFF, 0xB5, 0x00, 0x0F, 0xFF, 0xB5, 0x00, 0x10, 0xFF, 0xB5,
+    0x00, 0x11, 0xFF, 0xB5, 0x00, 0x12, 0xFF, 0xB5, 0x00, 0x13, 0xFF, 0xB5,
+    0x00, 0x14, 0xFF, 0xB5, 0x00, 0x15, 0xFF, 0xB5, 0x00, 0x16, 0xFF, 0xB5,
+    0x00, 0x17, 0xFF, 0xB5, 0x00, 0x18, 0xFF, 0xB5, 0x00, 0x19, 0xFF, 0xB5,
+    0x00, 0x1A, 0xFF, 0xB5, 0x01, 0x2C, 0xFF, 0xE7, 0x01, 0xE1, 0x00, 0x06,
+    0x02, 0x22, 0xFF, 0xB5, 0x00, 0x01, 0x00, 0xDB, 0xFF, 0xF8, 0x00, 0x03,
+    0x00, 0xDB, 0xFF, 0xF4, 0x01, 0x2C, 0x00, 0x0A, 0x01, 0xE7, 0xFF, 0xFA,
+    0x00, 0x03, 0x00, 0xDB, 0xFF, 0xEF, 0x01, 0x2C, 0xFF, 0xE2, 0x01, 0xE1,
+    0xFF, 0xF7, 0x00, 0x20, 0x00, 0x01, 0xFF, 0xD8, 0x00, 0x02, 0xFF, 0xD8,
+    0x00, 0x03, 0xFF, 0xD8, 0x00, 0x04, 0xFF, 0xD8, 0x00, 0x05, 0xFF, 0xD8,
+    0x00, 0x06, 0xFF, 0xD8, 0x00, 0x07, 0xFF, 0xD8, 0x00, 0x08, 0xFF, 0xD8,
+    0x00, 0x09, 0xFF, 0xD8, 0x00, 0x0A, 0xFF, 0xD8, 0x00, 0x0B, 0xFF, 0xD8,
+    0x00, 0x0C, 0xFF, 0xD8, 0x00, 0x0D, 0xFF, 0xD8, 0x00, 0x0E, 0xFF, 0xD8,
+    0x00, 0x0F, 0xFF, 0xD8, 0x00, 0x10, 0xFF, 0xD8, 0x00, 0x11, 0xFF, 0xD8,
+    0x00, 0x12, 0xFF, 0xD8, 0x00, 0x13, 0xFF, 0xD8, 0x00, 0x14, 0xFF, 0xD8,
+    0x00, 0x15, 0xFF, 0xD8, 0x00, 0x16, 0xFF, 0xD8, 0x00, 0x17, 0xFF, 0xD8,
+    0x00, 0x18, 0xFF, 0xD8, 0x00, 0x19, 0xFF, 0xD8, 0x00, 0x1A, 0xFF, 0xD8,
+    0x00, 0x64, 0xFF, 0xB5, 0x00, 0x65, 0xFF, 0xB5, 0x01, 0x03, 0xFF, 0xB5,
+    0x01, 0x04, 0xFF, 0xB5, 0x01, 0x2C, 0xFF, 0xF1, 0x02, 0x22, 0xFF, 0xD8,
+    0x00, 0x01, 0x00, 0xDB, 0xFF, 0xFA, 0x00, 0x19, 0x00, 0xBC, 0xFF, 0x9C,
+    0x00, 0xBD, 0xFF, 0x9C, 0x00, 0xBE, 0xFF, 0x9C, 0x00, 0xBF, 0xFF, 0x9C,
+    0x00, 0xC0, 0xFF, 0x9C, 0x00, 0xC1, 0xFF, 0x9C, 0x00, 0xC2, 0xFF, 0x9C,
+    0x00, 0xDB, 0xFF, 0x88, 0x00, 0xDC, 0xFF, 0xB0, 0x00, 0xDD, 0xFF, 0xB0,
+    0x00, 0xDE, 0xFF, 0xB0, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0xE0, 0xFF, 0xB0,
+    0x00, 0xE2, 0xFF, 0x88, 0x00, 0xE3, 0xFF, 0x88, 0x00, 0xE4, 0xFF, 0x88,
+    0x00, 0xE5, 0xFF, 0x88, 0x00, 0xE6, 0xFF, 0x88, 0x00, 0xE7, 0xFF, 0x88,
+    0x00, 0xE8, 0xFF, 0x88, 0x00, 0xE9, 0xFF, 0x88, 0x00, 0xEA, 0xFF, 0x88,
+    0x00, 0xEB, 0xFF, 0x88, 0x01, 0xE1, 0xFF, 0xD8, 0x02, 0x2A, 0xFF, 0xE7,
+    0x00, 0x19, 0x00, 0xBC, 0xFF, 0x9C, 0x00, 0xBD, 0xFF, 0x9C, 0x00, 0xBE,
+    0xFF, 0x9C, 0x00, 0xBF, 0xFF, 0x9C, 0x00, 0xC0, 0xFF, 0x9C, 0x00, 0xC1,
+    0xFF, 0x9C, 0x00, 0xC2, 0xFF, 0x9C, 0x00, 0xDB, 0xFF, 0x9C, 0x00, 0xDC,
+    0xFF, 0xB0, 0x00, 0xDD, 0xFF, 0xB0, 0x00, 0xDE, 0xFF, 0xB0, 0x00, 0xDF,
+    0xFF, 0xB0, 0x00, 0xE0, 0xFF, 0xB0, 0x00, 0xE2, 0xFF, 0x88, 0x00, 0xE3,
+    0xFF, 0x88, 0x00, 0xE4, 0xFF, 0x88, 0x00, 0xE5, 0xFF, 0x88, 0x00, 0xE6,
+    0xFF, 0x88, 0x00, 0xE7, 0xFF, 0x88, 0x00, 0xE8, 0xFF, 0x88, 0x00, 0xE9,
+    0xFF, 0x88, 0x00, 0xEA, 0xFF, 0x88, 0x00, 0xEB, 0xFF, 0x88, 0x01, 0xE1,
+    0xFF, 0xD8, 0x02, 0x2A, 0xFF, 0xE7, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xCE,
+    0x02, 0xE1, 0xFF, 0xD8, 0x00, 0x01, 0x02, 0xE1, 0xFF, 0xE2, 0x00, 0x0A,
+    0x02, 0x27, 0xFF, 0xF1, 0x02, 0x28, 0xFF, 0xEC, 0x02, 0x2A, 0xFF, 0xE7,
+    0x02, 0x2C, 0xFF, 0xEC, 0x02, 0x2E, 0xFF, 0xEC, 0x02, 0x69, 0xFF, 0xB0,
+    0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x76, 0xFF, 0x88, 0x02, 0xD5, 0xFF, 0xCE,
+    0x02, 0xE1, 0xFF, 0xA6, 0x00, 0x01, 0x02, 0xE1, 0xFF, 0xEC, 0x00, 0x02,
+    0x02, 0x76, 0xFF, 0xD8, 0x02, 0xE1, 0xFF, 0xEC, 0x00, 0x03, 0x02, 0x28,
+    0xFF, 0xEC, 0x02, 0x2D, 0xFF, 0xEC, 0x02, 0xDF, 0xFF, 0xC4, 0x00, 0x02,
+    0x02, 0x76, 0xFF, 0xE7, 0x02, 0xE1, 0xFF, 0xE2, 0x00, 0x02, 0x02, 0x2A,
+    0xFF, 0xEC, 0x02, 0x8C, 0x00, 0x0A, 0x00, 0x01, 0x02, 0xD5, 0xFF, 0xD8,
+    0x00, 0x02, 0x02, 0x76, 0xFF, 0xCE, 0x02, 0xE1, 0xFF, 0xCE, 0x00, 0x03,
+    0x02, 0x6A, 0x00, 0x00, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0xA7, 0xFF, 0xE2,
+    0x00, 0x05, 0x01, 0x2C, 0xFF, 0xFD, 0x02, 0x72, 0xFF, 0xFA, 0x02, 0x76,
+    0xFF, 0xFF, 0x02, 0x77, 0xFF, 0xFA, 0x02, 0xA7, 0xFF, 0xFD, 0x00, 0x03,
+    0x02, 0x6A, 0xFF, 0xD8, 0x02, 0x76, 0xFF, 0xEC, 0x02, 0xA7, 0xFF, 0xE2,
+    0x00, 0x09, 0x01, 0x2C, 0xFF, 0xFC, 0x02, 0x6A, 0xFF, 0xD8, 0x02, 0x70,
+    0x00, 0x04, 0x02, 0x71, 0xFF, 0xF4, 0x02, 0x74, 0x00, 0x06, 0x02, 0x76,
+    0xFF, 0xEC, 0x02, 0x77, 0xFF, 0xFF, 0x02, 0x85, 0xFF, 0xEB, 0x02, 0xA7,
+    0xFF, 0xE2, 0x00, 0x09, 0x01, 0xE1, 0xFF, 0xFD, 0x01, 0xE7, 0xFF, 0xFD,
+    0x02, 0x72, 0x00, 0x0A, 0x02, 0x74, 0xFF, 0xEC, 0x02, 0x76, 0xFF, 0xF4,
+    0x02, 0x77, 0xFF, 0xFB, 0x02, 0x85, 0xFF, 0xDE, 0x02, 0x8A, 0xFF, 0xE7,
+    0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x02, 0x02, 0x74, 0x00, 0x14, 0x02, 0x76,
+    0xFF, 0xEC, 0x00, 0x04, 0x00, 0xDB, 0xFF, 0xF6, 0x02, 0x77, 0xFF, 0xFA,
+    0x02, 0x85, 0x00, 0x01, 0x02, 0x8A, 0x00, 0x1E, 0x00, 0x02, 0x02, 0x6A,
+    0xFF, 0xFD, 0x02, 0x77, 0xFF, 0xE2, 0x00, 0x04, 0x02, 0x74, 0x00, 0x1E,
+    0x02, 0x76, 0xFF, 0xEC, 0x02, 0x8A, 0x00, 0x1E, 0x02, 0x8E, 0x00, 0x28,
+    0x00, 0x0A, 0x00, 0x53, 0xFF, 0xF1, 0x01, 0xE7, 0xFF, 0xFD, 0x02, 0x71,
+    0xFF, 0xEC, 0x02, 0x72, 0x00, 0x0A, 0x02, 0x74, 0xFF, 0xF1, 0x02, 0x76,
+    0xFF, 0xE3, 0x02, 0x77, 0xFF, 0xCE, 0x02, 0x85, 0xFF, 0xCA, 0x02, 0x8A,
+    0xFF, 0xE2, 0x02, 0x8C, 0xFF, 0xE7, 0x00, 0x04, 0x02, 0x76, 0xFF, 0xCE,
+    0x02, 0x77, 0xFF, 0xCE, 0x02, 0x8A, 0xFF, 0xE7, 0x02, 0x8C, 0xFF, 0xE7,
+    0x00, 0x01, 0x02, 0x77, 0xFF, 0xE2, 0x00, 0x03, 0x02, 0x76, 0xFF, 0x88,
+    0x02, 0x81, 0xFF, 0x88, 0x02, 0xA7, 0xFF, 0xCE, 0x00, 0x01, 0x02, 0x81,
+    0xFF, 0xB0, 0x00, 0x03, 0x02, 0x76, 0xFF, 0xB0, 0x02, 0x81, 0xFF, 0xBA,
+    0x02, 0xA7, 0xFF, 0xE2, 0x00, 0x0B, 0x02, 0x6F, 0xFF, 0xFA, 0x02, 0x70,
+    0x00, 0x07, 0x02, 0x71, 0xFF, 0xEC, 0x02, 0x72, 0xFF, 0xF4, 0x02, 0x73,
+    0xFF, 0xF8, 0x02, 0x76, 0xFF, 0xB0, 0x02, 0x81, 0xFF, 0x9C, 0x02, 0x85,
+    0xFF, 0xE3, 0x02, 0xA6, 0xFF, 0xFA, 0x02, 0xA7, 0xFF, 0xCE, 0x02, 0xAC,
+    0x00, 0x06, 0x00, 0x05, 0x02, 0x76, 0xFF, 0xC4, 0x02, 0x7E, 0xFF, 0x9C,
+    0x02, 0x80, 0xFF, 0x9C, 0x02, 0x81, 0xFF, 0x9C, 0x02, 0xA7, 0xFF, 0xC9,
+    0x00, 0x04, 0x02, 0x77, 0xFF, 0xD8, 0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80,
+    0x00, 0x00, 0x02, 0x81, 0xFF, 0xC4, 0x00, 0x04, 0x02, 0x77, 0xFF, 0xD8,
+    0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80, 0xFF, 0xC4, 0x02, 0x81, 0xFF, 0xC4,
+    0x00, 0x06, 0x00, 0x53, 0xFF, 0xF1, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77,
+    0xFF, 0xCE, 0x02, 0x85, 0xFF, 0xF6, 0x02, 0x8A, 0xFF, 0xE2, 0x02, 0x8C,
+    0xFF, 0xE7, 0x00, 0x0E, 0x01, 0xE1, 0x00, 0x03, 0x01, 0xE7, 0xFF, 0xFD,
+    0x02, 0x69, 0xFF, 0x9C, 0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x6E, 0x00, 0x0A,
+    0x02, 0x6F, 0x00, 0x14, 0x02, 0x71, 0xFF, 0xEC, 0x02, 0x72, 0x00, 0x19,
+    0x02, 0x73, 0x00, 0x04, 0x02, 0x74, 0xFF, 0xFB, 0x02, 0x76, 0xFF, 0xD8,
+    0x02, 0x77, 0xFF, 0xEC, 0x02, 0x85, 0xFF, 0xCA, 0x02, 0xAC, 0xFF, 0xF0,
+    0x00, 0x04, 0x02, 0x69, 0xFF, 0x9C, 0x02, 0x6A, 0xFF, 0x9C, 0x02, 0x76,
+    0xFF, 0xB0, 0x02, 0x77, 0xFF, 0xCE, 0x00, 0x08, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x4E, 0x00, 0x00, 0x02, 0x74, 0xFF, 0xB5,
+    0x02, 0x77, 0xFF, 0x9C, 0x02, 0x7E, 0xFF, 0xC4, 0x02, 0x80, 0xFF, 0xC4,
+    0x02, 0x81, 0xFF, 0xC4, 0x00, 0x03, 0x02, 0x7E, 0xFF, 0xA6, 0x02, 0x80,
+    0xFF, 0xA6, 0x02, 0x81, 0xFF, 0xA6, 0x00, 0x04, 0x02, 0x76, 0xFF, 0xCE,
+    0x02, 0x8A, 0x00, 0x28, 0x02, 0x8C, 0x00, 0x28, 0x02, 0x8E, 0x00, 0x1E,
+    0x00, 0x34, 0x00, 0x1E, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x20,
+    0xFF, 0xF1, 0x00, 0x21, 0xFF, 0xF1, 0x00, 0x22, 0xFF, 0xF1, 0x00, 0x23,
+    0xFF, 0xF1, 0x00, 0x24, 0xFF, 0xF1, 0x00, 0x47, 0xFF, 0xF1, 0x00, 0x48,
+    0xFF, 0xF1, 0x00, 0x49, 0xFF, 0xF1, 0x00, 0x4A, 0xFF, 0xF1, 0x00, 0x4B,
+    0xFF, 0xF1, 0x00, 0x4C, 0xFF, 0xF1, 0x00, 0x4D, 0xFF, 0xF1, 0x00, 0x80,
+    0xFF, 0xF1, 0x00, 0x81, 0xFF, 0xF1, 0x00, 0x82, 0xFF, 0xF1, 0x00, 0x83,
+    0xFF, 0xF1, 0x00, 0x84, 0xFF, 0xF1, 0x00, 0x85, 0xFF, 0xF1, 0x00, 0x86,
+    0xFF, 0xF1, 0x00, 0x87, 0xFF, 0xF1, 0x00, 0x88, 0xFF, 0xF1, 0x00, 0x89,
+    0xFF, 0xF1, 0x00, 0x8A, 0xFF, 0xF1, 0x00, 0x8B, 0xFF, 0xF1, 0x00, 0x8C,
+    0xFF, 0xF1, 0x00, 0x8D, 0xFF, 0xF1, 0x00, 0x8E, 0xFF, 0xF1, 0x00, 0x8F,
+    0xFF, 0xF1, 0x00, 0x90, 0xFF, 0xF1, 0x00, 0x91, 0xFF, 0xF1, 0x00, 0x92,
+    0xFF, 0xF1, 0x00, 0x93, 0xFF, 0xF1, 0x00, 0x94, 0xFF, 0xF1, 0x00, 0x95,
+    0xFF, 0xF1, 0x00, 0x96, 0xFF, 0xF1, 0x00, 0x97, 0xFF, 0xF1, 0x00, 0x98,
+    0xFF, 0xF1, 0x00, 0x99, 0xFF, 0xF1, 0x00, 0x9A, 0xFF, 0xF1, 0x00, 0x9B,
+    0xFF, 0xF1, 0x00, 0x9C, 0xFF, 0xF1, 0x00, 0x9D, 0xFF, 0xF1, 0x00, 0x9E,
+    0xFF, 0xF1, 0x00, 0x9F, 0xFF, 0xF1, 0x00, 0xA0, 0xFF, 0xF1, 0x00, 0xA1,
+    0xFF, 0xF1, 0x00, 0xA2, 0xFF, 0xF1, 0x00, 0xA3, 0xFF, 0xF1, 0x00, 0xA6,
+    0xFF, 0xF1, 0x00, 0xBB, 0xFF, 0xF1, 0x00, 0x03, 0x00, 0x53, 0xFF, 0xF6,
+    0x02, 0x76, 0xFF, 0xD8, 0x02, 0x77, 0xFF, 0xCE, 0x00, 0x01, 0x02, 0x77,
+    0xFF, 0xD8, 0x00, 0x05, 0x00, 0x53, 0xFF, 0xF1, 0x02, 0x76, 0xFF, 0xD8,
+    0x02, 0x77, 0xFF, 0xCE, 0x02, 0x8A, 0xFF, 0xE2, 0x02, 0x8C, 0xFF, 0xE7,
+    0x00, 0x03, 0x02, 0x8A, 0x00, 0x14, 0x02, 0x98, 0x00, 0x28, 0x02, 0x9A,
+    0x00, 0x28, 0x00, 0x02, 0x02, 0x76, 0xFF, 0xD8, 0x02, 0x8A, 0xFF, 0xEC,
+    0x00, 0x07, 0x02, 0x74, 0xFF, 0xB5, 0x02, 0x77, 0xFF, 0x9C, 0x02, 0x7E,
+    0xFF, 0xCE, 0x02, 0x80, 0xFF, 0xCE, 0x02, 0x81, 0xFF, 0xCE, 0x02, 0x99,
+    0xFF, 0xC4, 0x02, 0x9A, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x28,
+    0x00, 0x00, 0x02, 0x20, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x16, 0x00, 0x21,
+    0x00, 0x00, 0x73, 0x22, 0x35, 0x11, 0x34, 0x33, 0x21, 0x32, 0x15, 0x11,
+    0x14, 0x23, 0x25, 0x21, 0x32, 0x36, 0x27, 0x01, 0x26, 0x06, 0x15, 0x11,
+    0x14, 0x25, 0x16, 0x36, 0x35, 0x11, 0x34, 0x23, 0x21, 0x22, 0x06, 0x17,
+    0x4B, 0x23, 0x23, 0x01, 0xB2, 0x23, 0x23, 0xFE, 0x46, 0x01, 0xB0, 0x03,
+    0x02, 0x02, 0xFE, 0x4E, 0x02, 0x04, 0x01, 0xC6, 0x02, 0x04, 0x05, 0xFE,
+    0x4F, 0x03, 0x02, 0x02, 0x23, 0x02, 0x76, 0x23, 0x23, 0xFD, 0x8A, 0x23,
+    0x16, 0x04, 0x02, 0x02, 0x70, 0x03, 0x01, 0x04, 0xFD, 0x91, 0x05, 0x19,
+    0x03, 0x01, 0x04, 0x02, 0x70, 0x05, 0x04, 0x02, 0x00, 0x02, 0x00, 0x14,
+    0x00, 0x00, 0x02, 0x4F, 0x02, 0xBC, 0x00, 0x11, 0x00, 0x15, 0x00, 0x00,
+    0x73, 0x01, 0x33, 0x01, 0x23, 0x03, 0x2E, 0x03, 0x27, 0x17, 0x0E, 0x03,
+    0x07, 0x03, 0x37, 0x37, 0x21, 0x17, 0x14, 0x01, 0x0D, 0x21, 0x01, 0x0D,
+    0x1A, 0xC1, 0x03, 0x0F, 0x15, 0x18, 0x0B, 0x0B, 0x06, 0x15, 0x17, 0x12,
+    0x04, 0xBF, 0x4A, 0x08, 0x01, 0x65, 0x08, 0x02, 0xBC, 0xFD, 0x44, 0x01,
+    0xF8, 0x07, 0x27, 0x38, 0x3D, 0x1C, 0x01, 0x12, 0x38, 0x3B, 0x30, 0x0A,
+    0xFE, 0x09, 0xE6, 0x17, 0x17, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
+    0x02, 0x4F, 0x03, 0x68, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x29, 0x4B, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F,
+    0x03, 0x6A, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32,
+    0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0xE0,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x34, 0x38, 0x00,
+    0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x75, 0x02, 0x4F, 0x03, 0x6A, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x38, 0x00, 0x00, 0x06,
+    0x03, 0x32, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F,
+    0x03, 0xE0, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x33,
+    0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0xE9,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x36, 0x38, 0x00,
+    0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0xE3, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x35, 0x38, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0x61, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0x00, 0x00, 0x02, 0x4F, 0x03, 0x61, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x2C, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
+    0x02, 0x4F, 0x03, 0xD6, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2E, 0x00, 0x60, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x75,
+    0x02, 0x4F, 0x03, 0x61, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x0E, 0x38, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x38, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0xD6, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2D, 0x00, 0x45, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0xE5, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x30, 0x00, 0x62, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0xD9, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x2F, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0x00, 0x00, 0x02, 0x4F, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x41, 0xF1, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
+    0x02, 0x4F, 0x03, 0x4D, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x23, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x75, 0x02, 0x4F,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0x68,
+    0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x23, 0x00,
+    0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0x90, 0x06, 0x26,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x38, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0x6F, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0x00, 0x00, 0x02, 0x4F, 0x03, 0x3D, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x3C, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x1A,
+    0x02, 0x53, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x46, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
+    0x02, 0x4F, 0x03, 0x63, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x37, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x4F,
+    0x03, 0xEF, 0x06, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x03, 0x37,
+    0x38, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x4B, 0x00, 0x87, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x4F, 0x03, 0x54, 0x06, 0x26, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0x37, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x5D, 0x02, 0xBC, 0x00, 0x13, 0x00, 0x00, 0x71, 0x01,
+    0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x35,
+    0x21, 0x37, 0x21, 0x11, 0x17, 0x01, 0x01, 0xDC, 0x01, 0x81, 0xFE, 0x9F,
+    0x01, 0x28, 0xFE, 0xD8, 0x01, 0x61, 0xFE, 0x89, 0xFE, 0xC1, 0x0F, 0x01,
+    0x30, 0x06, 0xFE, 0x30, 0x02, 0xBC, 0x16, 0xFE, 0xCE, 0x16, 0xFE, 0xB8,
+    0x16, 0xD8, 0x16, 0x01, 0xC5, 0x04, 0xFD, 0x51, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x5D, 0x03, 0x68, 0x06, 0x26, 0x00, 0x1B, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x01, 0x94, 0x00, 0x00, 0x00, 0x03, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x55, 0x02, 0xBC, 0x00, 0x13, 0x00, 0x1E, 0x00, 0x28,
+    0x00, 0x00, 0x73, 0x11, 0x21, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x27, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27, 0x33, 0x32, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x33, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x23, 0x6E, 0x01, 0x0C, 0x37, 0x52, 0x2D, 0x57,
+    0x48, 0x06, 0x43, 0x5A, 0x2D, 0x19, 0x37, 0x56, 0x3C, 0xF0, 0xF1, 0x49,
+    0x59, 0x28, 0x2E, 0x58, 0x3F, 0xF6, 0xF1, 0x2D, 0x4B, 0x2D, 0x57, 0x4B,
+    0xF4, 0x02, 0xBC, 0x2E, 0x4C, 0x2F, 0x40, 0x5F, 0x0B, 0x0D, 0x04, 0x32,
+    0x4F, 0x31, 0x28, 0x46, 0x35, 0x1D, 0x16, 0x2C, 0x4B, 0x2F, 0x31, 0x4C,
+    0x2B, 0x16, 0x29, 0x46, 0x2B, 0x3D, 0x55, 0x00, 0x00, 0x01, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0x8F, 0x02, 0xC6, 0x00, 0x25, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x8F, 0x4B, 0x7E, 0x5D, 0x32,
+    0x32, 0x5D, 0x7E, 0x4B, 0x35, 0x5D, 0x4F, 0x1F, 0x12, 0x1D, 0x4A, 0x56,
+    0x31, 0x45, 0x76, 0x56, 0x30, 0x30, 0x56, 0x76, 0x45, 0x2D, 0x52, 0x46,
+    0x1C, 0x0F, 0x1E, 0x4B, 0x57, 0x0A, 0x34, 0x5F, 0x83, 0x4E, 0x50, 0x85,
+    0x61, 0x36, 0x1D, 0x34, 0x23, 0x10, 0x21, 0x32, 0x1B, 0x33, 0x5C, 0x7D,
+    0x4A, 0x49, 0x7A, 0x5A, 0x31, 0x15, 0x27, 0x1B, 0x12, 0x1D, 0x28, 0x16,
+    0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x8F, 0x03, 0x68, 0x06, 0x26,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA8, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0x8F, 0x03, 0x61, 0x06, 0x26,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0x95, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x37, 0xFF, 0x1D, 0x02, 0x8F, 0x02, 0xC6, 0x06, 0x26,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x45, 0x00, 0x82, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x37, 0xFF, 0x1D, 0x02, 0x8F, 0x03, 0x68, 0x06, 0x26,
+    0x00, 0x1E, 0x00, 0x00, 0x00, 0x27, 0x03, 0x45, 0x00, 0x82, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0xA8, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0x8F, 0x03, 0x61, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2C, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0x8F, 0x03, 0x4F, 0x06, 0x26, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x26, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0xAA, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x1B, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x27,
+    0x27, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x23, 0x37,
+    0x6E, 0xF7, 0x40, 0x75, 0x5B, 0x35, 0x35, 0x5B, 0x75, 0x40, 0xE1, 0x0A,
+    0xE6, 0x3C, 0x6F, 0x56, 0x32, 0x32, 0x56, 0x6F, 0x3C, 0xE7, 0x0B, 0x02,
+    0xBC, 0x34, 0x5E, 0x80, 0x4C, 0x4B, 0x80, 0x5F, 0x34, 0x0D, 0x09, 0x32,
+    0x59, 0x78, 0x45, 0x46, 0x78, 0x59, 0x31, 0x0B, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x04, 0xF2, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0xEC, 0x02, 0xB4, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x04, 0xF2, 0x03, 0x61, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x27, 0x00, 0xEC, 0x02, 0xB4, 0x00, 0x00, 0x00, 0x07, 0x03, 0x31,
+    0x02, 0xF7, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x02, 0xAA,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1F, 0x00, 0x00, 0x53, 0x35,
+    0x21, 0x15, 0x03, 0x11, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
+    0x23, 0x27, 0x27, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23,
+    0x23, 0x37, 0x18, 0x01, 0x0C, 0xB6, 0xF7, 0x40, 0x75, 0x5B, 0x35, 0x35,
+    0x5B, 0x75, 0x40, 0xE1, 0x0A, 0xE6, 0x3C, 0x6F, 0x56, 0x32, 0x32, 0x56,
+    0x6F, 0x3C, 0xE7, 0x0B, 0x01, 0x53, 0x15, 0x15, 0xFE, 0xAD, 0x02, 0xBC,
+    0x34, 0x5E, 0x80, 0x4C, 0x4B, 0x80, 0x5F, 0x34, 0x0D, 0x09, 0x32, 0x59,
+    0x78, 0x45, 0x46, 0x78, 0x59, 0x31, 0x0B, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0xAA, 0x03, 0x61, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x31, 0x77, 0x00, 0xFF, 0xFF, 0x00, 0x18, 0x00, 0x00,
+    0x02, 0xAA, 0x02, 0xBC, 0x06, 0x06, 0x00, 0x28, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0x75, 0x02, 0xAA, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x77, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0x87, 0x02, 0xAA, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x14, 0x77, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x04, 0x6A, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0xF2, 0x02, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x04, 0x6A, 0x02, 0xD6, 0x04, 0x26, 0x00, 0x25, 0x00, 0x00, 0x00, 0x27,
+    0x01, 0xF2, 0x02, 0xE0, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFD, 0x02, 0xBD,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x02, 0xBC,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x11, 0x21, 0x15, 0x21, 0x11,
+    0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x6E, 0x01, 0x87, 0xFE, 0x8F, 0x01,
+    0x6B, 0xFE, 0x8C, 0x01, 0x40, 0x02, 0xBC, 0x16, 0xFD, 0x70, 0x16, 0x01,
+    0x5F, 0x16, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5,
+    0x03, 0x68, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0x52, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x6A,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32, 0x3F, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x61, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x3F, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0x1D, 0x01, 0xF5, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x45, 0x1A, 0x00, 0x00, 0x06, 0x03, 0x32,
+    0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x61,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x3F, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x02, 0x03, 0x03, 0xD6, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2E, 0x00, 0x67, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x75, 0x01, 0xF5, 0x03, 0x61, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x21, 0x00, 0x00, 0x06,
+    0x03, 0x2C, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5,
+    0x03, 0xD6, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2D,
+    0x4C, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x02, 0x06, 0x03, 0xE5,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x30, 0x69, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0xD9, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2F, 0x3F, 0x00, 0xFF, 0xFF,
+    0x00, 0x5E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0xF8, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x01, 0xF5, 0x03, 0x4D, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x23, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x01, 0xF5, 0x03, 0x4F, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x26, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x75, 0x01, 0xF5,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x21, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x68,
+    0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x2A, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x90, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x3F, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0x6F, 0x06, 0x26, 0x00, 0x2F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x01, 0xF5, 0x03, 0x3D, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x3C, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x01, 0xF5, 0x03, 0xE0, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x3C, 0x3F, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x52, 0x00, 0x78,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5, 0x03, 0xE0, 0x06, 0x26,
+    0x00, 0x2F, 0x00, 0x00, 0x00, 0x26, 0x03, 0x3C, 0x3F, 0x00, 0x00, 0x07,
+    0x03, 0x28, 0x00, 0x2A, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x1A,
+    0x01, 0xF9, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x46, 0x00, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x01, 0xF5, 0x03, 0x54, 0x06, 0x26, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x38, 0x3E, 0x00, 0x00, 0x03, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xF5,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x11,
+    0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x6E, 0x16,
+    0x0A, 0x01, 0x42, 0xFE, 0xBF, 0x01, 0x7A, 0x02, 0xBC, 0xFD, 0x44, 0x01,
+    0x55, 0x16, 0x16, 0x01, 0x51, 0x16, 0x16, 0x00, 0x00, 0x01, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xD2, 0x02, 0xC6, 0x00, 0x2F, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32,
+    0x3E, 0x02, 0x35, 0x35, 0x17, 0x21, 0x35, 0x21, 0x1C, 0x02, 0x15, 0x14,
+    0x0E, 0x02, 0x01, 0x90, 0x4B, 0x7F, 0x5C, 0x33, 0x32, 0x5D, 0x7E, 0x4B,
+    0x39, 0x62, 0x52, 0x20, 0x11, 0x1D, 0x4D, 0x5D, 0x35, 0x45, 0x76, 0x56,
+    0x30, 0x30, 0x57, 0x76, 0x45, 0x48, 0x6F, 0x4D, 0x27, 0x06, 0xFE, 0xD8,
+    0x01, 0x39, 0x2C, 0x54, 0x77, 0x0A, 0x34, 0x5F, 0x83, 0x4E, 0x50, 0x85,
+    0x61, 0x36, 0x20, 0x3B, 0x27, 0x10, 0x26, 0x38, 0x1E, 0x33, 0x5C, 0x7D,
+    0x4A, 0x49, 0x7A, 0x5A, 0x31, 0x2D, 0x52, 0x72, 0x45, 0x13, 0x05, 0x16,
+    0x06, 0x07, 0x04, 0x02, 0x55, 0x83, 0x58, 0x2D, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xD2, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x32, 0x00, 0x93, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xD2, 0x03, 0x61, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x00, 0x93, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xD2, 0x03, 0x61, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x2C, 0x00, 0x93, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0x34, 0x02, 0xD2, 0x02, 0xC6, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x44, 0x00, 0x85, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xD2, 0x03, 0x4F, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x26, 0x00, 0x93, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xD2, 0x03, 0x3D, 0x06, 0x26, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x3C, 0x00, 0x93, 0x00, 0x00, 0x00, 0x03, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x6D, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x61, 0x11, 0x33, 0x11, 0x21, 0x11, 0x33, 0x11, 0x03, 0x35,
+    0x21, 0x15, 0x02, 0x57, 0x16, 0xFE, 0x01, 0x16, 0x0B, 0x01, 0xE9, 0x02,
+    0xBC, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x52, 0x16, 0x16, 0x00,
+    0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x02, 0xC2, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x53, 0x35, 0x33, 0x33,
+    0x21, 0x33, 0x33, 0x15, 0x23, 0x23, 0x21, 0x23, 0x01, 0x11, 0x33, 0x11,
+    0x21, 0x11, 0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x18, 0x5E, 0x08, 0x01,
+    0xE2, 0x06, 0x5C, 0x5C, 0x05, 0xFE, 0x1D, 0x0A, 0x01, 0xE3, 0x16, 0xFE,
+    0x01, 0x16, 0x0B, 0x01, 0xE9, 0x02, 0x1D, 0x15, 0x15, 0xFD, 0xE3, 0x02,
+    0xBC, 0xFD, 0x44, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x52, 0x16, 0x16, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x4B, 0x02, 0x6D, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x4E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x13, 0x00, 0x74, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x02, 0x6D, 0x03, 0x61, 0x06, 0x26,
+    0x00, 0x4E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0x74, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x75, 0x02, 0x6D, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x4E, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x00, 0x73, 0x35, 0x33, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11,
+    0x33, 0x15, 0x32, 0x84, 0x84, 0x01, 0x1E, 0x84, 0x84, 0x16, 0x02, 0x90,
+    0x16, 0x16, 0xFD, 0x70, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0xFF, 0xF6,
+    0x03, 0x7F, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x64, 0x01, 0x82, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00,
+    0x01, 0x50, 0x03, 0x68, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x29, 0xDA, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50,
+    0x03, 0x6A, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x32,
+    0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50, 0x03, 0x61,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0xC7, 0x00,
+    0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50, 0x03, 0x61, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0xC7, 0x00, 0xFF, 0xFF,
+    0xFF, 0xE6, 0x00, 0x00, 0x01, 0x50, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0x50, 0x03, 0x4D, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x23, 0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00,
+    0x01, 0x50, 0x03, 0xE0, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x24, 0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50,
+    0x03, 0x4F, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x26,
+    0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0xFF, 0x75, 0x01, 0x50, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xC7, 0x00,
+    0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50, 0x03, 0x68, 0x06, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0xB2, 0x00, 0xFF, 0xFF,
+    0x00, 0x32, 0x00, 0x00, 0x01, 0x50, 0x03, 0x90, 0x06, 0x26, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32,
+    0x00, 0x00, 0x01, 0x50, 0x03, 0x6F, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x42, 0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00,
+    0x01, 0x50, 0x03, 0x3D, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x3C, 0xC7, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0xFF, 0x1A, 0x01, 0x50,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x46,
+    0xC8, 0x00, 0xFF, 0xFF, 0x00, 0x32, 0x00, 0x00, 0x01, 0x50, 0x03, 0x54,
+    0x06, 0x26, 0x00, 0x53, 0x00, 0x00, 0x00, 0x06, 0x03, 0x38, 0xC6, 0x00,
+    0x00, 0x01, 0x00, 0x14, 0xFF, 0xF6, 0x01, 0xFD, 0x02, 0xBC, 0x00, 0x1A,
+    0x00, 0x00, 0x57, 0x22, 0x2E, 0x02, 0x27, 0x37, 0x1E, 0x03, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x14, 0x0E,
+    0x02, 0xD1, 0x22, 0x3B, 0x30, 0x24, 0x0C, 0x10, 0x0E, 0x24, 0x2B, 0x34,
+    0x1E, 0x32, 0x4D, 0x2B, 0x81, 0x01, 0x01, 0x6A, 0x1D, 0x34, 0x47, 0x0A,
+    0x12, 0x22, 0x30, 0x1E, 0x0F, 0x1F, 0x2F, 0x1E, 0x0F, 0x2A, 0x58, 0x47,
+    0x01, 0xD1, 0x16, 0x16, 0xFE, 0x2F, 0x3A, 0x54, 0x37, 0x1A, 0xFF, 0xFF,
+    0x00, 0x14, 0xFF, 0xF6, 0x01, 0xFD, 0x03, 0x61, 0x06, 0x26, 0x00, 0x64,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0x87, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x6E, 0x00, 0x00, 0x02, 0x68, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x77, 0x35, 0x01, 0x33, 0x01, 0x11, 0x33, 0x11,
+    0x21, 0x01, 0x37, 0x01, 0x78, 0x01, 0xBE, 0x20, 0xFE, 0x18, 0x16, 0x01,
+    0xC7, 0xFE, 0xCF, 0x11, 0x01, 0x3D, 0xEA, 0x1F, 0x01, 0xB3, 0xFD, 0x44,
+    0x02, 0xBC, 0xFD, 0x44, 0x01, 0x94, 0x10, 0xFE, 0x5C, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0x34, 0x02, 0x68, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x66,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x44, 0x00, 0x00, 0x01, 0x00, 0x6E,
+    0x00, 0x00, 0x01, 0xE3, 0x02, 0xBC, 0x00, 0x05, 0x00, 0x00, 0x73, 0x11,
+    0x33, 0x11, 0x21, 0x15, 0x6E, 0x16, 0x01, 0x5F, 0x02, 0xBC, 0xFD, 0x5A,
+    0x16, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xF6, 0x04, 0x12, 0x02, 0xBC,
+    0x04, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x00, 0x64, 0x02, 0x15,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0x00, 0x00, 0x01, 0xE3, 0x03, 0x68,
+    0x06, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x92, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xE3, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x68, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x00, 0x74, 0x00, 0x1A,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x34, 0x01, 0xE3, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0x68, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x11, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0x00, 0x00, 0x01, 0xE3, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x07, 0x02, 0x69, 0x01, 0x14, 0x01, 0x54, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0x75, 0x01, 0xE3, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x11, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0x3E, 0x02, 0x80, 0x02, 0xD1, 0x04, 0x26, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x69, 0x02, 0x15, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0x87, 0x01, 0xE3, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x68, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x14, 0x11, 0x00, 0x00, 0x02, 0xFF, 0xF7, 0x00, 0x00,
+    0x01, 0xD3, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x43, 0x27,
+    0x25, 0x17, 0x03, 0x11, 0x33, 0x11, 0x21, 0x15, 0x01, 0x08, 0x01, 0x09,
+    0x08, 0xAA, 0x16, 0x01, 0x5F, 0x01, 0x38, 0x15, 0x79, 0x15, 0xFE, 0x4F,
+    0x02, 0xBC, 0xFD, 0x5A, 0x16, 0x00, 0x00, 0x01, 0x00, 0x6E, 0x00, 0x00,
+    0x02, 0xD8, 0x02, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x73, 0x11, 0x33, 0x01,
+    0x23, 0x01, 0x33, 0x11, 0x23, 0x11, 0x34, 0x36, 0x37, 0x17, 0x01, 0x23,
+    0x01, 0x37, 0x16, 0x16, 0x15, 0x11, 0x6E, 0x11, 0x01, 0x26, 0x03, 0x01,
+    0x25, 0x11, 0x16, 0x02, 0x01, 0x10, 0xFE, 0xD6, 0x0F, 0xFE, 0xDB, 0x0A,
+    0x02, 0x01, 0x02, 0xBC, 0xFE, 0x2C, 0x01, 0xD4, 0xFD, 0x44, 0x02, 0x1F,
+    0x23, 0x47, 0x23, 0x05, 0xFE, 0x25, 0x01, 0xD4, 0x0C, 0x21, 0x45, 0x25,
+    0xFD, 0xDF, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x75, 0x02, 0xD8, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0x72, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xAA,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x6E, 0x00, 0x00, 0x02, 0x6C, 0x02, 0xBC,
+    0x00, 0x17, 0x00, 0x00, 0x73, 0x11, 0x33, 0x01, 0x23, 0x26, 0x26, 0x34,
+    0x26, 0x34, 0x35, 0x11, 0x33, 0x11, 0x23, 0x01, 0x33, 0x14, 0x16, 0x16,
+    0x14, 0x14, 0x15, 0x11, 0x6E, 0x16, 0x01, 0xD9, 0x04, 0x01, 0x01, 0x01,
+    0x16, 0x14, 0xFE, 0x1B, 0x0F, 0x01, 0x01, 0x02, 0xBC, 0xFD, 0x63, 0x09,
+    0x14, 0x1D, 0x2C, 0x3F, 0x2D, 0x01, 0xCB, 0xFD, 0x44, 0x02, 0xAE, 0x0A,
+    0x24, 0x2F, 0x33, 0x32, 0x16, 0xFE, 0x2A, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0xF6, 0x04, 0xD8, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x64, 0x02, 0xDB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x6C, 0x03, 0x68, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0x87, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x6C, 0x03, 0x61, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x31, 0x00, 0x74, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0x34, 0x02, 0x6C, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x44, 0x00, 0x74, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x6C, 0x03, 0x4F, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x26, 0x00, 0x74, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0x75, 0x02, 0x6C, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x0E, 0x00, 0x74, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE,
+    0xFF, 0x3E, 0x02, 0x6C, 0x02, 0xBC, 0x00, 0x1D, 0x00, 0x00, 0x57, 0x27,
+    0x32, 0x36, 0x35, 0x11, 0x33, 0x01, 0x23, 0x34, 0x2E, 0x02, 0x35, 0x11,
+    0x33, 0x11, 0x23, 0x01, 0x33, 0x16, 0x14, 0x16, 0x14, 0x14, 0x15, 0x11,
+    0x14, 0x06, 0x06, 0x06, 0x08, 0x3E, 0x32, 0x16, 0x01, 0xD9, 0x04, 0x01,
+    0x01, 0x01, 0x16, 0x14, 0xFE, 0x1B, 0x0F, 0x01, 0x01, 0x1E, 0x38, 0xC2,
+    0x15, 0x41, 0x34, 0x02, 0xF4, 0xFD, 0x63, 0x0B, 0x1B, 0x2C, 0x48, 0x38,
+    0x01, 0xCB, 0xFD, 0x44, 0x02, 0xAE, 0x07, 0x2C, 0x39, 0x39, 0x2B, 0x08,
+    0xFD, 0xEE, 0x2B, 0x3C, 0x1F, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x3E,
+    0x03, 0x46, 0x02, 0xD1, 0x04, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x69, 0x02, 0xDB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x87,
+    0x02, 0x6C, 0x02, 0xBC, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x14, 0x00, 0x74, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x02, 0x6C, 0x03, 0x54, 0x06, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x38, 0x00, 0x73, 0x00, 0x00, 0x00, 0x01, 0x00, 0x6E, 0xFF, 0x3E,
+    0x02, 0x6C, 0x02, 0xBC, 0x00, 0x21, 0x00, 0x00, 0x45, 0x27, 0x32, 0x3E,
+    0x02, 0x35, 0x35, 0x17, 0x01, 0x33, 0x16, 0x14, 0x16, 0x14, 0x14, 0x15,
+    0x11, 0x23, 0x11, 0x33, 0x01, 0x23, 0x34, 0x2E, 0x02, 0x35, 0x11, 0x33,
+    0x11, 0x14, 0x06, 0x06, 0x01, 0xEE, 0x08, 0x1F, 0x2B, 0x1A, 0x0C, 0x09,
+    0xFE, 0x14, 0x0F, 0x01, 0x01, 0x16, 0x16, 0x01, 0xD9, 0x04, 0x01, 0x01,
+    0x01, 0x16, 0x1E, 0x38, 0xC2, 0x15, 0x11, 0x1F, 0x2B, 0x1A, 0x4B, 0x1D,
+    0x02, 0xB8, 0x07, 0x2B, 0x3A, 0x3A, 0x2B, 0x07, 0xFE, 0x2A, 0x02, 0xBC,
+    0xFD, 0x63, 0x0B, 0x1B, 0x2C, 0x48, 0x38, 0x01, 0xCB, 0xFD, 0x08, 0x2B,
+    0x3C, 0x1F, 0x00, 0x02, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x02, 0xC6,
+    0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32,
+    0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x1E, 0x02, 0x01, 0x8F, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B,
+    0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x46, 0x75, 0x57, 0x2F,
+    0x2F, 0x57, 0x75, 0x46, 0x45, 0x76, 0x56, 0x30, 0x30, 0x56, 0x76, 0x0A,
+    0x34, 0x61, 0x83, 0x4F, 0x4F, 0x84, 0x61, 0x35, 0x35, 0x60, 0x84, 0x50,
+    0x4F, 0x83, 0x61, 0x34, 0x16, 0x32, 0x5A, 0x7C, 0x49, 0x4A, 0x7B, 0x5C,
+    0x32, 0x32, 0x5C, 0x7B, 0x4A, 0x49, 0x7C, 0x5A, 0x32, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x68, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA8, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x32, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x61, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x31, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x61, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0xD6, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2E, 0x00, 0xBD, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0x75, 0x02, 0xE7, 0x03, 0x61, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x27, 0x03, 0x0E, 0x00, 0x95, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2C, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6,
+    0x02, 0xE7, 0x03, 0xD6, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2D, 0x00, 0xA2, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6,
+    0x02, 0xE7, 0x03, 0xE5, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x30, 0x00, 0xBF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6,
+    0x02, 0xE7, 0x03, 0xD9, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2F, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6,
+    0x02, 0xE7, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x41, 0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7,
+    0x03, 0x4D, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x23,
+    0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7,
+    0x03, 0xB5, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x23,
+    0x00, 0x95, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x95, 0x00, 0x78,
+    0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0xB5, 0x06, 0x26,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x26, 0x00, 0x95, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x3C, 0x00, 0x95, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0x75, 0x02, 0xE7, 0x02, 0xC6, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x0E, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x68, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x28, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x90, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x40, 0x00, 0x95, 0x00, 0x00, 0x00, 0x02, 0x00, 0x37,
+    0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x1F, 0x00, 0x23, 0x00, 0x37, 0x00, 0x00,
+    0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x17,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x33, 0x14, 0x0E, 0x02, 0x27,
+    0x37, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35,
+    0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x01,
+    0x8F, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x14, 0x24, 0x12,
+    0x14, 0x25, 0x0D, 0x22, 0x2F, 0x19, 0x16, 0x13, 0x27, 0x3A, 0x26, 0x0C,
+    0x41, 0x60, 0x35, 0x32, 0x5D, 0x7E, 0x4B, 0x46, 0x75, 0x57, 0x2F, 0x2F,
+    0x57, 0x75, 0x46, 0x45, 0x76, 0x56, 0x30, 0x30, 0x56, 0x76, 0x0A, 0x34,
+    0x61, 0x83, 0x4F, 0x4F, 0x84, 0x61, 0x35, 0x04, 0x03, 0x04, 0x03, 0x16,
+    0x2E, 0x23, 0x21, 0x32, 0x1F, 0x0C, 0x03, 0x0B, 0x19, 0x61, 0x86, 0x52,
+    0x4F, 0x83, 0x61, 0x34, 0x16, 0x32, 0x5A, 0x7C, 0x49, 0x4A, 0x7B, 0x5C,
+    0x32, 0x32, 0x5C, 0x7B, 0x4A, 0x49, 0x7C, 0x5A, 0x32, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x68, 0x06, 0x26, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA8, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0x75, 0x02, 0xE7, 0x03, 0x1F, 0x06, 0x26, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x68, 0x06, 0x26, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x80, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x90, 0x06, 0x26, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x40, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x54, 0x06, 0x26, 0x00, 0x91,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0x94, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x6A, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2B, 0x00, 0xC6, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x6F, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x42, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x3D, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x95, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0xE0, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x27, 0x03, 0x3C, 0x00, 0x95, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x29, 0x00, 0xA8, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6,
+    0x02, 0xE7, 0x03, 0xE0, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27,
+    0x03, 0x3C, 0x00, 0x95, 0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x80,
+    0x00, 0x78, 0x00, 0x03, 0x00, 0x37, 0xFF, 0x14, 0x02, 0xE7, 0x02, 0xC6,
+    0x00, 0x17, 0x00, 0x2B, 0x00, 0x3F, 0x00, 0x00, 0x45, 0x22, 0x26, 0x35,
+    0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x03, 0x15, 0x14, 0x16, 0x33, 0x32,
+    0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E,
+    0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E,
+    0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E,
+    0x02, 0x02, 0x06, 0x2A, 0x3A, 0x19, 0x2A, 0x35, 0x1C, 0x05, 0x1B, 0x30,
+    0x24, 0x14, 0x2D, 0x21, 0x1A, 0x26, 0x0B, 0x0F, 0x0C, 0x30, 0x95, 0x4B,
+    0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x4B, 0x7E, 0x5D, 0x32, 0x32,
+    0x5D, 0x7E, 0x4B, 0x46, 0x75, 0x57, 0x2F, 0x2F, 0x57, 0x75, 0x46, 0x45,
+    0x76, 0x56, 0x30, 0x30, 0x56, 0x76, 0xEC, 0x3B, 0x2D, 0x20, 0x34, 0x2C,
+    0x26, 0x11, 0x12, 0x11, 0x25, 0x27, 0x2C, 0x19, 0x26, 0x2F, 0x19, 0x14,
+    0x0D, 0x18, 0x1E, 0xE2, 0x34, 0x61, 0x83, 0x4F, 0x4F, 0x84, 0x61, 0x35,
+    0x35, 0x60, 0x84, 0x50, 0x4F, 0x83, 0x61, 0x34, 0x16, 0x32, 0x5A, 0x7C,
+    0x49, 0x4A, 0x7B, 0x5C, 0x32, 0x32, 0x5C, 0x7B, 0x4A, 0x49, 0x7C, 0x5A,
+    0x32, 0x00, 0x00, 0x03, 0x00, 0x36, 0xFF, 0xEE, 0x02, 0xE6, 0x02, 0xCE,
+    0x00, 0x03, 0x00, 0x17, 0x00, 0x2B, 0x00, 0x00, 0x57, 0x27, 0x01, 0x17,
+    0x01, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
+    0x15, 0x14, 0x0E, 0x02, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x72, 0x13, 0x02, 0x4D,
+    0x13, 0xFE, 0xCF, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x4B,
+    0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x46, 0x75, 0x57, 0x2F, 0x2F,
+    0x57, 0x75, 0x46, 0x45, 0x76, 0x56, 0x30, 0x30, 0x56, 0x76, 0x12, 0x0E,
+    0x02, 0xD2, 0x0E, 0xFD, 0x36, 0x34, 0x61, 0x83, 0x4F, 0x4F, 0x84, 0x61,
+    0x35, 0x35, 0x60, 0x84, 0x50, 0x4F, 0x83, 0x61, 0x34, 0x16, 0x32, 0x5A,
+    0x7C, 0x49, 0x4A, 0x7B, 0x5C, 0x32, 0x32, 0x5C, 0x7B, 0x4A, 0x49, 0x7C,
+    0x5A, 0x32, 0xFF, 0xFF, 0x00, 0x36, 0xFF, 0xEE, 0x02, 0xE6, 0x03, 0x68,
+    0x06, 0x26, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA8,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0x54,
+    0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x07, 0x03, 0x38, 0x00, 0x94,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0xE0,
+    0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27, 0x03, 0x38, 0x00, 0x94,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xA8, 0x00, 0x78, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0xF6, 0x02, 0xE7, 0x03, 0xC5, 0x06, 0x26, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x27, 0x03, 0x38, 0x00, 0x94, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x23, 0x00, 0x95, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xF6,
+    0x02, 0xE7, 0x03, 0xB5, 0x06, 0x26, 0x00, 0x80, 0x00, 0x00, 0x00, 0x27,
+    0x03, 0x38, 0x00, 0x94, 0x00, 0x00, 0x00, 0x07, 0x03, 0x3C, 0x00, 0x95,
+    0x00, 0x78, 0x00, 0x02, 0x00, 0x37, 0x00, 0x00, 0x03, 0xA9, 0x02, 0xBC,
+    0x00, 0x14, 0x00, 0x21, 0x00, 0x00, 0x61, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x21, 0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21,
+    0x15, 0x01, 0x14, 0x1E, 0x02, 0x33, 0x33, 0x11, 0x23, 0x22, 0x0E, 0x02,
+    0x01, 0x7C, 0x3F, 0x75, 0x5C, 0x35, 0x34, 0x58, 0x72, 0x3E, 0x02, 0x36,
+    0xFE, 0x8F, 0x01, 0x37, 0xFE, 0xC9, 0x01, 0x6B, 0xFC, 0xAB, 0x33, 0x57,
+    0x6E, 0x3C, 0xA0, 0xA9, 0x39, 0x6C, 0x54, 0x32, 0x34, 0x5F, 0x80, 0x4B,
+    0x4C, 0x80, 0x5E, 0x34, 0x16, 0xFE, 0xCF, 0x16, 0xFE, 0xB7, 0x16, 0x01,
+    0x5E, 0x45, 0x78, 0x59, 0x32, 0x02, 0x90, 0x31, 0x59, 0x78, 0x00, 0x02,
+    0x00, 0x6E, 0x00, 0x00, 0x02, 0x21, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x17,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x23, 0x11, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x23, 0x6E, 0xFB, 0x37, 0x53, 0x2E, 0x2E, 0x53, 0x37, 0xE5, 0xEB,
+    0x2F, 0x45, 0x27, 0x27, 0x45, 0x2F, 0xEB, 0x02, 0xBC, 0x31, 0x57, 0x39,
+    0x40, 0x61, 0x37, 0xFE, 0xDD, 0x01, 0x39, 0x31, 0x58, 0x39, 0x32, 0x4D,
+    0x2C, 0x00, 0x00, 0x02, 0x00, 0x6E, 0x00, 0x00, 0x01, 0xFF, 0x02, 0xBC,
+    0x00, 0x0E, 0x00, 0x19, 0x00, 0x00, 0x73, 0x11, 0x33, 0x15, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x15, 0x35, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x6E, 0x16, 0xC5, 0x35,
+    0x52, 0x2F, 0x2F, 0x53, 0x35, 0xC4, 0xC3, 0x33, 0x49, 0x26, 0x25, 0x48,
+    0x35, 0xC3, 0x02, 0xBC, 0x9D, 0x2E, 0x53, 0x38, 0x34, 0x55, 0x32, 0xAB,
+    0xC1, 0x2F, 0x4B, 0x2B, 0x30, 0x4A, 0x29, 0x00, 0x00, 0x03, 0x00, 0x37,
+    0xFF, 0xB2, 0x02, 0xE7, 0x02, 0xC6, 0x00, 0x03, 0x00, 0x17, 0x00, 0x2B,
+    0x00, 0x00, 0x45, 0x03, 0x37, 0x13, 0x25, 0x22, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32,
+    0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x1E, 0x02, 0x02, 0x8C, 0xFE, 0x12, 0xFD, 0xFE, 0xF2, 0x4B, 0x7E, 0x5D,
+    0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E,
+    0x4B, 0x46, 0x75, 0x57, 0x2F, 0x2F, 0x57, 0x75, 0x46, 0x45, 0x76, 0x56,
+    0x30, 0x30, 0x56, 0x76, 0x4E, 0x01, 0x52, 0x0C, 0xFE, 0xAF, 0x37, 0x34,
+    0x61, 0x83, 0x4F, 0x4F, 0x84, 0x61, 0x35, 0x35, 0x60, 0x84, 0x50, 0x4F,
+    0x83, 0x61, 0x34, 0x16, 0x32, 0x5A, 0x7C, 0x49, 0x4A, 0x7B, 0x5C, 0x32,
+    0x32, 0x5C, 0x7B, 0x4A, 0x49, 0x7C, 0x5A, 0x32, 0x00, 0x03, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x39, 0x02, 0xBC, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x1B,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x23, 0x11, 0x21, 0x03, 0x37, 0x13, 0x01, 0x33, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x6E, 0xFB, 0x37, 0x53, 0x2E, 0x2E,
+    0x53, 0x37, 0xE5, 0x01, 0x9B, 0xAF, 0x17, 0xB2, 0xFE, 0x4B, 0xEB, 0x2F,
+    0x45, 0x27, 0x27, 0x45, 0x2F, 0xEB, 0x02, 0xBC, 0x31, 0x57, 0x39, 0x40,
+    0x61, 0x37, 0xFE, 0xDD, 0x01, 0x2A, 0x07, 0xFE, 0xCF, 0x01, 0x39, 0x31,
+    0x58, 0x39, 0x32, 0x4D, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00,
+    0x02, 0x39, 0x03, 0x68, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x29, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0x00, 0x00, 0x02, 0x39,
+    0x03, 0x61, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31,
+    0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x34, 0x02, 0x39, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x37, 0x00,
+    0xFF, 0xFF, 0x00, 0x4C, 0x00, 0x00, 0x02, 0x39, 0x03, 0x6A, 0x06, 0x26,
+    0x00, 0xA7, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0xE6, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0x75, 0x02, 0x39, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xA7,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x37, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0x00, 0x00, 0x02, 0x39, 0x03, 0x6F, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x42, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x87,
+    0x02, 0x39, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xA7, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0x37, 0x00, 0x00, 0x01, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F,
+    0x02, 0xC6, 0x00, 0x36, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x27, 0x37,
+    0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x27, 0x2E,
+    0x03, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E,
+    0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03,
+    0x15, 0x14, 0x06, 0x06, 0x01, 0x2F, 0x3B, 0x62, 0x4C, 0x1B, 0x12, 0x26,
+    0x7A, 0x52, 0x38, 0x5B, 0x36, 0x17, 0x2A, 0x3B, 0x4A, 0x2A, 0x2F, 0x4A,
+    0x33, 0x1B, 0x23, 0x3D, 0x53, 0x30, 0x36, 0x52, 0x3C, 0x17, 0x11, 0x16,
+    0x38, 0x4B, 0x31, 0x39, 0x5D, 0x36, 0x1A, 0x30, 0x44, 0x2A, 0x3C, 0x5E,
+    0x42, 0x23, 0x3B, 0x66, 0x0A, 0x1D, 0x38, 0x28, 0x10, 0x3B, 0x3C, 0x29,
+    0x48, 0x2F, 0x1D, 0x2C, 0x22, 0x1B, 0x18, 0x0C, 0x0D, 0x21, 0x2B, 0x39,
+    0x26, 0x27, 0x44, 0x31, 0x1C, 0x17, 0x2D, 0x1F, 0x0F, 0x1D, 0x29, 0x16,
+    0x2A, 0x49, 0x2F, 0x22, 0x33, 0x27, 0x1C, 0x0B, 0x0F, 0x22, 0x2C, 0x3B,
+    0x27, 0x34, 0x52, 0x30, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F,
+    0x03, 0x68, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29,
+    0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F, 0x03, 0x74,
+    0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2A, 0x42, 0x00,
+    0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F, 0x03, 0x61, 0x06, 0x26,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31, 0x2C, 0x00, 0xFF, 0xFF,
+    0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F, 0x03, 0xC7, 0x06, 0x26, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x31, 0x2C, 0x00, 0x00, 0x07, 0x03, 0x26,
+    0x00, 0x2C, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0x1D, 0x02, 0x0F,
+    0x02, 0xC6, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x45,
+    0x31, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F, 0x03, 0x61,
+    0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x2C, 0x00,
+    0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0x34, 0x02, 0x0F, 0x02, 0xC6, 0x06, 0x26,
+    0x00, 0xAF, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0x38, 0x00, 0xFF, 0xFF,
+    0x00, 0x2B, 0xFF, 0xF6, 0x02, 0x0F, 0x03, 0x4F, 0x06, 0x26, 0x00, 0xAF,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x26, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x2B,
+    0xFF, 0x75, 0x02, 0x0F, 0x02, 0xC6, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x2B, 0xFF, 0x75,
+    0x02, 0x0F, 0x03, 0x4F, 0x06, 0x26, 0x00, 0xAF, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x0E, 0x38, 0x00, 0x00, 0x06, 0x03, 0x26, 0x2C, 0x00, 0x00, 0x01,
+    0x00, 0x6E, 0xFF, 0xF6, 0x02, 0x9B, 0x02, 0xC6, 0x00, 0x3B, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x15,
+    0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16,
+    0x17, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x01, 0xB8, 0x27, 0x49, 0x3E,
+    0x15, 0x11, 0x24, 0x5E, 0x31, 0x5D, 0x6E, 0x26, 0x3E, 0x24, 0x35, 0x3B,
+    0x18, 0x1F, 0x3A, 0x50, 0x31, 0x21, 0x66, 0x46, 0x43, 0x60, 0x3D, 0x1C,
+    0x17, 0x37, 0x79, 0x64, 0x49, 0x6B, 0x26, 0x02, 0x3D, 0x60, 0x37, 0x20,
+    0x3B, 0x27, 0x24, 0x41, 0x2A, 0x38, 0x66, 0x0A, 0x16, 0x27, 0x1B, 0x0F,
+    0x29, 0x28, 0x5B, 0x50, 0x32, 0x3B, 0x29, 0x15, 0x20, 0x2B, 0x27, 0x18,
+    0x19, 0x29, 0x21, 0x19, 0x09, 0x05, 0x1A, 0x2A, 0x20, 0x47, 0x71, 0x51,
+    0xFE, 0x79, 0x01, 0x92, 0x67, 0x89, 0x44, 0x2B, 0x21, 0x19, 0x0A, 0x20,
+    0x2D, 0x1E, 0x19, 0x24, 0x25, 0x19, 0x16, 0x2B, 0x3F, 0x35, 0x41, 0x58,
+    0x2D, 0x00, 0x00, 0x01, 0x00, 0x36, 0xFF, 0xF6, 0x02, 0xE4, 0x02, 0xC6,
+    0x00, 0x2A, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x37, 0x35, 0x21, 0x15,
+    0x21, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02,
+    0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02,
+    0x15, 0x14, 0x0E, 0x02, 0x01, 0x8B, 0x4B, 0x7E, 0x5B, 0x31, 0x01, 0x02,
+    0xA1, 0xFD, 0x75, 0x2D, 0x54, 0x76, 0x48, 0x45, 0x74, 0x58, 0x30, 0x34,
+    0x5F, 0x7E, 0x4A, 0x2B, 0x53, 0x48, 0x1D, 0x0F, 0x1D, 0x50, 0x5A, 0x2D,
+    0x4E, 0x87, 0x63, 0x38, 0x34, 0x5E, 0x7D, 0x0A, 0x37, 0x63, 0x84, 0x4D,
+    0x0C, 0x16, 0x45, 0x77, 0x5C, 0x33, 0x32, 0x5A, 0x7B, 0x49, 0x49, 0x7C,
+    0x5C, 0x33, 0x19, 0x2B, 0x1B, 0x10, 0x1D, 0x2E, 0x1A, 0x37, 0x63, 0x86,
+    0x4E, 0x4E, 0x81, 0x5F, 0x34, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00,
+    0x01, 0xD4, 0x02, 0xBC, 0x00, 0x07, 0x00, 0x00, 0x73, 0x11, 0x23, 0x35,
+    0x21, 0x15, 0x23, 0x11, 0xE9, 0xD5, 0x01, 0xC0, 0xD5, 0x02, 0xA6, 0x16,
+    0x16, 0xFD, 0x5A, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x00, 0x01, 0xD4,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x03, 0x11, 0x23, 0x35, 0x21, 0x15, 0x23, 0x11, 0x6D, 0x01, 0x0C, 0x90,
+    0xD5, 0x01, 0xC0, 0xD5, 0x01, 0x54, 0x15, 0x15, 0xFE, 0xAC, 0x02, 0xA6,
+    0x16, 0x16, 0xFD, 0x5A, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x01, 0xD4,
+    0x03, 0x61, 0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31,
+    0xFA, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x1D, 0x01, 0xD4, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x45, 0xF3, 0x00,
+    0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x34, 0x01, 0xD4, 0x02, 0xBC, 0x06, 0x26,
+    0x00, 0xBC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x44, 0xFA, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0xFF, 0x75, 0x01, 0xD4, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0xFA, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0xFF, 0x87, 0x01, 0xD4, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xBC, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x14, 0xFA, 0x00, 0x00, 0x01, 0x00, 0x6E, 0xFF, 0xFA,
+    0x02, 0x7A, 0x02, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35,
+    0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x01, 0x70, 0x4B, 0x75, 0x42, 0x16,
+    0x3C, 0x6A, 0x46, 0x48, 0x6E, 0x3E, 0x16, 0x45, 0x78, 0x06, 0x47, 0x7C,
+    0x50, 0x01, 0xAF, 0xFE, 0x5A, 0x4D, 0x76, 0x43, 0x43, 0x76, 0x4D, 0x01,
+    0xA6, 0xFE, 0x51, 0x50, 0x7C, 0x47, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA,
+    0x02, 0x7A, 0x03, 0x68, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x29, 0x00, 0x8D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA,
+    0x02, 0x7A, 0x03, 0x6A, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x32, 0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A,
+    0x03, 0x61, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31,
+    0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A, 0x03, 0x61,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x7A, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A, 0x03, 0x6A, 0x06, 0x26,
+    0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x41, 0x33, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A, 0x03, 0x4D, 0x06, 0x26, 0x00, 0xC3,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0x75, 0x02, 0x7A, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA,
+    0x02, 0x7A, 0x03, 0x68, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x28, 0x65, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A,
+    0x03, 0x90, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40,
+    0x7A, 0x00, 0x00, 0x01, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0xED, 0x03, 0x1F,
+    0x00, 0x1E, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11,
+    0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x32, 0x36,
+    0x35, 0x33, 0x14, 0x06, 0x06, 0x23, 0x37, 0x11, 0x14, 0x06, 0x06, 0x01,
+    0x70, 0x4B, 0x75, 0x42, 0x16, 0x3C, 0x6A, 0x46, 0x48, 0x6E, 0x3E, 0x09,
+    0x33, 0x37, 0x16, 0x1D, 0x39, 0x2B, 0x0E, 0x45, 0x78, 0x06, 0x47, 0x7C,
+    0x50, 0x01, 0xAF, 0xFE, 0x5A, 0x4D, 0x76, 0x43, 0x43, 0x76, 0x4D, 0x01,
+    0xA6, 0x31, 0x32, 0x27, 0x36, 0x1B, 0x0D, 0xFE, 0x59, 0x50, 0x7C, 0x47,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0xED, 0x03, 0x68, 0x06, 0x26,
+    0x00, 0xCD, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x8D, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0x75, 0x02, 0xED, 0x03, 0x1F, 0x06, 0x26,
+    0x00, 0xCD, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x7A, 0x00, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0xFA, 0x02, 0xED, 0x03, 0x68, 0x06, 0x26, 0x00, 0xCD,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x65, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0xFA, 0x02, 0xED, 0x03, 0x90, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x40, 0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA,
+    0x02, 0xED, 0x03, 0x54, 0x06, 0x26, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x38, 0x79, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A,
+    0x03, 0x6A, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x07, 0x03, 0x2B,
+    0x00, 0xAB, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A,
+    0x03, 0x6F, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42,
+    0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A, 0x03, 0x3D,
+    0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x7A, 0x00,
+    0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A, 0x03, 0xC5, 0x06, 0x26,
+    0x00, 0xC3, 0x00, 0x00, 0x00, 0x26, 0x03, 0x3C, 0x7A, 0x00, 0x00, 0x07,
+    0x03, 0x23, 0x00, 0x7A, 0x00, 0x78, 0x00, 0x02, 0x00, 0x6E, 0xFF, 0x14,
+    0x02, 0x7A, 0x02, 0xBC, 0x00, 0x17, 0x00, 0x2D, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x03, 0x15, 0x14, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x22, 0x26, 0x26, 0x35,
+    0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11,
+    0x33, 0x11, 0x14, 0x06, 0x06, 0x01, 0xCB, 0x2A, 0x3A, 0x19, 0x2A, 0x35,
+    0x1C, 0x05, 0x1B, 0x30, 0x24, 0x14, 0x2D, 0x21, 0x1A, 0x26, 0x0B, 0x0F,
+    0x0C, 0x30, 0x79, 0x4B, 0x75, 0x42, 0x16, 0x3C, 0x6A, 0x46, 0x48, 0x6E,
+    0x3E, 0x16, 0x45, 0x78, 0xEC, 0x3B, 0x2D, 0x20, 0x34, 0x2C, 0x26, 0x11,
+    0x12, 0x11, 0x25, 0x27, 0x2C, 0x19, 0x26, 0x2F, 0x19, 0x14, 0x0D, 0x18,
+    0x1E, 0xE6, 0x47, 0x7C, 0x50, 0x01, 0xAF, 0xFE, 0x5A, 0x4D, 0x76, 0x43,
+    0x43, 0x76, 0x4D, 0x01, 0xA6, 0xFE, 0x51, 0x50, 0x7C, 0x47, 0xFF, 0xFF,
+    0x00, 0x6E, 0xFF, 0xFA, 0x02, 0x7A, 0x03, 0x63, 0x06, 0x26, 0x00, 0xC3,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x37, 0x7A, 0x00, 0xFF, 0xFF, 0x00, 0x6E,
+    0xFF, 0xFA, 0x02, 0x7A, 0x03, 0x54, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x38, 0x79, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xFA,
+    0x02, 0x7A, 0x03, 0xE0, 0x06, 0x26, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x38, 0x79, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0x8D, 0x00, 0x78,
+    0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x02, 0x48, 0x02, 0xBC, 0x00, 0x10,
+    0x00, 0x00, 0x61, 0x01, 0x33, 0x13, 0x1E, 0x03, 0x17, 0x23, 0x3E, 0x02,
+    0x37, 0x13, 0x33, 0x01, 0x01, 0x20, 0xFE, 0xF4, 0x1A, 0xEC, 0x06, 0x08,
+    0x07, 0x04, 0x01, 0x0D, 0x01, 0x07, 0x0A, 0x07, 0xEE, 0x1A, 0xFE, 0xF3,
+    0x02, 0xBC, 0xFD, 0x90, 0x0F, 0x16, 0x11, 0x0B, 0x03, 0x03, 0x11, 0x1B,
+    0x13, 0x02, 0x72, 0xFD, 0x44, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00,
+    0x03, 0x3D, 0x02, 0xBC, 0x00, 0x22, 0x00, 0x00, 0x73, 0x03, 0x33, 0x13,
+    0x1E, 0x03, 0x17, 0x23, 0x3E, 0x02, 0x37, 0x13, 0x33, 0x13, 0x1E, 0x02,
+    0x17, 0x23, 0x3E, 0x04, 0x37, 0x13, 0x33, 0x03, 0x23, 0x03, 0x33, 0x03,
+    0xD8, 0xC4, 0x18, 0x8E, 0x08, 0x0B, 0x0A, 0x0C, 0x09, 0x0C, 0x14, 0x1A,
+    0x12, 0x09, 0x78, 0x0F, 0x77, 0x04, 0x0D, 0x1D, 0x1C, 0x0D, 0x0A, 0x0A,
+    0x06, 0x06, 0x0A, 0x09, 0x8E, 0x18, 0xC4, 0x1A, 0xC0, 0x13, 0xC0, 0x02,
+    0xBC, 0xFE, 0x05, 0x1E, 0x29, 0x24, 0x29, 0x1E, 0x31, 0x42, 0x31, 0x17,
+    0x01, 0x3E, 0xFE, 0xC2, 0x0C, 0x21, 0x48, 0x46, 0x20, 0x24, 0x15, 0x15,
+    0x23, 0x21, 0x01, 0xFB, 0xFD, 0x44, 0x01, 0xF3, 0xFE, 0x0D, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x03, 0x3D, 0x03, 0x68, 0x06, 0x26, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x00, 0xC2, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x03, 0x3D, 0x03, 0x61, 0x06, 0x26, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x2C, 0x00, 0xAF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x03, 0x3D, 0x03, 0x4D, 0x06, 0x26, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x23, 0x00, 0xAF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x03, 0x3D, 0x03, 0x68, 0x06, 0x26, 0x00, 0xDC,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x28, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x16, 0x00, 0x00, 0x02, 0x32, 0x02, 0xBC, 0x00, 0x05, 0x00, 0x09,
+    0x00, 0x0D, 0x00, 0x00, 0x61, 0x03, 0x03, 0x33, 0x13, 0x01, 0x21, 0x01,
+    0x17, 0x03, 0x13, 0x27, 0x13, 0x33, 0x02, 0x15, 0xFC, 0xFE, 0x1D, 0xEF,
+    0x01, 0x0B, 0xFD, 0xE4, 0x01, 0x03, 0x10, 0xF7, 0xF9, 0x11, 0xF2, 0x1C,
+    0x01, 0x5D, 0x01, 0x5F, 0xFE, 0xB2, 0xFE, 0x92, 0x01, 0x6B, 0x0D, 0xFE,
+    0xA2, 0x01, 0x60, 0x0D, 0x01, 0x4F, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00,
+    0x02, 0x3C, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x00, 0x61, 0x11, 0x17, 0x01,
+    0x33, 0x01, 0x23, 0x13, 0x33, 0x01, 0x37, 0x11, 0x01, 0x21, 0x08, 0xFE,
+    0xEB, 0x1A, 0x01, 0x03, 0x0B, 0xFC, 0x1A, 0xFE, 0xF2, 0x09, 0x01, 0x53,
+    0x27, 0x01, 0x90, 0xFE, 0x8B, 0x01, 0x75, 0xFE, 0x70, 0x27, 0xFE, 0xAD,
+    0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x3C, 0x03, 0x68, 0x06, 0x26,
+    0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x41, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x3C, 0x03, 0x61, 0x06, 0x26, 0x00, 0xE2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x2E, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0x00, 0x00, 0x02, 0x3C, 0x03, 0x4D, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x23, 0x2E, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00,
+    0x02, 0x3C, 0x03, 0x4F, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x26, 0x2E, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x75, 0x02, 0x3C,
+    0x02, 0xBC, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x2E, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x3C, 0x03, 0x68,
+    0x06, 0x26, 0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28, 0x19, 0x00,
+    0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x02, 0x3C, 0x03, 0x90, 0x06, 0x26,
+    0x00, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x2E, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x3C, 0x03, 0x3D, 0x06, 0x26, 0x00, 0xE2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x2E, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0x00, 0x00, 0x02, 0x3C, 0x03, 0x54, 0x06, 0x26, 0x00, 0xE2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x38, 0x2D, 0x00, 0x00, 0x01, 0x00, 0x3C, 0x00, 0x00,
+    0x02, 0x3E, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x35, 0x01, 0x17,
+    0x21, 0x35, 0x21, 0x15, 0x01, 0x27, 0x21, 0x15, 0x3C, 0x01, 0xE5, 0x0C,
+    0xFE, 0x29, 0x01, 0xDD, 0xFE, 0x1B, 0x03, 0x01, 0xF3, 0x18, 0x02, 0x9C,
+    0x0E, 0x16, 0x17, 0xFD, 0x65, 0x0C, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x3C,
+    0x00, 0x00, 0x02, 0x3E, 0x03, 0x68, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x29, 0x56, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00,
+    0x02, 0x3E, 0x03, 0x61, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x31, 0x43, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x02, 0x3E,
+    0x03, 0x4F, 0x06, 0x26, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x26,
+    0x43, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0xFF, 0x75, 0x02, 0x3E, 0x02, 0xBC,
+    0x06, 0x26, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x43, 0x00,
+    0xFF, 0xFF, 0x00, 0x32, 0xFF, 0xF6, 0x03, 0x7F, 0x03, 0x68, 0x04, 0x26,
+    0x00, 0x53, 0x00, 0x00, 0x00, 0x26, 0x03, 0x29, 0xDA, 0x00, 0x00, 0x27,
+    0x00, 0x64, 0x01, 0x82, 0x00, 0x00, 0x00, 0x07, 0x03, 0x29, 0x02, 0x1C,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x8F, 0x00, 0x00, 0x00, 0xA5, 0x02, 0xBC,
+    0x00, 0x06, 0x00, 0x00, 0x73, 0x11, 0x33, 0x32, 0x32, 0x33, 0x11, 0x8F,
+    0x0B, 0x02, 0x06, 0x03, 0x02, 0xBC, 0xFD, 0x44, 0xFF, 0xFF, 0x00, 0x8F,
+    0xFF, 0xF6, 0x02, 0xC7, 0x02, 0xBC, 0x04, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x03, 0x01, 0x34, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0xFF, 0x03, 0x68, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x29, 0xB3, 0x00, 0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00,
+    0x01, 0x1E, 0x03, 0x6A, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x32, 0xA0, 0x00, 0xFF, 0xFF, 0x00, 0x21, 0x00, 0x00, 0x01, 0x13,
+    0x03, 0x61, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x31,
+    0xA0, 0x00, 0xFF, 0xFF, 0x00, 0x20, 0x00, 0x00, 0x01, 0x12, 0x03, 0x61,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x9F, 0x00,
+    0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xE7, 0x03, 0x6A, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x07, 0x03, 0x41, 0xFF, 0x59, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x34, 0x00, 0x00, 0x01, 0x00, 0x03, 0x4D, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x23, 0xA0, 0x00, 0xFF, 0xFF,
+    0x00, 0x34, 0x00, 0x00, 0x01, 0x00, 0x03, 0xE0, 0x06, 0x26, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x24, 0xA0, 0x00, 0xFF, 0xFF, 0x00, 0x7E,
+    0x00, 0x00, 0x00, 0xB6, 0x03, 0x4F, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x26, 0xA0, 0x00, 0xFF, 0xFF, 0x00, 0x7E, 0xFF, 0x75,
+    0x00, 0xB6, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0xA0, 0x00, 0xFF, 0xFF, 0x00, 0x34, 0x00, 0x00, 0x00, 0xD7,
+    0x03, 0x68, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x28,
+    0x8B, 0x00, 0xFF, 0xFF, 0x00, 0x48, 0x00, 0x00, 0x00, 0xEA, 0x03, 0x90,
+    0x06, 0x26, 0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x40, 0x9F, 0x00,
+    0xFF, 0xFF, 0x00, 0x16, 0x00, 0x00, 0x01, 0x1E, 0x03, 0x6F, 0x06, 0x26,
+    0x00, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x42, 0xA0, 0x00, 0xFF, 0xFF,
+    0x00, 0x12, 0x00, 0x00, 0x01, 0x20, 0x03, 0x3D, 0x06, 0x26, 0x00, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x3C, 0x9F, 0x00, 0xFF, 0xFF, 0x00, 0x05,
+    0xFF, 0x1A, 0x00, 0xC3, 0x02, 0xBC, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x46, 0xFF, 0x6A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x15,
+    0x00, 0x00, 0x01, 0x1E, 0x03, 0x54, 0x06, 0x26, 0x00, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x38, 0x9F, 0x00, 0x00, 0x01, 0x00, 0x14, 0xFF, 0xF6,
+    0x01, 0x93, 0x02, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x57, 0x22, 0x2E, 0x02,
+    0x27, 0x37, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33, 0x11,
+    0x14, 0x0E, 0x02, 0xD1, 0x22, 0x3B, 0x30, 0x24, 0x0C, 0x10, 0x13, 0x33,
+    0x41, 0x28, 0x32, 0x4D, 0x2B, 0x16, 0x1D, 0x34, 0x47, 0x0A, 0x12, 0x22,
+    0x30, 0x1E, 0x0F, 0x2A, 0x36, 0x1B, 0x2A, 0x58, 0x47, 0x01, 0xE7, 0xFE,
+    0x19, 0x3A, 0x54, 0x37, 0x1A, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0xF6,
+    0x02, 0x01, 0x03, 0x61, 0x06, 0x26, 0x01, 0x03, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x2C, 0x00, 0x8E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xF6,
+    0x03, 0xA8, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x68, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x03, 0x02, 0x15, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6E, 0xFF, 0xF6,
+    0x04, 0x6E, 0x02, 0xBC, 0x04, 0x26, 0x00, 0x74, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x03, 0x02, 0xDB, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x14, 0x02, 0x12, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x27,
+    0x37, 0x33, 0x11, 0x23, 0x35, 0x37, 0x0E, 0x03, 0x27, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x01, 0x26, 0x49, 0x73, 0x42, 0x44, 0x71, 0x45, 0x2A, 0x4C, 0x3C, 0x29,
+    0x07, 0x06, 0x02, 0x14, 0x16, 0x09, 0x09, 0x29, 0x3C, 0x49, 0x2A, 0x3D,
+    0x63, 0x39, 0x39, 0x63, 0x3F, 0x43, 0x68, 0x3A, 0x3A, 0x68, 0x0A, 0x45,
+    0x79, 0x4E, 0x4F, 0x7B, 0x46, 0x1A, 0x30, 0x42, 0x28, 0x03, 0xAC, 0xFD,
+    0xF3, 0xAC, 0x03, 0x28, 0x44, 0x32, 0x1B, 0x16, 0x3F, 0x70, 0x49, 0x48,
+    0x70, 0x40, 0x40, 0x71, 0x49, 0x47, 0x6F, 0x40, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x14, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x3D, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x14, 0x02, 0xDF, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFF, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14,
+    0x03, 0x5F, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEA,
+    0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75, 0x02, 0x14, 0x02, 0xDF,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x33, 0x00,
+    0x00, 0x06, 0x02, 0xFF, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x14, 0x03, 0x5E, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEB, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14,
+    0x03, 0x72, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEC,
+    0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x03, 0x72,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xED, 0x29, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x02, 0xD6, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x29, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x14, 0x03, 0x4F, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xEE, 0x00, 0x51, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0x75, 0x02, 0x14, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x0E, 0x33, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x29, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x03, 0x4D, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF, 0x33, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x03, 0x72, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF0, 0x54, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x14, 0x03, 0x68, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF1, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x14, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0A, 0xF3, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2,
+    0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75, 0x02, 0x14, 0x02, 0x12,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x33, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x15, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x02, 0xF8, 0x06, 0x26, 0x01, 0x07,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x14, 0x02, 0xE9, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x14, 0x02, 0xAD, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x18, 0x02, 0x2D,
+    0x02, 0x12, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x07, 0x03, 0x12,
+    0x00, 0xD9, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14,
+    0x03, 0x04, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00,
+    0x29, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14, 0x03, 0xA3,
+    0x06, 0x26, 0x01, 0x07, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x29, 0x00,
+    0x00, 0x07, 0x02, 0xF8, 0x00, 0x3D, 0x00, 0xC3, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x14, 0x02, 0xCA, 0x06, 0x26, 0x01, 0x07, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x29, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6,
+    0x03, 0x90, 0x02, 0x12, 0x00, 0x40, 0x00, 0x55, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x21, 0x07, 0x35, 0x34, 0x26,
+    0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37,
+    0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x07, 0x21, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x13, 0x35, 0x34,
+    0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E,
+    0x02, 0x15, 0x15, 0xDA, 0x33, 0x50, 0x2F, 0x1A, 0x34, 0x4D, 0x33, 0x02,
+    0x8E, 0x0A, 0x36, 0x5B, 0x37, 0x44, 0x65, 0x38, 0x01, 0x01, 0x3C, 0x69,
+    0x45, 0x34, 0x58, 0x23, 0x0C, 0x19, 0x39, 0x43, 0x26, 0x4C, 0x74, 0x41,
+    0x24, 0x41, 0x5A, 0x36, 0x42, 0x66, 0x39, 0x02, 0xFD, 0x62, 0x2A, 0x43,
+    0x2D, 0x18, 0x2B, 0x47, 0x2B, 0x34, 0x5C, 0x49, 0x17, 0x0D, 0x18, 0x4C,
+    0x62, 0xA8, 0x17, 0x2B, 0x40, 0x29, 0x39, 0x63, 0x24, 0x10, 0x1B, 0x41,
+    0x4B, 0x2A, 0x2D, 0x47, 0x32, 0x1A, 0x0A, 0x28, 0x47, 0x30, 0x21, 0x33,
+    0x24, 0x12, 0x0F, 0x17, 0x3F, 0x60, 0x35, 0x3F, 0x6E, 0x47, 0x49, 0x72,
+    0x40, 0x26, 0x21, 0x12, 0x17, 0x21, 0x13, 0x46, 0x7C, 0x4F, 0x37, 0x60,
+    0x4A, 0x29, 0x3A, 0x6B, 0x49, 0x1A, 0x0F, 0x1E, 0x2B, 0x1C, 0x29, 0x3D,
+    0x23, 0x26, 0x45, 0x2E, 0x13, 0x2F, 0x46, 0x27, 0x01, 0x1E, 0x5B, 0x20,
+    0x34, 0x25, 0x14, 0x32, 0x2E, 0x10, 0x21, 0x2E, 0x17, 0x16, 0x2B, 0x3E,
+    0x27, 0x58, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x03, 0x90, 0x02, 0xE0,
+    0x06, 0x26, 0x01, 0x21, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF8, 0x00, 0xF4,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x46, 0xFF, 0xF6, 0x02, 0x32, 0x02, 0xE4,
+    0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x27, 0x17,
+    0x07, 0x23, 0x11, 0x33, 0x11, 0x07, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x38, 0x28, 0x4B,
+    0x3E, 0x2A, 0x07, 0x06, 0x02, 0x14, 0x16, 0x09, 0x0A, 0x2A, 0x3C, 0x49,
+    0x28, 0x49, 0x73, 0x42, 0x44, 0x71, 0x46, 0x43, 0x68, 0x3A, 0x3A, 0x68,
+    0x45, 0x3D, 0x63, 0x39, 0x39, 0x63, 0x0A, 0x1B, 0x31, 0x41, 0x27, 0x03,
+    0xA7, 0x02, 0xE4, 0xFE, 0x78, 0x03, 0x29, 0x43, 0x32, 0x1B, 0x45, 0x79,
+    0x4E, 0x4F, 0x7B, 0x46, 0x16, 0x40, 0x71, 0x49, 0x47, 0x6F, 0x40, 0x3F,
+    0x70, 0x49, 0x48, 0x70, 0x40, 0x00, 0x00, 0x01, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xFA, 0x02, 0x12, 0x00, 0x1F, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23,
+    0x22, 0x06, 0x06, 0x07, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x01, 0x32, 0x4E, 0x78, 0x44, 0x44, 0x78, 0x4E, 0x3F, 0x66,
+    0x23, 0x10, 0x16, 0x39, 0x43, 0x26, 0x47, 0x6D, 0x3F, 0x01, 0x01, 0x3F,
+    0x6D, 0x47, 0x25, 0x42, 0x39, 0x16, 0x10, 0x24, 0x64, 0x0A, 0x46, 0x7C,
+    0x4F, 0x4E, 0x79, 0x44, 0x2F, 0x28, 0x11, 0x1A, 0x24, 0x14, 0x3F, 0x6E,
+    0x48, 0x49, 0x72, 0x40, 0x13, 0x25, 0x19, 0x10, 0x28, 0x2F, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x01, 0xFA, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x24,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x4D, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xFA, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x1D,
+    0x01, 0xFA, 0x02, 0x12, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x11, 0x30, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x1D, 0x01, 0xFA,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x26, 0x03, 0x11,
+    0x30, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x4D, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xFA, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFC, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xFA, 0x02, 0xD1, 0x06, 0x26, 0x01, 0x24, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0x39, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x14,
+    0x02, 0xE4, 0x00, 0x18, 0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x27, 0x11, 0x33,
+    0x11, 0x23, 0x35, 0x37, 0x0E, 0x03, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x26,
+    0x49, 0x73, 0x42, 0x44, 0x71, 0x45, 0x28, 0x4B, 0x3E, 0x2A, 0x07, 0x06,
+    0x16, 0x16, 0x09, 0x0A, 0x2A, 0x3C, 0x48, 0x2A, 0x3D, 0x63, 0x39, 0x39,
+    0x63, 0x3F, 0x43, 0x68, 0x3A, 0x3A, 0x68, 0x0A, 0x45, 0x79, 0x4E, 0x4F,
+    0x7B, 0x46, 0x1B, 0x31, 0x41, 0x27, 0x03, 0x01, 0x83, 0xFD, 0x1C, 0xAC,
+    0x03, 0x28, 0x44, 0x32, 0x1B, 0x16, 0x3F, 0x70, 0x49, 0x48, 0x70, 0x40,
+    0x40, 0x71, 0x49, 0x47, 0x6F, 0x40, 0x00, 0x03, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x18, 0x02, 0xE3, 0x00, 0x1E, 0x00, 0x2E, 0x00, 0x36, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x27, 0x34, 0x2E, 0x03, 0x27, 0x37, 0x1E, 0x04, 0x15, 0x14, 0x06,
+    0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x16, 0x03, 0x27, 0x3F, 0x02, 0x17, 0x07, 0x07,
+    0x01, 0x20, 0x49, 0x70, 0x3F, 0x25, 0x44, 0x5C, 0x37, 0x37, 0x61, 0x3E,
+    0x05, 0x0A, 0x20, 0x38, 0x4C, 0x58, 0x30, 0x0A, 0x3C, 0x65, 0x50, 0x37,
+    0x1D, 0x40, 0x70, 0x48, 0x42, 0x66, 0x39, 0x39, 0x66, 0x42, 0x42, 0x65,
+    0x3A, 0x3A, 0x65, 0x3A, 0x04, 0xC9, 0x0D, 0x71, 0x06, 0x62, 0x0E, 0x0A,
+    0x45, 0x7B, 0x51, 0x3C, 0x61, 0x45, 0x26, 0x31, 0x49, 0x24, 0x02, 0x30,
+    0x5E, 0x53, 0x44, 0x2E, 0x08, 0x15, 0x0D, 0x36, 0x53, 0x6E, 0x8A, 0x52,
+    0x4D, 0x7A, 0x46, 0x16, 0x40, 0x72, 0x49, 0x47, 0x6D, 0x3E, 0x3E, 0x6D,
+    0x47, 0x49, 0x72, 0x40, 0x02, 0x32, 0x16, 0x36, 0x03, 0x1F, 0x15, 0x1A,
+    0x04, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x82, 0x02, 0xE4,
+    0x04, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFB, 0x01, 0x68,
+    0x00, 0x42, 0x00, 0x03, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x7B, 0x02, 0xE4,
+    0x00, 0x03, 0x00, 0x1C, 0x00, 0x2C, 0x00, 0x00, 0x41, 0x35, 0x21, 0x15,
+    0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02,
+    0x17, 0x27, 0x11, 0x33, 0x11, 0x23, 0x35, 0x37, 0x0E, 0x03, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x6F, 0x01, 0x0C, 0xFE, 0xAB, 0x49, 0x73, 0x42, 0x44,
+    0x71, 0x45, 0x28, 0x4B, 0x3E, 0x2A, 0x07, 0x06, 0x16, 0x16, 0x09, 0x0A,
+    0x2A, 0x3C, 0x48, 0x2A, 0x3D, 0x63, 0x39, 0x39, 0x63, 0x3F, 0x43, 0x68,
+    0x3A, 0x3A, 0x68, 0x02, 0x6F, 0x15, 0x15, 0xFD, 0x87, 0x45, 0x79, 0x4E,
+    0x4F, 0x7B, 0x46, 0x1B, 0x31, 0x41, 0x27, 0x03, 0x01, 0x83, 0xFD, 0x1C,
+    0xAC, 0x03, 0x28, 0x44, 0x32, 0x1B, 0x16, 0x3F, 0x70, 0x49, 0x48, 0x70,
+    0x40, 0x40, 0x71, 0x49, 0x47, 0x6F, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0x75, 0x02, 0x14, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x2B, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0E, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x87,
+    0x02, 0x14, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x14, 0x34, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x03, 0xE6,
+    0x02, 0xE4, 0x04, 0x26, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x01, 0xF2,
+    0x02, 0x5C, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFD, 0x02, 0x39, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0x12, 0x00, 0x27,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x1E, 0x02, 0x07, 0x07, 0x21, 0x35, 0x21, 0x07, 0x37, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x07, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x0E, 0x02, 0x01, 0x29, 0x4C, 0x74, 0x41, 0x24, 0x41, 0x5A, 0x36, 0x32,
+    0x54, 0x3D, 0x20, 0x02, 0x01, 0xFE, 0x37, 0x01, 0xBE, 0x0C, 0x02, 0x36,
+    0x5B, 0x37, 0x44, 0x65, 0x38, 0x01, 0x01, 0x3C, 0x69, 0x45, 0x34, 0x58,
+    0x23, 0x0C, 0x19, 0x39, 0x43, 0x0A, 0x46, 0x7C, 0x4F, 0x3B, 0x62, 0x47,
+    0x27, 0x21, 0x3F, 0x58, 0x37, 0x1A, 0x16, 0x11, 0x19, 0x40, 0x60, 0x35,
+    0x3F, 0x6F, 0x47, 0x49, 0x72, 0x40, 0x26, 0x21, 0x12, 0x17, 0x21, 0x13,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x37, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0xDF, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x00, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x1D,
+    0x02, 0x00, 0x02, 0xDF, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x11, 0x28, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x23, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x00, 0x03, 0x4F, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xEE, 0x4B, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75,
+    0x02, 0x00, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x0E, 0x30, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x23, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x03, 0x4D, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xEF, 0x2D, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x00, 0x03, 0x72, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF0, 0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x00, 0x03, 0x68, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF1, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A,
+    0xED, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0xD1,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x23, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0xD1, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x23, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0x75, 0x02, 0x00, 0x02, 0x12, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x30, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x00, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF7, 0x0F, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x00, 0x02, 0xF8, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x09, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00,
+    0x02, 0xE9, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B,
+    0x23, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x02, 0xAD,
+    0x06, 0x26, 0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x23, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x03, 0x49, 0x06, 0x26,
+    0x01, 0x32, 0x00, 0x00, 0x00, 0x06, 0x03, 0x08, 0x23, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x00, 0x03, 0x49, 0x06, 0x26, 0x01, 0x32,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x07, 0x23, 0x00, 0x00, 0x02, 0x00, 0x28,
+    0xFF, 0x18, 0x02, 0x00, 0x02, 0x12, 0x00, 0x15, 0x00, 0x3D, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x15,
+    0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x27, 0x22, 0x26,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x07, 0x21,
+    0x35, 0x21, 0x07, 0x37, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07,
+    0x1E, 0x02, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x96, 0x26,
+    0x39, 0x26, 0x42, 0x2A, 0x05, 0x3D, 0x44, 0x2A, 0x1F, 0x18, 0x23, 0x0B,
+    0x0F, 0x08, 0x1A, 0x20, 0x80, 0x4C, 0x74, 0x41, 0x24, 0x41, 0x5A, 0x36,
+    0x32, 0x54, 0x3D, 0x20, 0x02, 0x01, 0xFE, 0x37, 0x01, 0xBE, 0x0C, 0x02,
+    0x36, 0x5B, 0x37, 0x44, 0x65, 0x38, 0x01, 0x01, 0x3C, 0x69, 0x45, 0x34,
+    0x58, 0x23, 0x0C, 0x19, 0x39, 0x43, 0xE8, 0x3A, 0x2B, 0x28, 0x44, 0x3C,
+    0x1A, 0x10, 0x2A, 0x59, 0x2C, 0x24, 0x2E, 0x19, 0x14, 0x0D, 0x10, 0x18,
+    0x0E, 0xDE, 0x46, 0x7C, 0x4F, 0x3B, 0x62, 0x47, 0x27, 0x21, 0x3F, 0x58,
+    0x37, 0x1A, 0x16, 0x11, 0x19, 0x40, 0x60, 0x35, 0x3F, 0x6F, 0x47, 0x49,
+    0x72, 0x40, 0x26, 0x21, 0x12, 0x17, 0x21, 0x13, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x00, 0x02, 0xCA, 0x06, 0x26, 0x01, 0x32, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x23, 0x00, 0x00, 0x01, 0x00, 0x23, 0xFF, 0xFB,
+    0x01, 0xF9, 0x02, 0x17, 0x00, 0x26, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x37, 0x21, 0x15, 0x21, 0x37, 0x07, 0x14, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E,
+    0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x01, 0x04, 0x42,
+    0x65, 0x3A, 0x01, 0x01, 0xC9, 0xFE, 0x42, 0x0C, 0x02, 0x36, 0x5B, 0x37,
+    0x44, 0x65, 0x39, 0x3D, 0x69, 0x45, 0x34, 0x58, 0x23, 0x0C, 0x19, 0x39,
+    0x43, 0x26, 0x4C, 0x74, 0x41, 0x24, 0x41, 0x5A, 0x05, 0x3A, 0x6C, 0x49,
+    0x1A, 0x16, 0x11, 0x19, 0x3F, 0x60, 0x36, 0x3F, 0x6F, 0x47, 0x4A, 0x71,
+    0x40, 0x26, 0x21, 0x12, 0x17, 0x21, 0x13, 0x46, 0x7B, 0x50, 0x3B, 0x62,
+    0x47, 0x27, 0x00, 0x02, 0x00, 0x1E, 0x00, 0x00, 0x01, 0x54, 0x02, 0xEE,
+    0x00, 0x14, 0x00, 0x18, 0x00, 0x00, 0x73, 0x11, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x11,
+    0x23, 0x22, 0x22, 0x03, 0x35, 0x21, 0x15, 0x8C, 0x1A, 0x30, 0x1F, 0x24,
+    0x2D, 0x0E, 0x0E, 0x12, 0x27, 0x1A, 0x18, 0x24, 0x15, 0x08, 0x04, 0x07,
+    0x71, 0x01, 0x1C, 0x02, 0x72, 0x2C, 0x37, 0x19, 0x17, 0x13, 0x0F, 0x14,
+    0x0F, 0x13, 0x2D, 0x27, 0xFD, 0x8F, 0x01, 0xF7, 0x16, 0x16, 0x00, 0x02,
+    0x00, 0x28, 0xFF, 0x10, 0x02, 0x14, 0x02, 0x12, 0x00, 0x28, 0x00, 0x38,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x1E, 0x02, 0x33, 0x32, 0x36,
+    0x36, 0x35, 0x35, 0x37, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x1E, 0x03, 0x17, 0x27, 0x37, 0x33, 0x11, 0x14,
+    0x0E, 0x02, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x26, 0x36, 0x5F, 0x20, 0x0B,
+    0x15, 0x33, 0x3E, 0x23, 0x39, 0x63, 0x3D, 0x09, 0x0D, 0x42, 0x5C, 0x36,
+    0x49, 0x73, 0x42, 0x44, 0x71, 0x45, 0x20, 0x3D, 0x36, 0x2C, 0x1D, 0x06,
+    0x06, 0x02, 0x14, 0x25, 0x42, 0x56, 0x32, 0x3D, 0x63, 0x39, 0x39, 0x63,
+    0x3F, 0x43, 0x68, 0x3A, 0x3B, 0x68, 0xF0, 0x26, 0x24, 0x14, 0x16, 0x20,
+    0x12, 0x3C, 0x6F, 0x4D, 0x8E, 0x03, 0x36, 0x53, 0x30, 0x45, 0x79, 0x4E,
+    0x4F, 0x7B, 0x46, 0x12, 0x20, 0x2D, 0x36, 0x1F, 0x03, 0xAC, 0xFE, 0x08,
+    0x3D, 0x61, 0x43, 0x24, 0xFC, 0x3F, 0x70, 0x49, 0x48, 0x70, 0x40, 0x40,
+    0x71, 0x49, 0x47, 0x6F, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x10,
+    0x02, 0x14, 0x02, 0xDF, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFF, 0x2A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x10, 0x02, 0x14,
+    0x02, 0xD6, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0x2A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x10, 0x02, 0x14, 0x02, 0xD6,
+    0x06, 0x26, 0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x2A, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x10, 0x02, 0x14, 0x02, 0xEA, 0x06, 0x26,
+    0x01, 0x4B, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0C, 0x2A, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0x10, 0x02, 0x14, 0x02, 0xD1, 0x06, 0x26, 0x01, 0x4B,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF5, 0x2A, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0x10, 0x02, 0x14, 0x02, 0xAD, 0x06, 0x26, 0x01, 0x4B, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x05, 0x2A, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00,
+    0x01, 0xD9, 0x02, 0xE4, 0x00, 0x1C, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11,
+    0x07, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x22, 0x22, 0x46,
+    0x16, 0x09, 0x0B, 0x3D, 0x55, 0x30, 0x3B, 0x52, 0x2C, 0x16, 0x27, 0x49,
+    0x35, 0x2A, 0x47, 0x34, 0x1D, 0x0B, 0x02, 0x05, 0x02, 0xE4, 0xFE, 0xB0,
+    0x02, 0x23, 0x3A, 0x23, 0x2A, 0x59, 0x47, 0xFE, 0xB8, 0x01, 0x48, 0x3F,
+    0x50, 0x25, 0x1D, 0x2B, 0x2D, 0x0F, 0xFE, 0x88, 0x00, 0x02, 0xFF, 0xF0,
+    0x00, 0x00, 0x01, 0xD9, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00,
+    0x43, 0x35, 0x21, 0x15, 0x03, 0x11, 0x33, 0x11, 0x07, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x0E, 0x02, 0x15, 0x11, 0x23, 0x22, 0x22, 0x10, 0x01, 0x0C, 0xB6, 0x16,
+    0x09, 0x0B, 0x3D, 0x55, 0x30, 0x3B, 0x52, 0x2C, 0x16, 0x27, 0x49, 0x35,
+    0x2A, 0x47, 0x34, 0x1D, 0x0B, 0x02, 0x05, 0x02, 0x73, 0x15, 0x15, 0xFD,
+    0x8D, 0x02, 0xE4, 0xFE, 0xB0, 0x02, 0x23, 0x3A, 0x23, 0x2A, 0x59, 0x47,
+    0xFE, 0xB8, 0x01, 0x48, 0x3F, 0x50, 0x25, 0x1D, 0x2B, 0x2D, 0x0F, 0xFE,
+    0x88, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x4B, 0x01, 0xD9, 0x02, 0xE4,
+    0x06, 0x26, 0x01, 0x52, 0x00, 0x00, 0x00, 0x06, 0x03, 0x13, 0x15, 0x00,
+    0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x01, 0xD9, 0x03, 0x89, 0x06, 0x26,
+    0x01, 0x52, 0x00, 0x00, 0x00, 0x06, 0x03, 0x2C, 0x15, 0x28, 0xFF, 0xFF,
+    0x00, 0x46, 0xFF, 0x75, 0x01, 0xD9, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x52,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x15, 0x00, 0x00, 0x02, 0x00, 0x46,
+    0x00, 0x00, 0x00, 0x7E, 0x02, 0xD1, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x11, 0x03, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x57, 0x16, 0x0B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D,
+    0x0F, 0x0E, 0x02, 0x0D, 0xFD, 0xF3, 0x02, 0x97, 0x10, 0x0D, 0x0C, 0x11,
+    0x10, 0x0D, 0x0D, 0x10, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x00, 0x5C,
+    0x02, 0x0D, 0x00, 0x03, 0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x46, 0x16,
+    0x02, 0x0D, 0xFD, 0xF3, 0xFF, 0xFF, 0x00, 0x18, 0x00, 0x00, 0x00, 0xB2,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF8,
+    0xFF, 0x6B, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0xD5,
+    0x02, 0xDF, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFF,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0xCA,
+    0x02, 0xD6, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFD,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0xCA,
+    0x02, 0xD6, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFC,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0xA4,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0A,
+    0xFF, 0x21, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0xB8,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF2,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0xB8,
+    0x03, 0x4F, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF3,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x35, 0x00, 0x00, 0x00, 0x6D,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF5,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x75, 0x00, 0x7E,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0x57, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E,
+    0xFF, 0x68, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8A,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x02, 0xF7,
+    0xFF, 0x43, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2,
+    0x02, 0xF8, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x09,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0xD5,
+    0x02, 0xE9, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0B,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x3E, 0x01, 0x2F,
+    0x02, 0xD1, 0x04, 0x26, 0x01, 0x57, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x00, 0xC4, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xCA, 0x00, 0x00, 0x00, 0xD8,
+    0x02, 0xAD, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05,
+    0xFF, 0x57, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x18, 0x00, 0x75,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x27, 0x02, 0xF5,
+    0xFF, 0x57, 0x00, 0x00, 0x00, 0x07, 0x03, 0x12, 0xFF, 0x21, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0xCF, 0x02, 0xCA, 0x06, 0x26,
+    0x01, 0x58, 0x00, 0x00, 0x00, 0x07, 0x03, 0x01, 0xFF, 0x57, 0x00, 0x00,
+    0x00, 0x02, 0xFF, 0xD6, 0xFF, 0x3E, 0x00, 0x6B, 0x02, 0xD1, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x00, 0x47, 0x27, 0x32, 0x36, 0x36, 0x35, 0x11, 0x33,
+    0x11, 0x14, 0x06, 0x06, 0x13, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x22, 0x08, 0x2A, 0x31, 0x15, 0x16, 0x1E, 0x38,
+    0x49, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0xC2, 0x15, 0x1E, 0x35,
+    0x22, 0x02, 0x45, 0xFD, 0xB7, 0x2B, 0x3C, 0x1F, 0x03, 0x59, 0x10, 0x0D,
+    0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0x3E,
+    0x00, 0x66, 0x02, 0x0D, 0x00, 0x0B, 0x00, 0x00, 0x47, 0x27, 0x32, 0x36,
+    0x36, 0x35, 0x11, 0x33, 0x11, 0x14, 0x06, 0x06, 0x18, 0x08, 0x2A, 0x31,
+    0x15, 0x16, 0x1E, 0x38, 0xC2, 0x15, 0x1E, 0x35, 0x22, 0x02, 0x45, 0xFD,
+    0xB7, 0x2B, 0x3C, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x3E, 0x00, 0xD2,
+    0x02, 0xD6, 0x06, 0x26, 0x01, 0x6A, 0x00, 0x00, 0x00, 0x07, 0x02, 0xFC,
+    0xFF, 0x5F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x01, 0xD3,
+    0x02, 0xE4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x35,
+    0x01, 0x33, 0x01, 0x11, 0x33, 0x11, 0x21, 0x03, 0x37, 0x01, 0x54, 0x01,
+    0x3D, 0x20, 0xFE, 0x95, 0x16, 0x01, 0x58, 0xFD, 0x11, 0x01, 0x0B, 0xB3,
+    0x20, 0x01, 0x3A, 0xFD, 0xF3, 0x02, 0xE4, 0xFD, 0x1C, 0x01, 0x23, 0x10,
+    0xFE, 0xCD, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x34, 0x01, 0xD3, 0x02, 0xE4,
+    0x06, 0x26, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0xF3, 0x00,
+    0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x01, 0xD3, 0x02, 0x0D, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x35, 0x01, 0x33, 0x01, 0x11,
+    0x33, 0x11, 0x21, 0x03, 0x37, 0x01, 0x54, 0x01, 0x3D, 0x20, 0xFE, 0x95,
+    0x16, 0x01, 0x58, 0xFD, 0x11, 0x01, 0x0B, 0xB3, 0x20, 0x01, 0x3A, 0xFD,
+    0xF3, 0x02, 0x0D, 0xFD, 0xF3, 0x01, 0x23, 0x10, 0xFE, 0xCD, 0x00, 0x01,
+    0x00, 0x5C, 0x00, 0x00, 0x00, 0x72, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x11, 0x5C, 0x16, 0x02, 0xE4, 0xFD, 0x1C, 0xFF, 0xFF,
+    0x00, 0x29, 0x00, 0x00, 0x00, 0xCC, 0x03, 0x90, 0x06, 0x26, 0x01, 0x6F,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x29, 0x80, 0x28, 0xFF, 0xFF, 0x00, 0x5C,
+    0x00, 0x00, 0x00, 0xEC, 0x02, 0xE4, 0x04, 0x26, 0x01, 0x6F, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFB, 0xD2, 0x42, 0xFF, 0xFF, 0x00, 0x48, 0xFF, 0x34,
+    0x00, 0x87, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x10, 0xFF, 0x6D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0x00, 0x00,
+    0x00, 0xD5, 0x02, 0xE4, 0x04, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0x69, 0x00, 0x45, 0x01, 0x54, 0xFF, 0xFF, 0x00, 0x4B, 0xFF, 0x75,
+    0x00, 0x83, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x0E, 0xFF, 0x6D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5C, 0xFF, 0x3E,
+    0x01, 0x2B, 0x02, 0xE4, 0x04, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07,
+    0x01, 0x69, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0x87,
+    0x00, 0xEF, 0x02, 0xE4, 0x06, 0x26, 0x01, 0x6F, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x14, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x00,
+    0x01, 0x1A, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27,
+    0x25, 0x17, 0x03, 0x11, 0x33, 0x11, 0x12, 0x08, 0x01, 0x08, 0x08, 0x7F,
+    0x16, 0x01, 0x1B, 0x15, 0x79, 0x15, 0xFE, 0x6C, 0x02, 0xE4, 0xFD, 0x1C,
+    0x00, 0x01, 0x00, 0x41, 0x00, 0x00, 0x03, 0x2E, 0x02, 0x12, 0x00, 0x31,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x17, 0x27, 0x3E, 0x03, 0x33, 0x32, 0x16,
+    0x16, 0x17, 0x07, 0x37, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11,
+    0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23,
+    0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x41, 0x14,
+    0x03, 0x0F, 0x12, 0x2D, 0x34, 0x39, 0x1F, 0x2B, 0x45, 0x30, 0x0B, 0x0C,
+    0x06, 0x0D, 0x29, 0x33, 0x3B, 0x1F, 0x39, 0x4F, 0x2A, 0x16, 0x25, 0x46,
+    0x33, 0x27, 0x42, 0x30, 0x1B, 0x16, 0x25, 0x46, 0x33, 0x29, 0x44, 0x33,
+    0x1B, 0x02, 0x0D, 0x84, 0x03, 0x24, 0x33, 0x20, 0x0F, 0x1A, 0x3B, 0x32,
+    0x06, 0x11, 0x1E, 0x2F, 0x1F, 0x10, 0x2A, 0x59, 0x47, 0xFE, 0xB8, 0x01,
+    0x48, 0x3F, 0x50, 0x25, 0x1A, 0x2B, 0x33, 0x18, 0xFE, 0x94, 0x01, 0x48,
+    0x3F, 0x50, 0x25, 0x1D, 0x2B, 0x2D, 0x0F, 0xFE, 0x88, 0x00, 0xFF, 0xFF,
+    0x00, 0x41, 0xFF, 0x75, 0x03, 0x2E, 0x02, 0x12, 0x06, 0x26, 0x01, 0x78,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x0E, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x46, 0x00, 0x00, 0x01, 0xD9, 0x02, 0x12, 0x00, 0x1C, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x17, 0x07, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11,
+    0x23, 0x22, 0x22, 0x46, 0x14, 0x02, 0x09, 0x0B, 0x3C, 0x55, 0x31, 0x3B,
+    0x52, 0x2C, 0x16, 0x27, 0x49, 0x35, 0x2A, 0x47, 0x34, 0x1D, 0x0B, 0x02,
+    0x05, 0x02, 0x0D, 0x79, 0x03, 0x22, 0x3B, 0x24, 0x2A, 0x59, 0x47, 0xFE,
+    0xB8, 0x01, 0x48, 0x3F, 0x50, 0x25, 0x1D, 0x2B, 0x2D, 0x0F, 0xFE, 0x88,
+    0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x01, 0xD9, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x2E, 0x00, 0xFF, 0xFF,
+    0xFF, 0xF6, 0x00, 0x00, 0x02, 0x05, 0x02, 0xBC, 0x04, 0x26, 0x02, 0xA0,
+    0xBE, 0x00, 0x00, 0x06, 0x01, 0x7A, 0x2C, 0x00, 0xFF, 0xFF, 0x00, 0x46,
+    0x00, 0x00, 0x01, 0xD9, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x1A, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x34,
+    0x01, 0xD9, 0x02, 0x12, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x10, 0x15, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x01, 0xD9,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF5,
+    0x1A, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0xFF, 0x75, 0x01, 0xD9, 0x02, 0x12,
+    0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x15, 0x00,
+    0x00, 0x01, 0xFF, 0xD6, 0xFF, 0x3E, 0x01, 0xD9, 0x02, 0x12, 0x00, 0x22,
+    0x00, 0x00, 0x47, 0x27, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33, 0x17, 0x07,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26,
+    0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x14, 0x06, 0x06, 0x22, 0x08,
+    0x1F, 0x2B, 0x1A, 0x0C, 0x14, 0x01, 0x09, 0x0A, 0x3C, 0x57, 0x31, 0x3B,
+    0x52, 0x2C, 0x16, 0x27, 0x49, 0x35, 0x2A, 0x47, 0x34, 0x1D, 0x1E, 0x38,
+    0xC2, 0x15, 0x11, 0x1F, 0x2B, 0x1A, 0x02, 0x45, 0x78, 0x06, 0x23, 0x3C,
+    0x24, 0x2A, 0x59, 0x47, 0xFE, 0xB8, 0x01, 0x48, 0x40, 0x4F, 0x25, 0x1D,
+    0x2B, 0x2D, 0x0F, 0xFE, 0x4C, 0x2B, 0x3C, 0x1F, 0xFF, 0xFF, 0x00, 0x46,
+    0xFF, 0x3E, 0x02, 0x88, 0x02, 0xD1, 0x04, 0x26, 0x01, 0x7A, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x69, 0x02, 0x1D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x46,
+    0xFF, 0x87, 0x01, 0xD9, 0x02, 0x12, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x14, 0x15, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00,
+    0x01, 0xD9, 0x02, 0xCA, 0x06, 0x26, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x01, 0x1A, 0x00, 0x00, 0x01, 0x00, 0x46, 0xFF, 0x3E, 0x01, 0xD9,
+    0x02, 0x12, 0x00, 0x1F, 0x00, 0x00, 0x45, 0x27, 0x32, 0x36, 0x35, 0x11,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11, 0x23, 0x11, 0x33,
+    0x17, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x15, 0x11, 0x14, 0x06, 0x06,
+    0x01, 0x5B, 0x08, 0x3E, 0x32, 0x27, 0x49, 0x35, 0x2A, 0x47, 0x34, 0x1D,
+    0x16, 0x14, 0x02, 0x19, 0x3D, 0x47, 0x27, 0x3B, 0x52, 0x2C, 0x1E, 0x38,
+    0xC2, 0x15, 0x41, 0x34, 0x01, 0x80, 0x3F, 0x50, 0x25, 0x1D, 0x2B, 0x2D,
+    0x0F, 0xFE, 0x88, 0x02, 0x0D, 0x69, 0x27, 0x30, 0x17, 0x2A, 0x59, 0x47,
+    0xFE, 0x7C, 0x2B, 0x3C, 0x1F, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x3F, 0x02, 0x12, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x34, 0x4F, 0x79, 0x44, 0x44,
+    0x79, 0x4F, 0x4F, 0x79, 0x43, 0x43, 0x79, 0x4F, 0x47, 0x6E, 0x40, 0x40,
+    0x6E, 0x47, 0x47, 0x6F, 0x40, 0x40, 0x6F, 0x0A, 0x46, 0x7C, 0x4F, 0x4E,
+    0x79, 0x44, 0x44, 0x79, 0x4E, 0x4F, 0x7C, 0x46, 0x16, 0x40, 0x72, 0x49,
+    0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x49, 0x72, 0x40, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xDF, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFF, 0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x3F, 0x02, 0xD6, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFD, 0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F,
+    0x02, 0xD6, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC,
+    0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x4F,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEE, 0x62, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75, 0x02, 0x3F, 0x02, 0xD6, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0x3A, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F,
+    0x03, 0x4D, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF,
+    0x44, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x72,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF0, 0x65, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x68, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF1, 0x39, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0x04, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xD1, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF2, 0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x3F, 0x03, 0x52, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x26,
+    0x02, 0xF2, 0x3A, 0x00, 0x00, 0x07, 0x03, 0x05, 0x00, 0x3A, 0x00, 0xA5,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x52, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x02, 0xF5, 0x3A, 0x00, 0x00, 0x07,
+    0x03, 0x05, 0x00, 0x3A, 0x00, 0xA5, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75,
+    0x02, 0x3F, 0x02, 0x12, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7,
+    0x26, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xF8,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x39, 0x00,
+    0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0x70, 0x00, 0x1D,
+    0x00, 0x2D, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x33, 0x14,
+    0x06, 0x06, 0x27, 0x37, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x34, 0x4F, 0x79, 0x44, 0x44, 0x79, 0x4F, 0x13, 0x24,
+    0x10, 0x0C, 0x19, 0x0C, 0x2E, 0x32, 0x16, 0x21, 0x3D, 0x2A, 0x07, 0x49,
+    0x55, 0x43, 0x79, 0x4F, 0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x47, 0x6F,
+    0x40, 0x40, 0x6F, 0x0A, 0x46, 0x7C, 0x4F, 0x4E, 0x79, 0x44, 0x04, 0x04,
+    0x02, 0x03, 0x39, 0x32, 0x28, 0x3D, 0x1E, 0x06, 0x0B, 0x1C, 0x83, 0x58,
+    0x4F, 0x7C, 0x46, 0x16, 0x40, 0x72, 0x49, 0x47, 0x6E, 0x40, 0x40, 0x6E,
+    0x47, 0x49, 0x72, 0x40, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8,
+    0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75, 0x02, 0x3F, 0x02, 0x70,
+    0x06, 0x26, 0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x3A, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0x97, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0x26, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xF8, 0x06, 0x26, 0x01, 0x97,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xCA, 0x06, 0x26, 0x01, 0x97, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x3F, 0x02, 0xE0, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFA, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F,
+    0x02, 0xE9, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0B,
+    0x3A, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x02, 0xAD,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x3A, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x49, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x08, 0x3A, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x49, 0x06, 0x26, 0x01, 0x86,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x07, 0x3A, 0x00, 0x00, 0x03, 0x00, 0x28,
+    0xFF, 0x18, 0x02, 0x3F, 0x02, 0x12, 0x00, 0x15, 0x00, 0x25, 0x00, 0x35,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x17, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x27,
+    0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0xA7, 0x26, 0x39, 0x25,
+    0x3C, 0x23, 0x05, 0x33, 0x40, 0x2A, 0x1F, 0x18, 0x23, 0x0B, 0x0F, 0x08,
+    0x1A, 0x20, 0x86, 0x4F, 0x79, 0x44, 0x44, 0x79, 0x4F, 0x4F, 0x79, 0x43,
+    0x43, 0x79, 0x4F, 0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x47, 0x6F, 0x40,
+    0x40, 0x6F, 0xE8, 0x3A, 0x2B, 0x28, 0x43, 0x37, 0x16, 0x10, 0x22, 0x57,
+    0x2C, 0x24, 0x2E, 0x19, 0x14, 0x0D, 0x10, 0x18, 0x0E, 0xDE, 0x46, 0x7C,
+    0x4F, 0x4E, 0x79, 0x44, 0x44, 0x79, 0x4E, 0x4F, 0x7C, 0x46, 0x16, 0x40,
+    0x72, 0x49, 0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x49, 0x72, 0x40, 0x00,
+    0x00, 0x03, 0x00, 0x28, 0xFF, 0xED, 0x02, 0x3F, 0x02, 0x1A, 0x00, 0x03,
+    0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x57, 0x27, 0x01, 0x17, 0x03, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x51, 0x10, 0x01, 0xCD, 0x11, 0xEB,
+    0x4F, 0x79, 0x44, 0x44, 0x79, 0x4F, 0x4F, 0x79, 0x43, 0x43, 0x79, 0x4F,
+    0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x47, 0x6F, 0x40, 0x40, 0x6F, 0x13,
+    0x0E, 0x02, 0x1F, 0x0F, 0xFD, 0xEB, 0x46, 0x7C, 0x4F, 0x4E, 0x79, 0x44,
+    0x44, 0x79, 0x4E, 0x4F, 0x7C, 0x46, 0x16, 0x40, 0x72, 0x49, 0x47, 0x6E,
+    0x40, 0x40, 0x6E, 0x47, 0x49, 0x72, 0x40, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xED, 0x02, 0x3F, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xA3, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x4E, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x02, 0x3F, 0x02, 0xCA, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x01, 0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F,
+    0x03, 0x4C, 0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x03,
+    0x39, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x4E,
+    0x06, 0x26, 0x01, 0x86, 0x00, 0x00, 0x00, 0x06, 0x03, 0x02, 0x39, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x3F, 0x03, 0x52, 0x06, 0x26,
+    0x01, 0x86, 0x00, 0x00, 0x00, 0x26, 0x03, 0x01, 0x39, 0x00, 0x00, 0x07,
+    0x03, 0x05, 0x00, 0x3A, 0x00, 0xA5, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6,
+    0x04, 0x01, 0x02, 0x12, 0x00, 0x39, 0x00, 0x49, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x07, 0x07, 0x21, 0x37, 0x21, 0x07,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x27,
+    0x33, 0x0E, 0x02, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x34, 0x4F, 0x79, 0x44,
+    0x44, 0x79, 0x4F, 0x46, 0x6E, 0x48, 0x0B, 0x0E, 0x0A, 0x42, 0x65, 0x40,
+    0x32, 0x54, 0x3D, 0x20, 0x02, 0x01, 0xFE, 0x3C, 0x01, 0x01, 0xBC, 0x0D,
+    0x38, 0x5C, 0x35, 0x31, 0x52, 0x3D, 0x22, 0x3A, 0x6A, 0x47, 0x34, 0x58,
+    0x23, 0x0C, 0x18, 0x3A, 0x43, 0x26, 0x43, 0x6B, 0x44, 0x0B, 0x0E, 0x0B,
+    0x47, 0x6F, 0x46, 0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x47, 0x6F, 0x40,
+    0x40, 0x6F, 0x0A, 0x46, 0x7C, 0x4F, 0x4E, 0x79, 0x44, 0x36, 0x5F, 0x40,
+    0x02, 0x41, 0x60, 0x36, 0x21, 0x3F, 0x58, 0x37, 0x1A, 0x16, 0x09, 0x1D,
+    0x3E, 0x5A, 0x31, 0x23, 0x42, 0x5A, 0x36, 0x45, 0x72, 0x44, 0x26, 0x21,
+    0x12, 0x16, 0x22, 0x13, 0x37, 0x63, 0x41, 0x41, 0x63, 0x37, 0x16, 0x40,
+    0x72, 0x49, 0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x49, 0x72, 0x40, 0x00,
+    0x00, 0x02, 0x00, 0x46, 0xFF, 0x1A, 0x02, 0x32, 0x02, 0x12, 0x00, 0x16,
+    0x00, 0x26, 0x00, 0x00, 0x57, 0x11, 0x33, 0x17, 0x07, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27,
+    0x17, 0x11, 0x37, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x46, 0x14, 0x02, 0x09, 0x0D, 0x42,
+    0x5C, 0x36, 0x49, 0x73, 0x42, 0x44, 0x71, 0x45, 0x35, 0x61, 0x43, 0x09,
+    0x06, 0xDB, 0x43, 0x68, 0x3A, 0x3A, 0x68, 0x45, 0x3D, 0x63, 0x39, 0x39,
+    0x63, 0xE6, 0x02, 0xF3, 0xB1, 0x03, 0x36, 0x54, 0x2F, 0x45, 0x79, 0x4E,
+    0x4F, 0x7B, 0x46, 0x2F, 0x52, 0x33, 0x03, 0xFE, 0x73, 0xF2, 0x40, 0x71,
+    0x49, 0x47, 0x6F, 0x40, 0x3F, 0x70, 0x49, 0x48, 0x70, 0x40, 0x00, 0x02,
+    0x00, 0x46, 0xFF, 0x1A, 0x02, 0x3C, 0x02, 0xE4, 0x00, 0x17, 0x00, 0x27,
+    0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x1E,
+    0x02, 0x15, 0x14, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x27, 0x33, 0x11,
+    0x37, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x46, 0x16, 0x08, 0x10, 0x44, 0x5F, 0x3A, 0x33,
+    0x5B, 0x46, 0x27, 0x42, 0x72, 0x48, 0x3A, 0x60, 0x43, 0x0F, 0x08, 0xE0,
+    0x45, 0x69, 0x3C, 0x3D, 0x6A, 0x43, 0x41, 0x67, 0x3B, 0x3C, 0x66, 0xE6,
+    0x03, 0xCA, 0xFE, 0x7C, 0x01, 0x34, 0x50, 0x2D, 0x28, 0x49, 0x63, 0x3B,
+    0x4E, 0x79, 0x46, 0x2C, 0x4E, 0x34, 0xFE, 0x76, 0xF2, 0x40, 0x70, 0x47,
+    0x48, 0x71, 0x40, 0x40, 0x70, 0x48, 0x49, 0x70, 0x3F, 0x00, 0x00, 0x02,
+    0x00, 0x28, 0xFF, 0x1A, 0x02, 0x14, 0x02, 0x12, 0x00, 0x18, 0x00, 0x28,
+    0x00, 0x00, 0x45, 0x11, 0x37, 0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x1E, 0x02, 0x17, 0x27, 0x37, 0x33, 0x11,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x01, 0xFE, 0x09, 0x0A, 0x2A, 0x3C, 0x48, 0x29,
+    0x49, 0x73, 0x42, 0x44, 0x71, 0x45, 0x28, 0x4B, 0x3E, 0x2A, 0x07, 0x06,
+    0x02, 0x14, 0xEF, 0x3D, 0x63, 0x39, 0x39, 0x63, 0x3F, 0x43, 0x68, 0x3A,
+    0x3A, 0x68, 0xE6, 0x01, 0x92, 0x03, 0x28, 0x44, 0x32, 0x1B, 0x45, 0x79,
+    0x4E, 0x4F, 0x7B, 0x46, 0x1B, 0x31, 0x41, 0x27, 0x03, 0xAC, 0xFD, 0x0D,
+    0xF2, 0x3F, 0x70, 0x49, 0x48, 0x70, 0x40, 0x40, 0x71, 0x49, 0x47, 0x6F,
+    0x40, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x01, 0x3C, 0x02, 0x12,
+    0x00, 0x15, 0x00, 0x00, 0x73, 0x11, 0x33, 0x17, 0x07, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x11,
+    0x46, 0x14, 0x01, 0x06, 0x07, 0x2B, 0x49, 0x32, 0x11, 0x1D, 0x0C, 0x07,
+    0x10, 0x1D, 0x0B, 0x28, 0x3D, 0x28, 0x14, 0x02, 0x0D, 0x7F, 0x02, 0x21,
+    0x3D, 0x28, 0x04, 0x04, 0x17, 0x05, 0x04, 0x20, 0x34, 0x3B, 0x1B, 0xFE,
+    0xAE, 0x00, 0xFF, 0xFF, 0x00, 0x46, 0x00, 0x00, 0x01, 0x3C, 0x02, 0xE0,
+    0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0xD6, 0x00,
+    0xFF, 0xFF, 0x00, 0x43, 0x00, 0x00, 0x01, 0x3C, 0x02, 0xD6, 0x06, 0x26,
+    0x01, 0xAD, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0xC2, 0x00, 0xFF, 0xFF,
+    0x00, 0x37, 0xFF, 0x34, 0x01, 0x3C, 0x02, 0x12, 0x06, 0x26, 0x01, 0xAD,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0x10, 0xFF, 0x5C, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFD, 0x00, 0x00, 0x01, 0x3C, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xAD,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0A, 0x8C, 0x00, 0xFF, 0xFF, 0x00, 0x3A,
+    0xFF, 0x75, 0x01, 0x3C, 0x02, 0x12, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x0E, 0xFF, 0x5C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x38,
+    0x00, 0x00, 0x01, 0x40, 0x02, 0xE9, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0xC2, 0x00, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x87,
+    0x01, 0x3C, 0x02, 0x12, 0x06, 0x26, 0x01, 0xAD, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x14, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x2D, 0xFF, 0xF6,
+    0x01, 0xA9, 0x02, 0x12, 0x00, 0x39, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x27, 0x26, 0x26,
+    0x27, 0x26, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0xF8, 0x42, 0x6C, 0x1D, 0x11, 0x1C, 0x60, 0x40, 0x29, 0x3A,
+    0x24, 0x12, 0x2A, 0x14, 0x3C, 0x28, 0x2D, 0x45, 0x16, 0x14, 0x14, 0x19,
+    0x2D, 0x41, 0x28, 0x23, 0x42, 0x3A, 0x17, 0x10, 0x16, 0x34, 0x3B, 0x21,
+    0x24, 0x39, 0x28, 0x14, 0x0E, 0x10, 0x14, 0x41, 0x2B, 0x2D, 0x43, 0x16,
+    0x17, 0x17, 0x2A, 0x50, 0x0A, 0x32, 0x29, 0x0F, 0x25, 0x2F, 0x14, 0x22,
+    0x2B, 0x18, 0x31, 0x1C, 0x0F, 0x16, 0x09, 0x0B, 0x1C, 0x12, 0x11, 0x27,
+    0x18, 0x1F, 0x32, 0x25, 0x13, 0x14, 0x26, 0x1B, 0x12, 0x19, 0x25, 0x13,
+    0x11, 0x1F, 0x29, 0x19, 0x11, 0x20, 0x0D, 0x11, 0x1A, 0x0A, 0x0A, 0x19,
+    0x11, 0x11, 0x2E, 0x1F, 0x2B, 0x41, 0x23, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0xF6, 0x01, 0xA9, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF8, 0x0A, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x01, 0xA9, 0x02, 0xF9, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF9, 0x0C, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x01, 0xA9,
+    0x02, 0xD6, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD,
+    0xF6, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6, 0x01, 0xA9, 0x03, 0x1E,
+    0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFE, 0xF6, 0x00,
+    0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x1D, 0x01, 0xA9, 0x02, 0x12, 0x06, 0x26,
+    0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0xF8, 0x00, 0xFF, 0xFF,
+    0x00, 0x2D, 0xFF, 0xF6, 0x01, 0xA9, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xB5,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0xF6, 0x00, 0xFF, 0xFF, 0x00, 0x2D,
+    0xFF, 0x34, 0x01, 0xA9, 0x02, 0x12, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x10, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0xF6,
+    0x01, 0xA9, 0x02, 0xD1, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0xF6, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x75, 0x01, 0xA9,
+    0x02, 0x12, 0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0xFF, 0x75, 0x01, 0xA9, 0x02, 0xD1,
+    0x06, 0x26, 0x01, 0xB5, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E, 0xFF, 0x00,
+    0x00, 0x06, 0x02, 0xF5, 0xF6, 0x00, 0x00, 0x02, 0x00, 0x1E, 0xFF, 0xF6,
+    0x02, 0x28, 0x02, 0xD8, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x45, 0x26,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x2E, 0x02,
+    0x27, 0x35, 0x3E, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x11,
+    0x23, 0x11, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x23, 0x35, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06, 0x01, 0x35, 0x33,
+    0x15, 0x01, 0x62, 0x3D, 0x51, 0x1C, 0x14, 0x1D, 0x4A, 0x2F, 0x50, 0x5F,
+    0x1E, 0x39, 0x56, 0x38, 0x24, 0x39, 0x29, 0x16, 0x4F, 0x42, 0x53, 0x5A,
+    0x16, 0x2E, 0x55, 0x3B, 0x37, 0x4E, 0x28, 0x2F, 0x4D, 0x2F, 0x45, 0x5E,
+    0x39, 0x18, 0x2D, 0x58, 0xFE, 0x7B, 0x62, 0x0A, 0x01, 0x30, 0x31, 0x0C,
+    0x32, 0x26, 0x4F, 0x61, 0x26, 0x44, 0x39, 0x2F, 0x10, 0x17, 0x02, 0x16,
+    0x26, 0x31, 0x1D, 0x36, 0x4B, 0x69, 0x6C, 0xFE, 0x13, 0x01, 0xEE, 0x4E,
+    0x68, 0x34, 0x29, 0x44, 0x2A, 0x2E, 0x47, 0x28, 0x0C, 0x16, 0x37, 0x40,
+    0x45, 0x24, 0x41, 0x56, 0x2C, 0x01, 0xA9, 0x16, 0x16, 0x00, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x00, 0x01, 0x4F, 0x02, 0x93, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x73, 0x11, 0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0xA3, 0x16,
+    0xA5, 0x01, 0x3B, 0x02, 0x93, 0xFD, 0x6D, 0x01, 0xF7, 0x16, 0x16, 0x00,
+    0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x01, 0x4F, 0x02, 0x93, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x07, 0x11,
+    0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x29, 0x01, 0x0C, 0x92, 0x16, 0xA5,
+    0x01, 0x3B, 0xFC, 0x15, 0x15, 0xFC, 0x02, 0x93, 0xFD, 0x6D, 0x01, 0xF7,
+    0x16, 0x16, 0xFF, 0xFF, 0x00, 0x14, 0x00, 0x00, 0x01, 0x4F, 0x02, 0xE4,
+    0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFB, 0x28, 0x42,
+    0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x1D, 0x01, 0x4F, 0x02, 0x93, 0x06, 0x26,
+    0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x03, 0x11, 0xAD, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0xFF, 0x34, 0x01, 0x4F, 0x02, 0x93, 0x06, 0x26, 0x01, 0xC1,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x10, 0xB5, 0x00, 0xFF, 0xFF, 0x00, 0x14,
+    0x00, 0x00, 0x01, 0x4F, 0x03, 0x28, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF2, 0xB5, 0x57, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x75,
+    0x01, 0x4F, 0x02, 0x93, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0E, 0xB5, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0x87, 0x01, 0x4F,
+    0x02, 0x93, 0x06, 0x26, 0x01, 0xC1, 0x00, 0x00, 0x00, 0x06, 0x03, 0x14,
+    0xB5, 0x00, 0x00, 0x01, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2, 0x02, 0x0D,
+    0x00, 0x19, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x11, 0x33, 0x11,
+    0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x11, 0x33, 0x11, 0x23,
+    0x27, 0x37, 0x0E, 0x02, 0x01, 0x07, 0x3D, 0x55, 0x2C, 0x16, 0x27, 0x4C,
+    0x37, 0x24, 0x41, 0x32, 0x1C, 0x16, 0x14, 0x02, 0x09, 0x0C, 0x38, 0x4D,
+    0x0A, 0x2B, 0x5C, 0x48, 0x01, 0x48, 0xFE, 0xB8, 0x41, 0x52, 0x26, 0x1E,
+    0x2D, 0x2E, 0x10, 0x01, 0x78, 0xFD, 0xF3, 0x79, 0x02, 0x24, 0x3C, 0x25,
+    0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x27, 0x00, 0xFF, 0xFF,
+    0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xDF, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49,
+    0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6,
+    0x01, 0xD2, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xFC, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0A,
+    0xDD, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xD1,
+    0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2, 0x13, 0x00,
+    0xFF, 0xFF, 0x00, 0x49, 0xFF, 0x75, 0x01, 0xD2, 0x02, 0x0D, 0x06, 0x26,
+    0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x13, 0x00, 0xFF, 0xFF,
+    0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xC9,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x49,
+    0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xF8, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x09, 0x13, 0x00, 0x00, 0x01, 0x00, 0x49, 0xFF, 0xF6,
+    0x02, 0x30, 0x02, 0x70, 0x00, 0x23, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26,
+    0x35, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35,
+    0x11, 0x32, 0x3E, 0x02, 0x35, 0x33, 0x14, 0x06, 0x06, 0x23, 0x37, 0x11,
+    0x23, 0x27, 0x37, 0x0E, 0x02, 0x01, 0x07, 0x3D, 0x55, 0x2C, 0x16, 0x27,
+    0x4C, 0x37, 0x24, 0x41, 0x32, 0x1C, 0x1B, 0x24, 0x16, 0x09, 0x16, 0x16,
+    0x30, 0x28, 0x10, 0x14, 0x02, 0x0A, 0x0A, 0x38, 0x4F, 0x0A, 0x2B, 0x5C,
+    0x48, 0x01, 0x48, 0xFE, 0xB8, 0x41, 0x52, 0x26, 0x1E, 0x2D, 0x2E, 0x10,
+    0x01, 0x78, 0x0C, 0x18, 0x26, 0x19, 0x27, 0x35, 0x1B, 0x0C, 0xFD, 0xFB,
+    0x7C, 0x03, 0x24, 0x3F, 0x26, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6,
+    0x02, 0x30, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF8, 0x27, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0x75, 0x02, 0x30,
+    0x02, 0x70, 0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x02, 0x30, 0x02, 0xE0,
+    0x06, 0x26, 0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x02, 0x30, 0x02, 0xF8, 0x06, 0x26,
+    0x01, 0xD3, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x13, 0x00, 0xFF, 0xFF,
+    0x00, 0x49, 0xFF, 0xF6, 0x02, 0x30, 0x02, 0xCA, 0x06, 0x26, 0x01, 0xD3,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49,
+    0xFF, 0xF6, 0x01, 0xD2, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFA, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6,
+    0x01, 0xD2, 0x02, 0xE9, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0B, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2,
+    0x02, 0xAD, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05,
+    0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2, 0x03, 0x44,
+    0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x26, 0x03, 0x05, 0x13, 0x00,
+    0x00, 0x07, 0x02, 0xF2, 0x00, 0x13, 0x00, 0x73, 0xFF, 0xFF, 0x00, 0x49,
+    0xFF, 0x18, 0x01, 0xEB, 0x02, 0x0D, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x12, 0x00, 0x97, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x49,
+    0xFF, 0xF6, 0x01, 0xD2, 0x03, 0x04, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x00, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6,
+    0x01, 0xD2, 0x02, 0xCA, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x01, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x49, 0xFF, 0xF6, 0x01, 0xD2,
+    0x03, 0x4C, 0x06, 0x26, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x06, 0x03, 0x03,
+    0x13, 0x00, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xC4, 0x02, 0x0D,
+    0x00, 0x07, 0x00, 0x00, 0x73, 0x03, 0x33, 0x13, 0x23, 0x13, 0x33, 0x03,
+    0xE2, 0xD3, 0x19, 0xC8, 0x0D, 0xC8, 0x19, 0xD3, 0x02, 0x0D, 0xFE, 0x0B,
+    0x01, 0xF5, 0xFD, 0xF3, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x00, 0x02, 0xD8,
+    0x02, 0x0D, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x03, 0x33, 0x13, 0x23, 0x13,
+    0x33, 0x13, 0x23, 0x13, 0x33, 0x03, 0x23, 0x03, 0x33, 0x03, 0xC8, 0xB9,
+    0x18, 0xB0, 0x0F, 0xA4, 0x0F, 0xA4, 0x0F, 0xB0, 0x18, 0xB9, 0x0E, 0xA5,
+    0x0F, 0xA5, 0x02, 0x0D, 0xFE, 0x0B, 0x01, 0xA4, 0xFE, 0x5C, 0x01, 0xF5,
+    0xFD, 0xF3, 0x01, 0xA6, 0xFE, 0x5A, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00,
+    0x02, 0xD8, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF8, 0x00, 0x8E, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00,
+    0x02, 0xD8, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xFC, 0x00, 0x7A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00,
+    0x02, 0xD8, 0x02, 0xD1, 0x06, 0x26, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF2, 0x00, 0x7A, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00,
+    0x02, 0xD8, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xE2, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF7, 0x00, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0A, 0x00, 0x00,
+    0x01, 0xD1, 0x02, 0x0D, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
+    0x61, 0x27, 0x27, 0x03, 0x33, 0x17, 0x17, 0x13, 0x21, 0x13, 0x17, 0x03,
+    0x13, 0x27, 0x37, 0x33, 0x01, 0xB3, 0xCD, 0x03, 0xCD, 0x1E, 0xBB, 0x07,
+    0xDB, 0xFE, 0x39, 0xDA, 0x10, 0xCC, 0xCF, 0x0C, 0xBB, 0x1E, 0xFF, 0x05,
+    0x01, 0x09, 0xF4, 0x08, 0xFE, 0xEF, 0x01, 0x10, 0x0F, 0xFE, 0xFF, 0x01,
+    0x05, 0x14, 0xF4, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6,
+    0x02, 0x0D, 0x00, 0x10, 0x00, 0x00, 0x57, 0x37, 0x17, 0x03, 0x33, 0x13,
+    0x16, 0x16, 0x17, 0x07, 0x36, 0x36, 0x37, 0x13, 0x33, 0x03, 0x07, 0x9D,
+    0x5F, 0x05, 0xF2, 0x19, 0xD4, 0x08, 0x05, 0x02, 0x09, 0x04, 0x09, 0x04,
+    0xBA, 0x19, 0xD9, 0x57, 0xE6, 0xEF, 0x10, 0x02, 0x14, 0xFE, 0x2C, 0x10,
+    0x0B, 0x05, 0x05, 0x0B, 0x15, 0x0A, 0x01, 0xCF, 0xFD, 0xE6, 0xD9, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x15, 0x00, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xE8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0x1A, 0x01, 0xE6, 0x02, 0xD1, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF2, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x1A,
+    0x01, 0xE6, 0x02, 0xD1, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0x01, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6,
+    0x02, 0x0D, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x07, 0x03, 0x0E,
+    0x00, 0x79, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6,
+    0x02, 0xE0, 0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7,
+    0xED, 0x00, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6, 0x02, 0xF8,
+    0x06, 0x26, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x01, 0x00,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6, 0x02, 0xAD, 0x06, 0x26,
+    0x01, 0xE8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x05, 0x01, 0x00, 0xFF, 0xFF,
+    0x00, 0x0F, 0xFF, 0x1A, 0x01, 0xE6, 0x02, 0xCA, 0x06, 0x26, 0x01, 0xE8,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x8A, 0x02, 0x0D, 0x00, 0x0B, 0x00, 0x00, 0x73, 0x35,
+    0x01, 0x07, 0x21, 0x35, 0x21, 0x15, 0x01, 0x27, 0x21, 0x15, 0x23, 0x01,
+    0x46, 0x02, 0xFE, 0xBC, 0x01, 0x52, 0xFE, 0xBE, 0x04, 0x01, 0x5B, 0x1A,
+    0x01, 0xEF, 0x12, 0x16, 0x1C, 0xFE, 0x19, 0x0C, 0x16, 0x00, 0xFF, 0xFF,
+    0x00, 0x23, 0x00, 0x00, 0x01, 0x8A, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xF2,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0xF1, 0x00, 0xFF, 0xFF, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x8A, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFD, 0xDD, 0x00, 0xFF, 0xFF, 0x00, 0x23, 0x00, 0x00,
+    0x01, 0x8A, 0x02, 0xD1, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xF5, 0xDD, 0x00, 0xFF, 0xFF, 0x00, 0x23, 0xFF, 0x75, 0x01, 0x8A,
+    0x02, 0x0D, 0x06, 0x26, 0x01, 0xF2, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E,
+    0xDD, 0x00, 0xFF, 0xFF, 0x00, 0x18, 0xFF, 0x3E, 0x01, 0x5C, 0x02, 0xE0,
+    0x04, 0x26, 0x01, 0x58, 0x00, 0x00, 0x00, 0x27, 0x02, 0xF8, 0xFF, 0x6B,
+    0x00, 0x00, 0x00, 0x27, 0x01, 0x6A, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0xF8, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xD0, 0x02, 0x12, 0x00, 0x10, 0x00, 0x2E, 0x00, 0x00, 0x61, 0x11,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x11, 0x07, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x33,
+    0x33, 0x15, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0xBA, 0x59, 0x52, 0x38, 0x63,
+    0x23, 0x10, 0x28, 0x69, 0x3E, 0x3C, 0x56, 0x2E, 0xF6, 0x33, 0x50, 0x2F,
+    0x1A, 0x34, 0x4D, 0x33, 0xCC, 0xD2, 0x2A, 0x43, 0x2D, 0x18, 0x2B, 0x47,
+    0x2B, 0x31, 0x58, 0x45, 0x16, 0x0D, 0x18, 0x49, 0x5C, 0x01, 0x6F, 0x40,
+    0x4D, 0x31, 0x2D, 0x10, 0x31, 0x33, 0x27, 0x4A, 0x35, 0xFE, 0x94, 0x0A,
+    0x28, 0x47, 0x30, 0x21, 0x33, 0x24, 0x12, 0x16, 0x0F, 0x1E, 0x2B, 0x1C,
+    0x29, 0x3D, 0x23, 0x24, 0x42, 0x2B, 0x0B, 0x2E, 0x46, 0x28, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF8, 0x27, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xDF, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xFF, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xD0, 0x03, 0x5F, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEA, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75, 0x01, 0xD0,
+    0x02, 0xDF, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x26, 0x03, 0x0E,
+    0x13, 0x00, 0x00, 0x06, 0x02, 0xFF, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xD0, 0x03, 0x5E, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xEB, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xD0, 0x03, 0x72, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0xEC, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0,
+    0x03, 0x72, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xED,
+    0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xD6,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x13, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xD6, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x13, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD7, 0x03, 0x4F, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xEE, 0x3B, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0x75, 0x01, 0xD0, 0x02, 0xD6, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x0E, 0x13, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x13, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x03, 0x4D, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xEF, 0x1D, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x01, 0xDE, 0x03, 0x72, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x02, 0xF0, 0x3E, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xD0, 0x03, 0x68, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF1, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xD0, 0x02, 0xE0, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x0A, 0xDD, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0,
+    0x02, 0xD1, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF2,
+    0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x75, 0x01, 0xD0, 0x02, 0x12,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x0E, 0x13, 0x00,
+    0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xE0, 0x06, 0x26,
+    0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x02, 0xF7, 0xFF, 0x00, 0xFF, 0xFF,
+    0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xF8, 0x06, 0x26, 0x01, 0xF8,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x09, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xE9, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x0B, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6,
+    0x01, 0xD0, 0x02, 0xAD, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0x18, 0x01, 0xE9,
+    0x02, 0x12, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x07, 0x03, 0x12,
+    0x00, 0x95, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0,
+    0x03, 0x04, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00,
+    0x13, 0x00, 0xFF, 0xFF, 0x00, 0x28, 0xFF, 0xF6, 0x01, 0xD0, 0x03, 0xA3,
+    0x06, 0x26, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x13, 0x00,
+    0x00, 0x07, 0x02, 0xF8, 0x00, 0x27, 0x00, 0xC3, 0xFF, 0xFF, 0x00, 0x28,
+    0xFF, 0xF6, 0x01, 0xD0, 0x02, 0xCA, 0x06, 0x26, 0x01, 0xF8, 0x00, 0x00,
+    0x00, 0x06, 0x03, 0x01, 0x13, 0x00, 0x00, 0x03, 0x00, 0x3B, 0xFF, 0x19,
+    0x02, 0x09, 0x02, 0x13, 0x00, 0x37, 0x00, 0x45, 0x00, 0x55, 0x00, 0x00,
+    0x45, 0x22, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x15, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x36, 0x37, 0x17, 0x2E, 0x02, 0x35, 0x34, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x16, 0x17, 0x27, 0x33, 0x15, 0x23, 0x37, 0x1E, 0x02, 0x15,
+    0x14, 0x06, 0x06, 0x23, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x16, 0x13, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x01, 0x20, 0x70, 0x75, 0x1D, 0x3F, 0x32, 0x41, 0x2D, 0x13, 0x2D, 0x28,
+    0x16, 0x32, 0x3A, 0x18, 0x34, 0x59, 0x36, 0x0A, 0x1B, 0x24, 0x18, 0x3B,
+    0xCB, 0x9D, 0x06, 0x2F, 0x2D, 0x0D, 0x31, 0x57, 0x3B, 0x61, 0x21, 0x24,
+    0x25, 0x20, 0x69, 0x6B, 0x7A, 0x37, 0x67, 0x48, 0x3F, 0x5D, 0x33, 0x70,
+    0x5F, 0x5D, 0x70, 0x33, 0x5C, 0x37, 0x31, 0x4E, 0x2D, 0x2D, 0x4E, 0x31,
+    0x31, 0x4E, 0x2D, 0x2D, 0x4E, 0xE7, 0x59, 0x42, 0x21, 0x38, 0x2C, 0x0F,
+    0x10, 0x02, 0x27, 0x20, 0x14, 0x20, 0x13, 0x01, 0x0E, 0x14, 0x35, 0x3F,
+    0x22, 0x30, 0x4F, 0x2F, 0x03, 0x08, 0x09, 0x09, 0x16, 0x12, 0x22, 0x35,
+    0x2F, 0x19, 0x33, 0x50, 0x2E, 0x1E, 0x14, 0x19, 0x1A, 0x53, 0x48, 0x2C,
+    0x46, 0x29, 0x16, 0x23, 0x3C, 0x26, 0x3E, 0x47, 0x47, 0x3E, 0x26, 0x3C,
+    0x23, 0x01, 0x9B, 0x27, 0x45, 0x2F, 0x2A, 0x45, 0x29, 0x28, 0x45, 0x2B,
+    0x2D, 0x46, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0x19, 0x02, 0x09,
+    0x02, 0xDF, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFF,
+    0x28, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0x19, 0x02, 0x09, 0x02, 0xD6,
+    0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFD, 0x28, 0x00,
+    0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0x19, 0x02, 0x09, 0x02, 0xD6, 0x06, 0x26,
+    0x02, 0x12, 0x00, 0x00, 0x00, 0x06, 0x02, 0xFC, 0x28, 0x00, 0xFF, 0xFF,
+    0x00, 0x3B, 0xFF, 0x19, 0x02, 0x09, 0x02, 0xEA, 0x06, 0x26, 0x02, 0x12,
+    0x00, 0x00, 0x00, 0x06, 0x03, 0x0C, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x3B,
+    0xFF, 0x19, 0x02, 0x09, 0x02, 0xD1, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00,
+    0x00, 0x06, 0x02, 0xF5, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x3B, 0xFF, 0x19,
+    0x02, 0x09, 0x02, 0xAD, 0x06, 0x26, 0x02, 0x12, 0x00, 0x00, 0x00, 0x06,
+    0x03, 0x05, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x02, 0xA8,
+    0x02, 0xEE, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x07, 0x01, 0x4A,
+    0x01, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x03, 0x26,
+    0x02, 0xEE, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x4A,
+    0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0x01, 0x57, 0x02, 0xA8, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0x3E, 0x03, 0xD7, 0x02, 0xEE, 0x04, 0x26,
+    0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x4A, 0x01, 0x54, 0x00, 0x00,
+    0x00, 0x27, 0x01, 0x57, 0x02, 0xA8, 0x00, 0x00, 0x00, 0x07, 0x01, 0x69,
+    0x03, 0x6C, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1E, 0x00, 0x00, 0x03, 0x1A,
+    0x02, 0xEE, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x4A,
+    0x01, 0x54, 0x00, 0x00, 0x00, 0x07, 0x01, 0x6F, 0x02, 0xA8, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0x3E, 0x02, 0x83, 0x02, 0xEE, 0x04, 0x26,
+    0x01, 0x4A, 0x00, 0x00, 0x00, 0x27, 0x01, 0x57, 0x01, 0x54, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x69, 0x02, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1E,
+    0x00, 0x00, 0x01, 0xD2, 0x02, 0xEE, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x57, 0x01, 0x54, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x1E,
+    0x00, 0x00, 0x01, 0xC6, 0x02, 0xEE, 0x04, 0x26, 0x01, 0x4A, 0x00, 0x00,
+    0x00, 0x07, 0x01, 0x6F, 0x01, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1E,
+    0x01, 0x92, 0x01, 0x36, 0x02, 0xD1, 0x00, 0x15, 0x00, 0x24, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x27, 0x37, 0x33, 0x11, 0x23, 0x35, 0x37, 0x0E, 0x02, 0x27, 0x32, 0x36,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0xB0, 0x29, 0x42, 0x27, 0x27, 0x42, 0x29, 0x2B, 0x44, 0x0C, 0x09, 0x01,
+    0x13, 0x14, 0x09, 0x08, 0x24, 0x32, 0x1E, 0x22, 0x35, 0x1E, 0x44, 0x31,
+    0x24, 0x38, 0x21, 0x21, 0x38, 0x01, 0x92, 0x2A, 0x48, 0x2D, 0x2D, 0x49,
+    0x2A, 0x2B, 0x25, 0x03, 0x48, 0xFE, 0xC7, 0x4B, 0x06, 0x19, 0x25, 0x14,
+    0x14, 0x1B, 0x3D, 0x33, 0x4E, 0x3E, 0x25, 0x3F, 0x28, 0x27, 0x3F, 0x25,
+    0x00, 0x02, 0x00, 0x28, 0x01, 0x88, 0x01, 0x40, 0x02, 0xDB, 0x00, 0x0F,
+    0x00, 0x1F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0xB4, 0x27, 0x40, 0x25, 0x25, 0x40, 0x27, 0x28, 0x3F, 0x25, 0x25, 0x3F,
+    0x29, 0x23, 0x36, 0x20, 0x20, 0x37, 0x22, 0x22, 0x36, 0x1F, 0x1F, 0x36,
+    0x01, 0x88, 0x2D, 0x4C, 0x30, 0x30, 0x4D, 0x2D, 0x2D, 0x4D, 0x30, 0x30,
+    0x4C, 0x2D, 0x14, 0x28, 0x43, 0x2A, 0x2B, 0x44, 0x27, 0x27, 0x44, 0x2B,
+    0x2A, 0x43, 0x28, 0x00, 0xFF, 0xFF, 0x00, 0x08, 0x00, 0x00, 0x02, 0xBB,
+    0x02, 0xD2, 0x06, 0x06, 0x02, 0xE1, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x19,
+    0x00, 0x00, 0x02, 0x8B, 0x02, 0xC6, 0x06, 0x06, 0x02, 0xE0, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x49, 0xFF, 0x63, 0x01, 0xD5, 0x02, 0x0D, 0x06, 0x06,
+    0x02, 0xE5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x00, 0x02, 0x3E,
+    0x02, 0x05, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x11, 0x17, 0x23, 0x35, 0x21,
+    0x15, 0x23, 0x37, 0x11, 0x23, 0x11, 0x17, 0x21, 0x37, 0x11, 0x72, 0x09,
+    0x53, 0x02, 0x16, 0x51, 0x07, 0x16, 0x06, 0xFE, 0x9B, 0x09, 0x01, 0xF6,
+    0x07, 0x16, 0x16, 0x07, 0xFE, 0x0A, 0x01, 0xF6, 0x07, 0x07, 0xFE, 0x0A,
+    0x00, 0x02, 0x00, 0x34, 0xFF, 0xF6, 0x02, 0x38, 0x02, 0xC6, 0x00, 0x0F,
+    0x00, 0x1B, 0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x01, 0x36, 0x54, 0x73,
+    0x3B, 0x3B, 0x73, 0x54, 0x54, 0x73, 0x3B, 0x3B, 0x73, 0x54, 0x72, 0x79,
+    0x79, 0x72, 0x71, 0x7A, 0x7A, 0x0A, 0x52, 0xA1, 0x75, 0x75, 0xA1, 0x52,
+    0x52, 0xA1, 0x75, 0x75, 0xA1, 0x52, 0x16, 0xAF, 0xA3, 0xA3, 0xAF, 0xAF,
+    0xA3, 0xA3, 0xAF, 0x00, 0x00, 0x02, 0x00, 0x27, 0x00, 0x00, 0x01, 0x3F,
+    0x02, 0xC6, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x77, 0x11, 0x33, 0x07,
+    0x27, 0x37, 0x33, 0x11, 0x07, 0x35, 0x21, 0x15, 0xB3, 0x05, 0x8B, 0x06,
+    0x98, 0x0A, 0x8B, 0x01, 0x01, 0x08, 0x02, 0x9E, 0x5D, 0x14, 0x69, 0xFD,
+    0x42, 0x08, 0x16, 0x16, 0x00, 0x01, 0x00, 0x38, 0x00, 0x00, 0x01, 0xFA,
+    0x02, 0xC6, 0x00, 0x22, 0x00, 0x00, 0x73, 0x27, 0x01, 0x3E, 0x03, 0x35,
+    0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x03, 0x07, 0x01, 0x35, 0x21, 0x15,
+    0x4E, 0x06, 0x01, 0x22, 0x0F, 0x26, 0x22, 0x16, 0x31, 0x55, 0x36, 0x28,
+    0x50, 0x43, 0x13, 0x15, 0x13, 0x44, 0x5A, 0x34, 0x3B, 0x5E, 0x38, 0x0D,
+    0x15, 0x1C, 0x1F, 0x10, 0xFE, 0xDD, 0x01, 0x9C, 0x0D, 0x01, 0x36, 0x11,
+    0x2D, 0x38, 0x3D, 0x21, 0x2B, 0x46, 0x28, 0x20, 0x4C, 0x42, 0x0A, 0x41,
+    0x52, 0x27, 0x2D, 0x4E, 0x33, 0x1A, 0x33, 0x2E, 0x2C, 0x26, 0x11, 0xFE,
+    0xCA, 0x12, 0x16, 0x00, 0x00, 0x01, 0x00, 0x14, 0xFF, 0xF6, 0x01, 0xED,
+    0x02, 0xBC, 0x00, 0x28, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x1E,
+    0x02, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x07, 0x27, 0x01, 0x15, 0x21, 0x35, 0x21, 0x17, 0x01, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x06, 0x06, 0x01, 0x08, 0x4A,
+    0x7A, 0x30, 0x14, 0x21, 0x48, 0x4E, 0x2B, 0x3B, 0x5C, 0x35, 0x33, 0x56,
+    0x35, 0x15, 0x2D, 0x30, 0x19, 0x0E, 0x01, 0x3D, 0xFE, 0x9D, 0x01, 0x6B,
+    0x0D, 0xFE, 0xDE, 0x0A, 0x1A, 0x33, 0x26, 0x2F, 0x4D, 0x3A, 0x1F, 0x3C,
+    0x68, 0x0A, 0x43, 0x51, 0x0C, 0x37, 0x3C, 0x17, 0x39, 0x60, 0x39, 0x39,
+    0x5B, 0x35, 0x07, 0x1A, 0x1D, 0x16, 0x01, 0x30, 0x09, 0x16, 0x18, 0xFE,
+    0xEC, 0x06, 0x13, 0x14, 0x21, 0x3B, 0x52, 0x31, 0x40, 0x69, 0x3F, 0x00,
+    0x00, 0x01, 0x00, 0x23, 0x00, 0x00, 0x02, 0x42, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x00, 0x61, 0x11, 0x33, 0x01, 0x27, 0x21, 0x15, 0x21, 0x27, 0x01,
+    0x33, 0x11, 0x01, 0xB2, 0x0E, 0xFE, 0x79, 0x03, 0x02, 0x0C, 0xFD, 0xEC,
+    0x0B, 0x01, 0x91, 0x14, 0x02, 0xA9, 0xFE, 0x23, 0x08, 0x16, 0x16, 0x01,
+    0xE8, 0xFD, 0x44, 0x00, 0x00, 0x01, 0x00, 0x27, 0xFF, 0xF6, 0x01, 0xFC,
+    0x02, 0xBC, 0x00, 0x26, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x07, 0x27, 0x13, 0x21, 0x15, 0x21, 0x37, 0x03, 0x27, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x01, 0x01, 0x45, 0x6F,
+    0x26, 0x13, 0x23, 0x6D, 0x38, 0x40, 0x67, 0x3C, 0x35, 0x5C, 0x3B, 0x24,
+    0x4A, 0x44, 0x19, 0x0D, 0x2E, 0x01, 0x78, 0xFE, 0x8D, 0x0F, 0x2C, 0x0A,
+    0x1D, 0x41, 0x48, 0x27, 0x40, 0x66, 0x3C, 0x42, 0x72, 0x0A, 0x41, 0x3C,
+    0x12, 0x3C, 0x3D, 0x3D, 0x67, 0x3F, 0x37, 0x5D, 0x37, 0x15, 0x25, 0x17,
+    0x10, 0x01, 0x43, 0x16, 0x0C, 0xFE, 0xC9, 0x08, 0x17, 0x23, 0x13, 0x3A,
+    0x66, 0x43, 0x46, 0x70, 0x41, 0x00, 0x00, 0x02, 0x00, 0x43, 0xFF, 0xF6,
+    0x02, 0x0B, 0x02, 0xBC, 0x00, 0x1F, 0x00, 0x2F, 0x00, 0x00, 0x45, 0x22,
+    0x2E, 0x02, 0x35, 0x26, 0x3E, 0x02, 0x37, 0x37, 0x33, 0x17, 0x07, 0x0E,
+    0x02, 0x15, 0x27, 0x3E, 0x03, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x27, 0x2F, 0x52, 0x3F, 0x23, 0x01,
+    0x09, 0x16, 0x22, 0x18, 0x84, 0x16, 0x02, 0x81, 0x1B, 0x29, 0x16, 0x06,
+    0x12, 0x2D, 0x35, 0x3C, 0x20, 0x40, 0x67, 0x3D, 0x3D, 0x67, 0x3D, 0x38,
+    0x5C, 0x36, 0x36, 0x5C, 0x38, 0x3A, 0x5D, 0x37, 0x37, 0x5D, 0x0A, 0x24,
+    0x40, 0x59, 0x36, 0x1D, 0x3E, 0x44, 0x48, 0x25, 0xC7, 0x05, 0xC2, 0x29,
+    0x4D, 0x3E, 0x12, 0x03, 0x26, 0x38, 0x25, 0x12, 0x3D, 0x6A, 0x42, 0x41,
+    0x69, 0x3E, 0x16, 0x38, 0x60, 0x3B, 0x3B, 0x5F, 0x38, 0x39, 0x60, 0x3B,
+    0x3B, 0x5E, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA8,
+    0x02, 0xBC, 0x00, 0x07, 0x00, 0x00, 0x73, 0x01, 0x17, 0x21, 0x35, 0x21,
+    0x17, 0x01, 0x62, 0x01, 0x34, 0x08, 0xFE, 0x62, 0x01, 0x98, 0x10, 0xFE,
+    0xD3, 0x02, 0xB5, 0x0F, 0x16, 0x14, 0xFD, 0x58, 0x00, 0x03, 0x00, 0x37,
+    0xFF, 0xFD, 0x02, 0x0E, 0x02, 0xC6, 0x00, 0x25, 0x00, 0x35, 0x00, 0x45,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17,
+    0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x0E, 0x02, 0x07, 0x37, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x13, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x22, 0x41, 0x6B, 0x3F, 0x18,
+    0x2C, 0x41, 0x29, 0x04, 0x22, 0x36, 0x27, 0x14, 0x37, 0x5C, 0x39, 0x39,
+    0x5D, 0x37, 0x14, 0x27, 0x36, 0x23, 0x04, 0x26, 0x41, 0x2E, 0x1A, 0x3F,
+    0x6B, 0x42, 0x3B, 0x60, 0x3A, 0x37, 0x61, 0x3D, 0x3D, 0x60, 0x37, 0x3A,
+    0x60, 0x3A, 0x35, 0x52, 0x2F, 0x2F, 0x52, 0x35, 0x34, 0x52, 0x2F, 0x2F,
+    0x52, 0x03, 0x34, 0x59, 0x37, 0x24, 0x3E, 0x32, 0x24, 0x09, 0x0C, 0x05,
+    0x1D, 0x2C, 0x34, 0x1A, 0x35, 0x51, 0x2E, 0x2E, 0x51, 0x35, 0x1A, 0x33,
+    0x2B, 0x1E, 0x06, 0x0C, 0x09, 0x23, 0x32, 0x3E, 0x25, 0x38, 0x59, 0x33,
+    0x16, 0x30, 0x4F, 0x2D, 0x34, 0x50, 0x2D, 0x2D, 0x50, 0x34, 0x2D, 0x4E,
+    0x31, 0x01, 0x71, 0x26, 0x43, 0x2C, 0x2A, 0x44, 0x29, 0x29, 0x44, 0x2A,
+    0x2B, 0x43, 0x27, 0x00, 0x00, 0x02, 0x00, 0x2F, 0x00, 0x00, 0x01, 0xF6,
+    0x02, 0xC6, 0x00, 0x1B, 0x00, 0x2B, 0x00, 0x00, 0x61, 0x27, 0x13, 0x37,
+    0x0E, 0x03, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x07, 0x03, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x01, 0x0E, 0x02, 0xD2, 0x03, 0x13, 0x2D, 0x34, 0x3A, 0x20, 0x40, 0x67,
+    0x3D, 0x3D, 0x67, 0x40, 0x2F, 0x53, 0x3E, 0x23, 0x10, 0x1C, 0x24, 0x13,
+    0x6F, 0x14, 0x3A, 0x5D, 0x37, 0x37, 0x5D, 0x3A, 0x38, 0x5C, 0x36, 0x36,
+    0x5C, 0x05, 0x01, 0x7B, 0x03, 0x24, 0x36, 0x23, 0x11, 0x3E, 0x69, 0x42,
+    0x41, 0x69, 0x3E, 0x22, 0x3F, 0x55, 0x34, 0x23, 0x45, 0x45, 0x45, 0x23,
+    0xC7, 0x01, 0x0B, 0x39, 0x60, 0x3B, 0x3B, 0x5E, 0x38, 0x38, 0x60, 0x3B,
+    0x3B, 0x5F, 0x38, 0x00, 0xFF, 0xFF, 0x00, 0x34, 0xFF, 0xF6, 0x02, 0x38,
+    0x02, 0xC6, 0x06, 0x26, 0x02, 0x26, 0x00, 0x00, 0x00, 0x07, 0x02, 0x69,
+    0x00, 0xC4, 0x01, 0x38, 0x00, 0x02, 0x00, 0x1E, 0xFF, 0xF6, 0x01, 0x4E,
+    0x01, 0x67, 0x00, 0x0F, 0x00, 0x1C, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14,
+    0x16, 0xB7, 0x2D, 0x45, 0x27, 0x27, 0x45, 0x2D, 0x2D, 0x44, 0x26, 0x27,
+    0x44, 0x2C, 0x26, 0x3A, 0x20, 0x45, 0x3B, 0x3B, 0x47, 0x48, 0x0A, 0x30,
+    0x53, 0x35, 0x36, 0x54, 0x2F, 0x2F, 0x54, 0x36, 0x35, 0x53, 0x30, 0x16,
+    0x2A, 0x49, 0x2F, 0x49, 0x5A, 0x59, 0x4A, 0x49, 0x59, 0x00, 0x00, 0x01,
+    0x00, 0x38, 0x00, 0x01, 0x00, 0xB6, 0x01, 0x5A, 0x00, 0x0A, 0x00, 0x00,
+    0x77, 0x11, 0x33, 0x07, 0x27, 0x37, 0x33, 0x11, 0x23, 0x22, 0x22, 0xA0,
+    0x06, 0x64, 0x0A, 0x70, 0x0E, 0x0B, 0x03, 0x06, 0x01, 0x01, 0x3F, 0x38,
+    0x11, 0x41, 0xFE, 0xA7, 0x00, 0x01, 0x00, 0x48, 0x00, 0x00, 0x01, 0x27,
+    0x01, 0x69, 0x00, 0x1D, 0x00, 0x00, 0x73, 0x27, 0x37, 0x3E, 0x02, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x3E, 0x02, 0x33, 0x32, 0x16,
+    0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x07, 0x37, 0x33, 0x15, 0x4B, 0x03,
+    0x87, 0x11, 0x18, 0x0C, 0x2B, 0x1D, 0x1D, 0x2E, 0x14, 0x13, 0x0C, 0x22,
+    0x2B, 0x19, 0x1A, 0x2B, 0x19, 0x0F, 0x1C, 0x16, 0x80, 0x01, 0xCD, 0x1A,
+    0x99, 0x13, 0x22, 0x1E, 0x0E, 0x1D, 0x22, 0x1E, 0x22, 0x0D, 0x15, 0x21,
+    0x13, 0x15, 0x26, 0x19, 0x14, 0x25, 0x28, 0x18, 0x8F, 0x09, 0x16, 0x00,
+    0x00, 0x01, 0x00, 0x42, 0xFF, 0xF6, 0x01, 0x29, 0x01, 0x5E, 0x00, 0x23,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x37, 0x17, 0x23,
+    0x35, 0x33, 0x17, 0x07, 0x23, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0xAE, 0x13, 0x27, 0x24, 0x0E, 0x0C, 0x1F, 0x2A, 0x15, 0x2D,
+    0x3A, 0x38, 0x26, 0x18, 0x21, 0x1B, 0x05, 0x9D, 0x05, 0xAE, 0xBA, 0x04,
+    0x92, 0x11, 0x1B, 0x20, 0x11, 0x2F, 0x43, 0x21, 0x37, 0x0A, 0x09, 0x0F,
+    0x0A, 0x12, 0x13, 0x0B, 0x33, 0x2C, 0x27, 0x30, 0x0A, 0x0F, 0x0F, 0x96,
+    0x05, 0x15, 0x18, 0x8B, 0x12, 0x0A, 0x3C, 0x2F, 0x22, 0x35, 0x1F, 0x00,
+    0x00, 0x03, 0x00, 0x3A, 0x00, 0x00, 0x01, 0x54, 0x01, 0x64, 0x00, 0x03,
+    0x00, 0x09, 0x00, 0x11, 0x00, 0x00, 0x65, 0x33, 0x15, 0x23, 0x27, 0x27,
+    0x33, 0x07, 0x35, 0x17, 0x13, 0x23, 0x35, 0x17, 0x23, 0x27, 0x13, 0x33,
+    0x01, 0x12, 0x42, 0x42, 0xBF, 0x03, 0xBD, 0x0C, 0x08, 0x0E, 0x16, 0x09,
+    0xCD, 0x03, 0xC7, 0x16, 0x6B, 0x16, 0x08, 0x0E, 0x0B, 0xEF, 0x06, 0xFE,
+    0xB7, 0x5B, 0x06, 0x0E, 0x01, 0x01, 0x00, 0x01, 0x00, 0x41, 0xFF, 0xF6,
+    0x01, 0x32, 0x01, 0x59, 0x00, 0x22, 0x00, 0x00, 0x57, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06,
+    0x07, 0x27, 0x37, 0x33, 0x15, 0x23, 0x37, 0x07, 0x23, 0x36, 0x36, 0x33,
+    0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0xA7, 0x19, 0x39, 0x14, 0x0C,
+    0x17, 0x2D, 0x19, 0x34, 0x3E, 0x3B, 0x30, 0x1B, 0x29, 0x15, 0x16, 0x19,
+    0xC6, 0xC2, 0x10, 0x16, 0x0A, 0x0E, 0x35, 0x23, 0x25, 0x39, 0x1F, 0x23,
+    0x3F, 0x0A, 0x16, 0x10, 0x14, 0x13, 0x11, 0x36, 0x2E, 0x2D, 0x34, 0x0F,
+    0x17, 0x04, 0xAA, 0x16, 0x09, 0x8E, 0x12, 0x17, 0x1F, 0x35, 0x21, 0x26,
+    0x38, 0x1E, 0x00, 0x02, 0x00, 0x34, 0xFF, 0xF6, 0x01, 0x21, 0x01, 0x66,
+    0x00, 0x1C, 0x00, 0x28, 0x00, 0x00, 0x57, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x07, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27,
+    0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xAC,
+    0x36, 0x42, 0x1B, 0x3B, 0x30, 0x17, 0x29, 0x15, 0x0A, 0x10, 0x27, 0x17,
+    0x36, 0x34, 0x04, 0x09, 0x0C, 0x39, 0x27, 0x21, 0x35, 0x1F, 0x1F, 0x35,
+    0x22, 0x28, 0x39, 0x39, 0x28, 0x28, 0x37, 0x37, 0x0A, 0x48, 0x44, 0x45,
+    0x66, 0x39, 0x0D, 0x0F, 0x13, 0x0B, 0x0E, 0x60, 0x59, 0x0B, 0x29, 0x2C,
+    0x1F, 0x35, 0x21, 0x21, 0x36, 0x1F, 0x15, 0x38, 0x28, 0x28, 0x39, 0x39,
+    0x28, 0x28, 0x38, 0x00, 0x00, 0x01, 0x00, 0x3E, 0x00, 0x00, 0x01, 0x21,
+    0x01, 0x58, 0x00, 0x08, 0x00, 0x00, 0x73, 0x27, 0x13, 0x17, 0x23, 0x35,
+    0x33, 0x17, 0x03, 0x70, 0x03, 0x9F, 0x01, 0xCF, 0xDA, 0x09, 0xA0, 0x09,
+    0x01, 0x46, 0x0D, 0x16, 0x0E, 0xFE, 0xB6, 0x00, 0x00, 0x03, 0x00, 0x3E,
+    0xFF, 0xF6, 0x01, 0x20, 0x01, 0x66, 0x00, 0x1E, 0x00, 0x2A, 0x00, 0x36,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x17, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x07, 0x37, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x37, 0x32, 0x36,
+    0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xB0, 0x1F, 0x34,
+    0x1F, 0x22, 0x23, 0x03, 0x1E, 0x22, 0x1B, 0x30, 0x1F, 0x1C, 0x2F, 0x1C,
+    0x10, 0x1C, 0x12, 0x05, 0x1E, 0x24, 0x1F, 0x33, 0x1E, 0x23, 0x37, 0x35,
+    0x25, 0x2A, 0x32, 0x36, 0x26, 0x21, 0x30, 0x31, 0x20, 0x24, 0x30, 0x31,
+    0x0A, 0x1C, 0x2E, 0x1D, 0x1E, 0x31, 0x0F, 0x0A, 0x0F, 0x2A, 0x1E, 0x1A,
+    0x2B, 0x19, 0x19, 0x2B, 0x1A, 0x12, 0x20, 0x1A, 0x0B, 0x0A, 0x0D, 0x34,
+    0x1D, 0x1D, 0x2E, 0x1C, 0x16, 0x2F, 0x21, 0x21, 0x2F, 0x2F, 0x21, 0x21,
+    0x2F, 0xB4, 0x29, 0x1E, 0x1F, 0x2A, 0x28, 0x21, 0x1E, 0x29, 0x00, 0x02,
+    0x00, 0x30, 0xFF, 0xF6, 0x01, 0x1D, 0x01, 0x66, 0x00, 0x1D, 0x00, 0x29,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x36, 0x37, 0x37, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0x97, 0x17, 0x29, 0x15,
+    0x0A, 0x10, 0x27, 0x17, 0x23, 0x2F, 0x19, 0x03, 0x09, 0x0C, 0x39, 0x27,
+    0x21, 0x35, 0x1F, 0x1F, 0x35, 0x21, 0x36, 0x42, 0x1B, 0x3B, 0x21, 0x28,
+    0x37, 0x37, 0x28, 0x28, 0x39, 0x39, 0x0A, 0x0D, 0x0F, 0x13, 0x0B, 0x0E,
+    0x2B, 0x53, 0x3B, 0x0B, 0x29, 0x2C, 0x1F, 0x35, 0x21, 0x21, 0x36, 0x1F,
+    0x48, 0x44, 0x45, 0x66, 0x39, 0x9A, 0x39, 0x28, 0x28, 0x38, 0x38, 0x28,
+    0x28, 0x39, 0xFF, 0xFF, 0x00, 0x1E, 0xFF, 0x38, 0x01, 0x4E, 0x00, 0xA9,
+    0x06, 0x07, 0x02, 0x31, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x38,
+    0xFF, 0x39, 0x00, 0xB6, 0x00, 0x92, 0x06, 0x07, 0x02, 0x32, 0x00, 0x00,
+    0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x48, 0xFF, 0x38, 0x01, 0x27, 0x00, 0xA1,
+    0x06, 0x07, 0x02, 0x33, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x42,
+    0xFF, 0x38, 0x01, 0x29, 0x00, 0xA0, 0x06, 0x07, 0x02, 0x34, 0x00, 0x00,
+    0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x3A, 0xFF, 0x38, 0x01, 0x54, 0x00, 0x9C,
+    0x06, 0x07, 0x02, 0x35, 0x00, 0x00, 0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x41,
+    0xFF, 0x2E, 0x01, 0x32, 0x00, 0x91, 0x06, 0x07, 0x02, 0x36, 0x00, 0x00,
+    0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x34, 0xFF, 0x38, 0x01, 0x21, 0x00, 0xA8,
+    0x06, 0x07, 0x02, 0x37, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x3E,
+    0xFF, 0x38, 0x01, 0x21, 0x00, 0x90, 0x06, 0x07, 0x02, 0x38, 0x00, 0x00,
+    0xFF, 0x38, 0xFF, 0xFF, 0x00, 0x3E, 0xFF, 0x38, 0x01, 0x20, 0x00, 0xA8,
+    0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x30,
+    0xFF, 0x38, 0x01, 0x1D, 0x00, 0xA8, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00,
+    0xFF, 0x42, 0xFF, 0xFF, 0x00, 0x1E, 0x01, 0x56, 0x01, 0x4E, 0x02, 0xC7,
+    0x06, 0x07, 0x02, 0x31, 0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF, 0x00, 0x38,
+    0x01, 0x6A, 0x00, 0xB6, 0x02, 0xC3, 0x06, 0x07, 0x02, 0x32, 0x00, 0x00,
+    0x01, 0x69, 0xFF, 0xFF, 0x00, 0x48, 0x01, 0x5C, 0x01, 0x27, 0x02, 0xC5,
+    0x06, 0x07, 0x02, 0x33, 0x00, 0x00, 0x01, 0x5C, 0xFF, 0xFF, 0x00, 0x42,
+    0x01, 0x56, 0x01, 0x29, 0x02, 0xBE, 0x06, 0x07, 0x02, 0x34, 0x00, 0x00,
+    0x01, 0x60, 0xFF, 0xFF, 0x00, 0x3A, 0x01, 0x5E, 0x01, 0x54, 0x02, 0xC2,
+    0x06, 0x07, 0x02, 0x35, 0x00, 0x00, 0x01, 0x5E, 0xFF, 0xFF, 0x00, 0x41,
+    0x01, 0x57, 0x01, 0x32, 0x02, 0xBA, 0x06, 0x07, 0x02, 0x36, 0x00, 0x00,
+    0x01, 0x61, 0xFF, 0xFF, 0x00, 0x34, 0x01, 0x58, 0x01, 0x21, 0x02, 0xC8,
+    0x06, 0x07, 0x02, 0x37, 0x00, 0x00, 0x01, 0x62, 0xFF, 0xFF, 0x00, 0x3E,
+    0x01, 0x64, 0x01, 0x21, 0x02, 0xBC, 0x06, 0x07, 0x02, 0x38, 0x00, 0x00,
+    0x01, 0x64, 0xFF, 0xFF, 0x00, 0x3E, 0x01, 0x56, 0x01, 0x20, 0x02, 0xC6,
+    0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0x01, 0x60, 0xFF, 0xFF, 0x00, 0x30,
+    0x01, 0x56, 0x01, 0x1D, 0x02, 0xC6, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00,
+    0x01, 0x60, 0xFF, 0xFF, 0x00, 0x1E, 0x01, 0x9C, 0x01, 0x4E, 0x03, 0x0D,
+    0x06, 0x07, 0x02, 0x31, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF, 0x00, 0x38,
+    0x01, 0xB0, 0x00, 0xB6, 0x03, 0x09, 0x06, 0x07, 0x02, 0x32, 0x00, 0x00,
+    0x01, 0xAF, 0xFF, 0xFF, 0x00, 0x48, 0x01, 0xA2, 0x01, 0x27, 0x03, 0x0B,
+    0x06, 0x07, 0x02, 0x33, 0x00, 0x00, 0x01, 0xA2, 0xFF, 0xFF, 0x00, 0x42,
+    0x01, 0x9C, 0x01, 0x29, 0x03, 0x04, 0x06, 0x07, 0x02, 0x34, 0x00, 0x00,
+    0x01, 0xA6, 0xFF, 0xFF, 0x00, 0x3A, 0x01, 0xA4, 0x01, 0x54, 0x03, 0x08,
+    0x06, 0x07, 0x02, 0x35, 0x00, 0x00, 0x01, 0xA4, 0xFF, 0xFF, 0x00, 0x41,
+    0x01, 0x9D, 0x01, 0x32, 0x03, 0x00, 0x06, 0x07, 0x02, 0x36, 0x00, 0x00,
+    0x01, 0xA7, 0xFF, 0xFF, 0x00, 0x34, 0x01, 0x9E, 0x01, 0x21, 0x03, 0x0E,
+    0x06, 0x07, 0x02, 0x37, 0x00, 0x00, 0x01, 0xA8, 0xFF, 0xFF, 0x00, 0x3E,
+    0x01, 0xAA, 0x01, 0x21, 0x03, 0x02, 0x06, 0x07, 0x02, 0x38, 0x00, 0x00,
+    0x01, 0xAA, 0xFF, 0xFF, 0x00, 0x3E, 0x01, 0x9C, 0x01, 0x20, 0x03, 0x0C,
+    0x06, 0x07, 0x02, 0x39, 0x00, 0x00, 0x01, 0xA6, 0xFF, 0xFF, 0x00, 0x30,
+    0x01, 0x9C, 0x01, 0x1D, 0x03, 0x0C, 0x06, 0x07, 0x02, 0x3A, 0x00, 0x00,
+    0x01, 0xA6, 0x00, 0x01, 0x00, 0x34, 0x00, 0x00, 0x02, 0x23, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x00, 0x73, 0x01, 0x33, 0x01, 0x34, 0x01, 0xD4, 0x1B,
+    0xFE, 0x2C, 0x02, 0xBC, 0xFD, 0x44, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00,
+    0x02, 0x9B, 0x02, 0xC3, 0x04, 0x27, 0x02, 0x32, 0x00, 0x0A, 0x01, 0x69,
+    0x00, 0x26, 0x02, 0x59, 0x0A, 0x00, 0x00, 0x07, 0x02, 0x33, 0x01, 0x74,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x42, 0x00, 0x00, 0x02, 0xC5, 0x02, 0xC3,
+    0x04, 0x27, 0x02, 0x32, 0x00, 0x0A, 0x01, 0x69, 0x00, 0x26, 0x02, 0x59,
+    0x28, 0x00, 0x00, 0x07, 0x02, 0x35, 0x01, 0x71, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x8C, 0x02, 0xBE, 0x04, 0x27, 0x02, 0x34,
+    0xFF, 0xD2, 0x01, 0x60, 0x00, 0x26, 0x02, 0x59, 0x10, 0x00, 0x00, 0x07,
+    0x02, 0x35, 0x01, 0x38, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x6C, 0xFF, 0xF6,
+    0x02, 0xFB, 0x02, 0xC3, 0x04, 0x27, 0x02, 0x32, 0x00, 0x34, 0x01, 0x69,
+    0x00, 0x26, 0x02, 0x59, 0x6B, 0x00, 0x00, 0x07, 0x02, 0x39, 0x01, 0xDB,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x14, 0xFF, 0xF6, 0x02, 0x90, 0x02, 0xBE,
+    0x04, 0x27, 0x02, 0x34, 0xFF, 0xD2, 0x01, 0x60, 0x00, 0x26, 0x02, 0x59,
+    0x11, 0x00, 0x00, 0x07, 0x02, 0x39, 0x01, 0x70, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x27, 0xFF, 0xF6, 0x02, 0xD7, 0x02, 0xBC, 0x04, 0x27, 0x02, 0x36,
+    0xFF, 0xE6, 0x01, 0x61, 0x00, 0x26, 0x02, 0x59, 0x46, 0x00, 0x00, 0x07,
+    0x02, 0x39, 0x01, 0xB7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x5E, 0xFF, 0xF6,
+    0x02, 0xE3, 0x02, 0xBC, 0x04, 0x27, 0x02, 0x38, 0x00, 0x20, 0x01, 0x64,
+    0x00, 0x26, 0x02, 0x59, 0x58, 0x00, 0x00, 0x07, 0x02, 0x39, 0x01, 0xC3,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0xFF, 0xFB, 0x00, 0x90, 0x00, 0x39,
+    0x00, 0x0B, 0x00, 0x00, 0x57, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x72, 0x0E, 0x10, 0x10, 0x0E, 0x0E, 0x10, 0x10,
+    0x05, 0x10, 0x0F, 0x0E, 0x11, 0x10, 0x0F, 0x0D, 0x12, 0x00, 0x00, 0x01,
+    0x00, 0x4A, 0xFF, 0x86, 0x00, 0x96, 0x00, 0x36, 0x00, 0x15, 0x00, 0x00,
+    0x57, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E, 0x02, 0x56, 0x09, 0x13,
+    0x1A, 0x0F, 0x0E, 0x08, 0x0B, 0x0F, 0x0F, 0x0F, 0x14, 0x0B, 0x07, 0x0F,
+    0x18, 0x7A, 0x0C, 0x15, 0x28, 0x0D, 0x10, 0x0C, 0x05, 0x03, 0x0F, 0x0B,
+    0x0C, 0x10, 0x0E, 0x1B, 0x14, 0x11, 0x1C, 0x1A, 0x1B, 0x00, 0xFF, 0xFF,
+    0x00, 0x54, 0xFF, 0xFA, 0x00, 0x90, 0x02, 0x08, 0x06, 0x26, 0x02, 0x69,
+    0x00, 0xFF, 0x00, 0x07, 0x02, 0x69, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF,
+    0x00, 0x54, 0xFF, 0x86, 0x00, 0xA0, 0x02, 0x08, 0x04, 0x26, 0x02, 0x6A,
+    0x0A, 0x00, 0x00, 0x07, 0x02, 0x69, 0x00, 0x0C, 0x01, 0xCF, 0xFF, 0xFF,
+    0x00, 0x54, 0xFF, 0xFB, 0x02, 0x58, 0x00, 0x39, 0x04, 0x26, 0x02, 0x69,
+    0x00, 0x00, 0x00, 0x27, 0x02, 0x69, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x07,
+    0x02, 0x69, 0x01, 0xC8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x62, 0xFF, 0xF8,
+    0x00, 0xA0, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x77, 0x2E,
+    0x02, 0x37, 0x11, 0x33, 0x13, 0x14, 0x06, 0x06, 0x07, 0x07, 0x22, 0x26,
+    0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x7C, 0x01, 0x02,
+    0x01, 0x01, 0x16, 0x01, 0x01, 0x02, 0x01, 0x0B, 0x0F, 0x10, 0x11, 0x0E,
+    0x10, 0x0F, 0x10, 0xF1, 0x1F, 0x41, 0x41, 0x22, 0x01, 0x08, 0xFE, 0xF8,
+    0x22, 0x41, 0x41, 0x1F, 0xF9, 0x13, 0x11, 0x10, 0x14, 0x13, 0x11, 0x0F,
+    0x15, 0x00, 0x00, 0x02, 0x00, 0x62, 0xFF, 0x56, 0x00, 0xA0, 0x02, 0x1A,
+    0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x53, 0x1E, 0x02, 0x07, 0x11, 0x23,
+    0x03, 0x34, 0x36, 0x36, 0x37, 0x37, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x22, 0x26, 0x35, 0x34, 0x36, 0x86, 0x01, 0x02, 0x01, 0x01, 0x16, 0x01,
+    0x01, 0x02, 0x01, 0x0B, 0x0F, 0x10, 0x11, 0x0E, 0x10, 0x0F, 0x10, 0x01,
+    0x21, 0x1F, 0x41, 0x41, 0x22, 0xFE, 0xF8, 0x01, 0x08, 0x22, 0x41, 0x41,
+    0x1F, 0xF9, 0x13, 0x11, 0x10, 0x14, 0x13, 0x11, 0x0F, 0x15, 0x00, 0x02,
+    0x00, 0x00, 0xFF, 0xF6, 0x01, 0x8E, 0x02, 0xC6, 0x00, 0x1C, 0x00, 0x28,
+    0x00, 0x00, 0x77, 0x27, 0x3E, 0x04, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x0E,
+    0x02, 0x0F, 0x02, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23,
+    0x22, 0x26, 0xBA, 0x02, 0x25, 0x3D, 0x2E, 0x1F, 0x10, 0x2A, 0x4E, 0x36,
+    0x3A, 0x63, 0x1A, 0x12, 0x17, 0x6C, 0x45, 0x3B, 0x59, 0x32, 0x1B, 0x31,
+    0x46, 0x2C, 0x02, 0x20, 0x0E, 0x0C, 0x0E, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x92, 0xA9, 0x09, 0x1D, 0x26, 0x2F, 0x36, 0x1E, 0x2B, 0x4C, 0x2F, 0x40,
+    0x4D, 0x0C, 0x49, 0x4E, 0x32, 0x55, 0x35, 0x28, 0x46, 0x3A, 0x2B, 0x0B,
+    0x9A, 0x7E, 0x0D, 0x11, 0x10, 0x0E, 0x0C, 0x12, 0x10, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0xFF, 0x50, 0x01, 0x8E, 0x02, 0x20, 0x00, 0x1C, 0x00, 0x28,
+    0x00, 0x00, 0x53, 0x17, 0x0E, 0x04, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32,
+    0x36, 0x37, 0x17, 0x06, 0x06, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E,
+    0x02, 0x3F, 0x02, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0xD4, 0x02, 0x25, 0x3D, 0x2E, 0x1F, 0x10, 0x2A, 0x4E, 0x36,
+    0x3A, 0x63, 0x1A, 0x12, 0x17, 0x6C, 0x45, 0x3B, 0x59, 0x32, 0x1B, 0x31,
+    0x46, 0x2C, 0x02, 0x20, 0x0E, 0x0C, 0x0E, 0x0C, 0x0D, 0x0D, 0x0D, 0x0D,
+    0x01, 0x84, 0xA9, 0x09, 0x1D, 0x26, 0x2F, 0x36, 0x1E, 0x2B, 0x4C, 0x2F,
+    0x40, 0x4D, 0x0C, 0x49, 0x4E, 0x32, 0x55, 0x35, 0x28, 0x46, 0x3A, 0x2B,
+    0x0B, 0x9A, 0x7E, 0x0D, 0x11, 0x10, 0x0E, 0x0C, 0x12, 0x10, 0xFF, 0xFF,
+    0x00, 0x54, 0x01, 0x03, 0x00, 0x90, 0x01, 0x41, 0x06, 0x07, 0x02, 0x69,
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x01, 0x00, 0x66, 0x01, 0x12, 0x00, 0xF5,
+    0x01, 0x9F, 0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0xAC, 0x12,
+    0x20, 0x14, 0x13, 0x20, 0x13, 0x14, 0x21, 0x14, 0x14, 0x21, 0x01, 0x12,
+    0x13, 0x20, 0x13, 0x13, 0x21, 0x13, 0x13, 0x21, 0x13, 0x13, 0x20, 0x13,
+    0x00, 0x01, 0x00, 0x35, 0x01, 0x78, 0x01, 0x5B, 0x02, 0xBC, 0x00, 0x17,
+    0x00, 0x00, 0x53, 0x37, 0x17, 0x07, 0x27, 0x37, 0x17, 0x27, 0x37, 0x17,
+    0x07, 0x27, 0x33, 0x07, 0x27, 0x37, 0x17, 0x07, 0x35, 0x17, 0x07, 0x27,
+    0x37, 0x17, 0xBB, 0x04, 0x0A, 0x87, 0x0D, 0x8E, 0x01, 0x8F, 0x0D, 0x89,
+    0x0C, 0x04, 0x18, 0x04, 0x0E, 0x8D, 0x0D, 0x8B, 0x8B, 0x0D, 0x87, 0x08,
+    0x04, 0x01, 0x78, 0xA0, 0x05, 0x4C, 0x14, 0x46, 0x0E, 0x48, 0x16, 0x51,
+    0x10, 0xAC, 0xA1, 0x04, 0x52, 0x16, 0x45, 0x0B, 0x46, 0x14, 0x4D, 0x02,
+    0x9E, 0x00, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x02, 0x86, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x61, 0x13,
+    0x33, 0x03, 0x25, 0x35, 0x21, 0x15, 0x05, 0x13, 0x33, 0x03, 0x03, 0x35,
+    0x21, 0x15, 0x01, 0x9B, 0x78, 0x16, 0x78, 0xFE, 0x78, 0x02, 0x38, 0xFE,
+    0x23, 0x78, 0x16, 0x78, 0x4B, 0x02, 0x37, 0x02, 0xBC, 0xFD, 0x44, 0xD8,
+    0x16, 0x16, 0xD8, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0xDB, 0x16, 0x16, 0x00,
+    0x00, 0x01, 0x00, 0x4B, 0xFF, 0xA1, 0x01, 0xED, 0x02, 0xBC, 0x00, 0x03,
+    0x00, 0x00, 0x57, 0x01, 0x33, 0x01, 0x4B, 0x01, 0x8A, 0x18, 0xFE, 0x76,
+    0x5F, 0x03, 0x1B, 0xFC, 0xE5, 0x00, 0x00, 0x01, 0x00, 0x25, 0xFF, 0xA1,
+    0x01, 0xC9, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00, 0x45, 0x01, 0x33, 0x01,
+    0x01, 0xAF, 0xFE, 0x76, 0x1A, 0x01, 0x8A, 0x5F, 0x03, 0x1B, 0xFC, 0xE5,
+    0xFF, 0xFF, 0x00, 0x54, 0x01, 0x31, 0x00, 0x90, 0x01, 0x6F, 0x06, 0x07,
+    0x02, 0x69, 0x00, 0x00, 0x01, 0x36, 0xFF, 0xFF, 0x00, 0x6E, 0x01, 0x15,
+    0x00, 0xFD, 0x01, 0xA2, 0x04, 0x06, 0x02, 0x73, 0x08, 0x03, 0xFF, 0xFF,
+    0x00, 0x4B, 0xFF, 0xA1, 0x01, 0xED, 0x02, 0xBC, 0x04, 0x06, 0x02, 0x76,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x25, 0xFF, 0xA1, 0x01, 0xC9, 0x02, 0xBC,
+    0x04, 0x06, 0x02, 0x77, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0x01, 0x4F,
+    0x00, 0x33, 0x01, 0x8D, 0x04, 0x07, 0x02, 0x69, 0xFF, 0xA3, 0x01, 0x54,
+    0xFF, 0xFF, 0xFF, 0x56, 0x01, 0x4F, 0xFF, 0x92, 0x01, 0x8D, 0x04, 0x07,
+    0x02, 0x69, 0xFF, 0x02, 0x01, 0x54, 0x00, 0x01, 0x00, 0x3C, 0x01, 0x07,
+    0x01, 0x4E, 0x01, 0x1D, 0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x3C, 0x01, 0x12, 0x01, 0x07, 0x16, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x3C,
+    0x01, 0x07, 0x01, 0x4E, 0x01, 0x1D, 0x06, 0x06, 0x02, 0x7E, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x35, 0x01, 0x1B, 0x01, 0xCD, 0x01, 0x31, 0x00, 0x03,
+    0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x35, 0x01, 0x98, 0x01, 0x1B, 0x16,
+    0x16, 0x00, 0x00, 0x01, 0x00, 0x35, 0x01, 0x1C, 0x03, 0x2F, 0x01, 0x32,
+    0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x35, 0x02, 0xFA, 0x01,
+    0x1C, 0x16, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x3C, 0x01, 0x1B, 0x01, 0xD4,
+    0x01, 0x31, 0x06, 0x06, 0x02, 0x80, 0x07, 0x00, 0xFF, 0xFF, 0x00, 0x3C,
+    0x01, 0x1C, 0x03, 0x36, 0x01, 0x32, 0x06, 0x06, 0x02, 0x81, 0x07, 0x00,
+    0xFF, 0xFF, 0x00, 0x3C, 0x01, 0x07, 0x01, 0x4E, 0x01, 0x1D, 0x06, 0x06,
+    0x02, 0x7E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0xFF, 0x97, 0x02, 0x80,
+    0xFF, 0xAE, 0x00, 0x03, 0x00, 0x00, 0x57, 0x35, 0x21, 0x15, 0x38, 0x02,
+    0x48, 0x69, 0x17, 0x17, 0xFF, 0xFF, 0x00, 0x3C, 0x01, 0x32, 0x01, 0x4E,
+    0x01, 0x48, 0x06, 0x06, 0x02, 0x7E, 0x00, 0x2B, 0xFF, 0xFF, 0x00, 0x3C,
+    0x01, 0x46, 0x01, 0xD4, 0x01, 0x5C, 0x06, 0x06, 0x02, 0x80, 0x07, 0x2B,
+    0xFF, 0xFF, 0x00, 0x3C, 0x01, 0x4A, 0x03, 0x36, 0x01, 0x60, 0x06, 0x06,
+    0x02, 0x81, 0x07, 0x2E, 0x00, 0x01, 0x00, 0x3C, 0xFF, 0x46, 0x01, 0x45,
+    0x02, 0xBE, 0x00, 0x0D, 0x00, 0x00, 0x45, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x01, 0x36, 0x7A, 0x80,
+    0x81, 0x7A, 0x0E, 0x79, 0x79, 0x74, 0x7E, 0xBA, 0x4C, 0xE4, 0x8C, 0x8B,
+    0xE5, 0x4C, 0x11, 0x4F, 0xD8, 0x84, 0x82, 0xD6, 0x53, 0x00, 0x00, 0x01,
+    0x00, 0x0A, 0xFF, 0x46, 0x01, 0x13, 0x02, 0xBE, 0x00, 0x0D, 0x00, 0x00,
+    0x57, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x37, 0x16, 0x16, 0x15,
+    0x14, 0x06, 0x18, 0x0E, 0x79, 0x79, 0x74, 0x7E, 0x0F, 0x7A, 0x80, 0x81,
+    0xBA, 0x11, 0x4F, 0xD8, 0x84, 0x82, 0xD6, 0x53, 0x11, 0x4C, 0xE4, 0x8C,
+    0x8B, 0xE5, 0x00, 0x01, 0x00, 0x3F, 0xFF, 0x46, 0x01, 0x5D, 0x02, 0xAE,
+    0x00, 0x25, 0x00, 0x00, 0x45, 0x2E, 0x03, 0x35, 0x37, 0x34, 0x26, 0x27,
+    0x23, 0x35, 0x33, 0x36, 0x36, 0x35, 0x27, 0x34, 0x36, 0x37, 0x17, 0x0E,
+    0x02, 0x15, 0x17, 0x14, 0x06, 0x07, 0x35, 0x16, 0x16, 0x15, 0x07, 0x14,
+    0x16, 0x16, 0x17, 0x01, 0x57, 0x21, 0x35, 0x24, 0x14, 0x02, 0x3E, 0x3A,
+    0x14, 0x14, 0x3B, 0x3D, 0x02, 0x4C, 0x42, 0x06, 0x2E, 0x37, 0x19, 0x02,
+    0x2D, 0x2D, 0x2E, 0x2C, 0x02, 0x19, 0x37, 0x2E, 0xBA, 0x08, 0x1C, 0x2C,
+    0x3C, 0x27, 0x5F, 0x46, 0x4E, 0x01, 0x1A, 0x01, 0x4D, 0x47, 0x5F, 0x4D,
+    0x57, 0x0F, 0x13, 0x0C, 0x2A, 0x44, 0x34, 0x5F, 0x3A, 0x4D, 0x0E, 0x03,
+    0x11, 0x4C, 0x39, 0x5F, 0x34, 0x44, 0x2A, 0x0C, 0x00, 0x01, 0x00, 0x35,
+    0xFF, 0x46, 0x01, 0x53, 0x02, 0xAE, 0x00, 0x25, 0x00, 0x00, 0x57, 0x27,
+    0x3E, 0x02, 0x35, 0x27, 0x34, 0x36, 0x37, 0x15, 0x26, 0x26, 0x35, 0x37,
+    0x34, 0x26, 0x26, 0x27, 0x37, 0x1E, 0x03, 0x15, 0x07, 0x14, 0x16, 0x17,
+    0x33, 0x15, 0x23, 0x06, 0x06, 0x15, 0x17, 0x14, 0x06, 0x3B, 0x06, 0x2E,
+    0x37, 0x19, 0x02, 0x2D, 0x2D, 0x2E, 0x2C, 0x02, 0x19, 0x37, 0x2E, 0x06,
+    0x21, 0x35, 0x24, 0x14, 0x02, 0x3E, 0x3A, 0x14, 0x14, 0x3B, 0x3D, 0x02,
+    0x4C, 0xBA, 0x13, 0x0C, 0x2A, 0x44, 0x34, 0x5F, 0x3A, 0x4D, 0x0E, 0x03,
+    0x11, 0x4C, 0x39, 0x5F, 0x34, 0x44, 0x2A, 0x0C, 0x13, 0x07, 0x1D, 0x2C,
+    0x3C, 0x27, 0x5F, 0x46, 0x4E, 0x01, 0x1A, 0x01, 0x4D, 0x47, 0x5F, 0x4D,
+    0x57, 0x00, 0x00, 0x01, 0x00, 0x4B, 0xFF, 0x42, 0x01, 0x1F, 0x02, 0xBC,
+    0x00, 0x09, 0x00, 0x00, 0x57, 0x11, 0x33, 0x15, 0x23, 0x37, 0x11, 0x27,
+    0x33, 0x15, 0x4B, 0xD4, 0xC7, 0x0A, 0x0B, 0xC8, 0xBE, 0x03, 0x7A, 0x16,
+    0x08, 0xFC, 0x9E, 0x0C, 0x16, 0x00, 0x00, 0x01, 0x00, 0x20, 0xFF, 0x42,
+    0x00, 0xF4, 0x02, 0xBC, 0x00, 0x09, 0x00, 0x00, 0x57, 0x35, 0x33, 0x07,
+    0x11, 0x17, 0x23, 0x35, 0x33, 0x11, 0x20, 0xC7, 0x0A, 0x0B, 0xC8, 0xD4,
+    0xBE, 0x16, 0x08, 0x03, 0x62, 0x0C, 0x16, 0xFC, 0x86, 0x00, 0xFF, 0xFF,
+    0x00, 0x3C, 0xFF, 0x78, 0x01, 0x45, 0x02, 0xF0, 0x04, 0x06, 0x02, 0x89,
+    0x00, 0x32, 0xFF, 0xFF, 0x00, 0x0A, 0xFF, 0x78, 0x01, 0x13, 0x02, 0xF0,
+    0x04, 0x06, 0x02, 0x8A, 0x00, 0x32, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x78,
+    0x01, 0x5D, 0x02, 0xE0, 0x06, 0x06, 0x02, 0x8B, 0x00, 0x32, 0xFF, 0xFF,
+    0x00, 0x35, 0xFF, 0x78, 0x01, 0x53, 0x02, 0xE0, 0x06, 0x06, 0x02, 0x8C,
+    0x00, 0x32, 0xFF, 0xFF, 0x00, 0x4B, 0xFF, 0x6A, 0x01, 0x1F, 0x02, 0xE4,
+    0x06, 0x06, 0x02, 0x8D, 0x00, 0x28, 0xFF, 0xFF, 0x00, 0x20, 0xFF, 0x6A,
+    0x00, 0xF4, 0x02, 0xE4, 0x06, 0x06, 0x02, 0x8E, 0x00, 0x28, 0xFF, 0xFF,
+    0x00, 0x4A, 0xFF, 0x86, 0x00, 0x96, 0x00, 0x36, 0x06, 0x06, 0x02, 0x6A,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x4A, 0xFF, 0x86, 0x01, 0x01, 0x00, 0x36,
+    0x04, 0x26, 0x02, 0x6A, 0x00, 0x00, 0x00, 0x07, 0x02, 0x6A, 0x00, 0x6B,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x50, 0x02, 0x37, 0x01, 0x07, 0x02, 0xE7,
+    0x04, 0x26, 0x02, 0x99, 0x00, 0xFB, 0x00, 0x07, 0x02, 0x99, 0x00, 0x6B,
+    0xFF, 0xFB, 0xFF, 0xFF, 0x00, 0x50, 0x02, 0x3C, 0x01, 0x01, 0x02, 0xEC,
+    0x04, 0x26, 0x02, 0x9A, 0x00, 0x00, 0x00, 0x07, 0x02, 0x9A, 0x00, 0x65,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x02, 0x3C, 0x00, 0x9C, 0x02, 0xEC,
+    0x00, 0x15, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
+    0x37, 0x17, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x7E, 0x0E, 0x15, 0x0B, 0x04, 0x0E, 0x19, 0x15, 0x09, 0x13, 0x1A,
+    0x0F, 0x0E, 0x08, 0x0B, 0x0F, 0x02, 0x3C, 0x0E, 0x1B, 0x14, 0x0E, 0x1A,
+    0x1B, 0x1E, 0x12, 0x0C, 0x15, 0x28, 0x0D, 0x10, 0x0C, 0x05, 0x03, 0x0F,
+    0x0B, 0x0C, 0x10, 0x00, 0x00, 0x01, 0x00, 0x50, 0x02, 0x3C, 0x00, 0x9C,
+    0x02, 0xEC, 0x00, 0x15, 0x00, 0x00, 0x53, 0x27, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15,
+    0x14, 0x0E, 0x02, 0x5C, 0x09, 0x13, 0x1A, 0x0F, 0x0E, 0x08, 0x0B, 0x0F,
+    0x0F, 0x0F, 0x14, 0x0B, 0x04, 0x0E, 0x19, 0x02, 0x3C, 0x0C, 0x15, 0x28,
+    0x0D, 0x10, 0x0C, 0x05, 0x03, 0x0F, 0x0B, 0x0C, 0x10, 0x0E, 0x1B, 0x14,
+    0x0E, 0x1A, 0x1B, 0x1E, 0xFF, 0xFF, 0x00, 0x28, 0x00, 0x49, 0x01, 0x9B,
+    0x01, 0xC9, 0x04, 0x27, 0x02, 0x9D, 0x00, 0xB7, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0x9D, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x2D, 0x00, 0x40, 0x01, 0xC1,
+    0x01, 0xC0, 0x04, 0x27, 0x02, 0x9E, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x06,
+    0x02, 0x9E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x49, 0x00, 0xE4,
+    0x01, 0xC9, 0x00, 0x07, 0x00, 0x00, 0x77, 0x27, 0x35, 0x37, 0x17, 0x07,
+    0x35, 0x17, 0xD1, 0xA9, 0xA9, 0x13, 0xAB, 0xAB, 0x49, 0xC3, 0x06, 0xB7,
+    0x0D, 0xB7, 0x14, 0xC3, 0x00, 0x01, 0x00, 0x2D, 0x00, 0x40, 0x00, 0xE9,
+    0x01, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x77, 0x27, 0x37, 0x15, 0x27, 0x37,
+    0x17, 0x15, 0x40, 0x13, 0xAB, 0xAB, 0x13, 0xA9, 0x40, 0x0D, 0xB7, 0x14,
+    0xC3, 0x0D, 0xC3, 0x06, 0x00, 0x02, 0x00, 0x50, 0x01, 0xBA, 0x00, 0xF8,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x13, 0x33, 0x03,
+    0x23, 0x13, 0x33, 0x03, 0xAD, 0x30, 0x1B, 0x3A, 0x6E, 0x30, 0x1B, 0x3A,
+    0x01, 0xBA, 0x01, 0x02, 0xFE, 0xFE, 0x01, 0x02, 0xFE, 0xFE, 0x00, 0x01,
+    0x00, 0x38, 0x01, 0xBA, 0x00, 0x79, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x00,
+    0x53, 0x13, 0x33, 0x03, 0x38, 0x26, 0x1B, 0x2F, 0x01, 0xBA, 0x01, 0x02,
+    0xFE, 0xFE, 0xFF, 0xFF, 0x00, 0x28, 0x00, 0x93, 0x01, 0x9B, 0x02, 0x13,
+    0x04, 0x27, 0x02, 0x9D, 0x00, 0xB7, 0x00, 0x4A, 0x00, 0x06, 0x02, 0x9D,
+    0x00, 0x4A, 0xFF, 0xFF, 0x00, 0x2D, 0x00, 0x8A, 0x01, 0xC1, 0x02, 0x0A,
+    0x04, 0x27, 0x02, 0x9E, 0x00, 0xD8, 0x00, 0x4A, 0x00, 0x06, 0x02, 0x9E,
+    0x00, 0x4A, 0xFF, 0xFF, 0x00, 0x28, 0x00, 0x9A, 0x00, 0xE4, 0x02, 0x1A,
+    0x06, 0x06, 0x02, 0x9D, 0x00, 0x51, 0xFF, 0xFF, 0x00, 0x2D, 0x00, 0x91,
+    0x00, 0xE9, 0x02, 0x11, 0x06, 0x06, 0x02, 0x9E, 0x00, 0x51, 0x00, 0x02,
+    0x00, 0x04, 0xFF, 0xE2, 0x02, 0x04, 0x02, 0xB5, 0x00, 0x1C, 0x00, 0x20,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x36, 0x37, 0x13, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x03, 0x06, 0x06, 0x03, 0x35, 0x21, 0x15, 0x60,
+    0x1A, 0x2F, 0x13, 0x0A, 0x1A, 0x24, 0x18, 0x1F, 0x26, 0x14, 0x05, 0x4E,
+    0x0E, 0x3F, 0x3A, 0x1F, 0x35, 0x19, 0x0B, 0x19, 0x32, 0x1C, 0x2B, 0x35,
+    0x0D, 0x48, 0x0D, 0x3C, 0x44, 0x01, 0x71, 0x1E, 0x12, 0x0E, 0x14, 0x12,
+    0x0C, 0x20, 0x32, 0x1A, 0x01, 0xB7, 0x4D, 0x4D, 0x12, 0x11, 0x14, 0x11,
+    0x10, 0x46, 0x49, 0xFE, 0x68, 0x4C, 0x4A, 0x01, 0xC4, 0x16, 0x16, 0x00,
+    0x00, 0x02, 0x00, 0x37, 0xFF, 0x5E, 0x03, 0xA3, 0x02, 0xC6, 0x00, 0x50,
+    0x00, 0x62, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26, 0x35,
+    0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x37, 0x33, 0x03,
+    0x06, 0x06, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37,
+    0x17, 0x0E, 0x02, 0x27, 0x32, 0x36, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x01, 0xA8, 0x51,
+    0x88, 0x62, 0x36, 0x47, 0x82, 0xB5, 0x6D, 0x55, 0x8D, 0x67, 0x38, 0x28,
+    0x43, 0x53, 0x2A, 0x1E, 0x22, 0x0E, 0x0D, 0x0C, 0x0A, 0x11, 0x40, 0x54,
+    0x30, 0x31, 0x4C, 0x2C, 0x22, 0x3C, 0x54, 0x31, 0x24, 0x48, 0x39, 0x0D,
+    0x0A, 0x19, 0x16, 0x3F, 0x06, 0x04, 0x17, 0x1F, 0x25, 0x4B, 0x3D, 0x26,
+    0x5E, 0xA3, 0x68, 0x6A, 0xAD, 0x7B, 0x43, 0x33, 0x5D, 0x7F, 0x4B, 0x23,
+    0x5C, 0x57, 0x1B, 0x0C, 0x23, 0x56, 0x5B, 0x14, 0x38, 0x58, 0x3B, 0x0B,
+    0x01, 0x02, 0x24, 0x48, 0x35, 0x34, 0x5D, 0x3B, 0x52, 0xA2, 0x38, 0x66,
+    0x8E, 0x56, 0x61, 0xAF, 0x88, 0x4E, 0x30, 0x58, 0x77, 0x47, 0x4E, 0x79,
+    0x56, 0x2C, 0x15, 0x21, 0x13, 0x14, 0x2F, 0x22, 0x0B, 0x32, 0x49, 0x28,
+    0x2C, 0x4F, 0x35, 0x38, 0x65, 0x4E, 0x2C, 0x1A, 0x3D, 0x35, 0x08, 0x8B,
+    0xFE, 0xBC, 0x22, 0x2D, 0x15, 0x26, 0x4C, 0x73, 0x4C, 0x5F, 0x89, 0x4A,
+    0x4E, 0x84, 0xA3, 0x54, 0x54, 0x89, 0x62, 0x34, 0x13, 0x1F, 0x11, 0x12,
+    0x15, 0x20, 0x12, 0xEF, 0x35, 0x66, 0x49, 0x05, 0x13, 0x06, 0x22, 0x47,
+    0x30, 0x41, 0x74, 0x4B, 0x44, 0x57, 0x00, 0x02, 0x00, 0x32, 0xFF, 0xF6,
+    0x02, 0x7C, 0x02, 0xBF, 0x00, 0x20, 0x00, 0x3B, 0x00, 0x00, 0x61, 0x2F,
+    0x02, 0x2E, 0x03, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17,
+    0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x1E, 0x02, 0x17,
+    0x13, 0x17, 0x17, 0x07, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x37, 0x33,
+    0x0E, 0x04, 0x02, 0x1C, 0x31, 0x0D, 0xE1, 0x27, 0x30, 0x1C, 0x0A, 0x31,
+    0x58, 0x3A, 0x2D, 0x47, 0x33, 0x11, 0x13, 0x1B, 0x4E, 0x3C, 0x35, 0x4D,
+    0x2A, 0x09, 0x16, 0x29, 0x20, 0xF3, 0x07, 0x40, 0xFE, 0x4F, 0x77, 0x43,
+    0x43, 0x42, 0x0C, 0x38, 0x42, 0x3F, 0x6F, 0x48, 0x3D, 0x65, 0x4C, 0x30,
+    0x09, 0x16, 0x07, 0x23, 0x37, 0x4B, 0x5D, 0x35, 0x0D, 0xF3, 0x2A, 0x3A,
+    0x2D, 0x2C, 0x1C, 0x34, 0x50, 0x2D, 0x1D, 0x37, 0x29, 0x0B, 0x3C, 0x36,
+    0x28, 0x45, 0x2C, 0x19, 0x26, 0x27, 0x30, 0x23, 0xFE, 0xF7, 0x08, 0x46,
+    0x0A, 0x38, 0x67, 0x48, 0x3E, 0x6B, 0x20, 0x12, 0x19, 0x64, 0x3A, 0x3D,
+    0x5F, 0x35, 0x2C, 0x54, 0x75, 0x48, 0x3C, 0x69, 0x53, 0x3B, 0x20, 0x00,
+    0x00, 0x01, 0x00, 0x37, 0x00, 0x00, 0x01, 0xCB, 0x02, 0xBC, 0x00, 0x13,
+    0x00, 0x00, 0x61, 0x11, 0x17, 0x23, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x36, 0x33, 0x33, 0x11, 0x23, 0x11, 0x17, 0x23, 0x37, 0x11, 0x01, 0x29,
+    0x0B, 0x41, 0x36, 0x55, 0x31, 0x38, 0x65, 0x44, 0xB3, 0x16, 0x0B, 0x8C,
+    0x0B, 0x01, 0x23, 0x0C, 0x36, 0x5D, 0x3C, 0x41, 0x60, 0x35, 0xFD, 0x44,
+    0x02, 0xB2, 0x0C, 0x0C, 0xFD, 0x4E, 0x00, 0x02, 0x00, 0x4C, 0xFF, 0xC3,
+    0x01, 0xCB, 0x02, 0xBF, 0x00, 0x2A, 0x00, 0x52, 0x00, 0x00, 0x65, 0x27,
+    0x3E, 0x02, 0x35, 0x34, 0x26, 0x27, 0x27, 0x2E, 0x03, 0x35, 0x34, 0x3E,
+    0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x06,
+    0x15, 0x14, 0x16, 0x16, 0x17, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x07, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x26, 0x27, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37,
+    0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x17, 0x17, 0x1E, 0x02, 0x15, 0x14,
+    0x06, 0x06, 0x01, 0x62, 0x14, 0x16, 0x2F, 0x20, 0x2E, 0x22, 0x93, 0x16,
+    0x25, 0x1B, 0x0E, 0x18, 0x2A, 0x3A, 0x22, 0x25, 0x44, 0x3D, 0x18, 0x10,
+    0x16, 0x37, 0x3E, 0x23, 0x39, 0x4D, 0x13, 0x27, 0x1E, 0x8F, 0x39, 0x27,
+    0x1E, 0x2F, 0x60, 0x28, 0x4D, 0x42, 0x1B, 0x10, 0x26, 0x62, 0x3A, 0x3B,
+    0x50, 0x15, 0x2C, 0x21, 0x8F, 0x39, 0x27, 0x1D, 0x2F, 0x1C, 0x15, 0x16,
+    0x2F, 0x20, 0x2E, 0x22, 0x93, 0x21, 0x31, 0x1C, 0x2A, 0x4A, 0xA8, 0x0F,
+    0x07, 0x1F, 0x31, 0x22, 0x27, 0x28, 0x0D, 0x37, 0x09, 0x17, 0x1E, 0x27,
+    0x18, 0x1E, 0x2F, 0x21, 0x11, 0x13, 0x25, 0x1C, 0x12, 0x1A, 0x24, 0x12,
+    0x37, 0x33, 0x16, 0x27, 0x20, 0x0B, 0x35, 0x15, 0x3D, 0x22, 0x23, 0x35,
+    0x24, 0xEF, 0x10, 0x1F, 0x16, 0x12, 0x1E, 0x23, 0x37, 0x33, 0x16, 0x26,
+    0x20, 0x0C, 0x35, 0x15, 0x3D, 0x22, 0x21, 0x34, 0x26, 0x0B, 0x0F, 0x07,
+    0x1E, 0x31, 0x22, 0x27, 0x29, 0x0D, 0x37, 0x0C, 0x21, 0x2F, 0x21, 0x27,
+    0x39, 0x1F, 0x00, 0x03, 0x00, 0x23, 0xFF, 0xF8, 0x02, 0xEE, 0x02, 0xC3,
+    0x00, 0x13, 0x00, 0x32, 0x00, 0x46, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02,
+    0x27, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x32, 0x3E, 0x02, 0x35, 0x34,
+    0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x01, 0x88,
+    0x4B, 0x82, 0x61, 0x37, 0x37, 0x61, 0x82, 0x4B, 0x4B, 0x82, 0x62, 0x37,
+    0x37, 0x62, 0x82, 0x45, 0x39, 0x5D, 0x36, 0x36, 0x5D, 0x39, 0x22, 0x42,
+    0x1D, 0x0D, 0x0A, 0x22, 0x2D, 0x1B, 0x32, 0x53, 0x31, 0x31, 0x52, 0x33,
+    0x26, 0x38, 0x1B, 0x0C, 0x1E, 0x44, 0x28, 0x46, 0x79, 0x5C, 0x33, 0x33,
+    0x5C, 0x79, 0x46, 0x46, 0x7A, 0x5C, 0x33, 0x33, 0x5C, 0x7A, 0x08, 0x37,
+    0x61, 0x82, 0x4B, 0x4B, 0x82, 0x62, 0x37, 0x37, 0x62, 0x82, 0x4B, 0x4B,
+    0x82, 0x61, 0x37, 0x96, 0x36, 0x5E, 0x3C, 0x39, 0x5E, 0x38, 0x17, 0x16,
+    0x12, 0x08, 0x13, 0x0E, 0x34, 0x54, 0x31, 0x33, 0x55, 0x32, 0x13, 0x12,
+    0x10, 0x15, 0x16, 0x80, 0x34, 0x5B, 0x7B, 0x46, 0x46, 0x7A, 0x5B, 0x34,
+    0x34, 0x5B, 0x7A, 0x46, 0x46, 0x7B, 0x5B, 0x34, 0x00, 0x05, 0x00, 0x1C,
+    0x01, 0x01, 0x01, 0xEA, 0x02, 0xC5, 0x00, 0x12, 0x00, 0x22, 0x00, 0x26,
+    0x00, 0x32, 0x00, 0x3D, 0x00, 0x00, 0x41, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x37, 0x27, 0x37, 0x17, 0x23, 0x35, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x23, 0x37, 0x15, 0x35, 0x27, 0x33, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x23, 0x37, 0x01, 0x03, 0x3F, 0x69, 0x3F, 0x24, 0x41,
+    0x53, 0x2F, 0x30, 0x54, 0x3F, 0x24, 0x24, 0x3F, 0x54, 0x30, 0x3A, 0x60,
+    0x39, 0x39, 0x60, 0x3A, 0x3A, 0x60, 0x39, 0x3A, 0x60, 0x70, 0x29, 0x13,
+    0x2D, 0x92, 0x4D, 0x23, 0x2A, 0x2C, 0x21, 0x40, 0x07, 0x07, 0x3B, 0x1B,
+    0x22, 0x1D, 0x1E, 0x41, 0x0B, 0x01, 0x01, 0x3D, 0x66, 0x3F, 0x2F, 0x52,
+    0x3E, 0x23, 0x23, 0x3E, 0x52, 0x2F, 0x2F, 0x52, 0x3E, 0x23, 0x14, 0x37,
+    0x5E, 0x39, 0x3A, 0x5D, 0x37, 0x37, 0x5D, 0x3A, 0x3A, 0x5D, 0x37, 0x5A,
+    0x68, 0x08, 0x70, 0xEF, 0x29, 0x21, 0x1E, 0x26, 0x05, 0x66, 0x6F, 0x06,
+    0x1C, 0x15, 0x19, 0x1C, 0x08, 0x00, 0x00, 0x03, 0x00, 0x28, 0x01, 0x54,
+    0x02, 0xA5, 0x02, 0xBE, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+    0x41, 0x11, 0x33, 0x13, 0x23, 0x13, 0x33, 0x11, 0x23, 0x11, 0x17, 0x07,
+    0x23, 0x27, 0x37, 0x11, 0x23, 0x11, 0x33, 0x11, 0x03, 0x35, 0x21, 0x15,
+    0x01, 0x6E, 0x0D, 0x9B, 0x15, 0x97, 0x0D, 0x16, 0x10, 0x89, 0x15, 0x8D,
+    0x10, 0xE1, 0x16, 0x91, 0x01, 0x12, 0x01, 0x54, 0x01, 0x6A, 0xFE, 0xFD,
+    0x01, 0x03, 0xFE, 0x96, 0x01, 0x4D, 0x02, 0xED, 0xED, 0x02, 0xFE, 0xB3,
+    0x01, 0x5A, 0xFE, 0xA6, 0x01, 0x52, 0x16, 0x16, 0x00, 0x02, 0x00, 0x6E,
+    0x01, 0x8F, 0x01, 0xA6, 0x02, 0xC5, 0x00, 0x0F, 0x00, 0x1F, 0x00, 0x00,
+    0x41, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x0A, 0x2C, 0x47,
+    0x29, 0x29, 0x46, 0x2D, 0x2D, 0x46, 0x29, 0x29, 0x47, 0x2C, 0x25, 0x3D,
+    0x24, 0x25, 0x3D, 0x24, 0x25, 0x3D, 0x24, 0x24, 0x3D, 0x01, 0x8F, 0x29,
+    0x46, 0x2B, 0x2C, 0x47, 0x29, 0x29, 0x47, 0x2B, 0x2B, 0x47, 0x29, 0x16,
+    0x25, 0x3C, 0x24, 0x24, 0x3D, 0x24, 0x24, 0x3D, 0x25, 0x24, 0x3C, 0x24,
+    0xFF, 0xFF, 0x00, 0x50, 0x01, 0xBA, 0x00, 0xF8, 0x02, 0xBC, 0x06, 0x06,
+    0x02, 0x9F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x64, 0xFF, 0x3F, 0x00, 0x7B,
+    0x02, 0xE4, 0x00, 0x03, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x64, 0x17,
+    0xC1, 0x03, 0xA5, 0xFC, 0x5B, 0x00, 0x00, 0x02, 0x00, 0x65, 0xFF, 0x36,
+    0x00, 0x7B, 0x02, 0xE4, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x57, 0x11,
+    0x33, 0x11, 0x03, 0x11, 0x33, 0x11, 0x65, 0x16, 0x16, 0x16, 0xCA, 0x01,
+    0x90, 0xFE, 0x70, 0x02, 0x1F, 0x01, 0x8F, 0xFE, 0x71, 0x00, 0x00, 0x02,
+    0x00, 0x3C, 0x00, 0xD8, 0x01, 0x7A, 0x02, 0xD1, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x77, 0x11, 0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0xD0, 0x16,
+    0xAA, 0x01, 0x3E, 0xD8, 0x01, 0xF9, 0xFE, 0x07, 0x01, 0x54, 0x16, 0x16,
+    0x00, 0x01, 0x00, 0x2E, 0xFF, 0xF6, 0x02, 0x07, 0x02, 0xEC, 0x00, 0x38,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x37, 0x3E,
+    0x02, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x0E, 0x02, 0x07,
+    0x27, 0x36, 0x36, 0x37, 0x3E, 0x03, 0x35, 0x34, 0x26, 0x23, 0x22, 0x0E,
+    0x02, 0x07, 0x0E, 0x03, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x01, 0x36, 0x35, 0x50, 0x2D, 0x0B, 0x16, 0x12,
+    0x16, 0x3E, 0x4D, 0x2C, 0x3D, 0x46, 0x26, 0x4F, 0x3D, 0x1D, 0x57, 0x6C,
+    0x3C, 0x0B, 0x58, 0x97, 0x3A, 0x1E, 0x38, 0x2A, 0x19, 0x37, 0x36, 0x20,
+    0x39, 0x31, 0x28, 0x0D, 0x0C, 0x0F, 0x0A, 0x04, 0x25, 0x44, 0x2E, 0x19,
+    0x2D, 0x27, 0x10, 0x0B, 0x1E, 0x47, 0x0A, 0x42, 0x74, 0x4B, 0x31, 0x6D,
+    0x6B, 0x2E, 0x3B, 0x55, 0x2E, 0x4B, 0x41, 0x30, 0x70, 0x7A, 0x3E, 0x1F,
+    0x46, 0x44, 0x1C, 0x14, 0x29, 0x6D, 0x3D, 0x20, 0x4B, 0x52, 0x54, 0x29,
+    0x2C, 0x46, 0x1F, 0x38, 0x4A, 0x2A, 0x25, 0x4C, 0x4B, 0x43, 0x1A, 0x3B,
+    0x69, 0x42, 0x0C, 0x17, 0x10, 0x13, 0x1D, 0x19, 0x00, 0x03, 0x00, 0x3C,
+    0x00, 0xC5, 0x01, 0x74, 0x02, 0xD0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x77, 0x11, 0x33, 0x11, 0x27, 0x35, 0x21, 0x15, 0x25, 0x35,
+    0x21, 0x15, 0xCD, 0x16, 0xA7, 0x01, 0x38, 0xFE, 0xC8, 0x01, 0x38, 0xC5,
+    0x02, 0x0B, 0xFD, 0xF5, 0xC4, 0x16, 0x16, 0x9F, 0x16, 0x16, 0x00, 0x02,
+    0x00, 0x2B, 0xFF, 0xF5, 0x02, 0x54, 0x02, 0x45, 0x00, 0x24, 0x00, 0x32,
+    0x00, 0x00, 0x45, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x17, 0x16, 0x06, 0x23, 0x21, 0x37, 0x15, 0x14, 0x1E, 0x02,
+    0x33, 0x32, 0x36, 0x37, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x06, 0x06, 0x01, 0x27, 0x21, 0x07, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x01, 0x3F, 0x53, 0x7C, 0x45, 0x45, 0x7C, 0x53, 0x4E,
+    0x79, 0x48, 0x05, 0x01, 0x0C, 0x0B, 0xFE, 0x20, 0x06, 0x1F, 0x39, 0x51,
+    0x33, 0x3F, 0x62, 0x25, 0x07, 0x0A, 0x08, 0x0E, 0x04, 0x02, 0x2E, 0x6A,
+    0xFE, 0xD5, 0x0A, 0x01, 0xCE, 0x0E, 0x21, 0x3C, 0x4F, 0x2F, 0x3D, 0x64,
+    0x3A, 0x0B, 0x50, 0x86, 0x52, 0x53, 0x86, 0x4F, 0x45, 0x7B, 0x50, 0x09,
+    0x0F, 0x07, 0x4F, 0x1C, 0x41, 0x38, 0x24, 0x34, 0x3B, 0x0B, 0x0A, 0x0A,
+    0x04, 0x08, 0x03, 0x42, 0x3C, 0x01, 0x45, 0x0A, 0x04, 0x23, 0x27, 0x44,
+    0x34, 0x1D, 0x35, 0x51, 0x2C, 0x00, 0x00, 0x04, 0x00, 0x6E, 0x00, 0x00,
+    0x04, 0x46, 0x02, 0xC6, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x23, 0x00, 0x3B,
+    0x00, 0x00, 0x41, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x07, 0x35, 0x21, 0x15, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x11, 0x33, 0x01, 0x23, 0x26, 0x26, 0x34, 0x26, 0x34,
+    0x35, 0x11, 0x33, 0x11, 0x23, 0x01, 0x33, 0x14, 0x16, 0x16, 0x14, 0x14,
+    0x15, 0x11, 0x03, 0x96, 0x31, 0x4F, 0x2F, 0x2F, 0x4F, 0x31, 0x31, 0x50,
+    0x2F, 0x2F, 0x50, 0xD5, 0x01, 0x49, 0xA5, 0x2B, 0x46, 0x29, 0x29, 0x46,
+    0x2B, 0x2B, 0x45, 0x29, 0x29, 0x45, 0xFD, 0x03, 0x16, 0x01, 0xD9, 0x04,
+    0x01, 0x01, 0x01, 0x16, 0x14, 0xFE, 0x1B, 0x0F, 0x01, 0x01, 0x01, 0x66,
+    0x2F, 0x50, 0x31, 0x31, 0x50, 0x2F, 0x2F, 0x50, 0x31, 0x31, 0x50, 0x2F,
+    0x84, 0x16, 0x16, 0x9A, 0x29, 0x46, 0x2B, 0x2B, 0x46, 0x29, 0x29, 0x46,
+    0x2B, 0x2B, 0x46, 0x29, 0xFE, 0x84, 0x02, 0xBC, 0xFD, 0x63, 0x09, 0x14,
+    0x1D, 0x2C, 0x3F, 0x2D, 0x01, 0xCB, 0xFD, 0x44, 0x02, 0xAE, 0x0A, 0x24,
+    0x2F, 0x33, 0x32, 0x16, 0xFE, 0x2A, 0xFF, 0xFF, 0x00, 0x37, 0xFF, 0xC2,
+    0x03, 0xA3, 0x03, 0x2A, 0x06, 0x06, 0x02, 0xA6, 0x00, 0x64, 0x00, 0x02,
+    0x00, 0x37, 0xFF, 0xAB, 0x02, 0x8F, 0x03, 0x11, 0x00, 0x0B, 0x00, 0x31,
+    0x00, 0x00, 0x45, 0x35, 0x35, 0x11, 0x35, 0x35, 0x33, 0x15, 0x15, 0x11,
+    0x15, 0x15, 0x27, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14,
+    0x1E, 0x02, 0x33, 0x32, 0x36, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x01, 0x7B,
+    0x15, 0x01, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x35, 0x5D,
+    0x4F, 0x1F, 0x12, 0x1D, 0x4A, 0x56, 0x31, 0x45, 0x76, 0x56, 0x30, 0x30,
+    0x56, 0x76, 0x45, 0x2D, 0x52, 0x46, 0x1C, 0x0F, 0x1E, 0x4B, 0x57, 0x55,
+    0x50, 0x0D, 0x02, 0xAC, 0x0F, 0x4E, 0x4E, 0x10, 0xFD, 0x55, 0x0E, 0x4F,
+    0x4B, 0x34, 0x5F, 0x83, 0x4E, 0x50, 0x85, 0x61, 0x36, 0x1D, 0x34, 0x23,
+    0x10, 0x21, 0x32, 0x1B, 0x33, 0x5C, 0x7D, 0x4A, 0x49, 0x7A, 0x5A, 0x31,
+    0x15, 0x27, 0x1B, 0x12, 0x1D, 0x28, 0x16, 0x00, 0x00, 0x02, 0x00, 0x2C,
+    0x00, 0x00, 0x01, 0xFE, 0x02, 0xBC, 0x00, 0x1F, 0x00, 0x2B, 0x00, 0x00,
+    0x65, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x07, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x36, 0x37, 0x17, 0x06, 0x06, 0x07, 0x35, 0x35, 0x11, 0x35, 0x35,
+    0x33, 0x15, 0x15, 0x11, 0x15, 0x15, 0x01, 0x38, 0x4F, 0x79, 0x44, 0x44,
+    0x79, 0x4F, 0x3E, 0x65, 0x23, 0x10, 0x16, 0x38, 0x43, 0x25, 0x47, 0x6F,
+    0x3F, 0x01, 0x01, 0x3F, 0x6F, 0x47, 0x25, 0x41, 0x38, 0x16, 0x10, 0x24,
+    0x63, 0x5A, 0x16, 0x4E, 0x46, 0x7C, 0x4F, 0x4E, 0x78, 0x44, 0x2E, 0x28,
+    0x11, 0x19, 0x25, 0x13, 0x3F, 0x6E, 0x47, 0x49, 0x72, 0x40, 0x13, 0x25,
+    0x19, 0x0F, 0x28, 0x30, 0x4E, 0x55, 0x0A, 0x01, 0xFA, 0x0B, 0x58, 0x58,
+    0x0C, 0xFE, 0x07, 0x0A, 0x55, 0x00, 0x00, 0x03, 0x00, 0x37, 0xFF, 0xD3,
+    0x02, 0x8F, 0x03, 0x01, 0x00, 0x03, 0x00, 0x07, 0x00, 0x2D, 0x00, 0x00,
+    0x57, 0x27, 0x01, 0x17, 0x01, 0x27, 0x01, 0x17, 0x03, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
+    0x37, 0x17, 0x0E, 0x02, 0xE8, 0x14, 0x01, 0x8E, 0x16, 0xFD, 0xE9, 0x14,
+    0x01, 0x8E, 0x16, 0x62, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B,
+    0x35, 0x5D, 0x4F, 0x1F, 0x12, 0x1D, 0x4A, 0x56, 0x31, 0x45, 0x76, 0x56,
+    0x30, 0x30, 0x56, 0x76, 0x45, 0x2D, 0x52, 0x46, 0x1C, 0x0F, 0x1E, 0x4B,
+    0x57, 0x2D, 0x0A, 0x03, 0x24, 0x09, 0xFC, 0xDC, 0x09, 0x03, 0x24, 0x09,
+    0xFC, 0xFE, 0x34, 0x5F, 0x83, 0x4E, 0x50, 0x85, 0x61, 0x36, 0x1D, 0x34,
+    0x23, 0x10, 0x21, 0x32, 0x1B, 0x33, 0x5C, 0x7D, 0x4A, 0x49, 0x7A, 0x5A,
+    0x31, 0x15, 0x27, 0x1B, 0x12, 0x1D, 0x28, 0x16, 0x00, 0x06, 0x00, 0x50,
+    0x00, 0x6E, 0x01, 0xDE, 0x01, 0xF0, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x65, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x07, 0x27, 0x37, 0x17, 0x27, 0x27, 0x37, 0x17, 0x13, 0x32, 0x36, 0x36,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16,
+    0x17, 0x27, 0x37, 0x17, 0x03, 0x27, 0x37, 0x17, 0x01, 0x17, 0x31, 0x51,
+    0x30, 0x30, 0x51, 0x31, 0x31, 0x51, 0x30, 0x30, 0x51, 0xE9, 0x0F, 0x47,
+    0x10, 0x10, 0x47, 0x0F, 0x48, 0x70, 0x2E, 0x46, 0x28, 0x28, 0x46, 0x2E,
+    0x2D, 0x47, 0x28, 0x28, 0x47, 0xE5, 0x48, 0x10, 0x47, 0x47, 0x10, 0x48,
+    0x0F, 0x7A, 0x30, 0x51, 0x33, 0x33, 0x51, 0x30, 0x30, 0x52, 0x32, 0x33,
+    0x51, 0x30, 0x0C, 0x11, 0x42, 0x0F, 0xEB, 0x42, 0x11, 0x44, 0xFE, 0xE4,
+    0x29, 0x48, 0x2D, 0x2D, 0x48, 0x29, 0x29, 0x48, 0x2D, 0x2D, 0x48, 0x29,
+    0x22, 0x44, 0x0F, 0x42, 0x01, 0x1E, 0x0F, 0x44, 0x11, 0x00, 0x00, 0x03,
+    0x00, 0x37, 0xFF, 0xA5, 0x02, 0x0E, 0x03, 0x0E, 0x00, 0x32, 0x00, 0x36,
+    0x00, 0x3A, 0x00, 0x00, 0x45, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x2E, 0x03, 0x27, 0x2E, 0x02, 0x35, 0x34,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x1E, 0x02, 0x17, 0x1E, 0x03, 0x15, 0x14, 0x06, 0x06,
+    0x07, 0x11, 0x17, 0x11, 0x11, 0x27, 0x11, 0x33, 0x01, 0x29, 0x48, 0x82,
+    0x28, 0x0D, 0x29, 0x75, 0x48, 0x38, 0x5E, 0x38, 0x13, 0x25, 0x33, 0x41,
+    0x26, 0x45, 0x5C, 0x2D, 0x20, 0x38, 0x4D, 0x2D, 0x4E, 0x65, 0x20, 0x0F,
+    0x1D, 0x64, 0x42, 0x37, 0x55, 0x31, 0x17, 0x2F, 0x4B, 0x34, 0x34, 0x51,
+    0x39, 0x1D, 0x3E, 0x68, 0x48, 0x16, 0x16, 0x16, 0x0A, 0x36, 0x30, 0x12,
+    0x30, 0x32, 0x2B, 0x49, 0x2D, 0x1E, 0x2C, 0x22, 0x1B, 0x19, 0x0E, 0x19,
+    0x2D, 0x3E, 0x32, 0x27, 0x41, 0x2D, 0x19, 0x3C, 0x26, 0x0F, 0x22, 0x39,
+    0x27, 0x46, 0x2E, 0x1E, 0x2C, 0x23, 0x21, 0x12, 0x12, 0x22, 0x29, 0x3B,
+    0x2C, 0x33, 0x51, 0x30, 0x51, 0x01, 0xC2, 0x05, 0xFE, 0x43, 0x01, 0xC2,
+    0x04, 0x01, 0xA3, 0x00, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x01, 0xD2,
+    0x02, 0xBC, 0x00, 0x16, 0x00, 0x1A, 0x00, 0x2A, 0x00, 0x2E, 0x00, 0x00,
+    0x77, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16,
+    0x17, 0x27, 0x11, 0x33, 0x11, 0x23, 0x35, 0x17, 0x14, 0x06, 0x06, 0x07,
+    0x35, 0x21, 0x15, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x13, 0x35, 0x21, 0x15, 0xD4,
+    0x2E, 0x4E, 0x30, 0x30, 0x50, 0x31, 0x25, 0x44, 0x2E, 0x06, 0x07, 0x16,
+    0x16, 0x05, 0x2C, 0x49, 0xD2, 0x01, 0x6C, 0xC0, 0x2A, 0x45, 0x29, 0x27,
+    0x44, 0x2B, 0x2E, 0x47, 0x28, 0x28, 0x45, 0x20, 0x01, 0x07, 0x92, 0x2C,
+    0x4E, 0x35, 0x31, 0x50, 0x2F, 0x1E, 0x34, 0x1F, 0x06, 0x01, 0x36, 0xFD,
+    0xE0, 0x80, 0x12, 0x1B, 0x37, 0x26, 0x92, 0x16, 0x16, 0xA8, 0x2A, 0x46,
+    0x29, 0x2A, 0x46, 0x2A, 0x28, 0x45, 0x2D, 0x2B, 0x46, 0x28, 0x01, 0xA8,
+    0x16, 0x16, 0x00, 0x03, 0x00, 0x0F, 0xFF, 0xF6, 0x02, 0x58, 0x02, 0xC6,
+    0x00, 0x24, 0x00, 0x28, 0x00, 0x2C, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26,
+    0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x36,
+    0x37, 0x17, 0x0E, 0x02, 0x01, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15,
+    0x01, 0xB7, 0x4B, 0x7E, 0x5D, 0x32, 0x32, 0x5D, 0x7E, 0x4B, 0x1E, 0x38,
+    0x34, 0x17, 0x0F, 0x20, 0x4A, 0x28, 0x45, 0x76, 0x56, 0x30, 0x30, 0x56,
+    0x76, 0x45, 0x1B, 0x32, 0x2F, 0x15, 0x0F, 0x17, 0x34, 0x38, 0xFE, 0x3B,
+    0x01, 0xC4, 0xFE, 0x3C, 0x01, 0xC4, 0x0A, 0x34, 0x5F, 0x83, 0x4E, 0x50,
+    0x85, 0x61, 0x36, 0x09, 0x12, 0x0D, 0x12, 0x11, 0x13, 0x33, 0x5C, 0x7D,
+    0x4A, 0x49, 0x7A, 0x5A, 0x31, 0x07, 0x0E, 0x0A, 0x12, 0x0B, 0x10, 0x08,
+    0x01, 0x0D, 0x16, 0x16, 0x8D, 0x16, 0x16, 0x00, 0x00, 0x04, 0x00, 0x10,
+    0x00, 0x00, 0x01, 0xF5, 0x02, 0xBC, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x77, 0x35, 0x21, 0x15, 0x07, 0x11, 0x33, 0x11,
+    0x03, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15, 0x10, 0x01, 0x0C, 0xAE,
+    0x16, 0x0A, 0x01, 0x42, 0xFE, 0xBF, 0x01, 0x7A, 0xA1, 0x15, 0x15, 0xA1,
+    0x02, 0xBC, 0xFD, 0x44, 0x01, 0x55, 0x16, 0x16, 0x01, 0x51, 0x16, 0x16,
+    0x00, 0x02, 0x00, 0x37, 0xFF, 0x78, 0x02, 0xD2, 0x03, 0x1D, 0x00, 0x2F,
+    0x00, 0x33, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02,
+    0x15, 0x14, 0x1E, 0x02, 0x33, 0x32, 0x3E, 0x02, 0x35, 0x35, 0x17, 0x21,
+    0x35, 0x21, 0x1C, 0x02, 0x15, 0x14, 0x0E, 0x02, 0x07, 0x11, 0x33, 0x11,
+    0x01, 0x90, 0x4B, 0x7F, 0x5C, 0x33, 0x32, 0x5D, 0x7E, 0x4B, 0x39, 0x62,
+    0x52, 0x20, 0x11, 0x1D, 0x4D, 0x5D, 0x35, 0x45, 0x76, 0x56, 0x30, 0x30,
+    0x57, 0x76, 0x45, 0x48, 0x6F, 0x4D, 0x27, 0x06, 0xFE, 0xD8, 0x01, 0x39,
+    0x2C, 0x54, 0x77, 0x58, 0x16, 0x0A, 0x34, 0x5F, 0x83, 0x4E, 0x50, 0x85,
+    0x61, 0x36, 0x20, 0x3B, 0x27, 0x10, 0x26, 0x38, 0x1E, 0x33, 0x5C, 0x7D,
+    0x4A, 0x49, 0x7A, 0x5A, 0x31, 0x2D, 0x52, 0x72, 0x45, 0x13, 0x05, 0x16,
+    0x06, 0x07, 0x04, 0x02, 0x55, 0x83, 0x58, 0x2D, 0x7E, 0x03, 0xA5, 0xFC,
+    0x5B, 0x00, 0x00, 0x05, 0x00, 0x32, 0x00, 0x00, 0x02, 0x86, 0x02, 0xBC,
+    0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00,
+    0x77, 0x35, 0x01, 0x33, 0x01, 0x11, 0x33, 0x11, 0x03, 0x35, 0x33, 0x15,
+    0x01, 0x01, 0x37, 0x01, 0x01, 0x35, 0x21, 0x15, 0x96, 0x01, 0xBE, 0x20,
+    0xFE, 0x18, 0x16, 0x70, 0x64, 0x01, 0xD3, 0xFE, 0xCF, 0x11, 0x01, 0x3D,
+    0xFE, 0xC6, 0x01, 0x0B, 0xEA, 0x1F, 0x01, 0xB3, 0xFD, 0x44, 0x02, 0xBC,
+    0xFD, 0x44, 0x01, 0x90, 0x16, 0x16, 0xFE, 0x70, 0x01, 0x94, 0x10, 0xFE,
+    0x5C, 0x01, 0x90, 0x16, 0x16, 0x00, 0x00, 0x04, 0x00, 0x3B, 0xFF, 0xFB,
+    0x02, 0x32, 0x02, 0xB7, 0x00, 0x24, 0x00, 0x40, 0x00, 0x44, 0x00, 0x48,
+    0x00, 0x00, 0x77, 0x27, 0x36, 0x36, 0x35, 0x34, 0x26, 0x27, 0x2E, 0x02,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23,
+    0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06,
+    0x06, 0x05, 0x22, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x25, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15,
+    0x9D, 0x10, 0x1E, 0x24, 0x0E, 0x14, 0x0D, 0x0D, 0x03, 0x30, 0x58, 0x3C,
+    0x3C, 0x50, 0x1D, 0x12, 0x19, 0x2F, 0x32, 0x1D, 0x33, 0x4E, 0x2C, 0x16,
+    0x0B, 0x0E, 0x10, 0x0D, 0x20, 0x01, 0x06, 0x20, 0x44, 0x22, 0x0E, 0x2B,
+    0x2A, 0x0F, 0x13, 0x29, 0x2C, 0x16, 0x0B, 0x1F, 0x42, 0x28, 0x18, 0x39,
+    0x36, 0x1D, 0x38, 0x1C, 0x18, 0x33, 0x1A, 0x0E, 0x1B, 0x39, 0xFE, 0x5D,
+    0x01, 0x7A, 0xFE, 0x86, 0x01, 0x7A, 0x2F, 0x0F, 0x0C, 0x4F, 0x30, 0x1C,
+    0x3F, 0x3C, 0x29, 0x35, 0x26, 0x12, 0x39, 0x57, 0x31, 0x2B, 0x29, 0x0E,
+    0x1F, 0x21, 0x0C, 0x2C, 0x4E, 0x32, 0x24, 0x4D, 0x23, 0x29, 0x45, 0x29,
+    0x1B, 0x3A, 0x33, 0x47, 0x0F, 0x0A, 0x04, 0x0D, 0x0A, 0x09, 0x0F, 0x0A,
+    0x13, 0x0E, 0x17, 0x0D, 0x11, 0x09, 0x0D, 0x10, 0x10, 0x12, 0x10, 0x14,
+    0xF1, 0x16, 0x16, 0x75, 0x16, 0x16, 0x00, 0x03, 0x00, 0x4E, 0x00, 0x00,
+    0x02, 0x21, 0x02, 0xBC, 0x00, 0x11, 0x00, 0x15, 0x00, 0x19, 0x00, 0x00,
+    0x73, 0x22, 0x26, 0x27, 0x11, 0x33, 0x11, 0x27, 0x32, 0x3E, 0x02, 0x37,
+    0x17, 0x0E, 0x03, 0x27, 0x27, 0x25, 0x17, 0x05, 0x27, 0x25, 0x17, 0xD2,
+    0x06, 0x06, 0x03, 0x16, 0x09, 0x3D, 0x68, 0x51, 0x39, 0x0E, 0x14, 0x0B,
+    0x37, 0x55, 0x71, 0xC3, 0x08, 0x01, 0x54, 0x0D, 0xFE, 0xA7, 0x08, 0x01,
+    0x54, 0x0D, 0x02, 0x03, 0x02, 0xB7, 0xFD, 0x4C, 0x0F, 0x14, 0x2C, 0x46,
+    0x33, 0x05, 0x33, 0x4D, 0x32, 0x19, 0xBC, 0x15, 0xBF, 0x14, 0x0F, 0x15,
+    0xBF, 0x14, 0x00, 0x02, 0x00, 0x6E, 0x00, 0x00, 0x02, 0x7A, 0x03, 0x21,
+    0x00, 0x15, 0x00, 0x19, 0x00, 0x00, 0x73, 0x11, 0x3E, 0x02, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x11, 0x23, 0x11, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x11, 0x37, 0x11, 0x33, 0x11, 0x6E, 0x01, 0x42, 0x74, 0x4B,
+    0x4D, 0x78, 0x45, 0x16, 0x3E, 0x6E, 0x48, 0x46, 0x6A, 0x3C, 0xE1, 0x16,
+    0x01, 0xAF, 0x50, 0x7C, 0x47, 0x47, 0x7C, 0x50, 0xFE, 0x51, 0x01, 0xA6,
+    0x4D, 0x76, 0x43, 0x43, 0x76, 0x4D, 0xFE, 0x5A, 0xFE, 0x02, 0x23, 0xFD,
+    0xDD, 0x00, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x02, 0xEE, 0x02, 0xBC,
+    0x00, 0x0B, 0x00, 0x23, 0x00, 0x00, 0x53, 0x35, 0x33, 0x33, 0x21, 0x33,
+    0x33, 0x15, 0x23, 0x23, 0x21, 0x23, 0x03, 0x11, 0x33, 0x01, 0x23, 0x26,
+    0x26, 0x34, 0x26, 0x34, 0x35, 0x11, 0x33, 0x11, 0x23, 0x01, 0x33, 0x14,
+    0x16, 0x16, 0x14, 0x14, 0x15, 0x11, 0x28, 0x6A, 0x08, 0x01, 0xE0, 0x0A,
+    0x6A, 0x6B, 0x0A, 0xFE, 0x22, 0x09, 0x06, 0x16, 0x01, 0xD9, 0x04, 0x01,
+    0x01, 0x01, 0x16, 0x14, 0xFE, 0x1B, 0x0F, 0x01, 0x01, 0x01, 0x51, 0x16,
+    0x16, 0xFE, 0xAF, 0x02, 0xBC, 0xFD, 0x63, 0x09, 0x14, 0x1D, 0x2C, 0x3F,
+    0x2D, 0x01, 0xCB, 0xFD, 0x44, 0x02, 0xAE, 0x0A, 0x24, 0x2F, 0x33, 0x32,
+    0x16, 0xFE, 0x2A, 0x00, 0x00, 0x03, 0x00, 0x5D, 0x00, 0x00, 0x02, 0xD8,
+    0x02, 0xBC, 0x00, 0x03, 0x00, 0x10, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x35,
+    0x21, 0x15, 0x01, 0x11, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x23, 0x23, 0x11, 0x11, 0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26,
+    0x23, 0x23, 0x5D, 0x02, 0x7B, 0xFD, 0xE9, 0xFB, 0x37, 0x53, 0x2E, 0x2E,
+    0x53, 0x37, 0xE5, 0xEB, 0x2F, 0x45, 0x27, 0x27, 0x45, 0x2F, 0xEB, 0x01,
+    0xF0, 0x16, 0x16, 0xFE, 0x10, 0x02, 0xBC, 0x31, 0x57, 0x39, 0x40, 0x61,
+    0x37, 0xFE, 0xDD, 0x01, 0x39, 0x31, 0x58, 0x39, 0x32, 0x4D, 0x2C, 0x00,
+    0x00, 0x04, 0x00, 0x5D, 0x00, 0x00, 0x02, 0xD0, 0x02, 0xBC, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x24, 0x00, 0x2F, 0x00, 0x00, 0x53, 0x35, 0x33, 0x33,
+    0x21, 0x33, 0x33, 0x15, 0x23, 0x23, 0x21, 0x23, 0x07, 0x35, 0x33, 0x33,
+    0x21, 0x33, 0x33, 0x15, 0x23, 0x23, 0x21, 0x23, 0x03, 0x11, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23, 0x11, 0x11, 0x33, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x5D, 0x6A, 0x0D, 0x01,
+    0x88, 0x07, 0x6D, 0x67, 0x0A, 0xFE, 0x72, 0x0A, 0x6A, 0x69, 0x07, 0x01,
+    0x8D, 0x0C, 0x6A, 0x72, 0x09, 0xFE, 0x7B, 0x09, 0x06, 0xFB, 0x37, 0x53,
+    0x2E, 0x2E, 0x53, 0x37, 0xE5, 0xEB, 0x2F, 0x45, 0x27, 0x27, 0x45, 0x2F,
+    0xEB, 0x02, 0x24, 0x15, 0x15, 0x83, 0x15, 0x15, 0xFE, 0x5F, 0x02, 0xBC,
+    0x31, 0x57, 0x39, 0x40, 0x61, 0x37, 0xFE, 0xDD, 0x01, 0x39, 0x31, 0x58,
+    0x39, 0x32, 0x4D, 0x2C, 0x00, 0x04, 0x00, 0x5D, 0x00, 0x00, 0x02, 0x74,
+    0x02, 0xBC, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x15, 0x00, 0x22, 0x00, 0x00,
+    0x73, 0x11, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x23, 0x23,
+    0x37, 0x11, 0x27, 0x35, 0x21, 0x15, 0x25, 0x35, 0x33, 0x15, 0x37, 0x27,
+    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x37, 0xC1,
+    0xFB, 0x37, 0x53, 0x2E, 0x2E, 0x53, 0x37, 0xF3, 0x0E, 0x7A, 0x01, 0x04,
+    0xFE, 0xFC, 0x64, 0x16, 0x0F, 0xFA, 0x2F, 0x45, 0x27, 0x27, 0x45, 0x2F,
+    0xF8, 0x0D, 0x02, 0xBC, 0x31, 0x57, 0x39, 0x40, 0x61, 0x37, 0x09, 0xFE,
+    0xD4, 0x97, 0x16, 0x16, 0x8C, 0x16, 0x16, 0x0E, 0x08, 0x31, 0x58, 0x39,
+    0x32, 0x4D, 0x2C, 0x0C, 0x00, 0x03, 0x00, 0x50, 0x00, 0x00, 0x01, 0xFD,
+    0x02, 0xBC, 0x00, 0x1A, 0x00, 0x1E, 0x00, 0x22, 0x00, 0x00, 0x53, 0x35,
+    0x35, 0x33, 0x32, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x23, 0x35, 0x21,
+    0x15, 0x23, 0x27, 0x1E, 0x03, 0x15, 0x14, 0x0E, 0x02, 0x23, 0x13, 0x01,
+    0x33, 0x01, 0x03, 0x35, 0x21, 0x15, 0x7E, 0x69, 0x46, 0x55, 0x27, 0x45,
+    0x2F, 0x97, 0x01, 0xAD, 0xDD, 0x06, 0x24, 0x30, 0x1E, 0x0D, 0x1A, 0x31,
+    0x43, 0x2A, 0x90, 0xFE, 0xF9, 0x1B, 0x01, 0x07, 0x9B, 0x01, 0x0C, 0x01,
+    0x3A, 0x0E, 0x08, 0x60, 0x4B, 0x32, 0x4D, 0x2C, 0x16, 0x16, 0x0E, 0x0C,
+    0x26, 0x31, 0x38, 0x1E, 0x2B, 0x47, 0x33, 0x1C, 0xFE, 0xC6, 0x01, 0x50,
+    0xFE, 0xB0, 0x01, 0xF0, 0x16, 0x16, 0x00, 0x03, 0x00, 0x3B, 0xFF, 0xFB,
+    0x02, 0x32, 0x02, 0xB7, 0x00, 0x27, 0x00, 0x42, 0x00, 0x46, 0x00, 0x00,
+    0x77, 0x27, 0x3E, 0x02, 0x35, 0x34, 0x2E, 0x02, 0x27, 0x2E, 0x02, 0x35,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x07, 0x2E, 0x02, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x17, 0x22, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x01, 0x35, 0x21, 0x15, 0xA8, 0x14, 0x10, 0x1B, 0x10, 0x03,
+    0x08, 0x0D, 0x0A, 0x0D, 0x0C, 0x04, 0x30, 0x58, 0x3C, 0x3C, 0x50, 0x1D,
+    0x12, 0x19, 0x2F, 0x32, 0x1D, 0x33, 0x4E, 0x2C, 0x16, 0x0B, 0x0E, 0x10,
+    0x0A, 0x1B, 0xFE, 0x20, 0x43, 0x23, 0x12, 0x32, 0x29, 0x05, 0x1C, 0x41,
+    0x21, 0x0B, 0x1F, 0x42, 0x28, 0x18, 0x39, 0x36, 0x1D, 0x38, 0x1C, 0x18,
+    0x33, 0x1A, 0x0E, 0x1B, 0x39, 0xFE, 0x5D, 0x01, 0x7A, 0x2F, 0x0F, 0x09,
+    0x29, 0x39, 0x20, 0x0E, 0x1C, 0x22, 0x2D, 0x1E, 0x29, 0x35, 0x26, 0x12,
+    0x39, 0x57, 0x31, 0x2B, 0x29, 0x0E, 0x1F, 0x21, 0x0C, 0x2C, 0x4E, 0x32,
+    0x23, 0x4F, 0x22, 0x2A, 0x44, 0x29, 0x1B, 0x33, 0x33, 0x4E, 0x0F, 0x0B,
+    0x05, 0x0C, 0x09, 0x13, 0x0F, 0x13, 0x0E, 0x17, 0x0D, 0x11, 0x09, 0x0D,
+    0x10, 0x10, 0x12, 0x10, 0x14, 0x01, 0x66, 0x16, 0x16, 0x00, 0x00, 0x02,
+    0x00, 0x14, 0x00, 0x00, 0x03, 0x6D, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x2E,
+    0x00, 0x00, 0x53, 0x35, 0x33, 0x33, 0x21, 0x33, 0x33, 0x15, 0x23, 0x23,
+    0x21, 0x23, 0x13, 0x03, 0x33, 0x13, 0x1E, 0x03, 0x17, 0x23, 0x3E, 0x02,
+    0x37, 0x13, 0x33, 0x13, 0x1E, 0x02, 0x17, 0x23, 0x3E, 0x04, 0x37, 0x13,
+    0x33, 0x03, 0x23, 0x03, 0x33, 0x03, 0x14, 0x7E, 0x09, 0x02, 0x47, 0x0D,
+    0x7E, 0x82, 0x0C, 0xFD, 0xC4, 0x0B, 0x58, 0xC4, 0x18, 0x8E, 0x08, 0x0B,
+    0x0A, 0x0C, 0x09, 0x0C, 0x14, 0x1A, 0x12, 0x09, 0x78, 0x0F, 0x77, 0x04,
+    0x0D, 0x1D, 0x1C, 0x0D, 0x0A, 0x0A, 0x06, 0x06, 0x0A, 0x09, 0x8E, 0x18,
+    0xC4, 0x1A, 0xC0, 0x13, 0xC0, 0x01, 0x50, 0x15, 0x15, 0xFE, 0xB0, 0x02,
+    0xBC, 0xFE, 0x05, 0x1E, 0x29, 0x24, 0x29, 0x1E, 0x31, 0x42, 0x31, 0x17,
+    0x01, 0x3E, 0xFE, 0xC2, 0x0C, 0x21, 0x48, 0x46, 0x20, 0x24, 0x15, 0x15,
+    0x23, 0x21, 0x01, 0xFB, 0xFD, 0x44, 0x01, 0xF3, 0xFE, 0x0D, 0x00, 0x03,
+    0x00, 0x14, 0x00, 0x00, 0x02, 0x3C, 0x02, 0xBC, 0x00, 0x0B, 0x00, 0x0F,
+    0x00, 0x13, 0x00, 0x00, 0x61, 0x11, 0x17, 0x01, 0x33, 0x01, 0x23, 0x13,
+    0x33, 0x01, 0x37, 0x11, 0x27, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15,
+    0x01, 0x21, 0x08, 0xFE, 0xEB, 0x1B, 0x01, 0x02, 0x0B, 0xFB, 0x1B, 0xFE,
+    0xF2, 0x09, 0xB4, 0x01, 0x52, 0xFE, 0xAE, 0x01, 0x52, 0x01, 0x53, 0x27,
+    0x01, 0x90, 0xFE, 0x8B, 0x01, 0x75, 0xFE, 0x70, 0x27, 0xFE, 0xAD, 0x95,
+    0x16, 0x16, 0x96, 0x16, 0x16, 0x00, 0x00, 0x01, 0x00, 0x5F, 0x01, 0x12,
+    0x00, 0x95, 0x01, 0x48, 0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06,
+    0x7B, 0x08, 0x0C, 0x08, 0x08, 0x0C, 0x08, 0x07, 0x0C, 0x07, 0x07, 0x0C,
+    0x01, 0x12, 0x07, 0x0D, 0x07, 0x07, 0x0D, 0x07, 0x07, 0x0D, 0x07, 0x07,
+    0x0D, 0x07, 0x00, 0x01, 0x00, 0x3A, 0xFF, 0x95, 0x01, 0xFC, 0x02, 0xF4,
+    0x00, 0x03, 0x00, 0x00, 0x57, 0x01, 0x33, 0x01, 0x3A, 0x01, 0xA8, 0x1A,
+    0xFE, 0x58, 0x6B, 0x03, 0x5F, 0xFC, 0xA1, 0x00, 0x00, 0x02, 0x00, 0x3C,
+    0x00, 0x2A, 0x02, 0x12, 0x02, 0x0D, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x53, 0x35, 0x21, 0x15, 0x07, 0x23, 0x11, 0x33, 0x3C, 0x01, 0xD6, 0xE0,
+    0x16, 0x16, 0x01, 0x15, 0x16, 0x16, 0xEB, 0x01, 0xE3, 0x00, 0x00, 0x01,
+    0x00, 0x3C, 0x01, 0x13, 0x02, 0x1E, 0x01, 0x29, 0x00, 0x03, 0x00, 0x00,
+    0x53, 0x35, 0x21, 0x15, 0x3C, 0x01, 0xE2, 0x01, 0x13, 0x16, 0x16, 0x00,
+    0x00, 0x02, 0x00, 0x28, 0x00, 0x6C, 0x01, 0x94, 0x01, 0xCC, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x65, 0x01, 0x37, 0x01, 0x05, 0x27, 0x01, 0x17,
+    0x01, 0x83, 0xFE, 0xAE, 0x11, 0x01, 0x52, 0xFE, 0xA5, 0x11, 0x01, 0x52,
+    0x11, 0x6C, 0x01, 0x51, 0x0F, 0xFE, 0xAF, 0x0F, 0x0F, 0x01, 0x51, 0x0F,
+    0x00, 0x03, 0x00, 0x38, 0x00, 0x77, 0x02, 0x12, 0x01, 0xDB, 0x00, 0x03,
+    0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x07, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x03, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x38, 0x01, 0xDA, 0xED, 0x09, 0x0C,
+    0x07, 0x07, 0x0C, 0x09, 0x09, 0x0C, 0x07, 0x07, 0x0C, 0x09, 0x09, 0x0C,
+    0x07, 0x07, 0x0C, 0x09, 0x09, 0x0C, 0x07, 0x07, 0x0C, 0x01, 0x1E, 0x16,
+    0x16, 0xA7, 0x08, 0x0D, 0x08, 0x08, 0x0C, 0x09, 0x09, 0x0C, 0x08, 0x07,
+    0x0E, 0x08, 0x01, 0x2A, 0x08, 0x0D, 0x08, 0x08, 0x0C, 0x09, 0x09, 0x0C,
+    0x08, 0x07, 0x0E, 0x08, 0x00, 0x02, 0x00, 0x41, 0x00, 0xBE, 0x01, 0xF5,
+    0x01, 0x73, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x05, 0x35, 0x21, 0x15, 0x41, 0x01, 0xB4, 0xFE, 0x4C, 0x01, 0xB4, 0x01,
+    0x5B, 0x18, 0x18, 0x9D, 0x18, 0x18, 0x00, 0x03, 0x00, 0x41, 0x00, 0x2E,
+    0x01, 0xF5, 0x02, 0x04, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x77, 0x01, 0x33, 0x01, 0x27, 0x35, 0x21, 0x15, 0x25, 0x35, 0x21, 0x15,
+    0x8E, 0x01, 0x02, 0x1A, 0xFE, 0xFE, 0x67, 0x01, 0xB4, 0xFE, 0x4C, 0x01,
+    0xB4, 0x2E, 0x01, 0xD6, 0xFE, 0x2A, 0x91, 0x16, 0x16, 0x9E, 0x16, 0x16,
+    0x00, 0x01, 0x00, 0x38, 0x00, 0x24, 0x01, 0xA8, 0x01, 0xD6, 0x00, 0x07,
+    0x00, 0x00, 0x77, 0x27, 0x25, 0x15, 0x25, 0x37, 0x05, 0x15, 0x44, 0x0C,
+    0x01, 0x5A, 0xFE, 0xA6, 0x0C, 0x01, 0x64, 0x24, 0x14, 0xC8, 0x06, 0xC8,
+    0x14, 0xCC, 0x1A, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x24, 0x01, 0xA0,
+    0x01, 0xD6, 0x00, 0x07, 0x00, 0x00, 0x65, 0x25, 0x35, 0x25, 0x17, 0x05,
+    0x35, 0x05, 0x01, 0x94, 0xFE, 0x9C, 0x01, 0x64, 0x0C, 0xFE, 0xA6, 0x01,
+    0x5A, 0x24, 0xCC, 0x1A, 0xCC, 0x14, 0xC8, 0x06, 0xC8, 0x00, 0x00, 0x02,
+    0x00, 0x50, 0x00, 0x00, 0x02, 0x01, 0x01, 0xE2, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x77, 0x27, 0x25, 0x15, 0x25, 0x37, 0x05, 0x15, 0x01, 0x35,
+    0x21, 0x15, 0x57, 0x07, 0x01, 0xAC, 0xFE, 0x56, 0x05, 0x01, 0xAA, 0xFE,
+    0x51, 0x01, 0xAD, 0xA5, 0x15, 0x8E, 0x0A, 0x8E, 0x16, 0x8E, 0x22, 0xFE,
+    0xCE, 0x16, 0x16, 0x00, 0x00, 0x02, 0x00, 0x4B, 0x00, 0x00, 0x01, 0xFC,
+    0x01, 0xE2, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x65, 0x25, 0x35, 0x25,
+    0x17, 0x05, 0x35, 0x05, 0x05, 0x35, 0x21, 0x15, 0x01, 0xF5, 0xFE, 0x56,
+    0x01, 0xAA, 0x05, 0xFE, 0x56, 0x01, 0xAC, 0xFE, 0x51, 0x01, 0xAD, 0xA5,
+    0x8D, 0x22, 0x8E, 0x16, 0x8E, 0x0A, 0x8E, 0xBA, 0x16, 0x16, 0x00, 0x03,
+    0x00, 0x41, 0x00, 0x44, 0x02, 0x1D, 0x02, 0x0D, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x01, 0x35, 0x21, 0x15,
+    0x27, 0x11, 0x33, 0x11, 0x41, 0x01, 0xDC, 0xFE, 0x24, 0x01, 0xDC, 0xFA,
+    0x17, 0x01, 0x5A, 0x16, 0x16, 0xFE, 0xEA, 0x16, 0x16, 0x73, 0x01, 0x56,
+    0xFE, 0xAA, 0x00, 0x02, 0x00, 0x64, 0x00, 0x86, 0x01, 0xBF, 0x01, 0x9F,
+    0x00, 0x1F, 0x00, 0x3F, 0x00, 0x00, 0x41, 0x22, 0x26, 0x26, 0x27, 0x2E,
+    0x02, 0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x16, 0x17, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x35, 0x17, 0x14, 0x06, 0x06,
+    0x07, 0x22, 0x26, 0x26, 0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x27,
+    0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x1E, 0x02, 0x33, 0x32,
+    0x36, 0x35, 0x17, 0x14, 0x06, 0x06, 0x01, 0x7F, 0x08, 0x1A, 0x31, 0x2C,
+    0x11, 0x1F, 0x1A, 0x0A, 0x1D, 0x15, 0x16, 0x0F, 0x1E, 0x16, 0x0A, 0x1E,
+    0x31, 0x25, 0x11, 0x22, 0x1C, 0x06, 0x1B, 0x14, 0x16, 0x0F, 0x1D, 0x14,
+    0x08, 0x1D, 0x31, 0x29, 0x11, 0x1F, 0x1A, 0x0A, 0x1D, 0x15, 0x16, 0x0F,
+    0x1E, 0x16, 0x0A, 0x1E, 0x31, 0x25, 0x11, 0x22, 0x1C, 0x06, 0x1B, 0x14,
+    0x16, 0x0F, 0x1D, 0x01, 0x53, 0x03, 0x0A, 0x09, 0x04, 0x06, 0x04, 0x20,
+    0x17, 0x02, 0x18, 0x21, 0x11, 0x05, 0x09, 0x08, 0x03, 0x07, 0x04, 0x20,
+    0x17, 0x02, 0x17, 0x22, 0x11, 0xBA, 0x04, 0x0A, 0x08, 0x04, 0x06, 0x04,
+    0x20, 0x17, 0x02, 0x18, 0x21, 0x11, 0x05, 0x09, 0x08, 0x03, 0x07, 0x04,
+    0x20, 0x17, 0x02, 0x17, 0x22, 0x11, 0x00, 0x01, 0x00, 0x4C, 0x00, 0xFB,
+    0x01, 0xB0, 0x01, 0x53, 0x00, 0x1F, 0x00, 0x00, 0x65, 0x22, 0x26, 0x26,
+    0x27, 0x2E, 0x02, 0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x33, 0x32,
+    0x1E, 0x02, 0x17, 0x1E, 0x02, 0x33, 0x32, 0x36, 0x35, 0x33, 0x14, 0x06,
+    0x06, 0x01, 0x67, 0x15, 0x2D, 0x26, 0x0C, 0x0C, 0x20, 0x21, 0x10, 0x15,
+    0x1F, 0x16, 0x2C, 0x1D, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0x09, 0x1C, 0x21,
+    0x0F, 0x14, 0x20, 0x16, 0x14, 0x22, 0xFB, 0x0E, 0x11, 0x06, 0x06, 0x0E,
+    0x09, 0x1D, 0x1F, 0x26, 0x2C, 0x07, 0x0D, 0x0E, 0x06, 0x04, 0x0C, 0x0A,
+    0x1B, 0x21, 0x1A, 0x25, 0x13, 0x00, 0x00, 0x01, 0x00, 0x41, 0x00, 0x75,
+    0x02, 0x5D, 0x01, 0x85, 0x00, 0x06, 0x00, 0x00, 0x65, 0x11, 0x17, 0x21,
+    0x35, 0x21, 0x11, 0x02, 0x47, 0x0B, 0xFD, 0xEF, 0x02, 0x1C, 0x75, 0x01,
+    0x06, 0x0C, 0x16, 0xFE, 0xF0, 0x00, 0x00, 0x01, 0x00, 0x32, 0x01, 0x70,
+    0x02, 0x16, 0x02, 0xD7, 0x00, 0x07, 0x00, 0x00, 0x53, 0x13, 0x33, 0x13,
+    0x23, 0x03, 0x33, 0x03, 0x32, 0xE7, 0x16, 0xE7, 0x1B, 0xDB, 0x08, 0xDB,
+    0x01, 0x70, 0x01, 0x67, 0xFE, 0x99, 0x01, 0x54, 0xFE, 0xAC, 0x00, 0x02,
+    0x00, 0x23, 0x00, 0x2F, 0x03, 0x40, 0x01, 0xB5, 0x00, 0x1E, 0x00, 0x3E,
+    0x00, 0x00, 0x65, 0x22, 0x26, 0x27, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x15, 0x14, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x37, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x21, 0x22, 0x26, 0x26,
+    0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x17, 0x17, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x07, 0x0E, 0x02, 0x02, 0x98, 0x33, 0x50, 0x2F, 0x86, 0x24, 0x46, 0x29,
+    0x29, 0x42, 0x28, 0x28, 0x42, 0x29, 0x29, 0x48, 0x22, 0x92, 0x1C, 0x34,
+    0x35, 0x1F, 0x32, 0x4C, 0x2C, 0x2B, 0x4B, 0xFE, 0x01, 0x32, 0x4B, 0x2B,
+    0x2B, 0x4B, 0x32, 0x22, 0x39, 0x38, 0x1F, 0x86, 0x22, 0x48, 0x29, 0x29,
+    0x42, 0x28, 0x28, 0x46, 0x2C, 0x21, 0x42, 0x1A, 0x95, 0x1F, 0x38, 0x39,
+    0x2F, 0x2C, 0x3E, 0xB2, 0x30, 0x24, 0x2A, 0x4E, 0x35, 0x35, 0x4E, 0x2A,
+    0x27, 0x2D, 0xC1, 0x25, 0x27, 0x0F, 0x30, 0x58, 0x3B, 0x3C, 0x57, 0x30,
+    0x30, 0x57, 0x3C, 0x3C, 0x58, 0x2F, 0x13, 0x2E, 0x29, 0xB2, 0x2D, 0x27,
+    0x2A, 0x4E, 0x35, 0x35, 0x4D, 0x2B, 0x1D, 0x23, 0xC6, 0x2A, 0x2E, 0x12,
+    0x00, 0x03, 0x00, 0x28, 0xFF, 0xED, 0x02, 0x3F, 0x02, 0x21, 0x00, 0x03,
+    0x00, 0x13, 0x00, 0x23, 0x00, 0x00, 0x57, 0x27, 0x01, 0x17, 0x03, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x52, 0x11, 0x01, 0xD4, 0x12, 0xF3,
+    0x4F, 0x79, 0x44, 0x44, 0x79, 0x4F, 0x4F, 0x79, 0x43, 0x43, 0x79, 0x4F,
+    0x47, 0x6E, 0x40, 0x40, 0x6E, 0x47, 0x47, 0x6F, 0x40, 0x40, 0x6F, 0x13,
+    0x0E, 0x02, 0x26, 0x0F, 0xFD, 0xE4, 0x46, 0x7C, 0x4F, 0x4E, 0x79, 0x44,
+    0x44, 0x79, 0x4E, 0x4F, 0x7C, 0x46, 0x16, 0x40, 0x72, 0x49, 0x47, 0x6E,
+    0x40, 0x40, 0x6E, 0x47, 0x49, 0x72, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xFF, 0x81, 0x02, 0x31, 0x02, 0xEC, 0x00, 0x20, 0x00, 0x00, 0x57, 0x22,
+    0x26, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x36, 0x37, 0x13,
+    0x3E, 0x02, 0x33, 0x32, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06,
+    0x06, 0x07, 0x03, 0x0E, 0x02, 0x6B, 0x11, 0x25, 0x24, 0x11, 0x0E, 0x1E,
+    0x28, 0x19, 0x1D, 0x2C, 0x1F, 0x0A, 0x56, 0x09, 0x20, 0x3B, 0x31, 0x22,
+    0x32, 0x13, 0x0D, 0x13, 0x2D, 0x1B, 0x21, 0x2F, 0x21, 0x0A, 0x56, 0x0C,
+    0x24, 0x37, 0x7F, 0x0B, 0x15, 0x0E, 0x14, 0x1A, 0x12, 0x29, 0x4D, 0x37,
+    0x01, 0xE2, 0x31, 0x5A, 0x3B, 0x19, 0x0D, 0x16, 0x0E, 0x15, 0x27, 0x4D,
+    0x38, 0xFE, 0x20, 0x42, 0x58, 0x2C, 0x00, 0x01, 0x00, 0x19, 0x00, 0x00,
+    0x02, 0x8B, 0x02, 0xC6, 0x00, 0x36, 0x00, 0x00, 0x73, 0x35, 0x33, 0x07,
+    0x2E, 0x02, 0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x1E, 0x02, 0x15, 0x14,
+    0x06, 0x06, 0x07, 0x27, 0x33, 0x15, 0x23, 0x35, 0x3E, 0x02, 0x37, 0x3E,
+    0x02, 0x35, 0x34, 0x2E, 0x02, 0x23, 0x22, 0x0E, 0x02, 0x15, 0x14, 0x16,
+    0x16, 0x17, 0x1E, 0x03, 0x17, 0x15, 0x27, 0xD4, 0x01, 0x44, 0x65, 0x38,
+    0x2F, 0x55, 0x72, 0x43, 0x43, 0x72, 0x55, 0x2F, 0x38, 0x65, 0x44, 0x01,
+    0xD4, 0xE8, 0x17, 0x3C, 0x3D, 0x19, 0x10, 0x19, 0x0D, 0x29, 0x4C, 0x6B,
+    0x42, 0x42, 0x6B, 0x4C, 0x29, 0x0D, 0x19, 0x10, 0x13, 0x2C, 0x2E, 0x2B,
+    0x11, 0x16, 0x0C, 0x37, 0x80, 0x8C, 0x47, 0x41, 0x6F, 0x53, 0x2F, 0x2F,
+    0x53, 0x6F, 0x41, 0x47, 0x8C, 0x80, 0x37, 0x0C, 0x16, 0x16, 0x0F, 0x3A,
+    0x4D, 0x2C, 0x1E, 0x3F, 0x3F, 0x1F, 0x36, 0x66, 0x52, 0x2F, 0x2F, 0x52,
+    0x66, 0x36, 0x1E, 0x3F, 0x3F, 0x1E, 0x21, 0x3D, 0x33, 0x27, 0x0B, 0x16,
+    0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x02, 0xBB, 0x02, 0xD2, 0x00, 0x02,
+    0x00, 0x08, 0x00, 0x00, 0x73, 0x01, 0x01, 0x25, 0x27, 0x21, 0x07, 0x01,
+    0x33, 0x08, 0x01, 0x57, 0x01, 0x5C, 0xFD, 0x6B, 0x08, 0x02, 0x83, 0x06,
+    0xFE, 0xC0, 0x08, 0x02, 0xD2, 0xFD, 0x2E, 0x09, 0x0D, 0x0C, 0x02, 0x93,
+    0x00, 0x03, 0x00, 0x1C, 0xFF, 0x38, 0x02, 0xA8, 0x02, 0xBC, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x45, 0x11, 0x33, 0x11, 0x21, 0x11,
+    0x33, 0x11, 0x03, 0x35, 0x21, 0x15, 0x02, 0x2F, 0x16, 0xFE, 0x3A, 0x16,
+    0x79, 0x02, 0x8C, 0xC8, 0x03, 0x7D, 0xFC, 0x83, 0x03, 0x7D, 0xFC, 0x83,
+    0x03, 0x6E, 0x16, 0x16, 0x00, 0x01, 0x00, 0x3B, 0x00, 0x00, 0x01, 0xE9,
+    0x02, 0xA4, 0x00, 0x0F, 0x00, 0x00, 0x73, 0x27, 0x01, 0x17, 0x01, 0x37,
+    0x21, 0x15, 0x21, 0x27, 0x01, 0x15, 0x01, 0x35, 0x21, 0x15, 0x40, 0x05,
+    0x01, 0x24, 0x01, 0xFE, 0xE5, 0x03, 0x01, 0x97, 0xFE, 0x83, 0x02, 0x01,
+    0x13, 0xFE, 0xE8, 0x01, 0x8E, 0x0F, 0x01, 0x4C, 0x11, 0x01, 0x4D, 0x0D,
+    0x16, 0x0D, 0xFE, 0xBF, 0x0F, 0xFE, 0xC5, 0x06, 0x16, 0x00, 0x00, 0x01,
+    0x00, 0x2F, 0xFF, 0x90, 0x02, 0x98, 0x02, 0xBC, 0x00, 0x0A, 0x00, 0x00,
+    0x57, 0x03, 0x33, 0x13, 0x23, 0x01, 0x33, 0x15, 0x23, 0x37, 0x01, 0xD8,
+    0xA9, 0x1A, 0x97, 0x0F, 0x01, 0x0F, 0xB8, 0xB8, 0x17, 0xFE, 0xE4, 0x70,
+    0x01, 0xA5, 0xFE, 0x88, 0x02, 0xFF, 0x16, 0x0D, 0xFC, 0xDD, 0x00, 0x01,
+    0x00, 0x49, 0xFF, 0x63, 0x01, 0xD5, 0x02, 0x0D, 0x00, 0x1C, 0x00, 0x00,
+    0x57, 0x11, 0x33, 0x11, 0x14, 0x16, 0x16, 0x33, 0x32, 0x3E, 0x02, 0x35,
+    0x11, 0x33, 0x11, 0x23, 0x27, 0x33, 0x0E, 0x02, 0x23, 0x22, 0x26, 0x26,
+    0x27, 0x17, 0x11, 0x49, 0x16, 0x24, 0x4A, 0x3A, 0x27, 0x43, 0x32, 0x1C,
+    0x16, 0x14, 0x06, 0x14, 0x14, 0x3E, 0x4C, 0x2A, 0x2F, 0x4F, 0x33, 0x08,
+    0x11, 0x9D, 0x02, 0xAA, 0xFE, 0xA1, 0x32, 0x49, 0x27, 0x1E, 0x32, 0x41,
+    0x23, 0x01, 0x4D, 0xFD, 0xF3, 0x8C, 0x38, 0x41, 0x1D, 0x1C, 0x45, 0x3E,
+    0x2E, 0xFE, 0xFC, 0x00, 0x00, 0x02, 0x00, 0x28, 0xFF, 0xF6, 0x02, 0x18,
+    0x02, 0xE2, 0x00, 0x20, 0x00, 0x30, 0x00, 0x00, 0x45, 0x22, 0x2E, 0x02,
+    0x35, 0x34, 0x3E, 0x02, 0x33, 0x32, 0x16, 0x16, 0x17, 0x23, 0x34, 0x2E,
+    0x03, 0x27, 0x37, 0x16, 0x16, 0x17, 0x16, 0x16, 0x15, 0x0E, 0x03, 0x27,
+    0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15,
+    0x14, 0x16, 0x16, 0x01, 0x20, 0x37, 0x5B, 0x42, 0x24, 0x25, 0x44, 0x5C,
+    0x37, 0x3A, 0x5F, 0x3C, 0x05, 0x07, 0x1D, 0x36, 0x4B, 0x5B, 0x34, 0x09,
+    0x3A, 0x6C, 0x33, 0x33, 0x39, 0x01, 0x25, 0x43, 0x59, 0x36, 0x42, 0x66,
+    0x39, 0x39, 0x66, 0x42, 0x42, 0x65, 0x3A, 0x3A, 0x65, 0x0A, 0x28, 0x48,
+    0x65, 0x3C, 0x3C, 0x61, 0x45, 0x26, 0x2F, 0x49, 0x27, 0x35, 0x61, 0x53,
+    0x42, 0x2C, 0x08, 0x13, 0x09, 0x35, 0x36, 0x35, 0xAC, 0x7E, 0x3C, 0x67,
+    0x4C, 0x2A, 0x16, 0x40, 0x72, 0x49, 0x47, 0x6D, 0x3E, 0x3E, 0x6D, 0x47,
+    0x49, 0x72, 0x40, 0x00, 0x00, 0x05, 0x00, 0x28, 0xFF, 0xF7, 0x03, 0x17,
+    0x02, 0xC5, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x43,
+    0x00, 0x00, 0x73, 0x01, 0x33, 0x01, 0x03, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x01, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0xAC, 0x01,
+    0xD1, 0x1B, 0xFE, 0x2F, 0x06, 0x2D, 0x45, 0x27, 0x27, 0x45, 0x2D, 0x2D,
+    0x45, 0x28, 0x28, 0x46, 0x2C, 0x25, 0x3C, 0x23, 0x22, 0x3B, 0x27, 0x26,
+    0x3B, 0x22, 0x22, 0x3B, 0x01, 0xE2, 0x2D, 0x45, 0x27, 0x27, 0x45, 0x2D,
+    0x2D, 0x45, 0x28, 0x28, 0x46, 0x2C, 0x25, 0x3C, 0x23, 0x22, 0x3B, 0x27,
+    0x26, 0x3B, 0x22, 0x22, 0x3B, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x49, 0x31,
+    0x55, 0x37, 0x37, 0x57, 0x31, 0x31, 0x57, 0x37, 0x35, 0x56, 0x32, 0x15,
+    0x2A, 0x4C, 0x32, 0x33, 0x4C, 0x2B, 0x2B, 0x4D, 0x32, 0x32, 0x4C, 0x2A,
+    0xFE, 0x99, 0x31, 0x55, 0x37, 0x37, 0x57, 0x31, 0x31, 0x57, 0x37, 0x35,
+    0x56, 0x32, 0x15, 0x2A, 0x4C, 0x32, 0x33, 0x4C, 0x2B, 0x2B, 0x4D, 0x32,
+    0x32, 0x4C, 0x2A, 0x00, 0x00, 0x07, 0x00, 0x28, 0xFF, 0xF7, 0x04, 0x7A,
+    0x02, 0xC5, 0x00, 0x03, 0x00, 0x13, 0x00, 0x23, 0x00, 0x33, 0x00, 0x43,
+    0x00, 0x53, 0x00, 0x63, 0x00, 0x00, 0x73, 0x01, 0x33, 0x01, 0x03, 0x22,
+    0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14,
+    0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0x01, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32,
+    0x36, 0x36, 0x35, 0x34, 0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x16, 0x05, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36, 0x33, 0x32,
+    0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x36, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x22, 0x06, 0x06, 0x15, 0x14, 0x16, 0x16, 0xAC, 0x01,
+    0xD1, 0x1B, 0xFE, 0x2F, 0x06, 0x2D, 0x45, 0x27, 0x27, 0x45, 0x2D, 0x2D,
+    0x45, 0x28, 0x28, 0x46, 0x2C, 0x25, 0x3C, 0x23, 0x22, 0x3B, 0x27, 0x26,
+    0x3B, 0x22, 0x22, 0x3B, 0x01, 0xE2, 0x2D, 0x45, 0x27, 0x27, 0x45, 0x2D,
+    0x2D, 0x45, 0x28, 0x28, 0x46, 0x2C, 0x25, 0x3C, 0x23, 0x22, 0x3B, 0x27,
+    0x26, 0x3B, 0x22, 0x22, 0x3B, 0x01, 0x8C, 0x2D, 0x45, 0x27, 0x27, 0x45,
+    0x2D, 0x2D, 0x44, 0x26, 0x27, 0x44, 0x2C, 0x26, 0x3A, 0x20, 0x1F, 0x3A,
+    0x27, 0x27, 0x3B, 0x20, 0x21, 0x3A, 0x02, 0xBC, 0xFD, 0x44, 0x01, 0x49,
+    0x31, 0x55, 0x37, 0x37, 0x57, 0x31, 0x31, 0x57, 0x37, 0x35, 0x56, 0x32,
+    0x15, 0x2A, 0x4C, 0x33, 0x32, 0x4C, 0x2B, 0x2B, 0x4D, 0x32, 0x32, 0x4C,
+    0x2A, 0xFE, 0x99, 0x31, 0x55, 0x37, 0x37, 0x57, 0x31, 0x31, 0x57, 0x37,
+    0x35, 0x56, 0x32, 0x15, 0x2A, 0x4C, 0x33, 0x32, 0x4C, 0x2B, 0x2B, 0x4D,
+    0x32, 0x32, 0x4C, 0x2A, 0x15, 0x30, 0x53, 0x35, 0x36, 0x54, 0x2F, 0x2F,
+    0x54, 0x36, 0x35, 0x53, 0x30, 0x16, 0x2A, 0x49, 0x2F, 0x31, 0x49, 0x29,
+    0x28, 0x4A, 0x31, 0x31, 0x49, 0x28, 0x00, 0x02, 0x00, 0x24, 0xFF, 0xDB,
+    0x02, 0x30, 0x02, 0xB1, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x45, 0x09,
+    0x03, 0x13, 0x03, 0x03, 0x01, 0x2B, 0xFE, 0xF9, 0x01, 0x07, 0x01, 0x05,
+    0xFE, 0xFB, 0xE7, 0xE7, 0xE9, 0x25, 0x01, 0x6D, 0x01, 0x69, 0xFE, 0x97,
+    0xFE, 0xBC, 0x01, 0x44, 0x01, 0x41, 0xFE, 0xBF, 0x00, 0x02, 0x00, 0x76,
+    0x02, 0x65, 0x01, 0x7E, 0x03, 0x5F, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0xFA, 0x33, 0x45, 0x0C, 0x16, 0x0A,
+    0x3C, 0x28, 0x27, 0x3E, 0x09, 0x16, 0x0B, 0x47, 0x34, 0x0F, 0x4F, 0x17,
+    0x02, 0x65, 0x36, 0x2E, 0x02, 0x26, 0x2B, 0x2B, 0x26, 0x02, 0x2E, 0x36,
+    0x80, 0x0B, 0x6F, 0x11, 0x00, 0x02, 0x00, 0x76, 0x02, 0x65, 0x01, 0x7E,
+    0x03, 0x5E, 0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x27,
+    0x37, 0x17, 0xFA, 0x33, 0x45, 0x0C, 0x16, 0x0A, 0x3C, 0x28, 0x27, 0x3E,
+    0x09, 0x16, 0x0B, 0x47, 0x25, 0x58, 0x17, 0x4F, 0x02, 0x65, 0x36, 0x2E,
+    0x02, 0x26, 0x2B, 0x2B, 0x26, 0x02, 0x2E, 0x36, 0x80, 0x68, 0x11, 0x6F,
+    0x00, 0x02, 0x00, 0x76, 0x02, 0x65, 0x01, 0x7E, 0x03, 0x72, 0x00, 0x0D,
+    0x00, 0x2D, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0xFA, 0x33, 0x45, 0x0C, 0x16, 0x0A, 0x3C, 0x28, 0x27, 0x3E,
+    0x09, 0x16, 0x0B, 0x47, 0x39, 0x02, 0x04, 0x16, 0x0D, 0x0E, 0x16, 0x23,
+    0x1A, 0x10, 0x22, 0x13, 0x07, 0x11, 0x25, 0x15, 0x27, 0x30, 0x1C, 0x10,
+    0x0B, 0x11, 0x03, 0x01, 0x02, 0x65, 0x36, 0x2E, 0x02, 0x26, 0x2B, 0x2B,
+    0x26, 0x02, 0x2E, 0x36, 0x73, 0x05, 0x08, 0x06, 0x0E, 0x12, 0x08, 0x09,
+    0x13, 0x0E, 0x10, 0x0F, 0x05, 0x07, 0x14, 0x07, 0x07, 0x1D, 0x18, 0x15,
+    0x19, 0x09, 0x06, 0x0E, 0x08, 0x04, 0x06, 0x03, 0x00, 0x02, 0x00, 0x75,
+    0x02, 0x65, 0x01, 0x7F, 0x03, 0x72, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x00,
+    0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x0E, 0x02, 0xF9, 0x33, 0x45, 0x0C, 0x16, 0x0A, 0x3C, 0x28,
+    0x27, 0x3E, 0x09, 0x16, 0x0B, 0x47, 0x13, 0x13, 0x25, 0x10, 0x0F, 0x1C,
+    0x10, 0x0F, 0x17, 0x05, 0x17, 0x05, 0x24, 0x19, 0x14, 0x1D, 0x0F, 0x0E,
+    0x21, 0x13, 0x0F, 0x19, 0x07, 0x13, 0x04, 0x13, 0x1B, 0x02, 0x65, 0x3B,
+    0x29, 0x02, 0x21, 0x30, 0x30, 0x21, 0x02, 0x29, 0x3B, 0xC4, 0x11, 0x0A,
+    0x09, 0x0F, 0x12, 0x15, 0x04, 0x1A, 0x1F, 0x10, 0x0A, 0x09, 0x10, 0x10,
+    0x19, 0x04, 0x13, 0x1B, 0x0D, 0x00, 0x00, 0x02, 0x00, 0x59, 0x02, 0x6D,
+    0x01, 0x9C, 0x03, 0x4F, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x27, 0x37, 0x17, 0x65, 0x0C,
+    0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F, 0x6B, 0x0F, 0x4F, 0x17, 0x02, 0x6D,
+    0x0D, 0x5C, 0x5C, 0x0D, 0x5C, 0x0C, 0x0B, 0x6F, 0x11, 0x00, 0x00, 0x02,
+    0x00, 0x77, 0x02, 0x6D, 0x01, 0x7D, 0x03, 0x4D, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x27,
+    0x37, 0x17, 0x83, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F, 0x77, 0x58,
+    0x17, 0x4F, 0x02, 0x6D, 0x0D, 0x5C, 0x5C, 0x0D, 0x5C, 0x0B, 0x68, 0x11,
+    0x6F, 0x00, 0x00, 0x02, 0x00, 0x55, 0x02, 0x6D, 0x01, 0xA0, 0x03, 0x72,
+    0x00, 0x07, 0x00, 0x27, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07,
+    0x27, 0x33, 0x37, 0x26, 0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0x61, 0x0C,
+    0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F, 0x70, 0x02, 0x04, 0x16, 0x0D, 0x0E,
+    0x16, 0x23, 0x1A, 0x10, 0x22, 0x13, 0x07, 0x11, 0x25, 0x15, 0x27, 0x30,
+    0x1C, 0x10, 0x0B, 0x11, 0x03, 0x01, 0x02, 0x6D, 0x0D, 0x5C, 0x5C, 0x0D,
+    0x5C, 0x0F, 0x05, 0x08, 0x06, 0x0E, 0x12, 0x08, 0x09, 0x13, 0x0E, 0x10,
+    0x0F, 0x05, 0x07, 0x14, 0x07, 0x07, 0x1D, 0x18, 0x15, 0x19, 0x09, 0x06,
+    0x0E, 0x08, 0x04, 0x06, 0x03, 0x00, 0x00, 0x02, 0x00, 0x77, 0x02, 0x6D,
+    0x01, 0x7D, 0x03, 0x68, 0x00, 0x07, 0x00, 0x22, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x8A, 0x0C, 0x6B, 0x1C,
+    0x6B, 0x0C, 0x74, 0x0F, 0x3D, 0x13, 0x25, 0x10, 0x0F, 0x1C, 0x10, 0x0F,
+    0x17, 0x05, 0x17, 0x05, 0x24, 0x19, 0x14, 0x1D, 0x0F, 0x0E, 0x21, 0x13,
+    0x0F, 0x19, 0x07, 0x13, 0x04, 0x13, 0x1B, 0x02, 0x6D, 0x0D, 0x5C, 0x5C,
+    0x0D, 0x5C, 0x56, 0x11, 0x0A, 0x09, 0x0F, 0x12, 0x15, 0x04, 0x1A, 0x1F,
+    0x10, 0x0A, 0x09, 0x10, 0x10, 0x19, 0x04, 0x13, 0x1B, 0x0D, 0x00, 0x02,
+    0x00, 0x93, 0x02, 0x97, 0x01, 0x61, 0x02, 0xD1, 0x00, 0x0B, 0x00, 0x17,
+    0x00, 0x00, 0x41, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x01, 0x45, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0xA4,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x02, 0x97, 0x10, 0x0D, 0x0C,
+    0x11, 0x10, 0x0D, 0x0D, 0x10, 0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D, 0x0D,
+    0x10, 0x00, 0x00, 0x03, 0x00, 0x93, 0x02, 0x85, 0x01, 0x61, 0x03, 0x4F,
+    0x00, 0x0B, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x33, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x27, 0x27, 0x37, 0x17,
+    0xAF, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x88, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0D, 0x0F, 0x0E, 0x5A, 0x0F, 0x4F, 0x17, 0x02, 0x85, 0x10, 0x0D,
+    0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10, 0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D,
+    0x0D, 0x10, 0x50, 0x0B, 0x6F, 0x11, 0xFF, 0xFF, 0x00, 0x73, 0x02, 0x97,
+    0x01, 0x81, 0x03, 0x52, 0x06, 0x26, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x07,
+    0x03, 0x05, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x01, 0x00, 0xDE, 0x02, 0x97,
+    0x01, 0x16, 0x02, 0xD1, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0xFA, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0D, 0x0F, 0x0E, 0x02, 0x97, 0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D,
+    0x0D, 0x10, 0xFF, 0xFF, 0x00, 0x73, 0x02, 0x97, 0x01, 0x81, 0x03, 0x52,
+    0x06, 0x26, 0x02, 0xF5, 0x00, 0x00, 0x00, 0x07, 0x03, 0x05, 0x00, 0x00,
+    0x00, 0xA5, 0x00, 0x01, 0x00, 0xAD, 0x02, 0x63, 0x01, 0x47, 0x02, 0xE0,
+    0x00, 0x03, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x01, 0x3D, 0x90, 0x0E,
+    0x8C, 0x02, 0x63, 0x68, 0x15, 0x6E, 0x00, 0x01, 0x00, 0xAD, 0x02, 0x63,
+    0x01, 0x47, 0x02, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17,
+    0xB7, 0x0A, 0x8C, 0x0E, 0x02, 0x63, 0x0F, 0x6E, 0x15, 0x00, 0x00, 0x02,
+    0x00, 0x99, 0x02, 0x7F, 0x01, 0x5C, 0x02, 0xF9, 0x00, 0x03, 0x00, 0x0F,
+    0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x07, 0x22, 0x26, 0x35, 0x34, 0x36,
+    0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x05, 0x0F, 0x4F, 0x17, 0xA7,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x02, 0x7F, 0x0B, 0x6F, 0x11,
+    0x63, 0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10, 0x00, 0x00, 0x02,
+    0x00, 0x71, 0x02, 0x63, 0x01, 0x83, 0x02, 0xE0, 0x00, 0x03, 0x00, 0x07,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x05, 0x27, 0x37, 0x17, 0xF3, 0x0A,
+    0x8C, 0x0E, 0xFE, 0xF8, 0x0A, 0x8C, 0x0E, 0x02, 0x63, 0x0F, 0x6E, 0x15,
+    0x68, 0x0F, 0x6E, 0x15, 0x00, 0x01, 0x00, 0xDB, 0x02, 0x1A, 0x01, 0x1A,
+    0x02, 0xA2, 0x00, 0x15, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02, 0x35, 0x34,
+    0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14,
+    0x0E, 0x02, 0xEB, 0x0D, 0x07, 0x0F, 0x0C, 0x06, 0x0B, 0x0A, 0x0A, 0x0E,
+    0x0D, 0x11, 0x13, 0x04, 0x0A, 0x13, 0x02, 0x1A, 0x0D, 0x06, 0x0F, 0x11,
+    0x09, 0x08, 0x0A, 0x05, 0x05, 0x0E, 0x0A, 0x09, 0x0F, 0x19, 0x15, 0x0D,
+    0x17, 0x15, 0x15, 0x00, 0x00, 0x01, 0x00, 0x81, 0x02, 0x6D, 0x01, 0x73,
+    0x02, 0xD6, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07,
+    0x27, 0x33, 0x8D, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F, 0x02, 0x6D,
+    0x0D, 0x5C, 0x5C, 0x0D, 0x5C, 0x00, 0x00, 0x01, 0x00, 0x81, 0x02, 0x6D,
+    0x01, 0x73, 0x02, 0xD6, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17,
+    0x23, 0x37, 0x17, 0x07, 0xEC, 0x6B, 0x0C, 0x75, 0x0F, 0x74, 0x0C, 0x6B,
+    0x02, 0x6D, 0x5C, 0x0D, 0x5C, 0x5C, 0x0D, 0x5C, 0x00, 0x02, 0x00, 0x81,
+    0x02, 0x6D, 0x01, 0x73, 0x03, 0x1E, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x17, 0x23, 0x37, 0x17, 0x07, 0x27, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0xEC, 0x6B, 0x0C, 0x75,
+    0x0F, 0x74, 0x0C, 0x6B, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E,
+    0x02, 0x6D, 0x5C, 0x0D, 0x5C, 0x5C, 0x0D, 0x5C, 0x77, 0x10, 0x0D, 0x0C,
+    0x11, 0x10, 0x0D, 0x0D, 0x10, 0x00, 0x00, 0x01, 0x00, 0x76, 0x02, 0x65,
+    0x01, 0x7E, 0x02, 0xDF, 0x00, 0x0D, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0xFA, 0x33,
+    0x45, 0x0C, 0x16, 0x0A, 0x3C, 0x28, 0x27, 0x3E, 0x09, 0x16, 0x0B, 0x47,
+    0x02, 0x65, 0x40, 0x38, 0x02, 0x30, 0x35, 0x35, 0x30, 0x02, 0x38, 0x40,
+    0x00, 0x02, 0x00, 0x9E, 0x02, 0x52, 0x01, 0x56, 0x03, 0x04, 0x00, 0x0F,
+    0x00, 0x1B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xFA, 0x18, 0x2A, 0x1A,
+    0x19, 0x2A, 0x19, 0x1A, 0x29, 0x19, 0x1A, 0x29, 0x19, 0x1E, 0x29, 0x29,
+    0x1E, 0x1F, 0x28, 0x2A, 0x02, 0x52, 0x18, 0x28, 0x18, 0x19, 0x28, 0x19,
+    0x19, 0x28, 0x19, 0x17, 0x29, 0x18, 0x14, 0x29, 0x1B, 0x20, 0x26, 0x27,
+    0x1F, 0x1B, 0x29, 0x00, 0x00, 0x01, 0x00, 0x7C, 0x02, 0x79, 0x01, 0x78,
+    0x02, 0xCA, 0x00, 0x1A, 0x00, 0x00, 0x41, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x14, 0x06, 0x06, 0x01, 0x3D, 0x17,
+    0x26, 0x11, 0x18, 0x15, 0x08, 0x0F, 0x1B, 0x14, 0x26, 0x18, 0x15, 0x26,
+    0x12, 0x07, 0x20, 0x0E, 0x0F, 0x18, 0x01, 0x14, 0x11, 0x1B, 0x02, 0x79,
+    0x18, 0x0C, 0x11, 0x08, 0x1D, 0x1A, 0x03, 0x1E, 0x2A, 0x17, 0x0D, 0x05,
+    0x14, 0x19, 0x1E, 0x03, 0x16, 0x20, 0x12, 0x00, 0x00, 0x03, 0x00, 0x7C,
+    0x02, 0x79, 0x01, 0x78, 0x03, 0x4E, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x32,
+    0x00, 0x00, 0x41, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x17, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x15,
+    0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x14, 0x06, 0x06, 0x01, 0x45, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D,
+    0x0F, 0x0E, 0xA4, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x80, 0x17,
+    0x26, 0x11, 0x18, 0x15, 0x08, 0x0F, 0x1B, 0x14, 0x26, 0x18, 0x15, 0x26,
+    0x12, 0x07, 0x20, 0x0E, 0x0F, 0x18, 0x01, 0x14, 0x11, 0x1B, 0x03, 0x14,
+    0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10, 0x10, 0x0D, 0x0C, 0x11,
+    0x10, 0x0D, 0x0D, 0x10, 0x9B, 0x18, 0x0C, 0x11, 0x08, 0x1D, 0x1A, 0x03,
+    0x1E, 0x2A, 0x17, 0x0D, 0x05, 0x14, 0x19, 0x1E, 0x03, 0x16, 0x20, 0x12,
+    0x00, 0x02, 0x00, 0x7C, 0x02, 0x79, 0x01, 0x78, 0x03, 0x4C, 0x00, 0x1A,
+    0x00, 0x1E, 0x00, 0x00, 0x41, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x15, 0x27, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x14, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0x01,
+    0x3D, 0x17, 0x26, 0x11, 0x18, 0x15, 0x08, 0x0F, 0x1B, 0x14, 0x26, 0x18,
+    0x15, 0x26, 0x12, 0x07, 0x20, 0x0E, 0x0F, 0x18, 0x01, 0x14, 0x11, 0x1B,
+    0x52, 0x0F, 0x4F, 0x17, 0x02, 0x79, 0x18, 0x0C, 0x11, 0x08, 0x1D, 0x1A,
+    0x03, 0x1E, 0x2A, 0x17, 0x0D, 0x05, 0x14, 0x19, 0x1E, 0x03, 0x16, 0x20,
+    0x12, 0x59, 0x0B, 0x6F, 0x11, 0x00, 0xFF, 0xFF, 0x00, 0x73, 0x02, 0x79,
+    0x01, 0x81, 0x03, 0x52, 0x04, 0x26, 0x03, 0x01, 0xFF, 0x00, 0x02, 0x07,
+    0x03, 0x05, 0x00, 0x00, 0x00, 0xA5, 0x00, 0x01, 0x00, 0x73, 0x02, 0x97,
+    0x01, 0x81, 0x02, 0xAD, 0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x73, 0x01, 0x0E, 0x02, 0x97, 0x16, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x73,
+    0x02, 0x97, 0x01, 0x81, 0x03, 0x44, 0x06, 0x26, 0x03, 0x05, 0x00, 0x00,
+    0x00, 0x07, 0x02, 0xF2, 0x00, 0x00, 0x00, 0x73, 0x00, 0x02, 0x00, 0x73,
+    0x02, 0x8D, 0x01, 0x81, 0x03, 0x49, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x41, 0x27, 0x37, 0x17, 0x07, 0x35, 0x21, 0x15, 0x01, 0x11, 0x57, 0x17,
+    0x4F, 0xAD, 0x01, 0x0E, 0x02, 0xCF, 0x69, 0x11, 0x6F, 0x4D, 0x16, 0x16,
+    0x00, 0x02, 0x00, 0x73, 0x02, 0x8D, 0x01, 0x81, 0x03, 0x49, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15, 0x27, 0x27, 0x37, 0x17,
+    0x73, 0x01, 0x0E, 0x8E, 0x0F, 0x4F, 0x17, 0x02, 0x8D, 0x16, 0x16, 0x42,
+    0x0B, 0x6F, 0x11, 0x00, 0x00, 0x01, 0x00, 0xA9, 0x02, 0x5E, 0x01, 0x4B,
+    0x02, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x53, 0x26, 0x26, 0x35, 0x34, 0x36,
+    0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06, 0x15, 0x14,
+    0x16, 0x17, 0xF1, 0x02, 0x04, 0x16, 0x0D, 0x0E, 0x16, 0x23, 0x1A, 0x10,
+    0x22, 0x13, 0x07, 0x11, 0x25, 0x15, 0x27, 0x30, 0x1C, 0x10, 0x0B, 0x11,
+    0x03, 0x01, 0x02, 0x5E, 0x05, 0x08, 0x06, 0x0E, 0x12, 0x08, 0x09, 0x13,
+    0x0E, 0x10, 0x0F, 0x05, 0x07, 0x14, 0x07, 0x07, 0x1D, 0x18, 0x15, 0x19,
+    0x09, 0x06, 0x0E, 0x08, 0x04, 0x06, 0x03, 0x00, 0x00, 0x02, 0x00, 0x71,
+    0x02, 0x63, 0x01, 0x83, 0x02, 0xE0, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x41, 0x27, 0x37, 0x17, 0x07, 0x27, 0x37, 0x17, 0x01, 0x79, 0x90, 0x0E,
+    0x8C, 0x82, 0x90, 0x0E, 0x8C, 0x02, 0x63, 0x68, 0x15, 0x6E, 0x0F, 0x68,
+    0x15, 0x6E, 0x00, 0x01, 0x00, 0x76, 0x02, 0x6F, 0x01, 0x7E, 0x02, 0xE9,
+    0x00, 0x0D, 0x00, 0x00, 0x53, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17,
+    0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x8C, 0x16, 0x0C, 0x45, 0x33, 0x32,
+    0x47, 0x0B, 0x16, 0x09, 0x3E, 0x27, 0x28, 0x3C, 0x02, 0x6F, 0x02, 0x38,
+    0x40, 0x40, 0x38, 0x02, 0x30, 0x35, 0x35, 0x00, 0x00, 0x01, 0x00, 0xDB,
+    0x02, 0x62, 0x01, 0x1A, 0x02, 0xEA, 0x00, 0x15, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x35, 0x34, 0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16,
+    0x17, 0x16, 0x16, 0x15, 0x14, 0x06, 0xFF, 0x10, 0x14, 0x04, 0x0A, 0x13,
+    0x0E, 0x0D, 0x07, 0x10, 0x0B, 0x07, 0x0A, 0x0B, 0x09, 0x0D, 0x02, 0x62,
+    0x19, 0x15, 0x0D, 0x17, 0x15, 0x15, 0x0C, 0x0D, 0x06, 0x0F, 0x10, 0x0A,
+    0x08, 0x0A, 0x05, 0x05, 0x0E, 0x0A, 0x09, 0x0F, 0x00, 0x01, 0x00, 0xC0,
+    0x01, 0xF9, 0x01, 0x35, 0x02, 0x70, 0x00, 0x08, 0x00, 0x00, 0x53, 0x27,
+    0x32, 0x36, 0x35, 0x33, 0x14, 0x06, 0x06, 0xC7, 0x07, 0x37, 0x28, 0x16,
+    0x16, 0x30, 0x01, 0xF9, 0x14, 0x30, 0x33, 0x27, 0x35, 0x1B, 0x00, 0x01,
+    0x00, 0xDE, 0xFF, 0x75, 0x01, 0x16, 0xFF, 0xAF, 0x00, 0x0B, 0x00, 0x00,
+    0x57, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06,
+    0xFA, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x8B, 0x10, 0x0D, 0x0C,
+    0x11, 0x10, 0x0D, 0x0D, 0x10, 0x00, 0x00, 0x02, 0x00, 0x93, 0xFF, 0x75,
+    0x01, 0x61, 0xFF, 0xAF, 0x00, 0x0B, 0x00, 0x17, 0x00, 0x00, 0x45, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x23, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x45,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0xA4, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0D, 0x0F, 0x0E, 0x8B, 0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10,
+    0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10, 0x00, 0x01, 0x00, 0xDB,
+    0xFF, 0x34, 0x01, 0x1A, 0xFF, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x57, 0x27,
+    0x3E, 0x02, 0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33,
+    0x32, 0x16, 0x15, 0x14, 0x0E, 0x02, 0xEB, 0x0D, 0x08, 0x0F, 0x0B, 0x06,
+    0x0B, 0x0A, 0x0A, 0x0E, 0x0D, 0x11, 0x13, 0x04, 0x0A, 0x13, 0xCC, 0x0D,
+    0x07, 0x0E, 0x10, 0x0A, 0x08, 0x0A, 0x05, 0x05, 0x0E, 0x0A, 0x09, 0x0F,
+    0x19, 0x15, 0x0D, 0x17, 0x15, 0x15, 0x00, 0x01, 0x00, 0xAF, 0xFF, 0x1D,
+    0x01, 0x45, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x57, 0x27, 0x3E, 0x02,
+    0x35, 0x34, 0x26, 0x26, 0x23, 0x27, 0x37, 0x33, 0x07, 0x16, 0x16, 0x15,
+    0x14, 0x0E, 0x02, 0xB3, 0x04, 0x1E, 0x3C, 0x28, 0x20, 0x2E, 0x16, 0x0D,
+    0x36, 0x16, 0x33, 0x3B, 0x31, 0x1B, 0x2B, 0x33, 0xE3, 0x11, 0x05, 0x0C,
+    0x1C, 0x1B, 0x16, 0x15, 0x07, 0x0A, 0x4E, 0x47, 0x02, 0x24, 0x1E, 0x1B,
+    0x1F, 0x11, 0x09, 0x00, 0x00, 0x01, 0x00, 0xA0, 0xFF, 0x1A, 0x01, 0x54,
+    0x00, 0x12, 0x00, 0x18, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x3E, 0x02, 0x37, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x0E, 0x02, 0xFF, 0x1C, 0x2B, 0x18, 0x19, 0x2B, 0x36, 0x1C,
+    0x05, 0x25, 0x3D, 0x23, 0x2A, 0x1F, 0x18, 0x23, 0x0B, 0x0F, 0x08, 0x1A,
+    0x20, 0xE6, 0x1A, 0x2E, 0x1C, 0x1E, 0x32, 0x26, 0x19, 0x05, 0x10, 0x08,
+    0x23, 0x35, 0x24, 0x21, 0x2D, 0x19, 0x14, 0x0D, 0x10, 0x18, 0x0E, 0x00,
+    0x00, 0x01, 0x00, 0x76, 0xFF, 0x4B, 0x01, 0x7E, 0xFF, 0xC5, 0x00, 0x0D,
+    0x00, 0x00, 0x57, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0xFA, 0x33, 0x45, 0x0C, 0x16, 0x0A, 0x3C, 0x28,
+    0x27, 0x3E, 0x09, 0x16, 0x0B, 0x47, 0xB5, 0x40, 0x38, 0x02, 0x30, 0x35,
+    0x35, 0x30, 0x02, 0x38, 0x40, 0x00, 0x00, 0x01, 0x00, 0x73, 0xFF, 0x87,
+    0x01, 0x82, 0xFF, 0x9D, 0x00, 0x03, 0x00, 0x00, 0x57, 0x35, 0x21, 0x15,
+    0x73, 0x01, 0x0F, 0x79, 0x16, 0x16, 0x00, 0x01, 0x00, 0x74, 0x01, 0x20,
+    0x01, 0x80, 0x01, 0x35, 0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x74, 0x01, 0x0C, 0x01, 0x20, 0x15, 0x15, 0x00, 0xFF, 0xFF, 0x00, 0x93,
+    0x02, 0x97, 0x01, 0x61, 0x02, 0xD1, 0x04, 0x06, 0x02, 0xF2, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0xDE, 0x02, 0x97, 0x01, 0x16, 0x02, 0xD1, 0x04, 0x06,
+    0x02, 0xF5, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAD, 0x02, 0x63, 0x01, 0x47,
+    0x02, 0xE0, 0x04, 0x06, 0x02, 0xF7, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAD,
+    0x02, 0x63, 0x01, 0x47, 0x02, 0xE0, 0x04, 0x06, 0x02, 0xF8, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x71, 0x02, 0x63, 0x01, 0x83, 0x02, 0xE0, 0x04, 0x06,
+    0x02, 0xFA, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x81, 0x02, 0x6D, 0x01, 0x73,
+    0x02, 0xD6, 0x04, 0x06, 0x02, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x81,
+    0x02, 0x6D, 0x01, 0x73, 0x02, 0xD6, 0x04, 0x06, 0x02, 0xFD, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x76, 0x02, 0x65, 0x01, 0x7E, 0x02, 0xDF, 0x04, 0x06,
+    0x02, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x9E, 0x02, 0x52, 0x01, 0x56,
+    0x03, 0x04, 0x04, 0x06, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x7C,
+    0x02, 0x79, 0x01, 0x78, 0x02, 0xCA, 0x04, 0x06, 0x03, 0x01, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x73, 0x02, 0x97, 0x01, 0x81, 0x02, 0xAD, 0x04, 0x06,
+    0x03, 0x05, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xAF, 0xFF, 0x1D, 0x01, 0x45,
+    0x00, 0x00, 0x04, 0x06, 0x03, 0x11, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xA0,
+    0xFF, 0x1A, 0x01, 0x54, 0x00, 0x12, 0x04, 0x06, 0x03, 0x12, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x94, 0x03, 0x17, 0x01, 0x60, 0x03, 0x4D, 0x00, 0x0B,
+    0x00, 0x17, 0x00, 0x00, 0x41, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x23, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32,
+    0x16, 0x15, 0x14, 0x06, 0x01, 0x45, 0x0C, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D,
+    0x0D, 0xA4, 0x0C, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D, 0x0D, 0x03, 0x17, 0x0F,
+    0x0C, 0x0B, 0x10, 0x0F, 0x0C, 0x0C, 0x0F, 0x0F, 0x0C, 0x0B, 0x10, 0x0F,
+    0x0C, 0x0C, 0x0F, 0x00, 0x00, 0x03, 0x00, 0x94, 0x03, 0x17, 0x01, 0x60,
+    0x03, 0xE0, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x17, 0x07, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0x33, 0x22, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15,
+    0x14, 0x06, 0xC5, 0x09, 0x96, 0x0D, 0xB0, 0x0C, 0x0F, 0x0E, 0x0D, 0x0E,
+    0x0D, 0x0D, 0x88, 0x0C, 0x0F, 0x0E, 0x0D, 0x0E, 0x0D, 0x0D, 0x03, 0x74,
+    0x10, 0x5C, 0x16, 0xB3, 0x0F, 0x0C, 0x0B, 0x10, 0x0F, 0x0C, 0x0C, 0x0F,
+    0x0F, 0x0C, 0x0B, 0x10, 0x0F, 0x0C, 0x0C, 0x0F, 0xFF, 0xFF, 0x00, 0x73,
+    0x03, 0x17, 0x01, 0x81, 0x03, 0xB5, 0x06, 0x26, 0x03, 0x23, 0x00, 0x00,
+    0x00, 0x07, 0x03, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0x00, 0xDE,
+    0x03, 0x15, 0x01, 0x16, 0x03, 0x4F, 0x00, 0x0B, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0xFA, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x03, 0x15, 0x10, 0x0D, 0x0C, 0x11,
+    0x10, 0x0D, 0x0D, 0x10, 0xFF, 0xFF, 0x00, 0x73, 0x03, 0x15, 0x01, 0x81,
+    0x03, 0xB5, 0x04, 0x26, 0x03, 0x26, 0x01, 0x00, 0x02, 0x07, 0x03, 0x3C,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0x00, 0xA9, 0x02, 0xFC, 0x01, 0x4C,
+    0x03, 0x68, 0x00, 0x03, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x01, 0x43,
+    0x9A, 0x0D, 0x96, 0x02, 0xFC, 0x56, 0x16, 0x5C, 0x00, 0x01, 0x00, 0xA9,
+    0x02, 0xFC, 0x01, 0x4C, 0x03, 0x68, 0x00, 0x03, 0x00, 0x00, 0x53, 0x27,
+    0x37, 0x17, 0xB2, 0x09, 0x96, 0x0D, 0x02, 0xFC, 0x10, 0x5C, 0x16, 0x00,
+    0x00, 0x02, 0x00, 0x99, 0x02, 0xFA, 0x01, 0x5C, 0x03, 0x74, 0x00, 0x03,
+    0x00, 0x0F, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x07, 0x22, 0x26, 0x35,
+    0x34, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x01, 0x05, 0x0F, 0x4F,
+    0x17, 0xA7, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0F, 0x0E, 0x02, 0xFA, 0x0B,
+    0x6F, 0x11, 0x63, 0x10, 0x0D, 0x0C, 0x11, 0x10, 0x0D, 0x0D, 0x10, 0x00,
+    0x00, 0x02, 0x00, 0x66, 0x02, 0xF9, 0x01, 0x8E, 0x03, 0x6A, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x07, 0x27, 0x37, 0x17,
+    0x6F, 0x09, 0x95, 0x0C, 0x11, 0x09, 0x95, 0x0C, 0x02, 0xF9, 0x10, 0x61,
+    0x16, 0x5B, 0x10, 0x61, 0x16, 0x00, 0x00, 0x01, 0x00, 0x81, 0x03, 0x02,
+    0x01, 0x73, 0x03, 0x61, 0x00, 0x07, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33,
+    0x17, 0x07, 0x27, 0x33, 0x8D, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F,
+    0x03, 0x02, 0x0D, 0x52, 0x52, 0x0D, 0x52, 0x00, 0x00, 0x02, 0x00, 0x74,
+    0x03, 0x02, 0x01, 0x81, 0x03, 0xD6, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x27, 0x37, 0x17,
+    0x80, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F, 0x7E, 0x58, 0x17, 0x4F,
+    0x03, 0x02, 0x0D, 0x52, 0x52, 0x0D, 0x52, 0x09, 0x68, 0x11, 0x6F, 0x00,
+    0x00, 0x02, 0x00, 0x59, 0x03, 0x02, 0x01, 0x9C, 0x03, 0xD6, 0x00, 0x07,
+    0x00, 0x0B, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33,
+    0x37, 0x27, 0x37, 0x17, 0x65, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F,
+    0x6A, 0x0E, 0x4F, 0x17, 0x03, 0x02, 0x0D, 0x52, 0x52, 0x0D, 0x52, 0x09,
+    0x0A, 0x6F, 0x11, 0x00, 0x00, 0x02, 0x00, 0x7D, 0x03, 0x02, 0x01, 0x78,
+    0x03, 0xD9, 0x00, 0x07, 0x00, 0x22, 0x00, 0x00, 0x53, 0x27, 0x37, 0x33,
+    0x17, 0x07, 0x27, 0x33, 0x37, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33,
+    0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0x8D, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C,
+    0x74, 0x0F, 0x3A, 0x10, 0x23, 0x12, 0x10, 0x20, 0x0E, 0x0D, 0x13, 0x05,
+    0x17, 0x05, 0x21, 0x16, 0x11, 0x22, 0x10, 0x10, 0x1F, 0x10, 0x0E, 0x15,
+    0x07, 0x13, 0x03, 0x12, 0x19, 0x03, 0x02, 0x0D, 0x52, 0x52, 0x0D, 0x52,
+    0x4A, 0x0B, 0x07, 0x06, 0x0B, 0x10, 0x13, 0x04, 0x18, 0x1D, 0x0C, 0x06,
+    0x06, 0x0B, 0x0F, 0x16, 0x04, 0x12, 0x18, 0x0D, 0x00, 0x02, 0x00, 0x57,
+    0x03, 0x02, 0x01, 0x9D, 0x03, 0xE5, 0x00, 0x07, 0x00, 0x27, 0x00, 0x00,
+    0x53, 0x27, 0x37, 0x33, 0x17, 0x07, 0x27, 0x33, 0x37, 0x26, 0x26, 0x35,
+    0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22, 0x06, 0x07,
+    0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07, 0x06, 0x06,
+    0x15, 0x14, 0x16, 0x17, 0x63, 0x0C, 0x6B, 0x1C, 0x6B, 0x0C, 0x74, 0x0F,
+    0x6D, 0x02, 0x04, 0x16, 0x0D, 0x0E, 0x14, 0x20, 0x17, 0x13, 0x23, 0x13,
+    0x07, 0x11, 0x26, 0x19, 0x23, 0x2D, 0x1C, 0x0E, 0x0B, 0x11, 0x03, 0x01,
+    0x03, 0x02, 0x0D, 0x52, 0x52, 0x0D, 0x52, 0x10, 0x05, 0x08, 0x06, 0x0A,
+    0x11, 0x08, 0x08, 0x0F, 0x07, 0x0C, 0x0B, 0x06, 0x06, 0x14, 0x07, 0x07,
+    0x18, 0x15, 0x0F, 0x14, 0x08, 0x07, 0x0B, 0x07, 0x03, 0x05, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x81, 0x03, 0x02, 0x01, 0x73, 0x03, 0x61, 0x00, 0x07,
+    0x00, 0x00, 0x53, 0x27, 0x37, 0x17, 0x23, 0x37, 0x17, 0x07, 0xEC, 0x6B,
+    0x0C, 0x75, 0x0F, 0x74, 0x0C, 0x6B, 0x03, 0x02, 0x52, 0x0D, 0x52, 0x52,
+    0x0D, 0x52, 0x00, 0x01, 0x00, 0x76, 0x02, 0xFA, 0x01, 0x7E, 0x03, 0x6A,
+    0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x27, 0x37, 0x16, 0x16,
+    0x33, 0x32, 0x36, 0x37, 0x17, 0x0E, 0x02, 0xFA, 0x22, 0x36, 0x24, 0x08,
+    0x16, 0x0A, 0x3C, 0x28, 0x27, 0x3E, 0x09, 0x16, 0x07, 0x25, 0x36, 0x02,
+    0xFA, 0x1C, 0x32, 0x20, 0x02, 0x28, 0x33, 0x33, 0x28, 0x02, 0x20, 0x32,
+    0x1C, 0x00, 0x00, 0x02, 0x00, 0x76, 0x02, 0xFA, 0x01, 0x7E, 0x03, 0xE0,
+    0x00, 0x0D, 0x00, 0x11, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17,
+    0xFA, 0x33, 0x43, 0x0E, 0x17, 0x0C, 0x39, 0x28, 0x27, 0x3B, 0x0B, 0x17,
+    0x0D, 0x45, 0x24, 0x58, 0x17, 0x4F, 0x02, 0xFA, 0x35, 0x2F, 0x02, 0x27,
+    0x2A, 0x2A, 0x27, 0x02, 0x2F, 0x35, 0x6D, 0x68, 0x11, 0x6F, 0x00, 0x02,
+    0x00, 0x76, 0x02, 0xFA, 0x01, 0x7E, 0x03, 0xE0, 0x00, 0x0D, 0x00, 0x11,
+    0x00, 0x00, 0x53, 0x22, 0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36,
+    0x37, 0x17, 0x06, 0x06, 0x27, 0x27, 0x37, 0x17, 0xFA, 0x33, 0x43, 0x0E,
+    0x17, 0x0C, 0x39, 0x28, 0x27, 0x3B, 0x0B, 0x17, 0x0D, 0x45, 0x38, 0x0E,
+    0x4F, 0x17, 0x02, 0xFA, 0x38, 0x2C, 0x02, 0x24, 0x2D, 0x2D, 0x24, 0x02,
+    0x2C, 0x38, 0x6D, 0x0A, 0x6F, 0x11, 0x00, 0x02, 0x00, 0x76, 0x02, 0xFA,
+    0x01, 0x7E, 0x03, 0xE3, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x00, 0x53, 0x22,
+    0x26, 0x27, 0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06,
+    0x37, 0x22, 0x26, 0x27, 0x26, 0x26, 0x23, 0x22, 0x06, 0x07, 0x27, 0x36,
+    0x36, 0x33, 0x32, 0x16, 0x17, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x0E, 0x02, 0xFA, 0x33, 0x43, 0x0E, 0x17, 0x0C, 0x39, 0x28, 0x27, 0x3B,
+    0x0B, 0x17, 0x0D, 0x45, 0x10, 0x10, 0x23, 0x12, 0x10, 0x20, 0x0E, 0x0D,
+    0x13, 0x05, 0x17, 0x05, 0x21, 0x16, 0x11, 0x22, 0x10, 0x10, 0x1F, 0x10,
+    0x0E, 0x15, 0x07, 0x13, 0x03, 0x12, 0x19, 0x02, 0xFA, 0x38, 0x2C, 0x02,
+    0x24, 0x2D, 0x2D, 0x24, 0x02, 0x2C, 0x38, 0xAE, 0x0B, 0x07, 0x06, 0x0B,
+    0x10, 0x13, 0x04, 0x18, 0x1D, 0x0C, 0x06, 0x06, 0x0B, 0x0F, 0x16, 0x04,
+    0x12, 0x18, 0x0D, 0x00, 0x00, 0x02, 0x00, 0x76, 0x02, 0xFA, 0x01, 0x7E,
+    0x03, 0xE9, 0x00, 0x0D, 0x00, 0x2D, 0x00, 0x00, 0x53, 0x22, 0x26, 0x27,
+    0x37, 0x16, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17, 0x06, 0x06, 0x27, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0xFA, 0x33, 0x43, 0x0E, 0x17, 0x0C,
+    0x39, 0x28, 0x27, 0x3B, 0x0B, 0x17, 0x0D, 0x45, 0x35, 0x02, 0x04, 0x16,
+    0x0D, 0x0E, 0x14, 0x21, 0x17, 0x12, 0x23, 0x13, 0x07, 0x11, 0x26, 0x18,
+    0x24, 0x2D, 0x1C, 0x0E, 0x0B, 0x11, 0x03, 0x01, 0x02, 0xFA, 0x38, 0x2C,
+    0x02, 0x24, 0x2D, 0x2D, 0x24, 0x02, 0x2C, 0x38, 0x6E, 0x05, 0x08, 0x06,
+    0x0A, 0x11, 0x08, 0x08, 0x0F, 0x07, 0x0C, 0x0B, 0x05, 0x07, 0x14, 0x07,
+    0x07, 0x18, 0x15, 0x0F, 0x14, 0x08, 0x07, 0x0B, 0x07, 0x03, 0x05, 0x03,
+    0x00, 0x02, 0x00, 0x9E, 0x02, 0xB1, 0x01, 0x56, 0x03, 0x63, 0x00, 0x0F,
+    0x00, 0x1B, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34, 0x36, 0x36,
+    0x33, 0x32, 0x16, 0x16, 0x15, 0x14, 0x06, 0x06, 0x27, 0x32, 0x36, 0x35,
+    0x34, 0x26, 0x23, 0x22, 0x06, 0x15, 0x14, 0x16, 0xFA, 0x18, 0x2A, 0x1A,
+    0x19, 0x2A, 0x19, 0x1A, 0x29, 0x19, 0x1A, 0x29, 0x19, 0x1E, 0x29, 0x29,
+    0x1E, 0x1F, 0x28, 0x2A, 0x02, 0xB1, 0x18, 0x28, 0x18, 0x19, 0x28, 0x19,
+    0x19, 0x28, 0x19, 0x17, 0x29, 0x18, 0x14, 0x29, 0x1B, 0x20, 0x26, 0x27,
+    0x1F, 0x1B, 0x29, 0x00, 0x00, 0x01, 0x00, 0x76, 0x03, 0x10, 0x01, 0x7F,
+    0x03, 0x54, 0x00, 0x1A, 0x00, 0x00, 0x41, 0x22, 0x26, 0x27, 0x26, 0x26,
+    0x23, 0x22, 0x06, 0x15, 0x23, 0x34, 0x36, 0x33, 0x32, 0x16, 0x17, 0x16,
+    0x16, 0x33, 0x32, 0x36, 0x37, 0x33, 0x14, 0x06, 0x06, 0x01, 0x37, 0x0C,
+    0x20, 0x26, 0x06, 0x1F, 0x0F, 0x0E, 0x17, 0x16, 0x23, 0x16, 0x18, 0x2A,
+    0x12, 0x18, 0x13, 0x07, 0x13, 0x20, 0x01, 0x16, 0x14, 0x21, 0x03, 0x10,
+    0x09, 0x13, 0x03, 0x0F, 0x17, 0x16, 0x1F, 0x24, 0x14, 0x09, 0x0B, 0x06,
+    0x15, 0x18, 0x15, 0x1E, 0x10, 0x00, 0xFF, 0xFF, 0x00, 0x75, 0x03, 0x10,
+    0x01, 0x7E, 0x03, 0xC5, 0x04, 0x26, 0x03, 0x38, 0xFF, 0x00, 0x02, 0x07,
+    0x03, 0x23, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x75, 0x03, 0x10,
+    0x01, 0x7E, 0x03, 0xE0, 0x04, 0x26, 0x03, 0x38, 0xFF, 0x00, 0x00, 0x07,
+    0x03, 0x29, 0x00, 0x13, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x73, 0x03, 0x10,
+    0x01, 0x81, 0x03, 0xB5, 0x04, 0x26, 0x03, 0x38, 0xFF, 0x00, 0x00, 0x07,
+    0x03, 0x3C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x01, 0x00, 0x73, 0x03, 0x27,
+    0x01, 0x81, 0x03, 0x3D, 0x00, 0x03, 0x00, 0x00, 0x53, 0x35, 0x21, 0x15,
+    0x73, 0x01, 0x0E, 0x03, 0x27, 0x16, 0x16, 0x00, 0xFF, 0xFF, 0x00, 0x72,
+    0x03, 0x27, 0x01, 0x80, 0x03, 0xC5, 0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00,
+    0x02, 0x07, 0x03, 0x23, 0x00, 0x00, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x72,
+    0x03, 0x27, 0x01, 0x80, 0x03, 0xE0, 0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00,
+    0x00, 0x07, 0x03, 0x28, 0xFF, 0xEB, 0x00, 0x78, 0xFF, 0xFF, 0x00, 0x72,
+    0x03, 0x27, 0x01, 0x80, 0x03, 0xE0, 0x04, 0x26, 0x03, 0x3C, 0xFF, 0x00,
+    0x00, 0x07, 0x03, 0x29, 0x00, 0x13, 0x00, 0x78, 0x00, 0x01, 0x00, 0xA9,
+    0x02, 0xFD, 0x01, 0x4B, 0x03, 0x90, 0x00, 0x1F, 0x00, 0x00, 0x53, 0x26,
+    0x26, 0x35, 0x34, 0x36, 0x37, 0x36, 0x36, 0x35, 0x34, 0x26, 0x23, 0x22,
+    0x06, 0x07, 0x27, 0x36, 0x36, 0x33, 0x32, 0x16, 0x15, 0x14, 0x06, 0x07,
+    0x06, 0x06, 0x15, 0x14, 0x16, 0x17, 0xF1, 0x02, 0x04, 0x16, 0x0D, 0x0F,
+    0x15, 0x23, 0x1A, 0x10, 0x22, 0x13, 0x07, 0x11, 0x25, 0x15, 0x27, 0x30,
+    0x1D, 0x0F, 0x0B, 0x11, 0x03, 0x01, 0x02, 0xFD, 0x05, 0x08, 0x06, 0x0E,
+    0x12, 0x08, 0x09, 0x0F, 0x0D, 0x0F, 0x0E, 0x05, 0x07, 0x14, 0x07, 0x07,
+    0x1C, 0x17, 0x13, 0x16, 0x09, 0x07, 0x0D, 0x08, 0x04, 0x06, 0x03, 0x00,
+    0x00, 0x02, 0x00, 0x66, 0x02, 0xF9, 0x01, 0x8E, 0x03, 0x6A, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x41, 0x27, 0x37, 0x17, 0x07, 0x27, 0x37, 0x17,
+    0x01, 0x85, 0x98, 0x0C, 0x95, 0x90, 0x98, 0x0C, 0x95, 0x02, 0xF9, 0x5B,
+    0x16, 0x61, 0x10, 0x5B, 0x16, 0x61, 0x00, 0x01, 0x00, 0x76, 0x02, 0xFF,
+    0x01, 0x7E, 0x03, 0x6F, 0x00, 0x0F, 0x00, 0x00, 0x53, 0x27, 0x3E, 0x02,
+    0x33, 0x32, 0x16, 0x16, 0x17, 0x07, 0x26, 0x26, 0x23, 0x22, 0x06, 0x8C,
+    0x16, 0x08, 0x24, 0x37, 0x21, 0x22, 0x36, 0x24, 0x08, 0x16, 0x0A, 0x3C,
+    0x28, 0x27, 0x3E, 0x02, 0xFF, 0x02, 0x21, 0x31, 0x1C, 0x1C, 0x31, 0x21,
+    0x02, 0x29, 0x32, 0x32, 0x00, 0x01, 0x00, 0xBA, 0x01, 0xF4, 0x01, 0x3A,
+    0x02, 0x70, 0x00, 0x08, 0x00, 0x00, 0x53, 0x35, 0x32, 0x36, 0x35, 0x33,
+    0x14, 0x06, 0x06, 0xBA, 0x33, 0x37, 0x16, 0x1D, 0x38, 0x01, 0xF4, 0x15,
+    0x34, 0x33, 0x28, 0x38, 0x1C, 0x00, 0x00, 0x01, 0x00, 0xDB, 0xFF, 0x34,
+    0x01, 0x1A, 0xFF, 0xBC, 0x00, 0x15, 0x00, 0x00, 0x57, 0x27, 0x3E, 0x02,
+    0x35, 0x34, 0x26, 0x27, 0x26, 0x26, 0x35, 0x34, 0x36, 0x33, 0x32, 0x16,
+    0x15, 0x14, 0x0E, 0x02, 0xEB, 0x0D, 0x07, 0x10, 0x0B, 0x06, 0x0B, 0x0A,
+    0x0A, 0x0E, 0x0D, 0x11, 0x13, 0x04, 0x0A, 0x13, 0xCC, 0x0D, 0x07, 0x0E,
+    0x10, 0x0A, 0x08, 0x0A, 0x05, 0x05, 0x0E, 0x0A, 0x09, 0x0F, 0x19, 0x15,
+    0x0D, 0x17, 0x15, 0x15, 0x00, 0x01, 0x00, 0xAF, 0xFF, 0x1D, 0x01, 0x45,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x57, 0x27, 0x3E, 0x02, 0x35, 0x34,
+    0x26, 0x26, 0x23, 0x27, 0x37, 0x33, 0x07, 0x16, 0x16, 0x15, 0x14, 0x0E,
+    0x02, 0xB3, 0x04, 0x1E, 0x3C, 0x28, 0x20, 0x2E, 0x16, 0x0D, 0x36, 0x16,
+    0x33, 0x3B, 0x31, 0x1B, 0x2B, 0x33, 0xE3, 0x11, 0x05, 0x0C, 0x1C, 0x1B,
+    0x16, 0x15, 0x07, 0x0A, 0x4E, 0x47, 0x02, 0x24, 0x1E, 0x1B, 0x1F, 0x11,
+    0x09, 0x00, 0x00, 0x01, 0x00, 0x9B, 0xFF, 0x1A, 0x01, 0x59, 0x00, 0x12,
+    0x00, 0x17, 0x00, 0x00, 0x57, 0x22, 0x26, 0x26, 0x35, 0x34, 0x3E, 0x02,
+    0x37, 0x17, 0x0E, 0x02, 0x15, 0x14, 0x16, 0x33, 0x32, 0x36, 0x37, 0x17,
+    0x06, 0x06, 0xFF, 0x1C, 0x2D, 0x1B, 0x1A, 0x2C, 0x37, 0x1E, 0x05, 0x26,
+    0x3F, 0x25, 0x2D, 0x21, 0x1A, 0x26, 0x0B, 0x0F, 0x0C, 0x30, 0xE6, 0x1B,
+    0x2D, 0x1C, 0x1E, 0x32, 0x26, 0x19, 0x05, 0x12, 0x06, 0x23, 0x35, 0x24,
+    0x21, 0x2D, 0x19, 0x14, 0x0D, 0x18, 0x1E, 0x00, 0xFF, 0xFF, 0x00, 0x38,
+    0x01, 0xBA, 0x00, 0x79, 0x02, 0xBC, 0x06, 0x06, 0x02, 0xA0, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x50, 0x02, 0x3C, 0x00, 0x9C, 0x02, 0xEC, 0x06, 0x06,
+    0x02, 0x99, 0x00, 0x00, 0x00, 0x01, 0x00, 0x43, 0x02, 0x1F, 0x00, 0xAA,
+    0x02, 0xE4, 0x00, 0x0F, 0x00, 0x00, 0x53, 0x22, 0x26, 0x26, 0x35, 0x34,
+    0x36, 0x36, 0x33, 0x15, 0x22, 0x06, 0x15, 0x14, 0x16, 0x33, 0xAA, 0x1B,
+    0x2F, 0x1D, 0x1D, 0x2F, 0x1B, 0x21, 0x30, 0x30, 0x21, 0x02, 0x1F, 0x1B,
+    0x2D, 0x1A, 0x1B, 0x2D, 0x1B, 0x15, 0x2B, 0x23, 0x1F, 0x2D, 0x00, 0x01,
+    0x00, 0x34, 0x02, 0x1F, 0x00, 0x9B, 0x02, 0xE4, 0x00, 0x0F, 0x00, 0x00,
+    0x53, 0x35, 0x32, 0x36, 0x35, 0x34, 0x26, 0x23, 0x35, 0x32, 0x16, 0x16,
+    0x15, 0x14, 0x06, 0x06, 0x34, 0x21, 0x30, 0x30, 0x21, 0x1B, 0x2F, 0x1D,
+    0x1D, 0x2F, 0x02, 0x1F, 0x16, 0x2D, 0x1F, 0x23, 0x2B, 0x15, 0x1B, 0x2D,
+    0x1B, 0x1A, 0x2D, 0x1B, 0x00, 0x01, 0x00, 0x64, 0xFF, 0x6D, 0x00, 0x7A,
+    0x00, 0xC5, 0x00, 0x03, 0x00, 0x00, 0x57, 0x11, 0x33, 0x11, 0x64, 0x16,
+    0x93, 0x01, 0x58, 0xFE, 0xA8, 0x00, 0x00, 0x01, 0x00, 0x68, 0x01, 0x70,
+    0x00, 0x80, 0x02, 0xC8, 0x00, 0x03, 0x00, 0x00, 0x53, 0x11, 0x33, 0x11,
+    0x68, 0x18, 0x01, 0x70, 0x01, 0x58, 0xFE, 0xA8};
+
+unsigned int lexend_thin_size = 78380;
+
+} // namespace tvk
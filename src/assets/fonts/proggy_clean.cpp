@@ -0,0 +1,3449 @@
+/**
+ * @file proggy_clean.cpp
+ * @brief Embedded Proggy Clean font data
+ */
+
+#include "tinyvk/assets/fonts.h"
+
+namespace tvk {
+
+unsigned char proggy_clean[] = {
+
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x03, 0x00, 0x40,
+    0x4F, 0x53, 0x2F, 0x32, 0x88, 0xEB, 0x74, 0x90, 0x00, 0x00, 0x01, 0x48,
+    0x00, 0x00, 0x00, 0x4E, 0x63, 0x6D, 0x61, 0x70, 0x02, 0x12, 0x23, 0x75,
+    0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x01, 0x52, 0x63, 0x76, 0x74, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x02,
+    0x67, 0x6C, 0x79, 0x66, 0x12, 0xAF, 0x89, 0x56, 0x00, 0x00, 0x07, 0x04,
+    0x00, 0x00, 0x92, 0x80, 0x68, 0x65, 0x61, 0x64, 0xD7, 0x91, 0x66, 0xD3,
+    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x08, 0x42, 0x01, 0xC3, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x24,
+    0x68, 0x6D, 0x74, 0x78, 0x8A, 0x00, 0x7E, 0x80, 0x00, 0x00, 0x01, 0x98,
+    0x00, 0x00, 0x02, 0x06, 0x6C, 0x6F, 0x63, 0x61, 0x8C, 0x73, 0xB0, 0xD8,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x04, 0x6D, 0x61, 0x78, 0x70,
+    0x01, 0xAE, 0x00, 0xDA, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x20,
+    0x6E, 0x61, 0x6D, 0x65, 0x25, 0x59, 0xBB, 0x96, 0x00, 0x00, 0x99, 0x84,
+    0x00, 0x00, 0x01, 0x9E, 0x70, 0x6F, 0x73, 0x74, 0xA6, 0xAC, 0x83, 0xEF,
+    0x00, 0x00, 0x9B, 0x24, 0x00, 0x00, 0x05, 0xD2, 0x70, 0x72, 0x65, 0x70,
+    0x69, 0x02, 0x01, 0x12, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3C, 0x55, 0xE9, 0xD5,
+    0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB7, 0x67, 0x77, 0x84, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x92, 0xA6, 0xD7,
+    0x00, 0x00, 0xFE, 0x80, 0x03, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x04, 0xC0, 0xFE, 0x40, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x90, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x08, 0x00, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x76, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0x90, 0x00, 0x05,
+    0x00, 0x00, 0x02, 0xBC, 0x02, 0x8A, 0x00, 0x00, 0x00, 0x8F, 0x02, 0xBC,
+    0x02, 0x8A, 0x00, 0x00, 0x01, 0xC5, 0x00, 0x32, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x6C, 0x74, 0x73, 0x00, 0x40, 0x00, 0x00, 0x20, 0xAC,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+    0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x80, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80,
+    0x03, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0x80, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0xFF, 0x20, 0xAC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81,
+    0x20, 0xAC, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xDF, 0xD5, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x01, 0x8D,
+    0xB8, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6,
+    0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6,
+    0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6,
+    0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6,
+    0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6,
+    0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6,
+    0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xF4, 0x01, 0x1C, 0x01, 0x9E,
+    0x02, 0x14, 0x02, 0x88, 0x02, 0xFC, 0x03, 0x14, 0x03, 0x58, 0x03, 0x9C,
+    0x03, 0xDE, 0x04, 0x14, 0x04, 0x32, 0x04, 0x50, 0x04, 0x62, 0x04, 0xA2,
+    0x05, 0x16, 0x05, 0x66, 0x05, 0xBC, 0x06, 0x12, 0x06, 0x74, 0x06, 0xD6,
+    0x07, 0x38, 0x07, 0x7E, 0x07, 0xEC, 0x08, 0x4E, 0x08, 0x6C, 0x08, 0x96,
+    0x08, 0xD0, 0x09, 0x10, 0x09, 0x4A, 0x09, 0x88, 0x0A, 0x16, 0x0A, 0x80,
+    0x0B, 0x04, 0x0B, 0x56, 0x0B, 0xC8, 0x0C, 0x2E, 0x0C, 0x82, 0x0C, 0xEA,
+    0x0D, 0x5E, 0x0D, 0xA4, 0x0D, 0xEA, 0x0E, 0x50, 0x0E, 0x96, 0x0F, 0x28,
+    0x0F, 0xB0, 0x10, 0x12, 0x10, 0x74, 0x10, 0xE0, 0x11, 0x52, 0x11, 0xB6,
+    0x12, 0x04, 0x12, 0x6E, 0x12, 0xC4, 0x13, 0x4C, 0x13, 0xAC, 0x13, 0xF6,
+    0x14, 0x58, 0x14, 0xAE, 0x14, 0xEA, 0x15, 0x40, 0x15, 0x80, 0x15, 0xA6,
+    0x15, 0xB8, 0x16, 0x12, 0x16, 0x7E, 0x16, 0xC6, 0x17, 0x34, 0x17, 0x8E,
+    0x17, 0xE0, 0x18, 0x56, 0x18, 0xBA, 0x18, 0xEE, 0x19, 0x36, 0x19, 0x96,
+    0x19, 0xD4, 0x1A, 0x48, 0x1A, 0x9C, 0x1A, 0xF0, 0x1B, 0x5C, 0x1B, 0xC8,
+    0x1C, 0x04, 0x1C, 0x4C, 0x1C, 0x96, 0x1C, 0xEA, 0x1D, 0x2A, 0x1D, 0x92,
+    0x1D, 0xD2, 0x1E, 0x40, 0x1E, 0x8E, 0x1E, 0xE0, 0x1F, 0x24, 0x1F, 0x76,
+    0x1F, 0xA6, 0x1F, 0xA6, 0x20, 0x10, 0x20, 0x10, 0x20, 0x2E, 0x20, 0x8A,
+    0x20, 0xB2, 0x20, 0xC8, 0x21, 0x14, 0x21, 0x74, 0x21, 0x98, 0x21, 0xEE,
+    0x22, 0x62, 0x22, 0x86, 0x23, 0x0C, 0x23, 0x0C, 0x23, 0x80, 0x23, 0x80,
+    0x23, 0x80, 0x23, 0x98, 0x23, 0xB0, 0x23, 0xD8, 0x24, 0x00, 0x24, 0x4A,
+    0x24, 0x68, 0x24, 0x90, 0x24, 0xAE, 0x25, 0x06, 0x25, 0x60, 0x25, 0x82,
+    0x25, 0xF8, 0x25, 0xF8, 0x26, 0x58, 0x26, 0xAA, 0x26, 0xAA, 0x26, 0xD8,
+    0x27, 0x40, 0x27, 0x9A, 0x28, 0x0A, 0x28, 0x68, 0x28, 0xA8, 0x29, 0x0E,
+    0x29, 0x20, 0x29, 0xB8, 0x29, 0xF8, 0x2A, 0x36, 0x2A, 0x60, 0x2A, 0x60,
+    0x2B, 0x02, 0x2B, 0x2A, 0x2B, 0x5E, 0x2B, 0xAC, 0x2B, 0xE6, 0x2C, 0x20,
+    0x2C, 0x34, 0x2C, 0x9A, 0x2D, 0x28, 0x2D, 0x5C, 0x2D, 0x78, 0x2D, 0xAA,
+    0x2D, 0xE8, 0x2E, 0x26, 0x2E, 0xA6, 0x2F, 0x26, 0x2F, 0xB6, 0x2F, 0xF4,
+    0x30, 0x5E, 0x30, 0xC8, 0x31, 0x3E, 0x31, 0xB4, 0x32, 0x1E, 0x32, 0x9E,
+    0x33, 0x1E, 0x33, 0x82, 0x33, 0xEE, 0x34, 0x5C, 0x34, 0xCE, 0x35, 0x3A,
+    0x35, 0x86, 0x35, 0xD4, 0x36, 0x26, 0x36, 0x72, 0x36, 0xE6, 0x37, 0x76,
+    0x37, 0xD8, 0x38, 0x3A, 0x38, 0xA6, 0x39, 0x12, 0x39, 0x74, 0x39, 0xAE,
+    0x3A, 0x2E, 0x3A, 0x9A, 0x3B, 0x06, 0x3B, 0x7C, 0x3B, 0xE8, 0x3C, 0x3A,
+    0x3C, 0x96, 0x3D, 0x22, 0x3D, 0x86, 0x3D, 0xEC, 0x3E, 0x56, 0x3E, 0xC6,
+    0x3F, 0x2A, 0x3F, 0x9A, 0x40, 0x12, 0x40, 0x6A, 0x40, 0xD0, 0x41, 0x36,
+    0x41, 0xA2, 0x42, 0x08, 0x42, 0x40, 0x42, 0x7A, 0x42, 0xB8, 0x42, 0xF0,
+    0x43, 0x62, 0x43, 0xCC, 0x44, 0x2A, 0x44, 0x8A, 0x44, 0xEE, 0x45, 0x58,
+    0x45, 0xB6, 0x45, 0xE2, 0x46, 0x54, 0x46, 0xB4, 0x47, 0x14, 0x47, 0x7A,
+    0x47, 0xDA, 0x48, 0x54, 0x48, 0xC6, 0x49, 0x40, 0x00, 0x24, 0x00, 0x00,
+    0xFE, 0x80, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B,
+    0x00, 0x6F, 0x00, 0x73, 0x00, 0x77, 0x00, 0x7B, 0x00, 0x7F, 0x00, 0x83,
+    0x00, 0x87, 0x00, 0x8B, 0x00, 0x8F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x07, 0x01, 0x80,
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x03, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x15, 0x00, 0x80,
+    0xFF, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x03, 0x01, 0x80, 0x03, 0x00, 0x02, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0B, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0B, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x04, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x09, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x80,
+    0xFF, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x25, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x05, 0x00, 0x80,
+    0x01, 0x80, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x25, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x80,
+    0xFF, 0x80, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x02, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0F, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x11, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x02, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x13, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x04, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x06, 0x00, 0x80, 0xFF, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x02, 0x00, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80,
+    0x01, 0x00, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x13, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0C, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63,
+    0x00, 0x67, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02,
+    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x18, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80,
+    0xFF, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x01, 0x00,
+    0xFF, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0A, 0x00, 0x80, 0xFF, 0x80, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0F, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0xFF, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x00, 0x15, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x02, 0x01, 0x00, 0x03, 0x80, 0x02, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x80, 0xFE, 0x80, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x08, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x04, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0xFF, 0x00, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFC,
+    0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x80, 0xFE, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x13, 0x00, 0x80, 0xFE, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0D, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00,
+    0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x80, 0xFE, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x80, 0xFF, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0B, 0x01, 0x80, 0xFF, 0x00, 0x02, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x80, 0xFF, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x25, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+    0xFF, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x06, 0x01, 0x00, 0xFF, 0x80, 0x02, 0x80, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+    0x25, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x02, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x80,
+    0x00, 0x80, 0x02, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x00, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x06, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x06, 0x00, 0x80, 0x03, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x80,
+    0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x80,
+    0x03, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x80,
+    0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x03, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x12, 0x00, 0x80, 0xFF, 0x80, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x80, 0x80, 0x03, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x01, 0x80,
+    0xFF, 0x00, 0x02, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B, 0x00, 0x6F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFC, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0B, 0x00, 0x80,
+    0x01, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x07, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x80, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B,
+    0x00, 0x6F, 0x00, 0x73, 0x00, 0x77, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x01, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFC,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x02,
+    0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x04, 0x80, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x02, 0x80, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0A, 0x00, 0x80, 0x02, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x80,
+    0x02, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x80, 0x03, 0x80, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x04, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0xFF, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x80,
+    0xFF, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x01, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x04, 0x01, 0x80, 0xFE, 0x80, 0x02, 0x80, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x00, 0x80,
+    0x02, 0x00, 0x02, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0A, 0x00, 0x80, 0x02, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x16, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x02, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x02, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x02, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00,
+    0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0x04, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x16, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0x04, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x80,
+    0xFE, 0x80, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x02, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x19, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80,
+    0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x04,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x16, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80,
+    0xFD, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00,
+    0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x80, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x80, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x02,
+    0x80, 0x80, 0xFC, 0x80, 0x80, 0x02, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
+    0xFF, 0x80, 0x03, 0x80, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x13, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x14, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFC, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x80, 0xFE, 0x80, 0x03, 0x00,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x04,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0A, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x14, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x02, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x12, 0x00, 0x80,
+    0x00, 0x00, 0x03, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x07, 0x00, 0x80, 0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x00, 0x00, 0x14, 0x00, 0x80, 0xFF, 0x80, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x02, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x11, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x15, 0x00, 0x80, 0xFE, 0x80, 0x03, 0x00,
+    0x04, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x02, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x04, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x14, 0x00, 0x80,
+    0xFF, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x15, 0x00, 0x80,
+    0xFE, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x15, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x0E, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x12, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x0D, 0x00, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x00, 0x07, 0x00, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x11, 0x00, 0x2D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x0D, 0x00, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x0A, 0x00, 0x3E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x0D, 0x00, 0x31, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x48, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x01, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x02, 0x00, 0x0E, 0x00, 0x6C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x03, 0x00, 0x22, 0x00, 0x7A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x04, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
+    0x00, 0x06, 0x00, 0x1A, 0x00, 0x82, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30,
+    0x00, 0x34, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x34, 0x00, 0x2F, 0x00, 0x31,
+    0x00, 0x35, 0x62, 0x79, 0x20, 0x54, 0x72, 0x69, 0x73, 0x74, 0x61, 0x6E,
+    0x20, 0x47, 0x72, 0x69, 0x6D, 0x6D, 0x65, 0x72, 0x52, 0x65, 0x67, 0x75,
+    0x6C, 0x61, 0x72, 0x54, 0x54, 0x58, 0x20, 0x50, 0x72, 0x6F, 0x67, 0x67,
+    0x79, 0x43, 0x6C, 0x65, 0x61, 0x6E, 0x54, 0x54, 0x32, 0x30, 0x30, 0x34,
+    0x2F, 0x30, 0x34, 0x2F, 0x31, 0x35, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20,
+    0x00, 0x54, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61,
+    0x00, 0x6E, 0x00, 0x20, 0x00, 0x47, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6D,
+    0x00, 0x6D, 0x00, 0x65, 0x00, 0x72, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67,
+    0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x00, 0x54, 0x00, 0x54,
+    0x00, 0x58, 0x00, 0x20, 0x00, 0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x67,
+    0x00, 0x67, 0x00, 0x79, 0x00, 0x43, 0x00, 0x6C, 0x00, 0x65, 0x00, 0x61,
+    0x00, 0x6E, 0x00, 0x54, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06, 0x01, 0x07, 0x01, 0x08,
+    0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C, 0x01, 0x0D, 0x01, 0x0E,
+    0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12, 0x01, 0x13, 0x01, 0x14,
+    0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18, 0x01, 0x19, 0x01, 0x1A,
+    0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x1E, 0x01, 0x1F, 0x01, 0x20,
+    0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08,
+    0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0E,
+    0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14,
+    0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1A,
+    0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E, 0x00, 0x1F, 0x00, 0x20,
+    0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x25, 0x00, 0x26,
+    0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A, 0x00, 0x2B, 0x00, 0x2C,
+    0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x31, 0x00, 0x32,
+    0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36, 0x00, 0x37, 0x00, 0x38,
+    0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C, 0x00, 0x3D, 0x00, 0x3E,
+    0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44,
+    0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x49, 0x00, 0x4A,
+    0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E, 0x00, 0x4F, 0x00, 0x50,
+    0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54, 0x00, 0x55, 0x00, 0x56,
+    0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A, 0x00, 0x5B, 0x00, 0x5C,
+    0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60, 0x00, 0x61, 0x01, 0x21,
+    0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25, 0x01, 0x26, 0x01, 0x27,
+    0x01, 0x28, 0x01, 0x29, 0x01, 0x2A, 0x01, 0x2B, 0x01, 0x2C, 0x01, 0x2D,
+    0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x31, 0x01, 0x32, 0x01, 0x33,
+    0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37, 0x01, 0x38, 0x01, 0x39,
+    0x01, 0x3A, 0x01, 0x3B, 0x01, 0x3C, 0x01, 0x3D, 0x01, 0x3E, 0x01, 0x3F,
+    0x01, 0x40, 0x01, 0x41, 0x00, 0xAC, 0x00, 0xA3, 0x00, 0x84, 0x00, 0x85,
+    0x00, 0xBD, 0x00, 0x96, 0x00, 0xE8, 0x00, 0x86, 0x00, 0x8E, 0x00, 0x8B,
+    0x00, 0x9D, 0x00, 0xA9, 0x00, 0xA4, 0x00, 0xEF, 0x00, 0x8A, 0x00, 0xDA,
+    0x00, 0x83, 0x00, 0x93, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0x8D, 0x00, 0x97,
+    0x00, 0x88, 0x00, 0xC3, 0x00, 0xDE, 0x00, 0xF1, 0x00, 0x9E, 0x00, 0xAA,
+    0x00, 0xF5, 0x00, 0xF4, 0x00, 0xF6, 0x00, 0xA2, 0x00, 0xAD, 0x00, 0xC9,
+    0x00, 0xC7, 0x00, 0xAE, 0x00, 0x62, 0x00, 0x63, 0x00, 0x90, 0x00, 0x64,
+    0x00, 0xCB, 0x00, 0x65, 0x00, 0xC8, 0x00, 0xCA, 0x00, 0xCF, 0x00, 0xCC,
+    0x00, 0xCD, 0x00, 0xCE, 0x00, 0xE9, 0x00, 0x66, 0x00, 0xD3, 0x00, 0xD0,
+    0x00, 0xD1, 0x00, 0xAF, 0x00, 0x67, 0x00, 0xF0, 0x00, 0x91, 0x00, 0xD6,
+    0x00, 0xD4, 0x00, 0xD5, 0x00, 0x68, 0x00, 0xEB, 0x00, 0xED, 0x00, 0x89,
+    0x00, 0x6A, 0x00, 0x69, 0x00, 0x6B, 0x00, 0x6D, 0x00, 0x6C, 0x00, 0x6E,
+    0x00, 0xA0, 0x00, 0x6F, 0x00, 0x71, 0x00, 0x70, 0x00, 0x72, 0x00, 0x73,
+    0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77, 0x00, 0xEA, 0x00, 0x78,
+    0x00, 0x7A, 0x00, 0x79, 0x00, 0x7B, 0x00, 0x7D, 0x00, 0x7C, 0x00, 0xB8,
+    0x00, 0xA1, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x80, 0x00, 0x81, 0x00, 0xEC,
+    0x00, 0xEE, 0x00, 0xBA, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x31, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x32, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30,
+    0x33, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x30, 0x34, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x35, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x36, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30,
+    0x37, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x30, 0x38, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x39, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x61, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30,
+    0x62, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x30, 0x63, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x64, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x65, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30,
+    0x66, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x31, 0x30, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x31, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x32, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31,
+    0x33, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x31, 0x34, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x35, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x36, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31,
+    0x37, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x31, 0x38, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x39, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x61, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31,
+    0x62, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x31, 0x63, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x64, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x65, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31,
+    0x66, 0x06, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x04, 0x45, 0x75, 0x72,
+    0x6F, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x38, 0x31, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x32, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x33, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38,
+    0x34, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x38, 0x35, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x36, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x37, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38,
+    0x38, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x38, 0x39, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x61, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x62, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38,
+    0x63, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x38, 0x64, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x65, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x66, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39,
+    0x30, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x39, 0x31, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x32, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x33, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39,
+    0x34, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x39, 0x35, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x36, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x37, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39,
+    0x38, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x39, 0x39, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x61, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x62, 0x0E, 0x75,
+    0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39,
+    0x63, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78,
+    0x30, 0x30, 0x39, 0x64, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65,
+    0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x65, 0x0E, 0x75, 0x6E, 0x69, 0x63,
+    0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x66, 0x00, 0x00};
+
+unsigned int proggy_clean_size = 41208;
+
+} // namespace tvk
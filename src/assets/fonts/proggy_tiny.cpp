@@ -0,0 +1,2987 @@
+/**
+ * @file proggy_tiny.cpp
+ * @brief Embedded Proggy Tiny font data
+ */
+
+#include "tinyvk/assets/fonts.h"
+
+namespace tvk {
+
+unsigned char proggy_tiny[] = {
+
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x00, 0x03, 0x00, 0x40,
+    0x4F, 0x53, 0x2F, 0x32, 0x87, 0xEB, 0x73, 0x10, 0x00, 0x00, 0x01, 0x48,
+    0x00, 0x00, 0x00, 0x4E, 0x63, 0x6D, 0x61, 0x70, 0x02, 0x12, 0x23, 0x75,
+    0x00, 0x00, 0x03, 0xA0, 0x00, 0x00, 0x01, 0x52, 0x63, 0x76, 0x74, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x02,
+    0x67, 0x6C, 0x79, 0x66, 0xD3, 0xEE, 0x60, 0xD0, 0x00, 0x00, 0x07, 0x04,
+    0x00, 0x00, 0x7C, 0xD4, 0x68, 0x65, 0x61, 0x64, 0xD7, 0x11, 0x68, 0xB2,
+    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
+    0x06, 0xC2, 0x01, 0xC3, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 0x24,
+    0x68, 0x6D, 0x74, 0x78, 0x58, 0x80, 0x4C, 0x80, 0x00, 0x00, 0x01, 0x98,
+    0x00, 0x00, 0x02, 0x06, 0x6C, 0x6F, 0x63, 0x61, 0x45, 0xF3, 0x64, 0xF4,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x04, 0x6D, 0x61, 0x78, 0x70,
+    0x01, 0xA6, 0x00, 0xBA, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0x20,
+    0x6E, 0x61, 0x6D, 0x65, 0x01, 0xFC, 0x6E, 0xBC, 0x00, 0x00, 0x83, 0xD8,
+    0x00, 0x00, 0x01, 0x9B, 0x70, 0x6F, 0x73, 0x74, 0xA6, 0xAC, 0x83, 0xEF,
+    0x00, 0x00, 0x85, 0x74, 0x00, 0x00, 0x05, 0xD2, 0x70, 0x72, 0x65, 0x70,
+    0x69, 0x02, 0x01, 0x12, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF6, 0xA4, 0x10, 0xEA,
+    0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB7, 0x67, 0x77, 0x84, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x92, 0xA9, 0x33,
+    0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x03, 0xC0, 0xFE, 0xC0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x01, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x08, 0x00, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x76, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x90, 0x00, 0x05,
+    0x00, 0x00, 0x02, 0xBC, 0x02, 0x8A, 0x00, 0x00, 0x00, 0x8F, 0x02, 0xBC,
+    0x02, 0x8A, 0x00, 0x00, 0x01, 0xC5, 0x00, 0x32, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x41, 0x6C, 0x74, 0x73, 0x00, 0x40, 0x00, 0x00, 0x20, 0xAC,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C,
+    0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7F,
+    0x00, 0xFF, 0x20, 0xAC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81,
+    0x20, 0xAC, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xDF, 0xD5, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0x00, 0x01, 0x8D,
+    0xB8, 0x01, 0xFF, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C,
+    0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C,
+    0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C,
+    0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C,
+    0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C,
+    0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C,
+    0x00, 0x9C, 0x00, 0x9C, 0x00, 0x9C, 0x00, 0xC6, 0x00, 0xEE, 0x01, 0x50,
+    0x01, 0xB0, 0x02, 0x04, 0x02, 0x66, 0x02, 0x7E, 0x02, 0xB8, 0x02, 0xF0,
+    0x03, 0x32, 0x03, 0x68, 0x03, 0x7A, 0x03, 0x98, 0x03, 0xA4, 0x03, 0xE0,
+    0x04, 0x42, 0x04, 0x7E, 0x04, 0xD2, 0x05, 0x22, 0x05, 0x74, 0x05, 0xD0,
+    0x06, 0x26, 0x06, 0x66, 0x06, 0xC8, 0x07, 0x1E, 0x07, 0x32, 0x07, 0x4C,
+    0x07, 0x7C, 0x07, 0xB2, 0x07, 0xE2, 0x08, 0x1A, 0x08, 0x9E, 0x08, 0xEC,
+    0x09, 0x5A, 0x09, 0xA6, 0x0A, 0x04, 0x0A, 0x64, 0x0A, 0xB2, 0x0B, 0x14,
+    0x0B, 0x78, 0x0B, 0xB8, 0x0B, 0xFE, 0x0C, 0x52, 0x0C, 0x92, 0x0D, 0x02,
+    0x0D, 0x78, 0x0D, 0xD6, 0x0E, 0x2C, 0x0E, 0x94, 0x0E, 0xFA, 0x0F, 0x4E,
+    0x0F, 0x8E, 0x0F, 0xE8, 0x10, 0x32, 0x10, 0x94, 0x10, 0xE4, 0x11, 0x2C,
+    0x11, 0x80, 0x11, 0xCC, 0x12, 0x02, 0x12, 0x4E, 0x12, 0x72, 0x12, 0x94,
+    0x12, 0xA6, 0x12, 0xF4, 0x13, 0x54, 0x13, 0x92, 0x13, 0xF4, 0x14, 0x46,
+    0x14, 0x92, 0x14, 0xF2, 0x15, 0x4A, 0x15, 0x78, 0x15, 0xBA, 0x16, 0x08,
+    0x16, 0x40, 0x16, 0x96, 0x16, 0xDE, 0x17, 0x26, 0x17, 0x82, 0x17, 0xDE,
+    0x18, 0x14, 0x18, 0x5A, 0x18, 0x9A, 0x18, 0xE2, 0x19, 0x1C, 0x19, 0x64,
+    0x19, 0x9E, 0x19, 0xFA, 0x1A, 0x42, 0x1A, 0x7C, 0x1A, 0xB6, 0x1A, 0xEE,
+    0x1B, 0x14, 0x1B, 0x14, 0x1B, 0x7E, 0x1B, 0x7E, 0x1B, 0x90, 0x1B, 0xDE,
+    0x1B, 0xFA, 0x1C, 0x10, 0x1C, 0x5C, 0x1C, 0xBC, 0x1C, 0xD4, 0x1D, 0x18,
+    0x1D, 0x7A, 0x1D, 0x9E, 0x1E, 0x0A, 0x1E, 0x0A, 0x1E, 0x64, 0x1E, 0x64,
+    0x1E, 0x64, 0x1E, 0x7C, 0x1E, 0x94, 0x1E, 0xBC, 0x1E, 0xE4, 0x1F, 0x00,
+    0x1F, 0x1E, 0x1F, 0x40, 0x1F, 0x5E, 0x1F, 0xB4, 0x20, 0x0C, 0x20, 0x30,
+    0x20, 0x86, 0x20, 0x86, 0x20, 0xE0, 0x21, 0x30, 0x21, 0x30, 0x21, 0x5A,
+    0x21, 0xA2, 0x21, 0xFC, 0x22, 0x58, 0x22, 0xAE, 0x22, 0xE2, 0x23, 0x4A,
+    0x23, 0x5C, 0x23, 0xDA, 0x24, 0x0C, 0x24, 0x4C, 0x24, 0x76, 0x24, 0x76,
+    0x24, 0xEC, 0x25, 0x0A, 0x25, 0x28, 0x25, 0x76, 0x25, 0xA6, 0x25, 0xD6,
+    0x25, 0xEA, 0x26, 0x3E, 0x26, 0xCC, 0x26, 0xDA, 0x26, 0xF6, 0x27, 0x28,
+    0x27, 0x52, 0x27, 0x92, 0x28, 0x02, 0x28, 0x6E, 0x28, 0xEC, 0x29, 0x24,
+    0x29, 0x6C, 0x29, 0xB6, 0x2A, 0x06, 0x2A, 0x5A, 0x2A, 0xA4, 0x2A, 0xF8,
+    0x2B, 0x68, 0x2B, 0xC0, 0x2C, 0x20, 0x2C, 0x82, 0x2C, 0xEA, 0x2D, 0x4A,
+    0x2D, 0x8C, 0x2D, 0xCE, 0x2E, 0x16, 0x2E, 0x58, 0x2E, 0xC4, 0x2F, 0x32,
+    0x2F, 0x84, 0x2F, 0xD8, 0x30, 0x32, 0x30, 0x90, 0x30, 0xE2, 0x31, 0x1C,
+    0x31, 0x78, 0x31, 0xC8, 0x32, 0x18, 0x32, 0x6E, 0x32, 0xBE, 0x33, 0x0E,
+    0x33, 0x60, 0x33, 0xC8, 0x34, 0x20, 0x34, 0x7A, 0x34, 0xDA, 0x35, 0x3E,
+    0x35, 0x96, 0x35, 0xFA, 0x36, 0x4E, 0x36, 0x98, 0x36, 0xF6, 0x37, 0x54,
+    0x37, 0xB8, 0x38, 0x16, 0x38, 0x48, 0x38, 0x7C, 0x38, 0xB6, 0x38, 0xE8,
+    0x39, 0x42, 0x39, 0xA2, 0x39, 0xF4, 0x3A, 0x48, 0x3A, 0xA2, 0x3B, 0x00,
+    0x3B, 0x52, 0x3B, 0x7E, 0x3B, 0xDA, 0x3C, 0x2E, 0x3C, 0x84, 0x3C, 0xDE,
+    0x3D, 0x32, 0x3D, 0x9C, 0x3E, 0x02, 0x3E, 0x6A, 0x00, 0x1C, 0x00, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x5B, 0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x6B,
+    0x00, 0x6F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80, 0x02,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x80,
+    0x02, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x09, 0x00, 0x80, 0xFF, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x80,
+    0xFF, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0B, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x02, 0x00, 0x80, 0xFF, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x01, 0x80, 0x02, 0x80, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x03,
+    0x00, 0x00, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0xFF, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0A, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x00,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x02, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0A, 0x00, 0x00, 0x01, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x63, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x15, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x80, 0xFF, 0x80, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0xFF, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0D, 0x00, 0x80, 0xFF, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0x02, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+    0xFF, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x15, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x07, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x03, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0D, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0xFF, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0B, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0xFF, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x09, 0x00, 0x80, 0xFF, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00,
+    0xFF, 0x80, 0x01, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x80, 0xFF, 0x80, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x06, 0x00, 0x00,
+    0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+    0xFF, 0x80, 0x02, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x80,
+    0xFF, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x00, 0x80,
+    0xFF, 0x80, 0x02, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0D, 0x00, 0x00, 0xFF, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0xFF, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x80,
+    0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0B, 0x00, 0x00,
+    0x00, 0x80, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x06, 0x00, 0x80, 0x02, 0x80, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x80, 0x02, 0x80, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x04, 0x01, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x80,
+    0x01, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x01, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x04, 0x00, 0x80, 0x01, 0x00, 0x02, 0x80, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x05, 0x01, 0x00, 0x00, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x02, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x02, 0x00, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0xFF, 0x80, 0x01, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x02, 0x00, 0x80, 0x03, 0x00, 0x02, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x08, 0x00, 0x80, 0x01, 0x80, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x01,
+    0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x07, 0x00, 0x80, 0x00, 0x00, 0x02, 0x80,
+    0x02, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x02, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFD, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x04, 0x00, 0x80, 0x02, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x08, 0x00, 0x80, 0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x08, 0x00, 0x80, 0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x02, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x1A, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53, 0x00, 0x57, 0x00, 0x5B,
+    0x00, 0x5F, 0x00, 0x63, 0x00, 0x67, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x01, 0x80, 0x01, 0x80, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0x00, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x00,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x08, 0x00, 0x80, 0x01, 0x80, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x06, 0x00, 0x80, 0x02, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x00,
+    0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0x02, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x00, 0xFF, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0xFF, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x02, 0x00, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x16, 0x00, 0x00,
+    0xFF, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x4F, 0x00, 0x53,
+    0x00, 0x57, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x01, 0x00,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x11, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x4F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0xFF, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0B, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0C, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0B, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x4B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x09, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80,
+    0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x00, 0x11, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,
+    0x00, 0x0E, 0x00, 0x80, 0xFF, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01,
+    0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0xFF, 0x80, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x00, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x00, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00,
+    0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0xFF, 0x00, 0x02, 0x80, 0x02, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x02, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43, 0x00, 0x00, 0x13, 0x35,
+    0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80,
+    0x00, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x01, 0x80, 0x04, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x03, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x09, 0x00, 0x80,
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0x80,
+    0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x1D, 0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x03, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE,
+    0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD,
+    0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80,
+    0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80,
+    0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x00, 0x01, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x03,
+    0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B,
+    0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x33, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x01, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x00, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x00, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x13, 0x35, 0x33, 0x1D,
+    0x01, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80,
+    0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80,
+    0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80,
+    0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0xFF, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x00, 0x01, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x33, 0x35,
+    0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35,
+    0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35,
+    0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35,
+    0x33, 0x15, 0x01, 0x00, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80,
+    0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x80, 0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x00,
+    0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00,
+    0xFF, 0x00, 0x02, 0x80, 0x04, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B,
+    0x00, 0x0F, 0x00, 0x13, 0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23,
+    0x00, 0x27, 0x00, 0x2B, 0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B,
+    0x00, 0x3F, 0x00, 0x43, 0x00, 0x47, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x01, 0x00, 0x80, 0xFF,
+    0x00, 0x80, 0xFF, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x11, 0x35, 0x33, 0x15, 0x07, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80,
+    0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x12, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x80,
+    0x03, 0x80, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x13,
+    0x00, 0x17, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x23, 0x00, 0x27, 0x00, 0x2B,
+    0x00, 0x2F, 0x00, 0x33, 0x00, 0x37, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x43,
+    0x00, 0x47, 0x00, 0x00, 0x13, 0x35, 0x33, 0x15, 0x33, 0x35, 0x33, 0x15,
+    0x01, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15,
+    0x05, 0x35, 0x33, 0x15, 0x21, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x07, 0x35, 0x33, 0x15, 0x05, 0x35, 0x33, 0x15, 0x31, 0x35, 0x33, 0x15,
+    0x31, 0x35, 0x33, 0x15, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFD, 0x80, 0x80, 0x01,
+    0x80, 0x80, 0xFD, 0x80, 0x80, 0x01, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFE, 0x00, 0x80, 0x80, 0x80, 0x03, 0x00, 0x80,
+    0x80, 0x80, 0x80, 0xFF, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0E,
+    0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C,
+    0x00, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07,
+    0x00, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10,
+    0x00, 0x2D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0C,
+    0x00, 0x31, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0A,
+    0x00, 0x3D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0C,
+    0x00, 0x31, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x47, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E,
+    0x00, 0x6B, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x20,
+    0x00, 0x79, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x18,
+    0x00, 0x81, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x34, 0x00, 0x2F,
+    0x00, 0x30, 0x00, 0x34, 0x00, 0x2F, 0x00, 0x31, 0x00, 0x35, 0x62, 0x79,
+    0x20, 0x54, 0x72, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x20, 0x47, 0x72, 0x69,
+    0x6D, 0x6D, 0x65, 0x72, 0x52, 0x65, 0x67, 0x75, 0x6C, 0x61, 0x72, 0x54,
+    0x54, 0x58, 0x20, 0x50, 0x72, 0x6F, 0x67, 0x67, 0x79, 0x54, 0x69, 0x6E,
+    0x79, 0x54, 0x54, 0x32, 0x30, 0x30, 0x34, 0x2F, 0x30, 0x34, 0x2F, 0x31,
+    0x35, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x54, 0x00, 0x72, 0x00,
+    0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x61, 0x00, 0x6E, 0x00, 0x20, 0x00,
+    0x47, 0x00, 0x72, 0x00, 0x69, 0x00, 0x6D, 0x00, 0x6D, 0x00, 0x65, 0x00,
+    0x72, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00,
+    0x61, 0x00, 0x72, 0x00, 0x54, 0x00, 0x54, 0x00, 0x58, 0x00, 0x20, 0x00,
+    0x50, 0x00, 0x72, 0x00, 0x6F, 0x00, 0x67, 0x00, 0x67, 0x00, 0x79, 0x00,
+    0x54, 0x00, 0x69, 0x00, 0x6E, 0x00, 0x79, 0x00, 0x54, 0x00, 0x54, 0x00,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x01, 0x03, 0x01, 0x04, 0x01, 0x05, 0x01, 0x06,
+    0x01, 0x07, 0x01, 0x08, 0x01, 0x09, 0x01, 0x0A, 0x01, 0x0B, 0x01, 0x0C,
+    0x01, 0x0D, 0x01, 0x0E, 0x01, 0x0F, 0x01, 0x10, 0x01, 0x11, 0x01, 0x12,
+    0x01, 0x13, 0x01, 0x14, 0x01, 0x15, 0x01, 0x16, 0x01, 0x17, 0x01, 0x18,
+    0x01, 0x19, 0x01, 0x1A, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1D, 0x01, 0x1E,
+    0x01, 0x1F, 0x01, 0x20, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x0B, 0x00, 0x0C,
+    0x00, 0x0D, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
+    0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
+    0x00, 0x19, 0x00, 0x1A, 0x00, 0x1B, 0x00, 0x1C, 0x00, 0x1D, 0x00, 0x1E,
+    0x00, 0x1F, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
+    0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2A,
+    0x00, 0x2B, 0x00, 0x2C, 0x00, 0x2D, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x30,
+    0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
+    0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3A, 0x00, 0x3B, 0x00, 0x3C,
+    0x00, 0x3D, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
+    0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
+    0x00, 0x49, 0x00, 0x4A, 0x00, 0x4B, 0x00, 0x4C, 0x00, 0x4D, 0x00, 0x4E,
+    0x00, 0x4F, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
+    0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5A,
+    0x00, 0x5B, 0x00, 0x5C, 0x00, 0x5D, 0x00, 0x5E, 0x00, 0x5F, 0x00, 0x60,
+    0x00, 0x61, 0x01, 0x21, 0x01, 0x22, 0x01, 0x23, 0x01, 0x24, 0x01, 0x25,
+    0x01, 0x26, 0x01, 0x27, 0x01, 0x28, 0x01, 0x29, 0x01, 0x2A, 0x01, 0x2B,
+    0x01, 0x2C, 0x01, 0x2D, 0x01, 0x2E, 0x01, 0x2F, 0x01, 0x30, 0x01, 0x31,
+    0x01, 0x32, 0x01, 0x33, 0x01, 0x34, 0x01, 0x35, 0x01, 0x36, 0x01, 0x37,
+    0x01, 0x38, 0x01, 0x39, 0x01, 0x3A, 0x01, 0x3B, 0x01, 0x3C, 0x01, 0x3D,
+    0x01, 0x3E, 0x01, 0x3F, 0x01, 0x40, 0x01, 0x41, 0x00, 0xAC, 0x00, 0xA3,
+    0x00, 0x84, 0x00, 0x85, 0x00, 0xBD, 0x00, 0x96, 0x00, 0xE8, 0x00, 0x86,
+    0x00, 0x8E, 0x00, 0x8B, 0x00, 0x9D, 0x00, 0xA9, 0x00, 0xA4, 0x00, 0xEF,
+    0x00, 0x8A, 0x00, 0xDA, 0x00, 0x83, 0x00, 0x93, 0x00, 0xF2, 0x00, 0xF3,
+    0x00, 0x8D, 0x00, 0x97, 0x00, 0x88, 0x00, 0xC3, 0x00, 0xDE, 0x00, 0xF1,
+    0x00, 0x9E, 0x00, 0xAA, 0x00, 0xF5, 0x00, 0xF4, 0x00, 0xF6, 0x00, 0xA2,
+    0x00, 0xAD, 0x00, 0xC9, 0x00, 0xC7, 0x00, 0xAE, 0x00, 0x62, 0x00, 0x63,
+    0x00, 0x90, 0x00, 0x64, 0x00, 0xCB, 0x00, 0x65, 0x00, 0xC8, 0x00, 0xCA,
+    0x00, 0xCF, 0x00, 0xCC, 0x00, 0xCD, 0x00, 0xCE, 0x00, 0xE9, 0x00, 0x66,
+    0x00, 0xD3, 0x00, 0xD0, 0x00, 0xD1, 0x00, 0xAF, 0x00, 0x67, 0x00, 0xF0,
+    0x00, 0x91, 0x00, 0xD6, 0x00, 0xD4, 0x00, 0xD5, 0x00, 0x68, 0x00, 0xEB,
+    0x00, 0xED, 0x00, 0x89, 0x00, 0x6A, 0x00, 0x69, 0x00, 0x6B, 0x00, 0x6D,
+    0x00, 0x6C, 0x00, 0x6E, 0x00, 0xA0, 0x00, 0x6F, 0x00, 0x71, 0x00, 0x70,
+    0x00, 0x72, 0x00, 0x73, 0x00, 0x75, 0x00, 0x74, 0x00, 0x76, 0x00, 0x77,
+    0x00, 0xEA, 0x00, 0x78, 0x00, 0x7A, 0x00, 0x79, 0x00, 0x7B, 0x00, 0x7D,
+    0x00, 0x7C, 0x00, 0xB8, 0x00, 0xA1, 0x00, 0x7F, 0x00, 0x7E, 0x00, 0x80,
+    0x00, 0x81, 0x00, 0xEC, 0x00, 0xEE, 0x00, 0xBA, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x31, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x30, 0x32, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x30, 0x33, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x34, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x35, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x30, 0x36, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x30, 0x37, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x38, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x39, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x30, 0x61, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x30, 0x62, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x63, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x30, 0x64, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x30, 0x65, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x30, 0x66, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x30, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x31, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x31, 0x32, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x31, 0x33, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x34, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x35, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x31, 0x36, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x31, 0x37, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x38, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x39, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x31, 0x61, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x31, 0x62, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x63, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x31, 0x64, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x31, 0x65, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x31, 0x66, 0x06, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65,
+    0x04, 0x45, 0x75, 0x72, 0x6F, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x31, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x32, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x38, 0x33, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x38, 0x34, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x35, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x36, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x38, 0x37, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x38, 0x38, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x39, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x61, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x38, 0x62, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x38, 0x63, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x64, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x38, 0x65, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x38, 0x66, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x39, 0x30, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x31, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x32, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x39, 0x33, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x39, 0x34, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x35, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x36, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x39, 0x37, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x39, 0x38, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x39, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x61, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x39, 0x62, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30,
+    0x78, 0x30, 0x30, 0x39, 0x63, 0x0E, 0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64,
+    0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x64, 0x0E, 0x75, 0x6E, 0x69,
+    0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30, 0x39, 0x65, 0x0E,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x23, 0x30, 0x78, 0x30, 0x30,
+    0x39, 0x66, 0x00, 0x00};
+
+unsigned int proggy_tiny_size = 35656;
+
+} // namespace tvk
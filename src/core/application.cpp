@@ -1,6 +1,8 @@
 #include "tinyvk/core/application.h"
 #include "tinyvk/core/input.h"
+#include "tinyvk/core/job_system.h"
 #include "tinyvk/core/log.h"
+#include "tinyvk/core/timer.h"
 #include "tinyvk/renderer/renderer.h"
 #include "tinyvk/ui/imgui_layer.h"
 #include "tinyvk/ui/render_widget.h"
@@ -9,6 +11,8 @@
 #include <windows.h>
 #endif
 
+#include <algorithm>
+
 namespace tvk {
 
 App::App() {
@@ -38,14 +42,32 @@ void App::Run(const AppConfig& config) {
     }
     _instance = this;
 
+    bool ownsLog = false;
+    if (!Log::IsInitialized()) {
+        LogConfig logConfig;
+        logConfig.async = config.asyncLogging;
+        if (!config.logFile.empty()) {
+            logConfig.files.push_back(config.logFile);
+        }
+        Log::Init(logConfig);
+        ownsLog = true;
+    }
+
     Initialize(config);
     OnStart();
 
     _running = true;
+    Profiler::instance().setThreadName("Main");
+    StartSimulationThread();
     MainLoop();
+    StopSimulationThread();
 
     OnStop();
     Shutdown();
+
+    if (ownsLog) {
+        Log::Shutdown();
+    }
 }
 
 void App::Initialize(const AppConfig& config) {
@@ -53,6 +75,14 @@ void App::Initialize(const AppConfig& config) {
     
     _mode = config.mode;
     _enableDockspace = config.enableDockspace;
+    _onDemand = config.onDemand;
+    _idleRedrawInterval = config.idleRedrawInterval;
+    _fixedTimestep = std::max(config.fixedTimestep, 0.0f);
+    _maxFixedSteps = std::max(config.maxFixedSteps, 1u);
+    _threadedSimulation = config.threadedSimulation;
+
+    _jobs = CreateScope<JobSystem>();
+    _jobs->Init(config.workerThreads);
 
     WindowConfig windowConfig;
     windowConfig.title = config.title;
@@ -80,12 +110,16 @@ void App::Initialize(const AppConfig& config) {
     rendererConfig.enableValidation = false;
 #endif
     rendererConfig.vsync = config.vsync;
+    rendererConfig.lowLatency = config.lowLatency;
+    rendererConfig.maxFramesInFlight = config.maxFramesInFlight;
+    rendererConfig.recordingThreads = _jobs->GetWorkerCount();
 
     _renderer = CreateScope<Renderer>();
     if (!_renderer->Init(_window.get(), rendererConfig)) {
         TVK_LOG_FATAL("Failed to initialize renderer");
         return;
     }
+    _renderer->SetWakeCallback([this]() { RequestRedraw(); });
 
     ImGuiConfig imguiConfig;
     imguiConfig.enableDocking = true;
@@ -105,6 +139,8 @@ void App::Initialize(const AppConfig& config) {
 void App::Shutdown() {
     TVK_LOG_INFO("Shutting down TinyVK Application");
 
+    _jobs->Cleanup();
+
     _renderer->GetContext().WaitIdle();
     
     for (auto* widget : _widgets) {
@@ -119,6 +155,7 @@ void App::Shutdown() {
     _renderer.reset();
 
     _window.reset();
+    _jobs.reset();
 
     TVK_LOG_INFO("TinyVK shutdown complete");
 }
@@ -128,6 +165,17 @@ void App::MainLoop() {
     float fpsTimer = 0.0f;
 
     while (_running && !_window->ShouldClose()) {
+        // Nothing changed, sleep until an event, a request or the idle redraw wakes the loop
+        if (_onDemand && !IsRedrawDue()) {
+            WaitForRedraw();
+            continue;
+        }
+        
+        // Returns when the frame should start, input and timing are sampled right after
+        _renderer->PaceFrame();
+        
+        TVK_PROFILE_SCOPE("Frame");
+        
         auto currentTime = std::chrono::high_resolution_clock::now();
         _deltaTime = std::chrono::duration<float>(currentTime - _lastFrameTime).count();
         _lastFrameTime = currentTime;
@@ -149,7 +197,18 @@ void App::MainLoop() {
             continue;
         }
 
-        OnUpdate();
+        if (_onDemand) {
+            BeginRedraw();
+        }
+
+        if (_fixedTimestep > 0.0f) {
+            StepSimulation();
+        }
+
+        {
+            TVK_PROFILE_SCOPE("OnUpdate");
+            OnUpdate();
+        }
 
         if (_renderer->BeginFrame()) {
             OnPreRender();
@@ -180,15 +239,159 @@ void App::MainLoop() {
                     }
                 }
                 
-                _imguiLayer->End(_renderer->GetCurrentCommandBuffer());
+                VkCommandBuffer uiCmd = _renderer->GetCurrentCommandBuffer();
+                u32 uiScope = _renderer->GetGpuProfiler().BeginScope(uiCmd, "ImGui");
+                _imguiLayer->End(uiCmd);
+                _renderer->GetGpuProfiler().EndScope(uiCmd, uiScope);
             }
             
             OnPostRender();
             _renderer->EndFrame();
         }
+        
+        // Events of every thread, including the previous frame's scope
+        Profiler::instance().collect();
+    }
+}
+
+bool App::IsRedrawDue() const {
+    // A running simulation needs the loop to advance its time
+    if (_fixedTimestep > 0.0f) return true;
+    if (_redrawFrames > 0 || _redrawRequested.load(std::memory_order_relaxed)) return true;
+    if (_window->GetEventCount() != _seenEventCount) return true;
+    
+    // Loads, uploads and compute readbacks only advance in BeginFrame()
+    if (_renderer->HasBackgroundWork()) return true;
+    
+    float now = Now();
+    if (now < _animateUntil) return true;
+    if (_idleRedrawInterval > 0.0f && now - _lastRedrawTime >= _idleRedrawInterval) return true;
+    
+    for (auto* widget : _widgets) {
+        if (widget->IsEnabled() && widget->IsAnimating()) return true;
+    }
+    return false;
+}
+
+void App::WaitForRedraw() {
+    if (_idleRedrawInterval > 0.0f) {
+        float remaining = _idleRedrawInterval - (Now() - _lastRedrawTime);
+        _window->WaitEventsTimeout(std::max(remaining, 0.001f));
+    } else {
+        _window->WaitEvents();
+    }
+}
+
+void App::BeginRedraw() {
+    // This frame satisfies every request made so far, later ones render another frame
+    _redrawRequested.store(false, std::memory_order_relaxed);
+    
+    // ImGui needs a few frames to settle after input, e.g. for hover state and layout changes
+    constexpr u32 settleFrames = 2;
+    u64 events = _window->GetEventCount();
+    if (events != _seenEventCount) {
+        _seenEventCount = events;
+        _redrawFrames = settleFrames;
+    } else if (_redrawFrames > 0) {
+        _redrawFrames--;
+    }
+    
+    _lastRedrawTime = Now();
+}
+
+float App::Now() const {
+    return std::chrono::duration<float>(std::chrono::high_resolution_clock::now() - _startTime).count();
+}
+
+void App::StepSimulation() {
+    // Time beyond maxFixedSteps is dropped, a slow frame would otherwise make the next one slower
+    _fixedAccumulator = std::min(_fixedAccumulator + _deltaTime, _fixedTimestep * static_cast<float>(_maxFixedSteps));
+    u32 steps = static_cast<u32>(_fixedAccumulator / _fixedTimestep);
+    _fixedAccumulator -= static_cast<float>(steps) * _fixedTimestep;
+    float alpha = _fixedAccumulator / _fixedTimestep;
+    _fixedStepCount += steps;
+    
+    if (!_simThread.joinable()) {
+        for (u32 i = 0; i < steps; i++) {
+            TVK_PROFILE_SCOPE("OnFixedUpdate");
+            OnFixedUpdate(_fixedTimestep);
+        }
+        _fixedAlpha = alpha;
+        return;
+    }
+    
+    // The previous batch is handed to rendering before the next one starts
+    WaitForSimulation();
+    OnFixedSync();
+    _fixedAlpha = _pendingAlpha;
+    _pendingAlpha = alpha;
+    
+    if (steps > 0) {
+        {
+            std::lock_guard<std::mutex> lock(_simMutex);
+            _simSteps = steps;
+        }
+        _simWake.notify_one();
     }
 }
 
+void App::StartSimulationThread() {
+    if (!_threadedSimulation || _fixedTimestep <= 0.0f) return;
+    
+    _simExit = false;
+    _simSteps = 0;
+    _simThread = std::thread([this]() { SimulationThread(); });
+}
+
+void App::StopSimulationThread() {
+    if (!_simThread.joinable()) return;
+    
+    WaitForSimulation();
+    {
+        std::lock_guard<std::mutex> lock(_simMutex);
+        _simExit = true;
+    }
+    _simWake.notify_one();
+    _simThread.join();
+}
+
+void App::WaitForSimulation() {
+    std::unique_lock<std::mutex> lock(_simMutex);
+    _simDone.wait(lock, [this]() { return _simSteps == 0; });
+}
+
+void App::SimulationThread() {
+    Profiler::instance().setThreadName("Simulation");
+    
+    std::unique_lock<std::mutex> lock(_simMutex);
+    while (true) {
+        _simWake.wait(lock, [this]() { return _simSteps > 0 || _simExit; });
+        if (_simExit) return;
+        
+        u32 steps = _simSteps;
+        lock.unlock();
+        for (u32 i = 0; i < steps; i++) {
+            TVK_PROFILE_SCOPE("OnFixedUpdate");
+            OnFixedUpdate(_fixedTimestep);
+        }
+        lock.lock();
+        
+        _simSteps = 0;
+        _simDone.notify_all();
+    }
+}
+
+void App::RequestRedraw() {
+    _redrawRequested.store(true, std::memory_order_relaxed);
+    if (_window) {
+        Window::PostEmptyEvent();
+    }
+}
+
+void App::RequestAnimation(float seconds) {
+    _animateUntil = std::max(_animateUntil, Now() + seconds);
+}
+
 u32 App::WindowWidth() const {
     return _window->GetExtent().width;
 }
@@ -246,4 +449,20 @@ void App::SetClearColor(float r, float g, float b, float a) {
     _renderer->SetClearColor({r, g, b, a});
 }
 
+JobSystem& App::GetJobs() {
+    return *_jobs;
+}
+
+void App::RecordParallel(u32 count, u32 chunkSize, const std::function<void(VkCommandBuffer, u32, u32)>& function) {
+    // Worker indices match the renderer's recording threads, merged by EndFrame()
+    _jobs->ParallelFor(count, chunkSize, [this, &function](u32 begin, u32 end) {
+        u32 worker = JobSystem::GetWorkerIndex();
+        VkCommandBuffer cmd = _renderer->BeginSecondaryCommands(worker);
+        if (cmd == VK_NULL_HANDLE) return;
+        
+        function(cmd, begin, end);
+        _renderer->EndSecondaryCommands(worker, cmd);
+    });
+}
+
 } // namespace tvk
@@ -9,44 +9,61 @@ namespace tvk {
 
 void Input::Init(GLFWwindow* window) {
     s_Window = window;
-    s_FirstMouse = true;
-    s_LastMousePos = GetMousePosition();
-    
-    glfwSetScrollCallback(window, ScrollCallback);
+
+    double x, y;
+    glfwGetCursorPos(window, &x, &y);
+    s_Pending = InputSnapshot{};
+    s_Pending.mousePosition = {static_cast<float>(x), static_cast<float>(y)};
+    s_Pending.time = std::chrono::steady_clock::now();
+    s_Snapshot = s_Pending;
+
+    s_Events.clear();
+    s_PendingEvents.clear();
+    s_Events.reserve(256);
+    s_PendingEvents.reserve(256);
+
+    // Chained so the window still sees the events
+    s_PrevKeyCallback = glfwSetKeyCallback(window, KeyCallback);
+    s_PrevCharCallback = glfwSetCharCallback(window, CharCallback);
+    s_PrevMouseButtonCallback = glfwSetMouseButtonCallback(window, MouseButtonCallback);
+    s_PrevCursorPosCallback = glfwSetCursorPosCallback(window, CursorPosCallback);
+    s_PrevScrollCallback = glfwSetScrollCallback(window, ScrollCallback);
 }
 
 bool Input::IsKeyPressed(Key key) {
-    int state = glfwGetKey(s_Window, static_cast<int>(key));
-    return state == GLFW_PRESS || state == GLFW_REPEAT;
+    return s_Snapshot.IsKeyHeld(key);
 }
 
 bool Input::IsKeyDown(Key key) {
-    // Note: For proper implementation, you'd need to track previous frame state
-    return glfwGetKey(s_Window, static_cast<int>(key)) == GLFW_PRESS;
+    return s_Snapshot.IsKeyPressed(key);
 }
 
 bool Input::IsKeyUp(Key key) {
-    // Note: For proper implementation, you'd need to track previous frame state
-    return glfwGetKey(s_Window, static_cast<int>(key)) == GLFW_RELEASE;
+    return s_Snapshot.IsKeyReleased(key);
 }
 
 bool Input::IsMouseButtonPressed(MouseButton button) {
-    int state = glfwGetMouseButton(s_Window, static_cast<int>(button));
-    return state == GLFW_PRESS;
+    return s_Snapshot.IsButtonHeld(button);
+}
+
+bool Input::IsMouseButtonDown(MouseButton button) {
+    return s_Snapshot.IsButtonPressed(button);
+}
+
+bool Input::IsMouseButtonUp(MouseButton button) {
+    return s_Snapshot.IsButtonReleased(button);
 }
 
 Vec2 Input::GetMousePosition() {
-    double x, y;
-    glfwGetCursorPos(s_Window, &x, &y);
-    return {static_cast<float>(x), static_cast<float>(y)};
+    return s_Snapshot.mousePosition;
 }
 
 Vec2 Input::GetMouseDelta() {
-    return s_MouseDelta;
+    return s_Snapshot.mouseDelta;
 }
 
 Vec2 Input::GetScrollDelta() {
-    return s_ScrollDelta;
+    return s_Snapshot.scrollDelta;
 }
 
 void Input::SetCursorMode(int mode) {
@@ -54,22 +71,115 @@ void Input::SetCursorMode(int mode) {
 }
 
 void Input::Update() {
-    Vec2 currentPos = GetMousePosition();
-    
-    if (s_FirstMouse) {
-        s_LastMousePos = currentPos;
-        s_FirstMouse = false;
+    s_Pending.mouseDelta = s_Pending.mousePosition - s_Snapshot.mousePosition;
+    s_Pending.time = std::chrono::steady_clock::now();
+    s_Snapshot = s_Pending;
+
+    // Edges and deltas start over, held state carries into the next frame
+    s_Pending.keysPressed.reset();
+    s_Pending.keysReleased.reset();
+    s_Pending.buttonsPressed.reset();
+    s_Pending.buttonsReleased.reset();
+    s_Pending.scrollDelta = {0.0f, 0.0f};
+
+    s_Events.swap(s_PendingEvents);
+    s_PendingEvents.clear();
+}
+
+void Input::PushEvent(const InputEvent& event) {
+    if (s_PendingEvents.size() < MaxEventsPerFrame) {
+        s_PendingEvents.push_back(event);
+    }
+}
+
+void Input::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    if (key >= 0 && static_cast<u32>(key) < InputSnapshot::KeyCount) {
+        if (action == GLFW_PRESS) {
+            s_Pending.keysHeld.set(key);
+            s_Pending.keysPressed.set(key);
+        } else if (action == GLFW_RELEASE) {
+            s_Pending.keysHeld.reset(key);
+            s_Pending.keysReleased.set(key);
+        }
+    }
+
+    InputEvent event;
+    event.type = InputEventType::Key;
+    event.code = key;
+    event.action = action;
+    event.mods = mods;
+    event.time = std::chrono::steady_clock::now();
+    PushEvent(event);
+
+    if (s_PrevKeyCallback) {
+        s_PrevKeyCallback(window, key, scancode, action, mods);
+    }
+}
+
+void Input::CharCallback(GLFWwindow* window, unsigned int codepoint) {
+    InputEvent event;
+    event.type = InputEventType::Char;
+    event.code = static_cast<i32>(codepoint);
+    event.time = std::chrono::steady_clock::now();
+    PushEvent(event);
+
+    if (s_PrevCharCallback) {
+        s_PrevCharCallback(window, codepoint);
+    }
+}
+
+void Input::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+    if (button >= 0 && static_cast<u32>(button) < InputSnapshot::MouseButtonCount) {
+        if (action == GLFW_PRESS) {
+            s_Pending.buttonsHeld.set(button);
+            s_Pending.buttonsPressed.set(button);
+        } else if (action == GLFW_RELEASE) {
+            s_Pending.buttonsHeld.reset(button);
+            s_Pending.buttonsReleased.set(button);
+        }
+    }
+
+    InputEvent event;
+    event.type = InputEventType::MouseButton;
+    event.code = button;
+    event.action = action;
+    event.mods = mods;
+    event.value = s_Pending.mousePosition;
+    event.time = std::chrono::steady_clock::now();
+    PushEvent(event);
+
+    if (s_PrevMouseButtonCallback) {
+        s_PrevMouseButtonCallback(window, button, action, mods);
+    }
+}
+
+void Input::CursorPosCallback(GLFWwindow* window, double x, double y) {
+    s_Pending.mousePosition = {static_cast<float>(x), static_cast<float>(y)};
+
+    InputEvent event;
+    event.type = InputEventType::MouseMove;
+    event.value = s_Pending.mousePosition;
+    event.time = std::chrono::steady_clock::now();
+    PushEvent(event);
+
+    if (s_PrevCursorPosCallback) {
+        s_PrevCursorPosCallback(window, x, y);
     }
-    
-    s_MouseDelta = currentPos - s_LastMousePos;
-    s_LastMousePos = currentPos;
-    
-    // Reset scroll delta each frame
-    s_ScrollDelta = {0.0f, 0.0f};
 }
 
 void Input::ScrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
-    s_ScrollDelta = {static_cast<float>(xoffset), static_cast<float>(yoffset)};
+    // Summed, several scroll events can arrive within one frame
+    s_Pending.scrollDelta += Vec2(static_cast<float>(xoffset), static_cast<float>(yoffset));
+
+    InputEvent event;
+    event.type = InputEventType::Scroll;
+    event.value = {static_cast<float>(xoffset), static_cast<float>(yoffset)};
+    event.time = std::chrono::steady_clock::now();
+    PushEvent(event);
+
+    if (s_PrevScrollCallback) {
+        s_PrevScrollCallback(window, xoffset, yoffset);
+    }
 }
 
 } // namespace tvk
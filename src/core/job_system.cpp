@@ -0,0 +1,290 @@
+/**
+ * @file job_system.cpp
+ * @brief Job system implementation
+ */
+
+#include "tinyvk/core/job_system.h"
+#include "tinyvk/core/log.h"
+#include "tinyvk/core/timer.h"
+
+#include <algorithm>
+
+namespace tvk {
+
+static thread_local u32 s_WorkerIndex = JobSystem::InvalidWorker;
+
+JobQueue::JobQueue(u32 capacity)
+    : m_Jobs(capacity), m_Mask(static_cast<i64>(capacity) - 1) {
+}
+
+bool JobQueue::Push(Job* job) {
+    i64 bottom = m_Bottom.load(std::memory_order_relaxed);
+    i64 top = m_Top.load(std::memory_order_acquire);
+    if (bottom - top > m_Mask) return false;
+
+    m_Jobs[bottom & m_Mask].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Job* JobQueue::Pop() {
+    i64 bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+    m_Bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    i64 top = m_Top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = m_Jobs[bottom & m_Mask].load(std::memory_order_relaxed);
+    if (top == bottom) {
+        // Last job, race thieves for it
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* JobQueue::Steal() {
+    i64 top = m_Top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    i64 bottom = m_Bottom.load(std::memory_order_acquire);
+    if (top >= bottom) return nullptr;
+
+    Job* job = m_Jobs[top & m_Mask].load(std::memory_order_relaxed);
+    if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return job;
+}
+
+JobSystem::~JobSystem() {
+    Cleanup();
+}
+
+bool JobSystem::Init(u32 workerCount) {
+    if (IsRunning()) return true;
+
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_Queues.clear();
+    for (u32 i = 0; i < workerCount; i++) {
+        m_Queues.push_back(CreateScope<JobQueue>());
+    }
+
+    m_Running.store(true, std::memory_order_release);
+    s_WorkerIndex = 0;
+
+    for (u32 i = 1; i < workerCount; i++) {
+        m_Threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+
+    TVK_LOG_INFO("Job system started with {} workers", workerCount);
+    return true;
+}
+
+void JobSystem::Cleanup() {
+    if (!IsRunning()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_Running.store(false, std::memory_order_release);
+    }
+    m_WakeCondition.notify_all();
+
+    for (auto& thread : m_Threads) {
+        thread.join();
+    }
+    m_Threads.clear();
+
+    // Drop jobs that never started
+    for (auto& queue : m_Queues) {
+        while (Job* job = queue->Pop()) {
+            delete job;
+        }
+    }
+    m_Queues.clear();
+
+    for (Job* job : m_Inbox) {
+        delete job;
+    }
+    m_Inbox.clear();
+    m_InboxCount.store(0, std::memory_order_relaxed);
+    m_PendingJobs.store(0, std::memory_order_relaxed);
+
+    s_WorkerIndex = InvalidWorker;
+}
+
+void JobSystem::Run(std::function<void()> function, JobCounter* counter) {
+    Job* job = new Job{std::move(function), counter};
+    if (counter) {
+        counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+    }
+    Schedule(job);
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, std::function<void()> function, JobCounter* counter) {
+    Job* job = new Job{std::move(function), counter};
+    if (counter) {
+        counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        // Finish() drops the value under the same lock, so the job is either seen there or here
+        std::lock_guard<std::mutex> lock(dependency.m_Mutex);
+        if (!dependency.IsDone()) {
+            dependency.m_Continuations.push_back(job);
+            return;
+        }
+    }
+    Schedule(job);
+}
+
+void JobSystem::ParallelFor(u32 count, u32 chunkSize, const std::function<void(u32, u32)>& function) {
+    JobCounter counter;
+    ParallelFor(count, chunkSize, function, counter);
+    Wait(counter);
+}
+
+void JobSystem::ParallelFor(u32 count, u32 chunkSize, const std::function<void(u32, u32)>& function, JobCounter& counter) {
+    if (count == 0) return;
+    chunkSize = std::max(1u, chunkSize);
+
+    for (u32 begin = 0; begin < count; begin += chunkSize) {
+        u32 end = std::min(count, begin + chunkSize);
+        Run([&function, begin, end]() { function(begin, end); }, &counter);
+    }
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    u32 index = s_WorkerIndex;
+    while (!counter.IsDone()) {
+        Job* job = IsRunning() ? FindJob(index) : nullptr;
+        if (job) {
+            Execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // The last Finish() may still hold the lock, the counter can be destroyed once it is released
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+u32 JobSystem::GetWorkerIndex() {
+    return s_WorkerIndex;
+}
+
+void JobSystem::WorkerLoop(u32 index) {
+    s_WorkerIndex = index;
+    Profiler::instance().setThreadName("Worker " + std::to_string(index));
+
+    while (IsRunning()) {
+        if (Job* job = FindJob(index)) {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_SleepingWorkers.fetch_add(1);
+        m_WakeCondition.wait(lock, [this]() {
+            return m_PendingJobs.load() > 0 || !m_Running.load(std::memory_order_acquire);
+        });
+        m_SleepingWorkers.fetch_sub(1);
+    }
+}
+
+void JobSystem::Schedule(Job* job) {
+    if (!IsRunning()) {
+        // Not started or shutting down, run on the calling thread
+        Execute(job);
+        return;
+    }
+
+    u32 index = s_WorkerIndex;
+    m_PendingJobs.fetch_add(1);
+
+    if (index < m_Queues.size()) {
+        if (!m_Queues[index]->Push(job)) {
+            // Full, run it here instead of blocking
+            m_PendingJobs.fetch_sub(1);
+            Execute(job);
+            return;
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(m_InboxMutex);
+        m_Inbox.push_back(job);
+        m_InboxCount.fetch_add(1, std::memory_order_release);
+    }
+
+    // A worker that went to sleep after this check has seen the pending job
+    if (m_SleepingWorkers.load() > 0) {
+        { std::lock_guard<std::mutex> lock(m_WakeMutex); }
+        m_WakeCondition.notify_one();
+    }
+}
+
+void JobSystem::Execute(Job* job) {
+    {
+        TVK_PROFILE_SCOPE("Job");
+        job->function();
+    }
+    JobCounter* counter = job->counter;
+    delete job;
+    Finish(counter);
+}
+
+void JobSystem::Finish(JobCounter* counter) {
+    if (!counter) return;
+
+    // Decremented under the lock so Wait() can tell when the counter is no longer touched
+    std::vector<Job*> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_Mutex);
+        if (counter->m_Value.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuations.swap(counter->m_Continuations);
+        }
+    }
+    for (Job* job : continuations) {
+        Schedule(job);
+    }
+}
+
+Job* JobSystem::FindJob(u32 index) {
+    Job* job = nullptr;
+
+    if (index < m_Queues.size()) {
+        job = m_Queues[index]->Pop();
+    }
+
+    if (!job && m_InboxCount.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(m_InboxMutex);
+        if (!m_Inbox.empty()) {
+            job = m_Inbox.back();
+            m_Inbox.pop_back();
+            m_InboxCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Steal from the other workers, starting after our own queue
+    u32 count = static_cast<u32>(m_Queues.size());
+    for (u32 i = 1; !job && i <= count; i++) {
+        u32 victim = (index == InvalidWorker ? i : index + i) % count;
+        if (victim == index) continue;
+        job = m_Queues[victim]->Steal();
+    }
+
+    if (job) {
+        m_PendingJobs.fetch_sub(1);
+    }
+    return job;
+}
+
+} // namespace tvk
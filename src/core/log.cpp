@@ -0,0 +1,329 @@
+/**
+ * @file log.cpp
+ * @brief Log sinks and asynchronous writer
+ */
+
+#include "tinyvk/core/log.h"
+
+#include <atomic>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace tvk {
+
+namespace {
+
+/**
+ * @brief Bounded multi-producer queue with a single consumer
+ *
+ * Every slot carries a sequence number telling whether it is free for the
+ * producer of a position or ready for the consumer. A message longer than a
+ * slot claims consecutive slots with one CAS, so messages never interleave.
+ */
+class LogQueue {
+public:
+    static constexpr size_t SlotTextSize = 240;
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        LogLevel level = LogLevel::Info;
+        uint16_t size = 0;
+        bool last = true;                // Final chunk of a message
+        char text[SlotTextSize];
+    };
+
+    explicit LogQueue(size_t capacity) {
+        // A message has to fit into the queue as a whole
+        size_t minimum = (LogBuffer::Capacity + SlotTextSize - 1) / SlotTextSize;
+        size_t size = 1;
+        while (size < std::max(capacity, minimum)) size <<= 1;
+
+        m_Slots = std::make_unique<Slot[]>(size);
+        m_Mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Blocks while the queue is full
+    void Push(LogLevel level, const char* text, size_t size) {
+        size_t count = std::max<size_t>(1, (size + SlotTextSize - 1) / SlotTextSize);
+        size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+
+        for (;;) {
+            // The consumer frees slots in order, so the last one being free covers the rest
+            Slot& lastSlot = m_Slots[(pos + count - 1) & m_Mask];
+            size_t sequence = lastSlot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + count - 1);
+
+            if (diff == 0) {
+                if (m_EnqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                std::this_thread::yield();
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            Slot& slot = m_Slots[(pos + i) & m_Mask];
+            size_t chunk = std::min(SlotTextSize, size - std::min(size, i * SlotTextSize));
+            std::memcpy(slot.text, text + i * SlotTextSize, chunk);
+            slot.level = level;
+            slot.size = static_cast<uint16_t>(chunk);
+            slot.last = i + 1 == count;
+            slot.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+    }
+
+    // Returns the next published slot, Release() it once consumed
+    const Slot* Peek() const {
+        const Slot& slot = m_Slots[m_DequeuePos & m_Mask];
+        if (slot.sequence.load(std::memory_order_acquire) != m_DequeuePos + 1) return nullptr;
+        return &slot;
+    }
+
+    void Release() {
+        m_Slots[m_DequeuePos & m_Mask].sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+        m_DequeuePos++;
+    }
+
+    size_t GetEnqueuePosition() const { return m_EnqueuePos.load(std::memory_order_acquire); }
+    size_t GetDequeuePosition() const { return m_DequeuePos; }
+
+private:
+    std::unique_ptr<Slot[]> m_Slots;
+    size_t m_Mask = 0;
+    alignas(64) std::atomic<size_t> m_EnqueuePos{0};
+    alignas(64) size_t m_DequeuePos = 0;
+};
+
+class LogBackend {
+public:
+    static constexpr size_t BatchSize = 64 * 1024;
+
+    bool Init(const LogConfig& config) {
+        std::lock_guard<std::mutex> lock(m_InitMutex);
+        if (m_Initialized) return false;
+
+        {
+            std::lock_guard<std::mutex> sinkLock(m_SinkMutex);
+            m_Console = config.console;
+            m_ConsoleStream = config.consoleStderr ? stderr : stdout;
+        }
+        bool opened = config.console;
+        for (const auto& path : config.files) {
+            opened |= AddFileSink(path);
+        }
+
+        if (config.async) {
+            m_Queue = std::make_unique<LogQueue>(config.queueCapacity);
+            m_Batch.reserve(BatchSize + LogQueue::SlotTextSize + 1);
+            m_Written.store(0);
+            m_Stop.store(false);
+            m_Async.store(true, std::memory_order_release);
+            m_Writer = std::thread([this]() { WriterLoop(); });
+        }
+
+        m_Initialized = true;
+        return opened;
+    }
+
+    void Shutdown() {
+        std::lock_guard<std::mutex> lock(m_InitMutex);
+        if (!m_Initialized) return;
+
+        if (m_Writer.joinable()) {
+            // New messages are written synchronously from here on. Callers that
+            // saw the queue before the switch may still be pushing, which needs
+            // the writer while the queue is full
+            m_Async.store(false);
+            while (m_Users.load() > 0) {
+                std::this_thread::yield();
+            }
+
+            WaitWritten(m_Queue->GetEnqueuePosition());
+            m_Stop.store(true);
+            m_Signal.fetch_add(1, std::memory_order_release);
+            m_Signal.notify_one();
+            m_Writer.join();
+        }
+        m_Queue.reset();
+
+        std::lock_guard<std::mutex> sinkLock(m_SinkMutex);
+        for (FILE* file : m_Files) {
+            std::fclose(file);
+        }
+        m_Files.clear();
+        m_Console = true;
+        m_ConsoleStream = stdout;
+        m_Initialized = false;
+    }
+
+    void Flush() {
+        if (!m_Async.load(std::memory_order_acquire)) return;
+        WaitWritten(m_Queue->GetEnqueuePosition());
+    }
+
+    bool AddFileSink(const std::string& path) {
+        FILE* file = std::fopen(path.c_str(), "ab");
+        if (!file) {
+            TVK_LOG_ERROR("Failed to open log file: {}", path);
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_SinkMutex);
+        m_Files.push_back(file);
+        return true;
+    }
+
+    void Submit(LogLevel level, const char* text, size_t size) {
+        // Sequentially consistent with the switch in Shutdown(), which waits for m_Users
+        m_Users.fetch_add(1);
+        if (m_Async.load()) {
+            m_Queue->Push(level, text, size);
+            m_Signal.fetch_add(1, std::memory_order_release);
+            m_Signal.notify_one();
+
+            // The process is likely about to stop, get the message out first
+            if (level == LogLevel::Fatal) WaitWritten(m_Queue->GetEnqueuePosition());
+
+            m_Users.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+        m_Users.fetch_sub(1, std::memory_order_release);
+
+        std::lock_guard<std::mutex> lock(m_SinkMutex);
+        WriteSinks(text, size);
+        WriteSinks("\n", 1);
+        FlushSinks();
+    }
+
+    bool IsInitialized() {
+        std::lock_guard<std::mutex> lock(m_InitMutex);
+        return m_Initialized;
+    }
+
+    bool IsAsync() const { return m_Async.load(std::memory_order_acquire); }
+
+private:
+    void WaitWritten(size_t target) {
+        size_t written = m_Written.load(std::memory_order_acquire);
+        while (written < target) {
+            m_Written.wait(written, std::memory_order_acquire);
+            written = m_Written.load(std::memory_order_acquire);
+        }
+    }
+
+    void WriterLoop() {
+        while (true) {
+            uint32_t signal = m_Signal.load(std::memory_order_acquire);
+            if (WriteQueued() == 0) {
+                if (m_Stop.load()) break;
+                m_Signal.wait(signal, std::memory_order_acquire);
+            }
+        }
+    }
+
+    // Drains the queue in batches, one write per sink and batch
+    size_t WriteQueued() {
+        size_t total = 0;
+        while (true) {
+            m_Batch.clear();
+            while (m_Batch.size() < BatchSize) {
+                const LogQueue::Slot* slot = m_Queue->Peek();
+                if (!slot) break;
+
+                m_Batch.append(slot->text, slot->size);
+                if (slot->last) m_Batch.push_back('\n');
+                m_Queue->Release();
+                total++;
+            }
+            if (m_Batch.empty()) break;
+
+            {
+                std::lock_guard<std::mutex> lock(m_SinkMutex);
+                WriteSinks(m_Batch.data(), m_Batch.size());
+                FlushSinks();
+            }
+
+            m_Written.store(m_Queue->GetDequeuePosition(), std::memory_order_release);
+            m_Written.notify_all();
+        }
+        return total;
+    }
+
+    void WriteSinks(const char* text, size_t size) {
+        if (m_Console) std::fwrite(text, 1, size, m_ConsoleStream);
+        for (FILE* file : m_Files) {
+            std::fwrite(text, 1, size, file);
+        }
+    }
+
+    void FlushSinks() {
+        if (m_Console) std::fflush(m_ConsoleStream);
+        for (FILE* file : m_Files) {
+            std::fflush(file);
+        }
+    }
+
+    std::mutex m_InitMutex;
+    std::mutex m_SinkMutex;              // Guards the sinks
+    std::vector<FILE*> m_Files;
+    bool m_Console = true;
+    FILE* m_ConsoleStream = stdout;
+    bool m_Initialized = false;
+
+    std::unique_ptr<LogQueue> m_Queue;
+    std::thread m_Writer;
+    std::string m_Batch;
+    std::atomic<bool> m_Async{false};
+    std::atomic<uint32_t> m_Users{0};    // Callers using the queue, Shutdown() waits for them
+    std::atomic<uint32_t> m_Signal{0};   // Bumped for every push, the writer sleeps on it
+    std::atomic<size_t> m_Written{0};    // Queue position written to the sinks
+    std::atomic<bool> m_Stop{false};
+};
+
+// Never destroyed, so logging from static destructors stays valid
+LogBackend& GetBackend() {
+    static LogBackend* backend = new LogBackend();
+    return *backend;
+}
+
+} // namespace
+
+bool Log::Init(const LogConfig& config) {
+    static std::once_flag s_ExitHandler;
+    std::call_once(s_ExitHandler, []() { std::atexit([]() { Log::Shutdown(); }); });
+
+    return GetBackend().Init(config);
+}
+
+void Log::Shutdown() {
+    GetBackend().Shutdown();
+}
+
+void Log::Flush() {
+    GetBackend().Flush();
+}
+
+bool Log::AddFileSink(const std::string& path) {
+    return GetBackend().AddFileSink(path);
+}
+
+bool Log::IsInitialized() {
+    return GetBackend().IsInitialized();
+}
+
+bool Log::IsAsync() {
+    return GetBackend().IsAsync();
+}
+
+void Log::Submit(LogLevel level, const char* text, size_t size) {
+    GetBackend().Submit(level, text, size);
+}
+
+} // namespace tvk
@@ -0,0 +1,144 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Memory mapped file implementation
+ */
+
+#include "tinyvk/core/mapped_file.h"
+#include "tinyvk/core/log.h"
+
+#include <utility>
+
+#ifdef TVK_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tvk {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_Data = std::exchange(other.m_Data, nullptr);
+        m_Size = std::exchange(other.m_Size, 0);
+#ifdef TVK_PLATFORM_WINDOWS
+        m_File = std::exchange(other.m_File, nullptr);
+        m_Mapping = std::exchange(other.m_Mapping, nullptr);
+#endif
+    }
+    return *this;
+}
+
+#ifdef TVK_PLATFORM_WINDOWS
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        TVK_LOG_ERROR("Failed to open file: {}", path);
+        return false;
+    }
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        TVK_LOG_ERROR("Failed to map empty file: {}", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        TVK_LOG_ERROR("Failed to map file: {}", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        TVK_LOG_ERROR("Failed to map file: {}", path);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_File = file;
+    m_Mapping = mapping;
+    m_Data = static_cast<const u8*>(data);
+    m_Size = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        UnmapViewOfFile(m_Data);
+        m_Data = nullptr;
+    }
+    if (m_Mapping) {
+        CloseHandle(static_cast<HANDLE>(m_Mapping));
+        m_Mapping = nullptr;
+    }
+    if (m_File) {
+        CloseHandle(static_cast<HANDLE>(m_File));
+        m_File = nullptr;
+    }
+    m_Size = 0;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        TVK_LOG_ERROR("Failed to open file: {}", path);
+        return false;
+    }
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        TVK_LOG_ERROR("Failed to map empty file: {}", path);
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   // The mapping keeps the file referenced
+
+    if (data == MAP_FAILED) {
+        TVK_LOG_ERROR("Failed to map file: {}", path);
+        return false;
+    }
+
+    // Uploads read the file front to back
+    madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    m_Data = static_cast<const u8*>(data);
+    m_Size = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_Data) {
+        munmap(const_cast<u8*>(m_Data), m_Size);
+        m_Data = nullptr;
+    }
+    m_Size = 0;
+}
+
+#endif
+
+} // namespace tvk
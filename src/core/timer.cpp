@@ -0,0 +1,248 @@
+/**
+ * @file timer.cpp
+ * @brief Profiler implementation
+ */
+
+#include "tinyvk/core/log.h"
+#include "tinyvk/core/timer.h"
+
+#include <fstream>
+#include <cstdio>
+
+namespace tinyvk {
+
+static void WriteJsonString(std::ostream& out, const std::string& value) {
+    out << '"';
+    for (char c : value) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out << escaped;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+// Trace timestamps are microseconds, the fraction keeps nanoseconds
+static void WriteMicroseconds(std::ostream& out, int64_t ns) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%lld.%03lld", static_cast<long long>(ns / 1000),
+                  static_cast<long long>(ns % 1000));
+    out << buffer;
+}
+
+ProfileId Profiler::intern(std::string_view name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return internLocked(name);
+}
+
+ProfileId Profiler::internLocked(std::string_view name) {
+    std::string key(name);
+    auto it = m_ids.find(key);
+    if (it != m_ids.end()) return it->second;
+
+    ProfileId id = static_cast<ProfileId>(m_stats.size());
+    m_stats.emplace_back().name = key;
+    m_ids.emplace(std::move(key), id);
+    return id;
+}
+
+std::string Profiler::getName(ProfileId id) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return id < m_stats.size() ? m_stats[id].name : std::string();
+}
+
+ProfileThreadBuffer* Profiler::registerThread() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& buffer = m_threads.emplace_back(std::make_unique<ProfileThreadBuffer>());
+    buffer->threadIndex = static_cast<uint32_t>(m_threads.size() - 1);
+    buffer->threadName = "Thread " + std::to_string(buffer->threadIndex);
+    return buffer.get();
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    ProfileThreadBuffer& buffer = threadBuffer();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    buffer.threadName = name;
+}
+
+void Profiler::addSample(ProfileId id, double timeMs) {
+    if (!isEnabled()) return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_stats.size()) return;
+
+    m_stats[id].addSample(timeMs);
+    if (isCapturing()) {
+        if (m_captureEvents.size() + m_captureCounters.size() < m_captureLimit) {
+            m_captureCounters.push_back({id, now(), timeMs});
+        } else {
+            m_droppedEvents++;
+        }
+    }
+}
+
+void Profiler::collect() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    collectLocked();
+}
+
+void Profiler::collectLocked() {
+    bool capturing = isCapturing();
+
+    for (auto& buffer : m_threads) {
+        uint32_t threadIndex = buffer->threadIndex;
+        buffer->drain([&](const ProfileEvent& event) {
+            if (event.id < m_stats.size()) {
+                m_stats[event.id].addSample(static_cast<double>(event.endNs - event.startNs) / 1000000.0);
+            }
+            if (capturing) {
+                if (m_captureEvents.size() + m_captureCounters.size() < m_captureLimit) {
+                    m_captureEvents.push_back({event, threadIndex});
+                } else {
+                    m_droppedEvents++;
+                }
+            }
+        });
+        m_droppedEvents += buffer->takeDropped();
+    }
+}
+
+const ProfileStats* Profiler::getStats(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_ids.find(name);
+    return it != m_ids.end() ? &m_stats[it->second] : nullptr;
+}
+
+std::vector<ProfileStats> Profiler::getAllStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<ProfileStats> result;
+    for (const auto& stats : m_stats) {
+        if (stats.callCount > 0) {
+            result.push_back(stats);
+        }
+    }
+    return result;
+}
+
+void Profiler::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Pending events would otherwise land in the fresh stats
+    for (auto& buffer : m_threads) {
+        buffer->drain([](const ProfileEvent&) {});
+        buffer->takeDropped();
+    }
+    for (auto& stats : m_stats) {
+        stats.reset();
+    }
+    m_droppedEvents = 0;
+}
+
+void Profiler::reset(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_ids.find(name);
+    if (it != m_ids.end()) {
+        m_stats[it->second].reset();
+    }
+}
+
+void Profiler::beginCapture(size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Events recorded before the capture started are not part of it
+    collectLocked();
+    m_captureEvents.clear();
+    m_captureCounters.clear();
+    m_captureEvents.reserve(std::min<size_t>(maxEvents, 1 << 16));
+    m_captureLimit = maxEvents;
+    m_capturing.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::endCapture() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    collectLocked();
+    m_capturing.store(false, std::memory_order_relaxed);
+}
+
+size_t Profiler::getCapturedEventCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_captureEvents.size() + m_captureCounters.size();
+}
+
+uint64_t Profiler::getDroppedEventCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_droppedEvents;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (isCapturing()) {
+        collectLocked();
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        TVK_LOG_ERROR("Failed to open trace file: {}", path);
+        return false;
+    }
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    bool first = true;
+    auto separator = [&]() {
+        if (!first) file << ",\n";
+        first = false;
+    };
+
+    for (const auto& buffer : m_threads) {
+        separator();
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex << ",\"args\":{\"name\":";
+        WriteJsonString(file, buffer->threadName);
+        file << "}}";
+    }
+
+    // Complete events, viewers nest them by time on each thread
+    for (const auto& captured : m_captureEvents) {
+        const ProfileEvent& event = captured.event;
+        separator();
+        file << "{\"name\":";
+        WriteJsonString(file, m_stats[event.id].name);
+        file << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << captured.threadIndex << ",\"ts\":";
+        WriteMicroseconds(file, event.startNs);
+        file << ",\"dur\":";
+        WriteMicroseconds(file, event.endNs - event.startNs);
+        file << '}';
+    }
+
+    for (const auto& counter : m_captureCounters) {
+        separator();
+        file << "{\"name\":";
+        WriteJsonString(file, m_stats[counter.id].name);
+        file << ",\"ph\":\"C\",\"pid\":1,\"ts\":";
+        WriteMicroseconds(file, counter.timeNs);
+        file << ",\"args\":{\"ms\":" << counter.value << "}}";
+    }
+
+    file << "\n]}\n";
+
+    if (!file) {
+        TVK_LOG_ERROR("Failed to write trace file: {}", path);
+        return false;
+    }
+
+    TVK_LOG_INFO("Wrote {} trace events to {}", m_captureEvents.size() + m_captureCounters.size(), path);
+    return true;
+}
+
+} // namespace tinyvk
@@ -56,6 +56,16 @@ Window::Window(const WindowConfig& config) : m_Config(config) {
     glfwSetWindowCloseCallback(m_Window, WindowCloseCallback);
     glfwSetWindowMaximizeCallback(m_Window, WindowMaximizeCallback);
 
+    // Only counted here, installed first so that ImGui chains them
+    glfwSetWindowFocusCallback(m_Window, WindowFocusCallback);
+    glfwSetWindowRefreshCallback(m_Window, WindowRefreshCallback);
+    glfwSetKeyCallback(m_Window, KeyCallback);
+    glfwSetCharCallback(m_Window, CharCallback);
+    glfwSetMouseButtonCallback(m_Window, MouseButtonCallback);
+    glfwSetCursorPosCallback(m_Window, CursorPosCallback);
+    glfwSetCursorEnterCallback(m_Window, CursorEnterCallback);
+    glfwSetScrollCallback(m_Window, ScrollCallback);
+
     TVK_LOG_INFO("Window created: {} ({}x{})", config.title, config.width, config.height);
 }
 
@@ -75,7 +85,8 @@ Window::Window(Window&& other) noexcept
     , m_Config(std::move(other.m_Config))
     , m_ResizeCallback(std::move(other.m_ResizeCallback))
     , m_CloseCallback(std::move(other.m_CloseCallback))
-    , m_MaximizeCallback(std::move(other.m_MaximizeCallback)) {
+    , m_MaximizeCallback(std::move(other.m_MaximizeCallback))
+    , m_EventCount(other.m_EventCount) {
     other.m_Window = nullptr;
     if (m_Window) {
         glfwSetWindowUserPointer(m_Window, this);
@@ -94,6 +105,7 @@ Window& Window::operator=(Window&& other) noexcept {
         m_ResizeCallback = std::move(other.m_ResizeCallback);
         m_CloseCallback = std::move(other.m_CloseCallback);
         m_MaximizeCallback = std::move(other.m_MaximizeCallback);
+        m_EventCount = other.m_EventCount;
 
         other.m_Window = nullptr;
         if (m_Window) {
@@ -145,6 +157,14 @@ void Window::WaitEvents() {
     glfwWaitEvents();
 }
 
+void Window::WaitEventsTimeout(double timeout) {
+    glfwWaitEventsTimeout(timeout);
+}
+
+void Window::PostEmptyEvent() {
+    glfwPostEmptyEvent();
+}
+
 void Window::GetPosition(i32& x, i32& y) const {
     glfwGetWindowPos(m_Window, &x, &y);
 }
@@ -169,7 +189,15 @@ void Window::Restore() {
     glfwRestoreWindow(m_Window);
 }
 
+void Window::CountEvent(GLFWwindow* window) {
+    auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
+    if (self) {
+        self->m_EventCount++;
+    }
+}
+
 void Window::FramebufferResizeCallback(GLFWwindow* window, int width, int height) {
+    CountEvent(window);
     auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
     if (self && self->m_ResizeCallback) {
         self->m_ResizeCallback(static_cast<u32>(width), static_cast<u32>(height));
@@ -177,6 +205,7 @@ void Window::FramebufferResizeCallback(GLFWwindow* window, int width, int height
 }
 
 void Window::WindowCloseCallback(GLFWwindow* window) {
+    CountEvent(window);
     auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
     if (self && self->m_CloseCallback) {
         self->m_CloseCallback();
@@ -184,10 +213,43 @@ void Window::WindowCloseCallback(GLFWwindow* window) {
 }
 
 void Window::WindowMaximizeCallback(GLFWwindow* window, int maximized) {
+    CountEvent(window);
     auto* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
     if (self && self->m_MaximizeCallback) {
         self->m_MaximizeCallback(maximized == GLFW_TRUE);
     }
 }
 
+void Window::WindowFocusCallback(GLFWwindow* window, int focused) {
+    CountEvent(window);
+}
+
+void Window::WindowRefreshCallback(GLFWwindow* window) {
+    CountEvent(window);
+}
+
+void Window::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    CountEvent(window);
+}
+
+void Window::CharCallback(GLFWwindow* window, unsigned int codepoint) {
+    CountEvent(window);
+}
+
+void Window::MouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+    CountEvent(window);
+}
+
+void Window::CursorPosCallback(GLFWwindow* window, double x, double y) {
+    CountEvent(window);
+}
+
+void Window::CursorEnterCallback(GLFWwindow* window, int entered) {
+    CountEvent(window);
+}
+
+void Window::ScrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
+    CountEvent(window);
+}
+
 } // namespace tvk
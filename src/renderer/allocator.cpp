@@ -0,0 +1,267 @@
+/**
+ * @file allocator.cpp
+ * @brief GPU memory allocator implementation (backed by VMA)
+ */
+
+#include "tinyvk/renderer/allocator.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+#define VMA_IMPLEMENTATION
+#include <vk_mem_alloc.h>
+
+namespace tvk {
+
+MemoryAllocator::~MemoryAllocator() {
+    Cleanup();
+}
+
+bool MemoryAllocator::Init(VulkanContext* context, VkDeviceSize blockSize) {
+    m_Context = context;
+
+    VmaAllocatorCreateInfo createInfo{};
+    createInfo.vulkanApiVersion = VK_API_VERSION_1_2;
+    createInfo.instance = context->GetInstance();
+    createInfo.physicalDevice = context->GetPhysicalDevice();
+    createInfo.device = context->GetDevice();
+    createInfo.preferredLargeHeapBlockSize = blockSize;
+    if (context->IsMemoryBudgetSupported()) {
+        createInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+
+    if (vmaCreateAllocator(&createInfo, &m_Allocator) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create memory allocator");
+        return false;
+    }
+
+    return true;
+}
+
+void MemoryAllocator::Cleanup() {
+    if (m_Allocator != nullptr) {
+        vmaDestroyAllocator(m_Allocator);
+        m_Allocator = nullptr;
+    }
+    m_Context = nullptr;
+}
+
+bool MemoryAllocator::CreateBuffer(const VkBufferCreateInfo& bufferInfo, VkMemoryPropertyFlags properties,
+                                   VkBuffer& buffer, Allocation& allocation, bool mapped) {
+    VmaAllocationCreateInfo allocInfo{};
+    allocInfo.usage = VMA_MEMORY_USAGE_UNKNOWN;
+    allocInfo.requiredFlags = properties;
+    if (mapped) {
+        allocInfo.flags |= VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    }
+
+    VmaAllocationInfo info{};
+    VkResult result = vmaCreateBuffer(m_Allocator, &bufferInfo, &allocInfo, &buffer, &allocation.handle, &info);
+    if (result != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to allocate buffer memory ({} bytes, error code: {})",
+                      bufferInfo.size, static_cast<int>(result));
+        buffer = VK_NULL_HANDLE;
+        allocation = Allocation{};
+        return false;
+    }
+
+    allocation.size = info.size;
+    allocation.mapped = info.pMappedData;
+    return true;
+}
+
+void MemoryAllocator::DestroyBuffer(VkBuffer buffer, Allocation& allocation) {
+    if (buffer != VK_NULL_HANDLE || allocation.handle != nullptr) {
+        vmaDestroyBuffer(m_Allocator, buffer, allocation.handle);
+    }
+    allocation = Allocation{};
+}
+
+bool MemoryAllocator::CreateImage(const VkImageCreateInfo& imageInfo, VkMemoryPropertyFlags properties,
+                                  VkImage& image, Allocation& allocation) {
+    VmaAllocationCreateInfo allocInfo{};
+    allocInfo.usage = VMA_MEMORY_USAGE_UNKNOWN;
+    allocInfo.requiredFlags = properties;
+
+    // VMA gives the image its own memory when the driver prefers it (dedicated allocation
+    // is core in Vulkan 1.1) or when it is too large for a block, small targets share blocks
+
+    VmaAllocationInfo info{};
+    VkResult result = vmaCreateImage(m_Allocator, &imageInfo, &allocInfo, &image, &allocation.handle, &info);
+    if (result != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to allocate image memory ({}x{}, error code: {})",
+                      imageInfo.extent.width, imageInfo.extent.height, static_cast<int>(result));
+        image = VK_NULL_HANDLE;
+        allocation = Allocation{};
+        return false;
+    }
+
+    allocation.size = info.size;
+    allocation.mapped = info.pMappedData;
+    return true;
+}
+
+void MemoryAllocator::DestroyImage(VkImage image, Allocation& allocation) {
+    if (image != VK_NULL_HANDLE || allocation.handle != nullptr) {
+        vmaDestroyImage(m_Allocator, image, allocation.handle);
+    }
+    allocation = Allocation{};
+}
+
+bool MemoryAllocator::BindBuffer(VmaAllocation allocation, VkBuffer buffer, VkDeviceSize offset) {
+    return vmaBindBufferMemory2(m_Allocator, allocation, offset, buffer, nullptr) == VK_SUCCESS;
+}
+
+bool MemoryAllocator::BindImage(VmaAllocation allocation, VkImage image, VkDeviceSize offset) {
+    return vmaBindImageMemory2(m_Allocator, allocation, offset, image, nullptr) == VK_SUCCESS;
+}
+
+bool MemoryAllocator::AllocateMemory(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties,
+                                     Allocation& allocation) {
+    VmaAllocationCreateInfo allocInfo{};
+    allocInfo.usage = VMA_MEMORY_USAGE_UNKNOWN;
+    allocInfo.requiredFlags = properties;
+
+    VmaAllocationInfo info{};
+    VkResult result = vmaAllocateMemory(m_Allocator, &requirements, &allocInfo, &allocation.handle, &info);
+    if (result != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to allocate memory ({} bytes, error code: {})",
+                      requirements.size, static_cast<int>(result));
+        allocation = Allocation{};
+        return false;
+    }
+
+    allocation.size = info.size;
+    allocation.mapped = info.pMappedData;
+    return true;
+}
+
+void MemoryAllocator::FreeMemory(Allocation& allocation) {
+    if (allocation.handle != nullptr) {
+        vmaFreeMemory(m_Allocator, allocation.handle);
+    }
+    allocation = Allocation{};
+}
+
+void* MemoryAllocator::Map(const Allocation& allocation) {
+    void* data = nullptr;
+    if (vmaMapMemory(m_Allocator, allocation.handle, &data) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to map memory");
+        return nullptr;
+    }
+    return data;
+}
+
+void MemoryAllocator::Unmap(const Allocation& allocation) {
+    vmaUnmapMemory(m_Allocator, allocation.handle);
+}
+
+void MemoryAllocator::Flush(const Allocation& allocation, VkDeviceSize offset, VkDeviceSize size) {
+    vmaFlushAllocation(m_Allocator, allocation.handle, offset, size);
+}
+
+void MemoryAllocator::SetRelocatable(const Allocation& allocation, RelocatableResource* resource) {
+    vmaSetAllocationUserData(m_Allocator, allocation.handle, resource);
+}
+
+DefragmentationStats MemoryAllocator::Defragment() {
+    DefragmentationStats result;
+
+    m_Context->WaitIdle();
+
+    VmaDefragmentationInfo defragInfo{};
+    defragInfo.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_FAST_BIT;
+
+    VmaDefragmentationContext defragContext = nullptr;
+    if (vmaBeginDefragmentation(m_Allocator, &defragInfo, &defragContext) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to begin defragmentation");
+        return result;
+    }
+
+    std::vector<RelocatableResource*> moved;
+    for (;;) {
+        VmaDefragmentationPassMoveInfo pass{};
+        if (vmaBeginDefragmentationPass(m_Allocator, defragContext, &pass) == VK_SUCCESS) {
+            break; // Nothing left to move
+        }
+
+        moved.clear();
+        VkCommandBuffer cmd = m_Context->BeginSingleTimeCommands();
+
+        for (u32 i = 0; i < pass.moveCount; i++) {
+            VmaDefragmentationMove& move = pass.pMoves[i];
+
+            VmaAllocationInfo info{};
+            vmaGetAllocationInfo(m_Allocator, move.srcAllocation, &info);
+            auto* resource = static_cast<RelocatableResource*>(info.pUserData);
+
+            if (resource && resource->BeginRelocation(cmd, move.dstTmpAllocation)) {
+                moved.push_back(resource);
+            } else {
+                move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+            }
+        }
+
+        // Make the copies visible to whatever uses the resources next
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                             0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        m_Context->EndSingleTimeCommands(cmd);
+
+        for (auto* resource : moved) {
+            resource->EndRelocation();
+        }
+
+        if (vmaEndDefragmentationPass(m_Allocator, defragContext, &pass) == VK_SUCCESS) {
+            break;
+        }
+    }
+
+    VmaDefragmentationStats stats{};
+    vmaEndDefragmentation(m_Allocator, defragContext, &stats);
+
+    result.bytesMoved = stats.bytesMoved;
+    result.bytesFreed = stats.bytesFreed;
+    result.allocationsMoved = stats.allocationsMoved;
+    result.blocksFreed = stats.deviceMemoryBlocksFreed;
+
+    TVK_LOG_INFO("Defragmentation moved {} allocations ({} bytes), freed {} blocks",
+                 result.allocationsMoved, result.bytesMoved, result.blocksFreed);
+    return result;
+}
+
+std::vector<MemoryHeapStats> MemoryAllocator::GetHeapStats() const {
+    std::vector<MemoryHeapStats> result;
+    if (m_Allocator == nullptr) return result;
+
+    const VkPhysicalDeviceMemoryProperties* memProps = nullptr;
+    vmaGetMemoryProperties(m_Allocator, &memProps);
+
+    std::vector<VmaBudget> budgets(memProps->memoryHeapCount);
+    vmaGetHeapBudgets(m_Allocator, budgets.data());
+
+    result.resize(memProps->memoryHeapCount);
+    for (u32 i = 0; i < memProps->memoryHeapCount; i++) {
+        MemoryHeapStats& stats = result[i];
+        stats.heapIndex = i;
+        stats.deviceLocal = (memProps->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+        stats.blockCount = budgets[i].statistics.blockCount;
+        stats.allocationCount = budgets[i].statistics.allocationCount;
+        stats.blockBytes = budgets[i].statistics.blockBytes;
+        stats.allocationBytes = budgets[i].statistics.allocationBytes;
+        stats.usage = budgets[i].usage;
+        stats.budget = budgets[i].budget;
+    }
+
+    return result;
+}
+
+void MemoryAllocator::SetFrameIndex(u64 frame) {
+    if (m_Allocator == nullptr) return;
+    vmaSetCurrentFrameIndex(m_Allocator, static_cast<u32>(frame));
+}
+
+} // namespace tvk
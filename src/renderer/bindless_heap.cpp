@@ -0,0 +1,338 @@
+/**
+ * @file bindless_heap.cpp
+ * @brief Bindless descriptor heap implementation
+ */
+
+#include "tinyvk/renderer/bindless_heap.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+
+namespace tvk {
+
+u32 BindlessHeap::IndexPool::Allocate() {
+    if (!free.empty()) {
+        u32 index = free.back();
+        free.pop_back();
+        return index;
+    }
+    if (next < capacity) {
+        return next++;
+    }
+    return InvalidIndex;
+}
+
+void BindlessHeap::IndexPool::Collect(u64 completedFrame) {
+    size_t kept = 0;
+    for (size_t i = 0; i < pending.size(); i++) {
+        if (pending[i].frame <= completedFrame) {
+            free.push_back(pending[i].index);
+        } else {
+            pending[kept++] = pending[i];
+        }
+    }
+    pending.resize(kept);
+}
+
+BindlessHeap::~BindlessHeap() {
+    Cleanup();
+}
+
+bool BindlessHeap::Init(VulkanContext* context, u32 maxImages, u32 maxSamplers, u32 maxBuffers) {
+    m_Context = context;
+    if (!context->IsBindlessSupported()) {
+        TVK_LOG_WARN("Descriptor indexing not supported, bindless heap disabled");
+        return false;
+    }
+
+    VkDevice device = context->GetDevice();
+
+    // A set counts against the per-set and the per-stage limits alike
+    VkPhysicalDeviceVulkan12Properties properties12{};
+    properties12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+    VkPhysicalDeviceProperties2 properties{};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties.pNext = &properties12;
+    vkGetPhysicalDeviceProperties2(context->GetPhysicalDevice(), &properties);
+
+    m_Images.capacity = std::min({maxImages, properties12.maxDescriptorSetUpdateAfterBindSampledImages,
+                                  properties12.maxPerStageDescriptorUpdateAfterBindSampledImages});
+    m_Samplers.capacity = std::min({maxSamplers, properties12.maxDescriptorSetUpdateAfterBindSamplers,
+                                    properties12.maxPerStageDescriptorUpdateAfterBindSamplers});
+    m_Buffers.capacity = std::min({maxBuffers, properties12.maxDescriptorSetUpdateAfterBindStorageBuffers,
+                                   properties12.maxPerStageDescriptorUpdateAfterBindStorageBuffers});
+
+    VkDescriptorSetLayoutBinding bindings[3]{};
+    bindings[0].binding = SampledImageBinding;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    bindings[0].descriptorCount = m_Images.capacity;
+    bindings[1].binding = SamplerBinding;
+    bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    bindings[1].descriptorCount = m_Samplers.capacity;
+    bindings[2].binding = StorageBufferBinding;
+    bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    bindings[2].descriptorCount = m_Buffers.capacity;
+    for (auto& binding : bindings) {
+        binding.stageFlags = VK_SHADER_STAGE_ALL;
+    }
+
+    VkDescriptorBindingFlags bindingFlags[3];
+    for (auto& flags : bindingFlags) {
+        flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+    bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bindingFlagsInfo.bindingCount = 3;
+    bindingFlagsInfo.pBindingFlags = bindingFlags;
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo{};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.pNext = &bindingFlagsInfo;
+    layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    layoutInfo.bindingCount = 3;
+    layoutInfo.pBindings = bindings;
+
+    if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_SetLayout) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create bindless descriptor set layout");
+        Cleanup();
+        return false;
+    }
+
+    VkDescriptorPoolSize poolSizes[3] = {
+        {VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, m_Images.capacity},
+        {VK_DESCRIPTOR_TYPE_SAMPLER, m_Samplers.capacity},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, m_Buffers.capacity}
+    };
+
+    VkDescriptorPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    poolInfo.maxSets = 1;
+    poolInfo.poolSizeCount = 3;
+    poolInfo.pPoolSizes = poolSizes;
+
+    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_Pool) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create bindless descriptor pool");
+        Cleanup();
+        return false;
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = m_Pool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &m_SetLayout;
+
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    if (vkAllocateDescriptorSets(device, &allocInfo, &set) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to allocate bindless descriptor set");
+        Cleanup();
+        return false;
+    }
+
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_ALL;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = PushConstantSize;
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_SetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create bindless pipeline layout");
+        Cleanup();
+        return false;
+    }
+
+    m_Set = set;
+    TVK_LOG_INFO("Bindless heap: {} images, {} samplers, {} storage buffers",
+                 m_Images.capacity, m_Samplers.capacity, m_Buffers.capacity);
+    return true;
+}
+
+void BindlessHeap::Cleanup() {
+    if (!m_Context) return;
+
+    VkDevice device = m_Context->GetDevice();
+    if (m_PipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
+        m_PipelineLayout = VK_NULL_HANDLE;
+    }
+    if (m_Pool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device, m_Pool, nullptr);
+        m_Pool = VK_NULL_HANDLE;
+        m_Set = VK_NULL_HANDLE;
+    }
+    if (m_SetLayout != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device, m_SetLayout, nullptr);
+        m_SetLayout = VK_NULL_HANDLE;
+    }
+
+    m_Images = IndexPool{};
+    m_Samplers = IndexPool{};
+    m_Buffers = IndexPool{};
+    m_SamplerEntries.clear();
+    m_Context = nullptr;
+}
+
+u32 BindlessHeap::AddImage(VkImageView view, VkImageLayout layout) {
+    if (!IsEnabled() || view == VK_NULL_HANDLE) return InvalidIndex;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    u32 index = m_Images.Allocate();
+    if (index == InvalidIndex) {
+        TVK_LOG_ERROR("Bindless heap is out of image slots ({})", m_Images.capacity);
+        return InvalidIndex;
+    }
+    WriteImage(index, view, layout);
+    return index;
+}
+
+u32 BindlessHeap::AddBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range) {
+    if (!IsEnabled() || buffer == VK_NULL_HANDLE) return InvalidIndex;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    u32 index = m_Buffers.Allocate();
+    if (index == InvalidIndex) {
+        TVK_LOG_ERROR("Bindless heap is out of storage buffer slots ({})", m_Buffers.capacity);
+        return InvalidIndex;
+    }
+    WriteBuffer(index, buffer, offset, range);
+    return index;
+}
+
+u32 BindlessHeap::AddSampler(VkSampler sampler) {
+    if (!IsEnabled() || sampler == VK_NULL_HANDLE) return InvalidIndex;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    SamplerEntry& entry = m_SamplerEntries[sampler];
+    if (entry.refCount > 0) {
+        entry.refCount++;
+        return entry.index;
+    }
+
+    entry.index = m_Samplers.Allocate();
+    if (entry.index == InvalidIndex) {
+        TVK_LOG_ERROR("Bindless heap is out of sampler slots ({})", m_Samplers.capacity);
+        m_SamplerEntries.erase(sampler);
+        return InvalidIndex;
+    }
+    entry.refCount = 1;
+
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.sampler = sampler;
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_Set;
+    write.dstBinding = SamplerBinding;
+    write.dstArrayElement = entry.index;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    write.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(m_Context->GetDevice(), 1, &write, 0, nullptr);
+    return entry.index;
+}
+
+void BindlessHeap::UpdateImage(u32 index, VkImageView view, VkImageLayout layout) {
+    if (!IsEnabled() || index >= m_Images.capacity) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    WriteImage(index, view, layout);
+}
+
+void BindlessHeap::UpdateBuffer(u32 index, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range) {
+    if (!IsEnabled() || index >= m_Buffers.capacity) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    WriteBuffer(index, buffer, offset, range);
+}
+
+void BindlessHeap::RemoveImage(u32 index, u64 frame) {
+    if (!IsEnabled() || index >= m_Images.capacity) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Images.pending.push_back({frame, index});
+}
+
+void BindlessHeap::RemoveBuffer(u32 index, u64 frame) {
+    if (!IsEnabled() || index >= m_Buffers.capacity) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Buffers.pending.push_back({frame, index});
+}
+
+void BindlessHeap::RemoveSampler(VkSampler sampler, u64 frame) {
+    if (!IsEnabled() || sampler == VK_NULL_HANDLE) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_SamplerEntries.find(sampler);
+    if (it == m_SamplerEntries.end()) return;
+
+    if (--it->second.refCount == 0) {
+        m_Samplers.pending.push_back({frame, it->second.index});
+        m_SamplerEntries.erase(it);
+    }
+}
+
+void BindlessHeap::Collect(u64 completedFrame) {
+    if (!IsEnabled()) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Images.Collect(completedFrame);
+    m_Samplers.Collect(completedFrame);
+    m_Buffers.Collect(completedFrame);
+}
+
+void BindlessHeap::Bind(VkCommandBuffer cmd, VkPipelineBindPoint bindPoint, VkPipelineLayout layout) const {
+    if (!IsEnabled()) return;
+    vkCmdBindDescriptorSets(cmd, bindPoint, layout, 0, 1, &m_Set, 0, nullptr);
+}
+
+void BindlessHeap::PushConstants(VkCommandBuffer cmd, const void* data, u32 size, u32 offset) const {
+    if (!IsEnabled()) return;
+    vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_ALL, offset, size, data);
+}
+
+void BindlessHeap::WriteImage(u32 index, VkImageView view, VkImageLayout layout) {
+    VkDescriptorImageInfo imageInfo{};
+    imageInfo.imageView = view;
+    imageInfo.imageLayout = layout;
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_Set;
+    write.dstBinding = SampledImageBinding;
+    write.dstArrayElement = index;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    write.pImageInfo = &imageInfo;
+    vkUpdateDescriptorSets(m_Context->GetDevice(), 1, &write, 0, nullptr);
+}
+
+void BindlessHeap::WriteBuffer(u32 index, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range) {
+    VkDescriptorBufferInfo bufferInfo{};
+    bufferInfo.buffer = buffer;
+    bufferInfo.offset = offset;
+    bufferInfo.range = range;
+
+    VkWriteDescriptorSet write{};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_Set;
+    write.dstBinding = StorageBufferBinding;
+    write.dstArrayElement = index;
+    write.descriptorCount = 1;
+    write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    write.pBufferInfo = &bufferInfo;
+    vkUpdateDescriptorSets(m_Context->GetDevice(), 1, &write, 0, nullptr);
+}
+
+} // namespace tvk
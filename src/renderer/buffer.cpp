@@ -17,30 +17,54 @@ Buffer::~Buffer() {
 }
 
 Buffer::Buffer(Buffer&& other) noexcept
-    : m_Context(other.m_Context)
+    : m_Renderer(other.m_Renderer)
+    , m_Context(other.m_Context)
     , m_Buffer(other.m_Buffer)
-    , m_Memory(other.m_Memory)
+    , m_Allocation(other.m_Allocation)
     , m_Size(other.m_Size)
     , m_Usage(other.m_Usage)
-    , m_Mapped(other.m_Mapped) {
+    , m_Mapped(other.m_Mapped)
+    , m_BindlessIndex(other.m_BindlessIndex)
+    , m_UploadSerial(other.m_UploadSerial)
+    , m_HasUpload(other.m_HasUpload)
+    , m_HasContents(other.m_HasContents)
+    , m_PendingTransfer(other.m_PendingTransfer) {
     other.m_Buffer = VK_NULL_HANDLE;
-    other.m_Memory = VK_NULL_HANDLE;
+    other.m_Allocation = Allocation{};
     other.m_Mapped = nullptr;
+    other.m_BindlessIndex = BindlessHeap::InvalidIndex;
+    other.m_HasUpload = false;
+
+    if (m_Allocation.IsValid() && IsRelocatable(m_Usage)) {
+        m_Context->GetAllocator().SetRelocatable(m_Allocation, this);
+    }
 }
 
 Buffer& Buffer::operator=(Buffer&& other) noexcept {
     if (this != &other) {
         Cleanup();
+        m_Renderer = other.m_Renderer;
         m_Context = other.m_Context;
         m_Buffer = other.m_Buffer;
-        m_Memory = other.m_Memory;
+        m_Allocation = other.m_Allocation;
         m_Size = other.m_Size;
         m_Usage = other.m_Usage;
         m_Mapped = other.m_Mapped;
+        m_BindlessIndex = other.m_BindlessIndex;
+        m_UploadSerial = other.m_UploadSerial;
+        m_HasUpload = other.m_HasUpload;
+        m_HasContents = other.m_HasContents;
+        m_PendingTransfer = other.m_PendingTransfer;
 
         other.m_Buffer = VK_NULL_HANDLE;
-        other.m_Memory = VK_NULL_HANDLE;
+        other.m_Allocation = Allocation{};
         other.m_Mapped = nullptr;
+        other.m_BindlessIndex = BindlessHeap::InvalidIndex;
+        other.m_HasUpload = false;
+
+        if (m_Allocation.IsValid() && IsRelocatable(m_Usage)) {
+            m_Context->GetAllocator().SetRelocatable(m_Allocation, this);
+        }
     }
     return *this;
 }
@@ -56,83 +80,68 @@ Ref<Buffer> Buffer::Create(Renderer* renderer, VkDeviceSize size, BufferUsage us
 void Buffer::SetData(const void* data, VkDeviceSize size, VkDeviceSize offset) {
     if (!m_Context || !data) return;
 
-    // For device local buffers, use staging
-    VkMemoryPropertyFlags props = GetMemoryProperties(m_Usage);
-    if (props & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT && !(props & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
-        // Create staging buffer
-        VkBuffer stagingBuffer;
-        VkDeviceMemory stagingMemory;
-
-        VkBufferCreateInfo bufferInfo{};
-        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        bufferInfo.size = size;
-        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-        vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &stagingBuffer);
-
-        VkMemoryRequirements memReqs;
-        vkGetBufferMemoryRequirements(m_Context->GetDevice(), stagingBuffer, &memReqs);
-
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memReqs.size;
-        allocInfo.memoryTypeIndex = m_Context->FindMemoryType(
-            memReqs.memoryTypeBits,
-            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-        );
-
-        vkAllocateMemory(m_Context->GetDevice(), &allocInfo, nullptr, &stagingMemory);
-        vkBindBufferMemory(m_Context->GetDevice(), stagingBuffer, stagingMemory, 0);
-
-        void* mapped;
-        vkMapMemory(m_Context->GetDevice(), stagingMemory, 0, size, 0, &mapped);
-        memcpy(mapped, data, static_cast<size_t>(size));
-        vkUnmapMemory(m_Context->GetDevice(), stagingMemory);
-
-        // Copy to device local buffer
-        VkCommandBuffer cmd = m_Context->BeginSingleTimeCommands();
-        
+    MemoryAllocator& allocator = m_Context->GetAllocator();
+
+    m_HasContents = true;
+
+    // For device local buffers, copy through the renderer's staging ring
+    if (IsDeviceLocal(m_Usage)) {
+        WaitForTransfer();
+
+        StagingAllocation staging = m_Renderer->AllocateStaging(size);
+        if (!staging.IsValid()) return;
+
+        memcpy(staging.data, data, static_cast<size_t>(size));
+
         VkBufferCopy copyRegion{};
-        copyRegion.srcOffset = 0;
+        copyRegion.srcOffset = staging.offset;
         copyRegion.dstOffset = offset;
         copyRegion.size = size;
-        vkCmdCopyBuffer(cmd, stagingBuffer, m_Buffer, 1, &copyRegion);
-        
-        m_Context->EndSingleTimeCommands(cmd);
+        vkCmdCopyBuffer(m_Renderer->GetUploadCommandBuffer(), staging.buffer, m_Buffer, 1, &copyRegion);
 
-        vkDestroyBuffer(m_Context->GetDevice(), stagingBuffer, nullptr);
-        vkFreeMemory(m_Context->GetDevice(), stagingMemory, nullptr);
+        m_UploadSerial = m_Renderer->GetUploadSerial();
+        m_HasUpload = true;
     } else {
         // Direct memory mapping
-        void* mapped;
-        vkMapMemory(m_Context->GetDevice(), m_Memory, offset, size, 0, &mapped);
-        memcpy(mapped, data, static_cast<size_t>(size));
-        vkUnmapMemory(m_Context->GetDevice(), m_Memory);
+        void* mapped = allocator.Map(m_Allocation);
+        if (!mapped) return;
+        memcpy(static_cast<u8*>(mapped) + offset, data, static_cast<size_t>(size));
+        allocator.Unmap(m_Allocation);
     }
 }
 
+TransferHandle Buffer::SetDataAsync(const void* data, VkDeviceSize size, VkDeviceSize offset) {
+    if (!m_Context || !data) return {};
+
+    // Frames in flight may read a buffer with contents, only the graphics queue orders the copy after them
+    TransferQueue& transfer = m_Renderer->GetTransferQueue();
+    if (!IsDeviceLocal(m_Usage) || !transfer.IsAsync() || m_HasContents) {
+        SetData(data, size, offset);
+        return {};
+    }
+
+    m_HasContents = true;
+    m_PendingTransfer = transfer.UploadBuffer(m_Buffer, data, size, offset);
+    return m_PendingTransfer;
+}
+
 void* Buffer::Map() {
     if (m_Mapped) return m_Mapped;
+    m_HasContents = true;
     
-    vkMapMemory(m_Context->GetDevice(), m_Memory, 0, m_Size, 0, &m_Mapped);
+    m_Mapped = m_Context->GetAllocator().Map(m_Allocation);
     return m_Mapped;
 }
 
 void Buffer::Unmap() {
     if (!m_Mapped) return;
     
-    vkUnmapMemory(m_Context->GetDevice(), m_Memory);
+    m_Context->GetAllocator().Unmap(m_Allocation);
     m_Mapped = nullptr;
 }
 
 void Buffer::Flush(VkDeviceSize size, VkDeviceSize offset) {
-    VkMappedMemoryRange mappedRange{};
-    mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-    mappedRange.memory = m_Memory;
-    mappedRange.offset = offset;
-    mappedRange.size = size;
-    vkFlushMappedMemoryRanges(m_Context->GetDevice(), 1, &mappedRange);
+    m_Context->GetAllocator().Flush(m_Allocation, offset, size);
 }
 
 void Buffer::BindAsVertex(VkCommandBuffer cmd, u32 binding) const {
@@ -146,6 +155,7 @@ void Buffer::BindAsIndex(VkCommandBuffer cmd, VkIndexType indexType) const {
 }
 
 bool Buffer::Init(Renderer* renderer, VkDeviceSize size, BufferUsage usage, const void* data) {
+    m_Renderer = renderer;
     m_Context = &renderer->GetContext();
     m_Size = size;
     m_Usage = usage;
@@ -156,28 +166,18 @@ bool Buffer::Init(Renderer* renderer, VkDeviceSize size, BufferUsage usage, cons
     bufferInfo.usage = ToVkUsage(usage);
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-    if (vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &m_Buffer) != VK_SUCCESS) {
+    if (!m_Context->GetAllocator().CreateBuffer(bufferInfo, GetMemoryProperties(usage), m_Buffer, m_Allocation)) {
         TVK_LOG_ERROR("Failed to create buffer");
         return false;
     }
 
-    VkMemoryRequirements memReqs;
-    vkGetBufferMemoryRequirements(m_Context->GetDevice(), m_Buffer, &memReqs);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memReqs.size;
-    allocInfo.memoryTypeIndex = m_Context->FindMemoryType(
-        memReqs.memoryTypeBits,
-        GetMemoryProperties(usage)
-    );
-
-    if (vkAllocateMemory(m_Context->GetDevice(), &allocInfo, nullptr, &m_Memory) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to allocate buffer memory");
-        return false;
+    if (IsRelocatable(usage)) {
+        m_Context->GetAllocator().SetRelocatable(m_Allocation, this);
     }
 
-    vkBindBufferMemory(m_Context->GetDevice(), m_Buffer, m_Memory, 0);
+    if (bufferInfo.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) {
+        m_BindlessIndex = renderer->GetBindlessHeap().AddBuffer(m_Buffer);
+    }
 
     if (data) {
         SetData(data, size);
@@ -193,31 +193,88 @@ void Buffer::Cleanup() {
         Unmap();
     }
 
-    if (m_Buffer != VK_NULL_HANDLE) {
-        vkDestroyBuffer(m_Context->GetDevice(), m_Buffer, nullptr);
+    // A copy into this buffer that is still being recorded must not outlive it
+    if (m_HasUpload && m_Renderer->HasPendingUploads() && m_UploadSerial == m_Renderer->GetUploadSerial()) {
+        m_Renderer->FlushUploads();
+    }
+    m_HasUpload = false;
+
+    // The transfer queue may still be writing into it
+    WaitForTransfer();
+
+    if (m_BindlessIndex != BindlessHeap::InvalidIndex) {
+        m_Renderer->GetBindlessHeap().RemoveBuffer(m_BindlessIndex, m_Renderer->GetFrameNumber());
+        m_BindlessIndex = BindlessHeap::InvalidIndex;
+    }
+
+    if (m_Buffer != VK_NULL_HANDLE || m_Allocation.IsValid()) {
+        m_Context->GetAllocator().DestroyBuffer(m_Buffer, m_Allocation);
         m_Buffer = VK_NULL_HANDLE;
     }
+}
 
-    if (m_Memory != VK_NULL_HANDLE) {
-        vkFreeMemory(m_Context->GetDevice(), m_Memory, nullptr);
-        m_Memory = VK_NULL_HANDLE;
+void Buffer::WaitForTransfer() {
+    if (!m_PendingTransfer.IsComplete()) {
+        m_PendingTransfer.Wait();
     }
+    m_PendingTransfer = {};
+}
+
+bool Buffer::BeginRelocation(VkCommandBuffer cmd, VmaAllocation destination) {
+    if (m_Mapped) return false;
+
+    // Copies still being recorded or on the transfer queue target the current handle, it stays until they ran
+    if (m_HasUpload && m_Renderer->HasPendingUploads() && m_UploadSerial == m_Renderer->GetUploadSerial()) return false;
+    if (!m_PendingTransfer.IsComplete()) return false;
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = m_Size;
+    bufferInfo.usage = ToVkUsage(m_Usage);
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &m_RelocatedBuffer) != VK_SUCCESS) {
+        m_RelocatedBuffer = VK_NULL_HANDLE;
+        return false;
+    }
+
+    if (!m_Context->GetAllocator().BindBuffer(destination, m_RelocatedBuffer)) {
+        vkDestroyBuffer(m_Context->GetDevice(), m_RelocatedBuffer, nullptr);
+        m_RelocatedBuffer = VK_NULL_HANDLE;
+        return false;
+    }
+
+    VkBufferCopy copyRegion{};
+    copyRegion.size = m_Size;
+    vkCmdCopyBuffer(cmd, m_Buffer, m_RelocatedBuffer, 1, &copyRegion);
+    return true;
+}
+
+void Buffer::EndRelocation() {
+    vkDestroyBuffer(m_Context->GetDevice(), m_Buffer, nullptr);
+    m_Buffer = m_RelocatedBuffer;
+    m_RelocatedBuffer = VK_NULL_HANDLE;
 }
 
 VkBufferUsageFlags Buffer::ToVkUsage(BufferUsage usage) {
     switch (usage) {
+        // Device local buffers are also transfer sources so defragmentation can copy them
         case BufferUsage::Vertex:
-            return VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            return VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         case BufferUsage::Index:
-            return VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            return VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         case BufferUsage::Uniform:
             return VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
         case BufferUsage::Storage:
-            return VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            return VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         case BufferUsage::StorageShared:
             return VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         case BufferUsage::Staging:
             return VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        case BufferUsage::Instance:
+            return VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        case BufferUsage::Indirect:
+            return VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
         default:
             return VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
     }
@@ -228,6 +285,8 @@ VkMemoryPropertyFlags Buffer::GetMemoryProperties(BufferUsage usage) {
         case BufferUsage::Vertex:
         case BufferUsage::Index:
         case BufferUsage::Storage:
+        case BufferUsage::Instance:
+        case BufferUsage::Indirect:
             return VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
         case BufferUsage::StorageShared:
         case BufferUsage::Uniform:
@@ -238,4 +297,14 @@ VkMemoryPropertyFlags Buffer::GetMemoryProperties(BufferUsage usage) {
     }
 }
 
+bool Buffer::IsDeviceLocal(BufferUsage usage) {
+    VkMemoryPropertyFlags props = GetMemoryProperties(usage);
+    return (props & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) && !(props & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+}
+
+bool Buffer::IsRelocatable(BufferUsage usage) {
+    // Host visible buffers may be mapped by the user, descriptor sets keep the handle of storage buffers
+    return IsDeviceLocal(usage) && !(ToVkUsage(usage) & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+}
+
 } // namespace tvk
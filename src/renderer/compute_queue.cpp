@@ -0,0 +1,500 @@
+/**
+ * @file compute_queue.cpp
+ * @brief Asynchronous compute queue implementation
+ */
+
+#include "tinyvk/renderer/compute_queue.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+#include "tinyvk/core/timer.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace tvk {
+
+bool ComputeHandle::IsComplete() const {
+    return !queue || queue->IsComplete(value);
+}
+
+void ComputeHandle::Wait() const {
+    if (queue) {
+        queue->Wait(value);
+    }
+}
+
+ComputeQueue::~ComputeQueue() {
+    Cleanup();
+}
+
+bool ComputeQueue::Init(VulkanContext* context) {
+    m_Context = context;
+
+    if (!context->GetVulkan12Features().timelineSemaphore) {
+        TVK_LOG_WARN("Timeline semaphores not supported");
+        m_Context = nullptr;
+        return false;
+    }
+
+    const auto& indices = context->GetQueueFamilyIndices();
+    m_ComputeFamily = indices.computeFamily.value();
+    m_GraphicsFamily = indices.graphicsFamily.value();
+    m_Queue = context->GetComputeQueue();
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = m_ComputeFamily;
+
+    if (vkCreateCommandPool(context->GetDevice(), &poolInfo, nullptr, &m_CommandPool) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create compute command pool");
+        Cleanup();
+        return false;
+    }
+
+    VkSemaphoreTypeCreateInfo typeInfo{};
+    typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext = &typeInfo;
+
+    if (vkCreateSemaphore(context->GetDevice(), &semaphoreInfo, nullptr, &m_Timeline) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create compute timeline semaphore");
+        Cleanup();
+        return false;
+    }
+
+    m_NextValue = 1;
+
+    // Batches are timed when the compute family writes timestamps
+    u32 validBits = context->GetTimestampValidBits(m_ComputeFamily);
+    if (validBits > 0) {
+        VkQueryPoolCreateInfo queryPoolInfo{};
+        queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolInfo.queryCount = MaxTimedBatches * 2;
+
+        if (vkCreateQueryPool(context->GetDevice(), &queryPoolInfo, nullptr, &m_TimestampPool) == VK_SUCCESS) {
+            m_TimestampMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+            m_TimestampPeriod = context->GetDeviceProperties().limits.timestampPeriod;
+            for (u32 i = MaxTimedBatches; i > 0; i--) {
+                m_FreeTimestampQueries.push_back(i - 1);
+            }
+        }
+    }
+
+    if (context->HasDedicatedComputeQueue()) {
+        TVK_LOG_INFO("Using dedicated compute queue family {}", m_ComputeFamily);
+    }
+    return true;
+}
+
+void ComputeQueue::Cleanup() {
+    if (!m_Context) return;
+
+    VkDevice device = m_Context->GetDevice();
+
+    if (m_Timeline != VK_NULL_HANDLE) {
+        if (m_Recording) {
+            Submit();
+        }
+        WaitForValue(m_NextValue - 1);
+        vkDestroySemaphore(device, m_Timeline, nullptr);
+        m_Timeline = VK_NULL_HANDLE;
+    }
+
+    if (m_CommandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device, m_CommandPool, nullptr);
+        m_CommandPool = VK_NULL_HANDLE;
+    }
+
+    if (m_TimestampPool != VK_NULL_HANDLE) {
+        vkDestroyQueryPool(device, m_TimestampPool, nullptr);
+        m_TimestampPool = VK_NULL_HANDLE;
+    }
+
+    // Readbacks that were never delivered are dropped
+    for (auto& readback : m_Readbacks) {
+        m_Context->GetAllocator().DestroyBuffer(readback.buffer.buffer, readback.buffer.allocation);
+    }
+    for (auto& readbackBuffer : m_FreeReadbackBuffers) {
+        m_Context->GetAllocator().DestroyBuffer(readbackBuffer.buffer, readbackBuffer.allocation);
+    }
+
+    m_InFlight.clear();
+    m_FreeCommandBuffers.clear();
+    m_Waits.clear();
+    m_Releases.clear();
+    m_Acquires.clear();
+    m_Readbacks.clear();
+    m_FreeReadbackBuffers.clear();
+    m_FreeTimestampQueries.clear();
+    m_TimestampQuery = NoTimestamps;
+    m_CommandBuffer = VK_NULL_HANDLE;
+    m_Recording = false;
+    m_Queue = VK_NULL_HANDLE;
+    m_Context = nullptr;
+}
+
+VkCommandBuffer ComputeQueue::Begin() {
+    if (!IsAsync()) return VK_NULL_HANDLE;
+    if (m_Recording) return m_CommandBuffer;
+
+    Recycle(GetCompletedValue());
+
+    if (!m_FreeCommandBuffers.empty()) {
+        m_CommandBuffer = m_FreeCommandBuffers.back();
+        m_FreeCommandBuffers.pop_back();
+        vkResetCommandBuffer(m_CommandBuffer, 0);
+    } else {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_CommandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        vkAllocateCommandBuffers(m_Context->GetDevice(), &allocInfo, &m_CommandBuffer);
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(m_CommandBuffer, &beginInfo);
+
+    m_Context->CmdBeginDebugLabel(m_CommandBuffer, "Compute");
+    if (!m_FreeTimestampQueries.empty()) {
+        m_TimestampQuery = m_FreeTimestampQueries.back();
+        m_FreeTimestampQueries.pop_back();
+        vkCmdResetQueryPool(m_CommandBuffer, m_TimestampPool, m_TimestampQuery * 2, 2);
+        vkCmdWriteTimestamp(m_CommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_TimestampPool, m_TimestampQuery * 2);
+    }
+
+    m_Recording = true;
+    return m_CommandBuffer;
+}
+
+void ComputeQueue::ReleaseBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size) {
+    if (!IsAsync() || buffer == VK_NULL_HANDLE) return;
+
+    PendingAcquire release;
+    release.barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    release.barrier.srcQueueFamilyIndex = m_ComputeFamily;
+    release.barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+    release.barrier.buffer = buffer;
+    release.barrier.offset = offset;
+    release.barrier.size = size;
+    m_Releases.push_back(release);
+}
+
+void ComputeQueue::AcquireBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size) {
+    if (!IsAsync() || buffer == VK_NULL_HANDLE) return;
+
+    VkCommandBuffer cmd = Begin();
+
+    // On a shared family the semaphore wait alone makes the upload visible
+    if (m_ComputeFamily == m_GraphicsFamily) return;
+
+    VkBufferMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.srcQueueFamilyIndex = m_GraphicsFamily;
+    barrier.dstQueueFamilyIndex = m_ComputeFamily;
+    barrier.buffer = buffer;
+    barrier.offset = offset;
+    barrier.size = size;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                         0, nullptr, 1, &barrier, 0, nullptr);
+}
+
+void ComputeQueue::WaitSemaphore(VkSemaphore semaphore, u64 value, VkPipelineStageFlags stage) {
+    if (!IsAsync() || semaphore == VK_NULL_HANDLE || value == 0) return;
+
+    for (auto& wait : m_Waits) {
+        if (wait.semaphore == semaphore) {
+            wait.value = std::max(wait.value, value);
+            wait.stage |= stage;
+            return;
+        }
+    }
+    m_Waits.push_back({semaphore, value, stage});
+}
+
+ComputeHandle ComputeQueue::ReadBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, ReadbackCallback callback) {
+    ComputeHandle handle;
+    if (!IsAsync() || buffer == VK_NULL_HANDLE || size == 0) return handle;
+
+    PendingReadback readback;
+    if (!AcquireReadbackBuffer(size, readback.buffer)) return handle;
+
+    VkCommandBuffer cmd = Begin();
+
+    // Shader writes of the batch become visible to the copy, the copy to the host
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = offset;
+    copyRegion.dstOffset = 0;
+    copyRegion.size = size;
+    vkCmdCopyBuffer(cmd, buffer, readback.buffer.buffer, 1, &copyRegion);
+
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    readback.value = m_NextValue;
+    readback.size = size;
+    readback.callback = std::move(callback);
+    m_Readbacks.push_back(std::move(readback));
+
+    handle.queue = this;
+    handle.value = m_NextValue;
+    return handle;
+}
+
+ComputeHandle ComputeQueue::Submit() {
+    ComputeHandle handle;
+    if (!IsAsync()) return handle;
+
+    handle.queue = this;
+    if (!m_Recording) {
+        handle.value = m_NextValue - 1;
+        return handle;
+    }
+
+    u64 value = m_NextValue++;
+    bool transferOwnership = m_ComputeFamily != m_GraphicsFamily;
+
+    // Without a dedicated queue the timeline wait alone orders graphics after the batch
+    std::vector<VkBufferMemoryBarrier> releaseBarriers;
+    for (auto& release : m_Releases) {
+        release.value = value;
+        if (transferOwnership) {
+            VkBufferMemoryBarrier barrier = release.barrier;
+            barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask = 0;
+            releaseBarriers.push_back(barrier);
+        }
+    }
+
+    if (!releaseBarriers.empty()) {
+        vkCmdPipelineBarrier(m_CommandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                             0, nullptr,
+                             static_cast<u32>(releaseBarriers.size()), releaseBarriers.data(),
+                             0, nullptr);
+    }
+
+    if (m_TimestampQuery != NoTimestamps) {
+        vkCmdWriteTimestamp(m_CommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_TimestampPool, m_TimestampQuery * 2 + 1);
+    }
+    m_Context->CmdEndDebugLabel(m_CommandBuffer);
+
+    vkEndCommandBuffer(m_CommandBuffer);
+
+    // Inputs written on other queues, e.g. this frame's uploads
+    std::vector<VkSemaphore> waitSemaphores;
+    std::vector<VkPipelineStageFlags> waitStages;
+    std::vector<u64> waitValues;
+    for (const auto& wait : m_Waits) {
+        waitSemaphores.push_back(wait.semaphore);
+        waitStages.push_back(wait.stage);
+        waitValues.push_back(wait.value);
+    }
+    m_Waits.clear();
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.waitSemaphoreValueCount = static_cast<u32>(waitValues.size());
+    timelineInfo.pWaitSemaphoreValues = waitValues.data();
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues = &value;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.waitSemaphoreCount = static_cast<u32>(waitSemaphores.size());
+    submitInfo.pWaitSemaphores = waitSemaphores.data();
+    submitInfo.pWaitDstStageMask = waitStages.data();
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &m_CommandBuffer;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = &m_Timeline;
+
+    if (vkQueueSubmit(m_Queue, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to submit compute command buffer");
+    }
+
+    Submission submission;
+    submission.commandBuffer = m_CommandBuffer;
+    submission.value = value;
+    submission.timestampQuery = m_TimestampQuery;
+    m_InFlight.push_back(submission);
+    m_TimestampQuery = NoTimestamps;
+
+    m_Acquires.insert(m_Acquires.end(), m_Releases.begin(), m_Releases.end());
+    m_Releases.clear();
+
+    m_CommandBuffer = VK_NULL_HANDLE;
+    m_Recording = false;
+
+    handle.value = value;
+    return handle;
+}
+
+bool ComputeQueue::IsComplete(u64 value) const {
+    return !IsAsync() || value <= GetCompletedValue();
+}
+
+void ComputeQueue::Wait(u64 value) {
+    if (!IsAsync()) return;
+
+    if (m_Recording && value >= m_NextValue) {
+        Submit();
+    }
+    WaitForValue(std::min(value, m_NextValue - 1));
+    Update();
+}
+
+void ComputeQueue::Update() {
+    if (!IsAsync()) return;
+
+    u64 completed = GetCompletedValue();
+    Recycle(completed);
+
+    size_t finished = 0;
+    while (finished < m_Readbacks.size() && m_Readbacks[finished].value <= completed) {
+        finished++;
+    }
+    if (finished == 0) return;
+
+    // Callbacks may record new readbacks
+    std::vector<PendingReadback> delivered(std::make_move_iterator(m_Readbacks.begin()),
+                                           std::make_move_iterator(m_Readbacks.begin() + finished));
+    m_Readbacks.erase(m_Readbacks.begin(), m_Readbacks.begin() + finished);
+
+    for (auto& readback : delivered) {
+        if (readback.callback) {
+            readback.callback(readback.buffer.allocation.mapped, readback.size);
+        }
+        m_FreeReadbackBuffers.push_back(readback.buffer);
+    }
+}
+
+u64 ComputeQueue::Acquire(u64 value, VkCommandBuffer graphicsCmd) {
+    if (!IsAsync() || value == 0) return 0;
+
+    // The graphics submission must not wait on a value that is never signaled
+    if (m_Recording && value >= m_NextValue) {
+        Submit();
+    }
+    value = std::min(value, m_NextValue - 1);
+
+    bool transferOwnership = m_ComputeFamily != m_GraphicsFamily;
+    std::vector<VkBufferMemoryBarrier> acquireBarriers;
+
+    size_t acquired = 0;
+    while (acquired < m_Acquires.size() && m_Acquires[acquired].value <= value) {
+        if (transferOwnership) {
+            VkBufferMemoryBarrier barrier = m_Acquires[acquired].barrier;
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            acquireBarriers.push_back(barrier);
+        }
+        acquired++;
+    }
+    m_Acquires.erase(m_Acquires.begin(), m_Acquires.begin() + acquired);
+
+    if (!acquireBarriers.empty()) {
+        vkCmdPipelineBarrier(graphicsCmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                             0, nullptr,
+                             static_cast<u32>(acquireBarriers.size()), acquireBarriers.data(),
+                             0, nullptr);
+    }
+
+    return value;
+}
+
+bool ComputeQueue::HasCompletedReleases() const {
+    return IsAsync() && !m_Acquires.empty() && m_Acquires.front().value <= GetCompletedValue();
+}
+
+u64 ComputeQueue::AcquireCompleted(VkCommandBuffer graphicsCmd) {
+    if (!IsAsync()) return 0;
+    return Acquire(GetCompletedValue(), graphicsCmd);
+}
+
+bool ComputeQueue::AcquireReadbackBuffer(VkDeviceSize size, ReadbackBuffer& buffer) {
+    // Reuse the smallest free buffer that fits
+    auto best = m_FreeReadbackBuffers.end();
+    for (auto it = m_FreeReadbackBuffers.begin(); it != m_FreeReadbackBuffers.end(); ++it) {
+        if (it->capacity >= size && (best == m_FreeReadbackBuffers.end() || it->capacity < best->capacity)) {
+            best = it;
+        }
+    }
+    if (best != m_FreeReadbackBuffers.end()) {
+        buffer = *best;
+        m_FreeReadbackBuffers.erase(best);
+        return true;
+    }
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (!m_Context->GetAllocator().CreateBuffer(bufferInfo,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            buffer.buffer, buffer.allocation, true)) {
+        TVK_LOG_ERROR("Failed to create {} byte readback buffer", size);
+        return false;
+    }
+    buffer.capacity = size;
+    return true;
+}
+
+void ComputeQueue::WaitForValue(u64 value) const {
+    VkSemaphoreWaitInfo waitInfo{};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &m_Timeline;
+    waitInfo.pValues = &value;
+    vkWaitSemaphores(m_Context->GetDevice(), &waitInfo, UINT64_MAX);
+}
+
+u64 ComputeQueue::GetCompletedValue() const {
+    u64 value = 0;
+    vkGetSemaphoreCounterValue(m_Context->GetDevice(), m_Timeline, &value);
+    return value;
+}
+
+void ComputeQueue::Recycle(u64 completed) {
+    size_t finished = 0;
+    while (finished < m_InFlight.size() && m_InFlight[finished].value <= completed) {
+        const Submission& submission = m_InFlight[finished];
+        m_FreeCommandBuffers.push_back(submission.commandBuffer);
+
+        // The batch finished, the results are available without waiting
+        if (submission.timestampQuery != NoTimestamps) {
+            u64 timestamps[2] = {};
+            if (vkGetQueryPoolResults(m_Context->GetDevice(), m_TimestampPool, submission.timestampQuery * 2, 2,
+                                      sizeof(timestamps), timestamps, sizeof(u64), VK_QUERY_RESULT_64_BIT) == VK_SUCCESS) {
+                u64 ticks = (timestamps[1] - timestamps[0]) & m_TimestampMask;
+                Profiler::instance().addSample("GPU: Compute", static_cast<double>(ticks) * m_TimestampPeriod / 1000000.0);
+            }
+            m_FreeTimestampQueries.push_back(submission.timestampQuery);
+        }
+        finished++;
+    }
+    m_InFlight.erase(m_InFlight.begin(), m_InFlight.begin() + finished);
+}
+
+} // namespace tvk
@@ -5,6 +5,7 @@
 
 #include "tinyvk/renderer/context.h"
 #include "tinyvk/core/log.h"
+#include "tinyvk/core/hash.h"
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
@@ -12,6 +13,8 @@
 #include <set>
 #include <cstring>
 #include <algorithm>
+#include <fstream>
+#include <filesystem>
 
 namespace tvk {
 
@@ -28,6 +31,21 @@ static const std::vector<const char*> s_DeviceExtensions = {
 #endif
 };
 
+// Written ahead of the driver's cache data, a mismatch discards the file
+struct PipelineCacheFileHeader {
+    u32 magic;
+    u32 version;
+    u32 vendorID;
+    u32 deviceID;
+    u32 driverVersion;
+    u8 pipelineCacheUUID[VK_UUID_SIZE];
+    u64 dataSize;
+    u64 checksum;
+};
+
+static constexpr u32 s_PipelineCacheMagic = 0x43505654;   // "TVPC"
+static constexpr u32 s_PipelineCacheVersion = 1;
+
 // Debug callback
 static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
     VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
@@ -81,6 +99,7 @@ VulkanContext::~VulkanContext() {
 
 bool VulkanContext::Init(GLFWwindow* window, const ContextConfig& config) {
     m_ValidationEnabled = config.enableValidation;
+    m_Headless = window == nullptr;
 
     if (!CreateInstance(config)) {
         TVK_LOG_ERROR("Failed to create Vulkan instance");
@@ -91,7 +110,7 @@ bool VulkanContext::Init(GLFWwindow* window, const ContextConfig& config) {
         TVK_LOG_WARN("Failed to set up debug messenger");
     }
 
-    if (!CreateSurface(window)) {
+    if (!m_Headless && !CreateSurface(window)) {
         TVK_LOG_ERROR("Failed to create window surface");
         return false;
     }
@@ -106,6 +125,13 @@ bool VulkanContext::Init(GLFWwindow* window, const ContextConfig& config) {
         return false;
     }
 
+    if (!m_Allocator.Init(this, config.memoryBlockSize)) {
+        TVK_LOG_ERROR("Failed to create memory allocator");
+        return false;
+    }
+
+    m_SamplerCache.Init(this);
+
     if (!CreateCommandPool()) {
         TVK_LOG_ERROR("Failed to create command pool");
         return false;
@@ -116,6 +142,12 @@ bool VulkanContext::Init(GLFWwindow* window, const ContextConfig& config) {
         return false;
     }
 
+    m_PipelineCachePath = config.pipelineCachePath;
+    if (!CreatePipelineCache()) {
+        TVK_LOG_ERROR("Failed to create pipeline cache");
+        return false;
+    }
+
     TVK_LOG_INFO("Vulkan context initialized successfully");
     TVK_LOG_INFO("GPU: {}", m_DeviceProperties.deviceName);
     return true;
@@ -125,6 +157,12 @@ void VulkanContext::Cleanup() {
     if (m_Device != VK_NULL_HANDLE) {
         vkDeviceWaitIdle(m_Device);
 
+        if (m_PipelineCache != VK_NULL_HANDLE) {
+            SavePipelineCache();
+            vkDestroyPipelineCache(m_Device, m_PipelineCache, nullptr);
+            m_PipelineCache = VK_NULL_HANDLE;
+        }
+
         if (m_DescriptorPool != VK_NULL_HANDLE) {
             vkDestroyDescriptorPool(m_Device, m_DescriptorPool, nullptr);
             m_DescriptorPool = VK_NULL_HANDLE;
@@ -135,6 +173,9 @@ void VulkanContext::Cleanup() {
             m_CommandPool = VK_NULL_HANDLE;
         }
 
+        m_SamplerCache.Cleanup();
+        m_Allocator.Cleanup();
+
         vkDestroyDevice(m_Device, nullptr);
         m_Device = VK_NULL_HANDLE;
     }
@@ -155,6 +196,115 @@ void VulkanContext::Cleanup() {
     }
 }
 
+bool VulkanContext::CreatePipelineCache() {
+    std::vector<u8> data;
+
+    if (!m_PipelineCachePath.empty()) {
+        std::ifstream file(m_PipelineCachePath, std::ios::binary | std::ios::ate);
+        if (file.is_open()) {
+            size_t fileSize = static_cast<size_t>(file.tellg());
+            file.seekg(0);
+
+            PipelineCacheFileHeader header{};
+            if (fileSize >= sizeof(header)) {
+                file.read(reinterpret_cast<char*>(&header), sizeof(header));
+            }
+
+            // Only reuse data written by the same driver for the same device
+            bool valid = fileSize >= sizeof(header) &&
+                         header.magic == s_PipelineCacheMagic &&
+                         header.version == s_PipelineCacheVersion &&
+                         header.vendorID == m_DeviceProperties.vendorID &&
+                         header.deviceID == m_DeviceProperties.deviceID &&
+                         header.driverVersion == m_DeviceProperties.driverVersion &&
+                         memcmp(header.pipelineCacheUUID, m_DeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+                         header.dataSize == fileSize - sizeof(header);
+
+            if (valid) {
+                data.resize(static_cast<size_t>(header.dataSize));
+                file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+                if (!file || HashBytes(data.data(), data.size()) != header.checksum) {
+                    data.clear();
+                    valid = false;
+                }
+            }
+
+            if (valid) {
+                TVK_LOG_INFO("Loaded pipeline cache ({} bytes)", data.size());
+            } else {
+                TVK_LOG_WARN("Pipeline cache {} is stale or corrupt, starting empty", m_PipelineCachePath);
+            }
+        }
+    }
+
+    VkPipelineCacheCreateInfo cacheInfo{};
+    cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cacheInfo.initialDataSize = data.size();
+    cacheInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+    if (vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_PipelineCache) == VK_SUCCESS) {
+        return true;
+    }
+
+    // The driver may still reject data that passed the header check
+    if (!data.empty()) {
+        cacheInfo.initialDataSize = 0;
+        cacheInfo.pInitialData = nullptr;
+        return vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_PipelineCache) == VK_SUCCESS;
+    }
+    return false;
+}
+
+bool VulkanContext::SavePipelineCache() {
+    if (m_PipelineCache == VK_NULL_HANDLE || m_PipelineCachePath.empty()) return false;
+
+    size_t size = 0;
+    if (vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, nullptr) != VK_SUCCESS || size == 0) {
+        return false;
+    }
+
+    std::vector<u8> data(size);
+    if (vkGetPipelineCacheData(m_Device, m_PipelineCache, &size, data.data()) != VK_SUCCESS) {
+        TVK_LOG_WARN("Failed to read pipeline cache data");
+        return false;
+    }
+    data.resize(size);
+
+    PipelineCacheFileHeader header{};
+    header.magic = s_PipelineCacheMagic;
+    header.version = s_PipelineCacheVersion;
+    header.vendorID = m_DeviceProperties.vendorID;
+    header.deviceID = m_DeviceProperties.deviceID;
+    header.driverVersion = m_DeviceProperties.driverVersion;
+    memcpy(header.pipelineCacheUUID, m_DeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    header.dataSize = data.size();
+    header.checksum = HashBytes(data.data(), data.size());
+
+    // Write next to the target and swap it in, so an interrupted save never leaves a torn file
+    std::string tempPath = m_PipelineCachePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            TVK_LOG_WARN("Failed to write pipeline cache {}", tempPath);
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            TVK_LOG_WARN("Failed to write pipeline cache {}", tempPath);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, m_PipelineCachePath, error);
+    if (error) {
+        TVK_LOG_WARN("Failed to replace pipeline cache {}: {}", m_PipelineCachePath, error.message());
+        return false;
+    }
+    return true;
+}
+
 void VulkanContext::WaitIdle() {
     if (m_Device != VK_NULL_HANDLE) {
         vkDeviceWaitIdle(m_Device);
@@ -176,6 +326,9 @@ bool VulkanContext::CreateInstance(const ContextConfig& config) {
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
     appInfo.apiVersion = VK_API_VERSION_1_2;
 
+    // Command buffer labels for debuggers and profilers, independent of validation
+    m_DebugLabelsEnabled = config.enableGPUDebugMarkers && CheckInstanceExtensionSupport(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+
     auto extensions = GetRequiredExtensions(config);
 
     VkInstanceCreateInfo createInfo{};
@@ -225,6 +378,12 @@ bool VulkanContext::CreateInstance(const ContextConfig& config) {
         return false;
     }
 
+    if (m_DebugLabelsEnabled) {
+        m_CmdBeginDebugLabel = (PFN_vkCmdBeginDebugUtilsLabelEXT)vkGetInstanceProcAddr(m_Instance, "vkCmdBeginDebugUtilsLabelEXT");
+        m_CmdEndDebugLabel = (PFN_vkCmdEndDebugUtilsLabelEXT)vkGetInstanceProcAddr(m_Instance, "vkCmdEndDebugUtilsLabelEXT");
+        m_DebugLabelsEnabled = m_CmdBeginDebugLabel && m_CmdEndDebugLabel;
+    }
+
     return true;
 }
 
@@ -298,16 +457,31 @@ bool VulkanContext::CreateLogicalDevice(const ContextConfig& config) {
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
     std::set<u32> uniqueQueueFamilies = {
         m_QueueFamilyIndices.graphicsFamily.value(),
-        m_QueueFamilyIndices.presentFamily.value()
+        m_QueueFamilyIndices.presentFamily.value(),
+        m_QueueFamilyIndices.transferFamily.value(),
+        m_QueueFamilyIndices.computeFamily.value()
     };
 
-    float queuePriority = 1.0f;
+    u32 queueFamilyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &queueFamilyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &queueFamilyCount, queueFamilies.data());
+
+    // Async compute sharing a family with transfers gets a queue of its own when there is one
+    u32 computeFamily = m_QueueFamilyIndices.computeFamily.value();
+    u32 computeQueueIndex = 0;
+    if (HasDedicatedComputeQueue() && computeFamily == m_QueueFamilyIndices.transferFamily.value() &&
+        queueFamilies[computeFamily].queueCount > 1) {
+        computeQueueIndex = 1;
+    }
+
+    float queuePriorities[] = {1.0f, 1.0f};
     for (u32 queueFamily : uniqueQueueFamilies) {
         VkDeviceQueueCreateInfo queueCreateInfo{};
         queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
         queueCreateInfo.queueFamilyIndex = queueFamily;
-        queueCreateInfo.queueCount = 1;
-        queueCreateInfo.pQueuePriorities = &queuePriority;
+        queueCreateInfo.queueCount = (queueFamily == computeFamily) ? computeQueueIndex + 1 : 1;
+        queueCreateInfo.pQueuePriorities = queuePriorities;
         queueCreateInfos.push_back(queueCreateInfo);
     }
 
@@ -316,24 +490,139 @@ bool VulkanContext::CreateLogicalDevice(const ContextConfig& config) {
     vkGetPhysicalDeviceFeatures(m_PhysicalDevice, &supportedFeatures);
 
     // Only request features that are supported
-    VkPhysicalDeviceFeatures deviceFeatures{};
+    m_Features = {};
     if (supportedFeatures.samplerAnisotropy) {
-        deviceFeatures.samplerAnisotropy = VK_TRUE;
+        m_Features.samplerAnisotropy = VK_TRUE;
     }
     if (supportedFeatures.fillModeNonSolid) {
-        deviceFeatures.fillModeNonSolid = VK_TRUE;
+        m_Features.fillModeNonSolid = VK_TRUE;
     }
     if (supportedFeatures.wideLines) {
-        deviceFeatures.wideLines = VK_TRUE;
+        m_Features.wideLines = VK_TRUE;
+    }
+    if (supportedFeatures.multiDrawIndirect) {
+        m_Features.multiDrawIndirect = VK_TRUE;
+    }
+    if (supportedFeatures.drawIndirectFirstInstance) {
+        m_Features.drawIndirectFirstInstance = VK_TRUE;
+    }
+    if (supportedFeatures.textureCompressionBC) {
+        m_Features.textureCompressionBC = VK_TRUE;
+    }
+    if (supportedFeatures.textureCompressionETC2) {
+        m_Features.textureCompressionETC2 = VK_TRUE;
+    }
+    if (supportedFeatures.textureCompressionASTC_LDR) {
+        m_Features.textureCompressionASTC_LDR = VK_TRUE;
+    }
+    if (supportedFeatures.pipelineStatisticsQuery) {
+        m_Features.pipelineStatisticsQuery = VK_TRUE;
+    }
+
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR supportedDynamicRendering{};
+    supportedDynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+    VkPhysicalDevicePresentIdFeaturesKHR supportedPresentId{};
+    supportedPresentId.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+    VkPhysicalDevicePresentWaitFeaturesKHR supportedPresentWait{};
+    supportedPresentWait.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+    VkPhysicalDeviceVulkan12Features supported12{};
+    supported12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+    // Extension features are only queried when the extension is present
+    void** supportedChain = &supported12.pNext;
+    bool dynamicRenderingExtension = config.enableDynamicRendering &&
+        CheckDeviceExtensionSupport(m_PhysicalDevice, {VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME});
+    if (dynamicRenderingExtension) {
+        *supportedChain = &supportedDynamicRendering;
+        supportedChain = &supportedDynamicRendering.pNext;
+    }
+    bool presentWaitExtensions = config.enablePresentWait && !m_Headless &&
+        CheckDeviceExtensionSupport(m_PhysicalDevice, {VK_KHR_PRESENT_ID_EXTENSION_NAME, VK_KHR_PRESENT_WAIT_EXTENSION_NAME});
+    if (presentWaitExtensions) {
+        *supportedChain = &supportedPresentId;
+        supportedPresentId.pNext = &supportedPresentWait;
+        supportedChain = &supportedPresentWait.pNext;
+    }
+    VkPhysicalDeviceFeatures2 supportedFeatures2{};
+    supportedFeatures2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    supportedFeatures2.pNext = &supported12;
+    vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &supportedFeatures2);
+
+    m_Features12 = {};
+    m_Features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    if (supported12.timelineSemaphore) {
+        m_Features12.timelineSemaphore = VK_TRUE;
+    }
+    if (supported12.drawIndirectCount) {
+        m_Features12.drawIndirectCount = VK_TRUE;
+    }
+    if (supported12.hostQueryReset) {
+        m_Features12.hostQueryReset = VK_TRUE;
+    }
+
+    // Descriptor indexing for the bindless heap, all or nothing
+    m_BindlessSupported = supported12.runtimeDescriptorArray &&
+                          supported12.descriptorBindingPartiallyBound &&
+                          supported12.descriptorBindingUpdateUnusedWhilePending &&
+                          supported12.descriptorBindingSampledImageUpdateAfterBind &&
+                          supported12.descriptorBindingStorageBufferUpdateAfterBind &&
+                          supported12.shaderSampledImageArrayNonUniformIndexing &&
+                          supported12.shaderStorageBufferArrayNonUniformIndexing;
+    if (m_BindlessSupported) {
+        m_Features12.descriptorIndexing = supported12.descriptorIndexing;
+        m_Features12.runtimeDescriptorArray = VK_TRUE;
+        m_Features12.descriptorBindingPartiallyBound = VK_TRUE;
+        m_Features12.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+        m_Features12.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        m_Features12.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+        m_Features12.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        m_Features12.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+    }
+
+    // Optional extensions
+    std::vector<const char*> extensions = GetRequiredDeviceExtensions();
+    m_MemoryBudgetEnabled = CheckDeviceExtensionSupport(m_PhysicalDevice, {VK_EXT_MEMORY_BUDGET_EXTENSION_NAME});
+    if (m_MemoryBudgetEnabled) {
+        extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
+    void** enabledChain = &m_Features12.pNext;
+
+    // Render pass free rendering, also exposed by Vulkan 1.3 drivers as the extension
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures{};
+    dynamicRenderingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+    m_DynamicRenderingEnabled = dynamicRenderingExtension && supportedDynamicRendering.dynamicRendering;
+    if (m_DynamicRenderingEnabled) {
+        extensions.push_back(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME);
+        dynamicRenderingFeatures.dynamicRendering = VK_TRUE;
+        *enabledChain = &dynamicRenderingFeatures;
+        enabledChain = &dynamicRenderingFeatures.pNext;
+    }
+
+    // Waiting for a present to reach the display, used for low latency frame pacing
+    VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures{};
+    presentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+    VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures{};
+    presentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+    m_PresentWaitEnabled = presentWaitExtensions && supportedPresentId.presentId && supportedPresentWait.presentWait;
+    if (m_PresentWaitEnabled) {
+        extensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+        extensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+        presentIdFeatures.presentId = VK_TRUE;
+        presentWaitFeatures.presentWait = VK_TRUE;
+        *enabledChain = &presentIdFeatures;
+        presentIdFeatures.pNext = &presentWaitFeatures;
+        enabledChain = &presentWaitFeatures.pNext;
     }
 
     VkDeviceCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    createInfo.pNext = &m_Features12;
     createInfo.queueCreateInfoCount = static_cast<u32>(queueCreateInfos.size());
     createInfo.pQueueCreateInfos = queueCreateInfos.data();
-    createInfo.pEnabledFeatures = &deviceFeatures;
-    createInfo.enabledExtensionCount = static_cast<u32>(s_DeviceExtensions.size());
-    createInfo.ppEnabledExtensionNames = s_DeviceExtensions.data();
+    createInfo.pEnabledFeatures = &m_Features;
+    createInfo.enabledExtensionCount = static_cast<u32>(extensions.size());
+    createInfo.ppEnabledExtensionNames = extensions.data();
 
     if (m_ValidationEnabled) {
         createInfo.enabledLayerCount = static_cast<u32>(s_ValidationLayers.size());
@@ -348,6 +637,28 @@ bool VulkanContext::CreateLogicalDevice(const ContextConfig& config) {
 
     vkGetDeviceQueue(m_Device, m_QueueFamilyIndices.graphicsFamily.value(), 0, &m_GraphicsQueue);
     vkGetDeviceQueue(m_Device, m_QueueFamilyIndices.presentFamily.value(), 0, &m_PresentQueue);
+    vkGetDeviceQueue(m_Device, m_QueueFamilyIndices.transferFamily.value(), 0, &m_TransferQueue);
+    vkGetDeviceQueue(m_Device, computeFamily, computeQueueIndex, &m_ComputeQueue);
+
+    // Chained structs are only valid during device creation
+    m_Features12.pNext = nullptr;
+
+    if (m_DynamicRenderingEnabled) {
+        m_CmdBeginRendering = (PFN_vkCmdBeginRenderingKHR)vkGetDeviceProcAddr(m_Device, "vkCmdBeginRenderingKHR");
+        m_CmdEndRendering = (PFN_vkCmdEndRenderingKHR)vkGetDeviceProcAddr(m_Device, "vkCmdEndRenderingKHR");
+        m_DynamicRenderingEnabled = m_CmdBeginRendering && m_CmdEndRendering;
+    }
+    if (m_DynamicRenderingEnabled) {
+        TVK_LOG_INFO("Dynamic rendering enabled");
+    }
+
+    if (m_PresentWaitEnabled) {
+        m_WaitForPresent = (PFN_vkWaitForPresentKHR)vkGetDeviceProcAddr(m_Device, "vkWaitForPresentKHR");
+        m_PresentWaitEnabled = m_WaitForPresent != nullptr;
+    }
+    if (m_PresentWaitEnabled) {
+        TVK_LOG_INFO("Present wait enabled");
+    }
 
     return true;
 }
@@ -395,26 +706,48 @@ QueueFamilyIndices VulkanContext::FindQueueFamilies(VkPhysicalDevice device) con
     std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
     vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
 
+    // Transfer family score: 2 = transfer only, 1 = no graphics
+    int transferScore = -1;
+
     for (u32 i = 0; i < queueFamilyCount; i++) {
-        if (queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+        VkQueueFlags flags = queueFamilies[i].queueFlags;
+
+        if ((flags & VK_QUEUE_GRAPHICS_BIT) && !indices.graphicsFamily.has_value()) {
             indices.graphicsFamily = i;
         }
 
+        // Headless contexts never present, the graphics queue stands in
         VkBool32 presentSupport = false;
-        vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_Surface, &presentSupport);
-        if (presentSupport) {
+        if (m_Surface != VK_NULL_HANDLE) {
+            vkGetPhysicalDeviceSurfaceSupportKHR(device, i, m_Surface, &presentSupport);
+        } else {
+            presentSupport = (flags & VK_QUEUE_GRAPHICS_BIT) != 0;
+        }
+        if (presentSupport && !indices.presentFamily.has_value()) {
             indices.presentFamily = i;
         }
 
-        if (queueFamilies[i].queueFlags & VK_QUEUE_COMPUTE_BIT) {
+        // Compute without graphics runs asynchronously to the frame
+        if ((flags & VK_QUEUE_COMPUTE_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT) && !indices.computeFamily.has_value()) {
             indices.computeFamily = i;
         }
 
-        if (queueFamilies[i].queueFlags & VK_QUEUE_TRANSFER_BIT) {
-            indices.transferFamily = i;
+        // Graphics and compute queues implicitly support transfers
+        if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & VK_QUEUE_GRAPHICS_BIT)) {
+            int score = (flags & VK_QUEUE_COMPUTE_BIT) ? 1 : 2;
+            if (score > transferScore) {
+                transferScore = score;
+                indices.transferFamily = i;
+            }
         }
+    }
 
-        if (indices.IsComplete()) break;
+    // Without a separate family transfers share the graphics queue
+    if (!indices.transferFamily.has_value()) {
+        indices.transferFamily = indices.graphicsFamily;
+    }
+    if (!indices.computeFamily.has_value()) {
+        indices.computeFamily = indices.graphicsFamily;
     }
 
     return indices;
@@ -424,7 +757,8 @@ bool VulkanContext::IsDeviceSuitable(VkPhysicalDevice device, const ContextConfi
     QueueFamilyIndices indices = FindQueueFamilies(device);
     if (!indices.IsComplete()) return false;
 
-    if (!CheckDeviceExtensionSupport(device, s_DeviceExtensions)) return false;
+    if (!CheckDeviceExtensionSupport(device, GetRequiredDeviceExtensions())) return false;
+    if (m_Headless) return true;
 
     // Check swapchain support
     u32 formatCount, presentModeCount;
@@ -452,23 +786,37 @@ bool VulkanContext::CheckDeviceExtensionSupport(VkPhysicalDevice device, const s
     return requiredExtensions.empty();
 }
 
+std::vector<const char*> VulkanContext::GetRequiredDeviceExtensions() const {
+    std::vector<const char*> extensions;
+    for (const char* extension : s_DeviceExtensions) {
+        if (m_Headless && strcmp(extension, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0) continue;
+        extensions.push_back(extension);
+    }
+    return extensions;
+}
+
 std::vector<const char*> VulkanContext::GetRequiredExtensions(const ContextConfig& config) const {
-    u32 glfwExtensionCount = 0;
-    const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+    std::vector<const char*> extensions;
 
-    if (!glfwExtensions) {
-        TVK_LOG_ERROR("Failed to get GLFW required extensions");
-        return {};
-    }
+    // Surface extensions, GLFW does not need to be initialized without a window
+    if (!m_Headless) {
+        u32 glfwExtensionCount = 0;
+        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+
+        if (!glfwExtensions) {
+            TVK_LOG_ERROR("Failed to get GLFW required extensions");
+            return {};
+        }
 
-    std::vector<const char*> extensions(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    }
 
 #ifdef TVK_PLATFORM_APPLE
     extensions.push_back(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
     extensions.push_back("VK_KHR_get_physical_device_properties2");
 #endif
 
-    if (m_ValidationEnabled) {
+    if (m_ValidationEnabled || m_DebugLabelsEnabled) {
         extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
     }
 
@@ -479,6 +827,21 @@ std::vector<const char*> VulkanContext::GetRequiredExtensions(const ContextConfi
     return extensions;
 }
 
+bool VulkanContext::CheckInstanceExtensionSupport(const char* extension) const {
+    u32 extensionCount = 0;
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
+
+    std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+    vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, availableExtensions.data());
+
+    for (const auto& available : availableExtensions) {
+        if (strcmp(available.extensionName, extension) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool VulkanContext::CheckValidationLayerSupport() const {
     u32 layerCount;
     vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
@@ -500,6 +863,49 @@ bool VulkanContext::CheckValidationLayerSupport() const {
     return true;
 }
 
+void VulkanContext::CmdBeginRendering(VkCommandBuffer cmd, const VkRenderingInfoKHR& renderingInfo) const {
+    m_CmdBeginRendering(cmd, &renderingInfo);
+}
+
+void VulkanContext::CmdEndRendering(VkCommandBuffer cmd) const {
+    m_CmdEndRendering(cmd);
+}
+
+void VulkanContext::CmdBeginDebugLabel(VkCommandBuffer cmd, const char* name) const {
+    if (!m_DebugLabelsEnabled) return;
+
+    VkDebugUtilsLabelEXT label{};
+    label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+    label.pLabelName = name;
+    m_CmdBeginDebugLabel(cmd, &label);
+}
+
+void VulkanContext::CmdEndDebugLabel(VkCommandBuffer cmd) const {
+    if (!m_DebugLabelsEnabled) return;
+
+    m_CmdEndDebugLabel(cmd);
+}
+
+VkResult VulkanContext::WaitForPresent(VkSwapchainKHR swapchain, u64 presentId, u64 timeout) const {
+    return m_WaitForPresent(m_Device, swapchain, presentId, timeout);
+}
+
+u32 VulkanContext::GetTimestampValidBits(u32 queueFamily) const {
+    u32 familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &familyCount, nullptr);
+
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(m_PhysicalDevice, &familyCount, families.data());
+
+    return queueFamily < familyCount ? families[queueFamily].timestampValidBits : 0;
+}
+
+bool VulkanContext::IsFormatSupported(VkFormat format, VkFormatFeatureFlags features) const {
+    VkFormatProperties properties;
+    vkGetPhysicalDeviceFormatProperties(m_PhysicalDevice, format, &properties);
+    return (properties.optimalTilingFeatures & features) == features;
+}
+
 SwapchainSupportDetails VulkanContext::QuerySwapchainSupport() const {
     SwapchainSupportDetails details;
 
@@ -560,8 +966,16 @@ void VulkanContext::EndSingleTimeCommands(VkCommandBuffer commandBuffer) {
     submitInfo.commandBufferCount = 1;
     submitInfo.pCommandBuffers = &commandBuffer;
 
-    vkQueueSubmit(m_GraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
-    vkQueueWaitIdle(m_GraphicsQueue);
+    // Wait for this submission only, not for frames still in flight
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+    VkFence fence = VK_NULL_HANDLE;
+    vkCreateFence(m_Device, &fenceInfo, nullptr, &fence);
+
+    vkQueueSubmit(m_GraphicsQueue, 1, &submitInfo, fence);
+    vkWaitForFences(m_Device, 1, &fence, VK_TRUE, UINT64_MAX);
+    vkDestroyFence(m_Device, fence, nullptr);
 
     vkFreeCommandBuffers(m_Device, m_CommandPool, 1, &commandBuffer);
 }
@@ -0,0 +1,163 @@
+/**
+ * @file culling.cpp
+ * @brief GPU frustum culling implementation
+ */
+
+#include "tinyvk/renderer/culling.h"
+#include "tinyvk/renderer/renderer.h"
+#include "tinyvk/renderer/shaders.h"
+#include "tinyvk/core/log.h"
+
+namespace tvk {
+
+static constexpr u32 s_CullGroupSize = 64;   // local_size_x of shaders::frustum_cull_comp
+
+CullingPass::~CullingPass() {
+    Cleanup();
+}
+
+bool CullingPass::Init(Renderer* renderer, u32 maxObjects, u32 maxDraws) {
+    m_Renderer = renderer;
+    m_MaxObjects = maxObjects;
+    m_MaxDraws = maxDraws;
+
+    if (maxObjects == 0 || maxDraws == 0) {
+        TVK_LOG_ERROR("Culling pass needs at least one object and one draw");
+        return false;
+    }
+
+    if (!m_Pipeline.Create(renderer, shaders::frustum_cull_comp)) {
+        TVK_LOG_ERROR("Failed to create culling pipeline");
+        return false;
+    }
+
+    VkDeviceSize drawSize = sizeof(VkDrawIndexedIndirectCommand) * maxDraws;
+    m_Objects = Buffer::Create(renderer, sizeof(CullObject) * maxObjects, BufferUsage::Storage);
+    m_Instances = Buffer::Create(renderer, sizeof(InstanceData) * maxObjects, BufferUsage::Instance);
+    m_DrawTemplates = Buffer::Create(renderer, drawSize, BufferUsage::Indirect);
+    m_DrawCommands = Buffer::Create(renderer, drawSize, BufferUsage::Indirect);
+
+    if (!m_Objects || !m_Instances || !m_DrawTemplates || !m_DrawCommands) {
+        TVK_LOG_ERROR("Failed to create culling buffers");
+        return false;
+    }
+
+    m_Pipeline.BindStorageBuffer(0, m_Objects.get());
+    m_Pipeline.BindStorageBuffer(1, m_Instances.get());
+    m_Pipeline.BindStorageBuffer(2, m_DrawCommands.get());
+    m_Pipeline.UpdateDescriptors();
+    return true;
+}
+
+void CullingPass::Cleanup() {
+    if (!m_Renderer) return;
+
+    m_Pipeline.Destroy();
+    m_Objects.reset();
+    m_Instances.reset();
+    m_DrawTemplates.reset();
+    m_DrawCommands.reset();
+    m_ObjectCount = 0;
+    m_DrawCount = 0;
+    m_Renderer = nullptr;
+}
+
+bool CullingPass::SetScene(const std::vector<CullObject>& objects, const std::vector<VkDrawIndexedIndirectCommand>& draws) {
+    if (objects.size() > m_MaxObjects || draws.size() > m_MaxDraws) {
+        TVK_LOG_ERROR("Culling scene too large: {} objects, {} draws (max {}, {})",
+                      objects.size(), draws.size(), m_MaxObjects, m_MaxDraws);
+        return false;
+    }
+
+    // Every draw reserves room for all of its instances
+    std::vector<VkDrawIndexedIndirectCommand> templates = draws;
+    for (auto& draw : templates) {
+        draw.instanceCount = 0;
+        draw.firstInstance = 0;
+    }
+    for (const auto& object : objects) {
+        if (object.drawIndex >= templates.size()) {
+            TVK_LOG_ERROR("Culling object references draw {} of {}", object.drawIndex, templates.size());
+            return false;
+        }
+        templates[object.drawIndex].firstInstance++;
+    }
+
+    u32 first = 0;
+    for (auto& draw : templates) {
+        u32 capacity = draw.firstInstance;
+        draw.firstInstance = first;
+        first += capacity;
+    }
+
+    if (!objects.empty()) {
+        m_Objects->SetData(objects.data(), sizeof(CullObject) * objects.size());
+    }
+    if (!templates.empty()) {
+        m_DrawTemplates->SetData(templates.data(), sizeof(VkDrawIndexedIndirectCommand) * templates.size());
+    }
+
+    m_ObjectCount = static_cast<u32>(objects.size());
+    m_DrawCount = static_cast<u32>(templates.size());
+    return true;
+}
+
+void CullingPass::Cull(VkCommandBuffer cmd, const glm::mat4& viewProjection) {
+    if (m_DrawCount == 0) return;
+
+    // The previous frame's draws must be done reading before the buffers are rewritten
+    vkCmdPipelineBarrier(cmd,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+    VkBufferCopy copyRegion{};
+    copyRegion.size = sizeof(VkDrawIndexedIndirectCommand) * m_DrawCount;
+    vkCmdCopyBuffer(cmd, m_DrawTemplates->GetBuffer(), m_DrawCommands->GetBuffer(), 1, &copyRegion);
+
+    VkMemoryBarrier resetBarrier{};
+    resetBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    resetBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    resetBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        0, 1, &resetBarrier, 0, nullptr, 0, nullptr);
+
+    if (m_ObjectCount > 0) {
+        CullPushConstants constants{};
+        ExtractFrustumPlanes(viewProjection, constants.planes);
+        constants.objectCount = m_ObjectCount;
+
+        m_Pipeline.Bind(cmd);
+        m_Pipeline.SetPushConstants(cmd, constants);
+        m_Pipeline.Dispatch(cmd, (m_ObjectCount + s_CullGroupSize - 1) / s_CullGroupSize, 1, 1);
+    }
+
+    VkMemoryBarrier drawBarrier{};
+    drawBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    drawBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    drawBarrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+        0, 1, &drawBarrier, 0, nullptr, 0, nullptr);
+}
+
+void CullingPass::ExtractFrustumPlanes(const glm::mat4& viewProjection, glm::vec4 planes[6]) {
+    // Rows of the matrix, glm is column major
+    glm::vec4 rows[4];
+    for (int i = 0; i < 4; i++) {
+        rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+    }
+
+    planes[0] = rows[3] + rows[0];   // Left
+    planes[1] = rows[3] - rows[0];   // Right
+    planes[2] = rows[3] + rows[1];   // Bottom
+    planes[3] = rows[3] - rows[1];   // Top
+    planes[4] = rows[3] + rows[2];   // Near, also conservative for a [0, 1] depth range
+    planes[5] = rows[3] - rows[2];   // Far
+
+    for (int i = 0; i < 6; i++) {
+        planes[i] /= glm::length(glm::vec3(planes[i]));
+    }
+}
+
+} // namespace tvk
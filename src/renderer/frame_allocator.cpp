@@ -0,0 +1,99 @@
+/**
+ * @file frame_allocator.cpp
+ * @brief Frame allocator implementation
+ */
+
+#include "tinyvk/renderer/frame_allocator.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+
+namespace tvk {
+
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+FrameAllocator::~FrameAllocator() {
+    Cleanup();
+}
+
+bool FrameAllocator::Init(VulkanContext* context, VkDeviceSize frameSize, u32 frameCount) {
+    m_Context = context;
+
+    // Both limits are powers of two, the larger one satisfies either descriptor type
+    const VkPhysicalDeviceLimits& limits = context->GetDeviceProperties().limits;
+    m_Alignment = std::max({limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment, VkDeviceSize(16)});
+    m_FrameSize = AlignUp(frameSize, m_Alignment);
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = m_FrameSize * frameCount;
+    bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                       VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+                       VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (!m_Context->GetAllocator().CreateBuffer(bufferInfo,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            m_Buffer, m_Allocation, true)) {
+        TVK_LOG_ERROR("Failed to create frame allocator");
+        return false;
+    }
+
+    m_Data = static_cast<u8*>(m_Allocation.mapped);
+    m_Base = 0;
+    m_Head.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+void FrameAllocator::Cleanup() {
+    if (!m_Context) return;
+
+    if (m_Buffer != VK_NULL_HANDLE) {
+        m_Context->GetAllocator().DestroyBuffer(m_Buffer, m_Allocation);
+        m_Buffer = VK_NULL_HANDLE;
+    }
+
+    m_Data = nullptr;
+    m_FrameSize = 0;
+    m_Base = 0;
+    m_Head.store(0, std::memory_order_relaxed);
+    m_Context = nullptr;
+}
+
+FrameAllocation FrameAllocator::Allocate(VkDeviceSize size, VkDeviceSize alignment) {
+    FrameAllocation result;
+    if (!m_Data || size == 0) return result;
+
+    if (alignment == 0) {
+        alignment = m_Alignment;
+    }
+
+    VkDeviceSize head = m_Head.load(std::memory_order_relaxed);
+    VkDeviceSize offset = 0;
+    do {
+        offset = AlignUp(head, alignment);
+        if (offset + size > m_FrameSize) {
+            if (!m_OverflowReported.exchange(true, std::memory_order_relaxed)) {
+                TVK_LOG_ERROR("Frame allocator is out of memory ({} bytes per frame)", m_FrameSize);
+            }
+            return result;
+        }
+    } while (!m_Head.compare_exchange_weak(head, offset + size, std::memory_order_relaxed));
+
+    result.buffer = m_Buffer;
+    result.offset = m_Base + offset;
+    result.size = size;
+    result.data = m_Data + m_Base + offset;
+    return result;
+}
+
+void FrameAllocator::Reset(u32 frameIndex) {
+    m_Base = m_FrameSize * frameIndex;
+    m_Head.store(0, std::memory_order_relaxed);
+    m_OverflowReported.store(false, std::memory_order_relaxed);
+}
+
+} // namespace tvk
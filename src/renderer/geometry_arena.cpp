@@ -0,0 +1,260 @@
+/**
+ * @file geometry_arena.cpp
+ * @brief Geometry arena implementation
+ */
+
+#include "tinyvk/renderer/geometry_arena.h"
+#include "tinyvk/renderer/renderer.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+namespace tvk {
+
+void GeometryArena::FreeList::Reset(u32 capacity, u32 used) {
+    m_Ranges.clear();
+    if (used < capacity) {
+        m_Ranges[used] = capacity - used;
+    }
+    m_FreeCount = capacity - used;
+}
+
+u32 GeometryArena::FreeList::Allocate(u32 count) {
+    for (auto it = m_Ranges.begin(); it != m_Ranges.end(); ++it) {
+        if (it->second < count) continue;
+
+        u32 offset = it->first;
+        u32 remaining = it->second - count;
+        m_Ranges.erase(it);
+        if (remaining > 0) {
+            m_Ranges[offset + count] = remaining;
+        }
+        m_FreeCount -= count;
+        return offset;
+    }
+    return InvalidOffset;
+}
+
+void GeometryArena::FreeList::Free(u32 offset, u32 count) {
+    auto it = m_Ranges.emplace(offset, count).first;
+    m_FreeCount += count;
+
+    // Merge with the following range
+    auto next = std::next(it);
+    if (next != m_Ranges.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        m_Ranges.erase(next);
+    }
+
+    // Merge with the preceding range
+    if (it != m_Ranges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == it->first) {
+            prev->second += it->second;
+            m_Ranges.erase(it);
+        }
+    }
+}
+
+GeometryArena::~GeometryArena() {
+    Cleanup();
+}
+
+bool GeometryArena::Init(Renderer* renderer, u32 vertexStride, u32 vertexCapacity, u32 indexCapacity) {
+    m_Renderer = renderer;
+    m_VertexStride = vertexStride;
+    m_VertexCapacity = vertexCapacity;
+    m_IndexCapacity = indexCapacity;
+
+    m_VertexBuffer = Buffer::Create(renderer, static_cast<VkDeviceSize>(vertexStride) * vertexCapacity, BufferUsage::Vertex);
+    if (!m_VertexBuffer) {
+        TVK_LOG_ERROR("Failed to create geometry arena vertex buffer");
+        return false;
+    }
+
+    if (indexCapacity > 0) {
+        m_IndexBuffer = Buffer::Create(renderer, sizeof(u32) * static_cast<VkDeviceSize>(indexCapacity), BufferUsage::Index);
+        if (!m_IndexBuffer) {
+            TVK_LOG_ERROR("Failed to create geometry arena index buffer");
+            return false;
+        }
+    }
+
+    m_FreeVertices.Reset(vertexCapacity);
+    m_FreeIndices.Reset(indexCapacity);
+
+    TVK_LOG_INFO("Geometry arena created: {} vertices, {} indices", vertexCapacity, indexCapacity);
+    return true;
+}
+
+void GeometryArena::Cleanup() {
+    if (!m_Renderer) return;
+
+    m_VertexBuffer.reset();
+    m_IndexBuffer.reset();
+    m_Ranges.clear();
+    m_Live.clear();
+    m_FreeHandles.clear();
+    m_PendingFrees.clear();
+    m_FreeVertices.Reset(0);
+    m_FreeIndices.Reset(0);
+    m_Renderer = nullptr;
+}
+
+GeometryArena::Handle GeometryArena::Allocate(const void* vertices, u32 vertexCount, const u32* indices, u32 indexCount) {
+    if (!m_Renderer || vertexCount == 0) return InvalidHandle;
+
+    ReleaseCompleted();
+
+    u32 firstVertex = m_FreeVertices.Allocate(vertexCount);
+    if (firstVertex == FreeList::InvalidOffset) {
+        return InvalidHandle;
+    }
+
+    u32 firstIndex = 0;
+    if (indexCount > 0) {
+        firstIndex = m_FreeIndices.Allocate(indexCount);
+        if (firstIndex == FreeList::InvalidOffset) {
+            m_FreeVertices.Free(firstVertex, vertexCount);
+            return InvalidHandle;
+        }
+    }
+
+    m_VertexBuffer->SetData(vertices, static_cast<VkDeviceSize>(m_VertexStride) * vertexCount,
+                            static_cast<VkDeviceSize>(m_VertexStride) * firstVertex);
+    if (indexCount > 0) {
+        m_IndexBuffer->SetData(indices, sizeof(u32) * static_cast<VkDeviceSize>(indexCount),
+                               sizeof(u32) * static_cast<VkDeviceSize>(firstIndex));
+    }
+
+    Handle handle;
+    if (!m_FreeHandles.empty()) {
+        handle = m_FreeHandles.back();
+        m_FreeHandles.pop_back();
+    } else {
+        handle = static_cast<Handle>(m_Ranges.size());
+        m_Ranges.emplace_back();
+        m_Live.push_back(false);
+    }
+
+    m_Ranges[handle] = {firstVertex, vertexCount, firstIndex, indexCount};
+    m_Live[handle] = true;
+    return handle;
+}
+
+void GeometryArena::Free(Handle handle) {
+    if (handle >= m_Ranges.size() || !m_Live[handle]) return;
+
+    // The frame being recorded and those in flight may still draw from the range
+    m_PendingFrees.push_back({m_Renderer->GetFrameNumber(), m_Ranges[handle]});
+
+    m_Ranges[handle] = {};
+    m_Live[handle] = false;
+    m_FreeHandles.push_back(handle);
+}
+
+void GeometryArena::Compact() {
+    if (!m_Renderer) return;
+
+    // Copies still recorded into the old buffers must land before they are read
+    m_Renderer->FlushUploads();
+
+    VulkanContext& ctx = m_Renderer->GetContext();
+    ctx.WaitIdle();
+
+    // Nothing draws from freed ranges anymore, they are dropped by the repacking
+    m_PendingFrees.clear();
+
+    Ref<Buffer> vertexBuffer = Buffer::Create(m_Renderer, m_VertexBuffer->GetSize(), BufferUsage::Vertex);
+    Ref<Buffer> indexBuffer = m_IndexBuffer ? Buffer::Create(m_Renderer, m_IndexBuffer->GetSize(), BufferUsage::Index) : nullptr;
+    if (!vertexBuffer || (m_IndexBuffer && !indexBuffer)) {
+        TVK_LOG_ERROR("Failed to create buffers for geometry arena compaction");
+        return;
+    }
+
+    std::vector<VkBufferCopy> vertexCopies;
+    std::vector<VkBufferCopy> indexCopies;
+    u32 vertexCursor = 0;
+    u32 indexCursor = 0;
+
+    for (size_t i = 0; i < m_Ranges.size(); i++) {
+        if (!m_Live[i]) continue;
+
+        GeometryRange& range = m_Ranges[i];
+
+        VkBufferCopy vertexCopy{};
+        vertexCopy.srcOffset = static_cast<VkDeviceSize>(m_VertexStride) * range.firstVertex;
+        vertexCopy.dstOffset = static_cast<VkDeviceSize>(m_VertexStride) * vertexCursor;
+        vertexCopy.size = static_cast<VkDeviceSize>(m_VertexStride) * range.vertexCount;
+        vertexCopies.push_back(vertexCopy);
+        range.firstVertex = vertexCursor;
+        vertexCursor += range.vertexCount;
+
+        if (range.indexCount > 0) {
+            VkBufferCopy indexCopy{};
+            indexCopy.srcOffset = sizeof(u32) * static_cast<VkDeviceSize>(range.firstIndex);
+            indexCopy.dstOffset = sizeof(u32) * static_cast<VkDeviceSize>(indexCursor);
+            indexCopy.size = sizeof(u32) * static_cast<VkDeviceSize>(range.indexCount);
+            indexCopies.push_back(indexCopy);
+            range.firstIndex = indexCursor;
+            indexCursor += range.indexCount;
+        }
+    }
+
+    VkCommandBuffer cmd = ctx.BeginSingleTimeCommands();
+    if (!vertexCopies.empty()) {
+        vkCmdCopyBuffer(cmd, m_VertexBuffer->GetBuffer(), vertexBuffer->GetBuffer(),
+                        static_cast<u32>(vertexCopies.size()), vertexCopies.data());
+    }
+    if (!indexCopies.empty()) {
+        vkCmdCopyBuffer(cmd, m_IndexBuffer->GetBuffer(), indexBuffer->GetBuffer(),
+                        static_cast<u32>(indexCopies.size()), indexCopies.data());
+    }
+
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+    ctx.EndSingleTimeCommands(cmd);
+
+    m_VertexBuffer = vertexBuffer;
+    m_IndexBuffer = indexBuffer;
+    m_FreeVertices.Reset(m_VertexCapacity, vertexCursor);
+    m_FreeIndices.Reset(m_IndexCapacity, indexCursor);
+
+    TVK_LOG_INFO("Geometry arena compacted: {} of {} vertices, {} of {} indices in use",
+                 vertexCursor, m_VertexCapacity, indexCursor, m_IndexCapacity);
+}
+
+void GeometryArena::ReleaseRange(const GeometryRange& range) {
+    m_FreeVertices.Free(range.firstVertex, range.vertexCount);
+    if (range.indexCount > 0) {
+        m_FreeIndices.Free(range.firstIndex, range.indexCount);
+    }
+}
+
+void GeometryArena::ReleaseCompleted() {
+    u64 completed = m_Renderer->GetCompletedFrame();
+
+    size_t kept = 0;
+    for (size_t i = 0; i < m_PendingFrees.size(); i++) {
+        if (m_PendingFrees[i].frame <= completed) {
+            ReleaseRange(m_PendingFrees[i].range);
+        } else {
+            m_PendingFrees[kept++] = m_PendingFrees[i];
+        }
+    }
+    m_PendingFrees.resize(kept);
+}
+
+void GeometryArena::Bind(VkCommandBuffer cmd) const {
+    if (m_VertexBuffer) {
+        m_VertexBuffer->BindAsVertex(cmd, 0);
+    }
+    if (m_IndexBuffer) {
+        m_IndexBuffer->BindAsIndex(cmd);
+    }
+}
+
+} // namespace tvk
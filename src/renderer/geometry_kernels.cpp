@@ -0,0 +1,686 @@
+/**
+ * @file geometry_kernels.cpp
+ * @brief Batched mesh generation and vertex processing implementation
+ */
+
+#include "tinyvk/renderer/geometry_kernels.h"
+#include "tinyvk/core/job_system.h"
+
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define TVK_GEOMETRY_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace tvk {
+namespace GeometryKernels {
+
+namespace {
+
+// Vertices per job, also the granularity of the per-chunk reductions
+constexpr u32 s_ChunkSize = 4096;
+
+#ifdef TVK_GEOMETRY_SSE
+
+/**
+ * @brief Four floats in one SSE register
+ */
+struct F4 {
+    __m128 v;
+
+    static F4 Set(float value) { return {_mm_set1_ps(value)}; }
+    static F4 Load(const float* data) { return {_mm_loadu_ps(data)}; }
+    void Store(float* data) const { _mm_storeu_ps(data, v); }
+};
+
+inline F4 operator+(F4 a, F4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline F4 operator-(F4 a, F4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline F4 operator*(F4 a, F4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline F4 operator/(F4 a, F4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline F4 Min(F4 a, F4 b) { return {_mm_min_ps(a.v, b.v)}; }
+inline F4 Max(F4 a, F4 b) { return {_mm_max_ps(a.v, b.v)}; }
+inline F4 Sqrt(F4 a) { return {_mm_sqrt_ps(a.v)}; }
+
+// 1 / a, or 0 where a is too close to zero
+inline F4 SafeReciprocal(F4 a) {
+    __m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v);
+    __m128 valid = _mm_cmpgt_ps(magnitude, _mm_set1_ps(1e-20f));
+    return {_mm_and_ps(valid, _mm_div_ps(_mm_set1_ps(1.0f), a.v))};
+}
+
+#else
+
+/**
+ * @brief Four floats processed lane by lane, vectorized by the compiler where it can
+ */
+struct F4 {
+    float v[4];
+
+    static F4 Set(float value) { return {{value, value, value, value}}; }
+    static F4 Load(const float* data) { return {{data[0], data[1], data[2], data[3]}}; }
+    void Store(float* data) const { for (u32 i = 0; i < 4; i++) data[i] = v[i]; }
+};
+
+template<typename Op>
+inline F4 Apply(F4 a, F4 b, Op op) {
+    F4 result;
+    for (u32 i = 0; i < 4; i++) result.v[i] = op(a.v[i], b.v[i]);
+    return result;
+}
+
+inline F4 operator+(F4 a, F4 b) { return Apply(a, b, [](float x, float y) { return x + y; }); }
+inline F4 operator-(F4 a, F4 b) { return Apply(a, b, [](float x, float y) { return x - y; }); }
+inline F4 operator*(F4 a, F4 b) { return Apply(a, b, [](float x, float y) { return x * y; }); }
+inline F4 operator/(F4 a, F4 b) { return Apply(a, b, [](float x, float y) { return x / y; }); }
+inline F4 Min(F4 a, F4 b) { return Apply(a, b, [](float x, float y) { return x < y ? x : y; }); }
+inline F4 Max(F4 a, F4 b) { return Apply(a, b, [](float x, float y) { return x > y ? x : y; }); }
+inline F4 Sqrt(F4 a) { return Apply(a, a, [](float x, float) { return std::sqrt(x); }); }
+
+inline F4 SafeReciprocal(F4 a) {
+    return Apply(a, a, [](float x, float) { return std::abs(x) > 1e-20f ? 1.0f / x : 0.0f; });
+}
+
+#endif
+
+constexpr float s_Ramp[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+
+inline F4 Dot(F4 ax, F4 ay, F4 az, F4 bx, F4 by, F4 bz) {
+    return ax * bx + ay * by + az * bz;
+}
+
+// Zero vectors stay zero
+inline void Normalize(F4& x, F4& y, F4& z) {
+    F4 scale = SafeReciprocal(Sqrt(Dot(x, y, z, x, y, z)));
+    x = x * scale;
+    y = y * scale;
+    z = z * scale;
+}
+
+/**
+ * @brief Up to four vertices transposed into one array per component
+ */
+struct VertexBlock {
+    alignas(16) float px[4];
+    alignas(16) float py[4];
+    alignas(16) float pz[4];
+    alignas(16) float nx[4];
+    alignas(16) float ny[4];
+    alignas(16) float nz[4];
+    alignas(16) float u[4];
+    alignas(16) float v[4];
+};
+
+// Unused lanes are zeroed so they do not produce NaNs
+void LoadBlock(const Vertex* vertices, u32 count, VertexBlock& block) {
+    for (u32 i = 0; i < 4; i++) {
+        const Vertex* vertex = i < count ? &vertices[i] : nullptr;
+        block.px[i] = vertex ? vertex->position.x : 0.0f;
+        block.py[i] = vertex ? vertex->position.y : 0.0f;
+        block.pz[i] = vertex ? vertex->position.z : 0.0f;
+        block.nx[i] = vertex ? vertex->normal.x : 0.0f;
+        block.ny[i] = vertex ? vertex->normal.y : 0.0f;
+        block.nz[i] = vertex ? vertex->normal.z : 0.0f;
+    }
+}
+
+void StoreBlock(Vertex* vertices, u32 count, const VertexBlock& block) {
+    for (u32 i = 0; i < count; i++) {
+        Vertex& vertex = vertices[i];
+        vertex.position = glm::vec3(block.px[i], block.py[i], block.pz[i]);
+        vertex.normal = glm::vec3(block.nx[i], block.ny[i], block.nz[i]);
+        vertex.texCoord = glm::vec2(block.u[i], block.v[i]);
+        vertex.color = glm::vec3(1.0f);
+    }
+}
+
+inline const float* GetPosition(const float* positions, size_t stride, size_t index) {
+    return reinterpret_cast<const float*>(reinterpret_cast<const u8*>(positions) + index * stride);
+}
+
+bool ShouldSplit(JobSystem* jobs, size_t work) {
+    return jobs && jobs->IsRunning() && jobs->GetWorkerCount() > 1 && work >= ParallelThreshold;
+}
+
+// Runs function(begin, end) over [0, count), split into chunks across the job system for large work
+template<typename Function>
+void ForEachRange(JobSystem* jobs, u32 count, u32 chunkSize, size_t work, const Function& function) {
+    if (count == 0) return;
+
+    if (ShouldSplit(jobs, work)) {
+        jobs->ParallelFor(count, chunkSize, function);
+    } else {
+        function(0u, count);
+    }
+}
+
+// Runs function(begin, end) per chunk of s_ChunkSize items and returns one result per chunk
+template<typename T, typename Function>
+std::vector<T> MapRanges(JobSystem* jobs, u32 count, const Function& function) {
+    if (!ShouldSplit(jobs, count)) return {function(0u, count)};
+
+    std::vector<T> results((count + s_ChunkSize - 1) / s_ChunkSize);
+    jobs->ParallelFor(count, s_ChunkSize, [&](u32 begin, u32 end) {
+        results[begin / s_ChunkSize] = function(begin, end);
+    });
+    return results;
+}
+
+/**
+ * @brief cos and sin of i * step, padded so four-wide loads never read past the end
+ */
+struct TrigTable {
+    std::vector<float> cos;
+    std::vector<float> sin;
+
+    TrigTable(u32 count, float step) {
+        u32 padded = (count + 3) & ~3u;
+        cos.assign(padded, 0.0f);
+        sin.assign(padded, 0.0f);
+        for (u32 i = 0; i < count; i++) {
+            float angle = step * static_cast<float>(i);
+            cos[i] = std::cos(angle);
+            sin[i] = std::sin(angle);
+        }
+    }
+};
+
+// Fills a grid of (columns + 1) x (rows + 1) vertices four at a time,
+// fillBlock(block, row, column) writes the lanes of columns [column, column + 4)
+template<typename FillBlock>
+void GenerateGrid(Vertex* vertices, u32 columns, u32 rows, JobSystem* jobs, const FillBlock& fillBlock) {
+    u32 stride = columns + 1;
+    u32 chunkRows = std::max(1u, s_ChunkSize / stride);
+
+    ForEachRange(jobs, rows + 1, chunkRows, static_cast<size_t>(stride) * (rows + 1), [&](u32 begin, u32 end) {
+        VertexBlock block;
+        for (u32 row = begin; row < end; row++) {
+            Vertex* rowVertices = vertices + static_cast<size_t>(row) * stride;
+            for (u32 column = 0; column < stride; column += 4) {
+                fillBlock(block, row, column);
+                StoreBlock(rowVertices + column, std::min(4u, stride - column), block);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Per-triangle vectors computed four triangles at a time
+ */
+struct TriangleVectors {
+    std::vector<float> x, y, z;
+
+    explicit TriangleVectors(u32 count) : x(count), y(count), z(count) {}
+
+    void Store(u32 index, u32 count, F4 vx, F4 vy, F4 vz) {
+        alignas(16) float lanes[3][4];
+        vx.Store(lanes[0]);
+        vy.Store(lanes[1]);
+        vz.Store(lanes[2]);
+        for (u32 i = 0; i < count; i++) {
+            x[index + i] = lanes[0][i];
+            y[index + i] = lanes[1][i];
+            z[index + i] = lanes[2][i];
+        }
+    }
+
+    glm::vec3 Get(u32 index) const { return glm::vec3(x[index], y[index], z[index]); }
+};
+
+/**
+ * @brief Corners of up to four triangles, transposed
+ */
+struct TriangleBlock {
+    alignas(16) float px[3][4];
+    alignas(16) float py[3][4];
+    alignas(16) float pz[3][4];
+    alignas(16) float u[3][4];
+    alignas(16) float v[3][4];
+
+    void Load(const Vertex* vertices, const u32* indices, u32 count) {
+        for (u32 i = 0; i < 4; i++) {
+            for (u32 corner = 0; corner < 3; corner++) {
+                const Vertex* vertex = i < count ? &vertices[indices[i * 3 + corner]] : nullptr;
+                px[corner][i] = vertex ? vertex->position.x : 0.0f;
+                py[corner][i] = vertex ? vertex->position.y : 0.0f;
+                pz[corner][i] = vertex ? vertex->position.z : 0.0f;
+                u[corner][i] = vertex ? vertex->texCoord.x : 0.0f;
+                v[corner][i] = vertex ? vertex->texCoord.y : 0.0f;
+            }
+        }
+    }
+
+    // Edge from the first corner to the given one
+    void GetEdge(u32 corner, F4& x, F4& y, F4& z) const {
+        x = F4::Load(px[corner]) - F4::Load(px[0]);
+        y = F4::Load(py[corner]) - F4::Load(py[0]);
+        z = F4::Load(pz[corner]) - F4::Load(pz[0]);
+    }
+};
+
+} // namespace
+
+void GenerateGridIndices(u32* indices, u32 columns, u32 rows, u32 baseVertex, JobSystem* jobs) {
+    u32 stride = columns + 1;
+    u32 chunkRows = std::max(1u, s_ChunkSize / std::max(1u, columns));
+
+    ForEachRange(jobs, rows, chunkRows, static_cast<size_t>(columns) * rows, [&](u32 begin, u32 end) {
+        for (u32 row = begin; row < end; row++) {
+            u32* out = indices + static_cast<size_t>(row) * columns * 6;
+            u32 current = baseVertex + row * stride;
+            for (u32 column = 0; column < columns; column++, current++) {
+                u32 next = current + stride;
+                out[0] = current;
+                out[1] = next;
+                out[2] = current + 1;
+                out[3] = current + 1;
+                out[4] = next;
+                out[5] = next + 1;
+                out += 6;
+            }
+        }
+    });
+}
+
+void GeneratePlane(Vertex* vertices, float width, float height, u32 segmentsX, u32 segmentsY, JobSystem* jobs) {
+    F4 ramp = F4::Load(s_Ramp);
+    F4 step = F4::Set(1.0f / static_cast<float>(segmentsX));
+    float stepY = 1.0f / static_cast<float>(segmentsY);
+
+    GenerateGrid(vertices, segmentsX, segmentsY, jobs, [&](VertexBlock& block, u32 row, u32 column) {
+        F4 u = (ramp + F4::Set(static_cast<float>(column))) * step;
+        float v = static_cast<float>(row) * stepY;
+
+        (u * F4::Set(width) - F4::Set(width * 0.5f)).Store(block.px);
+        F4::Set(0.0f).Store(block.py);
+        F4::Set(v * height - height * 0.5f).Store(block.pz);
+        F4::Set(0.0f).Store(block.nx);
+        F4::Set(1.0f).Store(block.ny);
+        F4::Set(0.0f).Store(block.nz);
+        u.Store(block.u);
+        F4::Set(v).Store(block.v);
+    });
+}
+
+void GenerateSphere(Vertex* vertices, float radius, u32 segments, u32 rings, JobSystem* jobs) {
+    // One table per direction, the grid only multiplies them
+    TrigTable theta(segments + 1, 2.0f * glm::pi<float>() / static_cast<float>(segments));
+    TrigTable phi(rings + 1, glm::pi<float>() / static_cast<float>(rings));
+
+    F4 ramp = F4::Load(s_Ramp);
+    F4 step = F4::Set(1.0f / static_cast<float>(segments));
+    F4 scale = F4::Set(radius);
+    float stepV = 1.0f / static_cast<float>(rings);
+
+    GenerateGrid(vertices, segments, rings, jobs, [&](VertexBlock& block, u32 ring, u32 segment) {
+        F4 sinPhi = F4::Set(phi.sin[ring]);
+        F4 nx = sinPhi * F4::Load(&theta.cos[segment]);
+        F4 ny = F4::Set(phi.cos[ring]);
+        F4 nz = sinPhi * F4::Load(&theta.sin[segment]);
+
+        (nx * scale).Store(block.px);
+        (ny * scale).Store(block.py);
+        (nz * scale).Store(block.pz);
+        nx.Store(block.nx);
+        ny.Store(block.ny);
+        nz.Store(block.nz);
+        ((ramp + F4::Set(static_cast<float>(segment))) * step).Store(block.u);
+        F4::Set(static_cast<float>(ring) * stepV).Store(block.v);
+    });
+}
+
+void GenerateTorus(Vertex* vertices, float majorRadius, float minorRadius, u32 majorSegments, u32 minorSegments,
+                   JobSystem* jobs) {
+    TrigTable major(majorSegments + 1, 2.0f * glm::pi<float>() / static_cast<float>(majorSegments));
+    TrigTable minor(minorSegments + 1, 2.0f * glm::pi<float>() / static_cast<float>(minorSegments));
+
+    F4 ramp = F4::Load(s_Ramp);
+    F4 step = F4::Set(1.0f / static_cast<float>(minorSegments));
+    float stepU = 1.0f / static_cast<float>(majorSegments);
+
+    // Rows go around the major circle, columns around the tube
+    GenerateGrid(vertices, minorSegments, majorSegments, jobs, [&](VertexBlock& block, u32 i, u32 j) {
+        F4 cosU = F4::Set(major.cos[i]);
+        F4 sinU = F4::Set(major.sin[i]);
+        F4 cosV = F4::Load(&minor.cos[j]);
+        F4 sinV = F4::Load(&minor.sin[j]);
+
+        F4 ring = F4::Set(majorRadius) + F4::Set(minorRadius) * cosV;
+        (ring * cosU).Store(block.px);
+        (F4::Set(minorRadius) * sinV).Store(block.py);
+        (ring * sinU).Store(block.pz);
+        (cosV * cosU).Store(block.nx);
+        sinV.Store(block.ny);
+        (cosV * sinU).Store(block.nz);
+        F4::Set(static_cast<float>(i) * stepU).Store(block.u);
+        ((ramp + F4::Set(static_cast<float>(j))) * step).Store(block.v);
+    });
+}
+
+void GenerateHeightfield(Vertex* vertices, const float* heights, u32 columns, u32 rows, float cellSize,
+                         JobSystem* jobs) {
+    u32 stride = columns + 1;
+    F4 ramp = F4::Load(s_Ramp);
+    F4 cell = F4::Set(cellSize);
+    F4 originX = F4::Set(-0.5f * cellSize * static_cast<float>(columns));
+    F4 stepU = F4::Set(1.0f / static_cast<float>(columns));
+    float originZ = -0.5f * cellSize * static_cast<float>(rows);
+
+    GenerateGrid(vertices, columns, rows, jobs, [&](VertexBlock& block, u32 row, u32 column) {
+        // Neighbours for central differences, one-sided at the borders
+        u32 up = row > 0 ? row - 1 : row;
+        u32 down = std::min(row + 1, rows);
+        const float* center = heights + static_cast<size_t>(row) * stride;
+        const float* above = heights + static_cast<size_t>(up) * stride;
+        const float* below = heights + static_cast<size_t>(down) * stride;
+
+        alignas(16) float height[4], slopeX[4], slopeZ[4];
+        for (u32 i = 0; i < 4; i++) {
+            u32 x = std::min(column + i, columns);
+            u32 left = x > 0 ? x - 1 : x;
+            u32 right = std::min(x + 1, columns);
+            height[i] = center[x];
+            slopeX[i] = right > left ? (center[right] - center[left]) / static_cast<float>(right - left) : 0.0f;
+            slopeZ[i] = down > up ? (below[x] - above[x]) / static_cast<float>(down - up) : 0.0f;
+        }
+
+        // Normal of the surface y = h(x, z) is (-dh/dx, 1, -dh/dz), slopes are per sample
+        F4 nx = F4::Set(0.0f) - F4::Load(slopeX);
+        F4 ny = cell;
+        F4 nz = F4::Set(0.0f) - F4::Load(slopeZ);
+        Normalize(nx, ny, nz);
+
+        F4 u = (ramp + F4::Set(static_cast<float>(column))) * stepU;
+        (originX + (ramp + F4::Set(static_cast<float>(column))) * cell).Store(block.px);
+        F4::Load(height).Store(block.py);
+        F4::Set(originZ + static_cast<float>(row) * cellSize).Store(block.pz);
+        nx.Store(block.nx);
+        ny.Store(block.ny);
+        nz.Store(block.nz);
+        u.Store(block.u);
+        F4::Set(static_cast<float>(row) / static_cast<float>(rows)).Store(block.v);
+    });
+}
+
+void TransformVertices(Vertex* destination, const Vertex* source, u32 count, const glm::mat4& transform,
+                       JobSystem* jobs) {
+    const glm::mat4& m = transform;
+    glm::mat3 n = glm::transpose(glm::inverse(glm::mat3(transform)));
+    bool projective = m[0][3] != 0.0f || m[1][3] != 0.0f || m[2][3] != 0.0f || m[3][3] != 1.0f;
+
+    ForEachRange(jobs, count, s_ChunkSize, count, [&](u32 begin, u32 end) {
+        VertexBlock block;
+        for (u32 i = begin; i < end; i += 4) {
+            u32 lanes = std::min(4u, end - i);
+            LoadBlock(source + i, lanes, block);
+
+            F4 x = F4::Load(block.px);
+            F4 y = F4::Load(block.py);
+            F4 z = F4::Load(block.pz);
+            F4 px = F4::Set(m[0][0]) * x + F4::Set(m[1][0]) * y + F4::Set(m[2][0]) * z + F4::Set(m[3][0]);
+            F4 py = F4::Set(m[0][1]) * x + F4::Set(m[1][1]) * y + F4::Set(m[2][1]) * z + F4::Set(m[3][1]);
+            F4 pz = F4::Set(m[0][2]) * x + F4::Set(m[1][2]) * y + F4::Set(m[2][2]) * z + F4::Set(m[3][2]);
+            if (projective) {
+                F4 w = SafeReciprocal(F4::Set(m[0][3]) * x + F4::Set(m[1][3]) * y + F4::Set(m[2][3]) * z + F4::Set(m[3][3]));
+                px = px * w;
+                py = py * w;
+                pz = pz * w;
+            }
+
+            x = F4::Load(block.nx);
+            y = F4::Load(block.ny);
+            z = F4::Load(block.nz);
+            F4 nx = F4::Set(n[0][0]) * x + F4::Set(n[1][0]) * y + F4::Set(n[2][0]) * z;
+            F4 ny = F4::Set(n[0][1]) * x + F4::Set(n[1][1]) * y + F4::Set(n[2][1]) * z;
+            F4 nz = F4::Set(n[0][2]) * x + F4::Set(n[1][2]) * y + F4::Set(n[2][2]) * z;
+            Normalize(nx, ny, nz);
+
+            px.Store(block.px);
+            py.Store(block.py);
+            pz.Store(block.pz);
+            nx.Store(block.nx);
+            ny.Store(block.ny);
+            nz.Store(block.nz);
+
+            for (u32 lane = 0; lane < lanes; lane++) {
+                Vertex vertex = source[i + lane];
+                vertex.position = glm::vec3(block.px[lane], block.py[lane], block.pz[lane]);
+                vertex.normal = glm::vec3(block.nx[lane], block.ny[lane], block.nz[lane]);
+                destination[i + lane] = vertex;
+            }
+        }
+    });
+}
+
+void ComputeNormals(Vertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount, JobSystem* jobs) {
+    u32 triangleCount = indexCount / 3;
+
+    // The cross product of two edges is the face normal scaled by twice the area
+    TriangleVectors faces(triangleCount);
+    ForEachRange(jobs, triangleCount, s_ChunkSize, triangleCount, [&](u32 begin, u32 end) {
+        TriangleBlock block;
+        for (u32 t = begin; t < end; t += 4) {
+            u32 lanes = std::min(4u, end - t);
+            block.Load(vertices, indices + static_cast<size_t>(t) * 3, lanes);
+
+            F4 ax, ay, az, bx, by, bz;
+            block.GetEdge(1, ax, ay, az);
+            block.GetEdge(2, bx, by, bz);
+            faces.Store(t, lanes, ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx);
+        }
+    });
+
+    // Triangles share vertices, so accumulating stays on one thread
+    for (u32 i = 0; i < vertexCount; i++) {
+        vertices[i].normal = glm::vec3(0.0f);
+    }
+    for (u32 t = 0; t < triangleCount; t++) {
+        glm::vec3 normal = faces.Get(t);
+        vertices[indices[t * 3 + 0]].normal += normal;
+        vertices[indices[t * 3 + 1]].normal += normal;
+        vertices[indices[t * 3 + 2]].normal += normal;
+    }
+
+    ForEachRange(jobs, vertexCount, s_ChunkSize, vertexCount, [&](u32 begin, u32 end) {
+        VertexBlock block;
+        for (u32 i = begin; i < end; i += 4) {
+            u32 lanes = std::min(4u, end - i);
+            LoadBlock(vertices + i, lanes, block);
+
+            F4 nx = F4::Load(block.nx);
+            F4 ny = F4::Load(block.ny);
+            F4 nz = F4::Load(block.nz);
+            Normalize(nx, ny, nz);
+            nx.Store(block.nx);
+            ny.Store(block.ny);
+            nz.Store(block.nz);
+
+            for (u32 lane = 0; lane < lanes; lane++) {
+                vertices[i + lane].normal = glm::vec3(block.nx[lane], block.ny[lane], block.nz[lane]);
+            }
+        }
+    });
+}
+
+void ComputeTangents(glm::vec4* tangents, const Vertex* vertices, u32 vertexCount, const u32* indices, u32 indexCount,
+                     JobSystem* jobs) {
+    u32 triangleCount = indexCount / 3;
+
+    // Directions of increasing u and v on each triangle (Lengyel)
+    TriangleVectors faceTangents(triangleCount);
+    TriangleVectors faceBitangents(triangleCount);
+    ForEachRange(jobs, triangleCount, s_ChunkSize, triangleCount, [&](u32 begin, u32 end) {
+        TriangleBlock block;
+        for (u32 t = begin; t < end; t += 4) {
+            u32 lanes = std::min(4u, end - t);
+            block.Load(vertices, indices + static_cast<size_t>(t) * 3, lanes);
+
+            F4 ax, ay, az, bx, by, bz;
+            block.GetEdge(1, ax, ay, az);
+            block.GetEdge(2, bx, by, bz);
+            F4 du1 = F4::Load(block.u[1]) - F4::Load(block.u[0]);
+            F4 dv1 = F4::Load(block.v[1]) - F4::Load(block.v[0]);
+            F4 du2 = F4::Load(block.u[2]) - F4::Load(block.u[0]);
+            F4 dv2 = F4::Load(block.v[2]) - F4::Load(block.v[0]);
+
+            // Degenerate texture coordinates contribute nothing
+            F4 r = SafeReciprocal(du1 * dv2 - du2 * dv1);
+            faceTangents.Store(t, lanes, (ax * dv2 - bx * dv1) * r, (ay * dv2 - by * dv1) * r, (az * dv2 - bz * dv1) * r);
+            faceBitangents.Store(t, lanes, (bx * du1 - ax * du2) * r, (by * du1 - ay * du2) * r, (bz * du1 - az * du2) * r);
+        }
+    });
+
+    std::vector<glm::vec3> tangentSums(vertexCount, glm::vec3(0.0f));
+    std::vector<glm::vec3> bitangentSums(vertexCount, glm::vec3(0.0f));
+    for (u32 t = 0; t < triangleCount; t++) {
+        glm::vec3 tangent = faceTangents.Get(t);
+        glm::vec3 bitangent = faceBitangents.Get(t);
+        for (u32 corner = 0; corner < 3; corner++) {
+            u32 index = indices[t * 3 + corner];
+            tangentSums[index] += tangent;
+            bitangentSums[index] += bitangent;
+        }
+    }
+
+    // Gram-Schmidt against the normal, then the handedness from the accumulated bitangent
+    ForEachRange(jobs, vertexCount, s_ChunkSize, vertexCount, [&](u32 begin, u32 end) {
+        VertexBlock block;
+        alignas(16) float tx[4], ty[4], tz[4], bx[4], by[4], bz[4], handedness[4];
+        for (u32 i = begin; i < end; i += 4) {
+            u32 lanes = std::min(4u, end - i);
+            LoadBlock(vertices + i, lanes, block);
+            for (u32 lane = 0; lane < 4; lane++) {
+                glm::vec3 tangent = lane < lanes ? tangentSums[i + lane] : glm::vec3(0.0f);
+                glm::vec3 bitangent = lane < lanes ? bitangentSums[i + lane] : glm::vec3(0.0f);
+                tx[lane] = tangent.x;
+                ty[lane] = tangent.y;
+                tz[lane] = tangent.z;
+                bx[lane] = bitangent.x;
+                by[lane] = bitangent.y;
+                bz[lane] = bitangent.z;
+            }
+
+            F4 nx = F4::Load(block.nx);
+            F4 ny = F4::Load(block.ny);
+            F4 nz = F4::Load(block.nz);
+            F4 x = F4::Load(tx);
+            F4 y = F4::Load(ty);
+            F4 z = F4::Load(tz);
+            F4 d = Dot(nx, ny, nz, x, y, z);
+            x = x - nx * d;
+            y = y - ny * d;
+            z = z - nz * d;
+            Normalize(x, y, z);
+
+            F4 cx = ny * z - nz * y;
+            F4 cy = nz * x - nx * z;
+            F4 cz = nx * y - ny * x;
+            Dot(cx, cy, cz, F4::Load(bx), F4::Load(by), F4::Load(bz)).Store(handedness);
+            x.Store(tx);
+            y.Store(ty);
+            z.Store(tz);
+
+            for (u32 lane = 0; lane < lanes; lane++) {
+                glm::vec3 tangent(tx[lane], ty[lane], tz[lane]);
+                if (tangent == glm::vec3(0.0f)) {
+                    // No usable texture coordinates, any direction perpendicular to the normal will do
+                    glm::vec3 normal = vertices[i + lane].normal;
+                    glm::vec3 axis = std::abs(normal.y) < 0.999f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+                    glm::vec3 perpendicular = glm::cross(axis, normal);
+                    float length = glm::length(perpendicular);
+                    tangent = length > 0.0f ? perpendicular / length : glm::vec3(1.0f, 0.0f, 0.0f);
+                }
+                tangents[i + lane] = glm::vec4(tangent, handedness[lane] < 0.0f ? -1.0f : 1.0f);
+            }
+        }
+    });
+}
+
+BoundingBox ComputeBounds(const float* positions, size_t count, size_t positionStride, JobSystem* jobs) {
+    if (count == 0) return BoundingBox{};
+
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+    auto boxes = MapRanges<BoundingBox>(jobs, static_cast<u32>(count), [&](u32 begin, u32 end) {
+        F4 minX = F4::Set(infinity), minY = minX, minZ = minX;
+        F4 maxX = F4::Set(-infinity), maxY = maxX, maxZ = maxX;
+
+        alignas(16) float x[4], y[4], z[4];
+        for (u32 i = begin; i < end; i += 4) {
+            // Repeating the first position in the unused lanes leaves the result unchanged
+            for (u32 lane = 0; lane < 4; lane++) {
+                const float* position = GetPosition(positions, positionStride, i + lane < end ? i + lane : i);
+                x[lane] = position[0];
+                y[lane] = position[1];
+                z[lane] = position[2];
+            }
+            F4 px = F4::Load(x), py = F4::Load(y), pz = F4::Load(z);
+            minX = Min(minX, px);
+            minY = Min(minY, py);
+            minZ = Min(minZ, pz);
+            maxX = Max(maxX, px);
+            maxY = Max(maxY, py);
+            maxZ = Max(maxZ, pz);
+        }
+
+        alignas(16) float lanes[6][4];
+        minX.Store(lanes[0]);
+        minY.Store(lanes[1]);
+        minZ.Store(lanes[2]);
+        maxX.Store(lanes[3]);
+        maxY.Store(lanes[4]);
+        maxZ.Store(lanes[5]);
+
+        BoundingBox box;
+        box.min = glm::vec3(infinity);
+        box.max = glm::vec3(-infinity);
+        for (u32 lane = 0; lane < 4; lane++) {
+            box.min = glm::min(box.min, glm::vec3(lanes[0][lane], lanes[1][lane], lanes[2][lane]));
+            box.max = glm::max(box.max, glm::vec3(lanes[3][lane], lanes[4][lane], lanes[5][lane]));
+        }
+        return box;
+    });
+
+    BoundingBox bounds = boxes[0];
+    for (const auto& box : boxes) {
+        bounds.min = glm::min(bounds.min, box.min);
+        bounds.max = glm::max(bounds.max, box.max);
+    }
+    return bounds;
+}
+
+glm::vec4 ComputeBoundingSphere(const float* positions, size_t count, size_t positionStride, JobSystem* jobs) {
+    if (count == 0) return glm::vec4(0.0f);
+
+    glm::vec3 center = ComputeBounds(positions, count, positionStride, jobs).GetCenter();
+    F4 cx = F4::Set(center.x), cy = F4::Set(center.y), cz = F4::Set(center.z);
+
+    auto distances = MapRanges<float>(jobs, static_cast<u32>(count), [&](u32 begin, u32 end) {
+        F4 farthest = F4::Set(0.0f);
+
+        alignas(16) float x[4], y[4], z[4];
+        for (u32 i = begin; i < end; i += 4) {
+            for (u32 lane = 0; lane < 4; lane++) {
+                const float* position = GetPosition(positions, positionStride, i + lane < end ? i + lane : i);
+                x[lane] = position[0];
+                y[lane] = position[1];
+                z[lane] = position[2];
+            }
+            F4 dx = F4::Load(x) - cx, dy = F4::Load(y) - cy, dz = F4::Load(z) - cz;
+            farthest = Max(farthest, Dot(dx, dy, dz, dx, dy, dz));
+        }
+
+        alignas(16) float lanes[4];
+        farthest.Store(lanes);
+        return std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    });
+
+    float radiusSquared = *std::max_element(distances.begin(), distances.end());
+    return glm::vec4(center, std::sqrt(radiusSquared));
+}
+
+} // namespace GeometryKernels
+} // namespace tvk
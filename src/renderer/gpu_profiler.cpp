@@ -0,0 +1,246 @@
+/**
+ * @file gpu_profiler.cpp
+ * @brief GPU profiler implementation
+ */
+
+#include "tinyvk/renderer/gpu_profiler.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+#include "tinyvk/core/timer.h"
+
+#include <algorithm>
+
+namespace tvk {
+
+// Results are written in bit order, GpuPipelineStatistics follows it
+static constexpr VkQueryPipelineStatisticFlags s_StatisticFlags =
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |
+    VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT;
+static constexpr u32 s_StatisticCount = 6;
+
+GpuProfiler::~GpuProfiler() {
+    Cleanup();
+}
+
+bool GpuProfiler::Init(VulkanContext* context, u32 frameCount, u32 maxScopes, bool pipelineStatistics) {
+    m_Context = context;
+    m_MaxScopes = std::max(1u, maxScopes);
+
+    u32 validBits = context->GetTimestampValidBits(context->GetQueueFamilyIndices().graphicsFamily.value());
+    if (validBits == 0) {
+        TVK_LOG_WARN("Timestamps not supported on the graphics queue, GPU scopes only add debug labels");
+        return false;
+    }
+
+    m_TimestampMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+    m_TimestampPeriod = context->GetDeviceProperties().limits.timestampPeriod;
+    m_HostReset = context->GetVulkan12Features().hostQueryReset;
+    m_PipelineStatistics = pipelineStatistics && context->GetEnabledFeatures().pipelineStatisticsQuery;
+    if (pipelineStatistics && !m_PipelineStatistics) {
+        TVK_LOG_WARN("Pipeline statistics queries not supported");
+    }
+
+    m_Frames.resize(frameCount);
+    for (auto& frame : m_Frames) {
+        VkQueryPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        poolInfo.queryCount = m_MaxScopes * 2;
+
+        if (vkCreateQueryPool(context->GetDevice(), &poolInfo, nullptr, &frame.timestampPool) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create timestamp query pool");
+            Cleanup();
+            return false;
+        }
+
+        if (m_PipelineStatistics) {
+            poolInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+            poolInfo.queryCount = m_MaxScopes;
+            poolInfo.pipelineStatistics = s_StatisticFlags;
+
+            if (vkCreateQueryPool(context->GetDevice(), &poolInfo, nullptr, &frame.statisticsPool) != VK_SUCCESS) {
+                TVK_LOG_ERROR("Failed to create pipeline statistics query pool");
+                Cleanup();
+                return false;
+            }
+        }
+        frame.scopes.reserve(m_MaxScopes);
+    }
+
+    // Timestamps and availability of every scope, followed by the statistics
+    m_QueryData.resize(static_cast<size_t>(m_MaxScopes) * (4 + s_StatisticCount + 1));
+    return true;
+}
+
+void GpuProfiler::Cleanup() {
+    if (!m_Context) return;
+
+    for (auto& frame : m_Frames) {
+        if (frame.timestampPool != VK_NULL_HANDLE) {
+            vkDestroyQueryPool(m_Context->GetDevice(), frame.timestampPool, nullptr);
+        }
+        if (frame.statisticsPool != VK_NULL_HANDLE) {
+            vkDestroyQueryPool(m_Context->GetDevice(), frame.statisticsPool, nullptr);
+        }
+    }
+
+    m_Frames.clear();
+    m_Results.clear();
+    m_QueryData.clear();
+    m_PipelineStatistics = false;
+    m_Recording = false;
+    m_StatisticsActive = false;
+    m_Context = nullptr;
+}
+
+void GpuProfiler::BeginFrame(u32 frameIndex, VkCommandBuffer resetCmd) {
+    if (m_Frames.empty()) return;
+
+    m_CurrentFrame = frameIndex;
+    FrameQueries& frame = m_Frames[frameIndex];
+
+    Resolve(frame);
+    frame.scopes.clear();
+    frame.statisticsCount = 0;
+    m_StatisticsActive = false;
+
+    // Pools are reset whole, the reset is cheap compared to tracking the used range
+    frame.reset = false;
+    if (m_HostReset) {
+        vkResetQueryPool(m_Context->GetDevice(), frame.timestampPool, 0, m_MaxScopes * 2);
+        if (frame.statisticsPool != VK_NULL_HANDLE) {
+            vkResetQueryPool(m_Context->GetDevice(), frame.statisticsPool, 0, m_MaxScopes);
+        }
+        frame.reset = true;
+    } else if (resetCmd != VK_NULL_HANDLE) {
+        vkCmdResetQueryPool(resetCmd, frame.timestampPool, 0, m_MaxScopes * 2);
+        if (frame.statisticsPool != VK_NULL_HANDLE) {
+            vkCmdResetQueryPool(resetCmd, frame.statisticsPool, 0, m_MaxScopes);
+        }
+        frame.reset = true;
+    }
+
+    m_Recording = frame.reset;
+}
+
+void GpuProfiler::EndFrame() {
+    m_Recording = false;
+}
+
+u32 GpuProfiler::BeginScope(VkCommandBuffer cmd, const char* name, bool statistics) {
+    if (!m_Context) return InvalidScope;
+
+    m_Context->CmdBeginDebugLabel(cmd, name);
+
+    if (!m_Enabled || !m_Recording) return InvalidScope;
+
+    FrameQueries& frame = m_Frames[m_CurrentFrame];
+    if (frame.scopes.size() >= m_MaxScopes) return InvalidScope;
+
+    u32 scope = static_cast<u32>(frame.scopes.size());
+    frame.scopes.emplace_back();
+    Scope& record = frame.scopes.back();
+    record.name = name;
+
+    vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.timestampPool, scope * 2);
+
+    if (statistics && frame.statisticsPool != VK_NULL_HANDLE && !m_StatisticsActive) {
+        record.statisticsQuery = frame.statisticsCount++;
+        vkCmdBeginQuery(cmd, frame.statisticsPool, record.statisticsQuery, 0);
+        m_StatisticsActive = true;
+    }
+    return scope;
+}
+
+void GpuProfiler::EndScope(VkCommandBuffer cmd, u32 scope) {
+    if (!m_Context) return;
+
+    // Scopes of a frame that already ended are only labelled
+    if (scope != InvalidScope && m_Recording && scope < m_Frames[m_CurrentFrame].scopes.size()) {
+        FrameQueries& frame = m_Frames[m_CurrentFrame];
+        Scope& record = frame.scopes[scope];
+
+        if (record.statisticsQuery != InvalidScope) {
+            vkCmdEndQuery(cmd, frame.statisticsPool, record.statisticsQuery);
+            m_StatisticsActive = false;
+        }
+
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.timestampPool, scope * 2 + 1);
+        record.ended = true;
+    }
+
+    m_Context->CmdEndDebugLabel(cmd);
+}
+
+void GpuProfiler::Resolve(FrameQueries& frame) {
+    if (!frame.reset) return;
+
+    m_Results.clear();
+    if (frame.scopes.empty()) return;
+
+    VkDevice device = m_Context->GetDevice();
+    u32 scopeCount = static_cast<u32>(frame.scopes.size());
+
+    // The fence signaled, so nothing waits here. Queries of a frame that was
+    // never submitted stay unavailable and are skipped
+    const VkQueryResultFlags flags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+    u64* timestamps = m_QueryData.data();
+    vkGetQueryPoolResults(device, frame.timestampPool, 0, scopeCount * 2,
+                          sizeof(u64) * 4 * scopeCount, timestamps, sizeof(u64) * 2, flags);
+
+    for (u32 i = 0; i < scopeCount; i++) {
+        const Scope& scope = frame.scopes[i];
+        const u64* begin = timestamps + i * 4;
+        const u64* end = begin + 2;
+        if (!scope.ended || begin[1] == 0 || end[1] == 0) continue;
+
+        auto it = std::find_if(m_Results.begin(), m_Results.end(),
+                               [&](const GpuScopeResult& result) { return result.name == scope.name; });
+        if (it == m_Results.end()) {
+            it = m_Results.emplace(m_Results.end());
+            it->name = scope.name;
+        }
+
+        u64 ticks = (end[0] - begin[0]) & m_TimestampMask;
+        it->timeMs += static_cast<double>(ticks) * m_TimestampPeriod / 1000000.0;
+        it->count++;
+    }
+
+    if (frame.statisticsCount > 0) {
+        u64* statistics = timestamps + 4 * scopeCount;
+        const u32 stride = s_StatisticCount + 1;
+        vkGetQueryPoolResults(device, frame.statisticsPool, 0, frame.statisticsCount,
+                              sizeof(u64) * stride * frame.statisticsCount, statistics, sizeof(u64) * stride, flags);
+
+        for (const Scope& scope : frame.scopes) {
+            if (scope.statisticsQuery == InvalidScope || !scope.ended) continue;
+
+            const u64* values = statistics + scope.statisticsQuery * stride;
+            if (values[s_StatisticCount] == 0) continue;
+
+            auto it = std::find_if(m_Results.begin(), m_Results.end(),
+                                   [&](const GpuScopeResult& result) { return result.name == scope.name; });
+            if (it == m_Results.end()) continue;
+
+            it->hasStatistics = true;
+            it->statistics.inputVertices += values[0];
+            it->statistics.inputPrimitives += values[1];
+            it->statistics.vertexInvocations += values[2];
+            it->statistics.clippedPrimitives += values[3];
+            it->statistics.fragmentInvocations += values[4];
+            it->statistics.computeInvocations += values[5];
+        }
+    }
+
+    auto& profiler = Profiler::instance();
+    for (const auto& result : m_Results) {
+        m_ProfileName.assign("GPU: ").append(result.name);
+        profiler.addSample(m_ProfileName, result.timeMs);
+    }
+}
+
+} // namespace tvk
@@ -4,9 +4,12 @@
  */
 
 #include "tinyvk/renderer/mesh.h"
+#include "tinyvk/renderer/mesh_file.h"
 #include "tinyvk/renderer/renderer.h"
+#include "tinyvk/renderer/context.h"
 #include "tinyvk/core/log.h"
 #include <glm/gtc/constants.hpp>
+#include <algorithm>
 
 namespace tvk {
 
@@ -14,24 +17,44 @@ Mesh::~Mesh() {
     Destroy();
 }
 
-bool Mesh::Create(Renderer* renderer, const std::vector<Vertex>& vertices, const std::vector<u32>& indices) {
+bool Mesh::CreateFromData(Renderer* renderer, const void* vertices, u32 vertexCount, u32 vertexStride,
+                          const glm::vec4& boundingSphere, const u32* indices, u32 indexCount,
+                          GeometryArena* arena) {
+    Destroy();
     _renderer = renderer;
-    _vertexCount = static_cast<u32>(vertices.size());
-    _indexCount = static_cast<u32>(indices.size());
+    _vertexCount = vertexCount;
+    _indexCount = indexCount;
+    _vertexStride = vertexStride;
+    _boundingSphere = boundingSphere;
+    _lods = {{0, indexCount, 0.0f}};
     
     if (_vertexCount == 0) {
         TVK_LOG_ERROR("Mesh has no vertices");
         return false;
     }
+
+    if (arena) {
+        if (arena->GetVertexStride() != vertexStride) {
+            TVK_LOG_ERROR("Geometry arena stride {} does not match the mesh's vertices ({})", arena->GetVertexStride(), vertexStride);
+            return false;
+        }
+
+        _arenaHandle = arena->Allocate(vertices, _vertexCount, indices, _indexCount);
+        if (_arenaHandle != GeometryArena::InvalidHandle) {
+            _arena = arena;
+            return true;
+        }
+        TVK_LOG_WARN("Geometry arena full, mesh uses its own buffers");
+    }
     
-    _vertexBuffer = Buffer::CreateVertex(renderer, vertices);
+    _vertexBuffer = Buffer::Create(renderer, static_cast<VkDeviceSize>(vertexStride) * _vertexCount, BufferUsage::Vertex, vertices);
     if (!_vertexBuffer) {
         TVK_LOG_ERROR("Failed to create vertex buffer");
         return false;
     }
     
     if (_indexCount > 0) {
-        _indexBuffer = Buffer::CreateIndex(renderer, indices);
+        _indexBuffer = Buffer::Create(renderer, sizeof(u32) * static_cast<VkDeviceSize>(_indexCount), BufferUsage::Index, indices);
         if (!_indexBuffer) {
             TVK_LOG_ERROR("Failed to create index buffer");
             return false;
@@ -41,28 +64,191 @@ bool Mesh::Create(Renderer* renderer, const std::vector<Vertex>& vertices, const
     return true;
 }
 
+bool Mesh::LoadFromFile(Renderer* renderer, const std::string& path, GeometryArena* arena) {
+    MeshFile file;
+    if (!file.Open(path)) {
+        return false;
+    }
+
+    const MeshFileHeader& header = file.GetHeader();
+    if (!CreateFromData(renderer, file.GetVertices(), header.vertexCount, header.vertexStride,
+                        file.GetBoundingSphere(), file.GetIndices(), header.indexCount, arena)) {
+        return false;
+    }
+
+    SetLods(file.GetLods());
+    return true;
+}
+
 void Mesh::Destroy() {
+    if (_arena) {
+        _arena->Free(_arenaHandle);
+        _arena = nullptr;
+        _arenaHandle = GeometryArena::InvalidHandle;
+    }
     _vertexBuffer.reset();
     _indexBuffer.reset();
     _vertexCount = 0;
     _indexCount = 0;
+    _vertexStride = 0;
+    _boundingSphere = glm::vec4(0.0f);
+    _lods.clear();
+}
+
+void Mesh::Draw(VkCommandBuffer cmd, u32 lod) {
+    BindBuffers(cmd, nullptr);
+    DrawBound(cmd, 1, 0, lod);
+}
+
+void Mesh::DrawBound(VkCommandBuffer cmd, u32 instanceCount, u32 firstInstance, u32 lod) {
+    GeometryRange range = GetRange();
+    if (range.indexCount > 0) {
+        MeshLod level = ResolveLod(lod);
+        vkCmdDrawIndexed(cmd, level.indexCount, instanceCount, range.firstIndex + level.firstIndex,
+                         static_cast<i32>(range.firstVertex), firstInstance);
+    } else {
+        vkCmdDraw(cmd, range.vertexCount, instanceCount, range.firstVertex, firstInstance);
+    }
+}
+
+VkBuffer Mesh::GetVertexBuffer() const {
+    if (_arena) return _arena->GetVertexBuffer();
+    return _vertexBuffer ? _vertexBuffer->GetBuffer() : VK_NULL_HANDLE;
 }
 
-void Mesh::Draw(VkCommandBuffer cmd) {
+VkBuffer Mesh::GetIndexBuffer() const {
+    if (_arena) return _arena->GetIndexBuffer();
+    return _indexBuffer ? _indexBuffer->GetBuffer() : VK_NULL_HANDLE;
+}
+
+GeometryRange Mesh::GetRange() const {
+    if (_arena) return _arena->GetRange(_arenaHandle);
+
+    GeometryRange range;
+    range.vertexCount = _vertexCount;
+    range.indexCount = _indexBuffer ? _indexCount : 0;
+    return range;
+}
+
+void Mesh::DrawInstanced(VkCommandBuffer cmd, const Buffer& instances, u32 instanceCount, u32 firstInstance) {
+    if (instanceCount == 0) return;
+
+    BindBuffers(cmd, &instances);
+    DrawBound(cmd, instanceCount, firstInstance);
+}
+
+void Mesh::DrawIndirect(VkCommandBuffer cmd, const Buffer& commands, VkDeviceSize offset, u32 drawCount,
+                        const Buffer* instances, u32 stride) {
+    if (drawCount == 0 || GetRange().indexCount == 0) return;
+
+    BindBuffers(cmd, instances);
+
+    if (drawCount == 1 || _renderer->GetContext().GetEnabledFeatures().multiDrawIndirect) {
+        vkCmdDrawIndexedIndirect(cmd, commands.GetBuffer(), offset, drawCount, stride);
+        return;
+    }
+
+    for (u32 i = 0; i < drawCount; i++) {
+        vkCmdDrawIndexedIndirect(cmd, commands.GetBuffer(), offset + static_cast<VkDeviceSize>(i) * stride, 1, stride);
+    }
+}
+
+void Mesh::DrawIndirectCount(VkCommandBuffer cmd, const Buffer& commands, VkDeviceSize offset,
+                             const Buffer& count, VkDeviceSize countOffset, u32 maxDrawCount,
+                             const Buffer* instances, u32 stride) {
+    if (maxDrawCount == 0 || GetRange().indexCount == 0) return;
+
+    if (!SupportsDrawIndirectCount()) {
+        TVK_LOG_ERROR("drawIndirectCount is not supported by this device");
+        return;
+    }
+
+    BindBuffers(cmd, instances);
+    vkCmdDrawIndexedIndirectCount(cmd, commands.GetBuffer(), offset, count.GetBuffer(), countOffset, maxDrawCount, stride);
+}
+
+VkDrawIndexedIndirectCommand Mesh::GetIndirectCommand(u32 instanceCount, u32 firstInstance, u32 lod) const {
+    GeometryRange range = GetRange();
+    MeshLod level = ResolveLod(lod);
+
+    VkDrawIndexedIndirectCommand command{};
+    command.indexCount = range.indexCount > 0 ? level.indexCount : 0;
+    command.instanceCount = instanceCount;
+    command.firstIndex = range.firstIndex + level.firstIndex;
+    command.vertexOffset = static_cast<i32>(range.firstVertex);
+    command.firstInstance = firstInstance;
+    return command;
+}
+
+void Mesh::SetLods(const std::vector<MeshLod>& lods) {
+    if (lods.empty()) {
+        _lods = {{0, _indexCount, 0.0f}};
+        return;
+    }
+
+    for (const auto& lod : lods) {
+        if (lod.firstIndex + lod.indexCount > _indexCount) {
+            TVK_LOG_ERROR("LOD range {}+{} exceeds the mesh's {} indices", lod.firstIndex, lod.indexCount, _indexCount);
+            return;
+        }
+    }
+    _lods = lods;
+}
+
+MeshLod Mesh::ResolveLod(u32 lod) const {
+    // Destroyed or never created meshes have no LODs, their range is empty
+    if (_lods.empty()) return {0, _indexCount, 0.0f};
+    return _lods[std::min(lod, GetLodCount() - 1)];
+}
+
+u32 Mesh::SelectLod(float distance, float bias) const {
+    float scaled = distance * bias;
+
+    u32 selected = 0;
+    for (u32 i = 1; i < GetLodCount(); i++) {
+        if (_lods[i].distance <= scaled) {
+            selected = i;
+        }
+    }
+    return selected;
+}
+
+u32 Mesh::SelectLod(const glm::vec3& cameraPosition, const glm::mat4& model, float bias) const {
+    glm::vec3 center = glm::vec3(model * glm::vec4(glm::vec3(_boundingSphere), 1.0f));
+    return SelectLod(glm::length(center - cameraPosition), bias);
+}
+
+bool Mesh::SupportsDrawIndirectCount() const {
+    return _renderer && _renderer->GetContext().GetVulkan12Features().drawIndirectCount;
+}
+
+void Mesh::BindBuffers(VkCommandBuffer cmd, const Buffer* instances) {
+    if (_arena) {
+        _arena->Bind(cmd);
+    }
     if (_vertexBuffer) {
         _vertexBuffer->BindAsVertex(cmd, 0);
     }
-    
+    if (instances) {
+        instances->BindAsVertex(cmd, InstanceData::Binding);
+    }
     if (_indexCount > 0 && _indexBuffer) {
         _indexBuffer->BindAsIndex(cmd);
-        vkCmdDrawIndexed(cmd, _indexCount, 1, 0, 0, 0);
-    } else {
-        vkCmdDraw(cmd, _vertexCount, 1, 0, 0);
     }
 }
 
 namespace Geometry {
 
+// Points on a circle in XZ, segments + 1 of them so the last one closes it
+static std::vector<glm::vec2> GetCircle(float radius, u32 segments) {
+    std::vector<glm::vec2> circle(segments + 1);
+    for (u32 i = 0; i <= segments; ++i) {
+        float angle = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
+        circle[i] = glm::vec2(radius * glm::cos(angle), radius * glm::sin(angle));
+    }
+    return circle;
+}
+
 Scope<Mesh> CreateCube(Renderer* renderer, float size) {
     float half = size * 0.5f;
     
@@ -122,50 +308,11 @@ Scope<Mesh> CreateCube(Renderer* renderer, float size) {
 }
 
 Scope<Mesh> CreateSphere(Renderer* renderer, float radius, u32 segments, u32 rings) {
-    std::vector<Vertex> vertices;
-    std::vector<u32> indices;
-    
-    for (u32 ring = 0; ring <= rings; ++ring) {
-        float phi = glm::pi<float>() * static_cast<float>(ring) / static_cast<float>(rings);
-        float sinPhi = glm::sin(phi);
-        float cosPhi = glm::cos(phi);
-        
-        for (u32 segment = 0; segment <= segments; ++segment) {
-            float theta = 2.0f * glm::pi<float>() * static_cast<float>(segment) / static_cast<float>(segments);
-            float sinTheta = glm::sin(theta);
-            float cosTheta = glm::cos(theta);
-            
-            Vertex vertex;
-            vertex.position = glm::vec3(
-                radius * sinPhi * cosTheta,
-                radius * cosPhi,
-                radius * sinPhi * sinTheta
-            );
-            vertex.normal = glm::normalize(vertex.position);
-            vertex.texCoord = glm::vec2(
-                static_cast<float>(segment) / static_cast<float>(segments),
-                static_cast<float>(ring) / static_cast<float>(rings)
-            );
-            vertex.color = glm::vec3(1.0f);
-            
-            vertices.push_back(vertex);
-        }
-    }
+    std::vector<Vertex> vertices(GeometryKernels::GetGridVertexCount(segments, rings));
+    std::vector<u32> indices(GeometryKernels::GetGridIndexCount(segments, rings));
     
-    for (u32 ring = 0; ring < rings; ++ring) {
-        for (u32 segment = 0; segment < segments; ++segment) {
-            u32 current = ring * (segments + 1) + segment;
-            u32 next = current + segments + 1;
-            
-            indices.push_back(current);
-            indices.push_back(next);
-            indices.push_back(current + 1);
-            
-            indices.push_back(current + 1);
-            indices.push_back(next);
-            indices.push_back(next + 1);
-        }
-    }
+    GeometryKernels::GenerateSphere(vertices.data(), radius, segments, rings);
+    GeometryKernels::GenerateGridIndices(indices.data(), segments, rings);
     
     auto mesh = CreateScope<Mesh>();
     if (!mesh->Create(renderer, vertices, indices)) {
@@ -176,47 +323,11 @@ Scope<Mesh> CreateSphere(Renderer* renderer, float radius, u32 segments, u32 rin
 }
 
 Scope<Mesh> CreatePlane(Renderer* renderer, float width, float height, u32 segmentsX, u32 segmentsY) {
-    std::vector<Vertex> vertices;
-    std::vector<u32> indices;
-    
-    float halfWidth = width * 0.5f;
-    float halfHeight = height * 0.5f;
+    std::vector<Vertex> vertices(GeometryKernels::GetGridVertexCount(segmentsX, segmentsY));
+    std::vector<u32> indices(GeometryKernels::GetGridIndexCount(segmentsX, segmentsY));
     
-    for (u32 y = 0; y <= segmentsY; ++y) {
-        for (u32 x = 0; x <= segmentsX; ++x) {
-            float u = static_cast<float>(x) / static_cast<float>(segmentsX);
-            float v = static_cast<float>(y) / static_cast<float>(segmentsY);
-            
-            Vertex vertex;
-            vertex.position = glm::vec3(
-                -halfWidth + u * width,
-                0.0f,
-                -halfHeight + v * height
-            );
-            vertex.normal = glm::vec3(0.0f, 1.0f, 0.0f);
-            vertex.texCoord = glm::vec2(u, v);
-            vertex.color = glm::vec3(1.0f);
-            
-            vertices.push_back(vertex);
-        }
-    }
-    
-    for (u32 y = 0; y < segmentsY; ++y) {
-        for (u32 x = 0; x < segmentsX; ++x) {
-            u32 topLeft = y * (segmentsX + 1) + x;
-            u32 topRight = topLeft + 1;
-            u32 bottomLeft = (y + 1) * (segmentsX + 1) + x;
-            u32 bottomRight = bottomLeft + 1;
-            
-            indices.push_back(topLeft);
-            indices.push_back(bottomLeft);
-            indices.push_back(topRight);
-            
-            indices.push_back(topRight);
-            indices.push_back(bottomLeft);
-            indices.push_back(bottomRight);
-        }
-    }
+    GeometryKernels::GeneratePlane(vertices.data(), width, height, segmentsX, segmentsY);
+    GeometryKernels::GenerateGridIndices(indices.data(), segmentsX, segmentsY);
     
     auto mesh = CreateScope<Mesh>();
     if (!mesh->Create(renderer, vertices, indices)) {
@@ -229,14 +340,16 @@ Scope<Mesh> CreatePlane(Renderer* renderer, float width, float height, u32 segme
 Scope<Mesh> CreateCylinder(Renderer* renderer, float radius, float height, u32 segments) {
     std::vector<Vertex> vertices;
     std::vector<u32> indices;
+    vertices.reserve(2 * (segments + 1) + 2 + 4 * segments);
+    indices.reserve(12 * segments);
     
     float halfHeight = height * 0.5f;
+    std::vector<glm::vec2> circle = GetCircle(radius, segments);
     
     // Side vertices
     for (u32 i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
-        float x = radius * glm::cos(angle);
-        float z = radius * glm::sin(angle);
+        float x = circle[i].x;
+        float z = circle[i].y;
         float u = static_cast<float>(i) / static_cast<float>(segments);
         
         glm::vec3 normal = glm::normalize(glm::vec3(x, 0.0f, z));
@@ -261,23 +374,20 @@ Scope<Mesh> CreateCylinder(Renderer* renderer, float radius, float height, u32 s
     vertices.push_back({{0.0f,  halfHeight, 0.0f}, {0.0f,  1.0f, 0.0f}, {0.5f, 0.5f}, {1.0f, 1.0f, 1.0f}});
     
     for (u32 i = 0; i < segments; ++i) {
-        float angle1 = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
-        float angle2 = 2.0f * glm::pi<float>() * static_cast<float>(i + 1) / static_cast<float>(segments);
-        
-        glm::vec3 p1(radius * glm::cos(angle1), 0.0f, radius * glm::sin(angle1));
-        glm::vec3 p2(radius * glm::cos(angle2), 0.0f, radius * glm::sin(angle2));
+        glm::vec2 p1 = circle[i];
+        glm::vec2 p2 = circle[i + 1];
         
         u32 idx = static_cast<u32>(vertices.size());
-        vertices.push_back({{p1.x, -halfHeight, p1.z}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
-        vertices.push_back({{p2.x, -halfHeight, p2.z}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
+        vertices.push_back({{p1.x, -halfHeight, p1.y}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
+        vertices.push_back({{p2.x, -halfHeight, p2.y}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
         
         indices.push_back(baseIndex);
         indices.push_back(idx);
         indices.push_back(idx + 1);
         
         idx = static_cast<u32>(vertices.size());
-        vertices.push_back({{p1.x, halfHeight, p1.z}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
-        vertices.push_back({{p2.x, halfHeight, p2.z}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
+        vertices.push_back({{p1.x, halfHeight, p1.y}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
+        vertices.push_back({{p2.x, halfHeight, p2.y}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
         
         indices.push_back(baseIndex + 1);
         indices.push_back(idx + 1);
@@ -295,13 +405,16 @@ Scope<Mesh> CreateCylinder(Renderer* renderer, float radius, float height, u32 s
 Scope<Mesh> CreateCone(Renderer* renderer, float radius, float height, u32 segments) {
     std::vector<Vertex> vertices;
     std::vector<u32> indices;
+    vertices.reserve(segments + 3 + 2 * segments);
+    indices.reserve(6 * segments);
+    
+    std::vector<glm::vec2> circle = GetCircle(radius, segments);
     
     vertices.push_back({{0.0f, height, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.5f, 1.0f}, {1.0f, 1.0f, 1.0f}});
     
     for (u32 i = 0; i <= segments; ++i) {
-        float angle = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
-        float x = radius * glm::cos(angle);
-        float z = radius * glm::sin(angle);
+        float x = circle[i].x;
+        float z = circle[i].y;
         
         glm::vec3 toTip = glm::normalize(glm::vec3(-x, height, -z));
         glm::vec3 normal = glm::normalize(glm::cross(glm::vec3(-z, 0.0f, x), toTip));
@@ -319,11 +432,8 @@ Scope<Mesh> CreateCone(Renderer* renderer, float radius, float height, u32 segme
     vertices.push_back({{0.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.5f, 0.5f}, {1.0f, 1.0f, 1.0f}});
     
     for (u32 i = 0; i < segments; ++i) {
-        float angle1 = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(segments);
-        float angle2 = 2.0f * glm::pi<float>() * static_cast<float>(i + 1) / static_cast<float>(segments);
-        
-        glm::vec3 p1(radius * glm::cos(angle1), 0.0f, radius * glm::sin(angle1));
-        glm::vec3 p2(radius * glm::cos(angle2), 0.0f, radius * glm::sin(angle2));
+        glm::vec3 p1(circle[i].x, 0.0f, circle[i].y);
+        glm::vec3 p2(circle[i + 1].x, 0.0f, circle[i + 1].y);
         
         u32 idx = static_cast<u32>(vertices.size());
         vertices.push_back({p1, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
@@ -343,53 +453,12 @@ Scope<Mesh> CreateCone(Renderer* renderer, float radius, float height, u32 segme
 }
 
 Scope<Mesh> CreateTorus(Renderer* renderer, float majorRadius, float minorRadius, u32 majorSegments, u32 minorSegments) {
-    std::vector<Vertex> vertices;
-    std::vector<u32> indices;
-    
-    for (u32 i = 0; i <= majorSegments; ++i) {
-        float u = 2.0f * glm::pi<float>() * static_cast<float>(i) / static_cast<float>(majorSegments);
-        float cosU = glm::cos(u);
-        float sinU = glm::sin(u);
-        
-        for (u32 j = 0; j <= minorSegments; ++j) {
-            float v = 2.0f * glm::pi<float>() * static_cast<float>(j) / static_cast<float>(minorSegments);
-            float cosV = glm::cos(v);
-            float sinV = glm::sin(v);
-            
-            Vertex vertex;
-            vertex.position = glm::vec3(
-                (majorRadius + minorRadius * cosV) * cosU,
-                minorRadius * sinV,
-                (majorRadius + minorRadius * cosV) * sinU
-            );
-            
-            glm::vec3 center(majorRadius * cosU, 0.0f, majorRadius * sinU);
-            vertex.normal = glm::normalize(vertex.position - center);
-            
-            vertex.texCoord = glm::vec2(
-                static_cast<float>(i) / static_cast<float>(majorSegments),
-                static_cast<float>(j) / static_cast<float>(minorSegments)
-            );
-            vertex.color = glm::vec3(1.0f);
-            
-            vertices.push_back(vertex);
-        }
-    }
+    // Rows of the grid go around the major circle
+    std::vector<Vertex> vertices(GeometryKernels::GetGridVertexCount(minorSegments, majorSegments));
+    std::vector<u32> indices(GeometryKernels::GetGridIndexCount(minorSegments, majorSegments));
     
-    for (u32 i = 0; i < majorSegments; ++i) {
-        for (u32 j = 0; j < minorSegments; ++j) {
-            u32 current = i * (minorSegments + 1) + j;
-            u32 next = current + minorSegments + 1;
-            
-            indices.push_back(current);
-            indices.push_back(next);
-            indices.push_back(current + 1);
-            
-            indices.push_back(current + 1);
-            indices.push_back(next);
-            indices.push_back(next + 1);
-        }
-    }
+    GeometryKernels::GenerateTorus(vertices.data(), majorRadius, minorRadius, majorSegments, minorSegments);
+    GeometryKernels::GenerateGridIndices(indices.data(), minorSegments, majorSegments);
     
     auto mesh = CreateScope<Mesh>();
     if (!mesh->Create(renderer, vertices, indices)) {
@@ -417,6 +486,23 @@ Scope<Mesh> CreateQuad(Renderer* renderer) {
     return mesh;
 }
 
+Scope<Mesh> CreateHeightfield(Renderer* renderer, const float* heights, u32 columns, u32 rows, float cellSize, JobSystem* jobs) {
+    std::vector<Vertex> vertices(GeometryKernels::GetGridVertexCount(columns, rows));
+    std::vector<u32> indices(GeometryKernels::GetGridIndexCount(columns, rows));
+    
+    GeometryKernels::GenerateHeightfield(vertices.data(), heights, columns, rows, cellSize, jobs);
+    GeometryKernels::GenerateGridIndices(indices.data(), columns, rows, 0, jobs);
+    
+    auto mesh = CreateScope<Mesh>();
+    if (!mesh->CreateFromData(renderer, vertices.data(), static_cast<u32>(vertices.size()), sizeof(Vertex),
+                              GeometryKernels::ComputeBoundingSphere(&vertices[0].position.x, vertices.size(), sizeof(Vertex), jobs),
+                              indices.data(), static_cast<u32>(indices.size()))) {
+        return nullptr;
+    }
+    
+    return mesh;
+}
+
 } // namespace Geometry
 
 } // namespace tvk
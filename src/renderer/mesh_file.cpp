@@ -0,0 +1,238 @@
+/**
+ * @file mesh_file.cpp
+ * @brief Binary mesh container implementation
+ */
+
+#include "tinyvk/renderer/mesh_file.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace tvk {
+
+static constexpr char s_MeshMagic[4] = {'T', 'V', 'M', 'S'};
+static constexpr u64 s_SectionAlignment = 16;
+
+static u64 AlignSection(u64 offset) {
+    return (offset + s_SectionAlignment - 1) & ~(s_SectionAlignment - 1);
+}
+
+static bool SectionInFile(u64 offset, u64 size, size_t fileSize) {
+    return offset % 4 == 0 && offset <= fileSize && size <= fileSize - offset;
+}
+
+// Size of a vertex attribute format, 0 for formats a mesh file cannot use
+static u32 GetFormatSize(u32 format) {
+    switch (static_cast<VkFormat>(format)) {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SNORM:
+        case VK_FORMAT_R8G8B8A8_UINT:
+        case VK_FORMAT_R8G8B8A8_SINT:
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+        case VK_FORMAT_A2B10G10R10_SNORM_PACK32:
+        case VK_FORMAT_R16G16_UNORM:
+        case VK_FORMAT_R16G16_SNORM:
+        case VK_FORMAT_R16G16_SFLOAT:
+        case VK_FORMAT_R32_SFLOAT:
+        case VK_FORMAT_R32_UINT:
+        case VK_FORMAT_R32_SINT:
+            return 4;
+        case VK_FORMAT_R16G16B16A16_UNORM:
+        case VK_FORMAT_R16G16B16A16_SNORM:
+        case VK_FORMAT_R16G16B16A16_UINT:
+        case VK_FORMAT_R16G16B16A16_SINT:
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+        case VK_FORMAT_R32G32_SFLOAT:
+        case VK_FORMAT_R32G32_UINT:
+        case VK_FORMAT_R32G32_SINT:
+            return 8;
+        case VK_FORMAT_R32G32B32_SFLOAT:
+        case VK_FORMAT_R32G32B32_UINT:
+        case VK_FORMAT_R32G32B32_SINT:
+            return 12;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+        case VK_FORMAT_R32G32B32A32_UINT:
+        case VK_FORMAT_R32G32B32A32_SINT:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+bool MeshFile::Open(const std::string& path) {
+    Close();
+
+    if (!m_File.Open(path)) {
+        return false;
+    }
+
+    size_t size = m_File.GetSize();
+    if (size < sizeof(MeshFileHeader)) {
+        TVK_LOG_ERROR("Mesh file too small: {}", path);
+        Close();
+        return false;
+    }
+
+    const auto* header = reinterpret_cast<const MeshFileHeader*>(m_File.GetData());
+    if (std::memcmp(header->magic, s_MeshMagic, sizeof(s_MeshMagic)) != 0 || header->version != Version) {
+        TVK_LOG_ERROR("Not a version {} tinyvk mesh file: {}", Version, path);
+        Close();
+        return false;
+    }
+
+    // The sizes come from the file, checked in 64 bits so they cannot wrap
+    bool valid = header->vertexStride > 0 && header->vertexCount > 0 &&
+        SectionInFile(header->attributesOffset, u64(header->attributeCount) * sizeof(MeshFileAttribute), size) &&
+        SectionInFile(header->lodsOffset, u64(header->lodCount) * sizeof(MeshFileLod), size) &&
+        SectionInFile(header->verticesOffset, u64(header->vertexCount) * header->vertexStride, size) &&
+        SectionInFile(header->indicesOffset, u64(header->indexCount) * sizeof(u32), size);
+
+    if (valid) {
+        const auto* lods = reinterpret_cast<const MeshFileLod*>(m_File.GetData() + header->lodsOffset);
+        for (u32 i = 0; i < header->lodCount && valid; i++) {
+            valid = u64(lods[i].firstIndex) + lods[i].indexCount <= header->indexCount;
+        }
+
+        const auto* attributes = reinterpret_cast<const MeshFileAttribute*>(m_File.GetData() + header->attributesOffset);
+        for (u32 i = 0; i < header->attributeCount && valid; i++) {
+            // The whole attribute has to fit, the last vertex would otherwise be read past the buffer
+            u32 formatSize = GetFormatSize(attributes[i].format);
+            valid = formatSize > 0 && u64(attributes[i].offset) + formatSize <= header->vertexStride;
+        }
+    }
+
+    // Indices go straight to the GPU, an out of range one would read past the vertex buffer
+    if (valid && header->indexCount > 0) {
+        valid = header->indicesOffset % alignof(u32) == 0;
+        if (valid) {
+            const auto* indices = reinterpret_cast<const u32*>(m_File.GetData() + header->indicesOffset);
+            u32 maxIndex = 0;
+            for (u32 i = 0; i < header->indexCount; i++) {
+                maxIndex = std::max(maxIndex, indices[i]);
+            }
+            valid = maxIndex < header->vertexCount;
+        }
+    }
+
+    if (!valid) {
+        TVK_LOG_ERROR("Corrupt mesh file: {}", path);
+        Close();
+        return false;
+    }
+
+    m_Header = header;
+    return true;
+}
+
+void MeshFile::Close() {
+    m_File.Close();
+    m_Header = nullptr;
+}
+
+glm::vec4 MeshFile::GetBoundingSphere() const {
+    return glm::vec4(m_Header->boundingSphere[0], m_Header->boundingSphere[1],
+                     m_Header->boundingSphere[2], m_Header->boundingSphere[3]);
+}
+
+std::vector<MeshLod> MeshFile::GetLods() const {
+    std::vector<MeshLod> lods;
+    const auto* fileLods = reinterpret_cast<const MeshFileLod*>(m_File.GetData() + m_Header->lodsOffset);
+    for (u32 i = 0; i < m_Header->lodCount; i++) {
+        lods.push_back({fileLods[i].firstIndex, fileLods[i].indexCount, fileLods[i].distance});
+    }
+    return lods;
+}
+
+VertexLayout MeshFile::GetVertexLayout() const {
+    VertexLayout layout;
+
+    VkVertexInputBindingDescription binding{};
+    binding.binding = 0;
+    binding.stride = m_Header->vertexStride;
+    binding.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    layout.bindings.push_back(binding);
+
+    const auto* attributes = reinterpret_cast<const MeshFileAttribute*>(m_File.GetData() + m_Header->attributesOffset);
+    for (u32 i = 0; i < m_Header->attributeCount; i++) {
+        VkVertexInputAttributeDescription attribute{};
+        attribute.location = attributes[i].location;
+        attribute.binding = 0;
+        attribute.format = static_cast<VkFormat>(attributes[i].format);
+        attribute.offset = attributes[i].offset;
+        layout.attributes.push_back(attribute);
+    }
+    return layout;
+}
+
+bool MeshFile::Write(const std::string& path, const void* vertices, u32 vertexCount, u32 vertexStride,
+                     const VertexLayout& layout, const u32* indices, u32 indexCount,
+                     const std::vector<MeshLod>& lods, const glm::vec4& boundingSphere) {
+    MeshFileHeader header{};
+    std::memcpy(header.magic, s_MeshMagic, sizeof(s_MeshMagic));
+    header.version = Version;
+    header.vertexStride = vertexStride;
+    header.vertexCount = vertexCount;
+    header.indexCount = indexCount;
+    header.attributeCount = static_cast<u32>(layout.attributes.size());
+    header.lodCount = static_cast<u32>(lods.size());
+    header.boundingSphere[0] = boundingSphere.x;
+    header.boundingSphere[1] = boundingSphere.y;
+    header.boundingSphere[2] = boundingSphere.z;
+    header.boundingSphere[3] = boundingSphere.w;
+
+    header.attributesOffset = AlignSection(sizeof(MeshFileHeader));
+    header.lodsOffset = AlignSection(header.attributesOffset + header.attributeCount * sizeof(MeshFileAttribute));
+    header.verticesOffset = AlignSection(header.lodsOffset + header.lodCount * sizeof(MeshFileLod));
+    header.indicesOffset = AlignSection(header.verticesOffset + u64(vertexCount) * vertexStride);
+
+    std::vector<MeshFileAttribute> attributes;
+    for (const auto& attribute : layout.attributes) {
+        attributes.push_back({attribute.location, static_cast<u32>(attribute.format), attribute.offset, 0});
+    }
+
+    std::vector<MeshFileLod> fileLods;
+    for (const auto& lod : lods) {
+        fileLods.push_back({lod.firstIndex, lod.indexCount, lod.distance, 0});
+    }
+
+    // Written next to the target and swapped in, a crash never leaves a torn file
+    std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            TVK_LOG_ERROR("Failed to write mesh file: {}", path);
+            return false;
+        }
+
+        static const char padding[s_SectionAlignment] = {};
+        auto writeSection = [&](u64 offset, const void* data, u64 size) {
+            u64 position = static_cast<u64>(file.tellp());
+            file.write(padding, static_cast<std::streamsize>(offset - position));
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeSection(header.attributesOffset, attributes.data(), attributes.size() * sizeof(MeshFileAttribute));
+        writeSection(header.lodsOffset, fileLods.data(), fileLods.size() * sizeof(MeshFileLod));
+        writeSection(header.verticesOffset, vertices, u64(vertexCount) * vertexStride);
+        writeSection(header.indicesOffset, indices, u64(indexCount) * sizeof(u32));
+
+        if (!file) {
+            TVK_LOG_ERROR("Failed to write mesh file: {}", path);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        TVK_LOG_ERROR("Failed to write mesh file: {} ({})", path, error.message());
+        return false;
+    }
+    return true;
+}
+
+} // namespace tvk
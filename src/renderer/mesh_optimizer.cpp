@@ -0,0 +1,410 @@
+/**
+ * @file mesh_optimizer.cpp
+ * @brief Mesh optimization and simplification implementation
+ */
+
+#include "tinyvk/renderer/mesh_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace tvk {
+namespace MeshOptimizer {
+
+// Forsyth's linear-speed vertex cache optimization
+static constexpr i32 s_CacheSize = 32;
+static constexpr float s_CacheDecayPower = 1.5f;
+static constexpr float s_LastTriangleScore = 0.75f;
+static constexpr float s_ValenceBoostScale = 2.0f;
+static constexpr float s_ValenceBoostPower = 0.5f;
+
+static float VertexScore(i32 cachePosition, u32 remainingValence) {
+    if (remainingValence == 0) return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // The vertices of the last triangle get a fixed score so it is not favoured twice
+            score = s_LastTriangleScore;
+        } else {
+            float scaler = 1.0f / static_cast<float>(s_CacheSize - 3);
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, s_CacheDecayPower);
+        }
+    }
+
+    // Finish off vertices with few triangles left so they leave the working set
+    score += s_ValenceBoostScale * std::pow(static_cast<float>(remainingValence), -s_ValenceBoostPower);
+    return score;
+}
+
+static const float* GetPosition(const float* positions, size_t positionStride, u32 index) {
+    return reinterpret_cast<const float*>(reinterpret_cast<const u8*>(positions) + positionStride * index);
+}
+
+void OptimizeVertexCache(u32* indices, size_t indexCount, size_t vertexCount) {
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) return;
+
+    // Triangles using each vertex, as offsets into one array
+    std::vector<u32> valence(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) {
+        valence[indices[i]]++;
+    }
+
+    std::vector<u32> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; v++) {
+        adjacencyOffset[v + 1] = adjacencyOffset[v] + valence[v];
+    }
+
+    std::vector<u32> adjacency(triangleCount * 3);
+    std::vector<u32> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+    for (size_t t = 0; t < triangleCount; t++) {
+        for (u32 k = 0; k < 3; k++) {
+            u32 v = indices[t * 3 + k];
+            adjacency[fill[v]++] = static_cast<u32>(t);
+        }
+    }
+
+    std::vector<i32> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) {
+        vertexScore[v] = VertexScore(-1, valence[v]);
+    }
+
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<u32> output;
+    output.reserve(triangleCount * 3);
+
+    std::vector<u32> cache;
+    std::vector<u32> newCache;
+    cache.reserve(s_CacheSize + 3);
+    newCache.reserve(s_CacheSize + 3);
+
+    size_t scanCursor = 0;
+    i64 bestTriangle = -1;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++) {
+        // Without a candidate from the cache, take the next triangle that is left
+        if (bestTriangle < 0) {
+            while (emitted[scanCursor]) scanCursor++;
+            bestTriangle = static_cast<i64>(scanCursor);
+        }
+
+        u32 tri = static_cast<u32>(bestTriangle);
+        emitted[tri] = true;
+
+        const u32* triIndices = &indices[tri * 3];
+        output.insert(output.end(), triIndices, triIndices + 3);
+
+        // Drop the triangle from its vertices' adjacency
+        for (u32 k = 0; k < 3; k++) {
+            u32 v = triIndices[k];
+            u32 begin = adjacencyOffset[v];
+            u32 end = begin + valence[v];
+            for (u32 a = begin; a < end; a++) {
+                if (adjacency[a] == tri) {
+                    adjacency[a] = adjacency[end - 1];
+                    break;
+                }
+            }
+            valence[v]--;
+        }
+
+        // Move the triangle's vertices to the front of the cache
+        newCache.clear();
+        newCache.insert(newCache.end(), triIndices, triIndices + 3);
+        for (u32 v : cache) {
+            if (v != triIndices[0] && v != triIndices[1] && v != triIndices[2]) {
+                newCache.push_back(v);
+            }
+        }
+
+        for (size_t i = 0; i < newCache.size(); i++) {
+            u32 v = newCache[i];
+            cachePosition[v] = i < static_cast<size_t>(s_CacheSize) ? static_cast<i32>(i) : -1;
+            vertexScore[v] = VertexScore(cachePosition[v], valence[v]);
+        }
+
+        if (newCache.size() > static_cast<size_t>(s_CacheSize)) {
+            newCache.resize(s_CacheSize);
+        }
+        std::swap(cache, newCache);
+
+        // The best candidate shares a vertex with the cache
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (u32 v : cache) {
+            u32 begin = adjacencyOffset[v];
+            for (u32 a = begin; a < begin + valence[v]; a++) {
+                u32 t = adjacency[a];
+                const u32* ti = &indices[t * 3];
+                float score = vertexScore[ti[0]] + vertexScore[ti[1]] + vertexScore[ti[2]];
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = t;
+                }
+            }
+        }
+    }
+
+    std::memcpy(indices, output.data(), output.size() * sizeof(u32));
+}
+
+void OptimizeOverdraw(u32* indices, size_t indexCount, const float* positions, size_t vertexCount, size_t positionStride) {
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) return;
+
+    // Cluster boundaries are triangles whose vertices all miss a simulated FIFO cache
+    static constexpr u32 cacheSize = 16;
+    std::vector<u32> timestamps(vertexCount, 0);
+    u32 time = cacheSize + 1;
+
+    std::vector<size_t> clusterStarts;
+    for (size_t t = 0; t < triangleCount; t++) {
+        u32 misses = 0;
+        for (u32 k = 0; k < 3; k++) {
+            u32 v = indices[t * 3 + k];
+            if (time - timestamps[v] > cacheSize) {
+                timestamps[v] = time++;
+                misses++;
+            }
+        }
+        if (misses == 3 || t == 0) {
+            clusterStarts.push_back(t);
+        }
+    }
+
+    if (clusterStarts.size() < 2) return;
+
+    glm::vec3 meshCenter(0.0f);
+    for (size_t i = 0; i < indexCount; i++) {
+        const float* p = GetPosition(positions, positionStride, indices[i]);
+        meshCenter += glm::vec3(p[0], p[1], p[2]);
+    }
+    meshCenter /= static_cast<float>(indexCount);
+
+    // Clusters facing away from the center tend to occlude the others, draw them first
+    struct Cluster {
+        size_t start;
+        size_t end;
+        float sortKey;
+    };
+    std::vector<Cluster> clusters;
+    clusters.reserve(clusterStarts.size());
+
+    for (size_t c = 0; c < clusterStarts.size(); c++) {
+        size_t start = clusterStarts[c];
+        size_t end = c + 1 < clusterStarts.size() ? clusterStarts[c + 1] : triangleCount;
+
+        glm::vec3 center(0.0f);
+        glm::vec3 normal(0.0f);
+        float area = 0.0f;
+        for (size_t t = start; t < end; t++) {
+            const float* p0 = GetPosition(positions, positionStride, indices[t * 3]);
+            const float* p1 = GetPosition(positions, positionStride, indices[t * 3 + 1]);
+            const float* p2 = GetPosition(positions, positionStride, indices[t * 3 + 2]);
+            glm::vec3 a(p0[0], p0[1], p0[2]);
+            glm::vec3 b(p1[0], p1[1], p1[2]);
+            glm::vec3 d(p2[0], p2[1], p2[2]);
+
+            glm::vec3 cross = glm::cross(b - a, d - a);
+            float triangleArea = glm::length(cross);
+            center += (a + b + d) * (triangleArea / 3.0f);
+            normal += cross;
+            area += triangleArea;
+        }
+
+        if (area > 0.0f) {
+            center /= area;
+        }
+        float normalLength = glm::length(normal);
+        if (normalLength > 0.0f) {
+            normal /= normalLength;
+        }
+
+        clusters.push_back({start, end, glm::dot(center - meshCenter, normal)});
+    }
+
+    std::stable_sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) {
+        return a.sortKey > b.sortKey;
+    });
+
+    std::vector<u32> output;
+    output.reserve(triangleCount * 3);
+    for (const auto& cluster : clusters) {
+        output.insert(output.end(), indices + cluster.start * 3, indices + cluster.end * 3);
+    }
+    std::memcpy(indices, output.data(), output.size() * sizeof(u32));
+}
+
+size_t OptimizeVertexFetch(void* vertices, u32* indices, size_t indexCount, size_t vertexCount, size_t vertexSize) {
+    static constexpr u32 unused = ~0u;
+    std::vector<u32> remap(vertexCount, unused);
+
+    u32 next = 0;
+    for (size_t i = 0; i < indexCount; i++) {
+        u32& target = remap[indices[i]];
+        if (target == unused) {
+            target = next++;
+        }
+        indices[i] = target;
+    }
+
+    std::vector<u8> reordered(static_cast<size_t>(next) * vertexSize);
+    const u8* source = static_cast<const u8*>(vertices);
+    for (size_t v = 0; v < vertexCount; v++) {
+        if (remap[v] != unused) {
+            std::memcpy(&reordered[remap[v] * vertexSize], source + v * vertexSize, vertexSize);
+        }
+    }
+    std::memcpy(vertices, reordered.data(), reordered.size());
+    return next;
+}
+
+static size_t SimplifyWithGrid(u32* destination, const u32* indices, size_t indexCount, const float* positions,
+                               size_t vertexCount, size_t positionStride, const glm::vec3& minBounds,
+                               float cellSize, u32 gridSize) {
+    // Representative of every cell is the vertex closest to the mean of the cell's vertices
+    std::unordered_map<u64, u32> cellOf;
+    std::vector<u32> vertexCell(vertexCount, ~0u);
+    std::vector<glm::vec3> cellSum;
+    std::vector<u32> cellCount;
+
+    auto cellIndex = [&](const float* p) {
+        u64 x = std::min(static_cast<u32>((p[0] - minBounds.x) / cellSize), gridSize - 1);
+        u64 y = std::min(static_cast<u32>((p[1] - minBounds.y) / cellSize), gridSize - 1);
+        u64 z = std::min(static_cast<u32>((p[2] - minBounds.z) / cellSize), gridSize - 1);
+        return (x << 42) | (y << 21) | z;
+    };
+
+    for (size_t i = 0; i < indexCount; i++) {
+        u32 v = indices[i];
+        if (vertexCell[v] != ~0u) continue;
+
+        const float* p = GetPosition(positions, positionStride, v);
+        auto [it, inserted] = cellOf.emplace(cellIndex(p), static_cast<u32>(cellSum.size()));
+        if (inserted) {
+            cellSum.emplace_back(0.0f);
+            cellCount.push_back(0);
+        }
+        vertexCell[v] = it->second;
+        cellSum[it->second] += glm::vec3(p[0], p[1], p[2]);
+        cellCount[it->second]++;
+    }
+
+    std::vector<u32> representative(cellSum.size(), ~0u);
+    std::vector<float> bestDistance(cellSum.size(), 0.0f);
+    for (size_t v = 0; v < vertexCount; v++) {
+        u32 cell = vertexCell[v];
+        if (cell == ~0u) continue;
+
+        const float* p = GetPosition(positions, positionStride, static_cast<u32>(v));
+        glm::vec3 mean = cellSum[cell] / static_cast<float>(cellCount[cell]);
+        glm::vec3 offset = glm::vec3(p[0], p[1], p[2]) - mean;
+        float distance = glm::dot(offset, offset);
+        if (representative[cell] == ~0u || distance < bestDistance[cell]) {
+            representative[cell] = static_cast<u32>(v);
+            bestDistance[cell] = distance;
+        }
+    }
+
+    struct TriangleHash {
+        size_t operator()(const glm::uvec3& t) const {
+            return (static_cast<size_t>(t.x) * 73856093u) ^ (static_cast<size_t>(t.y) * 19349663u) ^ (static_cast<size_t>(t.z) * 83492791u);
+        }
+    };
+    std::unordered_set<glm::uvec3, TriangleHash> seen;
+
+    size_t written = 0;
+    for (size_t i = 0; i + 2 < indexCount; i += 3) {
+        u32 a = representative[vertexCell[indices[i]]];
+        u32 b = representative[vertexCell[indices[i + 1]]];
+        u32 c = representative[vertexCell[indices[i + 2]]];
+        if (a == b || b == c || a == c) continue;
+
+        // Rotate the smallest index first so duplicates compare equal, winding is kept
+        glm::uvec3 key = a < b && a < c ? glm::uvec3(a, b, c) : (b < c ? glm::uvec3(b, c, a) : glm::uvec3(c, a, b));
+        if (!seen.insert(key).second) continue;
+
+        destination[written++] = a;
+        destination[written++] = b;
+        destination[written++] = c;
+    }
+    return written;
+}
+
+size_t Simplify(u32* destination, const u32* indices, size_t indexCount, const float* positions,
+                size_t vertexCount, size_t positionStride, size_t targetIndexCount) {
+    if (indexCount == 0 || vertexCount == 0) return 0;
+
+    if (targetIndexCount >= indexCount) {
+        std::memcpy(destination, indices, indexCount * sizeof(u32));
+        return indexCount;
+    }
+
+    glm::vec3 minBounds(GetPosition(positions, positionStride, indices[0])[0],
+                        GetPosition(positions, positionStride, indices[0])[1],
+                        GetPosition(positions, positionStride, indices[0])[2]);
+    glm::vec3 maxBounds = minBounds;
+    for (size_t i = 0; i < indexCount; i++) {
+        const float* p = GetPosition(positions, positionStride, indices[i]);
+        glm::vec3 position(p[0], p[1], p[2]);
+        minBounds = glm::min(minBounds, position);
+        maxBounds = glm::max(maxBounds, position);
+    }
+
+    glm::vec3 extent = maxBounds - minBounds;
+    float maxExtent = std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6f));
+
+    // Largest grid whose result fits the target, found by bisection on the resolution
+    u32 low = 1;
+    u32 high = 1024;
+    size_t bestCount = 0;
+    std::vector<u32> scratch(indexCount);
+
+    bool found = false;
+    for (u32 iteration = 0; iteration < 16 && low <= high; iteration++) {
+        u32 grid = (low + high) / 2;
+        size_t count = SimplifyWithGrid(scratch.data(), indices, indexCount, positions, vertexCount, positionStride,
+                                        minBounds, maxExtent / static_cast<float>(grid) * 1.0001f, grid);
+        if (count <= targetIndexCount) {
+            std::memcpy(destination, scratch.data(), count * sizeof(u32));
+            bestCount = count;
+            found = true;
+            low = grid + 1;
+        } else {
+            high = grid - 1;
+        }
+    }
+
+    if (!found) {
+        // Even the coarsest grid is above the target, return it anyway
+        bestCount = SimplifyWithGrid(destination, indices, indexCount, positions, vertexCount, positionStride,
+                                     minBounds, maxExtent * 1.0001f, 1);
+    }
+    return bestCount;
+}
+
+float AnalyzeVertexCache(const u32* indices, size_t indexCount, size_t vertexCount, u32 cacheSize) {
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) return 0.0f;
+
+    std::vector<u32> timestamps(vertexCount, 0);
+    u32 time = cacheSize + 1;
+    size_t misses = 0;
+
+    for (size_t i = 0; i < triangleCount * 3; i++) {
+        u32 v = indices[i];
+        if (time - timestamps[v] > cacheSize) {
+            timestamps[v] = time++;
+            misses++;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+} // namespace MeshOptimizer
+} // namespace tvk
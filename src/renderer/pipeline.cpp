@@ -9,6 +9,7 @@
 #include "tinyvk/renderer/buffer.h"
 #include "tinyvk/renderer/shader_compiler.h"
 #include "tinyvk/core/log.h"
+#include "tinyvk/core/job_system.h"
 
 namespace tvk {
 
@@ -17,165 +18,81 @@ Pipeline::~Pipeline() {
 }
 
 bool Pipeline::Create(Renderer* renderer, VkRenderPass renderPass, const std::string& vertShaderSource, const std::string& fragShaderSource) {
-    _renderer = renderer;
-    auto& ctx = renderer->GetContext();
-    VkDevice device = ctx.GetDevice();
+    return Create(renderer, MakeDesc(renderPass, vertShaderSource, fragShaderSource));
+}
 
-    VkShaderModule vertShaderModule = ShaderCompiler::CreateShaderModuleFromGLSL(
-        renderer, vertShaderSource, ShaderStage::Vertex, "basic.vert"
-    );
-    VkShaderModule fragShaderModule = ShaderCompiler::CreateShaderModuleFromGLSL(
-        renderer, fragShaderSource, ShaderStage::Fragment, "basic.frag"
-    );
-    
-    if (vertShaderModule == VK_NULL_HANDLE || fragShaderModule == VK_NULL_HANDLE) {
-        TVK_LOG_ERROR("Failed to create shader modules");
-        return false;
-    }
+bool Pipeline::Create(Renderer* renderer, const PipelineDesc& desc) {
+    Destroy();
+    _renderer = renderer;
+    _layout = desc.layout != VK_NULL_HANDLE ? desc.layout : renderer->GetPipelineRegistry().GetDefaultLayout();
+    return Build(desc);
+}
 
-    VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
-    vertShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    vertShaderStageInfo.stage = VK_SHADER_STAGE_VERTEX_BIT;
-    vertShaderStageInfo.module = vertShaderModule;
-    vertShaderStageInfo.pName = "main";
-
-    VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
-    fragShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    fragShaderStageInfo.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    fragShaderStageInfo.module = fragShaderModule;
-    fragShaderStageInfo.pName = "main";
-
-    VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
-
-    auto bindingDescription = Vertex::GetBindingDescription();
-    auto attributeDescriptions = Vertex::GetAttributeDescriptions();
-
-    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
-    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
-    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<u32>(attributeDescriptions.size());
-    vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
-
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
-    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    inputAssembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    inputAssembly.primitiveRestartEnable = VK_FALSE;
-
-    VkPipelineViewportStateCreateInfo viewportState{};
-    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
-    viewportState.viewportCount = 1;
-    viewportState.scissorCount = 1;
-
-    VkPipelineRasterizationStateCreateInfo rasterizer{};
-    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
-    rasterizer.depthClampEnable = VK_FALSE;
-    rasterizer.rasterizerDiscardEnable = VK_FALSE;
-    rasterizer.polygonMode = VK_POLYGON_MODE_FILL;
-    rasterizer.lineWidth = 1.0f;
-    rasterizer.cullMode = VK_CULL_MODE_BACK_BIT;
-    rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
-    rasterizer.depthBiasEnable = VK_FALSE;
-
-    VkPipelineMultisampleStateCreateInfo multisampling{};
-    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisampling.sampleShadingEnable = VK_FALSE;
-    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
-
-    VkPipelineDepthStencilStateCreateInfo depthStencil{};
-    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-    depthStencil.depthTestEnable = VK_TRUE;
-    depthStencil.depthWriteEnable = VK_TRUE;
-    depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
-    depthStencil.depthBoundsTestEnable = VK_FALSE;
-    depthStencil.stencilTestEnable = VK_FALSE;
-
-    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
-    colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-    colorBlendAttachment.blendEnable = VK_FALSE;
-
-    VkPipelineColorBlendStateCreateInfo colorBlending{};
-    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-    colorBlending.logicOpEnable = VK_FALSE;
-    colorBlending.attachmentCount = 1;
-    colorBlending.pAttachments = &colorBlendAttachment;
-
-    std::vector<VkDynamicState> dynamicStates = {
-        VK_DYNAMIC_STATE_VIEWPORT,
-        VK_DYNAMIC_STATE_SCISSOR
-    };
-
-    VkPipelineDynamicStateCreateInfo dynamicState{};
-    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
-    dynamicState.dynamicStateCount = static_cast<u32>(dynamicStates.size());
-    dynamicState.pDynamicStates = dynamicStates.data();
+bool Pipeline::CreateAsync(JobSystem& jobs, Renderer* renderer, VkRenderPass renderPass, std::string vertShaderSource, std::string fragShaderSource) {
+    return CreateAsync(jobs, renderer, MakeDesc(renderPass, std::move(vertShaderSource), std::move(fragShaderSource)));
+}
 
-    VkPushConstantRange pushConstantRange{};
-    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
-    pushConstantRange.offset = 0;
-    pushConstantRange.size = sizeof(PushConstants);
+bool Pipeline::CreateAsync(JobSystem& jobs, Renderer* renderer, PipelineDesc desc) {
+    Destroy();
+    _renderer = renderer;
+    _jobs = &jobs;
 
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.pushConstantRangeCount = 1;
-    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+    // The layout is known now so push constants can be set while the fallback is bound
+    _layout = desc.layout != VK_NULL_HANDLE ? desc.layout : renderer->GetPipelineRegistry().GetDefaultLayout();
 
-    if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &_layout) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to create pipeline layout");
-        vkDestroyShaderModule(device, vertShaderModule, nullptr);
-        vkDestroyShaderModule(device, fragShaderModule, nullptr);
-        return false;
-    }
+    jobs.Run([this, desc = std::move(desc)]() {
+        Build(desc);
+    }, &_build);
+    return true;
+}
 
-    VkGraphicsPipelineCreateInfo pipelineInfo{};
-    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipelineInfo.stageCount = 2;
-    pipelineInfo.pStages = shaderStages;
-    pipelineInfo.pVertexInputState = &vertexInputInfo;
-    pipelineInfo.pInputAssemblyState = &inputAssembly;
-    pipelineInfo.pViewportState = &viewportState;
-    pipelineInfo.pRasterizationState = &rasterizer;
-    pipelineInfo.pMultisampleState = &multisampling;
-    pipelineInfo.pDepthStencilState = &depthStencil;
-    pipelineInfo.pColorBlendState = &colorBlending;
-    pipelineInfo.pDynamicState = &dynamicState;
-    pipelineInfo.layout = _layout;
-    pipelineInfo.renderPass = renderPass;
-    pipelineInfo.subpass = 0;
+PipelineDesc Pipeline::MakeDesc(VkRenderPass renderPass, std::string vertShaderSource, std::string fragShaderSource) {
+    PipelineDesc desc;
+    desc.vertexShader = std::move(vertShaderSource);
+    desc.fragmentShader = std::move(fragShaderSource);
+    desc.renderPass = renderPass;
+    return desc;
+}
 
-    if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &_pipeline) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to create graphics pipeline");
-        vkDestroyShaderModule(device, vertShaderModule, nullptr);
-        vkDestroyShaderModule(device, fragShaderModule, nullptr);
+bool Pipeline::Build(const PipelineDesc& desc) {
+    // Identical descriptions share one VkPipeline owned by the registry
+    VkPipeline pipeline = _renderer->GetPipelineRegistry().GetPipeline(desc);
+    if (pipeline == VK_NULL_HANDLE) {
+        _state.store(PipelineState::Failed, std::memory_order_release);
         return false;
     }
 
-    vkDestroyShaderModule(device, vertShaderModule, nullptr);
-    vkDestroyShaderModule(device, fragShaderModule, nullptr);
-
-    TVK_LOG_INFO("Graphics pipeline created successfully");
+    // Published to the recording thread by the release store
+    _pipeline = pipeline;
+    _state.store(PipelineState::Ready, std::memory_order_release);
     return true;
 }
 
 void Pipeline::Destroy() {
-    if (!_renderer) return;
-    
-    auto& ctx = _renderer->GetContext();
-    VkDevice device = ctx.GetDevice();
-
-    if (_pipeline != VK_NULL_HANDLE) {
-        vkDestroyPipeline(device, _pipeline, nullptr);
-        _pipeline = VK_NULL_HANDLE;
+    // A build still running on a worker writes into this pipeline
+    if (_jobs) {
+        _jobs->Wait(_build);
+        _jobs = nullptr;
     }
 
-    if (_layout != VK_NULL_HANDLE) {
-        vkDestroyPipelineLayout(device, _layout, nullptr);
-        _layout = VK_NULL_HANDLE;
-    }
+    // The pipeline and layout belong to the registry
+    _pipeline = VK_NULL_HANDLE;
+    _layout = VK_NULL_HANDLE;
+    _state.store(PipelineState::Pending, std::memory_order_relaxed);
 }
 
-void Pipeline::Bind(VkCommandBuffer cmd) {
-    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, _pipeline);
+bool Pipeline::Bind(VkCommandBuffer cmd) {
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (IsReady()) {
+        pipeline = _pipeline;
+    } else if (_fallback && _fallback->IsReady()) {
+        pipeline = _fallback->_pipeline;
+    }
+
+    if (pipeline == VK_NULL_HANDLE) return false;
+
+    vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    return true;
 }
 
 void Pipeline::SetPushConstants(VkCommandBuffer cmd, const PushConstants& constants) {
@@ -188,29 +105,12 @@ ComputePipeline::~ComputePipeline() {
 
 bool ComputePipeline::Create(Renderer* renderer, const std::string& computeShaderSource) {
     _renderer = renderer;
-    auto& ctx = renderer->GetContext();
-    VkDevice device = ctx.GetDevice();
-
-    VkShaderModule computeShaderModule = ShaderCompiler::CreateShaderModuleFromGLSL(
-        renderer, computeShaderSource, ShaderStage::Compute, "compute.comp"
-    );
-    
-    if (computeShaderModule == VK_NULL_HANDLE) {
-        TVK_LOG_ERROR("Failed to create compute shader module");
-        return false;
-    }
+    VkDevice device = renderer->GetContext().GetDevice();
 
     if (!CreateDescriptorResources()) {
-        vkDestroyShaderModule(device, computeShaderModule, nullptr);
         return false;
     }
 
-    VkPipelineShaderStageCreateInfo computeShaderStageInfo{};
-    computeShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-    computeShaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
-    computeShaderStageInfo.module = computeShaderModule;
-    computeShaderStageInfo.pName = "main";
-
     VkPushConstantRange pushConstantRange{};
     pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
     pushConstantRange.offset = 0;
@@ -225,16 +125,53 @@ bool ComputePipeline::Create(Renderer* renderer, const std::string& computeShade
 
     if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &_layout) != VK_SUCCESS) {
         TVK_LOG_ERROR("Failed to create compute pipeline layout");
-        vkDestroyShaderModule(device, computeShaderModule, nullptr);
         return false;
     }
 
+    _pushConstantStages = VK_SHADER_STAGE_COMPUTE_BIT;
+    _bindless = false;
+    return CreatePipeline(computeShaderSource);
+}
+
+bool ComputePipeline::CreateBindless(Renderer* renderer, const std::string& computeShaderSource) {
+    BindlessHeap& heap = renderer->GetBindlessHeap();
+    if (!heap.IsEnabled()) {
+        TVK_LOG_ERROR("Bindless compute pipeline requires descriptor indexing");
+        return false;
+    }
+
+    _renderer = renderer;
+    _layout = heap.GetPipelineLayout();
+    _pushConstantStages = VK_SHADER_STAGE_ALL;
+    _bindless = true;
+    return CreatePipeline(computeShaderSource);
+}
+
+bool ComputePipeline::CreatePipeline(const std::string& computeShaderSource) {
+    auto& ctx = _renderer->GetContext();
+    VkDevice device = ctx.GetDevice();
+
+    VkShaderModule computeShaderModule = ShaderCompiler::CreateShaderModuleFromGLSL(
+        _renderer, computeShaderSource, ShaderStage::Compute, "compute.comp"
+    );
+    
+    if (computeShaderModule == VK_NULL_HANDLE) {
+        TVK_LOG_ERROR("Failed to create compute shader module");
+        return false;
+    }
+
+    VkPipelineShaderStageCreateInfo computeShaderStageInfo{};
+    computeShaderStageInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    computeShaderStageInfo.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    computeShaderStageInfo.module = computeShaderModule;
+    computeShaderStageInfo.pName = "main";
+
     VkComputePipelineCreateInfo pipelineInfo{};
     pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
     pipelineInfo.stage = computeShaderStageInfo;
     pipelineInfo.layout = _layout;
 
-    if (vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &_pipeline) != VK_SUCCESS) {
+    if (vkCreateComputePipelines(device, ctx.GetPipelineCache(), 1, &pipelineInfo, nullptr, &_pipeline) != VK_SUCCESS) {
         TVK_LOG_ERROR("Failed to create compute pipeline");
         vkDestroyShaderModule(device, computeShaderModule, nullptr);
         return false;
@@ -309,10 +246,11 @@ void ComputePipeline::Destroy() {
         _pipeline = VK_NULL_HANDLE;
     }
 
-    if (_layout != VK_NULL_HANDLE) {
+    if (_layout != VK_NULL_HANDLE && !_bindless) {
         vkDestroyPipelineLayout(device, _layout, nullptr);
-        _layout = VK_NULL_HANDLE;
     }
+    _layout = VK_NULL_HANDLE;
+    _bindless = false;
 
     if (_descriptorPool != VK_NULL_HANDLE) {
         vkDestroyDescriptorPool(device, _descriptorPool, nullptr);
@@ -327,7 +265,11 @@ void ComputePipeline::Destroy() {
 
 void ComputePipeline::Bind(VkCommandBuffer cmd) {
     vkCmdBindPipeline(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _pipeline);
-    vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _layout, 0, 1, &_descriptorSet, 0, nullptr);
+    if (_bindless) {
+        _renderer->GetBindlessHeap().Bind(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _layout);
+    } else {
+        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_COMPUTE, _layout, 0, 1, &_descriptorSet, 0, nullptr);
+    }
 }
 
 void ComputePipeline::Dispatch(VkCommandBuffer cmd, u32 groupCountX, u32 groupCountY, u32 groupCountZ) {
@@ -345,7 +287,7 @@ void ComputePipeline::BindStorageBuffers(Buffer* buffer0, Buffer* buffer1) {
 }
 
 void ComputePipeline::UpdateDescriptors() {
-    if (!_renderer) return;
+    if (!_renderer || _descriptorSet == VK_NULL_HANDLE) return;
     
     auto& ctx = _renderer->GetContext();
     VkDevice device = ctx.GetDevice();
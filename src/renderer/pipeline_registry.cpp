@@ -0,0 +1,349 @@
+/**
+ * @file pipeline_registry.cpp
+ * @brief Pipeline registry implementation
+ */
+
+#include "tinyvk/renderer/pipeline_registry.h"
+#include "tinyvk/renderer/pipeline.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/renderer/shader_compiler.h"
+#include "tinyvk/core/hash.h"
+#include "tinyvk/core/log.h"
+
+namespace tvk {
+
+bool VertexLayout::operator==(const VertexLayout& other) const {
+    if (bindings.size() != other.bindings.size() || attributes.size() != other.attributes.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < bindings.size(); i++) {
+        const auto& a = bindings[i];
+        const auto& b = other.bindings[i];
+        if (a.binding != b.binding || a.stride != b.stride || a.inputRate != b.inputRate) return false;
+    }
+
+    for (size_t i = 0; i < attributes.size(); i++) {
+        const auto& a = attributes[i];
+        const auto& b = other.attributes[i];
+        if (a.location != b.location || a.binding != b.binding || a.format != b.format || a.offset != b.offset) return false;
+    }
+    return true;
+}
+
+u64 PipelineDesc::Hash() const {
+    u64 hash = HashString(vertexShader);
+    hash = HashString(fragmentShader, hash);
+
+    // Field by field, the Vulkan structs may contain padding
+    for (const auto& binding : vertexLayout.bindings) {
+        hash = HashValue(binding.binding, hash);
+        hash = HashValue(binding.stride, hash);
+        hash = HashValue(binding.inputRate, hash);
+    }
+    for (const auto& attribute : vertexLayout.attributes) {
+        hash = HashValue(attribute.location, hash);
+        hash = HashValue(attribute.binding, hash);
+        hash = HashValue(attribute.format, hash);
+        hash = HashValue(attribute.offset, hash);
+    }
+
+    hash = HashValue(topology, hash);
+    hash = HashValue(polygonMode, hash);
+    hash = HashValue(cullMode, hash);
+    hash = HashValue(frontFace, hash);
+    hash = HashValue(depthTest, hash);
+    hash = HashValue(depthWrite, hash);
+    hash = HashValue(depthCompareOp, hash);
+    hash = HashValue(blendMode, hash);
+    hash = HashValue(colorWrite, hash);
+    hash = HashValue(renderPass, hash);
+    hash = HashValue(subpass, hash);
+    hash = HashValue(colorFormat, hash);
+    hash = HashValue(depthFormat, hash);
+
+    for (const auto& constant : specialization) {
+        hash = HashValue(constant.id, hash);
+        hash = HashValue(constant.value, hash);
+    }
+
+    hash = HashValue(layout, hash);
+    return hash;
+}
+
+bool PipelineDesc::operator==(const PipelineDesc& other) const {
+    return vertexShader == other.vertexShader &&
+           fragmentShader == other.fragmentShader &&
+           vertexLayout == other.vertexLayout &&
+           topology == other.topology &&
+           polygonMode == other.polygonMode &&
+           cullMode == other.cullMode &&
+           frontFace == other.frontFace &&
+           depthTest == other.depthTest &&
+           depthWrite == other.depthWrite &&
+           depthCompareOp == other.depthCompareOp &&
+           blendMode == other.blendMode &&
+           colorWrite == other.colorWrite &&
+           renderPass == other.renderPass &&
+           subpass == other.subpass &&
+           colorFormat == other.colorFormat &&
+           depthFormat == other.depthFormat &&
+           specialization == other.specialization &&
+           layout == other.layout;
+}
+
+PipelineRegistry::~PipelineRegistry() {
+    Cleanup();
+}
+
+bool PipelineRegistry::Init(VulkanContext* context) {
+    m_Context = context;
+
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(PushConstants);
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    if (vkCreatePipelineLayout(context->GetDevice(), &pipelineLayoutInfo, nullptr, &m_DefaultLayout) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create default pipeline layout");
+        return false;
+    }
+    return true;
+}
+
+void PipelineRegistry::Cleanup() {
+    if (!m_Context) return;
+
+    VkDevice device = m_Context->GetDevice();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (auto& [hash, entries] : m_Pipelines) {
+        for (auto& entry : entries) {
+            if (entry.pipeline != VK_NULL_HANDLE) {
+                vkDestroyPipeline(device, entry.pipeline, nullptr);
+            }
+        }
+    }
+    m_Pipelines.clear();
+    m_PipelineCount = 0;
+
+    if (m_DefaultLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device, m_DefaultLayout, nullptr);
+        m_DefaultLayout = VK_NULL_HANDLE;
+    }
+
+    m_Context = nullptr;
+}
+
+VkPipeline PipelineRegistry::GetPipeline(const PipelineDesc& desc) {
+    u64 hash = desc.Hash();
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_Pipelines.find(hash);
+        if (it != m_Pipelines.end()) {
+            for (const auto& entry : it->second) {
+                if (entry.desc == desc) return entry.pipeline;
+            }
+        }
+    }
+
+    // Created outside the lock so other threads keep getting existing pipelines meanwhile
+    VkPipeline pipeline = CreatePipeline(desc);
+    if (pipeline == VK_NULL_HANDLE) return VK_NULL_HANDLE;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto& entries = m_Pipelines[hash];
+    for (const auto& entry : entries) {
+        if (entry.desc == desc) {
+            // Another thread created the same pipeline first
+            vkDestroyPipeline(m_Context->GetDevice(), pipeline, nullptr);
+            return entry.pipeline;
+        }
+    }
+
+    entries.push_back({desc, pipeline});
+    m_PipelineCount++;
+    return pipeline;
+}
+
+u32 PipelineRegistry::GetPipelineCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_PipelineCount;
+}
+
+VkPipeline PipelineRegistry::CreatePipeline(const PipelineDesc& desc) {
+    VkDevice device = m_Context->GetDevice();
+
+    if (desc.renderPass == VK_NULL_HANDLE && !m_Context->IsDynamicRenderingSupported()) {
+        TVK_LOG_ERROR("Pipeline has no render pass and dynamic rendering is unavailable");
+        return VK_NULL_HANDLE;
+    }
+
+    auto vertSpirv = ShaderCompiler::CompileGLSL(desc.vertexShader, ShaderStage::Vertex, "pipeline.vert");
+    auto fragSpirv = ShaderCompiler::CompileGLSL(desc.fragmentShader, ShaderStage::Fragment, "pipeline.frag");
+    if (vertSpirv.empty() || fragSpirv.empty()) {
+        TVK_LOG_ERROR("Failed to compile pipeline shaders");
+        return VK_NULL_HANDLE;
+    }
+
+    VkShaderModule modules[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    const std::vector<u32>* spirv[2] = {&vertSpirv, &fragSpirv};
+    for (u32 i = 0; i < 2; i++) {
+        VkShaderModuleCreateInfo moduleInfo{};
+        moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleInfo.codeSize = spirv[i]->size() * sizeof(u32);
+        moduleInfo.pCode = spirv[i]->data();
+
+        if (vkCreateShaderModule(device, &moduleInfo, nullptr, &modules[i]) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create shader module");
+            if (modules[0] != VK_NULL_HANDLE) vkDestroyShaderModule(device, modules[0], nullptr);
+            return VK_NULL_HANDLE;
+        }
+    }
+
+    std::vector<VkSpecializationMapEntry> mapEntries;
+    std::vector<u32> specializationData;
+    for (const auto& constant : desc.specialization) {
+        VkSpecializationMapEntry entry{};
+        entry.constantID = constant.id;
+        entry.offset = static_cast<u32>(specializationData.size() * sizeof(u32));
+        entry.size = sizeof(u32);
+        mapEntries.push_back(entry);
+        specializationData.push_back(constant.value);
+    }
+
+    VkSpecializationInfo specializationInfo{};
+    specializationInfo.mapEntryCount = static_cast<u32>(mapEntries.size());
+    specializationInfo.pMapEntries = mapEntries.data();
+    specializationInfo.dataSize = specializationData.size() * sizeof(u32);
+    specializationInfo.pData = specializationData.data();
+
+    VkPipelineShaderStageCreateInfo shaderStages[2]{};
+    shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    shaderStages[0].module = modules[0];
+    shaderStages[0].pName = "main";
+    shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    shaderStages[1].module = modules[1];
+    shaderStages[1].pName = "main";
+    if (!mapEntries.empty()) {
+        shaderStages[0].pSpecializationInfo = &specializationInfo;
+        shaderStages[1].pSpecializationInfo = &specializationInfo;
+    }
+
+    VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+    vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInputInfo.vertexBindingDescriptionCount = static_cast<u32>(desc.vertexLayout.bindings.size());
+    vertexInputInfo.pVertexBindingDescriptions = desc.vertexLayout.bindings.data();
+    vertexInputInfo.vertexAttributeDescriptionCount = static_cast<u32>(desc.vertexLayout.attributes.size());
+    vertexInputInfo.pVertexAttributeDescriptions = desc.vertexLayout.attributes.data();
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+    inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    inputAssembly.topology = desc.topology;
+    inputAssembly.primitiveRestartEnable = VK_FALSE;
+
+    VkPipelineViewportStateCreateInfo viewportState{};
+    viewportState.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewportState.viewportCount = 1;
+    viewportState.scissorCount = 1;
+
+    VkPipelineRasterizationStateCreateInfo rasterizer{};
+    rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterizer.depthClampEnable = VK_FALSE;
+    rasterizer.rasterizerDiscardEnable = VK_FALSE;
+    rasterizer.polygonMode = desc.polygonMode;
+    rasterizer.lineWidth = 1.0f;
+    rasterizer.cullMode = desc.cullMode;
+    rasterizer.frontFace = desc.frontFace;
+    rasterizer.depthBiasEnable = VK_FALSE;
+
+    VkPipelineMultisampleStateCreateInfo multisampling{};
+    multisampling.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisampling.sampleShadingEnable = VK_FALSE;
+    multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineDepthStencilStateCreateInfo depthStencil{};
+    depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthStencil.depthTestEnable = desc.depthTest ? VK_TRUE : VK_FALSE;
+    depthStencil.depthWriteEnable = desc.depthWrite ? VK_TRUE : VK_FALSE;
+    depthStencil.depthCompareOp = desc.depthCompareOp;
+    depthStencil.depthBoundsTestEnable = VK_FALSE;
+    depthStencil.stencilTestEnable = VK_FALSE;
+
+    VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+    if (desc.colorWrite) {
+        colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    }
+    colorBlendAttachment.blendEnable = desc.blendMode == BlendMode::Opaque ? VK_FALSE : VK_TRUE;
+    colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    colorBlendAttachment.dstColorBlendFactor = desc.blendMode == BlendMode::Additive ? VK_BLEND_FACTOR_ONE : VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    colorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+    colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+    colorBlendAttachment.dstAlphaBlendFactor = desc.blendMode == BlendMode::Additive ? VK_BLEND_FACTOR_ONE : VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    colorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+
+    VkPipelineColorBlendStateCreateInfo colorBlending{};
+    colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    colorBlending.logicOpEnable = VK_FALSE;
+    colorBlending.attachmentCount = 1;
+    colorBlending.pAttachments = &colorBlendAttachment;
+
+    // Without a render pass the attachment formats describe the target, the pipeline works with any image of them
+    VkPipelineRenderingCreateInfoKHR renderingInfo{};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    if (desc.renderPass == VK_NULL_HANDLE) {
+        renderingInfo.colorAttachmentCount = desc.colorFormat != VK_FORMAT_UNDEFINED ? 1 : 0;
+        renderingInfo.pColorAttachmentFormats = &desc.colorFormat;
+        renderingInfo.depthAttachmentFormat = desc.depthFormat;
+        colorBlending.attachmentCount = renderingInfo.colorAttachmentCount;
+    }
+
+    VkDynamicState dynamicStates[] = {
+        VK_DYNAMIC_STATE_VIEWPORT,
+        VK_DYNAMIC_STATE_SCISSOR
+    };
+
+    VkPipelineDynamicStateCreateInfo dynamicState{};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates = dynamicStates;
+
+    VkGraphicsPipelineCreateInfo pipelineInfo{};
+    pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    pipelineInfo.pNext = desc.renderPass == VK_NULL_HANDLE ? &renderingInfo : nullptr;
+    pipelineInfo.stageCount = 2;
+    pipelineInfo.pStages = shaderStages;
+    pipelineInfo.pVertexInputState = &vertexInputInfo;
+    pipelineInfo.pInputAssemblyState = &inputAssembly;
+    pipelineInfo.pViewportState = &viewportState;
+    pipelineInfo.pRasterizationState = &rasterizer;
+    pipelineInfo.pMultisampleState = &multisampling;
+    pipelineInfo.pDepthStencilState = &depthStencil;
+    pipelineInfo.pColorBlendState = &colorBlending;
+    pipelineInfo.pDynamicState = &dynamicState;
+    pipelineInfo.layout = desc.layout != VK_NULL_HANDLE ? desc.layout : m_DefaultLayout;
+    pipelineInfo.renderPass = desc.renderPass;
+    pipelineInfo.subpass = desc.subpass;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkResult result = vkCreateGraphicsPipelines(device, m_Context->GetPipelineCache(), 1, &pipelineInfo, nullptr, &pipeline);
+
+    vkDestroyShaderModule(device, modules[0], nullptr);
+    vkDestroyShaderModule(device, modules[1], nullptr);
+
+    if (result != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create graphics pipeline");
+        return VK_NULL_HANDLE;
+    }
+    return pipeline;
+}
+
+} // namespace tvk
@@ -0,0 +1,1594 @@
+/**
+ * @file render_graph.cpp
+ * @brief Render graph implementation
+ */
+
+#include "tinyvk/renderer/render_graph.h"
+#include "tinyvk/renderer/renderer.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+namespace tvk {
+
+static constexpr VkAccessFlags WriteAccessMask =
+    VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+    VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_HOST_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+static bool HasDepth(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_D16_UNORM:
+        case VK_FORMAT_X8_D24_UNORM_PACK32:
+        case VK_FORMAT_D32_SFLOAT:
+        case VK_FORMAT_D16_UNORM_S8_UINT:
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool HasStencil(VkFormat format) {
+    return format == VK_FORMAT_D16_UNORM_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT ||
+           format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_S8_UINT;
+}
+
+static VkImageAspectFlags GetAspectMask(VkFormat format) {
+    if (!HasDepth(format)) {
+        return HasStencil(format) ? VK_IMAGE_ASPECT_STENCIL_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+    return VK_IMAGE_ASPECT_DEPTH_BIT | (HasStencil(format) ? VK_IMAGE_ASPECT_STENCIL_BIT : 0);
+}
+
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Memory block shared by transients, in placement order
+ */
+struct AliasBlock {
+    VkDeviceSize size = 0;
+    VkDeviceSize alignment = 1;
+    u32 memoryTypeBits = 0;
+    bool aliasable = true;
+    std::vector<u32> occupants;
+};
+
+/**
+ * @brief Place resources into as few bytes as possible, largest first
+ * Resources whose pass ranges overlap never share bytes, each lands at the lowest offset free for its lifetime
+ */
+static std::vector<AliasBlock> PlaceResources(const std::vector<VkMemoryRequirements>& requirements,
+                                              const std::vector<std::pair<u32, u32>>& lifetimes,
+                                              const std::vector<bool>& aliasable,
+                                              std::vector<std::pair<u32, VkDeviceSize>>& placements) {
+    std::vector<AliasBlock> blocks;
+    placements.assign(requirements.size(), {0, 0});
+
+    std::vector<u32> order(requirements.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](u32 a, u32 b) {
+        return requirements[a].size > requirements[b].size;
+    });
+
+    auto overlaps = [&](u32 a, u32 b) {
+        return lifetimes[a].first <= lifetimes[b].second && lifetimes[b].first <= lifetimes[a].second;
+    };
+
+    for (u32 resource : order) {
+        const VkMemoryRequirements& req = requirements[resource];
+        bool placed = false;
+
+        for (u32 b = 0; b < blocks.size() && aliasable[resource] && !placed; b++) {
+            AliasBlock& block = blocks[b];
+            if (!block.aliasable || (block.memoryTypeBits & req.memoryTypeBits) == 0) continue;
+
+            // Candidates are the block start and the ends of occupants alive at the same time
+            std::vector<VkDeviceSize> candidates = {0};
+            for (u32 occupant : block.occupants) {
+                if (overlaps(resource, occupant)) {
+                    candidates.push_back(AlignUp(placements[occupant].second + requirements[occupant].size, req.alignment));
+                }
+            }
+            std::sort(candidates.begin(), candidates.end());
+
+            for (VkDeviceSize offset : candidates) {
+                if (offset + req.size > block.size) break;
+
+                bool free = true;
+                for (u32 occupant : block.occupants) {
+                    VkDeviceSize begin = placements[occupant].second;
+                    VkDeviceSize end = begin + requirements[occupant].size;
+                    if (overlaps(resource, occupant) && offset < end && begin < offset + req.size) {
+                        free = false;
+                        break;
+                    }
+                }
+                if (!free) continue;
+
+                placements[resource] = {b, offset};
+                block.occupants.push_back(resource);
+                block.alignment = std::max(block.alignment, req.alignment);
+                block.memoryTypeBits &= req.memoryTypeBits;
+                placed = true;
+                break;
+            }
+        }
+
+        if (!placed) {
+            AliasBlock block;
+            block.size = req.size;
+            block.alignment = req.alignment;
+            block.memoryTypeBits = req.memoryTypeBits;
+            block.aliasable = aliasable[resource];
+            block.occupants.push_back(resource);
+            placements[resource] = {static_cast<u32>(blocks.size()), 0};
+            blocks.push_back(std::move(block));
+        }
+    }
+
+    return blocks;
+}
+
+// ============================================================================
+// RenderGraphBuilder
+// ============================================================================
+
+void RenderGraphBuilder::WriteColor(RenderGraphImage image, std::optional<VkClearColorValue> clear) {
+    if (image.index >= m_Graph->m_Images.size()) return;
+
+    RenderGraph::Attachment attachment;
+    attachment.image = image.index;
+    attachment.clear = clear.has_value();
+    if (clear) {
+        attachment.clearValue.color = *clear;
+    }
+    m_Graph->m_Passes[m_Pass].colors.push_back(attachment);
+
+    // Loading the previous contents reads them
+    m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+                            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                            VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, !attachment.clear, true);
+}
+
+void RenderGraphBuilder::WriteDepth(RenderGraphImage image, std::optional<f32> clear) {
+    if (image.index >= m_Graph->m_Images.size()) return;
+
+    RenderGraph::Attachment& attachment = m_Graph->m_Passes[m_Pass].depth;
+    attachment.image = image.index;
+    attachment.clear = clear.has_value();
+    attachment.readOnly = false;
+    attachment.clearValue.depthStencil = {clear.value_or(1.0f), 0};
+
+    m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, !attachment.clear, true);
+}
+
+void RenderGraphBuilder::ReadDepth(RenderGraphImage image) {
+    if (image.index >= m_Graph->m_Images.size()) return;
+
+    RenderGraph::Attachment& attachment = m_Graph->m_Passes[m_Pass].depth;
+    attachment.image = image.index;
+    attachment.clear = false;
+    attachment.readOnly = true;
+
+    m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                            VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT,
+                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, true, false);
+}
+
+void RenderGraphBuilder::Read(RenderGraphImage image, RenderGraphImageUsage usage) {
+    if (image.index >= m_Graph->m_Images.size()) return;
+
+    VkPipelineStageFlags shaderStages = m_Graph->GetShaderStages(m_Pass);
+    switch (usage) {
+        case RenderGraphImageUsage::Sampled:
+            m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_SAMPLED_BIT, shaderStages,
+                                    VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true, false);
+            break;
+        case RenderGraphImageUsage::Storage:
+            m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_STORAGE_BIT, shaderStages,
+                                    VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_GENERAL, true, false);
+            break;
+        case RenderGraphImageUsage::TransferSrc:
+            m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                    VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, true, false);
+            break;
+        case RenderGraphImageUsage::TransferDst:
+            TVK_LOG_ERROR("Pass '{}' reads image '{}' as a transfer destination",
+                          m_Graph->m_Passes[m_Pass].name, m_Graph->m_Images[image.index].name);
+            break;
+    }
+}
+
+void RenderGraphBuilder::Write(RenderGraphImage image, RenderGraphImageUsage usage) {
+    if (image.index >= m_Graph->m_Images.size()) return;
+
+    switch (usage) {
+        case RenderGraphImageUsage::Storage:
+            m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_STORAGE_BIT, m_Graph->GetShaderStages(m_Pass),
+                                    VK_ACCESS_SHADER_WRITE_BIT, VK_IMAGE_LAYOUT_GENERAL, false, true);
+            break;
+        case RenderGraphImageUsage::TransferDst:
+            m_Graph->AddImageAccess(m_Pass, image.index, VK_IMAGE_USAGE_TRANSFER_DST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                    VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, false, true);
+            break;
+        default:
+            TVK_LOG_ERROR("Pass '{}' writes image '{}' through a read-only usage",
+                          m_Graph->m_Passes[m_Pass].name, m_Graph->m_Images[image.index].name);
+            break;
+    }
+}
+
+void RenderGraphBuilder::Read(RenderGraphBuffer buffer, RenderGraphBufferUsage usage) {
+    if (buffer.index >= m_Graph->m_Buffers.size()) return;
+
+    VkPipelineStageFlags shaderStages = m_Graph->GetShaderStages(m_Pass);
+    switch (usage) {
+        case RenderGraphBufferUsage::Vertex:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                                     VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, true, false);
+            break;
+        case RenderGraphBufferUsage::Index:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                                     VK_ACCESS_INDEX_READ_BIT, true, false);
+            break;
+        case RenderGraphBufferUsage::Indirect:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                                     VK_ACCESS_INDIRECT_COMMAND_READ_BIT, true, false);
+            break;
+        case RenderGraphBufferUsage::Uniform:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, shaderStages,
+                                     VK_ACCESS_UNIFORM_READ_BIT, true, false);
+            break;
+        case RenderGraphBufferUsage::Storage:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, shaderStages,
+                                     VK_ACCESS_SHADER_READ_BIT, true, false);
+            break;
+        case RenderGraphBufferUsage::TransferSrc:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     VK_ACCESS_TRANSFER_READ_BIT, true, false);
+            break;
+        case RenderGraphBufferUsage::TransferDst:
+            TVK_LOG_ERROR("Pass '{}' reads buffer '{}' as a transfer destination",
+                          m_Graph->m_Passes[m_Pass].name, m_Graph->m_Buffers[buffer.index].name);
+            break;
+    }
+}
+
+void RenderGraphBuilder::Write(RenderGraphBuffer buffer, RenderGraphBufferUsage usage) {
+    if (buffer.index >= m_Graph->m_Buffers.size()) return;
+
+    switch (usage) {
+        case RenderGraphBufferUsage::Storage:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, m_Graph->GetShaderStages(m_Pass),
+                                     VK_ACCESS_SHADER_WRITE_BIT, false, true);
+            break;
+        case RenderGraphBufferUsage::TransferDst:
+            m_Graph->AddBufferAccess(m_Pass, buffer.index, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     VK_ACCESS_TRANSFER_WRITE_BIT, false, true);
+            break;
+        default:
+            TVK_LOG_ERROR("Pass '{}' writes buffer '{}' through a read-only usage",
+                          m_Graph->m_Passes[m_Pass].name, m_Graph->m_Buffers[buffer.index].name);
+            break;
+    }
+}
+
+void RenderGraphBuilder::SetSideEffect() {
+    m_Graph->m_Passes[m_Pass].sideEffect = true;
+}
+
+// ============================================================================
+// RenderGraphContext
+// ============================================================================
+
+VkImage RenderGraphContext::GetImage(RenderGraphImage image) const {
+    return image.index < m_Graph->m_Images.size() ? m_Graph->m_Images[image.index].image : VK_NULL_HANDLE;
+}
+
+VkImageView RenderGraphContext::GetImageView(RenderGraphImage image) const {
+    return image.index < m_Graph->m_Images.size() ? m_Graph->m_Images[image.index].view : VK_NULL_HANDLE;
+}
+
+VkBuffer RenderGraphContext::GetBuffer(RenderGraphBuffer buffer) const {
+    return buffer.index < m_Graph->m_Buffers.size() ? m_Graph->m_Buffers[buffer.index].buffer : VK_NULL_HANDLE;
+}
+
+// ============================================================================
+// RenderGraph
+// ============================================================================
+
+RenderGraph::~RenderGraph() {
+    Cleanup();
+}
+
+bool RenderGraph::Init(Renderer* renderer) {
+    m_Renderer = renderer;
+    VulkanContext& context = renderer->GetContext();
+
+    const QueueFamilyIndices& families = context.GetQueueFamilyIndices();
+    m_GraphicsFamily = families.graphicsFamily.value();
+    m_ComputeFamily = families.computeFamily.value_or(m_GraphicsFamily);
+    m_AsyncCompute = context.HasDedicatedComputeQueue() && context.GetVulkan12Features().timelineSemaphore &&
+                     context.GetComputeQueue() != VK_NULL_HANDLE;
+
+    m_FrameCommands.resize(renderer->GetMaxFramesInFlight());
+    for (auto& frame : m_FrameCommands) {
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = m_GraphicsFamily;
+        if (vkCreateCommandPool(context.GetDevice(), &poolInfo, nullptr, &frame.graphicsPool) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create render graph command pool");
+            return false;
+        }
+
+        if (m_AsyncCompute) {
+            poolInfo.queueFamilyIndex = m_ComputeFamily;
+            if (vkCreateCommandPool(context.GetDevice(), &poolInfo, nullptr, &frame.computePool) != VK_SUCCESS) {
+                TVK_LOG_ERROR("Failed to create render graph compute command pool");
+                return false;
+            }
+        }
+    }
+
+    if (m_AsyncCompute) {
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &typeInfo;
+
+        if (vkCreateSemaphore(context.GetDevice(), &semaphoreInfo, nullptr, &m_Timeline) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create render graph timeline semaphore");
+            return false;
+        }
+    }
+
+    TVK_LOG_INFO("Render graph initialized (async compute {})", m_AsyncCompute ? "enabled" : "unavailable");
+    return true;
+}
+
+void RenderGraph::Cleanup() {
+    if (!m_Renderer) return;
+
+    VkDevice device = m_Renderer->GetContext().GetDevice();
+
+    for (auto& retired : m_Retired) {
+        DestroyPhysical(retired);
+    }
+    m_Retired.clear();
+
+    RetiredResources current;
+    current.images = std::move(m_PhysicalImages);
+    current.buffers = std::move(m_PhysicalBuffers);
+    current.blocks = std::move(m_Blocks);
+    for (auto& framebuffer : m_Framebuffers) {
+        current.framebuffers.push_back(framebuffer.framebuffer);
+    }
+    DestroyPhysical(current);
+    m_PhysicalImages.clear();
+    m_PhysicalBuffers.clear();
+    m_Blocks.clear();
+    m_Framebuffers.clear();
+    m_Signature.clear();
+
+    for (auto& [key, renderPass] : m_RenderPasses) {
+        vkDestroyRenderPass(device, renderPass, nullptr);
+    }
+    m_RenderPasses.clear();
+
+    for (auto& frame : m_FrameCommands) {
+        if (frame.graphicsPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(device, frame.graphicsPool, nullptr);
+        }
+        if (frame.computePool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(device, frame.computePool, nullptr);
+        }
+    }
+    m_FrameCommands.clear();
+
+    if (m_Timeline != VK_NULL_HANDLE) {
+        vkDestroySemaphore(device, m_Timeline, nullptr);
+        m_Timeline = VK_NULL_HANDLE;
+    }
+
+    Reset();
+    m_Renderer = nullptr;
+}
+
+RenderGraphImage RenderGraph::CreateImage(const std::string& name, const RenderGraphImageDesc& desc) {
+    Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    if (resource.desc.width == 0 || resource.desc.height == 0) {
+        VkExtent2D extent = m_Renderer->GetSwapchainExtent();
+        resource.desc.width = extent.width;
+        resource.desc.height = extent.height;
+    }
+    resource.desc.mipLevels = std::max(resource.desc.mipLevels, 1u);
+
+    m_Images.push_back(std::move(resource));
+    return {static_cast<u32>(m_Images.size() - 1)};
+}
+
+RenderGraphBuffer RenderGraph::CreateBuffer(const std::string& name, VkDeviceSize size) {
+    Resource resource;
+    resource.name = name;
+    resource.size = size;
+
+    m_Buffers.push_back(std::move(resource));
+    return {static_cast<u32>(m_Buffers.size() - 1)};
+}
+
+RenderGraphImage RenderGraph::ImportImage(const std::string& name, VkImage image, VkImageView view,
+                                          const RenderGraphImageDesc& desc, VkImageLayout currentLayout,
+                                          VkImageLayout finalLayout) {
+    Resource resource;
+    resource.name = name;
+    resource.imported = true;
+    resource.desc = desc;
+    resource.desc.mipLevels = std::max(resource.desc.mipLevels, 1u);
+    resource.image = image;
+    resource.view = view;
+    resource.finalLayout = finalLayout;
+    resource.state.layout = currentLayout;
+
+    m_Images.push_back(std::move(resource));
+    return {static_cast<u32>(m_Images.size() - 1)};
+}
+
+RenderGraphBuffer RenderGraph::ImportBuffer(const std::string& name, VkBuffer buffer, VkDeviceSize size) {
+    Resource resource;
+    resource.name = name;
+    resource.imported = true;
+    resource.buffer = buffer;
+    resource.size = size;
+
+    m_Buffers.push_back(std::move(resource));
+    return {static_cast<u32>(m_Buffers.size() - 1)};
+}
+
+void RenderGraph::AddPass(const std::string& name, RenderGraphPassType type,
+                          const std::function<void(RenderGraphBuilder&)>& setup,
+                          std::function<void(RenderGraphContext&)> execute) {
+    Pass pass;
+    pass.name = name;
+    pass.type = type;
+    pass.execute = std::move(execute);
+    m_Passes.push_back(std::move(pass));
+
+    RenderGraphBuilder builder(this, static_cast<u32>(m_Passes.size() - 1));
+    if (setup) {
+        setup(builder);
+    }
+}
+
+VkPipelineStageFlags RenderGraph::GetShaderStages(u32 pass) const {
+    switch (m_Passes[pass].type) {
+        case RenderGraphPassType::Raster:
+            return VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        case RenderGraphPassType::Compute:
+        case RenderGraphPassType::AsyncCompute:
+            return VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+        case RenderGraphPassType::Transfer:
+            return VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
+    return VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+}
+
+void RenderGraph::AddImageAccess(u32 pass, u32 image, VkImageUsageFlags usage, VkPipelineStageFlags stages,
+                                 VkAccessFlags access, VkImageLayout layout, bool read, bool write) {
+    m_Images[image].usage |= usage;
+
+    // Several declarations of one image in a pass merge into one access
+    for (auto& existing : m_Passes[pass].images) {
+        if (existing.resource != image) continue;
+
+        if (existing.layout != layout) {
+            TVK_LOG_ERROR("Pass '{}' uses image '{}' in two layouts", m_Passes[pass].name, m_Images[image].name);
+            return;
+        }
+        existing.stages |= stages;
+        existing.access |= access;
+        existing.read |= read;
+        existing.write |= write;
+        return;
+    }
+
+    m_Passes[pass].images.push_back({image, stages, access, layout, read, write});
+}
+
+void RenderGraph::AddBufferAccess(u32 pass, u32 buffer, VkBufferUsageFlags usage, VkPipelineStageFlags stages,
+                                  VkAccessFlags access, bool read, bool write) {
+    m_Buffers[buffer].usage |= usage;
+
+    for (auto& existing : m_Passes[pass].buffers) {
+        if (existing.resource != buffer) continue;
+
+        existing.stages |= stages;
+        existing.access |= access;
+        existing.read |= read;
+        existing.write |= write;
+        return;
+    }
+
+    m_Passes[pass].buffers.push_back({buffer, stages, access, VK_IMAGE_LAYOUT_UNDEFINED, read, write});
+}
+
+void RenderGraph::Execute() {
+    if (!m_Renderer || m_Passes.empty()) {
+        Reset();
+        return;
+    }
+
+    CollectRetired();
+
+    m_Stats.passCount = static_cast<u32>(m_Passes.size());
+    m_Stats.culledPasses = 0;
+    m_Stats.asyncPasses = 0;
+    m_Stats.barriers = 0;
+
+    CullPasses();
+    AssignQueues();
+    ComputeLifetimes();
+    if (!RealizeTransients()) {
+        Reset();
+        return;
+    }
+    InitStates();
+
+    bool async = m_Stats.asyncPasses > 0;
+    VkCommandBuffer graphics = BeginCommands(GraphicsQueue);
+    VkCommandBuffer pre = async ? BeginCommands(GraphicsQueue) : VK_NULL_HANDLE;
+    VkCommandBuffer compute = async ? BeginCommands(ComputeQueue) : VK_NULL_HANDLE;
+    VkCommandBuffer tail = async ? BeginCommands(GraphicsQueue) : VK_NULL_HANDLE;
+    if (graphics == VK_NULL_HANDLE || (async && (pre == VK_NULL_HANDLE || compute == VK_NULL_HANDLE || tail == VK_NULL_HANDLE))) {
+        Reset();
+        return;
+    }
+
+    BarrierBatch batch;
+    VkPipelineStageFlags tailWaitStages = 0;
+    BarrierBatch endBatch;
+
+    if (async) {
+        // Compute passes only depend on the state at the start of the graph, record them first
+        BarrierBatch preBatch;
+        for (auto* resources : {&m_Images, &m_Buffers}) {
+            bool isImage = resources == &m_Images;
+            for (auto& resource : *resources) {
+                if (!resource.imported || !resource.compute) continue;
+
+                // Used first by the compute queue, ownership moves before it starts
+                const Pass& first = m_Passes[resource.firstPass];
+                if (first.queue != ComputeQueue) continue;
+
+                u32 index = static_cast<u32>(&resource - resources->data());
+                const auto& accesses = isImage ? first.images : first.buffers;
+                auto access = std::find_if(accesses.begin(), accesses.end(),
+                                           [&](const Access& a) { return a.resource == index; });
+
+                ResourceState& state = resource.state;
+                VkImageLayout newLayout = isImage ? access->layout : VK_IMAGE_LAYOUT_UNDEFINED;
+                AddBarrier(preBatch, resource, isImage, state.writeStages | state.readStages, state.writeAccess,
+                           VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, state.layout, newLayout,
+                           m_GraphicsFamily, m_ComputeFamily);
+                AddBarrier(batch, resource, isImage, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                           access->stages, access->access, state.layout, newLayout,
+                           m_GraphicsFamily, m_ComputeFamily);
+
+                state = ResourceState{};
+                state.layout = newLayout;
+                state.queue = ComputeQueue;
+                state.hasContents = true;
+            }
+        }
+        FlushBarriers(pre, preBatch);
+
+        for (u32 i = 0; i < m_Passes.size(); i++) {
+            if (!m_Passes[i].culled && m_Passes[i].queue == ComputeQueue) {
+                RecordPass(i, compute, batch);
+            }
+        }
+
+        BarrierBatch tailBatch;
+        RecordHandoffs(compute, tailBatch, endBatch, tailWaitStages);
+        FlushBarriers(tail, tailBatch);
+    }
+
+    for (u32 i = 0; i < m_Passes.size(); i++) {
+        const Pass& pass = m_Passes[i];
+        if (pass.culled || pass.queue != GraphicsQueue) continue;
+
+        // Graphics passes run on the frame's queue, the GPU profiler measures them with it
+        VkCommandBuffer cmd = pass.tail ? tail : graphics;
+        u32 scope = m_Renderer->GetGpuProfiler().BeginScope(cmd, pass.name.c_str());
+        RecordPass(i, cmd, batch);
+        m_Renderer->GetGpuProfiler().EndScope(cmd, scope);
+    }
+
+    VkCommandBuffer last = async ? tail : graphics;
+    RecordFinalBarriers(last, endBatch);
+
+    // Framebuffers of views that were not used this time may refer to destroyed images
+    RetiredResources retired;
+    retired.frame = m_Renderer->GetFrameNumber();
+    for (auto it = m_Framebuffers.begin(); it != m_Framebuffers.end();) {
+        if (!it->used) {
+            retired.framebuffers.push_back(it->framebuffer);
+            it = m_Framebuffers.erase(it);
+        } else {
+            it->used = false;
+            ++it;
+        }
+    }
+    if (!retired.framebuffers.empty()) {
+        m_Retired.push_back(std::move(retired));
+    }
+
+    for (VkCommandBuffer cmd : {pre, graphics, compute, tail}) {
+        if (cmd != VK_NULL_HANDLE && vkEndCommandBuffer(cmd) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to record render graph command buffer");
+            Reset();
+            return;
+        }
+    }
+
+    if (async) {
+        Submit(pre, graphics, compute, tail, tailWaitStages);
+    } else {
+        m_Renderer->SubmitWithFrame(graphics);
+    }
+
+    Reset();
+}
+
+void RenderGraph::CullPasses() {
+    std::vector<bool> imageLive(m_Images.size());
+    std::vector<bool> bufferLive(m_Buffers.size());
+    for (u32 i = 0; i < m_Images.size(); i++) imageLive[i] = m_Images[i].imported;
+    for (u32 i = 0; i < m_Buffers.size(); i++) bufferLive[i] = m_Buffers[i].imported;
+
+    // Walking backwards, a pass is needed if it writes something a needed pass or the caller reads
+    for (u32 i = static_cast<u32>(m_Passes.size()); i-- > 0;) {
+        Pass& pass = m_Passes[i];
+
+        bool needed = pass.sideEffect;
+        for (const auto& access : pass.images) {
+            needed |= access.write && imageLive[access.resource];
+        }
+        for (const auto& access : pass.buffers) {
+            needed |= access.write && bufferLive[access.resource];
+        }
+
+        pass.culled = !needed;
+        if (!needed) {
+            m_Stats.culledPasses++;
+            continue;
+        }
+
+        // A clear overwrites everything written before, other writes may be partial
+        for (const auto& attachment : pass.colors) {
+            if (attachment.clear) imageLive[attachment.image] = false;
+        }
+        if (pass.depth.image != ~0u && pass.depth.clear) {
+            imageLive[pass.depth.image] = false;
+        }
+
+        for (const auto& access : pass.images) {
+            if (access.read) imageLive[access.resource] = true;
+        }
+        for (const auto& access : pass.buffers) {
+            if (access.read) bufferLive[access.resource] = true;
+        }
+    }
+}
+
+void RenderGraph::AssignQueues() {
+    enum : u8 { TouchedByGraphics = 1, TouchedByCompute = 2 };
+    std::vector<u8> imageTouched(m_Images.size(), 0);
+    std::vector<u8> bufferTouched(m_Buffers.size(), 0);
+
+    auto touches = [&](const Pass& pass, u8 mask) {
+        bool result = false;
+        for (const auto& access : pass.images) result |= (imageTouched[access.resource] & mask) != 0;
+        for (const auto& access : pass.buffers) result |= (bufferTouched[access.resource] & mask) != 0;
+        return result;
+    };
+    auto mark = [&](const Pass& pass, u8 mask) {
+        for (const auto& access : pass.images) imageTouched[access.resource] |= mask;
+        for (const auto& access : pass.buffers) bufferTouched[access.resource] |= mask;
+    };
+
+    // Compute work independent of earlier graphics work overlaps it, graphics work
+    // from the first pass consuming compute results on waits for the compute queue
+    bool tail = false;
+    for (auto& pass : m_Passes) {
+        if (pass.culled) continue;
+
+        if (pass.type == RenderGraphPassType::AsyncCompute && m_AsyncCompute && !touches(pass, TouchedByGraphics)) {
+            pass.queue = ComputeQueue;
+            mark(pass, TouchedByCompute);
+            m_Stats.asyncPasses++;
+            continue;
+        }
+
+        pass.queue = GraphicsQueue;
+        tail |= touches(pass, TouchedByCompute);
+        pass.tail = tail;
+        mark(pass, TouchedByGraphics);
+    }
+}
+
+void RenderGraph::ComputeLifetimes() {
+    for (u32 i = 0; i < m_Passes.size(); i++) {
+        const Pass& pass = m_Passes[i];
+        if (pass.culled) continue;
+
+        for (auto* accesses : {&pass.images, &pass.buffers}) {
+            auto& resources = accesses == &pass.images ? m_Images : m_Buffers;
+            for (const auto& access : *accesses) {
+                Resource& resource = resources[access.resource];
+                resource.firstPass = std::min(resource.firstPass, i);
+                resource.lastPass = std::max(resource.lastPass, i);
+                resource.stages |= access.stages;
+                if (access.write) {
+                    resource.writeAccess |= access.access & WriteAccessMask;
+                }
+                (pass.queue == ComputeQueue ? resource.compute : resource.graphics) = true;
+            }
+        }
+    }
+}
+
+bool RenderGraph::RealizeTransients() {
+    // Everything the physical resources and their placement depend on
+    std::vector<u64> signature;
+    for (const auto& image : m_Images) {
+        if (image.imported || image.firstPass == ~0u) continue;
+        signature.insert(signature.end(), {0, image.desc.width, image.desc.height, static_cast<u64>(image.desc.format),
+                                           image.desc.mipLevels, static_cast<u64>(image.desc.samples), image.usage,
+                                           image.graphics, image.compute, image.firstPass, image.lastPass});
+    }
+    for (const auto& buffer : m_Buffers) {
+        if (buffer.imported || buffer.firstPass == ~0u) continue;
+        signature.insert(signature.end(), {1, buffer.size, buffer.usage, buffer.graphics, buffer.compute,
+                                           buffer.firstPass, buffer.lastPass});
+    }
+
+    auto assign = [&]() {
+        u32 imageIndex = 0;
+        for (auto& image : m_Images) {
+            if (image.imported || image.firstPass == ~0u) continue;
+            image.physical = imageIndex++;
+            image.image = m_PhysicalImages[image.physical].image;
+            image.view = m_PhysicalImages[image.physical].view;
+        }
+        u32 bufferIndex = 0;
+        for (auto& buffer : m_Buffers) {
+            if (buffer.imported || buffer.firstPass == ~0u) continue;
+            buffer.physical = bufferIndex++;
+            buffer.buffer = m_PhysicalBuffers[buffer.physical].buffer;
+        }
+    };
+
+    if (signature == m_Signature) {
+        assign();
+        return true;
+    }
+
+    // Frames in flight may still use the old resources, and framebuffers refer to their views
+    RetiredResources retired;
+    retired.frame = m_Renderer->GetFrameNumber();
+    retired.images = std::move(m_PhysicalImages);
+    retired.buffers = std::move(m_PhysicalBuffers);
+    retired.blocks = std::move(m_Blocks);
+    for (auto& framebuffer : m_Framebuffers) {
+        retired.framebuffers.push_back(framebuffer.framebuffer);
+    }
+    m_Retired.push_back(std::move(retired));
+    m_PhysicalImages.clear();
+    m_PhysicalBuffers.clear();
+    m_Blocks.clear();
+    m_Framebuffers.clear();
+    m_Signature.clear();
+    m_Stats.transientMemory = 0;
+    m_Stats.requestedMemory = 0;
+
+    VulkanContext& context = m_Renderer->GetContext();
+    VkDevice device = context.GetDevice();
+    u32 families[] = {m_GraphicsFamily, m_ComputeFamily};
+
+    std::vector<VkMemoryRequirements> imageRequirements;
+    std::vector<std::pair<u32, u32>> imageLifetimes;
+    std::vector<bool> imageAliasable;
+    for (const auto& image : m_Images) {
+        if (image.imported || image.firstPass == ~0u) continue;
+
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent = {image.desc.width, image.desc.height, 1};
+        imageInfo.mipLevels = image.desc.mipLevels;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = image.desc.format;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = image.usage;
+        imageInfo.samples = image.desc.samples;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Shared between queues without ownership transfers
+        if (image.graphics && image.compute) {
+            imageInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            imageInfo.queueFamilyIndexCount = 2;
+            imageInfo.pQueueFamilyIndices = families;
+        }
+
+        PhysicalImage physical;
+        if (vkCreateImage(device, &imageInfo, nullptr, &physical.image) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create render graph image '{}'", image.name);
+            return false;
+        }
+        m_PhysicalImages.push_back(physical);
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device, physical.image, &requirements);
+        imageRequirements.push_back(requirements);
+        imageLifetimes.push_back({image.firstPass, image.lastPass});
+        imageAliasable.push_back(!image.compute);
+        m_Stats.requestedMemory += requirements.size;
+    }
+
+    std::vector<VkMemoryRequirements> bufferRequirements;
+    std::vector<std::pair<u32, u32>> bufferLifetimes;
+    std::vector<bool> bufferAliasable;
+    for (const auto& buffer : m_Buffers) {
+        if (buffer.imported || buffer.firstPass == ~0u) continue;
+
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = buffer.size;
+        bufferInfo.usage = buffer.usage;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        if (buffer.graphics && buffer.compute) {
+            bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            bufferInfo.queueFamilyIndexCount = 2;
+            bufferInfo.pQueueFamilyIndices = families;
+        }
+
+        PhysicalBuffer physical;
+        if (vkCreateBuffer(device, &bufferInfo, nullptr, &physical.buffer) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create render graph buffer '{}'", buffer.name);
+            return false;
+        }
+        m_PhysicalBuffers.push_back(physical);
+
+        VkMemoryRequirements requirements;
+        vkGetBufferMemoryRequirements(device, physical.buffer, &requirements);
+        bufferRequirements.push_back(requirements);
+        bufferLifetimes.push_back({buffer.firstPass, buffer.lastPass});
+        bufferAliasable.push_back(!buffer.compute);
+        m_Stats.requestedMemory += requirements.size;
+    }
+
+    // Images and buffers get separate blocks, which keeps them apart by bufferImageGranularity
+    std::vector<std::pair<u32, VkDeviceSize>> imagePlacements;
+    std::vector<std::pair<u32, VkDeviceSize>> bufferPlacements;
+    std::vector<AliasBlock> imageBlocks = PlaceResources(imageRequirements, imageLifetimes, imageAliasable, imagePlacements);
+    std::vector<AliasBlock> bufferBlocks = PlaceResources(bufferRequirements, bufferLifetimes, bufferAliasable, bufferPlacements);
+
+    auto allocateBlocks = [&](const std::vector<AliasBlock>& blocks) {
+        for (const auto& block : blocks) {
+            VkMemoryRequirements requirements{};
+            requirements.size = block.size;
+            requirements.alignment = block.alignment;
+            requirements.memoryTypeBits = block.memoryTypeBits;
+
+            Allocation allocation;
+            if (!context.GetAllocator().AllocateMemory(requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, allocation)) {
+                return false;
+            }
+            m_Blocks.push_back(allocation);
+            m_Stats.transientMemory += block.size;
+        }
+        return true;
+    };
+
+    if (!allocateBlocks(imageBlocks)) return false;
+    u32 bufferBlockBase = static_cast<u32>(m_Blocks.size());
+    if (!allocateBlocks(bufferBlocks)) return false;
+
+    u32 imageIndex = 0;
+    for (const auto& image : m_Images) {
+        if (image.imported || image.firstPass == ~0u) continue;
+
+        PhysicalImage& physical = m_PhysicalImages[imageIndex];
+        auto [block, offset] = imagePlacements[imageIndex];
+        physical.range = {block, offset, imageRequirements[imageIndex].size};
+        imageIndex++;
+
+        if (!context.GetAllocator().BindImage(m_Blocks[block].handle, physical.image, offset)) {
+            TVK_LOG_ERROR("Failed to bind memory of render graph image '{}'", image.name);
+            return false;
+        }
+
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = physical.image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = image.desc.format;
+        viewInfo.subresourceRange.aspectMask = HasDepth(image.desc.format) ? VK_IMAGE_ASPECT_DEPTH_BIT
+                                                                           : GetAspectMask(image.desc.format);
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = image.desc.mipLevels;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(device, &viewInfo, nullptr, &physical.view) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create view of render graph image '{}'", image.name);
+            return false;
+        }
+    }
+
+    u32 bufferIndex = 0;
+    for (const auto& buffer : m_Buffers) {
+        if (buffer.imported || buffer.firstPass == ~0u) continue;
+
+        PhysicalBuffer& physical = m_PhysicalBuffers[bufferIndex];
+        auto [block, offset] = bufferPlacements[bufferIndex];
+        physical.range = {bufferBlockBase + block, offset, bufferRequirements[bufferIndex].size};
+        bufferIndex++;
+
+        if (!context.GetAllocator().BindBuffer(m_Blocks[physical.range.block].handle, physical.buffer, offset)) {
+            TVK_LOG_ERROR("Failed to bind memory of render graph buffer '{}'", buffer.name);
+            return false;
+        }
+    }
+
+    m_Signature = std::move(signature);
+    assign();
+
+    TVK_LOG_INFO("Render graph transients: {} images, {} buffers in {} KB ({} KB without aliasing)",
+                 m_PhysicalImages.size(), m_PhysicalBuffers.size(),
+                 m_Stats.transientMemory / 1024, m_Stats.requestedMemory / 1024);
+    return true;
+}
+
+void RenderGraph::DestroyPhysical(RetiredResources& retired) {
+    VulkanContext& context = m_Renderer->GetContext();
+    VkDevice device = context.GetDevice();
+
+    for (VkFramebuffer framebuffer : retired.framebuffers) {
+        vkDestroyFramebuffer(device, framebuffer, nullptr);
+    }
+    for (auto& image : retired.images) {
+        if (image.view != VK_NULL_HANDLE) vkDestroyImageView(device, image.view, nullptr);
+        if (image.image != VK_NULL_HANDLE) vkDestroyImage(device, image.image, nullptr);
+    }
+    for (auto& buffer : retired.buffers) {
+        if (buffer.buffer != VK_NULL_HANDLE) vkDestroyBuffer(device, buffer.buffer, nullptr);
+    }
+    for (auto& block : retired.blocks) {
+        context.GetAllocator().FreeMemory(block);
+    }
+
+    retired.framebuffers.clear();
+    retired.images.clear();
+    retired.buffers.clear();
+    retired.blocks.clear();
+}
+
+void RenderGraph::CollectRetired() {
+    u64 completed = m_Renderer->GetCompletedFrame();
+    for (auto it = m_Retired.begin(); it != m_Retired.end();) {
+        if (it->frame <= completed) {
+            DestroyPhysical(*it);
+            it = m_Retired.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void RenderGraph::InitStates() {
+    // Unknown earlier work may have written imported resources
+    for (auto* resources : {&m_Images, &m_Buffers}) {
+        for (auto& resource : *resources) {
+            if (!resource.imported) continue;
+            resource.state.writeStages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            resource.state.writeAccess = VK_ACCESS_MEMORY_WRITE_BIT;
+            resource.state.hasContents = true;
+        }
+    }
+
+    // A transient's first use waits for every use of its bytes, by earlier passes
+    // aliasing it and by the previous frame. Compute resources are never aliased, but
+    // the previous frame may have used them on either queue
+    for (auto* resources : {&m_Images, &m_Buffers}) {
+        bool isImage = resources == &m_Images;
+        for (auto& resource : *resources) {
+            if (resource.imported || resource.physical == ~0u) continue;
+
+            ResourceState& state = resource.state;
+            state = ResourceState{};
+            if (resource.compute) {
+                state.writeStages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+                state.writeAccess = VK_ACCESS_MEMORY_WRITE_BIT;
+                continue;
+            }
+
+            const MemoryRange& range = isImage ? m_PhysicalImages[resource.physical].range
+                                               : m_PhysicalBuffers[resource.physical].range;
+            for (const auto& other : *resources) {
+                if (other.imported || other.physical == ~0u) continue;
+
+                const MemoryRange& otherRange = isImage ? m_PhysicalImages[other.physical].range
+                                                        : m_PhysicalBuffers[other.physical].range;
+                if (otherRange.block == range.block && otherRange.offset < range.offset + range.size &&
+                    range.offset < otherRange.offset + otherRange.size) {
+                    state.writeStages |= other.stages;
+                    state.writeAccess |= other.writeAccess;
+                }
+            }
+        }
+    }
+}
+
+void RenderGraph::RecordPass(u32 passIndex, VkCommandBuffer cmd, BarrierBatch& batch) {
+    Pass& pass = m_Passes[passIndex];
+
+    for (const auto& access : pass.images) {
+        Transition(m_Images[access.resource], true, access, batch);
+    }
+    for (const auto& access : pass.buffers) {
+        Transition(m_Buffers[access.resource], false, access, batch);
+    }
+    FlushBarriers(cmd, batch);
+
+    RenderGraphContext context;
+    context.m_Graph = this;
+    context.m_CommandBuffer = cmd;
+
+    if (pass.type == RenderGraphPassType::Raster && (!pass.colors.empty() || pass.depth.image != ~0u)) {
+        u32 first = pass.colors.empty() ? pass.depth.image : pass.colors[0].image;
+        VkExtent2D extent = {m_Images[first].desc.width, m_Images[first].desc.height};
+
+        std::vector<VkImageView> views;
+        std::vector<VkClearValue> clearValues;
+        for (const auto& attachment : pass.colors) {
+            views.push_back(m_Images[attachment.image].view);
+            clearValues.push_back(attachment.clearValue);
+        }
+        if (pass.depth.image != ~0u) {
+            views.push_back(m_Images[pass.depth.image].view);
+            clearValues.push_back(pass.depth.clearValue);
+        }
+
+        VkRenderPass renderPass = GetPassRenderPass(passIndex);
+        VkFramebuffer framebuffer = GetFramebuffer(renderPass, views, extent);
+        if (renderPass == VK_NULL_HANDLE || framebuffer == VK_NULL_HANDLE) return;
+
+        VkRenderPassBeginInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassInfo.renderPass = renderPass;
+        renderPassInfo.framebuffer = framebuffer;
+        renderPassInfo.renderArea.offset = {0, 0};
+        renderPassInfo.renderArea.extent = extent;
+        renderPassInfo.clearValueCount = static_cast<u32>(clearValues.size());
+        renderPassInfo.pClearValues = clearValues.data();
+        vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+        VkViewport viewport{};
+        viewport.x = 0.0f;
+        viewport.y = 0.0f;
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+        VkRect2D scissor{};
+        scissor.offset = {0, 0};
+        scissor.extent = extent;
+        vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+        context.m_RenderPass = renderPass;
+        context.m_Extent = extent;
+        if (pass.execute) {
+            pass.execute(context);
+        }
+
+        vkCmdEndRenderPass(cmd);
+    } else if (pass.execute) {
+        pass.execute(context);
+    }
+
+    for (const auto& access : pass.images) {
+        if (access.write) m_Images[access.resource].state.hasContents = true;
+    }
+    for (const auto& access : pass.buffers) {
+        if (access.write) m_Buffers[access.resource].state.hasContents = true;
+    }
+}
+
+void RenderGraph::Transition(Resource& resource, bool isImage, const Access& access, BarrierBatch& batch) {
+    ResourceState& state = resource.state;
+    bool layoutChange = isImage && state.layout != access.layout;
+
+    // Writes and layout transitions wait for every earlier use, reads only for the last write
+    if (access.write || layoutChange) {
+        VkPipelineStageFlags srcStages = state.writeStages | state.readStages;
+        if (srcStages != 0 || layoutChange) {
+            AddBarrier(batch, resource, isImage, srcStages != 0 ? srcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                       state.writeAccess, access.stages, access.access, state.layout, access.layout,
+                       VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED);
+        }
+
+        state.writeStages = access.stages;
+        state.writeAccess = access.write ? (access.access & WriteAccessMask) : 0;
+        state.readStages = access.write ? 0 : access.stages;
+        state.readAccess = access.write ? 0 : access.access;
+        if (isImage) {
+            state.layout = access.layout;
+        }
+        return;
+    }
+
+    bool covered = (access.stages & ~state.readStages) == 0 && (access.access & ~state.readAccess) == 0;
+    if (state.writeStages != 0 && !covered) {
+        AddBarrier(batch, resource, isImage, state.writeStages, state.writeAccess, access.stages, access.access,
+                   state.layout, state.layout, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED);
+    }
+    state.readStages |= access.stages;
+    state.readAccess |= access.access;
+}
+
+void RenderGraph::RecordHandoffs(VkCommandBuffer compute, BarrierBatch& tailBatch, BarrierBatch& endBatch,
+                                 VkPipelineStageFlags& tailWaitStages) {
+    BarrierBatch releaseBatch;
+
+    for (auto* resources : {&m_Images, &m_Buffers}) {
+        bool isImage = resources == &m_Images;
+        for (auto& resource : *resources) {
+            if (!resource.compute) continue;
+            u32 index = static_cast<u32>(&resource - resources->data());
+
+            // Graphics passes touching compute resources all come after the compute passes
+            const Access* next = nullptr;
+            for (const auto& pass : m_Passes) {
+                if (pass.culled || pass.queue != GraphicsQueue) continue;
+                const auto& accesses = isImage ? pass.images : pass.buffers;
+                auto it = std::find_if(accesses.begin(), accesses.end(),
+                                       [&](const Access& a) { return a.resource == index; });
+                if (it != accesses.end()) {
+                    next = &*it;
+                    break;
+                }
+            }
+
+            ResourceState& state = resource.state;
+            bool exclusive = resource.imported;
+            if (!next && !exclusive) continue;
+
+            if (!next) {
+                // Returned to the graphics queue in its final layout at the end of the graph
+                VkImageLayout finalLayout = isImage ? resource.finalLayout : VK_IMAGE_LAYOUT_UNDEFINED;
+                AddBarrier(releaseBatch, resource, isImage, state.writeStages | state.readStages | VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                           state.writeAccess, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, state.layout, finalLayout,
+                           m_ComputeFamily, m_GraphicsFamily);
+                AddBarrier(endBatch, resource, isImage, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                           VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT,
+                           state.layout, finalLayout, m_ComputeFamily, m_GraphicsFamily);
+
+                state = ResourceState{};
+                state.layout = finalLayout;
+                state.hasContents = true;
+                continue;
+            }
+
+            // The semaphore wait makes compute writes visible, what remains is the layout and ownership
+            VkImageLayout newLayout = isImage ? next->layout : VK_IMAGE_LAYOUT_UNDEFINED;
+            if (exclusive) {
+                AddBarrier(releaseBatch, resource, isImage, state.writeStages | state.readStages | VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                           state.writeAccess, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, state.layout, newLayout,
+                           m_ComputeFamily, m_GraphicsFamily);
+                AddBarrier(tailBatch, resource, isImage, next->stages, 0, next->stages, next->access,
+                           state.layout, newLayout, m_ComputeFamily, m_GraphicsFamily);
+            } else if (newLayout != state.layout) {
+                AddBarrier(tailBatch, resource, isImage, next->stages, 0, next->stages, next->access,
+                           state.layout, newLayout, VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED);
+            }
+            tailWaitStages |= next->stages;
+
+            // Later tail passes at other stages chain a barrier from the stages the semaphore waited on,
+            // the signal already made the compute writes available
+            bool hasContents = state.hasContents;
+            state = ResourceState{};
+            state.writeStages = next->stages;
+            state.writeAccess = next->access & WriteAccessMask;
+            state.readStages = next->stages;
+            state.readAccess = next->access;
+            state.layout = newLayout;
+            state.hasContents = hasContents;
+        }
+    }
+
+    FlushBarriers(compute, releaseBatch);
+}
+
+void RenderGraph::RecordFinalBarriers(VkCommandBuffer cmd, BarrierBatch& batch) {
+    // Imported resources end in their final layout, visible to whatever runs next
+    for (auto* resources : {&m_Images, &m_Buffers}) {
+        bool isImage = resources == &m_Images;
+        for (auto& resource : *resources) {
+            if (!resource.imported || resource.firstPass == ~0u) continue;
+
+            ResourceState& state = resource.state;
+            VkImageLayout finalLayout = isImage ? resource.finalLayout : VK_IMAGE_LAYOUT_UNDEFINED;
+            VkPipelineStageFlags srcStages = state.writeStages | state.readStages;
+            if (srcStages == 0 && finalLayout == state.layout) continue;
+
+            AddBarrier(batch, resource, isImage, srcStages != 0 ? srcStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                       state.writeAccess, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                       VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT, state.layout, finalLayout,
+                       VK_QUEUE_FAMILY_IGNORED, VK_QUEUE_FAMILY_IGNORED);
+            state.layout = finalLayout;
+        }
+    }
+    FlushBarriers(cmd, batch);
+}
+
+void RenderGraph::AddBarrier(BarrierBatch& batch, Resource& resource, bool isImage, VkPipelineStageFlags srcStages,
+                             VkAccessFlags srcAccess, VkPipelineStageFlags dstStages, VkAccessFlags dstAccess,
+                             VkImageLayout oldLayout, VkImageLayout newLayout, u32 srcFamily, u32 dstFamily) {
+    // Transfers between identical families are plain barriers
+    if (srcFamily == dstFamily) {
+        srcFamily = VK_QUEUE_FAMILY_IGNORED;
+        dstFamily = VK_QUEUE_FAMILY_IGNORED;
+    }
+
+    if (isImage) {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.oldLayout = oldLayout;
+        barrier.newLayout = newLayout;
+        barrier.srcQueueFamilyIndex = srcFamily;
+        barrier.dstQueueFamilyIndex = dstFamily;
+        barrier.image = resource.image;
+        barrier.subresourceRange.aspectMask = GetAspectMask(resource.desc.format);
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+        batch.images.push_back(barrier);
+    } else {
+        VkBufferMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = srcAccess;
+        barrier.dstAccessMask = dstAccess;
+        barrier.srcQueueFamilyIndex = srcFamily;
+        barrier.dstQueueFamilyIndex = dstFamily;
+        barrier.buffer = resource.buffer;
+        barrier.offset = 0;
+        barrier.size = VK_WHOLE_SIZE;
+        batch.buffers.push_back(barrier);
+    }
+
+    batch.srcStages |= srcStages;
+    batch.dstStages |= dstStages;
+    m_Stats.barriers++;
+}
+
+void RenderGraph::FlushBarriers(VkCommandBuffer cmd, BarrierBatch& batch) {
+    if (batch.images.empty() && batch.buffers.empty()) return;
+
+    vkCmdPipelineBarrier(cmd, batch.srcStages, batch.dstStages, 0, 0, nullptr,
+                         static_cast<u32>(batch.buffers.size()), batch.buffers.data(),
+                         static_cast<u32>(batch.images.size()), batch.images.data());
+
+    batch.srcStages = 0;
+    batch.dstStages = 0;
+    batch.images.clear();
+    batch.buffers.clear();
+}
+
+VkRenderPass RenderGraph::GetPassRenderPass(u32 passIndex) {
+    const Pass& pass = m_Passes[passIndex];
+
+    // Attachments stay in the layout the barriers put them in
+    auto describe = [&](const Attachment& attachment, VkImageLayout layout) {
+        const Resource& image = m_Images[attachment.image];
+        bool keep = image.imported || image.lastPass > passIndex || attachment.readOnly;
+
+        VkAttachmentDescription description{};
+        description.format = image.desc.format;
+        description.samples = image.desc.samples;
+        description.loadOp = attachment.clear ? VK_ATTACHMENT_LOAD_OP_CLEAR
+                           : image.state.hasContents ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        description.storeOp = keep ? VK_ATTACHMENT_STORE_OP_STORE : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        description.stencilLoadOp = HasStencil(image.desc.format) ? description.loadOp : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        description.stencilStoreOp = HasStencil(image.desc.format) ? description.storeOp : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        description.initialLayout = layout;
+        description.finalLayout = layout;
+        return description;
+    };
+
+    std::vector<VkAttachmentDescription> attachments;
+    for (const auto& attachment : pass.colors) {
+        attachments.push_back(describe(attachment, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL));
+    }
+    bool hasDepth = pass.depth.image != ~0u;
+    if (hasDepth) {
+        attachments.push_back(describe(pass.depth, pass.depth.readOnly ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL
+                                                                       : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL));
+    }
+
+    return FindRenderPass(attachments, hasDepth);
+}
+
+VkRenderPass RenderGraph::GetRenderPass(const std::vector<VkFormat>& colorFormats, VkFormat depthFormat,
+                                        VkSampleCountFlagBits samples) {
+    // Load and store operations and layouts do not affect render pass compatibility
+    std::vector<VkAttachmentDescription> attachments;
+    for (VkFormat format : colorFormats) {
+        VkAttachmentDescription description{};
+        description.format = format;
+        description.samples = samples;
+        description.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        description.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        description.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        description.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        description.initialLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        description.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        attachments.push_back(description);
+    }
+
+    bool hasDepth = depthFormat != VK_FORMAT_UNDEFINED;
+    if (hasDepth) {
+        VkAttachmentDescription description{};
+        description.format = depthFormat;
+        description.samples = samples;
+        description.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        description.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        description.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        description.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        description.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        description.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        attachments.push_back(description);
+    }
+
+    return FindRenderPass(attachments, hasDepth);
+}
+
+VkRenderPass RenderGraph::FindRenderPass(const std::vector<VkAttachmentDescription>& attachments, bool hasDepth) {
+    std::vector<u32> key = {hasDepth ? 1u : 0u};
+    for (const auto& description : attachments) {
+        key.insert(key.end(), {static_cast<u32>(description.format), static_cast<u32>(description.samples),
+                               static_cast<u32>(description.loadOp), static_cast<u32>(description.storeOp),
+                               static_cast<u32>(description.stencilLoadOp), static_cast<u32>(description.stencilStoreOp),
+                               static_cast<u32>(description.initialLayout)});
+    }
+
+    auto it = m_RenderPasses.find(key);
+    if (it != m_RenderPasses.end()) {
+        return it->second;
+    }
+
+    u32 colorCount = static_cast<u32>(attachments.size()) - (hasDepth ? 1 : 0);
+    std::vector<VkAttachmentReference> colorRefs;
+    for (u32 i = 0; i < colorCount; i++) {
+        colorRefs.push_back({i, attachments[i].initialLayout});
+    }
+    VkAttachmentReference depthRef{colorCount, hasDepth ? attachments.back().initialLayout : VK_IMAGE_LAYOUT_UNDEFINED};
+
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = colorCount;
+    subpass.pColorAttachments = colorRefs.data();
+    subpass.pDepthStencilAttachment = hasDepth ? &depthRef : nullptr;
+
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = static_cast<u32>(attachments.size());
+    renderPassInfo.pAttachments = attachments.data();
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+
+    VkRenderPass renderPass = VK_NULL_HANDLE;
+    if (vkCreateRenderPass(m_Renderer->GetContext().GetDevice(), &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create render graph render pass");
+        return VK_NULL_HANDLE;
+    }
+
+    m_RenderPasses[key] = renderPass;
+    return renderPass;
+}
+
+VkFramebuffer RenderGraph::GetFramebuffer(VkRenderPass renderPass, const std::vector<VkImageView>& views,
+                                          VkExtent2D extent) {
+    for (auto& framebuffer : m_Framebuffers) {
+        if (framebuffer.renderPass == renderPass && framebuffer.views == views &&
+            framebuffer.extent.width == extent.width && framebuffer.extent.height == extent.height) {
+            framebuffer.used = true;
+            return framebuffer.framebuffer;
+        }
+    }
+
+    VkFramebufferCreateInfo framebufferInfo{};
+    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    framebufferInfo.renderPass = renderPass;
+    framebufferInfo.attachmentCount = static_cast<u32>(views.size());
+    framebufferInfo.pAttachments = views.data();
+    framebufferInfo.width = extent.width;
+    framebufferInfo.height = extent.height;
+    framebufferInfo.layers = 1;
+
+    Framebuffer framebuffer;
+    framebuffer.renderPass = renderPass;
+    framebuffer.views = views;
+    framebuffer.extent = extent;
+    framebuffer.used = true;
+    if (vkCreateFramebuffer(m_Renderer->GetContext().GetDevice(), &framebufferInfo, nullptr,
+                            &framebuffer.framebuffer) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create render graph framebuffer");
+        return VK_NULL_HANDLE;
+    }
+
+    m_Framebuffers.push_back(std::move(framebuffer));
+    return m_Framebuffers.back().framebuffer;
+}
+
+VkCommandBuffer RenderGraph::BeginCommands(u32 queue) {
+    VkDevice device = m_Renderer->GetContext().GetDevice();
+
+    // BeginFrame() waited for this slot's fence, which also covers the compute work
+    // since the last graphics submission of the slot waited for it
+    FrameCommands& frame = m_FrameCommands[m_Renderer->GetCurrentFrameIndex()];
+    if (frame.frameNumber != m_Renderer->GetFrameNumber()) {
+        vkResetCommandPool(device, frame.graphicsPool, 0);
+        frame.graphicsUsed = 0;
+        if (frame.computePool != VK_NULL_HANDLE) {
+            vkResetCommandPool(device, frame.computePool, 0);
+            frame.computeUsed = 0;
+        }
+        frame.frameNumber = m_Renderer->GetFrameNumber();
+    }
+
+    bool isCompute = queue == ComputeQueue;
+    auto& commandBuffers = isCompute ? frame.compute : frame.graphics;
+    u32& used = isCompute ? frame.computeUsed : frame.graphicsUsed;
+
+    if (used == commandBuffers.size()) {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = isCompute ? frame.computePool : frame.graphicsPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer cmd = VK_NULL_HANDLE;
+        if (vkAllocateCommandBuffers(device, &allocInfo, &cmd) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to allocate render graph command buffer");
+            return VK_NULL_HANDLE;
+        }
+        commandBuffers.push_back(cmd);
+    }
+
+    VkCommandBuffer cmd = commandBuffers[used++];
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (vkBeginCommandBuffer(cmd, &beginInfo) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to begin render graph command buffer");
+        return VK_NULL_HANDLE;
+    }
+    return cmd;
+}
+
+void RenderGraph::Submit(VkCommandBuffer pre, VkCommandBuffer graphics, VkCommandBuffer compute,
+                         VkCommandBuffer tail, VkPipelineStageFlags tailWaitStages) {
+    VulkanContext& context = m_Renderer->GetContext();
+
+    // Uploads recorded so far are submitted first, later ones run with the frame
+    m_Renderer->SubmitUploads();
+
+    u64 preValue = ++m_TimelineValue;
+    u64 computeValue = ++m_TimelineValue;
+
+    // Compute starts once the graphics queue is past earlier frames and ownership releases,
+    // the graphics passes not depending on it overlap it
+    VkTimelineSemaphoreSubmitInfo preTimeline{};
+    preTimeline.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    preTimeline.signalSemaphoreValueCount = 1;
+    preTimeline.pSignalSemaphoreValues = &preValue;
+
+    std::array<VkSubmitInfo, 2> graphicsInfos{};
+    graphicsInfos[0].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    graphicsInfos[0].pNext = &preTimeline;
+    graphicsInfos[0].commandBufferCount = 1;
+    graphicsInfos[0].pCommandBuffers = &pre;
+    graphicsInfos[0].signalSemaphoreCount = 1;
+    graphicsInfos[0].pSignalSemaphores = &m_Timeline;
+    graphicsInfos[1].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    graphicsInfos[1].commandBufferCount = 1;
+    graphicsInfos[1].pCommandBuffers = &graphics;
+
+    if (vkQueueSubmit(context.GetGraphicsQueue(), static_cast<u32>(graphicsInfos.size()), graphicsInfos.data(),
+                      VK_NULL_HANDLE) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to submit render graph commands");
+        return;
+    }
+
+    VkTimelineSemaphoreSubmitInfo computeTimeline{};
+    computeTimeline.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    computeTimeline.waitSemaphoreValueCount = 1;
+    computeTimeline.pWaitSemaphoreValues = &preValue;
+    computeTimeline.signalSemaphoreValueCount = 1;
+    computeTimeline.pSignalSemaphoreValues = &computeValue;
+
+    VkPipelineStageFlags computeWaitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo computeInfo{};
+    computeInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    computeInfo.pNext = &computeTimeline;
+    computeInfo.waitSemaphoreCount = 1;
+    computeInfo.pWaitSemaphores = &m_Timeline;
+    computeInfo.pWaitDstStageMask = &computeWaitStage;
+    computeInfo.commandBufferCount = 1;
+    computeInfo.pCommandBuffers = &compute;
+    computeInfo.signalSemaphoreCount = 1;
+    computeInfo.pSignalSemaphores = &m_Timeline;
+
+    if (vkQueueSubmit(context.GetComputeQueue(), 1, &computeInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to submit render graph compute commands");
+        return;
+    }
+
+    // Stages before the first consumer of compute results run without waiting.
+    // The frame's fence is signaled after this wait, which keeps the compute
+    // command buffers of a slot alive until the slot is reused
+    if (tailWaitStages == 0) {
+        tailWaitStages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    }
+
+    VkTimelineSemaphoreSubmitInfo tailTimeline{};
+    tailTimeline.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    tailTimeline.waitSemaphoreValueCount = 1;
+    tailTimeline.pWaitSemaphoreValues = &computeValue;
+
+    VkSubmitInfo tailInfo{};
+    tailInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    tailInfo.pNext = &tailTimeline;
+    tailInfo.waitSemaphoreCount = 1;
+    tailInfo.pWaitSemaphores = &m_Timeline;
+    tailInfo.pWaitDstStageMask = &tailWaitStages;
+    tailInfo.commandBufferCount = 1;
+    tailInfo.pCommandBuffers = &tail;
+
+    if (vkQueueSubmit(context.GetGraphicsQueue(), 1, &tailInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to submit render graph commands");
+    }
+}
+
+void RenderGraph::Reset() {
+    m_Passes.clear();
+    m_Images.clear();
+    m_Buffers.clear();
+}
+
+} // namespace tvk
@@ -7,6 +7,7 @@
 #include "tinyvk/renderer/texture.h"
 #include "tinyvk/core/window.h"
 #include "tinyvk/core/log.h"
+#include "tinyvk/core/timer.h"
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
@@ -14,9 +15,24 @@
 #include <algorithm>
 #include <limits>
 #include <array>
+#include <thread>
 
 namespace tvk {
 
+// Presents of a hidden or occluded window may not complete, the pacing wait gives up after this
+static constexpr u64 s_PresentWaitTimeout = 100'000'000;
+
+// sleep_until overshoots by up to a scheduler quantum, the last millisecond is spent yielding
+static void SleepUntil(std::chrono::steady_clock::time_point deadline) {
+    auto coarse = deadline - std::chrono::milliseconds(1);
+    if (std::chrono::steady_clock::now() < coarse) {
+        std::this_thread::sleep_until(coarse);
+    }
+    while (std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
 Renderer::~Renderer() {
     Cleanup();
 }
@@ -24,17 +40,71 @@ Renderer::~Renderer() {
 bool Renderer::Init(Window* window, const RendererConfig& config) {
     m_Window = window;
     m_Config = config;
+    m_Config.maxFramesInFlight = std::max(1u, config.maxFramesInFlight);
     m_ClearColor = config.clearColor;
 
+    // Slots are allocated for the maximum, the rotation only uses the first m_FramesInFlight
+    m_FramesInFlight = config.framesInFlight > 0 ? std::min(config.framesInFlight, m_Config.maxFramesInFlight)
+                                                 : m_Config.maxFramesInFlight;
+    m_RequestedFramesInFlight = m_FramesInFlight;
+
     // Initialize Vulkan context
     ContextConfig contextConfig;
     contextConfig.enableValidation = config.enableValidation;
     
-    if (!m_Context.Init(window->GetNativeHandle(), contextConfig)) {
+    if (!m_Context.Init(window ? window->GetNativeHandle() : nullptr, contextConfig)) {
         TVK_LOG_ERROR("Failed to initialize Vulkan context");
         return false;
     }
 
+    if (!m_StagingRing.Init(&m_Context, config.stagingBufferSize)) {
+        TVK_LOG_ERROR("Failed to create staging ring");
+        return false;
+    }
+
+    if (!m_FrameAllocator.Init(&m_Context, config.frameMemorySize, m_Config.maxFramesInFlight)) {
+        return false;
+    }
+
+    if (!m_TransferQueue.Init(&m_Context, config.transferStagingSize)) {
+        TVK_LOG_WARN("Asynchronous transfers unavailable, uploads go through the frame");
+    }
+
+    bool asyncCompute = m_ComputeQueue.Init(&m_Context);
+    if (!asyncCompute) {
+        TVK_LOG_WARN("Asynchronous compute unavailable");
+    }
+
+    // Signaled by upload submissions, compute batches and transfer handles wait on it
+    if (asyncCompute || m_TransferQueue.IsAsync()) {
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &typeInfo;
+
+        if (vkCreateSemaphore(m_Context.GetDevice(), &semaphoreInfo, nullptr, &m_UploadTimeline) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to create upload timeline semaphore");
+            return false;
+        }
+        m_TransferQueue.SetGraphicsTimeline(m_UploadTimeline, [this]() { SubmitUploads(); });
+    }
+
+    if (config.gpuProfiling) {
+        m_GpuProfiler.Init(&m_Context, m_Config.maxFramesInFlight, config.gpuProfilerScopes, config.gpuPipelineStatistics);
+    }
+
+    if (!m_PipelineRegistry.Init(&m_Context)) {
+        TVK_LOG_ERROR("Failed to create pipeline registry");
+        return false;
+    }
+
+    // Warns and stays disabled on devices without descriptor indexing
+    m_BindlessHeap.Init(&m_Context, config.bindlessImages, config.bindlessSamplers, config.bindlessBuffers);
+
     // Create swapchain and related resources
     if (!CreateSwapchain()) {
         TVK_LOG_ERROR("Failed to create swapchain");
@@ -97,52 +167,118 @@ void Renderer::Cleanup() {
     }
     m_RenderFinishedSemaphores.clear();
 
-    // Cleanup per-frame fences
+    if (m_UploadTimeline != VK_NULL_HANDLE) {
+        m_TransferQueue.SetGraphicsTimeline(VK_NULL_HANDLE, nullptr);
+        vkDestroySemaphore(m_Context.GetDevice(), m_UploadTimeline, nullptr);
+        m_UploadTimeline = VK_NULL_HANDLE;
+    }
+    m_UploadTimelineValue = 0;
+    m_ComputeReleases.clear();
+
+    // Cleanup per-frame fences and recording pools
     for (auto& frame : m_Frames) {
         if (frame.inFlightFence != VK_NULL_HANDLE) {
             vkDestroyFence(m_Context.GetDevice(), frame.inFlightFence, nullptr);
         }
+        DestroyThreadCommands(frame.mainCommands);
+        for (auto& commands : frame.threadCommands) {
+            DestroyThreadCommands(commands);
+        }
     }
     m_Frames.clear();
 
+    m_BindlessHeap.Cleanup();
+    m_PipelineRegistry.Cleanup();
+    m_GpuProfiler.Cleanup();
+    m_ComputeQueue.Cleanup();
+    m_TransferQueue.Cleanup();
+    m_FrameAllocator.Cleanup();
+    m_StagingRing.Cleanup();
     m_Context.Cleanup();
 }
 
 bool Renderer::BeginFrame() {
+    TVK_PROFILE_SCOPE("Renderer::BeginFrame");
+
     auto& frame = m_Frames[m_CurrentFrame];
 
     // Wait for the current frame's fence to be signaled
-    vkWaitForFences(m_Context.GetDevice(), 1, &frame.inFlightFence, VK_TRUE, UINT64_MAX);
+    WaitForFrame(frame);
 
-    // Use next semaphore from the pool for acquiring
-    VkSemaphore acquireSemaphore = m_ImageAvailableSemaphores[m_CurrentSemaphoreIndex];
-
-    // Acquire next swapchain image
-    VkResult result = vkAcquireNextImageKHR(
-        m_Context.GetDevice(),
-        m_Swapchain,
-        UINT64_MAX,
-        acquireSemaphore,
-        VK_NULL_HANDLE,
-        &m_CurrentImageIndex
-    );
+    // The slice was last read by this slot's previous frame
+    m_FrameAllocator.Reset(m_CurrentFrame);
 
-    if (result == VK_ERROR_OUT_OF_DATE_KHR) {
-        RecreateSwapchain();
-        return false;
-    } else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
-        TVK_LOG_ERROR("Failed to acquire swapchain image");
-        return false;
+    if (IsHeadless()) {
+        // Each slot owns an offscreen image, the fence wait above made it free
+        m_CurrentImageIndex = m_CurrentFrame;
+    } else {
+        // Use next semaphore from the pool for acquiring
+        VkSemaphore acquireSemaphore = m_ImageAvailableSemaphores[m_CurrentSemaphoreIndex];
+
+        // Acquire next swapchain image
+        VkResult result = vkAcquireNextImageKHR(
+            m_Context.GetDevice(),
+            m_Swapchain,
+            UINT64_MAX,
+            acquireSemaphore,
+            VK_NULL_HANDLE,
+            &m_CurrentImageIndex
+        );
+
+        if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+            RecreateSwapchain();
+            return false;
+        } else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+            TVK_LOG_ERROR("Failed to acquire swapchain image");
+            return false;
+        }
+
+        // Store which semaphores we're using for this frame
+        frame.imageAvailableSemaphore = acquireSemaphore;
+        frame.renderFinishedSemaphore = m_RenderFinishedSemaphores[m_CurrentSemaphoreIndex];
+
+        // Move to next semaphore pair for next frame
+        m_CurrentSemaphoreIndex = (m_CurrentSemaphoreIndex + 1) % static_cast<u32>(m_ImageAvailableSemaphores.size());
     }
 
-    // Store which semaphores we're using for this frame
-    frame.imageAvailableSemaphore = acquireSemaphore;
-    frame.renderFinishedSemaphore = m_RenderFinishedSemaphores[m_CurrentSemaphoreIndex];
-    
-    // Move to next semaphore pair for next frame
-    m_CurrentSemaphoreIndex = (m_CurrentSemaphoreIndex + 1) % static_cast<u32>(m_ImageAvailableSemaphores.size());
+    // Hand finished asynchronous uploads over to the graphics queue
+    if (m_TransferQueue.HasCompletedWork()) {
+        // The acquires run once the upload submission signals its value
+        VkCommandBuffer uploadCmd = GetUploadCommandBuffer();
+        u64 value = m_TransferQueue.AcquireCompleted(uploadCmd, m_UploadTimelineValue + 1);
+        m_TransferWaitValue = std::max(m_TransferWaitValue, value);
+    }
+
+    // Deliver finished readbacks, buffers released by finished batches go to graphics as well
+    m_ComputeQueue.Update();
+    if (m_ComputeQueue.HasCompletedReleases()) {
+        u64 value = m_ComputeQueue.AcquireCompleted(GetUploadCommandBuffer());
+        m_ComputeWaitValue = std::max(m_ComputeWaitValue, value);
+    }
+
+    // Queries of the slot's previous frame are done, without host reset the upload commands reset them
+    VkCommandBuffer queryResetCmd = VK_NULL_HANDLE;
+    if (m_GpuProfiler.IsEnabled() && !m_Context.GetVulkan12Features().hostQueryReset) {
+        queryResetCmd = GetUploadCommandBuffer();
+    }
+    m_GpuProfiler.BeginFrame(m_CurrentFrame, queryResetCmd);
+
+    // Input for this frame was sampled right after PaceFrame(), or just now without it
+    frame.inputTime = m_Paced ? m_InputTime : std::chrono::steady_clock::now();
+    m_Paced = false;
 
     vkResetFences(m_Context.GetDevice(), 1, &frame.inFlightFence);
+    m_Context.GetAllocator().SetFrameIndex(m_FrameNumber);
+
+    // Secondaries of this slot finished executing with the fence
+    vkResetCommandPool(m_Context.GetDevice(), frame.mainCommands.commandPool, 0);
+    frame.mainCommands.used = 0;
+    for (auto& commands : frame.threadCommands) {
+        vkResetCommandPool(m_Context.GetDevice(), commands.commandPool, 0);
+        commands.used = 0;
+        commands.recorded.clear();
+    }
+    frame.executeCommandBuffers.clear();
 
     // Reset and begin command buffer
     vkResetCommandBuffer(frame.commandBuffer, 0);
@@ -172,51 +308,87 @@ bool Renderer::BeginFrame() {
     renderPassInfo.clearValueCount = static_cast<u32>(clearValues.size());
     renderPassInfo.pClearValues = clearValues.data();
 
-    vkCmdBeginRenderPass(frame.commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    // Statistics stay off, the query would have to be inherited by the secondaries
+    m_MainPassScope = m_GpuProfiler.BeginScope(frame.commandBuffer, "Main Pass", false);
 
-    // Set viewport and scissor
-    VkViewport viewport{};
-    viewport.x = 0.0f;
-    viewport.y = 0.0f;
-    viewport.width = static_cast<float>(m_SwapchainExtent.width);
-    viewport.height = static_cast<float>(m_SwapchainExtent.height);
-    viewport.minDepth = 0.0f;
-    viewport.maxDepth = 1.0f;
-    vkCmdSetViewport(frame.commandBuffer, 0, 1, &viewport);
+    vkCmdBeginRenderPass(frame.commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 
-    VkRect2D scissor{};
-    scissor.offset = {0, 0};
-    scissor.extent = m_SwapchainExtent;
-    vkCmdSetScissor(frame.commandBuffer, 0, 1, &scissor);
+    BeginPassSegment(frame);
 
     return true;
 }
 
 void Renderer::EndFrame() {
+    TVK_PROFILE_SCOPE("Renderer::EndFrame");
+
     auto& frame = m_Frames[m_CurrentFrame];
 
+    // Merge everything recorded for the render pass, pending secondaries ahead of the last segment
+    MergeThreadCommands(frame);
+    EndPassSegment(frame);
+    vkCmdExecuteCommands(frame.commandBuffer, static_cast<u32>(frame.executeCommandBuffers.size()),
+                         frame.executeCommandBuffers.data());
+    frame.executeCommandBuffers.clear();
+
     // End render pass
     vkCmdEndRenderPass(frame.commandBuffer);
 
+    m_GpuProfiler.EndScope(frame.commandBuffer, m_MainPassScope);
+    m_MainPassScope = GpuProfiler::InvalidScope;
+    m_GpuProfiler.EndFrame();
+
     if (vkEndCommandBuffer(frame.commandBuffer) != VK_SUCCESS) {
         TVK_LOG_ERROR("Failed to record command buffer");
         return;
     }
 
+    // Asynchronous copies and dispatches recorded this frame start now, dispatches after the uploads they read
+    if (m_TransferQueue.HasPendingWork()) {
+        m_TransferQueue.Submit();
+    }
+    if (m_ComputeQueue.HasPendingWork()) {
+        SubmitCompute();
+    }
+
+    // Uploads run first, then queued passes (e.g. render widgets), then the frame's commands
+    m_SubmitCommandBuffers.clear();
+    if (frame.uploadRecording) {
+        m_SubmitCommandBuffers.push_back(EndUploadCommands(frame));
+        frame.uploadIndex++;
+    }
+    m_SubmitCommandBuffers.insert(m_SubmitCommandBuffers.end(),
+                                  frame.queuedCommandBuffers.begin(), frame.queuedCommandBuffers.end());
+    m_SubmitCommandBuffers.push_back(frame.commandBuffer);
+    frame.queuedCommandBuffers.clear();
+
     // Submit command buffer
     VkSubmitInfo submitInfo{};
     submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-    VkSemaphore waitSemaphores[] = {frame.imageAvailableSemaphore};
-    VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-    submitInfo.waitSemaphoreCount = 1;
+    // Headless frames have no image to acquire
+    VkSemaphore waitSemaphores[3] = {frame.imageAvailableSemaphore};
+    VkPipelineStageFlags waitStages[3] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
+    u64 waitValues[3] = {0};
+    u32 acquireWaits = IsHeadless() ? 0 : 1;
+    u32 timelineWaits = AddTimelineWaits(waitSemaphores + acquireWaits, waitStages + acquireWaits, waitValues + acquireWaits);
+    u32 waitCount = acquireWaits + timelineWaits;
+    submitInfo.waitSemaphoreCount = waitCount;
     submitInfo.pWaitSemaphores = waitSemaphores;
     submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &frame.commandBuffer;
+
+    // Acquired resources were released by the transfer or compute queue, order after that release
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    if (timelineWaits > 0) {
+        timelineInfo.waitSemaphoreValueCount = waitCount;
+        timelineInfo.pWaitSemaphoreValues = waitValues;
+        submitInfo.pNext = &timelineInfo;
+    }
+    submitInfo.commandBufferCount = static_cast<u32>(m_SubmitCommandBuffers.size());
+    submitInfo.pCommandBuffers = m_SubmitCommandBuffers.data();
 
     VkSemaphore signalSemaphores[] = {frame.renderFinishedSemaphore};
-    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.signalSemaphoreCount = IsHeadless() ? 0 : 1;
     submitInfo.pSignalSemaphores = signalSemaphores;
 
     if (vkQueueSubmit(m_Context.GetGraphicsQueue(), 1, &submitInfo, frame.inFlightFence) != VK_SUCCESS) {
@@ -224,38 +396,553 @@ void Renderer::EndFrame() {
         return;
     }
 
-    // Present
+    // The fence also covers uploads submitted earlier on this queue
+    m_StagingRing.Retire(m_FrameNumber);
+    frame.submittedFrame = m_FrameNumber++;
+    frame.pendingSubmission = true;
+
+    if (!IsHeadless()) {
+        Present(frame);
+    } else if (m_FramebufferResized) {
+        m_FramebufferResized = false;
+        RecreateSwapchain();
+    }
+
+    m_PreviousFrame = m_CurrentFrame;
+
+    // Slots leaving the rotation finish first so that everything they guard is released
+    if (m_RequestedFramesInFlight != m_FramesInFlight) {
+        for (u32 i = m_RequestedFramesInFlight; i < m_FramesInFlight; i++) {
+            WaitForFrame(m_Frames[i]);
+        }
+        m_FramesInFlight = m_RequestedFramesInFlight;
+    }
+
+    m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
+}
+
+void Renderer::Present(FrameData& frame) {
     VkPresentInfoKHR presentInfo{};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = signalSemaphores;
+    presentInfo.pWaitSemaphores = &frame.renderFinishedSemaphore;
 
     VkSwapchainKHR swapchains[] = {m_Swapchain};
     presentInfo.swapchainCount = 1;
     presentInfo.pSwapchains = swapchains;
     presentInfo.pImageIndices = &m_CurrentImageIndex;
 
+    // The id lets PaceFrame() and the latency stats wait until the frame is displayed
+    u64 presentId = m_PresentId + 1;
+    VkPresentIdKHR presentIdInfo{};
+    presentIdInfo.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+    if (m_Context.IsPresentWaitSupported()) {
+        presentIdInfo.swapchainCount = 1;
+        presentIdInfo.pPresentIds = &presentId;
+        presentInfo.pNext = &presentIdInfo;
+    }
+
     VkResult result = vkQueuePresentKHR(m_Context.GetPresentQueue(), &presentInfo);
 
+    if (m_Context.IsPresentWaitSupported() && (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)) {
+        // Bounded in case presents stop completing, e.g. while the window is hidden
+        if (m_PendingPresents.size() >= 8) {
+            m_PendingPresents.erase(m_PendingPresents.begin());
+        }
+        m_PresentId = presentId;
+        m_PendingPresents.push_back({presentId, frame.inputTime});
+    }
+
     if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_FramebufferResized) {
         m_FramebufferResized = false;
         RecreateSwapchain();
     } else if (result != VK_SUCCESS) {
         TVK_LOG_ERROR("Failed to present swapchain image");
     }
+}
+
+void Renderer::SetFramesInFlight(u32 count) {
+    m_RequestedFramesInFlight = std::clamp(count, 1u, m_Config.maxFramesInFlight);
+}
+
+void Renderer::PaceFrame() {
+    TVK_PROFILE_SCOPE("Renderer::PaceFrame");
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point start = Clock::now();
+    bool presentWait = m_Context.IsPresentWaitSupported();
+
+    if (m_Config.lowLatency && !m_Frames.empty()) {
+        // Nothing is queued behind the previous frame, its input to GPU completion time is the frame's cost
+        FrameData& previous = m_Frames[m_PreviousFrame];
+        bool pending = previous.pendingSubmission;
+        WaitForFrame(previous);
+        if (pending) {
+            double work = std::chrono::duration<double>(Clock::now() - previous.inputTime).count();
+            m_WorkEstimate = std::max(work, m_WorkEstimate * 0.95 + work * 0.05);
+        }
+
+        if (presentWait && !m_PendingPresents.empty()) {
+            CollectPresents(true);
+
+            // The next refresh is an interval after the one that displayed the previous frame
+            double interval = m_LatencyStats.refreshIntervalMs / 1000.0;
+            double delay = interval - m_WorkEstimate - m_Config.latencyMarginMs / 1000.0;
+            if (delay > 0.0 && !m_SkipPaceDelay) {
+                SleepUntil(m_DisplayedTime + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(delay)));
+            }
+            m_SkipPaceDelay = false;
+        }
+    } else if (presentWait) {
+        CollectPresents(false);
+    }
+
+    m_InputTime = Clock::now();
+    m_LatencyStats.paceWaitMs = std::chrono::duration<float, std::milli>(m_InputTime - start).count();
+    m_LatencyStats.displayTimed = presentWait;
+    m_Paced = true;
+}
+
+void Renderer::CollectPresents(bool wait) {
+    using Clock = std::chrono::steady_clock;
+
+    // Ids are displayed in order, waiting for the latest one also covers the earlier ones
+    while (!m_PendingPresents.empty()) {
+        size_t index = wait ? m_PendingPresents.size() - 1 : 0;
+        PendingPresent present = m_PendingPresents[index];
+
+        VkResult result = m_Context.WaitForPresent(m_Swapchain, present.id, wait ? s_PresentWaitTimeout : 0);
+        if (result == VK_TIMEOUT) break;
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+            // The swapchain is recreated and its ids start over
+            m_PendingPresents.clear();
+            break;
+        }
+
+        Clock::time_point now = Clock::now();
+        RecordLatency(present.inputTime, now);
+
+        // Falls quickly to the shortest interval seen and rises slowly, so missed refreshes barely move it
+        if (m_DisplayedId > 0 && present.id == m_DisplayedId + 1) {
+            float interval = std::chrono::duration<float, std::milli>(now - m_DisplayedTime).count();
+            float& refresh = m_LatencyStats.refreshIntervalMs;
+            if (refresh > 0.0f && interval > refresh * 1.5f && m_Config.lowLatency) {
+                m_LatencyStats.missedRefreshes++;
+                m_SkipPaceDelay = true;
+            }
+            refresh = (refresh == 0.0f || interval < refresh) ? interval : refresh + (interval - refresh) * 0.02f;
+        }
+
+        m_DisplayedId = present.id;
+        m_DisplayedTime = now;
+        m_PendingPresents.erase(m_PendingPresents.begin(), m_PendingPresents.begin() + index + 1);
+    }
+}
 
-    m_CurrentFrame = (m_CurrentFrame + 1) % m_Config.maxFramesInFlight;
+void Renderer::RecordLatency(std::chrono::steady_clock::time_point inputTime, std::chrono::steady_clock::time_point doneTime) {
+    if (inputTime == std::chrono::steady_clock::time_point{}) return;
+
+    float latency = std::chrono::duration<float, std::milli>(doneTime - inputTime).count();
+    m_LatencyStats.lastLatencyMs = latency;
+    m_LatencyStats.latencyMs = m_LatencyStats.latencyMs == 0.0f ? latency : m_LatencyStats.latencyMs * 0.9f + latency * 0.1f;
 }
 
 void Renderer::OnResize(u32 width, u32 height) {
+    if (IsHeadless()) {
+        if (width == 0 || height == 0) return;
+        m_Config.headlessExtent = {width, height};
+    }
     m_FramebufferResized = true;
 }
 
 VkCommandBuffer Renderer::GetCurrentCommandBuffer() const {
-    return m_Frames[m_CurrentFrame].commandBuffer;
+    return m_Frames[m_CurrentFrame].passCommandBuffer;
+}
+
+VkCommandBuffer Renderer::BeginSecondaryCommands(u32 thread) {
+    auto& frame = m_Frames[m_CurrentFrame];
+    if (thread >= frame.threadCommands.size()) {
+        TVK_LOG_ERROR("Recording thread {} out of range ({} threads)", thread, frame.threadCommands.size());
+        return VK_NULL_HANDLE;
+    }
+    return BeginSecondary(frame.threadCommands[thread]);
+}
+
+void Renderer::EndSecondaryCommands(u32 thread, VkCommandBuffer cmd) {
+    if (cmd == VK_NULL_HANDLE) return;
+
+    auto& frame = m_Frames[m_CurrentFrame];
+    if (thread >= frame.threadCommands.size()) return;
+
+    if (vkEndCommandBuffer(cmd) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to record secondary command buffer");
+        return;
+    }
+    frame.threadCommands[thread].recorded.push_back(cmd);
+}
+
+void Renderer::ExecuteSecondaryCommands() {
+    auto& frame = m_Frames[m_CurrentFrame];
+
+    // Split the main thread's commands so the secondaries run between them
+    EndPassSegment(frame);
+    MergeThreadCommands(frame);
+    BeginPassSegment(frame);
+}
+
+void Renderer::SubmitWithFrame(VkCommandBuffer cmd) {
+    if (cmd == VK_NULL_HANDLE) return;
+    m_Frames[m_CurrentFrame].queuedCommandBuffers.push_back(cmd);
+}
+
+StagingAllocation Renderer::AllocateStaging(VkDeviceSize size, VkDeviceSize alignment) {
+    StagingAllocation staging = m_StagingRing.Allocate(size, alignment);
+    if (!staging.IsValid()) {
+        // The ring is full of uploads the GPU has not consumed yet
+        FlushUploads();
+        staging = m_StagingRing.Allocate(size, alignment);
+        if (!staging.IsValid()) {
+            TVK_LOG_ERROR("Failed to allocate {} bytes of staging memory", size);
+        }
+    }
+    return staging;
+}
+
+StagingAllocation Renderer::TryAllocateStaging(VkDeviceSize size, VkDeviceSize alignment) {
+    return m_StagingRing.Allocate(size, alignment);
+}
+
+VkCommandBuffer Renderer::GetUploadCommandBuffer() {
+    auto& frame = m_Frames[m_CurrentFrame];
+    if (frame.uploadRecording) {
+        return frame.uploadCommandBuffers[frame.uploadIndex];
+    }
+
+    // Upload command buffers of this slot are reusable once its fence signaled
+    WaitForFrame(frame);
+
+    if (frame.uploadIndex == frame.uploadCommandBuffers.size()) {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_Context.GetCommandPool();
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer cmd = VK_NULL_HANDLE;
+        if (vkAllocateCommandBuffers(m_Context.GetDevice(), &allocInfo, &cmd) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to allocate upload command buffer");
+            return VK_NULL_HANDLE;
+        }
+        frame.uploadCommandBuffers.push_back(cmd);
+    }
+
+    VkCommandBuffer cmd = frame.uploadCommandBuffers[frame.uploadIndex];
+    vkResetCommandBuffer(cmd, 0);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &beginInfo);
+
+    // Earlier frames may still read or write the destinations
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    frame.uploadRecording = true;
+    return cmd;
+}
+
+void Renderer::SubmitUploads() {
+    if (m_Frames.empty()) return;
+
+    auto& frame = m_Frames[m_CurrentFrame];
+    if (!frame.uploadRecording) return;
+
+    VkCommandBuffer cmd = EndUploadCommands(frame);
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &cmd;
+
+    VkSemaphore waitSemaphores[2];
+    VkPipelineStageFlags waitStages[2];
+    u64 waitValues[2];
+    u32 waitCount = AddTimelineWaits(waitSemaphores, waitStages, waitValues);
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    if (waitCount > 0) {
+        timelineInfo.waitSemaphoreValueCount = waitCount;
+        timelineInfo.pWaitSemaphoreValues = waitValues;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.waitSemaphoreCount = waitCount;
+        submitInfo.pWaitSemaphores = waitSemaphores;
+        submitInfo.pWaitDstStageMask = waitStages;
+    }
+
+    // Compute batches submitted afterwards wait on this value
+    u64 signalValue = m_UploadTimelineValue + 1;
+    if (m_UploadTimeline != VK_NULL_HANDLE) {
+        timelineInfo.signalSemaphoreValueCount = 1;
+        timelineInfo.pSignalSemaphoreValues = &signalValue;
+        submitInfo.pNext = &timelineInfo;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &m_UploadTimeline;
+    }
+
+    if (vkQueueSubmit(m_Context.GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to submit upload command buffer");
+    } else if (m_UploadTimeline != VK_NULL_HANDLE) {
+        m_UploadTimelineValue = signalValue;
+    }
+    frame.uploadIndex++;
+
+    // Reclaimed together with this slot's next frame submission
+    m_StagingRing.Retire(m_FrameNumber);
+}
+
+void Renderer::FlushUploads() {
+    SubmitUploads();
+    vkQueueWaitIdle(m_Context.GetGraphicsQueue());
+
+    m_StagingRing.ReleaseAll();
+    m_CompletedFrame = m_FrameNumber - 1;
+    m_BindlessHeap.Collect(m_CompletedFrame);
+    for (auto& frame : m_Frames) {
+        if (!frame.uploadRecording) {
+            frame.uploadIndex = 0;
+        }
+    }
+}
+
+bool Renderer::HasPendingUploads() const {
+    return !m_Frames.empty() && m_Frames[m_CurrentFrame].uploadRecording;
+}
+
+void Renderer::EndBackgroundWork() {
+    // The frame handling the finished work has to run
+    m_BackgroundWork.fetch_sub(1, std::memory_order_relaxed);
+    Wake();
+}
+
+bool Renderer::HasBackgroundWork() const {
+    // Acquires and readbacks of submitted batches only happen in BeginFrame()
+    return m_BackgroundWork.load(std::memory_order_relaxed) > 0 || HasPendingUploads() ||
+           m_TransferQueue.HasPendingWork() || m_TransferQueue.HasWorkInFlight() ||
+           m_ComputeQueue.HasPendingWork() || m_ComputeQueue.HasWorkInFlight();
+}
+
+void Renderer::Wake() const {
+    if (m_WakeCallback) {
+        m_WakeCallback();
+    }
+}
+
+ComputeHandle Renderer::SubmitCompute() {
+    if (!m_ComputeQueue.HasPendingWork()) return {};
+
+    SubmitUploads();
+    m_ComputeQueue.WaitSemaphore(m_UploadTimeline, m_UploadTimelineValue);
+    return m_ComputeQueue.Submit();
+}
+
+void Renderer::ReleaseToCompute(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size) {
+    if (!m_ComputeQueue.IsAsync() || buffer == VK_NULL_HANDLE) return;
+
+    // The release is recorded with the uploads, after the copies that write the buffer
+    if (GetUploadCommandBuffer() == VK_NULL_HANDLE) return;
+
+    const auto& indices = m_Context.GetQueueFamilyIndices();
+    u32 graphicsFamily = indices.graphicsFamily.value();
+    u32 computeFamily = indices.computeFamily.value_or(graphicsFamily);
+    if (computeFamily != graphicsFamily) {
+        VkBufferMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = 0;
+        barrier.srcQueueFamilyIndex = graphicsFamily;
+        barrier.dstQueueFamilyIndex = computeFamily;
+        barrier.buffer = buffer;
+        barrier.offset = offset;
+        barrier.size = size;
+        m_ComputeReleases.push_back(barrier);
+    }
+
+    m_ComputeQueue.AcquireBuffer(buffer, offset, size);
+}
+
+void Renderer::WaitForCompute(const ComputeHandle& handle) {
+    if (!handle.IsValid()) return;
+
+    // The open batch starts after the uploads recorded so far, the acquire goes into the next ones
+    if (m_ComputeQueue.IsPending(handle.value)) {
+        SubmitCompute();
+    }
+
+    u64 value = m_ComputeQueue.Acquire(handle.value, GetUploadCommandBuffer());
+    m_ComputeWaitValue = std::max(m_ComputeWaitValue, value);
+}
+
+u32 Renderer::AddTimelineWaits(VkSemaphore* semaphores, VkPipelineStageFlags* stages, u64* values) {
+    u32 count = 0;
+    if (m_TransferWaitValue > 0) {
+        semaphores[count] = m_TransferQueue.GetTimelineSemaphore();
+        stages[count] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        values[count] = m_TransferWaitValue;
+        count++;
+        m_TransferWaitValue = 0;
+    }
+    if (m_ComputeWaitValue > 0) {
+        semaphores[count] = m_ComputeQueue.GetTimelineSemaphore();
+        stages[count] = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        values[count] = m_ComputeWaitValue;
+        count++;
+        m_ComputeWaitValue = 0;
+    }
+    return count;
+}
+
+void Renderer::WaitForFrame(FrameData& frame) {
+    if (!frame.pendingSubmission) return;
+
+    vkWaitForFences(m_Context.GetDevice(), 1, &frame.inFlightFence, VK_TRUE, UINT64_MAX);
+    if (!m_Context.IsPresentWaitSupported()) {
+        RecordLatency(frame.inputTime, std::chrono::steady_clock::now());
+    }
+    m_StagingRing.Release(frame.submittedFrame);
+    m_CompletedFrame = std::max(m_CompletedFrame, frame.submittedFrame);
+    m_BindlessHeap.Collect(m_CompletedFrame);
+    frame.uploadIndex = 0;
+    frame.pendingSubmission = false;
+}
+
+bool Renderer::CreateThreadCommands(ThreadCommands& commands) {
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = m_Context.GetQueueFamilyIndices().graphicsFamily.value();
+
+    return vkCreateCommandPool(m_Context.GetDevice(), &poolInfo, nullptr, &commands.commandPool) == VK_SUCCESS;
+}
+
+void Renderer::DestroyThreadCommands(ThreadCommands& commands) {
+    if (commands.commandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(m_Context.GetDevice(), commands.commandPool, nullptr);
+        commands.commandPool = VK_NULL_HANDLE;
+    }
+    commands.commandBuffers.clear();
+    commands.recorded.clear();
+    commands.used = 0;
+}
+
+VkCommandBuffer Renderer::BeginSecondary(ThreadCommands& commands) {
+    // Command buffers of a pool are reused once the pool was reset with its frame
+    if (commands.used == commands.commandBuffers.size()) {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = commands.commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer cmd = VK_NULL_HANDLE;
+        if (vkAllocateCommandBuffers(m_Context.GetDevice(), &allocInfo, &cmd) != VK_SUCCESS) {
+            TVK_LOG_ERROR("Failed to allocate secondary command buffer");
+            return VK_NULL_HANDLE;
+        }
+        commands.commandBuffers.push_back(cmd);
+    }
+
+    VkCommandBuffer cmd = commands.commandBuffers[commands.used++];
+
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = m_RenderPass;
+    inheritanceInfo.subpass = 0;
+    inheritanceInfo.framebuffer = m_Framebuffers[m_CurrentImageIndex];
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    if (vkBeginCommandBuffer(cmd, &beginInfo) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to begin secondary command buffer");
+        return VK_NULL_HANDLE;
+    }
+
+    // Dynamic state is not inherited from the primary
+    VkViewport viewport{};
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.width = static_cast<float>(m_SwapchainExtent.width);
+    viewport.height = static_cast<float>(m_SwapchainExtent.height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+    VkRect2D scissor{};
+    scissor.offset = {0, 0};
+    scissor.extent = m_SwapchainExtent;
+    vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+    return cmd;
+}
+
+void Renderer::BeginPassSegment(FrameData& frame) {
+    frame.passCommandBuffer = BeginSecondary(frame.mainCommands);
+}
+
+void Renderer::EndPassSegment(FrameData& frame) {
+    if (frame.passCommandBuffer == VK_NULL_HANDLE) return;
+
+    vkEndCommandBuffer(frame.passCommandBuffer);
+    frame.executeCommandBuffers.push_back(frame.passCommandBuffer);
+    frame.passCommandBuffer = VK_NULL_HANDLE;
+}
+
+void Renderer::MergeThreadCommands(FrameData& frame) {
+    for (auto& commands : frame.threadCommands) {
+        frame.executeCommandBuffers.insert(frame.executeCommandBuffers.end(),
+                                           commands.recorded.begin(), commands.recorded.end());
+        commands.recorded.clear();
+    }
+}
+
+VkCommandBuffer Renderer::EndUploadCommands(FrameData& frame) {
+    VkCommandBuffer cmd = frame.uploadCommandBuffers[frame.uploadIndex];
+
+    // Make the copies visible to everything that runs after them
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                         0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    // Buffers handed to the compute queue by ReleaseToCompute()
+    if (!m_ComputeReleases.empty()) {
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                             0, nullptr, static_cast<u32>(m_ComputeReleases.size()), m_ComputeReleases.data(),
+                             0, nullptr);
+        m_ComputeReleases.clear();
+    }
+
+    vkEndCommandBuffer(cmd);
+    frame.uploadRecording = false;
+    m_UploadSerial++;
+    return cmd;
 }
 
 bool Renderer::CreateSwapchain() {
+    if (IsHeadless()) {
+        return CreateOffscreenImages();
+    }
+
     SwapchainSupportDetails swapchainSupport = m_Context.QuerySwapchainSupport();
 
     VkSurfaceFormatKHR surfaceFormat = ChooseSwapSurfaceFormat(swapchainSupport.formats);
@@ -309,6 +996,44 @@ bool Renderer::CreateSwapchain() {
     return true;
 }
 
+bool Renderer::CreateOffscreenImages() {
+    // Same layout in memory as the usual swapchain format, pipelines built for either work for both
+    VkFormat format = VK_FORMAT_B8G8R8A8_UNORM;
+    VkFormatFeatureFlags features = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT | VK_FORMAT_FEATURE_TRANSFER_SRC_BIT;
+    if (!m_Context.IsFormatSupported(format, features)) {
+        format = VK_FORMAT_R8G8B8A8_UNORM;
+    }
+
+    VkImageCreateInfo imageInfo{};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.extent.width = std::max(1u, m_Config.headlessExtent.width);
+    imageInfo.extent.height = std::max(1u, m_Config.headlessExtent.height);
+    imageInfo.extent.depth = 1;
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.format = format;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // Frames in flight never share an image, so there is no acquire to wait for
+    m_SwapchainImages.resize(m_Config.maxFramesInFlight);
+    m_OffscreenAllocations.resize(m_Config.maxFramesInFlight);
+    for (u32 i = 0; i < m_Config.maxFramesInFlight; i++) {
+        if (!m_Context.GetAllocator().CreateImage(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                  m_SwapchainImages[i], m_OffscreenAllocations[i])) {
+            return false;
+        }
+    }
+
+    m_SwapchainImageFormat = format;
+    m_SwapchainExtent = {imageInfo.extent.width, imageInfo.extent.height};
+    return true;
+}
+
 bool Renderer::CreateImageViews() {
     m_SwapchainImageViews.resize(m_SwapchainImages.size());
 
@@ -345,7 +1070,7 @@ bool Renderer::CreateRenderPass() {
     colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    colorAttachment.finalLayout = IsHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
     VkAttachmentDescription depthAttachment{};
     depthAttachment.format = m_DepthFormat;
@@ -428,10 +1153,27 @@ bool Renderer::CreateCommandBuffers() {
     allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     allocInfo.commandBufferCount = 1;
 
+    // Per-frame pools for every recording thread, reset as a whole when the frame comes around
+    m_RecordingThreadCount = m_Config.recordingThreads;
+    if (m_RecordingThreadCount == 0) {
+        m_RecordingThreadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
     for (auto& frame : m_Frames) {
         if (vkAllocateCommandBuffers(m_Context.GetDevice(), &allocInfo, &frame.commandBuffer) != VK_SUCCESS) {
             return false;
         }
+
+        if (!CreateThreadCommands(frame.mainCommands)) {
+            return false;
+        }
+
+        frame.threadCommands.resize(m_RecordingThreadCount);
+        for (auto& commands : frame.threadCommands) {
+            if (!CreateThreadCommands(commands)) {
+                return false;
+            }
+        }
     }
 
     return true;
@@ -490,27 +1232,11 @@ bool Renderer::CreateDepthResources() {
     imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-    if (vkCreateImage(m_Context.GetDevice(), &imageInfo, nullptr, &m_DepthImage) != VK_SUCCESS) {
+    if (!m_Context.GetAllocator().CreateImage(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                              m_DepthImage, m_DepthImageAllocation)) {
         return false;
     }
 
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(m_Context.GetDevice(), m_DepthImage, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = m_Context.FindMemoryType(
-        memRequirements.memoryTypeBits, 
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
-
-    if (vkAllocateMemory(m_Context.GetDevice(), &allocInfo, nullptr, &m_DepthImageMemory) != VK_SUCCESS) {
-        return false;
-    }
-
-    vkBindImageMemory(m_Context.GetDevice(), m_DepthImage, m_DepthImageMemory, 0);
-
     // Create depth image view
     VkImageViewCreateInfo viewInfo{};
     viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -534,16 +1260,11 @@ void Renderer::CleanupSwapchain() {
         m_DepthImageView = VK_NULL_HANDLE;
     }
 
-    if (m_DepthImage != VK_NULL_HANDLE) {
-        vkDestroyImage(m_Context.GetDevice(), m_DepthImage, nullptr);
+    if (m_DepthImage != VK_NULL_HANDLE || m_DepthImageAllocation.IsValid()) {
+        m_Context.GetAllocator().DestroyImage(m_DepthImage, m_DepthImageAllocation);
         m_DepthImage = VK_NULL_HANDLE;
     }
 
-    if (m_DepthImageMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(m_Context.GetDevice(), m_DepthImageMemory, nullptr);
-        m_DepthImageMemory = VK_NULL_HANDLE;
-    }
-
     for (auto framebuffer : m_Framebuffers) {
         vkDestroyFramebuffer(m_Context.GetDevice(), framebuffer, nullptr);
     }
@@ -563,19 +1284,36 @@ void Renderer::CleanupSwapchain() {
         vkDestroySwapchainKHR(m_Context.GetDevice(), m_Swapchain, nullptr);
         m_Swapchain = VK_NULL_HANDLE;
     }
+
+    for (size_t i = 0; i < m_OffscreenAllocations.size(); i++) {
+        if (m_SwapchainImages[i] != VK_NULL_HANDLE || m_OffscreenAllocations[i].IsValid()) {
+            m_Context.GetAllocator().DestroyImage(m_SwapchainImages[i], m_OffscreenAllocations[i]);
+        }
+    }
+    if (!m_OffscreenAllocations.empty()) {
+        m_OffscreenAllocations.clear();
+        m_SwapchainImages.clear();
+    }
 }
 
 void Renderer::RecreateSwapchain() {
     // Wait for minimized window
-    auto extent = m_Window->GetFramebufferExtent();
-    while (extent.width == 0 || extent.height == 0) {
-        extent = m_Window->GetFramebufferExtent();
-        m_Window->WaitEvents();
+    if (m_Window) {
+        auto extent = m_Window->GetFramebufferExtent();
+        while (extent.width == 0 || extent.height == 0) {
+            extent = m_Window->GetFramebufferExtent();
+            m_Window->WaitEvents();
+        }
     }
 
     m_Context.WaitIdle();
 
     CleanupSwapchain();
+
+    // Present ids belong to the old swapchain
+    m_PresentId = 0;
+    m_DisplayedId = 0;
+    m_PendingPresents.clear();
     
     // Destroy old semaphore pools
     for (auto semaphore : m_ImageAvailableSemaphores) {
@@ -0,0 +1,115 @@
+/**
+ * @file sampler_cache.cpp
+ * @brief Sampler cache implementation
+ */
+
+#include "tinyvk/renderer/sampler_cache.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/hash.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+
+namespace tvk {
+
+static_assert(sizeof(SamplerDesc) == 9 * 4, "SamplerDesc must not contain padding");
+
+size_t SamplerCache::DescHash::operator()(const SamplerDesc& desc) const {
+    return static_cast<size_t>(HashValue(desc));
+}
+
+SamplerCache::~SamplerCache() {
+    Cleanup();
+}
+
+void SamplerCache::Init(VulkanContext* context) {
+    m_Context = context;
+}
+
+void SamplerCache::Cleanup() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Context) return;
+
+    for (auto& [desc, entry] : m_Samplers) {
+        vkDestroySampler(m_Context->GetDevice(), entry.sampler, nullptr);
+    }
+    m_Samplers.clear();
+    m_Descs.clear();
+    m_Context = nullptr;
+}
+
+VkSampler SamplerCache::Acquire(const SamplerDesc& desc) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Context) return VK_NULL_HANDLE;
+
+    // Anisotropy the device cannot do falls back to plain filtering, both map to one sampler
+    SamplerDesc key = desc;
+    if (!m_Context->GetEnabledFeatures().samplerAnisotropy) {
+        key.maxAnisotropy = 0.0f;
+    }
+    key.maxAnisotropy = std::min(key.maxAnisotropy, m_Context->GetDeviceProperties().limits.maxSamplerAnisotropy);
+    if (key.maxAnisotropy <= 1.0f) {
+        key.maxAnisotropy = 0.0f;
+    }
+
+    auto it = m_Samplers.find(key);
+    if (it != m_Samplers.end()) {
+        it->second.refCount++;
+        return it->second.sampler;
+    }
+
+    VkSamplerCreateInfo samplerInfo{};
+    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    samplerInfo.magFilter = key.magFilter;
+    samplerInfo.minFilter = key.minFilter;
+    samplerInfo.mipmapMode = key.mipmapMode;
+    samplerInfo.addressModeU = key.addressModeU;
+    samplerInfo.addressModeV = key.addressModeV;
+    samplerInfo.addressModeW = key.addressModeW;
+    samplerInfo.anisotropyEnable = key.maxAnisotropy > 0.0f ? VK_TRUE : VK_FALSE;
+    samplerInfo.maxAnisotropy = std::max(1.0f, key.maxAnisotropy);
+    samplerInfo.borderColor = key.borderColor;
+    samplerInfo.unnormalizedCoordinates = VK_FALSE;
+    samplerInfo.compareEnable = VK_FALSE;
+    samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+    samplerInfo.minLod = 0.0f;
+    samplerInfo.maxLod = key.maxLod;
+    samplerInfo.mipLodBias = 0.0f;
+
+    VkSampler sampler = VK_NULL_HANDLE;
+    if (vkCreateSampler(m_Context->GetDevice(), &samplerInfo, nullptr, &sampler) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create sampler");
+        return VK_NULL_HANDLE;
+    }
+
+    m_Samplers[key] = {sampler, 1};
+    m_Descs[sampler] = key;
+    return sampler;
+}
+
+void SamplerCache::Release(VkSampler sampler) {
+    if (sampler == VK_NULL_HANDLE) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Context) return;
+
+    auto descIt = m_Descs.find(sampler);
+    if (descIt == m_Descs.end()) {
+        TVK_LOG_WARN("Released a sampler not owned by the cache");
+        return;
+    }
+
+    auto it = m_Samplers.find(descIt->second);
+    if (--it->second.refCount == 0) {
+        vkDestroySampler(m_Context->GetDevice(), sampler, nullptr);
+        m_Samplers.erase(it);
+        m_Descs.erase(descIt);
+    }
+}
+
+u32 SamplerCache::GetSamplerCount() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return static_cast<u32>(m_Samplers.size());
+}
+
+} // namespace tvk
@@ -7,21 +7,86 @@
 #include "tinyvk/renderer/renderer.h"
 #include "tinyvk/renderer/context.h"
 #include "tinyvk/core/log.h"
+#include "tinyvk/core/hash.h"
 
 #include <shaderc/shaderc.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <cstdio>
+
 namespace tvk {
 
+static constexpr u32 s_SpirvMagic = 0x07230203;
+
+static std::mutex s_CacheMutex;
+static std::unordered_map<u64, std::vector<u32>> s_Cache;
+static std::string s_CacheDirectory = "shader_cache";
+
+// Hash of the shaderc library, set by CMake. Without it SPIR-V of another shaderc
+// build could be loaded from disk, so only the in-memory cache is used
+#ifdef TVK_SHADERC_IDENTITY
+static constexpr bool s_DiskCacheAvailable = true;
+#else
+    #define TVK_SHADERC_IDENTITY "unknown"
+static constexpr bool s_DiskCacheAvailable = false;
+#endif
+static bool s_DiskCacheWarned = false;
+
+static u64 ComputeCacheKey(const std::string& source, shaderc_shader_kind kind, bool debugInfo) {
+    // Releases targeting the same SPIR-V version still emit different code, the library hash tells them apart
+    unsigned int version = 0;
+    unsigned int revision = 0;
+    shaderc_get_spv_version(&version, &revision);
+
+    u64 key = HashString(source);
+    key = HashString(TVK_SHADERC_IDENTITY, key);
+    key = HashValue(kind, key);
+    key = HashValue(shaderc_optimization_level_performance, key);
+    key = HashValue(debugInfo, key);
+    key = HashValue(version, key);
+    key = HashValue(revision, key);
+    return key;
+}
+
+static std::string GetCacheFilePath(const std::string& directory, u64 key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.spv", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(directory) / name).string();
+}
+
+static bool LoadCachedSpirv(const std::string& path, std::vector<u32>& spirv) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+
+    size_t size = static_cast<size_t>(file.tellg());
+    if (size < sizeof(u32) || size % sizeof(u32) != 0) return false;
+
+    spirv.resize(size / sizeof(u32));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(spirv.data()), static_cast<std::streamsize>(size));
+    return file && spirv[0] == s_SpirvMagic;
+}
+
+static void StoreCachedSpirv(const std::string& directory, const std::string& path, const std::vector<u32>& spirv) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    // Written next to the target and swapped in, readers never see a torn file
+    std::string tempPath = path + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return;
+        file.write(reinterpret_cast<const char*>(spirv.data()), static_cast<std::streamsize>(spirv.size() * sizeof(u32)));
+        if (!file) return;
+    }
+    std::filesystem::rename(tempPath, path, error);
+}
+
 std::vector<u32> ShaderCompiler::CompileGLSL(const std::string& source, ShaderStage stage, const std::string& name) {
-    shaderc::Compiler compiler;
-    shaderc::CompileOptions options;
-    
-    options.SetOptimizationLevel(shaderc_optimization_level_performance);
-    
-    #ifdef TVK_DEBUG_BUILD
-    options.SetGenerateDebugInfo();
-    #endif
-    
     shaderc_shader_kind kind;
     switch (stage) {
         case ShaderStage::Vertex:
@@ -46,19 +111,78 @@ std::vector<u32> ShaderCompiler::CompileGLSL(const std::string& source, ShaderSt
             TVK_LOG_ERROR("Unknown shader stage");
             return {};
     }
-    
-    shaderc::SpvCompilationResult result = compiler.CompileGlslToSpv(
-        source, kind, name.c_str(), options
-    );
-    
-    if (result.GetCompilationStatus() != shaderc_compilation_status_success) {
-        TVK_LOG_ERROR("Shader compilation failed: {}", result.GetErrorMessage());
-        return {};
+
+#ifdef TVK_DEBUG_BUILD
+    bool debugInfo = true;
+#else
+    bool debugInfo = false;
+#endif
+
+    u64 key = ComputeCacheKey(source, kind, debugInfo);
+    std::string directory;
+    {
+        std::lock_guard<std::mutex> lock(s_CacheMutex);
+        auto it = s_Cache.find(key);
+        if (it != s_Cache.end()) {
+            return it->second;
+        }
+        if (s_DiskCacheAvailable) {
+            directory = s_CacheDirectory;
+        } else if (!s_CacheDirectory.empty() && !s_DiskCacheWarned) {
+            TVK_LOG_WARN("shaderc library was not identified at build time, the on-disk shader cache is disabled");
+            s_DiskCacheWarned = true;
+        }
     }
-    
-    TVK_LOG_INFO("Compiled shader '{}' successfully", name);
-    
-    return {result.cbegin(), result.cend()};
+
+    std::string path = directory.empty() ? std::string() : GetCacheFilePath(directory, key);
+
+    std::vector<u32> spirv;
+    if (!path.empty() && LoadCachedSpirv(path, spirv)) {
+        TVK_LOG_DEBUG("Loaded shader '{}' from cache", name);
+    } else {
+        // The compiler object is reused, compiling on it is thread-safe
+        static shaderc::Compiler compiler;
+        shaderc::CompileOptions options;
+        options.SetOptimizationLevel(shaderc_optimization_level_performance);
+        if (debugInfo) {
+            options.SetGenerateDebugInfo();
+        }
+
+        shaderc::SpvCompilationResult result = compiler.CompileGlslToSpv(
+            source, kind, name.c_str(), options
+        );
+
+        if (result.GetCompilationStatus() != shaderc_compilation_status_success) {
+            TVK_LOG_ERROR("Shader compilation failed: {}", result.GetErrorMessage());
+            return {};
+        }
+
+        TVK_LOG_DEBUG("Compiled shader '{}' successfully", name);
+
+        spirv.assign(result.cbegin(), result.cend());
+        if (!path.empty()) {
+            StoreCachedSpirv(directory, path, spirv);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(s_CacheMutex);
+    s_Cache[key] = spirv;
+    return spirv;
+}
+
+void ShaderCompiler::SetCacheDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(s_CacheMutex);
+    s_CacheDirectory = directory;
+}
+
+std::string ShaderCompiler::GetCacheDirectory() {
+    std::lock_guard<std::mutex> lock(s_CacheMutex);
+    return s_CacheDirectory;
+}
+
+void ShaderCompiler::ClearCache() {
+    std::lock_guard<std::mutex> lock(s_CacheMutex);
+    s_Cache.clear();
 }
 
 VkShaderModule ShaderCompiler::CreateShaderModule(Renderer* renderer, const std::vector<u32>& spirv) {
@@ -0,0 +1,172 @@
+/**
+ * @file staging_ring.cpp
+ * @brief Staging ring buffer implementation
+ */
+
+#include "tinyvk/renderer/staging_ring.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+namespace tvk {
+
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+StagingRing::~StagingRing() {
+    Cleanup();
+}
+
+bool StagingRing::Init(VulkanContext* context, VkDeviceSize capacity) {
+    m_Context = context;
+    m_Capacity = capacity;
+
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = capacity;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (!m_Context->GetAllocator().CreateBuffer(bufferInfo,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            m_Buffer, m_Allocation, true)) {
+        TVK_LOG_ERROR("Failed to create staging ring");
+        return false;
+    }
+
+    m_Data = static_cast<u8*>(m_Allocation.mapped);
+    m_Head = m_Tail = m_Used = m_PendingBytes = 0;
+    m_Regions.reserve(8);
+    return true;
+}
+
+void StagingRing::Cleanup() {
+    if (!m_Context) return;
+
+    for (auto& overflow : m_Overflow) {
+        m_Context->GetAllocator().DestroyBuffer(overflow.buffer, overflow.allocation);
+    }
+    m_Overflow.clear();
+
+    if (m_Buffer != VK_NULL_HANDLE) {
+        m_Context->GetAllocator().DestroyBuffer(m_Buffer, m_Allocation);
+        m_Buffer = VK_NULL_HANDLE;
+    }
+
+    m_Data = nullptr;
+    m_Regions.clear();
+    m_Head = m_Tail = m_Used = m_PendingBytes = 0;
+    m_Context = nullptr;
+}
+
+StagingAllocation StagingRing::Allocate(VkDeviceSize size, VkDeviceSize alignment) {
+    StagingAllocation result;
+    if (!m_Data || size == 0) return result;
+
+    // Requests that can never fit get their own buffer
+    if (size > m_Capacity) {
+        Overflow overflow;
+
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = size;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        if (!m_Context->GetAllocator().CreateBuffer(bufferInfo,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                overflow.buffer, overflow.allocation, true)) {
+            return result;
+        }
+
+        result.buffer = overflow.buffer;
+        result.offset = 0;
+        result.size = size;
+        result.data = overflow.allocation.mapped;
+        m_Overflow.push_back(overflow);
+        return result;
+    }
+
+    // Free space is [head, capacity) + [0, tail) when head >= tail, else [head, tail)
+    VkDeviceSize offset = AlignUp(m_Head, alignment);
+    VkDeviceSize consumed = 0;
+
+    if (m_Used == 0 || m_Head > m_Tail) {
+        if (offset + size <= m_Capacity) {
+            consumed = offset + size - m_Head;
+        } else if (size <= m_Tail) {
+            // Wrap around, the end of the ring is wasted until released
+            consumed = (m_Capacity - m_Head) + size;
+            offset = 0;
+        } else {
+            return result;
+        }
+    } else {
+        if (offset + size <= m_Tail) {
+            consumed = offset + size - m_Head;
+        } else {
+            return result;
+        }
+    }
+
+    m_Head = offset + size;
+    m_Used += consumed;
+    m_PendingBytes += consumed;
+
+    result.buffer = m_Buffer;
+    result.offset = offset;
+    result.size = size;
+    result.data = m_Data + offset;
+    return result;
+}
+
+void StagingRing::Retire(u64 marker) {
+    for (auto& overflow : m_Overflow) {
+        if (!overflow.retired) {
+            overflow.marker = marker;
+            overflow.retired = true;
+        }
+    }
+
+    if (m_PendingBytes == 0) return;
+
+    Region region;
+    region.marker = marker;
+    region.end = m_Head;
+    region.bytes = m_PendingBytes;
+    m_Regions.push_back(region);
+    m_PendingBytes = 0;
+}
+
+void StagingRing::Release(u64 completedMarker) {
+    size_t released = 0;
+    while (released < m_Regions.size() && m_Regions[released].marker <= completedMarker) {
+        m_Tail = m_Regions[released].end;
+        m_Used -= m_Regions[released].bytes;
+        released++;
+    }
+    if (released > 0) {
+        m_Regions.erase(m_Regions.begin(), m_Regions.begin() + released);
+    }
+
+    // Restart at the beginning when empty to keep large uploads contiguous
+    if (m_Used == 0) {
+        m_Head = m_Tail = 0;
+    }
+
+    for (size_t i = 0; i < m_Overflow.size();) {
+        if (m_Overflow[i].retired && m_Overflow[i].marker <= completedMarker) {
+            m_Context->GetAllocator().DestroyBuffer(m_Overflow[i].buffer, m_Overflow[i].allocation);
+            m_Overflow[i] = m_Overflow.back();
+            m_Overflow.pop_back();
+        } else {
+            i++;
+        }
+    }
+}
+
+void StagingRing::ReleaseAll() {
+    Release(~0ull);
+}
+
+} // namespace tvk
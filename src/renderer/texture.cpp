@@ -6,8 +6,11 @@
 #include "tinyvk/renderer/texture.h"
 #include "tinyvk/renderer/renderer.h"
 #include "tinyvk/renderer/context.h"
+#include "tinyvk/renderer/upload_batch.h"
+#include "tinyvk/renderer/texture_file.h"
 #include "tinyvk/core/log.h"
 
+#include <imgui.h>
 #include <imgui_impl_vulkan.h>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -26,19 +29,28 @@ Texture::Texture(Texture&& other) noexcept
     : m_Renderer(other.m_Renderer)
     , m_Context(other.m_Context)
     , m_Image(other.m_Image)
-    , m_ImageMemory(other.m_ImageMemory)
+    , m_ImageAllocation(other.m_ImageAllocation)
     , m_ImageView(other.m_ImageView)
     , m_Sampler(other.m_Sampler)
+    , m_BindlessIndex(other.m_BindlessIndex)
+    , m_BindlessSamplerIndex(other.m_BindlessSamplerIndex)
     , m_Format(other.m_Format)
+    , m_TextureFormat(other.m_TextureFormat)
     , m_ImGuiDescriptorSet(other.m_ImGuiDescriptorSet)
+    , m_PlaceholderDescriptorSet(other.m_PlaceholderDescriptorSet)
+    , m_State(other.m_State)
     , m_Width(other.m_Width)
     , m_Height(other.m_Height)
     , m_MipLevels(other.m_MipLevels)
+    , m_SourceWidth(other.m_SourceWidth)
+    , m_SourceHeight(other.m_SourceHeight)
     , m_FilePath(std::move(other.m_FilePath)) {
     other.m_Image = VK_NULL_HANDLE;
-    other.m_ImageMemory = VK_NULL_HANDLE;
+    other.m_ImageAllocation = Allocation{};
     other.m_ImageView = VK_NULL_HANDLE;
     other.m_Sampler = VK_NULL_HANDLE;
+    other.m_BindlessIndex = BindlessHeap::InvalidIndex;
+    other.m_BindlessSamplerIndex = BindlessHeap::InvalidIndex;
     other.m_ImGuiDescriptorSet = VK_NULL_HANDLE;
 }
 
@@ -48,26 +60,77 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         m_Renderer = other.m_Renderer;
         m_Context = other.m_Context;
         m_Image = other.m_Image;
-        m_ImageMemory = other.m_ImageMemory;
+        m_ImageAllocation = other.m_ImageAllocation;
         m_ImageView = other.m_ImageView;
         m_Sampler = other.m_Sampler;
+        m_BindlessIndex = other.m_BindlessIndex;
+        m_BindlessSamplerIndex = other.m_BindlessSamplerIndex;
         m_Format = other.m_Format;
+        m_TextureFormat = other.m_TextureFormat;
         m_ImGuiDescriptorSet = other.m_ImGuiDescriptorSet;
+        m_PlaceholderDescriptorSet = other.m_PlaceholderDescriptorSet;
+        m_State = other.m_State;
         m_Width = other.m_Width;
         m_Height = other.m_Height;
         m_MipLevels = other.m_MipLevels;
+        m_SourceWidth = other.m_SourceWidth;
+        m_SourceHeight = other.m_SourceHeight;
         m_FilePath = std::move(other.m_FilePath);
 
         other.m_Image = VK_NULL_HANDLE;
-        other.m_ImageMemory = VK_NULL_HANDLE;
+        other.m_ImageAllocation = Allocation{};
         other.m_ImageView = VK_NULL_HANDLE;
         other.m_Sampler = VK_NULL_HANDLE;
+        other.m_BindlessIndex = BindlessHeap::InvalidIndex;
+        other.m_BindlessSamplerIndex = BindlessHeap::InvalidIndex;
         other.m_ImGuiDescriptorSet = VK_NULL_HANDLE;
     }
     return *this;
 }
 
 Ref<Texture> Texture::LoadFromFile(Renderer* renderer, const std::string& filepath, const TextureSpec& spec) {
+    return LoadFromFile(renderer, nullptr, filepath, spec);
+}
+
+Ref<Texture> Texture::LoadFromFile(UploadBatch& batch, const std::string& filepath, const TextureSpec& spec) {
+    return LoadFromFile(batch.GetRenderer(), &batch, filepath, spec);
+}
+
+Ref<Texture> Texture::LoadFromFile(Renderer* renderer, UploadBatch* batch, const std::string& filepath, const TextureSpec& spec) {
+    if (TextureFile::IsContainer(filepath)) {
+        TextureFile file;
+        if (!file.Open(filepath)) {
+            return nullptr;
+        }
+        u32 sourceWidth = file.GetWidth();
+        u32 sourceHeight = file.GetHeight();
+        if (spec.maxSize > 0) {
+            file.SkipLevels(spec.maxSize);
+        }
+        if (!IsFormatSupported(renderer, file.GetFormat())) {
+            TVK_LOG_ERROR("Texture format of {} is not supported by the device", filepath);
+            return nullptr;
+        }
+
+        TextureSpec finalSpec = spec;
+        finalSpec.width = file.GetWidth();
+        finalSpec.height = file.GetHeight();
+        finalSpec.format = file.GetFormat();
+
+        auto texture = CreateRef<Texture>();
+        texture->m_FilePath = filepath;
+
+        // Mapped texels go straight into staging memory, the stored mips are kept
+        if (!texture->InitWithLevels(renderer, file.GetData(), file.GetDataSize(), file.GetLevels(), finalSpec, batch)) {
+            return nullptr;
+        }
+        texture->m_SourceWidth = sourceWidth;
+        texture->m_SourceHeight = sourceHeight;
+
+        TVK_LOG_INFO("Loaded texture: {} ({}x{}, {} mips)", filepath, file.GetWidth(), file.GetHeight(), file.GetLevels().size());
+        return texture;
+    }
+
     int width, height, channels;
     stbi_uc* pixels = stbi_load(filepath.c_str(), &width, &height, &channels, STBI_rgb_alpha);
     
@@ -79,18 +142,23 @@ Ref<Texture> Texture::LoadFromFile(Renderer* renderer, const std::string& filepa
     TextureSpec finalSpec = spec;
     finalSpec.width = static_cast<u32>(width);
     finalSpec.height = static_cast<u32>(height);
+    if (spec.maxSize > 0) {
+        Downsample(pixels, finalSpec.width, finalSpec.height, spec.maxSize);
+    }
 
     auto texture = CreateRef<Texture>();
     texture->m_FilePath = filepath;
     
-    if (!texture->Init(renderer, pixels, finalSpec)) {
+    if (!texture->Init(renderer, pixels, finalSpec, batch)) {
         stbi_image_free(pixels);
         return nullptr;
     }
 
     stbi_image_free(pixels);
+    texture->m_SourceWidth = static_cast<u32>(width);
+    texture->m_SourceHeight = static_cast<u32>(height);
     
-    TVK_LOG_INFO("Loaded texture: {} ({}x{})", filepath, width, height);
+    TVK_LOG_INFO("Loaded texture: {} ({}x{})", filepath, finalSpec.width, finalSpec.height);
     return texture;
 }
 
@@ -106,146 +174,129 @@ Ref<Texture> Texture::Create(Renderer* renderer, const void* data, u32 width, u3
     return texture;
 }
 
+Ref<Texture> Texture::Create(UploadBatch& batch, const void* data, u32 width, u32 height, const TextureSpec& spec) {
+    TextureSpec finalSpec = spec;
+    finalSpec.width = width;
+    finalSpec.height = height;
+
+    auto texture = CreateRef<Texture>();
+    if (!texture->Init(batch.GetRenderer(), data, finalSpec, &batch)) {
+        return nullptr;
+    }
+    return texture;
+}
+
 Ref<Texture> Texture::Create(Renderer* renderer, const TextureSpec& spec) {
     // Create with null data (empty texture)
-    std::vector<u8> emptyData(spec.width * spec.height * 4, 255);
+    std::vector<u8> emptyData(static_cast<size_t>(GetImageSize(spec.format, spec.width, spec.height)), 255);
     return Create(renderer, emptyData.data(), spec.width, spec.height, spec);
 }
 
 void Texture::SetData(const void* data, u32 width, u32 height) {
     if (!m_Context || !data) return;
     
-    VkDeviceSize imageSize = width * height * 4;
-
-    // Create staging buffer
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
-
-    VkBufferCreateInfo bufferInfo{};
-    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    bufferInfo.size = imageSize;
-    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-
-    vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &stagingBuffer);
-
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(m_Context->GetDevice(), stagingBuffer, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = m_Context->FindMemoryType(
-        memRequirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
-
-    vkAllocateMemory(m_Context->GetDevice(), &allocInfo, nullptr, &stagingBufferMemory);
-    vkBindBufferMemory(m_Context->GetDevice(), stagingBuffer, stagingBufferMemory, 0);
-
-    void* mappedData;
-    vkMapMemory(m_Context->GetDevice(), stagingBufferMemory, 0, imageSize, 0, &mappedData);
-    memcpy(mappedData, data, static_cast<size_t>(imageSize));
-    vkUnmapMemory(m_Context->GetDevice(), stagingBufferMemory);
+    VkDeviceSize imageSize = GetImageSize(m_TextureFormat, width, height);
 
-    TransitionImageLayout(m_Image, m_Format, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 
-                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_MipLevels);
-    CopyBufferToImage(stagingBuffer, m_Image, width, height);
-    TransitionImageLayout(m_Image, m_Format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                         VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_MipLevels);
-
-    vkDestroyBuffer(m_Context->GetDevice(), stagingBuffer, nullptr);
-    vkFreeMemory(m_Context->GetDevice(), stagingBufferMemory, nullptr);
+    UploadBatch batch(m_Renderer);
+    batch.Upload(*this, data, imageSize);
+    batch.Record();
 }
 
 void Texture::BindToImGui() {
     if (m_ImGuiDescriptorSet != VK_NULL_HANDLE) return;
     if (!m_ImageView || !m_Sampler) return;
 
+    // Headless renderers run without ImGui or its Vulkan backend
+    if (!ImGui::GetCurrentContext() || !ImGui::GetIO().BackendRendererUserData) return;
+
     m_ImGuiDescriptorSet = ImGui_ImplVulkan_AddTexture(
         m_Sampler, m_ImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
     );
 }
 
-bool Texture::Init(Renderer* renderer, const void* data, const TextureSpec& spec) {
-    m_Renderer = renderer;
-    m_Context = &renderer->GetContext();
-    m_Width = spec.width;
-    m_Height = spec.height;
-    m_Format = ToVkFormat(spec.format);
-    m_StorageUsage = spec.storageUsage;
-
-    if (spec.generateMipmaps) {
-        m_MipLevels = static_cast<u32>(std::floor(std::log2(std::max(m_Width, m_Height)))) + 1;
+bool Texture::Init(Renderer* renderer, const void* data, const TextureSpec& spec, UploadBatch* batch) {
+    if (!CreateResources(renderer, spec)) {
+        return false;
     }
 
-    VkDeviceSize imageSize = m_Width * m_Height * 4;
-
-    // Create staging buffer
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
+    // Copy, mipmaps and transition to shader read, recorded ahead of the current frame
+    UploadBatch localBatch(renderer);
+    UploadBatch& uploads = batch ? *batch : localBatch;
+    if (!uploads.Upload(*this, data, GetImageSize(m_TextureFormat, m_Width, m_Height), VK_IMAGE_LAYOUT_UNDEFINED)) {
+        TVK_LOG_ERROR("Failed to allocate staging memory for texture");
+        return false;
+    }
+    localBatch.Record();
 
-    VkBufferCreateInfo bufferInfo{};
-    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-    bufferInfo.size = imageSize;
-    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    return true;
+}
 
-    if (vkCreateBuffer(m_Context->GetDevice(), &bufferInfo, nullptr, &stagingBuffer) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to create staging buffer for texture");
+bool Texture::InitWithLevels(Renderer* renderer, const void* data, VkDeviceSize size, const std::vector<TextureMipLevel>& levels,
+                             const TextureSpec& spec, UploadBatch* batch) {
+    if (!CreateResources(renderer, spec, static_cast<u32>(levels.size()))) {
         return false;
     }
 
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(m_Context->GetDevice(), stagingBuffer, &memRequirements);
+    UploadBatch localBatch(renderer);
+    UploadBatch& uploads = batch ? *batch : localBatch;
+    if (!uploads.Upload(*this, data, size, levels, VK_IMAGE_LAYOUT_UNDEFINED)) {
+        TVK_LOG_ERROR("Failed to allocate staging memory for texture");
+        return false;
+    }
+    localBatch.Record();
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = m_Context->FindMemoryType(
-        memRequirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-    );
+    return true;
+}
 
-    vkAllocateMemory(m_Context->GetDevice(), &allocInfo, nullptr, &stagingBufferMemory);
-    vkBindBufferMemory(m_Context->GetDevice(), stagingBuffer, stagingBufferMemory, 0);
+bool Texture::CreateResources(Renderer* renderer, const TextureSpec& spec, u32 mipLevels) {
+    m_Renderer = renderer;
+    m_Context = &renderer->GetContext();
+    m_Width = spec.width;
+    m_Height = spec.height;
+    m_SourceWidth = spec.width;
+    m_SourceHeight = spec.height;
+    m_Format = ToVkFormat(spec.format);
+    m_TextureFormat = spec.format;
+    m_StorageUsage = spec.storageUsage;
 
-    void* mappedData;
-    vkMapMemory(m_Context->GetDevice(), stagingBufferMemory, 0, imageSize, 0, &mappedData);
-    memcpy(mappedData, data, static_cast<size_t>(imageSize));
-    vkUnmapMemory(m_Context->GetDevice(), stagingBufferMemory);
+    // Compressed formats cannot be blitted, their mips have to come with the data
+    if (mipLevels > 0) {
+        m_MipLevels = mipLevels;
+    } else if (spec.generateMipmaps && !IsCompressed(spec.format)) {
+        // Mips are generated by linear blits, without them the levels would stay uninitialized
+        VkFormatProperties formatProperties;
+        vkGetPhysicalDeviceFormatProperties(m_Context->GetPhysicalDevice(), m_Format, &formatProperties);
+        if (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) {
+            m_MipLevels = static_cast<u32>(std::floor(std::log2(std::max(m_Width, m_Height)))) + 1;
+        } else {
+            TVK_LOG_WARN("Texture format does not support linear blitting, mipmaps will not be generated");
+        }
+    }
 
     // Create image
     VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
     if (spec.storageUsage) {
         usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
     }
-    CreateImage(m_Width, m_Height, m_Format, VK_IMAGE_TILING_OPTIMAL,
-               usageFlags,
-               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    // Transition and copy
-    TransitionImageLayout(m_Image, m_Format, VK_IMAGE_LAYOUT_UNDEFINED, 
-                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_MipLevels);
-    CopyBufferToImage(stagingBuffer, m_Image, m_Width, m_Height);
-
-    // Generate mipmaps or transition to shader read
-    if (spec.generateMipmaps && m_MipLevels > 1) {
-        GenerateMipmaps(m_Image, m_Format, m_Width, m_Height, m_MipLevels);
-    } else {
-        TransitionImageLayout(m_Image, m_Format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, m_MipLevels);
+    if (!CreateImage(m_Width, m_Height, m_Format, VK_IMAGE_TILING_OPTIMAL,
+                     usageFlags,
+                     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+        return false;
     }
 
-    vkDestroyBuffer(m_Context->GetDevice(), stagingBuffer, nullptr);
-    vkFreeMemory(m_Context->GetDevice(), stagingBufferMemory, nullptr);
-
     // Create image view
     CreateImageView(m_Format, VK_IMAGE_ASPECT_COLOR_BIT);
 
     // Create sampler
     if (spec.useSampler) {
-        CreateSampler(spec);
+        m_Sampler = m_Context->GetSamplerCache().Acquire(GetSamplerDesc(spec));
+    }
+
+    // Stable indices for bindless shaders, the image is only read once its upload completed
+    BindlessHeap& heap = renderer->GetBindlessHeap();
+    if (heap.IsEnabled()) {
+        m_BindlessIndex = heap.AddImage(m_ImageView);
+        m_BindlessSamplerIndex = heap.AddSampler(m_Sampler);
     }
 
     // Bind to ImGui by default
@@ -257,15 +308,30 @@ bool Texture::Init(Renderer* renderer, const void* data, const TextureSpec& spec
 void Texture::Cleanup() {
     if (!m_Context) return;
     
-    m_Context->WaitIdle();
+    // Pending upload commands may still reference the image
+    if (m_WaitIdleOnCleanup) {
+        m_Renderer->SubmitUploads();
+        m_Context->WaitIdle();
+    }
 
     if (m_ImGuiDescriptorSet != VK_NULL_HANDLE) {
         ImGui_ImplVulkan_RemoveTexture(m_ImGuiDescriptorSet);
         m_ImGuiDescriptorSet = VK_NULL_HANDLE;
     }
 
+    // Indices are reused once frames recorded so far have completed
+    BindlessHeap& heap = m_Renderer->GetBindlessHeap();
+    if (m_BindlessIndex != BindlessHeap::InvalidIndex) {
+        heap.RemoveImage(m_BindlessIndex, m_Renderer->GetFrameNumber());
+        m_BindlessIndex = BindlessHeap::InvalidIndex;
+    }
+    if (m_BindlessSamplerIndex != BindlessHeap::InvalidIndex) {
+        heap.RemoveSampler(m_Sampler, m_Renderer->GetFrameNumber());
+        m_BindlessSamplerIndex = BindlessHeap::InvalidIndex;
+    }
+
     if (m_Sampler != VK_NULL_HANDLE) {
-        vkDestroySampler(m_Context->GetDevice(), m_Sampler, nullptr);
+        m_Context->GetSamplerCache().Release(m_Sampler);
         m_Sampler = VK_NULL_HANDLE;
     }
 
@@ -274,18 +340,13 @@ void Texture::Cleanup() {
         m_ImageView = VK_NULL_HANDLE;
     }
 
-    if (m_Image != VK_NULL_HANDLE) {
-        vkDestroyImage(m_Context->GetDevice(), m_Image, nullptr);
+    if (m_Image != VK_NULL_HANDLE || m_ImageAllocation.IsValid()) {
+        m_Context->GetAllocator().DestroyImage(m_Image, m_ImageAllocation);
         m_Image = VK_NULL_HANDLE;
     }
-
-    if (m_ImageMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(m_Context->GetDevice(), m_ImageMemory, nullptr);
-        m_ImageMemory = VK_NULL_HANDLE;
-    }
 }
 
-void Texture::CreateImage(u32 width, u32 height, VkFormat format, VkImageTiling tiling,
+bool Texture::CreateImage(u32 width, u32 height, VkFormat format, VkImageTiling tiling,
                           VkImageUsageFlags usage, VkMemoryPropertyFlags properties) {
     VkImageCreateInfo imageInfo{};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -302,18 +363,11 @@ void Texture::CreateImage(u32 width, u32 height, VkFormat format, VkImageTiling
     imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-    vkCreateImage(m_Context->GetDevice(), &imageInfo, nullptr, &m_Image);
-
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(m_Context->GetDevice(), m_Image, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = m_Context->FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-    vkAllocateMemory(m_Context->GetDevice(), &allocInfo, nullptr, &m_ImageMemory);
-    vkBindImageMemory(m_Context->GetDevice(), m_Image, m_ImageMemory, 0);
+    if (!m_Context->GetAllocator().CreateImage(imageInfo, properties, m_Image, m_ImageAllocation)) {
+        TVK_LOG_ERROR("Failed to create texture image");
+        return false;
+    }
+    return true;
 }
 
 void Texture::CreateImageView(VkFormat format, VkImageAspectFlags aspectFlags) {
@@ -331,173 +385,15 @@ void Texture::CreateImageView(VkFormat format, VkImageAspectFlags aspectFlags) {
     vkCreateImageView(m_Context->GetDevice(), &viewInfo, nullptr, &m_ImageView);
 }
 
-void Texture::CreateSampler(const TextureSpec& spec) {
-    VkPhysicalDeviceProperties properties{};
-    vkGetPhysicalDeviceProperties(m_Context->GetPhysicalDevice(), &properties);
-
-    VkSamplerCreateInfo samplerInfo{};
-    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-    samplerInfo.magFilter = ToVkFilter(spec.magFilter);
-    samplerInfo.minFilter = ToVkFilter(spec.minFilter);
-    samplerInfo.addressModeU = ToVkWrap(spec.wrapU);
-    samplerInfo.addressModeV = ToVkWrap(spec.wrapV);
-    samplerInfo.addressModeW = ToVkWrap(spec.wrapU);
-    samplerInfo.anisotropyEnable = VK_TRUE;
-    samplerInfo.maxAnisotropy = properties.limits.maxSamplerAnisotropy;
-    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
-    samplerInfo.unnormalizedCoordinates = VK_FALSE;
-    samplerInfo.compareEnable = VK_FALSE;
-    samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
-    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-    samplerInfo.minLod = 0.0f;
-    samplerInfo.maxLod = static_cast<float>(m_MipLevels);
-    samplerInfo.mipLodBias = 0.0f;
-
-    vkCreateSampler(m_Context->GetDevice(), &samplerInfo, nullptr, &m_Sampler);
-}
-
-void Texture::TransitionImageLayout(VkImage image, VkFormat format,
-                                    VkImageLayout oldLayout, VkImageLayout newLayout, u32 mipLevels) {
-    VkCommandBuffer commandBuffer = m_Context->BeginSingleTimeCommands();
-
-    VkImageMemoryBarrier barrier{};
-    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    barrier.oldLayout = oldLayout;
-    barrier.newLayout = newLayout;
-    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.image = image;
-    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    barrier.subresourceRange.baseMipLevel = 0;
-    barrier.subresourceRange.levelCount = mipLevels;
-    barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = 1;
-
-    VkPipelineStageFlags sourceStage;
-    VkPipelineStageFlags destinationStage;
-
-    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-        barrier.srcAccessMask = 0;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-        destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-        sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-    } else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-        barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        sourceStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-        destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    } else {
-        barrier.srcAccessMask = 0;
-        barrier.dstAccessMask = 0;
-        sourceStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-        destinationStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
-    }
-
-    vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0,
-                         0, nullptr, 0, nullptr, 1, &barrier);
-
-    m_Context->EndSingleTimeCommands(commandBuffer);
-}
-
-void Texture::CopyBufferToImage(VkBuffer buffer, VkImage image, u32 width, u32 height) {
-    VkCommandBuffer commandBuffer = m_Context->BeginSingleTimeCommands();
-
-    VkBufferImageCopy region{};
-    region.bufferOffset = 0;
-    region.bufferRowLength = 0;
-    region.bufferImageHeight = 0;
-    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.imageSubresource.mipLevel = 0;
-    region.imageSubresource.baseArrayLayer = 0;
-    region.imageSubresource.layerCount = 1;
-    region.imageOffset = {0, 0, 0};
-    region.imageExtent = {width, height, 1};
-
-    vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-    m_Context->EndSingleTimeCommands(commandBuffer);
-}
-
-void Texture::GenerateMipmaps(VkImage image, VkFormat format, u32 width, u32 height, u32 mipLevels) {
-    VkFormatProperties formatProperties;
-    vkGetPhysicalDeviceFormatProperties(m_Context->GetPhysicalDevice(), format, &formatProperties);
-
-    if (!(formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)) {
-        TVK_LOG_WARN("Texture format does not support linear blitting, mipmaps will not be generated");
-        TransitionImageLayout(image, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, mipLevels);
-        return;
-    }
-
-    VkCommandBuffer commandBuffer = m_Context->BeginSingleTimeCommands();
-
-    VkImageMemoryBarrier barrier{};
-    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-    barrier.image = image;
-    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = 1;
-    barrier.subresourceRange.levelCount = 1;
-
-    i32 mipWidth = static_cast<i32>(width);
-    i32 mipHeight = static_cast<i32>(height);
-
-    for (u32 i = 1; i < mipLevels; i++) {
-        barrier.subresourceRange.baseMipLevel = i - 1;
-        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-
-        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                             0, nullptr, 0, nullptr, 1, &barrier);
-
-        VkImageBlit blit{};
-        blit.srcOffsets[0] = {0, 0, 0};
-        blit.srcOffsets[1] = {mipWidth, mipHeight, 1};
-        blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        blit.srcSubresource.mipLevel = i - 1;
-        blit.srcSubresource.baseArrayLayer = 0;
-        blit.srcSubresource.layerCount = 1;
-        blit.dstOffsets[0] = {0, 0, 0};
-        blit.dstOffsets[1] = {mipWidth > 1 ? mipWidth / 2 : 1, mipHeight > 1 ? mipHeight / 2 : 1, 1};
-        blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        blit.dstSubresource.mipLevel = i;
-        blit.dstSubresource.baseArrayLayer = 0;
-        blit.dstSubresource.layerCount = 1;
-
-        vkCmdBlitImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                       image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
-
-        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                             0, nullptr, 0, nullptr, 1, &barrier);
-
-        if (mipWidth > 1) mipWidth /= 2;
-        if (mipHeight > 1) mipHeight /= 2;
-    }
-
-    barrier.subresourceRange.baseMipLevel = mipLevels - 1;
-    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                         0, nullptr, 0, nullptr, 1, &barrier);
-
-    m_Context->EndSingleTimeCommands(commandBuffer);
+SamplerDesc Texture::GetSamplerDesc(const TextureSpec& spec) {
+    SamplerDesc desc;
+    desc.magFilter = ToVkFilter(spec.magFilter);
+    desc.minFilter = ToVkFilter(spec.minFilter);
+    desc.addressModeU = ToVkWrap(spec.wrapU);
+    desc.addressModeV = ToVkWrap(spec.wrapV);
+    desc.addressModeW = ToVkWrap(spec.wrapU);
+    desc.maxAnisotropy = 16.0f;   // Clamped to what the device supports
+    return desc;
 }
 
 VkFormat Texture::ToVkFormat(TextureFormat format) {
@@ -513,10 +409,116 @@ VkFormat Texture::ToVkFormat(TextureFormat format) {
         case TextureFormat::RGBA32F: return VK_FORMAT_R32G32B32A32_SFLOAT;
         case TextureFormat::Depth24Stencil8: return VK_FORMAT_D24_UNORM_S8_UINT;
         case TextureFormat::Depth32F: return VK_FORMAT_D32_SFLOAT;
+        case TextureFormat::BC1: return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case TextureFormat::BC1_SRGB: return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case TextureFormat::BC3: return VK_FORMAT_BC3_UNORM_BLOCK;
+        case TextureFormat::BC3_SRGB: return VK_FORMAT_BC3_SRGB_BLOCK;
+        case TextureFormat::BC4: return VK_FORMAT_BC4_UNORM_BLOCK;
+        case TextureFormat::BC5: return VK_FORMAT_BC5_UNORM_BLOCK;
+        case TextureFormat::BC6H: return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case TextureFormat::BC7: return VK_FORMAT_BC7_UNORM_BLOCK;
+        case TextureFormat::BC7_SRGB: return VK_FORMAT_BC7_SRGB_BLOCK;
+        case TextureFormat::ETC2_RGB8: return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        case TextureFormat::ETC2_RGB8_SRGB: return VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK;
+        case TextureFormat::ETC2_RGBA8: return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+        case TextureFormat::ETC2_RGBA8_SRGB: return VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK;
+        case TextureFormat::ASTC_4x4: return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+        case TextureFormat::ASTC_4x4_SRGB: return VK_FORMAT_ASTC_4x4_SRGB_BLOCK;
         default: return VK_FORMAT_R8G8B8A8_UNORM;
     }
 }
 
+bool Texture::FromVkFormat(VkFormat vkFormat, TextureFormat& format) {
+    for (u32 i = 0; i <= static_cast<u32>(TextureFormat::ASTC_4x4_SRGB); i++) {
+        if (ToVkFormat(static_cast<TextureFormat>(i)) == vkFormat) {
+            format = static_cast<TextureFormat>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Texture::IsFormatSupported(Renderer* renderer, TextureFormat format) {
+    return renderer->GetContext().IsFormatSupported(ToVkFormat(format), VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT);
+}
+
+bool Texture::IsCompressed(TextureFormat format) {
+    return format >= TextureFormat::BC1;
+}
+
+u32 Texture::GetChannelCount(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::R8:
+        case TextureFormat::Depth32F:
+        case TextureFormat::BC4:
+            return 1;
+        case TextureFormat::RG8:
+        case TextureFormat::Depth24Stencil8:
+        case TextureFormat::BC5:
+            return 2;
+        case TextureFormat::RGB8:
+        case TextureFormat::BC6H:
+        case TextureFormat::ETC2_RGB8:
+        case TextureFormat::ETC2_RGB8_SRGB:
+            return 3;
+        default:
+            return 4;
+    }
+}
+
+VkDeviceSize Texture::GetImageSize(TextureFormat format, u32 width, u32 height) {
+    if (IsCompressed(format)) {
+        VkDeviceSize blockBytes = 16;
+        switch (format) {
+            case TextureFormat::BC1:
+            case TextureFormat::BC1_SRGB:
+            case TextureFormat::BC4:
+            case TextureFormat::ETC2_RGB8:
+            case TextureFormat::ETC2_RGB8_SRGB:
+                blockBytes = 8;
+                break;
+            default:
+                break;
+        }
+        return static_cast<VkDeviceSize>((width + 3) / 4) * ((height + 3) / 4) * blockBytes;
+    }
+
+    VkDeviceSize texelBytes = 4;
+    switch (format) {
+        case TextureFormat::R8: texelBytes = 1; break;
+        case TextureFormat::RG8: texelBytes = 2; break;
+        case TextureFormat::RGB8: texelBytes = 3; break;
+        case TextureFormat::RGBA16F: texelBytes = 8; break;
+        case TextureFormat::RGBA32F: texelBytes = 16; break;
+        default: break;
+    }
+    return static_cast<VkDeviceSize>(width) * height * texelBytes;
+}
+
+void Texture::Downsample(u8* pixels, u32& width, u32& height, u32 maxSize) {
+    while (width > maxSize || height > maxSize) {
+        u32 newWidth = std::max(1u, width / 2);
+        u32 newHeight = std::max(1u, height / 2);
+
+        // 2x2 box filter, every write lands at or before the texels it reads so it works in place
+        for (u32 y = 0; y < newHeight; y++) {
+            u32 y0 = std::min(y * 2, height - 1);
+            u32 y1 = std::min(y * 2 + 1, height - 1);
+            for (u32 x = 0; x < newWidth; x++) {
+                u32 x0 = std::min(x * 2, width - 1);
+                u32 x1 = std::min(x * 2 + 1, width - 1);
+                for (u32 c = 0; c < 4; c++) {
+                    u32 sum = pixels[(y0 * width + x0) * 4 + c] + pixels[(y0 * width + x1) * 4 + c] +
+                              pixels[(y1 * width + x0) * 4 + c] + pixels[(y1 * width + x1) * 4 + c];
+                    pixels[(y * newWidth + x) * 4 + c] = static_cast<u8>((sum + 2) / 4);
+                }
+            }
+        }
+        width = newWidth;
+        height = newHeight;
+    }
+}
+
 VkFilter Texture::ToVkFilter(TextureFilter filter) {
     switch (filter) {
         case TextureFilter::Nearest: return VK_FILTER_NEAREST;
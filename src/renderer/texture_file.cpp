@@ -0,0 +1,354 @@
+/**
+ * @file texture_file.cpp
+ * @brief KTX2 and DDS container parsing
+ */
+
+#include "tinyvk/renderer/texture_file.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace tvk {
+
+static constexpr u8 s_Ktx2Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+struct Ktx2Header {
+    u32 vkFormat;
+    u32 typeSize;
+    u32 pixelWidth;
+    u32 pixelHeight;
+    u32 pixelDepth;
+    u32 layerCount;
+    u32 faceCount;
+    u32 levelCount;
+    u32 supercompressionScheme;
+    u32 dfdByteOffset;
+    u32 dfdByteLength;
+    u32 kvdByteOffset;
+    u32 kvdByteLength;
+    u32 sgdByteOffset[2];   // u64 in the file, split so the struct has no padding
+    u32 sgdByteLength[2];
+};
+static_assert(sizeof(Ktx2Header) == 68, "KTX2 header layout");
+
+struct Ktx2Level {
+    u64 byteOffset;
+    u64 byteLength;
+    u64 uncompressedByteLength;
+};
+
+struct DdsPixelFormat {
+    u32 size;
+    u32 flags;
+    u32 fourCC;
+    u32 rgbBitCount;
+    u32 rBitMask;
+    u32 gBitMask;
+    u32 bBitMask;
+    u32 aBitMask;
+};
+
+struct DdsHeader {
+    u32 size;
+    u32 flags;
+    u32 height;
+    u32 width;
+    u32 pitchOrLinearSize;
+    u32 depth;
+    u32 mipMapCount;
+    u32 reserved1[11];
+    DdsPixelFormat pixelFormat;
+    u32 caps;
+    u32 caps2;
+    u32 caps3;
+    u32 caps4;
+    u32 reserved2;
+};
+static_assert(sizeof(DdsHeader) == 124, "DDS header layout");
+
+struct DdsHeaderDx10 {
+    u32 dxgiFormat;
+    u32 resourceDimension;
+    u32 miscFlag;
+    u32 arraySize;
+    u32 miscFlags2;
+};
+
+static constexpr u32 MakeFourCC(char a, char b, char c, char d) {
+    return static_cast<u32>(a) | (static_cast<u32>(b) << 8) | (static_cast<u32>(c) << 16) | (static_cast<u32>(d) << 24);
+}
+
+static constexpr u32 s_DdsPixelFormatFourCC = 0x4;
+static constexpr u32 s_DdsPixelFormatRGB = 0x40;
+static constexpr u32 s_DdsCaps2CubeMap = 0x200;
+static constexpr u32 s_DdsCaps2Volume = 0x200000;
+static constexpr u32 s_DdsDimensionTexture2D = 3;
+
+static bool FromDxgiFormat(u32 dxgiFormat, TextureFormat& format) {
+    switch (dxgiFormat) {
+        case 2:  format = TextureFormat::RGBA32F; return true;
+        case 10: format = TextureFormat::RGBA16F; return true;
+        case 28: format = TextureFormat::RGBA8; return true;
+        case 29: format = TextureFormat::RGBA8_SRGB; return true;
+        case 49: format = TextureFormat::RG8; return true;
+        case 61: format = TextureFormat::R8; return true;
+        case 71: format = TextureFormat::BC1; return true;
+        case 72: format = TextureFormat::BC1_SRGB; return true;
+        case 77: format = TextureFormat::BC3; return true;
+        case 78: format = TextureFormat::BC3_SRGB; return true;
+        case 80: format = TextureFormat::BC4; return true;
+        case 83: format = TextureFormat::BC5; return true;
+        case 87: format = TextureFormat::BGRA8; return true;
+        case 91: format = TextureFormat::BGRA8_SRGB; return true;
+        case 95: format = TextureFormat::BC6H; return true;
+        case 98: format = TextureFormat::BC7; return true;
+        case 99: format = TextureFormat::BC7_SRGB; return true;
+        default: return false;
+    }
+}
+
+// Full mip chain of the larger side, never more than 32 so shifts by the level stay defined
+static u32 GetMaxLevelCount(u32 width, u32 height) {
+    u32 size = std::max(width, height);
+    u32 count = 0;
+    while (size > 0) {
+        size >>= 1;
+        count++;
+    }
+    return std::max(1u, count);
+}
+
+bool TextureFile::IsContainer(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos) return false;
+
+    std::string extension = path.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == "ktx2" || extension == "dds";
+}
+
+bool TextureFile::Open(const std::string& path) {
+    Close();
+
+    if (!m_File.Open(path)) {
+        return false;
+    }
+
+    const u8* data = m_File.GetData();
+    size_t size = m_File.GetSize();
+
+    bool parsed = false;
+    if (size >= sizeof(s_Ktx2Identifier) + sizeof(Ktx2Header) &&
+        std::memcmp(data, s_Ktx2Identifier, sizeof(s_Ktx2Identifier)) == 0) {
+        parsed = ParseKtx2(path);
+    } else if (size >= 4 + sizeof(DdsHeader) && std::memcmp(data, "DDS ", 4) == 0) {
+        parsed = ParseDds(path);
+    } else {
+        TVK_LOG_ERROR("Not a KTX2 or DDS file: {}", path);
+    }
+
+    if (!parsed) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void TextureFile::Close() {
+    m_File.Close();
+    m_Levels.clear();
+    m_Data = nullptr;
+    m_DataSize = 0;
+    m_Width = 0;
+    m_Height = 0;
+}
+
+void TextureFile::SkipLevels(u32 maxSize) {
+    size_t skip = 0;
+    while (skip + 1 < m_Levels.size() && (m_Levels[skip].width > maxSize || m_Levels[skip].height > maxSize)) {
+        skip++;
+    }
+    if (skip == 0) return;
+
+    m_Levels.erase(m_Levels.begin(), m_Levels.begin() + skip);
+    m_Width = m_Levels[0].width;
+    m_Height = m_Levels[0].height;
+
+    // KTX2 stores the smallest level first, rebase to the remaining range either way
+    VkDeviceSize begin = ~0ull;
+    VkDeviceSize end = 0;
+    for (const auto& level : m_Levels) {
+        begin = std::min(begin, level.offset);
+        end = std::max(end, level.offset + level.size);
+    }
+    for (auto& level : m_Levels) {
+        level.offset -= begin;
+    }
+    m_Data += begin;
+    m_DataSize = end - begin;
+}
+
+bool TextureFile::ParseKtx2(const std::string& path) {
+    Ktx2Header header;
+    std::memcpy(&header, m_File.GetData() + sizeof(s_Ktx2Identifier), sizeof(header));
+
+    if (header.supercompressionScheme != 0) {
+        TVK_LOG_ERROR("Supercompressed KTX2 files are not supported: {}", path);
+        return false;
+    }
+    if (header.pixelDepth > 1 || header.layerCount > 1 || header.faceCount != 1 || header.pixelHeight == 0) {
+        TVK_LOG_ERROR("Only 2D KTX2 textures are supported: {}", path);
+        return false;
+    }
+    if (!Texture::FromVkFormat(static_cast<VkFormat>(header.vkFormat), m_Format)) {
+        TVK_LOG_ERROR("Unsupported KTX2 format {} in {}", header.vkFormat, path);
+        return false;
+    }
+
+    m_Width = header.pixelWidth;
+    m_Height = header.pixelHeight;
+
+    // A level count of 0 asks for generated mips, the file holds the base level only and none are generated
+    u32 levelCount = std::max(1u, header.levelCount);
+    if (header.levelCount == 0) {
+        TVK_LOG_WARN("KTX2 file {} asks for generated mips, only its base level is loaded", path);
+    }
+    if (m_Width == 0 || levelCount > GetMaxLevelCount(m_Width, m_Height)) {
+        TVK_LOG_ERROR("Invalid KTX2 level count {} in {}", header.levelCount, path);
+        return false;
+    }
+
+    size_t indexOffset = sizeof(s_Ktx2Identifier) + sizeof(Ktx2Header);
+    if (m_File.GetSize() < indexOffset || m_File.GetSize() - indexOffset < levelCount * sizeof(Ktx2Level)) {
+        TVK_LOG_ERROR("Corrupt KTX2 level index: {}", path);
+        return false;
+    }
+
+    std::vector<u64> offsets(levelCount);
+    for (u32 i = 0; i < levelCount; i++) {
+        Ktx2Level level;
+        std::memcpy(&level, m_File.GetData() + indexOffset + i * sizeof(Ktx2Level), sizeof(level));
+
+        VkDeviceSize expected = Texture::GetImageSize(m_Format, std::max(1u, m_Width >> i), std::max(1u, m_Height >> i));
+        if (level.byteLength != expected) {
+            TVK_LOG_ERROR("Unexpected size of KTX2 level {} in {}", i, path);
+            return false;
+        }
+        offsets[i] = level.byteOffset;
+    }
+    return SetLevels(path, offsets.data(), levelCount);
+}
+
+bool TextureFile::ParseDds(const std::string& path) {
+    DdsHeader header;
+    std::memcpy(&header, m_File.GetData() + 4, sizeof(header));
+    size_t dataOffset = 4 + sizeof(DdsHeader);
+
+    if (header.size != sizeof(DdsHeader) || (header.caps2 & (s_DdsCaps2CubeMap | s_DdsCaps2Volume)) != 0) {
+        TVK_LOG_ERROR("Only 2D DDS textures are supported: {}", path);
+        return false;
+    }
+
+    const DdsPixelFormat& pixelFormat = header.pixelFormat;
+    bool known = false;
+    if (pixelFormat.flags & s_DdsPixelFormatFourCC) {
+        known = true;
+        switch (pixelFormat.fourCC) {
+            case MakeFourCC('D', 'X', 'T', '1'): m_Format = TextureFormat::BC1; break;
+            case MakeFourCC('D', 'X', 'T', '5'): m_Format = TextureFormat::BC3; break;
+            case MakeFourCC('A', 'T', 'I', '1'):
+            case MakeFourCC('B', 'C', '4', 'U'): m_Format = TextureFormat::BC4; break;
+            case MakeFourCC('A', 'T', 'I', '2'):
+            case MakeFourCC('B', 'C', '5', 'U'): m_Format = TextureFormat::BC5; break;
+            case MakeFourCC('D', 'X', '1', '0'): {
+                DdsHeaderDx10 dx10;
+                if (m_File.GetSize() < dataOffset + sizeof(dx10)) {
+                    known = false;
+                    break;
+                }
+                std::memcpy(&dx10, m_File.GetData() + dataOffset, sizeof(dx10));
+                dataOffset += sizeof(dx10);
+
+                if (dx10.resourceDimension != s_DdsDimensionTexture2D || dx10.arraySize > 1) {
+                    TVK_LOG_ERROR("Only 2D DDS textures are supported: {}", path);
+                    return false;
+                }
+                known = FromDxgiFormat(dx10.dxgiFormat, m_Format);
+                break;
+            }
+            default:
+                known = false;
+                break;
+        }
+    } else if ((pixelFormat.flags & s_DdsPixelFormatRGB) && pixelFormat.rgbBitCount == 32) {
+        known = true;
+        if (pixelFormat.rBitMask == 0x000000FF && pixelFormat.bBitMask == 0x00FF0000) {
+            m_Format = TextureFormat::RGBA8;
+        } else if (pixelFormat.rBitMask == 0x00FF0000 && pixelFormat.bBitMask == 0x000000FF) {
+            m_Format = TextureFormat::BGRA8;
+        } else {
+            known = false;
+        }
+    }
+
+    if (!known) {
+        TVK_LOG_ERROR("Unsupported DDS pixel format in {}", path);
+        return false;
+    }
+
+    m_Width = header.width;
+    m_Height = header.height;
+
+    // Levels follow the headers back to back, largest first
+    u32 levelCount = std::max(1u, header.mipMapCount);
+    if (m_Width == 0 || m_Height == 0 || levelCount > GetMaxLevelCount(m_Width, m_Height)) {
+        TVK_LOG_ERROR("Invalid DDS mip count {} in {}", header.mipMapCount, path);
+        return false;
+    }
+
+    std::vector<u64> offsets(levelCount);
+    u64 offset = dataOffset;
+    for (u32 i = 0; i < levelCount; i++) {
+        offsets[i] = offset;
+        offset += Texture::GetImageSize(m_Format, std::max(1u, m_Width >> i), std::max(1u, m_Height >> i));
+    }
+    return SetLevels(path, offsets.data(), levelCount);
+}
+
+bool TextureFile::SetLevels(const std::string& path, const u64* offsets, u32 levelCount) {
+    if (m_Width == 0 || m_Height == 0 || levelCount > 32) {
+        TVK_LOG_ERROR("Invalid texture dimensions in {}", path);
+        return false;
+    }
+
+    u64 begin = ~0ull;
+    u64 end = 0;
+    m_Levels.resize(levelCount);
+    for (u32 i = 0; i < levelCount; i++) {
+        TextureMipLevel& level = m_Levels[i];
+        level.width = std::max(1u, m_Width >> i);
+        level.height = std::max(1u, m_Height >> i);
+        level.size = Texture::GetImageSize(m_Format, level.width, level.height);
+        level.offset = offsets[i];
+
+        // Checked in 64 bits against the file, offsets come from it
+        if (level.offset > m_File.GetSize() || level.size > m_File.GetSize() - level.offset) {
+            TVK_LOG_ERROR("Texture level {} exceeds the file: {}", i, path);
+            return false;
+        }
+        begin = std::min(begin, level.offset);
+        end = std::max(end, level.offset + level.size);
+    }
+
+    for (auto& level : m_Levels) {
+        level.offset -= begin;
+    }
+    m_Data = m_File.GetData() + begin;
+    m_DataSize = end - begin;
+    return true;
+}
+
+} // namespace tvk
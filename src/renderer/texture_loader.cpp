@@ -0,0 +1,355 @@
+/**
+ * @file texture_loader.cpp
+ * @brief Asynchronous texture loader implementation
+ */
+
+#include "tinyvk/renderer/texture_loader.h"
+#include "tinyvk/renderer/renderer.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/renderer/upload_batch.h"
+#include "tinyvk/renderer/texture_file.h"
+#include "tinyvk/core/log.h"
+
+#include <stb_image.h>
+
+#include <algorithm>
+
+namespace tvk {
+
+TextureLoader::~TextureLoader() {
+    Cleanup();
+}
+
+bool TextureLoader::Init(Renderer* renderer, JobSystem& jobs, VkDeviceSize uploadBudget) {
+    m_Renderer = renderer;
+    m_Jobs = &jobs;
+    m_UploadBudget = uploadBudget;
+
+    // Grey checkerboard, visible but unobtrusive while images stream in
+    const u32 size = 8;
+    std::vector<u32> pixels(size * size);
+    for (u32 y = 0; y < size; y++) {
+        for (u32 x = 0; x < size; x++) {
+            pixels[y * size + x] = ((x / 4 + y / 4) % 2) ? 0xFF808080 : 0xFF505050;
+        }
+    }
+
+    TextureSpec spec;
+    spec.minFilter = TextureFilter::Nearest;
+    spec.magFilter = TextureFilter::Nearest;
+    spec.generateMipmaps = false;
+    m_Placeholder = Texture::Create(renderer, pixels.data(), size, size, spec);
+    if (!m_Placeholder) {
+        TVK_LOG_ERROR("Failed to create placeholder texture");
+        return false;
+    }
+    return true;
+}
+
+void TextureLoader::Cleanup() {
+    if (!m_Jobs) return;
+
+    m_Jobs->Wait(m_Decoding);
+    for (auto& image : m_Decoded) {
+        if (image.pixels) {
+            stbi_image_free(image.pixels);
+        }
+        Finish(*image.texture, TextureState::Failed);
+    }
+    m_Decoded.clear();
+
+    // Acquire callbacks of uploads in flight call back into the loader
+    TransferQueue& transfer = m_Renderer->GetTransferQueue();
+    if (transfer.IsAsync()) {
+        transfer.Submit().Wait();
+    }
+    GenerateMipmaps();
+
+    m_Placeholder.reset();
+    for (; m_PendingCount > 0; m_PendingCount--) {
+        m_Renderer->EndBackgroundWork();
+    }
+    m_Jobs = nullptr;
+    m_Renderer = nullptr;
+}
+
+Ref<Texture> TextureLoader::Load(const std::string& filepath, const TextureSpec& spec) {
+    auto texture = CreateRef<Texture>();
+    texture->m_FilePath = filepath;
+    texture->m_State = TextureState::Pending;
+    texture->m_PlaceholderDescriptorSet = m_Placeholder ? m_Placeholder->GetImGuiTextureID() : VK_NULL_HANDLE;
+    m_PendingCount++;
+    m_Renderer->BeginBackgroundWork();
+
+    m_Jobs->Run([this, texture, filepath, spec]() {
+        DecodedImage image;
+        image.texture = texture;
+        image.spec = spec;
+
+        if (TextureFile::IsContainer(filepath)) {
+            // Read on the worker, the main thread only copies into staging memory
+            TextureFile file;
+            if (file.Open(filepath)) {
+                image.sourceWidth = file.GetWidth();
+                image.sourceHeight = file.GetHeight();
+                if (spec.maxSize > 0) {
+                    file.SkipLevels(spec.maxSize);
+                }
+                image.spec.width = file.GetWidth();
+                image.spec.height = file.GetHeight();
+                image.spec.format = file.GetFormat();
+                image.levels = file.GetLevels();
+                image.levelData.assign(file.GetData(), file.GetData() + file.GetDataSize());
+            }
+        } else {
+            int width, height, channels;
+            image.pixels = stbi_load(filepath.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+            if (image.pixels) {
+                image.spec.width = static_cast<u32>(width);
+                image.spec.height = static_cast<u32>(height);
+                image.sourceWidth = image.spec.width;
+                image.sourceHeight = image.spec.height;
+                if (spec.maxSize > 0) {
+                    Texture::Downsample(image.pixels, image.spec.width, image.spec.height, spec.maxSize);
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_DecodedMutex);
+            m_Decoded.push_back(std::move(image));
+        }
+
+        // An idle on-demand app only calls Update() from a frame
+        m_Renderer->Wake();
+    }, &m_Decoding);
+
+    return texture;
+}
+
+void TextureLoader::Update() {
+    if (!m_Renderer) return;
+
+    // Mip chains of images acquired by the previous frame
+    GenerateMipmaps();
+
+    std::vector<DecodedImage> decoded;
+    {
+        std::lock_guard<std::mutex> lock(m_DecodedMutex);
+
+        VkDeviceSize bytes = 0;
+        size_t count = 0;
+        while (count < m_Decoded.size() && (count == 0 || bytes < m_UploadBudget)) {
+            bytes += m_Decoded[count].GetSize();
+            count++;
+        }
+        decoded.assign(std::make_move_iterator(m_Decoded.begin()), std::make_move_iterator(m_Decoded.begin() + count));
+        m_Decoded.erase(m_Decoded.begin(), m_Decoded.begin() + count);
+    }
+
+    UploadBatch fallback(m_Renderer);
+    for (auto& image : decoded) {
+        Upload(image, fallback);
+    }
+    fallback.Record();
+
+    for (auto& image : decoded) {
+        if (image.pixels) {
+            stbi_image_free(image.pixels);
+        }
+    }
+}
+
+void TextureLoader::WaitAll() {
+    if (!m_Renderer) return;
+
+    m_Jobs->Wait(m_Decoding);
+
+    TransferQueue& transfer = m_Renderer->GetTransferQueue();
+    while (m_PendingCount > 0) {
+        Update();
+        if (transfer.IsAsync()) {
+            transfer.Submit().Wait();
+        }
+        GenerateMipmaps();
+    }
+}
+
+void TextureLoader::Upload(DecodedImage& image, UploadBatch& fallback) {
+    Texture& texture = *image.texture;
+    if (!image.IsValid()) {
+        TVK_LOG_ERROR("Failed to load texture: {}", texture.m_FilePath);
+        Finish(texture, TextureState::Failed);
+        return;
+    }
+
+    bool prebuiltMips = !image.levels.empty();
+    if (prebuiltMips && !Texture::IsFormatSupported(m_Renderer, image.spec.format)) {
+        TVK_LOG_ERROR("Texture format of {} is not supported by the device", texture.m_FilePath);
+        Finish(texture, TextureState::Failed);
+        return;
+    }
+
+    if (!texture.CreateResources(m_Renderer, image.spec, static_cast<u32>(image.levels.size()))) {
+        Finish(texture, TextureState::Failed);
+        return;
+    }
+    texture.m_SourceWidth = image.sourceWidth;
+    texture.m_SourceHeight = image.sourceHeight;
+
+    const void* data = prebuiltMips ? static_cast<const void*>(image.levelData.data()) : image.pixels;
+    VkDeviceSize size = image.GetSize();
+
+    // CreateResources() only adds levels to generate when the format supports linear blits
+    bool generateMips = !prebuiltMips && texture.m_MipLevels > 1;
+
+    TransferQueue& transfer = m_Renderer->GetTransferQueue();
+    if (transfer.IsAsync()) {
+        ImageUploadInfo info;
+        info.image = texture.m_Image;
+        info.width = texture.m_Width;
+        info.height = texture.m_Height;
+        info.mipLevels = texture.m_MipLevels;
+        info.finalLayout = generateMips ? VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        for (u32 level = 0; level < image.levels.size(); level++) {
+            VkBufferImageCopy region{};
+            region.bufferOffset = image.levels[level].offset;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = level;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageExtent = {image.levels[level].width, image.levels[level].height, 1};
+            info.regions.push_back(region);
+        }
+
+        // Runs on the main thread while the Renderer records the acquire, the ref keeps the image alive
+        Ref<Texture> ref = image.texture;
+        info.onAcquired = [this, ref, generateMips](VkCommandBuffer) {
+            if (generateMips) {
+                m_Acquired.push_back(ref);
+            } else {
+                Finish(*ref, TextureState::Ready);
+            }
+        };
+
+        if (transfer.UploadImage(info, data, size).IsValid()) {
+            return;
+        }
+    }
+
+    // No transfer queue or no room in its staging ring, upload ahead of the current frame instead
+    bool staged = prebuiltMips ? fallback.Upload(texture, data, size, image.levels, VK_IMAGE_LAYOUT_UNDEFINED)
+                               : fallback.Upload(texture, data, size, VK_IMAGE_LAYOUT_UNDEFINED);
+    if (!staged) {
+        TVK_LOG_ERROR("Failed to allocate staging memory for texture: {}", texture.m_FilePath);
+        Finish(texture, TextureState::Failed);
+        return;
+    }
+    Finish(texture, TextureState::Ready);
+}
+
+void TextureLoader::GenerateMipmaps() {
+    if (m_Acquired.empty()) return;
+
+    VkCommandBuffer cmd = m_Renderer->GetUploadCommandBuffer();
+    if (cmd == VK_NULL_HANDLE) return;
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+
+    std::vector<VkImageMemoryBarrier> barriers;
+    barriers.reserve(m_Acquired.size());
+
+    u32 maxMipLevels = 1;
+    for (const auto& texture : m_Acquired) {
+        maxMipLevels = std::max(maxMipLevels, texture->m_MipLevels);
+    }
+
+    // Every chain advances one level per barrier, as in UploadBatch::Record()
+    for (u32 level = 1; level < maxMipLevels; level++) {
+        barriers.clear();
+        for (const auto& texture : m_Acquired) {
+            if (level >= texture->m_MipLevels) continue;
+
+            barrier.image = texture->m_Image;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.subresourceRange.baseMipLevel = level - 1;
+            barrier.subresourceRange.levelCount = 1;
+            barriers.push_back(barrier);
+        }
+        // Level 0 was last touched by the acquire, which the transfer stage alone does not cover
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                             0, nullptr, 0, nullptr, static_cast<u32>(barriers.size()), barriers.data());
+
+        for (const auto& texture : m_Acquired) {
+            if (level >= texture->m_MipLevels) continue;
+
+            i32 srcWidth = std::max(1, static_cast<i32>(texture->m_Width >> (level - 1)));
+            i32 srcHeight = std::max(1, static_cast<i32>(texture->m_Height >> (level - 1)));
+
+            VkImageBlit blit{};
+            blit.srcOffsets[0] = {0, 0, 0};
+            blit.srcOffsets[1] = {srcWidth, srcHeight, 1};
+            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel = level - 1;
+            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.layerCount = 1;
+            blit.dstOffsets[0] = {0, 0, 0};
+            blit.dstOffsets[1] = {srcWidth > 1 ? srcWidth / 2 : 1, srcHeight > 1 ? srcHeight / 2 : 1, 1};
+            blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.dstSubresource.mipLevel = level;
+            blit.dstSubresource.baseArrayLayer = 0;
+            blit.dstSubresource.layerCount = 1;
+
+            vkCmdBlitImage(cmd, texture->m_Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           texture->m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+        }
+    }
+
+    // Everything to shader read with a single barrier
+    barriers.clear();
+    for (const auto& texture : m_Acquired) {
+        barrier.image = texture->m_Image;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        // Levels that were blitted from are transfer sources, the last one a destination
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = texture->m_MipLevels - 1;
+        barriers.push_back(barrier);
+
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.subresourceRange.baseMipLevel = texture->m_MipLevels - 1;
+        barrier.subresourceRange.levelCount = 1;
+        barriers.push_back(barrier);
+    }
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                         0, nullptr, 0, nullptr, static_cast<u32>(barriers.size()), barriers.data());
+
+    for (const auto& texture : m_Acquired) {
+        Finish(*texture, TextureState::Ready);
+    }
+    m_Acquired.clear();
+}
+
+void TextureLoader::Finish(Texture& texture, TextureState state) {
+    texture.m_State = state;
+    if (m_PendingCount > 0) {
+        m_PendingCount--;
+        m_Renderer->EndBackgroundWork();
+    }
+}
+
+} // namespace tvk
@@ -0,0 +1,324 @@
+/**
+ * @file texture_streamer.cpp
+ * @brief Texture streaming implementation
+ */
+
+#include "tinyvk/renderer/texture_streamer.h"
+#include "tinyvk/renderer/renderer.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tvk {
+
+// Halvings until the larger side of the source fits into size
+static u32 GetLevelForSize(u32 sourceSize, u32 size) {
+    u32 level = 0;
+    while ((sourceSize >> level) > std::max(size, 1u)) {
+        level++;
+    }
+    return level;
+}
+
+// Smallest level that still covers size on screen
+static u32 GetLevelForScreenSize(u32 sourceSize, u32 size) {
+    u32 level = 0;
+    while ((sourceSize >> (level + 1)) >= std::max(size, 1u)) {
+        level++;
+    }
+    return level;
+}
+
+static u32 GetSourceSize(const Texture& texture) {
+    return std::max(texture.GetSourceWidth(), texture.GetSourceHeight());
+}
+
+// Every level holds a quarter of the texels of the one above, including its own mips
+static VkDeviceSize EstimateSize(const Texture& resident, u32 residentLevel, u32 level) {
+    VkDeviceSize size = resident.GetMemorySize();
+    if (level < residentLevel) {
+        return size << std::min(2 * (residentLevel - level), 32u);
+    }
+    return size >> std::min(2 * (level - residentLevel), 63u);
+}
+
+VkDescriptorSet StreamedTexture::GetImGuiTextureID(f32 width, f32 height) {
+    u32 size = 0;
+    if (width > 0.0f || height > 0.0f) {
+        size = std::max(1u, static_cast<u32>(std::ceil(std::max(width, height))));
+    }
+
+    // Drawn several times in one frame, the largest wins
+    u64 frame = m_Renderer->GetFrameNumber();
+    if (m_LastUsedFrame != frame) {
+        m_LastUsedFrame = frame;
+        m_RequestedSize = size;
+    } else if (m_RequestedSize != 0) {
+        m_RequestedSize = size == 0 ? 0 : std::max(m_RequestedSize, size);
+    }
+
+    return m_Texture ? m_Texture->GetImGuiTextureID() : m_Placeholder;
+}
+
+TextureStreamer::~TextureStreamer() {
+    Cleanup();
+}
+
+bool TextureStreamer::Init(Renderer* renderer, JobSystem& jobs, const TextureStreamerConfig& config) {
+    m_Renderer = renderer;
+    m_Config = config;
+    m_Config.minSize = std::max(1u, m_Config.minSize);
+    m_Config.maxLoadsInFlight = std::max(1u, m_Config.maxLoadsInFlight);
+
+    if (!m_Loader.Init(renderer, jobs, config.uploadBudget)) {
+        m_Renderer = nullptr;
+        return false;
+    }
+
+    if (!renderer->GetContext().IsMemoryBudgetSupported()) {
+        TVK_LOG_WARN("VK_EXT_memory_budget not supported, texture streaming uses estimated heap budgets");
+    }
+    return true;
+}
+
+void TextureStreamer::Cleanup() {
+    if (!m_Renderer) return;
+
+    // Loads still running hold references of their own until finished
+    m_Loader.Cleanup();
+    m_Renderer->GetContext().WaitIdle();
+
+    for (auto& texture : m_Textures) {
+        if (texture.use_count() == 1) {
+            Retire(std::move(texture->m_Texture));
+        }
+        Retire(std::move(texture->m_Loading));
+    }
+    m_Textures.clear();
+
+    // The device is idle, nothing retired has to wait for a frame
+    for (auto& retired : m_Retired) {
+        if (retired.texture.use_count() == 1) {
+            retired.texture->m_WaitIdleOnCleanup = false;
+        }
+    }
+    m_Retired.clear();
+
+    m_ResidentBytes = 0;
+    m_LoadingCount = 0;
+    m_Renderer = nullptr;
+}
+
+Ref<StreamedTexture> TextureStreamer::Load(const std::string& filepath, const TextureSpec& spec) {
+    auto texture = CreateRef<StreamedTexture>();
+    texture->m_Renderer = m_Renderer;
+    texture->m_Placeholder = m_Loader.GetPlaceholder()->GetImGuiTextureID();
+    texture->m_FilePath = filepath;
+    texture->m_Spec = spec;
+    texture->m_LastUsedFrame = m_Renderer->GetFrameNumber();
+    texture->m_RequestedSize = m_Config.minSize;
+
+    // Low resolution first, the source size is known once it is loaded
+    Request(*texture, m_Config.minSize);
+    m_Textures.push_back(texture);
+    return texture;
+}
+
+void TextureStreamer::Update() {
+    if (!m_Renderer) return;
+
+    m_Loader.Update();
+    u64 frame = m_Renderer->GetFrameNumber();
+
+    // Swap in finished levels and drop textures nobody references any more
+    size_t kept = 0;
+    for (size_t i = 0; i < m_Textures.size(); i++) {
+        StreamedTexture& texture = *m_Textures[i];
+
+        if (texture.m_Loading && texture.m_Loading->GetState() != TextureState::Pending) {
+            if (texture.m_Loading->IsReady()) {
+                Retire(std::move(texture.m_Texture));
+                texture.m_Texture = std::move(texture.m_Loading);
+
+                const Texture& resident = *texture.m_Texture;
+                u32 residentSize = std::max(resident.GetWidth(), resident.GetHeight());
+                texture.m_Level = GetLevelForSize(GetSourceSize(resident), residentSize);
+
+                // Files without stored mips cannot come smaller than their smallest level
+                if (residentSize > texture.m_LoadingSize) {
+                    texture.m_MaxLevel = texture.m_Level;
+                }
+            } else {
+                texture.m_Failed = true;
+                Retire(std::move(texture.m_Loading));
+            }
+            texture.m_Loading.reset();
+        }
+
+        if (m_Textures[i].use_count() == 1) {
+            Retire(std::move(texture.m_Texture));
+            Retire(std::move(texture.m_Loading));
+            continue;
+        }
+        if (kept != i) {
+            m_Textures[kept] = std::move(m_Textures[i]);
+        }
+        kept++;
+    }
+    m_Textures.resize(kept);
+
+    ReleaseRetired();
+
+    m_ResidentBytes = 0;
+    m_LoadingCount = 0;
+    for (const auto& texture : m_Textures) {
+        if (texture->m_Texture) {
+            m_ResidentBytes += texture->m_Texture->GetMemorySize();
+        }
+        if (texture->m_Loading) {
+            m_ResidentBytes += texture->m_Loading->GetMemorySize();
+            m_LoadingCount++;
+        }
+    }
+    m_Budget = ComputeBudget();
+
+    // Level each texture should hold, the size it was last drawn at bounded by minSize and the file
+    struct Change {
+        StreamedTexture* texture;
+        u32 level;
+        bool needed;    // Drawn at the resident level recently
+    };
+    std::vector<Change> upgrades;
+    std::vector<Change> downgrades;
+    for (const auto& texture : m_Textures) {
+        if (!texture->m_Texture || texture->m_Loading || texture->m_Failed) continue;
+
+        u32 sourceSize = GetSourceSize(*texture->m_Texture);
+        u32 minLevel = std::min(GetLevelForSize(sourceSize, m_Config.minSize), texture->m_MaxLevel);
+        u32 level = minLevel;
+        if (frame - texture->m_LastUsedFrame <= m_Config.evictAfterFrames) {
+            u32 requested = texture->m_RequestedSize == 0 ? 0 : GetLevelForScreenSize(sourceSize, texture->m_RequestedSize);
+            level = std::min(minLevel, requested);
+        }
+
+        if (level < texture->m_Level) {
+            upgrades.push_back({texture.get(), level, true});
+        } else if (level > texture->m_Level) {
+            downgrades.push_back({texture.get(), level, false});
+        } else if (texture->m_Level < minLevel) {
+            // Needed at this level, gives up a single one if nothing else frees enough
+            downgrades.push_back({texture.get(), texture->m_Level + 1, true});
+        }
+    }
+
+    if (m_ResidentBytes > m_Budget) {
+        // Least recently used first, textures not needed at their level before visible ones
+        std::sort(downgrades.begin(), downgrades.end(), [](const Change& a, const Change& b) {
+            if (a.needed != b.needed) return !a.needed;
+            return a.texture->m_LastUsedFrame < b.texture->m_LastUsedFrame;
+        });
+
+        VkDeviceSize projected = m_ResidentBytes;
+        for (const auto& change : downgrades) {
+            if (projected <= m_Budget) break;
+
+            StreamedTexture& texture = *change.texture;
+            const Texture& resident = *texture.m_Texture;
+            VkDeviceSize saved = resident.GetMemorySize() - EstimateSize(resident, texture.m_Level, change.level);
+            projected -= std::min(projected, saved);
+            Request(texture, std::max(1u, GetSourceSize(resident) >> change.level));
+        }
+        return;
+    }
+
+    // Most recently used first, both levels stay resident until the new one is swapped in
+    std::sort(upgrades.begin(), upgrades.end(), [](const Change& a, const Change& b) {
+        return a.texture->m_LastUsedFrame > b.texture->m_LastUsedFrame;
+    });
+
+    VkDeviceSize projected = m_ResidentBytes;
+    for (const auto& change : upgrades) {
+        if (m_LoadingCount >= m_Config.maxLoadsInFlight) break;
+
+        StreamedTexture& texture = *change.texture;
+        const Texture& resident = *texture.m_Texture;
+        VkDeviceSize size = EstimateSize(resident, texture.m_Level, change.level);
+        if (projected + size > m_Budget) continue;
+
+        projected += size;
+        Request(texture, std::max(1u, GetSourceSize(resident) >> change.level));
+    }
+}
+
+void TextureStreamer::Request(StreamedTexture& texture, u32 maxSize) {
+    TextureSpec spec = texture.m_Spec;
+    spec.maxSize = maxSize;
+
+    texture.m_Loading = m_Loader.Load(texture.m_FilePath, spec);
+    texture.m_LoadingSize = maxSize;
+    m_LoadingCount++;
+}
+
+void TextureStreamer::Retire(Ref<Texture> texture) {
+    if (!texture) return;
+
+    // Loads in flight are stamped once they finish, their last commands are recorded then
+    u64 frame = texture->GetState() == TextureState::Pending ? 0 : m_Renderer->GetFrameNumber();
+    m_Retired.push_back({std::move(texture), frame});
+}
+
+void TextureStreamer::ReleaseRetired() {
+    u64 frame = m_Renderer->GetFrameNumber();
+    u64 completed = m_Renderer->GetCompletedFrame();
+
+    size_t kept = 0;
+    for (size_t i = 0; i < m_Retired.size(); i++) {
+        RetiredTexture& retired = m_Retired[i];
+        if (retired.texture->GetState() != TextureState::Pending) {
+            if (retired.frame == 0) {
+                retired.frame = frame;
+            }
+
+            if (retired.frame <= completed) {
+                // Other references keep the image, their owners destroy it the usual way
+                if (retired.texture.use_count() == 1) {
+                    retired.texture->m_WaitIdleOnCleanup = false;
+                }
+                retired.texture.reset();
+                continue;
+            }
+        }
+        if (kept != i) {
+            m_Retired[kept] = std::move(m_Retired[i]);
+        }
+        kept++;
+    }
+    m_Retired.resize(kept);
+}
+
+VkDeviceSize TextureStreamer::ComputeBudget() const {
+    VkDeviceSize heapUsage = 0;
+    VkDeviceSize heapBudget = 0;
+    for (const auto& stats : m_Renderer->GetContext().GetAllocator().GetHeapStats()) {
+        if (stats.deviceLocal) {
+            heapUsage += stats.usage;
+            heapBudget += stats.budget;
+        }
+    }
+
+    VkDeviceSize budget = m_Config.budget;
+    if (budget == 0) {
+        budget = static_cast<VkDeviceSize>(static_cast<f64>(heapBudget) * m_Config.heapBudgetFraction);
+    }
+
+    // The driver's view wins, e.g. when other applications claim video memory
+    if (heapUsage > heapBudget) {
+        VkDeviceSize overshoot = heapUsage - heapBudget;
+        budget = std::min(budget, m_ResidentBytes > overshoot ? m_ResidentBytes - overshoot : 0);
+    }
+    return budget;
+}
+
+} // namespace tvk
@@ -0,0 +1,511 @@
+/**
+ * @file transfer_queue.cpp
+ * @brief Asynchronous transfer queue implementation
+ */
+
+#include "tinyvk/renderer/transfer_queue.h"
+#include "tinyvk/renderer/context.h"
+#include "tinyvk/core/log.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace tvk {
+
+bool TransferHandle::IsComplete() const {
+    return !queue || queue->IsComplete(value);
+}
+
+void TransferHandle::Wait() const {
+    if (queue) {
+        queue->Wait(value);
+    }
+}
+
+TransferQueue::~TransferQueue() {
+    Cleanup();
+}
+
+bool TransferQueue::Init(VulkanContext* context, VkDeviceSize stagingSize) {
+    m_Context = context;
+
+    if (!context->GetVulkan12Features().timelineSemaphore) {
+        TVK_LOG_WARN("Timeline semaphores not supported");
+        m_Context = nullptr;
+        return false;
+    }
+
+    const auto& indices = context->GetQueueFamilyIndices();
+    m_TransferFamily = indices.transferFamily.value();
+    m_GraphicsFamily = indices.graphicsFamily.value();
+    m_Queue = context->GetTransferQueue();
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex = m_TransferFamily;
+
+    if (vkCreateCommandPool(context->GetDevice(), &poolInfo, nullptr, &m_CommandPool) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create transfer command pool");
+        Cleanup();
+        return false;
+    }
+
+    VkSemaphoreTypeCreateInfo typeInfo{};
+    typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext = &typeInfo;
+
+    if (vkCreateSemaphore(context->GetDevice(), &semaphoreInfo, nullptr, &m_Timeline) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create transfer timeline semaphore");
+        Cleanup();
+        return false;
+    }
+
+    if (!m_StagingRing.Init(context, stagingSize)) {
+        TVK_LOG_ERROR("Failed to create transfer staging ring");
+        Cleanup();
+        return false;
+    }
+
+    m_NextValue = 1;
+    m_AcquiredValue = 0;
+    m_ExecutedValue = 0;
+
+    if (context->HasDedicatedTransferQueue()) {
+        TVK_LOG_INFO("Using dedicated transfer queue family {}", m_TransferFamily);
+    }
+    return true;
+}
+
+void TransferQueue::Cleanup() {
+    if (!m_Context) return;
+
+    VkDevice device = m_Context->GetDevice();
+
+    if (m_Timeline != VK_NULL_HANDLE) {
+        if (m_Recording) {
+            Submit();
+        }
+        WaitForValue(m_NextValue - 1);
+        vkDestroySemaphore(device, m_Timeline, nullptr);
+        m_Timeline = VK_NULL_HANDLE;
+    }
+
+    if (m_CommandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(device, m_CommandPool, nullptr);
+        m_CommandPool = VK_NULL_HANDLE;
+    }
+
+    m_StagingRing.Cleanup();
+    m_InFlight.clear();
+    m_FreeCommandBuffers.clear();
+    m_Releases.clear();
+    m_Acquires.clear();
+    m_AcquireSignals.clear();
+    m_GraphicsTimeline = VK_NULL_HANDLE;
+    m_SubmitAcquires = nullptr;
+    m_CommandBuffer = VK_NULL_HANDLE;
+    m_Recording = false;
+    m_Queue = VK_NULL_HANDLE;
+    m_Context = nullptr;
+}
+
+TransferHandle TransferQueue::UploadBuffer(VkBuffer buffer, const void* data, VkDeviceSize size, VkDeviceSize offset) {
+    TransferHandle handle;
+    if (!IsAsync() || !data || size == 0) return handle;
+
+    StagingAllocation staging = AllocateStaging(size);
+    if (!staging.IsValid()) return handle;
+
+    memcpy(staging.data, data, static_cast<size_t>(size));
+
+    VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = staging.offset;
+    copyRegion.dstOffset = offset;
+    copyRegion.size = size;
+    vkCmdCopyBuffer(GetCommandBuffer(), staging.buffer, buffer, 1, &copyRegion);
+
+    PendingAcquire release;
+    release.bufferBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    release.bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    release.bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    release.bufferBarrier.buffer = buffer;
+    release.bufferBarrier.offset = offset;
+    release.bufferBarrier.size = size;
+    m_Releases.push_back(std::move(release));
+
+    handle.queue = this;
+    handle.value = m_NextValue;
+    return handle;
+}
+
+TransferHandle TransferQueue::UploadImage(const ImageUploadInfo& info, const void* data, VkDeviceSize size) {
+    TransferHandle handle;
+    if (!IsAsync() || !data || size == 0 || info.image == VK_NULL_HANDLE) return handle;
+
+    StagingAllocation staging = AllocateStaging(size);
+    if (!staging.IsValid()) return handle;
+
+    memcpy(staging.data, data, static_cast<size_t>(size));
+
+    VkCommandBuffer cmd = GetCommandBuffer();
+
+    VkImageSubresourceRange range{};
+    range.aspectMask = info.aspect;
+    range.baseMipLevel = info.mipLevel;
+    range.levelCount = std::max(1u, info.mipLevels);
+    range.baseArrayLayer = 0;
+    range.layerCount = 1;
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = info.image;
+    barrier.subresourceRange = range;
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    VkBufferImageCopy region{};
+    region.bufferOffset = staging.offset;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = info.aspect;
+    region.imageSubresource.mipLevel = info.mipLevel;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = {info.width, info.height, 1};
+
+    if (info.regions.empty()) {
+        vkCmdCopyBufferToImage(cmd, staging.buffer, info.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    } else {
+        std::vector<VkBufferImageCopy> regions = info.regions;
+        for (auto& levelRegion : regions) {
+            levelRegion.bufferOffset += staging.offset;
+        }
+        vkCmdCopyBufferToImage(cmd, staging.buffer, info.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<u32>(regions.size()), regions.data());
+    }
+
+    PendingAcquire release;
+    release.isImage = true;
+    release.imageBarrier = barrier;
+    release.imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    release.imageBarrier.newLayout = info.finalLayout;
+    release.onAcquired = info.onAcquired;
+    m_Releases.push_back(std::move(release));
+
+    handle.queue = this;
+    handle.value = m_NextValue;
+    return handle;
+}
+
+TransferHandle TransferQueue::Submit() {
+    TransferHandle handle;
+    if (!IsAsync()) return handle;
+
+    handle.queue = this;
+    if (!m_Recording) {
+        handle.value = m_NextValue - 1;
+        return handle;
+    }
+
+    u64 value = m_NextValue++;
+    bool transferOwnership = m_TransferFamily != m_GraphicsFamily;
+
+    // Release ownership to the graphics queue, or just finish the layout transitions
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+    for (auto& release : m_Releases) {
+        release.value = value;
+        if (release.isImage) {
+            VkImageMemoryBarrier barrier = release.imageBarrier;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = 0;
+            if (transferOwnership) {
+                barrier.srcQueueFamilyIndex = m_TransferFamily;
+                barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+            }
+            imageBarriers.push_back(barrier);
+        } else if (transferOwnership) {
+            VkBufferMemoryBarrier barrier = release.bufferBarrier;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = 0;
+            barrier.srcQueueFamilyIndex = m_TransferFamily;
+            barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+            bufferBarriers.push_back(barrier);
+        }
+    }
+
+    if (!bufferBarriers.empty() || !imageBarriers.empty()) {
+        vkCmdPipelineBarrier(m_CommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                             0, nullptr,
+                             static_cast<u32>(bufferBarriers.size()), bufferBarriers.data(),
+                             static_cast<u32>(imageBarriers.size()), imageBarriers.data());
+    }
+
+    vkEndCommandBuffer(m_CommandBuffer);
+
+    VkTimelineSemaphoreSubmitInfo timelineInfo{};
+    timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues = &value;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext = &timelineInfo;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &m_CommandBuffer;
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = &m_Timeline;
+
+    if (vkQueueSubmit(m_Queue, 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to submit transfer command buffer");
+    }
+
+    Submission submission;
+    submission.commandBuffer = m_CommandBuffer;
+    submission.value = value;
+    m_InFlight.push_back(submission);
+
+    m_StagingRing.Retire(value);
+    for (auto& release : m_Releases) {
+        m_Acquires.push_back(std::move(release));
+    }
+    m_Releases.clear();
+
+    m_CommandBuffer = VK_NULL_HANDLE;
+    m_Recording = false;
+
+    handle.value = value;
+    return handle;
+}
+
+bool TransferQueue::IsComplete(u64 value) const {
+    if (!IsAsync() || value <= m_ExecutedValue) return true;
+    if (value > m_AcquiredValue) return false;
+
+    // The acquire is recorded into graphics commands that may not have run yet
+    u64 graphicsValue = GetAcquireSignal(value);
+    return graphicsValue == 0 || graphicsValue <= GetGraphicsCompletedValue();
+}
+
+void TransferQueue::Wait(u64 value) {
+    if (IsComplete(value)) return;
+
+    if (value > m_AcquiredValue) {
+        if (m_Recording && value >= m_NextValue) {
+            Submit();
+        }
+        WaitForValue(std::min(value, m_NextValue - 1));
+
+        // Resources are usable once the graphics queue owns them
+        VkCommandBuffer cmd = m_Context->BeginSingleTimeCommands();
+        AcquireCompleted(cmd);
+        m_Context->EndSingleTimeCommands(cmd);
+        if (IsComplete(value)) return;
+    }
+
+    // Acquired by graphics commands recorded earlier, they have to be submitted to run
+    u64 graphicsValue = GetAcquireSignal(value);
+    if (m_SubmitAcquires) {
+        m_SubmitAcquires();
+    }
+
+    VkSemaphoreWaitInfo waitInfo{};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &m_GraphicsTimeline;
+    waitInfo.pValues = &graphicsValue;
+    vkWaitSemaphores(m_Context->GetDevice(), &waitInfo, UINT64_MAX);
+}
+
+bool TransferQueue::HasCompletedWork() const {
+    // Every batch holds at least one upload waiting to be acquired
+    return IsAsync() && !m_Acquires.empty() && m_Acquires.front().value <= GetCompletedValue();
+}
+
+u64 TransferQueue::AcquireCompleted(VkCommandBuffer graphicsCmd, u64 graphicsValue) {
+    if (!IsAsync()) return 0;
+
+    u64 completed = GetCompletedValue();
+    Recycle();
+
+    // Drop signals the graphics queue has passed
+    u64 graphicsCompleted = GetGraphicsCompletedValue();
+    size_t executed = 0;
+    while (executed < m_AcquireSignals.size() && m_AcquireSignals[executed].graphicsValue <= graphicsCompleted) {
+        m_ExecutedValue = std::max(m_ExecutedValue, m_AcquireSignals[executed].value);
+        executed++;
+    }
+    m_AcquireSignals.erase(m_AcquireSignals.begin(), m_AcquireSignals.begin() + executed);
+
+    bool transferOwnership = m_TransferFamily != m_GraphicsFamily;
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+
+    size_t acquired = 0;
+    while (acquired < m_Acquires.size() && m_Acquires[acquired].value <= completed) {
+        auto& acquire = m_Acquires[acquired];
+        if (transferOwnership) {
+            if (acquire.isImage) {
+                VkImageMemoryBarrier barrier = acquire.imageBarrier;
+                barrier.srcAccessMask = 0;
+                barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                barrier.srcQueueFamilyIndex = m_TransferFamily;
+                barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+                imageBarriers.push_back(barrier);
+            } else {
+                VkBufferMemoryBarrier barrier = acquire.bufferBarrier;
+                barrier.srcAccessMask = 0;
+                barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+                barrier.srcQueueFamilyIndex = m_TransferFamily;
+                barrier.dstQueueFamilyIndex = m_GraphicsFamily;
+                bufferBarriers.push_back(barrier);
+            }
+        }
+        acquired++;
+    }
+
+    if (!bufferBarriers.empty() || !imageBarriers.empty()) {
+        vkCmdPipelineBarrier(graphicsCmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                             0, nullptr,
+                             static_cast<u32>(bufferBarriers.size()), bufferBarriers.data(),
+                             static_cast<u32>(imageBarriers.size()), imageBarriers.data());
+    }
+
+    for (size_t i = 0; i < acquired; i++) {
+        if (m_Acquires[i].onAcquired) {
+            m_Acquires[i].onAcquired(graphicsCmd);
+        }
+    }
+    m_Acquires.erase(m_Acquires.begin(), m_Acquires.begin() + acquired);
+
+    if (completed <= m_AcquiredValue) return 0;
+    m_AcquiredValue = completed;
+
+    // Without a graphics timeline recording the acquire is as far as it can be tracked
+    if (graphicsValue == 0 || m_GraphicsTimeline == VK_NULL_HANDLE) {
+        if (m_AcquireSignals.empty()) {
+            m_ExecutedValue = completed;
+        } else {
+            m_AcquireSignals.push_back({completed, 0});
+        }
+    } else {
+        m_AcquireSignals.push_back({completed, graphicsValue});
+    }
+    return completed;
+}
+
+void TransferQueue::SetGraphicsTimeline(VkSemaphore timeline, std::function<void()> submitAcquires) {
+    m_GraphicsTimeline = timeline;
+    m_SubmitAcquires = std::move(submitAcquires);
+}
+
+VkCommandBuffer TransferQueue::GetCommandBuffer() {
+    if (m_Recording) return m_CommandBuffer;
+
+    Recycle();
+
+    if (!m_FreeCommandBuffers.empty()) {
+        m_CommandBuffer = m_FreeCommandBuffers.back();
+        m_FreeCommandBuffers.pop_back();
+        vkResetCommandBuffer(m_CommandBuffer, 0);
+    } else {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = m_CommandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount = 1;
+        vkAllocateCommandBuffers(m_Context->GetDevice(), &allocInfo, &m_CommandBuffer);
+    }
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(m_CommandBuffer, &beginInfo);
+
+    m_Recording = true;
+    return m_CommandBuffer;
+}
+
+StagingAllocation TransferQueue::AllocateStaging(VkDeviceSize size) {
+    StagingAllocation staging = m_StagingRing.Allocate(size);
+    if (staging.IsValid()) return staging;
+
+    // The ring is full - submit what is recorded and wait for the oldest batches
+    if (m_Recording) {
+        Submit();
+    }
+    Recycle();
+
+    for (const auto& submission : m_InFlight) {
+        WaitForValue(submission.value);
+        m_StagingRing.Release(submission.value);
+        staging = m_StagingRing.Allocate(size);
+        if (staging.IsValid()) break;
+    }
+    Recycle();
+
+    if (!staging.IsValid()) {
+        TVK_LOG_ERROR("Failed to allocate {} bytes of transfer staging memory", size);
+    }
+    return staging;
+}
+
+void TransferQueue::WaitForValue(u64 value) const {
+    VkSemaphoreWaitInfo waitInfo{};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &m_Timeline;
+    waitInfo.pValues = &value;
+    vkWaitSemaphores(m_Context->GetDevice(), &waitInfo, UINT64_MAX);
+}
+
+u64 TransferQueue::GetCompletedValue() const {
+    u64 value = 0;
+    vkGetSemaphoreCounterValue(m_Context->GetDevice(), m_Timeline, &value);
+    return value;
+}
+
+u64 TransferQueue::GetGraphicsCompletedValue() const {
+    if (m_GraphicsTimeline == VK_NULL_HANDLE) return UINT64_MAX;
+
+    u64 value = 0;
+    vkGetSemaphoreCounterValue(m_Context->GetDevice(), m_GraphicsTimeline, &value);
+    return value;
+}
+
+u64 TransferQueue::GetAcquireSignal(u64 value) const {
+    // Each signal covers the values since the one before it
+    for (const auto& signal : m_AcquireSignals) {
+        if (signal.value >= value) return signal.graphicsValue;
+    }
+    return 0;
+}
+
+void TransferQueue::Recycle() {
+    if (m_InFlight.empty()) return;
+
+    u64 completed = GetCompletedValue();
+    m_StagingRing.Release(completed);
+
+    size_t finished = 0;
+    while (finished < m_InFlight.size() && m_InFlight[finished].value <= completed) {
+        m_FreeCommandBuffers.push_back(m_InFlight[finished].commandBuffer);
+        finished++;
+    }
+    m_InFlight.erase(m_InFlight.begin(), m_InFlight.begin() + finished);
+}
+
+} // namespace tvk
@@ -0,0 +1,338 @@
+/**
+ * @file upload_batch.cpp
+ * @brief Upload batch implementation
+ */
+
+#include "tinyvk/renderer/upload_batch.h"
+#include "tinyvk/renderer/renderer.h"
+#include "tinyvk/renderer/buffer.h"
+#include "tinyvk/renderer/texture.h"
+#include "tinyvk/core/log.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace tvk {
+
+UploadBatch::UploadBatch(Renderer* renderer)
+    : m_Renderer(renderer) {
+}
+
+UploadBatch::~UploadBatch() {
+    Record();
+}
+
+bool UploadBatch::Upload(Buffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset) {
+    if (!data || size == 0) return false;
+
+    if (buffer.IsHostVisible()) {
+        buffer.SetData(data, size, offset);
+        return true;
+    }
+
+    StagingAllocation staging = Allocate(size);
+    if (!staging.IsValid()) return false;
+
+    memcpy(staging.data, data, static_cast<size_t>(size));
+
+    BufferCopy copy;
+    copy.buffer = &buffer;
+    copy.source = staging.buffer;
+    copy.region.srcOffset = staging.offset;
+    copy.region.dstOffset = offset;
+    copy.region.size = size;
+    m_BufferCopies.push_back(copy);
+    return true;
+}
+
+void* UploadBatch::Stage(Buffer& buffer, VkDeviceSize size, VkDeviceSize offset) {
+    if (size == 0) return nullptr;
+
+    if (buffer.IsHostVisible()) {
+        TVK_LOG_ERROR("Host visible buffers are written directly, use Buffer::Map()");
+        return nullptr;
+    }
+
+    StagingAllocation staging = Allocate(size);
+    if (!staging.IsValid()) return nullptr;
+
+    BufferCopy copy;
+    copy.buffer = &buffer;
+    copy.source = staging.buffer;
+    copy.region.srcOffset = staging.offset;
+    copy.region.dstOffset = offset;
+    copy.region.size = size;
+    m_BufferCopies.push_back(copy);
+    m_OpenStages++;
+    return staging.data;
+}
+
+void UploadBatch::Commit() {
+    m_OpenStages = 0;
+}
+
+bool UploadBatch::Upload(Texture& texture, const void* data, VkDeviceSize size, VkImageLayout currentLayout) {
+    if (!data || size == 0 || !texture.IsValid()) return false;
+
+    StagingAllocation staging = Allocate(size);
+    if (!staging.IsValid()) return false;
+
+    memcpy(staging.data, data, static_cast<size_t>(size));
+
+    ImageCopy copy;
+    copy.image = texture.GetImage();
+    copy.oldLayout = currentLayout;
+    copy.source = staging.buffer;
+    copy.sourceOffset = staging.offset;
+    copy.width = texture.GetWidth();
+    copy.height = texture.GetHeight();
+    copy.mipLevels = texture.GetMipLevels();
+
+    if (copy.mipLevels > 1) {
+        VkFormatProperties formatProperties;
+        vkGetPhysicalDeviceFormatProperties(m_Renderer->GetContext().GetPhysicalDevice(),
+                                            texture.GetFormat(), &formatProperties);
+        copy.generateMips = (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0;
+        if (!copy.generateMips) {
+            TVK_LOG_WARN("Texture format does not support linear blitting, mipmaps will not be generated");
+        }
+    }
+
+    m_ImageCopies.push_back(copy);
+    return true;
+}
+
+bool UploadBatch::Upload(Texture& texture, const void* data, VkDeviceSize size, const std::vector<TextureMipLevel>& levels,
+                         VkImageLayout currentLayout) {
+    if (!data || size == 0 || levels.empty() || !texture.IsValid()) return false;
+
+    StagingAllocation staging = Allocate(size);
+    if (!staging.IsValid()) return false;
+
+    memcpy(staging.data, data, static_cast<size_t>(size));
+
+    ImageCopy copy;
+    copy.image = texture.GetImage();
+    copy.oldLayout = currentLayout;
+    copy.source = staging.buffer;
+    copy.sourceOffset = staging.offset;
+    copy.width = texture.GetWidth();
+    copy.height = texture.GetHeight();
+    copy.mipLevels = std::min(texture.GetMipLevels(), static_cast<u32>(levels.size()));
+    copy.levels.assign(levels.begin(), levels.begin() + copy.mipLevels);
+
+    m_ImageCopies.push_back(std::move(copy));
+    return true;
+}
+
+void UploadBatch::Record() {
+    Commit();
+    RecordCopies();
+
+    // Dedicated staging buffers are not tracked by the renderer, they go once the copies ran
+    if (!m_StagingBuffers.empty()) {
+        m_Renderer->FlushUploads();
+        m_StagingBuffers.clear();
+    }
+}
+
+void UploadBatch::RecordCopies() {
+    if (m_BufferCopies.empty() && m_ImageCopies.empty()) return;
+
+    // Buffers written by the transfer queue have to be owned by graphics again
+    for (const auto& copy : m_BufferCopies) {
+        copy.buffer->WaitForTransfer();
+        copy.buffer->m_HasContents = true;
+    }
+
+    VkCommandBuffer cmd = m_Renderer->GetUploadCommandBuffer();
+    if (cmd == VK_NULL_HANDLE) return;
+
+    // One copy command per run of regions with the same source and destination
+    std::vector<VkBufferCopy> regions;
+    for (size_t i = 0; i < m_BufferCopies.size(); i++) {
+        const auto& copy = m_BufferCopies[i];
+        regions.push_back(copy.region);
+
+        bool last = i + 1 == m_BufferCopies.size();
+        if (last || m_BufferCopies[i + 1].buffer != copy.buffer || m_BufferCopies[i + 1].source != copy.source) {
+            vkCmdCopyBuffer(cmd, copy.source, copy.buffer->GetBuffer(), static_cast<u32>(regions.size()), regions.data());
+            regions.clear();
+        }
+
+        copy.buffer->m_UploadSerial = m_Renderer->GetUploadSerial();
+        copy.buffer->m_HasUpload = true;
+    }
+    m_BufferCopies.clear();
+
+    if (m_ImageCopies.empty()) return;
+
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+
+    std::vector<VkImageMemoryBarrier> barriers;
+    barriers.reserve(m_ImageCopies.size());
+
+    // Every image to transfer destination with a single barrier
+    VkPipelineStageFlags sourceStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+    for (const auto& copy : m_ImageCopies) {
+        barrier.image = copy.image;
+        barrier.oldLayout = copy.oldLayout;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = copy.mipLevels;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        if (copy.oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+            barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            sourceStages |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        } else {
+            barrier.srcAccessMask = 0;
+        }
+        barriers.push_back(barrier);
+    }
+    vkCmdPipelineBarrier(cmd, sourceStages, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                         0, nullptr, 0, nullptr, static_cast<u32>(barriers.size()), barriers.data());
+
+    u32 maxMipLevels = 1;
+    std::vector<VkBufferImageCopy> regions;
+    for (const auto& copy : m_ImageCopies) {
+        VkBufferImageCopy region{};
+        region.bufferOffset = copy.sourceOffset;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = {0, 0, 0};
+        region.imageExtent = {copy.width, copy.height, 1};
+
+        regions.clear();
+        if (copy.levels.empty()) {
+            regions.push_back(region);
+        }
+        for (u32 level = 0; level < copy.levels.size(); level++) {
+            region.bufferOffset = copy.sourceOffset + copy.levels[level].offset;
+            region.imageSubresource.mipLevel = level;
+            region.imageExtent = {copy.levels[level].width, copy.levels[level].height, 1};
+            regions.push_back(region);
+        }
+
+        vkCmdCopyBufferToImage(cmd, copy.source, copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<u32>(regions.size()), regions.data());
+
+        if (copy.generateMips) {
+            maxMipLevels = std::max(maxMipLevels, copy.mipLevels);
+        }
+    }
+
+    // Mip chains advance one level of every image per barrier
+    for (u32 level = 1; level < maxMipLevels; level++) {
+        barriers.clear();
+        for (const auto& copy : m_ImageCopies) {
+            if (!copy.generateMips || level >= copy.mipLevels) continue;
+
+            barrier.image = copy.image;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.subresourceRange.baseMipLevel = level - 1;
+            barrier.subresourceRange.levelCount = 1;
+            barriers.push_back(barrier);
+        }
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                             0, nullptr, 0, nullptr, static_cast<u32>(barriers.size()), barriers.data());
+
+        for (const auto& copy : m_ImageCopies) {
+            if (!copy.generateMips || level >= copy.mipLevels) continue;
+
+            i32 srcWidth = std::max(1, static_cast<i32>(copy.width >> (level - 1)));
+            i32 srcHeight = std::max(1, static_cast<i32>(copy.height >> (level - 1)));
+
+            VkImageBlit blit{};
+            blit.srcOffsets[0] = {0, 0, 0};
+            blit.srcOffsets[1] = {srcWidth, srcHeight, 1};
+            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel = level - 1;
+            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.layerCount = 1;
+            blit.dstOffsets[0] = {0, 0, 0};
+            blit.dstOffsets[1] = {srcWidth > 1 ? srcWidth / 2 : 1, srcHeight > 1 ? srcHeight / 2 : 1, 1};
+            blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.dstSubresource.mipLevel = level;
+            blit.dstSubresource.baseArrayLayer = 0;
+            blit.dstSubresource.layerCount = 1;
+
+            vkCmdBlitImage(cmd, copy.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_LINEAR);
+        }
+    }
+
+    // Everything to shader read with a single barrier
+    barriers.clear();
+    for (const auto& copy : m_ImageCopies) {
+        barrier.image = copy.image;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        if (copy.generateMips) {
+            // Levels that were blitted from are transfer sources, the last one a destination
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.subresourceRange.baseMipLevel = 0;
+            barrier.subresourceRange.levelCount = copy.mipLevels - 1;
+            barriers.push_back(barrier);
+
+            barrier.subresourceRange.baseMipLevel = copy.mipLevels - 1;
+            barrier.subresourceRange.levelCount = 1;
+        } else {
+            barrier.subresourceRange.baseMipLevel = 0;
+            barrier.subresourceRange.levelCount = copy.mipLevels;
+        }
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers.push_back(barrier);
+    }
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                         0, nullptr, 0, nullptr, static_cast<u32>(barriers.size()), barriers.data());
+
+    m_ImageCopies.clear();
+}
+
+void UploadBatch::Submit() {
+    Record();
+    m_Renderer->SubmitUploads();
+}
+
+StagingAllocation UploadBatch::Allocate(VkDeviceSize size) {
+    StagingAllocation staging = m_Renderer->TryAllocateStaging(size);
+    if (staging.IsValid()) return staging;
+
+    if (m_OpenStages == 0) {
+        // The renderer flushes a full ring, so memory already staged has to be recorded first
+        RecordCopies();
+        return m_Renderer->AllocateStaging(size);
+    }
+
+    // Stage() memory may not be filled yet, it must neither be copied nor handed out again
+    Ref<Buffer> buffer = Buffer::Create(m_Renderer, size, BufferUsage::Staging);
+    if (!buffer) return {};
+
+    StagingAllocation dedicated;
+    dedicated.buffer = buffer->GetBuffer();
+    dedicated.offset = 0;
+    dedicated.size = size;
+    dedicated.data = buffer->Map();
+    if (!dedicated.data) return {};
+
+    m_StagingBuffers.push_back(std::move(buffer));
+    return dedicated;
+}
+
+} // namespace tvk
@@ -15,7 +15,10 @@
 #include <imgui_impl_vulkan.h>
 
 #include <GLFW/glfw3.h>
+#include <cstdio>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 
 namespace tvk {
 
@@ -72,43 +75,21 @@ bool ImGuiLayer::Init(GLFWwindow* window, Renderer* renderer, const ImGuiConfig&
         io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
     }
 
-    // Load font
+    // Fonts, the configured one first so that it becomes the default
+    FontSource primary;
+    primary.size = config.fontSize * config.fontScale;
+    primary.icons = true;
     if (config.fontPath != nullptr) {
-        io.Fonts->AddFontFromFileTTF(config.fontPath, config.fontSize * config.fontScale);
+        primary.font = config.fontPath;
     } else if (config.useEmbeddedFont) {
-        void* fontData = roboto_medium;
-        int fontDataSize = roboto_medium_size;
-        
-        if (std::strcmp(config.embeddedFontName, "roboto") == 0) {
-            fontData = roboto_medium;
-            fontDataSize = roboto_medium_size;
-        } else if (std::strcmp(config.embeddedFontName, "lexend") == 0) {
-            fontData = lexend_regular;
-            fontDataSize = lexend_regular_size;
-        } else if (std::strcmp(config.embeddedFontName, "quicksand") == 0) {
-            fontData = quicksand_regular;
-            fontDataSize = quicksand_regular_size;
-        } else if (std::strcmp(config.embeddedFontName, "droid") == 0) {
-            fontData = droid_sans;
-            fontDataSize = droid_sans_size;
-        }
-        
-        ImFontConfig fontConfig;
-        fontConfig.FontDataOwnedByAtlas = false;
-        io.Fonts->AddFontFromMemoryTTF(fontData, fontDataSize, config.fontSize * config.fontScale, &fontConfig);
-        TVK_LOG_INFO("Loaded embedded font: {}", config.embeddedFontName);
+        primary.font = config.embeddedFontName;
     } else {
+        // ImGui's bitmap font only looks right at its own size
+        primary.size = 13.0f;
         io.FontGlobalScale = config.fontScale;
     }
-
-    static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
-    ImFontConfig icons_config;
-    icons_config.MergeMode = true;
-    icons_config.PixelSnapH = true;
-    icons_config.FontDataOwnedByAtlas = false;
-    icons_config.GlyphMinAdvanceX = config.fontSize * config.fontScale;
-    io.Fonts->AddFontFromMemoryTTF(fa_solid_900, fa_solid_900_size, config.fontSize * config.fontScale, &icons_config, icons_ranges);
-    TVK_LOG_INFO("Loaded Font Awesome icons");
+    m_FontSources.push_back(primary);
+    BuildFontAtlas();
 
     // Setup platform/renderer backends
     ImGui_ImplGlfw_InitForVulkan(window, true);
@@ -119,7 +100,7 @@ bool ImGuiLayer::Init(GLFWwindow* window, Renderer* renderer, const ImGuiConfig&
     initInfo.Device = context.GetDevice();
     initInfo.QueueFamily = context.GetQueueFamilyIndices().graphicsFamily.value();
     initInfo.Queue = context.GetGraphicsQueue();
-    initInfo.PipelineCache = VK_NULL_HANDLE;
+    initInfo.PipelineCache = context.GetPipelineCache();
     initInfo.DescriptorPool = m_DescriptorPool;
     initInfo.Subpass = 0;
     initInfo.MinImageCount = 2;
@@ -156,11 +137,18 @@ void ImGuiLayer::Cleanup() {
         m_DescriptorPool = VK_NULL_HANDLE;
     }
 
+    m_FontSources.clear();
+    m_Fonts.clear();
+    m_FontsDirty = false;
     m_Initialized = false;
     TVK_LOG_INFO("ImGui layer cleaned up");
 }
 
 void ImGuiLayer::Begin() {
+    if (m_FontsDirty) {
+        RebuildFonts();
+    }
+
     ImGui_ImplVulkan_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
@@ -280,6 +268,396 @@ void ImGuiLayer::EndDockspace() {
     ImGui::End();
 }
 
+u32 ImGuiLayer::RequestFont(const std::string& font, float size, bool icons) {
+    FontSource source;
+    source.font = font;
+    source.size = size * m_Config.fontScale;
+    source.icons = icons;
+
+    for (u32 i = 0; i < m_FontSources.size(); i++) {
+        const FontSource& existing = m_FontSources[i];
+        if (existing.font == source.font && existing.size == source.size && existing.icons == source.icons) return i;
+    }
+
+    m_FontSources.push_back(source);
+    m_Fonts.push_back(nullptr);
+    m_FontsDirty = true;
+    return static_cast<u32>(m_FontSources.size() - 1);
+}
+
+ImFont* ImGuiLayer::GetFont(u32 handle) const {
+    return handle < m_Fonts.size() ? m_Fonts[handle] : nullptr;
+}
+
+void ImGuiLayer::RebuildFonts() {
+    // The font texture may still be sampled by frames in flight
+    m_Renderer->GetContext().WaitIdle();
+    ImGui_ImplVulkan_DestroyFontsTexture();
+
+    // Recreated from the new atlas by the next ImGui_ImplVulkan_NewFrame()
+    BuildFontAtlas();
+}
+
+bool ImGuiLayer::BuildFontAtlas() {
+    m_FontsDirty = false;
+
+    u64 key = GetFontCacheKey();
+    if (m_Config.fontCachePath != nullptr && LoadFontCache(key)) {
+        TVK_LOG_INFO("Loaded font atlas from {}", m_Config.fontCachePath);
+        return true;
+    }
+
+    ImGuiIO& io = ImGui::GetIO();
+    io.Fonts->Clear();
+
+    m_Fonts.assign(m_FontSources.size(), nullptr);
+    for (size_t i = 0; i < m_FontSources.size(); i++) {
+        m_Fonts[i] = AddFontSource(m_FontSources[i]);
+    }
+
+    // The first font is the default, ImGui's own font takes its place if it failed
+    if (io.Fonts->Fonts.empty()) {
+        m_Fonts[0] = io.Fonts->AddFontDefault();
+    }
+
+    if (!io.Fonts->Build()) {
+        TVK_LOG_ERROR("Failed to build the font atlas");
+        return false;
+    }
+
+    if (m_Config.fontCachePath != nullptr) {
+        SaveFontCache(key);
+    }
+    return true;
+}
+
+ImFont* ImGuiLayer::AddFontSource(const FontSource& source) {
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImFontConfig fontConfig;
+    fontConfig.FontDataOwnedByAtlas = false;
+
+    ImFont* font = nullptr;
+    if (source.font.empty()) {
+        fontConfig.SizePixels = source.size;
+        font = io.Fonts->AddFontDefault(&fontConfig);
+    } else if (const EmbeddedFont* embedded = FindEmbeddedFont(source.font.c_str())) {
+        font = io.Fonts->AddFontFromMemoryTTF(const_cast<unsigned char*>(embedded->data), static_cast<int>(embedded->size),
+                                              source.size, &fontConfig);
+        TVK_LOG_DEBUG("Loaded embedded font: {}", source.font);
+    } else if (std::filesystem::exists(source.font)) {
+        font = io.Fonts->AddFontFromFileTTF(source.font.c_str(), source.size);
+    } else {
+        TVK_LOG_ERROR("Font is neither embedded nor a file: {}", source.font);
+        return nullptr;
+    }
+
+    if (font == nullptr || !source.icons) return font;
+
+    const EmbeddedFont* icons = FindEmbeddedFont("fa_solid_900");
+    if (icons == nullptr) {
+        TVK_LOG_WARN("Font Awesome is not embedded, icons are not available");
+        return font;
+    }
+
+    static const ImWchar icons_ranges[] = { ICON_MIN_FA, ICON_MAX_FA, 0 };
+    ImFontConfig icons_config;
+    icons_config.MergeMode = true;
+    icons_config.PixelSnapH = true;
+    icons_config.FontDataOwnedByAtlas = false;
+    icons_config.GlyphMinAdvanceX = source.size;
+    io.Fonts->AddFontFromMemoryTTF(const_cast<unsigned char*>(icons->data), static_cast<int>(icons->size),
+                                   source.size, &icons_config, icons_ranges);
+    return font;
+}
+
+namespace {
+
+constexpr u32 FontCacheMagic = 0x464B5654;   // "TVKF"
+constexpr u32 FontCacheVersion = 1;
+
+struct FontCacheHeader {
+    u32 magic = FontCacheMagic;
+    u32 version = FontCacheVersion;
+    u64 key = 0;
+    i32 texWidth = 0;
+    i32 texHeight = 0;
+    u32 fontCount = 0;
+    u32 sourceCount = 0;
+    u32 rectCount = 0;
+    i32 packIdMouseCursors = -1;
+    i32 packIdLines = -1;
+    ImVec2 texUvScale;
+    ImVec2 texUvWhitePixel;
+    ImVec4 texUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];
+};
+
+/**
+ * @brief Metrics of one atlas font, the glyphs follow it in the file
+ */
+struct FontCacheFont {
+    float fontSize = 0.0f;
+    float scale = 1.0f;
+    float ascent = 0.0f;
+    float descent = 0.0f;
+    i32 metricsTotalSurface = 0;
+    u32 fallbackChar = 0;
+    u32 ellipsisChar = 0;
+    u32 glyphCount = 0;
+};
+
+// FNV-1a
+void HashBytes(u64& hash, const void* data, size_t size) {
+    const u8* bytes = static_cast<const u8*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+}
+
+template<typename T>
+void HashValue(u64& hash, const T& value) {
+    HashBytes(hash, &value, sizeof(T));
+}
+
+template<typename T>
+void WriteValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool ReadValue(std::ifstream& file, T& value) {
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // namespace
+
+u64 ImGuiLayer::GetFontCacheKey() const {
+    u64 hash = 14695981039346656037ull;
+
+    // Glyph and pixel layouts are those of the ImGui build writing the cache
+    HashValue(hash, static_cast<u32>(IMGUI_VERSION_NUM));
+    HashValue(hash, sizeof(ImFontGlyph));
+    HashValue(hash, sizeof(ImFontAtlasCustomRect));
+    HashValue(hash, m_Config.fontScale);
+
+    for (const auto& source : m_FontSources) {
+        HashBytes(hash, source.font.data(), source.font.size());
+        HashValue(hash, source.size);
+        HashValue(hash, source.icons);
+
+        // A changed font file or a build embedding other fonts invalidates the cache
+        if (source.font.empty()) continue;
+        if (const EmbeddedFont* embedded = FindEmbeddedFont(source.font.c_str())) {
+            HashValue(hash, embedded->size);
+        } else {
+            std::error_code error;
+            auto size = std::filesystem::file_size(source.font, error);
+            auto time = std::filesystem::last_write_time(source.font, error).time_since_epoch().count();
+            HashValue(hash, static_cast<u64>(size));
+            HashValue(hash, static_cast<i64>(time));
+        }
+        if (source.icons) {
+            HashValue(hash, FindEmbeddedFont("fa_solid_900") != nullptr);
+        }
+    }
+    return hash;
+}
+
+bool ImGuiLayer::LoadFontCache(u64 key) {
+    std::ifstream file(m_Config.fontCachePath, std::ios::binary | std::ios::ate);
+    if (!file) return false;
+
+    // Sizes from the file are checked against what is left of it before allocating
+    std::streamoff remaining = file.tellg();
+    file.seekg(0);
+    auto consume = [&remaining](size_t size) {
+        if (remaining < 0 || static_cast<u64>(remaining) < size) return false;
+        remaining -= static_cast<std::streamoff>(size);
+        return true;
+    };
+
+    FontCacheHeader header;
+    if (!consume(sizeof(header)) || !ReadValue(file, header) || header.magic != FontCacheMagic || header.version != FontCacheVersion ||
+        header.key != key || header.sourceCount != m_FontSources.size() || header.fontCount == 0 ||
+        header.fontCount > 1024 || header.rectCount > 65536 || header.texWidth <= 0 || header.texHeight <= 0 ||
+        header.texWidth > 16384 || header.texHeight > 16384) {
+        return false;
+    }
+
+    // ImGui indexes CustomRects with the pack ids when drawing cursors and lines
+    auto validPackId = [&header](i32 id) { return id == -1 || (id >= 0 && static_cast<u32>(id) < header.rectCount); };
+    if (!validPackId(header.packIdMouseCursors) || !validPackId(header.packIdLines)) {
+        TVK_LOG_WARN("Font cache {} is invalid, rebuilding it", m_Config.fontCachePath);
+        return false;
+    }
+
+    size_t pixelCount = static_cast<size_t>(header.texWidth) * static_cast<size_t>(header.texHeight);
+    if (!consume(sizeof(i32) * header.sourceCount + sizeof(ImFontAtlasCustomRect) * header.rectCount +
+                 sizeof(FontCacheFont) * header.fontCount + pixelCount)) {
+        TVK_LOG_WARN("Font cache {} is truncated, rebuilding it", m_Config.fontCachePath);
+        return false;
+    }
+
+    std::vector<i32> sourceFonts(header.sourceCount);
+    std::vector<ImFontAtlasCustomRect> rects(header.rectCount);
+    std::vector<FontCacheFont> fonts(header.fontCount);
+    std::vector<std::vector<ImFontGlyph>> glyphs(header.fontCount);
+
+    file.read(reinterpret_cast<char*>(sourceFonts.data()), sizeof(i32) * sourceFonts.size());
+    file.read(reinterpret_cast<char*>(rects.data()), sizeof(ImFontAtlasCustomRect) * rects.size());
+    for (u32 i = 0; i < header.fontCount && file; i++) {
+        if (!ReadValue(file, fonts[i]) || fonts[i].glyphCount > (1u << 20) ||
+            fonts[i].fallbackChar > IM_UNICODE_CODEPOINT_MAX || fonts[i].ellipsisChar > IM_UNICODE_CODEPOINT_MAX ||
+            !consume(sizeof(ImFontGlyph) * fonts[i].glyphCount)) {
+            file.setstate(std::ios::failbit);
+            break;
+        }
+        glyphs[i].resize(fonts[i].glyphCount);
+        file.read(reinterpret_cast<char*>(glyphs[i].data()), sizeof(ImFontGlyph) * glyphs[i].size());
+
+        // BuildLookupTable() indexes its tables by codepoint
+        for (const auto& glyph : glyphs[i]) {
+            if (glyph.Codepoint > IM_UNICODE_CODEPOINT_MAX) {
+                file.setstate(std::ios::failbit);
+                break;
+            }
+        }
+    }
+
+    if (!file) {
+        TVK_LOG_WARN("Font cache {} is invalid, rebuilding it", m_Config.fontCachePath);
+        return false;
+    }
+
+    unsigned char* pixels = static_cast<unsigned char*>(IM_ALLOC(pixelCount));
+    if (!file.read(reinterpret_cast<char*>(pixels), static_cast<std::streamsize>(pixelCount))) {
+        IM_FREE(pixels);
+        TVK_LOG_WARN("Font cache {} is truncated, rebuilding it", m_Config.fontCachePath);
+        return false;
+    }
+
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    atlas->Clear();
+
+    // Sources are gone, the configs only describe the fonts to ImGui
+    for (u32 i = 0; i < header.fontCount; i++) {
+        ImFontConfig config;
+        config.FontDataOwnedByAtlas = false;
+        config.SizePixels = fonts[i].fontSize;
+        std::snprintf(config.Name, sizeof(config.Name), "Cached font %u", i);
+        atlas->ConfigData.push_back(config);
+    }
+
+    for (u32 i = 0; i < header.fontCount; i++) {
+        ImFont* font = IM_NEW(ImFont)();
+        font->ContainerAtlas = atlas;
+        font->ConfigData = &atlas->ConfigData[i];
+        font->ConfigDataCount = 1;
+        font->FontSize = fonts[i].fontSize;
+        font->Scale = fonts[i].scale;
+        font->Ascent = fonts[i].ascent;
+        font->Descent = fonts[i].descent;
+        font->MetricsTotalSurface = fonts[i].metricsTotalSurface;
+        font->FallbackChar = static_cast<ImWchar>(fonts[i].fallbackChar);
+        font->EllipsisChar = static_cast<ImWchar>(fonts[i].ellipsisChar);
+        font->Glyphs.resize(static_cast<int>(glyphs[i].size()));
+        std::memcpy(font->Glyphs.Data, glyphs[i].data(), sizeof(ImFontGlyph) * glyphs[i].size());
+        font->BuildLookupTable();
+
+        atlas->ConfigData[i].DstFont = font;
+        atlas->Fonts.push_back(font);
+    }
+
+    atlas->CustomRects.resize(static_cast<int>(rects.size()));
+    if (!rects.empty()) {
+        std::memcpy(atlas->CustomRects.Data, rects.data(), sizeof(ImFontAtlasCustomRect) * rects.size());
+    }
+    atlas->PackIdMouseCursors = header.packIdMouseCursors;
+    atlas->PackIdLines = header.packIdLines;
+
+    atlas->TexPixelsAlpha8 = pixels;
+    atlas->TexWidth = header.texWidth;
+    atlas->TexHeight = header.texHeight;
+    atlas->TexUvScale = header.texUvScale;
+    atlas->TexUvWhitePixel = header.texUvWhitePixel;
+    std::memcpy(atlas->TexUvLines, header.texUvLines, sizeof(header.texUvLines));
+    atlas->TexReady = true;
+
+    m_Fonts.assign(m_FontSources.size(), nullptr);
+    for (size_t i = 0; i < sourceFonts.size(); i++) {
+        if (sourceFonts[i] >= 0 && sourceFonts[i] < atlas->Fonts.Size) {
+            m_Fonts[i] = atlas->Fonts[sourceFonts[i]];
+        }
+    }
+    return true;
+}
+
+void ImGuiLayer::SaveFontCache(u64 key) {
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+
+    unsigned char* pixels = nullptr;
+    int width = 0;
+    int height = 0;
+    atlas->GetTexDataAsAlpha8(&pixels, &width, &height);
+    if (pixels == nullptr || atlas->TexPixelsUseColors) return;
+
+    std::ofstream file(m_Config.fontCachePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        TVK_LOG_WARN("Failed to write font cache {}", m_Config.fontCachePath);
+        return;
+    }
+
+    FontCacheHeader header;
+    header.key = key;
+    header.texWidth = width;
+    header.texHeight = height;
+    header.fontCount = static_cast<u32>(atlas->Fonts.Size);
+    header.sourceCount = static_cast<u32>(m_FontSources.size());
+    header.rectCount = static_cast<u32>(atlas->CustomRects.Size);
+    header.packIdMouseCursors = atlas->PackIdMouseCursors;
+    header.packIdLines = atlas->PackIdLines;
+    header.texUvScale = atlas->TexUvScale;
+    header.texUvWhitePixel = atlas->TexUvWhitePixel;
+    std::memcpy(header.texUvLines, atlas->TexUvLines, sizeof(header.texUvLines));
+    WriteValue(file, header);
+
+    for (ImFont* font : m_Fonts) {
+        i32 index = -1;
+        for (i32 i = 0; i < atlas->Fonts.Size && font; i++) {
+            if (atlas->Fonts[i] == font) index = i;
+        }
+        WriteValue(file, index);
+    }
+
+    // Rects only point at fonts for custom glyphs, which are not part of the cache
+    for (ImFontAtlasCustomRect rect : atlas->CustomRects) {
+        rect.Font = nullptr;
+        WriteValue(file, rect);
+    }
+
+    for (ImFont* font : atlas->Fonts) {
+        FontCacheFont cached;
+        cached.fontSize = font->FontSize;
+        cached.scale = font->Scale;
+        cached.ascent = font->Ascent;
+        cached.descent = font->Descent;
+        cached.metricsTotalSurface = font->MetricsTotalSurface;
+        cached.fallbackChar = font->FallbackChar;
+        cached.ellipsisChar = font->EllipsisChar;
+        cached.glyphCount = static_cast<u32>(font->Glyphs.Size);
+        WriteValue(file, cached);
+        file.write(reinterpret_cast<const char*>(font->Glyphs.Data), sizeof(ImFontGlyph) * font->Glyphs.Size);
+    }
+
+    file.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(width) * height);
+    if (!file) {
+        TVK_LOG_WARN("Failed to write font cache {}", m_Config.fontCachePath);
+        return;
+    }
+    TVK_LOG_DEBUG("Wrote font atlas to {}", m_Config.fontCachePath);
+}
+
 bool ImGuiLayer::WantsCaptureKeyboard() const {
     return ImGui::GetIO().WantCaptureKeyboard;
 }
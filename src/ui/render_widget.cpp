@@ -5,6 +5,7 @@
 
 #include "tinyvk/ui/render_widget.h"
 #include "tinyvk/renderer/renderer.h"
+#include "tinyvk/core/application.h"
 #include "tinyvk/core/log.h"
 
 #include <imgui.h>
@@ -14,6 +15,10 @@
 
 namespace tvk {
 
+static u32 RoundUpToStep(u32 size) {
+    return (size + RenderWidget::ResizeStep - 1) / RenderWidget::ResizeStep * RenderWidget::ResizeStep;
+}
+
 RenderWidget::RenderWidget() {
 }
 
@@ -39,17 +44,24 @@ void RenderWidget::Initialize(Renderer* renderer) {
         return;
     }
     
+    // One command buffer per frame in flight, reused once the renderer waited on that frame
+    _commandBuffers.resize(_renderer->GetMaxFramesInFlight());
+    
     VkCommandBufferAllocateInfo allocInfo{};
     allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     allocInfo.commandPool = _commandPool;
     allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandBufferCount = 1;
+    allocInfo.commandBufferCount = static_cast<u32>(_commandBuffers.size());
     
-    if (vkAllocateCommandBuffers(device, &allocInfo, &_commandBuffer) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to create RenderWidget command buffer");
+    if (vkAllocateCommandBuffers(device, &allocInfo, _commandBuffers.data()) != VK_SUCCESS) {
+        TVK_LOG_ERROR("Failed to create RenderWidget command buffers");
+        _commandBuffers.clear();
         return;
     }
     
+    // Render pass free when supported, pipelines then only depend on the attachment formats
+    _dynamicRendering = ctx.IsDynamicRenderingSupported();
+    
     CreateRenderTarget();
     
     OnRenderInit();
@@ -60,16 +72,16 @@ void RenderWidget::Initialize(Renderer* renderer) {
 void RenderWidget::Render(float deltaTime) {
     if (!_initialized || !_enabled) return;
     
+    ReleaseRetiredTargets();
+    
     if (_needsResize) {
         RecreateRenderTarget();
-        _needsResize = false;
     }
     
     OnRenderUpdate(deltaTime);
     
-    auto& ctx = _renderer->GetContext();
-    VkDevice device = ctx.GetDevice();
-    
+    _currentTarget = _renderer->GetCurrentFrameIndex();
+    _commandBuffer = _commandBuffers[_currentTarget];
     vkResetCommandBuffer(_commandBuffer, 0);
     
     VkCommandBufferBeginInfo beginInfo{};
@@ -77,21 +89,23 @@ void RenderWidget::Render(float deltaTime) {
     beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     
     if (vkBeginCommandBuffer(_commandBuffer, &beginInfo) == VK_SUCCESS) {
-        OnRenderFrame(_commandBuffer);
+        {
+            GpuScope scope(_renderer->GetGpuProfiler(), _commandBuffer, "Render Widget");
+            OnRenderFrame(_commandBuffer);
+        }
         vkEndCommandBuffer(_commandBuffer);
         
-        VkSubmitInfo submitInfo{};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &_commandBuffer;
-        
-        vkQueueSubmit(ctx.GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
-        vkQueueWaitIdle(ctx.GetGraphicsQueue());
+        // Runs after the frame's uploads and before ImGui samples the result,
+        // ordered by the render pass dependencies
+        _renderer->SubmitWithFrame(_commandBuffer);
     }
 }
 
 void RenderWidget::RenderImage() {
-    if (_imguiTexture == VK_NULL_HANDLE) return;
+    // ImGui draws after this frame's widget pass, so show the target it renders into
+    u32 slot = _renderer ? _renderer->GetCurrentFrameIndex() : 0;
+    if (slot >= _targets.size() || _targets[slot].imguiTexture == VK_NULL_HANDLE) return;
+    VkDescriptorSet imguiTexture = _targets[slot].imguiTexture;
     
     ImVec2 contentRegion = ImGui::GetContentRegionAvail();
     
@@ -102,12 +116,15 @@ void RenderWidget::RenderImage() {
         newWidth = std::max(newWidth, 32u);
         newHeight = std::max(newHeight, 32u);
         
+        // Within the current attachments the new size is rendered this frame already
         if (newWidth != _width || newHeight != _height) {
             SetSize(newWidth, newHeight);
-            return;
+            if (_needsResize) return;
         }
         
-        ImGui::Image((ImTextureID)_imguiTexture, contentRegion);
+        ImVec2 uvMax(static_cast<float>(_width) / static_cast<float>(_targetWidth),
+                     static_cast<float>(_height) / static_cast<float>(_targetHeight));
+        ImGui::Image((ImTextureID)imguiTexture, contentRegion, ImVec2(0.0f, 0.0f), uvMax);
     }
 }
 
@@ -124,6 +141,7 @@ void RenderWidget::Cleanup() {
     if (_commandPool != VK_NULL_HANDLE) {
         vkDestroyCommandPool(device, _commandPool, nullptr);
         _commandPool = VK_NULL_HANDLE;
+        _commandBuffers.clear();
         _commandBuffer = VK_NULL_HANDLE;
     }
     
@@ -131,11 +149,24 @@ void RenderWidget::Cleanup() {
 }
 
 void RenderWidget::SetSize(u32 width, u32 height) {
-    if (_width != width || _height != height) {
-        _width = width;
-        _height = height;
+    if (_width == width && _height == height) return;
+    
+    _width = width;
+    _height = height;
+    
+    // Reallocate when the region no longer fits or the attachments became more than twice too large
+    bool grow = width > _targetWidth || height > _targetHeight;
+    bool shrink = RoundUpToStep(width) * 2 <= _targetWidth || RoundUpToStep(height) * 2 <= _targetHeight;
+    if (grow || shrink) {
         _needsResize = true;
-        OnRenderResize(width, height);
+    }
+    
+    OnRenderResize(width, height);
+}
+
+void RenderWidget::RequestRedraw() {
+    if (App* app = App::Get()) {
+        app->RequestRedraw();
     }
 }
 
@@ -143,24 +174,93 @@ VulkanContext* RenderWidget::GetContext() {
     return _renderer ? &_renderer->GetContext() : nullptr;
 }
 
+PipelineDesc RenderWidget::MakePipelineDesc(std::string vertShaderSource, std::string fragShaderSource) const {
+    PipelineDesc desc;
+    desc.vertexShader = std::move(vertShaderSource);
+    desc.fragmentShader = std::move(fragShaderSource);
+    if (_dynamicRendering) {
+        desc.colorFormat = GetColorFormat();
+        desc.depthFormat = GetDepthFormat();
+    } else {
+        desc.renderPass = _renderPass;
+    }
+    return desc;
+}
+
 void RenderWidget::BeginRenderPass(VkCommandBuffer cmd) {
-    if (_renderPass == VK_NULL_HANDLE || _framebuffer == VK_NULL_HANDLE) return;
+    if (_currentTarget >= _targets.size()) return;
     
-    VkRenderPassBeginInfo renderPassInfo{};
-    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass = _renderPass;
-    renderPassInfo.framebuffer = _framebuffer;
-    renderPassInfo.renderArea.offset = {0, 0};
-    renderPassInfo.renderArea.extent = {_width, _height};
+    const RenderTarget& target = _targets[_currentTarget];
     
     std::array<VkClearValue, 2> clearValues{};
     clearValues[0].color = {{_clearColor[0], _clearColor[1], _clearColor[2], _clearColor[3]}};
     clearValues[1].depthStencil = {1.0f, 0};
     
-    renderPassInfo.clearValueCount = static_cast<u32>(clearValues.size());
-    renderPassInfo.pClearValues = clearValues.data();
-    
-    vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    if (_dynamicRendering) {
+        if (target.renderImageView == VK_NULL_HANDLE || target.depthImageView == VK_NULL_HANDLE) return;
+        
+        // Same dependency as the render pass, earlier frames using the target were waited on by the renderer
+        std::array<VkImageMemoryBarrier, 2> barriers{};
+        barriers[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barriers[0].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barriers[0].newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        barriers[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[0].image = target.renderImage;
+        barriers[0].subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        barriers[0].srcAccessMask = 0;
+        barriers[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        
+        barriers[1] = barriers[0];
+        barriers[1].newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        barriers[1].image = target.depthImage;
+        barriers[1].subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        barriers[1].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        
+        VkPipelineStageFlags stages = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        vkCmdPipelineBarrier(cmd, stages, stages, 0, 0, nullptr, 0, nullptr,
+                             static_cast<u32>(barriers.size()), barriers.data());
+        
+        VkRenderingAttachmentInfoKHR colorAttachment{};
+        colorAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        colorAttachment.imageView = target.renderImageView;
+        colorAttachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAttachment.clearValue = clearValues[0];
+        
+        VkRenderingAttachmentInfoKHR depthAttachment{};
+        depthAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+        depthAttachment.imageView = target.depthImageView;
+        depthAttachment.imageLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.clearValue = clearValues[1];
+        
+        VkRenderingInfoKHR renderingInfo{};
+        renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.renderArea.offset = {0, 0};
+        renderingInfo.renderArea.extent = {_width, _height};
+        renderingInfo.layerCount = 1;
+        renderingInfo.colorAttachmentCount = 1;
+        renderingInfo.pColorAttachments = &colorAttachment;
+        renderingInfo.pDepthAttachment = &depthAttachment;
+        
+        _renderer->GetContext().CmdBeginRendering(cmd, renderingInfo);
+    } else {
+        if (_renderPass == VK_NULL_HANDLE || target.framebuffer == VK_NULL_HANDLE) return;
+        
+        VkRenderPassBeginInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassInfo.renderPass = _renderPass;
+        renderPassInfo.framebuffer = target.framebuffer;
+        renderPassInfo.renderArea.offset = {0, 0};
+        renderPassInfo.renderArea.extent = {_width, _height};
+        renderPassInfo.clearValueCount = static_cast<u32>(clearValues.size());
+        renderPassInfo.pClearValues = clearValues.data();
+        
+        vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    }
     
     VkViewport viewport{};
     viewport.x = 0.0f;
@@ -178,7 +278,27 @@ void RenderWidget::BeginRenderPass(VkCommandBuffer cmd) {
 }
 
 void RenderWidget::EndRenderPass(VkCommandBuffer cmd) {
-    vkCmdEndRenderPass(cmd);
+    if (!_dynamicRendering) {
+        vkCmdEndRenderPass(cmd);
+        return;
+    }
+    
+    if (_currentTarget >= _targets.size()) return;
+    _renderer->GetContext().CmdEndRendering(cmd);
+    
+    // The color result is visible to ImGui sampling it later in the frame
+    VkImageMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = _targets[_currentTarget].renderImage;
+    barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &barrier);
 }
 
 void RenderWidget::CreateRenderPass() {
@@ -187,10 +307,10 @@ void RenderWidget::CreateRenderPass() {
     auto& ctx = _renderer->GetContext();
     VkDevice device = ctx.GetDevice();
     
-    VkFormat depthFormat = VK_FORMAT_D32_SFLOAT;
+    VkFormat depthFormat = GetDepthFormat();
     
     VkAttachmentDescription colorAttachment{};
-    colorAttachment.format = VK_FORMAT_R8G8B8A8_UNORM;
+    colorAttachment.format = GetColorFormat();
     colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
     colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
     colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
@@ -223,13 +343,23 @@ void RenderWidget::CreateRenderPass() {
     subpass.pColorAttachments = &colorAttachmentRef;
     subpass.pDepthStencilAttachment = &depthAttachmentRef;
     
-    VkSubpassDependency dependency{};
-    dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-    dependency.dstSubpass = 0;
-    dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-    dependency.srcAccessMask = 0;
-    dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-    dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    std::array<VkSubpassDependency, 2> dependencies{};
+    
+    // Each frame in flight has its own target, earlier frames using it were waited on by the renderer
+    dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[0].dstSubpass = 0;
+    dependencies[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependencies[0].srcAccessMask = 0;
+    dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    
+    // The color result is visible to ImGui sampling it later in the frame
+    dependencies[1].srcSubpass = 0;
+    dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
     
     std::array<VkAttachmentDescription, 2> attachments = {colorAttachment, depthAttachment};
     VkRenderPassCreateInfo renderPassInfo{};
@@ -238,105 +368,75 @@ void RenderWidget::CreateRenderPass() {
     renderPassInfo.pAttachments = attachments.data();
     renderPassInfo.subpassCount = 1;
     renderPassInfo.pSubpasses = &subpass;
-    renderPassInfo.dependencyCount = 1;
-    renderPassInfo.pDependencies = &dependency;
+    renderPassInfo.dependencyCount = static_cast<u32>(dependencies.size());
+    renderPassInfo.pDependencies = dependencies.data();
     
     vkCreateRenderPass(device, &renderPassInfo, nullptr, &_renderPass);
 }
 
-void RenderWidget::CreateSampler() {
+void RenderWidget::CreateSizeDependentResources() {
     if (!_renderer) return;
     
-    auto& ctx = _renderer->GetContext();
-    VkDevice device = ctx.GetDevice();
+    // Rounded up so that small resizes keep the attachments
+    _targetWidth = RoundUpToStep(_width);
+    _targetHeight = RoundUpToStep(_height);
+    _needsResize = false;
     
-    VkSamplerCreateInfo samplerInfo{};
-    samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-    samplerInfo.magFilter = VK_FILTER_LINEAR;
-    samplerInfo.minFilter = VK_FILTER_LINEAR;
-    samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-    samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-    samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
-    samplerInfo.anisotropyEnable = VK_FALSE;
-    samplerInfo.maxAnisotropy = 1.0f;
-    samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
-    samplerInfo.unnormalizedCoordinates = VK_FALSE;
-    samplerInfo.compareEnable = VK_FALSE;
-    samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
-    samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-    
-    if (vkCreateSampler(device, &samplerInfo, nullptr, &_sampler) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to create render widget sampler");
+    // One target per frame in flight so ImGui can sample frame N while frame N+1 is rendered
+    _targets.resize(_renderer->GetMaxFramesInFlight());
+    for (auto& target : _targets) {
+        CreateTarget(target);
     }
 }
 
-void RenderWidget::CreateSizeDependentResources() {
-    if (!_renderer) return;
-    
+void RenderWidget::CreateTarget(RenderTarget& target) {
     auto& ctx = _renderer->GetContext();
     VkDevice device = ctx.GetDevice();
     
     VkImageCreateInfo imageInfo{};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     imageInfo.imageType = VK_IMAGE_TYPE_2D;
-    imageInfo.extent.width = _width;
-    imageInfo.extent.height = _height;
+    imageInfo.extent.width = _targetWidth;
+    imageInfo.extent.height = _targetHeight;
     imageInfo.extent.depth = 1;
     imageInfo.mipLevels = 1;
     imageInfo.arrayLayers = 1;
-    imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    imageInfo.format = GetColorFormat();
     imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
     imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
     imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     
-    if (vkCreateImage(device, &imageInfo, nullptr, &_renderImage) != VK_SUCCESS) {
+    if (!ctx.GetAllocator().CreateImage(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                        target.renderImage, target.renderImageAllocation)) {
         TVK_LOG_ERROR("Failed to create render widget image");
         return;
     }
     
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(device, _renderImage, &memRequirements);
-    
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = ctx.FindMemoryType(
-        memRequirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
-    
-    if (vkAllocateMemory(device, &allocInfo, nullptr, &_renderImageMemory) != VK_SUCCESS) {
-        TVK_LOG_ERROR("Failed to allocate render widget image memory");
-        return;
-    }
-    
-    vkBindImageMemory(device, _renderImage, _renderImageMemory, 0);
-    
     VkImageViewCreateInfo viewInfo{};
     viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-    viewInfo.image = _renderImage;
+    viewInfo.image = target.renderImage;
     viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-    viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+    viewInfo.format = GetColorFormat();
     viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     viewInfo.subresourceRange.baseMipLevel = 0;
     viewInfo.subresourceRange.levelCount = 1;
     viewInfo.subresourceRange.baseArrayLayer = 0;
     viewInfo.subresourceRange.layerCount = 1;
     
-    if (vkCreateImageView(device, &viewInfo, nullptr, &_renderImageView) != VK_SUCCESS) {
+    if (vkCreateImageView(device, &viewInfo, nullptr, &target.renderImageView) != VK_SUCCESS) {
         TVK_LOG_ERROR("Failed to create render widget image view");
         return;
     }
     
-    VkFormat depthFormat = VK_FORMAT_D32_SFLOAT;
+    VkFormat depthFormat = GetDepthFormat();
     
     VkImageCreateInfo depthImageInfo{};
     depthImageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
     depthImageInfo.imageType = VK_IMAGE_TYPE_2D;
-    depthImageInfo.extent.width = _width;
-    depthImageInfo.extent.height = _height;
+    depthImageInfo.extent.width = _targetWidth;
+    depthImageInfo.extent.height = _targetHeight;
     depthImageInfo.extent.depth = 1;
     depthImageInfo.mipLevels = 1;
     depthImageInfo.arrayLayers = 1;
@@ -347,25 +447,15 @@ void RenderWidget::CreateSizeDependentResources() {
     depthImageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
     depthImageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
     
-    vkCreateImage(device, &depthImageInfo, nullptr, &_depthImage);
-    
-    VkMemoryRequirements depthMemRequirements;
-    vkGetImageMemoryRequirements(device, _depthImage, &depthMemRequirements);
-    
-    VkMemoryAllocateInfo depthAllocInfo{};
-    depthAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    depthAllocInfo.allocationSize = depthMemRequirements.size;
-    depthAllocInfo.memoryTypeIndex = ctx.FindMemoryType(
-        depthMemRequirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
-    
-    vkAllocateMemory(device, &depthAllocInfo, nullptr, &_depthImageMemory);
-    vkBindImageMemory(device, _depthImage, _depthImageMemory, 0);
+    if (!ctx.GetAllocator().CreateImage(depthImageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                        target.depthImage, target.depthImageAllocation)) {
+        TVK_LOG_ERROR("Failed to create render widget depth image");
+        return;
+    }
     
     VkImageViewCreateInfo depthViewInfo{};
     depthViewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
-    depthViewInfo.image = _depthImage;
+    depthViewInfo.image = target.depthImage;
     depthViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
     depthViewInfo.format = depthFormat;
     depthViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
@@ -374,73 +464,97 @@ void RenderWidget::CreateSizeDependentResources() {
     depthViewInfo.subresourceRange.baseArrayLayer = 0;
     depthViewInfo.subresourceRange.layerCount = 1;
     
-    vkCreateImageView(device, &depthViewInfo, nullptr, &_depthImageView);
-    
-    std::array<VkImageView, 2> fbAttachments = {_renderImageView, _depthImageView};
+    vkCreateImageView(device, &depthViewInfo, nullptr, &target.depthImageView);
     
-    VkFramebufferCreateInfo framebufferInfo{};
-    framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-    framebufferInfo.renderPass = _renderPass;
-    framebufferInfo.attachmentCount = static_cast<u32>(fbAttachments.size());
-    framebufferInfo.pAttachments = fbAttachments.data();
-    framebufferInfo.width = _width;
-    framebufferInfo.height = _height;
-    framebufferInfo.layers = 1;
-    
-    vkCreateFramebuffer(device, &framebufferInfo, nullptr, &_framebuffer);
+    if (!_dynamicRendering) {
+        std::array<VkImageView, 2> fbAttachments = {target.renderImageView, target.depthImageView};
+        
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = _renderPass;
+        framebufferInfo.attachmentCount = static_cast<u32>(fbAttachments.size());
+        framebufferInfo.pAttachments = fbAttachments.data();
+        framebufferInfo.width = _targetWidth;
+        framebufferInfo.height = _targetHeight;
+        framebufferInfo.layers = 1;
+        
+        vkCreateFramebuffer(device, &framebufferInfo, nullptr, &target.framebuffer);
+    }
     
-    _imguiTexture = ImGui_ImplVulkan_AddTexture(_sampler, _renderImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    // Headless renderers run without ImGui, the widget only renders
+    if (!_renderer->IsHeadless()) {
+        target.imguiTexture = ImGui_ImplVulkan_AddTexture(_sampler, target.renderImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
 }
 
 void RenderWidget::CleanupSizeDependentResources() {
     if (!_renderer) return;
     
-    VkDevice device = _renderer->GetContext().GetDevice();
-    
-    if (_imguiTexture != VK_NULL_HANDLE) {
-        ImGui_ImplVulkan_RemoveTexture(_imguiTexture);
-        _imguiTexture = VK_NULL_HANDLE;
+    for (auto& target : _targets) {
+        DestroyTarget(target);
     }
+    _targets.clear();
+}
+
+void RenderWidget::DestroyTarget(RenderTarget& target) {
+    auto& ctx = _renderer->GetContext();
+    VkDevice device = ctx.GetDevice();
     
-    if (_framebuffer != VK_NULL_HANDLE) {
-        vkDestroyFramebuffer(device, _framebuffer, nullptr);
-        _framebuffer = VK_NULL_HANDLE;
+    if (target.imguiTexture != VK_NULL_HANDLE) {
+        ImGui_ImplVulkan_RemoveTexture(target.imguiTexture);
+        target.imguiTexture = VK_NULL_HANDLE;
     }
     
-    if (_depthImageView != VK_NULL_HANDLE) {
-        vkDestroyImageView(device, _depthImageView, nullptr);
-        _depthImageView = VK_NULL_HANDLE;
+    if (target.framebuffer != VK_NULL_HANDLE) {
+        vkDestroyFramebuffer(device, target.framebuffer, nullptr);
+        target.framebuffer = VK_NULL_HANDLE;
     }
     
-    if (_depthImage != VK_NULL_HANDLE) {
-        vkDestroyImage(device, _depthImage, nullptr);
-        _depthImage = VK_NULL_HANDLE;
+    if (target.depthImageView != VK_NULL_HANDLE) {
+        vkDestroyImageView(device, target.depthImageView, nullptr);
+        target.depthImageView = VK_NULL_HANDLE;
     }
     
-    if (_depthImageMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(device, _depthImageMemory, nullptr);
-        _depthImageMemory = VK_NULL_HANDLE;
+    if (target.depthImage != VK_NULL_HANDLE || target.depthImageAllocation.IsValid()) {
+        ctx.GetAllocator().DestroyImage(target.depthImage, target.depthImageAllocation);
+        target.depthImage = VK_NULL_HANDLE;
     }
     
-    if (_renderImageView != VK_NULL_HANDLE) {
-        vkDestroyImageView(device, _renderImageView, nullptr);
-        _renderImageView = VK_NULL_HANDLE;
+    if (target.renderImageView != VK_NULL_HANDLE) {
+        vkDestroyImageView(device, target.renderImageView, nullptr);
+        target.renderImageView = VK_NULL_HANDLE;
     }
     
-    if (_renderImage != VK_NULL_HANDLE) {
-        vkDestroyImage(device, _renderImage, nullptr);
-        _renderImage = VK_NULL_HANDLE;
+    if (target.renderImage != VK_NULL_HANDLE || target.renderImageAllocation.IsValid()) {
+        ctx.GetAllocator().DestroyImage(target.renderImage, target.renderImageAllocation);
+        target.renderImage = VK_NULL_HANDLE;
     }
+}
+
+void RenderWidget::ReleaseRetiredTargets() {
+    u64 completed = _renderer->GetCompletedFrame();
     
-    if (_renderImageMemory != VK_NULL_HANDLE) {
-        vkFreeMemory(device, _renderImageMemory, nullptr);
-        _renderImageMemory = VK_NULL_HANDLE;
+    size_t released = 0;
+    while (released < _retiredTargets.size() && _retiredTargets[released].frame <= completed) {
+        DestroyTarget(_retiredTargets[released].target);
+        released++;
     }
+    _retiredTargets.erase(_retiredTargets.begin(), _retiredTargets.begin() + released);
 }
 
 void RenderWidget::CreateRenderTarget() {
-    CreateRenderPass();
-    CreateSampler();
+    if (!_renderer) return;
+
+    if (!_dynamicRendering) {
+        CreateRenderPass();
+    }
+
+    SamplerDesc samplerDesc;
+    samplerDesc.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerDesc.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    samplerDesc.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+    _sampler = _renderer->GetContext().GetSamplerCache().Acquire(samplerDesc);
+
     CreateSizeDependentResources();
 }
 
@@ -451,13 +565,18 @@ void RenderWidget::CleanupRenderTarget() {
     
     CleanupSizeDependentResources();
     
+    for (auto& retired : _retiredTargets) {
+        DestroyTarget(retired.target);
+    }
+    _retiredTargets.clear();
+    
     if (_renderPass != VK_NULL_HANDLE) {
         vkDestroyRenderPass(device, _renderPass, nullptr);
         _renderPass = VK_NULL_HANDLE;
     }
     
     if (_sampler != VK_NULL_HANDLE) {
-        vkDestroySampler(device, _sampler, nullptr);
+        _renderer->GetContext().GetSamplerCache().Release(_sampler);
         _sampler = VK_NULL_HANDLE;
     }
 }
@@ -465,9 +584,12 @@ void RenderWidget::CleanupRenderTarget() {
 void RenderWidget::RecreateRenderTarget() {
     if (!_renderer) return;
     
-    _renderer->GetContext().WaitIdle();
+    // Frames in flight and this frame's ImGui draw data may still use the old targets
+    for (auto& target : _targets) {
+        _retiredTargets.push_back({target, _renderer->GetFrameNumber()});
+    }
+    _targets.clear();
     
-    CleanupSizeDependentResources();
     CreateSizeDependentResources();
 }
 
@@ -0,0 +1,641 @@
+/**
+ * @file bench.cpp
+ * @brief Headless benchmark suite writing frame and GPU times as JSON
+ *
+ * Usage: tinyvk_bench [options]
+ *   --frames <count>     Measured frames per scenario (default 300)
+ *   --warmup <count>     Frames run before measuring (default 30)
+ *   --width <pixels>     Offscreen target width (default 1280)
+ *   --height <pixels>    Offscreen target height (default 720)
+ *   --scenario <filter>  Only run scenarios whose name contains the filter
+ *   --output <path>      Write the results to a JSON file instead of stdout
+ *                        (without it the log goes to stderr)
+ *   --validation         Enable the validation layers
+ *   --list               Print the scenario names and exit
+ *
+ * Every scenario runs on its own headless Renderer, so results do not depend
+ * on the order or on a display. Frame times are measured on the CPU from
+ * BeginFrame() to the end of EndFrame(), GPU times are the GpuProfiler scopes
+ * of the same frames.
+ */
+
+#include <tinyvk/tinyvk.h>
+#include "tinyvk/renderer/pipeline.h"
+#include "tinyvk/renderer/shaders.h"
+#include "tinyvk/renderer/buffer.h"
+#include "tinyvk/renderer/renderer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BenchOptions {
+    tvk::u32 frames = 300;
+    tvk::u32 warmup = 30;
+    tvk::u32 width = 1280;
+    tvk::u32 height = 720;
+    std::string filter;
+    std::string output;
+    bool validation = false;
+    bool list = false;
+};
+
+void PrintUsage() {
+    std::cout << "Usage: tinyvk_bench [--frames <count>] [--warmup <count>] [--width <pixels>] "
+                 "[--height <pixels>] [--scenario <filter>] [--output <path>] [--validation] [--list]" << std::endl;
+}
+
+bool ParseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--frames") == 0 && i + 1 < argc) {
+            options.frames = static_cast<tvk::u32>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(arg, "--warmup") == 0 && i + 1 < argc) {
+            options.warmup = static_cast<tvk::u32>(std::max(0, std::atoi(argv[++i])));
+        } else if (std::strcmp(arg, "--width") == 0 && i + 1 < argc) {
+            options.width = static_cast<tvk::u32>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(arg, "--height") == 0 && i + 1 < argc) {
+            options.height = static_cast<tvk::u32>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(arg, "--scenario") == 0 && i + 1 < argc) {
+            options.filter = argv[++i];
+        } else if (std::strcmp(arg, "--output") == 0 && i + 1 < argc) {
+            options.output = argv[++i];
+        } else if (std::strcmp(arg, "--validation") == 0) {
+            options.validation = true;
+        } else if (std::strcmp(arg, "--list") == 0) {
+            options.list = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+glm::mat4 MakeViewProjection(float aspect, float distance) {
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.0f, distance), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 proj = glm::perspective(glm::radians(45.0f), aspect, 0.1f, distance * 4.0f);
+    proj[1][1] *= -1;
+    return proj * view;
+}
+
+/**
+ * @brief Workload recorded into every frame of a benchmark run
+ */
+class BenchScenario {
+public:
+    virtual ~BenchScenario() = default;
+
+    virtual bool Init(tvk::Renderer& renderer) = 0;
+
+    /**
+     * @brief Record the frame's work, called between BeginFrame() and EndFrame()
+     */
+    virtual void Frame(tvk::Renderer& renderer, tvk::u32 frame) = 0;
+
+    /**
+     * @brief Release resources, the device is idle
+     */
+    virtual void Cleanup() {}
+
+    // Bytes moved to the GPU per frame, reported as throughput when non-zero
+    virtual tvk::u64 GetBytesPerFrame() const { return 0; }
+};
+
+/**
+ * @brief Device local buffer overwritten through the staging ring every frame
+ */
+class BufferUploadScenario : public BenchScenario {
+public:
+    // Every frame in flight holds one upload in the 32 MB staging ring, it never fills and flushes inside the scope
+    static constexpr tvk::u64 UploadSize = 8ull * 1024 * 1024;
+
+    bool Init(tvk::Renderer& renderer) override {
+        m_Data.resize(UploadSize / sizeof(tvk::u32));
+        for (size_t i = 0; i < m_Data.size(); i++) {
+            m_Data[i] = static_cast<tvk::u32>(i * 2654435761u);
+        }
+        m_Buffer = tvk::Buffer::Create(&renderer, UploadSize, tvk::BufferUsage::Storage);
+        return m_Buffer != nullptr;
+    }
+
+    void Frame(tvk::Renderer& renderer, tvk::u32) override {
+        tvk::GpuScope scope(renderer.GetGpuProfiler(), renderer.GetUploadCommandBuffer(), "Upload", false);
+        m_Buffer->SetData(m_Data.data(), UploadSize);
+    }
+
+    void Cleanup() override { m_Buffer.reset(); }
+
+    tvk::u64 GetBytesPerFrame() const override { return UploadSize; }
+
+private:
+    std::vector<tvk::u32> m_Data;
+    tvk::Ref<tvk::Buffer> m_Buffer;
+};
+
+/**
+ * @brief RGBA8 texture with mipmaps created from memory every frame
+ */
+class TextureLoadScenario : public BenchScenario {
+public:
+    static constexpr tvk::u32 Size = 1024;
+
+    bool Init(tvk::Renderer& renderer) override {
+        m_Pixels.resize(static_cast<size_t>(Size) * Size * 4);
+        for (tvk::u32 y = 0; y < Size; y++) {
+            for (tvk::u32 x = 0; x < Size; x++) {
+                tvk::u8* pixel = &m_Pixels[(static_cast<size_t>(y) * Size + x) * 4];
+                pixel[0] = static_cast<tvk::u8>(x);
+                pixel[1] = static_cast<tvk::u8>(y);
+                pixel[2] = static_cast<tvk::u8>(((x / 64) + (y / 64)) % 2 ? 255 : 0);
+                pixel[3] = 255;
+            }
+        }
+        return true;
+    }
+
+    void Frame(tvk::Renderer& renderer, tvk::u32) override {
+        // Released outside the scope once their frame completed, destroying them never waits for the device
+        while (!m_Textures.empty() && m_Textures.front().frame <= renderer.GetCompletedFrame()) {
+            if (m_Textures.front().texture) {
+                m_Textures.front().texture->SkipWaitIdleOnCleanup();
+            }
+            m_Textures.pop_front();
+        }
+
+        tvk::GpuScope scope(renderer.GetGpuProfiler(), renderer.GetUploadCommandBuffer(), "Texture Upload", false);
+        m_Textures.push_back({tvk::Texture::Create(&renderer, m_Pixels.data(), Size, Size), renderer.GetFrameNumber()});
+    }
+
+    void Cleanup() override { m_Textures.clear(); }
+
+    tvk::u64 GetBytesPerFrame() const override { return m_Pixels.size(); }
+
+private:
+    struct FrameTexture {
+        tvk::Ref<tvk::Texture> texture;
+        tvk::u64 frame = 0;   // Frame whose upload commands created it
+    };
+
+    std::vector<tvk::u8> m_Pixels;
+    std::deque<FrameTexture> m_Textures;
+};
+
+/**
+ * @brief Grid of cubes, one draw call each, in the main pass
+ */
+class MeshDrawScenario : public BenchScenario {
+public:
+    explicit MeshDrawScenario(tvk::u32 drawCount) : m_DrawCount(drawCount) {}
+
+    bool Init(tvk::Renderer& renderer) override {
+        m_Mesh = tvk::Geometry::CreateCube(&renderer, 1.0f);
+        m_Pipeline = tvk::CreateScope<tvk::Pipeline>();
+        if (!m_Mesh || !m_Pipeline->Create(&renderer, renderer.GetRenderPass(), tvk::shaders::basic_vert, tvk::shaders::basic_frag)) {
+            return false;
+        }
+
+        tvk::u32 side = static_cast<tvk::u32>(std::ceil(std::sqrt(static_cast<float>(m_DrawCount))));
+        float spacing = 1.5f;
+        float offset = (static_cast<float>(side) - 1.0f) * spacing * 0.5f;
+        m_Models.reserve(m_DrawCount);
+        for (tvk::u32 i = 0; i < m_DrawCount; i++) {
+            glm::vec3 position(static_cast<float>(i % side) * spacing - offset, static_cast<float>(i / side) * spacing - offset, 0.0f);
+            m_Models.push_back(glm::translate(glm::mat4(1.0f), position));
+        }
+        m_Distance = std::max(3.0f, static_cast<float>(side) * spacing * 1.3f);
+        return true;
+    }
+
+    void Frame(tvk::Renderer& renderer, tvk::u32 frame) override {
+        VkCommandBuffer cmd = renderer.GetCurrentCommandBuffer();
+        VkExtent2D extent = renderer.GetSwapchainExtent();
+
+        tvk::PushConstants push;
+        push.view_projection = MakeViewProjection(static_cast<float>(extent.width) / static_cast<float>(extent.height), m_Distance);
+        glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::radians(static_cast<float>(frame)), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        m_Pipeline->Bind(cmd);
+        for (const glm::mat4& model : m_Models) {
+            push.model = model * rotation;
+            m_Pipeline->SetPushConstants(cmd, push);
+            m_Mesh->Draw(cmd);
+        }
+    }
+
+    void Cleanup() override {
+        m_Pipeline->Destroy();
+        m_Mesh.reset();
+    }
+
+private:
+    tvk::u32 m_DrawCount;
+    float m_Distance = 3.0f;
+    std::vector<glm::mat4> m_Models;
+    tvk::Scope<tvk::Mesh> m_Mesh;
+    tvk::Scope<tvk::Pipeline> m_Pipeline;
+};
+
+/**
+ * @brief array_multiply over a million floats every frame
+ * Recorded into the upload commands on the graphics queue, so the GPU time is
+ * measured by the scope on every device, with or without a compute queue
+ */
+class ComputeDispatchScenario : public BenchScenario {
+public:
+    static constexpr tvk::u32 ElementCount = 1024 * 1024;
+
+    struct PushData {
+        tvk::u32 count;
+        float multiplier;
+    };
+
+    bool Init(tvk::Renderer& renderer) override {
+        std::vector<float> input(ElementCount);
+        for (tvk::u32 i = 0; i < ElementCount; i++) {
+            input[i] = static_cast<float>(i);
+        }
+
+        m_Input = tvk::Buffer::Create(&renderer, sizeof(float) * ElementCount, tvk::BufferUsage::Storage, input.data());
+        m_Output = tvk::Buffer::Create(&renderer, sizeof(float) * ElementCount, tvk::BufferUsage::Storage);
+        m_Pipeline = tvk::CreateScope<tvk::ComputePipeline>();
+        if (!m_Input || !m_Output || !m_Pipeline->Create(&renderer, tvk::shaders::array_multiply_comp)) {
+            return false;
+        }
+
+        m_Pipeline->BindStorageBuffers(m_Input.get(), m_Output.get());
+        m_Pipeline->UpdateDescriptors();
+        return true;
+    }
+
+    void Frame(tvk::Renderer& renderer, tvk::u32 frame) override {
+        VkCommandBuffer cmd = renderer.GetUploadCommandBuffer();
+        tvk::GpuScope scope(renderer.GetGpuProfiler(), cmd, "Compute");
+
+        PushData push;
+        push.count = ElementCount;
+        push.multiplier = 1.0f + static_cast<float>(frame % 8);
+
+        // The input copy from Init() may share this command buffer, and the previous
+        // frame's dispatch wrote the output
+        VkBufferMemoryBarrier barriers[2]{};
+        barriers[0].sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barriers[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        barriers[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[0].buffer = m_Input->GetBuffer();
+        barriers[0].size = VK_WHOLE_SIZE;
+        barriers[1] = barriers[0];
+        barriers[1].srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barriers[1].dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barriers[1].buffer = m_Output->GetBuffer();
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 2, barriers, 0, nullptr);
+
+        m_Pipeline->Bind(cmd);
+        m_Pipeline->SetPushConstants(cmd, push);
+        m_Pipeline->Dispatch(cmd, (ElementCount + 255) / 256, 1, 1);
+    }
+
+    void Cleanup() override {
+        m_Pipeline->Destroy();
+        m_Input.reset();
+        m_Output.reset();
+    }
+
+private:
+    tvk::Ref<tvk::Buffer> m_Input;
+    tvk::Ref<tvk::Buffer> m_Output;
+    tvk::Scope<tvk::ComputePipeline> m_Pipeline;
+};
+
+class CubeWidget : public tvk::RenderWidget {
+protected:
+    void OnRenderInit() override {
+        m_Mesh = tvk::Geometry::CreateCube(GetRenderer(), 1.0f);
+        m_Pipeline = tvk::CreateScope<tvk::Pipeline>();
+        if (!m_Pipeline->Create(GetRenderer(), MakePipelineDesc(tvk::shaders::basic_vert, tvk::shaders::basic_frag))) {
+            TVK_LOG_ERROR("Failed to create widget pipeline");
+            m_Pipeline.reset();
+        }
+        SetAnimating(true);
+    }
+
+    void OnRenderFrame(VkCommandBuffer cmd) override {
+        BeginRenderPass(cmd);
+        if (m_Pipeline && m_Mesh) {
+            tvk::PushConstants push;
+            push.model = glm::rotate(glm::mat4(1.0f), glm::radians(m_Rotation), glm::vec3(0.0f, 1.0f, 0.0f));
+            push.view_projection = MakeViewProjection(static_cast<float>(GetWidth()) / static_cast<float>(GetHeight()), 3.0f);
+
+            m_Pipeline->Bind(cmd);
+            m_Pipeline->SetPushConstants(cmd, push);
+            m_Mesh->Draw(cmd);
+        }
+        EndRenderPass(cmd);
+    }
+
+    void OnRenderUpdate(float deltaTime) override {
+        m_Rotation += deltaTime * 45.0f;
+    }
+
+    void OnRenderCleanup() override {
+        if (m_Pipeline) m_Pipeline->Destroy();
+        m_Mesh.reset();
+    }
+
+private:
+    float m_Rotation = 0.0f;
+    tvk::Scope<tvk::Mesh> m_Mesh;
+    tvk::Scope<tvk::Pipeline> m_Pipeline;
+};
+
+/**
+ * @brief Render widgets with their own targets and command buffers, one cube each
+ */
+class WidgetScalingScenario : public BenchScenario {
+public:
+    static constexpr tvk::u32 WidgetSize = 256;
+
+    explicit WidgetScalingScenario(tvk::u32 widgetCount) : m_WidgetCount(widgetCount) {}
+
+    bool Init(tvk::Renderer& renderer) override {
+        for (tvk::u32 i = 0; i < m_WidgetCount; i++) {
+            auto widget = tvk::CreateScope<CubeWidget>();
+            widget->Initialize(&renderer);
+            widget->SetSize(WidgetSize, WidgetSize);
+            if (!widget->IsInitialized()) return false;
+            m_Widgets.push_back(std::move(widget));
+        }
+        return true;
+    }
+
+    void Frame(tvk::Renderer&, tvk::u32) override {
+        for (auto& widget : m_Widgets) {
+            widget->Render(1.0f / 60.0f);
+        }
+    }
+
+    void Cleanup() override {
+        for (auto& widget : m_Widgets) {
+            widget->Cleanup();
+        }
+        m_Widgets.clear();
+    }
+
+private:
+    tvk::u32 m_WidgetCount;
+    std::vector<tvk::Scope<CubeWidget>> m_Widgets;
+};
+
+struct ScenarioEntry {
+    std::string name;
+    std::function<tvk::Scope<BenchScenario>()> create;
+};
+
+std::vector<ScenarioEntry> GetScenarios() {
+    std::vector<ScenarioEntry> scenarios;
+    scenarios.push_back({"buffer_upload", []() { return tvk::Scope<BenchScenario>(new BufferUploadScenario()); }});
+    scenarios.push_back({"texture_load", []() { return tvk::Scope<BenchScenario>(new TextureLoadScenario()); }});
+    for (tvk::u32 count : {100u, 1000u, 10000u}) {
+        scenarios.push_back({"mesh_draws_" + std::to_string(count),
+                             [count]() { return tvk::Scope<BenchScenario>(new MeshDrawScenario(count)); }});
+    }
+    scenarios.push_back({"compute_dispatch", []() { return tvk::Scope<BenchScenario>(new ComputeDispatchScenario()); }});
+    for (tvk::u32 count : {1u, 4u, 16u}) {
+        scenarios.push_back({"widgets_" + std::to_string(count),
+                             [count]() { return tvk::Scope<BenchScenario>(new WidgetScalingScenario(count)); }});
+    }
+    return scenarios;
+}
+
+struct TimeSummary {
+    double mean = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+};
+
+TimeSummary Summarize(std::vector<double> samples) {
+    TimeSummary summary;
+    if (samples.empty()) return summary;
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double p) {
+        size_t index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+        return samples[std::min(index, samples.size() - 1)];
+    };
+
+    double sum = 0.0;
+    for (double sample : samples) sum += sample;
+    summary.mean = sum / static_cast<double>(samples.size());
+    summary.p50 = percentile(0.50);
+    summary.p95 = percentile(0.95);
+    summary.p99 = percentile(0.99);
+    summary.min = samples.front();
+    summary.max = samples.back();
+    return summary;
+}
+
+struct ScenarioResult {
+    std::string name;
+    bool ok = false;
+    tvk::u32 frames = 0;
+    TimeSummary frameMs;
+    std::map<std::string, TimeSummary> gpuMs;   // Per GpuProfiler scope name
+    double throughputMBs = 0.0;
+};
+
+ScenarioResult RunScenario(const ScenarioEntry& entry, const BenchOptions& options, std::string& deviceName) {
+    ScenarioResult result;
+    result.name = entry.name;
+
+    tvk::RendererConfig config;
+    config.enableValidation = options.validation;
+    config.headlessExtent = {options.width, options.height};
+
+    tvk::Renderer renderer;
+    if (!renderer.Init(nullptr, config)) {
+        TVK_LOG_ERROR("Failed to initialize the headless renderer");
+        return result;
+    }
+
+    if (deviceName.empty()) {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(renderer.GetContext().GetPhysicalDevice(), &properties);
+        deviceName = properties.deviceName;
+    }
+
+    tvk::Scope<BenchScenario> scenario = entry.create();
+    if (!scenario->Init(renderer)) {
+        TVK_LOG_ERROR("Failed to initialize scenario {}", entry.name);
+        renderer.GetContext().WaitIdle();
+        scenario->Cleanup();
+        renderer.Cleanup();
+        return result;
+    }
+
+    std::vector<double> frameSamples;
+    std::map<std::string, std::vector<double>> gpuSamples;
+    frameSamples.reserve(options.frames);
+
+    tvk::u32 totalFrames = options.warmup + options.frames;
+    tvk::u32 framesInFlight = renderer.GetFramesInFlight();
+    double measuredSeconds = 0.0;
+
+    // GPU results of frame i arrive when its slot is reused, a few frames past the loop
+    for (tvk::u32 i = 0; i < totalFrames + framesInFlight; i++) {
+        auto start = std::chrono::steady_clock::now();
+        if (!renderer.BeginFrame()) continue;
+
+        // Results of the frame that last used this slot
+        if (i >= options.warmup + framesInFlight) {
+            for (const auto& scope : renderer.GetGpuProfiler().GetResults()) {
+                gpuSamples[scope.name].push_back(scope.timeMs);
+            }
+        }
+
+        if (i < totalFrames) {
+            scenario->Frame(renderer, i);
+        }
+        renderer.EndFrame();
+
+        if (i >= options.warmup && i < totalFrames) {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            frameSamples.push_back(seconds * 1000.0);
+            measuredSeconds += seconds;
+        }
+    }
+
+    renderer.GetContext().WaitIdle();
+    scenario->Cleanup();
+    renderer.Cleanup();
+
+    result.ok = true;
+    result.frames = static_cast<tvk::u32>(frameSamples.size());
+    result.frameMs = Summarize(std::move(frameSamples));
+    for (auto& [name, samples] : gpuSamples) {
+        result.gpuMs[name] = Summarize(std::move(samples));
+    }
+    if (scenario->GetBytesPerFrame() > 0 && measuredSeconds > 0.0) {
+        double bytes = static_cast<double>(scenario->GetBytesPerFrame()) * static_cast<double>(result.frames);
+        result.throughputMBs = bytes / (1024.0 * 1024.0) / measuredSeconds;
+    }
+    return result;
+}
+
+void WriteJsonString(std::ostream& out, const std::string& value) {
+    out << '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') out << '\\';
+        if (static_cast<unsigned char>(c) >= 0x20) out << c;
+    }
+    out << '"';
+}
+
+void WriteSummary(std::ostream& out, const TimeSummary& summary) {
+    out << "{\"mean\": " << summary.mean << ", \"p50\": " << summary.p50 << ", \"p95\": " << summary.p95
+        << ", \"p99\": " << summary.p99 << ", \"min\": " << summary.min << ", \"max\": " << summary.max << "}";
+}
+
+void WriteResults(std::ostream& out, const std::string& deviceName, const BenchOptions& options,
+                  const std::vector<ScenarioResult>& results) {
+    out << "{\n  \"device\": ";
+    WriteJsonString(out, deviceName);
+    out << ",\n  \"width\": " << options.width << ",\n  \"height\": " << options.height;
+    out << ",\n  \"warmupFrames\": " << options.warmup << ",\n  \"scenarios\": [";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const ScenarioResult& result = results[i];
+        out << (i > 0 ? ",\n" : "\n") << "    {\"name\": ";
+        WriteJsonString(out, result.name);
+        out << ", \"ok\": " << (result.ok ? "true" : "false") << ", \"frames\": " << result.frames;
+        out << ",\n     \"frameMs\": ";
+        WriteSummary(out, result.frameMs);
+        out << ",\n     \"gpuMs\": {";
+
+        bool first = true;
+        for (const auto& [name, summary] : result.gpuMs) {
+            out << (first ? "" : ", ");
+            WriteJsonString(out, name);
+            out << ": ";
+            WriteSummary(out, summary);
+            first = false;
+        }
+        out << "}";
+        if (result.throughputMBs > 0.0) {
+            out << ",\n     \"throughputMBs\": " << result.throughputMBs;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<ScenarioEntry> scenarios = GetScenarios();
+    if (options.list) {
+        for (const auto& scenario : scenarios) {
+            std::cout << scenario.name << std::endl;
+        }
+        return 0;
+    }
+
+    // Keep stdout to the results unless they go to a file
+    if (options.output.empty()) {
+        tvk::LogConfig logConfig;
+        logConfig.consoleStderr = true;
+        tvk::Log::Init(logConfig);
+    }
+
+    std::string deviceName;
+    std::vector<ScenarioResult> results;
+    for (const auto& scenario : scenarios) {
+        if (!options.filter.empty() && scenario.name.find(options.filter) == std::string::npos) continue;
+
+        TVK_LOG_INFO("Running {}", scenario.name);
+        results.push_back(RunScenario(scenario, options, deviceName));
+
+        const ScenarioResult& result = results.back();
+        if (result.ok) {
+            TVK_LOG_INFO("  {}: {} ms mean, {} ms p95", scenario.name, result.frameMs.mean, result.frameMs.p95);
+        }
+    }
+
+    if (results.empty()) {
+        TVK_LOG_ERROR("No scenario matches {}", options.filter);
+        return 1;
+    }
+
+    if (options.output.empty()) {
+        WriteResults(std::cout, deviceName, options, results);
+    } else {
+        std::ofstream file(options.output, std::ios::trunc);
+        if (!file) {
+            TVK_LOG_ERROR("Failed to open {}", options.output);
+            return 1;
+        }
+        WriteResults(file, deviceName, options, results);
+        TVK_LOG_INFO("Wrote results to {}", options.output);
+    }
+
+    bool failed = std::any_of(results.begin(), results.end(), [](const ScenarioResult& result) { return !result.ok; });
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file mesh_converter.cpp
+ * @brief Offline converter from Wavefront OBJ to the binary .tvkmesh format
+ *
+ * Usage: mesh_converter <input.obj> <output.tvkmesh> [options]
+ *   --compact           Store VertexCompact (24 bytes) instead of Vertex (44 bytes)
+ *   --lods <count>      Number of levels of detail including the full mesh (default 1)
+ *   --lod-distance <d>  Camera distance at which LOD 1 starts (default 10)
+ *   --no-optimize       Keep the vertex and triangle order of the source
+ */
+
+#include <tinyvk/tinyvk.h>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct ConvertOptions {
+    std::string input;
+    std::string output;
+    bool compact = false;
+    bool optimize = true;
+    tvk::u32 lodCount = 1;
+    float lodDistance = 10.0f;
+};
+
+void PrintUsage() {
+    std::cout << "Usage: mesh_converter <input.obj> <output.tvkmesh> [--compact] [--lods <count>] "
+                 "[--lod-distance <distance>] [--no-optimize]" << std::endl;
+}
+
+bool ParseOptions(int argc, char** argv, ConvertOptions& options) {
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--compact") == 0) {
+            options.compact = true;
+        } else if (std::strcmp(arg, "--no-optimize") == 0) {
+            options.optimize = false;
+        } else if (std::strcmp(arg, "--lods") == 0 && i + 1 < argc) {
+            options.lodCount = static_cast<tvk::u32>(std::max(1, std::atoi(argv[++i])));
+        } else if (std::strcmp(arg, "--lod-distance") == 0 && i + 1 < argc) {
+            options.lodDistance = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg[0] == '-') {
+            return false;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    if (positional.size() != 2) return false;
+    options.input = positional[0];
+    options.output = positional[1];
+    return true;
+}
+
+// OBJ indices are 1 based, negative ones count back from the last element read so far
+int ResolveIndex(int index, size_t count) {
+    if (index > 0) return index - 1;
+    if (index < 0) return static_cast<int>(count) + index;
+    return -1;
+}
+
+struct ObjCorner {
+    int position = -1;
+    int texCoord = -1;
+    int normal = -1;
+
+    bool operator==(const ObjCorner& other) const {
+        return position == other.position && texCoord == other.texCoord && normal == other.normal;
+    }
+};
+
+struct ObjCornerHash {
+    size_t operator()(const ObjCorner& corner) const {
+        size_t hash = std::hash<int>()(corner.position);
+        hash ^= std::hash<int>()(corner.texCoord) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<int>()(corner.normal) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+/**
+ * @brief Read positions, texture coordinates, normals and faces, polygons are fan triangulated
+ * Corners sharing position, texture coordinate and normal become one vertex
+ */
+bool LoadObj(const std::string& path, std::vector<tvk::Vertex>& vertices, std::vector<tvk::u32>& indices) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        TVK_LOG_ERROR("Failed to open {}", path);
+        return false;
+    }
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> texCoords;
+    std::vector<glm::vec3> normals;
+    std::unordered_map<ObjCorner, tvk::u32, ObjCornerHash> corners;
+    std::vector<tvk::u32> face;
+    bool hasNormals = true;
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        std::string type;
+        stream >> type;
+
+        if (type == "v") {
+            glm::vec3 position(0.0f);
+            stream >> position.x >> position.y >> position.z;
+            positions.push_back(position);
+        } else if (type == "vt") {
+            glm::vec2 texCoord(0.0f);
+            stream >> texCoord.x >> texCoord.y;
+            // OBJ has the origin at the bottom left, Vulkan samples from the top left
+            texCoords.push_back(glm::vec2(texCoord.x, 1.0f - texCoord.y));
+        } else if (type == "vn") {
+            glm::vec3 normal(0.0f);
+            stream >> normal.x >> normal.y >> normal.z;
+            normals.push_back(normal);
+        } else if (type == "f") {
+            face.clear();
+
+            std::string token;
+            while (stream >> token) {
+                ObjCorner corner;
+                int values[3] = {0, 0, 0};
+                size_t start = 0;
+                for (int slot = 0; slot < 3 && start <= token.size(); slot++) {
+                    size_t end = token.find('/', start);
+                    std::string part = token.substr(start, end == std::string::npos ? std::string::npos : end - start);
+                    if (!part.empty()) values[slot] = std::atoi(part.c_str());
+                    if (end == std::string::npos) break;
+                    start = end + 1;
+                }
+
+                corner.position = ResolveIndex(values[0], positions.size());
+                corner.texCoord = ResolveIndex(values[1], texCoords.size());
+                corner.normal = ResolveIndex(values[2], normals.size());
+
+                if (corner.position < 0 || corner.position >= static_cast<int>(positions.size()) ||
+                    corner.texCoord >= static_cast<int>(texCoords.size()) ||
+                    corner.normal >= static_cast<int>(normals.size())) {
+                    TVK_LOG_ERROR("Invalid face index in {}: {}", path, line);
+                    return false;
+                }
+
+                auto it = corners.find(corner);
+                if (it == corners.end()) {
+                    tvk::Vertex vertex{};
+                    vertex.position = positions[corner.position];
+                    vertex.normal = corner.normal >= 0 ? normals[corner.normal] : glm::vec3(0.0f);
+                    vertex.texCoord = corner.texCoord >= 0 ? texCoords[corner.texCoord] : glm::vec2(0.0f);
+                    vertex.color = glm::vec3(1.0f);
+                    hasNormals = hasNormals && corner.normal >= 0;
+
+                    it = corners.emplace(corner, static_cast<tvk::u32>(vertices.size())).first;
+                    vertices.push_back(vertex);
+                }
+                face.push_back(it->second);
+            }
+
+            for (size_t i = 2; i < face.size(); i++) {
+                indices.push_back(face[0]);
+                indices.push_back(face[i - 1]);
+                indices.push_back(face[i]);
+            }
+        }
+    }
+
+    // Smooth normals from the faces when the file has none
+    if (!hasNormals) {
+        for (auto& vertex : vertices) {
+            vertex.normal = glm::vec3(0.0f);
+        }
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            tvk::Vertex& a = vertices[indices[i]];
+            tvk::Vertex& b = vertices[indices[i + 1]];
+            tvk::Vertex& c = vertices[indices[i + 2]];
+            glm::vec3 normal = glm::cross(b.position - a.position, c.position - a.position);
+            a.normal += normal;
+            b.normal += normal;
+            c.normal += normal;
+        }
+        for (auto& vertex : vertices) {
+            float length = glm::length(vertex.normal);
+            vertex.normal = length > 0.0f ? vertex.normal / length : glm::vec3(0.0f, 1.0f, 0.0f);
+        }
+    }
+
+    if (vertices.empty() || indices.empty()) {
+        TVK_LOG_ERROR("No triangles in {}", path);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    ConvertOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    std::vector<tvk::Vertex> vertices;
+    std::vector<tvk::u32> indices;
+    if (!LoadObj(options.input, vertices, indices)) {
+        return 1;
+    }
+
+    if (options.optimize) {
+        tvk::MeshOptimizer::Optimize(vertices, indices);
+    }
+
+    std::vector<tvk::MeshLod> lods;
+    if (options.lodCount > 1) {
+        lods = tvk::MeshOptimizer::GenerateLods(vertices, indices, options.lodCount, options.lodDistance);
+    }
+
+    bool written = options.compact
+        ? tvk::MeshFile::Write(options.output, tvk::ConvertVertices<tvk::VertexCompact>(vertices), indices, lods)
+        : tvk::MeshFile::Write(options.output, vertices, indices, lods);
+    if (!written) {
+        return 1;
+    }
+
+    TVK_LOG_INFO("Wrote {}: {} vertices, {} indices, {} LODs", options.output,
+                 vertices.size(), indices.size(), std::max<size_t>(lods.size(), 1));
+    return 0;
+}